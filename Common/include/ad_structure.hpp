@@ -85,6 +85,11 @@ namespace AD{
    */
   void Reset();
 
+  /*!
+   * \brief Print the type and the statistics of the current tape (number of statements, adjoint vector size, memory).
+   */
+  void PrintStatistics();
+
   /*!
    * \brief Reset the variable (set index to zero).
    * \param[in] data - the variable to be unregistered from the tape.
@@ -92,6 +92,9 @@ namespace AD{
     }
   }
 
+  inline void PrintStatistics() {std::cout << "CoDiPack " << CODI_TAPE_NAME << ":" << std::endl;
+                                 AD::globalTape.printStatistics();}
+
   inline void SetPreaccIn(const su2double &data) {
     if (PreaccActive) {
       if (data.isActive()) {
@@ -182,6 +185,8 @@ namespace AD{
 
   inline void Reset() {}
 
+  inline void PrintStatistics() {}
+
   inline void ResetInput(su2double &data) {}
 
   inline void SetPreaccIn(const su2double &data) {}
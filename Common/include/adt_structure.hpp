@@ -245,6 +245,27 @@ protected:
   void BuildADT(unsigned short  nDim,
                 unsigned long   nPoints,
                 const su2double *coor);
+
+  /*!
+   * \brief Function, which refits the leaves of the ADT to new coordinates of
+            the points, while the topology of the tree is kept.
+   * \param[in] coor    New coordinates of the points, in the order of BuildADT.
+   */
+  void RefitADT(const su2double *coor);
+
+  /*!
+   * \brief Function, which determines the order of the given coordinates along a
+            space filling curve (Morton order), such that consecutive queries of a
+            batch are close to each other.
+   * \param[in]  nDimCoor Number of dimensions of the coordinates.
+   * \param[in]  nCoor    Number of coordinates.
+   * \param[in]  coor     The coordinates.
+   * \param[out] order    Indices of the coordinates in the order of the curve.
+   */
+  void SpaceFillingCurveOrder(const unsigned short  nDimCoor,
+                              const unsigned long   nCoor,
+                              const su2double       *coor,
+                              vector<unsigned long> &order) const;
 public:
   /*!
    * \brief Function, which returns whether or not the ADT is empty.
@@ -311,7 +332,38 @@ public:
                             su2double       &dist,
                             unsigned long   &pointID,
                             int             &rankID);
+
+  /*!
+   * \brief Function, which determines the nearest nodes in the ADT for a batch
+            of coordinates. The coordinates are processed along a space filling
+            curve and each search starts from the nearest node of the previous one.
+   * \param[in]  nCoor   Number of coordinates.
+   * \param[in]  coor    Coordinates for which the nearest nodes must be determined.
+   * \param[out] dist    Distances to the nearest nodes in the ADT.
+   * \param[out] pointID Local point IDs of the nearest nodes in the ADT.
+   * \param[out] rankID  Ranks on which the nearest nodes in the ADT are stored.
+   */
+  void DetermineNearestNodes(const unsigned long nCoor,
+                             const su2double     *coor,
+                             su2double           *dist,
+                             unsigned long       *pointID,
+                             int                 *rankID);
 private:
+  /*!
+   * \brief Function, which determines the nearest node in the ADT for the
+            given coordinate, starting from the given node of the ADT.
+   * \param[in]     coor     Coordinate for which the nearest node in the ADT must be determined.
+   * \param[out]    dist     Distance to the nearest node in the ADT.
+   * \param[out]    pointID  Local point ID of the nearest node in the ADT.
+   * \param[out]    rankID   Rank on which the nearest node in the ADT is stored.
+   * \param[in,out] minIndex Index in the ADT of the starting node and of the nearest node.
+   */
+  void DetermineNearestNode(const su2double *coor,
+                            su2double       &dist,
+                            unsigned long   &pointID,
+                            int             &rankID,
+                            unsigned long   &minIndex);
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -337,6 +389,7 @@ private:
 class CADTElemClass : public CADTBaseClass {
 private:
   unsigned short nDim; /*!< \brief Number of spatial dimensions. */
+  bool globalTree;     /*!< \brief Whether or not the tree contains the elements of all ranks. */
 
   vector<su2double>     coorPoints;    /*!< \brief Vector, which contains the coordinates
                                                    of the points in the ADT. */
@@ -421,8 +474,67 @@ public:
                                unsigned short  &markerID,
                                unsigned long   &elemID,
                                int             &rankID);
+
+  /*!
+   * \brief Function, which determines the nearest element in the ADT for the
+            given coordinate, starting from candidate elements. A good candidate,
+            e.g. the nearest element of a previous search, restricts the tree
+            traversal to the bounding boxes that are closer than the candidate.
+   * \param[in]  coor       Coordinate for which the nearest element in the ADT must be determined.
+   * \param[out] dist       Distance to the nearest element in the ADT.
+   * \param[out] markerID   Local marker ID of the nearest element in the ADT.
+   * \param[out] elemID     Local element ID of the nearest element in the ADT.
+   * \param[out] rankID     Rank on which the nearest element in the ADT is stored.
+   * \param[out] ADTElemID  ID of the nearest element in the ADT, to be used as candidate later.
+   * \param[in]  nGuess     Number of candidate elements.
+   * \param[in]  guessElems IDs of the candidate elements in the ADT.
+   */
+  void DetermineNearestElement(const su2double     *coor,
+                               su2double           &dist,
+                               unsigned short      &markerID,
+                               unsigned long       &elemID,
+                               int                 &rankID,
+                               unsigned long       &ADTElemID,
+                               const unsigned long nGuess,
+                               const unsigned long *guessElems);
+
+  /*!
+   * \brief Function, which updates the ADT for new coordinates of its points,
+            e.g. after a deformation of the mesh. The bounding boxes of the
+            elements are recomputed and the leaves are refitted in place.
+   * \param[in] val_coor  New coordinates of the local points, in the same order
+                          as given to the constructor.
+   */
+  void RefitElements(vector<su2double> &val_coor);
+
+  /*!
+   * \brief Function, which determines the nearest elements in the ADT for a batch
+            of coordinates. The coordinates are processed along a space filling
+            curve and the nearest element of the previous coordinate is the
+            candidate element of the next search.
+   * \param[in]  nCoor    Number of coordinates.
+   * \param[in]  coor     Coordinates for which the nearest elements must be determined.
+   * \param[out] dist     Distances to the nearest elements in the ADT.
+   * \param[out] markerID Local marker IDs of the nearest elements in the ADT.
+   * \param[out] elemID   Local element IDs of the nearest elements in the ADT.
+   * \param[out] rankID   Ranks on which the nearest elements in the ADT are stored.
+   * \param[out] ADTElemID IDs of the nearest elements in the ADT, may be NULL.
+   */
+  void DetermineNearestElements(const unsigned long nCoor,
+                                const su2double     *coor,
+                                su2double           *dist,
+                                unsigned short      *markerID,
+                                unsigned long       *elemID,
+                                int                 *rankID,
+                                unsigned long       *ADTElemID);
 private:
 
+  /*!
+   * \brief Function, which computes the bounding boxes of the elements from
+            the coordinates of the points.
+   */
+  void ComputeBBoxCoor(void);
+
   /*!
    * \brief Function, which checks whether or not the given coordinate is
             inside the given element.
@@ -0,0 +1,105 @@
+/*!
+ * \file anderson_acceleration.hpp
+ * \brief Headers of the Anderson acceleration of fixed-point iterations.
+ *        The functions are in the <i>anderson_acceleration.cpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+#include "./vector_structure.hpp"
+
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CAndersonAcceleration
+ * \brief Anderson acceleration (type II) of a fixed-point iteration x_{k+1} = G(x_k).
+ * \details The differences of the last iterates G(x_k) and of their residuals f_k = G(x_k) - x_k
+ *          are kept in distributed vectors. Each iteration the combination of the differences that
+ *          minimizes the residual is found with the normal equations of the small least-squares
+ *          problem, whose Gram matrix is updated with one reduction of the new column. With
+ *          the relaxation b, the next iterate is x_k + b f_k minus the same combination of the
+ *          differences of x + b f. The history is dropped when the Gram matrix is singular.
+ * \author SU2 contributors
+ */
+class CAndersonAcceleration {
+private:
+  unsigned short nDepth,       /*!< \brief Maximum number of differences kept. */
+  nCol;                        /*!< \brief Number of differences currently kept. */
+  su2double Relaxation;        /*!< \brief Relaxation (mixing) of the residual. */
+  
+  vector<CSysVector> Delta_Image,     /*!< \brief Differences of consecutive images G(x), oldest first. */
+  Delta_Residual;                     /*!< \brief Differences of consecutive residuals, oldest first. */
+  vector<su2double> Gram;             /*!< \brief Dot products of the residual differences, nDepth x nDepth. */
+  
+  CSysVector Iterate,          /*!< \brief Current iterate x_k, returned by the last call. */
+  Image_Old,                   /*!< \brief Image of the previous iterate. */
+  Residual_Old;                /*!< \brief Residual of the previous iterate. */
+  bool Has_Iterate,            /*!< \brief The current iterate is known. */
+  Has_Residual;                /*!< \brief The residual of the previous iterate is known. */
+  
+  /*!
+   * \brief Drop the oldest difference.
+   */
+  void DropOldest(void);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_depth - Maximum number of differences kept.
+   * \param[in] val_relaxation - Relaxation of the residual, 1 for the plain Anderson mixing.
+   */
+  CAndersonAcceleration(unsigned short val_depth, su2double val_relaxation);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CAndersonAcceleration(void);
+  
+  /*!
+   * \brief Forget the history, the next call starts a new sequence of iterates.
+   */
+  void Reset(void);
+  
+  /*!
+   * \brief Next iterate of the accelerated iteration. The first call of a sequence returns the image.
+   * \param[in,out] val_image - Image G(x_k) of the iterate returned by the last call, overwritten with x_{k+1}.
+   */
+  void Compute(CSysVector & val_image);
+  
+};
@@ -39,6 +39,7 @@
 /* LIBXSMM include files, if supported. */
 #ifdef HAVE_LIBXSMM
 #include "libxsmm.h"
+#include <map>
 #endif
 
 /*!
@@ -73,6 +74,19 @@ public:
             const su2double *A, const su2double *B, su2double *C,
             CConfig *config);
 
+  /*!
+   * \brief Function, which creates the kernel for the dense matrix product of
+            the given dimensions. The subsequent calls to gemm with these dimensions
+            call this kernel directly, i.e. without dispatching. Only the JIT kernels
+            of libxsmm are created, for the other implementations nothing is done.
+            As the kernels are stored in this object, this function must not be
+            called while gemm is called by other threads.
+   * \param[in]  M  - Number of rows of A and C.
+   * \param[in]  N  - Number of columns of B and C.
+   * \param[in]  K  - Number of columns of A and number of rows of B.
+   */
+  void CreateGemmKernel(const int M, const int N, const int K);
+
   /*!
    * \brief Function, which carries out a dense matrix vector product
             y = A x. It is a limited version of the BLAS gemv functionality.
@@ -101,6 +115,12 @@ public:
 
 private:
 
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  /* The JIT kernels of libxsmm created by CreateGemmKernel. The key
+     contains M, N and K of the matrix product. */
+  map<pair<int, pair<int, int> >, libxsmm_dmmfunction> gemmKernels;
+#endif
+
 #if !(defined(HAVE_LIBXSMM) || defined(HAVE_BLAS) || defined(HAVE_MKL)) || (defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
     /* Blocking parameters for the outer kernel.  We multiply mc x kc blocks of
      the matrix A with kc x nc panels of the matrix B (this approach is referred
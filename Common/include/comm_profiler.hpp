@@ -0,0 +1,148 @@
+/*!
+ * \file comm_profiler.hpp
+ * \brief Headers of the statistics of the MPI communication (COMM_PROFILING= YES).
+ *        The functions are in the <i>comm_profiler.cpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+
+#include <ctime>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CCommProfiler
+ * \brief Statistics of the halo exchanges and of the reductions of the linear solvers.
+ * \details The exchanges and reductions are grouped in categories, e.g. one per quantity of
+ *          the halo exchanges. For each category the number of calls, of messages and of bytes,
+ *          and the time spent waiting for the messages (or in the reduction) are accumulated,
+ *          next to the bytes sent to every rank (communication matrix) and the time of the
+ *          iterations. The statistics are written at the end of the run by the master rank.
+ *          All the communication goes through the calling thread, hence no locking is needed.
+ * \author SU2 contributors
+ */
+class CCommProfiler {
+private:
+  static bool Active;                       /*!< \brief Profiling of the communication requested in the config. */
+  
+  static map<string, unsigned short> Category_Map;  /*!< \brief Index of every category, by name. */
+  static vector<string> Category_Name;      /*!< \brief Name of every category, in the order of first use. */
+  static vector<bool> Category_Reduction;   /*!< \brief The category is a reduction (otherwise a halo exchange). */
+  static vector<unsigned long> Category_nCall,  /*!< \brief Number of calls of every category. */
+  Category_nMessage,                        /*!< \brief Number of messages sent by every category. */
+  Category_nByte;                           /*!< \brief Number of bytes sent by every category. */
+  static vector<double> Category_Time;      /*!< \brief Time spent waiting (or reducing) by every category. */
+  
+  static vector<unsigned long> Rank_nByte;  /*!< \brief Bytes sent to every rank. */
+  
+  static unsigned long nIter;               /*!< \brief Number of profiled iterations. */
+  static double Iter_Start,                 /*!< \brief Start time of the current iteration. */
+  Iter_Time,                                /*!< \brief Total time of the iterations. */
+  Iter_MaxTime,                             /*!< \brief Time of the slowest iteration. */
+  Iter_WaitTime,                            /*!< \brief Time spent waiting for halo messages during the iterations. */
+  Iter_ReductionTime,                       /*!< \brief Time spent in the reductions during the iterations. */
+  Total_WaitTime,                           /*!< \brief Time spent waiting for halo messages so far. */
+  Total_ReductionTime;                      /*!< \brief Time spent in the reductions so far. */
+  
+public:
+  
+  /*!
+   * \brief Enable or disable the profiling of the communication.
+   * \param[in] val_active - <code>TRUE</code> to collect the statistics.
+   */
+  static void SetActive(bool val_active);
+  
+  /*!
+   * \brief Get if the profiling of the communication is enabled.
+   * \return <code>TRUE</code> if the statistics are collected.
+   */
+  static bool GetActive(void);
+  
+  /*!
+   * \brief Wall clock time.
+   * \return Time in seconds.
+   */
+  static double GetTime(void);
+  
+  /*!
+   * \brief Get the index of a category, which is created the first time.
+   * \param[in] val_name - Name of the category.
+   * \param[in] val_reduction - <code>TRUE</code> for a reduction, <code>FALSE</code> for a halo exchange.
+   * \return Index of the category.
+   */
+  static unsigned short GetCategory(const string &val_name, bool val_reduction);
+  
+  /*!
+   * \brief Register a message sent by a category.
+   * \param[in] val_category - Index of the category.
+   * \param[in] val_rank - Destination rank.
+   * \param[in] val_nByte - Size of the message in bytes.
+   */
+  static void AddMessage(unsigned short val_category, int val_rank, unsigned long val_nByte);
+  
+  /*!
+   * \brief Register a call of a category and the time it spent waiting (or reducing).
+   * \param[in] val_category - Index of the category.
+   * \param[in] val_time - Time in seconds.
+   */
+  static void AddCall(unsigned short val_category, double val_time);
+  
+  /*!
+   * \brief Start the timing of an iteration.
+   */
+  static void BeginIteration(void);
+  
+  /*!
+   * \brief End the timing of an iteration, the time that was not spent waiting for
+   *        halo messages or in the reductions is the computation time.
+   */
+  static void EndIteration(void);
+  
+  /*!
+   * \brief Write the statistics of all ranks, gathered on the master rank: comm_profiling.csv
+   *        (categories), comm_ranks.csv (computation and wait time of every rank) and
+   *        comm_matrix.csv (bytes sent from the rank of the row to the rank of the column).
+   *        Must be called by all ranks.
+   */
+  static void WriteCSV(void);
+  
+};
+
+#include "comm_profiler.inl"
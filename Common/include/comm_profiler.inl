@@ -0,0 +1,67 @@
+/*!
+ * \file comm_profiler.inl
+ * \brief Inline subroutines of the <i>comm_profiler.hpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+inline bool CCommProfiler::GetActive(void) { return Active; }
+
+inline double CCommProfiler::GetTime(void) {
+#ifdef HAVE_MPI
+  return MPI_Wtime();
+#else
+  return double(clock())/double(CLOCKS_PER_SEC);
+#endif
+}
+
+inline void CCommProfiler::AddMessage(unsigned short val_category, int val_rank, unsigned long val_nByte) {
+  
+  Category_nMessage[val_category]++;
+  Category_nByte[val_category] += val_nByte;
+  
+  if (val_rank < int(Rank_nByte.size())) Rank_nByte[val_rank] += val_nByte;
+  
+}
+
+inline void CCommProfiler::AddCall(unsigned short val_category, double val_time) {
+  
+  Category_nCall[val_category]++;
+  Category_Time[val_category] += val_time;
+  
+  if (Category_Reduction[val_category]) Total_ReductionTime += val_time;
+  else Total_WaitTime += val_time;
+  
+}
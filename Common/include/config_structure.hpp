@@ -116,6 +116,8 @@ private:
   unsigned short FFD_Blending; /*!< \brief Kind of FFD Blending function. */
   su2double* FFD_BSpline_Order; /*!< \brief BSpline order in i,j,k direction. */
   su2double FFD_Tol;  	/*!< \brief Tolerance in the point inversion problem. */
+  bool FFD_Jacobian_Projection;  /*!< \brief Project the sensitivities using the FFD control point Jacobian. */
+  bool Dot_Surface_Only;         /*!< \brief SU2_DOT skips the volume preprocessing of the mesh. */
   su2double Opt_RelaxFactor;  	/*!< \brief Scale factor for the line search. */
   su2double Opt_LineSearch_Bound;  	/*!< \brief Bounds for the line search. */
   bool Write_Conv_FSI;			/*!< \brief Write convergence file for FSI problems. */
@@ -138,9 +140,14 @@ private:
   AdaptBoundary,			/*!< \brief Adapt the elements on the boundary. */
   SubsonicEngine,			/*!< \brief Engine intake subsonic region. */
   Frozen_Visc_Cont,			/*!< \brief Flag for cont. adjoint problem with/without frozen viscosity. */
+  Cont_Adj_Primal_Jacobian,  /*!< \brief Solve the cont. adjoint with the transposed Jacobian of the flow solver. */
   Frozen_Visc_Disc,			/*!< \brief Flag for disc. adjoint problem with/without frozen viscosity. */
   Frozen_Limiter_Disc,			/*!< \brief Flag for disc. adjoint problem with/without frozen limiter. */
   Inconsistent_Disc,      /*!< \brief Use an inconsistent (primal/dual) discrete adjoint formulation. */
+  DiscAdj_Krylov,         /*!< \brief Solve the steady discrete adjoint with FGMRES instead of the fixed-point iteration. */
+  DiscAdj_MultiGrid,      /*!< \brief Coarse grid correction of the steady discrete adjoint fixed-point iteration. */
+  DiscAdj_ObjSweep,       /*!< \brief Discrete adjoint of each objective function in turn, from the same recording. */
+  DiscAdj_Sens_Final,     /*!< \brief Record and evaluate the geometry tape of the steady discrete adjoint only once it is converged. */
   Sens_Remove_Sharp,			/*!< \brief Flag for removing or not the sharp edges from the sensitivity computation. */
   Hold_GridFixed,	/*!< \brief Flag hold fixed some part of the mesh during the deformation. */
   Axisymmetric, /*!< \brief Flag for axisymmetric calculations */
@@ -152,6 +159,8 @@ private:
   su2double Damp_Engine_Exhaust;	/*!< \brief Damping factor for the engine exhaust. */
   su2double Damp_Res_Restric,	/*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong; /*!< \brief Damping factor for the correction prolongation. */
+  bool MG_Interface_Agglomeration; /*!< \brief Agglomerate the points of the partition interfaces as interior points. */
+  bool MG_Adaptive_Cycle; /*!< \brief Adapt the smoothing sweeps, the cycle, and the depth of the multigrid at runtime. */
   su2double Position_Plane; /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd; /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL; /*!< \brief Weight of the drag coefficient. */
@@ -175,6 +184,7 @@ private:
   unsigned short *Kind_ObjFunc;  /*!< \brief Kind of objective function. */
   su2double *Weight_ObjFunc;    /*!< \brief Weight applied to objective function. */
   unsigned short Kind_SensSmooth; /*!< \brief Kind of sensitivity smoothing technique. */
+  su2double SensSmooth_Coeff;     /*!< \brief Coefficient of the surface Laplace-Beltrami term of the sensitivity smoothing. */
   unsigned short Continuous_Eqns; /*!< \brief Which equations to treat continuously (Hybrid adjoint)*/
   unsigned short Discrete_Eqns; /*!< \brief Which equations to treat discretely (Hybrid adjoint). */
   unsigned short *Design_Variable; /*!< \brief Kind of design variable. */
@@ -400,9 +410,17 @@ private:
   unsigned long IntIter;			/*!< \brief Current internal iteration number. */
   unsigned long OuterIter;			/*!< \brief Current Outer Iteration for multizone problems. */
   unsigned long Unst_nIntIter;			/*!< \brief Number of internal iterations (Dual time Method). */
+  su2double Unst_Residual_Drop;    /*!< \brief Orders of magnitude of the flow residual that end the internal iterations of a time step. */
+  bool Unst_Predictor;             /*!< \brief Extrapolate the solution of the new time step from the two previous ones. */
   unsigned long Dyn_nIntIter;			/*!< \brief Number of internal iterations (Newton-Raphson Method for nonlinear structural analysis). */
   long Unst_RestartIter;			/*!< \brief Iteration number to restart an unsteady simulation (Dual time Method). */
   long Unst_AdjointIter;			/*!< \brief Iteration number to begin the reverse time integration in the direct solver for the unsteady adjoint. */
+  unsigned short Unst_Adjoint_nCheckpoint;	/*!< \brief Number of in-memory checkpoints of the direct solution for the unsteady adjoint. */
+  unsigned short DiscAdj_Krylov_Size;	/*!< \brief Krylov subspace size of the discrete adjoint FGMRES solver. */
+  unsigned short DiscAdj_MultiGrid_Iter;	/*!< \brief Smoothing iterations per level of the discrete adjoint coarse grid correction. */
+  unsigned short Anderson_Depth;	/*!< \brief Previous iterates of the Anderson acceleration, 0 if it is disabled. */
+  su2double Anderson_Relaxation;	/*!< \brief Relaxation of the residual in the Anderson acceleration. */
+  unsigned short iObj_Sweep;	/*!< \brief Objective function of the current adjoint of the objective sweep. */
   long Iter_Avg_Objective;			/*!< \brief Iteration the number of time steps to be averaged, counting from the back */
   long Dyn_RestartIter;                         /*!< \brief Iteration number to restart a dynamic structural analysis. */
   unsigned short nLevels_TimeAccurateLTS;       /*!< \brief Number of time levels for time accurate local time stepping. */
@@ -424,6 +442,14 @@ private:
   Max_DeltaTime,  		/*!< \brief Max delta time. */
   Unst_CFL;		/*!< \brief Unsteady CFL number. */
   bool ReorientElements;		/*!< \brief Flag for enabling element reorientation. */
+  bool Edge_Coloring;       /*!< \brief Flag for grouping the edges in colors without shared points. */
+  unsigned short nThreads_Flow;  /*!< \brief Number of threads per rank that carry out the colors of the convective edge loops of the flow. */
+  bool Fused_Gradient_Limiter;  /*!< \brief Compute the gradient and the limiter bounds in a single pass. */
+  bool Cache_LS_Weights;    /*!< \brief Precompute the least-squares gradient weights of the edges. */
+  bool Reuse_Spectral_Radius; /*!< \brief Take the spectral radius of the local time step from the residual edge loops. */
+  unsigned short nRes_Smooth_Iter; /*!< \brief Jacobi sweeps of the central implicit residual smoothing (0 disables it). */
+  su2double Res_Smooth_Coeff; /*!< \brief Coefficient of the central implicit residual smoothing. */
+  unsigned short Kind_Point_Ordering; /*!< \brief Renumbering of the points of each partition. */
   bool AddIndNeighbor;			/*!< \brief Include indirect neighbor in the agglomeration process. */
   unsigned short nDV,		/*!< \brief Number of design variables. */
   nObj, nObjW;              /*! \brief Number of objective functions. */
@@ -554,13 +580,24 @@ private:
   su2double Linear_Solver_Error_FSI_Struc;		/*!< \brief Min error of the linear solver for the implicit formulation in the structural side for FSI problems . */
   su2double Linear_Solver_Error_Heat;        /*!< \brief Min error of the linear solver for the implicit formulation in the fvm heat solver . */
   unsigned long Linear_Solver_Iter;		/*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  bool Reproducible_Reductions;   /*!< \brief Exact parallel sums, the results do not depend on the partitioning. */
   unsigned long Deform_Linear_Solver_Iter;   /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Iter_FSI_Struc;		/*!< \brief Max iterations of the linear solver for FSI applications and structural solver. */
   unsigned long Linear_Solver_Iter_Heat;       /*!< \brief Max iterations of the linear solver for the implicit formulation in the fvm heat solver. */
   unsigned long Linear_Solver_Restart_Frequency;   /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
+  unsigned short Linear_Solver_Recycle_Size;       /*!< \brief Size of the space recycled by GCRO-DR between the linear solves. */
+  bool DiscAdj_Linear_WarmStart;   /*!< \brief Start the discrete adjoint linear solves from the previous adjoint solution. */
   unsigned short Linear_Solver_ILU_n;		/*!< \brief ILU fill=in level. */
+  unsigned short Linear_Solver_RAS_Overlap;	/*!< \brief Layers of halo points in the overlap of the RAS preconditioner. */
+  bool Linear_Solver_Mixed_Precision;   /*!< \brief Store and apply the preconditioners in single precision. */
+  bool Linear_Solver_Reuse_Heat;        /*!< \brief Keep the operator and the preconditioner of the solid heat solver. */
+  bool Newton_Krylov;                   /*!< \brief Jacobian-free Newton-Krylov for the implicit flow system. */
+  bool Coupled_Turb_Implicit;           /*!< \brief Solve the implicit mean flow and turbulence systems as one coupled system. */
+  unsigned short Jacobian_Lag;          /*!< \brief Maximum number of iterations between two assemblies of the Jacobian. */
+  bool Jacobian_Edge_Format;            /*!< \brief Store the flow Jacobian by points and edges instead of compressed rows. */
   su2double SemiSpan;		/*!< \brief Wing Semi span. */
   su2double Roe_Kappa;		/*!< \brief Relaxation of the Roe scheme. */
+  bool Batch_Flux;      /*!< \brief Evaluate the convective fluxes of several edges at once. */
   su2double Relaxation_Factor_Flow;		/*!< \brief Relaxation coefficient of the linear solver mean flow. */
   su2double Relaxation_Factor_Turb;		/*!< \brief Relaxation coefficient of the linear solver turbulence. */
   su2double Relaxation_Factor_AdjFlow;		/*!< \brief Relaxation coefficient of the linear solver adjoint mean flow. */
@@ -590,6 +627,15 @@ private:
   unsigned long GridDef_Nonlinear_Iter, /*!< \brief Number of nonlinear increments for grid deformation. */
   GridDef_Linear_Iter; /*!< \brief Number of linear smoothing iterations for grid deformation. */
   unsigned short Deform_Stiffness_Type; /*!< \brief Type of element stiffness imposed for FEA mesh deformation. */
+  unsigned short Kind_Deform_Method; /*!< \brief Method of the volumetric mesh deformation. */
+  unsigned short nThreads_Deform; /*!< \brief Number of threads per rank of the FEA mesh deformation. */
+  unsigned short Kind_Deform_Reuse; /*!< \brief Reuse of the stiffness matrix and preconditioner of the FEA mesh deformation. */
+  su2double Deform_Rebuild_Ratio; /*!< \brief Growth of the linear iterations that triggers the rebuild of the reused system. */
+  unsigned long Deform_RBF_MaxPoints; /*!< \brief Maximum number of control points of the RBF mesh deformation. */
+  su2double Deform_RBF_Radius, /*!< \brief Support radius of the RBF mesh deformation. */
+  Deform_RBF_Tolerance; /*!< \brief Relative tolerance of the greedy selection of the RBF control points. */
+  bool Update_Wall_Distance; /*!< \brief Update the wall distance after the deformation of the mesh. */
+  bool Partial_DualGrid_Update; /*!< \brief Update the dual grid only around the points moved by the deformation. */
   bool Deform_Output;  /*!< \brief Print the residuals during mesh deformation to the console. */
   su2double Deform_Tol_Factor; /*!< Factor to multiply smallest volume for deform tolerance (0.001 default) */
   su2double Deform_Coeff; /*!< Deform coeffienct */
@@ -610,6 +656,13 @@ private:
   bool Fixed_CM_Mode;			/*!< \brief Activate fixed CL mode (external flow only). */
   bool Eval_dOF_dCX;			/*!< \brief Activate fixed CL mode (external flow only). */
   bool Discard_InFiles; /*!< \brief Discard angle of attack in solution and geometry files. */
+  su2double *Ensemble_AoA,	/*!< \brief Angles of attack of the flow conditions of the ensemble run. */
+  *Ensemble_AoS;		/*!< \brief Sideslip angles of the flow conditions of the ensemble run. */
+  unsigned short nEnsemble_AoA,	/*!< \brief Number of angles of attack of the ensemble run. */
+  nEnsemble_AoS,		/*!< \brief Number of sideslip angles of the ensemble run. */
+  nEnsemble,			/*!< \brief Number of flow conditions of the ensemble run (0 without ensemble). */
+  iEnsemble;			/*!< \brief Current flow condition of the ensemble run. */
+  string Ensemble_FileName[5];	/*!< \brief Output file names of the ensemble run, without the extension of the condition. */
   su2double Target_CL;			/*!< \brief Specify a target CL instead of AoA (external flow only). */
   su2double Target_CM;			/*!< \brief Specify a target CL instead of AoA (external flow only). */
   su2double Total_CM;			/*!< \brief Specify a target CL instead of AoA (external flow only). */
@@ -620,6 +673,8 @@ private:
   unsigned long Iter_Fixed_CM;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Iter_Fixed_NetThrust;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Iter_dCL_dAlpha;   /*!< \brief Number of iterations to evaluate dCL_dAlpha. */
+  bool Fixed_CL_Newton;            /*!< \brief Update the AoA of the fixed CL mode by Newton steps with a secant dCL_dAlpha. */
+  su2double Fixed_CL_Newton_Residual;  /*!< \brief Orders of magnitude of the density residual drop that trigger a Newton update of the AoA. */
   unsigned long Update_Alpha;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Update_iH;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
   unsigned long Update_BCThrust;			/*!< \brief Iterations to re-evaluate the angle of attack (external flow only). */
@@ -637,14 +692,26 @@ private:
   su2double Cauchy_Eps;	/*!< \brief Epsilon used for the convergence. */
   unsigned long Wrt_Sol_Freq,	/*!< \brief Writing solution frequency. */
   Wrt_Sol_Freq_DualTime,	/*!< \brief Writing solution frequency for Dual Time. */
+  Wrt_Srf_Hist_Freq,	/*!< \brief Writing frequency of the surface pressure history. */
+  Time_Average_Start_Iter,	/*!< \brief Time step from which the time averages are accumulated. */
   Wrt_Con_Freq,				/*!< \brief Writing convergence history frequency. */
-  Wrt_Con_Freq_DualTime;				/*!< \brief Writing convergence history frequency. */
+  Wrt_Con_Freq_DualTime,				/*!< \brief Writing convergence history frequency. */
+  History_Flush_Freq;       /*!< \brief Number of history lines between the flushes of the history file. */
   bool Wrt_Unsteady;  /*!< \brief Write unsteady data adding header and prefix. */
+  bool Wrt_Time_Average;  /*!< \brief Accumulate and write the time averages of the flow. */
   bool Wrt_Dynamic;  		/*!< \brief Write dynamic data adding header and prefix. */
   bool Restart,	/*!< \brief Restart solution (for direct, adjoint, and linearized problems).*/
   Wrt_Binary_Restart,	/*!< \brief Write binary SU2 native restart files.*/
   Read_Binary_Restart,	/*!< \brief Read binary SU2 native restart files.*/
+  Wrt_Compact_Restart,	/*!< \brief Write the binary restart files in the compact format.*/
+  Wrt_Async_Restart,	/*!< \brief Write the binary restart files with a background thread.*/
+  Restart_Interpolate,	/*!< \brief Interpolate the solution files from a different mesh.*/
   Restart_Flow;	/*!< \brief Restart flow solution for adjoint and linearized problems. */
+  unsigned short Kind_Compact_Restart;	/*!< \brief Storage of the non-solution fields of compact restart files. */
+  unsigned short nCompact_Restart_Fields;	/*!< \brief Number of additional fields of compact restart files. */
+  string *Compact_Restart_Fields;	/*!< \brief Additional fields of compact restart files. */
+  unsigned short nVolume_Output_Fields;	/*!< \brief Number of derived fields selected for the volume output. */
+  string *Volume_Output_Fields;	/*!< \brief Derived fields selected for the volume output, all of them if empty. */
   unsigned short nMarker_Monitoring,	/*!< \brief Number of markers to monitor. */
   nMarker_Designing,					/*!< \brief Number of markers for the objective function. */
   nMarker_GeoEval,					/*!< \brief Number of markers for the objective function. */
@@ -701,9 +768,26 @@ private:
   unsigned short Analytical_Surface;	/*!< \brief Information about the analytical definition of the surface for grid adaptation. */
   unsigned short Geo_Description;	/*!< \brief Description of the geometry. */
   unsigned short Mesh_FileFormat;	/*!< \brief Mesh input format. */
+  bool Mesh_Offsets_Index;	/*!< \brief Use an index of the byte offsets of the sections of SU2 ASCII meshes. */
+  bool Partition_Cache;	/*!< \brief Store and reuse the graph partitioning of the mesh. */
+  unsigned short nPartition_Cache_Ranks,	/*!< \brief Number of other rank counts of the partition cache. */
+  *Partition_Cache_Ranks;	/*!< \brief Other rank counts for which the partitioning is stored in the cache. */
+  bool Partition_Weights;	/*!< \brief Balance the partitions on the edges and on the boundary vertices. */
+  bool Shared_Memory_Comms;	/*!< \brief Exchange the halos of the ranks of a node through MPI-3 shared memory. */
+  bool Comm_Profiling;	/*!< \brief Collect and write the statistics of the MPI communication. */
   unsigned short Output_FileFormat;	/*!< \brief Format of the output files. */
+  unsigned short Output_Precision;	/*!< \brief Default precision of the fields in the XDMF and Tecplot binary files. */
+  unsigned short nOutput_Single_Fields,	/*!< \brief Number of fields written in single precision. */
+  nOutput_Quantized_Fields,	/*!< \brief Number of quantized fields. */
+  nOutput_Quantization_Error;	/*!< \brief Number of error bounds of the quantized fields. */
+  string *Output_Single_Fields,	/*!< \brief Fields written in single precision. */
+  *Output_Quantized_Fields;	/*!< \brief Fields written as 1 or 2 byte integers. */
+  su2double *Output_Quantization_Error;	/*!< \brief Bounds of the absolute error of the quantized fields. */
   unsigned short ActDisk_Jump;	/*!< \brief Format of the output files. */
   bool CFL_Adapt;      /*!< \brief Adaptive CFL number. */
+  bool CFL_Adapt_LinSol; /*!< \brief Adapt the CFL number with the feedback of the linear solver and of the non-physical points. */
+  bool CFL_Adapt_Local;  /*!< \brief Reduce the CFL number locally at the non-physical points. */
+  bool Local_Freezing;   /*!< \brief Freeze the points whose residual has converged locally. */
   bool HB_Precondition;    /*< \brief Flag to turn on harmonic balance source term preconditioning */
   su2double RefArea,		/*!< \brief Reference area for coefficient computation. */
   RefElemLength,				/*!< \brief Reference element length for computing the slope limiting epsilon. */
@@ -714,6 +798,8 @@ private:
   *RefOriginMoment_Y,      /*!< \brief Y Origin for moment computation. */
   *RefOriginMoment_Z,      /*!< \brief Z Origin for moment computation. */
   *CFL_AdaptParam,      /*!< \brief Information about the CFL ramp. */
+  *CFL_AdaptParam_LinSol, /*!< \brief Parameters of the CFL controller with linear solver feedback. */
+  *Local_Freezing_Param,  /*!< \brief Parameters of the local freezing of converged points. */
   *RelaxFactor_Giles,      /*!< \brief Information about the under relaxation factor for Giles BC. */
   *CFL,
   *HTP_Axis,      /*!< \brief Location of the HTP axis. */
@@ -722,6 +808,7 @@ private:
   nRefOriginMoment_Y,           /*!< \brief Number of Y-coordinate moment computation origins. */
   nRefOriginMoment_Z;           /*!< \brief Number of Z-coordinate moment computation origins. */
   string Mesh_FileName,			/*!< \brief Mesh input file. */
+  Restart_Interpolate_Mesh,		/*!< \brief Mesh file of the solution files interpolated at restart. */
   Mesh_Out_FileName,				/*!< \brief Mesh output file. */
   Solution_FlowFileName,			/*!< \brief Flow solution input file. */
   Solution_LinFileName,			/*!< \brief Linearized flow solution input file. */
@@ -796,6 +883,10 @@ private:
   Pressure_Critical,   /*!< \brief Critical Pressure for real fluid model.  */
   Density_Critical,   /*!< \brief Critical Density for real fluid model.  */
   Acentric_Factor,   /*!< \brief Acentric Factor for real fluid model.  */
+  LUT_Pressure_Min,     /*!< \brief Lower bound of the pressure range of the fluid look-up table. */
+  LUT_Pressure_Max,     /*!< \brief Upper bound of the pressure range of the fluid look-up table. */
+  LUT_Temperature_Min,  /*!< \brief Lower bound of the temperature range of the fluid look-up table. */
+  LUT_Temperature_Max,  /*!< \brief Upper bound of the temperature range of the fluid look-up table. */
   Mu_Constant,     /*!< \brief Constant viscosity for ConstantViscosity model.  */
   Mu_ConstantND,   /*!< \brief Non-dimensional constant viscosity for ConstantViscosity model.  */
   Kt_Constant,     /*!< \brief Constant thermal conductivity for ConstantConductivity model.  */
@@ -875,6 +966,8 @@ private:
   su2double AitkenStatRelax;	/*!< \brief Aitken's relaxation factor (if set as static) */
   su2double AitkenDynMaxInit;	/*!< \brief Aitken's maximum dynamic relaxation factor for the first iteration */
   su2double AitkenDynMinInit;	/*!< \brief Aitken's minimum dynamic relaxation factor for the first iteration */
+  unsigned short IQN_ILS_MaxVectors;	/*!< \brief Maximum number of secant vectors of the IQN-ILS relaxation */
+  unsigned short IQN_ILS_ReuseSteps;	/*!< \brief Number of previous time steps reused by the IQN-ILS relaxation */
   bool RampAndRelease;        /*!< \brief option for ramp load and release */
   bool Sine_Load;             /*!< \brief option for sine load */
   su2double *SineLoad_Coeff;  /*!< \brief Stores the load coefficient */
@@ -990,8 +1083,12 @@ private:
   unsigned short Kind_RadialBasisFunction; /*!\brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!\brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter; /*!\brief Radial basis function parameter. */
+  bool RadialBasisFunction_Sparse; /*!\brief Option of whether to compute the Radial Basis Function weights from the compact support of each target point. */
   bool Prestretch;            /*!< Read a reference geometry for optimization purposes. */
   string Prestretch_FEMFileName;         /*!< \brief File name for reference geometry. */
+  unsigned short nThreads_FEA;  /*!< \brief Number of threads per rank to assemble the elements of the structural solver. */
+  bool Precompute_RefGrad_FEA;  /*!< \brief Store the shape function gradients of the reference configuration of every element. */
+  bool MatrixFree_FEA;          /*!< \brief Apply the stiffness matrix of linear elasticity element by element instead of assembling it. */
   string FEA_FileName;         /*!< \brief File name for element-based properties. */
   su2double RefGeom_Penalty,        /*!< \brief Penalty weight value for the reference geometry objective function. */
   RefNode_Penalty,            /*!< \brief Penalty weight value for the reference node objective function. */
@@ -1001,6 +1098,7 @@ private:
   Nonphys_Reconstr;      /*!< \brief Current number of non-physical reconstructions for 2nd-order upwinding. */
   bool ParMETIS;      /*!< \brief Boolean for activating ParMETIS mode (while testing). */
   unsigned short DirectDiff; /*!< \brief Direct Differentation mode. */
+  unsigned short DirectDiff_Directions; /*!< \brief Number of tangent directions seeded in the direct differentiation w.r.t. the design variables. */
   bool DiscreteAdjoint; /*!< \brief AD-based discrete adjoint mode. */
   unsigned long Wrt_Surf_Freq_DualTime;	/*!< \brief Writing surface solution frequency for Dual Time. */
   su2double Const_DES;   /*!< \brief Detached Eddy Simulation Constant. */
@@ -1011,6 +1109,8 @@ private:
   *default_eng_cyl,           /*!< \brief Default engine box array for the COption class. */
   *default_eng_val,           /*!< \brief Default engine box array values for the COption class. */
   *default_cfl_adapt,         /*!< \brief Default CFL adapt param array for the COption class. */
+  *default_cfl_adapt_linsol,  /*!< \brief Default CFL controller param array for the COption class. */
+  *default_local_freezing,    /*!< \brief Default local freezing param array for the COption class. */
   *default_jst_coeff,         /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_ffd_coeff,         /*!< \brief Default artificial dissipation (flow) array for the COption class. */
   *default_mixedout_coeff,    /*!< \brief Default default mixedout algorithm coefficients for the COption class. */
@@ -1070,10 +1170,20 @@ private:
   su2double Quadrature_Factor_Straight;      /*!< \brief Factor applied during quadrature of elements with a constant Jacobian. */
   su2double Quadrature_Factor_Curved;        /*!< \brief Factor applied during quadrature of elements with a non-constant Jacobian. */
   su2double Quadrature_Factor_Time_ADER_DG;  /*!< \brief Factor applied during quadrature in time for ADER-DG. */
+  su2double Tol_Predictor_ADER_DG;           /*!< \brief Relative tolerance of the iterative predictor step of ADER-DG. */
+  unsigned short MaxIter_Predictor_ADER_DG;  /*!< \brief Maximum number of iterations of the predictor step of ADER-DG per element. */
   su2double Theta_Interior_Penalty_DGFEM;    /*!< \brief Factor for the symmetrizing terms in the DG discretization of the viscous fluxes. */
   unsigned short byteAlignmentMatMul;        /*!< \brief Number of bytes in the vectorization direction for the matrix multiplication. Multipe of 64. */
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
+  unsigned short nThreads_DGFEM;             /*!< \brief Number of threads per rank to carry out the tasks list of the DG solver. */
+  bool SumFactorization_DGFEM;               /*!< \brief Whether or not to use sum-factorization for the volume integrals of tensor product elements. */
+  bool Compressed_MetricTerms_DGFEM;         /*!< \brief Whether or not to store the metric terms only once for the elements with constant metric terms. */
+  unsigned long LoadImbalance_Report_Freq_DGFEM; /*!< \brief Number of evaluations of the tasks list between two load imbalance reports of the DG solver (diagnostic only). */
+  su2double LoadImbalance_Report_Tol_DGFEM;  /*!< \brief Ratio of the maximum and average work per rank above which the DG load imbalance is reported (diagnostic only). */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
+  bool LUT_FluidModel;                       /*!< \brief Whether or not the real gas model is replaced by a look-up table. */
+  unsigned short LUT_nPoints;                /*!< \brief Number of points per direction of the fluid look-up tables. */
+  string LUT_FileName;                       /*!< \brief File name of the cached fluid look-up tables. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average; /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
@@ -1624,6 +1734,40 @@ public:
    */
   bool GetCFL_Adapt(void);
   
+  /*!
+   * \brief Get whether the adaptive CFL number uses the feedback of the linear solver.
+   * \return <code>TRUE</code> if the CFL number is adapted with the residual reduction of the linear
+   *         solver, the trend of the nonlinear residual and the number of non-physical points.
+   */
+  bool GetCFL_Adapt_LinSol(void);
+  
+  /*!
+   * \brief Get the parameters of the CFL controller with linear solver feedback.
+   * \param[in] val_index - 0: factor down, 1: factor up, 2: required reduction of the linear residual.
+   * \return Value of the parameter.
+   */
+  su2double GetCFL_AdaptParam_LinSol(unsigned short val_index);
+  
+  /*!
+   * \brief Get whether the CFL number is reduced locally at the non-physical points.
+   * \return <code>TRUE</code> if a local factor of the CFL number is used.
+   */
+  bool GetCFL_Adapt_Local(void);
+  
+  /*!
+   * \brief Get whether the points whose residual has converged locally are frozen.
+   * \return <code>TRUE</code> if only the active points are updated between the sweeps of the domain.
+   */
+  bool GetLocal_Freezing(void);
+  
+  /*!
+   * \brief Get the parameters of the local freezing.
+   * \param[in] val_index - 0: residual relative to the largest one below which a point is frozen,
+   *                       1: iterations between the sweeps of the entire domain, 2: first frozen iteration.
+   * \return Value of the parameter.
+   */
+  su2double GetLocal_Freezing_Param(unsigned short val_index);
+  
   /*!
    * \brief Get the values of the CFL adapation.
    * \return Value of CFL adapation
@@ -2214,6 +2358,24 @@ public:
    */
   
   bool GetPrestretch(void);
+
+  /*!
+   * \brief Get the number of threads per rank that assemble the elements of the structural solver.
+   * \return Number of threads, including the thread of the rank itself.
+   */
+  unsigned short GetnThreads_FEA(void);
+
+  /*!
+   * \brief Decide whether the shape function gradients of the reference configuration are precomputed.
+   * \return <code>TRUE</code> if the gradients are stored per element and reused in every assembly.
+   */
+  bool GetPrecompute_RefGrad_FEA(void);
+
+  /*!
+   * \brief Decide whether the stiffness matrix of linear elasticity is applied element by element.
+   * \return <code>TRUE</code> if the global matrix is not assembled and the linear solver uses a matrix-free product.
+   */
+  bool GetMatrixFree_FEA(void);
   
   /*!
     * \brief Decide whether it's necessary to add the cross term for adjoint FSI.
@@ -2332,6 +2494,13 @@ public:
    */
   void SetKind_TimeIntScheme(unsigned short val_kind_timeintscheme);
   
+  /*!
+   * \brief Set the kind of time integration scheme of the flow equations.
+   * \note Used to evaluate residuals without assembling the Jacobian.
+   * \param[in] val_kind_timeintscheme - Kind of time integration scheme.
+   */
+  void SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme);
+  
   /*!
    * \brief Set the parameters of the convective numerical scheme.
    * \note The parameters will change because we are solving different kind of equations.
@@ -2700,6 +2869,25 @@ public:
    * \param[in] val_AoA - Value of the angle of attack.
    */
   void SetAoS(su2double val_AoS);
+
+  /*!
+   * \brief Get the number of flow conditions of the ensemble run (ENSEMBLE_AOA, ENSEMBLE_SIDESLIP_ANGLE).
+   * \return Number of conditions, 0 if the problem is solved for AOA and SIDESLIP_ANGLE only.
+   */
+  unsigned short GetnEnsemble(void);
+
+  /*!
+   * \brief Get the current flow condition of the ensemble run.
+   * \return Index of the condition in the lists of angles.
+   */
+  unsigned short GetiEnsemble(void);
+
+  /*!
+   * \brief Set the flow condition of the ensemble run: the angle of attack, the sideslip angle and the
+   *        output file names, which get the extension _<condition>. The free-stream velocity is not changed.
+   * \param[in] val_iCond - Index of the condition in the lists of angles.
+   */
+  void SetEnsemble_Condition(unsigned short val_iCond);
   
   /*!
    * \brief Get the angle of sideslip of the body. It relates to the rotation of the aircraft centerline from
@@ -2778,6 +2966,24 @@ public:
    * \return 	<code>TRUE</code> means that elements can be reoriented if suspected unhealthy
    */
   bool GetReorientElements(void);
+
+  /*!
+   * \brief Get information about the edge coloring.
+   * \return <code>TRUE</code> means that the edge loops of the residual are traversed color by color.
+   */
+  bool GetEdge_Coloring(void);
+
+  /*!
+   * \brief Get the number of threads per rank that carry out the colors of the convective edge loops of the flow.
+   * \return Number of threads, including the thread of the rank itself.
+   */
+  unsigned short GetnThreads_Flow(void);
+  
+  /*!
+   * \brief Get the kind of renumbering of the points.
+   * \return Reverse Cuthill-McKee or Hilbert curve ordering.
+   */
+  unsigned short GetKind_Point_Ordering(void);
   
   /*!
    * \brief Get the Courant Friedrich Levi number for unsteady simulations.
@@ -2785,6 +2991,24 @@ public:
    */
   su2double GetMax_DeltaTime(void);
   
+  /*!
+   * \brief Get whether the local time step reuses the spectral radius of the residual edge loops.
+   * \return <code>TRUE</code> if the time step of the compressible Euler solver skips its own edge loop.
+   */
+  bool GetReuse_Spectral_Radius(void);
+  
+  /*!
+   * \brief Get the number of Jacobi sweeps of the central implicit residual smoothing of the explicit schemes.
+   * \return Number of sweeps, 0 if the residual is not smoothed.
+   */
+  unsigned short GetnRes_Smooth_Iter(void);
+  
+  /*!
+   * \brief Get the coefficient of the central implicit residual smoothing of the explicit schemes.
+   * \return Coefficient of the Laplacian of the smoothed residual.
+   */
+  su2double GetRes_Smooth_Coeff(void);
+  
   /*!
    * \brief Get a parameter of the particular design variable.
    * \param[in] val_dv - Number of the design variable that we want to read.
@@ -3039,6 +3263,18 @@ public:
    */
   unsigned long GetUnst_nIntIter(void);
   
+  /*!
+   * \brief Get the reduction of the flow residual that ends the internal iterations of a physical time step.
+   * \return Orders of magnitude of the reduction, zero if the criterion is not used.
+   */
+  su2double GetUnst_Residual_Drop(void);
+  
+  /*!
+   * \brief Check whether the solution of a new physical time step is extrapolated from the two previous ones.
+   * \return <code>TRUE</code> if the predictor is used; otherwise <code>FALSE</code>.
+   */
+  bool GetUnst_Predictor(void);
+  
   /*!
    * \brief Get the number of internal iterations for the Newton-Raphson Method in nonlinear structural applications.
    * \return Number of internal iterations.
@@ -3057,6 +3293,12 @@ public:
    */
   long GetUnst_AdjointIter(void);
   
+  /*!
+   * \brief Get the number of in-memory checkpoints of the direct solution for the unsteady discrete adjoint.
+   * \return Number of checkpoints, 0 if the direct solutions are read from the restart files.
+   */
+  unsigned short GetUnst_Adjoint_nCheckpoint(void);
+  
   /*!
    * \brief Number of iterations to average (reverse time integration).
    * \return Starting direct iteration number for the unsteady adjoint.
@@ -3149,6 +3391,30 @@ public:
    */
   unsigned long GetWrt_Sol_Freq_DualTime(void);
   
+  /*!
+   * \brief Get the frequency (in time steps) for writing the surface pressure history.
+   * \return It writes the surface pressure history with this frequency, 0 if it is not written.
+   */
+  unsigned long GetWrt_Srf_Hist_Freq(void);
+  
+  /*!
+   * \brief Get the number of lines written to the convergence history between two flushes of the file.
+   * \return Number of history lines between two flushes.
+   */
+  unsigned long GetHistory_Flush_Freq(void);
+  
+  /*!
+   * \brief Get information about the accumulation of the time averages of the flow.
+   * \return <code>TRUE</code> if the time averages, pressure RMS and Reynolds stresses are accumulated and written.
+   */
+  bool GetWrt_Time_Average(void);
+  
+  /*!
+   * \brief Get the time step from which the time averages are accumulated.
+   * \return First time step of the time averages.
+   */
+  unsigned long GetTime_Average_Start_Iter(void);
+  
   /*!
    * \brief Get the frequency for writing the convergence file.
    * \return It writes the convergence file with this frequency.
@@ -3762,6 +4028,48 @@ public:
    * \return Critical pressure.
    */
   su2double GetAcentric_Factor(void);
+
+  /*!
+   * \brief Get whether or not the real gas model is replaced by a look-up table.
+   * \return <code>TRUE</code> if a look-up table is used for the fluid model.
+   */
+  bool GetLUT_FluidModel(void);
+
+  /*!
+   * \brief Get the number of points per direction of the fluid look-up tables.
+   * \return Number of points per direction.
+   */
+  unsigned short GetLUT_nPoints(void);
+
+  /*!
+   * \brief Get the name of the file in which the fluid look-up tables are cached.
+   * \return File name of the look-up tables.
+   */
+  string GetLUT_FileName(void);
+
+  /*!
+   * \brief Get the lower bound of the pressure range of the fluid look-up table.
+   * \return Minimum pressure, 0 if it must be determined from the free-stream.
+   */
+  su2double GetLUT_Pressure_Min(void);
+
+  /*!
+   * \brief Get the upper bound of the pressure range of the fluid look-up table.
+   * \return Maximum pressure, 0 if it must be determined from the free-stream.
+   */
+  su2double GetLUT_Pressure_Max(void);
+
+  /*!
+   * \brief Get the lower bound of the temperature range of the fluid look-up table.
+   * \return Minimum temperature, 0 if it must be determined from the free-stream.
+   */
+  su2double GetLUT_Temperature_Min(void);
+
+  /*!
+   * \brief Get the upper bound of the temperature range of the fluid look-up table.
+   * \return Maximum temperature, 0 if it must be determined from the free-stream.
+   */
+  su2double GetLUT_Temperature_Max(void);
   
   /*!
    * \brief Get the value of the viscosity model.
@@ -3953,6 +4261,18 @@ public:
    */
   unsigned short GetKind_Gradient_Method(void);
   
+  /*!
+   * \brief Get whether the gradient and the limiter of the flow are computed in a single pass.
+   * \return <code>TRUE</code> if the gradient and the limiter bounds share the loop and the halo exchange.
+   */
+  bool GetFused_Gradient_Limiter(void);
+  
+  /*!
+   * \brief Get whether the weights of the least-squares gradients are precomputed per geometry.
+   * \return <code>TRUE</code> if the least-squares gradients are a weighted sum over the edges.
+   */
+  bool GetCache_LS_Weights(void);
+  
   /*!
    * \brief Get the kind of solver for the implicit solver.
    * \return Numerical solver for implicit formulation (solving the linear system).
@@ -4002,6 +4322,12 @@ public:
    */
   unsigned long GetLinear_Solver_Iter(void);
   
+  /*!
+   * \brief Get if the parallel sums are exact (REPRODUCIBLE_REDUCTIONS).
+   * \return <code>TRUE</code> if the inner products, residual RMS and forces do not depend on the partitioning.
+   */
+  bool GetReproducible_Reductions(void);
+  
   /*!
    * \brief Get max number of iterations of the linear solver for the implicit formulation.
    * \return Max number of iterations of the linear solver for the implicit formulation.
@@ -4014,11 +4340,61 @@ public:
    */
   unsigned short GetLinear_Solver_ILU_n(void);
 
+  /*!
+   * \brief Get the overlap of the restricted additive Schwarz preconditioner.
+   * \return Layers of halo points added to each partition.
+   */
+  unsigned short GetLinear_Solver_RAS_Overlap(void);
+
+  /*!
+   * \brief Get whether the preconditioners of the Krylov linear solvers are stored in single precision.
+   * \return <code>TRUE</code> if the ILU and Jacobi preconditioners are stored and applied in single precision.
+   */
+  bool GetLinear_Solver_Mixed_Precision(void);
+
+  /*!
+   * \brief Get whether the solid heat solver keeps its operator and preconditioner across iterations.
+   * \return <code>TRUE</code> if only the right-hand side and the variable diagonal terms are updated.
+   */
+  bool GetLinear_Solver_Reuse_Heat(void);
+
+  /*!
+   * \brief Get whether the Krylov solver of the flow equations uses Jacobian-free products.
+   * \return <code>TRUE</code> if the products with the Jacobian are finite differences of the residual,
+   *         the assembled Jacobian is then only used to build the preconditioner.
+   */
+  bool GetNewton_Krylov(void);
+
+  /*!
+   * \brief Get whether the implicit mean flow and turbulence equations are solved as one coupled system.
+   * \return <code>TRUE</code> if the linear system of the mean flow is solved together with the
+   *         one of the turbulence model by the turbulence solver.
+   */
+  bool GetCoupled_Turb_Implicit(void);
+
+  /*!
+   * \brief Get the maximum number of nonlinear iterations between two assemblies of the Jacobian.
+   * \return Jacobian lag of steady implicit solves, 1 assembles the Jacobian at every iteration.
+   */
+  unsigned short GetJacobian_Lag(void);
+
+  /*!
+   * \brief Get whether the flow Jacobian is stored by points and edges (edge format).
+   * \return <code>TRUE</code> if the diagonal blocks and two blocks per edge are stored without column indices.
+   */
+  bool GetJacobian_Edge_Format(void);
+
   /*!
    * \brief Get restart frequency of the linear solver for the implicit formulation.
    * \return Restart frequency of the linear solver for the implicit formulation.
    */
   unsigned long GetLinear_Solver_Restart_Frequency(void);
+
+  /*!
+   * \brief Get the number of directions recycled by GCRO-DR from one linear solve to the next.
+   * \return Size of the recycled space.
+   */
+  unsigned short GetLinear_Solver_Recycle_Size(void);
   
   /*!
    * \brief Get the relaxation coefficient of the linear solver for the implicit formulation.
@@ -4080,6 +4456,12 @@ public:
    */
   unsigned short GetKind_DiscAdj_Linear_Prec(void);
   
+  /*!
+   * \brief Get whether the discrete adjoint linear solves start from the previous adjoint solution.
+   * \return <code>TRUE</code> if the linear solves of the reverse sweep are warm-started.
+   */
+  bool GetDiscAdj_Linear_WarmStart(void);
+  
   /*!
    * \brief Get the kind of preconditioner for the implicit solver.
    * \return Numerical preconditioner for implicit formulation (solving the linear system).
@@ -4122,6 +4504,13 @@ public:
    */
   unsigned long GetGridDef_Linear_Iter(void);
   
+  /*!
+   * \brief Get the number of threads per rank that assemble the stiffness matrix of the mesh
+   *        deformation and share the products and preconditioners of its linear solver.
+   * \return Number of threads, including the thread of the rank itself.
+   */
+  unsigned short GetnThreads_Deform(void);
+  
   /*!
    * \brief Get the number of nonlinear increments for mesh deformation.
    * \return Number of nonlinear increments for mesh deformation.
@@ -4163,6 +4552,54 @@ public:
    */
   unsigned short GetDeform_Stiffness_Type(void);
   
+  /*!
+   * \brief Get the method of the volumetric mesh deformation.
+   * \return Method of the mesh deformation (linear elasticity or radial basis functions).
+   */
+  unsigned short GetKind_Deform_Method(void);
+  
+  /*!
+   * \brief Get the reuse of the linear system of the FEA mesh deformation across increments and deformations.
+   * \return Kind of reuse (none, preconditioner, stiffness matrix and preconditioner).
+   */
+  unsigned short GetKind_Deform_Reuse(void);
+  
+  /*!
+   * \brief Get the ratio of linear iterations that triggers the rebuild of the reused system.
+   * \return Ratio to the iterations of the first solve after the last rebuild.
+   */
+  su2double GetDeform_Rebuild_Ratio(void);
+  
+  /*!
+   * \brief Get the maximum number of surface control points of the RBF mesh deformation.
+   * \return Maximum number of control points.
+   */
+  unsigned long GetDeform_RBF_MaxPoints(void);
+  
+  /*!
+   * \brief Get the support radius of the radial basis functions of the mesh deformation.
+   * \return Support radius.
+   */
+  su2double GetDeform_RBF_Radius(void);
+  
+  /*!
+   * \brief Get the tolerance of the greedy selection of the RBF control points.
+   * \return Error of the interpolated surface displacements relative to the maximum displacement.
+   */
+  su2double GetDeform_RBF_Tolerance(void);
+  
+  /*!
+   * \brief Check whether the wall distance is updated after the deformation of the mesh.
+   * \return <code>TRUE</code> if the wall distance is updated; otherwise <code>FALSE</code>.
+   */
+  bool GetUpdate_Wall_Distance(void);
+  
+  /*!
+   * \brief Check whether only the dual grid around the moved points is updated after the deformation.
+   * \return <code>TRUE</code> if the update is restricted to the moved region; otherwise <code>FALSE</code>.
+   */
+  bool GetPartial_DualGrid_Update(void);
+  
   /*!
    * \brief Creates a tecplot file to visualize the volume deformation deformation made by the DEF software.
    * \return <code>TRUE</code> if the deformation is going to be plotted; otherwise <code>FALSE</code>.
@@ -4436,6 +4873,12 @@ public:
    * \return Kind of upwind convective numerical scheme for the flow equations.
    */
   unsigned short GetKind_Upwind_Flow(void);
+  
+  /*!
+   * \brief Get whether the convective fluxes of the flow equations are evaluated in batches of edges.
+   * \return <code>TRUE</code> if SIMD_WIDTH edges are passed at once to the numerics (structure of arrays).
+   */
+  bool GetBatch_Flux(void);
 
   /*!
    * \brief Get the kind of finite element convective numerical scheme for the flow equations.
@@ -4657,6 +5100,13 @@ public:
    */
   bool GetFrozen_Visc_Cont(void);
   
+  /*!
+   * \brief Get whether the implicit cont. adjoint is solved with the transposed Jacobian (and preconditioner)
+   *        of the last flow iteration, instead of assembling its own Jacobian.
+   * \return <code>TRUE</code> if the Jacobian of the flow solver is reused.
+   */
+  bool GetCont_Adj_Primal_Jacobian(void);
+  
   /*!
    * \brief Provides information about the way in which the turbulence will be treated by the
    *        disc. adjoint method.
@@ -4670,6 +5120,67 @@ public:
    */
   bool GetInconsistent_Disc(void);
 
+  /*!
+   * \brief Provides information about the solution method of the steady discrete adjoint.
+   * \return <code>TRUE</code> if the fixed-point iteration is accelerated with FGMRES.
+   */
+  bool GetDiscAdj_Krylov(void);
+
+  /*!
+   * \brief Get the size of the Krylov subspace of the discrete adjoint FGMRES solver.
+   * \return Number of tape evaluations per restart cycle.
+   */
+  unsigned short GetDiscAdj_Krylov_Size(void);
+
+  /*!
+   * \brief Provides information about the coarse grid correction of the steady discrete adjoint.
+   * \return <code>TRUE</code> if the fixed-point iteration is accelerated with the agglomerated multigrid levels,
+   *         using the transposed implicit operators (V/dt + dR/dU) of the coarse levels.
+   */
+  bool GetDiscAdj_MultiGrid(void);
+
+  /*!
+   * \brief Get the number of smoothing iterations on each level of the discrete adjoint coarse grid correction.
+   * \return Number of linear iterations before and after the visit of the next coarser level.
+   */
+  unsigned short GetDiscAdj_MultiGrid_Iter(void);
+
+  /*!
+   * \brief Get the number of previous iterates of the Anderson acceleration of the steady fixed-point iterations.
+   * \return Number of differences kept, 0 if the acceleration is disabled.
+   */
+  unsigned short GetAnderson_Depth(void);
+
+  /*!
+   * \brief Get the relaxation of the residual in the Anderson acceleration.
+   * \return Relaxation, 1 for the plain Anderson mixing.
+   */
+  su2double GetAnderson_Relaxation(void);
+
+  /*!
+   * \brief Provides information about the objective sweep of the steady discrete adjoint.
+   * \return <code>TRUE</code> if one adjoint is solved for each objective function, instead of one for their weighted sum.
+   */
+  bool GetDiscAdj_ObjSweep(void);
+
+  /*!
+   * \brief Provides information about the evaluation of the mesh sensitivities of the steady discrete adjoint.
+   * \return <code>TRUE</code> if the geometry tape is only recorded after the last adjoint iteration.
+   */
+  bool GetDiscAdj_Sens_Final(void);
+
+  /*!
+   * \brief Get the objective function of the current adjoint of the objective sweep.
+   * \return Index of the objective function in OBJECTIVE_FUNCTION.
+   */
+  unsigned short GetiObj_Sweep(void);
+
+  /*!
+   * \brief Set the objective function of the current adjoint of the objective sweep (also the extension of the adjoint files).
+   * \param[in] val_iObj - Index of the objective function in OBJECTIVE_FUNCTION.
+   */
+  void SetiObj_Sweep(unsigned short val_iObj);
+
   /*!
    * \brief Provides information about the way in which the limiter will be treated by the
    *        disc. adjoint method.
@@ -5088,6 +5599,12 @@ public:
    * \return Kind of sensitivity smoothing technique.
    */
   unsigned short GetKind_SensSmooth(void);
+
+  /*!
+   * \brief Get the coefficient of the surface Laplace-Beltrami term of the sensitivity smoothing.
+   * \return Smoothing coefficient (length squared).
+   */
+  su2double GetSensSmooth_Coeff(void);
   
   /*!
    * \brief Provides information about the time integration, and change the write in the output
@@ -5254,6 +5771,56 @@ public:
    */
   bool GetRead_Binary_Restart(void);
 
+  /*!
+   * \brief Flag for whether the binary restart files are written in the compact format.
+   * \return <code>TRUE</code> if only the selected fields are written, with the non-solution fields in reduced precision.
+   */
+  bool GetWrt_Compact_Restart(void);
+
+  /*!
+   * \brief Flag for whether the binary restart files are written by a background thread.
+   * \return Flag for asynchronous writing of the restart files.
+   */
+  bool GetWrt_Async_Restart(void);
+
+  /*!
+   * \brief Flag for whether the solution files are interpolated from a different mesh.
+   * \return <code>TRUE</code> if the values of the nearest point of the file are loaded at each point of the mesh.
+   */
+  bool GetRestart_Interpolate(void);
+
+  /*!
+   * \brief Get the native mesh file of the solution files interpolated at restart.
+   * \return Name of the mesh file, NONE if the values of the nearest point are loaded.
+   */
+  string GetRestart_Interpolate_Mesh(void);
+
+  /*!
+   * \brief Get the storage of the non-solution fields of compact restart files.
+   * \return Kind of storage (see ENUM_COMPACT_RESTART).
+   */
+  unsigned short GetKind_Compact_Restart(void);
+
+  /*!
+   * \brief Get the number of fields written in compact restart files, in addition to the ones needed to restart.
+   * \return Number of additional fields.
+   */
+  unsigned short GetnCompact_Restart_Fields(void);
+
+  /*!
+   * \brief Get the name of an additional field of compact restart files.
+   * \param[in] val_field - Index of the field.
+   * \return Name of the field (as in the header of the restart file).
+   */
+  string GetCompact_Restart_Fields(unsigned short val_field);
+
+  /*!
+   * \brief Check whether a group of derived fields is selected for the volume output.
+   * \param[in] val_field - Keyword of the group (as in VOLUME_OUTPUT_FIELDS).
+   * \return <code>TRUE</code> if the group was listed, or if no selection was given.
+   */
+  bool GetVolume_Output_Field(string val_field);
+
   /*!
    * \brief Provides the number of varaibles.
    * \return Number of variables.
@@ -5354,12 +5921,69 @@ public:
    */
   unsigned short GetMesh_FileFormat(void);
   
+  /*!
+   * \brief Flag for the use of the index of the byte offsets of the SU2 ASCII mesh (created when missing).
+   * \return <code>TRUE</code> if the sections of the mesh file are located with the index.
+   */
+  bool GetMesh_Offsets_Index(void);
+
+  /*!
+   * \brief Check whether the graph partitioning is stored and reused in later runs.
+   * \return <code>TRUE</code> if the partition cache is used; otherwise <code>FALSE</code>.
+   */
+  bool GetPartition_Cache(void);
+  
+  /*!
+   * \brief Get the number of other rank counts for which the partitioning is stored in the cache.
+   * \return Number of entries of PARTITION_CACHE_RANKS.
+   */
+  unsigned short GetnPartition_Cache_Ranks(void);
+  
+  /*!
+   * \brief Get one of the other rank counts for which the partitioning is stored in the cache.
+   * \param[in] val_index - Index of the entry of PARTITION_CACHE_RANKS.
+   * \return Number of ranks.
+   */
+  unsigned short GetPartition_Cache_Ranks(unsigned short val_index);
+  
+  /*!
+   * \brief Check whether the partitions are balanced on the edges and the boundary vertices of the points.
+   * \return <code>TRUE</code> if multi-constraint weights are given to ParMETIS; otherwise <code>FALSE</code>.
+   */
+  bool GetPartition_Weights(void);
+  
+  /*!
+   * \brief Check whether the halos of the ranks of a node are exchanged through shared memory.
+   * \return <code>TRUE</code> if MPI-3 shared memory windows are used on the node; otherwise <code>FALSE</code>.
+   */
+  bool GetShared_Memory_Comms(void);
+  
+  /*!
+   * \brief Check whether the statistics of the MPI communication are collected.
+   * \return <code>TRUE</code> if the communication is profiled; otherwise <code>FALSE</code>.
+   */
+  bool GetComm_Profiling(void);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
    */
   unsigned short GetOutput_FileFormat(void);
   
+  /*!
+   * \brief Get the default precision of the fields in the XDMF and Tecplot binary files.
+   * \return Precision of the fields, see ENUM_OUTPUT_PRECISION.
+   */
+  unsigned short GetOutput_Precision(void);
+  
+  /*!
+   * \brief Get the precision of a field in the XDMF and Tecplot binary files.
+   * \param[in] val_field - Name of the field, as in the output files.
+   * \param[out] val_error - Bound of the absolute error if the field is quantized, zero for the finest quantization.
+   * \return Precision of the field, see ENUM_OUTPUT_PRECISION.
+   */
+  unsigned short GetOutput_Precision(string val_field, su2double & val_error);
+  
   /*!
    * \brief Get the format of the output solution.
    * \return Format of the output solution.
@@ -6278,6 +6902,18 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void);
   
+  /*!
+   * \brief Check whether the points of the partition interfaces are agglomerated as interior points.
+   * \return <code>TRUE</code> if the interfaces do not restrict the agglomeration; otherwise <code>FALSE</code>.
+   */
+  bool GetMG_Interface_Agglomeration(void);
+  
+  /*!
+   * \brief Check whether the multigrid cycle is adapted at runtime from the residual reduction of each level.
+   * \return <code>TRUE</code> if the smoothing sweeps, the cycle, and the depth are adapted; otherwise <code>FALSE</code>.
+   */
+  bool GetMG_Adaptive_Cycle(void);
+  
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -8088,6 +8724,19 @@ public:
    */
   void SetRunTime_Options(void);
   
+  /*!
+   * \brief Read (master node) and broadcast a config file, and tokenize its options. The
+   *        tokens are kept between calls and only recomputed when the file contents change.
+   * \param[in] case_filename - Name of the config file.
+   * \returns The option names and values of the file, in order of appearance.
+   */
+  const vector<pair<string, vector<string> > >& ReadConfig_File(char case_filename[MAX_STRING_SIZE]);
+  
+  /*!
+   * \brief Release the contents and tokens of the config files read so far.
+   */
+  static void ClearConfig_FileCache(void);
+  
   /*!
    * \brief Set the config file parsing.
    */
@@ -8267,6 +8916,19 @@ public:
    */
   su2double GetFFD_Tol(void);
   
+  /*!
+   * \brief Get whether SU2_DOT projects the surface sensitivities with the FFD control point Jacobian.
+   * \return <code>TRUE</code> if the gradient is obtained from a single product with the transposed Jacobian.
+   */
+  bool GetFFD_Jacobian_Projection(void);
+  
+  /*!
+   * \brief Get whether SU2_DOT only preprocesses the surface of the mesh (connectivity,
+   *        edges and dual volumes are skipped), which is enough for the continuous adjoint.
+   * \return <code>TRUE</code> if only the boundary control volume is built.
+   */
+  bool GetDot_Surface_Only(void);
+  
   /*!
    * \brief Get the scale factor for the line search.
    * \return Scale factor for the line search.
@@ -8339,6 +9001,20 @@ public:
    */
   unsigned long GetIter_dCL_dAlpha(void);
   
+  /*!
+   * \brief Get whether the AoA of the fixed CL mode is updated by Newton steps, with dCL_dAlpha
+   *        estimated by secants through the (AoA, CL) pairs of the previous updates.
+   * \return <code>TRUE</code> for the Newton updates.
+   */
+  bool GetFixed_CL_Newton(void);
+  
+  /*!
+   * \brief Get the drop of the density residual since the last change of the AoA, in orders of
+   *        magnitude, after which the next Newton update of the AoA is made.
+   * \return Orders of magnitude of the residual drop.
+   */
+  su2double GetFixed_CL_Newton_Residual(void);
+  
   /*!
    * \brief Get the value of the damping coefficient for fixed CL mode.
    * \return Damping coefficient for fixed CL mode.
@@ -8447,12 +9123,14 @@ public:
    * \brief Stop the timer for profiling subroutines and store results.
    * \param[in] val_start_time - the value of the start time.
    * \param[in] val_function_name - string for the name of the profiled subroutine.
-   * \param[in] val_group_id - string for the name of the profiled subroutine.
+   * \param[in] val_group_id - group of the profiled subroutine, see PROFILE_GROUPS.
    */
   void Tock(double val_start_time, string val_function_name, int val_group_id);
 
   /*!
-   * \brief Write a CSV file containing the results of the profiling.
+   * \brief Write a CSV file containing the results of the profiling, with the
+   *        average, minimum and maximum over the ranks of the time of each function
+   *        (and the hardware counters if compiled with HAVE_PAPI).
    */
   void SetProfilingCSV(void);
 
@@ -8510,6 +9188,12 @@ public:
    * \return direct differentiation method.
    */
   unsigned short GetDirectDiff();
+
+  /*!
+   * \brief Get the number of tangent directions seeded in the direct differentiation w.r.t. the design variables.
+   * \return Number of tangent directions.
+   */
+  unsigned short GetDirectDiff_Directions(void);
   
   /*!
    * \brief Get the indicator whether we are solving an discrete adjoint problem.
@@ -8553,6 +9237,18 @@ public:
    */
   su2double GetAitkenDynMinInit(void);
   
+  /*!
+   * \brief Get the maximum number of secant vectors kept by the IQN-ILS relaxation.
+   * \return Maximum number of secant vectors.
+   */
+  unsigned short GetIQN_ILS_MaxVectors(void);
+  
+  /*!
+   * \brief Get the number of previous time steps whose secant vectors are reused by the IQN-ILS relaxation.
+   * \return Number of reused time steps.
+   */
+  unsigned short GetIQN_ILS_ReuseSteps(void);
+  
   
   /*!
    * \brief Decide whether to apply dead loads to the model.
@@ -8859,6 +9555,19 @@ public:
    */
   su2double GetQuadrature_Factor_Time_ADER_DG(void);
 
+  /*!
+   * \brief Get the relative tolerance of the iterative predictor step of ADER-DG.
+   * \return The relative tolerance of the ADER-DG predictor.
+   */
+  su2double GetTol_Predictor_ADER_DG(void);
+
+  /*!
+   * \brief Get the maximum number of iterations of the predictor step of ADER-DG
+            carried out for an element.
+   * \return The maximum number of iterations of the ADER-DG predictor.
+   */
+  unsigned short GetMaxIter_Predictor_ADER_DG(void);
+
   /*!
    * \brief Function to make available the multiplication factor theta of the
             symmetrizing terms in the DG discretization of the viscous terms.
@@ -8873,6 +9582,42 @@ public:
    */
   unsigned short GetSizeMatMulPadding(void);
 
+  /*!
+   * \brief Function to make available the number of threads per rank, which
+            carry out the tasks list of the DG solver.
+   * \return The number of threads, including the thread of the rank itself.
+   */
+  unsigned short GetnThreads_DGFEM(void);
+
+  /*!
+   * \brief Function to make available whether or not sum-factorization is used
+            for the volume integrals of quadrilaterals, hexahedra and prisms.
+   * \return The boolean whether or not sum-factorization is used.
+   */
+  bool GetSumFactorization_DGFEM(void);
+
+  /*!
+   * \brief Function to make available whether or not the metric terms of DG elements
+            with constant metric terms are stored only once.
+   * \return The boolean whether or not the metric terms are compressed.
+   */
+  bool GetCompressed_MetricTerms_DGFEM(void);
+
+  /*!
+   * \brief Function to make available the number of evaluations of the tasks list
+            of the DG solver between two reports of the load imbalance. This is a
+            diagnostic only, the grid is not repartitioned during the run.
+   * \return The frequency of the load imbalance report. 0 means no report.
+   */
+  unsigned long GetLoadImbalance_Report_Freq_DGFEM(void);
+
+  /*!
+   * \brief Function to make available the ratio of the maximum and average work
+            per rank of the DG solver above which the load imbalance is reported.
+   * \return The tolerance of the load imbalance report.
+   */
+  su2double GetLoadImbalance_Report_Tol_DGFEM(void);
+
   /*!
    * \brief Function to make available whether or not the entropy must be computed.
    * \return The boolean whether or not the entropy must be computed.
@@ -8918,6 +9663,11 @@ public:
    */
   inline su2double GetRadialBasisFunctionParameter(void);
 
+  /*!
+   * \brief Get option of whether to compute sparse Radial Basis Function weights from the compact support of the basis.
+   */
+  inline bool GetRadialBasisFunctionSparse(void);
+
   /*!
    * \brief Get information about using UQ methodology
    * \return <code>TRUE</code> means that UQ methodology of eigenspace perturbation will be used
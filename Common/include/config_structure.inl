@@ -43,6 +43,16 @@ inline su2double CConfig::GetCFL_AdaptParam(unsigned short val_index) { return C
 
 inline bool CConfig::GetCFL_Adapt(void) { return CFL_Adapt; }
 
+inline bool CConfig::GetCFL_Adapt_LinSol(void) { return CFL_Adapt_LinSol; }
+
+inline su2double CConfig::GetCFL_AdaptParam_LinSol(unsigned short val_index) { return CFL_AdaptParam_LinSol[val_index]; }
+
+inline bool CConfig::GetCFL_Adapt_Local(void) { return CFL_Adapt_Local; }
+
+inline bool CConfig::GetLocal_Freezing(void) { return Local_Freezing; }
+
+inline su2double CConfig::GetLocal_Freezing_Param(unsigned short val_index) { return Local_Freezing_Param[val_index]; }
+
 inline bool CConfig::GetHB_Precondition(void) { return HB_Precondition; }
 
 inline void CConfig::SetInflow_Mach(unsigned short val_imarker, su2double val_fanface_mach) { Inflow_Mach[val_imarker] = val_fanface_mach; }
@@ -321,14 +331,26 @@ inline unsigned long CConfig::GetIntIter(void) { return IntIter; }
 
 inline unsigned long CConfig::GetUnst_nIntIter(void) { return Unst_nIntIter; }
 
+inline su2double CConfig::GetUnst_Residual_Drop(void) { return Unst_Residual_Drop; }
+
+inline bool CConfig::GetUnst_Predictor(void) { return Unst_Predictor; }
+
 inline unsigned long CConfig::GetDyn_nIntIter(void) { return Dyn_nIntIter; }
 
 inline long CConfig::GetUnst_RestartIter(void) { return Unst_RestartIter; }
 
 inline long CConfig::GetUnst_AdjointIter(void) { return Unst_AdjointIter; }
 
+inline unsigned short CConfig::GetUnst_Adjoint_nCheckpoint(void) { return Unst_Adjoint_nCheckpoint; }
+
 inline bool CConfig::GetReorientElements(void) { return ReorientElements; }
 
+inline bool CConfig::GetEdge_Coloring(void) { return Edge_Coloring; }
+
+inline unsigned short CConfig::GetnThreads_Flow(void) { return nThreads_Flow; }
+
+inline unsigned short CConfig::GetKind_Point_Ordering(void) { return Kind_Point_Ordering; }
+
 inline unsigned long CConfig::GetIter_Avg_Objective(void) { return Iter_Avg_Objective ; }
 
 inline long CConfig::GetDyn_RestartIter(void) { return Dyn_RestartIter; }
@@ -413,6 +435,12 @@ inline unsigned short CConfig::GetGeometricConditions(void) { return Kind_Struct
 
 inline bool CConfig::GetPrestretch(void) { return Prestretch; }
 
+inline unsigned short CConfig::GetnThreads_FEA(void) { return nThreads_FEA; }
+
+inline bool CConfig::GetPrecompute_RefGrad_FEA(void) { return Precompute_RefGrad_FEA; }
+
+inline bool CConfig::GetMatrixFree_FEA(void) { return MatrixFree_FEA; }
+
 inline bool CConfig::Add_CrossTerm(void) { return addCrossTerm; }
 
 inline void CConfig::Set_CrossTerm(bool needCrossTerm) { addCrossTerm = needCrossTerm; }
@@ -724,6 +752,10 @@ inline void CConfig::SetAoS(su2double val_AoS) { AoS = val_AoS; }
 
 inline su2double CConfig::GetAoS(void) { return AoS; }
 
+inline unsigned short CConfig::GetnEnsemble(void) { return nEnsemble; }
+
+inline unsigned short CConfig::GetiEnsemble(void) { return iEnsemble; }
+
 inline su2double CConfig::GetAoA_Offset(void) { return AoA_Offset; }
 
 inline su2double CConfig::GetAoS_Offset(void) { return AoS_Offset; }
@@ -764,6 +796,12 @@ inline su2double CConfig::GetUnst_CFL(void) {	return Unst_CFL; }
 
 inline su2double CConfig::GetMax_DeltaTime(void) {	return Max_DeltaTime; }
 
+inline bool CConfig::GetReuse_Spectral_Radius(void) { return Reuse_Spectral_Radius; }
+
+inline unsigned short CConfig::GetnRes_Smooth_Iter(void) { return nRes_Smooth_Iter; }
+
+inline su2double CConfig::GetRes_Smooth_Coeff(void) { return Res_Smooth_Coeff; }
+
 inline su2double CConfig::GetParamDV(unsigned short val_dv, unsigned short val_param) {	return ParamDV[val_dv][val_param]; }
 
 inline su2double CConfig::GetCoordFFDBox(unsigned short val_ffd, unsigned short val_index) {	return CoordFFDBox[val_ffd][val_index]; }
@@ -837,6 +875,14 @@ inline unsigned long CConfig::GetWrt_Sol_Freq(void) { return Wrt_Sol_Freq; }
 
 inline unsigned long CConfig::GetWrt_Sol_Freq_DualTime(void) { return Wrt_Sol_Freq_DualTime; }
 
+inline unsigned long CConfig::GetWrt_Srf_Hist_Freq(void) { return Wrt_Srf_Hist_Freq; }
+
+inline unsigned long CConfig::GetHistory_Flush_Freq(void) { return History_Flush_Freq; }
+
+inline bool CConfig::GetWrt_Time_Average(void) { return Wrt_Time_Average; }
+
+inline unsigned long CConfig::GetTime_Average_Start_Iter(void) { return Time_Average_Start_Iter; }
+
 inline unsigned long CConfig::GetWrt_Con_Freq(void) { return Wrt_Con_Freq; }
 
 inline void CConfig::SetWrt_Con_Freq(unsigned long val_freq) { Wrt_Con_Freq = val_freq; }
@@ -873,6 +919,20 @@ inline su2double CConfig::GetTemperature_Critical(void) { return Temperature_Cri
 
 inline su2double CConfig::GetAcentric_Factor(void) { return Acentric_Factor; }
 
+inline bool CConfig::GetLUT_FluidModel(void) { return LUT_FluidModel; }
+
+inline unsigned short CConfig::GetLUT_nPoints(void) { return LUT_nPoints; }
+
+inline string CConfig::GetLUT_FileName(void) { return LUT_FileName; }
+
+inline su2double CConfig::GetLUT_Pressure_Min(void) { return LUT_Pressure_Min; }
+
+inline su2double CConfig::GetLUT_Pressure_Max(void) { return LUT_Pressure_Max; }
+
+inline su2double CConfig::GetLUT_Temperature_Min(void) { return LUT_Temperature_Min; }
+
+inline su2double CConfig::GetLUT_Temperature_Max(void) { return LUT_Temperature_Max; }
+
 inline unsigned short CConfig::GetKind_ViscosityModel(void) { return Kind_ViscosityModel; }
 
 inline unsigned short CConfig::GetKind_ConductivityModel(void) { return Kind_ConductivityModel; }
@@ -1009,6 +1069,10 @@ inline su2double CConfig::GetmaxTurkelBeta() { return  Max_Beta_RoeTurkel; }
 
 inline unsigned short CConfig::GetKind_Gradient_Method(void) { return Kind_Gradient_Method; }
 
+inline bool CConfig::GetFused_Gradient_Limiter(void) { return Fused_Gradient_Limiter; }
+
+inline bool CConfig::GetCache_LS_Weights(void) { return Cache_LS_Weights; }
+
 inline unsigned short CConfig::GetKind_Linear_Solver(void) { return Kind_Linear_Solver; }
 
 inline unsigned short CConfig::GetKind_Deform_Linear_Solver(void) { return Kind_Deform_Linear_Solver; }
@@ -1025,12 +1089,30 @@ inline su2double CConfig::GetDeform_Linear_Solver_Error(void) { return Deform_Li
 
 inline unsigned long CConfig::GetLinear_Solver_Iter(void) { return Linear_Solver_Iter; }
 
+inline bool CConfig::GetReproducible_Reductions(void) { return Reproducible_Reductions; }
+
 inline unsigned long CConfig::GetDeform_Linear_Solver_Iter(void) { return Deform_Linear_Solver_Iter; }
 
 inline unsigned short CConfig::GetLinear_Solver_ILU_n(void) { return Linear_Solver_ILU_n; }
 
+inline unsigned short CConfig::GetLinear_Solver_RAS_Overlap(void) { return Linear_Solver_RAS_Overlap; }
+
+inline bool CConfig::GetLinear_Solver_Mixed_Precision(void) { return Linear_Solver_Mixed_Precision; }
+
+inline bool CConfig::GetLinear_Solver_Reuse_Heat(void) { return Linear_Solver_Reuse_Heat; }
+
+inline bool CConfig::GetNewton_Krylov(void) { return Newton_Krylov; }
+
+inline bool CConfig::GetCoupled_Turb_Implicit(void) { return Coupled_Turb_Implicit; }
+
+inline unsigned short CConfig::GetJacobian_Lag(void) { return Jacobian_Lag; }
+
+inline bool CConfig::GetJacobian_Edge_Format(void) { return Jacobian_Edge_Format; }
+
 inline unsigned long CConfig::GetLinear_Solver_Restart_Frequency(void) { return Linear_Solver_Restart_Frequency; }
 
+inline unsigned short CConfig::GetLinear_Solver_Recycle_Size(void) { return Linear_Solver_Recycle_Size; }
+
 inline su2double CConfig::GetRelaxation_Factor_Flow(void) { return Relaxation_Factor_Flow; }
 
 inline su2double CConfig::GetRelaxation_Factor_AdjFlow(void) { return Relaxation_Factor_AdjFlow; }
@@ -1051,6 +1133,8 @@ inline unsigned short CConfig::GetKind_DiscAdj_Linear_Solver(void) { return Kind
 
 inline unsigned short CConfig::GetKind_DiscAdj_Linear_Prec(void) { return Kind_DiscAdj_Linear_Prec; }
 
+inline bool CConfig::GetDiscAdj_Linear_WarmStart(void) { return DiscAdj_Linear_WarmStart; }
+
 inline unsigned short CConfig::GetKind_Deform_Linear_Solver_Prec(void) { return Kind_Deform_Linear_Solver_Prec; }
 
 inline void CConfig::SetKind_AdjTurb_Linear_Prec(unsigned short val_kind_prec) { Kind_AdjTurb_Linear_Prec = val_kind_prec; }
@@ -1065,6 +1149,8 @@ inline su2double CConfig::GetCFLRedCoeff_AdjTurb(void) { return CFLRedCoeff_AdjT
 
 inline unsigned long CConfig::GetGridDef_Linear_Iter(void) { return GridDef_Linear_Iter; }
 
+inline unsigned short CConfig::GetnThreads_Deform(void) { return nThreads_Deform; }
+
 inline unsigned long CConfig::GetGridDef_Nonlinear_Iter(void) { return GridDef_Nonlinear_Iter; }
 
 inline bool CConfig::GetDeform_Output(void) { return Deform_Output; }
@@ -1079,6 +1165,22 @@ inline su2double CConfig::GetDeform_PoissonRatio(void) { return Deform_PoissonRa
 
 inline unsigned short CConfig::GetDeform_Stiffness_Type(void) { return Deform_Stiffness_Type; }
 
+inline unsigned short CConfig::GetKind_Deform_Method(void) { return Kind_Deform_Method; }
+
+inline unsigned short CConfig::GetKind_Deform_Reuse(void) { return Kind_Deform_Reuse; }
+
+inline su2double CConfig::GetDeform_Rebuild_Ratio(void) { return Deform_Rebuild_Ratio; }
+
+inline unsigned long CConfig::GetDeform_RBF_MaxPoints(void) { return Deform_RBF_MaxPoints; }
+
+inline su2double CConfig::GetDeform_RBF_Radius(void) { return Deform_RBF_Radius; }
+
+inline su2double CConfig::GetDeform_RBF_Tolerance(void) { return Deform_RBF_Tolerance; }
+
+inline bool CConfig::GetUpdate_Wall_Distance(void) { return Update_Wall_Distance; }
+
+inline bool CConfig::GetPartial_DualGrid_Update(void) { return Partial_DualGrid_Update; }
+
 inline bool CConfig::GetVisualize_Volume_Def(void) { return Visualize_Volume_Def; }
 
 inline bool CConfig::GetVisualize_Surface_Def(void) { return Visualize_Surface_Def; }
@@ -1141,6 +1243,8 @@ inline unsigned short CConfig::GetKind_SlopeLimit_AdjFlow(void) { return Kind_Sl
 
 inline unsigned short CConfig::GetKind_Upwind_Flow(void) { return Kind_Upwind_Flow; }
 
+inline bool CConfig::GetBatch_Flux(void) { return Batch_Flux; }
+
 inline unsigned short CConfig::GetKind_FEM_Flow(void) { return Kind_FEM_Flow; }
 
 inline unsigned short CConfig::GetKind_FEM_DG_Shock(void) { return Kind_FEM_DG_Shock; }
@@ -1301,6 +1405,8 @@ inline su2double CConfig::GetGeo_Waterline_Location(void) { return Geo_Waterline
 
 inline void CConfig::SetKind_TimeIntScheme(unsigned short val_kind_timeintscheme) { Kind_TimeNumScheme = val_kind_timeintscheme; }
 
+inline void CConfig::SetKind_TimeIntScheme_Flow(unsigned short val_kind_timeintscheme) { Kind_TimeIntScheme_Flow = val_kind_timeintscheme; }
+
 inline unsigned short CConfig::GetKind_ObjFunc(void) { return Kind_ObjFunc[0]; }
 
 inline unsigned short CConfig::GetKind_ObjFunc(unsigned short val_obj) { return Kind_ObjFunc[val_obj]; }
@@ -1313,12 +1419,28 @@ inline su2double CConfig::GetCoeff_ObjChainRule(unsigned short iVar) { return Ob
 
 inline unsigned short CConfig::GetKind_SensSmooth(void) { return Kind_SensSmooth; }
 
+inline su2double CConfig::GetSensSmooth_Coeff(void) { return SensSmooth_Coeff; }
+
 inline unsigned short CConfig::GetUnsteady_Simulation(void) { return Unsteady_Simulation; }
 
 inline bool CConfig::GetRestart(void) {	return Restart; }
 
 inline bool CConfig::GetWrt_Binary_Restart(void) {	return Wrt_Binary_Restart; }
 
+inline bool CConfig::GetWrt_Compact_Restart(void) { return Wrt_Compact_Restart; }
+
+inline bool CConfig::GetWrt_Async_Restart(void) { return Wrt_Async_Restart; }
+
+inline bool CConfig::GetRestart_Interpolate(void) { return Restart_Interpolate; }
+
+inline string CConfig::GetRestart_Interpolate_Mesh(void) { return Restart_Interpolate_Mesh; }
+
+inline unsigned short CConfig::GetKind_Compact_Restart(void) { return Kind_Compact_Restart; }
+
+inline unsigned short CConfig::GetnCompact_Restart_Fields(void) { return nCompact_Restart_Fields; }
+
+inline string CConfig::GetCompact_Restart_Fields(unsigned short val_field) { return Compact_Restart_Fields[val_field]; }
+
 inline bool CConfig::GetRead_Binary_Restart(void) {	return Read_Binary_Restart; }
 
 inline bool CConfig::GetRestart_Flow(void) { return Restart_Flow; }
@@ -1466,8 +1588,24 @@ inline string CConfig::GetMesh_Out_FileName(void) { return Mesh_Out_FileName; }
 
 inline unsigned short CConfig::GetMesh_FileFormat(void) { return Mesh_FileFormat; }
 
+inline bool CConfig::GetMesh_Offsets_Index(void) { return Mesh_Offsets_Index; }
+
+inline bool CConfig::GetPartition_Cache(void) { return Partition_Cache; }
+
+inline unsigned short CConfig::GetnPartition_Cache_Ranks(void) { return nPartition_Cache_Ranks; }
+
+inline unsigned short CConfig::GetPartition_Cache_Ranks(unsigned short val_index) { return Partition_Cache_Ranks[val_index]; }
+
+inline bool CConfig::GetPartition_Weights(void) { return Partition_Weights; }
+
+inline bool CConfig::GetShared_Memory_Comms(void) { return Shared_Memory_Comms; }
+
+inline bool CConfig::GetComm_Profiling(void) { return Comm_Profiling; }
+
 inline unsigned short CConfig::GetOutput_FileFormat(void) { return Output_FileFormat; }
 
+inline unsigned short CConfig::GetOutput_Precision(void) { return Output_Precision; }
+
 inline unsigned short CConfig::GetActDisk_Jump(void) { return ActDisk_Jump; }
 
 inline string CConfig::GetConv_FileName(void) { return Conv_FileName; }
@@ -1572,6 +1710,10 @@ inline su2double CConfig::GetDamp_Res_Restric(void) { return Damp_Res_Restric; }
 
 inline su2double CConfig::GetDamp_Correc_Prolong(void) { return Damp_Correc_Prolong; }
 
+inline bool CConfig::GetMG_Interface_Agglomeration(void) { return MG_Interface_Agglomeration; }
+
+inline bool CConfig::GetMG_Adaptive_Cycle(void) { return MG_Adaptive_Cycle; }
+
 inline su2double CConfig::GetPosition_Plane(void) { return Position_Plane; }
 
 inline su2double CConfig::GetWeightCd(void) { return WeightCd; }
@@ -1640,12 +1782,34 @@ inline unsigned short CConfig::GetKind_SGS_Model(void) { return Kind_SGS_Model;
 
 inline bool CConfig::GetFrozen_Visc_Cont(void) { return Frozen_Visc_Cont; }
 
+inline bool CConfig::GetCont_Adj_Primal_Jacobian(void) { return Cont_Adj_Primal_Jacobian; }
+
 inline bool CConfig::GetFrozen_Visc_Disc(void) { return Frozen_Visc_Disc; }
 
 inline bool CConfig::GetFrozen_Limiter_Disc(void){ return Frozen_Limiter_Disc; }
 
 inline bool CConfig::GetInconsistent_Disc(void){ return Inconsistent_Disc; }
 
+inline bool CConfig::GetDiscAdj_Krylov(void) { return DiscAdj_Krylov; }
+
+inline unsigned short CConfig::GetDiscAdj_Krylov_Size(void) { return DiscAdj_Krylov_Size; }
+
+inline bool CConfig::GetDiscAdj_MultiGrid(void) { return DiscAdj_MultiGrid; }
+
+inline unsigned short CConfig::GetDiscAdj_MultiGrid_Iter(void) { return DiscAdj_MultiGrid_Iter; }
+
+inline unsigned short CConfig::GetAnderson_Depth(void) { return Anderson_Depth; }
+
+inline su2double CConfig::GetAnderson_Relaxation(void) { return Anderson_Relaxation; }
+
+inline bool CConfig::GetDiscAdj_ObjSweep(void) { return DiscAdj_ObjSweep; }
+
+inline bool CConfig::GetDiscAdj_Sens_Final(void) { return DiscAdj_Sens_Final; }
+
+inline unsigned short CConfig::GetiObj_Sweep(void) { return iObj_Sweep; }
+
+inline void CConfig::SetiObj_Sweep(unsigned short val_iObj) { iObj_Sweep = val_iObj; }
+
 inline bool CConfig::GetSens_Remove_Sharp(void) { return Sens_Remove_Sharp; }
 
 inline bool CConfig::GetWrite_Conv_FSI(void) { return Write_Conv_FSI; }
@@ -1778,6 +1942,10 @@ inline unsigned short CConfig::GetnFFD_Iter(void) { return nFFD_Iter; }
 
 inline su2double CConfig::GetFFD_Tol(void) { return FFD_Tol; }
 
+inline bool CConfig::GetFFD_Jacobian_Projection(void) { return FFD_Jacobian_Projection; }
+
+inline bool CConfig::GetDot_Surface_Only(void) { return Dot_Surface_Only; }
+
 inline su2double CConfig::GetOpt_LineSearch_Bound(void) {return Opt_LineSearch_Bound; }
 
 inline su2double CConfig::GetOpt_RelaxFactor(void) {return Opt_RelaxFactor; }
@@ -1810,6 +1978,10 @@ inline unsigned long CConfig::GetUpdate_Alpha(void) {return Update_Alpha; }
 
 inline unsigned long CConfig::GetIter_dCL_dAlpha(void) {return Iter_dCL_dAlpha; }
 
+inline bool CConfig::GetFixed_CL_Newton(void) { return Fixed_CL_Newton; }
+
+inline su2double CConfig::GetFixed_CL_Newton_Residual(void) { return Fixed_CL_Newton_Residual; }
+
 inline bool CConfig::GetUpdate_AoA(void) { return Update_AoA; }
 
 inline bool CConfig::GetUpdate_BCThrust_Bool(void) { return Update_BCThrust_Bool; }
@@ -1844,6 +2016,10 @@ inline su2double CConfig::GetAitkenDynMaxInit(void) { return AitkenDynMaxInit; }
 
 inline su2double CConfig::GetAitkenDynMinInit(void) { return AitkenDynMinInit; }
 
+inline unsigned short CConfig::GetIQN_ILS_MaxVectors(void) { return IQN_ILS_MaxVectors; }
+
+inline unsigned short CConfig::GetIQN_ILS_ReuseSteps(void) { return IQN_ILS_ReuseSteps; }
+
 inline bool CConfig::GetDeadLoad(void) { return DeadLoad; }
 
 inline bool CConfig::GetPseudoStatic(void) { return PseudoStatic; }
@@ -1930,6 +2106,8 @@ inline bool CConfig::GetRadialBasisFunctionPolynomialOption(void) {return Radial
 
 inline su2double CConfig::GetRadialBasisFunctionParameter(void) {return RadialBasisFunction_Parameter; }
 
+inline bool CConfig::GetRadialBasisFunctionSparse(void) {return RadialBasisFunction_Sparse; }
+
 inline bool CConfig::GetConservativeInterpolation(void) { return ConservativeInterpolation; }
 
 inline unsigned short CConfig::GetRelaxation_Method_FSI(void) { return Kind_BGS_RelaxMethod; }
@@ -1958,6 +2136,8 @@ inline unsigned short CConfig::GetDynamic_LoadTransfer(void) { return Dynamic_Lo
 
 inline unsigned short CConfig::GetDirectDiff() { return DirectDiff;}
 
+inline unsigned short CConfig::GetDirectDiff_Directions(void) { return DirectDiff_Directions;}
+
 inline bool CConfig::GetDiscrete_Adjoint() { return DiscreteAdjoint;}
 
 inline unsigned short CConfig::GetRiemann_Solver_FEM(void) {return Riemann_Solver_FEM;}
@@ -1968,10 +2148,24 @@ inline su2double CConfig::GetQuadrature_Factor_Curved(void) {return Quadrature_F
 
 inline su2double CConfig::GetQuadrature_Factor_Time_ADER_DG(void) {return Quadrature_Factor_Time_ADER_DG;}
 
+inline su2double CConfig::GetTol_Predictor_ADER_DG(void) {return Tol_Predictor_ADER_DG;}
+
+inline unsigned short CConfig::GetMaxIter_Predictor_ADER_DG(void) {return MaxIter_Predictor_ADER_DG;}
+
 inline su2double CConfig::GetTheta_Interior_Penalty_DGFEM(void) {return Theta_Interior_Penalty_DGFEM;}
 
 inline unsigned short CConfig::GetSizeMatMulPadding(void) {return sizeMatMulPadding;}
 
+inline unsigned short CConfig::GetnThreads_DGFEM(void) {return nThreads_DGFEM;}
+
+inline bool CConfig::GetSumFactorization_DGFEM(void) {return SumFactorization_DGFEM;}
+
+inline bool CConfig::GetCompressed_MetricTerms_DGFEM(void) {return Compressed_MetricTerms_DGFEM;}
+
+inline unsigned long CConfig::GetLoadImbalance_Report_Freq_DGFEM(void) {return LoadImbalance_Report_Freq_DGFEM;}
+
+inline su2double CConfig::GetLoadImbalance_Report_Tol_DGFEM(void) {return LoadImbalance_Report_Tol_DGFEM;}
+
 inline bool CConfig::GetCompute_Entropy(void) {return Compute_Entropy;}
 
 inline bool CConfig::GetUse_Lumped_MassMatrix_DGFEM(void) {return Use_Lumped_MassMatrix_DGFEM;}
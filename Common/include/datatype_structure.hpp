@@ -63,6 +63,15 @@
 
 typedef double passivedouble;
 
+/*--- Type of the accumulators, norms and residual reductions. It keeps double precision in the
+ single precision builds and is the active type in the AD builds. ---*/
+
+#if defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
+typedef su2double accumdouble;
+#else
+typedef double accumdouble;
+#endif
+
 /*!
  * \namespace SU2_TYPE
  * \brief Namespace for defining the datatype wrapper routines; this class features as a base class for
@@ -112,6 +121,28 @@ namespace SU2_TYPE{
    */
   void SetDerivative(su2double &data, const double &val);
 
+  /*!
+   * \brief Get the derivative value of the datatype in one of the tangent directions of a vector forward type.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - Index of the tangent direction.
+   * \return The derivative value.
+   */
+  double GetDerivative(const su2double &data, const unsigned short &iDir);
+
+  /*!
+   * \brief Set the derivative value of the datatype in one of the tangent directions of a vector forward type.
+   * \param[in] data - The non-primitive datatype.
+   * \param[in] iDir - Index of the tangent direction.
+   * \param[in] val - The value of the derivative.
+   */
+  void SetDerivative(su2double &data, const unsigned short &iDir, const double &val);
+
+  /*!
+   * \brief Get the number of tangent directions carried by the datatype (1 for all but the vector forward type).
+   * \return The number of tangent directions.
+   */
+  unsigned short GetnDirections();
+
   /*!
    * \brief Casts the primitive value to int (uses GetValue, already implemented for each type).
    * \param[in] data - The non-primitive datatype.
@@ -38,5 +38,12 @@
 
 #include "codi.hpp"
 
+/*--- The vector forward type propagates CODI_FORWARD_DIRECTIONS tangent directions at once,
+ *    i.e. a single run yields the directional derivatives w.r.t. several variables. ---*/
+
+#if defined CODI_FORWARD_DIRECTIONS
+typedef codi::RealForwardVec<CODI_FORWARD_DIRECTIONS> su2double;
+#else
 typedef codi::RealForward su2double;
+#endif
 
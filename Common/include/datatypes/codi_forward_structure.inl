@@ -41,6 +41,21 @@ namespace SU2_TYPE{
 
   inline double GetValue(const su2double& data) { return data.getValue();}
 
+#if defined CODI_FORWARD_DIRECTIONS
+  inline void SetSecondary(su2double& data, const double &val) {data.gradient()[0] = val;}
+
+  inline double GetSecondary(const su2double& data) { return data.getGradient()[0];}
+
+  inline double GetDerivative(const su2double& data) { return data.getGradient()[0];}
+
+  inline void SetDerivative(su2double& data, const double &val) {data.gradient()[0] = val;}
+
+  inline double GetDerivative(const su2double& data, const unsigned short &iDir) { return data.getGradient()[iDir];}
+
+  inline void SetDerivative(su2double& data, const unsigned short &iDir, const double &val) {data.gradient()[iDir] = val;}
+
+  inline unsigned short GetnDirections() { return CODI_FORWARD_DIRECTIONS;}
+#else
   inline void SetSecondary(su2double& data, const double &val) {data.setGradient(val);}
 
   inline double GetSecondary(const su2double& data) { return data.getGradient();}
@@ -48,4 +63,11 @@ namespace SU2_TYPE{
   inline double GetDerivative(const su2double& data) { return data.getGradient();}
 
   inline void SetDerivative(su2double& data, const double &val) {data.setGradient(val);}
+
+  inline double GetDerivative(const su2double& data, const unsigned short &iDir) { return data.getGradient();}
+
+  inline void SetDerivative(su2double& data, const unsigned short &iDir, const double &val) {data.setGradient(val);}
+
+  inline unsigned short GetnDirections() { return 1;}
+#endif
 }
@@ -53,10 +53,14 @@
 
 #if CODI_INDEX_TAPE
   typedef codi::RealReverseIndex su2double;
+#  define CODI_TAPE_NAME "Jacobian tape with index reuse"
 #elif CODI_PRIMAL_TAPE
   typedef codi::RealReversePrimal su2double;
+#  define CODI_TAPE_NAME "primal value tape"
 #elif CODI_PRIMAL_INDEX_TAPE
   typedef codi::RealReversePrimalIndex su2double;
+#  define CODI_TAPE_NAME "primal value tape with index reuse"
 #else
   typedef codi::RealReverse su2double;
+#  define CODI_TAPE_NAME "Jacobian tape"
 #endif
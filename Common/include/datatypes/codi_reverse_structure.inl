@@ -48,6 +48,12 @@ namespace SU2_TYPE{
   inline double GetDerivative(const su2double& data) { return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);}
 
   inline void SetDerivative(su2double& data, const double &val) {data.setGradient(val);}
+
+  inline double GetDerivative(const su2double& data, const unsigned short &iDir) { return AD::globalTape.getGradient(AD::inputValues[AD::adjointVectorPosition++]);}
+
+  inline void SetDerivative(su2double& data, const unsigned short &iDir, const double &val) {data.setGradient(val);}
+
+  inline unsigned short GetnDirections() { return 1;}
 }
 
 /*--- Object for the definition of getValue used in the printfOver definition.
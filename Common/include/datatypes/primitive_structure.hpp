@@ -36,4 +36,23 @@
  */
 #pragma once
 
+#if defined SINGLE_PRECISION
+
+/*--- Single precision build (--enable-single-precision), the accumulators
+ and norms keep double precision through accumdouble. ---*/
+
+typedef float su2double;
+
+/*--- The std::min/max templates do not deduce mixed arguments such as
+ max(EPS*EPS, x) when x is a double expression. ---*/
+
+inline su2double min(su2double a, double b) { return (b < a)? su2double(b) : a; }
+inline su2double min(double a, su2double b) { return (b < a)? b : su2double(a); }
+inline su2double max(su2double a, double b) { return (a < b)? su2double(b) : a; }
+inline su2double max(double a, su2double b) { return (a < b)? b : su2double(a); }
+
+#else
+
 typedef double su2double;
+
+#endif
@@ -37,15 +37,25 @@
 #pragma once
 
 namespace SU2_TYPE{
-  inline void SetValue(double& data, const double &val) {data = val;}
+  inline void SetValue(su2double& data, const double &val) {data = val;}
 
-  inline double GetValue(const double& data) { return data;}
+  inline double GetValue(const su2double& data) { return data;}
+
+  inline void SetSecondary(su2double& data, const double &val) {}
+
+  inline double GetDerivative(const su2double& data) { return 0.0;}
 
-  inline void SetSecondary(double& data, const double &val) {}
+  inline double GetSecondary(const su2double& data) { return 0.0;}
 
-  inline double GetDerivative(const double& data) { return 0.0;}
+  inline void SetDerivative(su2double &data, const double &val) {}
 
-  inline double GetSecondary(const double& data) { return 0.0;}
+  inline double GetDerivative(const su2double& data, const unsigned short &iDir) { return 0.0;}
 
-  inline void SetDerivative(double &data, const double &val) {}
+  inline void SetDerivative(su2double &data, const unsigned short &iDir, const double &val) {}
+
+  inline unsigned short GetnDirections() { return 1;}
+
+#if defined SINGLE_PRECISION
+  inline double GetValue(const double& data) { return data;}
+#endif
 }
@@ -46,6 +46,7 @@
 #include <vector>
 
 #include "config_structure.hpp"
+#include "memory_pool.hpp"
 
 using namespace std;
 
@@ -71,6 +72,19 @@ public:
 	 * \brief Destructor of the class. 
 	 */
 	virtual ~CDualGrid(void);
+
+	/*!
+	 * \brief Allocate the object from the pool of the dual grid objects.
+	 * \param[in] size - Size of the (derived) object in bytes.
+	 */
+	static void *operator new(size_t size);
+	
+	/*!
+	 * \brief Return the memory of the object to the pool of the dual grid objects.
+	 * \param[in] ptr  - Pointer to the object.
+	 * \param[in] size - Size of the (derived) object in bytes.
+	 */
+	static void operator delete(void *ptr, size_t size);
 	
 	/*! 
 	 * \brief A pure virtual member.
@@ -160,6 +174,7 @@ private:
   *Coord_p1;                          /*!< \brief Coordinates at time n+1 for use with dynamic meshes. */
   su2double *GridVel;                 /*!< \brief Velocity of the grid for dynamic mesh cases. */
   su2double **GridVel_Grad;           /*!< \brief Gradient of the grid velocity for dynamic meshes. */
+  bool GridMotion_Shared;             /*!< \brief Volume, old coordinates and grid velocity are stored in arrays of the geometry. */
   unsigned long Parent_CV;            /*!< \brief Index of the parent control volume in the agglomeration process. */
   unsigned short nChildren_CV;        /*!< \brief Number of children in the agglomeration process. */
   vector<unsigned long> Children_CV;  /*!< \brief Index of the children control volumes in the agglomeration process. */
@@ -333,6 +348,13 @@ public:
 	 */
 	void SetElem(unsigned long val_elem);
   
+  /*!
+	 * \brief Set all the elements that set the control volume at once.
+	 * \param[in] val_elem - Elements of the control volume.
+	 * \param[in] val_nElem - Number of elements.
+	 */
+	void SetElem(const unsigned long *val_elem, unsigned long val_nElem);
+  
   /*!
 	 * \brief Reset the elements of a control volume.
 	 */
@@ -348,6 +370,13 @@ public:
 	 * \param[in] val_point - Point to be added.		 
 	 */
 	void SetPoint(unsigned long val_point);
+  
+  /*!
+	 * \brief Set all the points that compose the control volume at once.
+	 * \param[in] val_point - Points of the control volume, without duplicates.
+	 * \param[in] val_nPoint - Number of points.
+	 */
+	void SetPoint(const unsigned long *val_point, unsigned short val_nPoint);
 	
 	/*! 
 	 * \brief Set the edges that compose the control volume.
@@ -695,6 +724,18 @@ public:
 	 * \param[in] val_gridvel - Value of the grid velocity.
 	 */	
 	void SetGridVel(su2double *val_gridvel);
+
+  /*!
+   * \brief Use storage of the geometry, contiguous over all the points, for the volume at all time
+   *        levels, the coordinates at n and n-1 and the grid velocity. The values must have been
+   *        copied to the new storage, which the point does not free. NULL is passed for a quantity
+   *        that is not allocated for this point.
+   * \param[in] val_volume - Volume at n+1, n and n-1 (or only at n+1 for steady problems).
+   * \param[in] val_coord_n - Coordinates at n.
+   * \param[in] val_coord_n1 - Coordinates at n-1.
+   * \param[in] val_gridvel - Grid velocity.
+   */
+  void SetGridMotion_Storage(su2double *val_volume, su2double *val_coord_n, su2double *val_coord_n1, su2double *val_gridvel);
   
   /*!
 	 * \brief Set the gradient of the grid velocity.
@@ -776,6 +817,7 @@ private:
 	su2double *Coord_CG;			/*!< \brief Center-of-gravity of the element. */
 	unsigned long *Nodes;		/*!< \brief Vector to store the global nodes of an element. */
 	su2double *Normal;				/*!< \brief Normal al elemento y coordenadas de su centro de gravedad. */
+  bool External_Storage;    /*!< \brief The arrays belong to the geometry (contiguous edge storage). */
 
 public:
 		
@@ -786,6 +828,18 @@ public:
 	 * \param[in] val_nDim - Number of dimensions of the problem.		 
 	 */
 	CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim);
+  
+  /*!
+   * \overload
+   * \param[in] val_iPoint - First node of the edge.
+   * \param[in] val_jPoint - Second node of the edge.
+   * \param[in] val_nDim - Number of dimensions of the problem.
+   * \param[in] val_nodes - Storage of the two nodes.
+   * \param[in] val_normal - Storage of the normal (nDim).
+   * \param[in] val_coord_cg - Storage of the center of gravity (nDim).
+   */
+  CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim,
+        unsigned long *val_nodes, su2double *val_normal, su2double *val_coord_cg);
 	
 	/*! 
 	 * \brief Destructor of the class. 
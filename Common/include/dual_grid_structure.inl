@@ -39,12 +39,16 @@
 
 inline void CPoint::SetElem(unsigned long val_elem) { Elem.push_back(val_elem); nElem = Elem.size(); }
 
+inline void CPoint::SetElem(const unsigned long *val_elem, unsigned long val_nElem) { Elem.assign(val_elem, val_elem+val_nElem); nElem = Elem.size(); }
+
 inline void CPoint::ResetBoundary(void) { if (Vertex != NULL) delete [] Vertex; Boundary = false; }
 
 inline void CPoint::ResetElem(void) { Elem.clear(); nElem = 0; }
 
 inline void CPoint::ResetPoint(void) { Point.clear(); Edge.clear(); nPoint = 0; }
 
+inline void CPoint::SetPoint(const unsigned long *val_point, unsigned short val_nPoint) { Point.assign(val_point, val_point+val_nPoint); Edge.assign(val_nPoint, -1); nPoint = Point.size(); }
+
 inline su2double CPoint::GetCoord(unsigned short val_dim) { return Coord[val_dim]; }
 
 inline su2double *CPoint::GetCoord(void) { return Coord; }
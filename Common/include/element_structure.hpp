@@ -83,6 +83,7 @@ protected:
 	unsigned short iDe;					/*!< \brief ID of the dielectric elastomer */
 	unsigned long iDV;          /*!< \brief ID of the Design Variable (if it is element based) */
 	unsigned long iProp;        /*!< \brief ID of the Element Property */
+	su2double *RefGradients;    /*!< \brief Precomputed J_X and GradNi_Xj for the next gradient computation (NULL if not available). */
 
 public:
 	/*!
@@ -469,6 +470,34 @@ public:
 	 */
 	void SetPreaccOut_Kt_a(void);
 
+  /*!
+   * \brief Set the precomputed gradients of the reference configuration, which are used by the next
+   *        call of ComputeGrad_Linear or ComputeGrad_NonLinear instead of recomputing them.
+   * \param[in] val_RefGradients - Gradients stored with Store_RefGradients for the same reference coordinates.
+   */
+  void Set_RefGradients(su2double *val_RefGradients);
+
+  /*!
+   * \brief Get the number of values needed to store the gradients of the reference configuration.
+   * \return Number of Gauss points times the Jacobian and the gradients of the shape functions.
+   */
+  unsigned long GetnRefGradients(void);
+
+  /*!
+   * \brief Store the gradients of the reference configuration of the last gradient computation.
+   * \param[out] val_RefGradients - Storage of size GetnRefGradients.
+   */
+  void Store_RefGradients(su2double *val_RefGradients);
+
+protected:
+
+  /*!
+   * \brief Copy the precomputed gradients of the reference configuration to the Gauss points.
+   *        They are only used once, such that a stale set is never applied to another element.
+   * \return <code>TRUE</code> if precomputed gradients were available.
+   */
+  bool Load_RefGradients(void);
+
 };
 
 /*!
@@ -45,6 +45,10 @@ inline unsigned short CElement::GetnNodes(void) { return nNodes;}
 
 inline unsigned short CElement::GetnGaussPoints(void) { return nGaussPoints;}
 
+inline void CElement::Set_RefGradients(su2double *val_RefGradients) { RefGradients = val_RefGradients; }
+
+inline unsigned long CElement::GetnRefGradients(void) { return nGaussPoints*(1+nNodes*nDim); }
+
 inline void CElement::SetRef_Coord(su2double val_CoordRef, unsigned short iNode, unsigned short iDim) { RefCoord[iNode][iDim] = val_CoordRef;}
 
 inline void CElement::SetCurr_Coord(su2double val_CoordCurr, unsigned short iNode, unsigned short iDim) { CurrentCoord[iNode][iDim] = val_CoordCurr;}
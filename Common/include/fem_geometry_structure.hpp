@@ -239,6 +239,9 @@ public:
   bool elemIsOwned;             /*!< \brief Whether or not this is an owned element. */
   bool JacIsConsideredConstant; /*!< \brief Whether or not the Jacobian of the transformation
                                      to the standard element is considered constant. */
+  bool metricTermsConstant;     /*!< \brief Whether or not the metric terms are constant, in which
+                                     case they are stored only for the first point in metricTerms,
+                                     metricTermsSolDOFs and metricTerms2ndDer. */
 
   int rankOriginal;            /*!< \brief The rank where the original volume is stored. For
                                     the owned volumes, this is simply the current rank. */
@@ -502,6 +505,10 @@ public:
                                                                 for the wall function treatment. */
   vector<vector<su2double> > matWallFunctionDonor;  /*!< \brief Matrices, which store the interpolation coefficients
                                                                 for the donors of the integration points.*/
+  mutable vector<su2double> wallModelProfile;      /*!< \brief Profiles of the wall model in the integration points,
+                                                                which are used as initial guess in the next call
+                                                                of the wall model. Mutable, because it is solver
+                                                                data that is updated during the residual computation. */
 
   /*!
    * \brief Constructor of the class. Initialize some variables.
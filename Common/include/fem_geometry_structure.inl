@@ -68,7 +68,7 @@ inline CSortBoundaryFaces::CSortBoundaryFaces() { }
 
 inline CSortBoundaryFaces::~CSortBoundaryFaces() { }
 
-inline CVolumeElementFEM::CVolumeElementFEM(void) { }
+inline CVolumeElementFEM::CVolumeElementFEM(void) { metricTermsConstant = false; }
 
 inline CVolumeElementFEM::~CVolumeElementFEM(void) { }
 
@@ -40,6 +40,8 @@
 
 using namespace std;
 
+class CBlasStructure;
+
 /*!
  * \class CFEMStandardElementBase
  * \brief Base class for a FEM standard element.
@@ -828,6 +830,17 @@ private:
                                                       in the integration points. As such second derivatives can be computed
                                                       using one call to the BLAS routines. */
 
+  unsigned short nFactorsSumFact;     /*!< \brief Number of factors of the tensor product of the element, i.e. 2 for a
+                                                  quadrilateral and a prism and 3 for a hexahedron. Zero when
+                                                  sum-factorization is not used. */
+  unsigned short nDOFsFactor[3];      /*!< \brief Number of DOFs in every factor of the tensor product. */
+  unsigned short nIntFactor[3];       /*!< \brief Number of integration points in every factor of the tensor product. */
+  unsigned long  sizeWorkSumFact;     /*!< \brief Size of an intermediate result of the sum-factorization, per column. */
+
+  vector<su2double> matFactorInt[4][3];  /*!< \brief 1D (or triangular for a prism) basis functions and derivatives in the
+                                                     integration points of every factor. The first index corresponds to the
+                                                     blocks of matBasisIntegration, the second index to the factor. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs is
                                                 such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs is
@@ -988,6 +1001,78 @@ public:
   */
   const su2double *GetMat2ndDerBasisFunctionsInt(void) const;
 
+  /*!
+  * \brief Function, which indicates whether or not sum-factorization is used for this standard element.
+  * \return  True if the products with the basis functions are carried out with sum-factorization.
+  */
+  bool SumFactorizationActive(void) const;
+
+  /*!
+  * \brief Function, which makes available the size of the work array needed by the
+           sum-factorization per column of the data.
+  * \return  The size of the work array per column, zero when sum-factorization is not used.
+  */
+  unsigned long GetSizeWorkSumFactorization(void) const;
+
+  /*!
+  * \brief Function, which computes the product of blocks kBeg to kEnd (not included) of
+           matBasisIntegration with the data in the DOFs, i.e. the data and/or its
+           parametric derivatives in the integration points. Either sum-factorization
+           or a matrix multiplication is used.
+  * \param[in]  kBeg          - First block, 0 for the basis functions, 1 to nDim for the derivatives.
+  * \param[in]  kEnd          - Last block (not included).
+  * \param[in]  N             - Number of columns of the data.
+  * \param[in]  dataDOFs      - Data in the DOFs, nDOFs x N.
+  * \param[out] dataInt       - Data in the integration points, (kEnd-kBeg)*nIntegration x N.
+  * \param[in]  work          - Work array of GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix multiplication.
+  * \param[in]  config        - Object, which contains the input parameters.
+  */
+  void ProductBasisIntegration(const unsigned short kBeg,
+                               const unsigned short kEnd,
+                               const int            N,
+                               const su2double      *dataDOFs,
+                               su2double            *dataInt,
+                               su2double            *work,
+                               CBlasStructure       *blasFunctions,
+                               CConfig              *config) const;
+
+  /*!
+  * \brief Function, which computes the product of lagBasisIntegrationTrans with the
+           data in the integration points. Either sum-factorization or a matrix
+           multiplication is used.
+  * \param[in]  N             - Number of columns of the data.
+  * \param[in]  dataInt       - Data in the integration points, nIntegration x N.
+  * \param[out] dataDOFs      - Result in the DOFs, nDOFs x N.
+  * \param[in]  work          - Work array of GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix multiplication.
+  * \param[in]  config        - Object, which contains the input parameters.
+  */
+  void ProductBasisIntegrationTrans(const int       N,
+                                    const su2double *dataInt,
+                                    su2double       *dataDOFs,
+                                    su2double       *work,
+                                    CBlasStructure  *blasFunctions,
+                                    CConfig         *config) const;
+
+  /*!
+  * \brief Function, which computes the product of matDerBasisIntTrans with the
+           parametric fluxes in the integration points. Either sum-factorization or
+           a matrix multiplication is used.
+  * \param[in]  N             - Number of columns of the data.
+  * \param[in]  fluxesInt     - Parametric fluxes in the integration points, nIntegration*nDim x N.
+  * \param[out] dataDOFs      - Result in the DOFs, nDOFs x N.
+  * \param[in]  work          - Work array of GetSizeWorkSumFactorization()*N.
+  * \param[in]  blasFunctions - Object to carry out the matrix multiplication.
+  * \param[in]  config        - Object, which contains the input parameters.
+  */
+  void ProductDerBasisIntegrationTrans(const int       N,
+                                       const su2double *fluxesInt,
+                                       su2double       *dataDOFs,
+                                       su2double       *work,
+                                       CBlasStructure  *blasFunctions,
+                                       CConfig         *config) const;
+
   /*!
   * \brief Function, which makes available the connectivity of face 0.
   * \return  The pointer to data, which stores the connectivity of face 0.
@@ -1205,6 +1290,36 @@ private:
   */
   void DataStandardHexahedron(void);
 
+  /*!
+  * \brief Function, which creates the factors of the tensor product of a quadrilateral,
+           hexahedron or prism, such that the products with the basis functions can be
+           carried out with sum-factorization. If the factors do not reproduce
+           matBasisIntegration, sum-factorization is not used.
+  */
+  void SetUpSumFactorization(void);
+
+  /*!
+  * \brief Function, which carries out the sum-factorization, i.e. the product with the
+           tensor product of the matrices of the factors, one factor at a time.
+  * \param[in]  mats      - Matrices of the factors, nIntFactor x nDOFsFactor each.
+  * \param[in]  transpose - Whether the product with the transpose must be computed, i.e.
+                             from the integration points to the DOFs.
+  * \param[in]  N         - Number of columns of the data.
+  * \param[in]  dataIn    - Input data.
+  * \param[in]  strideIn  - Distance between the rows of dataIn.
+  * \param[out] dataOut   - Output data, with N as distance between the rows.
+  * \param[in]  addToOut  - Whether the result must be added to dataOut.
+  * \param[in]  work      - Work array of GetSizeWorkSumFactorization()*N.
+  */
+  void SumFactorizationKernel(const su2double *const *mats,
+                              const bool             transpose,
+                              const int              N,
+                              const su2double        *dataIn,
+                              const int              strideIn,
+                              su2double              *dataOut,
+                              const bool             addToOut,
+                              su2double              *work) const;
+
   /*!
   * \brief Function, which determines the connectivity of the linear subtetrahedra for a high
            order tetrahedron.
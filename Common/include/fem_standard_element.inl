@@ -43,7 +43,7 @@ inline unsigned short CFEMStandardElementBase::GetNIntegration(void) const {retu
 
 inline unsigned short CFEMStandardElementBase::GetOrderExact(void){return orderExact;}
 
-inline CFEMStandardElement::CFEMStandardElement(){}
+inline CFEMStandardElement::CFEMStandardElement(){nFactorsSumFact = 0; sizeWorkSumFact = 0;}
 
 inline CFEMStandardElement::~CFEMStandardElement(){}
 
@@ -75,6 +75,10 @@ inline const su2double* CFEMStandardElement::GetMatDerBasisFunctionsSolDOFs(void
 
 inline const su2double* CFEMStandardElement::GetMat2ndDerBasisFunctionsInt(void) const {return mat2ndDerBasisInt.data();}
 
+inline bool CFEMStandardElement::SumFactorizationActive(void) const {return nFactorsSumFact > 0;}
+
+inline unsigned long CFEMStandardElement::GetSizeWorkSumFactorization(void) const {return 2*sizeWorkSumFact;}
+
 inline unsigned short* CFEMStandardElement::GetConnFace0(void){return connFace0.data();}
 
 inline unsigned short* CFEMStandardElement::GetConnFace1(void){return connFace1.data();}
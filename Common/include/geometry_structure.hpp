@@ -50,6 +50,9 @@ extern "C" {
 #endif
 #ifdef HAVE_CGNS
   #include "fem_cgns_elements.hpp"
+#if defined(HAVE_CGNS_PARALLEL) && defined(HAVE_MPI)
+  #include "pcgnslib.h"
+#endif
 #endif
 #include <string>
 #include <fstream>
@@ -68,6 +71,8 @@ extern "C" {
 
 using namespace std;
 
+class CADTElemClass;
+
 /*!
  * \class CUnsignedLong2T
  * \brief Help class used to store two unsigned longs as one entity.
@@ -188,6 +193,16 @@ private:
   void Copy(const CFaceOfElement &other);
 };
 
+/*!
+ * \class CFaceOfElementHash
+ * \brief Functor to hash a CFaceOfElement on its corner points, consistent with its == operator.
+          Used to find the matching faces without sorting all the faces.
+ */
+class CFaceOfElementHash {
+public:
+  size_t operator()(const CFaceOfElement &face) const;
+};
+
 /*!
  * \class CBoundaryFace
  * \brief Help class used in the partitioning of the FEM grid.
@@ -299,6 +314,25 @@ protected:
 	nMarker;				/*!< \brief Number of different markers of the mesh. */
   unsigned long Max_GlobalPoint;  /*!< \brief Greater global point in the domain local structure. */
 
+  /*--- Edge coloring, i.e. groups of edges that do not share any point ---*/
+  unsigned short nEdgeColor;            /*!< \brief Number of edge colors (0 if the edges are not colored). */
+  vector<unsigned long> EdgeColor_Ptr;  /*!< \brief Start of each color in EdgeColor_Edge, cumulative storage format. */
+  vector<unsigned long> EdgeColor_Edge; /*!< \brief Edge indices, sorted by color. */
+
+  /*--- Element coloring, i.e. groups of elements that do not share any point ---*/
+  unsigned short nElemColor;            /*!< \brief Number of element colors (0 if the elements are not colored). */
+  vector<unsigned long> ElemColor_Ptr;  /*!< \brief Start of each color in ElemColor_Elem, cumulative storage format. */
+  vector<unsigned long> ElemColor_Elem; /*!< \brief Element indices, sorted by color. */
+
+  mutable vector<passivedouble> FilterNbr_Radius;       /*!< \brief Radii for which the filter neighbourhoods were built. */
+  mutable vector<vector<unsigned long> > FilterNbr_Start; /*!< \brief Start of the neighbourhood of each element, CSR format. */
+  mutable vector<vector<unsigned long> > FilterNbr_Idx;   /*!< \brief Global indices of the filter neighbours, CSR format. */
+
+  /*--- Contiguous storage of the edge data, the CEdge objects point into these arrays ---*/
+  vector<unsigned long> Edge_Node;      /*!< \brief The two nodes of each edge. */
+  vector<su2double> Edge_Normal;        /*!< \brief Normal of the dual face of each edge (nDim per edge). */
+  vector<su2double> Edge_CG;            /*!< \brief Center of gravity of each edge (nDim per edge). */
+
   /* --- Custom boundary variables --- */
   su2double **CustomBoundaryTemperature;
   su2double **CustomBoundaryHeatFlux;
@@ -337,6 +371,89 @@ public:
   su2double **TurboRadiusIn, **TurboRadiusOut; /*! <\brief Radius at each span wise section for each turbomachinery marker*/
 
   unsigned short nCommLevel;		/*!< \brief Number of non-blocking communication levels. */
+
+  /*--- Persistent point-to-point communication pattern of the SEND_RECEIVE markers ---*/
+  bool P2P_Ready;                         /*!< \brief Flag whether the point-to-point pattern has been set up. */
+  int nP2PSend,                           /*!< \brief Number of messages (send markers) of the pattern. */
+  nP2PRecv;                               /*!< \brief Number of messages (receive markers) of the pattern. */
+  unsigned short countPerPoint,           /*!< \brief Number of values per point of the current exchange. */
+  maxCountPerPoint;                       /*!< \brief Number of values per point the buffers are sized for. */
+  vector<unsigned short> Marker_P2PSend,  /*!< \brief Send marker of each message. */
+  Marker_P2PRecv;                         /*!< \brief Receive marker of each message. */
+  vector<int> Neighbor_P2PSend,           /*!< \brief Destination rank of each sent message. */
+  Neighbor_P2PRecv;                       /*!< \brief Source rank of each received message. */
+  vector<unsigned long> nVertex_P2PSend,  /*!< \brief Vertices per sent message, cumulative storage format. */
+  nVertex_P2PRecv,                        /*!< \brief Vertices per received message, cumulative storage format. */
+  FirstPoint_P2PRecv;                     /*!< \brief First halo point of each received message if its points are consecutive, otherwise nPoint. */
+  su2double *bufD_P2PSend,                /*!< \brief Packed send buffer of all messages. */
+  *bufD_P2PRecv;                          /*!< \brief Packed receive buffer of all messages. */
+  SU2_MPI::Request *req_P2PSend,          /*!< \brief Requests of the non-blocking sends. */
+  *req_P2PRecv;                           /*!< \brief Requests of the non-blocking receives. */
+  vector<su2double> Rotation_P2P;         /*!< \brief Rotation matrix (3x3, row-major) of each periodic transformation. */
+  vector<unsigned long> nRotated_P2PRecv, /*!< \brief Rotated vertices per received message, cumulative storage format. */
+  Vertex_P2PRecvRot;                      /*!< \brief Position in its message of each rotated vertex. */
+  vector<unsigned short> Index_P2PRecvRot; /*!< \brief Periodic transformation of each rotated vertex. */
+
+  /*--- Messages of the point-to-point pattern between ranks of the same node, through shared memory ---*/
+  bool P2P_Shared;                        /*!< \brief Whether the messages within a node use the shared window (SHARED_MEMORY_COMMS). */
+  unsigned long nExchange_P2P;            /*!< \brief Number of exchanges with the pattern, value of the flags of the last one. */
+  int nP2PRecvDone;                       /*!< \brief Number of messages of the current exchange already returned by WaitP2PRecv(). */
+  vector<bool> Shared_P2PSend,            /*!< \brief Whether each sent message stays on the node. */
+  Shared_P2PRecv,                         /*!< \brief Whether each received message comes from the node. */
+  Done_P2PRecv;                           /*!< \brief Whether each received message of the current exchange is unpacked. */
+  vector<int> SharedRank_P2PRecv,         /*!< \brief Rank in the node communicator of the source of each received message. */
+  SharedMessage_P2PRecv;                  /*!< \brief Index of each received message among the sent messages of its source. */
+  vector<unsigned long> SharedVertex_P2PRecv, /*!< \brief Position of each received message in the send buffer of its source (vertices). */
+  SharedTotal_P2PRecv;                    /*!< \brief Size of the send buffer of the source of each received message (vertices). */
+  su2double *bufD_P2PShared;              /*!< \brief Both halves of the send buffer in the shared window, bufD_P2PSend points to one of them. */
+  volatile long *Flag_P2PSend;            /*!< \brief Flags of the sent messages in the shared window, set to the exchange number when packed. */
+  vector<volatile long*> Flag_P2PRecv;    /*!< \brief Flag of the matching sent message of each on-node received message. */
+  vector<su2double*> Buffer_P2PRecv;      /*!< \brief Start of the send buffer (both halves) of the source of each on-node received message. */
+#ifdef HAVE_MPI_SHARED_MEMORY
+  MPI_Comm comm_P2PNode;                  /*!< \brief Communicator of the ranks of this node. */
+  MPI_Win win_P2PShared;                  /*!< \brief Shared window with the flags and the double buffered send buffer of each rank. */
+#endif
+
+  /*--- Point-to-point pattern of the actuator disk data, set up once by MatchActuator_Disk ---*/
+  vector<int> Neighbor_ActDiskSend,         /*!< \brief Destination rank of each sent actuator disk message. */
+  Neighbor_ActDiskRecv;                     /*!< \brief Source rank of each received actuator disk message. */
+  vector<unsigned long> nVertex_ActDiskSend, /*!< \brief Vertices per sent message, cumulative storage format. */
+  nVertex_ActDiskRecv;                      /*!< \brief Vertices per received message, cumulative storage format. */
+  vector<unsigned long> Point_ActDiskSend;  /*!< \brief Local point of each sent vertex. */
+  vector<unsigned short> Marker_ActDiskRecv; /*!< \brief Marker of the donor vertex of each received vertex. */
+  vector<unsigned long> Vertex_ActDiskRecv, /*!< \brief Donor vertex of each received vertex. */
+  GlobalIndex_ActDiskRecv;                  /*!< \brief Global index of the point of each received vertex. */
+
+  /*--- Weights of the least-squares gradients, refreshed when the grid moves ---*/
+  bool LS_Weights_Ready;                  /*!< \brief Flag whether the least-squares weights match the coordinates. */
+  vector<su2double> LS_Weight;            /*!< \brief Weights of both nodes of each edge (2*nDim per edge). */
+  bool Edge_Geometry_Ready;               /*!< \brief Flag whether the geometric factors of the edges match the coordinates. */
+  vector<su2double> Edge_Geometry;        /*!< \brief x_j-x_i, |x_j-x_i|^2 and area of the face of each edge (nDim+2 per edge). */
+  
+  /*--- Restriction and prolongation of the agglomeration multigrid, stored on the coarse grid ---*/
+  bool MG_Transfer_Ready;                 /*!< \brief Flag whether the transfer weights match the control volumes. */
+  vector<unsigned long> MG_Children_Begin; /*!< \brief Position of the first child of each point in MG_Children (nPoint+1). */
+  vector<unsigned long> MG_Children;      /*!< \brief Fine grid point of each child control volume. */
+  vector<su2double> MG_Children_Weight;   /*!< \brief Volume of each child divided by the volume of its parent. */
+  
+  /*--- Vertex data of the boundary conditions, contiguous marker by marker ---*/
+  bool Vertex_Arrays_Ready;               /*!< \brief Flag whether the vertex arrays match the dual grid. */
+  vector<unsigned long> Vertex_Begin;     /*!< \brief Position of the first vertex of each marker (nMarker+1). */
+  vector<unsigned long> Vertex_Node;      /*!< \brief Node of each vertex. */
+  vector<unsigned long> Vertex_Neighbor;  /*!< \brief Closest interior node of each vertex. */
+  vector<su2double> Vertex_Normal;        /*!< \brief Normal of each vertex (nDim per vertex). */
+
+  /*--- Region of the dual grid recomputed by the last update after a deformation ---*/
+  vector<su2double> DualGrid_Coord;       /*!< \brief Coordinates of the points at the last update of the dual grid. */
+  vector<bool> DualGrid_Affected;         /*!< \brief Points whose control volume was recomputed (empty if all of them). */
+
+  /*--- Time history and grid velocity of the points, contiguous over the points ---*/
+  bool GridMotion_Arrays_Ready;           /*!< \brief Flag whether the points use the arrays below. */
+  unsigned short nVolume_Level;           /*!< \brief Time levels of the volume of each point (3 if unsteady, else 1). */
+  vector<su2double> Point_Volume,         /*!< \brief Volume at n+1, n and n-1 of each point (nVolume_Level per point). */
+  Point_Coord_n,                          /*!< \brief Coordinates at n of each point (nDim per point). */
+  Point_Coord_n1,                         /*!< \brief Coordinates at n-1 of each point (nDim per point). */
+  Point_GridVel;                          /*!< \brief Grid velocity of each point (nDim per point). */
 	vector<unsigned long> PeriodicPoint[MAX_NUMBER_PERIODIC][2];			/*!< \brief PeriodicPoint[Periodic bc] and return the point that
 																			 must be sent [0], and the image point in the periodic bc[1]. */
 	vector<unsigned long> PeriodicElem[MAX_NUMBER_PERIODIC];				/*!< \brief PeriodicElem[Periodic bc] and return the elements that 
@@ -621,6 +738,270 @@ public:
 	 */
 	void SetEdges(void);
 
+  /*!
+   * \brief Group the edges in colors such that the edges of one color do not share any point.
+   *        The edges of a single color can therefore be processed concurrently without
+   *        conflicting updates of the residual and the Jacobian.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetEdgeColoring(CConfig *config);
+
+  /*!
+   * \brief Group the elements in colors such that the elements of one color do not share any point.
+   *        The elements of a single color can therefore be assembled concurrently without
+   *        conflicting updates of the residual and the Jacobian of the finite element solvers.
+   */
+  void SetElemColoring(void);
+
+  /*!
+   * \brief Set up the persistent point-to-point communication pattern from the SEND_RECEIVE markers.
+   *        Every pair of send/receive markers becomes one message, the buffers of all messages are
+   *        packed in one pre-allocated send and one receive buffer.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessP2PComms(CConfig *config);
+
+  /*!
+   * \brief Make sure the point-to-point buffers can hold a given number of values per point.
+   *        The buffers are only reallocated if they are too small.
+   * \param[in] val_countPerPoint - Number of values per point of the next exchange.
+   */
+  void AllocateP2PComms(unsigned short val_countPerPoint);
+
+  /*!
+   * \brief Post the non-blocking receives of all messages of the point-to-point pattern.
+   * \param[in] val_tag - Tag of the messages, identifies the quantity that is exchanged.
+   */
+  void PostP2PRecvs(int val_tag);
+
+  /*!
+   * \brief Post the non-blocking sends of all messages of the point-to-point pattern. The send
+   *        buffer must have been packed before. Without MPI the data is copied to the receive buffer.
+   * \param[in] val_tag - Tag of the messages, identifies the quantity that is exchanged.
+   */
+  void PostP2PSends(int val_tag);
+
+  /*!
+   * \brief Set up the exchange of the messages between ranks of the same node through a MPI-3 shared
+   *        window. Every rank learns where the data of its on-node received messages is stored in the
+   *        send buffers of the sources, the window itself is allocated with the buffers.
+   */
+  void PreprocessP2PShared(void);
+
+  /*!
+   * \brief (Re)allocate the shared window of the flags and of the two halves of the send buffer, the
+   *        halves are used in alternate exchanges such that a source never overwrites data that a slower
+   *        receiver has not copied yet. Collective over the ranks of the node.
+   */
+  void AllocateP2PShared(void);
+
+  /*!
+   * \brief Rotate the vector quantities of the received periodic vertices of one message, in place in
+   *        the packed receive buffer. Only the vertices with a non-trivial periodic transformation
+   *        are visited, with the rotation matrices computed once by PreprocessP2PComms().
+   * \param[in] val_message - Index of the received message.
+   * \param[in] val_nVector - Number of vectors (nDim consecutive values) per point.
+   * \param[in] val_offset - Position of each vector in the values of a point.
+   */
+  void RotateP2PRecv(int val_message, unsigned short val_nVector, const unsigned short *val_offset);
+
+  /*!
+   * \brief Wait for any received message of the current exchange that is not unpacked yet. The messages
+   *        from ranks of the same node are copied from the shared window to the receive buffer, the others
+   *        are received in the receive buffer by MPI.
+   * \return Index of the message, its data is in the receive buffer.
+   */
+  int WaitP2PRecv(void);
+
+  /*!
+   * \brief Wait for the completion of the sends of the current exchange, before the send buffer is reused.
+   */
+  void CompleteP2PSends(void);
+
+  /*!
+   * \brief Exchange the actuator disk data with the pattern set up by MatchActuator_Disk(). Only the
+   *        ranks that hold matched donor/target pairs communicate, the data of this rank is copied.
+   * \param[in] val_count - Number of values per vertex.
+   * \param[in] val_bufSend - Values of the sent vertices, in the order of GetPoint_ActDiskSend().
+   * \param[out] val_bufRecv - Values of the received vertices, in the order of GetVertex_ActDiskRecv().
+   */
+  void ExchangeActDisk(unsigned short val_count, su2double *val_bufSend, su2double *val_bufRecv);
+
+  /*!
+   * \brief Get the number of vertices whose data is sent by ExchangeActDisk().
+   * \return Number of sent vertices.
+   */
+  unsigned long GetnVertex_ActDiskSend(void);
+
+  /*!
+   * \brief Get the local point of a vertex sent by ExchangeActDisk().
+   * \param[in] val_index - Position of the vertex in the send buffer.
+   * \return Local point.
+   */
+  unsigned long GetPoint_ActDiskSend(unsigned long val_index);
+
+  /*!
+   * \brief Get the number of vertices whose data is received by ExchangeActDisk().
+   * \return Number of received vertices.
+   */
+  unsigned long GetnVertex_ActDiskRecv(void);
+
+  /*!
+   * \brief Get the marker of the donor vertex where a received value belongs.
+   * \param[in] val_index - Position of the vertex in the receive buffer.
+   * \return Marker of the donor vertex.
+   */
+  unsigned short GetMarker_ActDiskRecv(unsigned long val_index);
+
+  /*!
+   * \brief Get the donor vertex where a received value belongs.
+   * \param[in] val_index - Position of the vertex in the receive buffer.
+   * \return Donor vertex.
+   */
+  unsigned long GetVertex_ActDiskRecv(unsigned long val_index);
+
+  /*!
+   * \brief Get the global index of the point whose data is received.
+   * \param[in] val_index - Position of the vertex in the receive buffer.
+   * \return Global index of the sending point.
+   */
+  unsigned long GetGlobalIndex_ActDiskRecv(unsigned long val_index);
+
+  /*!
+   * \brief Get the number of edge colors.
+   * \return Number of colors, 1 if the edges were not colored (natural ordering).
+   */
+  unsigned short GetnEdgeColor(void);
+
+  /*!
+   * \brief Get the position in the colored edge list where a color starts.
+   * \param[in] val_color - Color of the edges.
+   * \return Index of the first edge of the color in the colored edge list.
+   */
+  unsigned long GetEdgeColor_Begin(unsigned short val_color);
+
+  /*!
+   * \brief Get the position in the colored edge list where a color ends (one past the last edge).
+   * \param[in] val_color - Color of the edges.
+   * \return Index past the last edge of the color in the colored edge list.
+   */
+  unsigned long GetEdgeColor_End(unsigned short val_color);
+
+  /*!
+   * \brief Get the edge stored at a position of the colored edge list.
+   * \param[in] val_pos - Position in the colored edge list.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdgeColor_Edge(unsigned long val_pos);
+
+  /*!
+   * \brief Get the number of element colors.
+   * \return Number of colors, 1 if the elements were not colored (natural ordering).
+   */
+  unsigned short GetnElemColor(void);
+
+  /*!
+   * \brief Get the position in the colored element list where a color starts.
+   * \param[in] val_color - Color of the elements.
+   * \return Index of the first element of the color in the colored element list.
+   */
+  unsigned long GetElemColor_Begin(unsigned short val_color);
+
+  /*!
+   * \brief Get the position in the colored element list where a color ends (one past the last element).
+   * \param[in] val_color - Color of the elements.
+   * \return Index past the last element of the color in the colored element list.
+   */
+  unsigned long GetElemColor_End(unsigned short val_color);
+
+  /*!
+   * \brief Get the element stored at a position of the colored element list.
+   * \param[in] val_pos - Position in the colored element list.
+   * \return Index of the element.
+   */
+  unsigned long GetElemColor_Elem(unsigned long val_pos);
+
+  /*!
+   * \brief Get a node of an edge from the contiguous edge storage.
+   * \param[in] val_edge - Edge.
+   * \param[in] val_node - Position of the node in the edge (0 or 1).
+   * \return Index of the node.
+   */
+  unsigned long GetEdge_Node(unsigned long val_edge, unsigned short val_node);
+
+  /*!
+   * \brief Get the normal of an edge from the contiguous edge storage.
+   * \param[in] val_edge - Edge.
+   * \return Dimensional normal vector, the modulus is the area of the face.
+   */
+  su2double *GetEdge_Normal(unsigned long val_edge);
+
+  /*!
+   * \brief Compute the weights of the least-squares gradients of all the edges,
+   *        grad(U)_i = sum_edges w_i*(U_j-U_i), with w_i = S_i*(x_j-x_i)/|x_j-x_i|^2.
+   */
+  void PreprocessLS_Weights(void);
+
+  /*!
+   * \brief Get the least-squares weights of an edge for one of its nodes.
+   * \param[in] val_edge - Edge.
+   * \param[in] val_node - Position of the node in the edge (0 or 1).
+   * \return Weights (nDim) of the difference U_j-U_i for the gradient of the node.
+   */
+  su2double *GetLS_Weight(unsigned long val_edge, unsigned short val_node);
+
+  /*!
+   * \brief Compute the geometric factors of all the edges used by the viscous fluxes,
+   *        the vector x_j-x_i, its squared length, and the area of the dual face.
+   */
+  void PreprocessEdge_Geometry(void);
+
+  /*!
+   * \brief Get the geometric factors of an edge.
+   * \param[in] val_edge - Edge.
+   * \return x_j-x_i (nDim), |x_j-x_i|^2, and the area of the face.
+   */
+  su2double *GetEdge_Geometry(unsigned long val_edge);
+
+  /*!
+   * \brief Store the children of the control volumes of this (coarse) grid in compressed rows, with
+   *        the volume fraction of each child, for the transfers between the multigrid levels.
+   * \param[in] fine_grid - Geometry of the finer level.
+   */
+  void PreprocessMG_Transfer(CGeometry *fine_grid);
+
+  /*!
+   * \brief Copy the node, the closest interior node, and the normal of all the vertices
+   *        in arrays that are contiguous for each marker.
+   * \param[in] copy_normals - Copy the normals as well, otherwise (discrete adjoint, the normals
+   *            must stay on the tape) GetVertex_Normal returns the normal of the vertex object.
+   */
+  void PreprocessVertex_Arrays(bool copy_normals);
+
+  /*!
+   * \brief Get the node of a vertex from the contiguous vertex arrays.
+   * \param[in] val_marker - Marker of the vertex.
+   * \param[in] val_vertex - Vertex of the marker.
+   * \return Index of the node.
+   */
+  unsigned long GetVertex_Node(unsigned short val_marker, unsigned long val_vertex);
+
+  /*!
+   * \brief Get the closest interior node of a vertex from the contiguous vertex arrays.
+   * \param[in] val_marker - Marker of the vertex.
+   * \param[in] val_vertex - Vertex of the marker.
+   * \return Index of the closest interior node.
+   */
+  unsigned long GetVertex_Neighbor(unsigned short val_marker, unsigned long val_vertex);
+
+  /*!
+   * \brief Get the normal of a vertex from the contiguous vertex arrays.
+   * \param[in] val_marker - Marker of the vertex.
+   * \param[in] val_vertex - Vertex of the marker.
+   * \return Normal vector (nDim), its norm is the area of the face.
+   */
+  su2double *GetVertex_Normal(unsigned short val_marker, unsigned long val_vertex);
+
 	/*! 
 	 * \brief A virtual member.
 	 */
@@ -677,6 +1058,11 @@ public:
    */
   virtual void SetCoord_CG(void);
 
+  /*!
+   * \brief A virtual member.
+   */
+  virtual void SetBoundCoord_CG(void);
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -721,6 +1107,51 @@ public:
 	 * \param[in] action - Allocate or not the new elements.		 
 	 */
 	virtual void SetBoundControlVolume(CConfig *config, unsigned short action);
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void SetControlVolume_Moved(CConfig *config);
+
+  /*!
+   * \brief Check whether the control volume of a point was recomputed by the last update of the dual grid.
+   * \param[in] val_point - Index of the point.
+   * \return <code>TRUE</code> if the control volume was recomputed; otherwise <code>FALSE</code>.
+   */
+  bool GetDualGrid_Affected(unsigned long val_point);
+
+  /*!
+   * \brief Update the dual grid after a rigid motion x' = R*x + t of the whole grid. The volumes and
+   *        areas are invariant, hence the normals of the edges and boundary vertices are only rotated.
+   * \param[in] rotMatrix - Rotation matrix R (3x3, row-major).
+   * \param[in] transl - Translation t.
+   * \param[in] val_move_coord - Apply the motion to the coordinates as well (coarse grids), otherwise
+   *            the coordinates were already moved and the centers of gravity are refreshed from them.
+   */
+  void SetRigid_DualGrid(const su2double *rotMatrix, const su2double *transl, bool val_move_coord);
+
+  /*!
+   * \brief Move the volumes, the coordinates at n and n-1 and the grid velocities of the points to
+   *        arrays of the geometry that are contiguous over the points. Done once, the points keep
+   *        their accessors.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void PreprocessGridMotion_Arrays(CConfig *config);
+
+  /*!
+   * \brief Shift the time levels of the volumes, and of the coordinates for dynamic meshes, of all
+   *        the points at the end of a physical time step (n-1 <- n <- n+1) in one sweep.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDualTime_History(CConfig *config);
+
+  /*!
+   * \brief Compute the grid velocity of all the points with the 1st or 2nd order backward
+   *        difference of the coordinates at n+1, n and n-1.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeGridVelocity(CConfig *config);
   
   /*!
 	 * \brief A virtual member.
@@ -851,6 +1282,13 @@ public:
 	 */	
 	virtual void SetBoundControlVolume(CConfig *config, CGeometry *geometry, unsigned short action);
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  virtual void SetControlVolume_Moved(CConfig *config, CGeometry *geometry);
+
 	/*! 
 	 * \brief A virtual member.
 	 * \param[in] config - Definition of the particular problem.
@@ -1558,11 +1996,23 @@ public:
    * \param[in] neighbour_start - See GetGlobalElementAdjacencyMatrix.
    * \param[in] neighbour_idx - See GetGlobalElementAdjacencyMatrix.
    * \param[in] cg_elem - Global element centroid coordinates in row major format {x0,y0,x1,y1,...}. Size nDim*nElemDomain.
+   * \param[in,out] visited - Work vector of size nElemDomain, initialized to -1 before the first call, stores the last
+   *                center for which each element was tested (avoids searching the neighbourhood for duplicates).
    * \param[in,out] neighbours - The neighbours of iElem_global.
    */
   void GetRadialNeighbourhood(const unsigned long iElem_global, const passivedouble radius,
                               const vector<unsigned long> &neighbour_start, const long *neighbour_idx,
-                              const su2double *cg_elem, vector<long> &neighbours) const;
+                              const su2double *cg_elem, vector<long> &visited, vector<long> &neighbours) const;
+
+  /*!
+   * \brief Get the CSR neighbourhood lists (global indices) of the local elements for a given filter radius.
+   *        The lists are built on the first request for a radius and kept by the geometry, since the search
+   *        is much more expensive than applying the filter.
+   * \param[in] radius - Filter radius.
+   * \param[in] cg_elem - Global element centroid coordinates, see GetRadialNeighbourhood.
+   * \return Index of the lists in FilterNbr_Start and FilterNbr_Idx.
+   */
+  unsigned long GetFilterNeighbourhoods(const passivedouble radius, const su2double *cg_elem) const;
 
   /*!
    * \brief Compute and store the volume of the elements.
@@ -1591,6 +2041,7 @@ class CPhysicalGeometry : public CGeometry {
   vector<vector<unsigned long> > Neighbors;
   map<unsigned long, unsigned long> Color_List;
   vector<string> Marker_Tags;
+  vector<long> Elem_FaceEdge; /*!< \brief Edge of each element face segment, in the order of SetControlVolume. */
   unsigned long nLocal_Point,
   nLocal_PointDomain,
   nLocal_PointGhost,
@@ -1646,6 +2097,10 @@ class CPhysicalGeometry : public CGeometry {
   unsigned long *Elem_ID_BoundTria_Linear;
   unsigned long *Elem_ID_BoundQuad_Linear;
 
+  CADTElemClass *WallADT;               /*!< \brief ADT of the viscous walls, kept to update the wall distance. */
+  vector<unsigned long> WallADT_Points; /*!< \brief Mesh points of the viscous walls, in the order of the ADT. */
+  vector<unsigned long> WallADT_Donor;  /*!< \brief Nearest element of the ADT of each mesh point. */
+
 public:
   
 	/*!
@@ -1833,6 +2288,14 @@ public:
    */
   void Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone);
 
+  /*!
+   * \brief Read (or build and store) the index of the byte offsets of the sections of an SU2 mesh file.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_mesh_filename - Name of the file with the grid information.
+   * \param[out] Mesh_Index - Offsets of the NPOIN, NELEM and NMARK lines, stride and offsets of the point lines; empty if the index cannot be used.
+   */
+  void Read_SU2_Mesh_Index(CConfig *config, string val_mesh_filename, vector<unsigned long> &Mesh_Index);
+
   /*!
    * \brief Reads the geometry of the grid and adjust the boundary
    *        conditions with the configuration file in parallel (for parmetis).
@@ -1877,6 +2340,8 @@ public:
 
 	/*! 
 	 * \brief Computes the distance to the nearest no-slip wall for each grid node.
+	 *        With UPDATE_WALL_DISTANCE the ADT of the walls is kept, later calls refit
+	 *        it and start the searches from the previous nearest elements.
 	 * \param[in] config - Definition of the particular problem.
 	 */
 	void ComputeWall_Distance(CConfig *config);
@@ -1893,11 +2358,17 @@ public:
 	void SetPoint_Connectivity(void);
   
   /*!
-	 * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm
+	 * \brief Set a renumbering using a Reverse Cuthill-McKee Algorithm, or a Hilbert curve (POINT_ORDERING).
    * \param[in] config - Definition of the particular problem.
 	 */
 	void SetRCM_Ordering(CConfig *config);
   
+  /*!
+   * \brief Order the domain points along a Hilbert space filling curve.
+   * \param[out] Result - Old index of the point at each new position.
+   */
+  void SetHilbert_Ordering(vector<unsigned long> & Result);
+  
 	/*!
 	 * \brief Function declaration to avoid partially overridden classes.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -1955,6 +2426,12 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
 	 */
 	void SetCoord_CG(void);
 
+	/*!
+	 * \brief Set the center of gravity of the boundary elements only, all the
+	 *        surface preprocessing needs for the boundary control volume.
+	 */
+	void SetBoundCoord_CG(void);
+
 	/*! 
 	 * \brief Set the edge structure of the control volume.
 	 * \param[in] config - Definition of the particular problem.
@@ -1994,6 +2471,13 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
 	 */
 	void SetBoundControlVolume(CConfig *config, unsigned short action);
 
+  /*!
+   * \brief Update the centers of gravity, the edges, the control volumes and the boundary
+   *        vertices only around the points moved since the last update of the dual grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetControlVolume_Moved(CConfig *config);
+
   /*!
    * \brief Set the maximum cell-center to cell-center distance for CVs.
    * \param[in] config - Definition of the particular problem.
@@ -2041,6 +2525,43 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
    */
   void SetColorGrid_Parallel(CConfig *config);
 
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+  /*!
+   * \brief Get the name of the partition cache file of a number of parts.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nparts - Number of parts of the partitioning.
+   * \return Name of the partition cache file.
+   */
+  string GetPartition_Cache_FileName(CConfig *config, int val_nparts);
+
+  /*!
+   * \brief Get the header that identifies a partition cache (mesh file, number of parts and of points).
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nparts - Number of parts of the partitioning.
+   * \param[out] Cache_Header - Header of the partition cache (6 values).
+   */
+  void Get_Partition_Cache_Header(CConfig *config, int val_nparts, unsigned long *Cache_Header);
+
+  /*!
+   * \brief Read the colors of the points of the linear partition of this rank from the partition cache.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nparts - Number of parts of the partitioning.
+   * \param[out] part - Colors of the points of the linear partition of this rank.
+   * \return <code>TRUE</code> if a valid cache was found on all ranks; otherwise <code>FALSE</code>.
+   */
+  bool Read_Partition_Cache(CConfig *config, int val_nparts, idx_t *part);
+
+  /*!
+   * \brief Store the colors of the points of the linear partition of this rank in the partition cache.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_nparts - Number of parts of the partitioning.
+   * \param[in] part - Colors of the points of the linear partition of this rank.
+   */
+  void Write_Partition_Cache(CConfig *config, int val_nparts, idx_t *part);
+#endif
+#endif
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -2171,7 +2692,7 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
 	void SetMeshFile(CConfig *config, string val_mesh_out_filename);
 
 	/*! 
-	 * \brief Compute some parameters about the grid quality.
+	 * \brief Compute some parameters about the grid quality over the owned elements of all partitions.
 	 * \param[out] statistics - Information about the grid quality, statistics[0] = (r/R)_min, statistics[1] = (r/R)_ave.		 
 	 */	
 	void GetQualityStatistics(su2double *statistics);
@@ -2460,6 +2981,22 @@ void UpdateTurboVertex(CConfig *config,unsigned short val_iZone, unsigned short
    */
   void ReadUnorderedSensitivity(CConfig *config);
 
+  /*!
+   * \brief Read consecutive fields of a binary restart file at some of the owned points, each rank
+   *        reading only the global indices it owns.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - Name of the binary restart file.
+   * \param[in] val_field - Name of the first field to be read.
+   * \param[in] val_nField - Number of consecutive fields to be read.
+   * \param[in] val_default - Position of the first field if the file does not name it.
+   * \param[in] val_point - Local indices of the points to be read.
+   * \param[out] val_data - Values of the fields, val_nField per point in the order of val_point.
+   * \return Sensitivity with respect to the angle of attack stored in the metadata of the file.
+   */
+  su2double Read_Binary_Sensitivity(CConfig *config, string val_filename, string val_field,
+                                    unsigned short val_nField, unsigned short val_default,
+                                    const vector<unsigned long> &val_point, vector<passivedouble> &val_data);
+
   /*!
    * \brief Get the Sensitivity at a specific point.
    * \param[in] iPoint - The point where to get the sensitivity.
@@ -2753,6 +3290,14 @@ public:
 	 */	
 	void SetBoundControlVolume(CConfig *config, CGeometry *geometry, unsigned short action);
 
+  /*!
+   * \brief Update the agglomerated control volumes, edges, vertices and coordinates only
+   *        for the coarse points whose children were recomputed on the finer grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetControlVolume_Moved(CConfig *config, CGeometry *geometry);
+
 	/*! 
 	 * \brief Set a representative coordinates of the agglomerated control volume.
 	 * \param[in] geometry - Geometrical definition of the problem.
@@ -63,6 +63,13 @@ inline CFaceOfElement& CFaceOfElement::operator=(const CFaceOfElement &other){Co
 
 inline void CFaceOfElement::CreateUniqueNumbering(void){sort(cornerPoints, cornerPoints+nCornerPoints);}
 
+inline size_t CFaceOfElementHash::operator()(const CFaceOfElement &face) const {
+  size_t hash = face.nCornerPoints;
+  for(unsigned short i=0; i<face.nCornerPoints; ++i)
+    hash ^= (size_t) face.cornerPoints[i] + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
 inline CBoundaryFace::CBoundaryFace(const CBoundaryFace &other){Copy(other);}
 
 inline CBoundaryFace& CBoundaryFace::operator=(const CBoundaryFace &other){Copy(other); return (*this);}
@@ -225,6 +232,39 @@ inline void CGeometry::SetnVertexSpanMax(unsigned short marker_flag, unsigned lo
 
 inline unsigned long CGeometry::GetnEdge(void) { return nEdge; }
 
+inline unsigned short CGeometry::GetnEdgeColor(void) { return (nEdgeColor > 0)? nEdgeColor : 1; }
+
+inline unsigned long CGeometry::GetEdgeColor_Begin(unsigned short val_color) { return (nEdgeColor > 0)? EdgeColor_Ptr[val_color] : 0; }
+
+inline unsigned long CGeometry::GetEdgeColor_End(unsigned short val_color) { return (nEdgeColor > 0)? EdgeColor_Ptr[val_color+1] : nEdge; }
+
+inline unsigned long CGeometry::GetEdgeColor_Edge(unsigned long val_pos) { return (nEdgeColor > 0)? EdgeColor_Edge[val_pos] : val_pos; }
+
+inline unsigned short CGeometry::GetnElemColor(void) { return (nElemColor > 0)? nElemColor : 1; }
+
+inline unsigned long CGeometry::GetElemColor_Begin(unsigned short val_color) { return (nElemColor > 0)? ElemColor_Ptr[val_color] : 0; }
+
+inline unsigned long CGeometry::GetElemColor_End(unsigned short val_color) { return (nElemColor > 0)? ElemColor_Ptr[val_color+1] : nElem; }
+
+inline unsigned long CGeometry::GetElemColor_Elem(unsigned long val_pos) { return (nElemColor > 0)? ElemColor_Elem[val_pos] : val_pos; }
+
+inline unsigned long CGeometry::GetEdge_Node(unsigned long val_edge, unsigned short val_node) { return Edge_Node[2*val_edge+val_node]; }
+
+inline su2double *CGeometry::GetEdge_Normal(unsigned long val_edge) { return &Edge_Normal[val_edge*nDim]; }
+
+inline su2double *CGeometry::GetLS_Weight(unsigned long val_edge, unsigned short val_node) { return &LS_Weight[(2*val_edge+val_node)*nDim]; }
+
+inline su2double *CGeometry::GetEdge_Geometry(unsigned long val_edge) { return &Edge_Geometry[val_edge*(nDim+2)]; }
+
+inline unsigned long CGeometry::GetVertex_Node(unsigned short val_marker, unsigned long val_vertex) { return Vertex_Node[Vertex_Begin[val_marker]+val_vertex]; }
+
+inline unsigned long CGeometry::GetVertex_Neighbor(unsigned short val_marker, unsigned long val_vertex) { return Vertex_Neighbor[Vertex_Begin[val_marker]+val_vertex]; }
+
+inline su2double *CGeometry::GetVertex_Normal(unsigned short val_marker, unsigned long val_vertex) {
+  if (Vertex_Normal.empty()) return vertex[val_marker][val_vertex]->GetNormal();
+  return &Vertex_Normal[(Vertex_Begin[val_marker]+val_vertex)*nDim];
+}
+
 inline bool CGeometry::FindFace(unsigned long first_elem, unsigned long second_elem, unsigned short &face_first_elem, unsigned short &face_second_elem) { return 0;}
 
 inline void CGeometry::SetBoundVolume(void) { }
@@ -291,6 +331,8 @@ inline void CGeometry::SetVertex(CGeometry *fine_grid, CConfig *config) { }
 
 inline void CGeometry::SetCoord_CG(void) { }
 
+inline void CGeometry::SetBoundCoord_CG(void) { }
+
 inline void CGeometry::SetMaxLength(CConfig* config) { }
 
 inline void CGeometry::SetControlVolume(CConfig *config, unsigned short action) { }
@@ -309,6 +351,24 @@ inline void CGeometry::SetBoundControlVolume(CConfig *config, unsigned short act
 
 inline void CGeometry::SetBoundControlVolume(CConfig *config, CGeometry *geometry, unsigned short action) { }
 
+inline void CGeometry::SetControlVolume_Moved(CConfig *config) { }
+
+inline void CGeometry::SetControlVolume_Moved(CConfig *config, CGeometry *geometry) { }
+
+inline bool CGeometry::GetDualGrid_Affected(unsigned long val_point) { return (DualGrid_Affected.empty() || DualGrid_Affected[val_point]); }
+
+inline unsigned long CGeometry::GetnVertex_ActDiskSend(void) { return Point_ActDiskSend.size(); }
+
+inline unsigned long CGeometry::GetPoint_ActDiskSend(unsigned long val_index) { return Point_ActDiskSend[val_index]; }
+
+inline unsigned long CGeometry::GetnVertex_ActDiskRecv(void) { return Vertex_ActDiskRecv.size(); }
+
+inline unsigned short CGeometry::GetMarker_ActDiskRecv(unsigned long val_index) { return Marker_ActDiskRecv[val_index]; }
+
+inline unsigned long CGeometry::GetVertex_ActDiskRecv(unsigned long val_index) { return Vertex_ActDiskRecv[val_index]; }
+
+inline unsigned long CGeometry::GetGlobalIndex_ActDiskRecv(unsigned long val_index) { return GlobalIndex_ActDiskRecv[val_index]; }
+
 inline void CGeometry::SetTecPlot(char config_filename[MAX_STRING_SIZE], bool new_file) { }
 
 inline void CGeometry::SetMeshFile(CConfig *config, string val_mesh_out_filename) { }
@@ -54,6 +54,7 @@
 #include "vector_structure.hpp"
 #include "linear_solvers_structure.hpp"
 #include "element_structure.hpp"
+#include "task_thread_pool.hpp"
 
 using namespace std;
 
@@ -313,6 +314,7 @@ public:
   vector<unsigned short> Fix_KPlane;  /*!< \brief Fix FFD K plane. */
 
   CFreeFormBlending** BlendingFunction;
+  vector<su2double> BasisValue[3];    /*!< \brief Blending functions of each direction at the evaluated parametric coordinate. */
 
 
 public:
@@ -760,6 +762,15 @@ public:
 	 */		
 	su2double *EvalCartesianCoord(su2double *ParamCoord);
 	
+	/*!
+	 * \brief Get the nonzero entries of the derivative of the cartesian coords of a point w.r.t. the
+	 *        control points, i.e. the products of blending functions (the same for each dimension).
+	 * \param[in] ParamCoord - Parametric coordinates of a point.
+	 * \param[out] Index_CP - Index <i>(i*mOrder + j)*nOrder + k</i> of the control points with a nonzero basis.
+	 * \param[out] Basis_CP - Value of the basis of those control points.
+	 */
+	void EvalCartesianCoord_Jacobian(su2double *ParamCoord, vector<unsigned long> &Index_CP, vector<su2double> &Basis_CP);
+	
 	/*! 
 	 * \brief Get the order in the l direction of the FFD FFDBox.
 	 * \return Order in the l direction of the FFD FFDBox.
@@ -967,9 +978,34 @@ protected:
 
 	unsigned long nIterMesh;	/*!< \brief Number of iterations in the mesh update. +*/
 
+  bool StiffMatrix_Ready,     /*!< \brief The stiffness matrix is kept from a previous increment. */
+  Precond_Ready;              /*!< \brief The preconditioner is kept from a previous increment. */
+  unsigned long Rebuild_Iter; /*!< \brief Linear iterations of the first solve after the last rebuild. */
+
   CSysMatrix StiffMatrix; /*!< \brief Matrix to store the point-to-point stiffness. */
   CSysVector LinSysSol;
   CSysVector LinSysRes;
+  CSysSolve System;       /*!< \brief Linear solver, it keeps the space recycled by GCRO-DR between the increments. */
+
+  CTaskThreadPool *taskThreadPool;                   /*!< \brief Threads that assemble the element colors, NULL when serial. */
+  vector<vector<unsigned long> > ElemColorChunks;    /*!< \brief Bounds of the chunks of the elements of every color. */
+  CGeometry *taskGeometry;                           /*!< \brief Geometry of the element loop carried out by the threads. */
+  CConfig *taskConfig;                               /*!< \brief Config of the element loop carried out by the threads. */
+
+  bool Rigid_Pending;         /*!< \brief The fine grid was only moved rigidly since the last update of the coarse grids. */
+  su2double Rigid_Matrix[9],  /*!< \brief Rotation (3x3, row-major) of the rigid motions since then. */
+  Rigid_Transl[3];            /*!< \brief Translation of the rigid motions since then. */
+
+  /*!
+   * \brief Update the dual grid after a rigid motion x' = R*x + t of the whole fine grid, by rotating the
+   *        normals instead of recomputing the control volumes. The motion is accumulated for UpdateMultiGrid().
+   *        Falls back to UpdateDualGrid() for the discrete adjoint, which differentiates the dual grid.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] rotMatrix - Rotation matrix R (3x3, row-major).
+   * \param[in] transl - Translation t.
+   */
+  void UpdateDualGrid_Rigid(CGeometry *geometry, CConfig *config, const su2double *rotMatrix, const su2double *transl);
 
 public:
 
@@ -1017,6 +1053,22 @@ public:
 	 */
 	su2double SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Add the stiffness matrices of a range of elements, in the order of the element colors.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_begin - First position of the range in the colored element list.
+   * \param[in] val_end - End of the range, not included.
+   */
+  void SetFEAMethodContributions_Range(CGeometry *geometry, CConfig *config, unsigned long val_begin, unsigned long val_end);
+  
+  /*!
+   * \brief Function called by the thread pool to assemble a chunk of elements of one color.
+   * \param[in] movement - The volumetric movement, passed as the owner of the pool.
+   * \param[in] chunk - Range of the chunk in the colored element list.
+   */
+  static void ProcessTaskChunk_Deform(void *movement, const CTaskChunk &chunk);
+  
   /*!
    * \brief Build the stiffness matrix for a 3-D hexahedron element. The result will be placed in StiffMatrix_Elem.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1242,6 +1294,16 @@ public:
 	 */
   void SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative = false);
 
+  /*!
+   * \brief Grid deformation by radial basis function interpolation of the surface displacements.
+   *        The control points are selected greedily among the boundary points until the interpolation
+   *        error on the surface is below the tolerance, and the interpolant is evaluated at the volume points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] UpdateGeo - Update geometry.
+   */
+  void SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo);
+
   /*!
    * \brief Grid deformation using the spring analogy method.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1255,15 +1317,17 @@ public:
    * \brief Set the derivatives of the boundary nodes.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iDir - Tangent direction of the derivatives.
    */
-  void SetBoundaryDerivatives(CGeometry *geometry, CConfig *config);
+  void SetBoundaryDerivatives(CGeometry *geometry, CConfig *config, unsigned short iDir = 0);
 
   /*!
    * \brief Update the derivatives of the coordinates after the grid movement.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] iDir - Tangent direction of the derivatives.
    */
-  void UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config);
+  void UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config, unsigned short iDir = 0);
 
 	/*!
 	 * \brief Compute the determinant of a 3 by 3 matrix.
@@ -191,6 +191,24 @@ public:
    */
   void Collect_VertexInfo(bool faces, int markDonor, int markTarget, unsigned long nVertexDonor, unsigned short nDim);
 
+  /*!
+   * \brief Collect only the donor vertices that can be the nearest donor of a local target vertex.
+   *        The bounding boxes of the donor patches are gathered on all ranks and a donor rank is
+   *        requested only if its box can contain the nearest donor of one of the local target vertices.
+   *        The vertex information is then exchanged point-to-point between the overlapping ranks.
+   * \param[in]  markDonor - Index of the boundary on the donor domain.
+   * \param[in]  markTarget - Index of the boundary on the target domain.
+   * \param[in]  nVertexDonor - Number of vertices on the donor boundary.
+   * \param[in]  nVertexTarget - Number of vertices on the target boundary.
+   * \param[in]  nDim - number of physical dimensions.
+   * \param[out] donorCoord - Coordinates of the collected donor vertices.
+   * \param[out] donorGlobalPoint - Global point indices of the collected donor vertices.
+   * \param[out] donorProc - Rank that owns each of the collected donor vertices.
+   */
+  void Collect_NearbyVertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor, unsigned long nVertexTarget,
+                                unsigned short nDim, vector<su2double> &donorCoord,
+                                vector<unsigned long> &donorGlobalPoint, vector<int> &donorProc);
+
 };
 
 /*!
@@ -446,6 +464,13 @@ private:
    */
   void Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P);
 
+  /*!
+   * \brief Set up a sparse transfer matrix for a compactly supported basis. The weights of each target point
+   * are computed from a local interpolation problem over the donor points within two support radii.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_TransferCoeff_Sparse(CConfig **config);
+
 };
 
 /*!
@@ -70,6 +70,10 @@ using namespace std;
 class CSysSolve {
   
 private:
+
+  su2double Residual_Rel; /*!< \brief Residual reached by the last call of Solve, relative to the initial one. */
+
+  vector<CSysVector> Recycle_Space; /*!< \brief Deflation space of GCRO-DR, kept from one call of Solve to the next. */
   
   /*!
    * \brief sign transfer function
@@ -80,7 +84,8 @@ private:
    * so, feel free to delete this and replace it as needed with the
    * appropriate global function
    */
-  su2double Sign(const su2double & x, const su2double & y) const;
+  template<class ScalarType>
+  ScalarType Sign(const ScalarType & x, const ScalarType & y) const;
   
   /*!
    * \brief applys a Givens rotation to a 2-vector
@@ -89,7 +94,8 @@ private:
    * \param[in, out] h1 - first element of 2x1 vector being transformed
    * \param[in, out] h2 - second element of 2x1 vector being transformed
    */
-  void ApplyGivens(const su2double & s, const su2double & c, su2double & h1, su2double & h2);
+  template<class ScalarType>
+  void ApplyGivens(const ScalarType & s, const ScalarType & c, ScalarType & h1, ScalarType & h2);
   
   /*!
    * \brief generates the Givens rotation matrix for a given 2-vector
@@ -101,7 +107,8 @@ private:
    * Based on givens() of SPARSKIT, which is based on p.202 of
    * "Matrix Computations" by Golub and van Loan.
    */
-  void GenerateGivens(su2double & dx, su2double & dy, su2double & s, su2double & c);
+  template<class ScalarType>
+  void GenerateGivens(ScalarType & dx, ScalarType & dy, ScalarType & s, ScalarType & c);
   
   /*!
    * \brief finds the solution of the upper triangular system Hsbg*x = rhs
@@ -114,8 +121,9 @@ private:
    * \pre the upper Hessenberg matrix has been transformed into a
    * triangular matrix.
    */
-  void SolveReduced(const int & n, const vector<vector<su2double> > & Hsbg,
-                    const vector<su2double> & rhs, vector<su2double> & x);
+  template<class ScalarType>
+  void SolveReduced(const int & n, const vector<vector<ScalarType> > & Hsbg,
+                    const vector<ScalarType> & rhs, vector<ScalarType> & x);
   
   /*!
    * \brief Modified Gram-Schmidt orthogonalization
@@ -135,7 +143,37 @@ private:
    * vector is kept in nrm0 and updated after operating with each vector
    *
    */
-  void ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w);
+  template<class ScalarType>
+  void ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<TCSysVector<ScalarType> > & w);
+  
+  /*!
+   * \brief Classical Gram-Schmidt orthogonalization with one fused reduction
+   * \param[in] i - index indicating which vector in w is being orthogonalized
+   * \param[in, out] Hsbg - the upper Hessenberg begin updated
+   * \param[in, out] w - the (i+1)th vector of w is orthogonalized against the
+   *                    previous vectors in w
+   *
+   * \pre the vectors w[0:i] are orthonormal
+   * \post the vectors w[0:i+1] are orthonormal
+   *
+   * The projections on w[0:i] and the norm of w[i+1] are computed with a single
+   * global reduction, the new norm follows from Pythagoras. A second pass (one
+   * more reduction) is done only if the norm drops below 1/sqrt(2) of its initial
+   * value, which signals a loss of orthogonality.
+   */
+  template<class ScalarType>
+  void ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<TCSysVector<ScalarType> > & w);
+
+  /*!
+   * \brief Eigen-decomposition of a small dense symmetric matrix (cyclic Jacobi method).
+   * \param[in] n - size of the matrix
+   * \param[in, out] A - the matrix, on exit its diagonal holds the eigenvalues
+   * \param[out] eigval - eigenvalues (not sorted)
+   * \param[out] eigvec - eigenvectors, stored by columns
+   */
+  template<class ScalarType>
+  void SymmetricEigen(unsigned long n, vector<vector<ScalarType> > & A, vector<ScalarType> & eigval,
+                      vector<vector<ScalarType> > & eigvec);
   
   /*!
    * \brief writes header information for a CSysSolve residual history
@@ -168,8 +206,9 @@ public:
    * \param[in] m - maximum size of the search subspace
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    */
-  unsigned long CG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                                  CPreconditioner & precond, su2double tol,
+  template<class ScalarType>
+  unsigned long CG_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                                  TCPreconditioner<ScalarType> & precond, su2double tol,
                                   unsigned long m, su2double *residual, bool monitoring);
 	
   /*!
@@ -182,10 +221,12 @@ public:
    * \param[in] m - maximum size of the search subspace
    * \param[in] residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
+   * \param[in] fused_reductions - use classical Gram-Schmidt, with one global reduction per iteration.
    */
-  unsigned long FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                      CPreconditioner & precond, su2double tol,
-                      unsigned long m, su2double *residual, bool monitoring);
+  template<class ScalarType>
+  unsigned long FGMRES_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                      TCPreconditioner<ScalarType> & precond, su2double tol,
+                      unsigned long m, su2double *residual, bool monitoring, bool fused_reductions = false);
 	
 	/*!
    * \brief Biconjugate Gradient Stabilized Method (BCGSTAB)
@@ -198,9 +239,45 @@ public:
    * \param[in] residual
    * \param[in] monitoring - turn on priting residuals from solver to screen.
    */
-  unsigned long BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                        CPreconditioner & precond, su2double tol,
+  template<class ScalarType>
+  unsigned long BCGSTAB_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                        TCPreconditioner<ScalarType> & precond, su2double tol,
                         unsigned long m, su2double *residual, bool monitoring);
+
+  /*!
+   * \brief Restarted FGMRES with subspace recycling (GCRO-DR)
+   * \param[in] b - the right hand size vector
+   * \param[in, out] x - on entry the intial guess, on exit the solution
+   * \param[in] mat_vec - object that defines matrix-vector product
+   * \param[in] precond - object that defines preconditioner
+   * \param[in] tol - tolerance with which to solve the system
+   * \param[in] m - number of Krylov directions of one cycle (restart frequency)
+   * \param[in] MaxIter - maximum number of iterations of all cycles
+   * \param[in] nRecycle - size of the recycled space
+   * \param[in, out] U - recycled space, on entry the one of the previous solve, on exit the one for the next solve
+   * \param[in] residual
+   * \param[in] monitoring - turn on priting residuals from solver to screen.
+   *
+   * The residual is first minimized over the recycled space, and the Krylov directions of each
+   * cycle are kept orthogonal to its image, (I - C*C^T)*A*M^-1 with A*U = C. At the end, U is replaced
+   * by the combinations of U and of the last Krylov directions with the smallest singular values of the
+   * projected operator, i.e. the ones that slow down the restarted method the most.
+   */
+  template<class ScalarType>
+  unsigned long GCRODR_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                                 TCPreconditioner<ScalarType> & precond, su2double tol, unsigned long m, unsigned long MaxIter,
+                                 unsigned short nRecycle, vector<TCSysVector<ScalarType> > & U, su2double *residual, bool monitoring);
+
+  /*!
+   * \brief Get the space recycled by GCRO-DR between the solves of this object.
+   * \return Reference to the recycled vectors (empty before the first solve).
+   */
+  vector<CSysVector> & GetRecycle_Space(void);
+
+  /*!
+   * \brief Discard the space recycled by GCRO-DR, e.g. when the system changes completely.
+   */
+  void ClearRecycle_Space(void);
   
   /*!
    * \brief Solve the linear system using a Krylov subspace method
@@ -209,8 +286,37 @@ public:
    * \param[in] LinSysSol - Linear system solution
    * \param[in] geometry -  Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] mat_vec_ext - Product with the system matrix, if not given the product with the Jacobian is used.
+   * \param[in] build_precond - Build the preconditioner, if false the one built by a previous solve is used.
+   * \param[in] transposed - Solve the system with the transposed matrix (Krylov methods with the Jacobi or ILU preconditioners).
+   */
+  unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config,
+                      CMatrixVectorProduct *mat_vec_ext = NULL, bool build_precond = true, bool transposed = false);
+
+  /*!
+   * \brief Get the residual reached by the last call of Solve, relative to the initial residual.
+   *        It is zero if the residual is not available (passive solves and the linelet smoother).
+   * \return Relative residual of the linear system.
+   */
+  su2double GetResidual_Rel(void) const;
+  
+  /*!
+   * \brief Solve the linear system with the passive copies of the matrix and of the preconditioner,
+   *        for the solves that are external functions of the AD tape.
+   * \param[in] Jacobian - Matrix of the system, its passive copies must be up to date.
+   * \param[in] LinSysRes - Linear system residual.
+   * \param[in,out] LinSysSol - Initial guess, on exit the solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] kind_solver - Krylov method.
+   * \param[in] kind_prec - Preconditioner, Jacobi or ILU.
+   * \param[in] tol - Tolerance of the solver.
+   * \param[in] MaxIter - Maximum number of iterations.
+   * \param[in] transposed - Solve the system with the transposed matrix.
+   * \return Number of iterations.
    */
-  unsigned long Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config);
+  unsigned long Solve_Passive(CSysMatrix & Jacobian, const CSysVectorPassive & LinSysRes, CSysVectorPassive & LinSysSol, CGeometry *geometry, CConfig *config,
+                              unsigned short kind_solver, unsigned short kind_prec, su2double tol, unsigned long MaxIter, bool transposed);
   
 
   /*!
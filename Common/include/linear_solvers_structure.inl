@@ -37,7 +37,8 @@
 
 #pragma once
 
-inline su2double CSysSolve::Sign(const su2double & x, const su2double & y) const {
+template<class ScalarType>
+inline ScalarType CSysSolve::Sign(const ScalarType & x, const ScalarType & y) const {
   if (y == 0.0)
     return 0.0;
   else {
@@ -46,3 +47,9 @@ inline su2double CSysSolve::Sign(const su2double & x, const su2double & y) const
     else return fabs(x);
   }
 }
+
+inline su2double CSysSolve::GetResidual_Rel(void) const { return Residual_Rel; }
+
+inline vector<CSysVector> & CSysSolve::GetRecycle_Space(void) { return Recycle_Space; }
+
+inline void CSysSolve::ClearRecycle_Space(void) { Recycle_Space.clear(); }
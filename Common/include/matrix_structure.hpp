@@ -47,6 +47,7 @@
 #include "config_structure.hpp"
 #include "geometry_structure.hpp"
 #include "vector_structure.hpp"
+#include "task_thread_pool.hpp"
 
 #ifdef HAVE_MKL
 #include "mkl.h"
@@ -56,6 +57,82 @@ using namespace std;
 
 const su2double eps = numeric_limits<passivedouble>::epsilon(); /*!< \brief machine epsilon */
 
+/*!
+ * \class CSysMatrixPattern
+ * \brief Sparsity pattern (compressed row format) shared by the matrices built on the same graph.
+ *
+ * The patterns are cached by geometry, fill level and connectivity type, and
+ * reference counted. A new pattern identical to a cached one (e.g. the instances
+ * of a harmonic balance run) is merged with it, so the index arrays are stored once.
+ */
+class CSysMatrixPattern {
+private:
+  unsigned long nPoint,                  /*!< \brief Number of (block) rows. */
+  nnz;                                   /*!< \brief Number of nonzero blocks. */
+  unsigned long *row_ptr;                /*!< \brief Pointers to the first element in each row. */
+  unsigned long *col_ind;                /*!< \brief Column index of each element. */
+  unsigned short fill_level;             /*!< \brief Fill in level of the pattern (0 for the matrix itself). */
+  bool EdgeConnect;                      /*!< \brief Connectivity from the edges or from the elements. */
+  vector<CGeometry*> geometry;           /*!< \brief Geometries that use this pattern. */
+  unsigned short nRef;                   /*!< \brief Number of matrices that use this pattern. */
+  
+  static vector<CSysMatrixPattern*> Patterns;  /*!< \brief Cache of the patterns in use. */
+  
+  /*!
+   * \brief Build the pattern from the connectivity of the geometry.
+   */
+  CSysMatrixPattern(CGeometry *val_geometry, unsigned long val_nPoint, unsigned short val_fill_level, bool val_EdgeConnect);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CSysMatrixPattern(void);
+  
+public:
+  
+  /*!
+   * \brief Get a cached pattern, or build and cache a new one.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] nPoint - Number of points (block rows).
+   * \param[in] fill_level - Fill in level.
+   * \param[in] EdgeConnect - There is (or not) an edge structure.
+   * \return Pattern, with its reference count increased.
+   */
+  static CSysMatrixPattern* GetPattern(CGeometry *geometry, unsigned long nPoint, unsigned short fill_level, bool EdgeConnect);
+  
+  /*!
+   * \brief Release a pattern, it is deleted with its last reference.
+   * \param[in] pattern - Pattern obtained with GetPattern.
+   */
+  static void ReleasePattern(CSysMatrixPattern *pattern);
+  
+  /*!
+   * \brief Neighbours of a point up to a fill level.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iPoint - Base point to compute neighbours.
+   * \param[in] deep_level - Deep level for the recursive algorithm.
+   * \param[in] fill_level - ILU fill in level.
+   * \param[in] EdgeConnect - There is (or not) an edge structure).
+   * \param[in] vneighs - Storage the neighbours points to iPoint.
+   */
+  static void SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsigned short deep_level, unsigned short fill_level, bool EdgeConnect, vector<unsigned long> & vneighs);
+  
+  /*!
+   * \brief Get the number of nonzero blocks.
+   */
+  unsigned long GetnNonZero(void);
+  
+  /*!
+   * \brief Get the row pointers.
+   */
+  unsigned long *GetRowPtr(void);
+  
+  /*!
+   * \brief Get the column indices.
+   */
+  unsigned long *GetColInd(void);
+  
+};
 
 /*!
  * \class CSysMatrix
@@ -80,6 +157,13 @@ private:
   unsigned long *row_ptr_ilu;        /*!< \brief Pointers to the first element in each row (ILU). */
   unsigned long *col_ind_ilu;        /*!< \brief Column index for each of the elements in val() (ILU). */
   unsigned short ilu_fill_in;        /*!< \brief Fill in level for the ILU preconditioner. */
+  CSysMatrixPattern *pattern;        /*!< \brief Shared sparsity pattern of the matrix (owner of row_ptr and col_ind). */
+  CSysMatrixPattern *pattern_ilu;    /*!< \brief Shared sparsity pattern of the ILU(n) matrix. */
+  vector<unsigned long> dia_ptr;     /*!< \brief Position of the diagonal block of each row. */
+  vector<unsigned long> edge_ptr;    /*!< \brief Position of the blocks (i,j) and (j,i) of each edge, empty without edges. */
+  bool edge_format;                  /*!< \brief Edge format, the diagonal blocks and then the two blocks of each edge, without row pointers and column indices. */
+  CGeometry *edge_geometry;          /*!< \brief Geometry whose edges index the off-diagonal blocks of the edge format. */
+  bool frozen;                       /*!< \brief The entries are kept, assembly calls are ignored (lagged Jacobian). */
   
   su2double *block;             /*!< \brief Internal array to store a subblock of the matrix. */
   su2double *block_inverse;             /*!< \brief Internal array to store a subblock of the matrix. */
@@ -90,15 +174,82 @@ private:
   su2double *sum_vector;         /*!< \brief Auxiliary array to store intermediate results. */
   su2double *invM;              /*!< \brief Inverse of (Jacobi) preconditioner. */
   
+  bool mixed_precision;         /*!< \brief Apply the ILU and Jacobi preconditioners in single precision. */
+  float *ILU_matrix_flt;        /*!< \brief Single precision copy of the ILU factorization, with inverted diagonal blocks. */
+  float *invM_flt;              /*!< \brief Single precision copy of the inverse of the (Jacobi) preconditioner. */
+  
+  bool passive_copy;            /*!< \brief Keep passive copies for the linear solves that are external functions of the AD tape. */
+  passivedouble *matrix_psv;    /*!< \brief Passive copy of the entries of the sparse matrix. */
+  passivedouble *ILU_matrix_psv;  /*!< \brief Passive copy of the ILU factorization, with inverted diagonal blocks. */
+  passivedouble *invM_psv;      /*!< \brief Passive copy of the inverse of the (Jacobi) preconditioner. */
+  passivedouble *aux_vector_psv;  /*!< \brief Auxiliary array of the passive products. */
+  passivedouble *sum_vector_psv;  /*!< \brief Auxiliary array of the passive products. */
+  bool invM_psv_current,        /*!< \brief The passive Jacobi preconditioner was built from the current entries. */
+  ILU_psv_current;              /*!< \brief The passive ILU factorization was built from the current entries. */
+  bool invM_psv_transposed,     /*!< \brief The passive Jacobi preconditioner was built from the transposed matrix. */
+  ILU_psv_transposed;           /*!< \brief The passive ILU factorization was built from the transposed matrix. */
+  CSysVectorPassive Guess_psv;  /*!< \brief Solution of the last external solve, initial guess of the next one. */
+  vector<CSysVectorPassive> Recycle_psv,   /*!< \brief Space recycled by GCRO-DR between the passive solves. */
+  Recycle_psv_transposed;                   /*!< \brief Space recycled by GCRO-DR between the passive transposed solves. */
+  
+  bool ilu_levels;                            /*!< \brief Order the ILU factorization and sweeps by level sets. */
+  vector<unsigned long> ILULevel_Fwd_Ptr,     /*!< \brief Start of each level of the forward sweep in ILULevel_Fwd_Row. */
+  ILULevel_Fwd_Row,                           /*!< \brief Rows of the forward sweep (and factorization), grouped by level. */
+  ILULevel_Bwd_Ptr,                           /*!< \brief Start of each level of the backward sweep in ILULevel_Bwd_Row. */
+  ILULevel_Bwd_Row;                           /*!< \brief Rows of the backward sweep, grouped by level. */
+  
+  /*--- Row loops carried out by the threads of the rank ---*/
+  
+  enum ENUM_ROW_TASK {
+    ROW_TASK_MATVEC  = 0,                     /*!< \brief Rows of the matrix vector product. */
+    ROW_TASK_JACOBI  = 1,                     /*!< \brief Points of the Jacobi preconditioner. */
+    ROW_TASK_ILU_FWD = 2,                     /*!< \brief Rows of one level of the forward ILU sweep. */
+    ROW_TASK_ILU_BWD = 3,                     /*!< \brief Rows of one level of the backward ILU sweep. */
+    ROW_TASK_FIRST_TOUCH = 4                  /*!< \brief Rows of the values first touched by the threads, see FirstTouchValues. */
+  };
+  
+  CTaskThreadPool *ThreadPool;                /*!< \brief Threads that share the row loops, NULL when the loops are serial. */
+  vector<su2double> ThreadScratch;            /*!< \brief Auxiliary arrays of the ILU sweeps of every thread. */
+  unsigned long ThreadScratch_Size;           /*!< \brief Size of the auxiliary arrays of one thread. */
+  unsigned short RowTask;                     /*!< \brief Row loop being carried out by the threads. */
+  bool RowTask_SinglePrec;                    /*!< \brief The row loop uses the single precision copies. */
+  const CSysVector *RowTask_Vec;              /*!< \brief Input vector of the row loop. */
+  CSysVector *RowTask_Prod;                   /*!< \brief Output vector of the row loop (overwritten in place by the ILU sweeps). */
+  
+  unsigned short nAMG_Level;                  /*!< \brief Number of levels of the AMG hierarchy, 0 until it is built. */
+  vector<unsigned long> AMG_nRow;             /*!< \brief Number of (block) rows of each AMG level. */
+  vector<vector<unsigned long> > AMG_RowPtr,  /*!< \brief Row pointers of the coarse AMG matrices, level 0 is the matrix itself. */
+  AMG_ColInd,                                 /*!< \brief Column indices of the coarse AMG matrices. */
+  AMG_Aggregate;                              /*!< \brief Aggregate (row of the next level) of each row of a level. */
+  vector<vector<su2double> > AMG_Val,         /*!< \brief Blocks of the coarse AMG matrices. */
+  AMG_InvDiag,                                /*!< \brief Inverse of the diagonal blocks of each level, for the smoother. */
+  AMG_Rhs, AMG_Sol, AMG_Res;                  /*!< \brief Work vectors of each level. */
+  
+  CSysMatrix *PressureMatrix;                 /*!< \brief Scalar matrix of the first variable (pressure block), with its own AMG hierarchy. */
+  CSysVector PressureCorrection,              /*!< \brief Correction of the pressure stage, zero for the other variables. */
+  PressureResidual;                           /*!< \brief Residual of the coupled system left by the pressure stage. */
+  
+  unsigned long RAS_nRow;                     /*!< \brief Rows of the local matrix extended by the overlap (RAS), 0 until it is built. */
+  vector<long> RAS_Row;                       /*!< \brief Row of the extended matrix of each local point, -1 if outside the overlap. */
+  vector<unsigned long> RAS_Point,            /*!< \brief Local point of each row of the extended matrix, the domain points first. */
+  RAS_RowPtr, RAS_ColInd,                     /*!< \brief Sparse pattern of the extended matrix, sorted columns. */
+  RAS_DiagPtr,                                /*!< \brief Position of the diagonal block of each row of the extended matrix. */
+  RAS_nBlockSend, RAS_nBlockRecv;             /*!< \brief Blocks of the halo rows sent and received through each SEND_RECEIVE marker. */
+  vector<long> RAS_Local,                     /*!< \brief Position in the extended matrix of each block of the domain rows. */
+  RAS_RecvDest;                               /*!< \brief Position in the extended matrix of each received block, -1 if dropped. */
+  vector<su2double> RAS_Val,                  /*!< \brief ILU(0) factorization of the extended matrix. */
+  RAS_InvDiag,                                /*!< \brief Inverse of the diagonal blocks of the factorization. */
+  RAS_Vec;                                    /*!< \brief Work vector of the extended problem. */
+  
   bool *LineletBool;                          /*!< \brief Identify if a point belong to a linelet. */
   vector<unsigned long> *LineletPoint;        /*!< \brief Linelet structure. */
   unsigned long nLinelet;                     /*!< \brief Number of Linelets in the system. */
-  su2double **UBlock, **invUBlock, **LBlock,
-  **yVector, **zVector, **rVector, *LFBlock,
-  *LyVector, *FzVector;           /*!< \brief Arrays of the Linelet preconditioner methodology. */
-  unsigned long max_nElem;
+  vector<unsigned long> LineletPtr;           /*!< \brief Start of each linelet in the factorization arrays. */
+  vector<su2double> LineletInvU,              /*!< \brief Inverse of the diagonal blocks U of the block LU factorization of the linelets. */
+  LineletL;                                   /*!< \brief Lower blocks L of the block LU factorization of the linelets. */
+  su2double *LFBlock, *LyVector, *FzVector;   /*!< \brief Auxiliary arrays of the Linelet preconditioner. */
 
-#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+#ifdef HAVE_MKL
   void * MatrixMatrixProductJitter;                   		/*!< \brief Jitter handle for MKL JIT based GEMM. */
   dgemm_jit_kernel_t MatrixMatrixProductKernel;               	/*!< \brief MKL JIT based GEMM kernel. */
   void * MatrixVectorProductJitterBetaZero;           		/*!< \brief Jitter handle for MKL JIT based GEMV. */
@@ -108,6 +259,205 @@ private:
   bool useMKL;
 #endif
 
+  /*--- Dense block kernels, specialized at compile time for the usual block sizes.
+   The specialization matching nVar is selected once, in SetIndexes. ---*/
+  
+  void (*MatVecBlock)(const su2double *matrix, const su2double *vector, su2double *product, unsigned long n);    /*!< \brief product = matrix*vector. */
+  void (*MatVecBlock_Flt)(const float *matrix, const su2double *vector, su2double *product, unsigned long n);    /*!< \brief product = matrix*vector, single precision matrix. */
+  void (*MatVecAddBlock)(const su2double *matrix, const su2double *vector, su2double *product, unsigned long n); /*!< \brief product += matrix*vector. */
+  void (*MatVecBlock_Psv)(const passivedouble *matrix, const passivedouble *vector, passivedouble *product, unsigned long n);    /*!< \brief product = matrix*vector, passive values. */
+  void (*MatVecAddBlock_Psv)(const passivedouble *matrix, const passivedouble *vector, passivedouble *product, unsigned long n); /*!< \brief product += matrix*vector, passive values. */
+  void (*MatMatBlock)(const su2double *matrix_a, const su2double *matrix_b, su2double *product, unsigned long n); /*!< \brief product = matrix_a*matrix_b. */
+  void (*GaussElimBlock)(su2double *block, su2double *rhs, unsigned long n);          /*!< \brief Solve in place, block is overwritten. */
+  void (*InverseBlockKernel)(su2double *block, su2double *invBlock, unsigned long n); /*!< \brief Invert, block is overwritten. */
+  
+  /*!
+   * \brief Select the block kernels specialized for the current number of variables.
+   */
+  void SetBlockKernels(void);
+  
+  /*!
+   * \brief Build the level sets of the ILU sweeps. The rows of one level only depend on
+   *        rows of lower levels, hence they can be processed in any order (or concurrently).
+   */
+  void BuildILULevels(void);
+  
+  /*!
+   * \brief Locate the diagonal blocks, and the off-diagonal blocks of the edges of the geometry,
+   *        such that the assembly of the edge loops does not search the rows of the matrix.
+   * \param[in] EdgeConnect - The matrix is built on the edges.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetBlockPointers(bool EdgeConnect, CGeometry *geometry);
+  
+  /*!
+   * \brief Locate the block (i, j) of the edge format, from the edges of the points.
+   * \param[in] block_i - Row of the block.
+   * \param[in] block_j - Column of the block.
+   * \return Pointer to the block, NULL if i and j are not connected by an edge.
+   */
+  su2double *GetEdgeFormatBlock(unsigned long block_i, unsigned long block_j);
+  
+  /*!
+   * \brief Add the product of the off-diagonal blocks of one row of the edge format by a vector,
+   *        the blocks are reached through the edges of the point.
+   * \param[in] vec - Vector to be multiplied by the row.
+   * \param[in] row_i - Row of the matrix.
+   * \param[in] part - Blocks of the row, lower (-1), upper (1) or all (0).
+   * \param[in,out] prod - Product of the row, incremented.
+   */
+  void EdgeRowProduct(const CSysVector & vec, unsigned long row_i, short part, su2double *prod);
+  
+  /*!
+   * \brief Incomplete LU factorization of one row of the ILU matrix.
+   * \param[in] iPoint - Row to be factorized, its dependencies must be factorized already.
+   */
+  void ILUFactorRow(long iPoint);
+  
+  /*!
+   * \brief Forward solve of one row with the lower part of the ILU factorization.
+   * \param[in,out] vec - Vector being solved, overwritten with the solution.
+   * \param[in] iPoint - Row.
+   * \param[in] single_prec - Use the single precision copy of the factorization.
+   * \param[in] scratch - Auxiliary arrays of the calling thread.
+   */
+  void ILUForwardRow(CSysVector & vec, long iPoint, bool single_prec, su2double *scratch);
+  
+  /*!
+   * \brief Backward substitution of one row with the upper part of the ILU factorization.
+   * \param[in,out] vec - Vector being solved, overwritten with the solution.
+   * \param[in] iPoint - Row.
+   * \param[in] single_prec - Use the single precision copy of the factorization.
+   * \param[in] scratch - Auxiliary arrays of the calling thread.
+   */
+  void ILUBackwardRow(CSysVector & vec, long iPoint, bool single_prec, su2double *scratch);
+  
+  /*!
+   * \brief Carry out the rows [val_begin, val_end) of a row loop, split over the threads if any.
+   * \param[in] val_task - Row loop, see ENUM_ROW_TASK.
+   * \param[in] val_begin - First row (or position in the level arrays of the ILU sweeps).
+   * \param[in] val_end - End of the range, not included.
+   */
+  void RunRowTask(unsigned short val_task, unsigned long val_begin, unsigned long val_end);
+  
+  /*!
+   * \brief Carry out a range of rows of the current row loop.
+   * \param[in] val_begin - First row of the range.
+   * \param[in] val_end - End of the range, not included.
+   * \param[in] iThread - Thread that carries out the range.
+   */
+  void RowTask_Range(unsigned long val_begin, unsigned long val_end, unsigned short iThread);
+  
+  /*!
+   * \brief Allocate the values of the matrix and of the preconditioners again and set them
+   *        to zero with the row loops of the threads. The memory pages are placed on the NUMA
+   *        domain of the thread that touches them first, which is then the thread that carries
+   *        out the same rows of the matrix vector product and of the Jacobi preconditioner.
+   */
+  void FirstTouchValues(void);
+  
+  /*!
+   * \brief Set to zero the values of a range of rows of the matrix and of the preconditioners.
+   * \param[in] val_begin - First row of the range.
+   * \param[in] val_end - End of the range, not included.
+   */
+  void FirstTouchRows(unsigned long val_begin, unsigned long val_end);
+  
+  /*!
+   * \brief Function called by the thread pool to carry out a chunk of a row loop.
+   * \param[in] matrix - The matrix, passed as the owner of the pool.
+   * \param[in] chunk - Range of rows.
+   */
+  static void ProcessTaskChunk_Matrix(void *matrix, const CTaskChunk &chunk);
+  
+  /*!
+   * \brief Forward and backward ILU solves, in natural or level scheduled order.
+   * \param[in,out] vec - Right hand side, overwritten with the solution.
+   * \param[in] single_prec - Use the single precision copy of the factorization.
+   */
+  void ILUForwardBackward(CSysVector & vec, bool single_prec);
+  
+  /*!
+   * \brief Copy of the ILU factorization with the diagonal blocks inverted.
+   * \param[out] ILU_copy - Copy, allocated with the size of the ILU matrix.
+   */
+  template<class OtherType>
+  void CopyILUFactorization(OtherType *ILU_copy);
+  
+  /*!
+   * \brief Product of a block of the passive copies by a vector.
+   * \param[in] matrix - Block.
+   * \param[in] vector - Vector.
+   * \param[out] product - Result of the product.
+   */
+  void MatrixVectorProduct_Passive(const passivedouble *matrix, const passivedouble *vector, passivedouble *product);
+  
+  /*!
+   * \brief Forward solve of one row with the passive copy of the ILU factorization.
+   * \param[in,out] vec - Vector being solved, overwritten with the solution.
+   * \param[in] iPoint - Row.
+   */
+  void ILUForwardRow_Passive(CSysVectorPassive & vec, long iPoint);
+  
+  /*!
+   * \brief Backward substitution of one row with the passive copy of the ILU factorization.
+   * \param[in,out] vec - Vector being solved, overwritten with the solution.
+   * \param[in] iPoint - Row.
+   */
+  void ILUBackwardRow_Passive(CSysVectorPassive & vec, long iPoint);
+  
+  /*!
+   * \brief Get the sparse structure and values of one level of the AMG hierarchy.
+   * \param[in] iLevel - Level, 0 is the matrix itself.
+   * \param[out] rowptr - Row pointers.
+   * \param[out] colind - Column indices.
+   * \param[out] val - Blocks of the matrix.
+   */
+  void GetAMGLevel(unsigned short iLevel, unsigned long* &rowptr, unsigned long* &colind, su2double* &val);
+  
+  /*!
+   * \brief Group the rows of an AMG level in aggregates of strongly connected rows,
+   *        and build the sparse structure of the next (coarser) level.
+   * \param[in] iLevel - Level to be coarsened.
+   * \return Number of aggregates, i.e. rows of the next level.
+   */
+  unsigned long AMGAggregate(unsigned short iLevel);
+  
+  /*!
+   * \brief Compute the values of the next level (Galerkin product with the piecewise constant
+   *        prolongation) and the inverse diagonal blocks of the current level.
+   * \param[in] iLevel - Level.
+   */
+  void AMGLevelValues(unsigned short iLevel);
+  
+  /*!
+   * \brief Residual of a level, AMG_Res = AMG_Rhs - A*AMG_Sol.
+   * \param[in] iLevel - Level.
+   */
+  void AMGResidual(unsigned short iLevel);
+  
+  /*!
+   * \brief Damped block Jacobi smoothing of one level.
+   * \param[in] iLevel - Level.
+   * \param[in] nSweep - Number of sweeps.
+   * \param[in] zero_guess - The initial solution is zero.
+   */
+  void AMGSmooth(unsigned short iLevel, unsigned short nSweep, bool zero_guess);
+  
+  /*!
+   * \brief Recursive V-cycle, approximate solution of A*AMG_Sol = AMG_Rhs on a level.
+   * \param[in] iLevel - Level.
+   */
+  void AMGCycle(unsigned short iLevel);
+  
+  /*!
+   * \brief Sparse pattern of the local matrix extended by the halo points of the overlap, and
+   *        the exchange of the rows of those points with the ranks that own them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildRASStructure(CGeometry *geometry, CConfig *config);
+
 public:
   
   /*!
@@ -126,9 +476,23 @@ public:
    * \param[in] nEqn - Number of equations.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] EdgeFormat - Store the diagonal blocks and two blocks per edge of the geometry instead of
+   *            the compressed rows. Only the assembly, the products, and the JACOBI and LU_SGS
+   *            preconditioners and smoothers are available in this format.
    */
   void Initialize(unsigned long nPoint, unsigned long nPointDomain, unsigned short nVar, unsigned short nEqn,
-                  bool EdgeConnect, CGeometry *geometry, CConfig *config);
+                  bool EdgeConnect, CGeometry *geometry, CConfig *config, bool EdgeFormat = false);
+  
+  /*!
+   * \brief Set only the sizes of the system, for operators that apply the matrix without
+   *        storing it. Only the halo exchanges of vectors (SendReceive_Solution) are available.
+   * \param[in] val_nPoint - Number of points of the system, including the halo points.
+   * \param[in] val_nPointDomain - Number of points of the domain.
+   * \param[in] val_nVar - Number of variables.
+   * \param[in] val_nEqn - Number of equations.
+   */
+  void Initialize_MatrixFree(unsigned long val_nPoint, unsigned long val_nPointDomain,
+                             unsigned short val_nVar, unsigned short val_nEqn);
   
   /*!
    * \brief Assigns values to the sparse-matrix structure.
@@ -143,21 +507,40 @@ public:
   void SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDomain, unsigned short val_nVar, unsigned short val_nEq, unsigned long* val_row_ptr, unsigned long* val_col_ind, unsigned long val_nnz, CConfig *config);
   
   /*!
-   * \brief Assigns values to the sparse-matrix structure.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] iPoint - Base point to compute neighbours.
-   * \param[in] deep_level - Deep level for the recursive algorithm.
-   * \param[in] fill_level - ILU fill in level.
-   * \param[in] EdgeConnect - There is (or not) an edge structure).
-   * \param[in] vneighs - Storage the neighbours points to iPoint.
+   * \brief Set the number of threads of the rank that share the row loops of the matrix vector
+   *        product and of the application of the Jacobi and ILU preconditioners. The ILU sweeps
+   *        are then carried out by level sets. Must be called after Initialize, before any
+   *        value is set, as the values are allocated again by the threads (first touch).
+   * \param[in] val_nThreads - Number of threads, including the calling thread.
    */
-  void SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsigned short deep_level, unsigned short fill_level, bool EdgeConnect, vector<unsigned long> & vneighs);
+  void SetThreads(unsigned short val_nThreads);
   
   /*!
    * \brief Sets to zero all the entries of the sparse matrix.
    */
   void SetValZero(void);
   
+  /*!
+   * \brief Freeze or release the entries of the matrix, while frozen the assembly methods (SetValZero,
+   *        Set/Add/Subtract blocks and diagonal values) leave the matrix unchanged.
+   * \param[in] val_frozen - <code>TRUE</code> to keep the current entries.
+   */
+  void SetFrozen(bool val_frozen);
+  
+  /*!
+   * \brief Get whether the entries of the matrix are frozen.
+   * \return <code>TRUE</code> if the matrix (and its preconditioner) are reused from a previous assembly.
+   */
+  bool GetFrozen(void) const;
+  
+  /*!
+   * \brief Add a scaled matrix with the same sparsity pattern, this = this + alpha*B,
+   *        in one sweep over the entries (e.g. the effective matrix K + a0*M of the structural dynamics).
+   * \param[in] alpha - Scaling of the added matrix.
+   * \param[in] B - Matrix built on the same pattern.
+   */
+  void MatrixMatrixAddition(su2double alpha, const CSysMatrix & B);
+  
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -204,6 +587,41 @@ public:
    */
   void SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block);
   
+  /*!
+   * \brief Update the four blocks of an edge, A(i,i) += J_i, A(i,j) += J_j, A(j,i) -= J_i, A(j,j) -= J_j,
+   *        without searching the rows (see SetBlockPointers).
+   * \param[in] iEdge - Edge, of the geometry used to initialize the matrix.
+   * \param[in] iPoint - First node of the edge.
+   * \param[in] jPoint - Second node of the edge.
+   * \param[in] block_i - Jacobian with respect to the first node.
+   * \param[in] block_j - Jacobian with respect to the second node.
+   */
+  void AddEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j);
+  
+  /*!
+   * \brief Update the four blocks of an edge with the opposite sign of AddEdgeBlocks.
+   * \param[in] iEdge - Edge, of the geometry used to initialize the matrix.
+   * \param[in] iPoint - First node of the edge.
+   * \param[in] jPoint - Second node of the edge.
+   * \param[in] block_i - Jacobian with respect to the first node.
+   * \param[in] block_j - Jacobian with respect to the second node.
+   */
+  void SubtractEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j);
+  
+  /*!
+   * \overload
+   * \brief Blocks stored contiguously with a stride between entries, the entry (iVar, jVar)
+   *        is block[(iVar*nVar+jVar)*stride], e.g. one lane of the batches of the numerics.
+   * \param[in] iEdge - Edge, of the geometry used to initialize the matrix.
+   * \param[in] iPoint - First node of the edge.
+   * \param[in] jPoint - Second node of the edge.
+   * \param[in] block_i - Jacobian with respect to the first node.
+   * \param[in] block_j - Jacobian with respect to the second node.
+   * \param[in] stride - Distance between consecutive entries of the blocks.
+   */
+  void AddEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                     const su2double *block_i, const su2double *block_j, unsigned short stride);
+  
   /*!
    * \brief Copies the block (i, j) of the matrix-by-blocks structure in the internal variable *block.
    * \param[in] block_i - Indexes of the block in the matrix-by-blocks structure.
@@ -268,6 +686,16 @@ public:
    */
   void MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product);
   
+#if !defined SINGLE_PRECISION
+  /*!
+   * \brief Performs the product of a single precision block matrix by a vector, used by the mixed precision preconditioners.
+   * \param[in] matrix - Single precision matrix.
+   * \param[in] vector - Vector.
+   * \param[out] product - Result of the product, accumulated in the working precision.
+   */
+  void MatrixVectorProduct(float *matrix, su2double *vector, su2double *product);
+#endif
+  
   /*!
    * \brief Deletes the values of the row i of the sparse matrix.
    * \param[in] i - Index of the row.
@@ -358,19 +786,21 @@ public:
   
   /*!
    * \brief Send receive the solution using MPI.
-   * \param[in] x - Solution..
+   * \param[in] x - Solution, active or passive.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config);
+  template<class ScalarType>
+  void SendReceive_Solution(TCSysVector<ScalarType> & x, CGeometry *geometry, CConfig *config);
   
   /*!
    * \brief Send receive the solution using MPI and the transposed structure of the matrix.
-   * \param[in] x - Solution..
+   * \param[in] x - Solution, active or passive.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] config - Definition of the particular problem.
    */
-  void SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config);
+  template<class ScalarType>
+  void SendReceive_SolutionTransposed(TCSysVector<ScalarType> & x, CGeometry *geometry, CConfig *config);
   
   /*!
    * \brief Performs the product of i-th row of a sparse matrix by a vector.
@@ -406,6 +836,77 @@ public:
    */
   void MatrixVectorProductTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Copy the entries of the matrix to the passive copy, used by the passive products.
+   *        From then on the Jacobi and ILU preconditioners are also copied when they are built.
+   */
+  void BuildPassiveMatrix(void);
+  
+  /*!
+   * \brief Get the memory held by the entries of the matrix (and their passive copy).
+   * \return Number of bytes, the sparsity pattern (shared between matrices) is not included.
+   */
+  unsigned long GetMatrixMemory(void) const;
+  
+  /*!
+   * \brief Get the memory held by the preconditioners built so far (ILU, Jacobi, AMG, linelet),
+   *        including their single precision and passive copies.
+   * \return Number of bytes.
+   */
+  unsigned long GetPreconditionerMemory(void) const;
+  
+  /*!
+   * \brief Get whether the passive copies of the matrix and preconditioners are kept.
+   * \return <code>TRUE</code> for the discrete adjoint (reverse AD) builds, or after BuildPassiveMatrix.
+   */
+  bool GetPassive_Copy(void);
+  
+  /*!
+   * \brief Check whether the passive copy of a preconditioner was built from the current entries of the
+   *        matrix, i.e. after the last SetValZero. The external solves of AD then reuse it.
+   * \param[in] kind_prec - Kind of preconditioner (JACOBI, ILU or ILU_LEVELS).
+   * \return <code>TRUE</code> if the passive copy of the preconditioner is up to date.
+   */
+  bool GetPassive_Preconditioner(unsigned short kind_prec);
+  
+  /*!
+   * \brief Check whether the passive copy of a preconditioner was built from the transposed matrix.
+   * \param[in] kind_prec - Kind of preconditioner (JACOBI, ILU or ILU_LEVELS).
+   * \return <code>TRUE</code> if the preconditioner was built from the transposed matrix.
+   */
+  bool GetPassive_Prec_Transposed(unsigned short kind_prec);
+  
+  /*!
+   * \brief Get the solution of the last external solve of AD, the initial guess of the next one.
+   * \return Reference to the stored passive vector (empty before the first solve).
+   */
+  CSysVectorPassive & GetPassive_Guess(void);
+
+  /*!
+   * \brief Get the space recycled by GCRO-DR between the passive solves with this matrix.
+   * \param[in] transposed - Space of the solves with the transposed matrix.
+   * \return Reference to the stored passive vectors (empty before the first solve).
+   */
+  vector<CSysVectorPassive> & GetPassive_Recycle(bool transposed);
+  
+  /*!
+   * \brief Performs the product of the passive copy of the matrix by a passive vector.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixVectorProduct_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Performs the product of the transposed passive copy of the matrix by a passive vector.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the transposed sparse matrix A.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixVectorProductTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Performs the product of two block matrices.
    */
@@ -461,6 +962,33 @@ public:
    */
   void ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Multiply CSysVector by the transposed Jacobi preconditioner.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeJacobiPreconditionerTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Multiply a passive vector by the passive copy of the Jacobi preconditioner.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeJacobiPreconditioner_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Multiply a passive vector by the transposed passive copy of the Jacobi preconditioner.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeJacobiPreconditionerTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Apply Jacobi as a classical iterative smoother
    * \param[in] b - CSysVector containing the residual (b)
@@ -491,6 +1019,25 @@ public:
    */
   void ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Multiply a passive vector by the passive copy of the ILU preconditioner.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeILUPreconditioner_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Multiply a passive vector by the transposed passive copy of the ILU preconditioner, i.e.
+   *        solve with U^T and L^T. The factors of the matrix serve the transposed system this way.
+   * \param[in] vec - CSysVectorPassive to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeILUPreconditionerTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Apply ILU as a classical iterative smoother
    * \param[in] b - CSysVector containing the residual (b)
@@ -528,6 +1075,58 @@ public:
    */
   unsigned long LU_SGS_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Build (or update with the current values of the matrix) the aggregation AMG preconditioner.
+   *        The aggregation is unsmoothed and each rank coarsens its own rows only, the partitions are
+   *        coupled only through the Krylov iterations, so the iteration counts are not mesh-independent.
+   */
+  void BuildAMGPreconditioner(void);
+  
+  /*!
+   * \brief Multiply CSysVector by the preconditioner, i.e. apply one AMG V-cycle.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Build (or update with the current values of the matrix) the two-stage pressure block preconditioner,
+   *        the AMG hierarchy of the pressure block is built once and reused by the next calls.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildPressureAMGPreconditioner(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Multiply CSysVector by the two-stage preconditioner, one AMG V-cycle on the pressure block
+   *        and ILU on the residual of the coupled system left by the pressure correction.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputePressureAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Build (or update with the current values of the matrix) the restricted additive Schwarz preconditioner,
+   *        the ILU(0) factorization of the local matrix extended by the rows of the halo points of the overlap.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void BuildRASPreconditioner(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Multiply CSysVector by the restricted additive Schwarz preconditioner, solve of the extended
+   *        local problem with the residual of the overlap, of which only the domain points are kept.
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product A*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeRASPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Build the Linelet preconditioner.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -535,6 +1134,13 @@ public:
    */
   unsigned short BuildLineletPreconditioner(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Block LU factorization (Thomas algorithm) of the tridiagonal systems of the linelets,
+   *        carried out once per matrix so that applying the preconditioner only needs the
+   *        forward and backward substitutions. Called by BuildJacobiPreconditioner.
+   */
+  void BuildLineletFactorization(void);
+  
   /*!
    * \brief Multiply CSysVector by the preconditioner
    * \param[in] vec - CSysVector to be multiplied by the preconditioner.
@@ -750,6 +1356,105 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CPressureAMGPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CPressureAMGPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CPressureAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CPressureAMGPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CRASPreconditioner
+ * \brief specialization of preconditioner that uses CSysMatrix class
+ */
+class CRASPreconditioner : public CPreconditioner {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CRASPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CRASPreconditioner() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVector that is being preconditioned
+   * \param[out] v - CSysVector that is the result of the preconditioning
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CLineletPreconditioner
  * \brief specialization of preconditioner that uses CSysMatrix class
@@ -783,4 +1488,202 @@ public:
   void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
+/*!
+ * \class CSysMatrixVectorProductPassive
+ * \brief matrix-vector product with the passive copy of a CSysMatrix
+ */
+class CSysMatrixVectorProductPassive : public CMatrixVectorProductPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the product. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the products
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CSysMatrixVectorProductPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CSysMatrixVectorProductPassive() {}
+  
+  /*!
+   * \brief operator that defines the CSysMatrix-CSysVectorPassive product
+   * \param[in] u - CSysVectorPassive that is being multiplied by the sparse matrix
+   * \param[out] v - CSysVectorPassive that is the result of the product
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
+/*!
+ * \class CSysMatrixVectorProductTransposedPassive
+ * \brief transposed matrix-vector product with the passive copy of a CSysMatrix
+ */
+class CSysMatrixVectorProductTransposedPassive : public CMatrixVectorProductPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the product. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the products
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CSysMatrixVectorProductTransposedPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CSysMatrixVectorProductTransposedPassive() {}
+  
+  /*!
+   * \brief operator that defines the transposed CSysMatrix-CSysVectorPassive product
+   * \param[in] u - CSysVectorPassive that is being multiplied by the transposed sparse matrix
+   * \param[out] v - CSysVectorPassive that is the result of the product
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
+/*!
+ * \class CJacobiPreconditionerPassive
+ * \brief Jacobi preconditioner with the passive copy of a CSysMatrix
+ */
+class CJacobiPreconditionerPassive : public CPreconditionerPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CJacobiPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CJacobiPreconditionerPassive() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVectorPassive that is being preconditioned
+   * \param[out] v - CSysVectorPassive that is the result of the preconditioning
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
+/*!
+ * \class CILUPreconditionerPassive
+ * \brief ILU preconditioner with the passive copy of a CSysMatrix
+ */
+class CILUPreconditionerPassive : public CPreconditionerPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CILUPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CILUPreconditionerPassive() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVectorPassive that is being preconditioned
+   * \param[out] v - CSysVectorPassive that is the result of the preconditioning
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
+/*!
+ * \class CJacobiTransposedPreconditionerPassive
+ * \brief transposed Jacobi preconditioner with the passive copy of a CSysMatrix
+ */
+class CJacobiTransposedPreconditionerPassive : public CPreconditionerPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CJacobiTransposedPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CJacobiTransposedPreconditionerPassive() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVectorPassive that is being preconditioned
+   * \param[out] v - CSysVectorPassive that is the result of the preconditioning
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
+/*!
+ * \class CILUTransposedPreconditionerPassive
+ * \brief transposed ILU preconditioner with the passive copy of a CSysMatrix
+ */
+class CILUTransposedPreconditionerPassive : public CPreconditionerPassive {
+private:
+  CSysMatrix* sparse_matrix; /*!< \brief pointer to matrix that defines the preconditioner. */
+  CGeometry* geometry; /*!< \brief pointer to matrix that defines the geometry. */
+  CConfig* config; /*!< \brief pointer to matrix that defines the config. */
+  
+public:
+  
+  /*!
+   * \brief constructor of the class
+   * \param[in] matrix_ref - matrix reference that will be used to define the preconditioner
+   * \param[in] geometry_ref -
+   * \param[in] config_ref -
+   */
+  CILUTransposedPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref);
+  
+  /*!
+   * \brief destructor of the class
+   */
+  ~CILUTransposedPreconditionerPassive() {}
+  
+  /*!
+   * \brief operator that defines the preconditioner operation
+   * \param[in] u - CSysVectorPassive that is being preconditioned
+   * \param[out] v - CSysVectorPassive that is the result of the preconditioning
+   */
+  void operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const;
+};
+
 #include "matrix_structure.inl"
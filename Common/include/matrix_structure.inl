@@ -37,13 +37,44 @@
  
 #pragma once
 
+inline unsigned long CSysMatrixPattern::GetnNonZero(void) { return nnz; }
+
+inline unsigned long *CSysMatrixPattern::GetRowPtr(void) { return row_ptr; }
+
+inline unsigned long *CSysMatrixPattern::GetColInd(void) { return col_ind; }
+
 inline void CSysMatrix::SetValZero(void) { 
+  if (frozen) return;
+  invM_psv_current = false;
+  ILU_psv_current  = false;
   if(NULL != matrix) {
 	  for (unsigned long index = 0; index < nnz*nVar*nEqn; index++)
 		matrix[index] = 0.0;
   }
 }
 
+inline void CSysMatrix::SetFrozen(bool val_frozen) { frozen = val_frozen; }
+
+inline bool CSysMatrix::GetFrozen(void) const { return frozen; }
+
+inline bool CSysMatrix::GetPassive_Copy(void) { return passive_copy; }
+
+inline bool CSysMatrix::GetPassive_Preconditioner(unsigned short kind_prec) {
+  if (kind_prec == JACOBI) return invM_psv_current;
+  if ((kind_prec == ILU) || (kind_prec == ILU_LEVELS)) return ILU_psv_current;
+  return false;
+}
+
+inline bool CSysMatrix::GetPassive_Prec_Transposed(unsigned short kind_prec) {
+  return (kind_prec == JACOBI)? invM_psv_transposed : ILU_psv_transposed;
+}
+
+inline CSysVectorPassive & CSysMatrix::GetPassive_Guess(void) { return Guess_psv; }
+
+inline vector<CSysVectorPassive> & CSysMatrix::GetPassive_Recycle(bool transposed) {
+  return (transposed)? Recycle_psv_transposed : Recycle_psv;
+}
+
 inline CSysMatrixVectorProduct::CSysMatrixVectorProduct(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
   sparse_matrix = &matrix_ref;
   geometry = geometry_ref;
@@ -134,3 +165,138 @@ inline void CLineletPreconditioner::operator()(const CSysVector & u, CSysVector
   }
   sparse_matrix->ComputeLineletPreconditioner(u, v, geometry, config);
 }
+
+inline CAMGPreconditioner::CAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeAMGPreconditioner(u, v, geometry, config);
+}
+
+inline CPressureAMGPreconditioner::CPressureAMGPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CPressureAMGPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CPressureAMGPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputePressureAMGPreconditioner(u, v, geometry, config);
+}
+
+inline CRASPreconditioner::CRASPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CRASPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CRASPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeRASPreconditioner(u, v, geometry, config);
+}
+
+inline CSysMatrixVectorProductPassive::CSysMatrixVectorProductPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CSysMatrixVectorProductPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CSysMatrixVectorProductPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->MatrixVectorProduct_Passive(u, v, geometry, config);
+}
+
+inline CSysMatrixVectorProductTransposedPassive::CSysMatrixVectorProductTransposedPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CSysMatrixVectorProductTransposedPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CSysMatrixVectorProductTransposedPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->MatrixVectorProductTransposed_Passive(u, v, geometry, config);
+}
+
+inline CJacobiPreconditionerPassive::CJacobiPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CJacobiPreconditionerPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CJacobiPreconditionerPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeJacobiPreconditioner_Passive(u, v, geometry, config);
+}
+
+inline CILUPreconditionerPassive::CILUPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CILUPreconditionerPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CILUPreconditionerPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeILUPreconditioner_Passive(u, v, geometry, config);
+}
+
+inline CJacobiTransposedPreconditionerPassive::CJacobiTransposedPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CJacobiTransposedPreconditionerPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CJacobiTransposedPreconditionerPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeJacobiPreconditionerTransposed_Passive(u, v, geometry, config);
+}
+
+inline CILUTransposedPreconditionerPassive::CILUTransposedPreconditionerPassive(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+inline void CILUTransposedPreconditionerPassive::operator()(const CSysVectorPassive & u, CSysVectorPassive & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CILUTransposedPreconditionerPassive::operator()(const CSysVectorPassive &, CSysVectorPassive &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeILUPreconditionerTransposed_Passive(u, v, geometry, config);
+}
@@ -0,0 +1,115 @@
+/*!
+ * \file memory_pool.hpp
+ * \brief Header of the pool allocator for the many small objects of the geometry and solver.
+ *        The subroutines and functions are in the <i>memory_pool.cpp</i> file.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CMemoryPool
+ * \brief Pool allocator for small objects, which are created and destroyed in large numbers.
+ *        The objects are grouped in size classes of 16 bytes. Each size class hands out the
+ *        objects from chunks of 64 kB, instead of calling the global operator new per object,
+ *        and releases all its chunks at once when its last object is destroyed. Objects
+ *        larger than 1 kB are passed on to the global operator new. The pool is not thread safe.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ */
+class CMemoryPool {
+
+private:
+
+  /*!
+   * \struct CSizeClass
+   * \brief Chunks and free list of the objects of one size class.
+   */
+  struct CSizeClass {
+    vector<char *> chunks;   /*!< \brief Memory chunks of this size class. */
+    void *freeList;          /*!< \brief First free object, each free object stores the next one. */
+    unsigned long nLive;     /*!< \brief Number of objects handed out and not yet released. */
+    CSizeClass(void) : freeList(NULL), nLive(0) {}
+  };
+
+  static const size_t alignment  = 16;        /*!< \brief Granularity (and alignment) of the object sizes. */
+  static const size_t maxSize    = 1024;      /*!< \brief Largest object size handled by the pool. */
+  static const size_t chunkBytes = 64*1024;   /*!< \brief Size of a memory chunk. */
+
+  vector<CSizeClass> sizeClasses;             /*!< \brief The size classes, indexed by size/alignment. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   */
+  CMemoryPool(void);
+
+  /*!
+   * \brief Destructor of the class, releases all chunks.
+   */
+  ~CMemoryPool(void);
+
+  /*!
+   * \brief Allocate the memory of an object.
+   * \param[in] size - Size of the object in bytes.
+   * \return Pointer to the memory of the object.
+   */
+  void *Allocate(size_t size);
+
+  /*!
+   * \brief Release the memory of an object.
+   * \param[in] ptr  - Pointer returned by Allocate.
+   * \param[in] size - Size of the object in bytes, the same as passed to Allocate.
+   */
+  void Deallocate(void *ptr, size_t size);
+
+private:
+
+  /*!
+   * \brief Copy constructor, disabled.
+   */
+  CMemoryPool(const CMemoryPool &other);
+
+  /*!
+   * \brief Assignment operator, disabled.
+   */
+  CMemoryPool& operator=(const CMemoryPool &other);
+};
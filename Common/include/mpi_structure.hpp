@@ -72,9 +72,29 @@ typedef CoDiPackForwardTool<su2double> MediTool;
 #endif // defined CODI_FORWARD_TYPE
 #define AMPI_ADOUBLE ((medi::MpiTypeInterface*)MediTool::MPI_TYPE)
 
+/*--- MPI_DOUBLE is converted to the active type by the Medi wrapper. ---*/
+#define MPI_SU2DOUBLE MPI_DOUBLE
+
+#elif defined SINGLE_PRECISION
+
+class CBaseMPIWrapper;
+typedef CBaseMPIWrapper SU2_MPI;
+
+/*--- Datatype of the su2double buffers, the passive and accumdouble
+ buffers keep MPI_DOUBLE. ---*/
+#define MPI_SU2DOUBLE MPI_FLOAT
+
 #else
 class CBaseMPIWrapper;
 typedef CBaseMPIWrapper SU2_MPI;
+
+#define MPI_SU2DOUBLE MPI_DOUBLE
+
+/*--- The MPI-3 shared memory windows hold plain doubles, they are only
+ available with the default datatype. ---*/
+#if MPI_VERSION >= 3
+#define HAVE_MPI_SHARED_MEMORY
+#endif
 #endif // defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE
 
 /*!
@@ -147,6 +167,16 @@ public:
 
   static void Testall(int count, Request* array_of_requests, int *flag, Status* array_of_statuses);
 
+  static void Send_init(void *buf, int count, Datatype datatype, int dest,
+                        int tag, Comm comm, Request* request);
+
+  static void Recv_init(void *buf, int count, Datatype datatype, int source,
+                        int tag, Comm comm, Request* request);
+
+  static void Startall(int count, Request* array_of_requests);
+
+  static void Request_free(Request *request);
+
   static void Probe(int source, int tag, Comm comm, Status *status);
 
   static void Send(void *buf, int count, Datatype datatype, int dest,
@@ -312,6 +342,12 @@ public:
 #define MPI_MIN 9
 #define MPI_MAX 10
 #define MPI_INT 11
+#define MPI_FLOAT 12
+#if defined SINGLE_PRECISION && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+#define MPI_SU2DOUBLE MPI_FLOAT
+#else
+#define MPI_SU2DOUBLE MPI_DOUBLE
+#endif
 class CBaseMPIWrapper {
   
 public:
@@ -188,6 +188,24 @@ inline void CBaseMPIWrapper::Testall(int count, Request *array_of_requests, int
   MPI_Testall(count,array_of_requests,flag, array_of_statuses);
 }
 
+inline void CBaseMPIWrapper::Send_init(void *buf, int count, Datatype datatype,
+                                   int dest, int tag, Comm comm, Request *request) {
+  MPI_Send_init(buf,count,datatype,dest,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Recv_init(void *buf, int count, Datatype datatype,
+                                   int source, int tag, Comm comm, Request *request) {
+  MPI_Recv_init(buf,count,datatype,source,tag,comm,request);
+}
+
+inline void CBaseMPIWrapper::Startall(int count, Request *array_of_requests) {
+  MPI_Startall(count,array_of_requests);
+}
+
+inline void CBaseMPIWrapper::Request_free(Request *request) {
+  MPI_Request_free(request);
+}
+
 inline void CBaseMPIWrapper::Waitall(int nrequests, Request *request, Status *status) {
   MPI_Waitall(nrequests, request, status);
 }
@@ -602,9 +620,20 @@ inline void CBaseMPIWrapper::Probe(int source, int tag, Comm comm, Status *statu
 inline void CBaseMPIWrapper::CopyData(void *sendbuf, void *recvbuf, int size, Datatype datatype){
   switch (datatype) {
     case MPI_DOUBLE:
+#if defined SINGLE_PRECISION && !(defined CODI_REVERSE_TYPE || defined CODI_FORWARD_TYPE)
+      for (int i = 0; i < size; i++){
+        static_cast<passivedouble*>(recvbuf)[i] = static_cast<passivedouble*>(sendbuf)[i];
+      }
+#else
       for (int i = 0; i < size; i++){
         static_cast<su2double*>(recvbuf)[i] = static_cast<su2double*>(sendbuf)[i];
       }
+#endif
+      break;
+    case MPI_FLOAT:
+      for (int i = 0; i < size; i++){
+        static_cast<float*>(recvbuf)[i] = static_cast<float*>(sendbuf)[i];
+      }
       break;
     case MPI_UNSIGNED_LONG:
       for (int i = 0; i < size; i++){
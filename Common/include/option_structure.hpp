@@ -121,6 +121,7 @@ const unsigned int MAX_TERMS = 6;		         /*!< \brief Maximum number of terms
 const unsigned int MAX_TERMS_FEA = 10;       /*!< \brief Maximum number of terms in the numerical equations (dimension of solver container array). */
 const unsigned int MAX_ZONES = 3;            /*!< \brief Maximum number of zones. */
 const unsigned int MAX_FE_KINDS = 4;            	/*!< \brief Maximum number of Finite Elements. */
+const unsigned short SIMD_WIDTH = 8;          /*!< \brief Number of edges in a batch of the convective numerics. */
 const unsigned int NO_RK_ITER = 0;		       /*!< \brief No Runge-Kutta iteration. */
 
 const unsigned int OVERHEAD = 4; /*!< \brief Overhead space above nMarker when allocating space for boundary elems (MPI + periodic). */
@@ -156,6 +157,50 @@ const unsigned short COMM_TYPE_CHAR           = 5; /*!< \brief Communication typ
 const unsigned short COMM_TYPE_SHORT          = 6; /*!< \brief Communication type for short. */
 const unsigned short COMM_TYPE_INT            = 7; /*!< \brief Communication type for int. */
 
+/*!
+ * \brief Renumbering of the points of each partition.
+ */
+enum ENUM_POINT_ORDERING {
+  RCM_ORDERING = 0,     /*!< \brief Reverse Cuthill-McKee ordering. */
+  HILBERT_ORDERING = 1  /*!< \brief Ordering along a Hilbert space filling curve. */
+};
+static const map<string, ENUM_POINT_ORDERING> Point_Ordering_Map = CCreateMap<string, ENUM_POINT_ORDERING>
+("RCM", RCM_ORDERING)
+("HILBERT", HILBERT_ORDERING);
+
+/*!
+ * \brief Quantities that are exchanged across the SEND_RECEIVE markers with CSolver::InitiateComms/CompleteComms.
+ */
+enum MPI_QUANTITIES {
+  SOLUTION            = 0,  /*!< \brief Solution. */
+  SOLUTION_OLD        = 1,  /*!< \brief Old solution. */
+  UNDIVIDED_LAPLACIAN = 2,  /*!< \brief Undivided Laplacian of the solution. */
+  MAX_EIGENVALUE      = 3,  /*!< \brief Maximum eigenvalue and number of neighbors. */
+  SENSOR              = 4,  /*!< \brief Pressure (dissipation) sensor. */
+  SOLUTION_GRADIENT   = 5,  /*!< \brief Gradient of the solution. */
+  SOLUTION_LIMITER    = 6,  /*!< \brief Limiter of the solution. */
+  PRIMITIVE_GRADIENT  = 7,  /*!< \brief Gradient of the primitive variables. */
+  PRIMITIVE_LIMITER   = 8,  /*!< \brief Limiter of the primitive variables. */
+  PRIMITIVE_GRAD_LIMITER = 9, /*!< \brief Gradient and limiter of the primitive variables (single message). */
+  SOLUTION_EDDY_VISCOSITY = 10, /*!< \brief Solution and eddy viscosity of the turbulence solvers (single message). */
+  UNDIVIDED_LAPLACIAN_SENSOR = 11, /*!< \brief Undivided Laplacian and pressure sensor of the JST scheme (single message). */
+  DELTA_TIME          = 12, /*!< \brief Local time step (multirate time stepping). */
+  RES_SMOOTH          = 13  /*!< \brief Smoothed residual of the implicit residual smoothing. */
+};
+
+/*!
+ * \brief Groups of the functions timed with CConfig::Tick/Tock (compiled with -DPROFILE).
+ */
+enum PROFILE_GROUPS {
+  PROFILE_ITERATION     = 0,  /*!< \brief Iteration and multigrid cycle. */
+  PROFILE_PREPROCESSING = 1,  /*!< \brief Preprocessing of the solvers. */
+  PROFILE_RESIDUAL      = 2,  /*!< \brief Spatial residuals (convective, viscous). */
+  PROFILE_GRADIENT      = 3,  /*!< \brief Gradients and limiters. */
+  PROFILE_COMMS         = 4,  /*!< \brief Point-to-point halo exchanges. */
+  PROFILE_LINEAR_SOLVER = 5,  /*!< \brief Linear solvers. */
+  PROFILE_OUTPUT        = 6   /*!< \brief Output of files and history. */
+};
+
 const unsigned short N_ELEM_TYPES = 7;           /*!< \brief General output & CGNS defines. */
 const unsigned short N_POINTS_LINE = 2;          /*!< \brief General output & CGNS defines. */
 const unsigned short N_POINTS_TRIANGLE = 3;      /*!< \brief General output & CGNS defines. */
@@ -805,6 +850,19 @@ static const map<string, ENUM_MATRIX_COLORING> MatrixColoring_Map = CCreateMap<s
 ("GREEDY_COLORING", GREEDY_COLORING)
 ("NATURAL_COLORING", NATURAL_COLORING);
 
+/*!
+ * \brief types of storage of the non-solution fields of compact restart files
+ */
+enum ENUM_COMPACT_RESTART {
+  COMPACT_DOUBLE      = 0, /*!< \brief Double precision, only the field selection reduces the size. */
+  COMPACT_FLOAT32     = 1, /*!< \brief Single precision. */
+  COMPACT_QUANTIZED16 = 2  /*!< \brief 16 bit integers, uniform quantization between the min/max of each field. */
+};
+static const map<string, ENUM_COMPACT_RESTART> Compact_Restart_Map = CCreateMap<string, ENUM_COMPACT_RESTART>
+("DOUBLE", COMPACT_DOUBLE)
+("FLOAT32", COMPACT_FLOAT32)
+("QUANTIZED_16", COMPACT_QUANTIZED16);
+
 /*!
  * \brief types of slope limiters
  */
@@ -940,13 +998,15 @@ enum ENUM_TIME_INT {
   EULER_EXPLICIT = 2,   	/*!< \brief Explicit Euler time integration definition. */
   EULER_IMPLICIT = 3,   	/*!< \brief Implicit Euler time integration definition. */
   CLASSICAL_RK4_EXPLICIT = 4,   /*!< \brief Classical RK4 time integration definition. */
-  ADER_DG = 5                   /*!< \brief ADER-DG time integration definition. */
+  ADER_DG = 5,                  /*!< \brief ADER-DG time integration definition. */
+  LOW_STORAGE_RK_EXPLICIT = 6   /*!< \brief Five stage, fourth order, 2N-storage Runge-Kutta (Carpenter and Kennedy). */
 };
 static const map<string, ENUM_TIME_INT> Time_Int_Map = CCreateMap<string, ENUM_TIME_INT>
 ("RUNGE-KUTTA_EXPLICIT", RUNGE_KUTTA_EXPLICIT)
 ("EULER_EXPLICIT", EULER_EXPLICIT)
 ("EULER_IMPLICIT", EULER_IMPLICIT)
 ("CLASSICAL_RK4_EXPLICIT", CLASSICAL_RK4_EXPLICIT)
+("LOW_STORAGE_RK_EXPLICIT", LOW_STORAGE_RK_EXPLICIT)
 ("ADER_DG", ADER_DG);
 
 /*!
@@ -1089,12 +1149,14 @@ static const map<string, ENUM_2DFORM> ElasForm_2D = CCreateMap<string, ENUM_2DFO
 enum ENUM_AITKEN {
   NO_RELAXATION = 0,			/*!< \brief No relaxation in the strongly coupled approach. */
   FIXED_PARAMETER = 1,			/*!< \brief Relaxation with a fixed parameter. */
-  AITKEN_DYNAMIC = 2			/*!< \brief Relaxation using Aitken's dynamic parameter. */
+  AITKEN_DYNAMIC = 2,			/*!< \brief Relaxation using Aitken's dynamic parameter. */
+  IQN_ILS = 3			/*!< \brief Interface quasi-Newton with an inverse Jacobian from a least-squares model. */
 };
 static const map<string, ENUM_AITKEN> AitkenForm_Map = CCreateMap<string, ENUM_AITKEN>
 ("NONE", NO_RELAXATION)
 ("FIXED_PARAMETER", FIXED_PARAMETER)
-("AITKEN_DYNAMIC", AITKEN_DYNAMIC);
+("AITKEN_DYNAMIC", AITKEN_DYNAMIC)
+("IQN_ILS", IQN_ILS);
 
 /*!
  * \brief types of dynamic transfer methods
@@ -1544,7 +1606,9 @@ enum ENUM_OUTPUT {
   CSV = 5,			         /*!< \brief Comma-separated values format for the solution output. */
   CGNS_SOL = 6,  	     	 /*!< \brief CGNS format for the solution output. */
   PARAVIEW = 7,  		     /*!< \brief Paraview ASCII format for the solution output. */
-  PARAVIEW_BINARY = 8    /*!< \brief Paraview binary format for the solution output. */
+  PARAVIEW_BINARY = 8,   /*!< \brief Paraview binary format for the solution output. */
+  XDMF = 9,              /*!< \brief XDMF format (XML with raw binary data) for the solution output. */
+  INSITU = 10            /*!< \brief Solution handed to an in-situ adaptor instead of writing files. */
 };
 static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPUT>
 ("TECPLOT", TECPLOT)
@@ -1554,7 +1618,21 @@ static const map<string, ENUM_OUTPUT> Output_Map = CCreateMap<string, ENUM_OUTPU
 ("CSV", CSV)
 ("CGNS", CGNS_SOL)
 ("PARAVIEW", PARAVIEW)
-("PARAVIEW_BINARY", PARAVIEW_BINARY);
+("PARAVIEW_BINARY", PARAVIEW_BINARY)
+("XDMF", XDMF)
+("INSITU", INSITU);
+
+/*!
+ * \brief type of storage of the fields in the visualization files
+ */
+enum ENUM_OUTPUT_PRECISION {
+  OUTPUT_DOUBLE = 1,     /*!< \brief Fields written as 8 byte floating point values. */
+  OUTPUT_SINGLE = 2,     /*!< \brief Fields written as 4 byte floating point values. */
+  OUTPUT_QUANTIZED = 3   /*!< \brief Fields written as 1 or 2 byte integers, scaled between the extrema of the field. */
+};
+static const map<string, ENUM_OUTPUT_PRECISION> Output_Precision_Map = CCreateMap<string, ENUM_OUTPUT_PRECISION>
+("DOUBLE", OUTPUT_DOUBLE)
+("SINGLE", OUTPUT_SINGLE);
 
 /*!
  * \brief type of volume sensitivity file formats (inout to SU2_DOT)
@@ -1727,7 +1805,10 @@ enum ENUM_LINEAR_SOLVER {
   SMOOTHER_LUSGS = 8,  /*!< \brief LU_SGS smoother. */
   SMOOTHER_JACOBI = 9,  /*!< \brief Jacobi smoother. */
   SMOOTHER_ILU = 10,  /*!< \brief ILU smoother. */
-  SMOOTHER_LINELET = 11  /*!< \brief Linelet smoother. */
+  SMOOTHER_LINELET = 11,  /*!< \brief Linelet smoother. */
+  FGMRES_CGS = 12,  /*!< \brief FGMRES with classical Gram-Schmidt, one global reduction per iteration. */
+  RESTARTED_FGMRES_CGS = 13,  /*!< \brief FGMRES with classical Gram-Schmidt and restart. */
+  GCRO_DR = 14  /*!< \brief Restarted FGMRES recycling a deflation space from one solve to the next (GCRO-DR). */
 };
 static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<string, ENUM_LINEAR_SOLVER>
 ("STEEPEST_DESCENT", STEEPEST_DESCENT)
@@ -1740,7 +1821,10 @@ static const map<string, ENUM_LINEAR_SOLVER> Linear_Solver_Map = CCreateMap<stri
 ("SMOOTHER_LUSGS", SMOOTHER_LUSGS)
 ("SMOOTHER_JACOBI", SMOOTHER_JACOBI)
 ("SMOOTHER_LINELET", SMOOTHER_LINELET)
-("SMOOTHER_ILU", SMOOTHER_ILU);
+("SMOOTHER_ILU", SMOOTHER_ILU)
+("FGMRES_CGS", FGMRES_CGS)
+("RESTARTED_FGMRES_CGS", RESTARTED_FGMRES_CGS)
+("GCRO_DR", GCRO_DR);
 
 /*!
  * \brief types surface continuity at the intersection with the FFD
@@ -1792,13 +1876,21 @@ enum ENUM_LINEAR_SOLVER_PREC {
   JACOBI = 1,		/*!< \brief Jacobi preconditioner. */
   LU_SGS = 2,		/*!< \brief LU SGS preconditioner. */
   LINELET = 3,  /*!< \brief Line implicit preconditioner. */
-  ILU = 4       /*!< \brief ILU(0) preconditioner. */
+  ILU = 4,      /*!< \brief ILU(0) preconditioner. */
+  ILU_LEVELS = 5, /*!< \brief ILU(0) preconditioner, factorization and sweeps ordered by level sets. */
+  AMG = 6,      /*!< \brief Unsmoothed aggregation algebraic multigrid preconditioner, per partition (no coarse level across ranks). */
+  PRESSURE_AMG = 7,  /*!< \brief Two-stage preconditioner, AMG on the pressure block followed by ILU on the coupled system. */
+  RAS = 8       /*!< \brief Restricted additive Schwarz, ILU(0) of the partition extended by an overlap. */
 };
 static const map<string, ENUM_LINEAR_SOLVER_PREC> Linear_Solver_Prec_Map = CCreateMap<string, ENUM_LINEAR_SOLVER_PREC>
 ("JACOBI", JACOBI)
 ("LU_SGS", LU_SGS)
 ("LINELET", LINELET)
-("ILU", ILU);
+("ILU", ILU)
+("ILU_LEVELS", ILU_LEVELS)
+("AMG", AMG)
+("PRESSURE_AMG", PRESSURE_AMG)
+("RAS", RAS);
 
 /*!
  * \brief types of analytic definitions for various geometries
@@ -1863,6 +1955,30 @@ static const map<string, ENUM_CONVERGE_CRIT> Converge_Crit_Map = CCreateMap<stri
 ("CAUCHY", CAUCHY)
 ("RESIDUAL", RESIDUAL);
 
+/*!
+ * \brief types of volumetric mesh deformation
+ */
+enum ENUM_DEFORM_METHOD {
+  FEA_DEFORMATION = 0,    /*!< \brief Linear elasticity equations solved with the finite element method. */
+  RBF_DEFORMATION = 1     /*!< \brief Radial basis function interpolation of the surface displacements. */
+};
+static const map<string, ENUM_DEFORM_METHOD> Deform_Method_Map = CCreateMap<string, ENUM_DEFORM_METHOD>
+("ELASTICITY", FEA_DEFORMATION)
+("RBF", RBF_DEFORMATION);
+
+/*!
+ * \brief types of reuse of the linear system of the FEA mesh deformation
+ */
+enum ENUM_DEFORM_REUSE {
+  NO_REUSE = 0,               /*!< \brief Build the stiffness matrix and the preconditioner for every increment. */
+  REUSE_PRECONDITIONER = 1,   /*!< \brief Keep the preconditioner, the stiffness matrix is built for every increment. */
+  REUSE_STIFFNESS = 2         /*!< \brief Keep the stiffness matrix and the preconditioner. */
+};
+static const map<string, ENUM_DEFORM_REUSE> Deform_Reuse_Map = CCreateMap<string, ENUM_DEFORM_REUSE>
+("NONE", NO_REUSE)
+("PRECONDITIONER", REUSE_PRECONDITIONER)
+("STIFFNESS_MATRIX", REUSE_STIFFNESS);
+
 /*!
  * \brief types of element stiffnesses imposed for FEA mesh deformation
  */
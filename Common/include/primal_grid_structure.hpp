@@ -96,6 +96,19 @@ public:
 	 */
 	virtual ~CPrimalGrid(void);
 
+	/*!
+	 * \brief Allocate the object from the pool of the primal grid objects.
+	 * \param[in] size - Size of the (derived) object in bytes.
+	 */
+	static void *operator new(size_t size);
+	
+	/*!
+	 * \brief Return the memory of the object to the pool of the primal grid objects.
+	 * \param[in] ptr  - Pointer to the object.
+	 * \param[in] size - Size of the (derived) object in bytes.
+	 */
+	static void operator delete(void *ptr, size_t size);
+
   /*!
    * \brief Get the elements that surround an element.
    * \param[in] val_face - Local index of the face.
@@ -0,0 +1,143 @@
+/*!
+ * \file reproducible_sum.hpp
+ * \brief Headers of the exact, order independent sums used for the reproducible
+ *        parallel reductions. The functions are in the <i>reproducible_sum.cpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+
+#include <cmath>
+#include <cfloat>
+#include <vector>
+
+using namespace std;
+
+/*!
+ * \class CReproducibleSum
+ * \brief Exact sums of double precision values (REPRODUCIBLE_REDUCTIONS= YES).
+ * \details Each value is stored as a fixed point number with 32 bit digits that covers
+ *          the whole range of the doubles (Kulisch accumulator). The digits are integers,
+ *          so the local additions and the MPI reduction are exact, and the result is only
+ *          rounded once, when it is converted back to double. It is therefore independent
+ *          of the order of the additions, of the partitioning and of the number of ranks.
+ * \author SU2 contributors
+ */
+class CReproducibleSum {
+private:
+  static bool Active;                  /*!< \brief Reproducible reductions requested in the config. */
+  static const unsigned short nDigit = 70;        /*!< \brief Number of 32 bit digits of one sum. */
+  static const int Exp_Offset = 1126;             /*!< \brief Digit 0, bit 0 has the weight 2^-Exp_Offset. */
+  static const unsigned long nAdd_Carry = 536870912; /*!< \brief Additions between normalizations, 2^29. */
+  
+  unsigned long nSum;                  /*!< \brief Number of independent sums. */
+  vector<long long> Digit;             /*!< \brief Digits of the sums, nDigit per sum. */
+  vector<passivedouble> NonFinite;     /*!< \brief Sum of the inf/nan values, they can not be stored in the digits. */
+  vector<unsigned long> nAdd;          /*!< \brief Additions since the last normalization, per sum. */
+  
+  /*!
+   * \brief Propagate the carries, digits 0 to nDigit-2 end up in [0, 2^32) and the last one holds the sign.
+   * \param[in] digit - Pointer to the nDigit digits of one sum.
+   */
+  static void Normalize(long long *digit);
+  
+  /*!
+   * \brief Round a sum to the nearest double.
+   * \param[in] digit - Pointer to the nDigit digits of one sum (modified).
+   * \param[in] nonfinite - Sum of the inf/nan values.
+   * \return Value of the sum.
+   */
+  static passivedouble Round(long long *digit, passivedouble nonfinite);
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_nSum - Number of independent sums.
+   */
+  CReproducibleSum(unsigned long val_nSum = 1);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CReproducibleSum(void);
+  
+  /*!
+   * \brief Enable or disable the reproducible reductions.
+   * \param[in] val_active - <code>TRUE</code> to use the exact sums.
+   */
+  static void SetActive(bool val_active);
+  
+  /*!
+   * \brief Get if the reproducible reductions are enabled.
+   * \return <code>TRUE</code> if the exact sums are used.
+   */
+  static bool GetActive(void);
+  
+  /*!
+   * \brief Set all the sums to zero.
+   */
+  void Reset(void);
+  
+  /*!
+   * \brief Set one sum to zero.
+   * \param[in] iSum - Index of the sum.
+   */
+  void Reset(unsigned long iSum);
+  
+  /*!
+   * \brief Add a value to one of the sums, exactly.
+   * \param[in] iSum - Index of the sum.
+   * \param[in] val - Value to be added.
+   */
+  void Add(unsigned long iSum, passivedouble val);
+  
+  /*!
+   * \brief Get the local value of one sum, rounded to double.
+   * \param[in] iSum - Index of the sum.
+   * \return Value of the sum on this rank.
+   */
+  passivedouble GetSum(unsigned long iSum);
+  
+  /*!
+   * \brief Sum over all ranks of every sum, rounded to double.
+   * \param[out] val_sum - Global values of the nSum sums.
+   */
+  void AllReduce(passivedouble *val_sum);
+  
+};
+
+#include "reproducible_sum.inl"
@@ -0,0 +1,84 @@
+/*!
+ * \file reproducible_sum.inl
+ * \brief Inline subroutines of the <i>reproducible_sum.hpp</i> file.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+inline void CReproducibleSum::SetActive(bool val_active) { Active = val_active; }
+
+inline bool CReproducibleSum::GetActive(void) { return Active; }
+
+inline void CReproducibleSum::Add(unsigned long iSum, passivedouble val) {
+  
+  if (val == 0.0) return;
+  
+  /*--- inf and nan can not be represented by the digits ---*/
+  
+  if (!(fabs(val) <= DBL_MAX)) { NonFinite[iSum] += val; return; }
+  
+  /*--- val = mantissa*2^(exponent-53), with an integer mantissa of at most
+   53 bits, i.e. the bit shift of the mantissa in the accumulator is positive
+   for all the doubles, subnormals included. ---*/
+  
+  int exponent;
+  const passivedouble fraction = frexp(val, &exponent);
+  const long long mantissa = (long long)ldexp(fraction, 53);
+  const unsigned long long magnitude = (mantissa < 0)? -mantissa : mantissa;
+  const long long sign = (mantissa < 0)? -1 : 1;
+  
+  const int shift = exponent - 53 + Exp_Offset;
+  const unsigned short iDigit = shift/32, bit = shift%32;
+  
+  /*--- The shifted mantissa spans three digits, the low and high halves of the
+   mantissa are shifted separately to stay within 64 bits. ---*/
+  
+  const unsigned long long low  = (magnitude & 0xFFFFFFFFULL) << bit;
+  const unsigned long long high = (magnitude >> 32) << bit;
+  
+  long long *digit = &Digit[iSum*nDigit + iDigit];
+  digit[0] += sign*(long long)(low & 0xFFFFFFFFULL);
+  digit[1] += sign*(long long)((low >> 32) + (high & 0xFFFFFFFFULL));
+  digit[2] += sign*(long long)(high >> 32);
+  
+  /*--- Each addition changes a digit by less than 2^33, normalize before
+   the 64 bit digits can overflow ---*/
+  
+  if (++nAdd[iSum] == nAdd_Carry) {
+    Normalize(&Digit[iSum*nDigit]);
+    nAdd[iSum] = 0;
+  }
+  
+}
@@ -0,0 +1,244 @@
+/*!
+ * \file task_thread_pool.hpp
+ * \brief Header of the thread pool, which carries out chunks of the tasks of the SU2 solvers and matrices.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "./mpi_structure.hpp"
+
+#ifdef HAVE_PTHREAD
+  #include <pthread.h>
+  #include <sched.h>
+  #include <unistd.h>
+#endif
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+/* The threads can only be bound to CPUs with the extensions of glibc. */
+#if defined(HAVE_PTHREAD) && defined(__linux__)
+  #define HAVE_THREAD_AFFINITY
+#endif
+
+using namespace std;
+
+/*!
+ * \struct CTaskChunk
+ * \brief Range of elements or faces of a task, which is carried out by one thread.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ */
+struct CTaskChunk {
+  int           indTask;  /*!< \brief Index of the task in the tasks list of the solver. */
+  unsigned long indBeg;   /*!< \brief Start index of the range of this chunk. */
+  unsigned long indEnd;   /*!< \brief End index (not included) of the range of this chunk. */
+};
+
+/*!
+ * \class CTaskThreadPool
+ * \brief Pool of threads with work stealing, which carries out the chunks of the
+          tasks of a solver.
+ * \details Every thread, including the calling thread which has index 0, owns a
+            queue of chunks. A thread takes the chunks from the back of its own queue
+            and, when it is empty, steals chunks from the front of the queues of the
+            other threads. The calling thread launches the tasks and must be the only
+            one that calls MPI, hence MPI_THREAD_FUNNELED is sufficient.
+            When the launcher bound the rank to a subset of the CPUs of the node,
+            the worker threads are bound to the CPUs of this subset, one each.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ */
+class CTaskThreadPool {
+
+public:
+
+  /*!
+   * \brief Type of the function that carries out a chunk of a task.
+   */
+  typedef void (*TaskChunkFunction)(void *owner, const CTaskChunk &chunk);
+
+private:
+
+  /*!
+   * \brief Data passed to a worker thread when it is started.
+   */
+  struct CWorkerData {
+    CTaskThreadPool *pool;    /*!< \brief The pool to which the thread belongs. */
+    unsigned short  iThread;  /*!< \brief Index of the thread in the pool. */
+  };
+
+  unsigned short nThreads;          /*!< \brief Number of threads, including the calling thread. */
+  TaskChunkFunction chunkFunction;  /*!< \brief Function that carries out a chunk. */
+  void *owner;                      /*!< \brief Object passed to chunkFunction, typically the solver. */
+
+  vector<deque<CTaskChunk> > queues;     /*!< \brief Queues of chunks of every thread. */
+  vector<unsigned long> nChunksLeft;     /*!< \brief Number of chunks of every task that are not completed yet. */
+  unsigned long nChunksQueued;           /*!< \brief Total number of chunks in the queues. */
+  unsigned long nextQueue;               /*!< \brief Queue in which the next chunk is stored. */
+  vector<int> threadCPU;                 /*!< \brief CPU to which every thread is bound, -1 if it is not bound. */
+
+  static bool affinityReported;          /*!< \brief Whether or not the placement of the threads was reported. */
+
+#ifdef HAVE_PTHREAD
+  bool shutDown;                         /*!< \brief Whether or not the worker threads must terminate. */
+  vector<pthread_t> threads;             /*!< \brief The worker threads that were started. */
+  vector<CWorkerData> workerData;        /*!< \brief Data of every worker thread. */
+  pthread_key_t threadIndexKey;          /*!< \brief Key to retrieve the index of the thread. */
+  pthread_mutex_t *queueMutex;           /*!< \brief Mutex of the queue of every thread. */
+  pthread_mutex_t poolMutex;             /*!< \brief Mutex of the counters and of the sleeping threads. */
+  pthread_cond_t  poolCond;              /*!< \brief Condition signaled when chunks have been queued. */
+#endif
+
+public:
+
+  /*!
+   * \brief Constructor of the class, which starts the worker threads. The first pool
+            with more than one thread reports the placement of the threads, hence it must
+            be constructed by all ranks.
+   * \param[in] val_nThreads  - Desired number of threads, including the calling thread.
+   * \param[in] val_function  - Function that carries out a chunk.
+   * \param[in] val_owner     - Object passed to val_function.
+   */
+  CTaskThreadPool(unsigned short    val_nThreads,
+                  TaskChunkFunction val_function,
+                  void              *val_owner);
+
+  /*!
+   * \brief Destructor of the class, which terminates the worker threads.
+   */
+  ~CTaskThreadPool(void);
+
+  /*!
+   * \brief Get the number of threads in the pool, including the calling thread.
+   * \return Number of threads.
+   */
+  unsigned short GetnThreads(void) const;
+
+  /*!
+   * \brief Get the index in the pool of the thread from which this function is called.
+   * \return Index of the thread, 0 for the calling thread.
+   */
+  unsigned short GetThreadIndex(void) const;
+
+  /*!
+   * \brief Reset the chunk counters of the tasks. Must be called by the calling thread
+            when no chunks are in progress.
+   * \param[in] val_nTasks - Number of tasks in the tasks list.
+   */
+  void ResetTasks(const unsigned long val_nTasks);
+
+  /*!
+   * \brief Launch a task, i.e. distribute its chunks over the queues of the threads.
+   * \param[in] indTask - Index of the task to be launched.
+   * \param[in] bounds  - Bounds of the chunks, i.e. chunk i is [bounds[i], bounds[i+1]).
+   */
+  void LaunchTask(const int                    indTask,
+                  const vector<unsigned long> &bounds);
+
+  /*!
+   * \brief Determine whether or not all chunks of a launched task have been completed.
+   * \param[in] indTask - Index of the task.
+   * \return True if all chunks have been completed.
+   */
+  bool TaskCompleted(const int indTask);
+
+  /*!
+   * \brief Carry out one chunk of the queue of the calling thread or, if this queue
+            is empty, one chunk stolen from another thread.
+   * \return True if a chunk was carried out, false if all queues were empty.
+   */
+  bool RunChunk(void);
+
+private:
+
+  /*!
+   * \brief Take a chunk from the own queue or steal one from the queue of another thread.
+   * \param[in]  iThread - Index of the thread that takes the chunk.
+   * \param[out] chunk   - The chunk taken.
+   * \return True if a chunk was found.
+   */
+  bool TakeChunk(const unsigned short iThread,
+                 CTaskChunk           &chunk);
+
+  /*!
+   * \brief Carry out a chunk and register its completion.
+   * \param[in] chunk - The chunk to be carried out.
+   */
+  void ExecuteChunk(const CTaskChunk &chunk);
+
+  /*!
+   * \brief Determine the CPUs to which the worker threads are bound. They are only bound
+            when the rank is bound to fewer CPUs than the node has, and to at least as many
+            CPUs as there are threads. Otherwise ranks that are not bound would bind their
+            threads to the same CPUs.
+   */
+  void SetThreadCPUs(void);
+
+  /*!
+   * \brief Write the host and the CPUs of the threads of every rank, gathered on the
+            master rank. Must be called by all ranks.
+   */
+  void ReportAffinity(void) const;
+
+#ifdef HAVE_PTHREAD
+  /*!
+   * \brief Main loop of a worker thread, which carries out chunks until the pool is destructed.
+   * \param[in] iThread - Index of the worker thread.
+   */
+  void WorkerLoop(const unsigned short iThread);
+
+  /*!
+   * \brief Start function of the worker threads.
+   * \param[in] data - Pointer to the CWorkerData of the thread.
+   */
+  static void *WorkerThread(void *data);
+#endif
+
+  /*!
+   * \brief Copy constructor, which is not allowed.
+   */
+  CTaskThreadPool(const CTaskThreadPool &other);
+
+  /*!
+   * \brief Assignment operator, which is not allowed.
+   */
+  CTaskThreadPool& operator=(const CTaskThreadPool &other);
+};
+
+#include "task_thread_pool.inl"
@@ -51,7 +51,7 @@
 using namespace std;
 
 /*!
- * \class CSysVector
+ * \class TCSysVector
  * \brief Class for holding and manipulating vectors needed by linear solvers
  * \author J. Hicken.
  *
@@ -59,8 +59,13 @@ using namespace std;
  * more flexibility with the underlying data (e.g. we may decide to
  * use a block storage scheme rather than a continuous storage
  * scheme).
+ *
+ * The template argument is the type of the elements. The vectors of the
+ * solvers are active (su2double), the passive (passivedouble) vectors are
+ * used by the linear solves that are external functions of the AD tape.
  */
-class CSysVector {
+template<class ScalarType>
+class TCSysVector {
   
 private:
 	unsigned long nElm; /*!< \brief total number of elements (or number elements on this processor) */
@@ -71,21 +76,21 @@ private:
 	unsigned short nVar; /*!< \brief number of elements in a block */
 	unsigned long nBlk; /*!< \brief number of blocks (or number of blocks on this processor) */
 	unsigned long nBlkDomain; /*!< \brief number of blocks (or number of blocks on this processor without Ghost cells) */
-  su2double* vec_val; /*!< \brief storage for the element values */
+  ScalarType* vec_val; /*!< \brief storage for the element values */
   
 public:
   
   /*!
    * \brief default constructor of the class.
    */
-  CSysVector(void);
+  TCSysVector(void);
   
   /*!
    * \brief constructor of the class.
    * \param[in] size - number of elements locally
    * \param[in] val - default value for elements
    */
-  CSysVector(const unsigned long & size, const su2double & val = 0.0);
+  TCSysVector(const unsigned long & size, const ScalarType & val = 0.0);
   
   /*!
    * \brief constructor of the class.
@@ -94,13 +99,19 @@ public:
    * \param[in] numVar - number of variables in each block
    * \param[in] val - default value for elements
    */
-  CSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const su2double & val = 0.0);
+  TCSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const ScalarType & val = 0.0);
   
   /*!
    * \brief copy constructor of the class.
-   * \param[in] u - CSysVector that is being copied
+   * \param[in] u - TCSysVector that is being copied
+   */
+  TCSysVector(const TCSysVector & u);
+  
+  /*!
+   * \brief move constructor of the class, takes over the storage of u.
+   * \param[in] u - TCSysVector that is being moved, it is left empty
    */
-  CSysVector(const CSysVector & u);
+  TCSysVector(TCSysVector && u) noexcept;
   
   /*!
 	 * \brief Sets to zero all the entries of the vector.
@@ -112,7 +123,7 @@ public:
    * \param[in] size - number of elements locally
    * \param[in] u_array - vector stored as array being copied
    */
-  explicit CSysVector(const unsigned long & size, const su2double* u_array);
+  explicit TCSysVector(const unsigned long & size, const ScalarType* u_array);
   
   /*!
    * \brief constructor from array
@@ -121,13 +132,13 @@ public:
    * \param[in] numVar - number of variables in each block
    * \param[in] u_array - vector stored as array being copied
    */
-  explicit CSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
-                      const su2double* u_array);
+  explicit TCSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
+                      const ScalarType* u_array);
   
   /*!
    * \brief class destructor
    */
-  virtual ~CSysVector();
+  virtual ~TCSysVector();
   
   /*!
    * \brief Initialize the class.
@@ -136,15 +147,15 @@ public:
    * \param[in] numVar - number of variables in each block
    * \param[in] val - default value for elements
    */
-  void Initialize(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const su2double & val = 0.0);
+  void Initialize(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const ScalarType & val = 0.0);
   
   /*!
-   * \brief return the number of local elements in the CSysVector
+   * \brief return the number of local elements in the TCSysVector
    */
   unsigned long GetLocSize() const;
   
   /*!
-   * \brief return the size of the CSysVector (over all processors)
+   * \brief return the size of the TCSysVector (over all processors)
    */
   unsigned long GetSize() const;
   
@@ -164,133 +175,158 @@ public:
   unsigned long GetNBlkDomain() const;
   
   /*!
-   * \brief set calling CSysVector to scaling of another CSysVector
+   * \brief set calling TCSysVector to scaling of another TCSysVector
    * \param[in] a - scalar factor for x
-   * \param[in] x - CSysVector that is being scaled
+   * \param[in] x - TCSysVector that is being scaled
    */
-  void Equals_AX(const su2double & a, CSysVector & x);
+  void Equals_AX(const ScalarType & a, TCSysVector & x);
   
   /*!
-   * \brief adds a scaled CSysVector to calling CSysVector
+   * \brief adds a scaled TCSysVector to calling TCSysVector
    * \param[in] a - scalar factor for x
-   * \param[in] x - CSysVector that is being scaled
+   * \param[in] x - TCSysVector that is being scaled
    */
-  void Plus_AX(const su2double & a, CSysVector & x);
+  void Plus_AX(const ScalarType & a, TCSysVector & x);
   
   /*!
-   * \brief general linear combination of two CSysVectors
+   * \brief general linear combination of two TCSysVectors
    * \param[in] a - scalar factor for x
-   * \param[in] x - first CSysVector in linear combination
+   * \param[in] x - first TCSysVector in linear combination
    * \param[in] b - scalar factor for y
-   * \param[in] y - second CSysVector in linear combination
+   * \param[in] y - second TCSysVector in linear combination
    */
-  void Equals_AX_Plus_BY(const su2double & a, CSysVector & x, const su2double & b, CSysVector & y);
+  void Equals_AX_Plus_BY(const ScalarType & a, TCSysVector & x, const ScalarType & b, TCSysVector & y);
+  
+  /*!
+   * \brief adds two scaled TCSysVectors to calling TCSysVector, in one pass
+   * \param[in] a - scalar factor for x
+   * \param[in] x - first TCSysVector in linear combination
+   * \param[in] b - scalar factor for y
+   * \param[in] y - second TCSysVector in linear combination
+   */
+  void Plus_AX_Plus_BY(const ScalarType & a, const TCSysVector & x, const ScalarType & b, const TCSysVector & y);
+  
+  /*!
+   * \brief adds a linear combination of several TCSysVectors to calling TCSysVector, in one pass
+   * \param[in] nVec - number of TCSysVectors in the combination, the first nVec of x are used
+   * \param[in] a - scalar factors of the TCSysVectors
+   * \param[in] x - list of TCSysVectors
+   */
+  void Plus_AX(unsigned long nVec, const ScalarType *a, const vector<TCSysVector> & x);
+  
+  /*!
+   * \brief adds a scaled TCSysVector to calling TCSysVector and computes the L2 norm
+   *        of the result in the same pass
+   * \param[in] a - scalar factor for x
+   * \param[in] x - TCSysVector that is being scaled
+   * \result the L2 norm of the updated TCSysVector
+   */
+  ScalarType Plus_AX_Norm(const ScalarType & a, const TCSysVector & x);
   
   /*!
    * \brief assignment operator with deep copy
-   * \param[in] u - CSysVector whose values are being assigned
+   * \param[in] u - TCSysVector whose values are being assigned
    */
-  CSysVector & operator=(const CSysVector & u);
+  TCSysVector & operator=(const TCSysVector & u);
   
   /*!
-   * \brief CSysVector=su2double assignment operator
-   * \param[in] val - value assigned to each element of CSysVector
+   * \brief move assignment operator, takes over the storage of u
+   * \param[in] u - TCSysVector that is being moved, it is left empty
    */
-  CSysVector & operator=(const su2double & val);
+  TCSysVector & operator=(TCSysVector && u) noexcept;
+  
+  /*!
+   * \brief TCSysVector=ScalarType assignment operator
+   * \param[in] val - value assigned to each element of TCSysVector
+   */
+  TCSysVector & operator=(const ScalarType & val);
   
   /*!
    * \brief addition operator
-   * \param[in] u - CSysVector being added to *this
+   * \param[in] u - TCSysVector being added to *this
    */
-  CSysVector operator+(const CSysVector & u) const;
+  TCSysVector operator+(const TCSysVector & u) const;
   
   /*!
    * \brief compound addition-assignment operator
-   * \param[in] u - CSysVector being added to calling object
+   * \param[in] u - TCSysVector being added to calling object
    */
-  CSysVector & operator+=(const CSysVector & u);
+  TCSysVector & operator+=(const TCSysVector & u);
   
   /*!
    * \brief subtraction operator
-   * \param[in] u - CSysVector being subtracted from *this
+   * \param[in] u - TCSysVector being subtracted from *this
    */
-  CSysVector operator-(const CSysVector & u) const;
+  TCSysVector operator-(const TCSysVector & u) const;
   
   /*!
    * \brief compound subtraction-assignment operator
-   * \param[in] u - CSysVector being subtracted from calling object
+   * \param[in] u - TCSysVector being subtracted from calling object
    */
-  CSysVector & operator-=(const CSysVector & u);
+  TCSysVector & operator-=(const TCSysVector & u);
   
   /*!
    * \brief vector * scalar multiplication operator
    * \param[in] val - value to multiply *this by
    */
-  CSysVector operator*(const su2double & val) const;
-  
-  /*!
-   * \brief scalar * vector multiplication operator
-   * \param[in] val - scalar value to multiply by
-   * \param[in] u - CSysVector having its elements scaled
-   */
-  friend CSysVector operator*(const su2double & val, const CSysVector & u);
+  TCSysVector operator*(const ScalarType & val) const;
   
   /*!
    * \brief compound scalar multiplication-assignment operator
    * \param[in] val - value to multiply calling object by
    */
-  CSysVector & operator*=(const su2double & val);
+  TCSysVector & operator*=(const ScalarType & val);
   
   /*!
    * \brief vector-scalar division operator (no scalar/vector operator)
    * \param[in] val - value to divide elements of *this by
    */
-  CSysVector operator/(const su2double & val) const;
+  TCSysVector operator/(const ScalarType & val) const;
   
   /*!
    * \brief compound scalar division-assignment operator
    * \param[in] val - value to divide elements of calling object by
    */
-  CSysVector & operator/=(const su2double & val);
+  TCSysVector & operator/=(const ScalarType & val);
   
   /*!
    * \brief indexing operator with assignment permitted
    * \param[in] i = local index to access
    */
-  su2double & operator[](const unsigned long & i);
+  ScalarType & operator[](const unsigned long & i);
   
   /*!
    * \brief indexing operator with assignment not permitted
    * \param[in] i = local index to access
    */
-  const su2double & operator[](const unsigned long & i) const;
+  const ScalarType & operator[](const unsigned long & i) const;
     
   /*!
-   * \brief the L2 norm of the CSysVector
+   * \brief the L2 norm of the TCSysVector
    * \result the L2 norm
    */
-  su2double norm() const;
+  ScalarType norm() const;
   
   /*!
-   * \brief copies the contents of the calling CSysVector into an array
+   * \brief copies the contents of the calling TCSysVector into an array
    * \param[out] u_array - array into which information is being copied
-   * \pre u_array must be allocated and have the same size as CSysVector
+   * \pre u_array must be allocated and have the same size as TCSysVector
    */
-  void CopyToArray(su2double* u_array);
+  void CopyToArray(ScalarType* u_array);
   
   /*!
 	 * \brief Subtract val_residual to the residual.
 	 * \param[in] val_ipoint - index of the point where subtract the residual.
    * \param[in] val_residual - Value to subtract to the residual.
 	 */
-  void SubtractBlock(unsigned long val_ipoint, su2double *val_residual);
+  void SubtractBlock(unsigned long val_ipoint, ScalarType *val_residual);
   
   /*!
 	 * \brief Add val_residual to the residual.
 	 * \param[in] val_ipoint - index of the point where add the residual.
    * \param[in] val_residual - Value to add to the residual.
 	 */
-  void AddBlock(unsigned long val_ipoint, su2double *val_residual);
+  void AddBlock(unsigned long val_ipoint, ScalarType *val_residual);
   
   /*!
 	 * \brief Set val_residual to the residual.
@@ -298,14 +334,14 @@ public:
    * \param[in] val_var - inde of the residual to be set.
    * \param[in] val_residual - Value to set to the residual.
 	 */
-  void SetBlock(unsigned long val_ipoint, unsigned short val_var, su2double val_residual);
+  void SetBlock(unsigned long val_ipoint, unsigned short val_var, ScalarType val_residual);
   
   /*!
 	 * \brief Set val_residual to the residual.
 	 * \param[in] val_ipoint - index of the point where set the residual.
    * \param[in] val_residual - Value to set to the residual.
 	 */
-  void SetBlock(unsigned long val_ipoint, su2double *val_residual);
+  void SetBlock(unsigned long val_ipoint, ScalarType *val_residual);
   
   /*!
 	 * \brief Set the residual to zero.
@@ -325,7 +361,7 @@ public:
 	 * \param[in] val_ipoint - index of the point where set the residual.
    * \return Pointer to the residual.
 	 */
-  su2double *GetBlock(unsigned long val_ipoint);
+  ScalarType *GetBlock(unsigned long val_ipoint);
 	
   /*!
 	 * \brief Get the value of the residual.
@@ -333,20 +369,62 @@ public:
    * \param[in] val_var - inde of the residual to be set.
    * \return Value of the residual.
 	 */
-  su2double GetBlock(unsigned long val_ipoint, unsigned short val_var);
+  ScalarType GetBlock(unsigned long val_ipoint, unsigned short val_var);
   
+  /*--- The dot products read the storage directly ---*/
   
-  /*!
-   * \brief dot-product between two CSysVectors
-   * \param[in] u - first CSysVector in dot product
-   * \param[in] v - second CSysVector in dot product
-   */
-  friend su2double dotProd(const CSysVector & u, const CSysVector & v);
+  template<class T>
+  friend T dotProd(const TCSysVector<T> & u, const TCSysVector<T> & v);
+  
+  template<class T>
+  friend void dotProd(const TCSysVector<T> & u, const vector<TCSysVector<T> > & v, unsigned long nVec, T *prod);
+  
+  template<class T>
+  friend void dotProd(const TCSysVector<T> & u, const TCSysVector<T> & v, const TCSysVector<T> & w, T *prod);
   
 };
 
 /*!
- * \class CMatrixVectorProduct
+ * \brief scalar * vector multiplication operator
+ * \param[in] val - scalar value to multiply by
+ * \param[in] u - TCSysVector having its elements scaled
+ */
+template<class ScalarType>
+TCSysVector<ScalarType> operator*(const ScalarType & val, const TCSysVector<ScalarType> & u);
+
+/*!
+ * \brief dot-product between two TCSysVectors
+ * \param[in] u - first TCSysVector in dot product
+ * \param[in] v - second TCSysVector in dot product
+ */
+template<class ScalarType>
+ScalarType dotProd(const TCSysVector<ScalarType> & u, const TCSysVector<ScalarType> & v);
+
+/*!
+ * \brief dot-products of one TCSysVector with several others, with a single global reduction
+ * \param[in] u - TCSysVector in all the dot products
+ * \param[in] v - list of TCSysVectors, the first nVec are used
+ * \param[in] nVec - number of dot products
+ * \param[out] prod - array with the nVec dot products
+ */
+template<class ScalarType>
+void dotProd(const TCSysVector<ScalarType> & u, const vector<TCSysVector<ScalarType> > & v, unsigned long nVec, ScalarType *prod);
+
+/*!
+ * \brief dot-products of one TCSysVector with two others, in one pass and with a single global reduction
+ * \param[in] u - TCSysVector in both dot products
+ * \param[in] v - second TCSysVector of the first dot product
+ * \param[in] w - second TCSysVector of the second dot product
+ * \param[out] prod - array with the two dot products, (u,v) and (u,w)
+ */
+template<class ScalarType>
+void dotProd(const TCSysVector<ScalarType> & u, const TCSysVector<ScalarType> & v, const TCSysVector<ScalarType> & w, ScalarType *prod);
+
+typedef TCSysVector<su2double> CSysVector;               /*!< \brief Vector of the solvers. */
+typedef TCSysVector<passivedouble> CSysVectorPassive;    /*!< \brief Passive vector, for the linear solves outside of the AD tape. */
+
+/*!
+ * \class TCMatrixVectorProduct
  * \brief abstract base class for defining matrix-vector products
  * \author J. Hicken.
  *
@@ -361,28 +439,38 @@ public:
  * handle the different types of matrix-vector products and still be
  * passed to a single implementation of the Krylov solvers.
  */
-class CMatrixVectorProduct {
+template<class ScalarType>
+class TCMatrixVectorProduct {
 public:
-  virtual ~CMatrixVectorProduct() = 0; ///< class destructor
-  virtual void operator()(const CSysVector & u, CSysVector & v)
+  virtual ~TCMatrixVectorProduct() = 0; ///< class destructor
+  virtual void operator()(const TCSysVector<ScalarType> & u, TCSysVector<ScalarType> & v)
   const = 0; ///< matrix-vector product operation
 };
-inline CMatrixVectorProduct::~CMatrixVectorProduct() {}
+template<class ScalarType>
+inline TCMatrixVectorProduct<ScalarType>::~TCMatrixVectorProduct() {}
+
+typedef TCMatrixVectorProduct<su2double> CMatrixVectorProduct;
+typedef TCMatrixVectorProduct<passivedouble> CMatrixVectorProductPassive;
 
 /*!
- * \class CPreconditioner
+ * \class TCPreconditioner
  * \brief abstract base class for defining preconditioning operation
  * \author J. Hicken.
  *
  * See the remarks regarding the CMatrixVectorProduct class.  The same
  * idea applies here to the preconditioning operation.
  */
-class CPreconditioner {
+template<class ScalarType>
+class TCPreconditioner {
 public:
-  virtual ~CPreconditioner() = 0; ///< class destructor
-  virtual void operator()(const CSysVector & u, CSysVector & v)
+  virtual ~TCPreconditioner() = 0; ///< class destructor
+  virtual void operator()(const TCSysVector<ScalarType> & u, TCSysVector<ScalarType> & v)
   const = 0; ///< preconditioning operation
 };
-inline CPreconditioner::~CPreconditioner() {}
+template<class ScalarType>
+inline TCPreconditioner<ScalarType>::~TCPreconditioner() {}
+
+typedef TCPreconditioner<su2double> CPreconditioner;
+typedef TCPreconditioner<passivedouble> CPreconditionerPassive;
 
 #include "vector_structure.inl"
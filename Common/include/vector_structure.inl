@@ -37,14 +37,17 @@
 
 #pragma once
 
-inline void CSysVector::SetValZero(void) { 
+template<class ScalarType>
+inline void TCSysVector<ScalarType>::SetValZero(void) { 
   for (unsigned long i = 0; i < nElm; i++)
 		vec_val[i] = 0.0;
 }
 
-inline unsigned long CSysVector::GetLocSize() const { return nElm; }
+template<class ScalarType>
+inline unsigned long TCSysVector<ScalarType>::GetLocSize() const { return nElm; }
 
-inline unsigned long CSysVector::GetSize() const {
+template<class ScalarType>
+inline unsigned long TCSysVector<ScalarType>::GetSize() const {
 #ifdef HAVE_MPI
   return nElmGlobal;
 #else
@@ -52,12 +55,17 @@ inline unsigned long CSysVector::GetSize() const {
 #endif
 }
 
-inline unsigned short CSysVector::GetNVar() const { return nVar; }
+template<class ScalarType>
+inline unsigned short TCSysVector<ScalarType>::GetNVar() const { return nVar; }
 
-inline unsigned long CSysVector::GetNBlk() const { return nBlk; }
+template<class ScalarType>
+inline unsigned long TCSysVector<ScalarType>::GetNBlk() const { return nBlk; }
 
-inline unsigned long CSysVector::GetNBlkDomain() const { return nBlkDomain; }
+template<class ScalarType>
+inline unsigned long TCSysVector<ScalarType>::GetNBlkDomain() const { return nBlkDomain; }
 
-inline su2double & CSysVector::operator[](const unsigned long & i) { return vec_val[i]; }
+template<class ScalarType>
+inline ScalarType & TCSysVector<ScalarType>::operator[](const unsigned long & i) { return vec_val[i]; }
 
-inline const su2double & CSysVector::operator[](const unsigned long & i) const { return vec_val[i]; }
+template<class ScalarType>
+inline const ScalarType & TCSysVector<ScalarType>::operator[](const unsigned long & i) const { return vec_val[i]; }
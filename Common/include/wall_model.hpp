@@ -101,6 +101,55 @@ public:
                                                 su2double &qWall,
                                                 su2double &ViscosityWall,
                                                 su2double &kOverCvWall);
+
+  /*!
+   * \brief Virtual function, which computes the wall shear stress and heat flux
+            for a number of exchange locations simultaneously. The input and output
+            arrays contain one entry per exchange location. The default implementation
+            simply calls the point wise function for every exchange location.
+   * \param[in]     nPointsExchange        - Number of exchange locations.
+   * \param[in]     tExchange              - Temperatures at the exchange locations.
+   * \param[in]     velExchange            - Velocities at the exchange locations.
+   * \param[in]     muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]     pExchange              - Pressures at the exchange locations.
+   * \param[in]     Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]     HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]     Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]     Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[out]    tauWall                - Wall shear stresses, to be computed.
+   * \param[out]    qWall                  - Wall hear fluxes, to be computed (if not prescribed).
+   * \param[out]    ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out]    OverCvWall             - Thermal conductivities divided by Cv at the wall,
+                                             to be computed.
+   * \param[in,out] profiles               - Storage of the wall model profiles, GetSizeProfile()
+                                             entries per exchange location. On input the profiles
+                                             of a previous call, which are used as initial guess.
+                                             On output the new profiles. It may be NULL, in which
+                                             case no warm start is carried out.
+   */
+  virtual void WallShearStressAndHeatFluxBatch(const unsigned short nPointsExchange,
+                                               const su2double      *tExchange,
+                                               const su2double      *velExchange,
+                                               const su2double      *muExchange,
+                                               const su2double      *pExchange,
+                                               const su2double      Wall_HeatFlux,
+                                               const bool           HeatFlux_Prescribed,
+                                               const su2double      Wall_Temperature,
+                                               const bool           Temperature_Prescribed,
+                                                     su2double      *tauWall,
+                                                     su2double      *qWall,
+                                                     su2double      *ViscosityWall,
+                                                     su2double      *kOverCvWall,
+                                                     su2double      *profiles);
+
+  /*!
+   * \brief Virtual function, which returns the number of variables stored per
+            exchange location to warm start the wall model.
+   * \return The number of profile variables per exchange location. The default is 0,
+             i.e. the wall model does not store profiles.
+   */
+  virtual unsigned short GetSizeProfile(void);
+
 protected:
 
   su2double h_wm; /*!< \brief The thickness of the wall model. This is also basically the exchange location */
@@ -160,11 +209,75 @@ public:
                                         su2double &ViscosityWall,
                                         su2double &kOverCvWall);
 
+  /*!
+   * \brief Function, which computes the wall shear stress and heat flux for
+            a number of exchange locations simultaneously. The data of the
+            exchange locations is stored such that the innermost loops run over
+            the exchange locations, which allows for vectorization. Exchange
+            locations, which are converged, are removed from the working set.
+   * \param[in]     nPointsExchange        - Number of exchange locations.
+   * \param[in]     tExchange              - Temperatures at the exchange locations.
+   * \param[in]     velExchange            - Velocities at the exchange locations.
+   * \param[in]     muExchange             - Laminar viscosities at the exchange locations.
+   * \param[in]     pExchange              - Pressures at the exchange locations.
+   * \param[in]     Wall_HeatFlux          - Value of the wall heat flux, if prescribed.
+   * \param[in]     HeatFlux_Prescribed    - Whether or not the wall heat flux is prescribed.
+   * \param[in]     Wall_Temperature       - Value of the wall temperature, if prescribed.
+   * \param[in]     Temperature_Prescribed - Wheter or not the wall temperature is prescribed.
+   * \param[out]    tauWall                - Wall shear stresses, to be computed.
+   * \param[out]    qWall                  - Wall hear fluxes, to be computed (if not prescribed).
+   * \param[out]    ViscosityWall          - Laminar viscosities at the wall, to be computed.
+   * \param[out]    OverCvWall             - Thermal conductivities divided by Cv at the wall,
+                                             to be computed.
+   * \param[in,out] profiles               - Wall shear stress and temperature profile per
+                                             exchange location, used as initial guess. May be NULL.
+   */
+  void WallShearStressAndHeatFluxBatch(const unsigned short nPointsExchange,
+                                       const su2double      *tExchange,
+                                       const su2double      *velExchange,
+                                       const su2double      *muExchange,
+                                       const su2double      *pExchange,
+                                       const su2double      Wall_HeatFlux,
+                                       const bool           HeatFlux_Prescribed,
+                                       const su2double      Wall_Temperature,
+                                       const bool           Temperature_Prescribed,
+                                             su2double      *tauWall,
+                                             su2double      *qWall,
+                                             su2double      *ViscosityWall,
+                                             su2double      *kOverCvWall,
+                                             su2double      *profiles);
+
+  /*!
+   * \brief Function, which returns the number of variables stored per exchange
+            location to warm start the wall model, i.e. the wall shear stress
+            and the temperatures in the faces of the wall model grid.
+   * \return The number of profile variables per exchange location.
+   */
+  unsigned short GetSizeProfile(void);
+
 private:
 
   su2double expansionRatio;   /*!< \brief  Stretching factor used for the wall model grid. */
   int       numPoints;        /*!< \brief  Number of points used in the wall model grid. */
 
+  /*!
+   * \brief Function, which solves simultaneously the tridiagonal systems of a
+            number of exchange locations with the Thomas algorithm. The systems
+            are stored with a stride of nStride between consecutive rows.
+   * \param[in]     nSystems - Number of tridiagonal systems to be solved.
+   * \param[in]     nStride  - Stride between the rows of the systems.
+   * \param[in]     lower    - Lower diagonals of the systems.
+   * \param[in]     diagonal - Diagonals of the systems.
+   * \param[in,out] upper    - Upper diagonals of the systems, overwritten.
+   * \param[in,out] rhs      - On input the right hand sides, on output the solutions.
+   */
+  void SolveTridiagonalSystems(const unsigned short nSystems,
+                               const unsigned short nStride,
+                               const su2double      *lower,
+                               const su2double      *diagonal,
+                                     su2double      *upper,
+                                     su2double      *rhs);
+
   vector<su2double> y_cv;    /*!< \brief  The coordinates in normal direction of the wall model grid (control volumes). */
   vector<su2double> y_fa;    /*!< \brief  The coordinates in normal direction of the wall model grid (faces of CV). */
 };
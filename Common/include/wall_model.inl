@@ -59,6 +59,8 @@ inline void CWallModel::WallShearStressAndHeatFlux(const su2double rhoExchange,
                                                          su2double &ViscosityWall,
                                                          su2double &kOverCvWall) {}
 
+inline unsigned short CWallModel::GetSizeProfile(void) {return 0;}
+
 inline CWallModel1DEQ::CWallModel1DEQ(void) : CWallModel(){
   expansionRatio = 0.0;
   numPoints      = 0;
@@ -66,6 +68,8 @@ inline CWallModel1DEQ::CWallModel1DEQ(void) : CWallModel(){
 
 inline CWallModel1DEQ::~CWallModel1DEQ(void){}
 
+inline unsigned short CWallModel1DEQ::GetSizeProfile(void) {return numPoints+2;}
+
 inline CWallModelLogLaw::CWallModelLogLaw(void) : CWallModel(){
   expansionRatio = 0.0;
   numPoints      = 0;
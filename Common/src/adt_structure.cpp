@@ -271,6 +271,40 @@ void CADTBaseClass::BuildADT(unsigned short  nDim,
   }
 }
 
+void CADTBaseClass::RefitADT(const su2double *coor) {
+
+  /*--- The children of a leaf always have a higher index than the leaf, hence
+        the bounding boxes are refitted from the last leaf to the root. ---*/
+  for(unsigned long i=nLeaves; i>0; --i) {
+    const unsigned long mm = i-1;
+
+    for(unsigned short l=0; l<2; ++l) {
+      const unsigned long kk = leaves[mm].children[l];
+
+      /* Bounding box of the child, either a point or a leaf. */
+      const su2double *childMin, *childMax;
+      if( leaves[mm].childrenAreTerminal[l] ) {
+        childMin = childMax = coor + nDimADT*kk;
+      }
+      else {
+        childMin = leaves[kk].xMin;
+        childMax = leaves[kk].xMax;
+      }
+
+      for(unsigned short k=0; k<nDimADT; ++k) {
+        if(l == 0) {
+          leaves[mm].xMin[k] = childMin[k];
+          leaves[mm].xMax[k] = childMax[k];
+        }
+        else {
+          leaves[mm].xMin[k] = min(leaves[mm].xMin[k], childMin[k]);
+          leaves[mm].xMax[k] = max(leaves[mm].xMax[k], childMax[k]);
+        }
+      }
+    }
+  }
+}
+
 CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
                                          unsigned long  nPoints,
                                          su2double      *coor,
@@ -316,8 +350,8 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
     for(int i=0; i<size; ++i) {recvCounts[i] *= nDim; displs[i] *= nDim;}
 
     coorPoints.resize(nDim*sizeGlobal);
-    SU2_MPI::Allgatherv(coor, nDim*sizeLocal, MPI_DOUBLE, coorPoints.data(),
-                        recvCounts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgatherv(coor, nDim*sizeLocal, MPI_SU2DOUBLE, coorPoints.data(),
+                        recvCounts.data(), displs.data(), MPI_SU2DOUBLE, MPI_COMM_WORLD);
   }
   else {
 
@@ -350,20 +384,94 @@ CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim,
   frontLeavesNew.reserve(200);
 }
 
+void CADTBaseClass::SpaceFillingCurveOrder(const unsigned short  nDimCoor,
+                                           const unsigned long   nCoor,
+                                           const su2double       *coor,
+                                           vector<unsigned long> &order) const {
+
+  /*--- Bounding box of the coordinates, which is divided in 2^nBits
+        intervals per direction (30 bits in total for the key). ---*/
+  const unsigned short nBits = 30/nDimCoor;
+  const double nInt = (double) (1 << nBits);
+
+  double xMin[3] = {0.0, 0.0, 0.0}, xMax[3] = {0.0, 0.0, 0.0};
+  for(unsigned long i=0; i<nCoor; ++i) {
+    for(unsigned short k=0; k<nDimCoor; ++k) {
+      const double x = SU2_TYPE::GetValue(coor[nDimCoor*i+k]);
+      if((i == 0) || (x < xMin[k])) xMin[k] = x;
+      if((i == 0) || (x > xMax[k])) xMax[k] = x;
+    }
+  }
+
+  /*--- Interleave the bits of the integer coordinates to obtain the
+        Morton key of each coordinate and sort the keys. ---*/
+  vector<pair<unsigned long, unsigned long> > keys(nCoor);
+  for(unsigned long i=0; i<nCoor; ++i) {
+    unsigned long iCoor[3] = {0, 0, 0};
+    for(unsigned short k=0; k<nDimCoor; ++k) {
+      const double len = xMax[k] - xMin[k];
+      if(len > 0.0) {
+        const double x = (SU2_TYPE::GetValue(coor[nDimCoor*i+k]) - xMin[k])/len;
+        iCoor[k] = min((unsigned long) (x*nInt), (unsigned long) (nInt-1.0));
+      }
+    }
+
+    unsigned long key = 0;
+    for(unsigned short b=0; b<nBits; ++b)
+      for(unsigned short k=0; k<nDimCoor; ++k)
+        key |= ((iCoor[k] >> b) & 1UL) << (nDimCoor*b+k);
+
+    keys[i] = make_pair(key, i);
+  }
+
+  sort(keys.begin(), keys.end());
+
+  order.resize(nCoor);
+  for(unsigned long i=0; i<nCoor; ++i) order[i] = keys[i].second;
+}
+
 void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
                                                su2double       &dist,
                                                unsigned long   &pointID,
                                                int             &rankID) {
 
+  unsigned long minIndex = leaves[0].centralNodeID;
+  DetermineNearestNode(coor, dist, pointID, rankID, minIndex);
+}
+
+void CADTPointsOnlyClass::DetermineNearestNodes(const unsigned long nCoor,
+                                                const su2double     *coor,
+                                                su2double           *dist,
+                                                unsigned long       *pointID,
+                                                int                 *rankID) {
+
+  /*--- Process the coordinates along a space filling curve, such that the
+        nearest node of the previous search is a close upper bound. ---*/
+  vector<unsigned long> order;
+  SpaceFillingCurveOrder(nDimADT, nCoor, coor, order);
+
+  unsigned long minIndex = leaves[0].centralNodeID;
+  for(unsigned long i=0; i<nCoor; ++i) {
+    const unsigned long ii = order[i];
+    DetermineNearestNode(coor + nDimADT*ii, dist[ii], pointID[ii], rankID[ii], minIndex);
+  }
+}
+
+void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
+                                               su2double       &dist,
+                                               unsigned long   &pointID,
+                                               int             &rankID,
+                                               unsigned long   &minIndex) {
+
   AD_BEGIN_PASSIVE
 
   /*--------------------------------------------------------------------------*/
-  /*--- Step 1: Initialize the nearest node to the central node of the     ---*/
-  /*---         root leaf. Note that the distance is the distance squared  ---*/
-  /*---         to avoid a sqrt.                                           ---*/
+  /*--- Step 1: Initialize the nearest node to the starting node, by       ---*/
+  /*---         default the central node of the root leaf. Note that the   ---*/
+  /*---         distance is the distance squared to avoid a sqrt.          ---*/
   /*--------------------------------------------------------------------------*/
 
-  unsigned long kk = leaves[0].centralNodeID, minIndex;
+  unsigned long kk = minIndex;
   const su2double *coorTarget = coorPoints.data() + nDimADT*kk;
 
   pointID  = localPointIDs[kk];
@@ -467,7 +575,7 @@ void CADTPointsOnlyClass::DetermineNearestNode(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -494,10 +602,11 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
                              vector<unsigned short> &val_VTKElem,
                              vector<unsigned short> &val_markerID,
                              vector<unsigned long>  &val_elemID,
-                             const bool             globalTree) {
+                             const bool             val_globalTree) {
 
   /* Copy the dimension of the problem into nDim. */
   nDim = val_nDim;
+  globalTree = val_globalTree;
 
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: If a global tree must be built, gather the local grids on  ---*/
@@ -544,8 +653,8 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
     int sizeGlobal = displs.back() + recvCounts.back();
 
     coorPoints.resize(sizeGlobal);
-    SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_DOUBLE, coorPoints.data(),
-                        recvCounts.data(), displs.data(), MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_SU2DOUBLE, coorPoints.data(),
+                        recvCounts.data(), displs.data(), MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
     /*--- Determine the number of elements per rank and make them
           available to all ranks. ---*/
@@ -657,7 +766,22 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
   /*---         these points in this higher dimensional space.             ---*/
   /*--------------------------------------------------------------------------*/
 
+  ComputeBBoxCoor();
+
+  /* Build the ADT of the bounding boxes. */
+  BuildADT(2*nDim, nElem, BBoxCoor.data());
+
+  /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
+        which are needed during the tree search. ---*/
+  frontLeaves.reserve(200);
+  frontLeavesNew.reserve(200);
+  BBoxTargets.reserve(200);
+}
+
+void CADTElemClass::ComputeBBoxCoor(void) {
+
   /* Allocate the memory for the bounding boxes of the elements. */
+  const unsigned long nElem = elemVTK_Type.size();
   BBoxCoor.resize(2*nDim*nElem);
 
   /*--- Loop over the elements to determine the minimum and maximum coordinates
@@ -698,15 +822,43 @@ CADTElemClass::CADTElemClass(unsigned short         val_nDim,
       BBMax[k] += tol;
     }
   }
+}
 
-  /* Build the ADT of the bounding boxes. */
-  BuildADT(2*nDim, nElem, BBoxCoor.data());
+void CADTElemClass::RefitElements(vector<su2double> &val_coor) {
 
-  /*--- Reserve the memory for frontLeaves, frontLeavesNew and BBoxTargets,
-        which are needed during the tree search. ---*/
-  frontLeaves.reserve(200);
-  frontLeavesNew.reserve(200);
-  BBoxTargets.reserve(200);
+  /*--- Gather the new coordinates in the same way as in the constructor, the
+        connectivities and the other element data do not change. ---*/
+#ifdef HAVE_MPI
+  if( globalTree ) {
+
+    int size;
+    SU2_MPI::Comm_size(MPI_COMM_WORLD, &size);
+
+    vector<int> recvCounts(size), displs(size);
+    int sizeLocal = (int) val_coor.size();
+
+    SU2_MPI::Allgather(&sizeLocal, 1, MPI_INT, recvCounts.data(), 1,
+                       MPI_INT, MPI_COMM_WORLD);
+    displs[0] = 0;
+    for(int i=1; i<size; ++i) displs[i] = displs[i-1] + recvCounts[i-1];
+
+    const int sizeGlobal = displs.back() + recvCounts.back();
+    if(sizeGlobal != (int) coorPoints.size())
+      SU2_MPI::Error("The number of points of the ADT changed.", CURRENT_FUNCTION);
+
+    SU2_MPI::Allgatherv(val_coor.data(), sizeLocal, MPI_SU2DOUBLE, coorPoints.data(),
+                        recvCounts.data(), displs.data(), MPI_SU2DOUBLE, MPI_COMM_WORLD);
+  }
+  else {
+    coorPoints = val_coor;
+  }
+#else
+  coorPoints = val_coor;
+#endif
+
+  /*--- Recompute the bounding boxes and refit the leaves of the tree. ---*/
+  ComputeBBoxCoor();
+  if( !isEmpty ) RefitADT(BBoxCoor.data());
 }
 
 bool CADTElemClass::DetermineContainingElement(const su2double *coor,
@@ -786,7 +938,7 @@ bool CADTElemClass::DetermineContainingElement(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -801,6 +953,42 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
                                             unsigned long   &elemID,
                                             int             &rankID) {
 
+  unsigned long ADTElemID;
+  DetermineNearestElement(coor, dist, markerID, elemID, rankID, ADTElemID, 0, NULL);
+}
+
+void CADTElemClass::DetermineNearestElements(const unsigned long nCoor,
+                                             const su2double     *coor,
+                                             su2double           *dist,
+                                             unsigned short      *markerID,
+                                             unsigned long       *elemID,
+                                             int                 *rankID,
+                                             unsigned long       *ADTElemID) {
+
+  /*--- Process the coordinates along a space filling curve, such that the
+        nearest element of the previous search is a good candidate. ---*/
+  vector<unsigned long> order;
+  SpaceFillingCurveOrder(nDim, nCoor, coor, order);
+
+  unsigned long guessElem = 0, nearestElem = 0, nGuess = 0;
+  for(unsigned long i=0; i<nCoor; ++i) {
+    const unsigned long ii = order[i];
+    DetermineNearestElement(coor + nDim*ii, dist[ii], markerID[ii], elemID[ii],
+                            rankID[ii], nearestElem, nGuess, &guessElem);
+    if( ADTElemID ) ADTElemID[ii] = nearestElem;
+    guessElem = nearestElem; nGuess = 1;
+  }
+}
+
+void CADTElemClass::DetermineNearestElement(const su2double     *coor,
+                                            su2double           &dist,
+                                            unsigned short      &markerID,
+                                            unsigned long       &elemID,
+                                            int                 &rankID,
+                                            unsigned long       &ADTElemID,
+                                            const unsigned long nGuess,
+                                            const unsigned long *guessElems) {
+
   AD_BEGIN_PASSIVE
 
   /*----------------------------------------------------------------------------*/
@@ -822,6 +1010,21 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
     dist += ds*ds;
   }
 
+  /*--- The distance to the candidate elements is an upper bound as well. ---*/
+  for(unsigned long i=0; i<nGuess; ++i) {
+    if(guessElems[i] >= localElemIDs.size()) continue;
+
+    su2double dist2Elem;
+    Dist2ToElement(guessElems[i], coor, dist2Elem);
+    if(dist2Elem <= dist) {
+      jj       = guessElems[i];
+      dist     = dist2Elem;
+      markerID = localMarkers[jj];
+      elemID   = localElemIDs[jj];
+      rankID   = ranksOfElems[jj];
+    }
+  }
+
   /*----------------------------------------------------------------------------*/
   /*--- Step 2: Traverse the tree and store the bounding boxes for which the ---*/
   /*---         possible minimum distance is less than the currently stored  ---*/
@@ -937,7 +1140,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
           frontLeavesNew to frontLeaves for the next round. If the new front
           is empty the entire tree has been traversed and a break can be made
           from the infinite loop. ---*/
-    frontLeaves = frontLeavesNew;
+    frontLeaves.swap(frontLeavesNew);
     if(frontLeaves.size() == 0) break;
   }
 
@@ -984,6 +1187,7 @@ void CADTElemClass::DetermineNearestElement(const su2double *coor,
      the correct value. */
   Dist2ToElement(jj, coor, dist);
   dist = sqrt(dist);
+  ADTElemID = jj;
 }
 
 bool CADTElemClass::CoorInElement(const unsigned long elemID,
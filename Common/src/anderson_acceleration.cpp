@@ -0,0 +1,188 @@
+/*!
+ * \file anderson_acceleration.cpp
+ * \brief Anderson acceleration of fixed-point iterations.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/anderson_acceleration.hpp"
+
+CAndersonAcceleration::CAndersonAcceleration(unsigned short val_depth, su2double val_relaxation) {
+  
+  nDepth     = val_depth;
+  Relaxation = val_relaxation;
+  
+  Gram.assign(nDepth*nDepth, 0.0);
+  
+  nCol         = 0;
+  Has_Iterate  = false;
+  Has_Residual = false;
+  
+}
+
+CAndersonAcceleration::~CAndersonAcceleration(void) { }
+
+void CAndersonAcceleration::Reset(void) {
+  
+  Delta_Image.clear();
+  Delta_Residual.clear();
+  
+  nCol         = 0;
+  Has_Iterate  = false;
+  Has_Residual = false;
+  
+}
+
+void CAndersonAcceleration::DropOldest(void) {
+  
+  unsigned short iCol, jCol;
+  
+  Delta_Image.erase(Delta_Image.begin());
+  Delta_Residual.erase(Delta_Residual.begin());
+  
+  for (iCol = 1; iCol < nCol; iCol++)
+    for (jCol = 1; jCol < nCol; jCol++)
+      Gram[(iCol-1)*nDepth+jCol-1] = Gram[iCol*nDepth+jCol];
+  
+  nCol--;
+  
+}
+
+void CAndersonAcceleration::Compute(CSysVector & val_image) {
+  
+  unsigned short iCol, jCol, kCol, iPivot;
+  
+  /*--- First iterate of a sequence, plain fixed-point step ---*/
+  
+  if ((nDepth == 0) || !Has_Iterate) {
+    Iterate     = val_image;
+    Has_Iterate = true;
+    Image_Old   = val_image;
+    Has_Residual = false;
+    return;
+  }
+  
+  /*--- Residual of the current iterate ---*/
+  
+  CSysVector residual(val_image);
+  residual -= Iterate;
+  
+  /*--- New differences, and the new row of the Gram matrix with one reduction ---*/
+  
+  if (Has_Residual) {
+    
+    if (nCol == nDepth) DropOldest();
+    
+    Delta_Image.push_back(val_image);
+    Delta_Image.back() -= Image_Old;
+    Delta_Residual.push_back(residual);
+    Delta_Residual.back() -= Residual_Old;
+    nCol++;
+    
+    vector<su2double> row(nCol);
+    dotProd(Delta_Residual.back(), Delta_Residual, nCol, row.data());
+    for (iCol = 0; iCol < nCol; iCol++) {
+      Gram[(nCol-1)*nDepth+iCol] = row[iCol];
+      Gram[iCol*nDepth+nCol-1]   = row[iCol];
+    }
+  }
+  
+  Image_Old    = val_image;
+  Residual_Old = residual;
+  Has_Residual = true;
+  
+  /*--- Least-squares combination of the differences, min |residual - Delta_Residual*gamma|,
+   by Gaussian elimination with partial pivoting of the normal equations. A pivot that is
+   negligible with respect to the diagonal means that the differences are (nearly) linearly
+   dependent, the history is then dropped and a plain fixed-point step is taken. ---*/
+  
+  vector<su2double> gamma(nCol+1, 0.0), A(nCol*nCol);
+  
+  if (nCol > 0) {
+    
+    dotProd(residual, Delta_Residual, nCol, gamma.data());
+    
+    su2double max_diag = 0.0;
+    for (iCol = 0; iCol < nCol; iCol++) {
+      for (jCol = 0; jCol < nCol; jCol++) A[iCol*nCol+jCol] = Gram[iCol*nDepth+jCol];
+      max_diag = max(max_diag, A[iCol*nCol+iCol]);
+    }
+    
+    bool singular = (max_diag <= 0.0);
+    
+    for (kCol = 0; (kCol < nCol) && !singular; kCol++) {
+      iPivot = kCol;
+      for (iCol = kCol+1; iCol < nCol; iCol++)
+        if (fabs(A[iCol*nCol+kCol]) > fabs(A[iPivot*nCol+kCol])) iPivot = iCol;
+      if (fabs(A[iPivot*nCol+kCol]) <= 1e-12*max_diag) { singular = true; break; }
+      if (iPivot != kCol) {
+        for (jCol = 0; jCol < nCol; jCol++) swap(A[kCol*nCol+jCol], A[iPivot*nCol+jCol]);
+        swap(gamma[kCol], gamma[iPivot]);
+      }
+      for (iCol = kCol+1; iCol < nCol; iCol++) {
+        const su2double factor = A[iCol*nCol+kCol]/A[kCol*nCol+kCol];
+        for (jCol = kCol; jCol < nCol; jCol++) A[iCol*nCol+jCol] -= factor*A[kCol*nCol+jCol];
+        gamma[iCol] -= factor*gamma[kCol];
+      }
+    }
+    
+    if (singular) {
+      Delta_Image.clear();
+      Delta_Residual.clear();
+      nCol = 0;
+    }
+    else {
+      for (kCol = nCol; kCol-- > 0; ) {
+        for (jCol = kCol+1; jCol < nCol; jCol++) gamma[kCol] -= A[kCol*nCol+jCol]*gamma[jCol];
+        gamma[kCol] /= A[kCol*nCol+kCol];
+      }
+    }
+  }
+  
+  /*--- x_{k+1} = G(x_k) - (1-b) f_k - sum_i gamma_i (Delta_Image_i - (1-b) Delta_Residual_i) ---*/
+  
+  if (Relaxation != 1.0) val_image.Plus_AX(Relaxation-1.0, residual);
+  
+  if (nCol > 0) {
+    vector<su2double> coeff(nCol);
+    for (iCol = 0; iCol < nCol; iCol++) coeff[iCol] = -gamma[iCol];
+    val_image.Plus_AX(nCol, coeff.data(), Delta_Image);
+    if (Relaxation != 1.0) {
+      for (iCol = 0; iCol < nCol; iCol++) coeff[iCol] = (1.0-Relaxation)*gamma[iCol];
+      val_image.Plus_AX(nCol, coeff.data(), Delta_Residual);
+    }
+  }
+  
+  Iterate = val_image;
+  
+}
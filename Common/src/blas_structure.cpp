@@ -81,11 +81,21 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
   /* The gemm function of libxsmm is used to carry out the multiplication.
      Note that libxsmm_gemm expects the matrices in column major order. That's
      why the in the calling sequence A and B and M and N are reversed. */
-  su2double alpha = 1.0;
-  su2double beta  = 0.0;
-  char trans = 'N';
+  map<pair<int, pair<int, int> >, libxsmm_dmmfunction>::const_iterator
+    kernel = gemmKernels.find(make_pair(M, make_pair(N, K)));
+
+  if(kernel != gemmKernels.end()) {
 
-  libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+    /* A kernel for these dimensions has been created. Call it directly. */
+    kernel->second(B, A, C);
+  }
+  else {
+    su2double alpha = 1.0;
+    su2double beta  = 0.0;
+    char trans = 'N';
+
+    libxsmm_dgemm(&trans, &trans, &N, &M, &K, &alpha, B, &N, A, &K, &beta, C, &N);
+  }
 
 #else // MKL and BLAS
 
@@ -107,6 +117,28 @@ void CBlasStructure::gemm(const int M,        const int N,        const int K,
 #endif
 }
 
+/* Creation of the kernel for the dense matrix product of the given dimensions. */
+void CBlasStructure::CreateGemmKernel(const int M, const int N, const int K) {
+
+#if defined(HAVE_LIBXSMM) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+  /* Check if the kernel is already present. */
+  const pair<int, pair<int, int> > key = make_pair(M, make_pair(N, K));
+  if(gemmKernels.find(key) != gemmKernels.end()) return;
+
+  /* Create the JIT kernel of libxsmm. As libxsmm expects the matrices in
+     column major order, M and N are reversed, see gemm. If the kernel
+     cannot be created, gemm uses libxsmm_dgemm for these dimensions. */
+  const double alpha = 1.0;
+  const double beta  = 0.0;
+
+  libxsmm_dmmfunction kernel = libxsmm_dmmdispatch(N, M, K, NULL, NULL, NULL,
+                                                   &alpha, &beta, NULL, NULL);
+  if( kernel ) gemmKernels[key] = kernel;
+
+#endif
+}
+
 /* Dense matrix vector multiplication, gemv functionality. */
 void CBlasStructure::gemv(const int M,        const int N,   const su2double *A,
                           const su2double *x, su2double *y) {
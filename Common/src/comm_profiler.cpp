@@ -0,0 +1,274 @@
+/*!
+ * \file comm_profiler.cpp
+ * \brief Statistics of the MPI communication, written at the end of the run.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/comm_profiler.hpp"
+#include "../include/option_structure.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+bool CCommProfiler::Active = false;
+
+map<string, unsigned short> CCommProfiler::Category_Map;
+vector<string> CCommProfiler::Category_Name;
+vector<bool> CCommProfiler::Category_Reduction;
+vector<unsigned long> CCommProfiler::Category_nCall;
+vector<unsigned long> CCommProfiler::Category_nMessage;
+vector<unsigned long> CCommProfiler::Category_nByte;
+vector<double> CCommProfiler::Category_Time;
+
+vector<unsigned long> CCommProfiler::Rank_nByte;
+
+unsigned long CCommProfiler::nIter = 0;
+double CCommProfiler::Iter_Start = -1.0;
+double CCommProfiler::Iter_Time = 0.0;
+double CCommProfiler::Iter_MaxTime = 0.0;
+double CCommProfiler::Iter_WaitTime = 0.0;
+double CCommProfiler::Iter_ReductionTime = 0.0;
+double CCommProfiler::Total_WaitTime = 0.0;
+double CCommProfiler::Total_ReductionTime = 0.0;
+
+void CCommProfiler::SetActive(bool val_active) {
+  
+  Active = val_active;
+  
+  if (Active) Rank_nByte.assign(SU2_MPI::GetSize(), 0);
+  
+}
+
+unsigned short CCommProfiler::GetCategory(const string &val_name, bool val_reduction) {
+  
+  map<string, unsigned short>::iterator it = Category_Map.find(val_name);
+  if (it != Category_Map.end()) return it->second;
+  
+  /*--- All ranks go through the same exchanges and reductions, hence the
+   categories are created in the same order on all of them. ---*/
+  
+  const unsigned short ind = Category_Name.size();
+  Category_Map[val_name] = ind;
+  Category_Name.push_back(val_name);
+  Category_Reduction.push_back(val_reduction);
+  Category_nCall.push_back(0);
+  Category_nMessage.push_back(0);
+  Category_nByte.push_back(0);
+  Category_Time.push_back(0.0);
+  
+  return ind;
+  
+}
+
+void CCommProfiler::BeginIteration(void) {
+  
+  if (!Active) return;
+  
+  Iter_Start = GetTime();
+  
+  /*--- The waits of the iteration are the difference of the running totals ---*/
+  
+  Iter_WaitTime      -= Total_WaitTime;
+  Iter_ReductionTime -= Total_ReductionTime;
+  
+}
+
+void CCommProfiler::EndIteration(void) {
+  
+  if (!Active || (Iter_Start < 0.0)) return;
+  
+  const double time = GetTime() - Iter_Start;
+  
+  nIter++;
+  Iter_Time   += time;
+  Iter_MaxTime = max(Iter_MaxTime, time);
+  
+  Iter_WaitTime      += Total_WaitTime;
+  Iter_ReductionTime += Total_ReductionTime;
+  
+  Iter_Start = -1.0;
+  
+}
+
+void CCommProfiler::WriteCSV(void) {
+  
+  if (!Active) return;
+  
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+  int iRank;
+  unsigned short iCat;
+  
+  /*--- The categories are matched by their position, which requires the same
+   number of categories on all ranks. ---*/
+  
+  int nCat = Category_Name.size(), min_nCat = nCat, max_nCat = nCat;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&nCat, &min_nCat, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&nCat, &max_nCat, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Statistics of the categories: average calls, total messages and bytes
+   with the largest share of a rank, average/min/max time of the ranks. ---*/
+  
+  const bool write_categories = (min_nCat == max_nCat);
+  
+  vector<double> cat_loc(4*nCat), cat_sum(4*nCat), cat_min(4*nCat), cat_max(4*nCat);
+  for (iCat = 0; iCat < nCat; iCat++) {
+    cat_loc[4*iCat  ] = double(Category_nCall[iCat]);
+    cat_loc[4*iCat+1] = double(Category_nMessage[iCat]);
+    cat_loc[4*iCat+2] = double(Category_nByte[iCat]);
+    cat_loc[4*iCat+3] = Category_Time[iCat];
+  }
+  cat_sum = cat_loc; cat_min = cat_loc; cat_max = cat_loc;
+  
+  /*--- Times of every rank: iterations, total, slowest iteration, halo waits,
+   reductions and computation (the rest of the iterations). ---*/
+  
+  const int nRankVal = 6;
+  const double compute = Iter_Time - Iter_WaitTime - Iter_ReductionTime;
+  double rank_loc[] = {double(nIter), Iter_Time, Iter_MaxTime, Iter_WaitTime, Iter_ReductionTime, compute};
+  vector<double> rank_all(nRankVal*size);
+  
+  /*--- Non-zeros of the row of the communication matrix ---*/
+  
+  vector<unsigned long> row_loc;
+  for (iRank = 0; iRank < int(Rank_nByte.size()); iRank++) {
+    if (Rank_nByte[iRank] == 0) continue;
+    row_loc.push_back(iRank);
+    row_loc.push_back(Rank_nByte[iRank]);
+  }
+  int nRow = row_loc.size();
+  vector<int> nRow_all(size);
+  vector<unsigned long> row_all;
+  
+#ifdef HAVE_MPI
+  
+  /*--- The statistics are passive values, they bypass the AD wrapper of MPI ---*/
+  
+  if (write_categories && (nCat > 0)) {
+    CBaseMPIWrapper::Reduce(cat_loc.data(), cat_sum.data(), 4*nCat, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Reduce(cat_loc.data(), cat_min.data(), 4*nCat, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Reduce(cat_loc.data(), cat_max.data(), 4*nCat, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  }
+  
+  CBaseMPIWrapper::Gather(rank_loc, nRankVal, MPI_DOUBLE, rank_all.data(), nRankVal, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(&nRow, 1, MPI_INT, nRow_all.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  
+  /*--- The rows of the matrix are sparse, they are received one rank at a time ---*/
+  
+  if (rank == MASTER_NODE) {
+    SU2_MPI::Status status;
+    row_all = row_loc;
+    for (iRank = 1; iRank < size; iRank++) {
+      if (nRow_all[iRank] == 0) continue;
+      const size_t offset = row_all.size();
+      row_all.resize(offset+nRow_all[iRank]);
+      SU2_MPI::Recv(&row_all[offset], nRow_all[iRank], MPI_UNSIGNED_LONG, iRank, iRank,
+                    MPI_COMM_WORLD, &status);
+    }
+  }
+  else if (nRow > 0) {
+    SU2_MPI::Send(row_loc.data(), nRow, MPI_UNSIGNED_LONG, MASTER_NODE, rank, MPI_COMM_WORLD);
+  }
+  
+#else
+  
+  for (int iVal = 0; iVal < nRankVal; iVal++) rank_all[iVal] = rank_loc[iVal];
+  nRow_all[0] = nRow;
+  row_all = row_loc;
+  
+#endif
+  
+  if (rank != MASTER_NODE) return;
+  
+  ofstream Profile_File;
+  
+  /*--- Categories ---*/
+  
+  if (write_categories) {
+    
+    Profile_File.precision(15);
+    Profile_File.open("comm_profiling.csv", ios::out);
+    
+    Profile_File << "\"Category\", \"Kind\", \"Avg_Calls\", \"Messages\", \"Bytes\", \"Max_Bytes_Rank\", \"Avg_Time\", \"Min_Time\", \"Max_Time\"" << endl;
+    
+    for (iCat = 0; iCat < nCat; iCat++) {
+      Profile_File << scientific << Category_Name[iCat] << ", "
+                   << (Category_Reduction[iCat]? "Reduction" : "Halo") << ", "
+                   << cat_sum[4*iCat]/double(size) << ", " << cat_sum[4*iCat+1] << ", "
+                   << cat_sum[4*iCat+2] << ", " << cat_max[4*iCat+2] << ", "
+                   << cat_sum[4*iCat+3]/double(size) << ", " << cat_min[4*iCat+3] << ", "
+                   << cat_max[4*iCat+3] << endl;
+    }
+    
+    Profile_File.close();
+  }
+  else {
+    cout << "WARNING: The communication categories differ between the ranks, comm_profiling.csv is not written." << endl;
+  }
+  
+  /*--- Ranks, the imbalance of the computation shows as wait time of the other ranks ---*/
+  
+  Profile_File.precision(15);
+  Profile_File.open("comm_ranks.csv", ios::out);
+  
+  Profile_File << "\"Rank\", \"Iterations\", \"Time\", \"Max_Iteration_Time\", \"Wait_Time\", \"Reduction_Time\", \"Compute_Time\", \"Compute_Time_Iteration\"" << endl;
+  
+  for (iRank = 0; iRank < size; iRank++) {
+    const double *val = &rank_all[nRankVal*iRank];
+    Profile_File << iRank << ", " << (unsigned long)(val[0]) << scientific;
+    for (int iVal = 1; iVal < nRankVal; iVal++) Profile_File << ", " << val[iVal];
+    Profile_File << ", " << val[5]/max(val[0], 1.0) << endl;
+    Profile_File.unsetf(ios::floatfield);
+  }
+  
+  Profile_File.close();
+  
+  /*--- Communication matrix, one line per pair of ranks that exchange messages ---*/
+  
+  Profile_File.open("comm_matrix.csv", ios::out);
+  
+  Profile_File << "\"Source_Rank\", \"Destination_Rank\", \"Bytes\"" << endl;
+  
+  size_t offset = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    for (int iRow = 0; iRow < nRow_all[iRank]; iRow += 2)
+      Profile_File << iRank << ", " << row_all[offset+iRow] << ", " << row_all[offset+iRow+1] << endl;
+    offset += nRow_all[iRank];
+  }
+  
+  Profile_File.close();
+  
+}
@@ -39,10 +39,21 @@
 #include "../include/fem_gauss_jacobi_quadrature.hpp"
 #include "../include/fem_geometry_structure.hpp"
 
-vector<string> Profile_Function_tp;       /*!< \brief Vector of string names for profiled functions. */
-vector<double> Profile_Time_tp;           /*!< \brief Vector of elapsed time for profiled functions. */
-vector<double> Profile_ID_tp;             /*!< \brief Vector of group ID number for profiled functions. */
-map<string, vector<int> > Profile_Map_tp; /*!< \brief Map containing the final results for profiled functions. */
+map<string, int> Profile_Map_tp;          /*!< \brief Map, which maps the name of a profiled function to the index
+                                                      where its data is stored in the vectors below. */
+vector<int>    Profile_ID_tp;             /*!< \brief Group ID number of the profiled functions. */
+vector<long>   Profile_NCalls_tp;         /*!< \brief Number of calls of the profiled functions. */
+vector<double> Profile_TotTime_tp;        /*!< \brief Total time spent in the profiled functions. */
+vector<double> Profile_MinTime_tp;        /*!< \brief Minimum time of a call of the profiled functions. */
+vector<double> Profile_MaxTime_tp;        /*!< \brief Maximum time of a call of the profiled functions. */
+
+#ifdef HAVE_PAPI
+#include <papi.h>
+int Profile_PAPI_EventSet = PAPI_NULL;    /*!< \brief Event set of the hardware counters. */
+vector<int> Profile_PAPI_Events;          /*!< \brief Hardware counters available on this machine. */
+vector<long long> Profile_PAPI_Stack;     /*!< \brief Counter values at the start of the open (nested) sections. */
+vector<long long> Profile_PAPI_Counters_tp; /*!< \brief Accumulated counters of the profiled functions. */
+#endif
 
 map<CLong3T, int> GEMM_Profile_MNK;       /*!< \brief Map, which maps the GEMM size to the index where
                                                       the data for this GEMM is stored in several vectors. */
@@ -52,11 +63,19 @@ vector<double> GEMM_Profile_TotTime;      /*!< \brief Total time spent for this
 vector<double> GEMM_Profile_MinTime;      /*!< \brief Minimum time spent for this GEMM size. */
 vector<double> GEMM_Profile_MaxTime;      /*!< \brief Maximum time spent for this GEMM size. */
 
-//#pragma omp threadprivate(Profile_Function_tp, Profile_Time_tp, Profile_ID_tp, Profile_Map_tp)
+//#pragma omp threadprivate(Profile_Map_tp, Profile_ID_tp, Profile_NCalls_tp, Profile_TotTime_tp, Profile_MinTime_tp, Profile_MaxTime_tp)
 
 #include "../include/ad_structure.hpp"
+#include "../include/reproducible_sum.hpp"
+#include "../include/comm_profiler.hpp"
 #include "../include/toolboxes/printing_toolbox.hpp"
 
+map<string, string> Config_File_Text;     /*!< \brief Contents of the configuration files read so far (master node). */
+map<string, vector<pair<string, vector<string> > > >
+                    Config_File_Tokens;   /*!< \brief Options (name and tokenized values) of the configuration files
+                                                      read so far, such that a file shared by several zones or
+                                                      drivers is only read and tokenized once. */
+
 CConfig::CConfig(char case_filename[MAX_STRING_SIZE], unsigned short val_software, unsigned short val_iZone, unsigned short val_nZone, unsigned short val_nDim, unsigned short verb_level) {
   
   /*--- Store MPI rank and size ---*/ 
@@ -380,6 +399,7 @@ void CConfig::SetPointersNull(void) {
   Marker_DV                   = NULL;   Marker_Moving            = NULL;    Marker_Monitoring = NULL;
   Marker_Designing            = NULL;   Marker_GeoEval           = NULL;    Marker_Plotting   = NULL;
   Marker_Analyze              = NULL;   Marker_PyCustom          = NULL;    Marker_WallFunctions        = NULL;
+  Compact_Restart_Fields      = NULL;   Volume_Output_Fields     = NULL;
   Marker_CfgFile_KindBC       = NULL;   Marker_All_KindBC        = NULL;
 
   Kind_WallFunctions       = NULL;
@@ -495,7 +515,9 @@ void CConfig::SetPointersNull(void) {
   Inc_Velocity_Init   = NULL;
 
   RefOriginMoment     = NULL;
-  CFL_AdaptParam      = NULL;            
+  CFL_AdaptParam      = NULL;
+  CFL_AdaptParam_LinSol = NULL;            
+  Local_Freezing_Param = NULL;
   CFL                 = NULL;
   HTP_Axis = NULL;
   PlaneTag            = NULL;
@@ -538,7 +560,10 @@ void CConfig::SetPointersNull(void) {
   Plunging_Omega_X    = NULL;    Plunging_Omega_Y    = NULL;    Plunging_Omega_Z    = NULL;
   Plunging_Ampl_X     = NULL;    Plunging_Ampl_Y     = NULL;    Plunging_Ampl_Z     = NULL;
   RefOriginMoment_X   = NULL;    RefOriginMoment_Y   = NULL;    RefOriginMoment_Z   = NULL;
+  Ensemble_AoA        = NULL;    Ensemble_AoS        = NULL;
   MoveMotion_Origin   = NULL;
+  Partition_Cache_Ranks = NULL;
+  Output_Single_Fields = NULL;   Output_Quantized_Fields = NULL;   Output_Quantization_Error = NULL;
   Periodic_Translate  = NULL;    Periodic_Rotation   = NULL;    Periodic_Center     = NULL;
   Periodic_Translation= NULL;    Periodic_RotAngles  = NULL;    Periodic_RotCenter  = NULL;
 
@@ -553,6 +578,8 @@ void CConfig::SetPointersNull(void) {
   default_eng_cyl            = NULL;
   default_eng_val            = NULL;
   default_cfl_adapt          = NULL;
+  default_cfl_adapt_linsol   = NULL;
+  default_local_freezing     = NULL;
   default_jst_coeff          = NULL;
   default_ffd_coeff          = NULL;
   default_mixedout_coeff     = NULL;
@@ -662,6 +689,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_eng_cyl            = new su2double[7];
   default_eng_val            = new su2double[5];
   default_cfl_adapt          = new su2double[4];
+  default_cfl_adapt_linsol   = new su2double[3];
+  default_local_freezing     = new su2double[3];
   default_jst_coeff          = new su2double[2];
   default_ffd_coeff          = new su2double[3];
   default_mixedout_coeff     = new su2double[3];
@@ -756,6 +785,18 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("WRT_BINARY_RESTART", Wrt_Binary_Restart, true);
   /*!\brief BINARY_RESTART \n DESCRIPTION: Read / write binary SU2 native restart files. \n Options: YES, NO \ingroup Config */
   addBoolOption("READ_BINARY_RESTART", Read_Binary_Restart, true);
+  /*!\brief WRT_COMPACT_RESTART \n DESCRIPTION: Write the binary restart files with a selection of fields and the non-solution fields in reduced precision. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_COMPACT_RESTART", Wrt_Compact_Restart, false);
+  /*!\brief COMPACT_RESTART_STORAGE \n DESCRIPTION: Storage of the non-solution fields of compact restart files \n OPTIONS: see \link Compact_Restart_Map \endlink \n DEFAULT: FLOAT32 \ingroup Config */
+  addEnumOption("COMPACT_RESTART_STORAGE", Kind_Compact_Restart, Compact_Restart_Map, COMPACT_FLOAT32);
+  /*!\brief COMPACT_RESTART_FIELDS \n DESCRIPTION: Fields of compact restart files in addition to the ones needed to restart \ingroup Config */
+  addStringListOption("COMPACT_RESTART_FIELDS", nCompact_Restart_Fields, Compact_Restart_Fields);
+  /*!\brief WRT_ASYNC_RESTART \n DESCRIPTION: Write the binary restart files with a background thread while the solver proceeds. \n Options: YES, NO \ingroup Config */
+  addBoolOption("WRT_ASYNC_RESTART", Wrt_Async_Restart, false);
+  /*!\brief RESTART_INTERPOLATE \n DESCRIPTION: The solution files are from a different mesh, their values are interpolated to the points of this mesh (nearest donor point). \n Options: NO, YES \ingroup Config */
+  addBoolOption("RESTART_INTERPOLATE", Restart_Interpolate, false);
+  /*!\brief RESTART_INTERPOLATE_MESH \n DESCRIPTION: Native mesh file of the solution files interpolated with RESTART_INTERPOLATE, the values are interpolated linearly in its elements (NONE: nearest point) \ingroup Config */
+  addStringOption("RESTART_INTERPOLATE_MESH", Restart_Interpolate_Mesh, string("NONE"));
   /*!\brief SYSTEM_MEASUREMENTS \n DESCRIPTION: System of measurements \n OPTIONS: see \link Measurements_Map \endlink \n DEFAULT: SI \ingroup Config*/
   addEnumOption("SYSTEM_MEASUREMENTS", SystemMeasurements, Measurements_Map, SI);
 
@@ -795,6 +836,20 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Critical Density, default value for MDM */
    addDoubleOption("ACENTRIC_FACTOR", Acentric_Factor, 0.035);
 
+  /*--- Options related to the look-up table for VAN der WAALS MODEL and PENG ROBINSON ---*/
+  /* DESCRIPTION: Replace the real gas model by a look-up table generated from it */
+  addBoolOption("LUT_FLUID_MODEL", LUT_FluidModel, false);
+  /* DESCRIPTION: Number of points per direction of the look-up tables */
+  addUnsignedShortOption("LUT_NPOINTS", LUT_nPoints, 200);
+  /* DESCRIPTION: File in which the look-up tables are cached */
+  addStringOption("LUT_FILENAME", LUT_FileName, string("fluid_lut.dat"));
+  /* DESCRIPTION: Pressure range of the look-up tables (0.0 = determined from the free-stream) */
+  addDoubleOption("LUT_PRESSURE_MIN", LUT_Pressure_Min, 0.0);
+  addDoubleOption("LUT_PRESSURE_MAX", LUT_Pressure_Max, 0.0);
+  /* DESCRIPTION: Temperature range of the look-up tables (0.0 = determined from the free-stream) */
+  addDoubleOption("LUT_TEMPERATURE_MIN", LUT_Temperature_Min, 0.0);
+  addDoubleOption("LUT_TEMPERATURE_MAX", LUT_Temperature_Max, 0.0);
+
    /*--- Options related to Viscosity Model ---*/
   /*!\brief VISCOSITY_MODEL \n DESCRIPTION: model of the viscosity \n OPTIONS: See \link ViscosityModel_Map \endlink \n DEFAULT: SUTHERLAND \ingroup Config*/
   addEnumOption("VISCOSITY_MODEL", Kind_ViscosityModel, ViscosityModel_Map, SUTHERLAND);
@@ -918,6 +973,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("SIDESLIP_ANGLE", AoS, 0.0);
   /*!\brief AOA  \n DESCRIPTION: Angle of attack (degrees, only for compressible flows) \ingroup Config*/
   addDoubleOption("AOA", AoA, 0.0);
+  /* DESCRIPTION: Angles of attack of an ensemble run, the conditions are solved in turn on the same preprocessed grid (degrees) */
+  addDoubleListOption("ENSEMBLE_AOA", nEnsemble_AoA, Ensemble_AoA);
+  /* DESCRIPTION: Side-slip angles of an ensemble run, one per condition (degrees) */
+  addDoubleListOption("ENSEMBLE_SIDESLIP_ANGLE", nEnsemble_AoS, Ensemble_AoS);
   /* DESCRIPTION: Activate fixed CL mode (specify a CL instead of AoA). */
   addBoolOption("FIXED_CL_MODE", Fixed_CL_Mode, false);
   /* DESCRIPTION: Activate fixed CM mode (specify a CM instead of iH). */
@@ -940,6 +999,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("UPDATE_IH", Update_iH, 5);
   /* DESCRIPTION: Number of iterations to evaluate dCL_dAlpha . */
   addUnsignedLongOption("ITER_DCL_DALPHA", Iter_dCL_dAlpha, 500);
+  /* DESCRIPTION: Update AoA by Newton steps with dCL_dAlpha estimated from the previous updates (fixed CL mode) */
+  addBoolOption("FIXED_CL_NEWTON", Fixed_CL_Newton, false);
+  /* DESCRIPTION: Drop of the density residual (orders of magnitude) since the last AoA change that triggers the next Newton update */
+  addDoubleOption("FIXED_CL_NEWTON_RESIDUAL", Fixed_CL_Newton_Residual, 2.0);
   /* DESCRIPTION: Damping factor for fixed CL mode. */
   addDoubleOption("DNETTHRUST_DBCTHRUST", dNetThrust_dBCThrust, 1.0);
   /* DESCRIPTION: Number of times Alpha is updated in a fix CL problem. */
@@ -1218,6 +1281,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("CFL_NUMBER_SOLID", CFLSolid, 1.25);
   /* DESCRIPTION:  Max time step in local time stepping simulations */
   addDoubleOption("MAX_DELTA_TIME", Max_DeltaTime, 1000000);
+  /*!\brief REUSE_SPECTRAL_RADIUS
+   *  \n DESCRIPTION: Take the inviscid spectral radius of the local time step from the edge loops of the residual
+   *  (max. eigenvalue of the centered schemes, previous upwind residual otherwise). \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("REUSE_SPECTRAL_RADIUS", Reuse_Spectral_Radius, false);
+  /* DESCRIPTION: Jacobi sweeps of the central implicit residual smoothing of the explicit flow schemes (0 disables it) */
+  addUnsignedShortOption("RES_SMOOTHING_ITER", nRes_Smooth_Iter, 0);
+  /* DESCRIPTION: Coefficient of the central implicit residual smoothing */
+  addDoubleOption("RES_SMOOTHING_COEFF", Res_Smooth_Coeff, 0.5);
   /* DESCRIPTION: Activate The adaptive CFL number. */
   addBoolOption("CFL_ADAPT", CFL_Adapt, false);
   /* !\brief CFL_ADAPT_PARAM
@@ -1226,6 +1297,24 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
    * and decrease when the residual is increasing or stalled. \ingroup Config*/
   default_cfl_adapt[0] = 0.0; default_cfl_adapt[1] = 0.0; default_cfl_adapt[2] = 1.0; default_cfl_adapt[3] = 100.0;
   addDoubleArrayOption("CFL_ADAPT_PARAM", 4, CFL_AdaptParam, default_cfl_adapt);
+  /* DESCRIPTION: Adapt the CFL number with the residual reduction of the linear solver, the trend of
+   the nonlinear residual and the number of non-physical points (uses the limits of CFL_ADAPT_PARAM). */
+  addBoolOption("CFL_ADAPT_LINSOL", CFL_Adapt_LinSol, false);
+  /* !\brief CFL_ADAPT_LINSOL_PARAM
+   * DESCRIPTION: Parameters of the CFL controller with linear solver feedback (factor down < 1, factor up > 1,
+   * required reduction of the linear residual). \ingroup Config*/
+  default_cfl_adapt_linsol[0] = 0.5; default_cfl_adapt_linsol[1] = 1.1; default_cfl_adapt_linsol[2] = 0.5;
+  addDoubleArrayOption("CFL_ADAPT_LINSOL_PARAM", 3, CFL_AdaptParam_LinSol, default_cfl_adapt_linsol);
+  /* DESCRIPTION: Reduce the CFL number locally at the non-physical points (with CFL_ADAPT_LINSOL). */
+  addBoolOption("CFL_ADAPT_LOCAL", CFL_Adapt_Local, false);
+  /* DESCRIPTION: Freeze the points whose residual has converged locally, only the edges of the
+   active points are computed between periodic sweeps of the entire domain. */
+  addBoolOption("LOCAL_FREEZING", Local_Freezing, false);
+  /* !\brief LOCAL_FREEZING_PARAM
+   * DESCRIPTION: Parameters of the local freezing (residual of a point relative to the largest residual
+   * below which the point is frozen, iterations between sweeps of the entire domain, first frozen iteration). \ingroup Config*/
+  default_local_freezing[0] = 1E-3; default_local_freezing[1] = 10.0; default_local_freezing[2] = 100.0;
+  addDoubleArrayOption("LOCAL_FREEZING_PARAM", 3, Local_Freezing_Param, default_local_freezing);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the adjoint problem */
   addDoubleOption("CFL_REDUCTION_ADJFLOW", CFLRedCoeff_AdjFlow, 0.8);
   /* DESCRIPTION: Reduction factor of the CFL coefficient in the level set problem */
@@ -1251,6 +1340,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("UNST_CFL_NUMBER", Unst_CFL, 0.0);
   /* DESCRIPTION: Number of internal iterations (dual time method) */
   addUnsignedLongOption("UNST_INT_ITER", Unst_nIntIter, 100);
+  /* DESCRIPTION: Reduction (orders of magnitude) of the flow residual that ends the internal iterations of a time step, 0 to disable */
+  addDoubleOption("UNST_RESIDUAL_DROP", Unst_Residual_Drop, 0.0);
+  /* DESCRIPTION: Extrapolate the initial solution of each time step from the two previous time steps */
+  addBoolOption("UNST_PREDICTOR", Unst_Predictor, false);
   /* DESCRIPTION: Integer number of periodic time instances for Harmonic Balance */
   addUnsignedShortOption("TIME_INSTANCES", nTimeInstances, 1);
   /* DESCRIPTION: Time period for Harmonic Balance wihtout moving meshes */
@@ -1261,6 +1354,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addLongOption("UNST_RESTART_ITER", Unst_RestartIter, 0);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
+  /* DESCRIPTION: Number of checkpoints of the direct solution kept in memory for the unsteady discrete adjoint */
+  addUnsignedShortOption("UNST_ADJOINT_CHECKPOINTS", Unst_Adjoint_nCheckpoint, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
   addLongOption("ITER_AVERAGE_OBJ", Iter_Avg_Objective , 0);
   /* DESCRIPTION: Iteration number to begin unsteady restarts (structural analysis) */
@@ -1301,10 +1396,29 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addUnsignedLongOption("LINEAR_SOLVER_ITER", Linear_Solver_Iter, 10);
   /* DESCRIPTION: Max iterations of the linear solver for the FVM heat solver. */
   addUnsignedLongOption("LINEAR_SOLVER_ITER_HEAT", Linear_Solver_Iter_Heat, 10);
+  /* DESCRIPTION: Assemble the operator of the solid heat solver and its preconditioner once, only the right-hand side and
+   the time step and CHT interface diagonal terms are updated afterwards. */
+  addBoolOption("LINEAR_SOLVER_REUSE_HEAT", Linear_Solver_Reuse_Heat, false);
   /* DESCRIPTION: Fill in level for the ILU preconditioner */
   addUnsignedShortOption("LINEAR_SOLVER_ILU_FILL_IN", Linear_Solver_ILU_n, 0);
+  /* DESCRIPTION: Layers of halo points added to each partition by the RAS preconditioner */
+  addUnsignedShortOption("LINEAR_SOLVER_RAS_OVERLAP", Linear_Solver_RAS_Overlap, 1);
+  /* DESCRIPTION: Store and apply the ILU and Jacobi preconditioners of the Krylov solvers in single precision */
+  addBoolOption("LINEAR_SOLVER_MIXED_PRECISION", Linear_Solver_Mixed_Precision, false);
+  /* DESCRIPTION: Jacobian-free Newton-Krylov, the Krylov solver of the flow equations uses finite differences of the residual */
+  addBoolOption("NEWTON_KRYLOV", Newton_Krylov, false);
+  /* DESCRIPTION: Solve the implicit mean flow and turbulence (SA) systems as one coupled linear system */
+  addBoolOption("COUPLED_TURB_IMPLICIT", Coupled_Turb_Implicit, false);
+  /* DESCRIPTION: Maximum number of nonlinear iterations between two assemblies of the Jacobian of steady implicit solves */
+  addUnsignedShortOption("JACOBIAN_LAG", Jacobian_Lag, 1);
+  /* DESCRIPTION: Store the flow Jacobian as diagonal blocks and two blocks per edge, without column indices */
+  addBoolOption("JACOBIAN_EDGE_FORMAT", Jacobian_Edge_Format, false);
+  /* DESCRIPTION: Exact parallel sums for the inner products of the linear solvers, the residual RMS and the force coefficients */
+  addBoolOption("REPRODUCIBLE_REDUCTIONS", Reproducible_Reductions, false);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("LINEAR_SOLVER_RESTART_FREQUENCY", Linear_Solver_Restart_Frequency, 10);
+  /* DESCRIPTION: Number of directions GCRO-DR recycles from one linear solve to the next */
+  addUnsignedShortOption("LINEAR_SOLVER_RECYCLE_SIZE", Linear_Solver_Recycle_Size, 5);
   /* DESCRIPTION: Relaxation of the flow equations solver for the implicit formulation */
   addDoubleOption("RELAXATION_FACTOR_FLOW", Relaxation_Factor_Flow, 1.0);
   /* DESCRIPTION: Relaxation of the turb equations solver for the implicit formulation */
@@ -1337,6 +1451,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addEnumOption("DISCADJ_LIN_SOLVER", Kind_DiscAdj_Linear_Solver, Linear_Solver_Map, FGMRES);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
   addEnumOption("DISCADJ_LIN_PREC", Kind_DiscAdj_Linear_Prec, Linear_Solver_Prec_Map, ILU);
+  /* DESCRIPTION: Start the discrete adjoint linear solves from the solution of the previous one with the same matrix */
+  addBoolOption("DISCADJ_LIN_WARM_START", DiscAdj_Linear_WarmStart, false);
   /* DESCRIPTION: Linear solver for the discete adjoint systems */
   addEnumOption("FSI_DISCADJ_LIN_SOLVER_STRUC", Kind_DiscAdj_Linear_Solver_FSI_Struc, Linear_Solver_Map, CONJUGATE_GRADIENT);
   /* DESCRIPTION: Preconditioner for the discrete adjoint Krylov linear solvers */
@@ -1405,6 +1521,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_INTERFACE_AGGLOMERATION\n DESCRIPTION: Agglomerate the points of the partition interfaces (SEND_RECEIVE) as interior points, instead of as a boundary surface. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_INTERFACE_AGGLOMERATION", MG_Interface_Agglomeration, false);
+  /*!\brief MG_ADAPTIVE_CYCLE\n DESCRIPTION: Adapt the smoothing sweeps of the coarse levels, the cycle (V or W), and the number of visited levels from the measured residual reduction. DEFAULT: NO \ingroup Config*/
+  addBoolOption("MG_ADAPTIVE_CYCLE", MG_Adaptive_Cycle, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -1412,6 +1532,21 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief NUM_METHOD_GRAD
    *  \n DESCRIPTION: Numerical method for spatial gradients \n OPTIONS: See \link Gradient_Map \endlink. \n DEFAULT: WEIGHTED_LEAST_SQUARES. \ingroup Config*/
   addEnumOption("NUM_METHOD_GRAD", Kind_Gradient_Method, Gradient_Map, WEIGHTED_LEAST_SQUARES);
+  /*!\brief FUSED_GRADIENT_LIMITER
+   *  \n DESCRIPTION: Compute the gradient and the limiter bounds of the flow in a single pass, with one halo exchange. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("FUSED_GRADIENT_LIMITER", Fused_Gradient_Limiter, false);
+  /*!\brief CACHE_LS_WEIGHTS
+   *  \n DESCRIPTION: Precompute the weights of the least-squares gradients once per geometry (refreshed when the grid moves). \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("CACHE_LS_WEIGHTS", Cache_LS_Weights, false);
+  /*!\brief EDGE_COLORING
+   *  \n DESCRIPTION: Group the edges in colors without shared points and traverse the edge loops color by color. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("EDGE_COLORING", Edge_Coloring, false);
+  /*!\brief NUMBER_THREADS_FLOW
+   *  \n DESCRIPTION: Number of threads per rank that carry out the colors of the convective edge loops of the compressible flow solver, more than one thread implies EDGE_COLORING= YES. \n DEFAULT: 1 \ingroup Config*/
+  addUnsignedShortOption("NUMBER_THREADS_FLOW", nThreads_Flow, 1);
+  /*!\brief POINT_ORDERING
+   *  \n DESCRIPTION: Renumbering of the points of each partition, the edges follow the order of their first point. \n OPTIONS: See \link Point_Ordering_Map \endlink. \n DEFAULT: RCM \ingroup Config*/
+  addEnumOption("POINT_ORDERING", Kind_Point_Ordering, Point_Ordering_Map, RCM_ORDERING);
   /*!\brief VENKAT_LIMITER_COEFF
    *  \n DESCRIPTION: Coefficient for the limiter. DEFAULT value 0.5. Larger values decrease the extent of limiting, values approaching zero cause lower-order approximation to the solution. \ingroup Config */
   addDoubleOption("VENKAT_LIMITER_COEFF", Venkat_LimiterCoeff, 0.05);
@@ -1425,6 +1560,8 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief CONV_NUM_METHOD_FLOW
    *  \n DESCRIPTION: Convective numerical method \n OPTIONS: See \link Upwind_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
   addConvectOption("CONV_NUM_METHOD_FLOW", Kind_ConvNumScheme_Flow, Kind_Centered_Flow, Kind_Upwind_Flow);
+  /*!\brief BATCH_FLUX \n DESCRIPTION: Evaluate the convective fluxes of the flow equations in batches of edges (SIMD) \ingroup Config*/
+  addBoolOption("BATCH_FLUX", Batch_Flux, false);
 
   /*!\brief NUM_METHOD_FEM_FLOW
    *  \n DESCRIPTION: Numerical method \n OPTIONS: See \link FEM_Map \endlink , \link Centered_Map \endlink. \ingroup Config*/
@@ -1540,14 +1677,35 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("DRAG_IN_SONICBOOM", WeightCd, 0.0);
   /* DESCRIPTION: Sensitivity smoothing  */
   addEnumOption("SENS_SMOOTHING", Kind_SensSmooth, Sens_Smoothing_Map, NO_SMOOTH);
+  /* DESCRIPTION: Coefficient of the surface Laplace-Beltrami term of the sensitivity smoothing */
+  addDoubleOption("SENS_SMOOTHING_COEFF", SensSmooth_Coeff, 5E-5);
   /* DESCRIPTION: Continuous Adjoint frozen viscosity */
   addBoolOption("FROZEN_VISC_CONT", Frozen_Visc_Cont, true);
+  /* DESCRIPTION: Solve the implicit continuous adjoint with the transposed Jacobian of the last flow iteration */
+  addBoolOption("CONT_ADJ_PRIMAL_JACOBIAN", Cont_Adj_Primal_Jacobian, false);
   /* DESCRIPTION: Discrete Adjoint frozen viscosity */
   addBoolOption("FROZEN_VISC_DISC", Frozen_Visc_Disc, false);
   /* DESCRIPTION: Discrete Adjoint frozen limiter */
   addBoolOption("FROZEN_LIMITER_DISC", Frozen_Limiter_Disc, false);
   /* DESCRIPTION: Use an inconsistent (primal/dual) discrete adjoint formulation */
   addBoolOption("INCONSISTENT_DISC", Inconsistent_Disc, false);
+  /* DESCRIPTION: Solve the steady discrete adjoint with FGMRES on the linearized fixed-point iteration */
+  addBoolOption("DISCADJ_KRYLOV", DiscAdj_Krylov, false);
+  /* DESCRIPTION: Size of the Krylov subspace built in each iteration of the discrete adjoint FGMRES solver */
+  addUnsignedShortOption("DISCADJ_KRYLOV_SIZE", DiscAdj_Krylov_Size, 10);
+  /* DESCRIPTION: Correct the steady discrete adjoint fixed-point iteration on the multigrid levels of the flow solver, with the
+     transposed implicit operators V/dt + dR/dU of the coarse levels (not the transposed residual Jacobians) */
+  addBoolOption("DISCADJ_MULTIGRID", DiscAdj_MultiGrid, false);
+  /* DESCRIPTION: Number of smoothing iterations on each level of the discrete adjoint coarse grid correction */
+  addUnsignedShortOption("DISCADJ_MULTIGRID_ITER", DiscAdj_MultiGrid_Iter, 5);
+  /* DESCRIPTION: Number of previous iterates of the Anderson acceleration of the steady fixed-point iterations of the flow and discrete adjoint solvers (0 disables it) */
+  addUnsignedShortOption("ANDERSON_DEPTH", Anderson_Depth, 0);
+  /* DESCRIPTION: Relaxation of the residual in the Anderson acceleration */
+  addDoubleOption("ANDERSON_RELAXATION", Anderson_Relaxation, 1.0);
+  /* DESCRIPTION: Solve the discrete adjoint of each OBJECTIVE_FUNCTION in turn on the same recording, instead of their weighted sum */
+  addBoolOption("DISCADJ_OBJECTIVE_SWEEP", DiscAdj_ObjSweep, false);
+  /* DESCRIPTION: Evaluate the mesh sensitivities of the steady discrete adjoint only once, after its last iteration */
+  addBoolOption("DISCADJ_SENS_FINAL", DiscAdj_Sens_Final, false);
    /* DESCRIPTION:  */
   addDoubleOption("FIX_AZIMUTHAL_LINE", FixAzimuthalLine, 90.0);
   /*!\brief SENS_REMOVE_SHARP
@@ -1562,10 +1720,30 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   /*!\brief OUTPUT_FORMAT \n DESCRIPTION: I/O format for output plots. \n OPTIONS: see \link Output_Map \endlink \n DEFAULT: TECPLOT \ingroup Config */
   addEnumOption("OUTPUT_FORMAT", Output_FileFormat, Output_Map, TECPLOT);
+  /*!\brief OUTPUT_PRECISION \n DESCRIPTION: Precision of the coordinates and of the fields in the XDMF and Tecplot binary files. \n OPTIONS: see \link Output_Precision_Map \endlink \n DEFAULT: DOUBLE \ingroup Config */
+  addEnumOption("OUTPUT_PRECISION", Output_Precision, Output_Precision_Map, OUTPUT_DOUBLE);
+  /*!\brief OUTPUT_SINGLE_FIELDS \n DESCRIPTION: Fields written in single precision whatever the OUTPUT_PRECISION. \ingroup Config */
+  addStringListOption("OUTPUT_SINGLE_FIELDS", nOutput_Single_Fields, Output_Single_Fields);
+  /*!\brief OUTPUT_QUANTIZED_FIELDS \n DESCRIPTION: Fields of the XDMF files written as 1 or 2 byte integers between the extrema of the field (single precision in the Tecplot binary files). \ingroup Config */
+  addStringListOption("OUTPUT_QUANTIZED_FIELDS", nOutput_Quantized_Fields, Output_Quantized_Fields);
+  /*!\brief OUTPUT_QUANTIZATION_ERROR \n DESCRIPTION: Bound of the absolute error of the quantized fields, one for all fields or one per field. Without bound the fields are quantized to 2 bytes. \ingroup Config */
+  addDoubleListOption("OUTPUT_QUANTIZATION_ERROR", nOutput_Quantization_Error, Output_Quantization_Error);
   /*!\brief ACTDISK_JUMP \n DESCRIPTION: The jump is given by the difference in values or a ratio */
   addEnumOption("ACTDISK_JUMP", ActDisk_Jump, Jump_Map, DIFFERENCE);
   /*!\brief MESH_FORMAT \n DESCRIPTION: Mesh input file format \n OPTIONS: see \link Input_Map \endlink \n DEFAULT: SU2 \ingroup Config*/
   addEnumOption("MESH_FORMAT", Mesh_FileFormat, Input_Map, SU2);
+  /*!\brief MESH_OFFSETS_INDEX \n DESCRIPTION: Read the SU2 mesh with an index of the byte offsets of its sections (mesh file name + .idx, created when missing or outdated). \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("MESH_OFFSETS_INDEX", Mesh_Offsets_Index, false);
+  /*!\brief PARTITION_CACHE \n DESCRIPTION: Store the ParMETIS partitioning of the mesh by global point index (mesh file name + .part_<ranks>_<zone>) and reuse it in later runs with the same mesh and number of ranks. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("PARTITION_CACHE", Partition_Cache, false);
+  /*!\brief PARTITION_CACHE_RANKS \n DESCRIPTION: Other numbers of ranks for which the partitioning is computed and stored in the partition cache, to resize a job without partitioning the mesh again. \ingroup Config*/
+  addUShortListOption("PARTITION_CACHE_RANKS", nPartition_Cache_Ranks, Partition_Cache_Ranks);
+  /*!\brief PARTITION_WEIGHTS \n DESCRIPTION: Multi-constraint graph partitioning, the partitions are balanced both on the number of edges and on the number of boundary vertices of their points. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("PARTITION_WEIGHTS", Partition_Weights, false);
+  /*!\brief SHARED_MEMORY_COMMS \n DESCRIPTION: The halo messages between ranks of the same node go through MPI-3 shared memory windows instead of point-to-point messages. \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("SHARED_MEMORY_COMMS", Shared_Memory_Comms, false);
+  /*!\brief COMM_PROFILING \n DESCRIPTION: Statistics of the halo exchanges and of the reductions of the linear solvers (messages, bytes per rank, wait times), and computation time of every rank, written at the end of the run (comm_profiling.csv, comm_ranks.csv, comm_matrix.csv). \n DEFAULT: NO \ingroup Config*/
+  addBoolOption("COMM_PROFILING", Comm_Profiling, false);
   /* DESCRIPTION:  Mesh input file */
   addStringOption("MESH_FILENAME", Mesh_FileName, string("mesh.su2"));
   /*!\brief MESH_OUT_FILENAME \n DESCRIPTION: Mesh output file name. Used when converting, scaling, or deforming a mesh. \n DEFAULT: mesh_out.su2 \ingroup Config*/
@@ -1646,12 +1824,24 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief WRT_SOL_FREQ_DUALTIME
    *  \n DESCRIPTION: Writing solution file frequency for dual time  \ingroup Config*/
   addUnsignedLongOption("WRT_SOL_FREQ_DUALTIME", Wrt_Sol_Freq_DualTime, 1);
+  /*!\brief WRT_SRF_HIST_FREQ
+   *  \n DESCRIPTION: Writing frequency (in time steps) of the surface pressure history of unsteady problems, 0 disables it  \ingroup Config*/
+  addUnsignedLongOption("WRT_SRF_HIST_FREQ", Wrt_Srf_Hist_Freq, 0);
+  /*!\brief WRT_TIME_AVERAGE
+   *  \n DESCRIPTION: Accumulate the time averages, pressure RMS and Reynolds stresses of unsteady flows and write them with the solution  \ingroup Config*/
+  addBoolOption("WRT_TIME_AVERAGE", Wrt_Time_Average, false);
+  /*!\brief TIME_AVERAGE_START_ITER
+   *  \n DESCRIPTION: Time step from which the time averages are accumulated  \ingroup Config*/
+  addUnsignedLongOption("TIME_AVERAGE_START_ITER", Time_Average_Start_Iter, 0);
   /*!\brief WRT_CON_FREQ
    *  \n DESCRIPTION: Writing convergence history frequency  \ingroup Config*/
   addUnsignedLongOption("WRT_CON_FREQ",  Wrt_Con_Freq, 1);
   /*!\brief WRT_CON_FREQ_DUALTIME
    *  \n DESCRIPTION: Writing convergence history frequency for the dual time  \ingroup Config*/
   addUnsignedLongOption("WRT_CON_FREQ_DUALTIME",  Wrt_Con_Freq_DualTime, 10);
+  /*!\brief HISTORY_FLUSH_FREQ
+   *  \n DESCRIPTION: Number of lines buffered before the convergence history file is flushed to disk  \ingroup Config*/
+  addUnsignedLongOption("HISTORY_FLUSH_FREQ", History_Flush_Freq, 1);
   /*!\brief LOW_MEMORY_OUTPUT
    *  \n DESCRIPTION: Output less information for lower memory use.  \ingroup Config*/
   addBoolOption("LOW_MEMORY_OUTPUT", Low_MemoryOutput, false);
@@ -1682,6 +1872,12 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /*!\brief WRT_SHARPEDGES
    *  \n DESCRIPTION: Output sharp edge limiter information to solution/restart file  \ingroup Config*/
   addBoolOption("WRT_SHARPEDGES", Wrt_SharpEdges, false);
+  /*!\brief VOLUME_OUTPUT_FIELDS
+   *  \n DESCRIPTION: Derived flow fields that are computed and written to the solution/restart file
+   *  (PRESSURE, TEMPERATURE, MACH, PRESSURE_COEFF, LAMINAR_VISCOSITY, SKIN_FRICTION, HEAT_FLUX, BUFFET,
+   *  Y_PLUS, EDDY_VISCOSITY, INTERMITTENCY, DES_LENGTHSCALE, ROE_DISSIPATION, DENSITY, SPECIFIC_HEAT,
+   *  THERMAL_CONDUCTIVITY). All of them if not given.  \ingroup Config*/
+  addStringListOption("VOLUME_OUTPUT_FIELDS", nVolume_Output_Fields, Volume_Output_Fields);
   /* DESCRIPTION: Output the rind layers in the solution files  \ingroup Config*/
   addBoolOption("WRT_HALO", Wrt_Halo, false);
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
@@ -1897,6 +2093,22 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("DEFORM_LIMIT", Deform_Limit, 1E6);
   /* DESCRIPTION: Type of element stiffness imposed for FEA mesh deformation (INVERSE_VOLUME, WALL_DISTANCE, CONSTANT_STIFFNESS) */
   addEnumOption("DEFORM_STIFFNESS_TYPE", Deform_Stiffness_Type, Deform_Stiffness_Map, SOLID_WALL_DISTANCE);
+  /* DESCRIPTION: Method of the volumetric mesh deformation (ELASTICITY, RBF) */
+  addEnumOption("DEFORM_METHOD", Kind_Deform_Method, Deform_Method_Map, FEA_DEFORMATION);
+  /* DESCRIPTION: Reuse of the linear system of the FEA mesh deformation across increments and deformations (NONE, PRECONDITIONER, STIFFNESS_MATRIX) */
+  addEnumOption("DEFORM_REUSE", Kind_Deform_Reuse, Deform_Reuse_Map, NO_REUSE);
+  /* DESCRIPTION: Rebuild the reused system when the linear iterations grow by this ratio, or the iteration limit is reached */
+  addDoubleOption("DEFORM_REBUILD_RATIO", Deform_Rebuild_Ratio, 2.0);
+  /* DESCRIPTION: Support radius of the radial basis functions (KIND_RADIAL_BASIS_FUNCTION) of the RBF mesh deformation */
+  addDoubleOption("DEFORM_RBF_RADIUS", Deform_RBF_Radius, 1.0);
+  /* DESCRIPTION: Tolerance of the greedy selection of the RBF control points, relative to the maximum surface displacement */
+  addDoubleOption("DEFORM_RBF_TOLERANCE", Deform_RBF_Tolerance, 1E-3);
+  /* DESCRIPTION: Maximum number of surface control points of the RBF mesh deformation */
+  addUnsignedLongOption("DEFORM_RBF_MAX_POINTS", Deform_RBF_MaxPoints, 1000);
+  /* DESCRIPTION: Update the wall distance of RANS cases after each deformation of the mesh, refitting the ADT of the walls */
+  addBoolOption("UPDATE_WALL_DISTANCE", Update_Wall_Distance, false);
+  /* DESCRIPTION: Recompute the dual grid only for the elements and coarse control volumes around the moved points */
+  addBoolOption("PARTIAL_DUAL_GRID_UPDATE", Partial_DualGrid_Update, false);
   /* DESCRIPTION: Poisson's ratio for constant stiffness FEA method of grid deformation*/
   addDoubleOption("DEFORM_ELASTICITY_MODULUS", Deform_ElasticityMod, 2E11);
   /* DESCRIPTION: Young's modulus and Poisson's ratio for constant stiffness FEA method of grid deformation*/
@@ -1909,6 +2121,9 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Number of threads per rank of the FEA mesh deformation, they assemble the
+   stiffness matrix and share the products and preconditioners of the linear solver (1 by default) */
+  addUnsignedShortOption("NUMBER_THREADS_DEFORM", nThreads_Deform, 1);
 
   /*!\par CONFIG_CATEGORY: Rotorcraft problem \ingroup Config*/
   /*--- option related to rotorcraft problems ---*/
@@ -1929,6 +2144,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("QUADRATURE_FACTOR_CURVED_FEM", Quadrature_Factor_Curved, 3.0);
   /* DESCRIPTION: Factor applied during quadrature in time for ADER-DG. (2.0 by default) */
   addDoubleOption("QUADRATURE_FACTOR_TIME_ADER_DG", Quadrature_Factor_Time_ADER_DG, 2.0);
+  /* DESCRIPTION: Relative tolerance of the iterative predictor step of ADER-DG. (1.e-6 by default) */
+  addDoubleOption("TOL_PREDICTOR_ADER_DG", Tol_Predictor_ADER_DG, 1.e-6);
+  /* DESCRIPTION: Maximum number of iterations of the predictor step of ADER-DG per element. (1000 by default) */
+  addUnsignedShortOption("MAX_ITER_PREDICTOR_ADER_DG", MaxIter_Predictor_ADER_DG, 1000);
   /* DESCRIPTION: Factor for the symmetrizing terms in the DG FEM discretization (1.0 by default) */
   addDoubleOption("THETA_INTERIOR_PENALTY_DG_FEM", Theta_Interior_Penalty_DGFEM, 1.0);
   /* DESCRIPTION: Compute the entropy in the fluid model (YES, NO) */
@@ -1940,6 +2159,16 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
+  /* DESCRIPTION: Number of threads per rank for the tasks of the DG solver (1 by default) */
+  addUnsignedShortOption("NUMBER_THREADS_DGFEM", nThreads_DGFEM, 1);
+  /* DESCRIPTION: Sum-factorization for the volume integrals of tensor product elements (NO, YES) */
+  addBoolOption("SUM_FACTORIZATION_DGFEM", SumFactorization_DGFEM, false);
+  /* DESCRIPTION: Store the metric terms only once for elements with constant metric terms (NO, YES) */
+  addBoolOption("COMPRESSED_METRIC_TERMS_DGFEM", Compressed_MetricTerms_DGFEM, false);
+  /* DESCRIPTION: Number of evaluations of the DG tasks list between two load imbalance reports, diagnostic only (0 by default, no report) */
+  addUnsignedLongOption("LOAD_IMBALANCE_REPORT_FREQ_DGFEM", LoadImbalance_Report_Freq_DGFEM, 0);
+  /* DESCRIPTION: Ratio of the maximum and average work per rank above which the DG load imbalance is reported, diagnostic only (1.1 by default) */
+  addDoubleOption("LOAD_IMBALANCE_REPORT_TOL_DGFEM", LoadImbalance_Report_Tol_DGFEM, 1.1);
 
   /*!\par CONFIG_CATEGORY: FEA solver \ingroup Config*/
   /*--- Options related to the FEA solver ---*/
@@ -2007,6 +2236,14 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addBoolOption("PRESTRETCH", Prestretch, false);
   /*!\brief PRESTRETCH_FILENAME \n DESCRIPTION: Filename to input for prestretching membranes \n Default: prestretch_file.dat \ingroup Config */
   addStringOption("PRESTRETCH_FILENAME", Prestretch_FEMFileName, string("prestretch_file.dat"));
+  /* DESCRIPTION: Number of threads per rank that assemble the elements of the structural solver (1 by default) */
+  addUnsignedShortOption("NUMBER_THREADS_FEA", nThreads_FEA, 1);
+  /*  DESCRIPTION: Precompute the shape function gradients of the reference configuration of every element
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("PRECOMPUTE_REF_GRADIENTS_FEA", Precompute_RefGrad_FEA, false);
+  /*  DESCRIPTION: Apply the stiffness matrix of static linear elasticity element by element, without assembling it
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("MATRIX_FREE_FEA", MatrixFree_FEA, false);
 
   /* DESCRIPTION: Iterative method for non-linear structural analysis */
   addEnumOption("NONLINEAR_FEM_SOLUTION_METHOD", Kind_SpaceIteScheme_FEA, Space_Ite_Map_FEA, NEWTON_RAPHSON);
@@ -2148,6 +2385,11 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Radius for radial basis function */
   addDoubleOption("RADIAL_BASIS_FUNCTION_PARAMETER", RadialBasisFunction_Parameter, 1);
 
+  /* DESCRIPTION: Compute the radial basis function weights of each target point from the donor points
+   in the compact support of the basis, which gives sparse transfer coefficients (WENDLAND_C2 only)
+  *  Options: NO, YES \ingroup Config */
+  addBoolOption("RADIAL_BASIS_FUNCTION_SPARSE", RadialBasisFunction_Sparse, false);
+
   /* DESCRIPTION: Maximum number of FSI iterations */
   addUnsignedShortOption("FSI_ITER", nIterFSI, 1);
   /* DESCRIPTION: Number of FSI iterations during which a ramp is applied */
@@ -2160,6 +2402,10 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   addDoubleOption("AITKEN_DYN_MIN_INITIAL", AitkenDynMinInit, 0.5);
   /* DESCRIPTION: Kind of relaxation */
   addEnumOption("BGS_RELAXATION", Kind_BGS_RelaxMethod, AitkenForm_Map, NO_RELAXATION);
+  /* DESCRIPTION: Maximum number of secant vectors kept by the IQN_ILS relaxation */
+  addUnsignedShortOption("IQN_ILS_MAX_VECTORS", IQN_ILS_MaxVectors, 20);
+  /* DESCRIPTION: Number of previous time steps whose secant vectors are reused by the IQN_ILS relaxation */
+  addUnsignedShortOption("IQN_ILS_REUSE_STEPS", IQN_ILS_ReuseSteps, 0);
   /* DESCRIPTION: Relaxation required */
   addBoolOption("RELAXATION", Relaxation, false);
 
@@ -2240,12 +2486,21 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   default_ffd_coeff[0] = 2; default_ffd_coeff[1] = 2; default_ffd_coeff[2] = 2;
   addDoubleArrayOption("FFD_BSPLINE_ORDER", 3, FFD_BSpline_Order, default_ffd_coeff);
 
+  /* DESCRIPTION: Projection of the sensitivities in SU2_DOT using the FFD control point Jacobian */
+  addBoolOption("FFD_JACOBIAN_PROJECTION", FFD_Jacobian_Projection, false);
+
+  /* DESCRIPTION: Surface-only preprocessing of the mesh in SU2_DOT (continuous adjoint projection) */
+  addBoolOption("DOT_SURFACE_ONLY", Dot_Surface_Only, false);
+
   /*--- Options for the automatic differentiation methods ---*/
   /*!\par CONFIG_CATEGORY: Automatic Differentation options\ingroup Config*/
 
   /* DESCRIPTION: Direct differentiation mode (forward) */
   addEnumOption("DIRECT_DIFF", DirectDiff, DirectDiff_Var_Map, NO_DERIVATIVE);
 
+  /* DESCRIPTION: Number of tangent directions in the direct differentiation w.r.t. the design variables */
+  addUnsignedShortOption("DIRECT_DIFF_DIRECTIONS", DirectDiff_Directions, 1);
+
   /* DESCRIPTION: Automatic differentiation mode (reverse) */
   addBoolOption("AUTO_DIFF", AD_Mode, NO);
 
@@ -2283,6 +2538,15 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
   /* DESCRIPTION: Number of partitions of the mesh */
   addPythonOption("NUMBER_PART");
 
+  /* DESCRIPTION: Number of independent evaluations (multipoint cases, finite difference steps) run concurrently */
+  addPythonOption("CONCURRENT_EVALUATIONS");
+
+  /* DESCRIPTION: Coarser mesh files solved in sequence to initialize the solution on MESH_FILENAME */
+  addPythonOption("MESH_SEQUENCE");
+
+  /* DESCRIPTION: Residual reduction (orders of magnitude) of the solutions on the coarser meshes of MESH_SEQUENCE */
+  addPythonOption("MESH_SEQUENCE_RESIDUAL");
+
   /* DESCRIPTION: Optimization objective function with optional scaling factor*/
   addPythonOption("OPT_OBJECTIVE");
 
@@ -2380,18 +2644,74 @@ void CConfig::SetConfig_Options(unsigned short val_iZone, unsigned short val_nZo
 
 }
 
-void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
-  string text_line, option_name;
-  ifstream case_file;
+const vector<pair<string, vector<string> > >& CConfig::ReadConfig_File(char case_filename[MAX_STRING_SIZE]) {
+  
+  string file_name(case_filename), file_text, text_line, option_name;
   vector<string> option_value;
+  int status = 0;
   
-  /*--- Read the configuration file ---*/
+  /*--- Only the master node reads the file. The file is tokenized again only
+   when its contents differ from the ones of the previous call, e.g. when a
+   script has rewritten it between two driver instances. ---*/
   
-  case_file.open(case_filename, ios::in);
-
-  if (case_file.fail()) {
+  if (rank == MASTER_NODE) {
+    ifstream case_file(case_filename, ios::in | ios::binary);
+    if (case_file.fail()) {
+      status = -1;
+    } else {
+      ostringstream file_stream;
+      file_stream << case_file.rdbuf();
+      file_text = file_stream.str();
+      map<string, string>::iterator it = Config_File_Text.find(file_name);
+      status = ((it == Config_File_Text.end()) || (it->second != file_text)) ? 1 : 0;
+      if (status == 1) Config_File_Text[file_name] = file_text;
+    }
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(&status, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  if (status == -1) {
     SU2_MPI::Error("The configuration file (.cfg) is missing!!", CURRENT_FUNCTION);
   }
+  
+  if (status == 1) {
+    
+#ifdef HAVE_MPI
+    unsigned long nChar = file_text.size();
+    SU2_MPI::Bcast(&nChar, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+    if (rank != MASTER_NODE) file_text.resize(nChar);
+    if (nChar > 0)
+      SU2_MPI::Bcast(&file_text[0], (int)nChar, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+    
+    vector<pair<string, vector<string> > > &options = Config_File_Tokens[file_name];
+    options.clear();
+    
+    istringstream case_file(file_text);
+    while (getline (case_file, text_line)) {
+      if (TokenizeString(text_line, option_name, option_value))
+        options.push_back(make_pair(option_name, option_value));
+    }
+  }
+  
+  return Config_File_Tokens[file_name];
+  
+}
+
+void CConfig::ClearConfig_FileCache(void) {
+  Config_File_Text.clear();
+  Config_File_Tokens.clear();
+}
+
+void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
+  string option_name;
+  vector<string> option_value;
+  
+  /*--- Read the configuration file ---*/
+  
+  const vector<pair<string, vector<string> > > &case_options = ReadConfig_File(case_filename);
 
   string errorString;
 
@@ -2402,7 +2722,7 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
 
   /*--- Parse the configuration file and set the options ---*/
   
-  while (getline (case_file, text_line)) {
+  for (unsigned long iOption = 0; iOption < case_options.size(); iOption++) {
     
     if (err_count >= max_err_count) {
       errorString.append("too many errors. Stopping parse");
@@ -2411,62 +2731,62 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
       throw(1);
     }
     
-    if (TokenizeString(text_line, option_name, option_value)) {
-      
-      /*--- See if it's a python option ---*/
-
-      if (option_map.find(option_name) == option_map.end()) {
-          string newString;
-          newString.append(option_name);
-          newString.append(": invalid option name");
-          newString.append(". Check current SU2 options in config_template.cfg.");
-          newString.append("\n");
-          if (!option_name.compare("AD_COEFF_FLOW")) newString.append("AD_COEFF_FLOW= (1st, 2nd, 4th) is now JST_SENSOR_COEFF= (2nd, 4th).\n");
-          if (!option_name.compare("AD_COEFF_ADJFLOW")) newString.append("AD_COEFF_ADJFLOW= (1st, 2nd, 4th) is now ADJ_JST_SENSOR_COEFF= (2nd, 4th).\n");
-          if (!option_name.compare("SPATIAL_ORDER_FLOW")) newString.append("SPATIAL_ORDER_FLOW is now the boolean MUSCL_FLOW and the appropriate SLOPE_LIMITER_FLOW.\n");
-          if (!option_name.compare("SPATIAL_ORDER_ADJFLOW")) newString.append("SPATIAL_ORDER_ADJFLOW is now the boolean MUSCL_ADJFLOW and the appropriate SLOPE_LIMITER_ADJFLOW.\n");
-          if (!option_name.compare("SPATIAL_ORDER_TURB")) newString.append("SPATIAL_ORDER_TURB is now the boolean MUSCL_TURB and the appropriate SLOPE_LIMITER_TURB.\n");
-          if (!option_name.compare("SPATIAL_ORDER_ADJTURB")) newString.append("SPATIAL_ORDER_ADJTURB is now the boolean MUSCL_ADJTURB and the appropriate SLOPE_LIMITER_ADJTURB.\n");
-          if (!option_name.compare("LIMITER_COEFF")) newString.append("LIMITER_COEFF is now VENKAT_LIMITER_COEFF.\n");
-          if (!option_name.compare("SHARP_EDGES_COEFF")) newString.append("SHARP_EDGES_COEFF is now ADJ_SHARP_LIMITER_COEFF.\n");
-          if (!option_name.compare("DEFORM_TOL_FACTOR")) newString.append("DEFORM_TOL_FACTOR is no longer used.\n Set DEFORM_LINEAR_SOLVER_ERROR to define the minimum residual for grid deformation.\n");
-          if (!option_name.compare("MOTION_FILENAME")) newString.append("MOTION_FILENAME is now DV_FILENAME.\n");
-          if (!option_name.compare("BETA_DELTA")) newString.append("BETA_DELTA is now UQ_DELTA_B.\n");
-          if (!option_name.compare("COMPONENTALITY")) newString.append("COMPONENTALITY is now UQ_COMPONENT.\n");
-          if (!option_name.compare("PERMUTE")) newString.append("PERMUTE is now UQ_PERMUTE.\n");
-          if (!option_name.compare("URLX")) newString.append("URLX is now UQ_URLX.\n");
-
-          errorString.append(newString);
-          err_count++;
-        continue;
-      }
+    option_name  = case_options[iOption].first;
+    option_value = case_options[iOption].second;
+    
+    /*--- See if it's a python option ---*/
 
-      /*--- Option exists, check if the option has already been in the config file ---*/
-      
-      if (included_options.find(option_name) != included_options.end()) {
+    if (option_map.find(option_name) == option_map.end()) {
         string newString;
         newString.append(option_name);
-        newString.append(": option appears twice");
+        newString.append(": invalid option name");
+        newString.append(". Check current SU2 options in config_template.cfg.");
         newString.append("\n");
+        if (!option_name.compare("AD_COEFF_FLOW")) newString.append("AD_COEFF_FLOW= (1st, 2nd, 4th) is now JST_SENSOR_COEFF= (2nd, 4th).\n");
+        if (!option_name.compare("AD_COEFF_ADJFLOW")) newString.append("AD_COEFF_ADJFLOW= (1st, 2nd, 4th) is now ADJ_JST_SENSOR_COEFF= (2nd, 4th).\n");
+        if (!option_name.compare("SPATIAL_ORDER_FLOW")) newString.append("SPATIAL_ORDER_FLOW is now the boolean MUSCL_FLOW and the appropriate SLOPE_LIMITER_FLOW.\n");
+        if (!option_name.compare("SPATIAL_ORDER_ADJFLOW")) newString.append("SPATIAL_ORDER_ADJFLOW is now the boolean MUSCL_ADJFLOW and the appropriate SLOPE_LIMITER_ADJFLOW.\n");
+        if (!option_name.compare("SPATIAL_ORDER_TURB")) newString.append("SPATIAL_ORDER_TURB is now the boolean MUSCL_TURB and the appropriate SLOPE_LIMITER_TURB.\n");
+        if (!option_name.compare("SPATIAL_ORDER_ADJTURB")) newString.append("SPATIAL_ORDER_ADJTURB is now the boolean MUSCL_ADJTURB and the appropriate SLOPE_LIMITER_ADJTURB.\n");
+        if (!option_name.compare("LIMITER_COEFF")) newString.append("LIMITER_COEFF is now VENKAT_LIMITER_COEFF.\n");
+        if (!option_name.compare("SHARP_EDGES_COEFF")) newString.append("SHARP_EDGES_COEFF is now ADJ_SHARP_LIMITER_COEFF.\n");
+        if (!option_name.compare("DEFORM_TOL_FACTOR")) newString.append("DEFORM_TOL_FACTOR is no longer used.\n Set DEFORM_LINEAR_SOLVER_ERROR to define the minimum residual for grid deformation.\n");
+        if (!option_name.compare("MOTION_FILENAME")) newString.append("MOTION_FILENAME is now DV_FILENAME.\n");
+        if (!option_name.compare("BETA_DELTA")) newString.append("BETA_DELTA is now UQ_DELTA_B.\n");
+        if (!option_name.compare("COMPONENTALITY")) newString.append("COMPONENTALITY is now UQ_COMPONENT.\n");
+        if (!option_name.compare("PERMUTE")) newString.append("PERMUTE is now UQ_PERMUTE.\n");
+        if (!option_name.compare("URLX")) newString.append("URLX is now UQ_URLX.\n");
+
         errorString.append(newString);
         err_count++;
-        continue;
-      }
+      continue;
+    }
 
+    /*--- Option exists, check if the option has already been in the config file ---*/
+    
+    if (included_options.find(option_name) != included_options.end()) {
+      string newString;
+      newString.append(option_name);
+      newString.append(": option appears twice");
+      newString.append("\n");
+      errorString.append(newString);
+      err_count++;
+      continue;
+    }
 
-      /*--- New found option. Add it to the map, and delete from all options ---*/
-      
-      included_options.insert(pair<string, bool>(option_name, true));
-      all_options.erase(option_name);
 
-      /*--- Set the value and check error ---*/
-      
-      string out = option_map[option_name]->SetValue(option_value);
-      if (out.compare("") != 0) {
-        errorString.append(out);
-        errorString.append("\n");
-        err_count++;
-      }
+    /*--- New found option. Add it to the map, and delete from all options ---*/
+    
+    included_options.insert(pair<string, bool>(option_name, true));
+    all_options.erase(option_name);
+
+    /*--- Set the value and check error ---*/
+    
+    string out = option_map[option_name]->SetValue(option_value);
+    if (out.compare("") != 0) {
+      errorString.append(out);
+      errorString.append("\n");
+      err_count++;
     }
   }
 
@@ -2481,8 +2801,6 @@ void CConfig::SetConfig_Parsing(char case_filename[MAX_STRING_SIZE]) {
   for (map<string, bool>::iterator iter = all_options.begin(); iter != all_options.end(); ++iter) {
     option_map[iter->first]->SetDefault();
   }
-
-  case_file.close();
   
 }
 
@@ -2588,6 +2906,16 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  /*--- The error bounds of the quantized fields, one for all of them or one per field ---*/
+
+  if ((nOutput_Quantization_Error > 1) && (nOutput_Quantization_Error != nOutput_Quantized_Fields)) {
+    SU2_MPI::Error("OUTPUT_QUANTIZATION_ERROR needs one value or one value per field of OUTPUT_QUANTIZED_FIELDS.", CURRENT_FUNCTION);
+  }
+  for (unsigned short iField = 0; iField < nOutput_Quantization_Error; iField++) {
+    if (Output_Quantization_Error[iField] <= 0.0)
+      SU2_MPI::Error("The values of OUTPUT_QUANTIZATION_ERROR must be positive.", CURRENT_FUNCTION);
+  }
+
   /*--- Set the boolean Wall_Functions equal to true if there is a
    definition for the wall founctions ---*/
 
@@ -2653,6 +2981,54 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   
   Kind_SU2 = val_software;
 
+  /*--- The precomputed least-squares weights are not part of the recorded tape,
+   the discrete adjoint needs their dependence on the coordinates. ---*/
+  
+  if (DiscreteAdjoint) Cache_LS_Weights = false;
+  
+  /*--- The dual grid must be recorded entirely by the discrete adjoint ---*/
+  
+  if (DiscreteAdjoint) Partial_DualGrid_Update = false;
+  
+  /*--- The greedy selection of the RBF mesh deformation is not differentiated and
+   the incremental Cholesky factorization needs a positive definite basis ---*/
+  
+  if (Kind_Deform_Method == RBF_DEFORMATION) {
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("The RBF mesh deformation is not available for the discrete adjoint.", CURRENT_FUNCTION);
+    if ((Kind_RadialBasisFunction != WENDLAND_C2) && (Kind_RadialBasisFunction != GAUSSIAN))
+      SU2_MPI::Error("The RBF mesh deformation needs KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2 or GAUSSIAN.", CURRENT_FUNCTION);
+  }
+  
+  /*--- The sparse radial basis function interpolation relies on the compact support of the basis ---*/
+  
+  if (RadialBasisFunction_Sparse && (Kind_RadialBasisFunction != WENDLAND_C2))
+    SU2_MPI::Error("RADIAL_BASIS_FUNCTION_SPARSE needs KIND_RADIAL_BASIS_FUNCTION= WENDLAND_C2.", CURRENT_FUNCTION);
+  
+  /*--- The compact restart format stores the solution of the direct flow solvers ---*/
+  
+  if ((!Wrt_Binary_Restart) || ContinuousAdjoint || DiscreteAdjoint ||
+      ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS) &&
+       (Kind_Solver != FEM_EULER) && (Kind_Solver != FEM_NAVIER_STOKES) && (Kind_Solver != FEM_LES)))
+    Wrt_Compact_Restart = false;
+  
+  /*--- The restart files are written asynchronously with positioned writes of
+   the chunk of each rank, which requires the binary format and threads. ---*/
+  
+#ifndef HAVE_PTHREAD
+  Wrt_Async_Restart = false;
+#endif
+  if (!Wrt_Binary_Restart) Wrt_Async_Restart = false;
+
+  /*--- The time averages are only accumulated for unsteady flows. ---*/
+
+  if ((Unsteady_Simulation == STEADY) || (Unsteady_Simulation == HARMONIC_BALANCE) ||
+      ContinuousAdjoint || DiscreteAdjoint) Wrt_Time_Average = false;
+
+  /*--- A flush frequency of zero flushes the history file after every line. ---*/
+
+  if (History_Flush_Freq == 0) History_Flush_Freq = 1;
+  
   /*--- Set limiter for no MUSCL reconstructions ---*/
   
   if ((!MUSCL_Flow) || (Kind_ConvNumScheme_Flow == SPACE_CENTERED)) Kind_SlopeLimit_Flow = NO_LIMITER;
@@ -3695,6 +4071,24 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     if (Kind_Solver == RANS) Kind_Solver = ADJ_RANS;
   }
   
+  /*--- The transposed flow Jacobian stands in for the one of the adjoint in steady, implicit,
+   inviscid problems (the strong wall conditions of the viscous adjoint are not in the flow matrix) ---*/
+  
+  if (!ContinuousAdjoint) Cont_Adj_Primal_Jacobian = false;
+  
+  if (Cont_Adj_Primal_Jacobian) {
+    if ((Kind_Solver != ADJ_EULER) || (Unsteady_Simulation != STEADY) ||
+        (Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (Kind_TimeIntScheme_AdjFlow != EULER_IMPLICIT))
+      SU2_MPI::Error(string("CONT_ADJ_PRIMAL_JACOBIAN= YES needs a steady continuous adjoint Euler problem\n") +
+                     string("with TIME_DISCRE_FLOW= EULER_IMPLICIT and TIME_DISCRE_ADJFLOW= EULER_IMPLICIT."), CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver == SMOOTHER_LUSGS) || (Kind_Linear_Solver == SMOOTHER_JACOBI) ||
+        (Kind_Linear_Solver == SMOOTHER_ILU) || (Kind_Linear_Solver == SMOOTHER_LINELET) ||
+        ((Kind_Linear_Solver_Prec != JACOBI) && (Kind_Linear_Solver_Prec != ILU) && (Kind_Linear_Solver_Prec != ILU_LEVELS)))
+      SU2_MPI::Error("CONT_ADJ_PRIMAL_JACOBIAN= YES needs a Krylov LINEAR_SOLVER with the JACOBI or ILU preconditioner.", CURRENT_FUNCTION);
+    if (Jacobian_Edge_Format)
+      SU2_MPI::Error("CONT_ADJ_PRIMAL_JACOBIAN= YES needs the compressed row flow Jacobian, set JACOBIAN_EDGE_FORMAT= NO.", CURRENT_FUNCTION);
+  }
+  
   nCFL = nMGLevels+1;
   CFL = new su2double[nCFL];
   CFL[0] = CFLFineGrid;
@@ -3750,25 +4144,117 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
      performance in the matrix multiplications. */
   sizeMatMulPadding = byteAlignmentMatMul/sizeof(passivedouble);
 
+  /* The tasks of the DG solver are only carried out by multiple threads when
+     threads are available. The tape of the algorithmic differentiation and the
+     timers of the profiling are not thread safe. */
+  if(nThreads_DGFEM == 0) nThreads_DGFEM = 1;
+#if !defined(HAVE_PTHREAD) || defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(PROFILE)
+  nThreads_DGFEM = 1;
+#endif
+
+  /* The same holds for the element assembly of the structural solver. The
+     reference gradients depend on the coordinates, which are inputs of the
+     tape for the discrete adjoint, and with a prestretch not all element loops
+     use the same reference configuration. Hence the gradients are only
+     precomputed for direct problems without prestretch. */
+  if(nThreads_FEA == 0) nThreads_FEA = 1;
+#if !defined(HAVE_PTHREAD) || defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(PROFILE)
+  nThreads_FEA = 1;
+#endif
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  Precompute_RefGrad_FEA = false;
+#endif
+
+  /* The same holds for the FEA mesh deformation. */
+  if(nThreads_Deform == 0) nThreads_Deform = 1;
+#if !defined(HAVE_PTHREAD) || defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(PROFILE)
+  nThreads_Deform = 1;
+#endif
+
+  /* The same holds for the convective edge loops of the flow solver, whose
+     threads carry out the edges of one color at a time. */
+  if(nThreads_Flow == 0) nThreads_Flow = 1;
+#if !defined(HAVE_PTHREAD) || defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(PROFILE)
+  nThreads_Flow = 1;
+#endif
+  if (nThreads_Flow > 1) Edge_Coloring = true;
+  if (Prestretch) Precompute_RefGrad_FEA = false;
+
+  /* The matrix-free stiffness operator of the structural solver covers static
+     linear elasticity with clamped boundaries, and it is preconditioned by the
+     inverse of its diagonal blocks. */
+  if (MatrixFree_FEA && ((Kind_Solver == FEM_ELASTICITY) || (Kind_Solver == DISC_ADJ_FEM))) {
+    if (Kind_Solver == DISC_ADJ_FEM)
+      SU2_MPI::Error("MATRIX_FREE_FEA is not available for the discrete adjoint structural solver.", CURRENT_FUNCTION);
+    if ((Kind_Struct_Solver != SMALL_DEFORMATIONS) || (Dynamic_Analysis != STATIC))
+      SU2_MPI::Error("MATRIX_FREE_FEA requires GEOMETRIC_CONDITIONS= SMALL_DEFORMATIONS and DYNAMIC_ANALYSIS= NO.", CURRENT_FUNCTION);
+    if (nMarker_Disp_Dir > 0)
+      SU2_MPI::Error("MATRIX_FREE_FEA does not support MARKER_DISPLACEMENT, use MARKER_CLAMPED.", CURRENT_FUNCTION);
+    if ((Kind_Linear_Solver != CONJUGATE_GRADIENT) && (Kind_Linear_Solver != FGMRES) && (Kind_Linear_Solver != BCGSTAB) &&
+        (Kind_Linear_Solver != GCRO_DR))
+      SU2_MPI::Error("MATRIX_FREE_FEA requires LINEAR_SOLVER= CONJUGATE_GRADIENT, FGMRES, BCGSTAB or GCRO_DR.", CURRENT_FUNCTION);
+    if (Kind_Linear_Solver_Prec != JACOBI)
+      SU2_MPI::Error("MATRIX_FREE_FEA requires LINEAR_SOLVER_PREC= JACOBI.", CURRENT_FUNCTION);
+  }
+
+  /* GCRO-DR needs Krylov directions beyond the recycled ones in every cycle. */
+  if (((Kind_Linear_Solver == GCRO_DR) || (Kind_DiscAdj_Linear_Solver == GCRO_DR) || (Kind_Deform_Linear_Solver == GCRO_DR)) &&
+      ((Linear_Solver_Recycle_Size < 1) || (Linear_Solver_Recycle_Size >= Linear_Solver_Restart_Frequency)))
+    SU2_MPI::Error("GCRO_DR requires 0 < LINEAR_SOLVER_RECYCLE_SIZE < LINEAR_SOLVER_RESTART_FREQUENCY.", CURRENT_FUNCTION);
+
+  /* The overlap of the RAS preconditioner is taken from the halo layers of the partitions. */
+  if ((Linear_Solver_RAS_Overlap < 1) || (Linear_Solver_RAS_Overlap > 2))
+    SU2_MPI::Error("LINEAR_SOLVER_RAS_OVERLAP must be 1 or 2.", CURRENT_FUNCTION);
+
   /* Correct the number of time levels for time accurate local time
      stepping, if needed.  */
   if (nLevels_TimeAccurateLTS == 0)  nLevels_TimeAccurateLTS =  1;
   if (nLevels_TimeAccurateLTS  > 15) nLevels_TimeAccurateLTS = 15;
 
+  /* The finite volume solver of the compressible flow equations has a
+     multirate variant of its explicit Euler scheme for time stepping. */
+  const bool FV_TimeAccurateLTS = (((Kind_Solver == EULER) || (Kind_Solver == NAVIER_STOKES)) &&
+                                   (Kind_TimeIntScheme_Flow == EULER_EXPLICIT) &&
+                                   (Unsteady_Simulation == TIME_STEPPING));
+
   /* Check that no time accurate local time stepping is specified for time
-     integration schemes other than ADER. */
-  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && nLevels_TimeAccurateLTS != 1) {
+     integration schemes other than ADER and the explicit Euler scheme. */
+  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && !FV_TimeAccurateLTS && nLevels_TimeAccurateLTS != 1) {
 
     if (rank==MASTER_NODE) {
       cout << endl << "WARNING: "
            << nLevels_TimeAccurateLTS << " levels specified for time accurate local time stepping." << endl
-           << "Time accurate local time stepping is only possible for ADER, hence this option is not used." << endl
+           << "Time accurate local time stepping is only possible for ADER and for the explicit Euler scheme" << endl
+           << "of the compressible EULER and NAVIER_STOKES solvers, hence this option is not used." << endl
            << endl;
     }
 
     nLevels_TimeAccurateLTS = 1;
   }
 
+  if (FV_TimeAccurateLTS && (nLevels_TimeAccurateLTS != 1) && (Unst_CFL == 0.0))
+    SU2_MPI::Error("Unsteady CFL not specified for time accurate local time stepping.", CURRENT_FUNCTION);
+
+  /* The implicit residual smoothing is part of the explicit Runge-Kutta and
+     Euler schemes of the finite volume compressible flow solvers. */
+  if (nRes_Smooth_Iter > 0) {
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        (Kind_Regime != COMPRESSIBLE))
+      SU2_MPI::Error("RES_SMOOTHING_ITER is only available for the compressible EULER, NAVIER_STOKES and RANS solvers.", CURRENT_FUNCTION);
+    if ((Kind_TimeIntScheme_Flow != RUNGE_KUTTA_EXPLICIT) && (Kind_TimeIntScheme_Flow != EULER_EXPLICIT))
+      SU2_MPI::Error("RES_SMOOTHING_ITER requires TIME_DISCRE_FLOW= RUNGE-KUTTA_EXPLICIT or EULER_EXPLICIT.", CURRENT_FUNCTION);
+    if ((nLevels_TimeAccurateLTS != 1) || (Unsteady_Simulation == TIME_STEPPING))
+      SU2_MPI::Error("RES_SMOOTHING_ITER is not time accurate, it is not available with UNSTEADY_SIMULATION= TIME_STEPPING.", CURRENT_FUNCTION);
+    if (Res_Smooth_Coeff <= 0.0)
+      SU2_MPI::Error("RES_SMOOTHING_COEFF must be positive.", CURRENT_FUNCTION);
+  }
+
+  /* The implicit scheme of the DG solver is a pseudo time stepping scheme
+     for steady problems only. */
+  if ((Kind_TimeIntScheme_FEM_Flow == EULER_IMPLICIT) && (Unsteady_Simulation != STEADY))
+    SU2_MPI::Error("EULER_IMPLICIT is only possible for steady DG computations.",
+                   CURRENT_FUNCTION);
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     Unsteady_Simulation = TIME_STEPPING;  // Only time stepping for ADER.
@@ -3781,6 +4267,12 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
     }
 
+    /* Check the parameters of the iterative predictor step. */
+    if (Tol_Predictor_ADER_DG <= 0.0)
+      SU2_MPI::Error("ERROR: TOL_PREDICTOR_ADER_DG must be positive.", CURRENT_FUNCTION);
+    if (MaxIter_Predictor_ADER_DG == 0)
+      SU2_MPI::Error("ERROR: MAX_ITER_PREDICTOR_ADER_DG must be at least 1.", CURRENT_FUNCTION);
+
     /* Determine the location of the ADER time DOFs, which are the Gauss-Legendre
        integration points corresponding to the number of time DOFs. */
     vector<passivedouble> GLPoints(nTimeDOFsADER_DG), GLWeights(nTimeDOFsADER_DG);
@@ -3942,6 +4434,31 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   if (Fixed_CL_Mode) Update_AoA = false;
   if (Fixed_CM_Mode) Update_HTPIncidence = false;
 
+  /*--- Ensemble run, the flow conditions differ only in the direction of the
+   free-stream velocity. The angles stored in the solution file are ignored. ---*/
+
+  nEnsemble = 0; iEnsemble = 0;
+  if ((Kind_SU2 == SU2_CFD) && (nEnsemble_AoA > 0 || nEnsemble_AoS > 0)) {
+    if ((nEnsemble_AoA > 0) && (nEnsemble_AoS > 0) && (nEnsemble_AoA != nEnsemble_AoS))
+      SU2_MPI::Error("ENSEMBLE_AOA and ENSEMBLE_SIDESLIP_ANGLE must have the same number of entries.", CURRENT_FUNCTION);
+    if (((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS)) ||
+        (Kind_Regime != COMPRESSIBLE) || (Unsteady_Simulation != STEADY) || SinglezoneDriver)
+      SU2_MPI::Error("An ensemble run is only available for steady compressible flow problems.", CURRENT_FUNCTION);
+    if (Fixed_CL_Mode || Fixed_CM_Mode)
+      SU2_MPI::Error("An ensemble run is not available in fixed CL or CM mode.", CURRENT_FUNCTION);
+
+    nEnsemble = max(nEnsemble_AoA, nEnsemble_AoS);
+    Discard_InFiles = true;
+
+    Ensemble_FileName[0] = Conv_FileName;
+    Ensemble_FileName[1] = Breakdown_FileName;
+    Ensemble_FileName[2] = Restart_FlowFileName;
+    Ensemble_FileName[3] = Flow_FileName;
+    Ensemble_FileName[4] = SurfFlowCoeff_FileName;
+
+    SetEnsemble_Condition(0);
+  }
+
   if (DirectDiff != NO_DERIVATIVE) {
 #if !defined COMPLEX_TYPE && !defined ADOLC_FORWARD_TYPE && !defined CODI_FORWARD_TYPE
       if (Kind_SU2 == SU2_CFD) {
@@ -3950,6 +4467,14 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 #endif
+    if ((DirectDiff_Directions == 0) || (DirectDiff_Directions > SU2_TYPE::GetnDirections())) {
+      SU2_MPI::Error(string("DIRECT_DIFF_DIRECTIONS must be between 1 and the number of tangent directions of the forward datatype.\n") +
+                     string("Configure with --with-codi-forward-directions=N to propagate several directions at once."),
+                     CURRENT_FUNCTION);
+    }
+    if ((DirectDiff_Directions > 1) && (DirectDiff != D_DESIGN)) {
+      SU2_MPI::Error("DIRECT_DIFF_DIRECTIONS > 1 is only available with DIRECT_DIFF= DESIGN_VARIABLES.", CURRENT_FUNCTION);
+    }
     /*--- Initialize the derivative values ---*/
     switch (DirectDiff) {
       case D_MACH:
@@ -3986,6 +4511,8 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   }
 #endif
 
+  iObj_Sweep = 0;
+
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
     if (Kind_SU2 == SU2_CFD) {
@@ -3998,6 +4525,48 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
     /*--- Disable writing of limiters if enabled ---*/
     Wrt_Limiters = false;
 
+    if (DiscAdj_Krylov && (Unsteady_Simulation != STEADY)) {
+      SU2_MPI::Error("DISCADJ_KRYLOV is only available for steady problems.", CURRENT_FUNCTION);
+    }
+
+    if (DiscAdj_Krylov && (DiscAdj_Krylov_Size == 0)) {
+      SU2_MPI::Error("DISCADJ_KRYLOV_SIZE must be at least 1.", CURRENT_FUNCTION);
+    }
+
+    if ((Anderson_Depth > 0) && DiscAdj_Krylov) {
+      SU2_MPI::Error("ANDERSON_DEPTH and DISCADJ_KRYLOV can not be used together.", CURRENT_FUNCTION);
+    }
+
+    if (DiscAdj_MultiGrid) {
+      if (Unsteady_Simulation != STEADY)
+        SU2_MPI::Error("DISCADJ_MULTIGRID is only available for steady problems.", CURRENT_FUNCTION);
+      if ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))
+        SU2_MPI::Error("DISCADJ_MULTIGRID is only available for the finite volume flow solvers.", CURRENT_FUNCTION);
+      if (nMGLevels == 0)
+        SU2_MPI::Error("DISCADJ_MULTIGRID requires coarse grid levels (MGLEVEL > 0).", CURRENT_FUNCTION);
+      if (Kind_TimeIntScheme_Flow != EULER_IMPLICIT)
+        SU2_MPI::Error("DISCADJ_MULTIGRID requires the Jacobians of an implicit flow solver (TIME_DISCRE_FLOW= EULER_IMPLICIT).", CURRENT_FUNCTION);
+      if (DiscAdj_Krylov)
+        SU2_MPI::Error("DISCADJ_MULTIGRID and DISCADJ_KRYLOV can not be used together.", CURRENT_FUNCTION);
+      if (DiscAdj_MultiGrid_Iter == 0)
+        SU2_MPI::Error("DISCADJ_MULTIGRID_ITER must be at least 1.", CURRENT_FUNCTION);
+    }
+
+    /*--- The objective sweep names the output files of each adjoint after its
+     objective function, hence the objectives must be different. ---*/
+
+    if (DiscAdj_ObjSweep && (nObj < 2)) DiscAdj_ObjSweep = false;
+    if (DiscAdj_ObjSweep) {
+      if (Unsteady_Simulation != STEADY)
+        SU2_MPI::Error("DISCADJ_OBJECTIVE_SWEEP is only available for steady problems.", CURRENT_FUNCTION);
+      if (Weakly_Coupled_Heat)
+        SU2_MPI::Error("DISCADJ_OBJECTIVE_SWEEP is not available with the weakly coupled heat solver.", CURRENT_FUNCTION);
+      for (unsigned short iObj = 0; iObj < nObj; iObj++)
+        for (unsigned short jObj = iObj+1; jObj < nObj; jObj++)
+          if (Kind_ObjFunc[iObj] == Kind_ObjFunc[jObj])
+            SU2_MPI::Error("DISCADJ_OBJECTIVE_SWEEP requires a different OBJECTIVE_FUNCTION for each entry.", CURRENT_FUNCTION);
+    }
+
     if (Unsteady_Simulation) {
 
       Restart_Flow = false;
@@ -4012,6 +4581,11 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
                        CURRENT_FUNCTION);
       }
 
+      if ((Unst_Adjoint_nCheckpoint != 0) &&
+          (Unsteady_Simulation != DT_STEPPING_1ST) && (Unsteady_Simulation != DT_STEPPING_2ND)) {
+        SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS requires dual time stepping.", CURRENT_FUNCTION);
+      }
+
       /*--- If the averaging interval is not set, we average over all time-steps ---*/
 
       if (Iter_Avg_Objective == 0.0) {
@@ -4052,6 +4626,77 @@ void CConfig::SetPostprocessing(unsigned short val_software, unsigned short val_
   
   delete [] tmp_smooth;
 
+  /*--- The fluid look-up table is generated from a real gas model
+        and is only available for the finite volume solver. ---*/
+  if (LUT_FluidModel) {
+    if ((Kind_FluidModel != VW_GAS) && (Kind_FluidModel != PR_GAS))
+      SU2_MPI::Error("LUT_FLUID_MODEL requires FLUID_MODEL= VW_GAS or PR_GAS.", CURRENT_FUNCTION);
+    if ((Kind_Solver == FEM_EULER) || (Kind_Solver == FEM_NAVIER_STOKES) ||
+        (Kind_Solver == FEM_RANS)  || (Kind_Solver == FEM_LES) ||
+        (Kind_Solver == DISC_ADJ_FEM_EULER) || (Kind_Solver == DISC_ADJ_FEM_NS) ||
+        (Kind_Solver == DISC_ADJ_FEM_RANS))
+      SU2_MPI::Error("LUT_FLUID_MODEL is only available for the finite volume solver.", CURRENT_FUNCTION);
+    if (LUT_nPoints < 2)
+      SU2_MPI::Error("LUT_NPOINTS must be at least 2.", CURRENT_FUNCTION);
+    if ((LUT_Pressure_Max    < LUT_Pressure_Min) ||
+        (LUT_Temperature_Max < LUT_Temperature_Min))
+      SU2_MPI::Error("Invalid pressure or temperature range of the fluid look-up table.", CURRENT_FUNCTION);
+  }
+
+  /*--- The coupled implicit solve of the mean flow and turbulence equations
+        is implemented for the compressible finite volume solver and the
+        SA models on a single grid level. ---*/
+  if (Coupled_Turb_Implicit) {
+    if (Kind_Solver != RANS)
+      SU2_MPI::Error("COUPLED_TURB_IMPLICIT is only available for the compressible RANS solver.", CURRENT_FUNCTION);
+    if ((Kind_Turb_Model != SA) && (Kind_Turb_Model != SA_NEG) && (Kind_Turb_Model != SA_E) &&
+        (Kind_Turb_Model != SA_COMP) && (Kind_Turb_Model != SA_E_COMP))
+      SU2_MPI::Error("COUPLED_TURB_IMPLICIT requires one of the SA turbulence models.", CURRENT_FUNCTION);
+    if ((Kind_TimeIntScheme_Flow != EULER_IMPLICIT) || (Kind_TimeIntScheme_Turb != EULER_IMPLICIT))
+      SU2_MPI::Error("COUPLED_TURB_IMPLICIT requires implicit time integration of the flow and turbulence.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("COUPLED_TURB_IMPLICIT is not compatible with multigrid, set MGLEVEL= 0.", CURRENT_FUNCTION);
+    if (Newton_Krylov)
+      SU2_MPI::Error("COUPLED_TURB_IMPLICIT is not compatible with NEWTON_KRYLOV.", CURRENT_FUNCTION);
+  }
+
+  if (Jacobian_Lag == 0) Jacobian_Lag = 1;
+
+  /*--- The edge format of the flow Jacobian has no column indices, only the
+        products and the JACOBI and LU_SGS preconditioners are defined on it. ---*/
+  if (Jacobian_Edge_Format) {
+    if ((Kind_Linear_Solver == SMOOTHER_ILU) || (Kind_Linear_Solver == SMOOTHER_LINELET) ||
+        ((Kind_Linear_Solver != SMOOTHER_LUSGS) && (Kind_Linear_Solver != SMOOTHER_JACOBI) &&
+         (Kind_Linear_Solver_Prec != JACOBI) && (Kind_Linear_Solver_Prec != LU_SGS)))
+      SU2_MPI::Error("JACOBIAN_EDGE_FORMAT requires the JACOBI or LU_SGS preconditioner (or smoother).", CURRENT_FUNCTION);
+    if (DiscreteAdjoint)
+      SU2_MPI::Error("JACOBIAN_EDGE_FORMAT is not available for the discrete adjoint.", CURRENT_FUNCTION);
+  }
+
+  /*--- The Anderson acceleration treats the steady solution as the fixed point of the iteration. ---*/
+  if ((Anderson_Depth > 0) && (Unsteady_Simulation != STEADY))
+    SU2_MPI::Error("ANDERSON_DEPTH is only available for steady problems.", CURRENT_FUNCTION);
+
+  /*--- The exact sums are global, they are used by the linear algebra of every zone. ---*/
+  CReproducibleSum::SetActive(Reproducible_Reductions);
+
+  /*--- The communication statistics are global as well ---*/
+  CCommProfiler::SetActive(Comm_Profiling);
+
+  /*--- The local freezing skips the update of converged points in the implicit
+        iteration of the compressible solver on a single grid level. ---*/
+  if (Local_Freezing) {
+    if ((Kind_Solver != EULER) && (Kind_Solver != NAVIER_STOKES) && (Kind_Solver != RANS))
+      SU2_MPI::Error("LOCAL_FREEZING is only available for the compressible EULER, NAVIER_STOKES and RANS solvers.", CURRENT_FUNCTION);
+    if ((Unsteady_Simulation != STEADY) || (Kind_TimeIntScheme_Flow != EULER_IMPLICIT))
+      SU2_MPI::Error("LOCAL_FREEZING requires a steady simulation with implicit time integration.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("LOCAL_FREEZING is not compatible with multigrid, set MGLEVEL= 0.", CURRENT_FUNCTION);
+    if (Coupled_Turb_Implicit)
+      SU2_MPI::Error("LOCAL_FREEZING is not compatible with COUPLED_TURB_IMPLICIT.", CURRENT_FUNCTION);
+    if (Local_Freezing_Param[1] < 1.0) Local_Freezing_Param[1] = 1.0;
+  }
+
   /*--- Make sure that implicit time integration is disabled
         for the FEM fluid solver (numerics). ---*/
   if ((Kind_Solver == FEM_EULER)         ||
@@ -5800,6 +6445,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 			if (Unst_CFL != 0.0) cout << "Time step computed by the code. Unsteady CFL number: " << Unst_CFL <<"."<< endl;
 			else cout << "Unsteady time step provided by the user (s): "<< Delta_UnstTime << "." << endl;
 			cout << "Total number of internal Dual Time iterations: "<< Unst_nIntIter <<"." << endl;
+			if (Unst_Residual_Drop > 0.0) cout << "Internal iterations stop after a flow residual reduction of " << Unst_Residual_Drop << " orders of magnitude." << endl;
+			if (Unst_Predictor) cout << "The solution of each time step is extrapolated from the two previous time steps." << endl;
 			break;
 		}
   }
@@ -5829,6 +6476,9 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           break;
         case EULER_EXPLICIT:
           cout << "Euler explicit method for the flow equations." << endl;
+          if (nLevels_TimeAccurateLTS != 1)
+            cout << "Multirate time stepping with " << nLevels_TimeAccurateLTS
+                 << " levels for time accurate local time stepping." << endl;
           break;
         case EULER_IMPLICIT:
           cout << "Euler implicit method for the flow equations." << endl;
@@ -5837,7 +6487,11 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "BCGSTAB is used for solving the linear system." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case ILU_LEVELS: cout << "Using a level scheduled ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case AMG: cout << "Using an unsmoothed aggregation AMG preconditioning (per partition)."<< endl; break;
+                case PRESSURE_AMG: cout << "Using a pressure block AMG and ILU("<< Linear_Solver_ILU_n <<") two-stage preconditioning."<< endl; break;
+                case RAS: cout << "Using a restricted additive Schwarz preconditioning, overlap of "<< Linear_Solver_RAS_Overlap <<" layer(s)."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
               }
@@ -5846,10 +6500,21 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               break;
             case FGMRES:
             case RESTARTED_FGMRES:
+            case FGMRES_CGS:
+            case RESTARTED_FGMRES_CGS:
+            case GCRO_DR:
               cout << "FGMRES is used for solving the linear system." << endl;
+              if ((Kind_Linear_Solver == FGMRES_CGS) || (Kind_Linear_Solver == RESTARTED_FGMRES_CGS))
+                cout << "Classical Gram-Schmidt with one global reduction per iteration." << endl;
+              if (Kind_Linear_Solver == GCRO_DR)
+                cout << "Restarts every " << Linear_Solver_Restart_Frequency << " iterations, " << Linear_Solver_Recycle_Size << " directions recycled between the solves (GCRO-DR)." << endl;
               switch (Kind_Linear_Solver_Prec) {
                 case ILU: cout << "Using a ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
+                case ILU_LEVELS: cout << "Using a level scheduled ILU("<< Linear_Solver_ILU_n <<") preconditioning."<< endl; break;
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
+                case AMG: cout << "Using an unsmoothed aggregation AMG preconditioning (per partition)."<< endl; break;
+                case PRESSURE_AMG: cout << "Using a pressure block AMG and ILU("<< Linear_Solver_ILU_n <<") two-stage preconditioning."<< endl; break;
+                case RAS: cout << "Using a restricted additive Schwarz preconditioning, overlap of "<< Linear_Solver_RAS_Overlap <<" layer(s)."<< endl; break;
                 case LU_SGS: cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI: cout << "Using a Jacobi preconditioning."<< endl; break;
               }
@@ -5876,6 +6541,10 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           cout << "Time coefficients: {0.5, 0.5, 1, 1}" << endl;
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
+        case LOW_STORAGE_RK_EXPLICIT:
+          cout << "Low-storage (2N) RK4 explicit method for the flow equations." << endl;
+          cout << "Number of steps: " << 5 << endl;
+          break;
       }
     }
 
@@ -5895,7 +6564,7 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
               break;
-            case FGMRES: case RESTARTED_FGMRES:
+            case FGMRES: case RESTARTED_FGMRES: case FGMRES_CGS: case RESTARTED_FGMRES_CGS: case GCRO_DR:
               cout << "FGMRES is used for solving the linear system." << endl;
               cout << "Convergence criteria of the linear solver: "<< Linear_Solver_Error <<"."<< endl;
               cout << "Max number of iterations: "<< Linear_Solver_Iter <<"."<< endl;
@@ -5944,6 +6613,14 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
           cout << "Time coefficients: {0.5, 0.5, 1, 1}" << endl;
           cout << "Function coefficients: {1/6, 1/3, 1/3, 1/6}" << endl;
           break;
+        case LOW_STORAGE_RK_EXPLICIT:
+          cout << "Low-storage (2N) RK4 explicit method for the flow equations." << endl;
+          cout << "Number of steps: " << 5 << endl;
+          break;
+
+        case EULER_IMPLICIT:
+          cout << "Euler implicit method with matrix-free products for the flow equations." << endl;
+          break;
 
         case ADER_DG:
           if(nLevels_TimeAccurateLTS == 1)
@@ -5991,14 +6668,23 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
 
       cout << "Damping factor for the residual restriction: " << Damp_Res_Restric <<"."<< endl;
       cout << "Damping factor for the correction prolongation: " << Damp_Correc_Prolong <<"."<< endl;
+      if (MG_Adaptive_Cycle) cout << "Adaptive multigrid: smoothing sweeps, cycle, and depth are tuned from the residual reduction of each level." << endl;
     }
 
     if ((Kind_Solver != FEM_ELASTICITY) && (Kind_Solver != DISC_ADJ_FEM)) {
 
       if (!CFL_Adapt) cout << "No CFL adaptation." << endl;
+      else if (CFL_Adapt_LinSol) cout << "CFL adaptation with linear solver feedback. Factor down: "<< CFL_AdaptParam_LinSol[0]
+        <<", factor up: "<< CFL_AdaptParam_LinSol[1] <<",\n                required linear residual reduction: "<< CFL_AdaptParam_LinSol[2]
+        <<", lower limit: "<< CFL_AdaptParam[2] <<", upper limit: " << CFL_AdaptParam[3] <<"."<< endl;
       else cout << "CFL adaptation. Factor down: "<< CFL_AdaptParam[0] <<", factor up: "<< CFL_AdaptParam[1]
         <<",\n                lower limit: "<< CFL_AdaptParam[2] <<", upper limit: " << CFL_AdaptParam[3] <<"."<< endl;
 
+      if (Local_Freezing) cout << "Local freezing of the converged points. Relative residual: "<< Local_Freezing_Param[0]
+        <<", full sweep every "<< Local_Freezing_Param[1] <<" iterations, from iteration "<< Local_Freezing_Param[2] <<"."<< endl;
+
+      if (Reproducible_Reductions) cout << "Reproducible parallel reductions (exact sums)." << endl;
+
       if (nMGLevels !=0) {
         PrintingToolbox::CTablePrinter MGTable(&std::cout);
         
@@ -6150,6 +6836,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII legacy (.vtk)." << endl; break;
       case PARAVIEW_BINARY: cout << "The output file format is Paraview binary legacy (.vtk)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF with raw binary data (.xmf, .bin)." << endl; break;
+      case INSITU: cout << "The solution is handed to an in-situ adaptor, no solution files are written." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -6200,6 +6888,8 @@ void CConfig::SetOutput(unsigned short val_software, unsigned short val_izone) {
     switch (Output_FileFormat) {
       case PARAVIEW: cout << "The output file format is Paraview ASCII legacy (.vtk)." << endl; break;
       case PARAVIEW_BINARY: cout << "The output file format is Paraview binary legacy (.vtk)." << endl; break;
+      case XDMF: cout << "The output file format is XDMF with raw binary data (.xmf, .bin)." << endl; break;
+      case INSITU: cout << "The solution is handed to an in-situ adaptor, no solution files are written." << endl; break;
       case TECPLOT: cout << "The output file format is Tecplot ASCII (.dat)." << endl; break;
       case TECPLOT_BINARY: cout << "The output file format is Tecplot binary (.plt)." << endl; break;
       case FIELDVIEW: cout << "The output file format is FieldView ASCII (.uns)." << endl; break;
@@ -6702,6 +7392,18 @@ bool CConfig::TokenizeString(string & str, string & option_name,
   return true;
 }
 
+bool CConfig::GetVolume_Output_Field(string val_field) {
+
+  unsigned short iField;
+
+  if (nVolume_Output_Fields == 0) return true;
+
+  for (iField = 0; iField < nVolume_Output_Fields; iField++)
+    if (Volume_Output_Fields[iField] == val_field) return true;
+
+  return false;
+}
+
 unsigned short CConfig::GetMarker_CfgFile_TagBound(string val_marker) {
 
   unsigned short iMarker_CfgFile;
@@ -6714,6 +7416,28 @@ unsigned short CConfig::GetMarker_CfgFile_TagBound(string val_marker) {
   return 0;
 }
 
+unsigned short CConfig::GetOutput_Precision(string val_field, su2double & val_error) {
+
+  unsigned short iField;
+
+  /*--- A zero error bound stands for the finest (2 byte) quantization ---*/
+
+  val_error = 0.0;
+
+  for (iField = 0; iField < nOutput_Quantized_Fields; iField++) {
+    if (Output_Quantized_Fields[iField] == val_field) {
+      if (nOutput_Quantization_Error == 1) val_error = Output_Quantization_Error[0];
+      else if (nOutput_Quantization_Error > 1) val_error = Output_Quantization_Error[iField];
+      return OUTPUT_QUANTIZED;
+    }
+  }
+
+  for (iField = 0; iField < nOutput_Single_Fields; iField++)
+    if (Output_Single_Fields[iField] == val_field) return OUTPUT_SINGLE;
+
+  return Output_Precision;
+}
+
 string CConfig::GetMarker_CfgFile_TagBound(unsigned short val_marker) {
   return Marker_CfgFile_TagBound[val_marker];
 }
@@ -6865,6 +7589,10 @@ CConfig::~CConfig(void) {
   if (Motion_Origin_Y   != NULL) delete [] Motion_Origin_Y;
   if (Motion_Origin_Z   != NULL) delete [] Motion_Origin_Z;
   if (MoveMotion_Origin != NULL) delete [] MoveMotion_Origin;
+  if (Partition_Cache_Ranks != NULL) delete [] Partition_Cache_Ranks;
+  if (Output_Single_Fields != NULL) delete [] Output_Single_Fields;
+  if (Output_Quantized_Fields != NULL) delete [] Output_Quantized_Fields;
+  if (Output_Quantization_Error != NULL) delete [] Output_Quantization_Error;
 
   /*--- translation: ---*/
   
@@ -6915,6 +7643,9 @@ CConfig::~CConfig(void) {
   if (RefOriginMoment_Y != NULL) delete [] RefOriginMoment_Y;
   if (RefOriginMoment_Z != NULL) delete [] RefOriginMoment_Z;
 
+  if (Ensemble_AoA != NULL) delete [] Ensemble_AoA;
+  if (Ensemble_AoS != NULL) delete [] Ensemble_AoS;
+
   /*--- Free memory for Harmonic Blance Frequency  pointer ---*/
     
   if (Omega_HB != NULL) delete [] Omega_HB;
@@ -6973,6 +7704,8 @@ CConfig::~CConfig(void) {
   if (Marker_GeoEval != NULL)         delete[] Marker_GeoEval;
   if (Marker_Plotting != NULL)        delete[] Marker_Plotting;
   if (Marker_Analyze != NULL)        delete[] Marker_Analyze;
+  if (Compact_Restart_Fields != NULL) delete[] Compact_Restart_Fields;
+  if (Volume_Output_Fields != NULL)   delete[] Volume_Output_Fields;
   if (Marker_WallFunctions != NULL)  delete[] Marker_WallFunctions;
   if (Marker_ZoneInterface != NULL)        delete[] Marker_ZoneInterface;
   if (Marker_PyCustom != NULL)             delete [] Marker_PyCustom;
@@ -7241,6 +7974,8 @@ CConfig::~CConfig(void) {
   if (default_eng_cyl       != NULL) delete [] default_eng_cyl;
   if (default_eng_val       != NULL) delete [] default_eng_val;
   if (default_cfl_adapt     != NULL) delete [] default_cfl_adapt;
+  if (default_cfl_adapt_linsol != NULL) delete [] default_cfl_adapt_linsol;
+  if (default_local_freezing   != NULL) delete [] default_local_freezing;
   if (default_jst_coeff != NULL) delete [] default_jst_coeff;
   if (default_ffd_coeff != NULL) delete [] default_ffd_coeff;
   if (default_mixedout_coeff!= NULL) delete [] default_mixedout_coeff;
@@ -7381,6 +8116,35 @@ string CConfig::GetMultiInstance_HistoryFileName(string val_filename, int val_iI
     return multizone_filename;
 }
 
+void CConfig::SetEnsemble_Condition(unsigned short val_iCond) {
+
+  unsigned short iFile;
+  char buffer[50];
+
+  iEnsemble = val_iCond;
+
+  if (nEnsemble_AoA > 0) AoA = Ensemble_AoA[iEnsemble];
+  if (nEnsemble_AoS > 0) AoS = Ensemble_AoS[iEnsemble];
+
+  /*--- Each condition writes its own files, name_<condition>(.dat) ---*/
+
+  string *FileName[5] = {&Conv_FileName, &Breakdown_FileName, &Restart_FlowFileName,
+                         &Flow_FileName, &SurfFlowCoeff_FileName};
+
+  SPRINTF (buffer, "_%d", SU2_TYPE::Int(iEnsemble));
+
+  for (iFile = 0; iFile < 5; iFile++) {
+    string Filename = Ensemble_FileName[iFile];
+    size_t lastindex = Filename.find_last_of(".");
+    if (lastindex != string::npos)
+      Filename = Filename.substr(0, lastindex) + string(buffer) + Filename.substr(lastindex);
+    else
+      Filename.append(string(buffer));
+    *FileName[iFile] = Filename;
+  }
+
+}
+
 string CConfig::GetObjFunc_Extension(string val_filename) {
 
   string AdjExt, Filename = val_filename;
@@ -7392,8 +8156,12 @@ string CConfig::GetObjFunc_Extension(string val_filename) {
     unsigned short lastindex = Filename.find_last_of(".");
     Filename = Filename.substr(0, lastindex);
 
-    if (nObj==1) {
-      switch (Kind_ObjFunc[0]) {
+    /*--- With the objective sweep, the files of the current objective ---*/
+
+    unsigned short iObj_Ext = (DiscreteAdjoint && DiscAdj_ObjSweep)? iObj_Sweep : 0;
+
+    if ((nObj==1) || (DiscreteAdjoint && DiscAdj_ObjSweep)) {
+      switch (Kind_ObjFunc[iObj_Ext]) {
         case DRAG_COEFFICIENT:            AdjExt = "_cd";       break;
         case LIFT_COEFFICIENT:            AdjExt = "_cl";       break;
         case SIDEFORCE_COEFFICIENT:       AdjExt = "_csf";      break;
@@ -8695,6 +9463,29 @@ void CConfig::Tick(double *val_start_time) {
   *val_start_time = MPI_Wtime();
 #endif
 
+#ifdef HAVE_PAPI
+
+  /*--- The counters are read at the start of each timed section and kept on
+   a stack, the sections are nested (e.g. Upwind_Residual within Iterate). ---*/
+
+  if (Profile_PAPI_EventSet == PAPI_NULL) {
+    if (PAPI_is_initialized() == PAPI_NOT_INITED)
+      PAPI_library_init(PAPI_VER_CURRENT);
+    PAPI_create_eventset(&Profile_PAPI_EventSet);
+    int events[] = {PAPI_TOT_CYC, PAPI_TOT_INS, PAPI_FP_OPS, PAPI_L3_TCM};
+    for (unsigned short iEvent = 0; iEvent < 4; iEvent++) {
+      if (PAPI_add_event(Profile_PAPI_EventSet, events[iEvent]) == PAPI_OK)
+        Profile_PAPI_Events.push_back(events[iEvent]);
+    }
+    PAPI_start(Profile_PAPI_EventSet);
+  }
+
+  const size_t nEvents = Profile_PAPI_Events.size();
+  Profile_PAPI_Stack.resize(Profile_PAPI_Stack.size()+nEvents, 0);
+  if (nEvents > 0)
+    PAPI_read(Profile_PAPI_EventSet, &Profile_PAPI_Stack[Profile_PAPI_Stack.size()-nEvents]);
+
+#endif
 #endif
 
 }
@@ -8714,12 +9505,46 @@ void CConfig::Tock(double val_start_time, string val_function_name, int val_grou
   /*--- Compute the elapsed time for this subroutine ---*/
   val_elapsed_time = val_stop_time - val_start_time;
 
-  /*--- Store the subroutine name and the elapsed time ---*/
-  Profile_Function_tp.push_back(val_function_name);
-  Profile_Time_tp.push_back(val_elapsed_time);
-  Profile_ID_tp.push_back(val_group_id);
+  /*--- Accumulate the statistics of the subroutine, the individual calls are
+   not stored such that the memory does not grow with the number of iterations. ---*/
+
+  map<string, int>::iterator MI = Profile_Map_tp.find(val_function_name);
+  int ind;
+
+  if (MI == Profile_Map_tp.end()) {
+    ind = Profile_NCalls_tp.size();
+    Profile_Map_tp[val_function_name] = ind;
+    Profile_ID_tp.push_back(val_group_id);
+    Profile_NCalls_tp.push_back(1);
+    Profile_TotTime_tp.push_back(val_elapsed_time);
+    Profile_MinTime_tp.push_back(val_elapsed_time);
+    Profile_MaxTime_tp.push_back(val_elapsed_time);
+  }
+  else {
+    ind = MI->second;
+    ++Profile_NCalls_tp[ind];
+    Profile_TotTime_tp[ind] += val_elapsed_time;
+    Profile_MinTime_tp[ind]  = min(Profile_MinTime_tp[ind], val_elapsed_time);
+    Profile_MaxTime_tp[ind]  = max(Profile_MaxTime_tp[ind], val_elapsed_time);
+  }
+
+#ifdef HAVE_PAPI
+
+  /*--- Difference of the counters with respect to the matching Tick ---*/
+
+  const size_t nEvents = Profile_PAPI_Events.size();
+  if ((nEvents > 0) && (Profile_PAPI_Stack.size() >= nEvents)) {
+    vector<long long> counters(nEvents);
+    PAPI_read(Profile_PAPI_EventSet, counters.data());
+    Profile_PAPI_Counters_tp.resize(Profile_NCalls_tp.size()*nEvents, 0);
+    for (size_t iEvent = 0; iEvent < nEvents; iEvent++)
+      Profile_PAPI_Counters_tp[ind*nEvents+iEvent] +=
+      counters[iEvent] - Profile_PAPI_Stack[Profile_PAPI_Stack.size()-nEvents+iEvent];
+    Profile_PAPI_Stack.resize(Profile_PAPI_Stack.size()-nEvents);
+  }
 
 #endif
+#endif
 
 }
 
@@ -8735,111 +9560,75 @@ void CConfig::SetProfilingCSV(void) {
 #endif
 
   /*--- Each rank has the same stack trace, so the they have the same
-   function calls and ordering in the vectors. We're going to reduce
-   the timings from each rank and extract the avg, min, and max timings. ---*/
-
-  /*--- First, create a local mapping, so that we can extract the
-   min and max values for each function. ---*/
-
-  for (unsigned int i = 0; i < Profile_Function_tp.size(); i++) {
+   function calls. The map is ordered by name, hence walking it gives the
+   same ordering of the functions on all ranks. The timings of each rank are
+   reduced to extract the avg, min, and max over the ranks. ---*/
 
-    /*--- Add the function and initialize if not already stored (the ID
-     only needs to be stored the first time).---*/
-    if (Profile_Map_tp.find(Profile_Function_tp[i]) == Profile_Map_tp.end()) {
-
-      vector<int> profile; profile.push_back(i);
-      Profile_Map_tp.insert(pair<string,vector<int> >(Profile_Function_tp[i],profile));
-
-    } else {
-
-      /*--- This function has already been added, so simply increment the
-       number of calls and total time for this function. ---*/
-
-      Profile_Map_tp[Profile_Function_tp[i]].push_back(i);
-
-    }
-  }
-
-  /*--- We now have everything gathered by function name, so we can loop over
-   each function and store the min/max times. ---*/
-
-  int map_size = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-    map_size++;
+  int map_size = Profile_Map_tp.size(), min_map_size = map_size, max_map_size = map_size;
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&map_size, &min_map_size, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&map_size, &max_map_size, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+  if (min_map_size != max_map_size) {
+    if (rank == MASTER_NODE)
+      cout << "WARNING: The profiled functions differ between the ranks, profiling.csv is not written." << endl;
+    return;
   }
 
-  /*--- Allocate and initialize memory ---*/
+  /*--- Allocate and initialize memory, the local values are stored in map
+   order: number of calls, total time of the rank, min and max time of a call. ---*/
 
-  double *l_min_red = NULL, *l_max_red = NULL, *l_tot_red = NULL, *l_avg_red = NULL;
-  int *n_calls_red = NULL;
-  double* l_min = new double[map_size];
-  double* l_max = new double[map_size];
-  double* l_tot = new double[map_size];
-  double* l_avg = new double[map_size];
-  int* n_calls  = new int[map_size];
-  for (int i = 0; i < map_size; i++)
-  {
-    l_min[i]   = 1e10;
-    l_max[i]   = 0.0;
-    l_tot[i]   = 0.0;
-    l_avg[i]   = 0.0;
-    n_calls[i] = 0;
-  }
+  unsigned short nEvents = 0;
+#ifdef HAVE_PAPI
+  nEvents = Profile_PAPI_Events.size();
+  Profile_PAPI_Counters_tp.resize(map_size*nEvents, 0);
+#endif
 
-  /*--- Collect the info for each function from the current rank ---*/
+  vector<long>   n_calls(map_size), n_calls_red(map_size);
+  vector<double> l_tot(map_size), l_tot_red(map_size), l_tot_min(map_size), l_tot_max(map_size),
+                 l_min(map_size), l_min_red(map_size), l_max(map_size), l_max_red(map_size),
+                 l_cnt(map_size*nEvents+1), l_cnt_red(map_size*nEvents+1);
+  vector<int>    group(map_size);
 
   int func_counter = 0;
-  for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-    for (unsigned int i = 0; i < (it->second).size(); i++) {
-      n_calls[func_counter]++;
-      l_tot[func_counter] += Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] < l_min[func_counter])
-        l_min[func_counter] = Profile_Time_tp[(it->second)[i]];
-      if (Profile_Time_tp[(it->second)[i]] > l_max[func_counter])
-        l_max[func_counter] = Profile_Time_tp[(it->second)[i]];
-
-    }
-    l_avg[func_counter] = l_tot[func_counter]/((double)n_calls[func_counter]);
+  for (map<string, int>::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
+    const int ind = it->second;
+    n_calls[func_counter] = Profile_NCalls_tp[ind];
+    l_tot[func_counter]   = Profile_TotTime_tp[ind];
+    l_min[func_counter]   = Profile_MinTime_tp[ind];
+    l_max[func_counter]   = Profile_MaxTime_tp[ind];
+    group[func_counter]   = Profile_ID_tp[ind];
+#ifdef HAVE_PAPI
+    for (unsigned short iEvent = 0; iEvent < nEvents; iEvent++)
+      l_cnt[func_counter*nEvents+iEvent] = double(Profile_PAPI_Counters_tp[ind*nEvents+iEvent]);
+#endif
     func_counter++;
   }
 
   /*--- Now reduce the data ---*/
 
-  if (rank == MASTER_NODE) {
-    l_min_red = new double[map_size];
-    l_max_red = new double[map_size];
-    l_tot_red = new double[map_size];
-    l_avg_red = new double[map_size];
-    n_calls_red  = new int[map_size];
-  }
-
 #ifdef HAVE_MPI
-  MPI_Reduce(n_calls, n_calls_red, map_size, MPI_INT, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_tot, l_tot_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_avg, l_avg_red, map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_min, l_min_red, map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-  MPI_Reduce(l_max, l_max_red, map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(n_calls.data(), n_calls_red.data(), map_size, MPI_LONG,   MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_tot.data(),   l_tot_red.data(),   map_size, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_tot.data(),   l_tot_min.data(),   map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_tot.data(),   l_tot_max.data(),   map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_min.data(),   l_min_red.data(),   map_size, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_max.data(),   l_max_red.data(),   map_size, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Reduce(l_cnt.data(),   l_cnt_red.data(),   map_size*nEvents+1, MPI_DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
 #else
-  memcpy(n_calls_red, n_calls, map_size*sizeof(int));
-  memcpy(l_tot_red,   l_tot,   map_size*sizeof(double));
-  memcpy(l_avg_red,   l_avg,   map_size*sizeof(double));
-  memcpy(l_min_red,   l_min,   map_size*sizeof(double));
-  memcpy(l_max_red,   l_max,   map_size*sizeof(double));
+  n_calls_red = n_calls;
+  l_tot_red   = l_tot;
+  l_tot_min   = l_tot;
+  l_tot_max   = l_tot;
+  l_min_red   = l_min;
+  l_max_red   = l_max;
+  l_cnt_red   = l_cnt;
 #endif
 
   /*--- The master rank will write the file ---*/
 
   if (rank == MASTER_NODE) {
 
-    /*--- Take averages over all ranks on the master ---*/
-
-    for (int i = 0; i < map_size; i++) {
-      l_tot_red[i]   = l_tot_red[i]/(double)size;
-      l_avg_red[i]   = l_avg_red[i]/(double)size;
-      n_calls_red[i] = n_calls_red[i]/size;
-    }
-
     /*--- Now write a CSV file with the processed results ---*/
 
     char cstr[200];
@@ -8851,36 +9640,36 @@ void CConfig::SetProfilingCSV(void) {
     Profile_File.precision(15);
     Profile_File.open(cstr, ios::out);
 
-    /*--- Create the CSV header ---*/
+    /*--- Create the CSV header. The total times are taken per rank, the
+     columns give their average, minimum and maximum over the ranks. ---*/
 
-    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"" << endl;
+    Profile_File << "\"Function_Name\", \"N_Calls\", \"Avg_Total_Time\", \"Min_Total_Time\", \"Max_Total_Time\", \"Avg_Time\", \"Min_Time\", \"Max_Time\", \"Function_ID\"";
+#ifdef HAVE_PAPI
+    for (unsigned short iEvent = 0; iEvent < nEvents; iEvent++) {
+      char event_name[PAPI_MAX_STR_LEN];
+      PAPI_event_code_to_name(Profile_PAPI_Events[iEvent], event_name);
+      Profile_File << ", \"Avg_" << event_name << "\"";
+    }
+#endif
+    Profile_File << endl;
 
     /*--- Loop through the map and write the results to the file ---*/
 
     func_counter = 0;
-    for (map<string,vector<int> >::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it) {
-
-      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter] << ", " << l_tot_red[func_counter] << ", " << l_avg_red[func_counter] << ", " << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << (int)Profile_ID_tp[(it->second)[0]] << endl;
-      func_counter++;
+    for (map<string, int>::iterator it=Profile_Map_tp.begin(); it!=Profile_Map_tp.end(); ++it, ++func_counter) {
+      Profile_File << scientific << it->first << ", " << n_calls_red[func_counter]/size << ", "
+                   << l_tot_red[func_counter]/double(size) << ", " << l_tot_min[func_counter] << ", " << l_tot_max[func_counter] << ", "
+                   << l_tot_red[func_counter]/double(max(n_calls_red[func_counter], long(1))) << ", "
+                   << l_min_red[func_counter] << ", " << l_max_red[func_counter] << ", " << group[func_counter];
+      for (unsigned short iEvent = 0; iEvent < nEvents; iEvent++)
+        Profile_File << ", " << l_cnt_red[func_counter*nEvents+iEvent]/double(size);
+      Profile_File << endl;
     }
 
     Profile_File.close();
 
   }
 
-  delete [] l_min;
-  delete [] l_max;
-  delete [] l_avg;
-  delete [] l_tot;
-  delete [] n_calls;
-  if (rank == MASTER_NODE) {
-    delete [] l_min_red;
-    delete [] l_max_red;
-    delete [] l_avg_red;
-    delete [] l_tot_red;
-    delete [] n_calls_red;
-  }
-
 #endif
 
 }
@@ -8988,12 +9777,12 @@ void CConfig::GEMMProfilingCSV(void) {
 
       SU2_MPI::Recv(recvBufNCalls.data(), recvBufNCalls.size(),
                     MPI_LONG, proc, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Recv(recvBufTotTime.data(), recvBufTotTime.size(),
-                    MPI_DOUBLE, proc, 1, MPI_COMM_WORLD, &status);
-      SU2_MPI::Recv(recvBufMinTime.data(), recvBufMinTime.size(),
-                    MPI_DOUBLE, proc, 2, MPI_COMM_WORLD, &status);
-      SU2_MPI::Recv(recvBufMaxTime.data(), recvBufMaxTime.size(),
-                    MPI_DOUBLE, proc, 3, MPI_COMM_WORLD, &status);
+      CBaseMPIWrapper::Recv(recvBufTotTime.data(), recvBufTotTime.size(),
+                            MPI_DOUBLE, proc, 1, MPI_COMM_WORLD, &status);
+      CBaseMPIWrapper::Recv(recvBufMinTime.data(), recvBufMinTime.size(),
+                            MPI_DOUBLE, proc, 2, MPI_COMM_WORLD, &status);
+      CBaseMPIWrapper::Recv(recvBufMaxTime.data(), recvBufMaxTime.size(),
+                            MPI_DOUBLE, proc, 3, MPI_COMM_WORLD, &status);
       SU2_MPI::Recv(recvBufMNK.data(), recvBufMNK.size(),
                     MPI_LONG, proc, 4, MPI_COMM_WORLD, &status);
 
@@ -9044,12 +9833,12 @@ void CConfig::GEMMProfilingCSV(void) {
     /* Send the data to the master node using blocking sends. */
     SU2_MPI::Send(GEMM_Profile_NCalls.data(), GEMM_Profile_NCalls.size(),
                   MPI_LONG, MASTER_NODE, 0, MPI_COMM_WORLD);
-    SU2_MPI::Send(GEMM_Profile_TotTime.data(), GEMM_Profile_TotTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 1, MPI_COMM_WORLD);
-    SU2_MPI::Send(GEMM_Profile_MinTime.data(), GEMM_Profile_MinTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 2, MPI_COMM_WORLD);
-    SU2_MPI::Send(GEMM_Profile_MaxTime.data(), GEMM_Profile_MaxTime.size(),
-                  MPI_DOUBLE, MASTER_NODE, 3, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Send(GEMM_Profile_TotTime.data(), GEMM_Profile_TotTime.size(),
+                          MPI_DOUBLE, MASTER_NODE, 1, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Send(GEMM_Profile_MinTime.data(), GEMM_Profile_MinTime.size(),
+                          MPI_DOUBLE, MASTER_NODE, 2, MPI_COMM_WORLD);
+    CBaseMPIWrapper::Send(GEMM_Profile_MaxTime.data(), GEMM_Profile_MaxTime.size(),
+                          MPI_DOUBLE, MASTER_NODE, 3, MPI_COMM_WORLD);
     SU2_MPI::Send(sendBufMNK.data(), sendBufMNK.size(),
                   MPI_LONG, MASTER_NODE, 4, MPI_COMM_WORLD);
   }
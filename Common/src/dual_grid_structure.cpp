@@ -43,6 +43,15 @@ CDualGrid::CDualGrid(unsigned short val_nDim) { nDim = val_nDim;}
 
 CDualGrid::~CDualGrid() {}
 
+static CMemoryPool& DualGridPool(void) {
+  static CMemoryPool pool;
+  return pool;
+}
+
+void *CDualGrid::operator new(size_t size) { return DualGridPool().Allocate(size); }
+
+void CDualGrid::operator delete(void *ptr, size_t size) { DualGridPool().Deallocate(ptr, size); }
+
 CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *config) : CDualGrid(val_nDim) {
   
   unsigned short iDim, jDim;
@@ -56,6 +65,7 @@ CPoint::CPoint(unsigned short val_nDim, unsigned long val_globalindex, CConfig *
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1 = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  GridMotion_Shared = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
@@ -147,6 +157,7 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, unsigned long val_g
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1  = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  GridMotion_Shared = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
 
@@ -241,6 +252,7 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
   Coord   = NULL;  Coord_Old    = NULL;  Coord_Sum = NULL;
   Coord_n = NULL;  Coord_n1     = NULL;  Coord_p1 = NULL;
   GridVel = NULL;  GridVel_Grad = NULL;
+  GridMotion_Shared = false;
 
   /*--- Volume (0 -> Vol_nP1, 1-> Vol_n, 2 -> Vol_nM1 ) and coordinates of the control volume ---*/
   if ( config->GetUnsteady_Simulation() == NO ) { 
@@ -327,14 +339,16 @@ CPoint::CPoint(su2double val_coord_0, su2double val_coord_1, su2double val_coord
 CPoint::~CPoint() {
 
   if (Vertex       != NULL && Boundary) delete[] Vertex;
-  if (Volume       != NULL) delete[] Volume;
   if (Coord        != NULL) delete[] Coord;
   if (Coord_Old    != NULL) delete[] Coord_Old;
   if (Coord_Sum    != NULL) delete[] Coord_Sum;
-  if (Coord_n      != NULL) delete[] Coord_n;
-  if (Coord_n1     != NULL) delete[] Coord_n1;
   if (Coord_p1     != NULL) delete[] Coord_p1;
-  if (GridVel      != NULL) delete[] GridVel;
+  if (!GridMotion_Shared) {
+    if (Volume     != NULL) delete[] Volume;
+    if (Coord_n    != NULL) delete[] Coord_n;
+    if (Coord_n1   != NULL) delete[] Coord_n1;
+    if (GridVel    != NULL) delete[] GridVel;
+  }
   if (GridVel_Grad != NULL) {
     for (unsigned short iDim = 0; iDim < nDim; iDim++)
       delete [] GridVel_Grad[iDim];
@@ -343,6 +357,24 @@ CPoint::~CPoint() {
   
 }
 
+void CPoint::SetGridMotion_Storage(su2double *val_volume, su2double *val_coord_n, su2double *val_coord_n1, su2double *val_gridvel) {
+
+  if (!GridMotion_Shared) {
+    if (Volume   != NULL) delete[] Volume;
+    if (Coord_n  != NULL) delete[] Coord_n;
+    if (Coord_n1 != NULL) delete[] Coord_n1;
+    if (GridVel  != NULL) delete[] GridVel;
+  }
+
+  Volume   = val_volume;
+  Coord_n  = val_coord_n;
+  Coord_n1 = val_coord_n1;
+  GridVel  = val_gridvel;
+
+  GridMotion_Shared = true;
+
+}
+
 void CPoint::SetPoint(unsigned long val_point) {
 
   unsigned short iPoint;
@@ -404,10 +436,36 @@ CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short
   Nodes[0] = val_iPoint; 
   Nodes[1] = val_jPoint;
 
+  External_Storage = false;
+
+}
+
+CEdge::CEdge(unsigned long val_iPoint, unsigned long val_jPoint, unsigned short val_nDim,
+             unsigned long *val_nodes, su2double *val_normal, su2double *val_coord_cg) : CDualGrid(val_nDim) {
+  
+  unsigned short iDim;
+  
+  /*--- The arrays are provided by the geometry ---*/
+  Coord_CG = val_coord_cg;
+  Normal   = val_normal;
+  Nodes    = val_nodes;
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_CG[iDim] = 0.0;
+    Normal[iDim]   = 0.0;
+  }
+  
+  Nodes[0] = val_iPoint;
+  Nodes[1] = val_jPoint;
+  
+  External_Storage = true;
+  
 }
 
 CEdge::~CEdge() {
   
+  if (External_Storage) return;
+  
   if (Coord_CG != NULL) delete[] Coord_CG;
   if (Normal   != NULL) delete[] Normal;
   if (Nodes    != NULL) delete[] Nodes;
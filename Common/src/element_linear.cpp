@@ -155,6 +155,10 @@ void CTRIA1::ComputeGrad_Linear(void) {
   su2double ad[2][2];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- Use the precomputed gradients of the reference configuration, if available ---*/
+  
+  if (Load_RefGradients()) return;
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     /*--- dN/d xi, dN/d eta ---*/
@@ -213,11 +217,16 @@ void CTRIA1::ComputeGrad_Linear(void) {
 
 void CTRIA1::ComputeGrad_NonLinear(void) {
   
-  su2double Jac_Ref[2][2], Jac_Curr[2][2], dNiXj[3][2];
-  su2double detJac_Ref, detJac_Curr, GradNi_Xj_Ref, GradNi_Xj_Curr;
-  su2double ad_Ref[2][2], ad_Curr[2][2];
+  su2double Jac_Curr[2][2], dNiXj[3][2];
+  su2double detJac_Curr, GradNi_Xj_Curr;
+  su2double ad_Curr[2][2];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- The gradients with respect to the reference configuration do not depend on the
+   current coordinates. They are retrieved from the cache when they were precomputed. ---*/
+  
+  ComputeGrad_Linear();
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     /*--- dN/d xi, dN/d eta ---*/
@@ -231,10 +240,8 @@ void CTRIA1::ComputeGrad_NonLinear(void) {
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = 0.0;
         Jac_Curr[iDim][jDim] = 0.0;
         for (iNode = 0; iNode < nNodes; iNode++) {
-          Jac_Ref[iDim][jDim] = Jac_Ref[iDim][jDim]+RefCoord[iNode][jDim]*dNiXj[iNode][iDim];
           Jac_Curr[iDim][jDim] = Jac_Curr[iDim][jDim]+CurrentCoord[iNode][jDim]*dNiXj[iNode][iDim];
         }
       }
@@ -242,11 +249,6 @@ void CTRIA1::ComputeGrad_NonLinear(void) {
     
     /*--- Adjoint to Jacobian ---*/
     
-    ad_Ref[0][0] = Jac_Ref[1][1];
-    ad_Ref[0][1] = -Jac_Ref[0][1];
-    ad_Ref[1][0] = -Jac_Ref[1][0];
-    ad_Ref[1][1] = Jac_Ref[0][0];
-    
     ad_Curr[0][0] = Jac_Curr[1][1];
     ad_Curr[0][1] = -Jac_Curr[0][1];
     ad_Curr[1][0] = -Jac_Curr[1][0];
@@ -254,17 +256,14 @@ void CTRIA1::ComputeGrad_NonLinear(void) {
     
     /*--- Determinant of Jacobian ---*/
     
-    detJac_Ref = ad_Ref[0][0]*ad_Ref[1][1]-ad_Ref[0][1]*ad_Ref[1][0];
     detJac_Curr = ad_Curr[0][0]*ad_Curr[1][1]-ad_Curr[0][1]*ad_Curr[1][0];
     
-    GaussPoint[iGauss]->SetJ_X(detJac_Ref);
     GaussPoint[iGauss]->SetJ_x(detJac_Curr);
     
     /*--- Jacobian inverse (it was already computed as transpose) ---*/
     
     for (iDim = 0; iDim < 2; iDim++) {
       for (jDim = 0; jDim < 2; jDim++) {
-        Jac_Ref[iDim][jDim] = ad_Ref[iDim][jDim]/detJac_Ref;
         Jac_Curr[iDim][jDim] = ad_Curr[iDim][jDim]/detJac_Curr;
       }
     }
@@ -273,13 +272,10 @@ void CTRIA1::ComputeGrad_NonLinear(void) {
     
     for (iNode = 0; iNode < nNodes; iNode++) {
       for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Xj_Ref = 0.0;
         GradNi_Xj_Curr = 0.0;
         for (jDim = 0; jDim < nDim; jDim++) {
-          GradNi_Xj_Ref += Jac_Ref[iDim][jDim]*dNiXj[iNode][jDim];
           GradNi_Xj_Curr += Jac_Curr[iDim][jDim]*dNiXj[iNode][jDim];
         }
-        GaussPoint[iGauss]->SetGradNi_Xj(GradNi_Xj_Ref, iDim, iNode);
         GaussPoint[iGauss]->SetGradNi_xj(GradNi_Xj_Curr, iDim, iNode);
       }
     }
@@ -456,6 +452,10 @@ void CQUAD4::ComputeGrad_Linear(void) {
   su2double ad[2][2];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- Use the precomputed gradients of the reference configuration, if available ---*/
+  
+  if (Load_RefGradients()) return;
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     Xi = GaussCoord[iGauss][0];
@@ -519,11 +519,16 @@ void CQUAD4::ComputeGrad_Linear(void) {
 void CQUAD4::ComputeGrad_NonLinear(void) {
   
   su2double Xi, Eta;
-  su2double Jac_Ref[2][2], Jac_Curr[2][2], dNiXj[4][2];
-  su2double detJac_Ref, detJac_Curr, GradNi_Xj_Ref, GradNi_Xj_Curr;
-  su2double ad_Ref[2][2], ad_Curr[2][2];
+  su2double Jac_Curr[2][2], dNiXj[4][2];
+  su2double detJac_Curr, GradNi_Xj_Curr;
+  su2double ad_Curr[2][2];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- The gradients with respect to the reference configuration do not depend on the
+   current coordinates. They are retrieved from the cache when they were precomputed. ---*/
+  
+  ComputeGrad_Linear();
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     Xi = GaussCoord[iGauss][0];
@@ -541,10 +546,8 @@ void CQUAD4::ComputeGrad_NonLinear(void) {
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = 0.0;
         Jac_Curr[iDim][jDim] = 0.0;
         for (iNode = 0; iNode < nNodes; iNode++) {
-          Jac_Ref[iDim][jDim] = Jac_Ref[iDim][jDim]+RefCoord[iNode][jDim]*dNiXj[iNode][iDim];
           Jac_Curr[iDim][jDim] = Jac_Curr[iDim][jDim]+CurrentCoord[iNode][jDim]*dNiXj[iNode][iDim];
         }
       }
@@ -552,11 +555,6 @@ void CQUAD4::ComputeGrad_NonLinear(void) {
     
     /*--- Adjoint to Jacobian ---*/
     
-    ad_Ref[0][0] = Jac_Ref[1][1];
-    ad_Ref[0][1] = -Jac_Ref[0][1];
-    ad_Ref[1][0] = -Jac_Ref[1][0];
-    ad_Ref[1][1] = Jac_Ref[0][0];
-    
     ad_Curr[0][0] = Jac_Curr[1][1];
     ad_Curr[0][1] = -Jac_Curr[0][1];
     ad_Curr[1][0] = -Jac_Curr[1][0];
@@ -564,17 +562,14 @@ void CQUAD4::ComputeGrad_NonLinear(void) {
     
     /*--- Determinant of Jacobian ---*/
     
-    detJac_Ref = ad_Ref[0][0]*ad_Ref[1][1]-ad_Ref[0][1]*ad_Ref[1][0];
     detJac_Curr = ad_Curr[0][0]*ad_Curr[1][1]-ad_Curr[0][1]*ad_Curr[1][0];
     
-    GaussPoint[iGauss]->SetJ_X(detJac_Ref);
     GaussPoint[iGauss]->SetJ_x(detJac_Curr);
     
     /*--- Jacobian inverse (it was already computed as transpose) ---*/
     
     for (iDim = 0; iDim < 2; iDim++) {
       for (jDim = 0; jDim < 2; jDim++) {
-        Jac_Ref[iDim][jDim] = ad_Ref[iDim][jDim]/detJac_Ref;
         Jac_Curr[iDim][jDim] = ad_Curr[iDim][jDim]/detJac_Curr;
       }
     }
@@ -583,13 +578,10 @@ void CQUAD4::ComputeGrad_NonLinear(void) {
     
     for (iNode = 0; iNode < nNodes; iNode++) {
       for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Xj_Ref = 0.0;
         GradNi_Xj_Curr = 0.0;
         for (jDim = 0; jDim < nDim; jDim++) {
-          GradNi_Xj_Ref += Jac_Ref[iDim][jDim]*dNiXj[iNode][jDim];
           GradNi_Xj_Curr += Jac_Curr[iDim][jDim]*dNiXj[iNode][jDim];
         }
-        GaussPoint[iGauss]->SetGradNi_Xj(GradNi_Xj_Ref, iDim, iNode);
         GaussPoint[iGauss]->SetGradNi_xj(GradNi_Xj_Curr, iDim, iNode);
       }
     }
@@ -1113,6 +1105,10 @@ void CTETRA1::ComputeGrad_Linear(void) {
   su2double ad[3][3];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- Use the precomputed gradients of the reference configuration, if available ---*/
+  
+  if (Load_RefGradients()) return;
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     /*--- dN/d xi, dN/d eta ---*/
@@ -1177,11 +1173,16 @@ void CTETRA1::ComputeGrad_Linear(void) {
 
 void CTETRA1::ComputeGrad_NonLinear(void) {
   
-  su2double Jac_Ref[3][3], Jac_Curr[3][3], dNiXj[4][3];
-  su2double detJac_Ref, detJac_Curr, GradNi_Xj_Ref, GradNi_Xj_Curr;
-  su2double ad_Ref[3][3], ad_Curr[3][3];
+  su2double Jac_Curr[3][3], dNiXj[4][3];
+  su2double detJac_Curr, GradNi_Xj_Curr;
+  su2double ad_Curr[3][3];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- The gradients with respect to the reference configuration do not depend on the
+   current coordinates. They are retrieved from the cache when they were precomputed. ---*/
+  
+  ComputeGrad_Linear();
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     /*--- dN/d xi, dN/d eta ---*/
@@ -1196,10 +1197,8 @@ void CTETRA1::ComputeGrad_NonLinear(void) {
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = 0.0;
         Jac_Curr[iDim][jDim] = 0.0;
         for (iNode = 0; iNode < nNodes; iNode++) {
-          Jac_Ref[iDim][jDim] = Jac_Ref[iDim][jDim]+RefCoord[iNode][jDim]*dNiXj[iNode][iDim];
           Jac_Curr[iDim][jDim] = Jac_Curr[iDim][jDim]+CurrentCoord[iNode][jDim]*dNiXj[iNode][iDim];
         }
       }
@@ -1207,16 +1206,6 @@ void CTETRA1::ComputeGrad_NonLinear(void) {
     
     /*--- Adjoint to Jacobian ---*/
     
-    ad_Ref[0][0] = Jac_Ref[1][1]*Jac_Ref[2][2]-Jac_Ref[1][2]*Jac_Ref[2][1];
-    ad_Ref[0][1] = Jac_Ref[0][2]*Jac_Ref[2][1]-Jac_Ref[0][1]*Jac_Ref[2][2];
-    ad_Ref[0][2] = Jac_Ref[0][1]*Jac_Ref[1][2]-Jac_Ref[0][2]*Jac_Ref[1][1];
-    ad_Ref[1][0] = Jac_Ref[1][2]*Jac_Ref[2][0]-Jac_Ref[1][0]*Jac_Ref[2][2];
-    ad_Ref[1][1] = Jac_Ref[0][0]*Jac_Ref[2][2]-Jac_Ref[0][2]*Jac_Ref[2][0];
-    ad_Ref[1][2] = Jac_Ref[0][2]*Jac_Ref[1][0]-Jac_Ref[0][0]*Jac_Ref[1][2];
-    ad_Ref[2][0] = Jac_Ref[1][0]*Jac_Ref[2][1]-Jac_Ref[1][1]*Jac_Ref[2][0];
-    ad_Ref[2][1] = Jac_Ref[0][1]*Jac_Ref[2][0]-Jac_Ref[0][0]*Jac_Ref[2][1];
-    ad_Ref[2][2] = Jac_Ref[0][0]*Jac_Ref[1][1]-Jac_Ref[0][1]*Jac_Ref[1][0];
-    
     ad_Curr[0][0] = Jac_Curr[1][1]*Jac_Curr[2][2]-Jac_Curr[1][2]*Jac_Curr[2][1];
     ad_Curr[0][1] = Jac_Curr[0][2]*Jac_Curr[2][1]-Jac_Curr[0][1]*Jac_Curr[2][2];
     ad_Curr[0][2] = Jac_Curr[0][1]*Jac_Curr[1][2]-Jac_Curr[0][2]*Jac_Curr[1][1];
@@ -1230,17 +1219,14 @@ void CTETRA1::ComputeGrad_NonLinear(void) {
     
     /*--- Determinant of Jacobian ---*/
     
-    detJac_Ref = Jac_Ref[0][0]*ad_Ref[0][0]+Jac_Ref[0][1]*ad_Ref[1][0]+Jac_Ref[0][2]*ad_Ref[2][0];
     detJac_Curr = Jac_Curr[0][0]*ad_Curr[0][0]+Jac_Curr[0][1]*ad_Curr[1][0]+Jac_Curr[0][2]*ad_Curr[2][0];
     
-    GaussPoint[iGauss]->SetJ_X(detJac_Ref);
     GaussPoint[iGauss]->SetJ_x(detJac_Curr);
     
     /*--- Jacobian inverse (it was already computed as transpose) ---*/
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = ad_Ref[iDim][jDim]/detJac_Ref;
         Jac_Curr[iDim][jDim] = ad_Curr[iDim][jDim]/detJac_Curr;
       }
     }
@@ -1249,13 +1235,10 @@ void CTETRA1::ComputeGrad_NonLinear(void) {
     
     for (iNode = 0; iNode < nNodes; iNode++) {
       for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Xj_Ref = 0.0;
         GradNi_Xj_Curr = 0.0;
         for (jDim = 0; jDim < nDim; jDim++) {
-          GradNi_Xj_Ref += Jac_Ref[iDim][jDim]*dNiXj[iNode][jDim];
           GradNi_Xj_Curr += Jac_Curr[iDim][jDim]*dNiXj[iNode][jDim];
         }
-        GaussPoint[iGauss]->SetGradNi_Xj(GradNi_Xj_Ref, iDim, iNode);
         GaussPoint[iGauss]->SetGradNi_xj(GradNi_Xj_Curr, iDim, iNode);
       }
     }
@@ -1461,6 +1444,10 @@ void CHEXA8::ComputeGrad_Linear(void) {
   su2double ad[3][3];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- Use the precomputed gradients of the reference configuration, if available ---*/
+  
+  if (Load_RefGradients()) return;
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     Xi = GaussCoord[iGauss][0];
@@ -1558,11 +1545,16 @@ void CHEXA8::ComputeGrad_Linear(void) {
 void CHEXA8::ComputeGrad_NonLinear(void) {
   
   su2double Xi, Eta, Zeta;
-  su2double Jac_Ref[3][3], Jac_Curr[3][3], dNiXj[8][3];
-  su2double detJac_Ref, detJac_Curr, GradNi_Xj_Ref, GradNi_Xj_Curr;
-  su2double ad_Ref[3][3], ad_Curr[3][3];
+  su2double Jac_Curr[3][3], dNiXj[8][3];
+  su2double detJac_Curr, GradNi_Xj_Curr;
+  su2double ad_Curr[3][3];
   unsigned short iNode, iDim, jDim, iGauss;
   
+  /*--- The gradients with respect to the reference configuration do not depend on the
+   current coordinates. They are retrieved from the cache when they were precomputed. ---*/
+  
+  ComputeGrad_Linear();
+  
   for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
     
     Xi = GaussCoord[iGauss][0];
@@ -1609,10 +1601,8 @@ void CHEXA8::ComputeGrad_NonLinear(void) {
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = 0.0;
         Jac_Curr[iDim][jDim] = 0.0;
         for (iNode = 0; iNode < nNodes; iNode++) {
-          Jac_Ref[iDim][jDim] = Jac_Ref[iDim][jDim]+RefCoord[iNode][jDim]*dNiXj[iNode][iDim];
           Jac_Curr[iDim][jDim] = Jac_Curr[iDim][jDim]+CurrentCoord[iNode][jDim]*dNiXj[iNode][iDim];
         }
       }
@@ -1620,16 +1610,6 @@ void CHEXA8::ComputeGrad_NonLinear(void) {
     
     /*--- Adjoint to Jacobian ---*/
     
-    ad_Ref[0][0] = Jac_Ref[1][1]*Jac_Ref[2][2]-Jac_Ref[1][2]*Jac_Ref[2][1];
-    ad_Ref[0][1] = Jac_Ref[0][2]*Jac_Ref[2][1]-Jac_Ref[0][1]*Jac_Ref[2][2];
-    ad_Ref[0][2] = Jac_Ref[0][1]*Jac_Ref[1][2]-Jac_Ref[0][2]*Jac_Ref[1][1];
-    ad_Ref[1][0] = Jac_Ref[1][2]*Jac_Ref[2][0]-Jac_Ref[1][0]*Jac_Ref[2][2];
-    ad_Ref[1][1] = Jac_Ref[0][0]*Jac_Ref[2][2]-Jac_Ref[0][2]*Jac_Ref[2][0];
-    ad_Ref[1][2] = Jac_Ref[0][2]*Jac_Ref[1][0]-Jac_Ref[0][0]*Jac_Ref[1][2];
-    ad_Ref[2][0] = Jac_Ref[1][0]*Jac_Ref[2][1]-Jac_Ref[1][1]*Jac_Ref[2][0];
-    ad_Ref[2][1] = Jac_Ref[0][1]*Jac_Ref[2][0]-Jac_Ref[0][0]*Jac_Ref[2][1];
-    ad_Ref[2][2] = Jac_Ref[0][0]*Jac_Ref[1][1]-Jac_Ref[0][1]*Jac_Ref[1][0];
-    
     ad_Curr[0][0] = Jac_Curr[1][1]*Jac_Curr[2][2]-Jac_Curr[1][2]*Jac_Curr[2][1];
     ad_Curr[0][1] = Jac_Curr[0][2]*Jac_Curr[2][1]-Jac_Curr[0][1]*Jac_Curr[2][2];
     ad_Curr[0][2] = Jac_Curr[0][1]*Jac_Curr[1][2]-Jac_Curr[0][2]*Jac_Curr[1][1];
@@ -1643,17 +1623,14 @@ void CHEXA8::ComputeGrad_NonLinear(void) {
     
     /*--- Determinant of Jacobian ---*/
     
-    detJac_Ref = Jac_Ref[0][0]*ad_Ref[0][0]+Jac_Ref[0][1]*ad_Ref[1][0]+Jac_Ref[0][2]*ad_Ref[2][0];
     detJac_Curr = Jac_Curr[0][0]*ad_Curr[0][0]+Jac_Curr[0][1]*ad_Curr[1][0]+Jac_Curr[0][2]*ad_Curr[2][0];
     
-    GaussPoint[iGauss]->SetJ_X(detJac_Ref);
     GaussPoint[iGauss]->SetJ_x(detJac_Curr);
     
     /*--- Jacobian inverse (it was already computed as transpose) ---*/
     
     for (iDim = 0; iDim < nDim; iDim++) {
       for (jDim = 0; jDim < nDim; jDim++) {
-        Jac_Ref[iDim][jDim] = ad_Ref[iDim][jDim]/detJac_Ref;
         Jac_Curr[iDim][jDim] = ad_Curr[iDim][jDim]/detJac_Curr;
       }
     }
@@ -1662,13 +1639,10 @@ void CHEXA8::ComputeGrad_NonLinear(void) {
     
     for (iNode = 0; iNode < nNodes; iNode++) {
       for (iDim = 0; iDim < nDim; iDim++) {
-        GradNi_Xj_Ref = 0.0;
         GradNi_Xj_Curr = 0.0;
         for (jDim = 0; jDim < nDim; jDim++) {
-          GradNi_Xj_Ref += Jac_Ref[iDim][jDim]*dNiXj[iNode][jDim];
           GradNi_Xj_Curr += Jac_Curr[iDim][jDim]*dNiXj[iNode][jDim];
         }
-        GaussPoint[iGauss]->SetGradNi_Xj(GradNi_Xj_Ref, iDim, iNode);
         GaussPoint[iGauss]->SetGradNi_xj(GradNi_Xj_Curr, iDim, iNode);
       }
     }
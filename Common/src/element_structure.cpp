@@ -72,6 +72,8 @@ CElement::CElement(void) {
   iDe = 0;
   iDV = 0;
   iProp = 0;
+  
+  RefGradients = NULL;
 }
 
 
@@ -111,6 +113,8 @@ CElement::CElement(unsigned short val_nDim, CConfig *config) {
   iDe = 0;
   iDV = 0;
   iProp = 0;
+  
+  RefGradients = NULL;
 
 }
 
@@ -334,3 +338,37 @@ void CElement::Set_ElProperties(CElementProperty *input_element) {
 
 }
 
+
+void CElement::Store_RefGradients(su2double *val_RefGradients) {
+
+  unsigned short iGauss, iNode, iDim;
+  unsigned long iPos = 0;
+
+  for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
+    val_RefGradients[iPos++] = GaussPoint[iGauss]->GetJ_X();
+    for (iNode = 0; iNode < nNodes; iNode++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        val_RefGradients[iPos++] = GaussPoint[iGauss]->GetGradNi_Xj(iNode, iDim);
+  }
+
+}
+
+bool CElement::Load_RefGradients(void) {
+
+  unsigned short iGauss, iNode, iDim;
+  unsigned long iPos = 0;
+
+  if (RefGradients == NULL) return false;
+
+  for (iGauss = 0; iGauss < nGaussPoints; iGauss++) {
+    GaussPoint[iGauss]->SetJ_X(RefGradients[iPos++]);
+    for (iNode = 0; iNode < nNodes; iNode++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        GaussPoint[iGauss]->SetGradNi_Xj(RefGradients[iPos++], iDim, iNode);
+  }
+
+  RefGradients = NULL;
+
+  return true;
+
+}
@@ -32,6 +32,8 @@
 #include "../include/fem_geometry_structure.hpp"
 #include "../include/adt_structure.hpp"
 
+#include <unordered_map>
+
 /* Prototypes for Lapack functions, if MKL or LAPACK is used. */
 #if defined (HAVE_MKL) || defined(HAVE_LAPACK)
 extern "C" void dpotrf_(char *, int*, passivedouble*, int*, int*);
@@ -324,6 +326,7 @@ void CSurfaceElementFEM::Copy(const CSurfaceElementFEM &other) {
   nIntPerWallFunctionDonor = other.nIntPerWallFunctionDonor;
   intPerWallFunctionDonor  = other.intPerWallFunctionDonor;
   matWallFunctionDonor     = other.matWallFunctionDonor;
+  wallModelProfile         = other.wallModelProfile;
 }
 
 CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
@@ -542,7 +545,7 @@ CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
                    dest, dest, MPI_COMM_WORLD, &commReqs[3*i]);
     SU2_MPI::Isend(longSendBuf[i].data(), longSendBuf[i].size(), MPI_LONG,
                    dest, dest+1, MPI_COMM_WORLD, &commReqs[3*i+1]);
-    SU2_MPI::Isend(doubleSendBuf[i].data(), doubleSendBuf[i].size(), MPI_DOUBLE,
+    SU2_MPI::Isend(doubleSendBuf[i].data(), doubleSendBuf[i].size(), MPI_SU2DOUBLE,
                    dest, dest+2, MPI_COMM_WORLD, &commReqs[3*i+2]);
   }
 
@@ -574,10 +577,10 @@ CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
 
     /* Idem for the message with doubles. */
     SU2_MPI::Probe(source, rank+2, MPI_COMM_WORLD, &status);
-    SU2_MPI::Get_count(&status, MPI_DOUBLE, &sizeMess);
+    SU2_MPI::Get_count(&status, MPI_SU2DOUBLE, &sizeMess);
     doubleRecvBuf[i].resize(sizeMess);
 
-    SU2_MPI::Recv(doubleRecvBuf[i].data(), sizeMess, MPI_DOUBLE,
+    SU2_MPI::Recv(doubleRecvBuf[i].data(), sizeMess, MPI_SU2DOUBLE,
                   source, rank+2, MPI_COMM_WORLD, &status);
   }
 
@@ -1745,7 +1748,7 @@ CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
                    dest, dest+1, MPI_COMM_WORLD, &commReqs[3*i]);
     SU2_MPI::Isend(longSendBuf[i].data(), longSendBuf[i].size(), MPI_LONG,
                    dest, dest+2, MPI_COMM_WORLD, &commReqs[3*i+1]);
-    SU2_MPI::Isend(doubleSendBuf[i].data(), doubleSendBuf[i].size(), MPI_DOUBLE,
+    SU2_MPI::Isend(doubleSendBuf[i].data(), doubleSendBuf[i].size(), MPI_SU2DOUBLE,
                    dest, dest+3, MPI_COMM_WORLD, &commReqs[3*i+2]);
 #endif
   }
@@ -1793,10 +1796,10 @@ CMeshFEM::CMeshFEM(CGeometry *geometry, CConfig *config) {
 
     /* Idem for the message with doubles. */
     SU2_MPI::Probe(sourceRank[i], rank+3, MPI_COMM_WORLD, &status);
-    SU2_MPI::Get_count(&status, MPI_DOUBLE, &sizeMess);
+    SU2_MPI::Get_count(&status, MPI_SU2DOUBLE, &sizeMess);
     doubleRecvBuf[i].resize(sizeMess);
 
-    SU2_MPI::Recv(doubleRecvBuf[i].data(), sizeMess, MPI_DOUBLE,
+    SU2_MPI::Recv(doubleRecvBuf[i].data(), sizeMess, MPI_SU2DOUBLE,
                   sourceRank[i], rank+3, MPI_COMM_WORLD, &status);
   }
 
@@ -2491,7 +2494,7 @@ void CMeshFEM::SetPositive_ZArea(CConfig *config) {
 
 #ifdef HAVE_MPI
   su2double locArea = PositiveZArea;
-  SU2_MPI::Allreduce(&locArea, &PositiveZArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&locArea, &PositiveZArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
 
   /*---------------------------------------------------------------------------*/
@@ -2670,6 +2673,14 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
 
   /*--- Loop over the volume elements stored on this rank, including the halos. ---*/
   vector<CFaceOfElement> localFaces;
+  localFaces.reserve(6*nVolElemTot);
+
+  /*--- Hash table of the faces created so far, which stores their index in
+        localFaces. A matching face is merged as soon as its second side is
+        created, such that the faces do not need to be sorted for this. ---*/
+  typedef unordered_map<CFaceOfElement, unsigned long, CFaceOfElementHash> MapFaces;
+  MapFaces mapFaces;
+  mapFaces.reserve(4*nVolElemTot);
 
   for(unsigned long k=0; k<nVolElemTot; ++k) {
 
@@ -2721,60 +2732,55 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
         }
       }
 
-      /* Renumber the corner points of the face, but keep the orientation.
-         Afterwards, add it to localFaces. */
+      /* Renumber the corner points of the face, but keep the orientation. */
       thisFace.CreateUniqueNumberingWithOrientation();
 
-      localFaces.push_back(thisFace);
-    }
-  }
-
-  /*--- Sort the the local faces in increasing order. ---*/
-  sort(localFaces.begin(), localFaces.end());
-
-  /*--- Loop over the faces to merge the matching faces. ---*/
-  for(unsigned long i=1; i<localFaces.size(); ++i) {
-
-    /* Check for a matching face with the previous face in the vector.
-       Note that the == operator only checks the node IDs. */
-    if(localFaces[i] == localFaces[i-1]) {
-
-      /* Faces are matching. Check if it should be kept, i.e. if one
-         of the elements owns the face. */
-      if(localFaces[i].elem0IsOwner || localFaces[i-1].elem0IsOwner) {
+      /* Check for a matching face created earlier. Note that the hash and
+         the == operator only use the node IDs. */
+      pair<MapFaces::iterator, bool> ins = mapFaces.insert(make_pair(thisFace, localFaces.size()));
+      if( !ins.second ) {
+
+        /* Faces are matching. Check if it should be kept, i.e. if one
+           of the elements owns the face. */
+        CFaceOfElement &prevFace = localFaces[ins.first->second];
+        if(thisFace.elem0IsOwner || prevFace.elem0IsOwner) {
+
+          /* Store the data for this matching face in prevFace. */
+          if(thisFace.elemID0 < nVolElemTot) {
+            prevFace.elemID0      = thisFace.elemID0;
+            prevFace.nPolyGrid0   = thisFace.nPolyGrid0;
+            prevFace.nPolySol0    = thisFace.nPolySol0;
+            prevFace.nDOFsElem0   = thisFace.nDOFsElem0;
+            prevFace.elemType0    = thisFace.elemType0;
+            prevFace.faceID0      = thisFace.faceID0;
+            prevFace.elem0IsOwner = thisFace.elem0IsOwner;
+          }
+          else {
+            prevFace.elemID1    = thisFace.elemID1;
+            prevFace.nPolyGrid1 = thisFace.nPolyGrid1;
+            prevFace.nPolySol1  = thisFace.nPolySol1;
+            prevFace.nDOFsElem1 = thisFace.nDOFsElem1;
+            prevFace.elemType1  = thisFace.elemType1;
+            prevFace.faceID1    = thisFace.faceID1;
+          }
 
-        /* Store the data for this matching face in faces[i-1]. */
-        if(localFaces[i].elemID0 < nVolElemTot) {
-          localFaces[i-1].elemID0      = localFaces[i].elemID0;
-          localFaces[i-1].nPolyGrid0   = localFaces[i].nPolyGrid0;
-          localFaces[i-1].nPolySol0    = localFaces[i].nPolySol0;
-          localFaces[i-1].nDOFsElem0   = localFaces[i].nDOFsElem0;
-          localFaces[i-1].elemType0    = localFaces[i].elemType0;
-          localFaces[i-1].faceID0      = localFaces[i].faceID0;
-          localFaces[i-1].elem0IsOwner = localFaces[i].elem0IsOwner;
-        }
-        else {
-          localFaces[i-1].elemID1    = localFaces[i].elemID1;
-          localFaces[i-1].nPolyGrid1 = localFaces[i].nPolyGrid1;
-          localFaces[i-1].nPolySol1  = localFaces[i].nPolySol1;
-          localFaces[i-1].nDOFsElem1 = localFaces[i].nDOFsElem1;
-          localFaces[i-1].elemType1  = localFaces[i].elemType1;
-          localFaces[i-1].faceID1    = localFaces[i].faceID1;
-        }
+          /* Adapt the boolean to indicate whether or not the face has a constant
+             Jacobian of the transformation, although in principle this info
+             should be the same for both faces. */
+          if( !(prevFace.JacFaceIsConsideredConstant &&
+                thisFace.JacFaceIsConsideredConstant) ) {
+            prevFace.JacFaceIsConsideredConstant = false;
+          }
 
-        /* Adapt the boolean to indicate whether or not the face has a constant
-           Jacobian of the transformation, although in principle this info
-           should be the same for both faces. */
-        if( !(localFaces[i-1].JacFaceIsConsideredConstant &&
-              localFaces[i].JacFaceIsConsideredConstant) ) {
-          localFaces[i-1].JacFaceIsConsideredConstant = false;
+          /* Set the face indicator of prevFace to -1 to indicate an internal
+             face and set elem0IsOwner for thisFace to false. */
+          prevFace.faceIndicator = -1;
+          thisFace.elem0IsOwner  = false;
         }
-
-        /* Set this face indicator to -1 to indicate an internal face
-           and set elem0IsOwner for localFaces[i] to false. */
-        localFaces[i-1].faceIndicator = -1;
-        localFaces[i].elem0IsOwner    = false;
       }
+
+      /* Add the face to localFaces. */
+      localFaces.push_back(thisFace);
     }
   }
 
@@ -2801,9 +2807,9 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
         thisFace.CreateUniqueNumberingWithOrientation();
 
         /* Search for thisFace in localFaces. It must be found. */
-        if( binary_search(localFaces.begin(), localFaces.end(), thisFace) ) {
-          vector<CFaceOfElement>::iterator low;
-          low = lower_bound(localFaces.begin(), localFaces.end(), thisFace);
+        MapFaces::const_iterator MI = mapFaces.find(thisFace);
+        if(MI != mapFaces.end()) {
+          CFaceOfElement *low = &localFaces[MI->second];
           low->faceIndicator = iMarker;
 
           /* A few additional checks. */
@@ -2833,24 +2839,18 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
       localFaces[i].faceIndicator = -1;
   }
 
-  /*--- Remove the invalid faces. This is accomplished by giving the face four
-        points and global node ID's that are larger than the largest local point
-        ID in the grid. In this way the sorting operator puts these faces at the
-        end of the vector, see also the < operator of CFaceOfElement. ---*/
-  unsigned long nFacesLoc = localFaces.size();
+  /*--- Release the memory of the hash table and remove the invalid faces,
+        while keeping the order of the remaining faces. ---*/
+  MapFaces().swap(mapFaces);
+
+  unsigned long nFacesLoc = 0;
   for(unsigned long i=0; i<localFaces.size(); ++i) {
-    if(localFaces[i].faceIndicator == -2) {
-      unsigned long invalID = meshPoints.size();
-      localFaces[i].nCornerPoints = 4;
-      localFaces[i].cornerPoints[0] = invalID;
-      localFaces[i].cornerPoints[1] = invalID;
-      localFaces[i].cornerPoints[2] = invalID;
-      localFaces[i].cornerPoints[3] = invalID;
-      --nFacesLoc;
+    if(localFaces[i].faceIndicator != -2) {
+      if(nFacesLoc != i) localFaces[nFacesLoc] = localFaces[i];
+      ++nFacesLoc;
     }
   }
 
-  sort(localFaces.begin(), localFaces.end());
   localFaces.resize(nFacesLoc);
 
   /*---------------------------------------------------------------------------*/
@@ -3066,7 +3066,7 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
 
   /*--- Loop over localFaces to create the connectivity information, which
         is stored in matchingFaces. ---*/
-  unsigned long ii = 0;
+  unsigned long ii = 0, indLast = 0;
   for(unsigned long i=0; i<localFaces.size(); ++i) {
     if(localFaces[i].faceIndicator == -1 && localFaces[i].elemID1 < nVolElemTot) {
 
@@ -3173,10 +3173,13 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
       /*--- Search in the standard elements for faces for a matching
             standard element. If not found, create a new standard element.
             Note that both the grid and the solution representation must
-            match with the standard element. ---*/
+            match with the standard element. The search starts at the
+            standard element of the previous face. ---*/
+      const unsigned long nStandard = standardMatchingFacesSol.size();
       unsigned long j;
-      for(j=0; j<standardMatchingFacesSol.size(); ++j) {
-        if(standardMatchingFacesSol[j].SameStandardMatchingFace(VTK_Type,
+      for(j=0; j<nStandard; ++j) {
+        const unsigned long jj = (indLast + j)%nStandard;
+        if(standardMatchingFacesSol[jj].SameStandardMatchingFace(VTK_Type,
                                                                 localFaces[i].JacFaceIsConsideredConstant,
                                                                 localFaces[i].elemType0,
                                                                 localFaces[i].nPolySol0,
@@ -3184,7 +3187,7 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
                                                                 localFaces[i].nPolySol1,
                                                                 swapFaceInElementSide0,
                                                                 swapFaceInElementSide1) &&
-           standardMatchingFacesGrid[j].SameStandardMatchingFace(VTK_Type,
+           standardMatchingFacesGrid[jj].SameStandardMatchingFace(VTK_Type,
                                                                  localFaces[i].JacFaceIsConsideredConstant,
                                                                  localFaces[i].elemType0,
                                                                  localFaces[i].nPolyGrid0,
@@ -3192,13 +3195,13 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
                                                                  localFaces[i].nPolyGrid1,
                                                                  swapFaceInElementSide0,
                                                                  swapFaceInElementSide1) ) {
-          matchingFaces[ii].indStandardElement = j;
+          matchingFaces[ii].indStandardElement = indLast = jj;
           break;
         }
       }
 
       /* Create the new standard elements if no match was found. */
-      if(j == standardMatchingFacesSol.size()) {
+      if(j == nStandard) {
 
         standardMatchingFacesSol.push_back(CFEMStandardInternalFace(VTK_Type,
                                                                     localFaces[i].elemType0,
@@ -3220,7 +3223,7 @@ void CMeshFEM_DG::CreateFaces(CConfig *config) {
                                                                      swapFaceInElementSide1,
                                                                      config,
                                                                      standardMatchingFacesSol[j].GetOrderExact()) );
-        matchingFaces[ii].indStandardElement = j;
+        matchingFaces[ii].indStandardElement = indLast = j;
       }
 
       /* Update the counter ii for the next internal matching face. */
@@ -3461,25 +3464,29 @@ void CMeshFEM_DG::CreateStandardVolumeElements(CConfig *config) {
         standard element of the grid the  order for the integration of the
         solution is used, such that the metric terms are computed in the correct
         integration points in case the polynomial order of the solution differs
-        from that of the grid. ---*/
+        from that of the grid. The search starts at the standard element of the
+        previous element, because consecutive elements are mostly identical. ---*/
+  unsigned long indLast = 0;
   for(unsigned long i=0; i<nVolElemTot; ++i) {
 
     /* Check the existing standard elements in the list. */
+    const unsigned long nStandard = standardElementsSol.size();
     unsigned long j;
-    for(j=0; j<standardElementsSol.size(); ++j) {
-      if(standardElementsSol[j].SameStandardElement(volElem[i].VTK_Type,
-                                                    volElem[i].nPolySol,
-                                                    volElem[i].JacIsConsideredConstant) &&
-         standardElementsGrid[j].SameStandardElement(volElem[i].VTK_Type,
-                                                     volElem[i].nPolyGrid,
-                                                     volElem[i].JacIsConsideredConstant) ) {
-         volElem[i].indStandardElement = j;
+    for(j=0; j<nStandard; ++j) {
+      const unsigned long jj = (indLast + j)%nStandard;
+      if(standardElementsSol[jj].SameStandardElement(volElem[i].VTK_Type,
+                                                     volElem[i].nPolySol,
+                                                     volElem[i].JacIsConsideredConstant) &&
+         standardElementsGrid[jj].SameStandardElement(volElem[i].VTK_Type,
+                                                      volElem[i].nPolyGrid,
+                                                      volElem[i].JacIsConsideredConstant) ) {
+         volElem[i].indStandardElement = indLast = jj;
          break;
       }
     }
 
     /* Create the new standard elements if no match was found. */
-    if(j == standardElementsSol.size()) {
+    if(j == nStandard) {
 
       standardElementsSol.push_back(CFEMStandardElement(volElem[i].VTK_Type,
                                                         volElem[i].nPolySol,
@@ -3494,7 +3501,7 @@ void CMeshFEM_DG::CreateStandardVolumeElements(CConfig *config) {
                                                          standardElementsSol[j].GetRDOFs(),
                                                          standardElementsSol[j].GetSDOFs(),
                                                          standardElementsSol[j].GetTDOFs()) );
-      volElem[i].indStandardElement = j;
+      volElem[i].indStandardElement = indLast = j;
     }
   }
 }
@@ -5232,7 +5239,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
         recvBuf[i][j] = volElem[entitiesRecv[i][j]].lenScale;
 
       /* Send the data. */
-      SU2_MPI::Isend(recvBuf[i].data(), recvBuf[i].size(), MPI_DOUBLE,
+      SU2_MPI::Isend(recvBuf[i].data(), recvBuf[i].size(), MPI_SU2DOUBLE,
                      ranksRecv[i], ranksRecv[i]+10, MPI_COMM_WORLD,
                      &recvRequests[nRecvRequests++]);
     }
@@ -5247,7 +5254,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
       /* Allocate the memory for communication buffer and post the receive. */
       sendBuf[i].resize(entitiesSend[i].size());
 
-      SU2_MPI::Irecv(sendBuf[i].data(), sendBuf[i].size(), MPI_DOUBLE,
+      SU2_MPI::Irecv(sendBuf[i].data(), sendBuf[i].size(), MPI_SU2DOUBLE,
                      ranksSend[i], rank+10, MPI_COMM_WORLD,
                      &sendRequests[nSendRequests++]);
     }
@@ -5325,8 +5332,10 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
        for this element. Note that the Jacobian is the first variable stored
        in the metric terms of the integration points. */
     su2double minJacElem = metric[0];
-    for(unsigned short k=1; k<nInt; ++k)
-      minJacElem = min(minJacElem, metric[k*nMetricPerPoint]);
+    if( !volElem[i].metricTermsConstant ) {
+      for(unsigned short k=1; k<nInt; ++k)
+        minJacElem = min(minJacElem, metric[k*nMetricPerPoint]);
+    }
 
     /* Determine the length scale of the element, for which the length
        scale of the reference element, 2.0, must be taken into account. */
@@ -5350,7 +5359,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
         sendBuf[i][j] = volElem[entitiesSend[i][j]].lenScale;
 
       /* Send the data. */
-      SU2_MPI::Isend(sendBuf[i].data(), sendBuf[i].size(), MPI_DOUBLE,
+      SU2_MPI::Isend(sendBuf[i].data(), sendBuf[i].size(), MPI_SU2DOUBLE,
                      ranksSend[i], ranksSend[i]+20, MPI_COMM_WORLD,
                      &sendRequests[nSendRequests++]);
     }
@@ -5363,7 +5372,7 @@ void CMeshFEM_DG::LengthScaleVolumeElements(void) {
     if(ranksRecv[i] != rank) {
 
       /* Post the nonblocking receive. */
-      SU2_MPI::Irecv(recvBuf[i].data(), recvBuf[i].size(), MPI_DOUBLE,
+      SU2_MPI::Irecv(recvBuf[i].data(), recvBuf[i].size(), MPI_SU2DOUBLE,
                      ranksRecv[i], rank+20, MPI_COMM_WORLD,
                      &recvRequests[nRecvRequests++]);
     }
@@ -5879,6 +5888,63 @@ void CMeshFEM_DG::MetricTermsVolumeElements(CConfig *config) {
       volElem[i].invMassMatrix = massMat;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 4: Store the metric terms only once for the elements for      ---*/
+  /*---         which they are constant, if desired.                       ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if( config->GetCompressed_MetricTerms_DGFEM() ) {
+
+    /* Loop over the owned volume elements. */
+    for(unsigned long i=0; i<nVolElemOwned; ++i) {
+
+      /* Determine the number of integration points and solution DOFs. */
+      const unsigned short ind      = volElem[i].indStandardElement;
+      const unsigned short nInt     = standardElementsSol[ind].GetNIntegration();
+      const unsigned short nDOFsSol = volElem[i].nDOFsSol;
+
+      /* Determine the tolerance for the comparison of the metric terms,
+         which is relative to the largest metric term in the first
+         integration point. */
+      const su2double *metric0 = volElem[i].metricTerms.data();
+      su2double tolMetric = 0.0;
+      for(unsigned short k=0; k<nMetricPerPoint; ++k)
+        tolMetric = max(tolMetric, fabs(metric0[k]));
+      tolMetric *= 1.e-12;
+
+      /* Check whether the metric terms in all integration points and all
+         solution DOFs are identical to the ones of the first integration
+         point. This is the case for elements with an affine mapping. */
+      bool metricConstant = true;
+      for(unsigned short j=1; j<nInt; ++j) {
+        const su2double *metric = metric0 + j*nMetricPerPoint;
+        for(unsigned short k=0; k<nMetricPerPoint; ++k)
+          if(fabs(metric[k]-metric0[k]) > tolMetric) metricConstant = false;
+      }
+
+      for(unsigned short j=0; j<nDOFsSol; ++j) {
+        const su2double *metric = volElem[i].metricTermsSolDOFs.data() + j*nMetricPerPoint;
+        for(unsigned short k=0; k<nMetricPerPoint; ++k)
+          if(fabs(metric[k]-metric0[k]) > tolMetric) metricConstant = false;
+      }
+
+      /* Keep only the data of the first point, if the metric terms are
+         constant. The swap construction is used to release the memory. */
+      if( metricConstant ) {
+        volElem[i].metricTermsConstant = true;
+
+        vector<su2double>(volElem[i].metricTerms.begin(),
+                          volElem[i].metricTerms.begin()+nMetricPerPoint).swap(volElem[i].metricTerms);
+        vector<su2double>(volElem[i].metricTerms.begin(),
+                          volElem[i].metricTerms.end()).swap(volElem[i].metricTermsSolDOFs);
+
+        if( DerMetricTerms )
+          vector<su2double>(volElem[i].metricTerms2ndDer.begin(),
+                            volElem[i].metricTerms2ndDer.begin()+nMetric2ndDerPerPoint).swap(volElem[i].metricTerms2ndDer);
+      }
+    }
+  }
 }
 
 void CMeshFEM_DG::TimeCoefficientsPredictorADER_DG(CConfig *config) {
@@ -6413,6 +6479,11 @@ void CMeshFEM_DG::WallFunctionPreprocessing(CConfig *config) {
             if(surfElem[l].donorsWallFunction.back() >= nVolElemOwned)
               boundaries[iMarker].haloInfoNeededForBC = true;
 
+            /* Allocate the memory for the profiles of the wall model, which
+               are used as initial guess. A zero wall shear stress indicates
+               that no profile is available yet. */
+            surfElem[l].wallModelProfile.assign(nInt*boundaries[iMarker].wallModel->GetSizeProfile(), 0.0);
+
             /* Allocate the memory of the first index of the interpolation
                matrices for the donordata. */
             surfElem[l].matWallFunctionDonor.resize(surfElem[l].donorsWallFunction.size());
@@ -2082,6 +2082,15 @@ CFEMStandardElement::CFEMStandardElement(unsigned short          val_VTK_Type,
       mat2ndDerBasisIntPoint = mat2ndDerBasisIntPoint + offsetDerInt;
     }
   }
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Create the factors of the tensor product of the basis functions,   ---*/
+  /*--- if sum-factorization must be used for this element.                ---*/
+  /*--------------------------------------------------------------------------*/
+
+  nFactorsSumFact = 0;
+  sizeWorkSumFact = 0;
+  if( config->GetSumFactorization_DGFEM() ) SetUpSumFactorization();
 }
 
 void CFEMStandardElement::BasisFunctionsInPoint(const su2double   *parCoor,
@@ -2215,6 +2224,78 @@ void CFEMStandardElement::BasisFunctionsAndDerivativesInPoint(
     MatMulRowMajor(nDOFs, 1, VDr[i], matVandermondeInv, dLagBasis[i]);
 }
 
+void CFEMStandardElement::ProductBasisIntegration(const unsigned short kBeg,
+                                                  const unsigned short kEnd,
+                                                  const int            N,
+                                                  const su2double      *dataDOFs,
+                                                  su2double            *dataInt,
+                                                  su2double            *work,
+                                                  CBlasStructure       *blasFunctions,
+                                                  CConfig              *config) const {
+
+  if( nFactorsSumFact ) {
+
+    /* Sum-factorization. Carry out the product for every block separately. */
+    for(unsigned short k=kBeg; k<kEnd; ++k) {
+      const su2double *mats[] = {matFactorInt[k][0].data(), matFactorInt[k][1].data(),
+                                 matFactorInt[k][2].data()};
+      SumFactorizationKernel(mats, false, N, dataDOFs, N,
+                             dataInt + (k-kBeg)*nIntegration*N, false, work);
+    }
+  }
+  else {
+
+    /* One matrix multiplication for all the blocks. */
+    const unsigned long offset = kBeg*nIntegration*nDOFs;
+    blasFunctions->gemm(nIntegration*(kEnd-kBeg), N, nDOFs,
+                        matBasisIntegration.data()+offset, dataDOFs, dataInt, config);
+  }
+}
+
+void CFEMStandardElement::ProductBasisIntegrationTrans(const int       N,
+                                                       const su2double *dataInt,
+                                                       su2double       *dataDOFs,
+                                                       su2double       *work,
+                                                       CBlasStructure  *blasFunctions,
+                                                       CConfig         *config) const {
+
+  if( nFactorsSumFact ) {
+    const su2double *mats[] = {matFactorInt[0][0].data(), matFactorInt[0][1].data(),
+                               matFactorInt[0][2].data()};
+    SumFactorizationKernel(mats, true, N, dataInt, N, dataDOFs, false, work);
+  }
+  else
+    blasFunctions->gemm(nDOFs, N, nIntegration, lagBasisIntegrationTrans.data(),
+                        dataInt, dataDOFs, config);
+}
+
+void CFEMStandardElement::ProductDerBasisIntegrationTrans(const int       N,
+                                                          const su2double *fluxesInt,
+                                                          su2double       *dataDOFs,
+                                                          su2double       *work,
+                                                          CBlasStructure  *blasFunctions,
+                                                          CConfig         *config) const {
+
+  /* Determine the number of dimensions from the size of matDerBasisIntTrans. */
+  const unsigned short nDim = matDerBasisIntTrans.size()/(nDOFs*nIntegration);
+
+  if( nFactorsSumFact ) {
+
+    /* Sum-factorization. The fluxes of the parametric directions are stored
+       consecutively for every integration point, hence the stride of nDim*N.
+       The contributions of the directions are accumulated in dataDOFs. */
+    for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+      const su2double *mats[] = {matFactorInt[iDim+1][0].data(), matFactorInt[iDim+1][1].data(),
+                                 matFactorInt[iDim+1][2].data()};
+      SumFactorizationKernel(mats, true, N, fluxesInt + iDim*N, nDim*N,
+                             dataDOFs, iDim > 0, work);
+    }
+  }
+  else
+    blasFunctions->gemm(nDOFs, N, nIntegration*nDim, matDerBasisIntTrans.data(),
+                        fluxesInt, dataDOFs, config);
+}
+
 bool CFEMStandardElement::SameStandardElement(unsigned short val_VTK_Type,
                                               unsigned short val_nPoly,
                                               bool           val_constJac) {
@@ -2267,6 +2348,15 @@ void CFEMStandardElement::Copy(const CFEMStandardElement &other) {
   matDerBasisSolDOFs  = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs  = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt   = other.mat2ndDerBasisInt;
+
+  nFactorsSumFact = other.nFactorsSumFact;
+  sizeWorkSumFact = other.sizeWorkSumFact;
+  for(unsigned short f=0; f<3; ++f) {
+    nDOFsFactor[f] = other.nDOFsFactor[f];
+    nIntFactor[f]  = other.nIntFactor[f];
+    for(unsigned short k=0; k<4; ++k)
+      matFactorInt[k][f] = other.matFactorInt[k][f];
+  }
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2725,6 +2815,199 @@ void CFEMStandardElement::DataStandardHexahedron(void) {
   VTK_Type2 = NONE;
 }
 
+void CFEMStandardElement::SetUpSumFactorization(void) {
+
+  /*--- Determine the number of dimensions and the number of factors of
+        the tensor product. For a prism the factors are the triangle and
+        the line in t-direction. ---*/
+  unsigned short nDim;
+  switch( VTK_Type ) {
+    case QUADRILATERAL: nDim = 2; nFactorsSumFact = 2; break;
+    case HEXAHEDRON:    nDim = 3; nFactorsSumFact = 3; break;
+    case PRISM:         nDim = 3; nFactorsSumFact = 2; break;
+    default: return;
+  }
+
+  /*--- Determine the 1D basis functions and their derivatives in the
+        integration points of the factors. The DOFs and the integration
+        points are stored with the r-direction running fastest. ---*/
+  vector<su2double> matVandermondeInvDummy, rDOFsDummy, sDOFsDummy;
+
+  if(VTK_Type == PRISM) {
+
+    /* Determine the number of integration points of the triangle, i.e. the
+       number of consecutive points with the same t-coordinate. */
+    unsigned short nIntTri = 1;
+    while((nIntTri < nIntegration) && (tIntegration[nIntTri] == tIntegration[0])) ++nIntTri;
+    if( nIntegration%nIntTri ) {nFactorsSumFact = 0; return;}
+
+    nIntFactor[0] = nIntTri;
+    nIntFactor[1] = nIntegration/nIntTri;
+
+    vector<su2double> rTri(rIntegration.begin(), rIntegration.begin()+nIntTri);
+    vector<su2double> sTri(sIntegration.begin(), sIntegration.begin()+nIntTri);
+    vector<su2double> tLine(nIntFactor[1]);
+    for(unsigned short i=0; i<nIntFactor[1]; ++i)
+      tLine[i] = tIntegration[i*nIntTri];
+
+    vector<su2double> lagTri, drLagTri, dsLagTri, lagLine, drLagLine;
+    LagrangianBasisFunctionAndDerivativesTriangle(nPoly, rTri, sTri, nDOFsFactor[0],
+                                                  rDOFsDummy, sDOFsDummy,
+                                                  matVandermondeInvDummy,
+                                                  lagTri, drLagTri, dsLagTri);
+    LagrangianBasisFunctionAndDerivativesLine(nPoly, tLine, nDOFsFactor[1], rDOFsDummy,
+                                              matVandermondeInvDummy, lagLine, drLagLine);
+
+    matFactorInt[0][0] = lagTri;   matFactorInt[0][1] = lagLine;
+    matFactorInt[1][0] = drLagTri; matFactorInt[1][1] = lagLine;
+    matFactorInt[2][0] = dsLagTri; matFactorInt[2][1] = lagLine;
+    matFactorInt[3][0] = lagTri;   matFactorInt[3][1] = drLagLine;
+  }
+  else {
+
+    /* Determine the number of integration points in every direction. */
+    unsigned short nInt1D = 0;
+    unsigned long nIntTensor = 0;
+    while(nIntTensor < nIntegration) {
+      ++nInt1D;
+      nIntTensor = 1;
+      for(unsigned short f=0; f<nFactorsSumFact; ++f) nIntTensor *= nInt1D;
+    }
+    if(nIntTensor != nIntegration) {nFactorsSumFact = 0; return;}
+
+    /* Loop over the factors and determine the 1D data. */
+    const vector<su2double> *parInt[] = {&rIntegration, &sIntegration, &tIntegration};
+    unsigned long strideInt = 1;
+    for(unsigned short f=0; f<nFactorsSumFact; ++f) {
+      vector<su2double> rLine(nInt1D);
+      for(unsigned short i=0; i<nInt1D; ++i)
+        rLine[i] = (*parInt[f])[i*strideInt];
+      strideInt *= nInt1D;
+      nIntFactor[f] = nInt1D;
+
+      vector<su2double> lagLine, drLagLine;
+      LagrangianBasisFunctionAndDerivativesLine(nPoly, rLine, nDOFsFactor[f], rDOFsDummy,
+                                                matVandermondeInvDummy, lagLine, drLagLine);
+
+      matFactorInt[0][f] = lagLine;
+      for(unsigned short k=1; k<=nDim; ++k)
+        matFactorInt[k][f] = (k == f+1) ? drLagLine : lagLine;
+    }
+  }
+
+  /*--- Check that the tensor product of the factors reproduces the basis
+        functions and their derivatives in matBasisIntegration. If not, the
+        ordering of the DOFs or the integration points does not correspond to
+        a tensor product and sum-factorization is not used. ---*/
+  unsigned long nDOFsTensor = 1, nIntTensor = 1;
+  for(unsigned short f=0; f<nFactorsSumFact; ++f) {
+    nDOFsTensor *= nDOFsFactor[f];
+    nIntTensor  *= nIntFactor[f];
+  }
+
+  bool tensorProduct = (nDOFsTensor == nDOFs) && (nIntTensor == nIntegration);
+  for(unsigned short k=0; k<=nDim; ++k) {
+    if( !tensorProduct ) break;
+    for(unsigned short i=0; i<nIntegration; ++i) {
+      for(unsigned short j=0; j<nDOFs; ++j) {
+
+        su2double val = 1.0;
+        unsigned short ii = i, jj = j;
+        for(unsigned short f=0; f<nFactorsSumFact; ++f) {
+          const unsigned short iF = ii%nIntFactor[f],  jF = jj%nDOFsFactor[f];
+          ii /= nIntFactor[f]; jj /= nDOFsFactor[f];
+          val *= matFactorInt[k][f][iF*nDOFsFactor[f]+jF];
+        }
+
+        const su2double valRef = matBasisIntegration[(k*nIntegration + i)*nDOFs + j];
+        const su2double valAbs = fabs(valRef);
+        const su2double tol    = (valAbs > 1.0) ? 1.e-10*valAbs : 1.e-10;
+        if(fabs(val - valRef) > tol) tensorProduct = false;
+      }
+    }
+  }
+
+  if( !tensorProduct ) {
+    nFactorsSumFact = 0;
+    for(unsigned short k=0; k<4; ++k)
+      for(unsigned short f=0; f<3; ++f)
+        matFactorInt[k][f].clear();
+    return;
+  }
+
+  /*--- Determine the maximum size of the intermediate results, both for the
+        products from the DOFs to the integration points and vice versa. ---*/
+  for(unsigned short f=0; f<(nFactorsSumFact-1); ++f) {
+    unsigned long sizeForward = 1, sizeBackward = 1;
+    for(unsigned short g=0; g<nFactorsSumFact; ++g) {
+      sizeForward  *= (g <= f) ? nIntFactor[g]  : nDOFsFactor[g];
+      sizeBackward *= (g <= f) ? nDOFsFactor[g] : nIntFactor[g];
+    }
+    sizeWorkSumFact = max(sizeWorkSumFact, max(sizeForward, sizeBackward));
+  }
+}
+
+void CFEMStandardElement::SumFactorizationKernel(const su2double *const *mats,
+                                                 const bool             transpose,
+                                                 const int              N,
+                                                 const su2double        *dataIn,
+                                                 const int              strideIn,
+                                                 su2double              *dataOut,
+                                                 const bool             addToOut,
+                                                 su2double              *work) const {
+
+  /* Initialize the current number of points of every factor. */
+  unsigned short nCur[3];
+  for(unsigned short f=0; f<nFactorsSumFact; ++f)
+    nCur[f] = transpose ? nIntFactor[f] : nDOFsFactor[f];
+
+  /* Loop over the factors, which are contracted one at a time. The
+     intermediate results are stored alternately in the two halves of work. */
+  const su2double *src = dataIn;
+  unsigned long strideSrc = strideIn;
+  for(unsigned short f=0; f<nFactorsSumFact; ++f) {
+
+    const bool lastFactor = (f == (nFactorsSumFact-1));
+    su2double *dst = lastFactor ? dataOut : work + (f%2)*sizeWorkSumFact*N;
+    const bool addToDst = lastFactor && addToOut;
+
+    /* Determine the number of points before and after the current factor.
+       The index of a point is a + nBefore*(i + nPoints*b). */
+    unsigned long nBefore = 1, nAfter = 1;
+    for(unsigned short g=0;   g<f;               ++g) nBefore *= nCur[g];
+    for(unsigned short g=f+1; g<nFactorsSumFact; ++g) nAfter  *= nCur[g];
+
+    /* The matrix of the factor is stored as nIntFactor x nDOFsFactor in row
+       major order. Determine the strides for the output and input points. */
+    const unsigned short nSrc = nCur[f];
+    const unsigned short nDst = transpose ? nDOFsFactor[f] : nIntFactor[f];
+    const unsigned long strideMatDst = transpose ? 1 : nDOFsFactor[f];
+    const unsigned long strideMatSrc = transpose ? nDOFsFactor[f] : 1;
+
+    for(unsigned long b=0; b<nAfter; ++b) {
+      for(unsigned short o=0; o<nDst; ++o) {
+        const su2double *matRow = mats[f] + o*strideMatDst;
+        for(unsigned long a=0; a<nBefore; ++a) {
+          su2double *out = dst + (a + nBefore*(o + nDst*b))*N;
+          if( !addToDst )
+            for(int n=0; n<N; ++n) out[n] = 0.0;
+
+          for(unsigned short i=0; i<nSrc; ++i) {
+            const su2double m   = matRow[i*strideMatSrc];
+            const su2double *in = src + (a + nBefore*(i + nSrc*b))*strideSrc;
+            for(int n=0; n<N; ++n) out[n] += m*in[n];
+          }
+        }
+      }
+    }
+
+    /* Update the data for the next factor. */
+    nCur[f]   = nDst;
+    src       = dst;
+    strideSrc = N;
+  }
+}
+
 void CFEMStandardElement::SubConnTetrahedron(void) {
 
   /*--- Initialize the number of DOFs for the current edges to the number of
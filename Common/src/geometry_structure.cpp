@@ -43,6 +43,7 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <iterator>
+#include <limits>
 
 /*--- Epsilon definition ---*/
 
@@ -75,6 +76,30 @@ CGeometry::CGeometry(void) {
   nPoint     = 0;
   nPointNode = 0;
   nElem      = 0;
+  nEdgeColor = 0;
+  nElemColor = 0;
+  
+  P2P_Ready        = false;
+  nP2PSend         = 0;
+  nP2PRecv         = 0;
+  countPerPoint    = 0;
+  maxCountPerPoint = 0;
+  bufD_P2PSend     = NULL;
+  bufD_P2PRecv     = NULL;
+  req_P2PSend      = NULL;
+  req_P2PRecv      = NULL;
+  P2P_Shared       = false;
+  nExchange_P2P    = 0;
+  nP2PRecvDone     = 0;
+  bufD_P2PShared   = NULL;
+  Flag_P2PSend     = NULL;
+  
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  MG_Transfer_Ready = false;
+  Vertex_Arrays_Ready = false;
+  GridMotion_Arrays_Ready = false;
+  nVolume_Level = 1;
   
   nElem_Bound         = NULL;
   Tag_to_Marker       = NULL;
@@ -184,6 +209,26 @@ CGeometry::~CGeometry(void) {
   if (npoint_procs  != NULL) delete [] npoint_procs;
   if (nPoint_Linear != NULL) delete [] nPoint_Linear;
 
+#ifdef HAVE_MPI_SHARED_MEMORY
+  if (P2P_Shared) {
+    int finalized;
+    MPI_Finalized(&finalized);
+    if (!finalized) {
+      if (Flag_P2PSend != NULL) {
+        MPI_Win_unlock_all(win_P2PShared);
+        MPI_Win_free(&win_P2PShared);
+      }
+      MPI_Comm_free(&comm_P2PNode);
+    }
+    bufD_P2PSend = NULL;
+  }
+#endif
+
+  if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+  if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
+  if (req_P2PSend  != NULL) delete [] req_P2PSend;
+  if (req_P2PRecv  != NULL) delete [] req_P2PRecv;
+
   if(CustomBoundaryHeatFlux != NULL){
     for(iMarker=0; iMarker < nMarker; iMarker++){
       if (CustomBoundaryHeatFlux[iMarker] != NULL) delete [] CustomBoundaryHeatFlux[iMarker];
@@ -278,12 +323,1043 @@ void CGeometry::SetEdges(void) {
   
   edge = new CEdge*[nEdge];
   
+  /*--- The nodes, normals and centers of gravity of all the edges are stored
+   in contiguous arrays. The edges are numbered in the order of their first
+   (lowest) node, hence they follow the point ordering (RCM or Hilbert). ---*/
+  
+  Edge_Node.assign(2*nEdge, 0);
+  Edge_Normal.assign(nEdge*nDim, 0.0);
+  Edge_CG.assign(nEdge*nDim, 0.0);
+  
   for (iPoint = 0; iPoint < nPoint; iPoint++)
     for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
       jPoint = node[iPoint]->GetPoint(iNode);
-      iEdge = FindEdge(iPoint, jPoint);
-      if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim);
+      iEdge = node[iPoint]->GetEdge(iNode);
+      if (iPoint < jPoint) edge[iEdge] = new CEdge(iPoint, jPoint, nDim, &Edge_Node[2*iEdge],
+                                                   &Edge_Normal[iEdge*nDim], &Edge_CG[iEdge*nDim]);
+    }
+}
+
+void CGeometry::PreprocessLS_Weights(void) {
+  
+  unsigned long iPoint, jPoint, iEdge;
+  unsigned short iDim, jDim, iNeigh, iNode;
+  su2double *Coord_i, *Coord_j, *Smatrix, Delta[3], r11, r12, r13, r22, r23, r23_a,
+  r23_b, r33, weight, z11, z12, z13, z22, z23, z33, detR2;
+  
+  /*--- S matrix (inverse of the normal equations) of each point, this is the
+   same computation as in the point loop of SetSolution_Gradient_LS ---*/
+  
+  vector<su2double> S_Point(nPoint*nDim*nDim, 0.0);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    Coord_i = node[iPoint]->GetCoord();
+    Smatrix = &S_Point[iPoint*nDim*nDim];
+    
+    r11 = 0.0; r12 = 0.0;   r13 = 0.0;    r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0;  r33 = 0.0;
+    
+    for (iNeigh = 0; iNeigh < node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = node[iPoint]->GetPoint(iNeigh);
+      Coord_j = node[jPoint]->GetCoord();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      if (weight != 0.0) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+      }
+    }
+    
+    /*--- Entries of upper triangular matrix R ---*/
+    
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+    
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+    
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+    
+    /*--- S matrix := inv(R)*traspose(inv(R)), zero for singular matrices ---*/
+    
+    if (abs(detR2) > EPS) {
+      if (nDim == 2) {
+        Smatrix[0] = (r12*r12+r22*r22)/detR2;
+        Smatrix[1] = -r11*r12/detR2;
+        Smatrix[2] = Smatrix[1];
+        Smatrix[3] = r11*r11/detR2;
+      }
+      else {
+        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+        Smatrix[0] = (z11*z11+z12*z12+z13*z13)/detR2;
+        Smatrix[1] = (z12*z22+z13*z23)/detR2;
+        Smatrix[2] = (z13*z33)/detR2;
+        Smatrix[3] = Smatrix[1];
+        Smatrix[4] = (z22*z22+z23*z23)/detR2;
+        Smatrix[5] = (z23*z33)/detR2;
+        Smatrix[6] = Smatrix[2];
+        Smatrix[7] = Smatrix[5];
+        Smatrix[8] = (z33*z33)/detR2;
+      }
+    }
+    
+  }
+  
+  /*--- Weights of each edge, such that the gradient of both nodes is the
+   weighted sum of the same difference U_j-U_i (U_i-U_j = -(U_j-U_i) and
+   x_i-x_j = -(x_j-x_i), hence the signs cancel for the second node). ---*/
+  
+  LS_Weight.assign(2*nEdge*nDim, 0.0);
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = Edge_Node[2*iEdge];
+    jPoint = Edge_Node[2*iEdge+1];
+    Coord_i = node[iPoint]->GetCoord();
+    Coord_j = node[jPoint]->GetCoord();
+    
+    weight = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Delta[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      weight += Delta[iDim]*Delta[iDim];
+    }
+    if (weight == 0.0) continue;
+    
+    for (iNode = 0; iNode < 2; iNode++) {
+      Smatrix = &S_Point[Edge_Node[2*iEdge+iNode]*nDim*nDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        for (jDim = 0; jDim < nDim; jDim++)
+          LS_Weight[(2*iEdge+iNode)*nDim+iDim] += Smatrix[iDim*nDim+jDim]*Delta[jDim]/weight;
+    }
+  }
+  
+  LS_Weights_Ready = true;
+  
+}
+
+void CGeometry::PreprocessEdge_Geometry(void) {
+  
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iDim;
+  su2double *Coord_i, *Coord_j, *Normal, *Factors, Dist2, Area;
+  
+  Edge_Geometry.assign(nEdge*(nDim+2), 0.0);
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = Edge_Node[2*iEdge]; jPoint = Edge_Node[2*iEdge+1];
+    Coord_i = node[iPoint]->GetCoord(); Coord_j = node[jPoint]->GetCoord();
+    Normal = &Edge_Normal[iEdge*nDim];
+    Factors = &Edge_Geometry[iEdge*(nDim+2)];
+    
+    Dist2 = 0.0; Area = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Factors[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      Dist2 += Factors[iDim]*Factors[iDim];
+      Area += Normal[iDim]*Normal[iDim];
+    }
+    Factors[nDim] = Dist2;
+    Factors[nDim+1] = sqrt(Area);
+  }
+  
+  Edge_Geometry_Ready = true;
+  
+}
+
+void CGeometry::PreprocessMG_Transfer(CGeometry *fine_grid) {
+  
+  unsigned long iPoint, iChild;
+  unsigned short iChildren, nChildren;
+  su2double Volume;
+  
+  /*--- The structure is set up once, the weights whenever the volumes change ---*/
+  
+  if (MG_Children_Begin.size() != nPoint+1) {
+    MG_Children_Begin.assign(nPoint+1, 0);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      MG_Children_Begin[iPoint+1] = MG_Children_Begin[iPoint] + node[iPoint]->GetnChildren_CV();
+    
+    MG_Children.resize(MG_Children_Begin[nPoint]);
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      nChildren = node[iPoint]->GetnChildren_CV();
+      for (iChildren = 0; iChildren < nChildren; iChildren++)
+        MG_Children[MG_Children_Begin[iPoint]+iChildren] = node[iPoint]->GetChildren_CV(iChildren);
+    }
+  }
+  
+  MG_Children_Weight.resize(MG_Children.size());
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Volume = node[iPoint]->GetVolume();
+    for (iChild = MG_Children_Begin[iPoint]; iChild < MG_Children_Begin[iPoint+1]; iChild++)
+      MG_Children_Weight[iChild] = fine_grid->node[MG_Children[iChild]]->GetVolume()/Volume;
+  }
+  
+  MG_Transfer_Ready = true;
+  
+}
+
+void CGeometry::PreprocessVertex_Arrays(bool copy_normals) {
+  
+  unsigned short iMarker, iDim;
+  unsigned long iVertex, iPos;
+  su2double *Normal;
+  
+  Vertex_Begin.assign(nMarker+1, 0);
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    Vertex_Begin[iMarker+1] = Vertex_Begin[iMarker] + nVertex[iMarker];
+  
+  Vertex_Node.assign(Vertex_Begin[nMarker], 0);
+  Vertex_Neighbor.assign(Vertex_Begin[nMarker], 0);
+  if (copy_normals) Vertex_Normal.assign(Vertex_Begin[nMarker]*nDim, 0.0);
+  else Vertex_Normal.clear();
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      iPos = Vertex_Begin[iMarker]+iVertex;
+      Vertex_Node[iPos] = vertex[iMarker][iVertex]->GetNode();
+      Vertex_Neighbor[iPos] = vertex[iMarker][iVertex]->GetNormal_Neighbor();
+      if (copy_normals) {
+        Normal = vertex[iMarker][iVertex]->GetNormal();
+        for (iDim = 0; iDim < nDim; iDim++)
+          Vertex_Normal[iPos*nDim+iDim] = Normal[iDim];
+      }
+    }
+  }
+  
+  Vertex_Arrays_Ready = true;
+  
+}
+
+void CGeometry::SetEdgeColoring(CConfig *config) {
+
+  unsigned long iEdge, iPoint, iPos;
+  unsigned short iNode, iColor, iEnd;
+
+  nEdgeColor = 0;
+  EdgeColor_Ptr.clear();
+  EdgeColor_Edge.clear();
+
+  if (!config->GetEdge_Coloring() || (nEdge == 0)) return;
+
+  /*--- Greedy coloring of the edges in their natural (RCM based) order. An
+   edge gets the lowest color that is not used yet by any of the edges
+   connected to its two end points. The flags are stamped with the current
+   edge such that they do not need to be reset between edges. ---*/
+
+  vector<unsigned short> Color(nEdge, 0);
+  vector<unsigned long> ColorStamp;
+  vector<bool> Colored(nEdge, false);
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+
+    for (iEnd = 0; iEnd < 2; iEnd++) {
+      iPoint = edge[iEdge]->GetNode(iEnd);
+      for (iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+        const long jEdge = node[iPoint]->GetEdge(iNode);
+        if ((jEdge < 0) || !Colored[jEdge]) continue;
+        if (Color[jEdge] >= ColorStamp.size()) ColorStamp.resize(Color[jEdge]+1, nEdge);
+        ColorStamp[Color[jEdge]] = iEdge;
+      }
+    }
+
+    for (iColor = 0; iColor < ColorStamp.size(); iColor++)
+      if (ColorStamp[iColor] != iEdge) break;
+
+    Color[iEdge]   = iColor;
+    Colored[iEdge] = true;
+    nEdgeColor     = max(nEdgeColor, (unsigned short)(iColor+1));
+  }
+
+  /*--- Store the edges sorted by color in cumulative storage format. Within
+   a color the original edge order is kept to retain the memory locality. ---*/
+
+  EdgeColor_Ptr.assign(nEdgeColor+1, 0);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) EdgeColor_Ptr[Color[iEdge]+1]++;
+  for (iColor = 0; iColor < nEdgeColor; iColor++) EdgeColor_Ptr[iColor+1] += EdgeColor_Ptr[iColor];
+
+  vector<unsigned long> Fill(EdgeColor_Ptr.begin(), EdgeColor_Ptr.end()-1);
+  EdgeColor_Edge.resize(nEdge);
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPos = Fill[Color[iEdge]]++;
+    EdgeColor_Edge[iPos] = iEdge;
+  }
+
+}
+
+void CGeometry::SetRigid_DualGrid(const su2double *rotMatrix, const su2double *transl, bool val_move_coord) {
+
+  unsigned short iDim, jDim, iMarker, iNode, nNode;
+  unsigned long iPoint, iEdge, iVertex, iElem;
+  su2double *Vector, vecRot[3];
+  vector<su2double*> Coord;
+
+  /*--- The least-squares weights, edge factors and vertex arrays follow the rotated normals,
+   and all the control volumes count as updated ---*/
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  Vertex_Arrays_Ready = false;
+  DualGrid_Affected.clear();
+
+  /*--- Rotate the normals of the edges and of the boundary vertices ---*/
+
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    Vector = edge[iEdge]->GetNormal();
+    for (iDim = 0; iDim < nDim; iDim++) {
+      vecRot[iDim] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++) vecRot[iDim] += rotMatrix[3*iDim+jDim]*Vector[jDim];
+    }
+    for (iDim = 0; iDim < nDim; iDim++) Vector[iDim] = vecRot[iDim];
+  }
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      Vector = vertex[iMarker][iVertex]->GetNormal();
+      for (iDim = 0; iDim < nDim; iDim++) {
+        vecRot[iDim] = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++) vecRot[iDim] += rotMatrix[3*iDim+jDim]*Vector[jDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) Vector[iDim] = vecRot[iDim];
+    }
+
+  if (val_move_coord) {
+
+    /*--- Move the points, the coarse grids have no elements ---*/
+
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Vector = node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++) {
+        vecRot[iDim] = transl[iDim];
+        for (jDim = 0; jDim < nDim; jDim++) vecRot[iDim] += rotMatrix[3*iDim+jDim]*Vector[jDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) node[iPoint]->SetCoord(iDim, vecRot[iDim]);
+    }
+
+  } else {
+
+    /*--- Centers of gravity of the elements, boundary elements and edges from the moved points ---*/
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+      nNode = elem[iElem]->GetnNodes();
+      Coord.resize(nNode);
+      for (iNode = 0; iNode < nNode; iNode++)
+        Coord[iNode] = node[elem[iElem]->GetNode(iNode)]->GetCoord();
+      elem[iElem]->SetCoord_CG(&Coord[0]);
+    }
+
+    for (iMarker = 0; iMarker < nMarker; iMarker++)
+      for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+        nNode = bound[iMarker][iElem]->GetnNodes();
+        Coord.resize(nNode);
+        for (iNode = 0; iNode < nNode; iNode++)
+          Coord[iNode] = node[bound[iMarker][iElem]->GetNode(iNode)]->GetCoord();
+        bound[iMarker][iElem]->SetCoord_CG(&Coord[0]);
+      }
+
+    Coord.resize(2);
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      Coord[0] = node[edge[iEdge]->GetNode(0)]->GetCoord();
+      Coord[1] = node[edge[iEdge]->GetNode(1)]->GetCoord();
+      edge[iEdge]->SetCoord_CG(&Coord[0]);
+    }
+  }
+
+  /*--- Reference coordinates of the partial update of the dual grid ---*/
+
+  if (DualGrid_Coord.size() == nPoint*nDim)
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+
+}
+
+void CGeometry::PreprocessGridMotion_Arrays(CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iDim;
+  bool coord_history, grid_vel;
+
+  if (GridMotion_Arrays_Ready || (nPoint == 0)) return;
+
+  /*--- The points allocate the old coordinates and the grid velocity depending
+   on the problem, the first one tells which quantities exist. ---*/
+
+  nVolume_Level = (config->GetUnsteady_Simulation() != NO)? 3 : 1;
+  coord_history = (node[0]->GetCoord_n() != NULL);
+  grid_vel      = (node[0]->GetGridVel() != NULL);
+
+  Point_Volume.resize(nPoint*nVolume_Level);
+  Point_Coord_n.resize(coord_history? nPoint*nDim : 0);
+  Point_Coord_n1.resize(coord_history? nPoint*nDim : 0);
+  Point_GridVel.resize(grid_vel? nPoint*nDim : 0);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    Point_Volume[iPoint*nVolume_Level] = node[iPoint]->GetVolume();
+    if (nVolume_Level == 3) {
+      Point_Volume[iPoint*3+1] = node[iPoint]->GetVolume_n();
+      Point_Volume[iPoint*3+2] = node[iPoint]->GetVolume_nM1();
+    }
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if (coord_history) {
+        Point_Coord_n[iPoint*nDim+iDim]  = node[iPoint]->GetCoord_n()[iDim];
+        Point_Coord_n1[iPoint*nDim+iDim] = node[iPoint]->GetCoord_n1()[iDim];
+      }
+      if (grid_vel) Point_GridVel[iPoint*nDim+iDim] = node[iPoint]->GetGridVel()[iDim];
+    }
+    node[iPoint]->SetGridMotion_Storage(&Point_Volume[iPoint*nVolume_Level],
+                                        coord_history? &Point_Coord_n[iPoint*nDim] : NULL,
+                                        coord_history? &Point_Coord_n1[iPoint*nDim] : NULL,
+                                        grid_vel? &Point_GridVel[iPoint*nDim] : NULL);
+  }
+
+  GridMotion_Arrays_Ready = true;
+
+}
+
+void CGeometry::SetDualTime_History(CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iDim;
+  su2double *Coord;
+
+  PreprocessGridMotion_Arrays(config);
+
+  if (nVolume_Level == 3)
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Point_Volume[iPoint*3+2] = Point_Volume[iPoint*3+1];
+      Point_Volume[iPoint*3+1] = Point_Volume[iPoint*3];
+    }
+
+  /*--- Store the old coordinates in case there is grid movement ---*/
+
+  if (config->GetGrid_Movement() && !Point_Coord_n.empty()) {
+    Point_Coord_n1 = Point_Coord_n;
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      Coord = node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        Point_Coord_n[iPoint*nDim+iDim] = Coord[iDim];
+    }
+  }
+
+}
+
+void CGeometry::ComputeGridVelocity(CConfig *config) {
+
+  unsigned long iPoint, iPos;
+  unsigned short iDim;
+  su2double *Coord, TimeStep = config->GetDelta_UnstTimeND();
+
+  PreprocessGridMotion_Arrays(config);
+
+  if (Point_GridVel.empty() || Point_Coord_n.empty()) return;
+
+  /*--- Mesh velocity with 1st or 2nd-order approximation, one branch per
+   order around the loops over the flat coordinate arrays ---*/
+
+  switch (config->GetUnsteady_Simulation()) {
+
+    case DT_STEPPING_1ST:
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        Coord = node[iPoint]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++) {
+          iPos = iPoint*nDim+iDim;
+          Point_GridVel[iPos] = ( Coord[iDim] - Point_Coord_n[iPos] ) / TimeStep;
+        }
+      }
+      break;
+
+    case DT_STEPPING_2ND:
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        Coord = node[iPoint]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++) {
+          iPos = iPoint*nDim+iDim;
+          Point_GridVel[iPos] = ( 3.0*Coord[iDim] - 4.0*Point_Coord_n[iPos]
+                                 + 1.0*Point_Coord_n1[iPos] ) / (2.0*TimeStep);
+        }
+      }
+      break;
+
+    default:
+      for (iPos = 0; iPos < Point_GridVel.size(); iPos++) Point_GridVel[iPos] = 0.0;
+      break;
+  }
+
+}
+
+void CGeometry::SetElemColoring(void) {
+
+  unsigned long iElem, iPoint, iPos;
+  unsigned short iNode, jNode, iColor;
+
+  nElemColor = 0;
+  ElemColor_Ptr.clear();
+  ElemColor_Elem.clear();
+
+  if (nElem == 0) return;
+
+  /*--- Greedy coloring of the elements in their natural order. An element gets
+   the lowest color that is not used yet by any of the elements that share one
+   of its points. As for the edges, the flags are stamped with the current
+   element such that they do not need to be reset between elements. ---*/
+
+  vector<unsigned short> Color(nElem, 0);
+  vector<unsigned long> ColorStamp;
+  vector<bool> Colored(nElem, false);
+
+  for (iElem = 0; iElem < nElem; iElem++) {
+
+    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
+      iPoint = elem[iElem]->GetNode(iNode);
+      for (jNode = 0; jNode < node[iPoint]->GetnElem(); jNode++) {
+        const unsigned long jElem = node[iPoint]->GetElem(jNode);
+        if ((jElem >= nElem) || !Colored[jElem]) continue;
+        if (Color[jElem] >= ColorStamp.size()) ColorStamp.resize(Color[jElem]+1, nElem);
+        ColorStamp[Color[jElem]] = iElem;
+      }
+    }
+
+    for (iColor = 0; iColor < ColorStamp.size(); iColor++)
+      if (ColorStamp[iColor] != iElem) break;
+
+    Color[iElem]   = iColor;
+    Colored[iElem] = true;
+    nElemColor     = max(nElemColor, (unsigned short)(iColor+1));
+  }
+
+  /*--- Store the elements sorted by color in cumulative storage format. ---*/
+
+  ElemColor_Ptr.assign(nElemColor+1, 0);
+  for (iElem = 0; iElem < nElem; iElem++) ElemColor_Ptr[Color[iElem]+1]++;
+  for (iColor = 0; iColor < nElemColor; iColor++) ElemColor_Ptr[iColor+1] += ElemColor_Ptr[iColor];
+
+  vector<unsigned long> Fill(ElemColor_Ptr.begin(), ElemColor_Ptr.end()-1);
+  ElemColor_Elem.resize(nElem);
+  for (iElem = 0; iElem < nElem; iElem++) {
+    iPos = Fill[Color[iElem]]++;
+    ElemColor_Elem[iPos] = iElem;
+  }
+
+}
+
+void CGeometry::PreprocessP2PComms(CConfig *config) {
+
+  unsigned short iMarker, MarkerS, MarkerR;
+  unsigned long iVertex;
+
+  Marker_P2PSend.clear();   Marker_P2PRecv.clear();
+  Neighbor_P2PSend.clear(); Neighbor_P2PRecv.clear();
+  nVertex_P2PSend.assign(1, 0);
+  nVertex_P2PRecv.assign(1, 0);
+
+  /*--- Every pair of send/receive markers is one message. The messages are
+   kept in marker order, which is the order in which the matching messages
+   are posted on the neighboring ranks (also when there are several markers
+   for the same pair of ranks, e.g. with periodic boundaries). ---*/
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+
+      MarkerS = iMarker;  MarkerR = iMarker+1;
+
+      Marker_P2PSend.push_back(MarkerS);
+      Neighbor_P2PSend.push_back(config->GetMarker_All_SendRecv(MarkerS)-1);
+      nVertex_P2PSend.push_back(nVertex_P2PSend.back() + nVertex[MarkerS]);
+
+      Marker_P2PRecv.push_back(MarkerR);
+      Neighbor_P2PRecv.push_back(abs(config->GetMarker_All_SendRecv(MarkerR))-1);
+      nVertex_P2PRecv.push_back(nVertex_P2PRecv.back() + nVertex[MarkerR]);
+    }
+  }
+
+  nP2PSend = Marker_P2PSend.size();
+  nP2PRecv = Marker_P2PRecv.size();
+
+  /*--- Received messages whose halo points are consecutive (see the halo
+   numbering of SetRCM_Ordering) are unpacked without the vertex indirection,
+   the others are marked with nPoint. ---*/
+
+  unsigned long firstPoint;
+
+  FirstPoint_P2PRecv.assign(nP2PRecv, nPoint);
+  for (int iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    MarkerR = Marker_P2PRecv[iMessage];
+    if (nVertex[MarkerR] == 0) continue;
+    firstPoint = vertex[MarkerR][0]->GetNode();
+    for (iVertex = 1; iVertex < nVertex[MarkerR]; iVertex++)
+      if (vertex[MarkerR][iVertex]->GetNode() != firstPoint+iVertex) break;
+    if (iVertex == nVertex[MarkerR]) FirstPoint_P2PRecv[iMessage] = firstPoint;
+  }
+
+  /*--- Rotation matrices of the periodic transformations, computed once
+   instead of for every vertex of every exchange. Note that this is the
+   transpose of the matrix used during the preprocessing stage. ---*/
+
+  unsigned short iPeriodic, nPeriodic = config->GetnPeriodicIndex();
+  vector<bool> Rotated(nPeriodic, false);
+  su2double *angles, cosTheta, sinTheta, cosPhi, sinPhi, cosPsi, sinPsi, *rotMatrix;
+
+  Rotation_P2P.assign(9*nPeriodic, 0.0);
+  for (iPeriodic = 0; iPeriodic < nPeriodic; iPeriodic++) {
+    angles = config->GetPeriodicRotation(iPeriodic);
+    Rotated[iPeriodic] = (angles[0] != 0.0) || (angles[1] != 0.0) || (angles[2] != 0.0);
+
+    cosTheta = cos(angles[0]);  cosPhi = cos(angles[1]);  cosPsi = cos(angles[2]);
+    sinTheta = sin(angles[0]);  sinPhi = sin(angles[1]);  sinPsi = sin(angles[2]);
+
+    rotMatrix = &Rotation_P2P[9*iPeriodic];
+    rotMatrix[0] = cosPhi*cosPsi;  rotMatrix[3] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;  rotMatrix[6] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+    rotMatrix[1] = cosPhi*sinPsi;  rotMatrix[4] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;  rotMatrix[7] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+    rotMatrix[2] = -sinPhi;        rotMatrix[5] = sinTheta*cosPhi;                           rotMatrix[8] = cosTheta*cosPhi;
+  }
+
+  /*--- List, per received message, the vertices that need a rotation. The
+   halo vertices of plain partition boundaries carry the identity and are
+   left out, so they cost nothing in the exchanges. ---*/
+
+  nRotated_P2PRecv.assign(1, 0);
+  Vertex_P2PRecvRot.clear();
+  Index_P2PRecvRot.clear();
+
+  for (int iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    MarkerR = Marker_P2PRecv[iMessage];
+    for (iVertex = 0; iVertex < nVertex[MarkerR]; iVertex++) {
+      iPeriodic = vertex[MarkerR][iVertex]->GetRotation_Type();
+      if ((iPeriodic < nPeriodic) && Rotated[iPeriodic]) {
+        Vertex_P2PRecvRot.push_back(iVertex);
+        Index_P2PRecvRot.push_back(iPeriodic);
+      }
     }
+    nRotated_P2PRecv.push_back(Vertex_P2PRecvRot.size());
+  }
+
+  /*--- The requests are allocated once, the buffers on demand. ---*/
+
+  if (req_P2PSend != NULL) delete [] req_P2PSend;
+  if (req_P2PRecv != NULL) delete [] req_P2PRecv;
+  req_P2PSend = new SU2_MPI::Request[max(nP2PSend, 1)];
+  req_P2PRecv = new SU2_MPI::Request[max(nP2PRecv, 1)];
+
+  if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+  if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
+  bufD_P2PSend = NULL;
+  bufD_P2PRecv = NULL;
+  countPerPoint = maxCountPerPoint = 0;
+
+  /*--- The messages between ranks of the same node go through shared memory. ---*/
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+  P2P_Shared = config->GetShared_Memory_Comms();
+#endif
+  if (P2P_Shared) PreprocessP2PShared();
+
+  P2P_Ready = true;
+
+}
+
+void CGeometry::PreprocessP2PShared(void) {
+
+  Shared_P2PSend.assign(nP2PSend, false);
+  Shared_P2PRecv.assign(nP2PRecv, false);
+  Done_P2PRecv.assign(nP2PRecv, false);
+  SharedRank_P2PRecv.assign(nP2PRecv, -1);
+  SharedMessage_P2PRecv.assign(nP2PRecv, -1);
+  SharedVertex_P2PRecv.assign(nP2PRecv, 0);
+  SharedTotal_P2PRecv.assign(nP2PRecv, 0);
+  Flag_P2PRecv.assign(nP2PRecv, NULL);
+  Buffer_P2PRecv.assign(nP2PRecv, NULL);
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+
+  int iMessage, nRequest = 0;
+  MPI_Group groupWorld, groupNode;
+
+  /*--- Ranks of the neighbors in the communicator of the node, the
+   neighbors on other nodes are MPI_UNDEFINED. ---*/
+
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &comm_P2PNode);
+  MPI_Comm_group(MPI_COMM_WORLD, &groupWorld);
+  MPI_Comm_group(comm_P2PNode, &groupNode);
+
+  vector<int> nodeRankSend(max(nP2PSend, 1)), nodeRankRecv(max(nP2PRecv, 1));
+  if (nP2PSend > 0)
+    MPI_Group_translate_ranks(groupWorld, nP2PSend, &Neighbor_P2PSend[0], groupNode, &nodeRankSend[0]);
+  if (nP2PRecv > 0)
+    MPI_Group_translate_ranks(groupWorld, nP2PRecv, &Neighbor_P2PRecv[0], groupNode, &nodeRankRecv[0]);
+
+  MPI_Group_free(&groupWorld);
+  MPI_Group_free(&groupNode);
+
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++)
+    Shared_P2PSend[iMessage] = (nodeRankSend[iMessage] != MPI_UNDEFINED);
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    Shared_P2PRecv[iMessage] = (nodeRankRecv[iMessage] != MPI_UNDEFINED);
+    SharedRank_P2PRecv[iMessage] = nodeRankRecv[iMessage];
+  }
+
+  /*--- Every source tells its receivers on the node the index of the message,
+   its position and the size of the send buffer. The messages of a pair of
+   ranks are matched in marker order, as the halo messages themselves. ---*/
+
+  vector<unsigned long> infoSend(3*nP2PSend), infoRecv(3*nP2PRecv);
+  vector<MPI_Request> request(nP2PSend+nP2PRecv);
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    if (!Shared_P2PRecv[iMessage]) continue;
+    MPI_Irecv(&infoRecv[3*iMessage], 3, MPI_UNSIGNED_LONG, Neighbor_P2PRecv[iMessage], 0,
+              MPI_COMM_WORLD, &request[nRequest++]);
+  }
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++) {
+    if (!Shared_P2PSend[iMessage]) continue;
+    infoSend[3*iMessage]   = iMessage;
+    infoSend[3*iMessage+1] = nVertex_P2PSend[iMessage];
+    infoSend[3*iMessage+2] = nVertex_P2PSend.back();
+    MPI_Isend(&infoSend[3*iMessage], 3, MPI_UNSIGNED_LONG, Neighbor_P2PSend[iMessage], 0,
+              MPI_COMM_WORLD, &request[nRequest++]);
+  }
+  if (nRequest > 0) MPI_Waitall(nRequest, &request[0], MPI_STATUSES_IGNORE);
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    if (!Shared_P2PRecv[iMessage]) continue;
+    SharedMessage_P2PRecv[iMessage] = infoRecv[3*iMessage];
+    SharedVertex_P2PRecv[iMessage]  = infoRecv[3*iMessage+1];
+    SharedTotal_P2PRecv[iMessage]   = infoRecv[3*iMessage+2];
+  }
+
+#endif
+
+}
+
+void CGeometry::AllocateP2PShared(void) {
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+
+  int iMessage, dispUnit;
+  MPI_Aint size, sizeSource;
+  char *base, *baseSource;
+
+  /*--- The window of each rank holds the two halves of its send buffer,
+   followed by the flags of its messages. ---*/
+
+  const unsigned long nBuffer = 2*maxCountPerPoint*nVertex_P2PSend.back();
+
+  /*--- All the ranks of the node must be done with the old window. ---*/
+
+  if (Flag_P2PSend != NULL) {
+    MPI_Barrier(comm_P2PNode);
+    MPI_Win_unlock_all(win_P2PShared);
+    MPI_Win_free(&win_P2PShared);
+  }
+
+  size = nBuffer*sizeof(su2double) + max(nP2PSend, 1)*sizeof(long);
+  MPI_Win_allocate_shared(size, 1, MPI_INFO_NULL, comm_P2PNode, &base, &win_P2PShared);
+  MPI_Win_lock_all(MPI_MODE_NOCHECK, win_P2PShared);
+
+  bufD_P2PShared = reinterpret_cast<su2double*>(base);
+  Flag_P2PSend   = reinterpret_cast<volatile long*>(base + nBuffer*sizeof(su2double));
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++) Flag_P2PSend[iMessage] = 0;
+
+  /*--- Location of the data and flag of each on-node received message. ---*/
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+    if (!Shared_P2PRecv[iMessage]) continue;
+    MPI_Win_shared_query(win_P2PShared, SharedRank_P2PRecv[iMessage], &sizeSource, &dispUnit, &baseSource);
+    Buffer_P2PRecv[iMessage] = reinterpret_cast<su2double*>(baseSource);
+    Flag_P2PRecv[iMessage]   = reinterpret_cast<volatile long*>(baseSource + 2*maxCountPerPoint*SharedTotal_P2PRecv[iMessage]*sizeof(su2double))
+                               + SharedMessage_P2PRecv[iMessage];
+  }
+
+  /*--- The flags must be reset everywhere before they are polled. ---*/
+
+  MPI_Win_sync(win_P2PShared);
+  MPI_Barrier(comm_P2PNode);
+
+#endif
+
+}
+
+void CGeometry::RotateP2PRecv(int val_message, unsigned short val_nVector, const unsigned short *val_offset) {
+
+  unsigned short iVector, iDim, jDim;
+  unsigned long iRotated;
+  su2double *bufDRecv = &bufD_P2PRecv[countPerPoint*nVertex_P2PRecv[val_message]], *vec, vecRot[3];
+  const su2double *rotMatrix;
+
+  for (iRotated = nRotated_P2PRecv[val_message]; iRotated < nRotated_P2PRecv[val_message+1]; iRotated++) {
+
+    rotMatrix = &Rotation_P2P[9*Index_P2PRecvRot[iRotated]];
+
+    for (iVector = 0; iVector < val_nVector; iVector++) {
+      vec = &bufDRecv[countPerPoint*Vertex_P2PRecvRot[iRotated] + val_offset[iVector]];
+      for (iDim = 0; iDim < nDim; iDim++) {
+        vecRot[iDim] = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          vecRot[iDim] += rotMatrix[3*iDim+jDim]*vec[jDim];
+      }
+      for (iDim = 0; iDim < nDim; iDim++) vec[iDim] = vecRot[iDim];
+    }
+  }
+
+}
+
+void CGeometry::AllocateP2PComms(unsigned short val_countPerPoint) {
+
+  countPerPoint = val_countPerPoint;
+
+  /*--- Every exchange starts here, all ranks count them in the same way. ---*/
+
+  nExchange_P2P++;
+
+  if (countPerPoint > maxCountPerPoint) {
+
+    /*--- Grow the buffers, they are kept for all following exchanges. The
+     growth is the same on all ranks, the shared window is reallocated
+     collectively on the node. ---*/
+
+    maxCountPerPoint = countPerPoint;
+
+    if (bufD_P2PRecv != NULL) delete [] bufD_P2PRecv;
+    bufD_P2PRecv = new su2double[maxCountPerPoint*nVertex_P2PRecv.back()];
+
+    if (P2P_Shared) {
+      AllocateP2PShared();
+    } else {
+      if (bufD_P2PSend != NULL) delete [] bufD_P2PSend;
+      bufD_P2PSend = new su2double[maxCountPerPoint*nVertex_P2PSend.back()];
+    }
+  }
+
+  /*--- The halves of the shared send buffer alternate between exchanges. ---*/
+
+  if (P2P_Shared)
+    bufD_P2PSend = &bufD_P2PShared[(nExchange_P2P%2)*maxCountPerPoint*nVertex_P2PSend.back()];
+
+}
+
+void CGeometry::PostP2PRecvs(int val_tag) {
+
+  nP2PRecvDone = 0;
+
+#ifdef HAVE_MPI
+
+  int iMessage, count;
+  unsigned long offset;
+
+  for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (P2P_Shared && Shared_P2PRecv[iMessage]) {
+      req_P2PRecv[iMessage] = MPI_REQUEST_NULL;
+      Done_P2PRecv[iMessage] = false;
+      continue;
+    }
+#endif
+    offset = countPerPoint*nVertex_P2PRecv[iMessage];
+    count  = countPerPoint*(nVertex_P2PRecv[iMessage+1] - nVertex_P2PRecv[iMessage]);
+    SU2_MPI::Irecv(&(bufD_P2PRecv[offset]), count, MPI_SU2DOUBLE,
+                   Neighbor_P2PRecv[iMessage], val_tag, MPI_COMM_WORLD,
+                   &(req_P2PRecv[iMessage]));
+  }
+
+#endif
+
+}
+
+void CGeometry::PostP2PSends(int val_tag) {
+
+  int iMessage;
+  unsigned long offset;
+
+#ifdef HAVE_MPI
+
+  int count;
+
+  /*--- The on-node receivers are notified by the flags of the messages,
+   which are set once the packed data is visible to them. ---*/
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+  if (P2P_Shared) {
+    MPI_Win_sync(win_P2PShared);
+    for (iMessage = 0; iMessage < nP2PSend; iMessage++)
+      if (Shared_P2PSend[iMessage]) Flag_P2PSend[iMessage] = nExchange_P2P;
+    MPI_Win_sync(win_P2PShared);
+  }
+#endif
+
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++) {
+#ifdef HAVE_MPI_SHARED_MEMORY
+    if (P2P_Shared && Shared_P2PSend[iMessage]) {
+      req_P2PSend[iMessage] = MPI_REQUEST_NULL;
+      continue;
+    }
+#endif
+    offset = countPerPoint*nVertex_P2PSend[iMessage];
+    count  = countPerPoint*(nVertex_P2PSend[iMessage+1] - nVertex_P2PSend[iMessage]);
+    SU2_MPI::Isend(&(bufD_P2PSend[offset]), count, MPI_SU2DOUBLE,
+                   Neighbor_P2PSend[iMessage], val_tag, MPI_COMM_WORLD,
+                   &(req_P2PSend[iMessage]));
+  }
+
+#else
+
+  /*--- Without MPI, the send and receive markers of a pair are matched
+   (periodic boundaries), so the message is simply copied. ---*/
+
+  unsigned long iEntry, nEntry;
+
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++) {
+    offset = countPerPoint*nVertex_P2PSend[iMessage];
+    nEntry = countPerPoint*(nVertex_P2PRecv[iMessage+1] - nVertex_P2PRecv[iMessage]);
+    for (iEntry = 0; iEntry < nEntry; iEntry++)
+      bufD_P2PRecv[countPerPoint*nVertex_P2PRecv[iMessage]+iEntry] = bufD_P2PSend[offset+iEntry];
+  }
+
+#endif
+
+}
+
+int CGeometry::WaitP2PRecv(void) {
+
+  int ind = nP2PRecvDone;
+
+#ifdef HAVE_MPI
+
+  SU2_MPI::Status status;
+
+#ifdef HAVE_MPI_SHARED_MEMORY
+
+  /*--- Poll the flags of the on-node sources and the requests of the other
+   messages until one of them is ready. The data of a source is in the half
+   of its send buffer of this exchange, it is copied to the receive buffer
+   where it may be rotated (periodic halos). ---*/
+
+  if (P2P_Shared) {
+
+    int iMessage, flag;
+    unsigned long iEntry, nEntry;
+    const su2double *bufSource;
+
+    while (true) {
+
+      MPI_Win_sync(win_P2PShared);
+
+      for (iMessage = 0; iMessage < nP2PRecv; iMessage++) {
+        if (!Shared_P2PRecv[iMessage] || Done_P2PRecv[iMessage]) continue;
+        if (*Flag_P2PRecv[iMessage] < long(nExchange_P2P)) continue;
+
+        MPI_Win_sync(win_P2PShared);
+        bufSource = &Buffer_P2PRecv[iMessage][(nExchange_P2P%2)*maxCountPerPoint*SharedTotal_P2PRecv[iMessage] +
+                                              countPerPoint*SharedVertex_P2PRecv[iMessage]];
+        nEntry = countPerPoint*(nVertex_P2PRecv[iMessage+1] - nVertex_P2PRecv[iMessage]);
+        for (iEntry = 0; iEntry < nEntry; iEntry++)
+          bufD_P2PRecv[countPerPoint*nVertex_P2PRecv[iMessage]+iEntry] = bufSource[iEntry];
+
+        Done_P2PRecv[iMessage] = true;
+        nP2PRecvDone++;
+        return iMessage;
+      }
+
+      /*--- Without pending requests MPI_Testany returns MPI_UNDEFINED. ---*/
+
+      MPI_Testany(nP2PRecv, req_P2PRecv, &ind, &flag, &status);
+      if (flag && (ind != MPI_UNDEFINED)) break;
+    }
+
+    nP2PRecvDone++;
+    return ind;
+  }
+
+#endif
+
+  SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+
+#endif
+
+  nP2PRecvDone++;
+  return ind;
+
+}
+
+void CGeometry::CompleteP2PSends(void) {
+
+#ifdef HAVE_MPI
+
+  /*--- The requests of the on-node messages are null, they complete at once. ---*/
+
+  int iMessage, ind;
+  SU2_MPI::Status status;
+
+  for (iMessage = 0; iMessage < nP2PSend; iMessage++)
+    SU2_MPI::Waitany(nP2PSend, req_P2PSend, &ind, &status);
+
+#endif
+
+}
+
+void CGeometry::ExchangeActDisk(unsigned short val_count, su2double *val_bufSend, su2double *val_bufRecv) {
+
+  int iMessage, jMessage, nMessageSend = Neighbor_ActDiskSend.size(), nMessageRecv = Neighbor_ActDiskRecv.size();
+  unsigned long iEntry, offsetSend, offsetRecv, nEntry;
+
+#ifdef HAVE_MPI
+
+  vector<SU2_MPI::Request> commReqs;
+  commReqs.reserve(nMessageSend+nMessageRecv);
+
+  for (iMessage = 0; iMessage < nMessageRecv; iMessage++) {
+    if (Neighbor_ActDiskRecv[iMessage] == rank) continue;
+    offsetRecv = val_count*nVertex_ActDiskRecv[iMessage];
+    nEntry = val_count*(nVertex_ActDiskRecv[iMessage+1] - nVertex_ActDiskRecv[iMessage]);
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&val_bufRecv[offsetRecv], nEntry, MPI_SU2DOUBLE, Neighbor_ActDiskRecv[iMessage],
+                   Neighbor_ActDiskRecv[iMessage], MPI_COMM_WORLD, &commReqs.back());
+  }
+
+  for (iMessage = 0; iMessage < nMessageSend; iMessage++) {
+    if (Neighbor_ActDiskSend[iMessage] == rank) continue;
+    offsetSend = val_count*nVertex_ActDiskSend[iMessage];
+    nEntry = val_count*(nVertex_ActDiskSend[iMessage+1] - nVertex_ActDiskSend[iMessage]);
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&val_bufSend[offsetSend], nEntry, MPI_SU2DOUBLE, Neighbor_ActDiskSend[iMessage],
+                   rank, MPI_COMM_WORLD, &commReqs.back());
+  }
+
+#endif
+
+  /*--- The pairs matched on this rank itself are copied in place. ---*/
+
+  for (iMessage = 0; iMessage < nMessageSend; iMessage++) {
+    if (Neighbor_ActDiskSend[iMessage] != rank) continue;
+    for (jMessage = 0; jMessage < nMessageRecv; jMessage++) {
+      if (Neighbor_ActDiskRecv[jMessage] != rank) continue;
+      offsetSend = val_count*nVertex_ActDiskSend[iMessage];
+      offsetRecv = val_count*nVertex_ActDiskRecv[jMessage];
+      nEntry = val_count*(nVertex_ActDiskSend[iMessage+1] - nVertex_ActDiskSend[iMessage]);
+      for (iEntry = 0; iEntry < nEntry; iEntry++)
+        val_bufRecv[offsetRecv+iEntry] = val_bufSend[offsetSend+iEntry];
+    }
+  }
+
+#ifdef HAVE_MPI
+
+  if (!commReqs.empty())
+    SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+
+#endif
+
 }
 
 void CGeometry::SetFaces(void) {
@@ -637,7 +1713,9 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
   vector<unsigned short> Conection_Index0, Conection_Index1;
   vector<unsigned long> Duplicate;
   vector<unsigned long>::iterator it;
-  su2double **Coord_Variation = NULL;
+  vector<su2double> Coord_Variation;
+  su2double Coord_Node, Dist_Node[4] = {0.0, 0.0, 0.0, 0.0}, Dist_Max;
+  bool Side_Positive, Side_Negative;
   vector<su2double> XcoordExtra, YcoordExtra, ZcoordExtra, VariableExtra;
   vector<unsigned long> IGlobalIDExtra, JGlobalIDExtra;
   vector<bool> AddExtra;
@@ -671,9 +1749,7 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
   
   if (original_surface == false) {
     
-    Coord_Variation = new su2double *[nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      Coord_Variation[iPoint] = new su2double [nDim];
+    Coord_Variation.assign(nPoint*nDim, 0.0);
     
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if (config->GetMarker_All_GeoEval(iMarker) == YES) {
@@ -681,7 +1757,7 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
           VarCoord = vertex[iMarker][iVertex]->GetVarCoord();
           iPoint = vertex[iMarker][iVertex]->GetNode();
           for (iDim = 0; iDim < nDim; iDim++)
-            Coord_Variation[iPoint][iDim] = VarCoord[iDim];
+            Coord_Variation[iPoint*nDim+iDim] = VarCoord[iDim];
         }
       }
     }
@@ -763,6 +1839,31 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
           
         }
         
+        /*--- In 3D, the elements with all their nodes clearly on one side of
+         the (perturbed) plane of SegmentIntersectsPlane cannot be cut, skip
+         them before testing their segments. The margin keeps the nodes that
+         are on the plane up to round-off. ---*/
+        
+        if (nDim == 3) {
+          Dist_Max = 0.0;
+          for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            iPoint = bound[iMarker][iElem]->GetNode(iNode);
+            Dist_Node[iNode] = 0.0;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              Coord_Node = node[iPoint]->GetCoord(iDim);
+              if (original_surface == false) Coord_Node += Coord_Variation[iPoint*nDim+iDim];
+              Dist_Node[iNode] += (Plane_Normal[iDim]+1E-6)*((Plane_P0[iDim]+1E-6) - Coord_Node);
+            }
+            Dist_Max = max(Dist_Max, fabs(Dist_Node[iNode]));
+          }
+          Side_Positive = true; Side_Negative = true;
+          for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            if (Dist_Node[iNode] <=  1E-6*Dist_Max) Side_Positive = false;
+            if (Dist_Node[iNode] >= -1E-6*Dist_Max) Side_Negative = false;
+          }
+          if (Side_Positive || Side_Negative) continue;
+        }
+        
         for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
           iPoint = bound[iMarker][iElem]->GetNode(iNode);
           
@@ -788,8 +1889,8 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
                   Segment_P1[iDim] = node[jPoint]->GetCoord(iDim);
                 }
                 else {
-                  Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint][iDim];
-                  Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint][iDim];
+                  Segment_P0[iDim] = node[iPoint]->GetCoord(iDim) + Coord_Variation[iPoint*nDim+iDim];
+                  Segment_P1[iDim] = node[jPoint]->GetCoord(iDim) + Coord_Variation[jPoint*nDim+iDim];
                 }
               }
               
@@ -843,12 +1944,6 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
     }
   }
   
-  if (original_surface == false) {
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      delete [] Coord_Variation[iPoint];
-    delete [] Coord_Variation;
-  }
-  
 #ifdef HAVE_MPI
   
   /*--- Copy the coordinates of all the points in the plane to the master node ---*/
@@ -896,8 +1991,8 @@ void CGeometry::ComputeAirfoil_Section(su2double *Plane_P0, su2double *Plane_Nor
     Buffer_Send_GlobalID[iEdge*4 + 3] = JGlobalID_Index1[iEdge];
   }
   
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_SU2DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(Buffer_Send_Variable, nBuffer_Variable, MPI_SU2DOUBLE, Buffer_Receive_Variable, nBuffer_Variable, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   SU2_MPI::Allgather(Buffer_Send_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalID, nBuffer_GlobalID, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
   
   /*--- Clean the vectors before adding the new vertices only to the master node ---*/
@@ -1468,11 +2563,11 @@ void CGeometry::UpdateCustomBoundaryConditions(CGeometry **geometry_container, C
 
 void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   unsigned short iMarker, iNeigh_Point, iDim, iNode, iNeighbor_Nodes, Neighbor_Node;
-  unsigned long Neighbor_Point, iVertex, iPoint, jPoint, iElem_Bound, iEdge, nLocalVertex, MaxLocalVertex , *Buffer_Send_nVertex, *Buffer_Receive_nVertex, TotalnPointDomain;
+  unsigned long Neighbor_Point, iVertex, iPoint, jPoint, iElem_Bound, iEdge, TotalnPointDomain;
   int iProcessor, nProcessor;
   vector<unsigned long> Point_NeighborList, Elem_NeighborList, Point_Triangle, Point_Edge, Point_Critical;
   vector<unsigned long>::iterator it;
-  su2double U[3] = {0.0,0.0,0.0}, V[3] = {0.0,0.0,0.0}, W[3] = {0.0,0.0,0.0}, Length_U, Length_V, Length_W, CosValue, Angle_Value, *K, *Angle_Defect, *Area_Vertex, *Angle_Alpha, *Angle_Beta, **NormalMeanK, MeanK, GaussK, MaxPrinK, cot_alpha, cot_beta, delta, X1, X2, X3, Y1, Y2, Y3, radius, *Buffer_Send_Coord, *Buffer_Receive_Coord, *Coord, Dist, MinDist, MaxK, MinK, SigmaK;
+  su2double U[3] = {0.0,0.0,0.0}, V[3] = {0.0,0.0,0.0}, W[3] = {0.0,0.0,0.0}, Length_U, Length_V, Length_W, CosValue, Angle_Value, *K, *Angle_Defect, *Area_Vertex, *Angle_Alpha, *Angle_Beta, **NormalMeanK, MeanK, GaussK, MaxPrinK, cot_alpha, cot_beta, delta, X1, X2, X3, Y1, Y2, Y3, radius, MaxK, SigmaK;
   bool *Check_Edge;
 
   bool fea = ((config->GetKind_Solver()==FEM_ELASTICITY) || (config->GetKind_Solver()==DISC_ADJ_FEM));
@@ -1695,168 +2790,115 @@ void CGeometry::ComputeSurf_Curvature(CConfig *config) {
   }
   
   /*--- Sharp edge detection is based in the statistical
-   distribution of the curvature ---*/
+   distribution of the curvature. The local maximum, sum, sum of squares
+   and number of owned surface points are gathered in a single collective
+   and reduced identically on every rank. ---*/
   
-  MaxK = K[0]; MinK = K[0]; MeanK = 0.0; TotalnPointDomain = 0;
+  su2double MyStatK[4] = {0.0, 0.0, 0.0, 0.0};
   for (iMarker = 0; iMarker < nMarker; iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
         iPoint  = vertex[iMarker][iVertex]->GetNode();
-        if (node[iPoint]->GetDomain()) {
-          MaxK = max(MaxK, fabs(K[iPoint]));
-          MinK = min(MinK, fabs(K[iPoint]));
-          MeanK += fabs(K[iPoint]);
-          TotalnPointDomain++;
-        }
-      }
-    }
-  }
-  
-#ifdef HAVE_MPI
-  su2double MyMeanK = MeanK; MeanK = 0.0;
-  su2double MyMaxK = MaxK; MaxK = 0.0;
-  unsigned long MynPointDomain = TotalnPointDomain; TotalnPointDomain = 0;
-  SU2_MPI::Allreduce(&MyMeanK, &MeanK, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyMaxK, &MaxK, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MynPointDomain, &TotalnPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#endif
-  
-  /*--- Compute the mean ---*/
-  MeanK /= su2double(TotalnPointDomain);
-  
-  /*--- Compute the standard deviation ---*/
-  SigmaK = 0.0;
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint  = vertex[iMarker][iVertex]->GetNode();
-        if (node[iPoint]->GetDomain()) {
-          SigmaK += (fabs(K[iPoint]) - MeanK) * (fabs(K[iPoint]) - MeanK);
-        }
-      }
-    }
-  }
-  
-#ifdef HAVE_MPI
-  su2double MySigmaK = SigmaK; SigmaK = 0.0;
-  SU2_MPI::Allreduce(&MySigmaK, &SigmaK, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-#endif
-  
-  SigmaK = sqrt(SigmaK/su2double(TotalnPointDomain));
-  
-  if ((rank == MASTER_NODE) && (!fea))
-    cout << "Max K: " << MaxK << ". Mean K: " << MeanK << ". Standard deviation K: " << SigmaK << "." << endl;
-  
-  Point_Critical.clear();
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
-      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-        iPoint  = vertex[iMarker][iVertex]->GetNode();
-        if (node[iPoint]->GetDomain()) {
-          if (fabs(K[iPoint]) > MeanK + config->GetRefSharpEdges()*SigmaK) {
-            Point_Critical.push_back(iPoint);
-          }
+        if (node[iPoint]->GetDomain()) {
+          MyStatK[0] = max(MyStatK[0], fabs(K[iPoint]));
+          MyStatK[1] += fabs(K[iPoint]);
+          MyStatK[2] += K[iPoint]*K[iPoint];
+          MyStatK[3] += 1.0;
         }
       }
     }
   }
   
-  /*--- Variables and buffers needed for MPI ---*/
-  
 #ifdef HAVE_MPI
   SU2_MPI::Comm_size(MPI_COMM_WORLD, &nProcessor);
 #else
   nProcessor = 1;
 #endif
   
-  Buffer_Send_nVertex    = new unsigned long [1];
-  Buffer_Receive_nVertex = new unsigned long [nProcessor];
-  
-  /*--- Count the total number of critical edge nodes. ---*/
-  
-  nLocalVertex = Point_Critical.size();
-  Buffer_Send_nVertex[0] = nLocalVertex;
-  
-  /*--- Communicate to all processors the total number of critical edge nodes. ---*/
+  su2double *Buffer_Receive_StatK = new su2double [4*nProcessor];
   
 #ifdef HAVE_MPI
-  MaxLocalVertex = 0;
-  SU2_MPI::Allreduce(&nLocalVertex, &MaxLocalVertex, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(MyStatK, 4, MPI_SU2DOUBLE, Buffer_Receive_StatK, 4, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 #else
-  MaxLocalVertex = nLocalVertex;
-  Buffer_Receive_nVertex[0] = nLocalVertex;
+  for (iDim = 0; iDim < 4; iDim++) Buffer_Receive_StatK[iDim] = MyStatK[iDim];
 #endif
   
+  MaxK = 0.0; MeanK = 0.0; SigmaK = 0.0; TotalnPointDomain = 0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    MaxK    = max(MaxK, Buffer_Receive_StatK[4*iProcessor]);
+    MeanK  += Buffer_Receive_StatK[4*iProcessor+1];
+    SigmaK += Buffer_Receive_StatK[4*iProcessor+2];
+    TotalnPointDomain += (unsigned long)SU2_TYPE::GetValue(Buffer_Receive_StatK[4*iProcessor+3]);
+  }
+  delete [] Buffer_Receive_StatK;
   
-  /*--- Create and initialize to zero some buffers to hold the coordinates
-   of the boundary nodes that are communicated from each partition (all-to-all). ---*/
+  /*--- Compute the mean and the standard deviation ---*/
   
-  Buffer_Send_Coord     = new su2double [MaxLocalVertex*nDim];
-  Buffer_Receive_Coord  = new su2double [nProcessor*MaxLocalVertex*nDim];
+  MeanK /= su2double(TotalnPointDomain);
+  SigmaK = SigmaK/su2double(TotalnPointDomain) - MeanK*MeanK;
+  SigmaK = sqrt(max(SigmaK, su2double(0.0)));
   
-#ifdef HAVE_MPI
-  unsigned long nBuffer               = MaxLocalVertex*nDim;
-#endif
-
-  for (iVertex = 0; iVertex < MaxLocalVertex; iVertex++) {
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Buffer_Send_Coord[iVertex*nDim+iDim] = 0.0;
+  if ((rank == MASTER_NODE) && (!fea))
+    cout << "Max K: " << MaxK << ". Mean K: " << MeanK << ". Standard deviation K: " << SigmaK << "." << endl;
+  
+  Point_Critical.clear();
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) {
+      for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        iPoint  = vertex[iMarker][iVertex]->GetNode();
+        if (node[iPoint]->GetDomain()) {
+          if (fabs(K[iPoint]) > MeanK + config->GetRefSharpEdges()*SigmaK) {
+            Point_Critical.push_back(iPoint);
+          }
+        }
+      }
     }
   }
   
-  /*--- Retrieve and store the coordinates of the sharp edges boundary nodes on
-   the local partition and broadcast them to all partitions. ---*/
+  /*--- Build a global ADT of the critical (sharp edge) points of all
+   partitions and search it for the nearest one of every local node,
+   instead of comparing each node against the whole gathered list. ---*/
   
+  vector<su2double> Coord_Critical(nDim*Point_Critical.size());
   for (iVertex = 0; iVertex < Point_Critical.size(); iVertex++) {
     iPoint = Point_Critical[iVertex];
     for (iDim = 0; iDim < nDim; iDim++)
-      Buffer_Send_Coord[iVertex*nDim+iDim] = node[iPoint]->GetCoord(iDim);
-  }
-  
-#ifdef HAVE_MPI
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer, MPI_DOUBLE, MPI_COMM_WORLD);
-#else
-  for (iVertex = 0; iVertex < Point_Critical.size(); iVertex++) {
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Buffer_Receive_Coord[iVertex*nDim+iDim] = Buffer_Send_Coord[iVertex*nDim+iDim];
-    }
+      Coord_Critical[iVertex*nDim+iDim] = node[iPoint]->GetCoord(iDim);
   }
-#endif
   
-  /*--- Loop over all interior mesh nodes on the local partition and compute
-   the distances to each of the no-slip boundary nodes in the entire mesh.
-   Store the minimum distance to the wall for each interior mesh node. ---*/
+  CADTPointsOnlyClass CriticalADT(nDim, Point_Critical.size(), Coord_Critical.data(),
+                                  Point_Critical.data(), true);
   
-  for (iPoint = 0; iPoint < GetnPoint(); iPoint++) {
-    Coord = node[iPoint]->GetCoord();
+  if (CriticalADT.IsEmpty()) {
+    
+    /*--- No sharp edges in the entire mesh. ---*/
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      node[iPoint]->SetSharpEdge_Distance(1E20);
+    
+  }
+  else {
+    
+    vector<su2double>     Coord_Point(nDim*nPoint), Dist_Point(nPoint);
+    vector<unsigned long> PointID_Point(nPoint);
+    vector<int>           RankID_Point(nPoint);
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coord_Point[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+    
+    CriticalADT.DetermineNearestNodes(nPoint, Coord_Point.data(), Dist_Point.data(),
+                                      PointID_Point.data(), RankID_Point.data());
+    
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      node[iPoint]->SetSharpEdge_Distance(Dist_Point[iPoint]);
     
-    MinDist = 1E20;
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++) {
-        Dist = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Dist += (Coord[iDim]-Buffer_Receive_Coord[(iProcessor*MaxLocalVertex+iVertex)*nDim+iDim])*
-          (Coord[iDim]-Buffer_Receive_Coord[(iProcessor*MaxLocalVertex+iVertex)*nDim+iDim]);
-        }
-        if (Dist!=0.0) Dist = sqrt(Dist);
-        else Dist = 0.0;
-        if (Dist < MinDist) MinDist = Dist;
-      }
-    }
-    node[iPoint]->SetSharpEdge_Distance(MinDist);
   }
   
   /*--- Deallocate Max curvature ---*/
   delete[] K;
   
-  /*--- Deallocate the buffers needed for the MPI communication. ---*/
-  delete[] Buffer_Send_Coord;
-  delete[] Buffer_Receive_Coord;
-  delete[] Buffer_Send_nVertex;
-  delete[] Buffer_Receive_nVertex;
-  
 }
 
 void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
@@ -1878,14 +2920,9 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
 
   if ( kernels.empty() ) return;
 
-  /*--- FIRST: Gather the adjacency matrix, element centroids, volumes, and values on every
-  processor, this is required because the filter reaches far into adjacent partitions. ---*/
+  /*--- FIRST: Gather the element centroids, volumes, and values on every processor,
+  this is required because the filter reaches far into adjacent partitions. ---*/
   
-  /*--- Adjacency matrix ---*/
-  vector<unsigned long> neighbour_start;
-  long *neighbour_idx = NULL;
-  GetGlobalElementAdjacencyMatrix(neighbour_start,neighbour_idx);
-
   /*--- Element centroids and volumes ---*/
   su2double *cg_elem  = new su2double [Global_nElemDomain*nDim],
             *vol_elem = new su2double [Global_nElemDomain];
@@ -1909,11 +2946,11 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
     su2double *buffer = NULL, *tmp = NULL;
 
     buffer = new su2double [Global_nElemDomain*nDim];
-    SU2_MPI::Allreduce(cg_elem,buffer,Global_nElemDomain*nDim,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(cg_elem,buffer,Global_nElemDomain*nDim,MPI_SU2DOUBLE,MPI_SUM,MPI_COMM_WORLD);
     tmp = cg_elem; cg_elem = buffer; delete [] tmp;
 
     buffer = new su2double [Global_nElemDomain];
-    SU2_MPI::Allreduce(vol_elem,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(vol_elem,buffer,Global_nElemDomain,MPI_SU2DOUBLE,MPI_SUM,MPI_COMM_WORLD);
     tmp = vol_elem; vol_elem = buffer; delete [] tmp;
   }
   
@@ -1937,9 +2974,19 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
 #endif
 
 
-  /*--- SECOND: Each processor performs the average for its elements. For each
-  element we look for neighbours of neighbours of... until the distance to the
-  closest newly found one is greater than the filter radius.  ---*/
+  /*--- SECOND: Each processor performs the average for its elements. The neighbourhoods
+  (see GetRadialNeighbourhood) only depend on the radius, they are built only once and
+  then reused by all kernels with the same radius and by the next design iterations.
+  Lists for radii that are no longer in use are dropped. ---*/
+  for (unsigned long iList=0; iList<FilterNbr_Radius.size(); ) {
+    bool in_use = false;
+    for (unsigned long iKernel=0; iKernel<kernels.size(); ++iKernel)
+      in_use |= (FilterNbr_Radius[iList] == SU2_TYPE::GetValue(filter_radius[iKernel]));
+    if (in_use) { ++iList; continue; }
+    FilterNbr_Radius.erase(FilterNbr_Radius.begin()+iList);
+    FilterNbr_Start.erase(FilterNbr_Start.begin()+iList);
+    FilterNbr_Idx.erase(FilterNbr_Idx.begin()+iList);
+  }
 
   /*--- Inputs of a filter stage, like with CG and volumes, each processor needs to see everything ---*/
   su2double *work_values = new su2double [Global_nElemDomain];
@@ -1960,7 +3007,7 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
     /*--- Share with all processors ---*/
     {
       su2double *buffer = new su2double [Global_nElemDomain], *tmp = NULL;
-      SU2_MPI::Allreduce(work_values,buffer,Global_nElemDomain,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(work_values,buffer,Global_nElemDomain,MPI_SU2DOUBLE,MPI_SUM,MPI_COMM_WORLD);
       tmp = work_values; work_values = buffer; delete [] tmp;
     }
     /*--- Account for duplication ---*/
@@ -1970,17 +3017,17 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
     }
 #endif
 
-    /*--- Filter ---*/
+    /*--- Neighbourhoods of the local elements for this radius ---*/
+    unsigned long iList = GetFilterNeighbourhoods(SU2_TYPE::GetValue(kernel_radius), cg_elem);
+    const vector<unsigned long> &nbr_start = FilterNbr_Start[iList];
+    const unsigned long *nbr_idx = FilterNbr_Idx[iList].data();
+
+    /*--- Filter, i.e. a sparse matrix-vector product with the rows of the local elements ---*/
     for (iElem=0; iElem<nElem; ++iElem)
     {
       /*--- Center of the search ---*/
       iElem_global = elem[iElem]->GetGlobalIndex();
     
-      /*--- Find the neighbours of iElem ---*/
-      vector<long> neighbours;
-      GetRadialNeighbourhood(iElem_global, SU2_TYPE::GetValue(kernel_radius),
-                             neighbour_start, neighbour_idx, cg_elem, neighbours);
-    
       /*--- Apply the kernel ---*/
       su2double weight = 0.0, numerator = 0.0, denominator = 0.0;
     
@@ -1988,11 +3035,12 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
         /*--- distance-based kernels (weighted averages) ---*/
         case CONSTANT_WEIGHT_FILTER: case CONICAL_WEIGHT_FILTER: case GAUSSIAN_WEIGHT_FILTER:
             
-          for (vector<long>::iterator it=neighbours.begin(); it!=neighbours.end(); ++it)
+          for (unsigned long iNbr=nbr_start[iElem]; iNbr<nbr_start[iElem+1]; ++iNbr)
           {
+            unsigned long jElem_global = nbr_idx[iNbr];
             su2double distance = 0.0;
             for (unsigned short iDim=0; iDim<nDim; ++iDim)
-              distance += pow(cg_elem[nDim*iElem_global+iDim]-cg_elem[nDim*(*it)+iDim],2.0);
+              distance += pow(cg_elem[nDim*iElem_global+iDim]-cg_elem[nDim*jElem_global+iDim],2.0);
             distance = sqrt(distance);
       
             switch ( kernel_type ) {
@@ -2001,8 +3049,8 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
               case GAUSSIAN_WEIGHT_FILTER: weight = exp(-0.5*pow(distance/kernel_param,2.0)); break;
               default: break;
             }
-            weight *= vol_elem[*it];
-            numerator   += weight*work_values[*it];
+            weight *= vol_elem[jElem_global];
+            numerator   += weight*work_values[jElem_global];
             denominator += weight;
           }
           output_values[iElem] = numerator/denominator;
@@ -2011,11 +3059,12 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
         /*--- morphology kernels (image processing) ---*/
         case DILATE_MORPH_FILTER: case ERODE_MORPH_FILTER:
             
-          for (vector<long>::iterator it=neighbours.begin(); it!=neighbours.end(); ++it)
+          for (unsigned long iNbr=nbr_start[iElem]; iNbr<nbr_start[iElem+1]; ++iNbr)
           {
+            unsigned long jElem_global = nbr_idx[iNbr];
             switch ( kernel_type ) {
-              case DILATE_MORPH_FILTER: numerator += exp(kernel_param*work_values[*it]); break;
-              case ERODE_MORPH_FILTER:  numerator += exp(kernel_param*(1.0-work_values[*it])); break;
+              case DILATE_MORPH_FILTER: numerator += exp(kernel_param*work_values[jElem_global]); break;
+              case ERODE_MORPH_FILTER:  numerator += exp(kernel_param*(1.0-work_values[jElem_global])); break;
               default: break;
             }
             denominator += 1.0;
@@ -2030,7 +3079,6 @@ void CGeometry::FilterValuesAtElementCG(const vector<su2double> filter_radius,
     }
   }
   
-  delete [] neighbour_idx;
   delete [] cg_elem;
   delete [] vol_elem;
   delete [] work_values;
@@ -2106,69 +3154,79 @@ void CGeometry::GetGlobalElementAdjacencyMatrix(vector<unsigned long> &neighbour
 #endif
 }
 
+unsigned long CGeometry::GetFilterNeighbourhoods(const passivedouble radius,
+                                                const su2double *cg_elem) const
+{
+  /*--- Lists built before for this radius ---*/
+  for (unsigned long iList=0; iList<FilterNbr_Radius.size(); ++iList)
+    if (FilterNbr_Radius[iList] == radius) return iList;
+
+  /*--- Otherwise build them, the adjacency matrix is only needed for the search ---*/
+  vector<unsigned long> neighbour_start;
+  long *neighbour_idx = NULL;
+  GetGlobalElementAdjacencyMatrix(neighbour_start,neighbour_idx);
+
+  FilterNbr_Radius.push_back(radius);
+  FilterNbr_Start.push_back(vector<unsigned long>(nElem+1,0));
+  FilterNbr_Idx.push_back(vector<unsigned long>());
+
+  vector<unsigned long> &nbr_start = FilterNbr_Start.back();
+  vector<unsigned long> &nbr_idx = FilterNbr_Idx.back();
+
+  vector<long> visited(Global_nElemDomain,-1), neighbours;
+
+  for (unsigned long iElem=0; iElem<nElem; ++iElem)
+  {
+    GetRadialNeighbourhood(elem[iElem]->GetGlobalIndex(), radius, neighbour_start,
+                           neighbour_idx, cg_elem, visited, neighbours);
+
+    nbr_idx.insert(nbr_idx.end(), neighbours.begin(), neighbours.end());
+    nbr_start[iElem+1] = nbr_idx.size();
+  }
+  delete [] neighbour_idx;
+
+  return FilterNbr_Radius.size()-1;
+}
+
 void CGeometry::GetRadialNeighbourhood(const unsigned long iElem_global,
                                        const passivedouble radius,
                                        const vector<unsigned long> &neighbour_start,
                                        const long *neighbour_idx,
                                        const su2double *cg_elem,
+                                       vector<long> &visited,
                                        vector<long> &neighbours) const
 {
-  /*--- Center of the search ---*/
-  neighbours.clear(); neighbours.push_back(iElem_global);
+  /*--- Center of the search, elements tested for this center are marked with
+  its index, this avoids searching "neighbours" for duplicates. ---*/
+  const long center = iElem_global;
+  neighbours.clear(); neighbours.push_back(center);
+  visited[center] = center;
 
   vector<passivedouble> X0(nDim);
   for (unsigned short iDim=0; iDim<nDim; ++iDim)
     X0[iDim] = SU2_TYPE::GetValue(cg_elem[nDim*iElem_global+iDim]);
 
-  /*--- A way to locate neighbours of a given degree (1st degree are direct neighbours).
-  "degree_start"[degree] is the position in "neighbours" where "degree" starts. ---*/
-  vector<unsigned long> degree_start(1,0);
-
-  /*--- Loop stops when "neighbours" stops changing size. ---*/
-  vector<long>::iterator cursor_it = neighbours.begin(), aux_it;
-  while (cursor_it != neighbours.end())
+  /*--- Breadth-first search, we look for neighbours of neighbours of... until the
+  distance to all the newly found ones is greater than the filter radius. ---*/
+  for (unsigned long iPos=0; iPos<neighbours.size(); ++iPos)
   {
-    /*--- Add another degree. ---*/
-    long current_degree = degree_start.size();
-    degree_start.push_back(neighbours.size());
-
-    /*--- For each element of the last degree added, add its direct neighbours avoiding
-    duplicates, note the special value -1 at the start position of "candidates". ---*/
-    vector<long> candidates(1,-1);
+    /*--- Locators to access this "row" of the adjacency matrix. ---*/
+    unsigned long row_begin = neighbour_start[ neighbours[iPos]],
+                  row_end   = neighbour_start[neighbours[iPos]+1];
 
-    for (; cursor_it!=neighbours.end(); ++cursor_it)
+    for (unsigned long i=row_begin; i<row_end; ++i)
     {
-      /*--- Locators to access this "row" of the adjacency matrix. ---*/
-      unsigned long row_begin = neighbour_start[ *cursor_it],
-                    row_end   = neighbour_start[(*cursor_it)+1];
-
-      for (unsigned long i=row_begin; i<row_end; ++i)
-        if (find(candidates.begin(), candidates.end(), neighbour_idx[i]) == candidates.end())
-          candidates.push_back(neighbour_idx[i]);
-    }
+      long candidate = neighbour_idx[i];
+      if (candidate < 0 || visited[candidate] == center) continue;
+      visited[candidate] = center;
 
-    /*--- Avoid duplication of previouly added neighbours.
-    Only the last two degrees need checking. ---*/
-    vector<long> new_neighbours;
-    long degree_to_check = max<long>(0,current_degree-2);
-    vector<long>::iterator search_begin = neighbours.begin()+degree_start[degree_to_check];
-
-    for (aux_it=candidates.begin()+1; aux_it<candidates.end(); ++aux_it)
-      if (find(search_begin, neighbours.end(), *aux_it) == neighbours.end())
-        new_neighbours.push_back(*aux_it);
-
-    /*--- Add the new neighbours that are inside the radius. ---*/
-    for (aux_it=new_neighbours.begin(); aux_it!=new_neighbours.end(); ++aux_it)
-    {
       /*--- passivedouble because we are still not going to calculate anything ---*/
       passivedouble distance = 0.0;
       for (unsigned short iDim=0; iDim<nDim; ++iDim)
-        distance += pow(X0[iDim]-SU2_TYPE::GetValue(cg_elem[nDim*(*aux_it)+iDim]),2.0);
+        distance += pow(X0[iDim]-SU2_TYPE::GetValue(cg_elem[nDim*candidate+iDim]),2.0);
 
-      if(sqrt(distance) < radius) neighbours.push_back(*aux_it);
+      if(sqrt(distance) < radius) neighbours.push_back(candidate);
     }
-    /*--- need new iterator (to same position where it was) after change of capacity ---*/
-    cursor_it = neighbours.begin()+degree_start[current_degree];
   }
 }
 
@@ -2212,6 +3270,7 @@ CPhysicalGeometry::CPhysicalGeometry() : CGeometry() {
   rank = SU2_MPI::GetRank();  
 
   Local_to_Global_Point  = NULL;
+  WallADT = NULL;
   Local_to_Global_Marker = NULL;
   Global_to_Local_Marker = NULL;
 
@@ -2253,6 +3312,7 @@ CPhysicalGeometry::CPhysicalGeometry(CConfig *config, unsigned short val_iZone,
   rank = SU2_MPI::GetRank();  
   
   Local_to_Global_Point = NULL;
+  WallADT = NULL;
   Local_to_Global_Marker = NULL;
   Global_to_Local_Marker = NULL;
   
@@ -2429,6 +3489,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
   /*--- Initialize several class data members for later. ---*/
   
   Local_to_Global_Point  = NULL;
+  WallADT = NULL;
   Local_to_Global_Marker = NULL;
   Global_to_Local_Marker = NULL;
   
@@ -3293,7 +4354,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
        date to iDomain with non-blocking sends. ---*/
       
       SU2_MPI::Isend(&Buffer_Send_Coord[PointTotal_Counter*nDim_s[iDomain]],
-                     nPointTotal_s[iDomain]*nDim_s[iDomain], MPI_DOUBLE, iDomain,
+                     nPointTotal_s[iDomain]*nDim_s[iDomain], MPI_SU2DOUBLE, iDomain,
                      iDomain*16+0,  MPI_COMM_WORLD, &send_req[0]);
       
       SU2_MPI::Isend(&Buffer_Send_GlobalPointIndex[PointTotal_Counter],
@@ -3499,8 +4560,8 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
 
       SU2_MPI::Probe(iDomain, rank*16+0, MPI_COMM_WORLD, &status2);
       source = status2.MPI_SOURCE;
-      SU2_MPI::Get_count(&status2, MPI_DOUBLE, &recv_count);
-      SU2_MPI::Recv(Buffer_Receive_Coord, recv_count , MPI_DOUBLE,
+      SU2_MPI::Get_count(&status2, MPI_SU2DOUBLE, &recv_count);
+      SU2_MPI::Recv(Buffer_Receive_Coord, recv_count , MPI_SU2DOUBLE,
                     source, rank*16+0, MPI_COMM_WORLD, &status2);
 
       SU2_MPI::Probe(iDomain, rank*16+1, MPI_COMM_WORLD, &status2);
@@ -4558,15 +5619,15 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
                        10, MPI_COMM_WORLD, &send_req[10]);
         
         SU2_MPI::Isend(Buffer_Send_Center,
-                       nPeriodic*3, MPI_DOUBLE, iDomain,
+                       nPeriodic*3, MPI_SU2DOUBLE, iDomain,
                        11, MPI_COMM_WORLD, &send_req[11]);
         
         SU2_MPI::Isend(Buffer_Send_Rotation,
-                       nPeriodic*3, MPI_DOUBLE, iDomain,
+                       nPeriodic*3, MPI_SU2DOUBLE, iDomain,
                        12, MPI_COMM_WORLD, &send_req[12]);
         
         SU2_MPI::Isend(Buffer_Send_Translate,
-                       nPeriodic*3, MPI_DOUBLE, iDomain,
+                       nPeriodic*3, MPI_SU2DOUBLE, iDomain,
                        13, MPI_COMM_WORLD, &send_req[13]);
         
         SU2_MPI::Isend(&Buffer_Send_nTotalSendDomain_Periodic,
@@ -4725,18 +5786,18 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
 
         SU2_MPI::Probe(MASTER_NODE, 11, MPI_COMM_WORLD, &status);
-        SU2_MPI::Get_count(&status, MPI_DOUBLE, &recv_count);
-        SU2_MPI::Recv(Buffer_Receive_Center, recv_count, MPI_DOUBLE,
+        SU2_MPI::Get_count(&status, MPI_SU2DOUBLE, &recv_count);
+        SU2_MPI::Recv(Buffer_Receive_Center, recv_count, MPI_SU2DOUBLE,
                       MASTER_NODE, 11, MPI_COMM_WORLD, &status);
 
         SU2_MPI::Probe(MASTER_NODE, 12, MPI_COMM_WORLD, &status);
-        SU2_MPI::Get_count(&status, MPI_DOUBLE, &recv_count);
-        SU2_MPI::Recv(Buffer_Receive_Rotation, recv_count, MPI_DOUBLE,
+        SU2_MPI::Get_count(&status, MPI_SU2DOUBLE, &recv_count);
+        SU2_MPI::Recv(Buffer_Receive_Rotation, recv_count, MPI_SU2DOUBLE,
                       MASTER_NODE, 12, MPI_COMM_WORLD, &status);
 
         SU2_MPI::Probe(MASTER_NODE, 13, MPI_COMM_WORLD, &status);
-        SU2_MPI::Get_count(&status, MPI_DOUBLE, &recv_count);
-        SU2_MPI::Recv(Buffer_Receive_Translate, recv_count, MPI_DOUBLE,
+        SU2_MPI::Get_count(&status, MPI_SU2DOUBLE, &recv_count);
+        SU2_MPI::Recv(Buffer_Receive_Translate, recv_count, MPI_SU2DOUBLE,
                       MASTER_NODE, 13, MPI_COMM_WORLD, &status);
 
         SU2_MPI::Probe(MASTER_NODE, 14, MPI_COMM_WORLD, &status);
@@ -5393,6 +6454,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
   /*--- Initialize several class data members for later. ---*/
 
   Local_to_Global_Point  = NULL;
+  WallADT = NULL;
   Local_to_Global_Marker = NULL;
   Global_to_Local_Marker = NULL;
 
@@ -5622,6 +6684,7 @@ CPhysicalGeometry::CPhysicalGeometry(CGeometry *geometry,
 CPhysicalGeometry::~CPhysicalGeometry(void) {
   
   if (Local_to_Global_Point  != NULL) delete [] Local_to_Global_Point;
+  if (WallADT != NULL) delete WallADT;
   if (Global_to_Local_Marker != NULL) delete [] Global_to_Local_Marker;
   if (Local_to_Global_Marker != NULL) delete [] Local_to_Global_Marker;
   
@@ -8275,7 +9338,7 @@ void CPhysicalGeometry::InitiateComms(void *bufSend,
       switch (commType) {
         case COMM_TYPE_DOUBLE:
           SU2_MPI::Irecv(&(static_cast<su2double*>(bufRecv)[offset]),
-                         count, MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
+                         count, MPI_SU2DOUBLE, source, tag, MPI_COMM_WORLD,
                          &(recvReq[iMessage]));
           break;
         case COMM_TYPE_UNSIGNED_LONG:
@@ -8350,7 +9413,7 @@ void CPhysicalGeometry::InitiateComms(void *bufSend,
       switch (commType) {
         case COMM_TYPE_DOUBLE:
           SU2_MPI::Isend(&(static_cast<su2double*>(bufSend)[offset]),
-                         count, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
+                         count, MPI_SU2DOUBLE, dest, tag, MPI_COMM_WORLD,
                          &(sendReq[iMessage]));
           break;
         case COMM_TYPE_UNSIGNED_LONG:
@@ -8892,6 +9955,137 @@ void CPhysicalGeometry::SetBoundaries(CConfig *config) {
   delete [] nElem_Bound_Copy;
 }
 
+void CPhysicalGeometry::Read_SU2_Mesh_Index(CConfig *config, string val_mesh_filename, vector<unsigned long> &Mesh_Index) {
+
+  /*--- The index holds the byte offsets of the NPOIN, NELEM and NMARK lines,
+   the stride of the point index and the offsets of every stride-th point line.
+   It is stored in val_mesh_filename.idx after a header with the size and the
+   modification time of the mesh file, which identify outdated indices. ---*/
+
+  const unsigned long Index_Stride = 1024;
+  unsigned long Index_Header[4], Mesh_Header[4] = {535532, 0, 0, 0}, nIndex = 0;
+  unsigned long Line_Offset, Next_Offset, iLine, nLine;
+  string text_line, index_filename = val_mesh_filename + ".idx";
+  string::size_type position;
+  struct stat mesh_stat;
+  ifstream mesh_file;
+  FILE *index_file;
+  bool valid = false, section_found = false, found_point = false, found_elem = false, found_marker = false;
+
+  Mesh_Index.clear();
+
+  if (rank == MASTER_NODE) {
+
+    if (stat(val_mesh_filename.c_str(), &mesh_stat) == 0) {
+      Mesh_Header[1] = (unsigned long)mesh_stat.st_size;
+      Mesh_Header[2] = (unsigned long)mesh_stat.st_mtime;
+    }
+
+    /*--- Read an existing index of the same mesh file. ---*/
+
+    index_file = fopen(index_filename.c_str(), "rb");
+    if (index_file != NULL) {
+      if ((fread(Index_Header, sizeof(unsigned long), 4, index_file) == 4) &&
+          (Index_Header[0] == Mesh_Header[0]) && (Index_Header[1] == Mesh_Header[1]) &&
+          (Index_Header[2] == Mesh_Header[2]) && (Index_Header[3] > 4)) {
+        Mesh_Index.resize(Index_Header[3]);
+        valid = (fread(&Mesh_Index[0], sizeof(unsigned long), Index_Header[3], index_file) == Index_Header[3]);
+      }
+      fclose(index_file);
+    }
+
+    /*--- Otherwise, scan the mesh file once to build the index. The index
+     is not used for files with several zones or with header keywords
+     after the first section, the sections are then searched as usual. ---*/
+
+    if (!valid) {
+
+      cout << "Building the offsets index of the mesh file." << endl;
+
+      Mesh_Index.assign(4, 0);
+      Mesh_Index[3] = Index_Stride;
+      mesh_file.open(val_mesh_filename.c_str(), ios::in);
+      valid = !mesh_file.fail();
+      Next_Offset = 0;
+
+      while (valid && getline(mesh_file, text_line)) {
+        Line_Offset = Next_Offset; Next_Offset += text_line.size()+1;
+
+        if ((text_line.find("NZONE=",0) != string::npos) || (text_line.find("IZONE=",0) != string::npos))
+          valid = false;
+
+        if (section_found && ((text_line.find("NDIME=",0) != string::npos) ||
+                              (text_line.find("AOA_OFFSET=",0) != string::npos) ||
+                              (text_line.find("AOS_OFFSET=",0) != string::npos)))
+          valid = false;
+
+        position = text_line.find("NPOIN=",0);
+        if (position != string::npos) {
+          section_found = true; found_point = true; Mesh_Index[0] = Line_Offset;
+          text_line.erase(0,6); nLine = atol(text_line.c_str());
+          for (iLine = 0; iLine < nLine; iLine++) {
+            if (iLine%Index_Stride == 0) Mesh_Index.push_back(Next_Offset);
+            if (!getline(mesh_file, text_line)) { valid = false; break; }
+            Next_Offset += text_line.size()+1;
+          }
+          continue;
+        }
+
+        position = text_line.find("NELEM=",0);
+        if (position != string::npos) {
+          section_found = true; found_elem = true; Mesh_Index[1] = Line_Offset;
+          text_line.erase(0,6); nLine = atol(text_line.c_str());
+          for (iLine = 0; iLine < nLine; iLine++) {
+            if (!getline(mesh_file, text_line)) { valid = false; break; }
+            Next_Offset += text_line.size()+1;
+          }
+          continue;
+        }
+
+        position = text_line.find("NMARK=",0);
+        if (position != string::npos) {
+          found_marker = true; Mesh_Index[2] = Line_Offset;
+          break;
+        }
+      }
+      mesh_file.close();
+
+      /*--- All three sections must have been found. ---*/
+
+      valid = valid && found_point && found_elem && found_marker && (Mesh_Index.size() > 4);
+
+      /*--- Store the index for the next runs, if the directory is writable. ---*/
+
+      if (valid) {
+        Mesh_Header[3] = Mesh_Index.size();
+        index_file = fopen(index_filename.c_str(), "wb");
+        if (index_file != NULL) {
+          fwrite(Mesh_Header, sizeof(unsigned long), 4, index_file);
+          fwrite(&Mesh_Index[0], sizeof(unsigned long), Mesh_Index.size(), index_file);
+          fclose(index_file);
+        }
+      }
+    }
+
+    if (!valid) {
+      cout << "The offsets index cannot be used for this mesh file." << endl;
+      Mesh_Index.clear();
+    }
+
+    nIndex = Mesh_Index.size();
+  }
+
+  /*--- Communicate the index to all ranks. ---*/
+
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(&nIndex, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+  Mesh_Index.resize(nIndex);
+  if (nIndex > 0)
+    SU2_MPI::Bcast(&Mesh_Index[0], nIndex, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+
+}
+
 void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mesh_filename, unsigned short val_iZone, unsigned short val_nZone) {
   
   string text_line, Marker_Tag;
@@ -8911,6 +10105,9 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   string::size_type position;
   bool domain_flag = false;
   bool found_transform = false;
+  bool mesh_index = false;
+  vector<unsigned long> Mesh_Index;
+  unsigned long Line_Offset = 0, Next_Offset = 0, Header_End = 0;
   bool harmonic_balance = config->GetUnsteady_Simulation() == HARMONIC_BALANCE;
   bool multizone_file = config->GetMultizone_Mesh();
   bool actuator_disk  = (((config->GetnMarker_ActDiskInlet() != 0) ||
@@ -9400,9 +10597,9 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     //    SU2_MPI::Bcast(&ActDiskNewPoints, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
     //    SU2_MPI::Bcast(&nPoint, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
     //    SU2_MPI::Bcast(&nPointVolume, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(&Xloc, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(&Yloc, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(&Zloc, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(&Xloc, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(&Yloc, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(&Zloc, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     
     //    if (rank != MASTER_NODE) {
     //      MapActDisk 				= new unsigned long [nPoint];
@@ -9419,12 +10616,12 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     //    SU2_MPI::Bcast(MapActDisk, nPoint, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
     //    SU2_MPI::Bcast(ActDisk_Bool, nPoint, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
     //    SU2_MPI::Bcast(VolumePoint_Inv, nPoint, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordXVolumePoint, nPointVolume, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordYVolumePoint, nPointVolume, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordZVolumePoint, nPointVolume, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordXActDisk, ActDiskNewPoints, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordYActDisk, ActDiskNewPoints, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    //    SU2_MPI::Bcast(CoordZActDisk, ActDiskNewPoints, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordXVolumePoint, nPointVolume, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordYVolumePoint, nPointVolume, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordZVolumePoint, nPointVolume, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordXActDisk, ActDiskNewPoints, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordYActDisk, ActDiskNewPoints, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    //    SU2_MPI::Bcast(CoordZActDisk, ActDiskNewPoints, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     
   }
   
@@ -9437,6 +10634,15 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   nelem_prism    = 0; Global_nelem_prism    = 0;
   nelem_pyramid  = 0; Global_nelem_pyramid  = 0;
   
+  /*--- Locate the sections of the mesh with the offsets index. Each rank then
+   reads only its slice of the points and skips the sections it does not need. ---*/
+
+  if (config->GetMesh_Offsets_Index() && !actuator_disk && !(val_nZone > 1 && multizone_file)) {
+    Read_SU2_Mesh_Index(config, val_mesh_filename, Mesh_Index);
+    mesh_index = !Mesh_Index.empty();
+    if (mesh_index) Header_End = min(Mesh_Index[0], min(Mesh_Index[1], Mesh_Index[2]));
+  }
+
   /*--- Allocate memory for the linear partition of the mesh. These
    arrays are the size of the number of ranks. ---*/
   
@@ -9481,6 +10687,16 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
   
   while (getline (mesh_file, text_line)) {
     
+    /*--- With the offsets index, jump to the points after the header. ---*/
+    
+    if (mesh_index) {
+      Line_Offset = Next_Offset; Next_Offset += text_line.size()+1;
+      if ((Line_Offset == Header_End) && (Header_End != Mesh_Index[0])) {
+        mesh_file.seekg(Mesh_Index[0]); Next_Offset = Mesh_Index[0];
+        continue;
+      }
+    }
+    
     /*--- Read the dimension of the problem ---*/
     
     position = text_line.find ("NDIME=",0);
@@ -9638,7 +10854,19 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
       nPointNode = nPoint; 
       node = new CPoint*[nPoint];
       iPoint = 0; node_count = 0;
-      while (node_count < Global_nPoint) {
+      
+      /*--- With the offsets index, only the slice of this rank is read, starting
+       from the indexed line before it. ---*/
+      
+      if (mesh_index) {
+        node_count = (starting_node[rank]/Mesh_Index[3])*Mesh_Index[3];
+        if (node_count < Global_nPoint)
+          mesh_file.seekg(Mesh_Index[4+starting_node[rank]/Mesh_Index[3]]);
+        for (; node_count < starting_node[rank]; node_count++)
+          mesh_file.ignore(numeric_limits<streamsize>::max(), '\n');
+      }
+      
+      while (node_count < (mesh_index ? ending_node[rank] : Global_nPoint)) {
         
         if (!actuator_disk) { getline(mesh_file, text_line); }
         else {
@@ -9688,6 +10916,10 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
         }
         node_count++;
       }
+      
+      /*--- The other sections are located with the index. ---*/
+      
+      if (mesh_index) break;
     }
   }
   
@@ -9728,6 +10960,8 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     }
   }
   
+  if (mesh_index) mesh_file.seekg(Mesh_Index[1]);
+  
   while (getline (mesh_file, text_line)) {
     
     /*--- Read the information about inner elements ---*/
@@ -10273,6 +11507,8 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     }
   }
   
+  if (mesh_index) mesh_file.seekg(Mesh_Index[1]);
+  
   while (getline (mesh_file, text_line)) {
     
     /*--- Read the information about inner elements ---*/
@@ -10615,6 +11851,8 @@ void CPhysicalGeometry::Read_SU2_Format_Parallel(CConfig *config, string val_mes
     }
   }
     
+    if (mesh_index) mesh_file.seekg(Mesh_Index[2]);
+    
     while (getline (mesh_file, text_line)) {
       
       /*--- Read number of markers ---*/
@@ -11021,9 +12259,17 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   
   /*--- Open the CGNS file for reading. The value of fn returned
    is the specific index number for this file and will be
-   repeatedly used in the function calls. ---*/
-  
+   repeatedly used in the function calls. When SU2 is linked against a
+   CGNS library built with parallel HDF5, the file is opened collectively
+   and the bulk coordinate and connectivity data are read with the cgp_*
+   routines, otherwise every rank opens the file independently. ---*/
+  
+#if defined(HAVE_CGNS_PARALLEL) && defined(HAVE_MPI)
+  if (cgp_mpi_comm(MPI_COMM_WORLD) != CG_OK) cgp_error_exit();
+  if (cgp_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn) != CG_OK) cgp_error_exit();
+#else
   if (cg_open(val_mesh_filename.c_str(), CG_MODE_READ, &fn)) cg_error_exit();
+#endif
   if (rank == MASTER_NODE) {
     cout << "Reading the CGNS file: ";
     cout << val_mesh_filename.c_str() << "." << endl;
@@ -11217,6 +12463,17 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         if (datatype != RealDouble) {
           SU2_MPI::Error("CGNS coordinates are not double precision.", CURRENT_FUNCTION);
         }
+        
+        /*--- Only this rank's window [range_min, range_max] of the
+         coordinates is read. The collective parallel read requires
+         that every rank owns at least one point. ---*/
+        
+#if defined(HAVE_CGNS_PARALLEL) && defined(HAVE_MPI)
+        if (vertices[j-1] >= size) {
+          if ( cgp_coord_read_data(fn, i, j, k, &range_min, &range_max,
+                                   coordArray[j-1]) != CG_OK ) cgp_error_exit();
+        } else
+#endif
         if ( cg_coord_read(fn, i, j, coordname, datatype, &range_min,
                            &range_max, coordArray[j-1]) ) cg_error_exit();
         
@@ -11323,25 +12580,48 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         isMixed = new bool[nElems[j-1][s-1]];
         for ( int ii = 0; ii < nElems[j-1][s-1]; ii++ ) isMixed[ii] = false;
 
-        /*--- Protect against the situation where there are fewer elements
-        in a section than number of ranks, or the linear partitioning will
-        fail. For now, assume that these must be surfaces, and we will 
-        avoid a parallel read and have the master read this section (the
-        master processes all of the markers anyway). ---*/
-
-        if (nElems[j-1][s-1] < rank+1) {
-
-          isInternal[j-1][s-1] = false;
-
-        } else {        
-
+        /*--- Decide whether this section holds internal or boundary
+         elements before reading its connectivity, so that all ranks take
+         the same path below and boundary sections are only read once, by
+         the master. We assume that internal cells and boundary cells do
+         not exist in the same section together, hence the type of a mixed
+         section is given by its first element. ---*/
+        
+        ElementType_t sectionType = elemType;
+        if ((elemType == MIXED) && (element_count > 0)) {
+          cgsize_t firstElem[10];
+          if (cg_elements_partial_read(fn, i, j, s, startE, startE, firstElem,
+                                       parentData) != CG_OK) cg_error_exit();
+          sectionType = ElementType_t(firstElem[0]);
+        }
+        
+        if (cell_dim == 2)
+          isInternal[j-1][s-1] = (sectionType != BAR_2) && (sectionType != BAR_3);
+        else
+          isInternal[j-1][s-1] = (sectionType != TRI_3) && (sectionType != QUAD_4);
+        
+        if (isInternal[j-1][s-1]) {
+        
         /*--- Retrieve the connectivity information and store. Note that
          we are only accessing our rank's piece of the data here in the
-         partial read function in the CGNS API. ---*/
-
-        if (cg_elements_partial_read(fn, i, j, s, (cgsize_t)elemB[rank],
-                                    (cgsize_t)elemE[rank], connElemCGNS,
-                                    parentData) != CG_OK) cg_error_exit();
+         partial read function in the CGNS API, mixed sections included,
+         since the linear partitioning is by element count. Ranks without
+         elements (sections smaller than the number of ranks) skip the
+         read, and the collective parallel read is only used when every
+         rank owns a piece of a section with a fixed element type. ---*/
+        
+#if defined(HAVE_CGNS_PARALLEL) && defined(HAVE_MPI)
+        if ((elemType != MIXED) && (element_count >= (unsigned long)size)) {
+          if (cgp_elements_read_data(fn, i, j, s, (cgsize_t)elemB[rank],
+                                     (cgsize_t)elemE[rank],
+                                     connElemCGNS) != CG_OK) cgp_error_exit();
+        } else
+#endif
+        if (nElems[j-1][s-1] > 0) {
+          if (cg_elements_partial_read(fn, i, j, s, (cgsize_t)elemB[rank],
+                                       (cgsize_t)elemE[rank], connElemCGNS,
+                                       parentData) != CG_OK) cg_error_exit();
+        }
         
         /*--- Find the number of nodes required to represent
          this type of element. ---*/
@@ -11350,7 +12630,7 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         if (cg_npe(elemType, &npe)) cg_error_exit();
         
         /*--- Loop through all of the elements in this section to get more
-         information and to decide whether it has internal elements. ---*/
+         information and to count the internal elements. ---*/
         
         int counter = 0;
         for ( int ii = 0; ii < nElems[j-1][s-1]; ii++ ) {
@@ -11436,39 +12716,22 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
               break;
           }
           
-          /*--- Check if the elements in this section are part
-           of the internal domain or are part of the boundary
-           surfaces. This will be used to separate the
-           internal connectivity from the boundary connectivity.
-           We will check for quad and tri elements for 3-D meshes
-           because these will be the boundaries. Similarly, line
-           elements will be boundaries to 2-D problems. ---*/
+          /*--- Count the elements that are part of the internal
+           domain. We will check for quad and tri elements for 3-D
+           meshes because these will be the boundaries. Similarly,
+           line elements will be boundaries to 2-D problems. ---*/
           
           if ( cell_dim == 2 ) {
             
             /*--- In 2-D check for line elements, VTK type 3. ---*/
             
-            if (elemTypes[ii] == 3) {
-              isInternal[j-1][s-1] = false;
-            } else {
-              isInternal[j-1][s-1] = true;
-              interiorElems++;
-            }
+            if (elemTypes[ii] != 3) interiorElems++;
             
           } else if (cell_dim == 3) {
             
             /*--- In 3-D check for tri/quad elements, VTK types 5 or 9. ---*/
             
-            switch (elemTypes[ii]) {
-              case 5:
-              case 9:
-                isInternal[j-1][s-1] = false;
-                break;
-              default:
-                isInternal[j-1][s-1] = true;
-                interiorElems++;
-                break;
-            }
+            if ((elemTypes[ii] != 5) && (elemTypes[ii] != 9)) interiorElems++;
             
           }
         }
@@ -11492,8 +12755,8 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
         if (!isInternal[j-1][s-1]) {
           
           /*--- Master node should read this entire marker section. Free
-           the memory for the conn. from the CGNS file since we are going
-           to read the section again with the master. ---*/
+           the memory for the partial conn., which is not needed since
+           the master reads the whole section below. ---*/
           
           delete [] connElemCGNS;
           delete [] nPoinPerElem;
@@ -11913,7 +13176,11 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel(CConfig *config, string val_me
   
   /*--- Close the CGNS file. ---*/
   
+#if defined(HAVE_CGNS_PARALLEL) && defined(HAVE_MPI)
+  if ( cgp_close(fn) != CG_OK ) cgp_error_exit();
+#else
   if ( cg_close(fn) ) cg_error_exit();
+#endif
   if (rank == MASTER_NODE)
     cout << "Successfully closed the CGNS file." << endl;
   
@@ -12924,6 +14191,53 @@ void CPhysicalGeometry::Check_BoundElem_Orientation(CConfig *config) {
 
 void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
 
+  const bool update_wall_distance = config->GetUpdate_Wall_Distance();
+
+  /*--------------------------------------------------------------------------*/
+  /*--- Step 0: If the ADT of the walls has been kept from a previous call, ---*/
+  /*---         refit it to the new coordinates of the walls and start the  ---*/
+  /*---         search of each point from its previous nearest element and  ---*/
+  /*---         the ones of its neighbors. For small motions of the walls   ---*/
+  /*---         these candidates prune most of the tree traversal.          ---*/
+  /*--------------------------------------------------------------------------*/
+
+  if (update_wall_distance && (WallADT != NULL) && (WallADT_Donor.size() == nPoint)) {
+
+    vector<su2double> surfaceCoor;
+    surfaceCoor.reserve(nDim*WallADT_Points.size());
+    for(unsigned long i=0; i<WallADT_Points.size(); ++i)
+      for(unsigned short k=0; k<nDim; ++k)
+        surfaceCoor.push_back(node[WallADT_Points[i]]->GetCoord(k));
+
+    WallADT->RefitElements(surfaceCoor);
+
+    if ( WallADT->IsEmpty() ) {
+      for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+        node[iPoint]->SetWall_Distance(0.0);
+    }
+    else {
+      vector<unsigned long> Guess;
+      for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
+        unsigned short markerID;
+        unsigned long  elemID;
+        int            rankID;
+        su2double      dist;
+
+        Guess.clear();
+        Guess.push_back(WallADT_Donor[iPoint]);
+        for (unsigned short iNode = 0; iNode < node[iPoint]->GetnPoint(); iNode++) {
+          const unsigned long jDonor = WallADT_Donor[node[iPoint]->GetPoint(iNode)];
+          if (jDonor != Guess[0]) Guess.push_back(jDonor);
+        }
+
+        WallADT->DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID, elemID, rankID,
+                                         WallADT_Donor[iPoint], Guess.size(), Guess.data());
+        node[iPoint]->SetWall_Distance(dist);
+      }
+    }
+    return;
+  }
+
   /*--------------------------------------------------------------------------*/
   /*--- Step 1: Create the coordinates and connectivity of the linear      ---*/
   /*---         subelements of the local boundaries that must be taken     ---*/
@@ -12986,9 +14300,11 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   vector<su2double> surfaceCoor;
   unsigned long nVertex_SolidWall = 0;
 
+  WallADT_Points.clear();
   for(unsigned long i=0; i<nPoint; ++i) {
     if( meshToSurface[i] ) {
       meshToSurface[i] = nVertex_SolidWall++;
+      if( update_wall_distance ) WallADT_Points.push_back(i);
 
       for(unsigned short k=0; k<nDim; ++k)
         surfaceCoor.push_back(node[i]->GetCoord(k));
@@ -13007,9 +14323,10 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   /*---         points of the elements close to a wall boundary.           ---*/
   /*--------------------------------------------------------------------------*/
 
-  /* Build the ADT. */
-  CADTElemClass WallADT(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
-                           markerIDs, elemIDs, true);
+  /* Build the ADT. It is kept when the wall distance is updated later. */
+  if (WallADT != NULL) delete WallADT;
+  WallADT = new CADTElemClass(nDim, surfaceCoor, surfaceConn, VTK_TypeElem,
+                              markerIDs, elemIDs, true);
 
   /* Release the memory of the vectors used to build the ADT. To make sure
      that all the memory is deleted, the swap function is used. */
@@ -13025,7 +14342,7 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
   /*--------------------------------------------------------------------------*/
 
 
-  if ( WallADT.IsEmpty() ) {
+  if ( WallADT->IsEmpty() ) {
   
     /*--- No solid wall boundary nodes in the entire mesh.
      Set the wall distance to zero for all nodes. ---*/
@@ -13038,16 +14355,31 @@ void CPhysicalGeometry::ComputeWall_Distance(CConfig *config) {
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
     
-    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint) {
-      unsigned short markerID;
-      unsigned long  elemID;
-      int            rankID;
-      su2double      dist;
-      
-      WallADT.DetermineNearestElement(node[iPoint]->GetCoord(), dist, markerID,
-                                   elemID, rankID);
-      node[iPoint]->SetWall_Distance(dist);
-    }
+    /*--- The points are searched as one batch, which orders them along a
+     space filling curve and starts each search from the previous result. ---*/
+    
+    vector<su2double> pointCoor(nDim*nPoint), dist(nPoint);
+    vector<unsigned short> markerID(nPoint);
+    vector<unsigned long> elemID(nPoint);
+    vector<int> rankID(nPoint);
+    
+    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+      for (unsigned short iDim=0; iDim<nDim; ++iDim)
+        pointCoor[nDim*iPoint+iDim] = node[iPoint]->GetCoord(iDim);
+    
+    WallADT_Donor.assign(nPoint, 0);
+    
+    WallADT->DetermineNearestElements(nPoint, pointCoor.data(), dist.data(), markerID.data(),
+                                      elemID.data(), rankID.data(), WallADT_Donor.data());
+    
+    for (unsigned long iPoint=0; iPoint<GetnPoint(); ++iPoint)
+      node[iPoint]->SetWall_Distance(dist[iPoint]);
+  }
+
+  /* Otherwise the ADT is released, as before. */
+  if (!update_wall_distance) {
+    delete WallADT; WallADT = NULL;
+    vector<unsigned long>().swap(WallADT_Donor);
   }
   
 }
@@ -13115,19 +14447,19 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
   }
   
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&PositiveXArea, &TotalPositiveXArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&PositiveYArea, &TotalPositiveYArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&PositiveZArea, &TotalPositiveZArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&PositiveXArea, &TotalPositiveXArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&PositiveYArea, &TotalPositiveYArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&PositiveZArea, &TotalPositiveZArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
-  SU2_MPI::Allreduce(&MinCoordX, &TotalMinCoordX, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinCoordY, &TotalMinCoordY, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinCoordZ, &TotalMinCoordZ, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MinCoordX, &TotalMinCoordX, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MinCoordY, &TotalMinCoordY, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MinCoordZ, &TotalMinCoordZ, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
   
-  SU2_MPI::Allreduce(&MaxCoordX, &TotalMaxCoordX, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxCoordY, &TotalMaxCoordY, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxCoordZ, &TotalMaxCoordZ, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MaxCoordX, &TotalMaxCoordX, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MaxCoordY, &TotalMaxCoordY, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MaxCoordZ, &TotalMaxCoordZ, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 
-  SU2_MPI::Allreduce(&WettedArea, &TotalWettedArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&WettedArea, &TotalWettedArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
   TotalPositiveXArea = PositiveXArea;
   TotalPositiveYArea = PositiveYArea;
@@ -13227,32 +14559,51 @@ void CPhysicalGeometry::SetPositive_ZArea(CConfig *config) {
 
 void CPhysicalGeometry::SetPoint_Connectivity(void) {
   
-  unsigned short Node_Neighbor, iNode, iNeighbor;
-  unsigned long jElem, Point_Neighbor, iPoint, iElem;
+  unsigned short Node_Neighbor, iNode, iNeighbor, nNeighbor;
+  unsigned long jElem, Point_Neighbor, iPoint, iElem, iPos;
   
-  /*--- Loop over all the elements ---*/
+  /*--- The elements surrounding each point are first stored in compressed
+   row (CSR) form, with one counting pass and one filling pass over the
+   elements, and then handed to the points with a single allocation each.
+   This avoids growing the vectors of every point one element at a time. ---*/
+  
+  vector<unsigned long> Elem_Offset(nPoint+1, 0), Elem_Index;
+  
+  for (iElem = 0; iElem < nElem; iElem++)
+    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      Elem_Offset[elem[iElem]->GetNode(iNode)+1]++;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Elem_Offset[iPoint+1] += Elem_Offset[iPoint];
+  
+  Elem_Index.resize(Elem_Offset[nPoint]);
+  vector<unsigned long> Elem_Pos(Elem_Offset.begin(), Elem_Offset.end()-1);
   
   for (iElem = 0; iElem < nElem; iElem++)
-    
-  /*--- Loop over all the nodes of an element ---*/
-    
     for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++) {
       iPoint = elem[iElem]->GetNode(iNode);
-      
-      /*--- Store the element into the point ---*/
-      
-      node[iPoint]->SetElem(iElem);
+      Elem_Index[Elem_Pos[iPoint]++] = iElem;
     }
-
-  /*--- Loop over all the points ---*/
+  
+  /*--- Store the elements into the points ---*/
   
   for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetElem(&Elem_Index[Elem_Offset[iPoint]],
+                          Elem_Offset[iPoint+1]-Elem_Offset[iPoint]);
+  
+  /*--- Loop over all the points and gather the neighbors through the
+   surrounding elements. A marker per point replaces the linear search for
+   duplicates, the neighbors keep the order in which they are found. ---*/
+  
+  vector<unsigned long> Marker(nPoint, nPoint), Neighbor;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
     
-  /*--- Loop over all elements shared by the point ---*/
+    Neighbor.clear();
     
-    for (iElem = 0; iElem < node[iPoint]->GetnElem(); iElem++) {
+    for (iPos = Elem_Offset[iPoint]; iPos < Elem_Offset[iPoint+1]; iPos++) {
       
-      jElem = node[iPoint]->GetElem(iElem);
+      jElem = Elem_Index[iPos];
       
       /*--- If we find the point iPoint in the surronding element ---*/
       
@@ -13265,18 +14616,110 @@ void CPhysicalGeometry::SetPoint_Connectivity(void) {
           for (iNeighbor = 0; iNeighbor < elem[jElem]->GetnNeighbor_Nodes(iNode); iNeighbor++) {
             Node_Neighbor = elem[jElem]->GetNeighbor_Nodes(iNode, iNeighbor);
             Point_Neighbor = elem[jElem]->GetNode(Node_Neighbor);
-            
-            /*--- Store the point into the point ---*/
-            
-            node[iPoint]->SetPoint(Point_Neighbor);
+            if (Marker[Point_Neighbor] != iPoint) {
+              Marker[Point_Neighbor] = iPoint;
+              Neighbor.push_back(Point_Neighbor);
+            }
           }
     }
+    
+    /*--- Store the points into the point ---*/
+    
+    nNeighbor = Neighbor.size();
+    node[iPoint]->SetPoint(nNeighbor > 0 ? &Neighbor[0] : NULL, nNeighbor);
+    
+  }
+  
+  /*--- Set the number of neighbors variable, this is
+   important for JST and multigrid in parallel ---*/
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
+  
+}
+
+/*--- Index of a point along a Hilbert curve, the coordinates are overwritten
+ with the transposed index (J. Skilling, "Programming the Hilbert curve",
+ AIP Conf. Proc. 707, 2004). ---*/
+
+static unsigned long HilbertIndex(unsigned long *X, unsigned short nDim, unsigned short nBits) {
+  
+  unsigned long M = 1UL << (nBits-1), P, Q, t, Index = 0;
+  unsigned short iDim;
+  short iBit;
+  
+  /*--- Inverse undo excess work ---*/
+  
+  for (Q = M; Q > 1; Q >>= 1) {
+    P = Q - 1;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      if (X[iDim] & Q) X[0] ^= P;
+      else { t = (X[0] ^ X[iDim]) & P; X[0] ^= t; X[iDim] ^= t; }
+    }
+  }
+  
+  /*--- Gray encode ---*/
+  
+  for (iDim = 1; iDim < nDim; iDim++) X[iDim] ^= X[iDim-1];
+  t = 0;
+  for (Q = M; Q > 1; Q >>= 1)
+    if (X[nDim-1] & Q) t ^= Q - 1;
+  for (iDim = 0; iDim < nDim; iDim++) X[iDim] ^= t;
+  
+  /*--- Interleave the bits of the transposed index ---*/
+  
+  for (iBit = nBits-1; iBit >= 0; iBit--)
+    for (iDim = 0; iDim < nDim; iDim++)
+      Index = (Index << 1) | ((X[iDim] >> iBit) & 1);
+  
+  return Index;
+  
+}
+
+void CPhysicalGeometry::SetHilbert_Ordering(vector<unsigned long> & Result) {
+  
+  unsigned long iPoint, X[3];
+  unsigned short iDim;
+  su2double Coord_Min[3], Coord_Max[3], Scale;
+  
+  /*--- Bits per coordinate, such that the index fits in 64 bits ---*/
+  
+  const unsigned short nBits = (nDim == 3)? 21 : 31;
+  const su2double nCell = su2double((1UL << nBits) - 1);
+  
+  if (nPointDomain == 0) return;
+  
+  /*--- Bounding box of the domain points ---*/
+  
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Coord_Min[iDim] = node[0]->GetCoord(iDim);
+    Coord_Max[iDim] = node[0]->GetCoord(iDim);
+  }
+  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Coord_Min[iDim] = min(Coord_Min[iDim], node[iPoint]->GetCoord(iDim));
+      Coord_Max[iDim] = max(Coord_Max[iDim], node[iPoint]->GetCoord(iDim));
+    }
+  }
   
-  /*--- Set the number of neighbors variable, this is
-   important for JST and multigrid in parallel ---*/
+  /*--- Index of each point on the curve, and sort ---*/
   
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    node[iPoint]->SetnNeighbor(node[iPoint]->GetnPoint());
+  vector<pair<unsigned long, unsigned long> > Key(nPointDomain);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Scale = Coord_Max[iDim] - Coord_Min[iDim];
+      if (Scale > 0.0) Scale = nCell/Scale;
+      X[iDim] = (unsigned long) SU2_TYPE::GetValue((node[iPoint]->GetCoord(iDim)-Coord_Min[iDim])*Scale);
+    }
+    Key[iPoint] = make_pair(HilbertIndex(X, nDim, nBits), iPoint);
+  }
+  
+  sort(Key.begin(), Key.end());
+  
+  Result.resize(nPointDomain);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    Result[iPoint] = Key[iPoint].second;
   
 }
 
@@ -13286,89 +14729,117 @@ void CPhysicalGeometry::SetRCM_Ordering(CConfig *config) {
   unsigned short Degree, MinDegree, iDim, iMarker;
   bool *inQueue;
   
-  inQueue = new bool [nPoint];
+  if (config->GetKind_Point_Ordering() == HILBERT_ORDERING) {
+    
+    /*--- Sort the domain points along a Hilbert curve ---*/
+    
+    SetHilbert_Ordering(Result);
+    
+  }
+  else {
+    
+    inQueue = new bool [nPoint];
   
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    inQueue[iPoint] = false;
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      inQueue[iPoint] = false;
   
-  /*--- Select the node with the lowest degree in the grid. ---*/
+    /*--- Select the node with the lowest degree in the grid. ---*/
   
-  MinDegree = node[0]->GetnNeighbor(); AddPoint = 0;
-  for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
-    Degree = node[iPoint]->GetnPoint();
-    if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
-  }
+    MinDegree = node[0]->GetnNeighbor(); AddPoint = 0;
+    for (iPoint = 1; iPoint < nPointDomain; iPoint++) {
+      Degree = node[iPoint]->GetnPoint();
+      if (Degree < MinDegree) { MinDegree = Degree; AddPoint = iPoint; }
+    }
   
-  /*--- Add the node in the first free position. ---*/
+    /*--- Add the node in the first free position. ---*/
   
-  Result.push_back(AddPoint); inQueue[AddPoint] = true;
+    Result.push_back(AddPoint); inQueue[AddPoint] = true;
   
-  /*--- Loop until reorganize all the nodes ---*/
+    /*--- Loop until reorganize all the nodes ---*/
   
-  do {
+    do {
     
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
+      /*--- Add to the queue all the nodes adjacent in the increasing
+       order of their degree, checking if the element is already
+       in the Queue. ---*/
     
-    AuxQueue.clear();
-    for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
-      AdjPoint = node[AddPoint]->GetPoint(iNode);
-      if ((!inQueue[AdjPoint]) && (AdjPoint < nPointDomain)) {
-        AuxQueue.push_back(AdjPoint);
+      AuxQueue.clear();
+      for (iNode = 0; iNode < node[AddPoint]->GetnPoint(); iNode++) {
+        AdjPoint = node[AddPoint]->GetPoint(iNode);
+        if ((!inQueue[AdjPoint]) && (AdjPoint < nPointDomain)) {
+          AuxQueue.push_back(AdjPoint);
+        }
       }
-    }
     
-    if (AuxQueue.size() != 0) {
+      if (AuxQueue.size() != 0) {
       
-      /*--- Sort the auxiliar queue based on the number of neighbors ---*/
+        /*--- Sort the auxiliar queue based on the number of neighbors ---*/
       
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        for (jNode = 0; jNode < AuxQueue.size() - 1 - iNode; jNode++) {
-          if (node[AuxQueue[jNode]]->GetnPoint() > node[AuxQueue[jNode+1]]->GetnPoint()) {
-            AuxPoint = AuxQueue[jNode];
-            AuxQueue[jNode] = AuxQueue[jNode+1];
-            AuxQueue[jNode+1] = AuxPoint;
+        for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
+          for (jNode = 0; jNode < AuxQueue.size() - 1 - iNode; jNode++) {
+            if (node[AuxQueue[jNode]]->GetnPoint() > node[AuxQueue[jNode+1]]->GetnPoint()) {
+              AuxPoint = AuxQueue[jNode];
+              AuxQueue[jNode] = AuxQueue[jNode+1];
+              AuxQueue[jNode+1] = AuxPoint;
+            }
           }
         }
-      }
       
-      Queue.insert(Queue.end(), AuxQueue.begin(), AuxQueue.end());
-      for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
-        inQueue[AuxQueue[iNode]] = true;
-      }
+        Queue.insert(Queue.end(), AuxQueue.begin(), AuxQueue.end());
+        for (iNode = 0; iNode < AuxQueue.size(); iNode++) {
+          inQueue[AuxQueue[iNode]] = true;
+        }
       
-    }
+      }
     
-    /*--- Extract the first node from the queue and add it in the first free
-     position. ---*/
+      /*--- Extract the first node from the queue and add it in the first free
+       position. ---*/
     
-    if (Queue.size() != 0) {
-      AddPoint = Queue[0];
-      Result.push_back(Queue[0]);
-      Queue.erase (Queue.begin(), Queue.begin()+1);
-    }
+      if (Queue.size() != 0) {
+        AddPoint = Queue[0];
+        Result.push_back(Queue[0]);
+        Queue.erase (Queue.begin(), Queue.begin()+1);
+      }
     
-    /*--- Add to the queue all the nodes adjacent in the increasing
-     order of their degree, checking if the element is already
-     in the Queue. ---*/
+      /*--- Add to the queue all the nodes adjacent in the increasing
+       order of their degree, checking if the element is already
+       in the Queue. ---*/
     
-  } while (Queue.size() != 0);
+    } while (Queue.size() != 0);
   
-  /*--- Check that all the points have been added ---*/
+    /*--- Check that all the points have been added ---*/
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-    if (inQueue[iPoint] == false) Result.push_back(iPoint);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (inQueue[iPoint] == false) Result.push_back(iPoint);
+    }
+  
+    delete[] inQueue;
+  
+    reverse(Result.begin(), Result.end());
+    
   }
   
-  delete[] inQueue;
+  /*--- Add the MPI points. The halo points of each receive marker are
+   numbered consecutively, in the order of its vertices and with the markers
+   in the order of the point-to-point messages, such that every received
+   message covers a block of consecutive points. ---*/
   
-  reverse(Result.begin(), Result.end());
+  vector<bool> haloAdded(nPoint-nPointDomain, false);
   
-  /*--- Add the MPI points ---*/
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) ||
+        (config->GetMarker_All_SendRecv(iMarker) >= 0)) continue;
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      iPoint = bound[iMarker][iElem]->GetNode(0);
+      if ((iPoint >= nPointDomain) && !haloAdded[iPoint-nPointDomain]) {
+        Result.push_back(iPoint);
+        haloAdded[iPoint-nPointDomain] = true;
+      }
+    }
+  }
   
   for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
-    Result.push_back(iPoint);
+    if (!haloAdded[iPoint-nPointDomain]) Result.push_back(iPoint);
   }
   
   /*--- Reset old data structures ---*/
@@ -13758,7 +15229,7 @@ void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone,
         valueSpan[iSpan] = -1001.0;
       }
 
-      SU2_MPI::Allgather(MyValueSpan, nSpan_max , MPI_DOUBLE, MyTotValueSpan, nSpan_max, MPI_DOUBLE, MPI_COMM_WORLD);
+      SU2_MPI::Allgather(MyValueSpan, nSpan_max , MPI_SU2DOUBLE, MyTotValueSpan, nSpan_max, MPI_SU2DOUBLE, MPI_COMM_WORLD);
       SU2_MPI::Allgather(&nSpan_loc, 1 , MPI_INT, My_nSpan_loc, 1, MPI_INT, MPI_COMM_WORLD);
 
       jSpan = 0;
@@ -13882,8 +15353,8 @@ void CPhysicalGeometry::ComputeNSpan(CConfig *config, unsigned short val_iZone,
 #ifdef HAVE_MPI
       MyMin= min;			min = 0;
       MyMax= max;			max = 0;
-      SU2_MPI::Allreduce(&MyMin, &min, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyMax, &max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyMin, &min, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyMax, &max, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
 
       //  	cout <<"min  " <<  min << endl;
@@ -14008,6 +15479,9 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
         if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
           if (config->GetMarker_All_TurbomachineryFlag(iMarker) == marker_flag){
 
+            /*--- Span-wise section of every vertex, found once by the search below and reused when storing the vertexes ---*/
+            vector<unsigned short> vertexSpan(nVertex[iMarker]);
+
             /*--- compute the amount of vertexes for each span-wise section to initialize the CTurboVertex pointers and auxiliary pointers  ---*/
             for (iVertex = 0; (unsigned long)iVertex  < nVertex[iMarker]; iVertex++) {
               iPoint = vertex[iMarker][iVertex]->GetNode();
@@ -14081,6 +15555,8 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
                 jSpan = 0;
               }
 
+              vertexSpan[iVertex] = jSpan;
+
               if(node[iPoint]->GetDomain()){
                 nVertexSpan[iMarker][jSpan]++;
               }
@@ -14112,72 +15588,8 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
             /*--- store the vertexes in a ordered manner in span-wise directions but not yet ordered pitch-wise ---*/
             for (iVertex = 0; (unsigned long)iVertex < nVertex[iMarker]; iVertex++) {
               iPoint = vertex[iMarker][iVertex]->GetNode();
-              if(nDim == 3){
-                dist  = 10E+06;
-                jSpan = -1;
-
-                coord = node[iPoint]->GetCoord();
-                switch (config->GetKind_TurboMachinery(val_iZone)){
-                case CENTRIFUGAL: case CENTRIPETAL:
-                  for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                    if (dist > (abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]))){
-                      dist= abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]);
-                      jSpan=iSpan;
-                    }
-                  }
-                  break;
-                case AXIAL:
-                  radius = sqrt(coord[0]*coord[0]+coord[1]*coord[1]);
-                  for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                    if (dist > (abs(radius - SpanWiseValue[marker_flag-1][iSpan]))){
-                      dist= abs(radius-SpanWiseValue[marker_flag-1][iSpan]);
-                      jSpan=iSpan;
-                    }
-                  }
-                  break;
-                case CENTRIPETAL_AXIAL:
-                  if(marker_flag == OUTFLOW){
-                    radius = sqrt(coord[0]*coord[0]+coord[1]*coord[1]);
-                    for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag-1][iSpan]))){
-                        dist= abs(radius-SpanWiseValue[marker_flag-1][iSpan]);
-                        jSpan=iSpan;
-                      }
-                    }
-                  }else{
-                    for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                      if (dist > (abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]))){
-                        dist= abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]);
-                        jSpan=iSpan;
-                      }
-                    }
-                  }
-                  break;
+              jSpan  = vertexSpan[iVertex];
 
-                case AXIAL_CENTRIFUGAL:
-                  if(marker_flag == INFLOW){
-                    radius = sqrt(coord[0]*coord[0]+coord[1]*coord[1]);
-                    for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                      if (dist > (abs(radius - SpanWiseValue[marker_flag-1][iSpan]))){
-                        dist= abs(radius-SpanWiseValue[marker_flag-1][iSpan]);
-                        jSpan=iSpan;
-                      }
-                    }
-                  }else{
-                    for(iSpan = 0; iSpan < nSpanWiseSections[marker_flag-1]; iSpan++){
-                      if (dist > (abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]))){
-                        dist= abs(coord[2]-SpanWiseValue[marker_flag-1][iSpan]);
-                        jSpan=iSpan;
-                      }
-                    }
-                  }
-                  break;
-                }
-              }
-              /*--- 2D problem do not need span-wise separation---*/
-              else{
-                jSpan = 0;
-              }
               /*--- compute the face area associated with the vertex ---*/
               vertex[iMarker][iVertex]->GetNormal(NormalArea);
               for (iDim = 0; iDim < nDim; iDim++) NormalArea[iDim] = -NormalArea[iDim];
@@ -14410,9 +15822,9 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
     MyIntMin  = minIntAngPitch[iSpan];   minIntAngPitch[iSpan] = 10.0E+6;
     MyMax     = maxAngPitch[iSpan];      maxAngPitch[iSpan]    = -10.0E+6;
 
-    SU2_MPI::Allreduce(&MyMin, &minAngPitch[iSpan], 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyIntMin, &minIntAngPitch[iSpan], 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyMax, &maxAngPitch[iSpan], 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyMin, &minAngPitch[iSpan], 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyIntMin, &minIntAngPitch[iSpan], 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyMax, &maxAngPitch[iSpan], 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
 
 
@@ -14522,11 +15934,11 @@ void CPhysicalGeometry::SetTurboVertex(CConfig *config, unsigned short val_iZone
        }
      }
     }
-    SU2_MPI::Gather(y_loc[iSpan], nTotVertex_gb[iSpan] , MPI_DOUBLE, y_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(x_loc[iSpan], nTotVertex_gb[iSpan] , MPI_DOUBLE, x_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(z_loc[iSpan], nTotVertex_gb[iSpan] , MPI_DOUBLE, z_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(angCoord_loc[iSpan], nTotVertex_gb[iSpan] , MPI_DOUBLE, angCoord_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(deltaAngCoord_loc[iSpan], nTotVertex_gb[iSpan] , MPI_DOUBLE, deltaAngCoord_gb, nTotVertex_gb[iSpan], MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(y_loc[iSpan], nTotVertex_gb[iSpan] , MPI_SU2DOUBLE, y_gb, nTotVertex_gb[iSpan], MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(x_loc[iSpan], nTotVertex_gb[iSpan] , MPI_SU2DOUBLE, x_gb, nTotVertex_gb[iSpan], MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(z_loc[iSpan], nTotVertex_gb[iSpan] , MPI_SU2DOUBLE, z_gb, nTotVertex_gb[iSpan], MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(angCoord_loc[iSpan], nTotVertex_gb[iSpan] , MPI_SU2DOUBLE, angCoord_gb, nTotVertex_gb[iSpan], MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(deltaAngCoord_loc[iSpan], nTotVertex_gb[iSpan] , MPI_SU2DOUBLE, deltaAngCoord_gb, nTotVertex_gb[iSpan], MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 
     if (rank == MASTER_NODE){
       for(iSpanVertex = 0; iSpanVertex<nTotVertex_gb[iSpan]; iSpanVertex++){
@@ -14900,8 +16312,8 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
 
     MyTotalArea            = TotalArea;                 TotalArea            = 0;
     MyTotalRadius          = TotalRadius;               TotalRadius          = 0;
-    SU2_MPI::Allreduce(&MyTotalArea, &TotalArea, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalRadius, &TotalRadius, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyTotalArea, &TotalArea, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyTotalRadius, &TotalRadius, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
     MyTotalTurboNormal     = new su2double[nDim];
     MyTotalNormal          = new su2double[nDim];
@@ -14916,9 +16328,9 @@ void CPhysicalGeometry::SetAvgTurboValue(CConfig *config, unsigned short val_iZo
       TotalGridVel[iDim]        = 0.0;
     }
 
-    SU2_MPI::Allreduce(MyTotalTurboNormal, TotalTurboNormal, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalNormal, TotalNormal, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalGridVel, TotalGridVel, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(MyTotalTurboNormal, TotalTurboNormal, nDim, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(MyTotalNormal, TotalNormal, nDim, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(MyTotalGridVel, TotalGridVel, nDim, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
     delete [] MyTotalTurboNormal;delete [] MyTotalNormal; delete [] MyTotalGridVel;
 
@@ -15158,8 +16570,8 @@ void CPhysicalGeometry::GatherInOutAverageValues(CConfig *config, bool allocate)
       TotMarkerTP[i]    = -1;
     }
 
-    SU2_MPI::Allgather(TurbGeoIn, n1, MPI_DOUBLE, TotTurbGeoIn, n1, MPI_DOUBLE, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(TurbGeoOut, n2, MPI_DOUBLE,TotTurbGeoOut, n2, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(TurbGeoIn, n1, MPI_SU2DOUBLE, TotTurbGeoIn, n1, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(TurbGeoOut, n2, MPI_SU2DOUBLE,TotTurbGeoOut, n2, MPI_SU2DOUBLE, MPI_COMM_WORLD);
     SU2_MPI::Allgather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MPI_COMM_WORLD);
 
     delete [] TurbGeoIn, delete [] TurbGeoOut;
@@ -15229,7 +16641,7 @@ void CPhysicalGeometry::GatherInOutAverageValues(CConfig *config, bool allocate)
 
 
 void CPhysicalGeometry::SetCoord_CG(void) {
-  unsigned short nNode, iDim, iMarker, iNode;
+  unsigned short nNode, iDim, iNode;
   unsigned long elem_poin, edge_poin, iElem, iEdge;
   su2double **Coord;
   
@@ -15259,26 +16671,7 @@ void CPhysicalGeometry::SetCoord_CG(void) {
   
   /*--- Center of gravity for face elements ---*/
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++)
-    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
-      nNode = bound[iMarker][iElem]->GetnNodes();
-      Coord = new su2double* [nNode];
-      
-      /*--- Store the coordinates for all the element nodes ---*/
-      
-      for (iNode = 0; iNode < nNode; iNode++) {
-        elem_poin = bound[iMarker][iElem]->GetNode(iNode);
-        Coord[iNode] = new su2double [nDim];
-        for (iDim = 0; iDim < nDim; iDim++)
-          Coord[iNode][iDim]=node[elem_poin]->GetCoord(iDim);
-      }
-      /*--- Compute the element CG coordinates ---*/
-      
-      bound[iMarker][iElem]->SetCoord_CG(Coord);
-      for (iNode = 0; iNode < nNode; iNode++)
-        if (Coord[iNode] != NULL) delete[] Coord[iNode];
-      if (Coord != NULL) delete[] Coord;
-    }
+  SetBoundCoord_CG();
   
   /*--- Center of gravity for edges ---*/
   
@@ -15305,12 +16698,43 @@ void CPhysicalGeometry::SetCoord_CG(void) {
   }
 }
 
+void CPhysicalGeometry::SetBoundCoord_CG(void) {
+  unsigned short nNode, iDim, iMarker, iNode;
+  unsigned long elem_poin, iElem;
+  su2double **Coord;
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      nNode = bound[iMarker][iElem]->GetnNodes();
+      Coord = new su2double* [nNode];
+      
+      /*--- Store the coordinates for all the element nodes ---*/
+      
+      for (iNode = 0; iNode < nNode; iNode++) {
+        elem_poin = bound[iMarker][iElem]->GetNode(iNode);
+        Coord[iNode] = new su2double [nDim];
+        for (iDim = 0; iDim < nDim; iDim++)
+          Coord[iNode][iDim]=node[elem_poin]->GetCoord(iDim);
+      }
+      /*--- Compute the element CG coordinates ---*/
+      
+      bound[iMarker][iElem]->SetCoord_CG(Coord);
+      for (iNode = 0; iNode < nNode; iNode++)
+        if (Coord[iNode] != NULL) delete[] Coord[iNode];
+      if (Coord != NULL) delete[] Coord;
+    }
+  
+}
+
 void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short action) {
   unsigned short Neighbor_Node, iMarker, iNode, iNeighbor_Nodes, iDim;
   unsigned long Neighbor_Point, iVertex, iPoint, iElem;
-  long iEdge;
   su2double Area, *NormalFace = NULL;
   
+  /*--- The vertex arrays are copied again with the new normals ---*/
+  
+  Vertex_Arrays_Ready = false;
+  
   /*--- Update values of faces of the edge ---*/
   
   if (action != ALLOCATE)
@@ -15342,11 +16766,11 @@ void CPhysicalGeometry::SetBoundControlVolume(CConfig *config, unsigned short ac
           Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
           Neighbor_Point = bound[iMarker][iElem]->GetNode(Neighbor_Node);
           
-          /*--- Shared edge by the Neighbor Point and the point ---*/
+          /*--- Midpoint of the edge shared by the Neighbor Point and the point, the
+                same as the edge CG, without requiring the edge structure ---*/
           
-          iEdge = FindEdge(iPoint, Neighbor_Point);
           for (iDim = 0; iDim < nDim; iDim++) {
-            Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
+            Coord_Edge_CG[iDim] = node[iPoint]->GetCoord(iDim)/2.0 + node[Neighbor_Point]->GetCoord(iDim)/2.0;
             Coord_Elem_CG[iDim] = bound[iMarker][iElem]->GetCG(iDim);
             Coord_Vertex[iDim] = node[iPoint]->GetCoord(iDim);
           }
@@ -15541,7 +16965,7 @@ void CPhysicalGeometry::MatchInterface(CConfig *config) {
     for (unsigned long iBuffer_Marker = 0; iBuffer_Marker < nBuffer_Marker; iBuffer_Marker++)
       Buffer_Receive_Marker[iBuffer_Marker] = Buffer_Send_Marker[iBuffer_Marker];
 #else
-    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_SU2DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_SU2DOUBLE, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, Buffer_Receive_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
@@ -15613,7 +17037,7 @@ void CPhysicalGeometry::MatchInterface(CConfig *config) {
 #ifndef HAVE_MPI
     maxdist_global = maxdist_local;
 #else
-    SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
 #endif
     
     if (rank == MASTER_NODE) cout <<"The max distance between points is: " << maxdist_global <<"."<< endl;
@@ -15740,7 +17164,7 @@ void CPhysicalGeometry::MatchNearField(CConfig *config) {
     for (unsigned long iBuffer_Marker = 0; iBuffer_Marker < nBuffer_Marker; iBuffer_Marker++)
       Buffer_Receive_Marker[iBuffer_Marker] = Buffer_Send_Marker[iBuffer_Marker];
 #else
-    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_SU2DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_SU2DOUBLE, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, Buffer_Receive_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
@@ -15812,7 +17236,7 @@ void CPhysicalGeometry::MatchNearField(CConfig *config) {
 #ifndef HAVE_MPI
     maxdist_global = maxdist_local;
 #else
-    SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
 #endif
     
     if (rank == MASTER_NODE) cout <<"The max distance between points is: " << maxdist_global <<"."<< endl;
@@ -15844,234 +17268,275 @@ void CPhysicalGeometry::MatchActuator_Disk(CConfig *config) {
   
   unsigned short nMarker_ActDiskInlet = config->GetnMarker_ActDiskInlet();
   
+  /*--- Reset the exchange pattern of the actuator disk data ---*/
+  
+  Neighbor_ActDiskSend.clear();  Neighbor_ActDiskRecv.clear();
+  nVertex_ActDiskSend.assign(1, 0);  nVertex_ActDiskRecv.assign(1, 0);
+  Point_ActDiskSend.clear();  Marker_ActDiskRecv.clear();
+  Vertex_ActDiskRecv.clear();  GlobalIndex_ActDiskRecv.clear();
+  
   if (nMarker_ActDiskInlet != 0) {
     
-    unsigned short iMarker, iDim;
-    unsigned long iVertex, iPoint, iPointGlobal, pPoint = 0, pPointGlobal = 0, pVertex = 0, pMarker = 0, jVertex, jVertex_, jPoint, jPointGlobal, jMarker;
-    su2double *Coord_i, Coord_j[3], dist = 0.0, mindist, maxdist_local = 0.0, maxdist_global = 0.0;
-    int iProcessor, pProcessor = 0;
-    unsigned long nLocalVertex_ActDisk = 0, MaxLocalVertex_ActDisk = 0;
-    int nProcessor = size;
-    unsigned short Beneficiary = 0, Donor = 0, iBC;
-    bool Perimeter;
+    unsigned short iMarker, iDim, iBC, Beneficiary = 0, Donor = 0;
+    unsigned long iVertex, iPoint, iPointGlobal, iDonor, iTarget, nTarget, iTargetStart, iRequest;
+    su2double maxdist_local = 0.0, maxdist_global = 0.0;
+    int iProcessor, nProcessor = size;
+    
+    /*--- Owned vertices of both sides of the disk, numbered locally. They are
+     the donors of the opposite side, their local number is their point ID in the ADT. ---*/
+    
+    vector<unsigned long> donorPoint, donorVertex;
+    vector<unsigned short> donorMarker;
+    
+    /*--- Owned vertices of both sides of the disk with their nearest donor ---*/
+    
+    vector<unsigned short> targetMarker;
+    vector<unsigned long> targetVertex, targetDonor;
+    vector<int> targetRank;
+    vector<su2double> targetDist;
     
     for (iBC = 0; iBC < 2; iBC++) {
       
       if (iBC == 0) { Beneficiary = ACTDISK_INLET; Donor = ACTDISK_OUTLET; }
       if (iBC == 1) { Beneficiary = ACTDISK_OUTLET; Donor = ACTDISK_INLET; }
       
-      unsigned long *Buffer_Send_nVertex = new unsigned long [1];
-      unsigned long *Buffer_Receive_nVertex = new unsigned long [nProcessor];
-      
       if ((iBC == 0) && (rank == MASTER_NODE)) cout << "Set Actuator Disk inlet boundary conditions." << endl;
       if ((iBC == 1) && (rank == MASTER_NODE)) cout << "Set Actuator Disk outlet boundary conditions." << endl;
       
-      /*--- Compute the number of vertex that have an actuator disk outlet boundary condition
-       without including the ghost nodes ---*/
+      vector<su2double> donorCoord, targetCoord;
+      vector<unsigned long> donorID;
       
-      nLocalVertex_ActDisk = 0;
       for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+        
         if (config->GetMarker_All_KindBC(iMarker) == Donor) {
-          for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
+          for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
             iPoint = vertex[iMarker][iVertex]->GetNode();
-            if (node[iPoint]->GetDomain()) nLocalVertex_ActDisk ++;
+            if (node[iPoint]->GetDomain()) {
+              donorID.push_back(donorPoint.size());
+              donorPoint.push_back(iPoint);
+              donorVertex.push_back(iVertex);
+              donorMarker.push_back(iMarker);
+              for (iDim = 0; iDim < nDim; iDim++)
+                donorCoord.push_back(node[iPoint]->GetCoord(iDim));
+            }
           }
         }
-      }
-      
-      Buffer_Send_nVertex[0] = nLocalVertex_ActDisk;
-      
-      /*--- Send actuator disk vertex information --*/
-      
-#ifndef HAVE_MPI
-      MaxLocalVertex_ActDisk = nLocalVertex_ActDisk;
-      Buffer_Receive_nVertex[0] = Buffer_Send_nVertex[0];
-#else
-      SU2_MPI::Allreduce(&nLocalVertex_ActDisk, &MaxLocalVertex_ActDisk, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-      SU2_MPI::Allgather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#endif
-      
-      /*--- Array dimensionalization --*/
-      
-      su2double *Buffer_Send_Coord = new su2double [MaxLocalVertex_ActDisk*nDim];
-      unsigned long *Buffer_Send_Point  = new unsigned long [MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Send_GlobalIndex  = new unsigned long [MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Send_Vertex  = new unsigned long [MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Send_Marker  = new unsigned long [MaxLocalVertex_ActDisk];
-      
-      su2double *Buffer_Receive_Coord = new su2double [nProcessor*MaxLocalVertex_ActDisk*nDim];
-      unsigned long *Buffer_Receive_Point = new unsigned long [nProcessor*MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Receive_GlobalIndex = new unsigned long [nProcessor*MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Receive_Vertex = new unsigned long [nProcessor*MaxLocalVertex_ActDisk];
-      unsigned long *Buffer_Receive_Marker = new unsigned long [nProcessor*MaxLocalVertex_ActDisk];
-      
-      unsigned long nBuffer_Coord = MaxLocalVertex_ActDisk*nDim;
-      unsigned long nBuffer_Point = MaxLocalVertex_ActDisk;
-      unsigned long nBuffer_GlobalIndex = MaxLocalVertex_ActDisk;
-      unsigned long nBuffer_Vertex = MaxLocalVertex_ActDisk;
-      unsigned long nBuffer_Marker = MaxLocalVertex_ActDisk;
-      
-      for (iVertex = 0; iVertex < MaxLocalVertex_ActDisk; iVertex++) {
-        Buffer_Send_Point[iVertex] = 0;
-        Buffer_Send_GlobalIndex[iVertex] = 0;
-        Buffer_Send_Vertex[iVertex] = 0;
-        Buffer_Send_Marker[iVertex] = 0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          Buffer_Send_Coord[iVertex*nDim+iDim] = 0.0;
-      }
-      
-      /*--- Copy coordinates and point to the auxiliar vector --*/
-      
-      nLocalVertex_ActDisk = 0;
-      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-        if (config->GetMarker_All_KindBC(iMarker) == Donor) {
-          for (iVertex = 0; iVertex < GetnVertex(iMarker); iVertex++) {
+        
+        if (config->GetMarker_All_KindBC(iMarker) == Beneficiary) {
+          for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
             iPoint = vertex[iMarker][iVertex]->GetNode();
-            iPointGlobal = node[iPoint]->GetGlobalIndex();
             if (node[iPoint]->GetDomain()) {
-              Buffer_Send_Point[nLocalVertex_ActDisk] = iPoint;
-              Buffer_Send_GlobalIndex[nLocalVertex_ActDisk] = iPointGlobal;
-              Buffer_Send_Vertex[nLocalVertex_ActDisk] = iVertex;
-              Buffer_Send_Marker[nLocalVertex_ActDisk] = iMarker;
+              targetMarker.push_back(iMarker);
+              targetVertex.push_back(iVertex);
               for (iDim = 0; iDim < nDim; iDim++)
-                Buffer_Send_Coord[nLocalVertex_ActDisk*nDim+iDim] = node[iPoint]->GetCoord(iDim);
-              nLocalVertex_ActDisk++;
+                targetCoord.push_back(node[iPoint]->GetCoord(iDim));
             }
           }
         }
+        
       }
       
-#ifndef HAVE_MPI
-      for (unsigned long iBuffer_Coord = 0; iBuffer_Coord < nBuffer_Coord; iBuffer_Coord++)
-        Buffer_Receive_Coord[iBuffer_Coord] = Buffer_Send_Coord[iBuffer_Coord];
-      for (unsigned long iBuffer_Point = 0; iBuffer_Point < nBuffer_Point; iBuffer_Point++)
-        Buffer_Receive_Point[iBuffer_Point] = Buffer_Send_Point[iBuffer_Point];
-      for (unsigned long iBuffer_GlobalIndex = 0; iBuffer_GlobalIndex < nBuffer_GlobalIndex; iBuffer_GlobalIndex++)
-        Buffer_Receive_GlobalIndex[iBuffer_GlobalIndex] = Buffer_Send_GlobalIndex[iBuffer_GlobalIndex];
-      for (unsigned long iBuffer_Vertex = 0; iBuffer_Vertex < nBuffer_Vertex; iBuffer_Vertex++)
-        Buffer_Receive_Vertex[iBuffer_Vertex] = Buffer_Send_Vertex[iBuffer_Vertex];
-      for (unsigned long iBuffer_Marker = 0; iBuffer_Marker < nBuffer_Marker; iBuffer_Marker++)
-        Buffer_Receive_Marker[iBuffer_Marker] = Buffer_Send_Marker[iBuffer_Marker];
+      /*--- Compute the closest donor of every target point with a global ADT of
+       the donor vertices. Targets without any donor keep the rank -1. ---*/
       
-#else
-      SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
-      SU2_MPI::Allgather(Buffer_Send_Point, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_Point, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-      SU2_MPI::Allgather(Buffer_Send_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalIndex, nBuffer_GlobalIndex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-      SU2_MPI::Allgather(Buffer_Send_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, Buffer_Receive_Vertex, nBuffer_Vertex, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-      SU2_MPI::Allgather(Buffer_Send_Marker, nBuffer_Marker, MPI_UNSIGNED_LONG, Buffer_Receive_Marker, nBuffer_Marker, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-#endif
+      iTargetStart = targetDonor.size();
+      nTarget      = targetVertex.size() - iTargetStart;
       
-      /*--- Compute the closest point to an actuator disk inlet point ---*/
+      targetDonor.resize(targetVertex.size(), 0);
+      targetRank.resize(targetVertex.size(), -1);
+      targetDist.resize(targetVertex.size(), 1E6);
       
-      maxdist_local = 0.0;
+      CADTPointsOnlyClass DonorADT(nDim, donorID.size(), donorCoord.data(), donorID.data(), true);
       
-      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-        if (config->GetMarker_All_KindBC(iMarker) == Beneficiary) {
-          
-          for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
-            iPoint = vertex[iMarker][iVertex]->GetNode();
-            iPointGlobal = node[iPoint]->GetGlobalIndex();
-            
-            
-            if (node[iPoint]->GetDomain()) {
-              
-              /*--- Coordinates of the boundary point ---*/
-              
-              Coord_i = node[iPoint]->GetCoord(); mindist = 1E6; pProcessor = 0; pPoint = 0;
-              
-              /*--- Loop over all the boundaries to find the pair ---*/
-              
-              Perimeter = false;
-              
-              for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-                for (jVertex = 0; jVertex < Buffer_Receive_nVertex[iProcessor]; jVertex++) {
-                  jPoint = Buffer_Receive_Point[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jPointGlobal = Buffer_Receive_GlobalIndex[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jVertex_ = Buffer_Receive_Vertex[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  jMarker = Buffer_Receive_Marker[iProcessor*MaxLocalVertex_ActDisk+jVertex];
-                  
- //                 if (jPointGlobal != iPointGlobal) {
- //                 ActDisk_Perimeter
-
-                    /*--- Compute the distance ---*/
-                    
-                    dist = 0.0;
-                    for (iDim = 0; iDim < nDim; iDim++) {
-                      Coord_j[iDim] = Buffer_Receive_Coord[(iProcessor*MaxLocalVertex_ActDisk+jVertex)*nDim+iDim];
-                      dist += pow(Coord_j[iDim]-Coord_i[iDim], 2.0);
-                    }
-                    dist = sqrt(dist);
-                    
-                    if (dist < mindist) {
-                      mindist = dist; pProcessor = iProcessor; pPoint = jPoint; pPointGlobal = jPointGlobal;
-                      pVertex = jVertex_; pMarker = jMarker;
-                      if (dist == 0.0) break;
-                    }
-                    
-//                  }
-//                  else { Perimeter = true; mindist = 0.0; dist = 0.0; break; }
-               }
-              }
-              
-              /*--- Store the value of the pair ---*/
-              
-              maxdist_local = max(maxdist_local, mindist);
-              vertex[iMarker][iVertex]->SetDonorPoint(pPoint, pPointGlobal, pVertex, pMarker, pProcessor);
-              vertex[iMarker][iVertex]->SetActDisk_Perimeter(Perimeter);
-              
-              if (mindist > epsilon) {
-                cout.precision(10);
-                cout << endl;
-                cout << "   Bad match for point " << iPoint << ".\tNearest";
-                cout << " donor distance: " << scientific << mindist << ".";
-                vertex[iMarker][iVertex]->SetDonorPoint(iPoint, iPointGlobal, pVertex, pMarker, pProcessor);
-                maxdist_local = min(maxdist_local, 0.0);
-              }
-              
-            }
-          }
-          
-        }
+      if (!DonorADT.IsEmpty() && (nTarget > 0))
+        DonorADT.DetermineNearestNodes(nTarget, targetCoord.data(), &targetDist[iTargetStart],
+                                       &targetDonor[iTargetStart], &targetRank[iTargetStart]);
+      
+    }
+    
+    nTarget = targetVertex.size();
+    
+    /*--- Every target point sends a request to the rank of its donor, with the
+     local number of the donor and the global index of the target point. The
+     requests are sorted by rank, in this order they make up the messages of the
+     exchange pattern, the replies return the donor vertex to the targets. ---*/
+    
+    vector<int> nRequest_Send(nProcessor, 0), nRequest_Recv(nProcessor, 0);
+    for (iTarget = 0; iTarget < nTarget; iTarget++)
+      if (targetRank[iTarget] >= 0) nRequest_Send[targetRank[iTarget]]++;
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Alltoall(nRequest_Send.data(), 1, MPI_INT, nRequest_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+#else
+    nRequest_Recv = nRequest_Send;
+#endif
+    
+    vector<unsigned long> offsetSend(nProcessor+1, 0), offsetRecv(nProcessor+1, 0);
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      offsetSend[iProcessor+1] = offsetSend[iProcessor] + nRequest_Send[iProcessor];
+      offsetRecv[iProcessor+1] = offsetRecv[iProcessor] + nRequest_Recv[iProcessor];
+    }
+    
+    vector<unsigned long> requestTarget(offsetSend[nProcessor]);
+    vector<unsigned long> Buffer_Send_Request(2*offsetSend[nProcessor]), Buffer_Receive_Request(2*offsetRecv[nProcessor]);
+    vector<unsigned long> Buffer_Send_Reply(4*offsetRecv[nProcessor]), Buffer_Receive_Reply(4*offsetSend[nProcessor]);
+    
+    vector<unsigned long> Fill(offsetSend.begin(), offsetSend.end()-1);
+    for (iTarget = 0; iTarget < nTarget; iTarget++) {
+      if (targetRank[iTarget] < 0) continue;
+      iRequest = Fill[targetRank[iTarget]]++;
+      iPoint = vertex[targetMarker[iTarget]][targetVertex[iTarget]]->GetNode();
+      requestTarget[iRequest] = iTarget;
+      Buffer_Send_Request[2*iRequest+0] = targetDonor[iTarget];
+      Buffer_Send_Request[2*iRequest+1] = node[iPoint]->GetGlobalIndex();
+    }
+    
+    /*--- Send the requests, the ones to this rank itself are copied ---*/
+    
+    for (iRequest = 0; iRequest < 2*(unsigned long)nRequest_Send[rank]; iRequest++)
+      Buffer_Receive_Request[2*offsetRecv[rank]+iRequest] = Buffer_Send_Request[2*offsetSend[rank]+iRequest];
+    
+#ifdef HAVE_MPI
+    
+    vector<SU2_MPI::Request> commReqs;
+    commReqs.reserve(2*nProcessor);
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || (nRequest_Recv[iProcessor] == 0)) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(&Buffer_Receive_Request[2*offsetRecv[iProcessor]], 2*nRequest_Recv[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, iProcessor, MPI_COMM_WORLD, &commReqs.back());
+    }
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || (nRequest_Send[iProcessor] == 0)) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(&Buffer_Send_Request[2*offsetSend[iProcessor]], 2*nRequest_Send[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, rank, MPI_COMM_WORLD, &commReqs.back());
+    }
+    
+    if (!commReqs.empty())
+      SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+    
+#endif
+    
+    /*--- Answer the requests with the point, global index, vertex and marker of
+     the donors. The received requests are the data this rank gets every iteration. ---*/
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if (nRequest_Recv[iProcessor] == 0) continue;
+      Neighbor_ActDiskRecv.push_back(iProcessor);
+      for (iRequest = offsetRecv[iProcessor]; iRequest < offsetRecv[iProcessor+1]; iRequest++) {
+        iDonor = Buffer_Receive_Request[2*iRequest+0];
+        Buffer_Send_Reply[4*iRequest+0] = donorPoint[iDonor];
+        Buffer_Send_Reply[4*iRequest+1] = node[donorPoint[iDonor]]->GetGlobalIndex();
+        Buffer_Send_Reply[4*iRequest+2] = donorVertex[iDonor];
+        Buffer_Send_Reply[4*iRequest+3] = donorMarker[iDonor];
+        Marker_ActDiskRecv.push_back(donorMarker[iDonor]);
+        Vertex_ActDiskRecv.push_back(donorVertex[iDonor]);
+        GlobalIndex_ActDiskRecv.push_back(Buffer_Receive_Request[2*iRequest+1]);
       }
-      
-#ifndef HAVE_MPI
-      maxdist_global = maxdist_local;
-#else
-      SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+      nVertex_ActDiskRecv.push_back(Vertex_ActDiskRecv.size());
+    }
+    
+    for (iRequest = 0; iRequest < 4*(unsigned long)nRequest_Recv[rank]; iRequest++)
+      Buffer_Receive_Reply[4*offsetSend[rank]+iRequest] = Buffer_Send_Reply[4*offsetRecv[rank]+iRequest];
+    
+#ifdef HAVE_MPI
+    
+    commReqs.clear();
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || (nRequest_Send[iProcessor] == 0)) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(&Buffer_Receive_Reply[4*offsetSend[iProcessor]], 4*nRequest_Send[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, iProcessor, MPI_COMM_WORLD, &commReqs.back());
+    }
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if ((iProcessor == rank) || (nRequest_Recv[iProcessor] == 0)) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(&Buffer_Send_Reply[4*offsetRecv[iProcessor]], 4*nRequest_Recv[iProcessor], MPI_UNSIGNED_LONG,
+                     iProcessor, rank, MPI_COMM_WORLD, &commReqs.back());
+    }
+    
+    if (!commReqs.empty())
+      SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+    
 #endif
+    
+    /*--- Store the value of the pair. The target points send their data to the
+     rank of their donor every iteration, in the order of the requests. ---*/
+    
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if (nRequest_Send[iProcessor] == 0) continue;
+      Neighbor_ActDiskSend.push_back(iProcessor);
+      for (iRequest = offsetSend[iProcessor]; iRequest < offsetSend[iProcessor+1]; iRequest++) {
+        iTarget = requestTarget[iRequest];
+        Point_ActDiskSend.push_back(vertex[targetMarker[iTarget]][targetVertex[iTarget]]->GetNode());
+        vertex[targetMarker[iTarget]][targetVertex[iTarget]]->SetDonorPoint(Buffer_Receive_Reply[4*iRequest+0],
+                                                                            Buffer_Receive_Reply[4*iRequest+1],
+                                                                            Buffer_Receive_Reply[4*iRequest+2],
+                                                                            Buffer_Receive_Reply[4*iRequest+3],
+                                                                            iProcessor);
+      }
+      nVertex_ActDiskSend.push_back(Point_ActDiskSend.size());
+    }
+    
+    for (iTarget = 0; iTarget < nTarget; iTarget++) {
       
-      if (rank == MASTER_NODE) cout <<"The max distance between points is: " << maxdist_global <<"."<< endl;
+      iVertex = targetVertex[iTarget];
+      iMarker = targetMarker[iTarget];
+      iPoint  = vertex[iMarker][iVertex]->GetNode();
+      iPointGlobal = node[iPoint]->GetGlobalIndex();
       
-      delete[] Buffer_Send_Coord;
-      delete[] Buffer_Send_Point;
+      maxdist_local = max(maxdist_local, targetDist[iTarget]);
+      vertex[iMarker][iVertex]->SetActDisk_Perimeter(false);
       
-      delete[] Buffer_Receive_Coord;
-      delete[] Buffer_Receive_Point;
+      if (targetRank[iTarget] < 0)
+        vertex[iMarker][iVertex]->SetDonorPoint(iPoint, iPointGlobal, iVertex, iMarker, nProcessor);
       
-      delete[] Buffer_Send_nVertex;
-      delete[] Buffer_Receive_nVertex;
-
-      delete [] Buffer_Send_GlobalIndex;
-      delete [] Buffer_Send_Vertex;
-      delete [] Buffer_Send_Marker;
-
-      delete [] Buffer_Receive_GlobalIndex;
-      delete [] Buffer_Receive_Vertex;
-      delete [] Buffer_Receive_Marker;
+      if (targetDist[iTarget] > epsilon) {
+        cout.precision(10);
+        cout << endl;
+        cout << "   Bad match for point " << iPoint << ".\tNearest";
+        cout << " donor distance: " << scientific << targetDist[iTarget] << ".";
+        vertex[iMarker][iVertex]->SetDonorPoint(iPoint, iPointGlobal, vertex[iMarker][iVertex]->GetDonorVertex(),
+                                                vertex[iMarker][iVertex]->GetDonorMarker(),
+                                                vertex[iMarker][iVertex]->GetDonorProcessor());
+        maxdist_local = min(maxdist_local, 0.0);
+      }
       
     }
+    
+#ifndef HAVE_MPI
+    maxdist_global = maxdist_local;
+#else
+    SU2_MPI::Reduce(&maxdist_local, &maxdist_global, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+    
+    if (rank == MASTER_NODE) cout <<"The max distance between points is: " << maxdist_global <<"."<< endl;
+    
   }
   
 }
 
-
 void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action) {
-  unsigned long face_iPoint = 0, face_jPoint = 0, iPoint, iElem;
+  unsigned long face_iPoint = 0, face_jPoint = 0, iPoint, iElem, iPos;
   long iEdge;
   unsigned short nEdgesFace = 1, iFace, iEdgesFace, iDim;
   su2double *Coord_Edge_CG, *Coord_FaceElem_CG, *Coord_Elem_CG, *Coord_FaceiPoint, *Coord_FacejPoint, Area,
   Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
-  bool change_face_orientation;
+  bool change_face_orientation, build_table;
+
+  /*--- The least-squares weights, edge factors, vertex arrays and multigrid transfer weights are recomputed with the new coordinates ---*/
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  Vertex_Arrays_Ready = false;
+  MG_Transfer_Ready = false;
+  
+  /*--- All the control volumes are recomputed ---*/
+  DualGrid_Affected.clear();
 
   /*--- Update values of faces of the edge ---*/
   if (action != ALLOCATE) {
@@ -16081,11 +17546,16 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
       node[iPoint]->SetVolume (0.0);
   }
   
-  Coord_Edge_CG = new su2double [nDim];
   Coord_FaceElem_CG = new su2double [nDim];
   Coord_Elem_CG = new su2double [nDim];
-  Coord_FaceiPoint = new su2double [nDim];
-  Coord_FacejPoint = new su2double [nDim];
+  
+  /*--- The edge of each face segment of the elements is searched only once,
+   the grid updates (deformation, moving grids) reuse the table instead of
+   calling FindEdge again for every segment. ---*/
+  
+  build_table = ((action == ALLOCATE) || Elem_FaceEdge.empty());
+  if (build_table) Elem_FaceEdge.clear();
+  iPos = 0;
   
   my_DomainVolume = 0.0;
   for (iElem = 0; iElem < nElem; iElem++)
@@ -16117,14 +17587,22 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
         /*--- We define a direction (from the smalest index to the greatest) --*/
         change_face_orientation = false;
         if (face_iPoint > face_jPoint) change_face_orientation = true;
-        iEdge = FindEdge(face_iPoint, face_jPoint);
+        if (build_table) {
+          iEdge = FindEdge(face_iPoint, face_jPoint);
+          Elem_FaceEdge.push_back(iEdge);
+        }
+        else iEdge = Elem_FaceEdge[iPos];
+        iPos++;
+        
+        /*--- The edge CG and the point coordinates are used in place ---*/
+        
+        Coord_Edge_CG = &Edge_CG[iEdge*nDim];
+        Coord_FaceiPoint = node[face_iPoint]->GetCoord();
+        Coord_FacejPoint = node[face_jPoint]->GetCoord();
         
         for (iDim = 0; iDim < nDim; iDim++) {
-          Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
           Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
           Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
-          Coord_FaceiPoint[iDim] = node[face_iPoint]->GetCoord(iDim);
-          Coord_FacejPoint[iDim] = node[face_jPoint]->GetCoord(iDim);
         }
         
         switch (nDim) {
@@ -16160,7 +17638,7 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   
   
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
   DomainVolume = my_DomainVolume;
 #endif
@@ -16172,11 +17650,265 @@ void CPhysicalGeometry::SetControlVolume(CConfig *config, unsigned short action)
   
   config->SetDomainVolume(DomainVolume);
   
-  delete[] Coord_Edge_CG;
   delete[] Coord_FaceElem_CG;
   delete[] Coord_Elem_CG;
-  delete[] Coord_FaceiPoint;
-  delete[] Coord_FacejPoint;
+}
+
+void CPhysicalGeometry::SetControlVolume_Moved(CConfig *config) {
+  unsigned long face_iPoint = 0, face_jPoint = 0, iPoint, jPoint, iElem, iVertex, Neighbor_Point;
+  long iEdge;
+  unsigned short nEdgesFace = 1, iFace, iEdgesFace, iDim, iNode, nNode, iMarker, iNeighbor_Nodes, Neighbor_Node;
+  su2double Coord_Edge_CG[3], Coord_FaceElem_CG[3], Coord_Elem_CG[3], Coord_FaceiPoint[3], Coord_FacejPoint[3],
+  Coord_Vertex[3], Area, Volume, DomainVolume, my_DomainVolume, *NormalFace = NULL;
+  bool change_face_orientation, moved;
+  vector<su2double*> Coord;
+  
+  /*--- Without the coordinates of a previous update the whole dual grid is computed ---*/
+  
+  if (DualGrid_Coord.size() != nPoint*nDim) {
+    SetCoord_CG();
+    SetControlVolume(config, UPDATE);
+    SetBoundControlVolume(config, UPDATE);
+    DualGrid_Coord.resize(nPoint*nDim);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+    return;
+  }
+  
+  /*--- The least-squares weights, edge factors, vertex arrays and multigrid transfer weights are recomputed with the new coordinates ---*/
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  Vertex_Arrays_Ready = false;
+  MG_Transfer_Ready = false;
+  
+  /*--- Points moved since the last update of the dual grid ---*/
+  
+  vector<bool> Point_Moved(nPoint, false);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++)
+      if (node[iPoint]->GetCoord(iDim) != DualGrid_Coord[iPoint*nDim+iDim]) {
+        DualGrid_Coord[iPoint*nDim+iDim] = node[iPoint]->GetCoord(iDim);
+        Point_Moved[iPoint] = true;
+      }
+  
+  /*--- The dual faces of an element with a moved point change, hence the control
+   volumes of all its points and the edges between them are recomputed ---*/
+  
+  DualGrid_Affected.assign(nPoint, false);
+  for (iElem = 0; iElem < nElem; iElem++) {
+    nNode = elem[iElem]->GetnNodes();
+    moved = false;
+    for (iNode = 0; iNode < nNode; iNode++)
+      if (Point_Moved[elem[iElem]->GetNode(iNode)]) moved = true;
+    if (!moved) continue;
+    
+    Coord.resize(nNode);
+    for (iNode = 0; iNode < nNode; iNode++) {
+      iPoint = elem[iElem]->GetNode(iNode);
+      Coord[iNode] = node[iPoint]->GetCoord();
+      DualGrid_Affected[iPoint] = true;
+    }
+    elem[iElem]->SetCoord_CG(&Coord[0]);
+  }
+  
+  /*--- Center of gravity of the boundary elements with a moved point ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+      nNode = bound[iMarker][iElem]->GetnNodes();
+      moved = false;
+      for (iNode = 0; iNode < nNode; iNode++)
+        if (Point_Moved[bound[iMarker][iElem]->GetNode(iNode)]) moved = true;
+      if (!moved) continue;
+      
+      Coord.resize(nNode);
+      for (iNode = 0; iNode < nNode; iNode++)
+        Coord[iNode] = node[bound[iMarker][iElem]->GetNode(iNode)]->GetCoord();
+      bound[iMarker][iElem]->SetCoord_CG(&Coord[0]);
+    }
+  
+  /*--- Center of gravity of the edges with a moved point. An edge between two
+   affected points collects the faces of all its elements again. ---*/
+  
+  vector<bool> Edge_Affected(nEdge, false);
+  Coord.resize(2);
+  for (iEdge = 0; iEdge < (long)nEdge; iEdge++) {
+    iPoint = edge[iEdge]->GetNode(0);
+    jPoint = edge[iEdge]->GetNode(1);
+    if (Point_Moved[iPoint] || Point_Moved[jPoint]) {
+      Coord[0] = node[iPoint]->GetCoord();
+      Coord[1] = node[jPoint]->GetCoord();
+      edge[iEdge]->SetCoord_CG(&Coord[0]);
+    }
+    if (DualGrid_Affected[iPoint] && DualGrid_Affected[jPoint]) {
+      Edge_Affected[iEdge] = true;
+      edge[iEdge]->SetZeroValues();
+    }
+  }
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    if (DualGrid_Affected[iPoint]) node[iPoint]->SetVolume(0.0);
+  
+  /*--- Add the contributions of every element around the affected points ---*/
+  
+  for (iElem = 0; iElem < nElem; iElem++) {
+    moved = false;
+    for (iNode = 0; iNode < elem[iElem]->GetnNodes(); iNode++)
+      if (DualGrid_Affected[elem[iElem]->GetNode(iNode)]) moved = true;
+    if (!moved) continue;
+    
+    for (iFace = 0; iFace < elem[iElem]->GetnFaces(); iFace++) {
+      
+      /*--- In 2D all the faces have only one edge ---*/
+      if (nDim == 2) nEdgesFace = 1;
+      /*--- In 3D the number of edges per face is the same as the number of point per face ---*/
+      if (nDim == 3) nEdgesFace = elem[iElem]->GetnNodesFace(iFace);
+      
+      /*-- Loop over the edges of a face ---*/
+      for (iEdgesFace = 0; iEdgesFace < nEdgesFace; iEdgesFace++) {
+        
+        /*--- In 2D only one edge (two points) per edge ---*/
+        if (nDim == 2) {
+          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+          face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,1));
+        }
+        
+        /*--- In 3D there are several edges in each face ---*/
+        if (nDim == 3) {
+          face_iPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace));
+          if (iEdgesFace != nEdgesFace-1)
+            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace, iEdgesFace+1));
+          else
+            face_jPoint = elem[iElem]->GetNode(elem[iElem]->GetFaces(iFace,0));
+        }
+        
+        if (!DualGrid_Affected[face_iPoint] && !DualGrid_Affected[face_jPoint]) continue;
+        
+        /*--- We define a direction (from the smalest index to the greatest) --*/
+        change_face_orientation = false;
+        if (face_iPoint > face_jPoint) change_face_orientation = true;
+        iEdge = FindEdge(face_iPoint, face_jPoint);
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
+          Coord_Elem_CG[iDim] = elem[iElem]->GetCG(iDim);
+          Coord_FaceElem_CG[iDim] = elem[iElem]->GetFaceCG(iFace, iDim);
+          Coord_FaceiPoint[iDim] = node[face_iPoint]->GetCoord(iDim);
+          Coord_FacejPoint[iDim] = node[face_jPoint]->GetCoord(iDim);
+        }
+        
+        switch (nDim) {
+          case 2:
+            /*--- Two dimensional problem ---*/
+            if (Edge_Affected[iEdge]) {
+              if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG);
+              else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG);
+            }
+            if (DualGrid_Affected[face_iPoint]) {
+              Area = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_Elem_CG);
+              node[face_iPoint]->AddVolume(Area);
+            }
+            if (DualGrid_Affected[face_jPoint]) {
+              Area = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_Elem_CG);
+              node[face_jPoint]->AddVolume(Area);
+            }
+            break;
+          case 3:
+            /*--- Three dimensional problem ---*/
+            if (Edge_Affected[iEdge]) {
+              if (change_face_orientation) edge[iEdge]->SetNodes_Coord(Coord_FaceElem_CG, Coord_Edge_CG, Coord_Elem_CG);
+              else edge[iEdge]->SetNodes_Coord(Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+            }
+            if (DualGrid_Affected[face_iPoint]) {
+              Volume = edge[iEdge]->GetVolume(Coord_FaceiPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+              node[face_iPoint]->AddVolume(Volume);
+            }
+            if (DualGrid_Affected[face_jPoint]) {
+              Volume = edge[iEdge]->GetVolume(Coord_FacejPoint, Coord_Edge_CG, Coord_FaceElem_CG, Coord_Elem_CG);
+              node[face_jPoint]->AddVolume(Volume);
+            }
+            break;
+        }
+      }
+    }
+  }
+  
+  /*--- Check if there is a normal with null area ---*/
+  for (iEdge = 0; iEdge < (long)nEdge; iEdge++) {
+    if (!Edge_Affected[iEdge]) continue;
+    NormalFace = edge[iEdge]->GetNormal();
+    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+    Area = sqrt(Area);
+    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+  }
+  
+  /*--- The volume of the domain is the sum of the control volumes ---*/
+  
+  my_DomainVolume = 0.0;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    my_DomainVolume += node[iPoint]->GetVolume();
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&my_DomainVolume, &DomainVolume, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  DomainVolume = my_DomainVolume;
+#endif
+  
+  config->SetDomainVolume(DomainVolume);
+  
+  /*--- Boundary vertices of the affected points ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
+      if (DualGrid_Affected[vertex[iMarker][iVertex]->GetNode()])
+        vertex[iMarker][iVertex]->SetZeroValues();
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    for (iElem = 0; iElem < nElem_Bound[iMarker]; iElem++)
+      for (iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+        iPoint = bound[iMarker][iElem]->GetNode(iNode);
+        if (!DualGrid_Affected[iPoint]) continue;
+        iVertex = node[iPoint]->GetVertex(iMarker);
+        
+        /*--- Loop over the neighbor nodes, there is a face for each one ---*/
+        
+        for (iNeighbor_Nodes = 0; iNeighbor_Nodes < bound[iMarker][iElem]->GetnNeighbor_Nodes(iNode); iNeighbor_Nodes++) {
+          Neighbor_Node = bound[iMarker][iElem]->GetNeighbor_Nodes(iNode, iNeighbor_Nodes);
+          Neighbor_Point = bound[iMarker][iElem]->GetNode(Neighbor_Node);
+          
+          /*--- Shared edge by the Neighbor Point and the point ---*/
+          
+          iEdge = FindEdge(iPoint, Neighbor_Point);
+          for (iDim = 0; iDim < nDim; iDim++) {
+            Coord_Edge_CG[iDim] = edge[iEdge]->GetCG(iDim);
+            Coord_Elem_CG[iDim] = bound[iMarker][iElem]->GetCG(iDim);
+            Coord_Vertex[iDim] = node[iPoint]->GetCoord(iDim);
+          }
+          switch (nDim) {
+            case 2:
+              if (iNode == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Vertex);
+              if (iNode == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Vertex, Coord_Elem_CG);
+              break;
+            case 3:
+              if (iNeighbor_Nodes == 0) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Elem_CG, Coord_Edge_CG, Coord_Vertex);
+              if (iNeighbor_Nodes == 1) vertex[iMarker][iVertex]->SetNodes_Coord(Coord_Edge_CG, Coord_Elem_CG, Coord_Vertex);
+              break;
+          }
+        }
+      }
+  
+  /*--- Check if there is a normal with null area ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker ++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      if (!DualGrid_Affected[vertex[iMarker][iVertex]->GetNode()]) continue;
+      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+      Area = sqrt(Area);
+      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+    }
+  
 }
 
 void CPhysicalGeometry::VisualizeControlVolume(CConfig *config, unsigned short action) {
@@ -16983,7 +18715,8 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
 #ifdef HAVE_MPI
 #ifdef HAVE_PARMETIS
   
-  unsigned long iPoint;
+  unsigned long iPoint, jPoint, iElem_Bound;
+  unsigned short iMarker, iNode, iCon;
   MPI_Comm comm = MPI_COMM_WORLD;
 
   /*--- Only call ParMETIS if we have more than one rank to avoid errors ---*/
@@ -16997,15 +18730,46 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     idx_t *vtxdist = new idx_t[size+1];
     idx_t *part    = new idx_t[nPoint];
     
-    real_t ubvec;
-    real_t *tpwgts = new real_t[size];
+    idx_t *vwgt    = NULL;
     
     /*--- Some recommended defaults for the various ParMETIS options. ---*/
     
     wgtflag = 0;
     numflag = 0;
     ncon    = 1;
-    ubvec   = 1.05;
+    
+    /*--- With partition weights, each point carries two constraints: the
+     number of its edges (the cost of the edge loops and of the halo) and
+     the number of boundary elements it belongs to (the cost of the boundary
+     conditions). ParMETIS balances both of them separately. ---*/
+    
+    if (config->GetPartition_Weights()) {
+      
+      wgtflag = 2;
+      ncon    = 2;
+      vwgt    = new idx_t[ncon*nPoint];
+      
+      for (iPoint = 0; iPoint < nPoint; iPoint++) {
+        vwgt[ncon*iPoint]   = max(xadj[iPoint+1]-xadj[iPoint], (idx_t)1);
+        vwgt[ncon*iPoint+1] = 0;
+      }
+      
+      /*--- The boundary elements are known on all ranks with the global
+       point indices, keep the ones of the points of this linear partition. ---*/
+      
+      for (iMarker = 0; iMarker < nMarker; iMarker++)
+        for (iElem_Bound = 0; iElem_Bound < nElem_Bound[iMarker]; iElem_Bound++)
+          for (iNode = 0; iNode < bound[iMarker][iElem_Bound]->GetnNodes(); iNode++) {
+            jPoint = bound[iMarker][iElem_Bound]->GetNode(iNode);
+            if ((jPoint >= starting_node[rank]) && (jPoint < ending_node[rank]))
+              vwgt[ncon*(jPoint-starting_node[rank])+1]++;
+          }
+      
+    }
+    
+    real_t *ubvec  = new real_t[ncon];
+    real_t *tpwgts = new real_t[ncon*size];
+    for (iCon = 0; iCon < ncon; iCon++) ubvec[iCon] = 1.05;
     nparts  = (idx_t)size;
     idx_t options[METIS_NOPTIONS];
     METIS_SetDefaultOptions(options);
@@ -17015,7 +18779,7 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
      adjacency_size are class data members that have been defined and set
      earlier in the partitioning process. ---*/
     
-    for (int i = 0; i < size; i++) {
+    for (int i = 0; i < ncon*size; i++) {
       tpwgts[i] = 1.0/((real_t)size);
     }
     
@@ -17024,14 +18788,62 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
       vtxdist[i+1] = (idx_t)ending_node[i];
     }
     
+    /*--- Reuse the partitioning of a previous run with the same mesh and
+     number of ranks, if it has been stored. ---*/
+    
+    bool cache_found = false;
+    if (config->GetPartition_Cache())
+      cache_found = Read_Partition_Cache(config, size, part);
+    
     /*--- Calling ParMETIS ---*/
-    if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
-    ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, NULL, NULL, &wgtflag,
-                         &numflag, &ncon, &nparts, tpwgts, &ubvec, options,
-                         &edgecut, part, &comm);
-    if (rank == MASTER_NODE) {
-      cout << " graph partitioning complete (";
-      cout << edgecut << " edge cuts)." << endl;
+    if (!cache_found) {
+      if (rank == MASTER_NODE) cout << "Calling ParMETIS...";
+      ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, NULL, &wgtflag,
+                           &numflag, &ncon, &nparts, tpwgts, ubvec, options,
+                           &edgecut, part, &comm);
+      if (rank == MASTER_NODE) {
+        cout << " graph partitioning complete (";
+        cout << edgecut << " edge cuts)." << endl;
+      }
+      if (config->GetPartition_Cache())
+        Write_Partition_Cache(config, size, part);
+    }
+    else if (rank == MASTER_NODE) {
+      cout << "Graph partitioning read from the partition cache." << endl;
+    }
+    
+    /*--- Partitionings for other numbers of ranks (PARTITION_CACHE_RANKS).
+     ParMETIS splits the graph in any number of parts, so a job that is
+     resized to one of these rank counts restarts without partitioning. ---*/
+    
+    if (config->GetPartition_Cache()) {
+      
+      idx_t *part_cache = new idx_t[nPoint];
+      
+      for (unsigned short iCache = 0; iCache < config->GetnPartition_Cache_Ranks(); iCache++) {
+        
+        idx_t nparts_cache = (idx_t)config->GetPartition_Cache_Ranks(iCache);
+        if ((nparts_cache < 2) || (nparts_cache == nparts)) continue;
+        if (Read_Partition_Cache(config, nparts_cache, part_cache)) continue;
+        
+        real_t *tpwgts_cache = new real_t[ncon*nparts_cache];
+        for (int i = 0; i < ncon*nparts_cache; i++)
+          tpwgts_cache[i] = 1.0/((real_t)nparts_cache);
+        
+        if (rank == MASTER_NODE) cout << "Calling ParMETIS for " << nparts_cache << " ranks...";
+        ParMETIS_V3_PartKway(vtxdist,xadj, adjacency, vwgt, NULL, &wgtflag,
+                             &numflag, &ncon, &nparts_cache, tpwgts_cache, ubvec, options,
+                             &edgecut, part_cache, &comm);
+        if (rank == MASTER_NODE) {
+          cout << " graph partitioning stored in the partition cache (";
+          cout << edgecut << " edge cuts)." << endl;
+        }
+        Write_Partition_Cache(config, nparts_cache, part_cache);
+        
+        delete [] tpwgts_cache;
+      }
+      
+      delete [] part_cache;
     }
     
     /*--- Store the results of the partitioning (note that this is local
@@ -17047,6 +18859,8 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
     delete [] vtxdist;
     delete [] part;
     delete [] tpwgts;
+    delete [] ubvec;
+    if (vwgt != NULL) delete [] vwgt;
     
   }
   
@@ -17061,18 +18875,148 @@ void CPhysicalGeometry::SetColorGrid_Parallel(CConfig *config) {
   
 }
 
+#ifdef HAVE_MPI
+#ifdef HAVE_PARMETIS
+
+string CPhysicalGeometry::GetPartition_Cache_FileName(CConfig *config, int val_nparts) {
+  
+  /*--- One file per number of parts and zone, e.g. mesh.su2.part_64_0 holds
+   the colors of all the points of zone 0 for a partitioning in 64 parts. ---*/
+  
+  ostringstream filename;
+  filename << config->GetMesh_FileName() << ".part_" << val_nparts << "_";
+  filename << config->GetiZone();
+  return filename.str();
+  
+}
+
+void CPhysicalGeometry::Get_Partition_Cache_Header(CConfig *config, int val_nparts, unsigned long *Cache_Header) {
+  
+  /*--- The cache is identified by the size and the modification time of the
+   mesh file, the number of parts and the global number of points. It does
+   not depend on the number of ranks that read or write it.
+   Weighted and unweighted partitionings use different identifiers. ---*/
+  
+  struct stat mesh_stat;
+  
+  Cache_Header[0] = config->GetPartition_Weights() ? 535534 : 535533;
+  Cache_Header[1] = 0; Cache_Header[2] = 0;
+  if (stat(config->GetMesh_FileName().c_str(), &mesh_stat) == 0) {
+    Cache_Header[1] = (unsigned long)mesh_stat.st_size;
+    Cache_Header[2] = (unsigned long)mesh_stat.st_mtime;
+  }
+  Cache_Header[3] = (unsigned long)val_nparts;
+  Cache_Header[4] = ending_node[size-1];
+  Cache_Header[5] = 0;
+  
+}
+
+bool CPhysicalGeometry::Read_Partition_Cache(CConfig *config, int val_nparts, idx_t *part) {
+  
+  unsigned long Cache_Header[6], File_Header[6], iPoint;
+  int local_found = 0, found = 0, ierr;
+  vector<int> Color(nPoint);
+  MPI_File fhw;
+  MPI_Offset disp;
+  char fname[MAX_STRING_SIZE];
+  
+  Get_Partition_Cache_Header(config, val_nparts, Cache_Header);
+  
+  /*--- The colors are stored by global point index after the header, each
+   rank reads the block of its linear partition. ---*/
+  
+  strcpy(fname, GetPartition_Cache_FileName(config, val_nparts).c_str());
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  if (ierr == MPI_SUCCESS) {
+    MPI_File_read_at(fhw, 0, File_Header, 6, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+    if (equal(File_Header, File_Header+6, Cache_Header)) {
+      disp = 6*sizeof(unsigned long) + starting_node[rank]*sizeof(int);
+      if (nPoint > 0)
+        MPI_File_read_at(fhw, disp, &Color[0], nPoint, MPI_INT, MPI_STATUS_IGNORE);
+      local_found = 1;
+    }
+    MPI_File_close(&fhw);
+  }
+  
+  /*--- The cache is only used if it is valid for all ranks. ---*/
+  
+  SU2_MPI::Allreduce(&local_found, &found, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  
+  if (found) {
+    for (iPoint = 0; iPoint < nPoint; iPoint++) {
+      if ((Color[iPoint] < 0) || (Color[iPoint] >= val_nparts)) found = 0;
+      part[iPoint] = (idx_t)Color[iPoint];
+    }
+    local_found = found;
+    SU2_MPI::Allreduce(&local_found, &found, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+  }
+  
+  return (found == 1);
+  
+}
+
+void CPhysicalGeometry::Write_Partition_Cache(CConfig *config, int val_nparts, idx_t *part) {
+  
+  unsigned long Cache_Header[6], iPoint;
+  vector<int> Color(nPoint);
+  int ierr;
+  MPI_File fhw;
+  MPI_Offset disp;
+  char fname[MAX_STRING_SIZE];
+  
+  Get_Partition_Cache_Header(config, val_nparts, Cache_Header);
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Color[iPoint] = (int)part[iPoint];
+  
+  /*--- All ranks write their block of colors at the position of their first
+   global point, there is no gather of the partitioning on one rank. ---*/
+  
+  strcpy(fname, GetPartition_Cache_FileName(config, val_nparts).c_str());
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  
+  /*--- A missing cache only costs a new partitioning in the next run. ---*/
+  
+  if (ierr != MPI_SUCCESS) {
+    if (rank == MASTER_NODE) {
+      cout << "WARNING: The partition cache " << fname;
+      cout << " could not be written." << endl;
+    }
+    return;
+  }
+  
+  MPI_File_set_size(fhw, 0);
+  
+  if (rank == MASTER_NODE)
+    MPI_File_write_at(fhw, 0, Cache_Header, 6, MPI_UNSIGNED_LONG, MPI_STATUS_IGNORE);
+  
+  disp = 6*sizeof(unsigned long) + starting_node[rank]*sizeof(int);
+  if (nPoint > 0)
+    MPI_File_write_at(fhw, disp, &Color[0], nPoint, MPI_INT, MPI_STATUS_IGNORE);
+  
+  MPI_File_close(&fhw);
+  
+}
+
+#endif
+#endif
+
 void CPhysicalGeometry::GetQualityStatistics(su2double *statistics) {
   unsigned long jPoint, Point_2, Point_3, iElem;
   su2double *Coord_j, *Coord_2, *Coord_3;
   unsigned short iDim;
+  int iProcessor, nProcessor = size;
   
-  statistics[0] = 1e06;
-  statistics[1] = 0;
+  /*--- Local minimum, sum and number of the owned elements, an element
+   belongs to the rank that owns its first node. ---*/
+  
+  su2double MyStatistics[3] = {1e06, 0.0, 0.0};
   
   /*--- Loop interior edges ---*/
   for (iElem = 0; iElem < this->GetnElem(); iElem++) {
     
-    if ((this->GetnDim() == 2) && (elem[iElem]->GetVTK_Type() == TRIANGLE)) {
+    if ((this->GetnDim() == 2) && (elem[iElem]->GetVTK_Type() == TRIANGLE) &&
+        (node[elem[iElem]->GetNode(0)]->GetDomain())) {
       
       jPoint = elem[iElem]->GetNode(0); Coord_j = node[jPoint]->GetCoord();
       Point_2 = elem[iElem]->GetNode(1); Coord_2 = node[Point_2]->GetCoord();
@@ -17097,14 +19041,36 @@ void CPhysicalGeometry::GetQualityStatistics(su2double *statistics) {
       su2double roR = r / R;
       
       /*--- Update statistics ---*/
-      if (roR < statistics[0])
-        statistics[0] = roR;
-      statistics[1] += roR;
+      if (roR < MyStatistics[0])
+        MyStatistics[0] = roR;
+      MyStatistics[1] += roR;
+      MyStatistics[2] += 1.0;
       
     }
   }
-  statistics[1] /= this->GetnElem();
   
+  /*--- Gather the partial statistics of all ranks in a single collective. ---*/
+  
+  su2double *Buffer_Receive_Statistics = new su2double [3*nProcessor];
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(MyStatistics, 3, MPI_SU2DOUBLE, Buffer_Receive_Statistics, 3, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+#else
+  for (iDim = 0; iDim < 3; iDim++) Buffer_Receive_Statistics[iDim] = MyStatistics[iDim];
+#endif
+  
+  su2double nElem_Total = 0.0;
+  statistics[0] = 1e06;
+  statistics[1] = 0.0;
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    statistics[0] = min(statistics[0], Buffer_Receive_Statistics[3*iProcessor]);
+    statistics[1] += Buffer_Receive_Statistics[3*iProcessor+1];
+    nElem_Total   += Buffer_Receive_Statistics[3*iProcessor+2];
+  }
+  if (nElem_Total > 0.0) statistics[1] /= nElem_Total;
+  
+  delete [] Buffer_Receive_Statistics;
+
 }
 
 void CPhysicalGeometry::SetRotationalVelocity(CConfig *config, unsigned short val_iZone, bool print) {
@@ -17221,41 +19187,9 @@ void CPhysicalGeometry::SetTranslationalVelocity(CConfig *config, unsigned short
 
 void CPhysicalGeometry::SetGridVelocity(CConfig *config, unsigned long iter) {
   
-  /*--- Local variables ---*/
-  
-  su2double *Coord_nP1 = NULL, *Coord_n = NULL, *Coord_nM1 = NULL;
-  su2double TimeStep, GridVel = 0.0;
-  unsigned long iPoint;
-  unsigned short iDim;
-  
   /*--- Compute the velocity of each node in the volume mesh ---*/
   
-  for (iPoint = 0; iPoint < GetnPoint(); iPoint++) {
-    
-    /*--- Coordinates of the current point at n+1, n, & n-1 time levels ---*/
-    
-    Coord_nM1 = node[iPoint]->GetCoord_n1();
-    Coord_n   = node[iPoint]->GetCoord_n();
-    Coord_nP1 = node[iPoint]->GetCoord();
-
-    /*--- Unsteady time step ---*/
-    
-    TimeStep = config->GetDelta_UnstTimeND();
-    
-    /*--- Compute mesh velocity with 1st or 2nd-order approximation ---*/
-    
-    for (iDim = 0; iDim < nDim; iDim++) {
-      if (config->GetUnsteady_Simulation() == DT_STEPPING_1ST)
-        GridVel = ( Coord_nP1[iDim] - Coord_n[iDim] ) / TimeStep;
-      if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
-        GridVel = ( 3.0*Coord_nP1[iDim] - 4.0*Coord_n[iDim]
-                   + 1.0*Coord_nM1[iDim] ) / (2.0*TimeStep);
-      
-      /*--- Store grid velocity for this point ---*/
-      
-      node[iPoint]->SetGridVel(iDim, GridVel);
-    }
-  }
+  ComputeGridVelocity(config);
   
 }
 
@@ -17303,8 +19237,8 @@ void CPhysicalGeometry::Set_MPI_Coord(CConfig *config) {
       
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Coord, nBufferS_Vector, MPI_DOUBLE, send_to,0,
-                   Buffer_Receive_Coord, nBufferR_Vector, MPI_DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Coord, nBufferS_Vector, MPI_SU2DOUBLE, send_to,0,
+                   Buffer_Receive_Coord, nBufferR_Vector, MPI_SU2DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -17436,8 +19370,8 @@ void CPhysicalGeometry::Set_MPI_GridVel(CConfig *config) {
       
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_GridVel, nBufferS_Vector, MPI_DOUBLE, send_to,0,
-                   Buffer_Receive_GridVel, nBufferR_Vector, MPI_DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_GridVel, nBufferS_Vector, MPI_SU2DOUBLE, send_to,0,
+                   Buffer_Receive_GridVel, nBufferR_Vector, MPI_SU2DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -17567,8 +19501,8 @@ void CPhysicalGeometry::Set_MPI_OldCoord(CConfig *config) {
 
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Coord_n, nBufferS_Vector, MPI_DOUBLE, send_to,0,
-                   Buffer_Receive_Coord_n, nBufferR_Vector, MPI_DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Coord_n, nBufferS_Vector, MPI_SU2DOUBLE, send_to,0,
+                   Buffer_Receive_Coord_n, nBufferR_Vector, MPI_SU2DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
 #else
 
       /*--- Receive information without MPI ---*/
@@ -17692,8 +19626,8 @@ void CPhysicalGeometry::Set_MPI_OldCoord(CConfig *config) {
 
 #ifdef HAVE_MPI
 			  /*--- Send/Receive information using Sendrecv ---*/
-			  SU2_MPI::Sendrecv(Buffer_Send_Coord_n1, nBufferS_Vector, MPI_DOUBLE, send_to,0,
-					  Buffer_Receive_Coord_n1, nBufferR_Vector, MPI_DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
+			  SU2_MPI::Sendrecv(Buffer_Send_Coord_n1, nBufferS_Vector, MPI_SU2DOUBLE, send_to,0,
+					  Buffer_Receive_Coord_n1, nBufferR_Vector, MPI_SU2DOUBLE, receive_from,0, MPI_COMM_WORLD, &status);
 #else
 
 			  /*--- Receive information without MPI ---*/
@@ -17824,8 +19758,8 @@ void CPhysicalGeometry::Set_MPI_MaxLength(CConfig *config) {
 
 #ifdef HAVE_MPI
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send, nBufferS, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive, nBufferR, MPI_DOUBLE, receive_from, 0,
+      SU2_MPI::Sendrecv(Buffer_Send, nBufferS, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive, nBufferR, MPI_SU2DOUBLE, receive_from, 0,
                         MPI_COMM_WORLD, &status);
 #else
 
@@ -18208,6 +20142,8 @@ void CPhysicalGeometry::FindNormal_Neighbor(CConfig *config) {
   unsigned short iNeigh, iMarker, iDim;
   unsigned long iPoint, iVertex;
   
+  Vertex_Arrays_Ready = false;
+  
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE &&
@@ -18350,22 +20286,14 @@ void CPhysicalGeometry::SetGeometryPlanes(CConfig *config) {
 
 void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
   unsigned short iMarker, icommas;
-  unsigned long iVertex, iPoint, (*Point2Vertex)[2], nPointLocal = 0, nPointGlobal = 0;
+  unsigned long iVertex, iPoint;
   su2double Sensitivity;
-  bool *PointInDomain;
-  
-  nPointLocal = nPoint;
-#ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&nPointLocal, &nPointGlobal, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-#else
-  nPointGlobal = nPointLocal;
-#endif
   
-  Point2Vertex = new unsigned long[nPointGlobal][2];
-  PointInDomain = new bool[nPointGlobal];
+  /*--- Map the global index of the owned design vertices to their marker
+   and vertex, sized by the local surface instead of the global mesh. ---*/
   
-  for (iPoint = 0; iPoint < nPointGlobal; iPoint ++)
-    PointInDomain[iPoint] = false;
+  map<unsigned long, pair<unsigned short, unsigned long> > Point2Vertex;
+  map<unsigned long, pair<unsigned short, unsigned long> >::const_iterator it;
   
   for (iMarker = 0; iMarker < nMarker; iMarker++)
     if (config->GetMarker_All_DV(iMarker) == YES)
@@ -18375,9 +20303,7 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
         iPoint = node[vertex[iMarker][iVertex]->GetNode()]->GetGlobalIndex();
 
         if (vertex[iMarker][iVertex]->GetNode() < GetnPointDomain()) {
-          Point2Vertex[iPoint][0] = iMarker;
-          Point2Vertex[iPoint][1] = iVertex;
-          PointInDomain[iPoint] = true;
+          Point2Vertex[iPoint] = make_pair(iMarker, iVertex);
           vertex[iMarker][iVertex]->SetAuxVar(0.0);
         }
       }
@@ -18458,12 +20384,13 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
       stringstream  point_line(text_line);
       point_line >> iPoint >> Sensitivity;
       
-      if (PointInDomain[iPoint]) {
+      it = Point2Vertex.find(iPoint);
+      if (it != Point2Vertex.end()) {
         
         /*--- Find the vertex for the Point and Marker ---*/
         
-        iMarker = Point2Vertex[iPoint][0];
-        iVertex = Point2Vertex[iPoint][1];
+        iMarker = it->second.first;
+        iVertex = it->second.second;
         
         /*--- Increment the auxiliary variable with the contribution of
          this unsteady timestep. For steady problems, this reduces to
@@ -18476,9 +20403,6 @@ void CPhysicalGeometry::SetBoundSensitivity(CConfig *config) {
     Surface_file.close();
   }
   
-  delete[] Point2Vertex;
-  delete[] PointInDomain;
-  
 }
 
 void CPhysicalGeometry::SetSensitivity(CConfig *config) {
@@ -18502,7 +20426,6 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
   unsigned short nExtIter, iDim;
   unsigned long iPoint, index;
   string::size_type position;
-  int counter = 0;
   
   Sensitivity = new su2double[nPoint*nDim];
 
@@ -18523,330 +20446,59 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
     if (sst && !frozen_visc) { skipVar += skipMult*2;}
     if (sa && !frozen_visc)  { skipVar += skipMult*1;}
     if (grid_movement)       { skipVar += nDim;}
-  }
-  else if (Kind_Solver == DISC_ADJ_HEAT) {
-    skipVar += 1;
-  }
-  else {
-    cout << "WARNING: Reading in sensitivities not defined for specified solver!" << endl;
-  }
-
-  /*--- Read all lines in the restart file ---*/
-  long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
-  
-  
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Sensitivity[iPoint*nDim+iDim] = 0.0;
-    }
-  }
-
-  iPoint_Global = 0;
-
-  filename = config->GetSolution_AdjFileName();
-
-  filename = config->GetObjFunc_Extension(filename);
-
-  if (config->GetUnsteady_Simulation()) {
-    filename = config->GetUnsteady_FileName(filename, nExtIter-1);
-  }
-
-	if (config->GetnZone() > 1){
-		filename = config->GetMultizone_FileName(filename, config->GetiZone());
-	}
-
-  if (config->GetRead_Binary_Restart()) {
-
-    char str_buf[CGNS_STRING_SIZE], fname[100];
-    unsigned short iVar;
-    strcpy(fname, filename.c_str());
-    int nRestart_Vars = 5, nFields;
-    int *Restart_Vars = new int[5];
-    passivedouble *Restart_Data = NULL;
-    int Restart_Iter = 0;
-    passivedouble Restart_Meta_Passive[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
-    su2double Restart_Meta[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
-
-#ifndef HAVE_MPI
-
-    /*--- Serial binary input. ---*/
-
-    FILE *fhw;
-    fhw = fopen(fname,"rb");
-    size_t ret;
-
-    /*--- Error check for opening the file. ---*/
-
-    if (!fhw) {
-      SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
-    }
-
-    /*--- First, read the number of variables and points. ---*/
-
-    ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
-    if (ret != (unsigned long)nRestart_Vars) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
-
-    /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
-
-    if (Restart_Vars[0] != 535532) {
-      SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                     string("SU2 reads/writes binary restart files by default.\n") +
-                     string("Note that backward compatibility for ASCII restart files is\n") +
-                     string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-    }
-
-    /*--- Store the number of fields for simplicity. ---*/
-
-    nFields = Restart_Vars[1];
-
-    /*--- Read the variable names from the file. Note that we are adopting a
-     fixed length of 33 for the string length to match with CGNS. This is
-     needed for when we read the strings later. We pad the beginning of the
-     variable string vector with the Point_ID tag that wasn't written. ---*/
-
-    config->fields.push_back("Point_ID");
-    for (iVar = 0; iVar < nFields; iVar++) {
-      ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
-      if (ret != (unsigned long)CGNS_STRING_SIZE) {
-        SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-      }
-      config->fields.push_back(str_buf);
-    }
-
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
-
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
-
-    /*--- Read in the data for the restart at all local points. ---*/
-
-    ret = fread(Restart_Data, sizeof(passivedouble), nFields*GetnPointDomain(), fhw);
-    if (ret != (unsigned long)nFields*GetnPointDomain()) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
-
-    /*--- Compute (negative) displacements and grab the metadata. ---*/
-
-    ret = sizeof(int) + 8*sizeof(passivedouble);
-    fseek(fhw,-ret, SEEK_END);
-
-    /*--- Read the external iteration. ---*/
-
-    ret = fread(&Restart_Iter, sizeof(int), 1, fhw);
-    if (ret != 1) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
-
-    /*--- Read the metadata. ---*/
-
-    ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
-    if (ret != 8) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
-    }
-
-    /*--- Close the file. ---*/
-
-    fclose(fhw);
-
-#else
-
-    /*--- Parallel binary input using MPI I/O. ---*/
-
-    MPI_File fhw;
-    SU2_MPI::Status status;
-    MPI_Datatype etype, filetype;
-    MPI_Offset disp;
-    unsigned long iPoint_Global, iChar;
-    string field_buf;
-
-    int ierr;
-    
-    /*--- All ranks open the file using MPI. ---*/
-
-    ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
-
-    /*--- Error check opening the file. ---*/
-
-    if (ierr) {
-      SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
-    }
-
-    /*--- First, read the number of variables and points (i.e., cols and rows),
-     which we will need in order to read the file later. Also, read the
-     variable string names here. Only the master rank reads the header. ---*/
-    
-    if (rank == MASTER_NODE)
-      MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
-
-    /*--- Broadcast the number of variables to all procs and store clearly. ---*/
-
-    SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-
-    /*--- Check that this is an SU2 binary file. SU2 binary files
-     have the hex representation of "SU2" as the first int in the file. ---*/
-
-    if (Restart_Vars[0] != 535532) {
-      
-      SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                     string("SU2 reads/writes binary restart files by default.\n") + 
-                     string("Note that backward compatibility for ASCII restart files is\n") + 
-                     string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-    }
-
-    /*--- Store the number of fields for simplicity. ---*/
-
-    nFields = Restart_Vars[1];
-
-    /*--- Read the variable names from the file. Note that we are adopting a
-     fixed length of 33 for the string length to match with CGNS. This is
-     needed for when we read the strings later. ---*/
-
-    char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
-    if (rank == MASTER_NODE) {
-      disp = nRestart_Vars*sizeof(int);
-      MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
-                       MPI_CHAR, MPI_STATUS_IGNORE);
-    }
-
-    /*--- Broadcast the string names of the variables. ---*/
-
-    SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
-                   MASTER_NODE, MPI_COMM_WORLD);
-
-    /*--- Now parse the string names and load into the config class in case
-     we need them for writing visualization files (SU2_SOL). ---*/
-
-    config->fields.push_back("Point_ID");
-    for (iVar = 0; iVar < nFields; iVar++) {
-      index = iVar*CGNS_STRING_SIZE;
-      field_buf.append("\"");
-      for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
-        str_buf[iChar] = mpi_str_buf[index + iChar];
-      }
-      field_buf.append(str_buf);
-      field_buf.append("\"");
-      config->fields.push_back(field_buf.c_str());
-      field_buf.clear();
-    }
-
-    /*--- Free string buffer memory. ---*/
-
-    delete [] mpi_str_buf;
-
-    /*--- We're writing only su2doubles in the data portion of the file. ---*/
-
-    etype = MPI_DOUBLE;
-
-    /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-     along with the string names of the variables. ---*/
-
-    disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
-
-    /*--- Define a derived datatype for this rank's set of non-contiguous data
-     that will be placed in the restart. Here, we are collecting each one of the
-     points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
-
-    int *blocklen = new int[GetnPointDomain()];
-    int *displace = new int[GetnPointDomain()];
-
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      if (GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-        blocklen[counter] = nFields;
-        displace[counter] = iPoint_Global*nFields;
-        counter++;
-      }
-    }
-    MPI_Type_indexed(GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-    MPI_Type_commit(&filetype);
-
-    /*--- Set the view for the MPI file write, i.e., describe the location in
-     the file that this rank "sees" for writing its piece of the restart file. ---*/
-
-    MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
-
-    /*--- For now, create a temp 1D buffer to read the data from file. ---*/
-
-    Restart_Data = new passivedouble[nFields*GetnPointDomain()];
-
-    /*--- Collective call for all ranks to read from their view simultaneously. ---*/
-    
-    MPI_File_read_all(fhw, Restart_Data, nFields*GetnPointDomain(), MPI_DOUBLE, &status);
-
-    /*--- Free the derived datatype. ---*/
-
-    MPI_Type_free(&filetype);
-
-    /*--- Reset the file view before writing the metadata. ---*/
-
-    MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
-
-    /*--- Access the metadata. ---*/
-
-    if (rank == MASTER_NODE) {
-
-      /*--- External iteration. ---*/
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble));
-      MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
-
-      /*--- Additional doubles for AoA, AoS, etc. ---*/
-
-      disp = (nRestart_Vars*sizeof(int) + nFields*CGNS_STRING_SIZE*sizeof(char) +
-              nFields*Restart_Vars[2]*sizeof(passivedouble) + 1*sizeof(int));
-      MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+  }
+  else if (Kind_Solver == DISC_ADJ_HEAT) {
+    skipVar += 1;
+  }
+  else {
+    cout << "WARNING: Reading in sensitivities not defined for specified solver!" << endl;
+  }
 
+  /*--- Read all lines in the restart file ---*/
+  long iPoint_Local; unsigned long iPoint_Global = 0; string text_line;
+  
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Sensitivity[iPoint*nDim+iDim] = 0.0;
     }
+  }
 
-    /*--- Communicate metadata. ---*/
-
-    SU2_MPI::Bcast(&Restart_Iter, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-
-    /*--- Copy to a su2double structure (because of the SU2_MPI::Bcast
-              doesn't work with passive data)---*/
-
-    for (unsigned short iVar = 0; iVar < 8; iVar++)
-      Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
+  iPoint_Global = 0;
 
-    SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  filename = config->GetSolution_AdjFileName();
 
-    /*--- All ranks close the file after writing. ---*/
-    
-    MPI_File_close(&fhw);
-    
-    delete [] blocklen;
-    delete [] displace;
-    
-#endif
+  filename = config->GetObjFunc_Extension(filename);
 
-    /*--- Load the data from the binary restart. ---*/
+  if (config->GetUnsteady_Simulation()) {
+    filename = config->GetUnsteady_FileName(filename, nExtIter-1);
+  }
 
-    counter = 0;
-    for (iPoint_Global = 0; iPoint_Global < GetGlobal_nPointDomain(); iPoint_Global++ ) {
+	if (config->GetnZone() > 1){
+		filename = config->GetMultizone_FileName(filename, config->GetiZone());
+	}
 
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+  if (config->GetRead_Binary_Restart()) {
 
-      iPoint_Local = GetGlobal_to_Local_Point(iPoint_Global);
+    /*--- Each rank reads only the sensitivity fields at the points it owns,
+     located by name in the restart (by position for restarts that do not
+     name them). ---*/
 
-      if (iPoint_Local > -1) {
+    vector<unsigned long> Point_Read(nPointDomain);
+    vector<passivedouble> Sens_Data;
 
-        /*--- We need to store this point's data, so jump to the correct
-         offset in the buffer of data from the restart file and load it. ---*/
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) Point_Read[iPoint] = iPoint;
 
-        index = counter*nFields + skipVar;
-        for (iDim = 0; iDim < nDim; iDim++) Sensitivity[iPoint_Local*nDim+iDim] = Restart_Data[index+iDim];
+    AoASens = Read_Binary_Sensitivity(config, filename, "Sensitivity_x", nDim,
+                                      skipVar, Point_Read, Sens_Data);
 
-        /*--- Increment the overall counter for how many points have been loaded. ---*/
-        counter++;
-      }
-    }
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Sensitivity[iPoint*nDim+iDim] = Sens_Data[iPoint*nDim+iDim];
 
     /*--- Lastly, load the AoA sensitivity from the binary metadata. ---*/
 
-    config->SetAoA_Sens(Restart_Meta[4]);
+    config->SetAoA_Sens(AoASens);
 
   } else {
 
@@ -18978,6 +20630,201 @@ void CPhysicalGeometry::SetSensitivity(CConfig *config) {
   
 }
 
+su2double CPhysicalGeometry::Read_Binary_Sensitivity(CConfig *config, string val_filename,
+                                                     string val_field, unsigned short val_nField,
+                                                     unsigned short val_default,
+                                                     const vector<unsigned long> &val_point,
+                                                     vector<passivedouble> &val_data) {
+  
+  char str_buf[CGNS_STRING_SIZE], fname[100];
+  strcpy(fname, val_filename.c_str());
+  int nRestart_Vars = 5, nFields, Restart_Vars[5];
+  passivedouble Restart_Meta_Passive[8] = {0.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0};
+  su2double AoASens;
+  unsigned long iRead, nRead = val_point.size(), iPoint_Global, nPoint_File;
+  unsigned short iField, First_Field;
+  
+  /*--- Visit the points in the order of their global index, such that the
+   file is accessed monotonically, and remember where each one goes. ---*/
+  
+  vector<pair<unsigned long, unsigned long> > Global_Order(nRead);
+  for (iRead = 0; iRead < nRead; iRead++)
+    Global_Order[iRead] = make_pair(node[val_point[iRead]]->GetGlobalIndex(), iRead);
+  sort(Global_Order.begin(), Global_Order.end());
+  
+  vector<passivedouble> Read_Data(max(nRead*val_nField, (unsigned long)1));
+  val_data.assign(nRead*val_nField, 0.0);
+  
+#ifndef HAVE_MPI
+  
+  /*--- Serial binary input. ---*/
+  
+  FILE *fhw;
+  fhw = fopen(fname,"rb");
+  size_t ret;
+  
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+  
+  ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+  if (ret != (unsigned long)nRestart_Vars) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+  
+#else
+  
+  /*--- Parallel binary input using MPI I/O. ---*/
+  
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype filetype;
+  MPI_Offset disp;
+  int ierr;
+  
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+  
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+  
+  /*--- Only the master rank reads the header. ---*/
+  
+  if (rank == MASTER_NODE)
+    MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
+  
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  
+#endif
+  
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
+  
+  if (Restart_Vars[0] != 535532) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                   string("The sensitivities are read from full (not compact) binary restart files,\n") +
+                   string("use READ_BINARY_RESTART= NO for ASCII restart files."), CURRENT_FUNCTION);
+  }
+  
+  nFields = Restart_Vars[1];
+  nPoint_File = Restart_Vars[2];
+  
+  /*--- Read the variable names, with the fixed length of 33 of CGNS. ---*/
+  
+  char *field_buf = new char[nFields*CGNS_STRING_SIZE];
+  
+#ifndef HAVE_MPI
+  ret = fread(field_buf, sizeof(char), nFields*CGNS_STRING_SIZE, fhw);
+  if (ret != (unsigned long)nFields*CGNS_STRING_SIZE) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+#else
+  if (rank == MASTER_NODE) {
+    disp = nRestart_Vars*sizeof(int);
+    MPI_File_read_at(fhw, disp, field_buf, nFields*CGNS_STRING_SIZE,
+                     MPI_CHAR, MPI_STATUS_IGNORE);
+  }
+  SU2_MPI::Bcast(field_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
+                 MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Locate the first of the consecutive fields to be read. ---*/
+  
+  First_Field = val_default;
+  for (iField = 0; iField < nFields; iField++) {
+    strncpy(str_buf, &field_buf[iField*CGNS_STRING_SIZE], CGNS_STRING_SIZE);
+    str_buf[CGNS_STRING_SIZE-1] = '\0';
+    if (val_field == str_buf) { First_Field = iField; break; }
+  }
+  
+  delete [] field_buf;
+  
+  if (First_Field + val_nField > nFields) {
+    SU2_MPI::Error(string("The field ") + val_field + string(" was not found in ") + string(fname),
+                   CURRENT_FUNCTION);
+  }
+  
+  /*--- The data portion of the file starts after the 5 ints describing the
+   restart and the string names of the variables. ---*/
+  
+  unsigned long Header_Size = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  
+#ifndef HAVE_MPI
+  
+  /*--- Seek forward to the fields of each point. ---*/
+  
+  for (iRead = 0; iRead < nRead; iRead++) {
+    iPoint_Global = Global_Order[iRead].first;
+    fseek(fhw, Header_Size + (iPoint_Global*nFields + First_Field)*sizeof(passivedouble), SEEK_SET);
+    ret = fread(&Read_Data[iRead*val_nField], sizeof(passivedouble), val_nField, fhw);
+    if (ret != (unsigned long)val_nField) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+  }
+  
+  /*--- The metadata follows the data, the AoA sensitivity is its 5th double. ---*/
+  
+  fseek(fhw, Header_Size + nFields*nPoint_File*sizeof(passivedouble) + sizeof(int), SEEK_SET);
+  ret = fread(Restart_Meta_Passive, sizeof(passivedouble), 8, fhw);
+  if (ret != 8) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+  
+  fclose(fhw);
+  
+  AoASens = Restart_Meta_Passive[4];
+  
+#else
+  
+  /*--- Describe the blocks of this rank with byte displacements, which do
+   not overflow for files of more than 2^31 values, and read them with one
+   collective call. ---*/
+  
+  int *blocklen = new int[max(nRead, (unsigned long)1)];
+  MPI_Aint *displace = new MPI_Aint[max(nRead, (unsigned long)1)];
+  
+  for (iRead = 0; iRead < nRead; iRead++) {
+    iPoint_Global = Global_Order[iRead].first;
+    blocklen[iRead] = val_nField;
+    displace[iRead] = (MPI_Aint)(iPoint_Global*nFields + First_Field)*sizeof(passivedouble);
+  }
+  
+  MPI_Type_create_hindexed((int)nRead, blocklen, displace, MPI_DOUBLE, &filetype);
+  MPI_Type_commit(&filetype);
+  
+  MPI_File_set_view(fhw, Header_Size, MPI_DOUBLE, filetype, (char*)"native", MPI_INFO_NULL);
+  MPI_File_read_all(fhw, Read_Data.data(), (int)(nRead*val_nField), MPI_DOUBLE, &status);
+  
+  MPI_Type_free(&filetype);
+  delete [] blocklen;
+  delete [] displace;
+  
+  /*--- Reset the file view and read the metadata on the master rank. ---*/
+  
+  MPI_File_set_view(fhw, 0, MPI_BYTE, MPI_BYTE, (char*)"native", MPI_INFO_NULL);
+  
+  if (rank == MASTER_NODE) {
+    disp = Header_Size + nFields*nPoint_File*sizeof(passivedouble) + sizeof(int);
+    MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+  }
+  
+  MPI_File_close(&fhw);
+  
+  AoASens = Restart_Meta_Passive[4];
+  SU2_MPI::Bcast(&AoASens, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  
+#endif
+  
+  /*--- Return the values in the order of the requested points. ---*/
+  
+  for (iRead = 0; iRead < nRead; iRead++)
+    for (iField = 0; iField < val_nField; iField++)
+      val_data[Global_Order[iRead].second*val_nField+iField] = Read_Data[iRead*val_nField+iField];
+  
+  return AoASens;
+  
+}
+
 void CPhysicalGeometry::ReadUnorderedSensitivity(CConfig *config) {
   
   /*--- This routine makes SU2_DOT more interoperable with other
@@ -20634,6 +22481,14 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
 
   unsigned short *copy_marker = new unsigned short [nMarker_Max];
   
+  /*--- With the interface agglomeration, the SEND_RECEIVE markers are not
+   considered as boundaries and their points are agglomerated from the queue
+   together with the interior points. The halos are agglomerated afterwards
+   as their donors, hence the partitions stay consistent. ---*/
+  
+  bool interface_agglomeration = config->GetMG_Interface_Agglomeration();
+  vector<unsigned long> Neighbor_Stamp;
+  
 #ifdef HAVE_MPI
   int send_to, receive_from;
   SU2_MPI::Status status;
@@ -20689,6 +22544,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
   
   for (iMarker = 0; iMarker < fine_grid->GetnMarker(); iMarker++) {
     
+    if (interface_agglomeration && (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE)) continue;
+    
     for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
       iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
       
@@ -20714,7 +22571,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
          that are in that point ---*/
         
         for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-          if (fine_grid->node[iPoint]->GetVertex(jMarker) != -1) {
+          if ((fine_grid->node[iPoint]->GetVertex(jMarker) != -1) &&
+              !(interface_agglomeration && (config->GetMarker_All_KindBC(jMarker) == SEND_RECEIVE))) {
             copy_marker[counter] = jMarker;
             counter++;
           }
@@ -20814,7 +22672,8 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
     for (iVertex = 0; iVertex < fine_grid->GetnVertex(iMarker); iVertex++) {
       iPoint = fine_grid->vertex[iMarker][iVertex]->GetNode();
       if ((fine_grid->node[iPoint]->GetAgglomerate() == false) &&
-          (fine_grid->node[iPoint]->GetDomain())) {
+          (fine_grid->node[iPoint]->GetDomain()) &&
+          !(interface_agglomeration && (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE))) {
         fine_grid->node[iPoint]->SetParent_CV(Index_CoarseCV);
         node[Index_CoarseCV]->SetChildren_CV(0, iPoint);
         node[Index_CoarseCV]->SetnChildren_CV(1);
@@ -20984,7 +22843,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
   unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iCoarsePoint_Complete;
   unsigned short iChildren;
   
-  /*--- Find the point surrounding a point ---*/
+  /*--- Find the point surrounding a point. The stamps avoid searching the
+   list of neighbors of the coarse point for every pair of fine points. ---*/
+  
+  Neighbor_Stamp.assign(fine_grid->GetnPoint(), fine_grid->GetnPoint());
   
   for (iCoarsePoint = 0; iCoarsePoint < nPointDomain; iCoarsePoint ++) {
     for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
@@ -20992,7 +22854,10 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        if ((iParent != iCoarsePoint) && (Neighbor_Stamp[iParent] != iCoarsePoint)) {
+          node[iCoarsePoint]->SetPoint(iParent);
+          Neighbor_Stamp[iParent] = iCoarsePoint;
+        }
       }
     }
   }
@@ -21144,14 +23009,11 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry ****geometry, CConfig **config_
         
         Parent_Remote[iVertex] = Buffer_Receive_Parent[iVertex];
         
-        /*--- We use the same sorting as in the donor domain ---*/
+        /*--- We use the same sorting as in the donor domain (the list of
+         parents is sorted, hence it is searched by bisection) ---*/
         
-        for (jVertex = 0; jVertex < Aux_Parent.size(); jVertex++) {
-          if (Parent_Remote[iVertex] == Aux_Parent[jVertex]) {
-            Parent_Local[iVertex] = jVertex + Index_CoarseCV;
-            break;
-          }
-        }
+        jVertex = lower_bound(Aux_Parent.begin(), Aux_Parent.end(), Parent_Remote[iVertex]) - Aux_Parent.begin();
+        Parent_Local[iVertex] = jVertex + Index_CoarseCV;
         
         Children_Remote[iVertex] = Buffer_Receive_Children[iVertex];
         Children_Local[iVertex] = fine_grid->vertex[MarkerR][iVertex]->GetNode();
@@ -21262,6 +23124,7 @@ CMultiGridGeometry::~CMultiGridGeometry(void) {
 bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short marker_seed, CGeometry *fine_grid, CConfig *config) {
   
   bool agglomerate_CV = false;
+  bool interface_agglomeration = config->GetMG_Interface_Agglomeration();
   unsigned short counter, jMarker;
   
   unsigned short nMarker_Max = config->GetnMarker_Max();
@@ -21283,11 +23146,16 @@ bool CMultiGridGeometry::SetBoundAgglomeration(unsigned long CVPoint, short mark
       
       counter = 0;
       for (jMarker = 0; jMarker < fine_grid->GetnMarker(); jMarker ++)
-        if (fine_grid->node[CVPoint]->GetVertex(jMarker) != -1) {
+        if ((fine_grid->node[CVPoint]->GetVertex(jMarker) != -1) &&
+            !(interface_agglomeration && (config->GetMarker_All_KindBC(jMarker) == SEND_RECEIVE))) {
           copy_marker[counter] = jMarker;
           counter++;
         }
       
+      /*--- Only on partition interfaces, it is agglomerated as an interior point ---*/
+      
+      if (counter == 0) agglomerate_CV = true;
+      
       /*--- The basic condition is that the aglomerated vertex must have the same physical marker,
        but eventually a send-receive condition ---*/
       
@@ -21515,7 +23383,10 @@ void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
   unsigned long iFinePoint, iFinePoint_Neighbor, iParent, iCoarsePoint;
   unsigned short iChildren, iNode;
   
-  /*--- Set the point surrounding a point ---*/
+  /*--- Set the point surrounding a point, the stamps avoid searching the
+   list of neighbors of the coarse point for every pair of fine points ---*/
+  
+  vector<unsigned long> Neighbor_Stamp(nPoint, nPoint);
   
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     for (iChildren = 0; iChildren <  node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
@@ -21523,7 +23394,10 @@ void CMultiGridGeometry::SetPoint_Connectivity(CGeometry *fine_grid) {
       for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
         iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
-        if (iParent != iCoarsePoint) node[iCoarsePoint]->SetPoint(iParent);
+        if ((iParent != iCoarsePoint) && (Neighbor_Stamp[iParent] != iCoarsePoint)) {
+          node[iCoarsePoint]->SetPoint(iParent);
+          Neighbor_Stamp[iParent] = iCoarsePoint;
+        }
       }
     }
   }
@@ -21679,6 +23553,15 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
   su2double *Normal, Coarse_Volume, Area, *NormalFace = NULL;
   Normal = new su2double [nDim];
   
+  /*--- The least-squares weights, edge factors, vertex arrays and multigrid transfer weights are recomputed with the new coordinates ---*/
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  Vertex_Arrays_Ready = false;
+  MG_Transfer_Ready = false;
+  
+  /*--- All the control volumes are recomputed ---*/
+  DualGrid_Affected.clear();
+  
   /*--- Compute the area of the coarse volume ---*/
   for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
     node[iCoarsePoint]->SetVolume(0.0);
@@ -21696,7 +23579,16 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
       edge[iEdge]->SetZeroValues();
   }
   
-  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
+  /*--- The edges of each coarse point are looked up in a table indexed by
+   the neighbor, instead of searching the neighbors for every fine face. ---*/
+  
+  vector<long> Coarse_Edge(nPoint, -1);
+  
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    
+    for (iNode = 0; iNode < node[iCoarsePoint]->GetnPoint(); iNode ++)
+      Coarse_Edge[node[iCoarsePoint]->GetPoint(iNode)] = node[iCoarsePoint]->GetEdge(iNode);
+    
     for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
       iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
       
@@ -21705,12 +23597,13 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
         iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
         if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint)) {
           
-          FineEdge = fine_grid->FindEdge(iFinePoint, iFinePoint_Neighbor);
+          FineEdge = fine_grid->node[iFinePoint]->GetEdge(iNode);
           
           change_face_orientation = false;
           if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
           
-          CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          CoarseEdge = Coarse_Edge[iParent];
+          if (CoarseEdge == -1) CoarseEdge = FindEdge(iParent, iCoarsePoint);
           
           fine_grid->edge[FineEdge]->GetNormal(Normal);
           
@@ -21724,6 +23617,11 @@ void CMultiGridGeometry::SetControlVolume(CConfig *config, CGeometry *fine_grid,
         }
       }
     }
+    
+    for (iNode = 0; iNode < node[iCoarsePoint]->GetnPoint(); iNode ++)
+      Coarse_Edge[node[iCoarsePoint]->GetPoint(iNode)] = -1;
+    
+  }
   delete[] Normal;
   
   /*--- Check if there is a normal with null area ---*/
@@ -21744,6 +23642,10 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
   
   Normal = new su2double [nDim];
   
+  /*--- The vertex arrays are copied again with the new normals ---*/
+  
+  Vertex_Arrays_Ready = false;
+  
   if (action != ALLOCATE) {
     for (iMarker = 0; iMarker < nMarker; iMarker++)
       for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++)
@@ -21776,6 +23678,134 @@ void CMultiGridGeometry::SetBoundControlVolume(CConfig *config, CGeometry *fine_
   
 }
 
+void CMultiGridGeometry::SetControlVolume_Moved(CConfig *config, CGeometry *fine_grid) {
+  
+  unsigned long iFinePoint, iFinePoint_Neighbor, iCoarsePoint, iEdge, iParent, iVertex, FineVertex;
+  long FineEdge, CoarseEdge;
+  unsigned short iChildren, iNode, iDim, iMarker;
+  bool change_face_orientation;
+  su2double Normal[3], Coordinates[3], *Coordinates_Fine, Coarse_Volume, Area, *NormalFace = NULL;
+  
+  /*--- The least-squares weights, edge factors, vertex arrays and multigrid transfer weights are recomputed with the new coordinates ---*/
+  LS_Weights_Ready = false;
+  Edge_Geometry_Ready = false;
+  Vertex_Arrays_Ready = false;
+  MG_Transfer_Ready = false;
+  
+  /*--- A coarse control volume is recomputed if any of its children was ---*/
+  
+  DualGrid_Affected.assign(nPoint, false);
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++)
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++)
+      if (fine_grid->GetDualGrid_Affected(node[iCoarsePoint]->GetChildren_CV(iChildren)))
+        DualGrid_Affected[iCoarsePoint] = true;
+  
+  /*--- Compute the area of the coarse volume ---*/
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    if (!DualGrid_Affected[iCoarsePoint]) continue;
+    Coarse_Volume = 0.0;
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      Coarse_Volume += fine_grid->node[iFinePoint]->GetVolume();
+    }
+    node[iCoarsePoint]->SetVolume(Coarse_Volume);
+  }
+  
+  /*--- Only the fine edges between two recomputed points changed, which are
+   collected by the coarse edges between two recomputed control volumes ---*/
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++)
+    if (DualGrid_Affected[edge[iEdge]->GetNode(0)] && DualGrid_Affected[edge[iEdge]->GetNode(1)])
+      edge[iEdge]->SetZeroValues();
+  
+  vector<long> Coarse_Edge(nPoint, -1);
+  
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    if (!DualGrid_Affected[iCoarsePoint]) continue;
+    
+    for (iNode = 0; iNode < node[iCoarsePoint]->GetnPoint(); iNode ++)
+      Coarse_Edge[node[iCoarsePoint]->GetPoint(iNode)] = node[iCoarsePoint]->GetEdge(iNode);
+    
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      
+      for (iNode = 0; iNode < fine_grid->node[iFinePoint]->GetnPoint(); iNode ++) {
+        iFinePoint_Neighbor = fine_grid->node[iFinePoint]->GetPoint(iNode);
+        iParent = fine_grid->node[iFinePoint_Neighbor]->GetParent_CV();
+        if ((iParent != iCoarsePoint) && (iParent < iCoarsePoint) && DualGrid_Affected[iParent]) {
+          
+          FineEdge = fine_grid->node[iFinePoint]->GetEdge(iNode);
+          
+          change_face_orientation = false;
+          if (iFinePoint < iFinePoint_Neighbor) change_face_orientation = true;
+          
+          CoarseEdge = Coarse_Edge[iParent];
+          if (CoarseEdge == -1) CoarseEdge = FindEdge(iParent, iCoarsePoint);
+          
+          fine_grid->edge[FineEdge]->GetNormal(Normal);
+          
+          if (change_face_orientation)
+            for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+          edge[CoarseEdge]->AddNormal(Normal);
+        }
+      }
+    }
+    
+    for (iNode = 0; iNode < node[iCoarsePoint]->GetnPoint(); iNode ++)
+      Coarse_Edge[node[iCoarsePoint]->GetPoint(iNode)] = -1;
+    
+  }
+  
+  /*--- Check if there is a normal with null area ---*/
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    if (!DualGrid_Affected[edge[iEdge]->GetNode(0)] || !DualGrid_Affected[edge[iEdge]->GetNode(1)]) continue;
+    NormalFace = edge[iEdge]->GetNormal();
+    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+    Area = sqrt(Area);
+    if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+  }
+  
+  /*--- Boundary vertices of the recomputed control volumes ---*/
+  
+  for (iMarker = 0; iMarker < nMarker; iMarker ++)
+    for (iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+      iCoarsePoint = vertex[iMarker][iVertex]->GetNode();
+      if (!DualGrid_Affected[iCoarsePoint]) continue;
+      vertex[iMarker][iVertex]->SetZeroValues();
+      for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren ++) {
+        iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+        if (fine_grid->node[iFinePoint]->GetVertex(iMarker)!=-1) {
+          FineVertex = fine_grid->node[iFinePoint]->GetVertex(iMarker);
+          fine_grid->vertex[iMarker][FineVertex]->GetNormal(Normal);
+          vertex[iMarker][iVertex]->AddNormal(Normal);
+        }
+      }
+      NormalFace = vertex[iMarker][iVertex]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += NormalFace[iDim]*NormalFace[iDim];
+      Area = sqrt(Area);
+      if (Area == 0.0) for (iDim = 0; iDim < nDim; iDim++) NormalFace[iDim] = EPS*EPS;
+    }
+  
+  /*--- Representative coordinates of the recomputed control volumes ---*/
+  
+  for (iCoarsePoint = 0; iCoarsePoint < nPoint; iCoarsePoint ++) {
+    if (!DualGrid_Affected[iCoarsePoint]) continue;
+    Coarse_Volume = node[iCoarsePoint]->GetVolume();
+    for (iDim = 0; iDim < nDim; iDim++) Coordinates[iDim] = 0.0;
+    for (iChildren = 0; iChildren < node[iCoarsePoint]->GetnChildren_CV(); iChildren++) {
+      iFinePoint = node[iCoarsePoint]->GetChildren_CV(iChildren);
+      Area = fine_grid->node[iFinePoint]->GetVolume();
+      Coordinates_Fine = fine_grid->node[iFinePoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++)
+        Coordinates[iDim] += Coordinates_Fine[iDim]*Area/Coarse_Volume;
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      node[iCoarsePoint]->SetCoord(iDim, Coordinates[iDim]);
+  }
+  
+}
+
 void CMultiGridGeometry::SetCoord(CGeometry *geometry) {
   unsigned long Point_Fine, Point_Coarse;
   unsigned short iChildren, iDim;
@@ -21988,42 +24018,10 @@ void CMultiGridGeometry::SetTranslationalVelocity(CConfig *config, unsigned shor
 
 void CMultiGridGeometry::SetGridVelocity(CConfig *config, unsigned long iter) {
   
-  /*--- Local variables ---*/
-  
-  su2double *Coord_nP1 = NULL, *Coord_n = NULL, *Coord_nM1 = NULL;
-  su2double TimeStep, GridVel = 0.0;
-  unsigned long Point_Coarse;
-  unsigned short iDim;
+  /*--- Compute the velocity of each node in the coarse mesh ---*/
   
-  /*--- Compute the velocity of each node in the volume mesh ---*/
+  ComputeGridVelocity(config);
   
-  for (Point_Coarse = 0; Point_Coarse < GetnPoint(); Point_Coarse++) {
-    
-    /*--- Coordinates of the current point at n+1, n, & n-1 time levels ---*/
-    
-    Coord_nM1 = node[Point_Coarse]->GetCoord_n1();
-    Coord_n   = node[Point_Coarse]->GetCoord_n();
-    Coord_nP1 = node[Point_Coarse]->GetCoord();
-    
-    /*--- Unsteady time step ---*/
-    
-    TimeStep = config->GetDelta_UnstTimeND();
-    
-    /*--- Compute mesh velocity with 1st or 2nd-order approximation ---*/
-    
-    for (iDim = 0; iDim < nDim; iDim++) {
-      if (config->GetUnsteady_Simulation() == DT_STEPPING_1ST)
-        GridVel = ( Coord_nP1[iDim] - Coord_n[iDim] ) / TimeStep;
-      if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND)
-        GridVel = ( 3.0*Coord_nP1[iDim] - 4.0*Coord_n[iDim]
-                   +  1.0*Coord_nM1[iDim] ) / (2.0*TimeStep);
-      
-      /*--- Store grid velocity for this point ---*/
-      
-      node[Point_Coarse]->SetGridVel(iDim, GridVel);
-      
-    }
-  }
 }
 
 void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfig *config) {
@@ -22031,11 +24029,17 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
   /*--- Local variables ---*/
   unsigned short iDim, iChild;
   unsigned long Point_Coarse, Point_Fine;
-  su2double Area_Parent, Area_Child, Grid_Vel[3], *Grid_Vel_Fine;
+  su2double Area_Parent, Area_Child, *Grid_Vel, *Grid_Vel_Fine;
+  
+  /*--- Both levels read and write the contiguous volume and grid velocity arrays ---*/
+  PreprocessGridMotion_Arrays(config);
+  fine_mesh->PreprocessGridMotion_Arrays(config);
+  if (Point_GridVel.empty() || fine_mesh->Point_GridVel.empty()) return;
   
   /*--- Loop over all coarse mesh points ---*/
-  for (Point_Coarse = 0; Point_Coarse < GetnPoint(); Point_Coarse++) {
-    Area_Parent = node[Point_Coarse]->GetVolume();
+  for (Point_Coarse = 0; Point_Coarse < nPoint; Point_Coarse++) {
+    Area_Parent = Point_Volume[Point_Coarse*nVolume_Level];
+    Grid_Vel    = &Point_GridVel[Point_Coarse*nDim];
     
     /*--- Zero out the grid velocity ---*/
     for (iDim = 0; iDim < nDim; iDim++)
@@ -22045,15 +24049,11 @@ void CMultiGridGeometry::SetRestricted_GridVelocity(CGeometry *fine_mesh, CConfi
      a grid velocity based on the values in the child CVs (fine mesh). ---*/
     for (iChild = 0; iChild < node[Point_Coarse]->GetnChildren_CV(); iChild++) {
       Point_Fine    = node[Point_Coarse]->GetChildren_CV(iChild);
-      Area_Child    = fine_mesh->node[Point_Fine]->GetVolume();
-      Grid_Vel_Fine = fine_mesh->node[Point_Fine]->GetGridVel();
+      Area_Child    = fine_mesh->Point_Volume[Point_Fine*fine_mesh->nVolume_Level];
+      Grid_Vel_Fine = &fine_mesh->Point_GridVel[Point_Fine*nDim];
       for (iDim = 0; iDim < nDim; iDim++)
         Grid_Vel[iDim] += Grid_Vel_Fine[iDim]*Area_Child/Area_Parent;
     }
-    
-    /*--- Set the grid velocity for this coarse node. ---*/
-    for (iDim = 0; iDim < nDim; iDim++)
-      node[Point_Coarse]->SetGridVel(iDim, Grid_Vel[iDim]);
   }
 }
 
@@ -22063,6 +24063,8 @@ void CMultiGridGeometry::FindNormal_Neighbor(CConfig *config) {
   unsigned short iMarker, iDim;
   unsigned long iPoint, iVertex;
   
+  Vertex_Arrays_Ready = false;
+  
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     
     if (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE &&
@@ -1284,7 +1284,7 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel_FEM(CConfig        *config,
 
     /* Send the buffer just filled back to the requesting rank.
        Use a non-blocking send to avoid deadlock. */
-    SU2_MPI::Isend(coorReturnBuf[i].data(), coorReturnBuf[i].size(), MPI_DOUBLE,
+    SU2_MPI::Isend(coorReturnBuf[i].data(), coorReturnBuf[i].size(), MPI_SU2DOUBLE,
                    source, source+1, MPI_COMM_WORLD, &returnReqs[i]);
   }
 
@@ -1300,7 +1300,7 @@ void CPhysicalGeometry::Read_CGNS_Format_Parallel_FEM(CConfig        *config,
     vector<su2double> coorRecvBuf(nDim*nodeBuf[source].size());
 
     /* Receive the message using a blocking receive. */
-    SU2_MPI::Recv(coorRecvBuf.data(), coorRecvBuf.size(), MPI_DOUBLE,
+    SU2_MPI::Recv(coorRecvBuf.data(), coorRecvBuf.size(), MPI_SU2DOUBLE,
                   source, rank+1, MPI_COMM_WORLD, &status);
 
     /*--- Make a distinction between 2D and 3D to store the data of the nodes.
@@ -2989,9 +2989,9 @@ void CPhysicalGeometry::DeterminePeriodicFacesFEMGrid(CConfig                *co
           recvCounts[i] *= 13; displs[i] *= 13;
         }
 
-        SU2_MPI::Allgatherv(doubleLocBuf.data(), doubleLocBuf.size(), MPI_DOUBLE,
+        SU2_MPI::Allgatherv(doubleLocBuf.data(), doubleLocBuf.size(), MPI_SU2DOUBLE,
                             doubleGlobBuf.data(), recvCounts.data(), displs.data(),
-                            MPI_DOUBLE, MPI_COMM_WORLD);
+                            MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
         /*--- Copy the data back into facesDonor, which will contain the
               global information after the copies. ---*/
@@ -3897,8 +3897,8 @@ void CPhysicalGeometry::DetermineDonorElementsWallFunctions(CConfig *config) {
     for(int i=0; i<size; ++i) {recvCounts[i] *= nDim; displs[i] *= nDim;}
     vector<su2double> bufCoorExGlobalSearch(nDim*nGlobalSearchPoints);
     SU2_MPI::Allgatherv(coorExGlobalSearch.data(), nDim*nLocalSearchPoints,
-                        MPI_DOUBLE, bufCoorExGlobalSearch.data(),
-                        recvCounts.data(), displs.data(), MPI_DOUBLE,
+                        MPI_SU2DOUBLE, bufCoorExGlobalSearch.data(),
+                        recvCounts.data(), displs.data(), MPI_SU2DOUBLE,
                         MPI_COMM_WORLD);
 
     /* Buffers to store the return information. */
@@ -4259,7 +4259,7 @@ void CPhysicalGeometry::DetermineTimeLevelElements(
        Only needed for a parallel implementation. */
 #ifdef HAVE_MPI
     su2double locVal = minDeltaT;
-    SU2_MPI::Allreduce(&locVal, &minDeltaT, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&locVal, &minDeltaT, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 #endif
 
     /* Initial estimate of the time level of the owned elements. */
@@ -4959,7 +4959,7 @@ void CPhysicalGeometry::ComputeFEMGraphWeights(
 
 #ifdef HAVE_MPI
   su2double locminvwgt = minvwgt;
-  SU2_MPI::Allreduce(&locminvwgt, &minvwgt, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&locminvwgt, &minvwgt, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 #endif
 
   /*--- Scale the workload of the elements, the 1st vertex weight, with the
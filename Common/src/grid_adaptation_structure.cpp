@@ -3593,7 +3593,7 @@ void CGridAdaptation::SetRestart_LinSolution(CConfig *config, CPhysicalGeometry
 void CGridAdaptation::SetSensorElem(CGeometry *geometry, CConfig *config, unsigned long max_elem) {
 	su2double Max_Sensor, threshold;
 	su2double *Sensor = new su2double[geometry->GetnElem()];
-	unsigned long ip_0, ip_1, ip_2, ip_3, iElem, nElem_real;
+	unsigned long ip_0, ip_1, ip_2, ip_3, iElem, nElem_real, iBin, iPos;
   
 	if (max_elem > geometry->GetnElem()) {
 		cout << "WARNING: Attempted to adapt " << max_elem << " cells," << endl;
@@ -3622,19 +3622,46 @@ void CGridAdaptation::SetSensorElem(CGeometry *geometry, CConfig *config, unsign
 		Sensor[iElem] = Sensor[iElem]/Max_Sensor;
 	}
 	
-	/*--- Selection of the elements to be adapted ---*/
+	/*--- Selection of the elements to be adapted. The threshold is lowered in
+	 steps of 0.001, each element is binned once with the first threshold it
+	 passes, so that every step only visits its own elements instead of the
+	 whole grid. Once the target is reached (stop below), the remaining steps
+	 fall back to the scan of all the elements, as only a few are left. ---*/
+	vector<su2double> Threshold;
+	for (threshold = 0.999; threshold >= 0; threshold = threshold - 0.001)
+		Threshold.push_back(threshold);
+	
+	vector<unsigned long> Bin_Offset(Threshold.size()+1, 0), Bin_Elem;
+	vector<unsigned long> Elem_Bin(geometry->GetnElem());
+	for (iElem = 0; iElem < geometry->GetnElem(); iElem ++) {
+		Elem_Bin[iElem] = lower_bound(Threshold.begin(), Threshold.end(), Sensor[iElem],
+		                              greater<su2double>()) - Threshold.begin();
+		if (Elem_Bin[iElem] < Threshold.size()) Bin_Offset[Elem_Bin[iElem]+1]++;
+	}
+	for (iBin = 0; iBin < Threshold.size(); iBin++)
+		Bin_Offset[iBin+1] += Bin_Offset[iBin];
+	Bin_Elem.resize(Bin_Offset[Threshold.size()]);
+	vector<unsigned long> Bin_Pos(Bin_Offset.begin(), Bin_Offset.end()-1);
+	for (iElem = 0; iElem < geometry->GetnElem(); iElem ++)
+		if (Elem_Bin[iElem] < Threshold.size()) Bin_Elem[Bin_Pos[Elem_Bin[iElem]]++] = iElem;
+	
 	threshold = 0.999;
 	nElem_real = 0;
+	iBin = 0;
+	bool stop = false;
 	while (nElem_real <= max_elem && threshold >= 0) {
-		for (iElem = 0; iElem < geometry->GetnElem(); iElem ++)
+		for (iPos = (stop ? 0 : Bin_Offset[iBin]); iPos < (stop ? geometry->GetnElem() : Bin_Offset[iBin+1]); iPos ++) {
+			iElem = (stop ? iPos : Bin_Elem[iPos]);
 			if ( Sensor[iElem] >= threshold && !geometry->elem[iElem]->GetDivide() ) {
 				if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE) nElem_real = nElem_real + 3;
 				if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nElem_real = nElem_real + 3;
 				if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON) nElem_real = nElem_real + 7;
 				geometry->elem[iElem]->SetDivide(true);
-				if (nElem_real >= max_elem) break;
-			}	
+				if (nElem_real >= max_elem) { stop = true; break; }
+			}
+		}
 		threshold = threshold - 0.001;
+		iBin++;
 	}
 
 	if (threshold < 0) {
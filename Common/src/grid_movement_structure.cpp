@@ -37,6 +37,7 @@
 
 #include "../include/grid_movement_structure.hpp"
 #include "../include/adt_structure.hpp"
+#include "../include/interpolation_structure.hpp"
 #include <list>
 
 using namespace std;
@@ -47,7 +48,17 @@ CGridMovement::~CGridMovement(void) { }
 
 CVolumetricMovement::CVolumetricMovement(void) : CGridMovement() {
 
+  StiffMatrix_Ready = false;
+  Precond_Ready     = false;
+  Rebuild_Iter      = 0;
 
+  taskThreadPool = NULL;
+  taskGeometry   = NULL;
+  taskConfig     = NULL;
+
+  Rigid_Pending = false;
+  for (unsigned short iDim = 0; iDim < 9; iDim++) Rigid_Matrix[iDim] = (iDim%4 == 0) ? 1.0 : 0.0;
+  for (unsigned short iDim = 0; iDim < 3; iDim++) Rigid_Transl[iDim] = 0.0;
 
 }
 
@@ -66,15 +77,64 @@ CVolumetricMovement::CVolumetricMovement(CGeometry *geometry, CConfig *config) :
 
 	  nIterMesh = 0;
 
+	  StiffMatrix_Ready = false;
+	  Precond_Ready     = false;
+	  Rebuild_Iter      = 0;
+
 	  /*--- Initialize matrix, solution, and r.h.s. structures for the linear solver. ---*/
 
 	  LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
 	  LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 	  StiffMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
+  /*--- With more than one thread the elements are colored, such that the elements
+   of one color can be assembled concurrently. The same threads share the products
+   and preconditioners of the linear solver. ---*/
+
+  unsigned short iColor, nThreads = config->GetnThreads_Deform();
+  unsigned long iChunk, nChunksColor, nElemColor, elemBeg;
+
+  taskThreadPool = NULL;
+  taskGeometry   = NULL;
+  taskConfig     = NULL;
+
+  Rigid_Pending = false;
+  for (unsigned short iDim = 0; iDim < 9; iDim++) Rigid_Matrix[iDim] = (iDim%4 == 0) ? 1.0 : 0.0;
+  for (unsigned short iDim = 0; iDim < 3; iDim++) Rigid_Transl[iDim] = 0.0;
+
+  if (nThreads > 1) {
+
+    geometry->SetElemColoring();
+
+    taskThreadPool = new CTaskThreadPool(nThreads, ProcessTaskChunk_Deform, this);
+    nThreads = taskThreadPool->GetnThreads();
+
+    if (rank == MASTER_NODE)
+      cout << "Mesh deformation by " << nThreads << " threads, "
+           << geometry->GetnElemColor() << " element colors." << endl;
+
+    const unsigned long nChunks = 4*nThreads;
+
+    ElemColorChunks.resize(geometry->GetnElemColor());
+    for (iColor = 0; iColor < geometry->GetnElemColor(); iColor++) {
+      elemBeg      = geometry->GetElemColor_Begin(iColor);
+      nElemColor   = geometry->GetElemColor_End(iColor) - elemBeg;
+      nChunksColor = max((unsigned long) 1, min(nChunks, nElemColor));
+      ElemColorChunks[iColor].resize(nChunksColor+1);
+      for (iChunk = 0; iChunk <= nChunksColor; iChunk++)
+        ElemColorChunks[iColor][iChunk] = elemBeg + (iChunk*nElemColor)/nChunksColor;
+    }
+
+    StiffMatrix.SetThreads(nThreads);
+  }
+
 }
 
-CVolumetricMovement::~CVolumetricMovement(void) { }
+CVolumetricMovement::~CVolumetricMovement(void) {
+
+  if (taskThreadPool != NULL) delete taskThreadPool;
+
+}
 
 void CVolumetricMovement::UpdateGridCoord(CGeometry *geometry, CConfig *config) {
   
@@ -106,25 +166,91 @@ void CVolumetricMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config) {
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
    dual mesh control volumes in the domain and on the boundaries. ---*/
   
-	geometry->SetCoord_CG();
-	geometry->SetControlVolume(config, UPDATE);
-	geometry->SetBoundControlVolume(config, UPDATE);
+  Rigid_Pending = false;
+  
+  if (config->GetPartial_DualGrid_Update()) {
+    
+    /*--- Only the elements and vertices around the moved points ---*/
+    
+    geometry->SetControlVolume_Moved(config);
+  }
+  else {
+    geometry->SetCoord_CG();
+    geometry->SetControlVolume(config, UPDATE);
+    geometry->SetBoundControlVolume(config, UPDATE);
+  }
   geometry->SetMaxLength(config);
   
 }
 
+void CVolumetricMovement::UpdateDualGrid_Rigid(CGeometry *geometry, CConfig *config,
+                                               const su2double *rotMatrix, const su2double *transl) {
+  
+  unsigned short iDim, jDim, kDim;
+  su2double Matrix[9], Transl[3];
+  bool moved = false;
+  
+  if (config->GetDiscrete_Adjoint()) {
+    UpdateDualGrid(geometry, config);
+    return;
+  }
+  
+  for (iDim = 0; iDim < 3; iDim++) {
+    if (transl[iDim] != 0.0) moved = true;
+    for (jDim = 0; jDim < 3; jDim++)
+      if (rotMatrix[3*iDim+jDim] != ((iDim == jDim) ? 1.0 : 0.0)) moved = true;
+  }
+  
+  /*--- Coming from a full update, the coarse grids match the fine grid before this motion ---*/
+  
+  if (!Rigid_Pending) {
+    for (iDim = 0; iDim < 9; iDim++) Rigid_Matrix[iDim] = (iDim%4 == 0) ? 1.0 : 0.0;
+    for (iDim = 0; iDim < 3; iDim++) Rigid_Transl[iDim] = 0.0;
+    Rigid_Pending = true;
+  }
+  
+  if (!moved) return;
+  
+  geometry->SetRigid_DualGrid(rotMatrix, transl, false);
+  
+  /*--- Accumulate the motion for the coarse grids, R <- R_new*R, t <- R_new*t + t_new ---*/
+  
+  for (iDim = 0; iDim < 3; iDim++) {
+    Transl[iDim] = transl[iDim];
+    for (jDim = 0; jDim < 3; jDim++) {
+      Transl[iDim] += rotMatrix[3*iDim+jDim]*Rigid_Transl[jDim];
+      Matrix[3*iDim+jDim] = 0.0;
+      for (kDim = 0; kDim < 3; kDim++)
+        Matrix[3*iDim+jDim] += rotMatrix[3*iDim+kDim]*Rigid_Matrix[3*kDim+jDim];
+    }
+  }
+  for (iDim = 0; iDim < 9; iDim++) Rigid_Matrix[iDim] = Matrix[iDim];
+  for (iDim = 0; iDim < 3; iDim++) Rigid_Transl[iDim] = Transl[iDim];
+  
+}
+
 void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config) {
   
   unsigned short iMGfine, iMGlevel, nMGlevel = config->GetnMGLevels();
+  bool rigid = Rigid_Pending;
+  
+  Rigid_Pending = false;
   
   /*--- Update the multigrid structure after moving the finest grid,
-   including computing the grid velocities on the coarser levels. ---*/
+   including computing the grid velocities on the coarser levels. After
+   rigid motions only, the coarse grids are moved the same way. ---*/
   
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel-1;
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    if (rigid)
+      geometry[iMGlevel]->SetRigid_DualGrid(Rigid_Matrix, Rigid_Transl, true);
+    else if (config->GetPartial_DualGrid_Update())
+      geometry[iMGlevel]->SetControlVolume_Moved(config, geometry[iMGfine]);
+    else {
+      geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
+      geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    }
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -134,8 +260,9 @@ void CVolumetricMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *config, bool UpdateGeo, bool Derivative) {
   
   unsigned long IterLinSol = 0, Smoothing_Iter, iNonlinear_Iter, MaxIter = 0, RestartIter = 50, Tot_Iter = 0, Nonlinear_Iter = 0;
-  su2double MinVolume, MaxVolume, NumError, Residual = 0.0, Residual_Init = 0.0;
-  bool Screen_Output;
+  su2double MinVolume = 0.0, MaxVolume, NumError, Residual = 0.0, Residual_Init = 0.0;
+  unsigned short Kind_Reuse;
+  bool Screen_Output, Precond_Reused;
 
 
   /*--- Retrieve number or iterations, tol, output, etc. from config ---*/
@@ -149,9 +276,31 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
   
   if (config->GetKind_SU2() == SU2_CFD && !Derivative) Screen_Output = false;
 
-  /*--- Set the number of nonlinear iterations to 1 if Derivative computation is enabled ---*/
+  /*--- The radial basis function interpolation replaces the elasticity equations ---*/
+  
+  if (config->GetKind_Deform_Method() == RBF_DEFORMATION) {
+    if (Derivative)
+      SU2_MPI::Error("The RBF mesh deformation does not compute the derivatives of the grid.", CURRENT_FUNCTION);
+    SetVolume_Deformation_RBF(geometry, config, UpdateGeo);
+    return;
+  }
 
-  if (Derivative) Nonlinear_Iter = 1;
+  /*--- Set the number of nonlinear iterations to 1 if Derivative computation is enabled,
+   the direct differentiation instead repeats the linear solve for each tangent direction. ---*/
+
+  if (Derivative) {
+    Nonlinear_Iter = 1;
+    if (config->GetKind_SU2() == SU2_CFD) Nonlinear_Iter = config->GetDirectDiff_Directions();
+  }
+  
+  /*--- The stiffness matrix and the preconditioner may be kept across the
+   increments and the deformations (time steps, FSI iterations), the derivatives
+   always use a new system. ---*/
+  
+  Kind_Reuse = config->GetKind_Deform_Reuse();
+  if (Derivative) Kind_Reuse = NO_REUSE;
+  if (Kind_Reuse == NO_REUSE) { StiffMatrix_Ready = false; Precond_Ready = false; }
+  if (Kind_Reuse == REUSE_PRECONDITIONER) StiffMatrix_Ready = false;
   
   /*--- Loop over the total number of grid deformation iterations. The surface
    deformation can be divided into increments to help with stability. In
@@ -163,13 +312,17 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
     LinSysSol.SetValZero();
     LinSysRes.SetValZero();
-    StiffMatrix.SetValZero();
+    Tot_Iter = 0;
     
     /*--- Compute the stiffness matrix entries for all nodes/elements in the
      mesh. FEA uses a finite element method discretization of the linear
      elasticity equations (transfers element stiffnesses to point-to-point). ---*/
     
-    MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    if (!StiffMatrix_Ready) {
+      StiffMatrix.SetValZero();
+      MinVolume = SetFEAMethodContributions_Elem(geometry, config);
+    }
+    Precond_Reused = Precond_Ready;
     
     /*--- Set the boundary and volume displacements (as prescribed by the 
      design variable perturbations controlling the surface shape) 
@@ -183,7 +336,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     /*--- Set the boundary derivatives (overrides the actual displacements) ---*/
 
-    if (Derivative) { SetBoundaryDerivatives(geometry, config); }
+    if (Derivative) { SetBoundaryDerivatives(geometry, config, iNonlinear_Iter); }
     
     CMatrixVectorProduct* mat_vec = NULL;
     CPreconditioner* precond = NULL;
@@ -210,16 +363,22 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == ILU) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# ILU preconditioner." << endl;
-    		StiffMatrix.BuildILUPreconditioner();
+    		if (!Precond_Ready) StiffMatrix.BuildILUPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner(StiffMatrix, geometry, config);
     	}
     	if (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Jacobi preconditioner." << endl;
-    		StiffMatrix.BuildJacobiPreconditioner();
+    		if (!Precond_Ready) StiffMatrix.BuildJacobiPreconditioner();
     		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
     		precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
     	}
+    	if (config->GetKind_Deform_Linear_Solver_Prec() == AMG) {
+        if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# AMG preconditioner." << endl;
+    		if (!Precond_Ready) StiffMatrix.BuildAMGPreconditioner();
+    		mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+    		precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+    	}
 
     } else if (Derivative && (config->GetKind_SU2() == SU2_DOT)) {
 
@@ -232,7 +391,8 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
     		precond = new CILUPreconditioner(StiffMatrix, geometry, config);
     	}
-    	if (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) {
+    	if ((config->GetKind_Deform_Linear_Solver_Prec() == JACOBI) ||
+    			(config->GetKind_Deform_Linear_Solver_Prec() == AMG)) {
         if ((rank == MASTER_NODE) && Screen_Output) cout << "\n# Jacobi preconditioner." << endl;
     		StiffMatrix.BuildJacobiPreconditioner(true);
     		mat_vec = new CSysMatrixVectorProductTransposed(StiffMatrix, geometry, config);
@@ -241,18 +401,23 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
     }
 
-    CSysSolve *system  = new CSysSolve();
+    CSysSolve *system  = &System;
+    
+    /*--- The CGS variants of FGMRES use classical Gram-Schmidt with fused reductions ---*/
+    
+    const bool fused_reductions = ((config->GetKind_Deform_Linear_Solver() == FGMRES_CGS) ||
+                                   (config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES_CGS));
     
     if (LinSysRes.norm() != 0.0){
       switch (config->GetKind_Deform_Linear_Solver()) {
         
         /*--- Solve the linear system (GMRES with restart) ---*/
         
-        case RESTARTED_FGMRES:
+        case RESTARTED_FGMRES: case RESTARTED_FGMRES_CGS:
 
           Tot_Iter = 0; MaxIter = RestartIter;
 
-          system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, 1, &Residual_Init, false);
+          system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, 1, &Residual_Init, false, fused_reductions);
 
           if ((rank == MASTER_NODE) && Screen_Output) {
             cout << "\n# FGMRES (with restart) residual history" << endl;
@@ -267,7 +432,7 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
             if (IterLinSol + RestartIter > Smoothing_Iter)
               MaxIter = Smoothing_Iter - IterLinSol;
 
-            IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, MaxIter, &Residual, false);
+            IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, MaxIter, &Residual, false, fused_reductions);
             Tot_Iter += IterLinSol;
 
             if ((rank == MASTER_NODE) && Screen_Output) { cout << "     " << Tot_Iter << "     " << Residual/Residual_Init << endl; }
@@ -285,9 +450,9 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           /*--- Solve the linear system (GMRES) ---*/
 
-        case FGMRES:
+        case FGMRES: case FGMRES_CGS:
 
-          Tot_Iter = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output);
+          Tot_Iter = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, Smoothing_Iter, &Residual, Screen_Output, fused_reductions);
 
           break;
 
@@ -306,20 +471,59 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
 
           break;
 
+          /*--- Solve the linear system (GMRES with restart, recycling the space of the previous increment) ---*/
+
+        case GCRO_DR:
+
+          Tot_Iter = system->GCRODR_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, NumError, RestartIter, Smoothing_Iter,
+                                              config->GetLinear_Solver_Recycle_Size(), system->GetRecycle_Space(), &Residual, Screen_Output);
+
+          break;
+
+        default:
+
+          SU2_MPI::Error("The DEFORM_LINEAR_SOLVER is not available for the mesh deformation.", CURRENT_FUNCTION);
+
+          break;
+
       }
     }
     
     /*--- Deallocate memory needed by the Krylov linear solver ---*/
     
-    delete system;
     delete mat_vec;
     delete precond;
     
+    /*--- Keep the system for the next increments. It is rebuilt once the linear
+     solver hits the iteration limit, or needs more iterations than the given
+     ratio of those of the first solve after the last rebuild. ---*/
+    
+    if (Kind_Reuse != NO_REUSE) {
+      if (!Precond_Reused) {
+        if (Tot_Iter > 0) {
+          Rebuild_Iter = Tot_Iter;
+          StiffMatrix_Ready = (Kind_Reuse == REUSE_STIFFNESS);
+          Precond_Ready = true;
+        }
+      }
+      else if ((Tot_Iter >= Smoothing_Iter) ||
+               (su2double(Tot_Iter) > config->GetDeform_Rebuild_Ratio()*su2double(Rebuild_Iter))) {
+        if ((rank == MASTER_NODE) && Screen_Output)
+          cout << "\n# Linear iterations " << Tot_Iter << " with the reused system, it is rebuilt." << endl;
+        StiffMatrix_Ready = false;
+        Precond_Ready = false;
+      }
+    }
+    
+    /*--- The remaining tangent directions of the derivatives use the same system. ---*/
+    
+    if (Derivative) { StiffMatrix_Ready = true; Precond_Ready = true; }
+    
     /*--- Update the grid coordinates and cell volumes using the solution
      of the linear system (usol contains the x, y, z displacements). ---*/
 
     if (!Derivative) { UpdateGridCoord(geometry, config); }
-    else { UpdateGridCoord_Derivatives(geometry, config); }
+    else { UpdateGridCoord_Derivatives(geometry, config, iNonlinear_Iter); }
     if (UpdateGeo) { UpdateDualGrid(geometry, config); }
     
     /*--- Check for failed deformation (negative volumes). ---*/
@@ -338,9 +542,284 @@ void CVolumetricMovement::SetVolume_Deformation(CGeometry *geometry, CConfig *co
     
   }
   
+  if (Derivative) { StiffMatrix_Ready = false; Precond_Ready = false; }
+  
 
 }
 
+void CVolumetricMovement::SetVolume_Deformation_RBF(CGeometry *geometry, CConfig *config, bool UpdateGeo) {
+  
+  unsigned short iDim, iMarker, axis = 0, Kind_RBF = config->GetKindRadialBasisFunction();
+  unsigned short Kind_SU2 = config->GetKind_SU2();
+  unsigned long iPoint, iVertex, iCand, iSel, jSel, nCand, nCand_Local = 0, iCand_Max, iCand_First, iCand_Last,
+  nSelected = 0, MaxPoints = config->GetDeform_RBF_MaxPoints();
+  su2double *VarCoord, *Coord, MeanCoord[3] = {0.0,0.0,0.0}, Interp[3], Dist, Phi, Phi_0, Diag, Error, MaxError = 0.0,
+  MaxDisp = 0.0, MinVolume, MaxVolume, Radius = config->GetDeform_RBF_Radius(), Tolerance = config->GetDeform_RBF_Tolerance();
+  bool compact = (Kind_RBF == WENDLAND_C2);
+  
+  /*--- Prescribed displacements of the boundary points: the moving surfaces
+   and the fixed ones. The separation of the symmetry planes is imposed afterwards,
+   while the points of the periodic, internal and send-receive boundaries are free. ---*/
+  
+  vector<unsigned short> Point_Kind(nPoint, 0);
+  vector<su2double> Point_Disp(nPoint*nDim, 0.0);
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) != SYMMETRY_PLANE) &&
+        (config->GetMarker_All_KindBC(iMarker) != SEND_RECEIVE) &&
+        (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY) &&
+        (config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+        Point_Kind[geometry->vertex[iMarker][iVertex]->GetNode()] = 1;
+    }
+  }
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((((config->GetMarker_All_Moving(iMarker) == YES) && (Kind_SU2 == SU2_CFD)) ||
+         ((config->GetMarker_All_DV(iMarker) == YES) && (Kind_SU2 == SU2_DEF)) ||
+         ((config->GetDirectDiff() == D_DESIGN) && (Kind_SU2 == SU2_CFD) && (config->GetMarker_All_DV(iMarker) == YES))) &&
+        (config->GetMarker_All_KindBC(iMarker) != NEARFIELD_BOUNDARY)) {
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
+        Point_Kind[iPoint] = 2;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Point_Disp[iPoint*nDim+iDim] = VarCoord[iDim];
+      }
+    }
+  }
+  
+  /*--- The candidate control points are the boundary points of the domain, gathered
+   on all ranks, so that every rank performs the same greedy selection. ---*/
+  
+  vector<su2double> Cand_Local;
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (Point_Kind[iPoint] == 0) continue;
+    Coord = geometry->node[iPoint]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++) Cand_Local.push_back(Coord[iDim]);
+    for (iDim = 0; iDim < nDim; iDim++) Cand_Local.push_back(Point_Disp[iPoint*nDim+iDim]);
+    nCand_Local++;
+  }
+  
+  vector<su2double> Cand;
+  
+#ifdef HAVE_MPI
+  int iRank, nSend = (int)Cand_Local.size();
+  vector<int> nRecv(size), Displ(size+1, 0);
+  SU2_MPI::Allgather(&nSend, 1, MPI_INT, &nRecv[0], 1, MPI_INT, MPI_COMM_WORLD);
+  for (iRank = 0; iRank < size; iRank++) Displ[iRank+1] = Displ[iRank] + nRecv[iRank];
+  Cand.resize(Displ[size]);
+  if (Cand_Local.empty()) Cand_Local.push_back(0.0);
+  SU2_MPI::Allgatherv(&Cand_Local[0], nSend, MPI_SU2DOUBLE, Cand.empty() ? NULL : &Cand[0], &nRecv[0], &Displ[0],
+                      MPI_SU2DOUBLE, MPI_COMM_WORLD);
+#else
+  Cand = Cand_Local;
+#endif
+  
+  nCand = Cand.size()/(2*nDim);
+  
+  /*--- The first control point is the one with the largest displacement ---*/
+  
+  iCand_Max = 0;
+  for (iCand = 0; iCand < nCand; iCand++) {
+    Error = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) Error += pow(Cand[(2*iCand+1)*nDim+iDim], 2);
+    Error = sqrt(Error);
+    if (Error > MaxDisp) { MaxDisp = Error; iCand_Max = iCand; }
+  }
+  
+  if (MaxDisp == 0.0) {
+    if (rank == MASTER_NODE) cout << "No surface displacement, the RBF mesh deformation is skipped." << endl;
+    Set_nIterMesh(0);
+    return;
+  }
+  
+  /*--- Greedy selection of the control points. The factorization L L^T of the
+   interpolation matrix grows by one row per point, [L 0; l^T d] with L l = b,
+   instead of factorizing the whole dense system again. The interpolation error
+   at the candidates is evaluated by each rank on its share of them. ---*/
+  
+  iCand_First = (nCand*rank)/size;
+  iCand_Last  = (nCand*(rank+1))/size;
+  
+  Phi_0 = CRadialBasisFunction::Get_RadialBasisValue(Kind_RBF, Radius, 0.0);
+  
+  vector<unsigned long> Selected;
+  vector<su2double> Chol, Row, Weight, Aux;
+  
+  while (true) {
+    
+    /*--- Row of the new control point in the factorization ---*/
+    
+    Row.assign(nSelected+1, 0.0);
+    for (iSel = 0; iSel < nSelected; iSel++) {
+      Dist = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Dist += pow(Cand[2*iCand_Max*nDim+iDim] - Cand[2*Selected[iSel]*nDim+iDim], 2);
+      Dist = sqrt(Dist);
+      Phi = CRadialBasisFunction::Get_RadialBasisValue(Kind_RBF, Radius, Dist);
+      for (jSel = 0; jSel < iSel; jSel++) Phi -= Chol[iSel*(iSel+1)/2+jSel]*Row[jSel];
+      Row[iSel] = Phi/Chol[iSel*(iSel+1)/2+iSel];
+    }
+    Diag = Phi_0;
+    for (iSel = 0; iSel < nSelected; iSel++) Diag -= Row[iSel]*Row[iSel];
+    
+    /*--- A point almost coincident with the control points adds no information ---*/
+    
+    if (Diag <= EPS*Phi_0) break;
+    
+    Row[nSelected] = sqrt(Diag);
+    Chol.insert(Chol.end(), Row.begin(), Row.end());
+    Selected.push_back(iCand_Max);
+    nSelected++;
+    
+    /*--- Weights of the interpolation of each component, L L^T w = d ---*/
+    
+    Weight.assign(nSelected*nDim, 0.0);
+    Aux.resize(nSelected);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      for (iSel = 0; iSel < nSelected; iSel++) {
+        Aux[iSel] = Cand[(2*Selected[iSel]+1)*nDim+iDim];
+        for (jSel = 0; jSel < iSel; jSel++) Aux[iSel] -= Chol[iSel*(iSel+1)/2+jSel]*Aux[jSel];
+        Aux[iSel] /= Chol[iSel*(iSel+1)/2+iSel];
+      }
+      for (iSel = nSelected; iSel-- > 0; ) {
+        Weight[iSel*nDim+iDim] = Aux[iSel];
+        for (jSel = iSel+1; jSel < nSelected; jSel++)
+          Weight[iSel*nDim+iDim] -= Chol[jSel*(jSel+1)/2+iSel]*Weight[jSel*nDim+iDim];
+        Weight[iSel*nDim+iDim] /= Chol[iSel*(iSel+1)/2+iSel];
+      }
+    }
+    
+    /*--- Largest error of the interpolated displacements at the candidates ---*/
+    
+    MaxError = 0.0; iCand_Max = nCand;
+    for (iCand = iCand_First; iCand < iCand_Last; iCand++) {
+      for (iDim = 0; iDim < nDim; iDim++) Interp[iDim] = 0.0;
+      for (iSel = 0; iSel < nSelected; iSel++) {
+        Dist = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          Dist += pow(Cand[2*iCand*nDim+iDim] - Cand[2*Selected[iSel]*nDim+iDim], 2);
+        Dist = sqrt(Dist);
+        if (compact && (Dist >= Radius)) continue;
+        Phi = CRadialBasisFunction::Get_RadialBasisValue(Kind_RBF, Radius, Dist);
+        for (iDim = 0; iDim < nDim; iDim++) Interp[iDim] += Weight[iSel*nDim+iDim]*Phi;
+      }
+      Error = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) Error += pow(Interp[iDim] - Cand[(2*iCand+1)*nDim+iDim], 2);
+      Error = sqrt(Error);
+      if (Error > MaxError) { MaxError = Error; iCand_Max = iCand; }
+    }
+    
+#ifdef HAVE_MPI
+    su2double MyError = MaxError;
+    unsigned long MyCand;
+    SU2_MPI::Allreduce(&MyError, &MaxError, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    MyCand = (MyError == MaxError) ? iCand_Max : nCand;
+    SU2_MPI::Allreduce(&MyCand, &iCand_Max, 1, MPI_UNSIGNED_LONG, MPI_MIN, MPI_COMM_WORLD);
+#endif
+    
+    if ((MaxError <= Tolerance*MaxDisp) || (nSelected >= MaxPoints) || (iCand_Max == nCand)) break;
+    
+  }
+  
+  /*--- Evaluate the interpolant at the points of the grid. The control points are
+   sorted by their first coordinate, for a compactly supported basis only those
+   within one radius of that coordinate are visited. ---*/
+  
+  vector<pair<su2double, unsigned long> > Sorted(nSelected);
+  for (iSel = 0; iSel < nSelected; iSel++)
+    Sorted[iSel] = make_pair(Cand[2*Selected[iSel]*nDim], iSel);
+  sort(Sorted.begin(), Sorted.end());
+  
+  LinSysSol.SetValZero();
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    /*--- The prescribed displacements are imposed exactly ---*/
+    
+    if (Point_Kind[iPoint] != 0) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        LinSysSol[iPoint*nDim+iDim] = Point_Disp[iPoint*nDim+iDim];
+      continue;
+    }
+    
+    Coord = geometry->node[iPoint]->GetCoord();
+    vector<pair<su2double, unsigned long> >::iterator it = Sorted.begin(), it_end = Sorted.end();
+    if (compact) {
+      it = lower_bound(Sorted.begin(), Sorted.end(), make_pair(Coord[0]-Radius, (unsigned long)0));
+      it_end = lower_bound(it, Sorted.end(), make_pair(Coord[0]+Radius, (unsigned long)0));
+    }
+    
+    for (iDim = 0; iDim < nDim; iDim++) Interp[iDim] = 0.0;
+    for (; it != it_end; ++it) {
+      iSel = it->second;
+      Dist = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Dist += pow(Coord[iDim] - Cand[2*Selected[iSel]*nDim+iDim], 2);
+      Dist = sqrt(Dist);
+      if (compact && (Dist >= Radius)) continue;
+      Phi = CRadialBasisFunction::Get_RadialBasisValue(Kind_RBF, Radius, Dist);
+      for (iDim = 0; iDim < nDim; iDim++) Interp[iDim] += Weight[iSel*nDim+iDim]*Phi;
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      LinSysSol[iPoint*nDim+iDim] = Interp[iDim];
+  }
+  
+  /*--- Set to zero displacements of the normal component for the symmetry plane condition ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SYMMETRY_PLANE) && (geometry->nVertex[iMarker] > 0)) {
+      
+      su2double *Coord_0 = NULL;
+      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = 0.0;
+      
+      iPoint  = geometry->vertex[iMarker][0]->GetNode();
+      Coord_0 = geometry->node[iPoint]->GetCoord();
+      
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        Coord = geometry->node[iPoint]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++)
+          MeanCoord[iDim] += (Coord[iDim]-Coord_0[iDim])*(Coord[iDim]-Coord_0[iDim]);
+      }
+      for (iDim = 0; iDim < nDim; iDim++) MeanCoord[iDim] = sqrt(MeanCoord[iDim]);
+      if (nDim==3) {
+        if ((MeanCoord[0] <= MeanCoord[1]) && (MeanCoord[0] <= MeanCoord[2])) axis = 0;
+        if ((MeanCoord[1] <= MeanCoord[0]) && (MeanCoord[1] <= MeanCoord[2])) axis = 1;
+        if ((MeanCoord[2] <= MeanCoord[0]) && (MeanCoord[2] <= MeanCoord[1])) axis = 2;
+      }
+      else {
+        if ((MeanCoord[0] <= MeanCoord[1]) ) axis = 0;
+        if ((MeanCoord[1] <= MeanCoord[0]) ) axis = 1;
+      }
+      
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        LinSysSol[iPoint*nDim+axis] = 0.0;
+      }
+    }
+  }
+  
+  /*--- Update the grid coordinates and cell volumes with the displacements ---*/
+  
+  UpdateGridCoord(geometry, config);
+  if (UpdateGeo) { UpdateDualGrid(geometry, config); }
+  
+  /*--- Check for failed deformation (negative volumes). ---*/
+  
+  ComputeDeforming_Element_Volume(geometry, MinVolume, MaxVolume);
+  
+  Set_nIterMesh(nSelected);
+  
+  if (rank == MASTER_NODE) {
+    cout << "RBF control points: " << nSelected << "/" << nCand << ". ";
+    if (nDim == 2) cout << "Min. area: " << MinVolume << ". Error: " << MaxError << "." << endl;
+    else cout << "Min. volume: " << MinVolume << ". Error: " << MaxError << "." << endl;
+  }
+  
+}
+
 void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, su2double &MinVolume, su2double &MaxVolume) {
   
   unsigned long iElem, ElemCounter = 0, PointCorners[8];
@@ -403,8 +882,8 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
   su2double MaxVolume_Local = MaxVolume; MaxVolume = 0.0;
   su2double MinVolume_Local = MinVolume; MinVolume = 0.0;
   SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 #endif
   
   /*--- Volume from  0 to 1 ---*/
@@ -423,10 +902,9 @@ void CVolumetricMovement::ComputeDeforming_Element_Volume(CGeometry *geometry, s
   
 void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfig *config, su2double &MinDistance, su2double &MaxDistance) {
   
-  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint, pointID;
+  unsigned long nVertex_SolidWall, ii, jj, iVertex, iPoint;
   unsigned short iMarker, iDim;
   su2double dist, MaxDistance_Local, MinDistance_Local;
-  int rankID;
 
   /*--- Initialize min and max distance ---*/
 
@@ -490,10 +968,23 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
     /*--- Solid wall boundary nodes are present. Compute the wall
      distance for all nodes. ---*/
     
+    /*--- The points are searched as one batch, ordered along a space
+     filling curve. ---*/
+    
+    vector<su2double>     Coord_point(nDim*geometry->GetnPoint()), Dist_point(geometry->GetnPoint());
+    vector<unsigned long> PointID_point(geometry->GetnPoint());
+    vector<int>           RankID_point(geometry->GetnPoint());
+    
+    for (iPoint=0; iPoint<geometry->GetnPoint(); ++iPoint)
+      for (iDim=0; iDim<nDim; ++iDim)
+        Coord_point[nDim*iPoint+iDim] = geometry->node[iPoint]->GetCoord(iDim);
+    
+    WallADT.DetermineNearestNodes(geometry->GetnPoint(), Coord_point.data(), Dist_point.data(),
+                                  PointID_point.data(), RankID_point.data());
+    
     for(iPoint=0; iPoint<geometry->GetnPoint(); ++iPoint) {
       
-      WallADT.DetermineNearestNode(geometry->node[iPoint]->GetCoord(), dist,
-                                   pointID, rankID);
+      dist = Dist_point[iPoint];
       geometry->node[iPoint]->SetWall_Distance(dist);
       
       MaxDistance = max(MaxDistance, dist);
@@ -508,8 +999,8 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
     MinDistance_Local = MinDistance; MinDistance = 0.0;
     
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&MaxDistance_Local, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MinDistance_Local, &MinDistance, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MaxDistance_Local, &MaxDistance, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MinDistance_Local, &MinDistance, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 #else
     MaxDistance = MaxDistance_Local;
     MinDistance = MinDistance_Local;
@@ -521,19 +1012,8 @@ void CVolumetricMovement::ComputeSolid_Wall_Distance(CGeometry *geometry, CConfi
 
 su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometry, CConfig *config) {
   
-  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
-  unsigned long iElem, PointCorners[8];
-  su2double **StiffMatrix_Elem = NULL, CoordCorners[8][3];
-  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0, ElemVolume = 0.0, ElemDistance = 0.0;
-  
-  /*--- Allocate maximum size (quadrilateral and hexahedron) ---*/
-  
-  if (nDim == 2) StiffMatrix_nElem = 8;
-  else StiffMatrix_nElem = 24;
-    
-  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
-  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
-    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  unsigned short iColor;
+  su2double MinVolume = 0.0, MaxVolume = 0.0, MinDistance = 0.0, MaxDistance = 0.0;
   
   /*--- Compute min volume in the entire mesh. ---*/
   
@@ -549,9 +1029,64 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     if (rank == MASTER_NODE) cout <<"Min. distance: "<< MinDistance <<", max. distance: "<< MaxDistance <<"." << endl;
   }
   
-	/*--- Compute contributions from each element by forming the stiffness matrix (FEA) ---*/
+	/*--- Compute contributions from each element by forming the stiffness matrix (FEA).
+   The elements of one color do not share points, hence the threads assemble them
+   concurrently, the colors are carried out one after the other. ---*/
+  
+  if (taskThreadPool == NULL) {
+    SetFEAMethodContributions_Range(geometry, config, 0, geometry->GetnElem());
+    return MinVolume;
+  }
+  
+  taskGeometry = geometry;
+  taskConfig   = config;
   
-	for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
+  taskThreadPool->ResetTasks(ElemColorChunks.size());
+  
+  for (iColor = 0; iColor < ElemColorChunks.size(); iColor++) {
+    taskThreadPool->LaunchTask(iColor, ElemColorChunks[iColor]);
+    while (!taskThreadPool->TaskCompleted(iColor)) {
+      if (!taskThreadPool->RunChunk()) {
+#ifdef HAVE_PTHREAD
+        sched_yield();
+#endif
+      }
+    }
+  }
+  
+  return MinVolume;
+
+}
+
+void CVolumetricMovement::ProcessTaskChunk_Deform(void *movement, const CTaskChunk &chunk) {
+  
+  CVolumetricMovement *Movement = (CVolumetricMovement *) movement;
+  
+  Movement->SetFEAMethodContributions_Range(Movement->taskGeometry, Movement->taskConfig,
+                                            chunk.indBeg, chunk.indEnd);
+  
+}
+
+void CVolumetricMovement::SetFEAMethodContributions_Range(CGeometry *geometry, CConfig *config, unsigned long val_begin, unsigned long val_end) {
+  
+  unsigned short iVar, iDim, nNodes = 0, iNodes, StiffMatrix_nElem = 0;
+  unsigned long iPos, iElem, PointCorners[8];
+  su2double **StiffMatrix_Elem = NULL, CoordCorners[8][3];
+  su2double ElemVolume = 0.0, ElemDistance = 0.0;
+  
+  /*--- Allocate maximum size (quadrilateral and hexahedron), every
+   chunk has its own element matrix. ---*/
+  
+  if (nDim == 2) StiffMatrix_nElem = 8;
+  else StiffMatrix_nElem = 24;
+    
+  StiffMatrix_Elem = new su2double* [StiffMatrix_nElem];
+  for (iVar = 0; iVar < StiffMatrix_nElem; iVar++)
+    StiffMatrix_Elem[iVar] = new su2double [StiffMatrix_nElem];
+  
+	for (iPos = val_begin; iPos < val_end; iPos++) {
+    
+    iElem = geometry->GetElemColor_Elem(iPos);
     
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      nNodes = 3;
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) nNodes = 4;
@@ -591,8 +1126,6 @@ su2double CVolumetricMovement::SetFEAMethodContributions_Elem(CGeometry *geometr
     delete [] StiffMatrix_Elem[iVar];
   delete [] StiffMatrix_Elem;
   
-  return MinVolume;
-
 }
 
 su2double CVolumetricMovement::ShapeFunc_Triangle(su2double Xi, su2double Eta, su2double CoordCorners[8][3], su2double DShapeFunction[8][4]) {
@@ -1749,7 +2282,7 @@ void CVolumetricMovement::SetBoundaryDisplacements(CGeometry *geometry, CConfig
 
 }
 
-void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *config) {
+void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *config, unsigned short iDir) {
   unsigned short iDim, iMarker;
   unsigned long iPoint, total_index, iVertex;
 
@@ -1763,8 +2296,8 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
           VarCoord = geometry->vertex[iMarker][iVertex]->GetVarCoord();
           for (iDim = 0; iDim < nDim; iDim++) {
             total_index = iPoint*nDim + iDim;
-            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
-            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim]);
+            LinSysRes[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], iDir);
+            LinSysSol[total_index] = SU2_TYPE::GetDerivative(VarCoord[iDim], iDir);
           }
         }
       }
@@ -1782,7 +2315,7 @@ void CVolumetricMovement::SetBoundaryDerivatives(CGeometry *geometry, CConfig *c
   }
 }
 
-void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config) {
+void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConfig *config, unsigned short iDir) {
   unsigned short iDim, iMarker;
   unsigned long iPoint, total_index, iVertex;
   su2double *new_coord = new su2double[3];
@@ -1797,7 +2330,7 @@ void CVolumetricMovement::UpdateGridCoord_Derivatives(CGeometry *geometry, CConf
       for (iDim = 0; iDim < nDim; iDim++) {
         total_index = iPoint*nDim + iDim;
         new_coord[iDim] = geometry->node[iPoint]->GetCoord(iDim);
-        SU2_TYPE::SetDerivative(new_coord[iDim], SU2_TYPE::GetValue(LinSysSol[total_index]));
+        SU2_TYPE::SetDerivative(new_coord[iDim], iDir, SU2_TYPE::GetValue(LinSysSol[total_index]));
       }
       geometry->node[iPoint]->SetCoord(new_coord);
     }
@@ -2051,7 +2584,21 @@ void CVolumetricMovement::Rigid_Rotation(CGeometry *geometry, CConfig *config,
   
 	/*--- After moving all nodes, update geometry class ---*/
   
-	UpdateDualGrid(geometry, config);
+  /*--- The motion is rigid, x' = R*x + (Center - R*Center), unless the
+   coordinates are scaled by the reference length. ---*/
+  
+  if (Lref == 1.0) {
+    su2double rigidMatrix[9], rigidTransl[3];
+    for (iDim = 0; iDim < 3; iDim++) {
+      rigidTransl[iDim] = Center[iDim];
+      for (unsigned short jDim = 0; jDim < 3; jDim++) {
+        rigidMatrix[3*iDim+jDim] = rotMatrix[iDim][jDim];
+        rigidTransl[iDim] -= rotMatrix[iDim][jDim]*Center[jDim];
+      }
+    }
+    UpdateDualGrid_Rigid(geometry, config, rigidMatrix, rigidTransl);
+  }
+  else UpdateDualGrid(geometry, config);
 
 }
 
@@ -2213,7 +2760,21 @@ void CVolumetricMovement::Rigid_Pitching(CGeometry *geometry, CConfig *config, u
 
 	/*--- After moving all nodes, update geometry class ---*/
   
-	UpdateDualGrid(geometry, config);
+  /*--- The motion is rigid, x' = R*x + (Center - R*Center), unless the
+   coordinates are scaled by the reference length. ---*/
+  
+  if (Lref == 1.0) {
+    su2double rigidMatrix[9], rigidTransl[3];
+    for (iDim = 0; iDim < 3; iDim++) {
+      rigidTransl[iDim] = Center[iDim];
+      for (unsigned short jDim = 0; jDim < 3; jDim++) {
+        rigidMatrix[3*iDim+jDim] = rotMatrix[iDim][jDim];
+        rigidTransl[iDim] -= rotMatrix[iDim][jDim]*Center[jDim];
+      }
+    }
+    UpdateDualGrid_Rigid(geometry, config, rigidMatrix, rigidTransl);
+  }
+  else UpdateDualGrid(geometry, config);
   
 }
 
@@ -2352,7 +2913,8 @@ void CVolumetricMovement::Rigid_Plunging(CGeometry *geometry, CConfig *config, u
   
 	/*--- After moving all nodes, update geometry class ---*/
 	
-  UpdateDualGrid(geometry, config);
+  const su2double rigidMatrix[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  UpdateDualGrid_Rigid(geometry, config, rigidMatrix, deltaX);
   
 }
 
@@ -2468,7 +3030,8 @@ void CVolumetricMovement::Rigid_Translation(CGeometry *geometry, CConfig *config
   
 	/*--- After moving all nodes, update geometry class ---*/
 	
-  UpdateDualGrid(geometry, config);
+  const su2double rigidMatrix[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+  UpdateDualGrid_Rigid(geometry, config, rigidMatrix, deltaX);
   
 }
 
@@ -3161,7 +3724,8 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
 
   su2double DV_Value = 0.0;
 
-  unsigned short iDV = 0, iDV_Value = 0;
+  unsigned short iDV = 0, iDV_Value = 0, iDir = 0;
+  unsigned short nDirections = config->GetDirectDiff_Directions();
 
   for (iDV = 0; iDV < config->GetnDV(); iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
@@ -3169,13 +3733,21 @@ void CSurfaceMovement::SetSurface_Derivative(CGeometry *geometry, CConfig *confi
       DV_Value = config->GetDV_Value(iDV, iDV_Value);
 
       /*--- If value of the design variable is not 0.0 we apply the differentation.
-     *     Note if multiple variables are non-zero, we end up with the sum of all the derivatives. ---*/
+     *     Note if multiple variables are non-zero and only one direction is used, we end up with the sum of all the derivatives.
+     *     Otherwise the n-th non-zero variable is seeded in the n-th tangent direction. ---*/
 
       if (DV_Value != 0.0) {
 
         DV_Value = 0.0;
 
-        SU2_TYPE::SetDerivative(DV_Value, 1.0);
+        if (nDirections == 1) {
+          SU2_TYPE::SetDerivative(DV_Value, 1.0);
+        } else {
+          if (iDir == nDirections)
+            SU2_MPI::Error("The number of non-zero design variables exceeds DIRECT_DIFF_DIRECTIONS.", CURRENT_FUNCTION);
+          SU2_TYPE::SetDerivative(DV_Value, iDir, 1.0);
+          iDir++;
+        }
 
         config->SetDV_Value(iDV, iDV_Value, DV_Value);
       }
@@ -3364,7 +3936,7 @@ void CSurfaceMovement::SetParametricCoord(CGeometry *geometry, CConfig *config,
 
 #ifdef HAVE_MPI
   SU2_MPI::Barrier(MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
   MaxDiff = my_MaxDiff;
 #endif
@@ -3911,7 +4483,7 @@ void CSurfaceMovement::UpdateParametricCoord(CGeometry *geometry, CConfig *confi
 	}
 		
 #ifdef HAVE_MPI
-	SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+	SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
 	MaxDiff = my_MaxDiff;
 #endif
@@ -4028,7 +4600,7 @@ su2double CSurfaceMovement::SetCartesianCoord(CGeometry *geometry, CConfig *conf
   }
   
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&my_MaxDiff, &MaxDiff, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
   MaxDiff = my_MaxDiff;
 #endif
@@ -5136,7 +5708,7 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
   
   Buffer_Send_Coord[0] = TPCoord[0]; Buffer_Send_Coord[1] = TPCoord[1];
 
-	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, MPI_COMM_WORLD);
+	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_SU2DOUBLE, Buffer_Receive_Coord, 2, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
   TPCoord[0] = Buffer_Receive_Coord[0]; TPCoord[1] = Buffer_Receive_Coord[1];
   for (iProcessor = 1; iProcessor < nProcessor; iProcessor++) {
@@ -5168,7 +5740,7 @@ void CSurfaceMovement::SetHicksHenne(CGeometry *boundary, CConfig *config, unsig
   
   Buffer_Send_Coord[0] = LPCoord[0]; Buffer_Send_Coord[1] = LPCoord[1];
 
-	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, MPI_COMM_WORLD);
+	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_SU2DOUBLE, Buffer_Receive_Coord, 2, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   
   Chord = 0.0;
   for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
@@ -5342,7 +5914,7 @@ void CSurfaceMovement::SetCST(CGeometry *boundary, CConfig *config, unsigned sho
   
   Buffer_Send_Coord[0] = TPCoord[0]; Buffer_Send_Coord[1] = TPCoord[1];
 
-	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, MPI_COMM_WORLD);
+	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_SU2DOUBLE, Buffer_Receive_Coord, 2, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
   TPCoord[0] = Buffer_Receive_Coord[0]; TPCoord[1] = Buffer_Receive_Coord[1];
   for (iProcessor = 1; iProcessor < nProcessor; iProcessor++) {
@@ -5374,7 +5946,7 @@ void CSurfaceMovement::SetCST(CGeometry *boundary, CConfig *config, unsigned sho
   
   Buffer_Send_Coord[0] = LPCoord[0]; Buffer_Send_Coord[1] = LPCoord[1];
 
-	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_DOUBLE, Buffer_Receive_Coord, 2, MPI_DOUBLE, MPI_COMM_WORLD);
+	SU2_MPI::Allgather(Buffer_Send_Coord, 2, MPI_SU2DOUBLE, Buffer_Receive_Coord, 2, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   
   Chord = 0.0;
   for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
@@ -7746,9 +8318,9 @@ void CSurfaceMovement::MergeFFDInfo(CGeometry *geometry, CConfig *config) {
     
     /*--- Gather the coordinate data on the master node using MPI. ---*/
     
-    SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     SU2_MPI::Gather(Buffer_Send_Point, nBuffer_Scalar, MPI_UNSIGNED_LONG, Buffer_Recv_Point, nBuffer_Scalar, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
     SU2_MPI::Gather(Buffer_Send_MarkerIndex_CfgFile, nBuffer_Scalar, MPI_UNSIGNED_SHORT, Buffer_Recv_MarkerIndex_CfgFile, nBuffer_Scalar, MPI_UNSIGNED_SHORT, MASTER_NODE, MPI_COMM_WORLD);
 
@@ -8591,23 +9163,81 @@ su2double *CFreeFormDefBox::GetParametricCoord_Analytical(su2double *cart_coord)
 
 su2double *CFreeFormDefBox::EvalCartesianCoord(su2double *ParamCoord) {
 	unsigned short iDim, iDegree, jDegree, kDegree;
+  su2double Basis_ij, Basis_ijk, *Coord_CP;
 	
 	for (iDim = 0; iDim < nDim; iDim++)
 		cart_coord[iDim] = 0.0;
 	
-	for (iDegree = 0; iDegree <= lDegree; iDegree++)
-		for (jDegree = 0; jDegree <= mDegree; jDegree++)
-			for (kDegree = 0; kDegree <= nDegree; kDegree++)
-				for (iDim = 0; iDim < nDim; iDim++) {
-					cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim]
-          * BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0])
-          * BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1])
-          * BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
-				}
+  /*--- The basis is a tensor product, hence the blending functions are evaluated
+   once per direction. The control points outside the support of the B-splines
+   have a null basis and are skipped. ---*/
+  
+  BasisValue[0].resize(lDegree+1);
+  BasisValue[1].resize(mDegree+1);
+  BasisValue[2].resize(nDegree+1);
+  
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    BasisValue[0][iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
+  for (jDegree = 0; jDegree <= mDegree; jDegree++)
+    BasisValue[1][jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
+  for (kDegree = 0; kDegree <= nDegree; kDegree++)
+    BasisValue[2][kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+  
+	for (iDegree = 0; iDegree <= lDegree; iDegree++) {
+    if (BasisValue[0][iDegree] == 0.0) continue;
+		for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      Basis_ij = BasisValue[0][iDegree]*BasisValue[1][jDegree];
+      if (Basis_ij == 0.0) continue;
+			for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        Basis_ijk = Basis_ij*BasisValue[2][kDegree];
+        if (Basis_ijk == 0.0) continue;
+        Coord_CP = Coord_Control_Points[iDegree][jDegree][kDegree];
+				for (iDim = 0; iDim < nDim; iDim++)
+					cart_coord[iDim] += Coord_CP[iDim]*Basis_ijk;
+      }
+    }
+  }
 	
 	return cart_coord;
 }
 
+void CFreeFormDefBox::EvalCartesianCoord_Jacobian(su2double *ParamCoord, vector<unsigned long> &Index_CP, vector<su2double> &Basis_CP) {
+  unsigned short iDegree, jDegree, kDegree;
+  su2double Basis_ij, Basis_ijk;
+  
+  Index_CP.clear();
+  Basis_CP.clear();
+  
+  /*--- The cartesian coordinates are linear in the control points, the
+   derivative is the same tensor product of blending functions as above. ---*/
+  
+  BasisValue[0].resize(lDegree+1);
+  BasisValue[1].resize(mDegree+1);
+  BasisValue[2].resize(nDegree+1);
+  
+  for (iDegree = 0; iDegree <= lDegree; iDegree++)
+    BasisValue[0][iDegree] = BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]);
+  for (jDegree = 0; jDegree <= mDegree; jDegree++)
+    BasisValue[1][jDegree] = BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]);
+  for (kDegree = 0; kDegree <= nDegree; kDegree++)
+    BasisValue[2][kDegree] = BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
+  
+  for (iDegree = 0; iDegree <= lDegree; iDegree++) {
+    if (BasisValue[0][iDegree] == 0.0) continue;
+    for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      Basis_ij = BasisValue[0][iDegree]*BasisValue[1][jDegree];
+      if (Basis_ij == 0.0) continue;
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        Basis_ijk = Basis_ij*BasisValue[2][kDegree];
+        if (Basis_ijk == 0.0) continue;
+        Index_CP.push_back((iDegree*mOrder + jDegree)*nOrder + kDegree);
+        Basis_CP.push_back(Basis_ijk);
+      }
+    }
+  }
+  
+}
+
 
 su2double *CFreeFormDefBox::GetFFDGradient(su2double *val_coord, su2double *xyz) {
   
@@ -9287,9 +9917,17 @@ void CElasticityMovement::UpdateDualGrid(CGeometry *geometry, CConfig *config){
   /*--- After moving all nodes, update the dual mesh. Recompute the edges and
    dual mesh control volumes in the domain and on the boundaries. ---*/
 
-  geometry->SetCoord_CG();
-  geometry->SetControlVolume(config, UPDATE);
-  geometry->SetBoundControlVolume(config, UPDATE);
+  if (config->GetPartial_DualGrid_Update()) {
+    
+    /*--- Only the elements and vertices around the moved points ---*/
+    
+    geometry->SetControlVolume_Moved(config);
+  }
+  else {
+    geometry->SetCoord_CG();
+    geometry->SetControlVolume(config, UPDATE);
+    geometry->SetBoundControlVolume(config, UPDATE);
+  }
   geometry->SetMaxLength(config);
 
 }
@@ -9304,9 +9942,13 @@ void CElasticityMovement::UpdateMultiGrid(CGeometry **geometry, CConfig *config)
 
   for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
     iMGfine = iMGlevel-1;
-    geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
-    geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
-    geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    if (config->GetPartial_DualGrid_Update())
+      geometry[iMGlevel]->SetControlVolume_Moved(config, geometry[iMGfine]);
+    else {
+      geometry[iMGlevel]->SetControlVolume(config, geometry[iMGfine], UPDATE);
+      geometry[iMGlevel]->SetBoundControlVolume(config, geometry[iMGfine],UPDATE);
+      geometry[iMGlevel]->SetCoord(geometry[iMGfine]);
+    }
     if (config->GetGrid_Movement())
       geometry[iMGlevel]->SetRestricted_GridVelocity(geometry[iMGfine], config);
   }
@@ -9534,7 +10176,7 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
   /*--- Initialize the structures to solve the system ---*/
 
   CMatrixVectorProduct* mat_vec = NULL;
-  CSysSolve *system  = new CSysSolve();
+  CSysSolve *system  = &System;
 
   bool TapeActive = NO;
 
@@ -9564,6 +10206,9 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
   if (config->GetKind_Deform_Linear_Solver() == BCGSTAB ||
       config->GetKind_Deform_Linear_Solver() == FGMRES ||
       config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES ||
+      config->GetKind_Deform_Linear_Solver() == FGMRES_CGS ||
+      config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES_CGS ||
+      config->GetKind_Deform_Linear_Solver() == GCRO_DR ||
       config->GetKind_Deform_Linear_Solver() == CONJUGATE_GRADIENT) {
 
     /*--- Independently of whether we are using or not derivatives,
@@ -9591,6 +10236,10 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CLineletPreconditioner(StiffMatrix, geometry, config);
       break;
+    case AMG:
+      StiffMatrix.BuildAMGPreconditioner();
+      precond = new CAMGPreconditioner(StiffMatrix, geometry, config);
+      break;
     default:
       StiffMatrix.BuildJacobiPreconditioner();
       precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
@@ -9604,19 +10253,28 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
     case FGMRES:
       IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
       break;
+    case FGMRES_CGS:
+      IterLinSol = system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output, true);
+      break;
     case CONJUGATE_GRADIENT:
       IterLinSol = system->CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
       break;
-    case RESTARTED_FGMRES:
+    case RESTARTED_FGMRES: case RESTARTED_FGMRES_CGS:
       IterLinSol = 0;
       while (IterLinSol < config->GetLinear_Solver_Iter()) {
         if (IterLinSol + config->GetLinear_Solver_Restart_Frequency() > config->GetLinear_Solver_Iter())
           MaxIter = config->GetLinear_Solver_Iter() - IterLinSol;
-        IterLinSol += system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output);
+        IterLinSol += system->FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &System_Residual, Screen_Output,
+                                               (config->GetKind_Deform_Linear_Solver() == RESTARTED_FGMRES_CGS));
         if (LinSysRes.norm() < SolverTol) break;
         SolverTol = SolverTol*(1.0/LinSysRes.norm());
       }
       break;
+    case GCRO_DR:
+      IterLinSol = system->GCRODR_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, config->GetLinear_Solver_Restart_Frequency(),
+                                            MaxIter, config->GetLinear_Solver_Recycle_Size(), system->GetRecycle_Space(),
+                                            &System_Residual, Screen_Output);
+      break;
     }
 
     /*--- Dealocate memory of the Krylov subspace method ---*/
@@ -9637,8 +10295,6 @@ void CElasticityMovement::Solve_System(CGeometry *geometry, CConfig *config){
 
   }
 
-  delete system;
-
   /*--- Set number of iterations in the mesh update. ---*/
 
   nIterMesh = IterLinSol;
@@ -9714,8 +10370,8 @@ void CElasticityMovement::SetMinMaxVolume(CGeometry *geometry, CConfig *config)
   su2double MaxVolume_Local = MaxVolume; MaxVolume = 0.0;
   su2double MinVolume_Local = MinVolume; MinVolume = 0.0;
   SU2_MPI::Allreduce(&ElemCounter_Local, &ElemCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MaxVolume_Local, &MaxVolume, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MinVolume_Local, &MinVolume, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 #endif
 
   /*--- Volume from  0 to 1 ---*/
@@ -36,6 +36,7 @@
  */
 
 #include "../include/interpolation_structure.hpp"
+#include "../include/adt_structure.hpp"
 
 CInterpolator::CInterpolator(void) {
   
@@ -241,10 +242,10 @@ void CInterpolator::Collect_VertexInfo(bool faces, int markDonor, int markTarget
   nBuffer_Point = MaxLocalVertex_Donor;
 
 #ifdef HAVE_MPI
-  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(Buffer_Send_Coord, nBuffer_Coord, MPI_SU2DOUBLE, Buffer_Receive_Coord, nBuffer_Coord, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   SU2_MPI::Allgather(Buffer_Send_GlobalPoint, nBuffer_Point, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalPoint, nBuffer_Point, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
   if (faces) {
-    SU2_MPI::Allgather(Buffer_Send_Normal, nBuffer_Coord, MPI_DOUBLE, Buffer_Receive_Normal, nBuffer_Coord, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_Normal, nBuffer_Coord, MPI_SU2DOUBLE, Buffer_Receive_Normal, nBuffer_Coord, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   }
 #else
   for (iVertex = 0; iVertex < nBuffer_Coord; iVertex++)
@@ -260,6 +261,157 @@ void CInterpolator::Collect_VertexInfo(bool faces, int markDonor, int markTarget
 #endif
 }
 
+void CInterpolator::Collect_NearbyVertexInfo(int markDonor, int markTarget, unsigned long nVertexDonor,
+                                             unsigned long nVertexTarget, unsigned short nDim,
+                                             vector<su2double> &donorCoord, vector<unsigned long> &donorGlobalPoint,
+                                             vector<int> &donorProc) {
+
+  unsigned long iVertex, iPoint, nLocalDonor, nDonor, iDonor;
+  unsigned short iDim;
+  int iProcessor, nProcessor = size;
+  su2double *Coord, dLow, dHigh, dMin2, dMax2, upperBound2;
+
+  const su2double largeDist = 1.0E300;
+
+  /*--- Pack the owned donor vertices and compute the bounding box of the local
+        donor patch. A rank without donor vertices keeps an inverted box. ---*/
+
+  vector<su2double> localCoord, localBox(2*nDim);
+  vector<unsigned long> localGlobalPoint;
+
+  localCoord.reserve(nVertexDonor*nDim);
+  localGlobalPoint.reserve(nVertexDonor);
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    localBox[2*iDim]   =  largeDist;
+    localBox[2*iDim+1] = -largeDist;
+  }
+
+  for (iVertex = 0; iVertex < nVertexDonor; iVertex++) {
+    iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+    if (donor_geometry->node[iPoint]->GetDomain()) {
+      localGlobalPoint.push_back(donor_geometry->node[iPoint]->GetGlobalIndex());
+      Coord = donor_geometry->node[iPoint]->GetCoord();
+      for (iDim = 0; iDim < nDim; iDim++) {
+        localCoord.push_back(Coord[iDim]);
+        localBox[2*iDim]   = min(localBox[2*iDim],   Coord[iDim]);
+        localBox[2*iDim+1] = max(localBox[2*iDim+1], Coord[iDim]);
+      }
+    }
+  }
+  nLocalDonor = localGlobalPoint.size();
+
+  /*--- Only the bounding boxes and the sizes of the donor patches are gathered on all ranks. ---*/
+
+  vector<su2double> allBox(nProcessor*2*nDim);
+  vector<unsigned long> allCount(nProcessor);
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(localBox.data(), 2*nDim, MPI_SU2DOUBLE, allBox.data(), 2*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&nLocalDonor, 1, MPI_UNSIGNED_LONG, allCount.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  allBox   = localBox;
+  allCount[0] = nLocalDonor;
+#endif
+
+  /*--- The distance from a target vertex to the farthest corner of a donor box is an
+        upper bound of the distance to its nearest donor in that box. The donor patch of
+        a rank is needed when its box is not farther away than the smallest upper bound. ---*/
+
+  vector<int> recvFrom(nProcessor, 0), sendTo(nProcessor, 0);
+  vector<su2double> minDist2(nProcessor);
+
+  for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+    iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+    if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+    Coord = target_geometry->node[iPoint]->GetCoord();
+    upperBound2 = largeDist;
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      if (allCount[iProcessor] == 0) continue;
+      const su2double *box = &allBox[iProcessor*2*nDim];
+      dMin2 = 0.0; dMax2 = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        dLow  = Coord[iDim] - box[2*iDim];
+        dHigh = box[2*iDim+1] - Coord[iDim];
+        if (dLow < 0.0)       dMin2 += dLow*dLow;
+        else if (dHigh < 0.0) dMin2 += dHigh*dHigh;
+        dMax2 += max(dLow*dLow, dHigh*dHigh);
+      }
+      minDist2[iProcessor] = dMin2;
+      upperBound2 = min(upperBound2, dMax2);
+    }
+
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+      if ((allCount[iProcessor] > 0) && (minDist2[iProcessor] <= upperBound2))
+        recvFrom[iProcessor] = 1;
+  }
+
+  /*--- Tell the donor ranks whose patch is requested. ---*/
+
+#ifdef HAVE_MPI
+  SU2_MPI::Alltoall(recvFrom.data(), 1, MPI_INT, sendTo.data(), 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  sendTo = recvFrom;
+#endif
+
+  /*--- Allocate the receive buffers, the requested patches are stored contiguously by rank. ---*/
+
+  vector<unsigned long> recvOffset(nProcessor+1, 0);
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    recvOffset[iProcessor+1] = recvOffset[iProcessor] + (recvFrom[iProcessor] ? allCount[iProcessor] : 0);
+  nDonor = recvOffset[nProcessor];
+
+  donorCoord.resize(nDonor*nDim);
+  donorGlobalPoint.resize(nDonor);
+  donorProc.resize(nDonor);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
+    for (iDonor = recvOffset[iProcessor]; iDonor < recvOffset[iProcessor+1]; iDonor++)
+      donorProc[iDonor] = iProcessor;
+
+  if (recvFrom[rank]) {
+    for (iDonor = 0; iDonor < nLocalDonor; iDonor++) {
+      donorGlobalPoint[recvOffset[rank]+iDonor] = localGlobalPoint[iDonor];
+      for (iDim = 0; iDim < nDim; iDim++)
+        donorCoord[(recvOffset[rank]+iDonor)*nDim+iDim] = localCoord[iDonor*nDim+iDim];
+    }
+  }
+
+#ifdef HAVE_MPI
+
+  /*--- Point-to-point exchange of the donor patches between the overlapping ranks. ---*/
+
+  vector<SU2_MPI::Request> commReqs;
+  commReqs.reserve(4*nProcessor);
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    if ((iProcessor == rank) || !recvFrom[iProcessor] || (allCount[iProcessor] == 0)) continue;
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&donorCoord[recvOffset[iProcessor]*nDim], allCount[iProcessor]*nDim, MPI_SU2DOUBLE,
+                   iProcessor, iProcessor, MPI_COMM_WORLD, &commReqs.back());
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&donorGlobalPoint[recvOffset[iProcessor]], allCount[iProcessor], MPI_UNSIGNED_LONG,
+                   iProcessor, iProcessor+nProcessor, MPI_COMM_WORLD, &commReqs.back());
+  }
+
+  for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+    if ((iProcessor == rank) || !sendTo[iProcessor] || (nLocalDonor == 0)) continue;
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(localCoord.data(), nLocalDonor*nDim, MPI_SU2DOUBLE,
+                   iProcessor, rank, MPI_COMM_WORLD, &commReqs.back());
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(localGlobalPoint.data(), nLocalDonor, MPI_UNSIGNED_LONG,
+                   iProcessor, rank+nProcessor, MPI_COMM_WORLD, &commReqs.back());
+  }
+
+  if (!commReqs.empty())
+    SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+
+#endif
+}
+
 int CInterpolator::Find_InterfaceMarker(CConfig *config, unsigned short val_marker_interface) {
     
   unsigned short nMarker = config->GetnMarker_All();
@@ -428,7 +580,7 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
       SU2_MPI::Recv(&Buffer_Receive_LinkedNodes[tmp_index_2], iTmp2, MPI_UNSIGNED_LONG, iRank, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
       SU2_MPI::Recv(                         &iTmp,         1, MPI_UNSIGNED_LONG, iRank, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
-      SU2_MPI::Recv(&Buffer_Receive_Coord[tmp_index*nDim], nDim*iTmp,        MPI_DOUBLE, iRank, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      SU2_MPI::Recv(&Buffer_Receive_Coord[tmp_index*nDim], nDim*iTmp,        MPI_SU2DOUBLE, iRank, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
       
       SU2_MPI::Recv(     &Buffer_Receive_GlobalPoint[tmp_index], iTmp, MPI_UNSIGNED_LONG, iRank, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
       SU2_MPI::Recv(    &Buffer_Receive_nLinkedNodes[tmp_index], iTmp, MPI_UNSIGNED_LONG, iRank, 1, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
@@ -448,7 +600,7 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
     SU2_MPI::Send(Buffer_Send_LinkedNodes, nLocalLinkedNodes, MPI_UNSIGNED_LONG, 0, 1, MPI_COMM_WORLD);
     
     SU2_MPI::Send(    &nLocalVertex,                   1, MPI_UNSIGNED_LONG, 0, 0, MPI_COMM_WORLD);
-    SU2_MPI::Send(Buffer_Send_Coord, nDim * nLocalVertex,        MPI_DOUBLE, 0, 1, MPI_COMM_WORLD);
+    SU2_MPI::Send(Buffer_Send_Coord, nDim * nLocalVertex,        MPI_SU2DOUBLE, 0, 1, MPI_COMM_WORLD);
       
     SU2_MPI::Send(     Buffer_Send_GlobalPoint, nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, MPI_COMM_WORLD);
     SU2_MPI::Send(    Buffer_Send_nLinkedNodes, nLocalVertex, MPI_UNSIGNED_LONG, 0, 1, MPI_COMM_WORLD);
@@ -496,7 +648,7 @@ void CInterpolator::ReconstructBoundary(unsigned long val_zone, int val_marker){
   }
 
 #ifdef HAVE_MPI    
-  SU2_MPI::Bcast(      Buffer_Receive_Coord, nGlobalVertex * nDim,        MPI_DOUBLE, 0, MPI_COMM_WORLD);
+  SU2_MPI::Bcast(      Buffer_Receive_Coord, nGlobalVertex * nDim,        MPI_SU2DOUBLE, 0, MPI_COMM_WORLD);
   SU2_MPI::Bcast(Buffer_Receive_GlobalPoint, nGlobalVertex,        MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD);
   SU2_MPI::Bcast(      Buffer_Receive_Proc, nGlobalVertex,        MPI_UNSIGNED_LONG, 0, MPI_COMM_WORLD );
   
@@ -594,15 +746,13 @@ CNearestNeighbor::~CNearestNeighbor() {}
 
 void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
 
-  int iProcessor, pProcessor, nProcessor = size;
   int markDonor, markTarget;
 
-  unsigned short nDim, iMarkerInt, nMarkerInt, iDonor;    
+  unsigned short nDim, iMarkerInt, nMarkerInt, iDonor, iDim;
 
-  unsigned long nVertexDonor, nVertexTarget, Point_Target, jVertex, iVertexTarget;
-  unsigned long Global_Point_Donor, pGlobalPoint=0;
+  unsigned long nVertexDonor, nVertexTarget, Point_Target, iVertexTarget, nLocalTarget, iTarget;
 
-  su2double *Coord_i, *Coord_j, dist, mindist, maxdist;
+  su2double *Coord_i;
 
   /*--- Initialize variables --- */
   
@@ -611,9 +761,6 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
   nDim = donor_geometry->GetnDim();
 
   iDonor = 0;
-  
-  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
-
 
   /*--- Cycle over nMarkersInt interface to determine communication pattern ---*/
 
@@ -639,76 +786,61 @@ void CNearestNeighbor::Set_TransferCoeff(CConfig **config) {
       nVertexTarget = target_geometry->GetnVertex( markTarget );
     else
       nVertexTarget  = 0;
-    
-    Buffer_Send_nVertex_Donor  = new unsigned long [ 1 ];
 
-    /* Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor */
-    Determine_ArraySize(false, markDonor, markTarget, nVertexDonor, nDim);
+    /*-- Collect coordinates and global points of the donor patches near the local target vertices ---*/
+    vector<su2double> donorCoord;
+    vector<unsigned long> donorGlobalPoint;
+    vector<int> donorProc;
 
-    Buffer_Send_Coord          = new su2double     [ MaxLocalVertex_Donor * nDim ];
-    Buffer_Send_GlobalPoint    = new unsigned long [ MaxLocalVertex_Donor ];
-    Buffer_Receive_Coord       = new su2double     [ nProcessor * MaxLocalVertex_Donor * nDim ];
-    Buffer_Receive_GlobalPoint = new unsigned long [ nProcessor * MaxLocalVertex_Donor ];
+    Collect_NearbyVertexInfo(markDonor, markTarget, nVertexDonor, nVertexTarget, nDim,
+                             donorCoord, donorGlobalPoint, donorProc);
 
-    /*-- Collect coordinates, global points, and normal vectors ---*/
-    Collect_VertexInfo( false, markDonor, markTarget, nVertexDonor, nDim );
-
-    /*--- Compute the closest point to a Near-Field boundary point ---*/
-    maxdist = 0.0;
+    /*--- Gather the coordinates of the owned target vertices ---*/
+    vector<unsigned long> targetVertex;
+    vector<su2double> targetCoord;
 
     for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
-
       Point_Target = target_geometry->vertex[markTarget][iVertexTarget]->GetNode();
-
       if ( target_geometry->node[Point_Target]->GetDomain() ) {
-
-        target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
-        target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo(); // Possible meme leak?
-
-        /*--- Coordinates of the boundary point ---*/
+        targetVertex.push_back(iVertexTarget);
         Coord_i = target_geometry->node[Point_Target]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++)
+          targetCoord.push_back(Coord_i[iDim]);
+      }
+    }
+    nLocalTarget = targetVertex.size();
 
-        mindist    = 1E6; 
-        pProcessor = 0;
+    if ((nLocalTarget == 0) || donorGlobalPoint.empty()) continue;
 
-        /*--- Loop over all the boundaries to find the pair ---*/
+    /*--- Compute the closest point to a Near-Field boundary point with a local ADT
+          of the collected donor vertices, the point IDs index the collected buffers ---*/
+    vector<unsigned long> donorIndex(donorGlobalPoint.size());
+    for (iTarget = 0; iTarget < donorIndex.size(); iTarget++) donorIndex[iTarget] = iTarget;
 
-        for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-          for (jVertex = 0; jVertex < MaxLocalVertex_Donor; jVertex++) {
-            Global_Point_Donor = iProcessor*MaxLocalVertex_Donor+jVertex;
+    CADTPointsOnlyClass donorADT(nDim, donorIndex.size(), donorCoord.data(), donorIndex.data(), false);
 
-            Coord_j = &Buffer_Receive_Coord[ Global_Point_Donor*nDim];
+    vector<su2double> minDist(nLocalTarget);
+    vector<unsigned long> nearestDonor(nLocalTarget);
+    vector<int> nearestRank(nLocalTarget);
 
-            dist = PointsDistance(Coord_i, Coord_j);
+    donorADT.DetermineNearestNodes(nLocalTarget, targetCoord.data(), minDist.data(),
+                                   nearestDonor.data(), nearestRank.data());
 
-            if (dist < mindist) {
-              mindist = dist; pProcessor = iProcessor; pGlobalPoint = Buffer_Receive_GlobalPoint[Global_Point_Donor];
-            }
+    /*--- Store the value of the pair ---*/
+    for (iTarget = 0; iTarget < nLocalTarget; iTarget++) {
 
-            if (dist == 0.0) break;
-          }
+      iVertexTarget = targetVertex[iTarget];
 
-        }
+      target_geometry->vertex[markTarget][iVertexTarget]->SetnDonorPoints(1);
+      target_geometry->vertex[markTarget][iVertexTarget]->Allocate_DonorInfo(); // Possible meme leak?
 
-        /*--- Store the value of the pair ---*/
-        maxdist = max(maxdist, mindist);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, pGlobalPoint);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, pProcessor);
-        target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, 1.0);
-      }
+      target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorPoint(iDonor, donorGlobalPoint[nearestDonor[iTarget]]);
+      target_geometry->vertex[markTarget][iVertexTarget]->SetInterpDonorProcessor(iDonor, donorProc[nearestDonor[iTarget]]);
+      target_geometry->vertex[markTarget][iVertexTarget]->SetDonorCoeff(iDonor, 1.0);
     }
 
-    delete[] Buffer_Send_Coord;
-    delete[] Buffer_Send_GlobalPoint;
-    
-    delete[] Buffer_Receive_Coord;
-    delete[] Buffer_Receive_GlobalPoint;
-
-    delete[] Buffer_Send_nVertex_Donor;
-
   }
 
-  delete[] Buffer_Receive_nVertex_Donor;
 }
 
 
@@ -1413,7 +1545,7 @@ void CMirror::Set_TransferCoeff(CConfig **config) {
 #ifdef HAVE_MPI
     SU2_MPI::Allgather(Buffer_Send_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceNodes, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_GlobalPoint, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG,Buffer_Receive_GlobalPoint, MaxFaceNodes_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-    SU2_MPI::Allgather(Buffer_Send_Coeff, MaxFaceNodes_Donor, MPI_DOUBLE,Buffer_Receive_Coeff, MaxFaceNodes_Donor, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(Buffer_Send_Coeff, MaxFaceNodes_Donor, MPI_SU2DOUBLE,Buffer_Receive_Coeff, MaxFaceNodes_Donor, MPI_SU2DOUBLE, MPI_COMM_WORLD);
     SU2_MPI::Allgather(Buffer_Send_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, Buffer_Receive_FaceIndex, MaxFace_Donor, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
 #else
     for (iFace=0; iFace<MaxFace_Donor; iFace++) {
@@ -1528,7 +1660,7 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -1633,6 +1765,49 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
     Donor_LinkedNodes      = Buffer_Receive_LinkedNodes;
     Donor_Proc             = Buffer_Receive_Proc;
 
+    /*--- Position of each global target point in the reconstructed target boundary ---*/
+
+    map<unsigned long, unsigned long> Target_Position;
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      Target_Position.insert(make_pair(Target_GlobalPoint[jVertexTarget], jVertexTarget));
+
+    /*--- Closest donor node of each owned target node, searched in a local ADT of the
+          reconstructed donor boundary instead of looping over all the donor nodes ---*/
+
+    vector<unsigned long> Donor_StartIndex(nVertexTarget, 0);
+
+    if (nGlobalVertex_Donor > 0) {
+
+      vector<unsigned long> ownedTarget;
+      vector<su2double> ownedTargetCoord;
+
+      for (iVertex = 0; iVertex < nVertexTarget; iVertex++) {
+        target_iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (target_geometry->node[target_iPoint]->GetDomain()) {
+          ownedTarget.push_back(iVertex);
+          for (iDim = 0; iDim < nDim; iDim++)
+            ownedTargetCoord.push_back(target_geometry->node[target_iPoint]->GetCoord(iDim));
+        }
+      }
+
+      vector<unsigned long> donorID(nGlobalVertex_Donor);
+      for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++)
+        donorID[donor_iPoint] = donor_iPoint;
+
+      CADTPointsOnlyClass donorADT(nDim, nGlobalVertex_Donor, DonorPoint_Coord, donorID.data(), false);
+
+      vector<su2double> nearestDist(ownedTarget.size());
+      vector<unsigned long> nearestDonor(ownedTarget.size());
+      vector<int> nearestRank(ownedTarget.size());
+
+      if (!ownedTarget.empty())
+        donorADT.DetermineNearestNodes(ownedTarget.size(), ownedTargetCoord.data(), nearestDist.data(),
+                                       nearestDonor.data(), nearestRank.data());
+
+      for (ii = 0; ii < ownedTarget.size(); ii++)
+        Donor_StartIndex[ownedTarget[ii]] = nearestDonor[ii];
+    }
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -1662,29 +1837,9 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
 
         if (target_geometry->node[target_iPoint]->GetDomain()){
 
-          Coord_i = target_geometry->node[target_iPoint]->GetCoord();
-
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
+          /*--- Closest donor_node ---*/
 
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
+          donor_StartIndex = Donor_StartIndex[iVertex];
 
           donor_iPoint    = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
@@ -1692,9 +1847,7 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
           /*--- Contruct information regarding the target cell ---*/
           
           dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if( dPoint == Target_GlobalPoint[jVertexTarget] )
-              break;
+          jVertexTarget = Target_Position[dPoint];
             
           if ( Target_nLinkedNodes[jVertexTarget] == 1 ){
             target_segment[0] = Target_LinkedNodes[ Target_StartLinkedNodes[jVertexTarget] ];
@@ -1924,10 +2077,7 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
             Coord_i[iDim] = target_geometry->node[target_iPoint]->GetCoord(iDim);
           
           dPoint = target_geometry->node[target_iPoint]->GetGlobalIndex();
-          for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++){
-            if( dPoint == Target_GlobalPoint[target_iPoint] )
-              break;
-          }        
+          target_iPoint = Target_Position[dPoint];
         
           /*--- Build local surface dual mesh for target element ---*/
         
@@ -1941,27 +2091,9 @@ void CSlidingMesh::Set_TransferCoeff(CConfig **config){
             
           nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes, TargetPoint_Coord, target_iPoint, target_element);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
- 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-        
-            Coord_j = &DonorPoint_Coord[ donor_iPoint * nDim ];
-
-            dist = PointsDistance(Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;  
-              donor_StartIndex = donor_iPoint;
-            }
+          /*--- Closest donor_node ---*/
 
-            if (dist == 0.0){
-              donor_StartIndex = donor_iPoint;
-              break;
-            }    
-          }
+          donor_StartIndex = Donor_StartIndex[iVertex];
                 
           donor_iPoint = donor_StartIndex;
 
@@ -2735,6 +2867,12 @@ CRadialBasisFunction::~CRadialBasisFunction() {}
 
 void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 
+  /*--- Compactly supported bases can be interpolated from local problems ---*/
+  if (config[donorZone]->GetRadialBasisFunctionSparse()) {
+    Set_TransferCoeff_Sparse(config);
+    return;
+  }
+
   int iProcessor, nProcessor = size;
   int nPolynomial = 0;
   int mark_donor, mark_target, target_check, donor_check;
@@ -2904,7 +3042,7 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
     
 #ifdef HAVE_MPI
     if (rank != MASTER_NODE) {
-    	SU2_MPI::Send(local_M, nLocalM, MPI_DOUBLE, MASTER_NODE, 0, MPI_COMM_WORLD);
+    	SU2_MPI::Send(local_M, nLocalM, MPI_SU2DOUBLE, MASTER_NODE, 0, MPI_COMM_WORLD);
     }
     
     /*--- Assemble global_M ---*/
@@ -2922,7 +3060,7 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
       if (nProcessor > SINGLE_NODE) {
         for (iProcessor=1; iProcessor<nProcessor; iProcessor++) {
           Buffer_recv_local_M = new su2double[nLocalM_arr[iProcessor]];
-          SU2_MPI::Recv(Buffer_recv_local_M, nLocalM_arr[iProcessor], MPI_DOUBLE, iProcessor, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+          SU2_MPI::Recv(Buffer_recv_local_M, nLocalM_arr[iProcessor], MPI_SU2DOUBLE, iProcessor, 0, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
 
           /*--- Copy processor's local_M to global_M ---*/
           for (iLocalM=0; iLocalM<nLocalM_arr[iProcessor]; iLocalM++) {
@@ -3063,7 +3201,7 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
       C_inv_trunc = new su2double [(nGlobalVertexDonor+nPolynomial+1)*nGlobalVertexDonor];
     }
 
-  	SU2_MPI::Bcast(C_inv_trunc, (nGlobalVertexDonor+nPolynomial+1)*nGlobalVertexDonor, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  	SU2_MPI::Bcast(C_inv_trunc, (nGlobalVertexDonor+nPolynomial+1)*nGlobalVertexDonor, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #endif
     
     /*--- Calculate H matrix ---*/
@@ -3181,6 +3319,208 @@ void CRadialBasisFunction::Set_TransferCoeff(CConfig **config) {
 #endif
 }
 
+void CRadialBasisFunction::Set_TransferCoeff_Sparse(CConfig **config) {
+
+  int iProcessor, nProcessor = size;
+  int nPolynomial = 0, iPoly;
+  int mark_donor, mark_target;
+
+  unsigned short iDim, nDim, iMarkerInt, nMarkerInt;
+
+  unsigned long iVertexDonor, iVertexTarget, iLocal, jLocal, iCount, jCount;
+  unsigned long nVertexDonor, nVertexTarget, nGlobalVertexDonor, nLocal, nSystem;
+  unsigned long point_target;
+
+  su2double interface_coord_tol=1e6*numeric_limits<double>::epsilon();
+  su2double *Coord_t, dist, searchRadius;
+
+  const unsigned short kindRBF = config[donorZone]->GetKindRadialBasisFunction();
+  const su2double radius = config[donorZone]->GetRadialBasisFunctionParameter();
+  const bool polynomial = config[donorZone]->GetRadialBasisFunctionPolynomialOption();
+
+  /*--- Initialize variables --- */
+
+  nMarkerInt = (int) ( config[donorZone]->GetMarker_n_ZoneInterface() / 2 );
+
+  nDim = donor_geometry->GetnDim();
+
+  Buffer_Receive_nVertex_Donor = new unsigned long [nProcessor];
+
+  int *skip_row = new int [nDim+1], *calc_polynomial_check = new int [nDim];
+  skip_row[0] = 1;
+  for (iDim = 0; iDim < nDim; iDim++) skip_row[iDim+1] = 0;
+
+  /*--- Cycle over nMarkersInt interface to determine communication pattern ---*/
+
+  for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
+
+    /*--- On the donor side: find the tag of the boundary sharing the interface ---*/
+    mark_donor  = Find_InterfaceMarker(config[donorZone],  iMarkerInt);
+
+    /*--- On the target side: find the tag of the boundary sharing the interface ---*/
+    mark_target = Find_InterfaceMarker(config[targetZone], iMarkerInt);
+
+    /*--- Checks if the zone contains the interface, if not continue to the next step ---*/
+    if( !CheckInterfaceBoundary(mark_donor, mark_target) )
+      continue;
+
+    if(mark_donor != -1)
+      nVertexDonor  = donor_geometry->GetnVertex( mark_donor );
+    else
+      nVertexDonor  = 0;
+
+    if(mark_target != -1)
+      nVertexTarget = target_geometry->GetnVertex( mark_target );
+    else
+      nVertexTarget  = 0;
+
+    Buffer_Send_nVertex_Donor  = new unsigned long [ 1 ];
+
+    /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor ---*/
+    Determine_ArraySize(false, mark_donor, mark_target, nVertexDonor, nDim);
+
+    /*-- Collect coordinates, global points, and normal vectors ---*/
+    Buffer_Send_Coord          = new su2double     [ MaxLocalVertex_Donor * nDim ];
+    Buffer_Send_GlobalPoint    = new unsigned long [ MaxLocalVertex_Donor ];
+    Buffer_Receive_Coord       = new su2double     [ nProcessor * MaxLocalVertex_Donor * nDim ];
+    Buffer_Receive_GlobalPoint = new unsigned long [ nProcessor * MaxLocalVertex_Donor ];
+
+    Collect_VertexInfo( false, mark_donor, mark_target, nVertexDonor, nDim);
+
+    /*--- Donor points of all the ranks, sorted along the first coordinate for the range searches ---*/
+
+    vector<unsigned long> donorBuffer;
+    vector<int> donorProc;
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      for (iVertexDonor = 0; iVertexDonor < Buffer_Receive_nVertex_Donor[iProcessor]; iVertexDonor++) {
+        donorBuffer.push_back(iProcessor*MaxLocalVertex_Donor+iVertexDonor);
+        donorProc.push_back(iProcessor);
+      }
+    }
+    nGlobalVertexDonor = donorBuffer.size();
+
+    vector<pair<passivedouble, unsigned long> > sortedDonor(nGlobalVertexDonor);
+    for (iVertexDonor = 0; iVertexDonor < nGlobalVertexDonor; iVertexDonor++)
+      sortedDonor[iVertexDonor] = make_pair(SU2_TYPE::GetValue(Buffer_Receive_Coord[donorBuffer[iVertexDonor]*nDim]), iVertexDonor);
+    sort(sortedDonor.begin(), sortedDonor.end());
+
+    vector<unsigned long> localDonor;
+    vector<su2double> P;
+    vector<passivedouble> target_vec;
+
+    for (iVertexTarget = 0; iVertexTarget < nVertexTarget; iVertexTarget++) {
+
+      point_target = target_geometry->vertex[mark_target][iVertexTarget]->GetNode();
+
+      if ( !target_geometry->node[point_target]->GetDomain() ) continue;
+
+      Coord_t = target_geometry->node[point_target]->GetCoord();
+
+      /*--- The inverse of the compactly supported interpolation matrix decays quickly away from
+            its diagonal, so the weights of the target point only depend on the donor points whose
+            support overlaps the support of the donors that see the target, i.e. those within two
+            radii. The search is widened if there are not enough points for the polynomial term. ---*/
+
+      searchRadius = 2.0*radius;
+
+      while (true) {
+        localDonor.clear();
+
+        vector<pair<passivedouble, unsigned long> >::const_iterator it =
+          lower_bound(sortedDonor.begin(), sortedDonor.end(),
+                      make_pair(SU2_TYPE::GetValue(Coord_t[0]-searchRadius), (unsigned long) 0));
+
+        for (; (it != sortedDonor.end()) && (it->first <= SU2_TYPE::GetValue(Coord_t[0]+searchRadius)); it++) {
+          dist = PointsDistance(Coord_t, &Buffer_Receive_Coord[donorBuffer[it->second]*nDim]);
+          if (dist <= searchRadius) localDonor.push_back(it->second);
+        }
+
+        if ((localDonor.size() >= (unsigned long)(nDim+2)) || (localDonor.size() == nGlobalVertexDonor)) break;
+        searchRadius *= 2.0;
+      }
+      nLocal = localDonor.size();
+
+      /*--- Polynomial part of the local problem, linear terms of a plane of points are removed ---*/
+
+      nPolynomial = -1;
+      if (polynomial) {
+        P.resize(nLocal*(nDim+1));
+        for (iLocal = 0; iLocal < nLocal; iLocal++) {
+          P[iLocal*(nDim+1)] = 1.0;
+          for (iDim = 0; iDim < nDim; iDim++)
+            P[iLocal*(nDim+1)+iDim+1] = Buffer_Receive_Coord[donorBuffer[localDonor[iLocal]]*nDim+iDim];
+        }
+        Check_PolynomialTerms(nDim+1, nLocal, skip_row, interface_coord_tol, calc_polynomial_check, nPolynomial, P.data());
+      }
+      nSystem = nLocal + nPolynomial + 1;
+
+      /*--- Assemble and invert the local interpolation matrix [M P; P' 0] ---*/
+
+      CSymmetricMatrix local_M;
+      local_M.Initialize((int)nSystem);
+
+      for (iLocal = 0; iLocal < nLocal; iLocal++) {
+        for (jLocal = iLocal; jLocal < nLocal; jLocal++)
+          local_M.Write((int)iLocal, (int)jLocal,
+                        Get_RadialBasisValue(kindRBF, radius,
+                                             PointsDistance(&Buffer_Receive_Coord[donorBuffer[localDonor[iLocal]]*nDim],
+                                                            &Buffer_Receive_Coord[donorBuffer[localDonor[jLocal]]*nDim])));
+        for (iPoly = 0; iPoly <= nPolynomial; iPoly++)
+          local_M.Write((int)iLocal, (int)nLocal+iPoly, P[iLocal*(nPolynomial+1)+iPoly]);
+      }
+
+      local_M.Invert(!polynomial);
+
+      /*--- The weights are the first nLocal entries of the inverse times [phi(x_t); p(x_t)] ---*/
+
+      target_vec.assign(nSystem, 0.0);
+      for (iLocal = 0; iLocal < nLocal; iLocal++)
+        target_vec[iLocal] = SU2_TYPE::GetValue(Get_RadialBasisValue(kindRBF, radius,
+                               PointsDistance(Coord_t, &Buffer_Receive_Coord[donorBuffer[localDonor[iLocal]]*nDim])));
+      if (polynomial) {
+        iCount = nLocal;
+        target_vec[iCount++] = 1.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          if (calc_polynomial_check[iDim] == 1)
+            target_vec[iCount++] = SU2_TYPE::GetValue(Coord_t[iDim]);
+      }
+
+      local_M.MatVecMult(target_vec.data());
+
+      iCount = 0;
+      for (iLocal = 0; iLocal < nLocal; iLocal++)
+        if (target_vec[iLocal] != 0.0) iCount++;
+
+      target_geometry->vertex[mark_target][iVertexTarget]->SetnDonorPoints(iCount);
+      target_geometry->vertex[mark_target][iVertexTarget]->Allocate_DonorInfo();
+
+      jCount = 0;
+      for (iLocal = 0; iLocal < nLocal; iLocal++) {
+        if (target_vec[iLocal] != 0.0) {
+          target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorPoint(jCount, Buffer_Receive_GlobalPoint[donorBuffer[localDonor[iLocal]]]);
+          target_geometry->vertex[mark_target][iVertexTarget]->SetInterpDonorProcessor(jCount, donorProc[localDonor[iLocal]]);
+          target_geometry->vertex[mark_target][iVertexTarget]->SetDonorCoeff(jCount, target_vec[iLocal]);
+          jCount++;
+        }
+      }
+    }
+
+    delete[] Buffer_Send_Coord;
+    delete[] Buffer_Send_GlobalPoint;
+
+    delete[] Buffer_Receive_Coord;
+    delete[] Buffer_Receive_GlobalPoint;
+
+    delete[] Buffer_Send_nVertex_Donor;
+
+  } // end loop over markers
+
+  delete[] skip_row;
+  delete[] calc_polynomial_check;
+
+  delete[] Buffer_Receive_nVertex_Donor;
+}
+
 void CRadialBasisFunction::Check_PolynomialTerms(int m, unsigned long n, const int *skip_row, su2double max_diff_tol_in, int *keep_row, int &n_polynomial, su2double *P)
 {
   /*--- This routine keeps the AD information in P but the calculations are done in passivedouble as their purpose
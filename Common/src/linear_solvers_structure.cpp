@@ -38,29 +38,31 @@
 #include "../include/linear_solvers_structure.hpp"
 #include "../include/linear_solvers_structure_b.hpp"
 
-void CSysSolve::ApplyGivens(const su2double & s, const su2double & c, su2double & h1, su2double & h2) {
+template<class ScalarType>
+void CSysSolve::ApplyGivens(const ScalarType & s, const ScalarType & c, ScalarType & h1, ScalarType & h2) {
   
-  su2double temp = c*h1 + s*h2;
+  ScalarType temp = c*h1 + s*h2;
   h2 = c*h2 - s*h1;
   h1 = temp;
 }
 
-void CSysSolve::GenerateGivens(su2double & dx, su2double & dy, su2double & s, su2double & c) {
+template<class ScalarType>
+void CSysSolve::GenerateGivens(ScalarType & dx, ScalarType & dy, ScalarType & s, ScalarType & c) {
   
   if ( (dx == 0.0) && (dy == 0.0) ) {
     c = 1.0;
     s = 0.0;
   }
   else if ( fabs(dy) > fabs(dx) ) {
-    su2double tmp = dx/dy;
+    ScalarType tmp = dx/dy;
     dx = sqrt(1.0 + tmp*tmp);
-    s = Sign(1.0/dx, dy);
+    s = Sign<ScalarType>(1.0/dx, dy);
     c = tmp*s;
   }
   else if ( fabs(dy) <= fabs(dx) ) {
-    su2double tmp = dy/dx;
+    ScalarType tmp = dy/dx;
     dy = sqrt(1.0 + tmp*tmp);
-    c = Sign(1.0/dy, dx);
+    c = Sign<ScalarType>(1.0/dy, dx);
     s = tmp*c;
   }
   else {
@@ -74,8 +76,9 @@ void CSysSolve::GenerateGivens(su2double & dx, su2double & dy, su2double & s, su
   dy = 0.0;
 }
 
-void CSysSolve::SolveReduced(const int & n, const vector<vector<su2double> > & Hsbg,
-                             const vector<su2double> & rhs, vector<su2double> & x) {
+template<class ScalarType>
+void CSysSolve::SolveReduced(const int & n, const vector<vector<ScalarType> > & Hsbg,
+                             const vector<ScalarType> & rhs, vector<ScalarType> & x) {
   // initialize...
   for (int i = 0; i < n; i++)
     x[i] = rhs[i];
@@ -88,19 +91,20 @@ void CSysSolve::SolveReduced(const int & n, const vector<vector<su2double> > & H
   }
 }
 
-void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<CSysVector> & w) {
+template<class ScalarType>
+void CSysSolve::ModGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<TCSysVector<ScalarType>> & w) {
 
   bool Convergence = true;
 
   /*--- Parameter for reorthonormalization ---*/
   
-  static const su2double reorth = 0.98;
+  static const ScalarType reorth = 0.98;
   
   /*--- Get the norm of the vector being orthogonalized, and find the
   threshold for re-orthogonalization ---*/
   
-  su2double nrm = dotProd(w[i+1], w[i+1]);
-  su2double thr = nrm*reorth;
+  ScalarType nrm = dotProd(w[i+1], w[i+1]);
+  ScalarType thr = nrm*reorth;
   
   /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN ---*/
 
@@ -147,7 +151,7 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<
   /*--- Begin main Gram-Schmidt loop ---*/
   
   for (int k = 0; k < i+1; k++) {
-    su2double prod = dotProd(w[i+1], w[k]);
+    ScalarType prod = dotProd(w[i+1], w[k]);
     Hsbg[k][i] = prod;
     w[i+1].Plus_AX(-prod, w[k]);
     
@@ -177,6 +181,121 @@ void CSysSolve::ModGramSchmidt(int i, vector<vector<su2double> > & Hsbg, vector<
 
 }
 
+template<class ScalarType>
+void CSysSolve::ClassicalGramSchmidt(int i, vector<vector<ScalarType> > & Hsbg, vector<TCSysVector<ScalarType>> & w) {
+  
+  /*--- Threshold (squared) of the norm reduction for the second pass ---*/
+  
+  static const ScalarType reorth = 0.5;
+  
+  int k;
+  ScalarType nrm0, nrm;
+  ScalarType *prod = new ScalarType[i+2];
+  
+  /*--- Projections of w[i+1] on w[0:i] and its norm, in one reduction ---*/
+  
+  dotProd(w[i+1], w, i+2, prod);
+  nrm0 = prod[i+1];
+  
+  /*--- The norm of w[i+1] < 0.0 or w[i+1] = NaN, the value is global
+   so there is no need for an additional synchronization point ---*/
+  
+  if ((nrm0 <= 0.0) || (nrm0 != nrm0)) {
+    delete [] prod;
+    SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
+  }
+  
+  nrm = nrm0;
+  for (k = 0; k < i+1; k++) {
+    Hsbg[k][i] = prod[k];
+    nrm -= prod[k]*prod[k];
+    prod[k] = -prod[k];
+  }
+  
+  /*--- Subtract all the projections in one pass over w[i+1] ---*/
+  
+  w[i+1].Plus_AX(i+1, prod, w);
+  
+  /*--- Reorthogonalize if there was too much cancellation, the norm
+   is then computed with the corrected projections ---*/
+  
+  if (nrm < reorth*nrm0) {
+    dotProd(w[i+1], w, i+2, prod);
+    nrm = prod[i+1];
+    for (k = 0; k < i+1; k++) {
+      Hsbg[k][i] += prod[k];
+      nrm -= prod[k]*prod[k];
+      prod[k] = -prod[k];
+    }
+    w[i+1].Plus_AX(i+1, prod, w);
+  }
+  
+  delete [] prod;
+  
+  if (nrm < 0.0) nrm = 0.0;
+  nrm = sqrt(nrm);
+  Hsbg[i+1][i] = nrm;
+  
+  /*--- Scale the resulting vector ---*/
+  
+  w[i+1] /= nrm;
+  
+}
+
+template<class ScalarType>
+void CSysSolve::SymmetricEigen(unsigned long n, vector<vector<ScalarType> > & A, vector<ScalarType> & eigval,
+                               vector<vector<ScalarType> > & eigvec) {
+
+  unsigned long i, p, q, r;
+
+  eigval.assign(n, 0.0);
+  eigvec.assign(n, vector<ScalarType>(n, 0.0));
+  for (i = 0; i < n; i++) eigvec[i][i] = 1.0;
+
+  /*--- Sweeps of plane rotations, each one zeroes one off-diagonal pair ---*/
+
+  for (unsigned short iSweep = 0; iSweep < 50; iSweep++) {
+
+    ScalarType off = 0.0, diag = 0.0;
+    for (p = 0; p < n; p++) {
+      diag += A[p][p]*A[p][p];
+      for (q = p+1; q < n; q++) off += A[p][q]*A[p][q];
+    }
+    if (off <= 1e-28*diag) break;
+
+    for (p = 0; p < n; p++) {
+      for (q = p+1; q < n; q++) {
+
+        if (A[p][q] == 0.0) continue;
+
+        ScalarType theta = 0.5*(A[q][q]-A[p][p])/A[p][q];
+        ScalarType t = 1.0/(fabs(theta)+sqrt(theta*theta+1.0));
+        if (theta < 0.0) t = -t;
+        ScalarType c = 1.0/sqrt(t*t+1.0), s = t*c;
+
+        for (r = 0; r < n; r++) {
+          ScalarType a_p = A[r][p], a_q = A[r][q];
+          A[r][p] = c*a_p - s*a_q;
+          A[r][q] = s*a_p + c*a_q;
+        }
+        for (r = 0; r < n; r++) {
+          ScalarType a_p = A[p][r], a_q = A[q][r];
+          A[p][r] = c*a_p - s*a_q;
+          A[q][r] = s*a_p + c*a_q;
+        }
+        for (r = 0; r < n; r++) {
+          ScalarType v_p = eigvec[r][p], v_q = eigvec[r][q];
+          eigvec[r][p] = c*v_p - s*v_q;
+          eigvec[r][q] = s*v_p + c*v_q;
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < n; i++) eigval[i] = A[i][i];
+
+}
+
 void CSysSolve::WriteHeader(const string & solver, const su2double & restol, const su2double & resinit) {
   
   cout << "\n# " << solver << " residual history" << endl;
@@ -191,8 +310,9 @@ void CSysSolve::WriteHistory(const int & iter, const su2double & res, const su2d
   
 }
 
-unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                                           CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+template<class ScalarType>
+unsigned long CSysSolve::CG_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                                           TCPreconditioner<ScalarType> & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
 
   int rank = SU2_MPI::GetRank();
 
@@ -204,25 +324,25 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
   
-  CSysVector r(b);
-  CSysVector A_p(b);
+  TCSysVector<ScalarType> r(b);
+  TCSysVector<ScalarType> A_p(b);
   
   /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
   
   mat_vec(x, A_p);
   
   r -= A_p; // recall, r holds b initially
-  su2double norm_r = r.norm();
-  su2double norm0 = b.norm();
+  ScalarType norm_r = r.norm();
+  ScalarType norm0 = b.norm();
   if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
     if (rank == MASTER_NODE) cout << "CSysSolve::ConjugateGradient(): system solved by initial guess." << endl;
     return 0;
   }
   
-  su2double alpha, beta, r_dot_z;
-  CSysVector z(r);
+  ScalarType alpha, beta, r_dot_z;
+  TCSysVector<ScalarType> z(r);
   precond(r, z);
-  CSysVector p(z);
+  TCSysVector<ScalarType> p(z);
   
   /*--- Set the norm to the initial initial residual value ---*/
   
@@ -236,6 +356,11 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
     WriteHistory(i, norm_r, norm0);
   }
   
+  /*--- The product (r,z) of each iteration is the one of the previous
+   Gram-Schmidt coefficient, it is only computed here for the first one ---*/
+  
+  r_dot_z = dotProd(r, z);
+  
   /*---  Loop over all search directions ---*/
   
   for (i = 0; i < (int)m; i++) {
@@ -246,18 +371,17 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
     
     /*--- Calculate step-length alpha ---*/
     
-    r_dot_z = dotProd(r, z);
     alpha = dotProd(A_p, p);
     alpha = r_dot_z / alpha;
     
-    /*--- Update solution and residual: ---*/
+    /*--- Update solution and residual, the norm of the residual is computed
+     in the same pass ---*/
     
     x.Plus_AX(alpha, p);
-    r.Plus_AX(-alpha, A_p);
+    norm_r = r.Plus_AX_Norm(-alpha, A_p);
     
     /*--- Check if solution has converged, else output the relative residual if necessary ---*/
     
-    norm_r = r.norm();
     if (norm_r < tol*norm0) break;
     if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0)) WriteHistory(i+1, norm_r, norm0);
     
@@ -290,7 +414,7 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
     mat_vec(x, A_p);
     r = b;
     r -= A_p;
-    su2double true_res = r.norm();
+    ScalarType true_res = r.norm();
     
     if (fabs(true_res - norm_r) > tol*10.0) {
       if (rank == MASTER_NODE) {
@@ -309,8 +433,10 @@ unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMat
   
 }
 
-unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+template<class ScalarType>
+unsigned long CSysSolve::FGMRES_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                               TCPreconditioner<ScalarType> & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring,
+                               bool fused_reductions) {
 	
   int rank = SU2_MPI::GetRank();
   
@@ -332,19 +458,19 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   
   /*---  Define various arrays
 	 Note: elements in w and z are initialized to x to avoid creating
-	 a temporary CSysVector object for the copy constructor ---*/
+	 a temporary TCSysVector<ScalarType> object for the copy constructor ---*/
   
-  vector<CSysVector> w(m+1, x);
-  vector<CSysVector> z(m+1, x);
-  vector<su2double> g(m+1, 0.0);
-  vector<su2double> sn(m+1, 0.0);
-  vector<su2double> cs(m+1, 0.0);
-  vector<su2double> y(m, 0.0);
-  vector<vector<su2double> > H(m+1, vector<su2double>(m, 0.0));
+  vector<TCSysVector<ScalarType>> w(m+1, x);
+  vector<TCSysVector<ScalarType>> z(m+1, x);
+  vector<ScalarType> g(m+1, 0.0);
+  vector<ScalarType> sn(m+1, 0.0);
+  vector<ScalarType> cs(m+1, 0.0);
+  vector<ScalarType> y(m, 0.0);
+  vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
   
   /*---  Calculate the norm of the rhs vector ---*/
   
-  su2double norm0 = b.norm();
+  ScalarType norm0 = b.norm();
   
   /*---  Calculate the initial residual (actually the negative residual)
 	 and compute its norm ---*/
@@ -352,7 +478,7 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   mat_vec(x, w[0]);
   w[0] -= b;
   
-  su2double beta = w[0].norm();
+  ScalarType beta = w[0].norm();
   
   if ( (beta < tol*norm0) || (beta < eps) ) {
     
@@ -391,7 +517,7 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     
     if (beta < tol*norm0) break;
     
-    /*---  Precondition the CSysVector w[i] and store result in z[i] ---*/
+    /*---  Precondition the TCSysVector<ScalarType> w[i] and store result in z[i] ---*/
     
     precond(w[i], z[i]);
     
@@ -399,9 +525,11 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
     
     mat_vec(z[i], w[i+1]);
     
-    /*---  Modified Gram-Schmidt orthogonalization ---*/
+    /*---  Modified (one reduction per vector) or classical (one fused
+     reduction) Gram-Schmidt orthogonalization ---*/
     
-    ModGramSchmidt(i, H, w);
+    if (fused_reductions) ClassicalGramSchmidt(i, H, w);
+    else ModGramSchmidt(i, H, w);
     
     /*---  Apply old Givens rotations to new column of the Hessenberg matrix
 		 then generate the new Givens rotation matrix and apply it to
@@ -425,9 +553,7 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   /*---  Solve the least-squares system and update solution ---*/
   
   SolveReduced(i, H, g, y);
-  for (int k = 0; k < i; k++) {
-    x.Plus_AX(y[k], z[k]);
-  }
+  if (i > 0) x.Plus_AX(i, &y[0], z);
   
   if ((monitoring) && (rank == MASTER_NODE)) {
     cout << "# FGMRES final (true) residual:" << endl;
@@ -439,7 +565,7 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   if (monitoring) {
     mat_vec(x, w[0]);
     w[0] -= b;
-    su2double res = w[0].norm();
+    ScalarType res = w[0].norm();
     
     if (fabs(res - beta) > tol*10) {
       if (rank == MASTER_NODE) {
@@ -456,8 +582,9 @@ unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x,
   
 }
 
-unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
-                                           CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
+template<class ScalarType>
+unsigned long CSysSolve::BCGSTAB_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                                           TCPreconditioner<ScalarType> & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring) {
   
   int rank = SU2_MPI::GetRank();
   
@@ -469,22 +596,22 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
   
-  CSysVector r(b);
-  CSysVector r_0(b);
-  CSysVector p(b);
-  CSysVector v(b);
-  CSysVector s(b);
-  CSysVector t(b);
-  CSysVector phat(b);
-  CSysVector shat(b);
-  CSysVector A_x(b);
+  TCSysVector<ScalarType> r(b);
+  TCSysVector<ScalarType> r_0(b);
+  TCSysVector<ScalarType> p(b);
+  TCSysVector<ScalarType> v(b);
+  TCSysVector<ScalarType> s(b);
+  TCSysVector<ScalarType> t(b);
+  TCSysVector<ScalarType> phat(b);
+  TCSysVector<ScalarType> shat(b);
+  TCSysVector<ScalarType> A_x(b);
   
   /*--- Calculate the initial residual, compute norm, and check if system is already solved ---*/
   
   mat_vec(x, A_x);
   r -= A_x; r_0 = r; // recall, r holds b initially
-  su2double norm_r = r.norm();
-  su2double norm0 = b.norm();
+  ScalarType norm_r = r.norm();
+  ScalarType norm0 = b.norm();
   if ( (norm_r < tol*norm0) || (norm_r < eps) ) {
     if (rank == MASTER_NODE) cout << "CSysSolve::BCGSTAB(): system solved by initial guess." << endl;
     return 0;
@@ -492,7 +619,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
   
   /*--- Initialization ---*/
   
-  su2double alpha = 1.0, beta = 1.0, omega = 1.0, rho = 1.0, rho_prime = 1.0;
+  ScalarType alpha = 1.0, beta = 1.0, omega = 1.0, rho = 1.0, rho_prime = 1.0, rho_next, prod[2];
   
   /*--- Set the norm to the initial initial residual value ---*/
   
@@ -506,6 +633,11 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     WriteHistory(i, norm_r, norm0);
   }
   
+  /*--- rho_i = (r_{i-1}, r_0), after the first iteration it is computed
+   together with the residual norm ---*/
+  
+  rho_next = dotProd(r, r_0);
+  
   /*---  Loop over all search directions ---*/
   
   for (i = 0; i < (int)m; i++) {
@@ -516,7 +648,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     
     /*--- Compute rho_i ---*/
     
-    rho = dotProd(r, r_0);
+    rho = rho_next;
     
     /*--- Compute beta ---*/
     
@@ -524,7 +656,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     
     /*--- p_{i} = r_{i-1} + beta * p_{i-1} - beta * omega * v_{i-1} ---*/
     
-    su2double beta_omega = -beta*omega;
+    ScalarType beta_omega = -beta*omega;
     p.Equals_AX_Plus_BY(beta, p, beta_omega, v);
     p.Plus_AX(1.0, r);
     
@@ -535,7 +667,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     
     /*--- Calculate step-length alpha ---*/
     
-    su2double r_0_v = dotProd(r_0, v);
+    ScalarType r_0_v = dotProd(r_0, v);
     alpha = rho / r_0_v;
     
     /*--- s_{i} = r_{i-1} - alpha * v_{i} ---*/
@@ -549,16 +681,22 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
     
     /*--- Calculate step-length omega ---*/
     
-    omega = dotProd(t, s) / dotProd(t, t);
+    dotProd(t, s, t, prod);
+    omega = prod[0] / prod[1];
     
     /*--- Update solution and residual: ---*/
     
-    x.Plus_AX(alpha, phat); x.Plus_AX(omega, shat);
+    x.Plus_AX_Plus_BY(alpha, phat, omega, shat);
     r.Equals_AX_Plus_BY(1.0, s, -omega, t);
     
+    /*--- Norm of the residual and rho of the next iteration, in one reduction ---*/
+    
+    dotProd(r, r, r_0, prod);
+    norm_r = sqrt(prod[0]);
+    rho_next = prod[1];
+    
     /*--- Check if solution has converged, else output the relative residual if necessary ---*/
     
-    norm_r = r.norm();
     if (norm_r < tol*norm0) break;
     if (((monitoring) && (rank == MASTER_NODE)) && ((i+1) % 10 == 0) && (rank == MASTER_NODE)) WriteHistory(i+1, norm_r, norm0);
     
@@ -573,7 +711,7 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
   if (monitoring) {
     mat_vec(x, A_x);
     r = b; r -= A_x;
-    su2double true_res = r.norm();
+    ScalarType true_res = r.norm();
     
     if ((fabs(true_res - norm_r) > tol*10.0) && (rank == MASTER_NODE)) {
       cout << "# WARNING in CSysSolve::BCGSTAB_LinSolver(): " << endl;
@@ -587,14 +725,223 @@ unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x,
   return (unsigned long) i;
 }
 
-unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
+template<class ScalarType>
+unsigned long CSysSolve::GCRODR_LinSolver(const TCSysVector<ScalarType> & b, TCSysVector<ScalarType> & x, TCMatrixVectorProduct<ScalarType> & mat_vec,
+                                          TCPreconditioner<ScalarType> & precond, su2double tol, unsigned long m, unsigned long MaxIter,
+                                          unsigned short nRecycle, vector<TCSysVector<ScalarType> > & U, su2double *residual, bool monitoring) {
+
+  int rank = SU2_MPI::GetRank();
+
+  /*--- Check the subspace sizes ---*/
+
+  if ((m <= nRecycle) || (m > 5000)) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for subspace size, m = %lu (recycled space %u)", m, nRecycle);
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+
+  /*--- A space recycled from a system of another size is of no use ---*/
+
+  if (!U.empty() && (U[0].GetLocSize() != x.GetLocSize())) U.clear();
+  if (U.size() > nRecycle) U.resize(nRecycle);
+
+  unsigned long i, j, l, nCycle = 0, iter = 0, k = 0;
+
+  vector<TCSysVector<ScalarType> > w(m+1, x);
+  vector<TCSysVector<ScalarType> > z(m, x);
+  vector<TCSysVector<ScalarType> > C(U.size(), x);
+  vector<ScalarType> g(m+1, 0.0), sn(m+1, 0.0), cs(m+1, 0.0), y(m, 0.0);
+  vector<ScalarType> prod(nRecycle+1, 0.0), coef(nRecycle+1, 0.0);
+  vector<vector<ScalarType> > H(m+1, vector<ScalarType>(m, 0.0));
+  vector<vector<ScalarType> > H_raw(m+1, vector<ScalarType>(m, 0.0));
+  vector<vector<ScalarType> > B(nRecycle, vector<ScalarType>(m, 0.0));
+
+  /*--- Initial residual, its norm is the reference of the tolerance ---*/
+
+  TCSysVector<ScalarType> r(b), A_x(b);
+  mat_vec(x, A_x);
+  r -= A_x;
+
+  ScalarType norm0 = r.norm(), beta = norm0;
+
+  if ((beta < tol*b.norm()) || (beta < eps)) {
+    if (rank == MASTER_NODE) cout << "CSysSolve::GCRODR(): system solved by initial guess." << endl;
+    (*residual) = beta;
+    return 0;
+  }
+
+  /*--- Image of the recycled space under the current operator, C = A*U, orthonormalized
+   (classical Gram-Schmidt, twice) with the same combinations applied to U. Directions that
+   became dependent are dropped. ---*/
+
+  for (i = 0; i < U.size(); i++) {
+    mat_vec(U[i], C[k]);
+    ScalarType nrm_init = C[k].norm();
+    for (unsigned short iPass = 0; (iPass < 2) && (k > 0); iPass++) {
+      dotProd(C[k], C, k, &prod[0]);
+      for (l = 0; l < k; l++) coef[l] = -prod[l];
+      C[k].Plus_AX(k, &coef[0], C);
+      U[i].Plus_AX(k, &coef[0], U);
+    }
+    ScalarType nrm = C[k].norm();
+    if (nrm <= 1e-10*nrm_init) continue;
+    C[k] /= nrm;
+    U[i] /= nrm;
+    if (i != k) U[k] = U[i];
+    k++;
+  }
+  U.resize(k);
+  C.resize(k);
+
+  /*--- Minimize the residual over the recycled space ---*/
+
+  if (k > 0) {
+    dotProd(r, C, k, &prod[0]);
+    x.Plus_AX(k, &prod[0], U);
+    for (l = 0; l < k; l++) coef[l] = -prod[l];
+    r.Plus_AX(k, &coef[0], C);
+    beta = r.norm();
+  }
+
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    WriteHeader("GCRO-DR", tol, norm0);
+    WriteHistory(0, beta, norm0);
+  }
+
+  /*--- Restarted cycles of FGMRES on the operator deflated by the recycled space ---*/
+
+  while ((beta >= tol*norm0) && (iter < MaxIter)) {
+
+    unsigned long mCycle = min(m, MaxIter-iter);
+
+    w[0] = r;
+    w[0] /= beta;
+    g.assign(m+1, 0.0);
+    g[0] = beta;
+
+    for (j = 0; j < mCycle; j++) {
+
+      if (beta < tol*norm0) break;
+
+      precond(w[j], z[j]);
+      mat_vec(z[j], w[j+1]);
+
+      /*--- Project out the image of the recycled space, B = C^T*A*z ---*/
+
+      if (k > 0) {
+        dotProd(w[j+1], C, k, &prod[0]);
+        for (l = 0; l < k; l++) { B[l][j] = prod[l]; coef[l] = -prod[l]; }
+        w[j+1].Plus_AX(k, &coef[0], C);
+      }
+
+      ModGramSchmidt(j, H, w);
+      for (i = 0; i <= j+1; i++) H_raw[i][j] = H[i][j];
+
+      for (i = 0; i < j; i++)
+        ApplyGivens(sn[i], cs[i], H[i][j], H[i+1][j]);
+      GenerateGivens(H[j][j], H[j+1][j], sn[j], cs[j]);
+      ApplyGivens(sn[j], cs[j], g[j], g[j+1]);
+
+      beta = fabs(g[j+1]);
+      iter++;
+
+      if (((monitoring) && (rank == MASTER_NODE)) && (iter % 10 == 0)) WriteHistory(iter, beta, norm0);
+    }
+
+    /*--- Update of the solution, x += Z*y - U*B*y ---*/
+
+    SolveReduced(j, H, g, y);
+    if (j > 0) x.Plus_AX(j, &y[0], z);
+    if ((k > 0) && (j > 0)) {
+      for (l = 0; l < k; l++) {
+        coef[l] = 0.0;
+        for (i = 0; i < j; i++) coef[l] -= B[l][i]*y[i];
+      }
+      x.Plus_AX(k, &coef[0], U);
+    }
+
+    /*--- True residual to restart from ---*/
+
+    mat_vec(x, A_x);
+    r = b;
+    r -= A_x;
+    beta = r.norm();
+    nCycle++;
+
+    if (j == 0) break;
+  }
+
+  /*--- New recycled space from the last cycle. With W = [C, V] orthonormal, A*[U, Z] = W*G,
+   G = [I, B; 0, Hbar], and the right singular vectors of G with the smallest singular values
+   (eigenvectors of G^T*G) give the new directions. ---*/
+
+  if ((nCycle > 0) && (j >= nRecycle)) {
+
+    unsigned long n = k+j;
+    vector<vector<ScalarType> > GtG(n, vector<ScalarType>(n, 0.0)), eigvec;
+    vector<ScalarType> eigval;
+
+    for (unsigned long p = 0; p < n; p++) {
+      for (unsigned long q = p; q < n; q++) {
+        ScalarType sum = 0.0;
+        if ((p < k) && (q < k)) sum = (p == q)? 1.0 : 0.0;
+        else if (p < k) sum = B[p][q-k];
+        else if (q >= k) {
+          for (l = 0; l < k; l++) sum += B[l][p-k]*B[l][q-k];
+          for (i = 0; i <= min(p, q)-k+1; i++) sum += H_raw[i][p-k]*H_raw[i][q-k];
+        }
+        GtG[p][q] = sum;
+        GtG[q][p] = sum;
+      }
+    }
+
+    SymmetricEigen(n, GtG, eigval, eigvec);
+
+    vector<TCSysVector<ScalarType> > U_new(nRecycle, x);
+    vector<bool> taken(n, false);
+
+    for (unsigned short iVec = 0; iVec < nRecycle; iVec++) {
+      unsigned long jMin = n;
+      for (i = 0; i < n; i++)
+        if (!taken[i] && ((jMin == n) || (eigval[i] < eigval[jMin]))) jMin = i;
+      taken[jMin] = true;
+
+      for (l = 0; l < k; l++) coef[l] = eigvec[l][jMin];
+      for (i = 0; i < j; i++) y[i] = eigvec[k+i][jMin];
+      U_new[iVec].SetValZero();
+      if (k > 0) U_new[iVec].Plus_AX(k, &coef[0], U);
+      U_new[iVec].Plus_AX(j, &y[0], z);
+    }
+
+    U.swap(U_new);
+  }
+
+  if ((monitoring) && (rank == MASTER_NODE)) {
+    cout << "# GCRO-DR final (true) residual:" << endl;
+    cout << "# Iteration = " << iter << ": |res|/|res0| = " << beta/norm0 << ".\n" << endl;
+  }
+
+  (*residual) = beta;
+  return iter;
+
+}
+
+unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config,
+                               CMatrixVectorProduct *mat_vec_ext, bool build_precond, bool transposed) {
   
-  su2double SolverTol = config->GetLinear_Solver_Error(), Residual, Norm0;
+  su2double SolverTol = config->GetLinear_Solver_Error(), Residual = 0.0, Norm0, NormRhs;
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
-  unsigned long IterLinSol = 0;
+  unsigned long IterLinSol = 0, iElm;
   CMatrixVectorProduct *mat_vec;
 
-  bool TapeActive = NO;
+  bool TapeActive = NO, PassiveSolve = NO;
+
+  double tick = 0.0;
+  config->Tick(&tick);
+
+  /*--- A frozen (lagged) Jacobian keeps the preconditioner of its last assembly ---*/
+
+  if (Jacobian.GetFrozen()) build_precond = false;
 
   if (config->GetDiscrete_Adjoint()) {
 #ifdef CODI_REVERSE_TYPE
@@ -607,39 +954,123 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
     /*--- Stop the recording for the linear solver ---*/
 
     AD::StopRecording();
+
+    /*--- The solve is not recorded, with the Jacobi and ILU preconditioners
+     the Krylov iterations run on passive copies of the system ---*/
+
+    PassiveSolve = (Jacobian.GetPassive_Copy() && (mat_vec_ext == NULL) &&
+                    ((config->GetKind_Linear_Solver() == BCGSTAB) ||
+                     (config->GetKind_Linear_Solver() == FGMRES) ||
+                     (config->GetKind_Linear_Solver() == RESTARTED_FGMRES) ||
+                     (config->GetKind_Linear_Solver() == FGMRES_CGS) ||
+                     (config->GetKind_Linear_Solver() == RESTARTED_FGMRES_CGS) ||
+                     (config->GetKind_Linear_Solver() == GCRO_DR) ||
+                     (config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT)) &&
+                    ((config->GetKind_Linear_Solver_Prec() == JACOBI) ||
+                     (config->GetKind_Linear_Solver_Prec() == ILU) ||
+                     (config->GetKind_Linear_Solver_Prec() == ILU_LEVELS)));
 #endif
   }
 
+  /*--- Norm of the right hand side, to which the final residual is related ---*/
+
+  NormRhs = LinSysRes.norm();
+
+  /*--- Solve the linear system with the passive copies ---*/
+
+  if (PassiveSolve) {
+
+    Jacobian.BuildPassiveMatrix();
+    if (config->GetKind_Linear_Solver_Prec() == JACOBI) Jacobian.BuildJacobiPreconditioner();
+    else Jacobian.BuildILUPreconditioner();
+
+    CSysVectorPassive LinSysRes_psv(LinSysRes.GetNBlk(), LinSysRes.GetNBlkDomain(), LinSysRes.GetNVar(), 0.0);
+    CSysVectorPassive LinSysSol_psv(LinSysSol.GetNBlk(), LinSysSol.GetNBlkDomain(), LinSysSol.GetNVar(), 0.0);
+
+    for (iElm = 0; iElm < LinSysRes.GetLocSize(); iElm++) {
+      LinSysRes_psv[iElm] = SU2_TYPE::GetValue(LinSysRes[iElm]);
+      LinSysSol_psv[iElm] = SU2_TYPE::GetValue(LinSysSol[iElm]);
+    }
+
+    IterLinSol = Solve_Passive(Jacobian, LinSysRes_psv, LinSysSol_psv, geometry, config, config->GetKind_Linear_Solver(),
+                               config->GetKind_Linear_Solver_Prec(), SolverTol, MaxIter, transposed);
+
+    for (iElm = 0; iElm < LinSysSol.GetLocSize(); iElm++)
+      LinSysSol[iElm] = LinSysSol_psv[iElm];
+
+  }
+
   /*--- Solve the linear system using a Krylov subspace method ---*/
   
-  if (config->GetKind_Linear_Solver() == BCGSTAB ||
+  else if (config->GetKind_Linear_Solver() == BCGSTAB ||
       config->GetKind_Linear_Solver() == FGMRES ||
       config->GetKind_Linear_Solver() == RESTARTED_FGMRES ||
+      config->GetKind_Linear_Solver() == FGMRES_CGS ||
+      config->GetKind_Linear_Solver() == RESTARTED_FGMRES_CGS ||
+      config->GetKind_Linear_Solver() == GCRO_DR ||
       config->GetKind_Linear_Solver() == CONJUGATE_GRADIENT) {
     
-    mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
+    /*--- The Jacobian is always used for the preconditioner, the product
+     may be provided by the caller (e.g. Jacobian-free products). The caller
+     may also keep the preconditioner built by a previous solve. ---*/
+    
+    if (mat_vec_ext != NULL) mat_vec = mat_vec_ext;
+    else if (transposed) mat_vec = new CSysMatrixVectorProductTransposed(Jacobian, geometry, config);
+    else mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
     CPreconditioner* precond = NULL;
     
-    switch (config->GetKind_Linear_Solver_Prec()) {
-      case JACOBI:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
-      case ILU:
-        Jacobian.BuildILUPreconditioner();
-        precond = new CILUPreconditioner(Jacobian, geometry, config);
-        break;
-      case LU_SGS:
-        precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
-        break;
-      case LINELET:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CLineletPreconditioner(Jacobian, geometry, config);
-        break;
-      default:
-        Jacobian.BuildJacobiPreconditioner();
-        precond = new CJacobiPreconditioner(Jacobian, geometry, config);
-        break;
+    /*--- The transposed system is preconditioned with the transposed diagonal blocks,
+     or with the ILU factorization of the transposed matrix ---*/
+    
+    if (transposed) {
+      switch (config->GetKind_Linear_Solver_Prec()) {
+        case JACOBI:
+          if (build_precond) Jacobian.BuildJacobiPreconditioner();
+          precond = new CJacobiTransposedPreconditioner(Jacobian, geometry, config);
+          break;
+        case ILU: case ILU_LEVELS:
+          if (build_precond) Jacobian.BuildILUPreconditioner(true);
+          precond = new CILUPreconditioner(Jacobian, geometry, config);
+          break;
+        default:
+          SU2_MPI::Error("Only the JACOBI and ILU preconditioners are available for the transposed system.", CURRENT_FUNCTION);
+          break;
+      }
+    }
+    else {
+      switch (config->GetKind_Linear_Solver_Prec()) {
+        case JACOBI:
+          if (build_precond) Jacobian.BuildJacobiPreconditioner();
+          precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+          break;
+        case ILU: case ILU_LEVELS:
+          if (build_precond) Jacobian.BuildILUPreconditioner();
+          precond = new CILUPreconditioner(Jacobian, geometry, config);
+          break;
+        case LU_SGS:
+          precond = new CLU_SGSPreconditioner(Jacobian, geometry, config);
+          break;
+        case LINELET:
+          if (build_precond) Jacobian.BuildJacobiPreconditioner();
+          precond = new CLineletPreconditioner(Jacobian, geometry, config);
+          break;
+        case AMG:
+          if (build_precond) Jacobian.BuildAMGPreconditioner();
+          precond = new CAMGPreconditioner(Jacobian, geometry, config);
+          break;
+        case PRESSURE_AMG:
+          if (build_precond) Jacobian.BuildPressureAMGPreconditioner(geometry, config);
+          precond = new CPressureAMGPreconditioner(Jacobian, geometry, config);
+          break;
+        case RAS:
+          if (build_precond) Jacobian.BuildRASPreconditioner(geometry, config);
+          precond = new CRASPreconditioner(Jacobian, geometry, config);
+          break;
+        default:
+          if (build_precond) Jacobian.BuildJacobiPreconditioner();
+          precond = new CJacobiPreconditioner(Jacobian, geometry, config);
+          break;
+      }
     }
     
     switch (config->GetKind_Linear_Solver()) {
@@ -652,21 +1083,29 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
       case CONJUGATE_GRADIENT:
         IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
         break;
-      case RESTARTED_FGMRES:
+      case FGMRES_CGS:
+        IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false, true);
+        break;
+      case RESTARTED_FGMRES: case RESTARTED_FGMRES_CGS:
         IterLinSol = 0;
         Norm0 = LinSysRes.norm();
         while (IterLinSol < config->GetLinear_Solver_Iter()) {
           /*--- Enforce a hard limit on total number of iterations ---*/
           MaxIter = min(config->GetLinear_Solver_Restart_Frequency(), config->GetLinear_Solver_Iter()-IterLinSol);
-          IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
+          IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false,
+                                         (config->GetKind_Linear_Solver() == RESTARTED_FGMRES_CGS));
           if ( Residual < SolverTol*Norm0 ) break;
         }
         break;
+      case GCRO_DR:
+        IterLinSol = GCRODR_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, SolverTol, config->GetLinear_Solver_Restart_Frequency(),
+                                      MaxIter, config->GetLinear_Solver_Recycle_Size(), Recycle_Space, &Residual, false);
+        break;
     }
     
     /*--- Dealocate memory of the Krylov subspace method ---*/
     
-    delete mat_vec;
+    if (mat_vec_ext == NULL) delete mat_vec;
     delete precond;
     
   }
@@ -674,6 +1113,8 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   /*--- Smooth the linear system. ---*/
   
   else {
+    if (transposed)
+      SU2_MPI::Error("The smoothers are not available for the transposed system, use a Krylov method.", CURRENT_FUNCTION);
     switch (config->GetKind_Linear_Solver()) {
       case SMOOTHER_LUSGS:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
@@ -682,18 +1123,18 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
         break;
       case SMOOTHER_JACOBI:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildJacobiPreconditioner();
+        if (build_precond) Jacobian.BuildJacobiPreconditioner();
         IterLinSol = Jacobian.Jacobi_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
       case SMOOTHER_ILU:
         mat_vec = new CSysMatrixVectorProduct(Jacobian, geometry, config);
-        Jacobian.BuildILUPreconditioner();
+        if (build_precond) Jacobian.BuildILUPreconditioner();
         IterLinSol = Jacobian.ILU_Smoother(LinSysRes, LinSysSol, *mat_vec, SolverTol, MaxIter, &Residual, false, geometry, config);
         delete mat_vec;
         break;
       case SMOOTHER_LINELET:
-        Jacobian.BuildJacobiPreconditioner();
+        if (build_precond) Jacobian.BuildJacobiPreconditioner();
         Jacobian.ComputeLineletPreconditioner(LinSysRes, LinSysSol, geometry, config);
         IterLinSol = 1;
         break;
@@ -701,6 +1142,10 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
   }
 
 
+  /*--- Residual reached by the solve relative to the right hand side, used e.g. by the adaptive CFL number ---*/
+
+  Residual_Rel = (NormRhs > 0.0) ? su2double(Residual/NormRhs) : su2double(0.0);
+
   if(TapeActive) {
     /*--- Start recording if it was stopped for the linear solver ---*/
 
@@ -712,10 +1157,80 @@ unsigned long CSysSolve::Solve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CS
 
   }
 
+  config->Tock(tick, "CSysSolve::Solve", PROFILE_LINEAR_SOLVER);
+
   return IterLinSol;
   
 }
 
+unsigned long CSysSolve::Solve_Passive(CSysMatrix & Jacobian, const CSysVectorPassive & LinSysRes, CSysVectorPassive & LinSysSol, CGeometry *geometry, CConfig *config,
+                                       unsigned short kind_solver, unsigned short kind_prec, su2double tol, unsigned long MaxIter, bool transposed) {
+
+  su2double Residual = 0.0;
+  passivedouble Norm0;
+  unsigned long IterLinSol = 0, RestartIter;
+  CMatrixVectorProductPassive *mat_vec = NULL;
+  CPreconditionerPassive *precond = NULL;
+
+  if (transposed) mat_vec = new CSysMatrixVectorProductTransposedPassive(Jacobian, geometry, config);
+  else mat_vec = new CSysMatrixVectorProductPassive(Jacobian, geometry, config);
+
+  /*--- A preconditioner built from the other orientation of the matrix is applied
+   transposed, e.g. the factors of the primal system for the adjoint solve. ---*/
+
+  bool transposed_prec = (transposed != Jacobian.GetPassive_Prec_Transposed(kind_prec));
+
+  switch (kind_prec) {
+    case JACOBI:
+      if (transposed_prec) precond = new CJacobiTransposedPreconditionerPassive(Jacobian, geometry, config);
+      else precond = new CJacobiPreconditionerPassive(Jacobian, geometry, config);
+      break;
+    case ILU: case ILU_LEVELS:
+      if (transposed_prec) precond = new CILUTransposedPreconditionerPassive(Jacobian, geometry, config);
+      else precond = new CILUPreconditionerPassive(Jacobian, geometry, config);
+      break;
+    default:
+      SU2_MPI::Error("Only the Jacobi and ILU preconditioners have a passive version.", CURRENT_FUNCTION);
+      break;
+  }
+
+  switch (kind_solver) {
+    case BCGSTAB:
+      IterLinSol = BCGSTAB_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, MaxIter, &Residual, false);
+      break;
+    case FGMRES:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, MaxIter, &Residual, false);
+      break;
+    case CONJUGATE_GRADIENT:
+      IterLinSol = CG_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, MaxIter, &Residual, false);
+      break;
+    case FGMRES_CGS:
+      IterLinSol = FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, MaxIter, &Residual, false, true);
+      break;
+    case RESTARTED_FGMRES: case RESTARTED_FGMRES_CGS:
+      Norm0 = LinSysRes.norm();
+      while (IterLinSol < MaxIter) {
+        /*--- Enforce a hard limit on total number of iterations ---*/
+        RestartIter = min(config->GetLinear_Solver_Restart_Frequency(), MaxIter-IterLinSol);
+        IterLinSol += FGMRES_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, RestartIter, &Residual, false,
+                                       (kind_solver == RESTARTED_FGMRES_CGS));
+        if ( Residual < tol*Norm0 ) break;
+      }
+      break;
+    case GCRO_DR:
+      IterLinSol = GCRODR_LinSolver(LinSysRes, LinSysSol, *mat_vec, *precond, tol, config->GetLinear_Solver_Restart_Frequency(),
+                                    MaxIter, config->GetLinear_Solver_Recycle_Size(), Jacobian.GetPassive_Recycle(transposed),
+                                    &Residual, false);
+      break;
+  }
+
+  delete mat_vec;
+  delete precond;
+
+  return IterLinSol;
+
+}
+
 void CSysSolve::SetExternalSolve(CSysMatrix & Jacobian, CSysVector & LinSysRes, CSysVector & LinSysSol, CGeometry *geometry, CConfig *config) {
 
 #ifdef CODI_REVERSE_TYPE
@@ -769,14 +1284,18 @@ void CSysSolve::SetExternalSolve(CSysMatrix & Jacobian, CSysVector & LinSysRes,
   dataHandler->addData(geometry);
   dataHandler->addData(config);
 
-  /*--- Build preconditioner for the transposed Jacobian ---*/
+  /*--- The reverse solve runs on the passive copies of the matrix and preconditioner.
+   The factors of the primal solve are applied transposed if they are of the same
+   kind, otherwise the preconditioner of the transposed Jacobian is built. ---*/
+
+  Jacobian.BuildPassiveMatrix();
 
   switch(config->GetKind_DiscAdj_Linear_Prec()) {
     case ILU:
-      Jacobian.BuildILUPreconditioner(true);
+      if (!Jacobian.GetPassive_Preconditioner(ILU)) Jacobian.BuildILUPreconditioner(true);
       break;
     case JACOBI:
-      Jacobian.BuildJacobiPreconditioner(true);
+      if (!Jacobian.GetPassive_Preconditioner(JACOBI)) Jacobian.BuildJacobiPreconditioner(true);
       break;
     default:
       SU2_MPI::Error("The specified preconditioner is not yet implemented for the discrete adjoint method.", CURRENT_FUNCTION);
@@ -833,14 +1352,17 @@ void CSysSolve::SetExternalSolve_Mesh(CSysMatrix & Jacobian, CSysVector & LinSys
   dataHandler->addData(geometry);
   dataHandler->addData(config);
 
-  /*--- Build preconditioner for the transposed Jacobian ---*/
+  /*--- The reverse solve runs on the passive copies of the matrix and preconditioner,
+   the preconditioner of the primal solve is reused if it is of the same kind ---*/
+
+  Jacobian.BuildPassiveMatrix();
 
   switch(config->GetKind_DiscAdj_Linear_Prec()){
     case ILU:
-      Jacobian.BuildILUPreconditioner(false);
+      if (!Jacobian.GetPassive_Preconditioner(ILU)) Jacobian.BuildILUPreconditioner(false);
       break;
     case JACOBI:
-      Jacobian.BuildJacobiPreconditioner(false);
+      if (!Jacobian.GetPassive_Preconditioner(JACOBI)) Jacobian.BuildJacobiPreconditioner(false);
       break;
     default:
       SU2_MPI::Error("The specified preconditioner is not yet implemented for the discrete adjoint method.", CURRENT_FUNCTION);
@@ -853,3 +1375,30 @@ void CSysSolve::SetExternalSolve_Mesh(CSysMatrix & Jacobian, CSysVector & LinSys
 
 #endif
 }
+
+/*--- Explicit instantiations of the Krylov methods, the passive vectors only
+ differ from the active ones in the AD builds ---*/
+
+template unsigned long CSysSolve::CG_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                               CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring);
+template unsigned long CSysSolve::FGMRES_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                   CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring,
+                                                   bool fused_reductions);
+template unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                    CPreconditioner & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring);
+template unsigned long CSysSolve::GCRODR_LinSolver(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec,
+                                                   CPreconditioner & precond, su2double tol, unsigned long m, unsigned long MaxIter,
+                                                   unsigned short nRecycle, vector<CSysVector> & U, su2double *residual, bool monitoring);
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+template unsigned long CSysSolve::CG_LinSolver(const CSysVectorPassive & b, CSysVectorPassive & x, CMatrixVectorProductPassive & mat_vec,
+                                               CPreconditionerPassive & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring);
+template unsigned long CSysSolve::FGMRES_LinSolver(const CSysVectorPassive & b, CSysVectorPassive & x, CMatrixVectorProductPassive & mat_vec,
+                                                   CPreconditionerPassive & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring,
+                                                   bool fused_reductions);
+template unsigned long CSysSolve::BCGSTAB_LinSolver(const CSysVectorPassive & b, CSysVectorPassive & x, CMatrixVectorProductPassive & mat_vec,
+                                                    CPreconditionerPassive & precond, su2double tol, unsigned long m, su2double *residual, bool monitoring);
+template unsigned long CSysSolve::GCRODR_LinSolver(const CSysVectorPassive & b, CSysVectorPassive & x, CMatrixVectorProductPassive & mat_vec,
+                                                   CPreconditionerPassive & precond, su2double tol, unsigned long m, unsigned long MaxIter,
+                                                   unsigned short nRecycle, vector<CSysVectorPassive> & U, su2double *residual, bool monitoring);
+#endif
@@ -73,9 +73,8 @@ void CSysSolve_b::Solve_b(AD::Tape* tape, AD::CheckpointHandler* data) {
   CConfig* config      = NULL;
   data->getData(config);
 
-  CSysVector LinSysRes_b(nBlk, nBlkDomain, nVar, 0.0);
-  CSysVector LinSysSol_b(nBlk, nBlkDomain, nVar, 0.0);
-  su2double Residual;
+  CSysVectorPassive LinSysRes_b(nBlk, nBlkDomain, nVar, 0.0);
+  CSysVectorPassive LinSysSol_b(nBlk, nBlkDomain, nVar, 0.0);
 
   unsigned long MaxIter = config->GetLinear_Solver_Iter();
   su2double SolverTol = config->GetLinear_Solver_Error();
@@ -88,43 +87,30 @@ void CSysSolve_b::Solve_b(AD::Tape* tape, AD::CheckpointHandler* data) {
     LinSysSol_b[i] = 0.0;
     AD::globalTape.gradient(index) = 0.0;
   }
-  /*--- Set up preconditioner and matrix-vector product ---*/
 
-  CPreconditioner* precond  = NULL;
+  /*--- Start from the solution of the previous reverse solve with this matrix,
+   successive solves of the same system have similar right hand sides ---*/
 
-  switch(config->GetKind_DiscAdj_Linear_Prec()) {
-    case ILU:
-      precond = new CILUPreconditioner(*Jacobian, geometry, config);
-      break;
-    case JACOBI:
-      precond = new CJacobiPreconditioner(*Jacobian, geometry, config);
-      break;
-  }
+  CSysVectorPassive & LinSysSol_Guess = Jacobian->GetPassive_Guess();
+  bool warm_start = (config->GetDiscAdj_Linear_WarmStart() && (LinSysSol_Guess.GetLocSize() == size));
+
+  if (warm_start) LinSysSol_b = LinSysSol_Guess;
 
-  CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProductTransposed(*Jacobian, geometry, config);
+  /*--- Solve the transposed system, with the passive copies of the matrix and
+   of the preconditioner that were made when the solve was recorded ---*/
 
   CSysSolve *solver = new CSysSolve;
 
-  /*--- Solve the system ---*/
-
-  switch(config->GetKind_DiscAdj_Linear_Solver()) {
-    case FGMRES:
-      solver->FGMRES_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, &Residual, false);
-      break;
-    case BCGSTAB:
-      solver->BCGSTAB_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, &Residual, false);
-      break;
-    case CONJUGATE_GRADIENT:
-      solver->CG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-      break;
-  }
+  solver->Solve_Passive(*Jacobian, LinSysRes_b, LinSysSol_b, geometry, config, config->GetKind_DiscAdj_Linear_Solver(),
+                        config->GetKind_DiscAdj_Linear_Prec(), SolverTol, MaxIter, true);
 
+  if (config->GetDiscAdj_Linear_WarmStart()) LinSysSol_Guess = LinSysSol_b;
 
   /*--- Update the gradients of the right-hand side of the primal linear system ---*/
 
   for (i = 0; i < size; i ++) {
     su2double::GradientData& index = LinSysRes_Indices[i];
-    AD::globalTape.gradient(index) += SU2_TYPE::GetValue(LinSysSol_b[i]);
+    AD::globalTape.gradient(index) += LinSysSol_b[i];
   }
 
 #if CODI_PRIMAL_INDEX_TAPE
@@ -134,8 +120,6 @@ void CSysSolve_b::Solve_b(AD::Tape* tape, AD::CheckpointHandler* data) {
   }
 #endif
 
-  delete mat_vec;
-  delete precond;
   delete solver;
 }
 
@@ -164,9 +148,8 @@ void CSysSolve_b::Solve_g(AD::Tape* tape, AD::CheckpointHandler* data){
   CConfig* config;
   data->getData(config);
 
-  CSysVector LinSysRes_b(nBlk, nBlkDomain, nVar, 0.0);
-  CSysVector LinSysSol_b(nBlk, nBlkDomain, nVar, 0.0);
-  su2double Residual;
+  CSysVectorPassive LinSysRes_b(nBlk, nBlkDomain, nVar, 0.0);
+  CSysVectorPassive LinSysSol_b(nBlk, nBlkDomain, nVar, 0.0);
 
   unsigned long MaxIter = config->GetDeform_Linear_Solver_Iter();
   su2double SolverTol = config->GetDeform_Linear_Solver_Error();
@@ -179,47 +162,32 @@ void CSysSolve_b::Solve_g(AD::Tape* tape, AD::CheckpointHandler* data){
     LinSysSol_b[i] = 0.0;
     AD::globalTape.gradient(index) = 0.0;
   }
-  /*--- Set up preconditioner and matrix-vector product ---*/
 
-  CPreconditioner* precond  = NULL;
+  /*--- Start from the solution of the previous reverse solve with this matrix,
+   successive solves of the same system have similar right hand sides ---*/
 
-  switch(config->GetKind_Deform_Linear_Solver_Prec()){
-    case ILU:
-      precond = new CILUPreconditioner(*Jacobian, geometry, config);
-      break;
-    case JACOBI:
-      precond = new CJacobiPreconditioner(*Jacobian, geometry, config);
-      break;
-  }
+  CSysVectorPassive & LinSysSol_Guess = Jacobian->GetPassive_Guess();
+  bool warm_start = (config->GetDiscAdj_Linear_WarmStart() && (LinSysSol_Guess.GetLocSize() == size));
+
+  if (warm_start) LinSysSol_b = LinSysSol_Guess;
 
-  CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProductTransposed(*Jacobian, geometry, config);
+  /*--- Solve the transposed system, with the passive copies of the matrix and
+   of the preconditioner that were made when the solve was recorded ---*/
 
   CSysSolve *solver = new CSysSolve;
 
-  /*--- Solve the system ---*/
-
-  switch(config->GetKind_Deform_Linear_Solver()){
-    case FGMRES:
-      solver->FGMRES_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol , MaxIter, &Residual, false);
-      break;
-    case BCGSTAB:
-      solver->BCGSTAB_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter, &Residual, false);
-      break;
-    case CONJUGATE_GRADIENT:
-      solver->CG_LinSolver(LinSysRes_b, LinSysSol_b, *mat_vec, *precond, SolverTol, MaxIter,  &Residual, false);
-      break;
-  }
+  solver->Solve_Passive(*Jacobian, LinSysRes_b, LinSysSol_b, geometry, config, config->GetKind_Deform_Linear_Solver(),
+                        config->GetKind_Deform_Linear_Solver_Prec(), SolverTol, MaxIter, true);
 
+  if (config->GetDiscAdj_Linear_WarmStart()) LinSysSol_Guess = LinSysSol_b;
 
   /*--- Update the gradients of the right-hand side of the primal linear system ---*/
 
   for (i = 0; i < size; i ++){
     su2double::GradientData& index = LinSysRes_Indices[i];
-    AD::globalTape.gradient(index) += SU2_TYPE::GetValue(LinSysSol_b[i]);
+    AD::globalTape.gradient(index) += LinSysSol_b[i];
   }
 
-  delete mat_vec;
-  delete precond;
   delete solver;
 }
 
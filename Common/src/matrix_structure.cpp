@@ -37,12 +37,276 @@
 
 #include "../include/matrix_structure.hpp"
 
+/*--- Dense block kernels. The template argument is the block size, when it is
+ not zero the loop bounds are compile-time constants and the compiler can fully
+ unroll and vectorize the loops. A zero template argument gives the generic
+ version that uses the runtime block size n. ---*/
+
+template<unsigned long nVar_, class MatType, class VecType>
+static void BlockMatVec(const MatType *matrix, const VecType *vector, VecType *product, unsigned long n) {
+  
+  const unsigned long nVar = (nVar_ != 0)? nVar_ : n;
+  unsigned long iVar, jVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    product[iVar] = 0.0;
+    for (jVar = 0; jVar < nVar; jVar++)
+      product[iVar] += VecType(matrix[iVar*nVar+jVar]) * vector[jVar];
+  }
+  
+}
+
+template<unsigned long nVar_, class ScalarType>
+static void BlockMatVecAdd(const ScalarType *matrix, const ScalarType *vector, ScalarType *product, unsigned long n) {
+  
+  const unsigned long nVar = (nVar_ != 0)? nVar_ : n;
+  unsigned long iVar, jVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
+  
+}
+
+template<unsigned long nVar_>
+static void BlockMatMat(const su2double *matrix_a, const su2double *matrix_b, su2double *product, unsigned long n) {
+  
+  const unsigned long nVar = (nVar_ != 0)? nVar_ : n;
+  unsigned long iVar, jVar, kVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nVar; jVar++) {
+      product[iVar*nVar+jVar] = 0.0;
+      for (kVar = 0; kVar < nVar; kVar++)
+        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
+    }
+  }
+  
+}
+
+template<unsigned long nVar_>
+static void BlockGaussElim(su2double *block, su2double *rhs, unsigned long n) {
+  
+  const long nVar = (nVar_ != 0)? nVar_ : n;
+  long iVar, jVar, kVar;
+  su2double weight, aux;
+  
+  if (nVar == 1) {
+    rhs[0] /= block[0];
+    return;
+  }
+  
+  /*--- Transform system in Upper Matrix ---*/
+  
+  for (iVar = 1; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
+      for (kVar = jVar; kVar < nVar; kVar++)
+        block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
+      rhs[iVar] -= weight*rhs[jVar];
+    }
+  }
+  
+  /*--- Backwards substitution ---*/
+  
+  rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
+  for (iVar = nVar-2; iVar >= 0; iVar--) {
+    aux = 0.0;
+    for (jVar = iVar+1; jVar < nVar; jVar++)
+      aux += block[iVar*nVar+jVar]*rhs[jVar];
+    rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
+  }
+  
+}
+
+template<unsigned long nVar_>
+static void BlockInverse(su2double *block, su2double *invBlock, unsigned long n) {
+  
+  /*--- Same elimination as BlockGaussElim, applied at once to all the columns
+   of the identity, which gives the same result as solving column by column. ---*/
+  
+  const long nVar = (nVar_ != 0)? nVar_ : n;
+  long iVar, jVar, kVar;
+  su2double weight, aux;
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    for (jVar = 0; jVar < nVar; jVar++)
+      invBlock[iVar*nVar+jVar] = (iVar == jVar)? 1.0 : 0.0;
+  
+  /*--- Transform system in Upper Matrix ---*/
+  
+  for (iVar = 1; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < iVar; jVar++) {
+      weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
+      for (kVar = jVar; kVar < nVar; kVar++)
+        block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
+      for (kVar = 0; kVar < nVar; kVar++)
+        invBlock[iVar*nVar+kVar] -= weight*invBlock[jVar*nVar+kVar];
+    }
+  }
+  
+  /*--- Backwards substitution ---*/
+  
+  for (kVar = 0; kVar < nVar; kVar++) {
+    for (iVar = nVar-1; iVar >= 0; iVar--) {
+      aux = 0.0;
+      for (jVar = iVar+1; jVar < nVar; jVar++)
+        aux += block[iVar*nVar+jVar]*invBlock[jVar*nVar+kVar];
+      invBlock[iVar*nVar+kVar] = (invBlock[iVar*nVar+kVar]-aux) / block[iVar*nVar+iVar];
+    }
+  }
+  
+}
+
+vector<CSysMatrixPattern*> CSysMatrixPattern::Patterns;
+
+CSysMatrixPattern::CSysMatrixPattern(CGeometry *val_geometry, unsigned long val_nPoint, unsigned short val_fill_level, bool val_EdgeConnect) {
+  
+  unsigned long iPoint, index;
+  vector<unsigned long>::iterator it;
+  vector<unsigned long> vneighs, vcol_ind;
+  
+  nPoint      = val_nPoint;
+  fill_level  = val_fill_level;
+  EdgeConnect = val_EdgeConnect;
+  geometry.push_back(val_geometry);
+  nRef        = 0;
+  
+  /*--- Create row_ptr and col_ind in one pass over the points, the neighbors
+   of each point are sorted and without repetitions ---*/
+  
+  row_ptr = new unsigned long [nPoint+1];
+  row_ptr[0] = 0;
+  
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    
+    vneighs.clear();
+    SetNeighbours(val_geometry, iPoint, 0, fill_level, EdgeConnect, vneighs);
+    vneighs.push_back(iPoint);
+    
+    sort(vneighs.begin(), vneighs.end());
+    it = unique(vneighs.begin(), vneighs.end());
+    vneighs.resize(it - vneighs.begin());
+    
+    vcol_ind.insert(vcol_ind.end(), vneighs.begin(), vneighs.end());
+    row_ptr[iPoint+1] = vcol_ind.size();
+    
+  }
+  
+  nnz = row_ptr[nPoint];
+  
+  col_ind = new unsigned long [nnz];
+  for (index = 0; index < nnz; index++) col_ind[index] = vcol_ind[index];
+  
+}
+
+CSysMatrixPattern::~CSysMatrixPattern(void) {
+  
+  if (row_ptr != NULL) delete [] row_ptr;
+  if (col_ind != NULL) delete [] col_ind;
+  
+}
+
+CSysMatrixPattern* CSysMatrixPattern::GetPattern(CGeometry *geometry, unsigned long nPoint, unsigned short fill_level, bool EdgeConnect) {
+  
+  unsigned long iPattern, iGeom;
+  CSysMatrixPattern *pattern, *cached;
+  
+  /*--- Pattern already built for this geometry ---*/
+  
+  for (iPattern = 0; iPattern < Patterns.size(); iPattern++) {
+    cached = Patterns[iPattern];
+    if ((cached->nPoint != nPoint) || (cached->fill_level != fill_level) ||
+        (cached->EdgeConnect != EdgeConnect)) continue;
+    for (iGeom = 0; iGeom < cached->geometry.size(); iGeom++) {
+      if (cached->geometry[iGeom] == geometry) {
+        cached->nRef++;
+        return cached;
+      }
+    }
+  }
+  
+  pattern = new CSysMatrixPattern(geometry, nPoint, fill_level, EdgeConnect);
+  
+  /*--- Merge with an identical pattern of another geometry (zones or
+   instances built from the same grid) ---*/
+  
+  for (iPattern = 0; iPattern < Patterns.size(); iPattern++) {
+    cached = Patterns[iPattern];
+    if ((cached->nPoint == pattern->nPoint) && (cached->nnz == pattern->nnz) &&
+        (cached->fill_level == fill_level) && (cached->EdgeConnect == EdgeConnect) &&
+        equal(pattern->row_ptr, pattern->row_ptr+nPoint+1, cached->row_ptr) &&
+        equal(pattern->col_ind, pattern->col_ind+pattern->nnz, cached->col_ind)) {
+      delete pattern;
+      cached->geometry.push_back(geometry);
+      cached->nRef++;
+      return cached;
+    }
+  }
+  
+  pattern->nRef++;
+  Patterns.push_back(pattern);
+  return pattern;
+  
+}
+
+void CSysMatrixPattern::ReleasePattern(CSysMatrixPattern *pattern) {
+  
+  unsigned long iPattern;
+  
+  pattern->nRef--;
+  if (pattern->nRef > 0) return;
+  
+  for (iPattern = 0; iPattern < Patterns.size(); iPattern++) {
+    if (Patterns[iPattern] == pattern) {
+      Patterns.erase(Patterns.begin()+iPattern);
+      break;
+    }
+  }
+  delete pattern;
+  
+}
+
+void CSysMatrixPattern::SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsigned short deep_level, unsigned short fill_level,
+                                      bool EdgeConnect, vector<unsigned long> & vneighs) {
+  unsigned long Point, iElem, Elem;
+  unsigned short iNode;
+
+
+  if (EdgeConnect) {
+    vneighs.push_back(iPoint);
+    for (iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
+      Point = geometry->node[iPoint]->GetPoint(iNode);
+      vneighs.push_back(Point);
+      if (deep_level < fill_level) SetNeighbours(geometry, Point, deep_level+1, fill_level, EdgeConnect, vneighs);
+    }
+  }
+  else {
+    for (iElem = 0; iElem < geometry->node[iPoint]->GetnElem(); iElem++) {
+      Elem =  geometry->node[iPoint]->GetElem(iElem);
+      for (iNode = 0; iNode < geometry->elem[Elem]->GetnNodes(); iNode++) {
+        Point = geometry->elem[Elem]->GetNode(iNode);
+        vneighs.push_back(Point);
+        if (deep_level < fill_level) SetNeighbours(geometry, Point, deep_level+1, fill_level, EdgeConnect, vneighs);
+      }
+    }
+  }
+  
+}
+
 CSysMatrix::CSysMatrix(void) {
   
   size = SU2_MPI::GetSize();
   rank = SU2_MPI::GetRank();
   
   ilu_fill_in       = 0;
+  pattern           = NULL;
+  pattern_ilu       = NULL;
+  nVar              = 0;
+  nEqn              = 0;
+  frozen            = false;
+  edge_format       = false;
+  edge_geometry     = NULL;
 
   /*--- Array initialization ---*/
 
@@ -61,22 +325,58 @@ CSysMatrix::CSysMatrix(void) {
   block_weight      = NULL;
   block_inverse     = NULL;
 
+  /*--- Mixed precision preconditioners ---*/
+  
+  mixed_precision   = false;
+  ILU_matrix_flt    = NULL;
+  invM_flt          = NULL;
+
+  /*--- Passive copies for the external linear solves of AD ---*/
+  
+  passive_copy      = false;
+  matrix_psv        = NULL;
+  ILU_matrix_psv    = NULL;
+  invM_psv          = NULL;
+  aux_vector_psv    = NULL;
+  sum_vector_psv    = NULL;
+  invM_psv_current  = false;
+  ILU_psv_current   = false;
+  invM_psv_transposed = false;
+  ILU_psv_transposed  = false;
+
+  /*--- Level scheduled ILU ---*/
+  
+  ilu_levels        = false;
+
+  /*--- Threads of the row loops ---*/
+  
+  ThreadPool         = NULL;
+  ThreadScratch_Size = 0;
+  RowTask            = ROW_TASK_MATVEC;
+  RowTask_SinglePrec = false;
+  RowTask_Vec        = NULL;
+  RowTask_Prod       = NULL;
+
+  /*--- Algebraic multigrid ---*/
+  
+  nAMG_Level        = 0;
+  PressureMatrix    = NULL;
+  RAS_nRow          = 0;
+
+  /*--- Generic block kernels until the block size is known ---*/
+  
+  SetBlockKernels();
+
   /*--- Linelet preconditioner ---*/
   
   LineletBool     = NULL;
   LineletPoint    = NULL;
-  UBlock          = NULL;
-  invUBlock       = NULL;
-  LBlock          = NULL;
-  yVector         = NULL;
-  zVector         = NULL;
-  rVector         = NULL;
+  nLinelet        = 0;
   LFBlock         = NULL;
   LyVector        = NULL;
   FzVector        = NULL;
-  max_nElem       = 0;
 
-#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+#ifdef HAVE_MKL
   MatrixMatrixProductJitter 		= NULL;
   MatrixVectorProductJitterBetaOne 	= NULL;
   MatrixVectorProductJitterBetaZero 	= NULL;
@@ -87,19 +387,21 @@ CSysMatrix::CSysMatrix(void) {
 
 CSysMatrix::~CSysMatrix(void) {
   
-  unsigned long iElem;
-
   /*--- Memory deallocation ---*/
   
   if (matrix != NULL)             delete [] matrix;
   if (ILU_matrix != NULL)         delete [] ILU_matrix;
-  if (row_ptr != NULL)            delete [] row_ptr;
-  if (col_ind != NULL)            delete [] col_ind;
 
-  if (ilu_fill_in != 0) {
-    if (row_ptr_ilu != NULL) delete [] row_ptr_ilu;
-    if (col_ind_ilu != NULL) delete [] col_ind_ilu;
+  /*--- The index arrays belong to the shared patterns, unless
+   they were assigned directly with SetIndexes ---*/
+  
+  if (pattern != NULL) CSysMatrixPattern::ReleasePattern(pattern);
+  else {
+    if (row_ptr != NULL)          delete [] row_ptr;
+    if (col_ind != NULL)          delete [] col_ind;
   }
+
+  if (pattern_ilu != NULL) CSysMatrixPattern::ReleasePattern(pattern_ilu);
   
   if (block != NULL)              delete [] block;
   if (block_weight != NULL)       delete [] block_weight;
@@ -110,29 +412,25 @@ CSysMatrix::~CSysMatrix(void) {
   if (aux_vector != NULL)         delete [] aux_vector;
   if (sum_vector != NULL)         delete [] sum_vector;
   if (invM != NULL)               delete [] invM;
+  if (ILU_matrix_flt != NULL)     delete [] ILU_matrix_flt;
+  if (invM_flt != NULL)           delete [] invM_flt;
+  if (matrix_psv != NULL)         delete [] matrix_psv;
+  if (ILU_matrix_psv != NULL)     delete [] ILU_matrix_psv;
+  if (invM_psv != NULL)           delete [] invM_psv;
+  if (aux_vector_psv != NULL)     delete [] aux_vector_psv;
+  if (sum_vector_psv != NULL)     delete [] sum_vector_psv;
   if (LineletBool != NULL)        delete [] LineletBool;
   if (LineletPoint != NULL)       delete [] LineletPoint;
-  
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    if (UBlock[iElem] != NULL)      delete [] UBlock[iElem];
-    if (invUBlock[iElem] != NULL)   delete [] invUBlock[iElem];
-    if (LBlock[iElem] != NULL)      delete [] LBlock[iElem];
-    if (yVector[iElem] != NULL)     delete [] yVector[iElem];
-    if (zVector[iElem] != NULL)     delete [] zVector[iElem];
-    if (rVector[iElem] != NULL)     delete [] rVector[iElem];
-  }
-  if (UBlock != NULL)     delete [] UBlock;
-  if (invUBlock != NULL)  delete [] invUBlock;
-  if (LBlock != NULL)     delete [] LBlock;
-  if (yVector != NULL)    delete [] yVector;
-  if (zVector != NULL)    delete [] zVector;
-  if (rVector != NULL)    delete [] rVector;
 
   if (LFBlock != NULL)    delete [] LFBlock;
   if (LyVector != NULL)   delete [] LyVector;
   if (FzVector != NULL)   delete [] FzVector;
 
-#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  if (PressureMatrix != NULL) delete PressureMatrix;
+
+  if (ThreadPool != NULL) delete ThreadPool;
+
+#ifdef HAVE_MKL
   if ( MatrixMatrixProductJitter != NULL ) 		mkl_jit_destroy( MatrixMatrixProductJitter );
   if ( MatrixVectorProductJitterBetaZero != NULL ) 	mkl_jit_destroy( MatrixVectorProductJitterBetaZero );
   if ( MatrixVectorProductJitterBetaOne != NULL ) 	mkl_jit_destroy( MatrixVectorProductJitterBetaOne );
@@ -142,95 +440,58 @@ CSysMatrix::~CSysMatrix(void) {
 
 void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
                             unsigned short nVar, unsigned short nEqn,
-                            bool EdgeConnect, CGeometry *geometry, CConfig *config) {
+                            bool EdgeConnect, CGeometry *geometry, CConfig *config, bool EdgeFormat) {
 
   /*--- Don't delete *row_ptr, *col_ind because they are
-   asigned to the Jacobian structure. ---*/
+   owned by the (shared) sparsity pattern. ---*/
 
-  unsigned long iPoint, *row_ptr, *col_ind, index, nnz, Elem, iVar;
-  unsigned short iNeigh, iElem, iNode, *nNeigh, *nNeigh_ilu;
-  vector<unsigned long>::iterator it;
-  vector<unsigned long> vneighs, vneighs_ilu;
+  unsigned long iVar;
   
   /*--- Set the ILU fill in level --*/
    
   ilu_fill_in = config->GetLinear_Solver_ILU_n();
   
-  /*--- Compute the number of neighbors ---*/
-  
-  nNeigh = new unsigned short [nPoint];
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  if (EdgeFormat) {
     
-    if (EdgeConnect) {
-      nNeigh[iPoint] = (geometry->node[iPoint]->GetnPoint()+1);  // +1 -> to include diagonal element
-    }
-    else {
-      vneighs.clear();
-      for (iElem = 0; iElem < geometry->node[iPoint]->GetnElem(); iElem++) {
-        Elem =  geometry->node[iPoint]->GetElem(iElem);
-        for (iNode = 0; iNode < geometry->elem[Elem]->GetnNodes(); iNode++)
-          vneighs.push_back(geometry->elem[Elem]->GetNode(iNode));
-      }
-      vneighs.push_back(iPoint);
-      
-      sort(vneighs.begin(), vneighs.end());
-      it = unique(vneighs.begin(), vneighs.end());
-      vneighs.resize(it - vneighs.begin());
-      nNeigh[iPoint] = vneighs.size();
-    }
+    /*--- Edge format, the nPoint diagonal blocks followed by the blocks (i,j) and (j,i)
+     of each edge, the edges of the geometry take the place of the column indices ---*/
+    
+    if (!EdgeConnect || (geometry->GetnPoint() != nPoint))
+      SU2_MPI::Error("The edge format of the matrix requires the edges of the geometry.", CURRENT_FUNCTION);
+    
+    edge_format   = true;
+    edge_geometry = geometry;
+    
+    SetIndexes(nPoint, nPointDomain, nVar, nEqn, NULL, NULL, nPoint + 2*geometry->GetnEdge(), config);
     
   }
-  
-  /*--- Create row_ptr structure, using the number of neighbors ---*/
-  
-  row_ptr = new unsigned long [nPoint+1];
-  row_ptr[0] = 0;
-  for (iPoint = 0; iPoint < nPoint; iPoint++)
-    row_ptr[iPoint+1] = row_ptr[iPoint] + nNeigh[iPoint];
-  nnz = row_ptr[nPoint];
-  
-  /*--- Create col_ind structure ---*/
-  
-  col_ind = new unsigned long [nnz];
-  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+  else {
     
-    vneighs.clear();
+    /*--- Sparse structure of the matrix, built once for each geometry
+     and shared by all the matrices on the same graph ---*/
     
-    if (EdgeConnect) {
-      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++)
-        vneighs.push_back(geometry->node[iPoint]->GetPoint(iNeigh));
-      vneighs.push_back(iPoint);
-    }
-    else {
-      for (iElem = 0; iElem < geometry->node[iPoint]->GetnElem(); iElem++) {
-        Elem =  geometry->node[iPoint]->GetElem(iElem);
-        for (iNode = 0; iNode < geometry->elem[Elem]->GetnNodes(); iNode++)
-          vneighs.push_back(geometry->elem[Elem]->GetNode(iNode));
-      }
-      vneighs.push_back(iPoint);
-    }
+    pattern = CSysMatrixPattern::GetPattern(geometry, nPoint, 0, EdgeConnect);
     
-    sort(vneighs.begin(), vneighs.end());
-    it = unique(vneighs.begin(), vneighs.end());
-    vneighs.resize( it - vneighs.begin() );
+    /*--- Set the indices in the in the sparce matrix structure, and memory allocation ---*/
     
-    index = row_ptr[iPoint];
-    for (iNeigh = 0; iNeigh < vneighs.size(); iNeigh++) {
-      col_ind[index] = vneighs[iNeigh];
-      index++;
-    }
+    SetIndexes(nPoint, nPointDomain, nVar, nEqn, pattern->GetRowPtr(), pattern->GetColInd(), pattern->GetnNonZero(), config);
+    
+    /*--- Positions of the blocks updated by the edge loops ---*/
+    
+    SetBlockPointers(EdgeConnect, geometry);
     
   }
-  
-  /*--- Set the indices in the in the sparce matrix structure, and memory allocation ---*/
-  
-  SetIndexes(nPoint, nPointDomain, nVar, nEqn, row_ptr, col_ind, nnz, config);
 
   /*--- Generate MKL Kernels ---*/
   
-#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-  /*--- Create MKL JIT kernels if not using adjoint solvers ---*/
+#ifdef HAVE_MKL
+  /*--- Create MKL JIT kernels if not using adjoint solvers. With AD they are
+   only used by the products with the passive copies. ---*/
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  if (passive_copy)
+#else
   if (!config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint())
+#endif
   {
     useMKL = true;
 
@@ -250,82 +511,33 @@ void CSysMatrix::Initialize(unsigned long nPoint, unsigned long nPointDomain,
   
   SetValZero();
   
-  delete [] nNeigh;
-  
   /*--- ILU(n) preconditioner with a specific sparse structure ---*/
   
-  if (ilu_fill_in != 0) {
+  if ((ilu_fill_in != 0) && !edge_format) {
     
-    nNeigh_ilu = new unsigned short [nPoint];
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
-      
-      vneighs_ilu.clear();
-      SetNeighbours(geometry, iPoint, 0, ilu_fill_in, EdgeConnect, vneighs_ilu);
-      sort(vneighs_ilu.begin(), vneighs_ilu.end());
-      it = unique(vneighs_ilu.begin(), vneighs_ilu.end());
-      vneighs_ilu.resize(it - vneighs_ilu.begin());
-      nNeigh_ilu[iPoint] = vneighs_ilu.size();
-      
-    }
-    
-    row_ptr_ilu = new unsigned long [nPoint+1];
-    row_ptr_ilu[0] = 0;
-    for (iPoint = 0; iPoint < nPoint; iPoint++)
-      row_ptr_ilu[iPoint+1] = row_ptr_ilu[iPoint] + nNeigh_ilu[iPoint];
-    nnz_ilu = row_ptr_ilu[nPoint];
+    pattern_ilu = CSysMatrixPattern::GetPattern(geometry, nPoint, ilu_fill_in, EdgeConnect);
     
-    /*--- Create col_ind structure ---*/
-    
-    col_ind_ilu = new unsigned long [nnz_ilu];
-    for (iPoint = 0; iPoint < nPoint; iPoint++) {
-      
-      vneighs_ilu.clear();
-      SetNeighbours(geometry, iPoint, 0, ilu_fill_in, EdgeConnect, vneighs_ilu);
-      sort(vneighs_ilu.begin(), vneighs_ilu.end());
-      it = unique(vneighs_ilu.begin(), vneighs_ilu.end());
-      vneighs_ilu.resize( it - vneighs_ilu.begin() );
-      
-      index = row_ptr_ilu[iPoint];
-      for (iNeigh = 0; iNeigh < vneighs_ilu.size(); iNeigh++) {
-        col_ind_ilu[index] = vneighs_ilu[iNeigh];
-        index++;
-      }
-      
-    }
+    row_ptr_ilu = pattern_ilu->GetRowPtr();
+    col_ind_ilu = pattern_ilu->GetColInd();
+    nnz_ilu     = pattern_ilu->GetnNonZero();
     
     ILU_matrix = new su2double [nnz_ilu*nVar*nEqn];
     for (iVar = 0; iVar < nnz_ilu*nVar*nEqn; iVar++) ILU_matrix[iVar] = 0.0;
     
-    delete [] nNeigh_ilu;
-    
   }
   
 }
 
-void CSysMatrix::SetNeighbours(CGeometry *geometry, unsigned long iPoint, unsigned short deep_level, unsigned short fill_level,
-                               bool EdgeConnect, vector<unsigned long> & vneighs) {
-  unsigned long Point, iElem, Elem;
-  unsigned short iNode;
-
-
-  if (EdgeConnect) {
-    vneighs.push_back(iPoint);
-    for (iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-      Point = geometry->node[iPoint]->GetPoint(iNode);
-      vneighs.push_back(Point);
-      if (deep_level < fill_level) SetNeighbours(geometry, Point, deep_level+1, fill_level, EdgeConnect, vneighs);
-    }
-  }
-  else {
-    for (iElem = 0; iElem < geometry->node[iPoint]->GetnElem(); iElem++) {
-      Elem =  geometry->node[iPoint]->GetElem(iElem);
-      for (iNode = 0; iNode < geometry->elem[Elem]->GetnNodes(); iNode++) {
-        Point = geometry->elem[Elem]->GetNode(iNode);
-        vneighs.push_back(Point);
-        if (deep_level < fill_level) SetNeighbours(geometry, Point, deep_level+1, fill_level, EdgeConnect, vneighs);
-      }
-    }
-  }
+void CSysMatrix::Initialize_MatrixFree(unsigned long val_nPoint, unsigned long val_nPointDomain,
+                                       unsigned short val_nVar, unsigned short val_nEqn) {
+  
+  /*--- Only the sizes are needed by the halo exchanges of the vectors,
+   no sparse structure or block storage is allocated. ---*/
+  
+  nPoint       = val_nPoint;
+  nPointDomain = val_nPointDomain;
+  nVar         = val_nVar;
+  nEqn         = val_nEqn;
   
 }
 
@@ -338,10 +550,32 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   nVar         = val_nVar;          // Assign number of vars in each block system
   nEqn         = val_nEq;           // Assign number of eqns in each block system
   
+  SetBlockKernels();                // Select the block kernels for this block size
+  
   row_ptr      = val_row_ptr;       // Assign row values in the spare system structure (Jacobian structure)
   col_ind      = val_col_ind;       // Assign colums values in the spare system structure (Jacobian structure)
   nnz          = val_nnz;           // Assign number of possible non zero blocks in the spare system structure (Jacobian structure)
   
+  /*--- Single precision copies of the preconditioners. They would break the
+   derivative information, so they are never used with AD. ---*/
+  
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  mixed_precision = config->GetLinear_Solver_Mixed_Precision();
+#endif
+  
+  /*--- Passive copies of the matrix and preconditioners. The linear solves of
+   the discrete adjoint are external functions of the tape, which run on
+   these copies without the overhead of the active type. ---*/
+  
+#ifdef CODI_REVERSE_TYPE
+  passive_copy = config->GetDiscrete_Adjoint();
+#endif
+  
+  /*--- Order the ILU factorization and sweeps by level sets, the result is
+   the same as with the natural ordering. ---*/
+  
+  ilu_levels = (config->GetKind_Linear_Solver_Prec() == ILU_LEVELS);
+  
   if (ilu_fill_in == 0) {
     row_ptr_ilu  = val_row_ptr;       // Assign row values in the spare system structure (ILU structure)
     col_ind_ilu  = val_col_ind;       // Assign colums values in the spare system structure (ILU structure)
@@ -370,11 +604,18 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
   for (iVar = 0; iVar < nVar; iVar++)          aux_vector[iVar] = 0.0;
   for (iVar = 0; iVar < nVar; iVar++)          sum_vector[iVar] = 0.0;
   
+  /*--- Auxiliary arrays of the ILU sweeps (aux, sum, block and inverse block),
+   one set for the calling thread until more threads are set. ---*/
+  
+  ThreadScratch_Size = 2*nVar + 2*nVar*nEqn;
+  ThreadScratch.assign(ThreadScratch_Size, 0.0);
+  
   if (ilu_fill_in == 0) {
 
     /*--- Set specific preconditioner matrices (ILU) ---*/
     
     if ((config->GetKind_Linear_Solver_Prec() == ILU) ||
+        (config->GetKind_Linear_Solver_Prec() == ILU_LEVELS) ||
         ((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
         ((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == ILU)) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_ILU) ||
@@ -396,6 +637,7 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
       (config->GetKind_Linear_Solver_Prec() == LINELET) ||
    		((config->GetKind_SU2() == SU2_DEF) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
     	((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == JACOBI)) ||
+    	((config->GetKind_SU2() == SU2_DOT) && (config->GetKind_Deform_Linear_Solver_Prec() == AMG)) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_JACOBI) ||
       (config->GetKind_Linear_Solver() == SMOOTHER_LINELET) ||
       (config->GetDiscrete_Adjoint() && config->GetKind_DiscAdj_Linear_Solver() == JACOBI) ||
@@ -410,10 +652,251 @@ void CSysMatrix::SetIndexes(unsigned long val_nPoint, unsigned long val_nPointDo
 
 }
 
-su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
+void CSysMatrix::SetBlockKernels(void) {
+  
+  /*--- Block sizes of the usual systems: 1 (SA), 2 (SST), 3 (mesh, FEA),
+   4 and 5 (Euler, NS), 6 and 7 (coupled RANS, FEA). Any other size falls
+   back to the generic kernels. ---*/
+  
+  switch (nVar) {
+#define SU2_SET_BLOCK_KERNELS(N) \
+    MatVecBlock        = &BlockMatVec<N, su2double, su2double>;         \
+    MatVecBlock_Flt    = &BlockMatVec<N, float, su2double>;             \
+    MatVecAddBlock     = &BlockMatVecAdd<N, su2double>;                 \
+    MatVecBlock_Psv    = &BlockMatVec<N, passivedouble, passivedouble>; \
+    MatVecAddBlock_Psv = &BlockMatVecAdd<N, passivedouble>;             \
+    MatMatBlock        = &BlockMatMat<N>;            \
+    GaussElimBlock     = &BlockGaussElim<N>;         \
+    InverseBlockKernel = &BlockInverse<N>;
+    case 1: SU2_SET_BLOCK_KERNELS(1) break;
+    case 2: SU2_SET_BLOCK_KERNELS(2) break;
+    case 3: SU2_SET_BLOCK_KERNELS(3) break;
+    case 4: SU2_SET_BLOCK_KERNELS(4) break;
+    case 5: SU2_SET_BLOCK_KERNELS(5) break;
+    case 6: SU2_SET_BLOCK_KERNELS(6) break;
+    case 7: SU2_SET_BLOCK_KERNELS(7) break;
+    default: SU2_SET_BLOCK_KERNELS(0) break;
+#undef SU2_SET_BLOCK_KERNELS
+  }
+  
+}
+
+void CSysMatrix::SetThreads(unsigned short val_nThreads) {
+  
+  if (ThreadPool != NULL) delete ThreadPool;
+  ThreadPool = NULL;
+  ThreadScratch.assign(ThreadScratch_Size, 0.0);
+  
+  /*--- The row loops are shared by the threads of the rank, the calling thread
+   keeps doing all the communication. The active type of the AD builds is not
+   thread safe, hence the loops stay serial there. ---*/
+  
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  if (val_nThreads > 1) {
+    
+    ThreadPool = new CTaskThreadPool(val_nThreads, ProcessTaskChunk_Matrix, this);
+    
+    if (ThreadPool->GetnThreads() > 1) {
+      
+      ThreadScratch.assign(ThreadPool->GetnThreads()*ThreadScratch_Size, 0.0);
+      
+      /*--- The rows of one level of the ILU sweeps are independent, the result
+       is the same as with the natural ordering. ---*/
+      
+      ilu_levels = true;
+      if (ILULevel_Fwd_Ptr.empty()) BuildILULevels();
+      
+      FirstTouchValues();
+    }
+    else {
+      delete ThreadPool;
+      ThreadPool = NULL;
+    }
+  }
+#endif
+  
+}
+
+void CSysMatrix::FirstTouchValues(void) {
+  
+  /*--- The values were allocated and set to zero by the calling thread in
+   Initialize, hence they are all on its NUMA domain. ---*/
+  
+  if (matrix != NULL) { delete [] matrix; matrix = new su2double [nnz*nVar*nEqn]; }
+  if (ILU_matrix != NULL) { delete [] ILU_matrix; ILU_matrix = new su2double [nnz_ilu*nVar*nEqn]; }
+  if (invM != NULL) { delete [] invM; invM = new su2double [nPoint*nVar*nEqn]; }
+  
+  /*--- The single precision copies are otherwise allocated by the calling
+   thread when the preconditioner is built. ---*/
+  
+  if (mixed_precision) {
+    if ((ILU_matrix != NULL) && (ILU_matrix_flt == NULL)) ILU_matrix_flt = new float [nnz_ilu*nVar*nEqn];
+    if ((invM != NULL) && (invM_flt == NULL)) invM_flt = new float [nPoint*nVar*nVar];
+  }
+  
+  /*--- Same chunks as the matrix vector product, the halo rows are left to
+   the calling thread, which receives them. ---*/
+  
+  RunRowTask(ROW_TASK_FIRST_TOUCH, 0, nPointDomain);
+  FirstTouchRows(nPointDomain, nPoint);
+  
+}
+
+void CSysMatrix::FirstTouchRows(unsigned long val_begin, unsigned long val_end) {
+  
+  unsigned long index, iEdge, nEdge;
+  const unsigned long nBlock = nVar*nEqn;
+  
+  /*--- Blocks of the rows. In edge format the diagonal blocks are followed by
+   the blocks of the edges, which are split in proportion to the rows as the
+   edges are sorted by their first point. ---*/
+  
+  if (matrix != NULL) {
+    if (edge_format) {
+      for (index = val_begin*nBlock; index < val_end*nBlock; index++) matrix[index] = 0.0;
+      nEdge = (nnz - nPoint)/2;
+      for (iEdge = (val_begin*nEdge)/nPoint; iEdge < (val_end*nEdge)/nPoint; iEdge++)
+        for (index = (nPoint+2*iEdge)*nBlock; index < (nPoint+2*iEdge+2)*nBlock; index++) matrix[index] = 0.0;
+    }
+    else {
+      for (index = row_ptr[val_begin]*nBlock; index < row_ptr[val_end]*nBlock; index++) matrix[index] = 0.0;
+    }
+  }
+  
+  if ((ILU_matrix != NULL) && (row_ptr_ilu != NULL)) {
+    for (index = row_ptr_ilu[val_begin]*nBlock; index < row_ptr_ilu[val_end]*nBlock; index++) {
+      ILU_matrix[index] = 0.0;
+      if (ILU_matrix_flt != NULL) ILU_matrix_flt[index] = 0.0f;
+    }
+  }
+  
+  if (invM != NULL) {
+    for (index = val_begin*nBlock; index < val_end*nBlock; index++) invM[index] = 0.0;
+    if (invM_flt != NULL)
+      for (index = val_begin*nVar*nVar; index < val_end*nVar*nVar; index++) invM_flt[index] = 0.0f;
+  }
+  
+}
+
+void CSysMatrix::RunRowTask(unsigned short val_task, unsigned long val_begin, unsigned long val_end) {
+  
+  /*--- Ranges that are too small for the synchronization to pay off, typically
+   the last levels of the ILU sweeps, are carried out by the calling thread. ---*/
+  
+  const unsigned long MinChunkRows = 64;
+  unsigned long iChunk, nChunks = 1, nRows = val_end - val_begin;
+  
+  RowTask = val_task;
+  
+  if (ThreadPool != NULL)
+    nChunks = min((unsigned long) 4*ThreadPool->GetnThreads(), nRows/MinChunkRows);
+  
+  if (nChunks <= 1) {
+    RowTask_Range(val_begin, val_end, 0);
+    return;
+  }
+  
+  vector<unsigned long> bounds(nChunks+1);
+  for (iChunk = 0; iChunk <= nChunks; iChunk++)
+    bounds[iChunk] = val_begin + (iChunk*nRows)/nChunks;
+  
+  ThreadPool->ResetTasks(1);
+  ThreadPool->LaunchTask(0, bounds);
+  while (!ThreadPool->TaskCompleted(0)) {
+    if (!ThreadPool->RunChunk()) {
+#ifdef HAVE_PTHREAD
+      sched_yield();
+#endif
+    }
+  }
+  
+}
+
+void CSysMatrix::RowTask_Range(unsigned long val_begin, unsigned long val_end, unsigned short iThread) {
+  
+  unsigned long iRow, index, iVar, jVar, prod_begin, vec_begin, mat_begin;
+  
+  /*--- The only row loop without vectors ---*/
+  
+  if (RowTask == ROW_TASK_FIRST_TOUCH) { FirstTouchRows(val_begin, val_end); return; }
+  
+  const CSysVector & vec = *RowTask_Vec;
+  CSysVector & prod = *RowTask_Prod;
+  su2double *scratch = &ThreadScratch[iThread*ThreadScratch_Size];
+  
+  switch (RowTask) {
+      
+    case ROW_TASK_MATVEC:
+      if (edge_format) {
+        for (iRow = val_begin; iRow < val_end; iRow++) {
+          prod_begin = iRow*nVar;
+          for (iVar = 0; iVar < nVar; iVar++) prod[prod_begin+iVar] = 0.0;
+          MatVecAddBlock(&matrix[iRow*nVar*nVar], &vec[prod_begin], &prod[prod_begin], nVar);
+          EdgeRowProduct(vec, iRow, 0, &prod[prod_begin]);
+        }
+        break;
+      }
+      for (iRow = val_begin; iRow < val_end; iRow++) {
+        prod_begin = iRow*nVar; // offset to beginning of block iRow
+        for (iVar = 0; iVar < nVar; iVar++) prod[prod_begin+iVar] = 0.0;
+        for (index = row_ptr[iRow]; index < row_ptr[iRow+1]; index++) {
+          vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
+          mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[iRow][col_ind[indx]]
+#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+          if (useMKL)
+          {
+            MatrixVectorProductKernelBetaOne( MatrixVectorProductJitterBetaOne, (double *)&vec[ vec_begin ], (double *)&matrix[ mat_begin ], (double *)&prod[ prod_begin ] );
+            continue;
+          }
+#endif
+          MatVecAddBlock(&matrix[mat_begin], &vec[vec_begin], &prod[prod_begin], nVar);
+        }
+      }
+      break;
+      
+    case ROW_TASK_JACOBI:
+      for (iRow = val_begin; iRow < val_end; iRow++) {
+        for (iVar = 0; iVar < nVar; iVar++) {
+          prod[iRow*nVar+iVar] = 0.0;
+          if (mixed_precision) {
+            for (jVar = 0; jVar < nVar; jVar++)
+              prod[iRow*nVar+iVar] += su2double(invM_flt[iRow*nVar*nVar+iVar*nVar+jVar])*vec[iRow*nVar+jVar];
+          }
+          else {
+            for (jVar = 0; jVar < nVar; jVar++)
+              prod[iRow*nVar+iVar] += invM[iRow*nVar*nVar+iVar*nVar+jVar]*vec[iRow*nVar+jVar];
+          }
+        }
+      }
+      break;
+      
+    case ROW_TASK_ILU_FWD:
+      for (iRow = val_begin; iRow < val_end; iRow++)
+        ILUForwardRow(prod, ILULevel_Fwd_Row[iRow], RowTask_SinglePrec, scratch);
+      break;
+      
+    case ROW_TASK_ILU_BWD:
+      for (iRow = val_begin; iRow < val_end; iRow++)
+        ILUBackwardRow(prod, ILULevel_Bwd_Row[iRow], RowTask_SinglePrec, scratch);
+      break;
+  }
+  
+}
+
+void CSysMatrix::ProcessTaskChunk_Matrix(void *matrix, const CTaskChunk &chunk) {
+  
+  CSysMatrix *Matrix = (CSysMatrix *) matrix;
+  
+  Matrix->RowTask_Range(chunk.indBeg, chunk.indEnd, Matrix->ThreadPool->GetThreadIndex());
+  
+}
+
+su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
   
   unsigned long step = 0, index;
   
+  if (edge_format) return GetEdgeFormatBlock(block_i, block_j);
+  
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_j) { return &(matrix[(row_ptr[block_i]+step-1)*nVar*nEqn]); }
@@ -425,6 +908,12 @@ su2double *CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j) {
 su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, unsigned short iVar, unsigned short jVar) {
   
   unsigned long step = 0, index;
+  su2double *bij;
+  
+  if (edge_format) {
+    bij = GetEdgeFormatBlock(block_i, block_j);
+    return (bij != NULL)? bij[iVar*nEqn+jVar] : 0.0;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
@@ -437,6 +926,18 @@ su2double CSysMatrix::GetBlock(unsigned long block_i, unsigned long block_j, uns
 void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
+  su2double *bij;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bij = GetEdgeFormatBlock(block_i, block_j);
+    if (bij != NULL)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nEqn; jVar++)
+          bij[iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar][jVar]);
+    return;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
@@ -454,6 +955,18 @@ void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2doubl
 void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2double *val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
+  su2double *bij;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bij = GetEdgeFormatBlock(block_i, block_j);
+    if (bij != NULL)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nEqn; jVar++)
+          bij[iVar*nEqn+jVar] = SU2_TYPE::GetValue(val_block[iVar*nVar+jVar]);
+    return;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
@@ -468,9 +981,53 @@ void CSysMatrix::SetBlock(unsigned long block_i, unsigned long block_j, su2doubl
   
 }
 
+void CSysMatrix::MatrixMatrixAddition(su2double alpha, const CSysMatrix & B) {
+  
+  unsigned long index;
+  bool same_pattern;
+  
+  if (frozen) return;
+  
+  /*--- The entries are only aligned if both matrices use the same pattern,
+   which is normally the shared (cached) one ---*/
+  
+  same_pattern = (nnz == B.nnz) && (nPoint == B.nPoint) && (nVar == B.nVar) && (nEqn == B.nEqn);
+  if (same_pattern && ((row_ptr != B.row_ptr) || (col_ind != B.col_ind))) {
+    for (index = 0; index <= nPoint; index++) same_pattern = same_pattern && (row_ptr[index] == B.row_ptr[index]);
+    for (index = 0; index < nnz; index++) same_pattern = same_pattern && (col_ind[index] == B.col_ind[index]);
+  }
+  if (!same_pattern)
+    SU2_MPI::Error("The matrices do not share the same sparsity pattern.", CURRENT_FUNCTION);
+  
+  for (index = 0; index < nnz*nVar*nEqn; index++)
+    matrix[index] += SU2_TYPE::GetValue(alpha*B.matrix[index]);
+  
+}
+
 void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
+  su2double *bij;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bij = GetEdgeFormatBlock(block_i, block_j);
+    if (bij != NULL)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nEqn; jVar++)
+          bij[iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
+    return;
+  }
+  
+  /*--- Diagonal blocks (source terms, boundary conditions) without search ---*/
+  
+  if ((block_i == block_j) && !dia_ptr.empty()) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        matrix[dia_ptr[block_i]*nVar*nEqn+iVar*nEqn+jVar] += SU2_TYPE::GetValue(val_block[iVar][jVar]);
+    return;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
@@ -488,6 +1045,27 @@ void CSysMatrix::AddBlock(unsigned long block_i, unsigned long block_j, su2doubl
 void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2double **val_block) {
   
   unsigned long iVar, jVar, index, step = 0;
+  su2double *bij;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bij = GetEdgeFormatBlock(block_i, block_j);
+    if (bij != NULL)
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nEqn; jVar++)
+          bij[iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
+    return;
+  }
+  
+  /*--- Diagonal blocks (source terms, boundary conditions) without search ---*/
+  
+  if ((block_i == block_j) && !dia_ptr.empty()) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nEqn; jVar++)
+        matrix[dia_ptr[block_i]*nVar*nEqn+iVar*nEqn+jVar] -= SU2_TYPE::GetValue(val_block[iVar][jVar]);
+    return;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
@@ -502,6 +1080,176 @@ void CSysMatrix::SubtractBlock(unsigned long block_i, unsigned long block_j, su2
   
 }
 
+void CSysMatrix::SetBlockPointers(bool EdgeConnect, CGeometry *geometry) {
+  
+  unsigned long iPoint, jPoint, iEdge, index, nEdge;
+  
+  dia_ptr.assign(nPoint, 0);
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (col_ind[index] == iPoint) { dia_ptr[iPoint] = index; break; }
+  
+  /*--- The edges are only known if the matrix is built on them ---*/
+  
+  edge_ptr.clear();
+  if (!EdgeConnect || (geometry->GetnPoint() != nPoint)) return;
+  
+  nEdge = geometry->GetnEdge();
+  edge_ptr.assign(2*nEdge, 0);
+  
+  for (iEdge = 0; iEdge < nEdge; iEdge++) {
+    iPoint = geometry->GetEdge_Node(iEdge, 0);
+    jPoint = geometry->GetEdge_Node(iEdge, 1);
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (col_ind[index] == jPoint) { edge_ptr[2*iEdge] = index; break; }
+    for (index = row_ptr[jPoint]; index < row_ptr[jPoint+1]; index++)
+      if (col_ind[index] == iPoint) { edge_ptr[2*iEdge+1] = index; break; }
+  }
+  
+}
+
+su2double *CSysMatrix::GetEdgeFormatBlock(unsigned long block_i, unsigned long block_j) {
+  
+  unsigned short iNeigh;
+  unsigned long iEdge;
+  CPoint *node;
+  
+  if (block_i == block_j) return &matrix[block_i*nVar*nEqn];
+  
+  /*--- The block (i,j) is the first one of the edge if i is its first node ---*/
+  
+  node = edge_geometry->node[block_i];
+  for (iNeigh = 0; iNeigh < node->GetnPoint(); iNeigh++) {
+    if (node->GetPoint(iNeigh) == block_j) {
+      iEdge = node->GetEdge(iNeigh);
+      if (edge_geometry->GetEdge_Node(iEdge, 0) == block_i)
+        return &matrix[(nPoint+2*iEdge)*nVar*nEqn];
+      return &matrix[(nPoint+2*iEdge+1)*nVar*nEqn];
+    }
+  }
+  return NULL;
+  
+}
+
+void CSysMatrix::EdgeRowProduct(const CSysVector & vec, unsigned long row_i, short part, su2double *prod) {
+  
+  unsigned short iNeigh;
+  unsigned long iEdge, jPoint, index;
+  CPoint *node = edge_geometry->node[row_i];
+  
+  for (iNeigh = 0; iNeigh < node->GetnPoint(); iNeigh++) {
+    jPoint = node->GetPoint(iNeigh);
+    if (((part < 0) && (jPoint > row_i)) || ((part > 0) && (jPoint < row_i))) continue;
+    iEdge = node->GetEdge(iNeigh);
+    index = nPoint + 2*iEdge + ((edge_geometry->GetEdge_Node(iEdge, 0) == row_i)? 0 : 1);
+    MatVecAddBlock(&matrix[index*nVar*nEqn], &vec[jPoint*nVar], prod, nVar);
+  }
+  
+}
+
+void CSysMatrix::AddEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar, offset;
+  su2double *bii, *bij, *bji, *bjj;
+  passivedouble val_i, val_j;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bii = &matrix[iPoint*nVar*nEqn];              bij = &matrix[(nPoint+2*iEdge)*nVar*nEqn];
+    bji = &matrix[(nPoint+2*iEdge+1)*nVar*nEqn];  bjj = &matrix[jPoint*nVar*nEqn];
+  }
+  else if (edge_ptr.empty()) {
+    AddBlock(iPoint, iPoint, block_i); AddBlock(iPoint, jPoint, block_j);
+    SubtractBlock(jPoint, iPoint, block_i); SubtractBlock(jPoint, jPoint, block_j);
+    return;
+  }
+  else {
+    bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];   bij = &matrix[edge_ptr[2*iEdge]*nVar*nEqn];
+    bji = &matrix[edge_ptr[2*iEdge+1]*nVar*nEqn]; bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
+  }
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      val_i = SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      val_j = SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      bii[offset] += val_i; bij[offset] += val_j;
+      bji[offset] -= val_i; bjj[offset] -= val_j;
+    }
+  }
+  
+}
+
+void CSysMatrix::SubtractEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint, su2double **block_i, su2double **block_j) {
+  
+  unsigned long iVar, jVar, offset;
+  su2double *bii, *bij, *bji, *bjj;
+  passivedouble val_i, val_j;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bii = &matrix[iPoint*nVar*nEqn];              bij = &matrix[(nPoint+2*iEdge)*nVar*nEqn];
+    bji = &matrix[(nPoint+2*iEdge+1)*nVar*nEqn];  bjj = &matrix[jPoint*nVar*nEqn];
+  }
+  else if (edge_ptr.empty()) {
+    SubtractBlock(iPoint, iPoint, block_i); SubtractBlock(iPoint, jPoint, block_j);
+    AddBlock(jPoint, iPoint, block_i); AddBlock(jPoint, jPoint, block_j);
+    return;
+  }
+  else {
+    bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];   bij = &matrix[edge_ptr[2*iEdge]*nVar*nEqn];
+    bji = &matrix[edge_ptr[2*iEdge+1]*nVar*nEqn]; bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
+  }
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      val_i = SU2_TYPE::GetValue(block_i[iVar][jVar]);
+      val_j = SU2_TYPE::GetValue(block_j[iVar][jVar]);
+      bii[offset] -= val_i; bij[offset] -= val_j;
+      bji[offset] += val_i; bjj[offset] += val_j;
+    }
+  }
+  
+}
+
+void CSysMatrix::AddEdgeBlocks(unsigned long iEdge, unsigned long iPoint, unsigned long jPoint,
+                               const su2double *block_i, const su2double *block_j, unsigned short stride) {
+  
+  unsigned long iVar, jVar, index, offset;
+  su2double *bii, *bij, *bji, *bjj;
+  passivedouble val_i, val_j;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    bii = &matrix[iPoint*nVar*nEqn];              bij = &matrix[(nPoint+2*iEdge)*nVar*nEqn];
+    bji = &matrix[(nPoint+2*iEdge+1)*nVar*nEqn];  bjj = &matrix[jPoint*nVar*nEqn];
+  }
+  else if (edge_ptr.empty()) {
+    bii = GetBlock(iPoint, iPoint); bij = GetBlock(iPoint, jPoint);
+    bji = GetBlock(jPoint, iPoint); bjj = GetBlock(jPoint, jPoint);
+  }
+  else {
+    bii = &matrix[dia_ptr[iPoint]*nVar*nEqn];   bij = &matrix[edge_ptr[2*iEdge]*nVar*nEqn];
+    bji = &matrix[edge_ptr[2*iEdge+1]*nVar*nEqn]; bjj = &matrix[dia_ptr[jPoint]*nVar*nEqn];
+  }
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (jVar = 0; jVar < nEqn; jVar++) {
+      offset = iVar*nEqn+jVar;
+      index = (iVar*nVar+jVar)*stride;
+      val_i = SU2_TYPE::GetValue(block_i[index]);
+      val_j = SU2_TYPE::GetValue(block_j[index]);
+      bii[offset] += val_i; bij[offset] += val_j;
+      bji[offset] -= val_i; bjj[offset] -= val_j;
+    }
+  }
+  
+}
+
 su2double *CSysMatrix::GetBlock_ILUMatrix(unsigned long block_i, unsigned long block_j) {
   
   unsigned long step = 0, index;
@@ -573,16 +1321,17 @@ void CSysMatrix::MatrixVectorProduct(su2double *matrix, su2double *vector, su2do
   }
 #endif
   
-  unsigned short iVar, jVar;
+  MatVecBlock(matrix, vector, product, nVar);
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    product[iVar] = 0.0;
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar] += matrix[iVar*nVar+jVar] * vector[jVar];
-    }
-  }
+}
+
+#if !defined SINGLE_PRECISION
+void CSysMatrix::MatrixVectorProduct(float *matrix, su2double *vector, su2double *product) {
+  
+  MatVecBlock_Flt(matrix, vector, product, nVar);
   
 }
+#endif
 
 void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, su2double *product) {
 
@@ -594,16 +1343,7 @@ void CSysMatrix::MatrixMatrixProduct(su2double *matrix_a, su2double *matrix_b, s
   }
 #endif
   
-  unsigned short iVar, jVar, kVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++) {
-      product[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++) {
-        product[iVar*nVar+jVar] += matrix_a[iVar*nVar+kVar]*matrix_b[kVar*nVar+jVar];
-      }
-    }
-  }
+  MatMatBlock(matrix_a, matrix_b, product, nVar);
   
 }
 
@@ -611,6 +1351,20 @@ void CSysMatrix::AddVal2Diag(unsigned long block_i, su2double val_matrix) {
   
   unsigned long step = 0, iVar, index;
   
+  if (frozen) return;
+  
+  if (edge_format) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      matrix[block_i*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
+    return;
+  }
+  
+  if (!dia_ptr.empty()) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      matrix[dia_ptr[block_i]*nVar*nVar+iVar*nVar+iVar] += SU2_TYPE::GetValue(val_matrix);
+    return;
+  }
+  
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_i) {	// Only elements on the diagonal
@@ -627,6 +1381,15 @@ void CSysMatrix::SetVal2Diag(unsigned long block_i, su2double val_matrix) {
   
   unsigned long step = 0, iVar, jVar, index;
   
+  if (frozen) return;
+  
+  if (edge_format) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        matrix[block_i*nVar*nVar+iVar*nVar+jVar] = (iVar == jVar)? SU2_TYPE::GetValue(val_matrix) : 0.0;
+    return;
+  }
+  
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     step++;
     if (col_ind[index] == block_i) {	// Only elements on the diagonal
@@ -650,6 +1413,20 @@ void CSysMatrix::DeleteValsRowi(unsigned long i) {
   unsigned long block_i = i/nVar;
   unsigned long row = i - block_i*nVar;
   unsigned long index, iVar;
+  unsigned short iNeigh;
+  su2double *bij;
+  
+  if (frozen) return;
+  
+  if (edge_format) {
+    for (iNeigh = 0; iNeigh < edge_geometry->node[block_i]->GetnPoint(); iNeigh++) {
+      bij = GetEdgeFormatBlock(block_i, edge_geometry->node[block_i]->GetPoint(iNeigh));
+      for (iVar = 0; iVar < nVar; iVar++) bij[row*nVar+iVar] = 0.0;
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      matrix[block_i*nVar*nVar+row*nVar+iVar] = (iVar == row)? 1.0 : 0.0;
+    return;
+  }
   
   for (index = row_ptr[block_i]; index < row_ptr[block_i+1]; index++) {
     for (iVar = 0; iVar < nVar; iVar++)
@@ -758,8 +1535,7 @@ void CSysMatrix::MatrixTranspose(su2double **a, unsigned long n) {
 
 void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool transposed) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  short iVar, jVar;
   
   su2double *Block = GetBlock(block_i, block_i);
   
@@ -777,41 +1553,12 @@ void CSysMatrix::Gauss_Elimination(unsigned long block_i, su2double* rhs, bool t
   }
   /*--- Gauss elimination ---*/
   
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  GaussElimBlock(block, rhs, nVar);
   
 }
 
 void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
-  
   su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
   
   /*--- Copy block matrix, note that the original matrix
@@ -827,13 +1574,8 @@ void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* r
   
   /*--- Gauss elimination ---*/
 
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-
 #if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-  if (useMKL) {
+  if (useMKL && (nVar != 1)) {
       // With MKL_DIRECT_CALL enabled, this is significantly faster than native code on Intel Architectures.
       lapack_int * ipiv = new lapack_int [ nVar ];
       LAPACKE_dgetrf( LAPACK_ROW_MAJOR, nVar, nVar, (double *)&block[0], nVar, ipiv );
@@ -843,36 +1585,14 @@ void CSysMatrix::Gauss_Elimination_ILUMatrix(unsigned long block_i, su2double* r
       return;
   }
 #endif
-    
-    /*--- Transform system in Upper Matrix ---*/
-    
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  
+  GaussElimBlock(block, rhs, nVar);
   
 }
 
 void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
   
-  short iVar, jVar, kVar; // This is important, otherwise some compilers optimizations will fail
-  su2double weight, aux;
+  short iVar, jVar;
   
   /*--- Copy block matrix, note that the original matrix
    is modified by the algorithm---*/
@@ -881,46 +1601,17 @@ void CSysMatrix::Gauss_Elimination(su2double* Block, su2double* rhs) {
     for (jVar = 0; jVar < (short)nVar; jVar++)
       block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
   
-  
-  if (nVar == 1) {
-    rhs[0] /= block[0];
-  }
-  else {
-    /*--- Transform system in Upper Matrix ---*/
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = block[iVar*nVar+jVar] / block[jVar*nVar+jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          block[iVar*nVar+kVar] -= weight*block[jVar*nVar+kVar];
-        rhs[iVar] -= weight*rhs[jVar];
-      }
-    }
-    
-    /*--- Backwards substitution ---*/
-    rhs[nVar-1] = rhs[nVar-1] / block[nVar*nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0.0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += block[iVar*nVar+jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux) / block[iVar*nVar+iVar];
-      if (iVar == 0) break;
-    }
-  }
+  GaussElimBlock(block, rhs, nVar);
   
 }
 
 void CSysMatrix::ProdBlockVector(unsigned long block_i, unsigned long block_j, const CSysVector & vec) {
   
   unsigned long j = block_j*nVar;
-  unsigned short iVar, jVar;
   
   su2double *block = GetBlock(block_i, block_j);
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    prod_block_vector[iVar] = 0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      prod_block_vector[iVar] += block[iVar*nVar+jVar]*vec[j+jVar];
-  }
+  MatVecBlock(block, &vec[j], prod_block_vector, nVar);
   
 }
 
@@ -931,6 +1622,8 @@ void CSysMatrix::UpperProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
+  if (edge_format) { EdgeRowProduct(vec, row_i, 1, prod_row_vector); return; }
+  
   for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
     if (col_ind[index] > row_i) {
       ProdBlockVector(row_i, col_ind[index], vec);
@@ -948,6 +1641,8 @@ void CSysMatrix::LowerProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
+  if (edge_format) { EdgeRowProduct(vec, row_i, -1, prod_row_vector); return; }
+  
   for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
     if (col_ind[index] < row_i) {
       ProdBlockVector(row_i, col_ind[index], vec);
@@ -965,6 +1660,11 @@ void CSysMatrix::DiagonalProduct(CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
+  if (edge_format) {
+    MatVecAddBlock(&matrix[row_i*nVar*nEqn], &vec[row_i*nVar], prod_row_vector, nVar);
+    return;
+  }
+  
   for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
     if (col_ind[index] == row_i) {
       ProdBlockVector(row_i, col_ind[index], vec);
@@ -975,15 +1675,38 @@ void CSysMatrix::DiagonalProduct(CSysVector & vec, unsigned long row_i) {
   
 }
 
-void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config) {
+#ifdef HAVE_MPI
+
+/*--- Exchange of the halo buffers. The passive values of the AD builds bypass
+ the AD wrapper of MPI, which sends MPI_DOUBLE buffers as active types. ---*/
+
+static void SendRecvBuffers(su2double *Buffer_Send, int nBufferS, int send_to,
+                            su2double *Buffer_Receive, int nBufferR, int receive_from) {
+  SU2_MPI::Status status;
+  SU2_MPI::Sendrecv(Buffer_Send, nBufferS, MPI_SU2DOUBLE, send_to, 0,
+                    Buffer_Receive, nBufferR, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+}
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(SINGLE_PRECISION)
+static void SendRecvBuffers(passivedouble *Buffer_Send, int nBufferS, int send_to,
+                            passivedouble *Buffer_Receive, int nBufferR, int receive_from) {
+  CBaseMPIWrapper::Status status;
+  CBaseMPIWrapper::Sendrecv(Buffer_Send, nBufferS, MPI_DOUBLE, send_to, 0,
+                            Buffer_Receive, nBufferR, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+}
+#endif
+
+#endif
+
+template<class ScalarType>
+void CSysMatrix::SendReceive_Solution(TCSysVector<ScalarType> & x, CGeometry *geometry, CConfig *config) {
   
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive = NULL, *Buffer_Send = NULL;
+  ScalarType *Buffer_Receive = NULL, *Buffer_Send = NULL;
   
 #ifdef HAVE_MPI
   int send_to, receive_from;
-  SU2_MPI::Status status;
 #endif
   
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -1005,8 +1728,8 @@ void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConf
       
       /*--- Allocate Receive and send buffers  ---*/
       
-      Buffer_Receive = new su2double [nBufferR_Vector];
-      Buffer_Send = new su2double[nBufferS_Vector];
+      Buffer_Receive = new ScalarType [nBufferR_Vector];
+      Buffer_Send = new ScalarType[nBufferS_Vector];
       
       /*--- Copy the solution that should be sended ---*/
       
@@ -1020,8 +1743,7 @@ void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConf
       
       /*--- Send/Receive information using Sendrecv ---*/
       
-      SU2_MPI::Sendrecv(Buffer_Send, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SendRecvBuffers(Buffer_Send, nBufferS_Vector, send_to, Buffer_Receive, nBufferR_Vector, receive_from);
       
 #else
       
@@ -1063,15 +1785,15 @@ void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConf
   
 }
 
-void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config) {
+template<class ScalarType>
+void CSysMatrix::SendReceive_SolutionTransposed(TCSysVector<ScalarType> & x, CGeometry *geometry, CConfig *config) {
 
   unsigned short iVar, iMarker, MarkerS, MarkerR;
   unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive = NULL, *Buffer_Send = NULL;
+  ScalarType *Buffer_Receive = NULL, *Buffer_Send = NULL;
 
 #ifdef HAVE_MPI
   int send_to, receive_from;
-  SU2_MPI::Status status;
 #endif
 
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
@@ -1093,8 +1815,8 @@ void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geome
 
       /*--- Allocate Receive and send buffers  ---*/
 
-      Buffer_Receive = new su2double [nBufferR_Vector];
-      Buffer_Send = new su2double[nBufferS_Vector];
+      Buffer_Receive = new ScalarType [nBufferR_Vector];
+      Buffer_Send = new ScalarType[nBufferS_Vector];
 
       /*--- Copy the solution that should be sended ---*/
 
@@ -1108,8 +1830,7 @@ void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geome
 
       /*--- Send/Receive information using Sendrecv ---*/
 
-      SU2_MPI::Sendrecv(Buffer_Send, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SendRecvBuffers(Buffer_Send, nBufferS_Vector, send_to, Buffer_Receive, nBufferR_Vector, receive_from);
 
 #else
 
@@ -1158,6 +1879,12 @@ void CSysMatrix::RowProduct(const CSysVector & vec, unsigned long row_i) {
   for (iVar = 0; iVar < nVar; iVar++)
     prod_row_vector[iVar] = 0;
   
+  if (edge_format) {
+    MatVecAddBlock(&matrix[row_i*nVar*nEqn], &vec[row_i*nVar], prod_row_vector, nVar);
+    EdgeRowProduct(vec, row_i, 0, prod_row_vector);
+    return;
+  }
+  
   for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
     ProdBlockVector(row_i, col_ind[index], vec);
     for (iVar = 0; iVar < nVar; iVar++)
@@ -1180,7 +1907,7 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod)
 
 void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
+  unsigned long index;
   
   /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
   if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
@@ -1194,26 +1921,14 @@ void CSysMatrix::MatrixVectorProduct(const CSysVector & vec, CSysVector & prod,
     throw(-1);
   }
   
-  prod = su2double(0.0); // set all entries of prod to zero
-  for (row_i = 0; row_i < nPointDomain; row_i++) {
-    prod_begin = row_i*nVar; // offset to beginning of block row_i
-    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
-      vec_begin = col_ind[index]*nVar; // offset to beginning of block col_ind[index]
-      mat_begin = (index*nVar*nVar); // offset to beginning of matrix block[row_i][col_ind[indx]]
-#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-      if (useMKL) 
-      {
-        MatrixVectorProductKernelBetaOne( MatrixVectorProductJitterBetaOne, (double *)&vec[ vec_begin ], (double *)&matrix[ mat_begin ], (double *)&prod[ prod_begin ] );
-        continue;
-      }
-#endif
-      for (iVar = 0; iVar < nVar; iVar++) {
-        for (jVar = 0; jVar < nVar; jVar++) {
-          prod[(unsigned long)(prod_begin+iVar)] += matrix[(unsigned long)(mat_begin+iVar*nVar+jVar)]*vec[(unsigned long)(vec_begin+jVar)];
-        }
-      }
-    }
-  }
+  /*--- Rows of the domain, shared by the threads if any, the halo
+   entries are zero until they are communicated. ---*/
+  
+  RowTask_Vec  = &vec;
+  RowTask_Prod = &prod;
+  RunRowTask(ROW_TASK_MATVEC, 0, nPointDomain);
+  
+  for (index = nPointDomain*nVar; index < nPoint*nVar; index++) prod[index] = 0.0;
   
   /*--- MPI Parallelization ---*/
   SendReceive_Solution(prod, geometry, config);
@@ -1251,29 +1966,159 @@ void CSysMatrix::MatrixVectorProductTransposed(const CSysVector & vec, CSysVecto
 
 }
 
-void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
+void CSysMatrix::BuildPassiveMatrix(void) {
   
-  unsigned long iVar, jVar, kVar;
+  unsigned long index;
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    for (jVar = 0; jVar < nVar; jVar++) {
-      c[iVar*nVar+jVar] = 0.0;
-      for (kVar = 0; kVar < nVar; kVar++)
-        c[iVar*nVar+jVar] += a[iVar*nVar+kVar] * b[kVar*nVar+jVar];
+  /*--- From now on the preconditioners are also copied when they are built ---*/
+  
+  passive_copy = true;
+  
+  if (matrix_psv == NULL) {
+    matrix_psv     = new passivedouble [nnz*nVar*nEqn];
+    aux_vector_psv = new passivedouble [nVar];
+    sum_vector_psv = new passivedouble [nVar];
+  }
+  
+  for (index = 0; index < nnz*nVar*nEqn; index++)
+    matrix_psv[index] = SU2_TYPE::GetValue(matrix[index]);
+  
+}
+
+unsigned long CSysMatrix::GetMatrixMemory(void) const {
+  
+  const unsigned long nEntry = nnz*nVar*nEqn;
+  unsigned long nBytes = 0;
+  
+  if (matrix     != NULL) nBytes += nEntry*sizeof(su2double);
+  if (matrix_psv != NULL) nBytes += nEntry*sizeof(passivedouble);
+  nBytes += (dia_ptr.size() + edge_ptr.size())*sizeof(unsigned long);
+  
+  return nBytes;
+  
+}
+
+unsigned long CSysMatrix::GetPreconditionerMemory(void) const {
+  
+  const unsigned long nEntry_ILU = nnz_ilu*nVar*nEqn, nEntry_Jac = nPoint*nVar*nEqn;
+  unsigned long iLevel, nBytes = 0;
+  
+  if (ILU_matrix     != NULL) nBytes += nEntry_ILU*sizeof(su2double);
+  if (ILU_matrix_flt != NULL) nBytes += nEntry_ILU*sizeof(float);
+  if (ILU_matrix_psv != NULL) nBytes += nEntry_ILU*sizeof(passivedouble);
+  
+  if (invM     != NULL) nBytes += nEntry_Jac*sizeof(su2double);
+  if (invM_flt != NULL) nBytes += nEntry_Jac*sizeof(float);
+  if (invM_psv != NULL) nBytes += nEntry_Jac*sizeof(passivedouble);
+  
+  for (iLevel = 0; iLevel < AMG_Val.size(); iLevel++)
+    nBytes += AMG_Val[iLevel].size()*sizeof(su2double);
+  for (iLevel = 0; iLevel < AMG_InvDiag.size(); iLevel++)
+    nBytes += AMG_InvDiag[iLevel].size()*sizeof(su2double);
+  
+  nBytes += (LineletInvU.size() + LineletL.size())*sizeof(su2double);
+  
+  nBytes += (RAS_Val.size() + RAS_InvDiag.size())*sizeof(su2double) + RAS_ColInd.size()*sizeof(unsigned long);
+  
+  if (PressureMatrix != NULL)
+    nBytes += PressureMatrix->GetMatrixMemory() + PressureMatrix->GetPreconditionerMemory() +
+              (PressureCorrection.GetLocSize() + PressureResidual.GetLocSize())*sizeof(su2double);
+  
+  return nBytes;
+  
+}
+
+void CSysMatrix::MatrixVectorProduct_Passive(const passivedouble *matrix, const passivedouble *vector, passivedouble *product) {
+  
+#ifdef HAVE_MKL
+  // NOTE: matrix/vector swapped due to column major kernel -- manual "CBLAS" setup.
+  if (useMKL)
+  {
+    MatrixVectorProductKernelBetaZero( MatrixVectorProductJitterBetaZero, (double *)vector, (double *)matrix, product );
+    return;
+  }
+#endif
+  
+  MatVecBlock_Psv(matrix, vector, product, nVar);
+  
+}
+
+void CSysMatrix::MatrixVectorProduct_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long prod_begin, vec_begin, mat_begin, index, row_i;
+  
+  /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
+  if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
+    SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
+  }
+  if ( (nPoint != vec.GetNBlk()) || (nPoint != prod.GetNBlk()) ) {
+    SU2_MPI::Error("nPoint and nBlk values incompatible.", CURRENT_FUNCTION);
+  }
+  
+  /*--- Same product as with the active matrix, on the passive copy without
+   the AD types the MKL kernels can also be used ---*/
+  
+  prod = passivedouble(0.0);
+  for (row_i = 0; row_i < nPointDomain; row_i++) {
+    prod_begin = row_i*nVar;
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      vec_begin = col_ind[index]*nVar;
+      mat_begin = (index*nVar*nVar);
+#ifdef HAVE_MKL
+      if (useMKL)
+      {
+        MatrixVectorProductKernelBetaOne( MatrixVectorProductJitterBetaOne, (double *)&vec[ vec_begin ], &matrix_psv[ mat_begin ], &prod[ prod_begin ] );
+        continue;
+      }
+#endif
+      MatVecAddBlock_Psv(&matrix_psv[mat_begin], &vec[vec_begin], &prod[prod_begin], nVar);
     }
+  }
+  
+  /*--- MPI Parallelization ---*/
+  SendReceive_Solution(prod, geometry, config);
   
 }
 
-void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
+void CSysMatrix::MatrixVectorProductTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iVar, jVar;
+  unsigned long prod_begin, vec_begin, mat_begin, index, iVar, jVar, row_i;
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    c[iVar] =  0.0;
-    for (jVar = 0; jVar < nVar; jVar++)
-      c[iVar] += a[iVar*nVar+jVar] * b[jVar];
+  /*--- Some checks for consistency between CSysMatrix and the CSysVectors ---*/
+  if ( (nVar != vec.GetNVar()) || (nVar != prod.GetNVar()) ) {
+    SU2_MPI::Error("nVar values incompatible.", CURRENT_FUNCTION);
+  }
+  if ( (nPoint != vec.GetNBlk()) || (nPoint != prod.GetNBlk()) ) {
+    SU2_MPI::Error("nPoint and nBlk values incompatible.", CURRENT_FUNCTION);
+  }
+  
+  prod = passivedouble(0.0);
+  for (row_i = 0; row_i < nPointDomain; row_i++) {
+    vec_begin = row_i*nVar;
+    for (index = row_ptr[row_i]; index < row_ptr[row_i+1]; index++) {
+      prod_begin = col_ind[index]*nVar;
+      mat_begin = (index*nVar*nVar);
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          prod[prod_begin+jVar] += matrix_psv[mat_begin+iVar*nVar+jVar]*vec[vec_begin+iVar];
+    }
   }
   
+  /*--- MPI Parallelization ---*/
+  SendReceive_SolutionTransposed(prod, geometry, config);
+  
+}
+
+void CSysMatrix::GetMultBlockBlock(su2double *c, su2double *a, su2double *b) {
+  
+  MatMatBlock(a, b, c, nVar);
+  
+}
+
+void CSysMatrix::GetMultBlockVector(su2double *c, su2double *a, su2double *b) {
+  
+  MatVecBlock(a, b, c, nVar);
+  
 }
 
 void CSysMatrix::GetSubsBlock(su2double *c, su2double *a, su2double *b) {
@@ -1297,19 +2142,14 @@ void CSysMatrix::GetSubsVector(su2double *c, su2double *a, su2double *b) {
 
 void CSysMatrix::InverseBlock(su2double *Block, su2double *invBlock) {
   
-  unsigned long iVar, jVar;
+  unsigned long iVar;
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    Gauss_Elimination(Block, aux_vector);
-    
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
-  }
+  /*--- Copy block matrix, note that it is modified by the algorithm ---*/
+  
+  for (iVar = 0; iVar < nVar*nVar; iVar++)
+    block[iVar] = Block[iVar];
+  
+  InverseBlockKernel(block, invBlock, nVar);
   
 }
 
@@ -1317,18 +2157,25 @@ void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock
   
   unsigned long iVar, jVar;
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
-    
-    /*--- Compute the i-th column of the inverse matrix ---*/
-    
-    Gauss_Elimination(block_i, aux_vector, transpose);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
+  su2double *Block = GetBlock(block_i, block_i);
+  
+  /*--- Copy block matrix, note that the original matrix
+   is modified by the algorithm---*/
+  
+  if (!transpose) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        block[iVar*nVar+jVar] = Block[iVar*nVar+jVar];
+  } else {
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (jVar = 0; jVar < nVar; jVar++)
+        block[iVar*nVar+jVar] = Block[jVar*nVar+iVar];
   }
   
+  /*--- Compute all the columns of the inverse matrix at once ---*/
+  
+  InverseBlockKernel(block, invBlock, nVar);
+  
   //  su2double Det, **Matrix, **CoFactor;
   //  su2double *Block = GetBlock(block_i, block_i);
   //
@@ -1366,19 +2213,33 @@ void CSysMatrix::InverseDiagonalBlock(unsigned long block_i, su2double *invBlock
 
 void CSysMatrix::InverseDiagonalBlock_ILUMatrix(unsigned long block_i, su2double *invBlock) {
   
-  unsigned long iVar, jVar;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (jVar = 0; jVar < nVar; jVar++)
-      aux_vector[jVar] = 0.0;
-    aux_vector[iVar] = 1.0;
+#if defined(HAVE_MKL) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  if (useMKL) {
     
-    /*--- Compute the i-th column of the inverse matrix ---*/
+    unsigned long iVar, jVar;
     
-    Gauss_Elimination_ILUMatrix(block_i, aux_vector);
-    for (jVar = 0; jVar < nVar; jVar++)
-      invBlock[jVar*nVar+iVar] = aux_vector[jVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (jVar = 0; jVar < nVar; jVar++)
+        aux_vector[jVar] = 0.0;
+      aux_vector[iVar] = 1.0;
+      
+      /*--- Compute the i-th column of the inverse matrix ---*/
+      
+      Gauss_Elimination_ILUMatrix(block_i, aux_vector);
+      for (jVar = 0; jVar < nVar; jVar++)
+        invBlock[jVar*nVar+iVar] = aux_vector[jVar];
+    }
+    return;
   }
+#endif
+  
+  /*--- Copy block matrix, note that it is modified by the algorithm ---*/
+  
+  memcpy( block, GetBlock_ILUMatrix(block_i, block_i), (nVar * nVar * sizeof(su2double)) );
+  
+  /*--- Compute all the columns of the inverse matrix at once ---*/
+  
+  InverseBlockKernel(block, invBlock, nVar);
   
   //  su2double Det, **Matrix, **CoFactor;
   //  su2double *Block = GetBlock_ILUMatrix(block_i, block_i);
@@ -1430,19 +2291,56 @@ void CSysMatrix::BuildJacobiPreconditioner(bool transpose) {
         invM[iPoint*nVar*nVar+iVar*nVar+jVar] = block_inverse[iVar*nVar+jVar];
   }
 
+  /*--- Single precision copy, which halves the memory traffic of the
+   preconditioner application. ---*/
+
+  if (mixed_precision) {
+    if (invM_flt == NULL) invM_flt = new float [nPoint*nVar*nVar];
+    for (iVar = 0; iVar < nPoint*nVar*nVar; iVar++)
+      invM_flt[iVar] = float(SU2_TYPE::GetValue(invM[iVar]));
+  }
+  
+  /*--- Passive copy for the external linear solves of AD ---*/
+  
+  if (passive_copy) {
+    if (invM_psv == NULL) invM_psv = new passivedouble [nPoint*nVar*nVar];
+    for (iVar = 0; iVar < nPoint*nVar*nVar; iVar++)
+      invM_psv[iVar] = SU2_TYPE::GetValue(invM[iVar]);
+    invM_psv_transposed = transpose;
+  }
+  invM_psv_current = passive_copy;
+
+  /*--- The linelets use the Jacobi preconditioner for the remaining points ---*/
+  
+  if (nLinelet != 0) BuildLineletFactorization();
+
 }
 
 
-void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+void CSysMatrix::ComputeJacobiPreconditioner_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    MatrixVectorProduct_Passive(&invM_psv[iPoint*nVar*nVar], &vec[iPoint*nVar], &prod[iPoint*nVar]);
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::ComputeJacobiPreconditionerTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
   
   unsigned long iPoint, iVar, jVar;
+  const passivedouble *block;
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    block = &invM_psv[iPoint*nVar*nVar];
     for (iVar = 0; iVar < nVar; iVar++) {
-      prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
+      prod[iPoint*nVar+iVar] = 0.0;
       for (jVar = 0; jVar < nVar; jVar++)
-        prod[(unsigned long)(iPoint*nVar+iVar)] +=
-        invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
+        prod[iPoint*nVar+iVar] += block[jVar*nVar+iVar]*vec[iPoint*nVar+jVar];
     }
   }
   
@@ -1452,21 +2350,56 @@ void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector
   
 }
 
-unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
+void CSysMatrix::ComputeJacobiPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iPoint, iVar, jVar;
+  /*--- Point-wise product with the inverse diagonal blocks, in single precision
+   when the mixed precision copy is available. ---*/
   
-  /*---  Check the number of iterations requested ---*/
+  RowTask_Vec  = &vec;
+  RowTask_Prod = &prod;
+  RunRowTask(ROW_TASK_JACOBI, 0, nPointDomain);
   
-  if (m < 1) {
-    char buf[100];
-    SPRINTF(buf, "Illegal value for smoothing iterations, m = %lu", m );
-    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
-  }
+  /*--- MPI Parallelization ---*/
   
-  /*--- Create vectors to hold the residual and the Matrix-Vector product
-   of the Jacobian matrix with the current solution (x^k). These must be
-   stored in order to perform multiple iterations of the smoother. ---*/
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::ComputeJacobiPreconditionerTransposed(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, iVar, jVar;
+  const su2double *block;
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    block = &invM[iPoint*nVar*nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      prod[iPoint*nVar+iVar] = 0.0;
+      for (jVar = 0; jVar < nVar; jVar++)
+        prod[iPoint*nVar+iVar] += block[jVar*nVar+iVar]*vec[iPoint*nVar+jVar];
+    }
+  }
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, iVar, jVar;
+  
+  /*---  Check the number of iterations requested ---*/
+  
+  if (m < 1) {
+    char buf[100];
+    SPRINTF(buf, "Illegal value for smoothing iterations, m = %lu", m );
+    SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
+  }
+  
+  /*--- Create vectors to hold the residual and the Matrix-Vector product
+   of the Jacobian matrix with the current solution (x^k). These must be
+   stored in order to perform multiple iterations of the smoother. ---*/
   
   CSysVector r(b);
   CSysVector A_x(b);
@@ -1542,11 +2475,217 @@ unsigned long CSysMatrix::Jacobi_Smoother(const CSysVector & b, CSysVector & x,
   
 }
 
-void CSysMatrix::BuildILUPreconditioner(bool transposed) {
+void CSysMatrix::BuildILULevels(void) {
+  
+  unsigned long index, iLevel, nLevel;
+  long iPoint, jPoint;
+  vector<unsigned long> level(nPointDomain, 0);
+  
+  /*--- Forward sweep: a row can be processed once all the rows it references
+   in the lower triangular part are done, i.e. its level is one more than the
+   highest level of those rows. ---*/
+  
+  nLevel = 0;
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if (jPoint < iPoint) level[iPoint] = max(level[iPoint], level[jPoint]+1);
+    }
+    nLevel = max(nLevel, level[iPoint]+1);
+  }
+  
+  ILULevel_Fwd_Ptr.assign(nLevel+1, 0);
+  ILULevel_Fwd_Row.resize(nPointDomain);
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) ILULevel_Fwd_Ptr[level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel; iLevel++) ILULevel_Fwd_Ptr[iLevel+1] += ILULevel_Fwd_Ptr[iLevel];
+  
+  vector<unsigned long> next(ILULevel_Fwd_Ptr.begin(), ILULevel_Fwd_Ptr.end()-1);
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) ILULevel_Fwd_Row[next[level[iPoint]]++] = iPoint;
+  
+  /*--- Backward sweep, same idea with the upper triangular part. ---*/
+  
+  level.assign(nPointDomain, 0);
+  nLevel = 0;
+  for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--) {
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+      jPoint = col_ind_ilu[index];
+      if ((jPoint > iPoint) && (jPoint < (long)nPointDomain)) level[iPoint] = max(level[iPoint], level[jPoint]+1);
+    }
+    nLevel = max(nLevel, level[iPoint]+1);
+  }
+  
+  ILULevel_Bwd_Ptr.assign(nLevel+1, 0);
+  ILULevel_Bwd_Row.resize(nPointDomain);
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) ILULevel_Bwd_Ptr[level[iPoint]+1]++;
+  for (iLevel = 0; iLevel < nLevel; iLevel++) ILULevel_Bwd_Ptr[iLevel+1] += ILULevel_Bwd_Ptr[iLevel];
+  
+  next.assign(ILULevel_Bwd_Ptr.begin(), ILULevel_Bwd_Ptr.end()-1);
+  for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--) ILULevel_Bwd_Row[next[level[iPoint]]++] = iPoint;
+  
+}
+
+void CSysMatrix::ILUFactorRow(long iPoint) {
   
-  unsigned long index, index_, iVar;
+  unsigned long index, index_;
   su2double *Block_ij, *Block_jk;
-  long iPoint, jPoint, kPoint;
+  long jPoint, kPoint;
+  
+  /*--- For each row (unknown), loop over all entries in A on this row
+   row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
+   row. ---*/
+  
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    
+    /*--- jPoint here is the column for each entry on this row ---*/
+    
+    jPoint = col_ind_ilu[index];
+    
+    /*--- Check that this column is in the lower triangular portion ---*/
+    
+    if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
+      
+      /*--- If we're in the lower triangle, get the pointer to this block,
+       invert it, and then right multiply against the original block ---*/
+      
+      Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
+      InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
+      MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
+      
+      /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
+      
+      for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
+        
+        /*--- Get the column of the entry ---*/
+        
+        kPoint = col_ind_ilu[index_];
+        
+        /*--- If the column is greater than or equal to jPoint, i.e., the
+         upper triangular part, then multiply and modify the matrix.
+         Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
+        
+        if ((kPoint >= jPoint) && (jPoint < (long)nPointDomain)) {
+          
+          Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
+          MatrixMatrixProduct(block_weight, Block_jk, block);
+          SubtractBlock_ILUMatrix(iPoint, kPoint, block);
+          
+        }
+      }
+      
+      /*--- Lastly, store block_weight in the lower triangular part, which
+       will be reused during the forward solve in the precon/smoother. ---*/
+      
+      SetBlock_ILUMatrix(iPoint, jPoint, block_weight);
+      
+    }
+  }
+  
+}
+
+void CSysMatrix::ILUForwardRow(CSysVector & vec, long iPoint, bool single_prec, su2double *scratch) {
+  
+  unsigned long index;
+  long jPoint;
+  unsigned short iVar;
+  su2double *aux = scratch;
+  
+  /*--- Get Aij*inv(Ajj) from the lower triangular part, which was
+   calculated in the preprocessing, and apply it to vec. ---*/
+  
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
+      if (single_prec) MatrixVectorProduct(&ILU_matrix_flt[index*nVar*nEqn], &vec[jPoint*nVar], aux);
+      else MatrixVectorProduct(&ILU_matrix[index*nVar*nEqn], &vec[jPoint*nVar], aux);
+      for (iVar = 0; iVar < nVar; iVar++)
+        vec[iPoint*nVar+iVar] -= aux[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::ILUBackwardRow(CSysVector & vec, long iPoint, bool single_prec, su2double *scratch) {
+  
+  unsigned long index, index_diag = 0;
+  long jPoint;
+  unsigned short iVar;
+  
+  /*--- Auxiliary arrays of the calling thread. ---*/
+  
+  su2double *aux = scratch, *sum = &scratch[nVar];
+  su2double *blk = &scratch[2*nVar], *blk_inv = &scratch[2*nVar+nVar*nEqn];
+  
+  for (iVar = 0; iVar < nVar; iVar++) sum[iVar] = 0.0;
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if (jPoint == iPoint) index_diag = index;
+    if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
+      if (single_prec) MatrixVectorProduct(&ILU_matrix_flt[index*nVar*nEqn], &vec[jPoint*nVar], aux);
+      else MatrixVectorProduct(&ILU_matrix[index*nVar*nEqn], &vec[jPoint*nVar], aux);
+      for (iVar = 0; iVar < nVar; iVar++) sum[iVar] += aux[iVar];
+    }
+  }
+  
+  /*--- The single precision copy stores the inverse of the diagonal block. ---*/
+  
+  if (single_prec) {
+    for (iVar = 0; iVar < nVar; iVar++) sum[iVar] = vec[iPoint*nVar+iVar]-sum[iVar];
+    MatrixVectorProduct(&ILU_matrix_flt[index_diag*nVar*nEqn], sum, &vec[iPoint*nVar]);
+  }
+  else {
+    for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = (vec[iPoint*nVar+iVar]-sum[iVar]);
+    memcpy(blk, &ILU_matrix[index_diag*nVar*nEqn], nVar*nEqn*sizeof(su2double));
+    InverseBlockKernel(blk, blk_inv, nVar);
+    MatrixVectorProduct(blk_inv, &vec[iPoint*nVar], aux);
+    for (iVar = 0; iVar < nVar; iVar++) vec[iPoint*nVar+iVar] = aux[iVar];
+  }
+  
+}
+
+void CSysMatrix::ILUForwardBackward(CSysVector & vec, bool single_prec) {
+  
+  unsigned long iLevel;
+  long iPoint;
+  
+  if (ilu_levels) {
+    
+    /*--- Rows of the same level do not depend on each other, hence the
+     threads share the rows of each level. ---*/
+    
+    RowTask_Vec        = &vec;
+    RowTask_Prod       = &vec;
+    RowTask_SinglePrec = single_prec;
+    
+    for (iLevel = 0; iLevel < ILULevel_Fwd_Ptr.size()-1; iLevel++)
+      RunRowTask(ROW_TASK_ILU_FWD, ILULevel_Fwd_Ptr[iLevel], ILULevel_Fwd_Ptr[iLevel+1]);
+    
+    for (iLevel = 0; iLevel < ILULevel_Bwd_Ptr.size()-1; iLevel++)
+      RunRowTask(ROW_TASK_ILU_BWD, ILULevel_Bwd_Ptr[iLevel], ILULevel_Bwd_Ptr[iLevel+1]);
+    
+  }
+  else {
+    
+    /*--- Forward solve the system using the lower matrix entries that
+     were computed and stored during the ILU preprocessing. Note
+     that we are overwriting the residual vector as we go. ---*/
+    
+    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++)
+      ILUForwardRow(vec, iPoint, single_prec, &ThreadScratch[0]);
+    
+    /*--- Backwards substitution (starts at the last row) ---*/
+    
+    for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--)
+      ILUBackwardRow(vec, iPoint, single_prec, &ThreadScratch[0]);
+    
+  }
+  
+}
+
+void CSysMatrix::BuildILUPreconditioner(bool transposed) {
+  
+  unsigned long index, iVar, iLevel, iRow;
+  su2double *Block_ij;
+  long iPoint, jPoint;
   
 
   /*--- Copy block matrix, note that the original matrix
@@ -1570,56 +2709,61 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
   
   /*--- Transform system in Upper Matrix ---*/
   
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+  if (ilu_levels) {
+    
+    /*--- The level sets only depend on the sparse structure, they are built once.
+     A row only needs the rows of lower levels to be factorized. ---*/
+    
+    if (ILULevel_Fwd_Ptr.empty()) BuildILULevels();
     
-    /*--- For each row (unknown), loop over all entries in A on this row
-     row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-     row. ---*/
+    for (iLevel = 0; iLevel < ILULevel_Fwd_Ptr.size()-1; iLevel++)
+      for (iRow = ILULevel_Fwd_Ptr[iLevel]; iRow < ILULevel_Fwd_Ptr[iLevel+1]; iRow++)
+        ILUFactorRow(ILULevel_Fwd_Row[iRow]);
     
+  }
+  else {
+    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++)
+      ILUFactorRow(iPoint);
+  }
+  
+  /*--- Single precision copy of the factorization. The diagonal blocks are
+   stored already inverted, which also avoids the Gauss elimination of
+   every diagonal block each time the preconditioner is applied. ---*/
+  
+  if (mixed_precision) {
+    if (ILU_matrix_flt == NULL) ILU_matrix_flt = new float [nnz_ilu*nVar*nEqn];
+    CopyILUFactorization(ILU_matrix_flt);
+  }
+  
+  /*--- Passive copy for the external linear solves of AD, in the same format ---*/
+  
+  if (passive_copy) {
+    if (ILU_matrix_psv == NULL) ILU_matrix_psv = new passivedouble [nnz_ilu*nVar*nEqn];
+    CopyILUFactorization(ILU_matrix_psv);
+    ILU_psv_transposed = transposed;
+  }
+  ILU_psv_current = passive_copy;
+  
+}
+
+template<class OtherType>
+void CSysMatrix::CopyILUFactorization(OtherType *ILU_copy) {
+  
+  unsigned long index, iVar;
+  su2double *Block_ij;
+  long iPoint, jPoint;
+  
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
     for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-      
-      /*--- jPoint here is the column for each entry on this row ---*/
-      
       jPoint = col_ind_ilu[index];
-      
-      /*--- Check that this column is in the lower triangular portion ---*/
-      
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        
-        /*--- If we're in the lower triangle, get the pointer to this block,
-         invert it, and then right multiply against the original block ---*/
-        
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        InverseDiagonalBlock_ILUMatrix(jPoint, block_inverse);
-        MatrixMatrixProduct(Block_ij, block_inverse, block_weight);
-        
-        /*--- block_weight holds Aij*inv(Ajj). Jump to the row for jPoint ---*/
-        
-        for (index_ = row_ptr_ilu[jPoint]; index_ < row_ptr_ilu[jPoint+1]; index_++) {
-          
-          /*--- Get the column of the entry ---*/
-          
-          kPoint = col_ind_ilu[index_];
-          
-          /*--- If the column is greater than or equal to jPoint, i.e., the
-           upper triangular part, then multiply and modify the matrix.
-           Here, Aik' = Aik - Aij*inv(Ajj)*Ajk. ---*/
-          
-          if ((kPoint >= jPoint) && (jPoint < (long)nPointDomain)) {
-            
-            Block_jk = GetBlock_ILUMatrix(jPoint, kPoint);
-            MatrixMatrixProduct(block_weight, Block_jk, block);
-            SubtractBlock_ILUMatrix(iPoint, kPoint, block);
-            
-          }
-        }
-        
-        /*--- Lastly, store block_weight in the lower triangular part, which
-         will be reused during the forward solve in the precon/smoother. ---*/
-        
-        SetBlock_ILUMatrix(iPoint, jPoint, block_weight);
-        
+      if (jPoint == iPoint) {
+        InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
+        Block_ij = block_inverse;
+      } else {
+        Block_ij = &ILU_matrix[index*nVar*nEqn];
       }
+      for (iVar = 0; iVar < nVar*nEqn; iVar++)
+        ILU_copy[index*nVar*nEqn+iVar] = OtherType(SU2_TYPE::GetValue(Block_ij[iVar]));
     }
   }
   
@@ -1627,9 +2771,7 @@ void CSysMatrix::BuildILUPreconditioner(bool transposed) {
 
 void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij;
-  long iPoint, jPoint;
+  long iPoint;
   unsigned short iVar;
   
   /*--- Copy block matrix, note that the original matrix
@@ -1641,46 +2783,142 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
     }
   }
   
-  /*--- Forward solve the system using the lower matrix entries that
-   were computed and stored during the ILU preprocessing. Note
-   that we are overwriting the residual vector as we go. ---*/
+  /*--- Forward and backward solves with the factorization, in single
+   precision when the mixed precision copy is available. ---*/
+  
+  ILUForwardBackward(prod, mixed_precision);
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::ILUForwardRow_Passive(CSysVectorPassive & vec, long iPoint) {
+  
+  unsigned long index;
+  long jPoint;
+  unsigned short iVar;
+  
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
+      MatrixVectorProduct_Passive(&ILU_matrix_psv[index*nVar*nEqn], &vec[jPoint*nVar], aux_vector_psv);
+      for (iVar = 0; iVar < nVar; iVar++)
+        vec[iPoint*nVar+iVar] -= aux_vector_psv[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::ILUBackwardRow_Passive(CSysVectorPassive & vec, long iPoint) {
+  
+  unsigned long index, index_diag = 0;
+  long jPoint;
+  unsigned short iVar;
+  
+  for (iVar = 0; iVar < nVar; iVar++) sum_vector_psv[iVar] = 0.0;
+  for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
+    jPoint = col_ind_ilu[index];
+    if (jPoint == iPoint) index_diag = index;
+    if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
+      MatrixVectorProduct_Passive(&ILU_matrix_psv[index*nVar*nEqn], &vec[jPoint*nVar], aux_vector_psv);
+      for (iVar = 0; iVar < nVar; iVar++) sum_vector_psv[iVar] += aux_vector_psv[iVar];
+    }
+  }
+  
+  /*--- The passive copy stores the inverse of the diagonal block. ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++) sum_vector_psv[iVar] = vec[iPoint*nVar+iVar]-sum_vector_psv[iVar];
+  MatrixVectorProduct_Passive(&ILU_matrix_psv[index_diag*nVar*nEqn], sum_vector_psv, &vec[iPoint*nVar]);
+  
+}
+
+void CSysMatrix::ComputeILUPreconditioner_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iLevel, iRow, iVar;
+  long iPoint;
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    prod[iVar] = vec[iVar];
+  
+  /*--- Forward and backward solves, in the same order as with the active factorization ---*/
+  
+  if (ilu_levels) {
+    for (iLevel = 0; iLevel < ILULevel_Fwd_Ptr.size()-1; iLevel++)
+      for (iRow = ILULevel_Fwd_Ptr[iLevel]; iRow < ILULevel_Fwd_Ptr[iLevel+1]; iRow++)
+        ILUForwardRow_Passive(prod, ILULevel_Fwd_Row[iRow]);
+    
+    for (iLevel = 0; iLevel < ILULevel_Bwd_Ptr.size()-1; iLevel++)
+      for (iRow = ILULevel_Bwd_Ptr[iLevel]; iRow < ILULevel_Bwd_Ptr[iLevel+1]; iRow++)
+        ILUBackwardRow_Passive(prod, ILULevel_Bwd_Row[iRow]);
+  }
+  else {
+    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++)
+      ILUForwardRow_Passive(prod, iPoint);
+    
+    for (iPoint = nPointDomain-1; iPoint >= 0; iPoint--)
+      ILUBackwardRow_Passive(prod, iPoint);
+  }
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::ComputeILUPreconditionerTransposed_Passive(const CSysVectorPassive & vec, CSysVectorPassive & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long index, index_diag, iVar, jVar;
+  long iPoint, jPoint;
+  const passivedouble *block;
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    prod[iVar] = vec[iVar];
+  
+  /*--- (LU)^T = U^T L^T. The transposed factors are lower and upper triangular
+   in the order of the columns, i.e. the rows of the factorization are used to
+   eliminate the point from the later (U^T) or earlier (L^T) points. ---*/
+  
+  /*--- Forward solve with U^T, the diagonal blocks are stored inverted ---*/
   
-  for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
+  for (iPoint = 0; iPoint < (long)nPointDomain; iPoint++) {
+    
+    index_diag = row_ptr_ilu[iPoint];
+    for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++)
+      if (col_ind_ilu[index] == (unsigned long)iPoint) index_diag = index;
+    
+    block = &ILU_matrix_psv[index_diag*nVar*nEqn];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      aux_vector_psv[iVar] = 0.0;
+      for (jVar = 0; jVar < nVar; jVar++)
+        aux_vector_psv[iVar] += block[jVar*nVar+iVar]*prod[iPoint*nVar+jVar];
+    }
+    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector_psv[iVar];
+    
     for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
       jPoint = col_ind_ilu[index];
-      if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
+      if ((jPoint > iPoint) && (jPoint < (long)nPointDomain)) {
+        block = &ILU_matrix_psv[index*nVar*nEqn];
         for (iVar = 0; iVar < nVar; iVar++)
-          prod[iPoint*nVar+iVar] -= aux_vector[iVar];
-        
+          for (jVar = 0; jVar < nVar; jVar++)
+            prod[jPoint*nVar+jVar] -= block[iVar*nVar+jVar]*prod[iPoint*nVar+iVar];
       }
     }
   }
   
-  /*--- Backwards substitution (starts at the last row) ---*/
-  
-  InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-  MatrixVectorProduct(block_inverse, &prod[(nPointDomain-1)*nVar], aux_vector);
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    prod[ (nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
+  /*--- Backward solve with L^T, which has identity diagonal blocks ---*/
   
-  for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
+  for (iPoint = nPointDomain-1; iPoint > 0; iPoint--) {
     for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
       jPoint = col_ind_ilu[index];
-      if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-        Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-        MatrixVectorProduct(Block_ij, &prod[jPoint*nVar], aux_vector);
-        for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
+      if (jPoint < iPoint) {
+        block = &ILU_matrix_psv[index*nVar*nEqn];
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (jVar = 0; jVar < nVar; jVar++)
+            prod[jPoint*nVar+jVar] -= block[iVar*nVar+jVar]*prod[iPoint*nVar+iVar];
       }
     }
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = (prod[iPoint*nVar+iVar]-sum_vector[iVar]);
-    InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-    MatrixVectorProduct(block_inverse, &prod[iPoint*nVar], aux_vector);
-    for (iVar = 0; iVar < nVar; iVar++) prod[iPoint*nVar+iVar] = aux_vector[iVar];
-    if (iPoint == 0) break;
   }
   
   /*--- MPI Parallelization ---*/
@@ -1691,10 +2929,7 @@ void CSysMatrix::ComputeILUPreconditioner(const CSysVector & vec, CSysVector & p
 
 unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMatrixVectorProduct & mat_vec, su2double tol, unsigned long m, su2double *residual, bool monitoring, CGeometry *geometry, CConfig *config) {
   
-  unsigned long index;
-  su2double *Block_ij, omega = 1.0;
-  long iPoint, jPoint;
-  unsigned short iVar;
+  su2double omega = 1.0;
   
   /*---  Check the number of iterations requested ---*/
   
@@ -1741,62 +2976,11 @@ unsigned long CSysMatrix::ILU_Smoother(const CSysVector & b, CSysVector & x, CMa
   
   for (i = 0; i < (int)m; i++) {
     
-    /*--- Forward solve the system using the lower matrix entries that
-     were computed and stored during the ILU preprocessing. Note
-     that we are overwriting the residual vector as we go. ---*/
+    /*--- Forward solve and backwards substitution with the factorization computed
+     during the ILU preprocessing. Note that we are overwriting the residual
+     vector as we go. ---*/
     
-    for (iPoint = 1; iPoint < (long)nPointDomain; iPoint++) {
-      
-      /*--- For each row (unknown), loop over all entries in A on this row
-       row_ptr_ilu[iPoint+1] will have the index for the first entry on the next
-       row. ---*/
-      
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        
-        /*--- jPoint here is the column for each entry on this row ---*/
-        
-        jPoint = col_ind_ilu[index];
-        
-        /*--- Check that this column is in the lower triangular portion ---*/
-        
-        if ((jPoint < iPoint) && (jPoint < (long)nPointDomain)) {
-          
-          /*--- Lastly, get Aij*inv(Ajj) from the lower triangular part, which
-           was calculated in the preprocessing, and apply to r. ---*/
-          
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++)
-            r[iPoint*nVar+iVar] -= aux_vector[iVar];
-          
-        }
-      }
-    }
-    
-    /*--- Backwards substitution (starts at the last row) ---*/
-    
-    InverseDiagonalBlock_ILUMatrix((nPointDomain-1), block_inverse);
-    MatrixVectorProduct(block_inverse, &r[(nPointDomain-1)*nVar], aux_vector);
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      r[(nPointDomain-1)*nVar + iVar] = aux_vector[iVar];
-    
-    for (iPoint = nPointDomain-2; iPoint >= 0; iPoint--) {
-      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = 0.0;
-      for (index = row_ptr_ilu[iPoint]; index < row_ptr_ilu[iPoint+1]; index++) {
-        jPoint = col_ind_ilu[index];
-        if ((jPoint >= iPoint+1) && (jPoint < (long)nPointDomain)) {
-          Block_ij = GetBlock_ILUMatrix(iPoint, jPoint);
-          MatrixVectorProduct(Block_ij, &r[jPoint*nVar], aux_vector);
-          for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] += aux_vector[iVar];
-        }
-      }
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = (r[iPoint*nVar+iVar]-sum_vector[iVar]);
-      InverseDiagonalBlock_ILUMatrix(iPoint, block_inverse);
-      MatrixVectorProduct(block_inverse, &r[iPoint*nVar], aux_vector);
-      for (iVar = 0; iVar < nVar; iVar++) r[iPoint*nVar+iVar] = aux_vector[iVar];
-      if (iPoint == 0) break;
-    }
+    ILUForwardBackward(r, false);
     
     /*--- Update solution (x^k+1 = x^k + w*M^-1*r^k) using the residual vector,
      which holds the update after applying the ILU smoother, i.e., M^-1*r^k.
@@ -1991,7 +3175,7 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   
   bool *check_Point, add_point;
   unsigned long iEdge, iPoint, jPoint, index_Point, iLinelet, iVertex, next_Point, counter, iElem;
-  unsigned short iMarker, iNode, ExtraLines = 100, MeanPoints;
+  unsigned short iMarker, iNode, MeanPoints;
   su2double alpha = 0.9, weight, max_weight, *normal, area, volume_iPoint, volume_jPoint;
   unsigned long Local_nPoints, Local_nLineLets, Global_nPoints, Global_nLineLets;
   
@@ -2005,6 +3189,8 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint ++)
     LineletBool[iPoint] = false;
   
+  /*--- Upper bound of the number of linelets, one per wall vertex ---*/
+  
   nLinelet = 0;
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
@@ -2021,30 +3207,35 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
     
     /*--- Basic initial allocation ---*/
     
-    LineletPoint = new vector<unsigned long>[nLinelet + ExtraLines];
+    LineletPoint = new vector<unsigned long>[nLinelet];
     
-    /*--- Define the basic linelets, starting from each vertex ---*/
+    /*--- Define the basic linelets, starting from each vertex. Only the points
+     owned by this rank start (and belong to) a linelet, such that the linelets
+     of the different ranks are independent. A vertex shared by two markers
+     starts only one linelet. ---*/
     
+    iLinelet = 0;
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
       if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
           (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
           (config->GetMarker_All_KindBC(iMarker) == EULER_WALL             ) ||
           (config->GetMarker_All_KindBC(iMarker) == DISPLACEMENT_BOUNDARY)) {
-        iLinelet = 0;
         for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
           iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          if (!check_Point[iPoint] || !geometry->node[iPoint]->GetDomain()) continue;
           LineletPoint[iLinelet].push_back(iPoint);
           check_Point[iPoint] = false;
           iLinelet++;
         }
       }
     }
+    nLinelet = iLinelet;
     
     /*--- Create the linelet structure ---*/
     
     iLinelet = 0;
     
-    do {
+    if (nLinelet != 0) do {
       
       index_Point = 0;
       
@@ -2115,22 +3306,13 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
       }
     }
     
-    /*--- Identify the maximum number of elements in a Linelet ---*/
-    
-    max_nElem = LineletPoint[0].size();
-    for (iLinelet = 1; iLinelet < nLinelet; iLinelet++)
-      if (LineletPoint[iLinelet].size() > max_nElem)
-        max_nElem = LineletPoint[iLinelet].size();
-    
   }
   
-  /*--- The domain doesn't have well defined linelets ---*/
+  /*--- Start of each linelet in the (contiguous) factorization arrays ---*/
   
-  else {
-    
-    max_nElem = 0;
-    
-  }
+  LineletPtr.assign(nLinelet+1, 0);
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++)
+    LineletPtr[iLinelet+1] = LineletPtr[iLinelet] + LineletPoint[iLinelet].size();
   
   /*--- Screen output ---*/
   
@@ -2148,24 +3330,14 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   SU2_MPI::Allreduce(&Local_nLineLets, &Global_nLineLets, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
-  MeanPoints = SU2_TYPE::Int(su2double(Global_nPoints)/su2double(Global_nLineLets));
+  MeanPoints = 0;
+  if (Global_nLineLets != 0)
+    MeanPoints = SU2_TYPE::Int(su2double(Global_nPoints)/su2double(Global_nLineLets));
   
-  /*--- Memory allocation --*/
+  /*--- Memory allocation, the factorization is computed with the Jacobi preconditioner --*/
   
-  UBlock = new su2double* [max_nElem];
-  invUBlock = new su2double* [max_nElem];
-  LBlock = new su2double* [max_nElem];
-  yVector = new su2double* [max_nElem];
-  zVector = new su2double* [max_nElem];
-  rVector = new su2double* [max_nElem];
-  for (iElem = 0; iElem < max_nElem; iElem++) {
-    UBlock[iElem] = new su2double [nVar*nVar];
-    invUBlock[iElem] = new su2double [nVar*nVar];
-    LBlock[iElem] = new su2double [nVar*nVar];
-    yVector[iElem] = new su2double [nVar];
-    zVector[iElem] = new su2double [nVar];
-    rVector[iElem] = new su2double [nVar];
-  }
+  LineletInvU.assign(LineletPtr[nLinelet]*nVar*nVar, 0.0);
+  LineletL.assign(LineletPtr[nLinelet]*nVar*nVar, 0.0);
   
   LFBlock = new su2double [nVar*nVar];
   LyVector = new su2double [nVar];
@@ -2179,107 +3351,795 @@ unsigned short CSysMatrix::BuildLineletPreconditioner(CGeometry *geometry, CConf
   
 }
 
+void CSysMatrix::BuildLineletFactorization(void) {
+  
+  unsigned long iLinelet, iElem, nElem, iPoint, im1Point, iVar, first;
+  const unsigned long nVar2 = nVar*nVar;
+  su2double *Block;
+  
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    
+    first = LineletPtr[iLinelet];
+    nElem = LineletPtr[iLinelet+1] - first;
+    
+    /*--- Initialization (iElem = 0), U_0 = D_0 ---*/
+    
+    iPoint = LineletPoint[iLinelet][0];
+    InverseBlock(GetBlock(iPoint, iPoint), &LineletInvU[first*nVar2]);
+    
+    /*--- L_i = A_(i,i-1) U_(i-1)^-1 and U_i = D_i - L_i A_(i-1,i) ---*/
+    
+    for (iElem = 1; iElem < nElem; iElem++) {
+      
+      im1Point = LineletPoint[iLinelet][iElem-1];
+      iPoint = LineletPoint[iLinelet][iElem];
+      
+      su2double *L_i = &LineletL[(first+iElem)*nVar2];
+      
+      MatMatBlock(GetBlock(iPoint, im1Point), &LineletInvU[(first+iElem-1)*nVar2], L_i, nVar);
+      MatMatBlock(L_i, GetBlock(im1Point, iPoint), LFBlock, nVar);
+      
+      Block = GetBlock(iPoint, iPoint);
+      for (iVar = 0; iVar < nVar2; iVar++)
+        block_weight[iVar] = Block[iVar] - LFBlock[iVar];
+      
+      InverseBlock(block_weight, &LineletInvU[(first+iElem)*nVar2]);
+      
+    }
+    
+  }
+  
+}
+
 void CSysMatrix::ComputeLineletPreconditioner(const CSysVector & vec, CSysVector & prod,
                                               CGeometry *geometry, CConfig *config) {
   
-  unsigned long iVar, jVar, nElem = 0, iLinelet, im1Point, iPoint, ip1Point, iElem;
+  unsigned long iVar, jVar, nElem, iLinelet, iPoint, im1Point, ip1Point, iElem, first;
   long iElemLoop;
-  su2double *block;
+  const unsigned long nVar2 = nVar*nVar;
+  
+  /*--- Jacobi preconditioning if there is no linelet ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (!LineletBool[iPoint]) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
+        for (jVar = 0; jVar < nVar; jVar++)
+          prod[(unsigned long)(iPoint*nVar+iVar)] +=
+          invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
+      }
+    }
+  }
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+  /*--- Solve the linelets with the block LU factorization of BuildLineletFactorization
+   (Thomas' algorithm). The linelets only contain points of this rank, hence they are
+   independent of each other, and prod holds the intermediate solution y of the forward
+   substitution, which is overwritten by the backward substitution. ---*/
   
-  if (size == SINGLE_NODE) {
+  for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
     
-    /*--- Jacobi preconditioning if there is no linelet ---*/
+    first = LineletPtr[iLinelet];
+    nElem = LineletPtr[iLinelet+1] - first;
     
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
-      if (!LineletBool[iPoint]) {
-        for (iVar = 0; iVar < nVar; iVar++) {
-          prod[(unsigned long)(iPoint*nVar+iVar)] = 0.0;
-          for (jVar = 0; jVar < nVar; jVar++)
-            prod[(unsigned long)(iPoint*nVar+iVar)] +=
-            invM[(unsigned long)(iPoint*nVar*nVar+iVar*nVar+jVar)]*vec[(unsigned long)(iPoint*nVar+jVar)];
-        }
+    /*--- Forward substitution, y_i = r_i - L_i y_(i-1) ---*/
+    
+    iPoint = LineletPoint[iLinelet][0];
+    for (iVar = 0; iVar < nVar; iVar++)
+      prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar];
+    
+    for (iElem = 1; iElem < nElem; iElem++) {
+      im1Point = iPoint;
+      iPoint = LineletPoint[iLinelet][iElem];
+      MatVecBlock(&LineletL[(first+iElem)*nVar2], prod.GetBlock(im1Point), LyVector, nVar);
+      for (iVar = 0; iVar < nVar; iVar++)
+        prod[iPoint*nVar+iVar] = vec[iPoint*nVar+iVar] - LyVector[iVar];
+    }
+    
+    /*--- Backward substitution, z_i = U_i^-1 (y_i - A_(i,i+1) z_(i+1)) ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      aux_vector[iVar] = prod[iPoint*nVar+iVar];
+    MatVecBlock(&LineletInvU[(first+nElem-1)*nVar2], aux_vector, prod.GetBlock(iPoint), nVar);
+    
+    for (iElemLoop = nElem-2; iElemLoop >= 0; iElemLoop--) {
+      ip1Point = LineletPoint[iLinelet][iElemLoop+1];
+      iPoint = LineletPoint[iLinelet][iElemLoop];
+      MatVecBlock(GetBlock(iPoint, ip1Point), prod.GetBlock(ip1Point), FzVector, nVar);
+      for (iVar = 0; iVar < nVar; iVar++)
+        aux_vector[iVar] = prod[iPoint*nVar+iVar] - FzVector[iVar];
+      MatVecBlock(&LineletInvU[(first+iElemLoop)*nVar2], aux_vector, prod.GetBlock(iPoint), nVar);
+    }
+    
+  }
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::GetAMGLevel(unsigned short iLevel, unsigned long* &rowptr, unsigned long* &colind, su2double* &val) {
+  
+  if (iLevel == 0) {
+    rowptr = row_ptr;
+    colind = col_ind;
+    val    = matrix;
+  }
+  else {
+    rowptr = &AMG_RowPtr[iLevel][0];
+    colind = &AMG_ColInd[iLevel][0];
+    val    = &AMG_Val[iLevel][0];
+  }
+  
+}
+
+unsigned long CSysMatrix::AMGAggregate(unsigned short iLevel) {
+  
+  /*--- Relative threshold of the strength of connection, the connection i-j is
+   strong if |A_ij| >= theta*sqrt(|A_ii|*|A_jj|), with the Frobenius norm of the blocks. ---*/
+  
+  const su2double theta = 0.25;
+  const unsigned long unassigned = ULONG_MAX;
+  
+  unsigned long iRow, jRow, index, iVar, nAgg = 0, nRow = AMG_nRow[iLevel], *rowptr, *colind;
+  su2double *val, *Block, norm;
+  bool free_neighbors;
+  
+  GetAMGLevel(iLevel, rowptr, colind, val);
+  
+  /*--- Norm of the diagonal blocks ---*/
+  
+  vector<su2double> diag(nRow, 0.0);
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      if (colind[index] == iRow) {
+        Block = &val[index*nVar*nVar];
+        for (iVar = 0; iVar < nVar*nVar; iVar++) diag[iRow] += Block[iVar]*Block[iVar];
+      }
+    }
+    diag[iRow] = sqrt(diag[iRow]);
+  }
+  
+  /*--- Flag the strong connections (only within the rows of this level, i.e. the
+   domain points of this rank on the finest level; the aggregates do not cross
+   partitions). ---*/
+  
+  vector<bool> strong(rowptr[nRow], false);
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      jRow = colind[index];
+      if ((jRow == iRow) || (jRow >= nRow)) continue;
+      Block = &val[index*nVar*nVar];
+      norm = 0.0;
+      for (iVar = 0; iVar < nVar*nVar; iVar++) norm += Block[iVar]*Block[iVar];
+      strong[index] = (sqrt(norm) >= theta*sqrt(diag[iRow]*diag[jRow]));
+    }
+  }
+  
+  /*--- First pass, seed the aggregates with the rows whose strong neighbors are all free. ---*/
+  
+  vector<unsigned long> &agg = AMG_Aggregate[iLevel];
+  agg.assign(nRow, unassigned);
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    if (agg[iRow] != unassigned) continue;
+    free_neighbors = true;
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++)
+      if (strong[index] && (agg[colind[index]] != unassigned)) { free_neighbors = false; break; }
+    if (!free_neighbors) continue;
+    agg[iRow] = nAgg;
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++)
+      if (strong[index]) agg[colind[index]] = nAgg;
+    nAgg++;
+  }
+  
+  /*--- Second pass, the remaining rows join the aggregate of a strong neighbor. ---*/
+  
+  vector<unsigned long> agg_seed(agg);
+  for (iRow = 0; iRow < nRow; iRow++) {
+    if (agg[iRow] != unassigned) continue;
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      if (strong[index] && (agg_seed[colind[index]] != unassigned)) {
+        agg[iRow] = agg_seed[colind[index]]; break;
+      }
+    }
+  }
+  
+  /*--- Last pass, whatever is left forms new aggregates with its free strong neighbors. ---*/
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    if (agg[iRow] != unassigned) continue;
+    agg[iRow] = nAgg;
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++)
+      if (strong[index] && (agg[colind[index]] == unassigned)) agg[colind[index]] = nAgg;
+    nAgg++;
+  }
+  
+  /*--- Sparse structure of the coarse level, A_IJ is non zero if one of its
+   rows i in I is connected to one row j in J. ---*/
+  
+  vector<unsigned long> agg_ptr(nAgg+1, 0), agg_row(nRow), marker(nAgg, unassigned);
+  for (iRow = 0; iRow < nRow; iRow++) agg_ptr[agg[iRow]+1]++;
+  for (jRow = 0; jRow < nAgg; jRow++) agg_ptr[jRow+1] += agg_ptr[jRow];
+  vector<unsigned long> next(agg_ptr.begin(), agg_ptr.end()-1);
+  for (iRow = 0; iRow < nRow; iRow++) agg_row[next[agg[iRow]]++] = iRow;
+  
+  vector<unsigned long> &c_rowptr = AMG_RowPtr[iLevel+1], &c_colind = AMG_ColInd[iLevel+1];
+  c_rowptr.assign(1, 0);
+  c_colind.clear();
+  
+  for (unsigned long iAgg = 0; iAgg < nAgg; iAgg++) {
+    unsigned long row_begin = c_colind.size();
+    for (next[0] = agg_ptr[iAgg]; next[0] < agg_ptr[iAgg+1]; next[0]++) {
+      iRow = agg_row[next[0]];
+      for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+        if (colind[index] >= nRow) continue;
+        jRow = agg[colind[index]];
+        if (marker[jRow] != iAgg) { marker[jRow] = iAgg; c_colind.push_back(jRow); }
+      }
+    }
+    sort(c_colind.begin()+row_begin, c_colind.end());
+    c_rowptr.push_back(c_colind.size());
+  }
+  
+  AMG_Val[iLevel+1].assign(c_colind.size()*nVar*nVar, 0.0);
+  
+  return nAgg;
+  
+}
+
+void CSysMatrix::AMGLevelValues(unsigned short iLevel) {
+  
+  unsigned long iRow, index, c_index, iVar, nRow = AMG_nRow[iLevel], *rowptr, *colind, I, J;
+  su2double *val, *Block;
+  
+  GetAMGLevel(iLevel, rowptr, colind, val);
+  
+  /*--- Inverse of the diagonal blocks, for the smoother of this level ---*/
+  
+  AMG_InvDiag[iLevel].resize(nRow*nVar*nVar);
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      if (colind[index] == iRow) {
+        Block = &val[index*nVar*nVar];
+        for (iVar = 0; iVar < nVar*nVar; iVar++) block[iVar] = Block[iVar];
+        InverseBlockKernel(block, &AMG_InvDiag[iLevel][iRow*nVar*nVar], nVar);
       }
     }
+  }
+  
+  if (iLevel+1 == nAMG_Level) return;
+  
+  /*--- Galerkin coarse matrix with piecewise constant prolongation,
+   A_IJ is the sum of the blocks A_ij with i in I and j in J. ---*/
+  
+  vector<unsigned long> &agg = AMG_Aggregate[iLevel], &c_rowptr = AMG_RowPtr[iLevel+1], &c_colind = AMG_ColInd[iLevel+1];
+  vector<su2double> &c_val = AMG_Val[iLevel+1];
+  
+  for (index = 0; index < c_val.size(); index++) c_val[index] = 0.0;
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    I = agg[iRow];
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      if (colind[index] >= nRow) continue;
+      J = agg[colind[index]];
+      c_index = lower_bound(c_colind.begin()+c_rowptr[I], c_colind.begin()+c_rowptr[I+1], J) - c_colind.begin();
+      Block = &val[index*nVar*nVar];
+      for (iVar = 0; iVar < nVar*nVar; iVar++) c_val[c_index*nVar*nVar+iVar] += Block[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::AMGResidual(unsigned short iLevel) {
+  
+  unsigned long iRow, index, iVar, nRow = AMG_nRow[iLevel], *rowptr, *colind;
+  su2double *val;
+  
+  GetAMGLevel(iLevel, rowptr, colind, val);
+  
+  vector<su2double> &x = AMG_Sol[iLevel], &b = AMG_Rhs[iLevel], &r = AMG_Res[iLevel];
+  
+  for (iRow = 0; iRow < nRow; iRow++) {
+    for (iVar = 0; iVar < nVar; iVar++) prod_row_vector[iVar] = 0.0;
+    for (index = rowptr[iRow]; index < rowptr[iRow+1]; index++) {
+      if (colind[index] >= nRow) continue;
+      MatVecAddBlock(&val[index*nVar*nVar], &x[colind[index]*nVar], prod_row_vector, nVar);
+    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      r[iRow*nVar+iVar] = b[iRow*nVar+iVar] - prod_row_vector[iVar];
+  }
+  
+}
+
+void CSysMatrix::AMGSmooth(unsigned short iLevel, unsigned short nSweep, bool zero_guess) {
+  
+  /*--- Damping of the block Jacobi smoother ---*/
+  
+  const su2double omega = 0.7;
+  
+  unsigned long iRow, iVar, nRow = AMG_nRow[iLevel];
+  unsigned short iSweep;
+  
+  vector<su2double> &x = AMG_Sol[iLevel], &b = AMG_Rhs[iLevel], &r = AMG_Res[iLevel];
+  
+  for (iSweep = 0; iSweep < nSweep; iSweep++) {
+    
+    if (zero_guess && (iSweep == 0)) {
+      for (iVar = 0; iVar < nRow*nVar; iVar++) { r[iVar] = b[iVar]; x[iVar] = 0.0; }
+    }
+    else AMGResidual(iLevel);
     
-    /*--- MPI Parallelization ---*/
+    for (iRow = 0; iRow < nRow; iRow++) {
+      MatVecBlock(&AMG_InvDiag[iLevel][iRow*nVar*nVar], &r[iRow*nVar], aux_vector, nVar);
+      for (iVar = 0; iVar < nVar; iVar++) x[iRow*nVar+iVar] += omega*aux_vector[iVar];
+    }
+  }
+  
+}
+
+void CSysMatrix::AMGCycle(unsigned short iLevel) {
+  
+  /*--- Pre and post smoothing sweeps, and sweeps on the coarsest level ---*/
+  
+  const unsigned short nSweep = 2, nSweep_Coarse = 20;
+  
+  unsigned long iRow, iVar, nRow = AMG_nRow[iLevel];
+  
+  if (iLevel+1 == nAMG_Level) {
+    AMGSmooth(iLevel, nSweep_Coarse, true);
+    return;
+  }
+  
+  AMGSmooth(iLevel, nSweep, true);
+  AMGResidual(iLevel);
+  
+  /*--- Restriction, the residual of the aggregate is the sum of the residuals of its rows ---*/
+  
+  vector<unsigned long> &agg = AMG_Aggregate[iLevel];
+  vector<su2double> &c_rhs = AMG_Rhs[iLevel+1], &c_sol = AMG_Sol[iLevel+1];
+  
+  for (iVar = 0; iVar < c_rhs.size(); iVar++) c_rhs[iVar] = 0.0;
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      c_rhs[agg[iRow]*nVar+iVar] += AMG_Res[iLevel][iRow*nVar+iVar];
+  
+  AMGCycle(iLevel+1);
+  
+  /*--- Prolongation of the coarse correction ---*/
+  
+  for (iRow = 0; iRow < nRow; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      AMG_Sol[iLevel][iRow*nVar+iVar] += c_sol[agg[iRow]*nVar+iVar];
+  
+  AMGSmooth(iLevel, nSweep, false);
+  
+}
+
+void CSysMatrix::BuildAMGPreconditioner(void) {
+  
+  /*--- Limits of the hierarchy: maximum number of levels, minimum number of
+   rows to coarsen a level, and minimum reduction of the number of rows. ---*/
+  
+  const unsigned short nLevel_Max = 10;
+  const unsigned long nRow_Min = 100;
+  const su2double ratio_Max = 0.85;
+  
+  unsigned short iLevel;
+  unsigned long nAgg;
+  
+  /*--- The aggregates and the sparse structure of the coarse levels are built
+   the first time, later calls only update the values of the coarse matrices. ---*/
+  
+  if (nAMG_Level == 0) {
     
-    SendReceive_Solution(prod, geometry, config);
+    AMG_nRow.assign(1, nPointDomain);
+    AMG_RowPtr.assign(nLevel_Max, vector<unsigned long>());
+    AMG_ColInd.assign(nLevel_Max, vector<unsigned long>());
+    AMG_Aggregate.assign(nLevel_Max, vector<unsigned long>());
+    AMG_Val.assign(nLevel_Max, vector<su2double>());
+    AMG_InvDiag.assign(nLevel_Max, vector<su2double>());
+    nAMG_Level = 1;
     
-    /*--- Solve linelet using a Thomas' algorithm ---*/
+    while ((nAMG_Level < nLevel_Max) && (AMG_nRow.back() > nRow_Min)) {
+      iLevel = nAMG_Level-1;
+      nAgg = AMGAggregate(iLevel);
+      if (nAgg > ratio_Max*AMG_nRow[iLevel]) break;
+      AMG_nRow.push_back(nAgg);
+      nAMG_Level++;
+      AMGLevelValues(iLevel);
+    }
     
-    for (iLinelet = 0; iLinelet < nLinelet; iLinelet++) {
+    AMG_InvDiag.resize(nAMG_Level);
+    AMG_Rhs.resize(nAMG_Level); AMG_Sol.resize(nAMG_Level); AMG_Res.resize(nAMG_Level);
+    for (iLevel = 0; iLevel < nAMG_Level; iLevel++) {
+      AMG_Rhs[iLevel].assign(AMG_nRow[iLevel]*nVar, 0.0);
+      AMG_Sol[iLevel].assign(AMG_nRow[iLevel]*nVar, 0.0);
+      AMG_Res[iLevel].assign(AMG_nRow[iLevel]*nVar, 0.0);
+    }
+    
+  }
+  
+  for (iLevel = 0; iLevel < nAMG_Level; iLevel++)
+    AMGLevelValues(iLevel);
+  
+}
+
+void CSysMatrix::ComputeAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iVar;
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++) AMG_Rhs[0][iVar] = vec[iVar];
+  
+  AMGCycle(0);
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++) prod[iVar] = AMG_Sol[0][iVar];
+  
+  /*--- MPI Parallelization ---*/
+  
+  SendReceive_Solution(prod, geometry, config);
+  
+}
+
+void CSysMatrix::BuildPressureAMGPreconditioner(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long index;
+  
+  /*--- The scalar matrix shares the sparse pattern of the coupled matrix, its
+   aggregates are built by the first call and kept for the next ones. ---*/
+  
+  if (PressureMatrix == NULL) {
+    PressureMatrix = new CSysMatrix();
+    PressureMatrix->Initialize(nPoint, nPointDomain, 1, 1, true, geometry, config);
+    if (PressureMatrix->nnz != nnz)
+      SU2_MPI::Error("PRESSURE_AMG requires the edge based sparse pattern of the finite volume solvers.", CURRENT_FUNCTION);
+    PressureCorrection.Initialize(nPoint, nPointDomain, nVar, 0.0);
+    PressureResidual.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  }
+  
+  /*--- The pressure block is the coupling of the first equation with the first
+   variable, i.e. the (0,0) entry of each block. ---*/
+  
+  for (index = 0; index < nnz; index++)
+    PressureMatrix->matrix[index] = matrix[index*nVar*nEqn];
+  
+  PressureMatrix->BuildAMGPreconditioner();
+  
+  BuildILUPreconditioner();
+  
+}
+
+void CSysMatrix::ComputePressureAMGPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, iVar;
+  
+  /*--- First stage, AMG V-cycle on the pressure block with the residual of the first equation ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    PressureMatrix->AMG_Rhs[0][iPoint] = vec[iPoint*nVar];
+  
+  PressureMatrix->AMGCycle(0);
+  
+  PressureCorrection = su2double(0.0);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    PressureCorrection[iPoint*nVar] = PressureMatrix->AMG_Sol[0][iPoint];
+  
+  SendReceive_Solution(PressureCorrection, geometry, config);
+  
+  /*--- Second stage, ILU on the residual of the coupled system left by the pressure correction ---*/
+  
+  MatrixVectorProduct(PressureCorrection, PressureResidual, geometry, config);
+  
+  for (iVar = 0; iVar < nPointDomain*nVar; iVar++)
+    PressureResidual[iVar] = vec[iVar] - PressureResidual[iVar];
+  
+  ComputeILUPreconditioner(PressureResidual, prod, geometry, config);
+  
+  /*--- The halos of both corrections are up to date ---*/
+  
+  for (iVar = 0; iVar < prod.GetLocSize(); iVar++)
+    prod[iVar] += PressureCorrection[iVar];
+  
+}
+
+void CSysMatrix::BuildRASStructure(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iMarker, MarkerS, MarkerR, iLayer;
+  unsigned long iPoint, jPoint, iRow, index, iVertex, iBlock, nRecv, nCol, begin, end;
+  long jRow;
+  
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+  SU2_MPI::Status status;
+#endif
+  
+  /*--- Halo points of the overlap, added by layers of the matrix graph around the domain.
+   The overlap is limited by the halo layers of the partitions. ---*/
+  
+  RAS_Row.assign(nPoint, -1);
+  RAS_Point.clear();
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    RAS_Row[iPoint] = iPoint;
+    RAS_Point.push_back(iPoint);
+  }
+  
+  begin = 0; end = nPointDomain;
+  for (iLayer = 0; iLayer < config->GetLinear_Solver_RAS_Overlap(); iLayer++) {
+    for (iRow = begin; iRow < end; iRow++) {
+      iPoint = RAS_Point[iRow];
+      for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+        jPoint = col_ind[index];
+        if (RAS_Row[jPoint] < 0) {
+          RAS_Row[jPoint] = RAS_Point.size();
+          RAS_Point.push_back(jPoint);
+        }
+      }
+    }
+    begin = end; end = RAS_Point.size();
+  }
+  RAS_nRow = RAS_Point.size();
+  
+  /*--- Columns of the extended rows, the domain rows are the local ones ---*/
+  
+  vector<vector<unsigned long> > RowCols(RAS_nRow);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+      if (RAS_Row[col_ind[index]] >= 0) RowCols[iPoint].push_back(RAS_Row[col_ind[index]]);
+  
+  /*--- The rows of the halo points come from their owners, as global indices of the
+   columns. Only the columns inside the extended problem are kept (restriction). ---*/
+  
+  map<unsigned long, unsigned long> Global2Local;
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    Global2Local[geometry->node[iPoint]->GetGlobalIndex()] = iPoint;
+  
+  vector<long> RecvRow, RecvCol;
+  RAS_nBlockSend.assign(config->GetnMarker_All(), 0);
+  RAS_nBlockRecv.assign(config->GetnMarker_All(), 0);
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
       
-      nElem = LineletPoint[iLinelet].size();
+      MarkerS = iMarker;  MarkerR = iMarker+1;
       
-      /*--- Copy vec vector to the new structure ---*/
+      /*--- Row lengths, then the global columns of the rows ---*/
       
-      for (iElem = 0; iElem < nElem; iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        for (iVar = 0; iVar < nVar; iVar++)
-          rVector[iElem][iVar] = vec[(unsigned long)(iPoint*nVar+iVar)];
+      vector<unsigned long> Buffer_Send, Buffer_Receive;
+      
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerS]; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        Buffer_Send.push_back(row_ptr[iPoint+1]-row_ptr[iPoint]);
       }
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerS]; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++)
+          Buffer_Send.push_back(geometry->node[col_ind[index]]->GetGlobalIndex());
+      }
+      RAS_nBlockSend[MarkerS] = Buffer_Send.size() - geometry->nVertex[MarkerS];
       
-      /*--- Initialization (iElem = 0) ---*/
+      unsigned long nBufferS = Buffer_Send.size(), nBufferR = 0;
       
-      iPoint = LineletPoint[iLinelet][0];
-      block = GetBlock(iPoint, iPoint);
-      for (iVar = 0; iVar < nVar; iVar++) {
-        yVector[0][iVar] = rVector[0][iVar];
-        for (jVar = 0; jVar < nVar; jVar++)
-          UBlock[0][iVar*nVar+jVar] = block[iVar*nVar+jVar];
-      }
+#ifdef HAVE_MPI
+      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
       
-      /*--- Main loop (without iElem = 0) ---*/
+      SU2_MPI::Sendrecv(&nBufferS, 1, MPI_UNSIGNED_LONG, send_to, 0,
+                        &nBufferR, 1, MPI_UNSIGNED_LONG, receive_from, 0, MPI_COMM_WORLD, &status);
+      Buffer_Receive.resize(nBufferR);
+      SU2_MPI::Sendrecv(Buffer_Send.data(), nBufferS, MPI_UNSIGNED_LONG, send_to, 0,
+                        Buffer_Receive.data(), nBufferR, MPI_UNSIGNED_LONG, receive_from, 0, MPI_COMM_WORLD, &status);
+#else
+      nBufferR = nBufferS;
+      Buffer_Receive = Buffer_Send;
+#endif
       
-      for (iElem = 1; iElem < nElem; iElem++) {
-        
-        im1Point = LineletPoint[iLinelet][iElem-1];
-        iPoint = LineletPoint[iLinelet][iElem];
-        
-        InverseBlock(UBlock[iElem-1], invUBlock[iElem-1]);
-        block = GetBlock(iPoint, im1Point); GetMultBlockBlock(LBlock[iElem], block, invUBlock[iElem-1]);
-        block = GetBlock(im1Point, iPoint); GetMultBlockBlock(LFBlock, LBlock[iElem], block);
-        block = GetBlock(iPoint, iPoint); GetSubsBlock(UBlock[iElem], block, LFBlock);
-        
-        /*--- Forward substituton ---*/
-        
-        GetMultBlockVector(LyVector, LBlock[iElem], yVector[iElem-1]);
-        GetSubsVector(yVector[iElem], rVector[iElem], LyVector);
-        
+      nRecv = geometry->nVertex[MarkerR];
+      RAS_nBlockRecv[MarkerR] = nBufferR - nRecv;
+      iBlock = nRecv;
+      
+      for (iVertex = 0; iVertex < nRecv; iVertex++) {
+        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+        nCol = Buffer_Receive[iVertex];
+        for (index = 0; index < nCol; index++, iBlock++) {
+          map<unsigned long, unsigned long>::const_iterator it = Global2Local.find(Buffer_Receive[iBlock]);
+          jRow = (it == Global2Local.end())? -1 : RAS_Row[it->second];
+          if ((RAS_Row[iPoint] >= (long)nPointDomain) && (jRow >= 0)) {
+            RowCols[RAS_Row[iPoint]].push_back(jRow);
+            RecvRow.push_back(RAS_Row[iPoint]);
+            RecvCol.push_back(jRow);
+          }
+          else {
+            RecvRow.push_back(-1);
+            RecvCol.push_back(-1);
+          }
+        }
       }
       
-      /*--- Backward substituton ---*/
+    }
+  }
+  
+  /*--- Compressed rows, with sorted columns ---*/
+  
+  RAS_RowPtr.assign(RAS_nRow+1, 0);
+  RAS_DiagPtr.assign(RAS_nRow, 0);
+  RAS_ColInd.clear();
+  
+  for (iRow = 0; iRow < RAS_nRow; iRow++) {
+    sort(RowCols[iRow].begin(), RowCols[iRow].end());
+    RowCols[iRow].erase(unique(RowCols[iRow].begin(), RowCols[iRow].end()), RowCols[iRow].end());
+    RAS_ColInd.insert(RAS_ColInd.end(), RowCols[iRow].begin(), RowCols[iRow].end());
+    RAS_RowPtr[iRow+1] = RAS_ColInd.size();
+  }
+  
+  for (iRow = 0; iRow < RAS_nRow; iRow++) {
+    RAS_DiagPtr[iRow] = lower_bound(RAS_ColInd.begin()+RAS_RowPtr[iRow], RAS_ColInd.begin()+RAS_RowPtr[iRow+1], iRow) - RAS_ColInd.begin();
+    if ((RAS_DiagPtr[iRow] == RAS_RowPtr[iRow+1]) || (RAS_ColInd[RAS_DiagPtr[iRow]] != iRow))
+      SU2_MPI::Error("The overlap of the RAS preconditioner is missing a diagonal block.", CURRENT_FUNCTION);
+  }
+  
+  /*--- Positions of the local and of the received blocks in the extended matrix ---*/
+  
+  RAS_Local.assign(row_ptr[nPointDomain], -1);
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++) {
+      jRow = RAS_Row[col_ind[index]];
+      if (jRow >= 0)
+        RAS_Local[index] = lower_bound(RAS_ColInd.begin()+RAS_RowPtr[iPoint], RAS_ColInd.begin()+RAS_RowPtr[iPoint+1],
+                                       (unsigned long)jRow) - RAS_ColInd.begin();
+    }
+  }
+  
+  RAS_RecvDest.assign(RecvRow.size(), -1);
+  for (iBlock = 0; iBlock < RecvRow.size(); iBlock++) {
+    if (RecvRow[iBlock] >= 0)
+      RAS_RecvDest[iBlock] = lower_bound(RAS_ColInd.begin()+RAS_RowPtr[RecvRow[iBlock]], RAS_ColInd.begin()+RAS_RowPtr[RecvRow[iBlock]+1],
+                                         (unsigned long)RecvCol[iBlock]) - RAS_ColInd.begin();
+  }
+  
+  RAS_Val.assign(RAS_ColInd.size()*nVar*nEqn, 0.0);
+  RAS_InvDiag.assign(RAS_nRow*nVar*nEqn, 0.0);
+  RAS_Vec.assign(RAS_nRow*nVar, 0.0);
+  
+}
+
+void CSysMatrix::BuildRASPreconditioner(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iMarker, MarkerS, MarkerR;
+  unsigned long iPoint, iRow, jRow, kRow, index, index_, iVertex, iVar, iBlock, iRecv;
+  const unsigned long nBlockSize = nVar*nEqn;
+  
+#ifdef HAVE_MPI
+  int send_to, receive_from;
+#endif
+  
+  /*--- The extended structure only depends on the sparse pattern, it is built once ---*/
+  
+  if (RAS_nRow == 0) BuildRASStructure(geometry, config);
+  
+  for (iVar = 0; iVar < RAS_Val.size(); iVar++) RAS_Val[iVar] = 0.0;
+  
+  /*--- Domain rows from the local matrix ---*/
+  
+  for (index = 0; index < row_ptr[nPointDomain]; index++)
+    if (RAS_Local[index] >= 0)
+      for (iVar = 0; iVar < nBlockSize; iVar++)
+        RAS_Val[RAS_Local[index]*nBlockSize+iVar] = matrix[index*nBlockSize+iVar];
+  
+  /*--- Rows of the halo points of the overlap from the ranks that own them ---*/
+  
+  iRecv = 0;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
+      
+      MarkerS = iMarker;  MarkerR = iMarker+1;
       
-      InverseBlock(UBlock[nElem-1], invUBlock[nElem-1]);
-      GetMultBlockVector(zVector[nElem-1], invUBlock[nElem-1], yVector[nElem-1]);
+      vector<su2double> Buffer_Send(RAS_nBlockSend[MarkerS]*nBlockSize), Buffer_Receive(RAS_nBlockRecv[MarkerR]*nBlockSize);
       
-      for (iElemLoop = nElem-2; iElemLoop >= 0; iElemLoop--) {
-        iPoint = LineletPoint[iLinelet][iElemLoop];
-        ip1Point = LineletPoint[iLinelet][iElemLoop+1];
-        block = GetBlock(iPoint, ip1Point); GetMultBlockVector(FzVector, block, zVector[iElemLoop+1]);
-        GetSubsVector(aux_vector, yVector[iElemLoop], FzVector);
-        GetMultBlockVector(zVector[iElemLoop], invUBlock[iElemLoop], aux_vector);
+      iBlock = 0;
+      for (iVertex = 0; iVertex < geometry->nVertex[MarkerS]; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        for (index = row_ptr[iPoint]; index < row_ptr[iPoint+1]; index++, iBlock++)
+          for (iVar = 0; iVar < nBlockSize; iVar++)
+            Buffer_Send[iBlock*nBlockSize+iVar] = matrix[index*nBlockSize+iVar];
       }
       
-      /*--- Copy zVector to the prod vector ---*/
+#ifdef HAVE_MPI
+      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+      SendRecvBuffers(Buffer_Send.data(), Buffer_Send.size(), send_to, Buffer_Receive.data(), Buffer_Receive.size(), receive_from);
+#else
+      Buffer_Receive = Buffer_Send;
+#endif
       
-      for (iElem = 0; iElem < nElem; iElem++) {
-        iPoint = LineletPoint[iLinelet][iElem];
-        for (iVar = 0; iVar < nVar; iVar++)
-          prod[(unsigned long)(iPoint*nVar+iVar)] = zVector[iElem][iVar];
-      }
+      for (iBlock = 0; iBlock < RAS_nBlockRecv[MarkerR]; iBlock++, iRecv++)
+        if (RAS_RecvDest[iRecv] >= 0)
+          for (iVar = 0; iVar < nBlockSize; iVar++)
+            RAS_Val[RAS_RecvDest[iRecv]*nBlockSize+iVar] = Buffer_Receive[iBlock*nBlockSize+iVar];
       
     }
+  }
+  
+  /*--- ILU(0) factorization of the extended matrix, the lower blocks store
+   Aij*inv(Ujj) and the inverses of the diagonal blocks are kept apart ---*/
+  
+  vector<long> RowPos(RAS_nRow, -1);
+  
+  for (iRow = 0; iRow < RAS_nRow; iRow++) {
     
-    /*--- MPI Parallelization ---*/
+    for (index = RAS_RowPtr[iRow]; index < RAS_RowPtr[iRow+1]; index++)
+      RowPos[RAS_ColInd[index]] = index;
     
-    SendReceive_Solution(prod, geometry, config);
+    for (index = RAS_RowPtr[iRow]; index < RAS_DiagPtr[iRow]; index++) {
+      jRow = RAS_ColInd[index];
+      MatrixMatrixProduct(&RAS_Val[index*nBlockSize], &RAS_InvDiag[jRow*nBlockSize], block_weight);
+      for (iVar = 0; iVar < nBlockSize; iVar++) RAS_Val[index*nBlockSize+iVar] = block_weight[iVar];
+      
+      for (index_ = RAS_DiagPtr[jRow]+1; index_ < RAS_RowPtr[jRow+1]; index_++) {
+        kRow = RAS_ColInd[index_];
+        if (RowPos[kRow] < 0) continue;
+        MatrixMatrixProduct(block_weight, &RAS_Val[index_*nBlockSize], block);
+        for (iVar = 0; iVar < nBlockSize; iVar++) RAS_Val[RowPos[kRow]*nBlockSize+iVar] -= block[iVar];
+      }
+    }
+    
+    InverseBlock(&RAS_Val[RAS_DiagPtr[iRow]*nBlockSize], &RAS_InvDiag[iRow*nBlockSize]);
     
+    for (index = RAS_RowPtr[iRow]; index < RAS_RowPtr[iRow+1]; index++)
+      RowPos[RAS_ColInd[index]] = -1;
   }
-  else {
-    SU2_MPI::Error("Linelet not implemented in parallel.", CURRENT_FUNCTION);
+  
+}
+
+void CSysMatrix::ComputeRASPreconditioner(const CSysVector & vec, CSysVector & prod, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iRow, iPoint, index;
+  unsigned short iVar;
+  
+  /*--- Residual of the overlap, the halo values are those of the owners ---*/
+  
+  prod = vec;
+  SendReceive_Solution(prod, geometry, config);
+  
+  for (iRow = 0; iRow < RAS_nRow; iRow++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      RAS_Vec[iRow*nVar+iVar] = prod[RAS_Point[iRow]*nVar+iVar];
+  
+  /*--- Forward and backward solves of the extended problem ---*/
+  
+  for (iRow = 1; iRow < RAS_nRow; iRow++) {
+    for (index = RAS_RowPtr[iRow]; index < RAS_DiagPtr[iRow]; index++) {
+      MatrixVectorProduct(&RAS_Val[index*nVar*nEqn], &RAS_Vec[RAS_ColInd[index]*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++) RAS_Vec[iRow*nVar+iVar] -= aux_vector[iVar];
+    }
+  }
+  
+  for (iRow = RAS_nRow; iRow-- > 0; ) {
+    for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] = RAS_Vec[iRow*nVar+iVar];
+    for (index = RAS_DiagPtr[iRow]+1; index < RAS_RowPtr[iRow+1]; index++) {
+      MatrixVectorProduct(&RAS_Val[index*nVar*nEqn], &RAS_Vec[RAS_ColInd[index]*nVar], aux_vector);
+      for (iVar = 0; iVar < nVar; iVar++) sum_vector[iVar] -= aux_vector[iVar];
+    }
+    MatrixVectorProduct(&RAS_InvDiag[iRow*nVar*nEqn], sum_vector, &RAS_Vec[iRow*nVar]);
   }
   
+  /*--- Restriction, only the domain points keep the solution of the extended
+   problem, the halos are then updated by their owners ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      prod[iPoint*nVar+iVar] = RAS_Vec[iPoint*nVar+iVar];
+  
+  SendReceive_Solution(prod, geometry, config);
+  
 }
 
 void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, CSysVector & res) {
@@ -2294,3 +4154,29 @@ void CSysMatrix::ComputeResidual(const CSysVector & sol, const CSysVector & f, C
   }
   
 }
+
+CJacobiTransposedPreconditioner::CJacobiTransposedPreconditioner(CSysMatrix & matrix_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  sparse_matrix = &matrix_ref;
+  geometry = geometry_ref;
+  config = config_ref;
+}
+
+void CJacobiTransposedPreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  if (sparse_matrix == NULL) {
+    cerr << "CJacobiTransposedPreconditioner::operator()(const CSysVector &, CSysVector &): " << endl;
+    cerr << "pointer to sparse matrix is NULL." << endl;
+    throw(-1);
+  }
+  sparse_matrix->ComputeJacobiPreconditionerTransposed(u, v, geometry, config);
+}
+
+/*--- Explicit instantiations of the halo exchanges, the passive vectors only
+ differ from the active ones in the AD and single precision builds ---*/
+
+template void CSysMatrix::SendReceive_Solution(CSysVector & x, CGeometry *geometry, CConfig *config);
+template void CSysMatrix::SendReceive_SolutionTransposed(CSysVector & x, CGeometry *geometry, CConfig *config);
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(SINGLE_PRECISION)
+template void CSysMatrix::SendReceive_Solution(CSysVectorPassive & x, CGeometry *geometry, CConfig *config);
+template void CSysMatrix::SendReceive_SolutionTransposed(CSysVectorPassive & x, CGeometry *geometry, CConfig *config);
+#endif
@@ -0,0 +1,105 @@
+/*!
+ * \file memory_pool.cpp
+ * \brief Functions of the pool allocator for the small objects of the geometry and solver.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/memory_pool.hpp"
+
+CMemoryPool::CMemoryPool(void) : sizeClasses(maxSize/alignment + 1) { }
+
+CMemoryPool::~CMemoryPool(void) {
+
+  for (size_t iClass = 0; iClass < sizeClasses.size(); iClass++)
+    for (size_t iChunk = 0; iChunk < sizeClasses[iClass].chunks.size(); iChunk++)
+      ::operator delete(sizeClasses[iClass].chunks[iChunk]);
+}
+
+void *CMemoryPool::Allocate(size_t size) {
+
+  if ((size == 0) || (size > maxSize)) return ::operator new(size);
+
+  /*--- Determine the size class and refill its free list with a new chunk
+   if it is empty. ---*/
+
+  const size_t iClass  = (size + alignment - 1)/alignment;
+  const size_t objSize = iClass*alignment;
+  CSizeClass &sizeClass = sizeClasses[iClass];
+
+  if (sizeClass.freeList == NULL) {
+    const size_t nObj = chunkBytes/objSize;
+    char *chunk = static_cast<char *>(::operator new(nObj*objSize));
+    sizeClass.chunks.push_back(chunk);
+
+    for (size_t iObj = 0; iObj < nObj; iObj++) {
+      void *obj = chunk + (nObj-1-iObj)*objSize;
+      *static_cast<void **>(obj) = sizeClass.freeList;
+      sizeClass.freeList = obj;
+    }
+  }
+
+  /*--- Take the first free object. ---*/
+
+  void *obj = sizeClass.freeList;
+  sizeClass.freeList = *static_cast<void **>(obj);
+  sizeClass.nLive++;
+
+  return obj;
+}
+
+void CMemoryPool::Deallocate(void *ptr, size_t size) {
+
+  if (ptr == NULL) return;
+
+  if ((size == 0) || (size > maxSize)) {
+    ::operator delete(ptr);
+    return;
+  }
+
+  CSizeClass &sizeClass = sizeClasses[(size + alignment - 1)/alignment];
+
+  /*--- Put the object back on the free list. When no objects of this size
+   are in use anymore, all chunks are released in one step. ---*/
+
+  *static_cast<void **>(ptr) = sizeClass.freeList;
+  sizeClass.freeList = ptr;
+  sizeClass.nLive--;
+
+  if (sizeClass.nLive == 0) {
+    for (size_t iChunk = 0; iChunk < sizeClass.chunks.size(); iChunk++)
+      ::operator delete(sizeClass.chunks[iChunk]);
+    sizeClass.chunks.clear();
+    sizeClass.freeList = NULL;
+  }
+}
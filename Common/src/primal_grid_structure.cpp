@@ -63,6 +63,15 @@ CPrimalGrid::~CPrimalGrid() {
  if (JacobianFaceIsConstant != NULL) delete[] JacobianFaceIsConstant;
 }
 
+static CMemoryPool& PrimalGridPool(void) {
+  static CMemoryPool pool;
+  return pool;
+}
+
+void *CPrimalGrid::operator new(size_t size) { return PrimalGridPool().Allocate(size); }
+
+void CPrimalGrid::operator delete(void *ptr, size_t size) { PrimalGridPool().Deallocate(ptr, size); }
+
 void CPrimalGrid::SetCoord_CG(su2double **val_coord) {
 	unsigned short iDim, iNode, NodeFace, iFace;
 	
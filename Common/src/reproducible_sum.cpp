@@ -0,0 +1,161 @@
+/*!
+ * \file reproducible_sum.cpp
+ * \brief Exact, order independent sums for the reproducible parallel reductions.
+ * \author SU2 contributors
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/reproducible_sum.hpp"
+#include "../include/comm_profiler.hpp"
+
+bool CReproducibleSum::Active = false;
+
+CReproducibleSum::CReproducibleSum(unsigned long val_nSum) {
+  
+  nSum = val_nSum;
+  
+  Digit.assign(nSum*nDigit, 0);
+  NonFinite.assign(nSum, 0.0);
+  nAdd.assign(nSum, 0);
+  
+}
+
+CReproducibleSum::~CReproducibleSum(void) { }
+
+void CReproducibleSum::Reset(void) {
+  
+  Digit.assign(nSum*nDigit, 0);
+  NonFinite.assign(nSum, 0.0);
+  nAdd.assign(nSum, 0);
+  
+}
+
+void CReproducibleSum::Reset(unsigned long iSum) {
+  
+  for (unsigned short iDigit = 0; iDigit < nDigit; iDigit++)
+    Digit[iSum*nDigit + iDigit] = 0;
+  NonFinite[iSum] = 0.0;
+  nAdd[iSum] = 0;
+  
+}
+
+void CReproducibleSum::Normalize(long long *digit) {
+  
+  const long long base = 4294967296LL;
+  
+  /*--- Floor division, so that the remainder is positive ---*/
+  
+  for (unsigned short iDigit = 0; iDigit < nDigit-1; iDigit++) {
+    long long carry = digit[iDigit]/base;
+    if (digit[iDigit] - carry*base < 0) carry--;
+    digit[iDigit]   -= carry*base;
+    digit[iDigit+1] += carry;
+  }
+  
+}
+
+passivedouble CReproducibleSum::Round(long long *digit, passivedouble nonfinite) {
+  
+  unsigned short iDigit;
+  
+  if (nonfinite != 0.0) return nonfinite;
+  
+  Normalize(digit);
+  
+  /*--- Sign and magnitude, the digits of a negative sum are negated and
+   normalized again, so that all of them are positive ---*/
+  
+  const bool negative = (digit[nDigit-1] < 0);
+  if (negative) {
+    for (iDigit = 0; iDigit < nDigit; iDigit++) digit[iDigit] = -digit[iDigit];
+    Normalize(digit);
+  }
+  
+  /*--- From the most significant digit down, the additions are always done in
+   the same order, the rounding is then the same for any partitioning ---*/
+  
+  passivedouble value = 0.0;
+  for (iDigit = nDigit; iDigit > 0; iDigit--) {
+    if (digit[iDigit-1] != 0)
+      value += ldexp((passivedouble)digit[iDigit-1], 32*(iDigit-1) - Exp_Offset);
+  }
+  
+  return negative? -value : value;
+  
+}
+
+passivedouble CReproducibleSum::GetSum(unsigned long iSum) {
+  
+  vector<long long> digit(Digit.begin() + iSum*nDigit, Digit.begin() + (iSum+1)*nDigit);
+  
+  return Round(digit.data(), NonFinite[iSum]);
+  
+}
+
+void CReproducibleSum::AllReduce(passivedouble *val_sum) {
+  
+  unsigned long iSum;
+  
+  /*--- Normalized digits are below 2^32 (the last one is small), the integer
+   sum over the ranks can not overflow ---*/
+  
+  vector<long long> digit(Digit);
+  for (iSum = 0; iSum < nSum; iSum++)
+    Normalize(&digit[iSum*nDigit]);
+  
+  vector<passivedouble> nonfinite(NonFinite);
+  
+#ifdef HAVE_MPI
+  
+  /*--- The passive values of the AD builds bypass the AD wrapper of MPI ---*/
+  
+  vector<long long> digit_global(nSum*nDigit);
+  vector<passivedouble> nonfinite_global(nSum);
+  
+  const double tick = CCommProfiler::GetActive()? CCommProfiler::GetTime() : 0.0;
+  
+  CBaseMPIWrapper::Allreduce(digit.data(), digit_global.data(), nSum*nDigit, MPI_LONG_LONG, MPI_SUM, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Allreduce(nonfinite.data(), nonfinite_global.data(), nSum, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  
+  if (CCommProfiler::GetActive())
+    CCommProfiler::AddCall(CCommProfiler::GetCategory("Allreduce_Reproducible", true), CCommProfiler::GetTime()-tick);
+  
+  digit.swap(digit_global);
+  nonfinite.swap(nonfinite_global);
+  
+#endif
+  
+  for (iSum = 0; iSum < nSum; iSum++)
+    val_sum[iSum] = Round(&digit[iSum*nDigit], nonfinite[iSum]);
+  
+}
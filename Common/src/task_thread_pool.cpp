@@ -0,0 +1,362 @@
+/*!
+ * \file task_thread_pool.cpp
+ * \brief Functions of the thread pool, which carries out chunks of the tasks of the SU2 solvers.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/task_thread_pool.hpp"
+
+bool CTaskThreadPool::affinityReported = false;
+
+CTaskThreadPool::CTaskThreadPool(unsigned short    val_nThreads,
+                                 TaskChunkFunction val_function,
+                                 void              *val_owner) {
+
+  /* Copy the data from the arguments. Without threads the calling
+     thread is the only one in the pool. */
+  chunkFunction = val_function;
+  owner         = val_owner;
+  nChunksQueued = 0;
+  nextQueue     = 0;
+
+#ifdef HAVE_PTHREAD
+  nThreads = max(val_nThreads, (unsigned short) 1);
+#else
+  nThreads = 1;
+#endif
+
+  queues.resize(nThreads);
+  threadCPU.assign(nThreads, -1);
+
+#ifdef HAVE_PTHREAD
+
+  /* Initialize the synchronization objects. */
+  shutDown = false;
+  pthread_key_create(&threadIndexKey, NULL);
+  pthread_mutex_init(&poolMutex, NULL);
+  pthread_cond_init(&poolCond, NULL);
+
+  queueMutex = new pthread_mutex_t[nThreads];
+  for(unsigned short i=0; i<nThreads; ++i)
+    pthread_mutex_init(&queueMutex[i], NULL);
+
+  /* Start the worker threads. The data of the workers must be set before any
+     thread is started, because a resize of workerData invalidates the pointers.
+     If a thread cannot be created, its queue is still used. The chunks in it
+     are then stolen by the other threads. */
+  workerData.resize(nThreads);
+  for(unsigned short i=0; i<nThreads; ++i) {
+    workerData[i].pool    = this;
+    workerData[i].iThread = i;
+  }
+
+  /* The workers are started on their CPUs, if they are bound, such that
+     everything they touch first, e.g. their stacks and their part of the
+     arrays initialized in parallel, is placed on their NUMA domain. */
+  SetThreadCPUs();
+
+  for(unsigned short i=1; i<nThreads; ++i) {
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+#ifdef HAVE_THREAD_AFFINITY
+    if(threadCPU[i] >= 0) {
+      cpu_set_t cpuSet;
+      CPU_ZERO(&cpuSet);
+      CPU_SET(threadCPU[i], &cpuSet);
+      pthread_attr_setaffinity_np(&attr, sizeof(cpu_set_t), &cpuSet);
+    }
+#endif
+    pthread_t thread;
+    if(pthread_create(&thread, &attr, WorkerThread, (void *) &workerData[i]) == 0)
+      threads.push_back(thread);
+    else
+      threadCPU[i] = -1;
+    pthread_attr_destroy(&attr);
+  }
+#endif
+
+  /* Report the placement once, for the first pool with threads. */
+  if((nThreads > 1) && !affinityReported) {
+    ReportAffinity();
+    affinityReported = true;
+  }
+}
+
+CTaskThreadPool::~CTaskThreadPool(void) {
+
+#ifdef HAVE_PTHREAD
+
+  /* Signal the worker threads to terminate and wait until they are done. */
+  pthread_mutex_lock(&poolMutex);
+  shutDown = true;
+  pthread_cond_broadcast(&poolCond);
+  pthread_mutex_unlock(&poolMutex);
+
+  for(unsigned short i=0; i<threads.size(); ++i)
+    pthread_join(threads[i], NULL);
+
+  /* Release the synchronization objects. */
+  for(unsigned short i=0; i<nThreads; ++i)
+    pthread_mutex_destroy(&queueMutex[i]);
+  delete [] queueMutex;
+
+  pthread_cond_destroy(&poolCond);
+  pthread_mutex_destroy(&poolMutex);
+  pthread_key_delete(threadIndexKey);
+#endif
+}
+
+void CTaskThreadPool::ResetTasks(const unsigned long val_nTasks) {
+
+  nChunksLeft.assign(val_nTasks, 0);
+  nextQueue = 0;
+}
+
+void CTaskThreadPool::LaunchTask(const int                    indTask,
+                                 const vector<unsigned long> &bounds) {
+
+  /* Determine the number of chunks of this task and set the counters
+     before any chunk can be taken or completed. Hence nChunksQueued is
+     never smaller than the actual number of chunks in the queues. */
+  const unsigned long nChunks = bounds.size() - 1;
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&poolMutex);
+#endif
+  nChunksLeft[indTask] = nChunks;
+  nChunksQueued       += nChunks;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_unlock(&poolMutex);
+#endif
+
+  /* Distribute the chunks in a round robin manner over the queues of the
+     threads. The starting queue is continued from the previous task, such
+     that the work of tasks with less chunks than threads is spread as well. */
+  for(unsigned long i=0; i<nChunks; ++i) {
+
+    CTaskChunk chunk;
+    chunk.indTask = indTask;
+    chunk.indBeg  = bounds[i];
+    chunk.indEnd  = bounds[i+1];
+
+    const unsigned short iQueue = nextQueue%nThreads;
+    ++nextQueue;
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&queueMutex[iQueue]);
+#endif
+    queues[iQueue].push_back(chunk);
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock(&queueMutex[iQueue]);
+#endif
+  }
+
+  /* Wake up the sleeping worker threads. */
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&poolMutex);
+  pthread_cond_broadcast(&poolCond);
+  pthread_mutex_unlock(&poolMutex);
+#endif
+}
+
+bool CTaskThreadPool::TaskCompleted(const int indTask) {
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&poolMutex);
+  const bool completed = nChunksLeft[indTask] == 0;
+  pthread_mutex_unlock(&poolMutex);
+  return completed;
+#else
+  return nChunksLeft[indTask] == 0;
+#endif
+}
+
+bool CTaskThreadPool::RunChunk(void) {
+
+  CTaskChunk chunk;
+  if( !TakeChunk(GetThreadIndex(), chunk) ) return false;
+
+  ExecuteChunk(chunk);
+  return true;
+}
+
+bool CTaskThreadPool::TakeChunk(const unsigned short iThread,
+                                CTaskChunk           &chunk) {
+
+  /* Loop over the queues, starting with the own queue. The own queue is
+     used as a stack, such that the most recently launched task, whose data
+     is most likely still in cache, is carried out first. Chunks of other
+     threads are stolen from the front, i.e. the oldest chunks. */
+  bool found = false;
+  for(unsigned short i=0; i<nThreads; ++i) {
+    const unsigned short iQueue = (iThread+i)%nThreads;
+
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&queueMutex[iQueue]);
+#endif
+    if( !queues[iQueue].empty() ) {
+      if(i == 0) {chunk = queues[iQueue].back();  queues[iQueue].pop_back();}
+      else       {chunk = queues[iQueue].front(); queues[iQueue].pop_front();}
+      found = true;
+    }
+#ifdef HAVE_PTHREAD
+    pthread_mutex_unlock(&queueMutex[iQueue]);
+#endif
+
+    if( found ) break;
+  }
+
+  /* Update the number of queued chunks. */
+  if( found ) {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&poolMutex);
+    --nChunksQueued;
+    pthread_mutex_unlock(&poolMutex);
+#else
+    --nChunksQueued;
+#endif
+  }
+
+  return found;
+}
+
+void CTaskThreadPool::ExecuteChunk(const CTaskChunk &chunk) {
+
+  /* Carry out the chunk and decrement the number of chunks of its task. */
+  chunkFunction(owner, chunk);
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&poolMutex);
+  --nChunksLeft[chunk.indTask];
+  pthread_mutex_unlock(&poolMutex);
+#else
+  --nChunksLeft[chunk.indTask];
+#endif
+}
+
+void CTaskThreadPool::SetThreadCPUs(void) {
+
+#ifdef HAVE_THREAD_AFFINITY
+
+  /* CPUs to which the launcher bound the rank, i.e. the calling thread. */
+  cpu_set_t rankSet;
+  CPU_ZERO(&rankSet);
+  if(sched_getaffinity(0, sizeof(cpu_set_t), &rankSet) != 0) return;
+
+  vector<int> rankCPUs;
+  for(int cpu=0; cpu<CPU_SETSIZE; ++cpu)
+    if( CPU_ISSET(cpu, &rankSet) ) rankCPUs.push_back(cpu);
+
+  /* Worker i is bound to the i-th CPU of the rank. The calling thread keeps
+     the CPUs of the rank, it is the one that waits for MPI. */
+  const long nCPUsNode = sysconf(_SC_NPROCESSORS_ONLN);
+  if((rankCPUs.size() < nThreads) || ((long) rankCPUs.size() >= nCPUsNode)) return;
+
+  for(unsigned short i=1; i<nThreads; ++i)
+    threadCPU[i] = rankCPUs[i];
+#endif
+}
+
+void CTaskThreadPool::ReportAffinity(void) const {
+
+  /* Line of this rank, with the CPU of every thread or - if it is not bound. */
+  const int lenLine = 512;
+  const int rank = SU2_MPI::GetRank(), size = SU2_MPI::GetSize();
+
+  string hostName = "localhost";
+#ifdef HAVE_MPI
+  char procName[MPI_MAX_PROCESSOR_NAME];
+  int  lenName;
+  if(MPI_Get_processor_name(procName, &lenName) == MPI_SUCCESS)
+    hostName = string(procName, lenName);
+#endif
+
+  ostringstream line;
+  line << "Rank " << rank << " on " << hostName << ", CPUs of the threads:";
+  for(unsigned short i=0; i<nThreads; ++i) {
+    if(threadCPU[i] >= 0) line << " " << threadCPU[i];
+    else                  line << " -";
+  }
+
+  vector<char> sendBuf(lenLine, '\0');
+  strncpy(&sendBuf[0], line.str().c_str(), lenLine-1);
+
+  vector<char> recvBuf((rank == 0) ? size*lenLine : lenLine, '\0');
+  SU2_MPI::Gather(&sendBuf[0], lenLine, MPI_CHAR, &recvBuf[0], lenLine, MPI_CHAR,
+                  0, MPI_COMM_WORLD);
+
+  if(rank == 0) {
+    cout << endl << "Placement of the threads (- if not bound):" << endl;
+    for(int i=0; i<size; ++i)
+      cout << "  " << &recvBuf[i*lenLine] << endl;
+  }
+}
+
+#ifdef HAVE_PTHREAD
+void CTaskThreadPool::WorkerLoop(const unsigned short iThread) {
+
+  for(;;) {
+
+    /* Carry out chunks as long as they can be found. */
+    CTaskChunk chunk;
+    if( TakeChunk(iThread, chunk) ) {
+      ExecuteChunk(chunk);
+      continue;
+    }
+
+    /* No chunk found. Sleep until new chunks are queued or the pool is
+       destructed. Note that nChunksQueued can be positive while TakeChunk
+       fails, when another thread has taken the last chunk, but did not
+       update the counter yet, or when the chunks of a task are still being
+       queued. In that case the loop is simply repeated. */
+    pthread_mutex_lock(&poolMutex);
+    while((nChunksQueued == 0) && !shutDown)
+      pthread_cond_wait(&poolCond, &poolMutex);
+    const bool terminate = shutDown;
+    pthread_mutex_unlock(&poolMutex);
+
+    if( terminate ) break;
+  }
+}
+
+void *CTaskThreadPool::WorkerThread(void *data) {
+
+  /* Store the data of this thread, such that GetThreadIndex can retrieve
+     its index, and start the loop that carries out the chunks. */
+  CWorkerData *workerData = (CWorkerData *) data;
+  pthread_setspecific(workerData->pool->threadIndexKey, data);
+  workerData->pool->WorkerLoop(workerData->iThread);
+  return NULL;
+}
+#endif
@@ -36,14 +36,92 @@
  */
 
 #include "../include/vector_structure.hpp"
+#include "../include/reproducible_sum.hpp"
+#include "../include/comm_profiler.hpp"
 
-CSysVector::CSysVector(void) {
+#ifdef HAVE_MPI
+
+/*--- Sum over all processors of the local dot products. The passive values
+ of the AD builds bypass the AD wrapper of MPI, which reduces MPI_DOUBLE
+ buffers as active types. The time of the reductions of the linear solvers
+ goes to the communication statistics. ---*/
+
+static void SumAllProcessors(su2double *loc_prod, su2double *prod, int count) {
+  const double tick = CCommProfiler::GetActive()? CCommProfiler::GetTime() : 0.0;
+  SU2_MPI::Allreduce(loc_prod, prod, count, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if (CCommProfiler::GetActive())
+    CCommProfiler::AddCall(CCommProfiler::GetCategory("Allreduce_DotProduct", true), CCommProfiler::GetTime()-tick);
+}
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(SINGLE_PRECISION)
+static void SumAllProcessors(passivedouble *loc_prod, passivedouble *prod, int count) {
+  const double tick = CCommProfiler::GetActive()? CCommProfiler::GetTime() : 0.0;
+  CBaseMPIWrapper::Allreduce(loc_prod, prod, count, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  if (CCommProfiler::GetActive())
+    CCommProfiler::AddCall(CCommProfiler::GetCategory("Allreduce_DotProduct", true), CCommProfiler::GetTime()-tick);
+}
+#endif
+
+#endif
+
+/*--- Exact inner products of the domain elements for REPRODUCIBLE_REDUCTIONS,
+ the result does not depend on the partitioning nor on the order of the MPI
+ reduction. The active type of the AD builds keeps the usual sums (returns false). ---*/
+
+static bool ReproducibleDotProd(const passivedouble *u, const passivedouble * const *v,
+                                unsigned long nVec, unsigned long nElmDomain, passivedouble *prod) {
+  
+  if (!CReproducibleSum::GetActive()) return false;
+  
+  CReproducibleSum Sum(nVec);
+  for (unsigned long k = 0; k < nVec; k++)
+    for (unsigned long i = 0; i < nElmDomain; i++)
+      Sum.Add(k, u[i]*v[k][i]);
+  Sum.AllReduce(prod);
+  
+  return true;
+}
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+static bool ReproducibleDotProd(const su2double *u, const su2double * const *v,
+                                unsigned long nVec, unsigned long nElmDomain, su2double *prod) {
+  return false;
+}
+#elif defined(SINGLE_PRECISION)
+static bool ReproducibleDotProd(const su2double *u, const su2double * const *v,
+                                unsigned long nVec, unsigned long nElmDomain, su2double *prod) {
+  
+  if (!CReproducibleSum::GetActive()) return false;
+  
+  CReproducibleSum Sum(nVec);
+  vector<passivedouble> prod_double(nVec);
+  for (unsigned long k = 0; k < nVec; k++)
+    for (unsigned long i = 0; i < nElmDomain; i++)
+      Sum.Add(k, passivedouble(u[i])*v[k][i]);
+  Sum.AllReduce(prod_double.data());
+  for (unsigned long k = 0; k < nVec; k++) prod[k] = prod_double[k];
+  
+  return true;
+}
+#endif
+
+/*--- Type of the local sums of the inner products, the single precision
+ vectors accumulate in double. ---*/
+
+template<class ScalarType> struct AccumType { typedef ScalarType Type; };
+#if defined(SINGLE_PRECISION) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+template<> struct AccumType<su2double> { typedef accumdouble Type; };
+#endif
+
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(void) {
   
   vec_val = NULL;
   
 }
 
-CSysVector::CSysVector(const unsigned long & size, const su2double & val) {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(const unsigned long & size, const ScalarType & val) {
   
   nElm = size; nElmDomain = size;
   nBlk = nElm; nBlkDomain = nElmDomain;
@@ -56,7 +134,7 @@ CSysVector::CSysVector(const unsigned long & size, const su2double & val) {
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned int i = 0; i < nElm; i++)
     vec_val[i] = val;
   
@@ -67,8 +145,9 @@ CSysVector::CSysVector(const unsigned long & size, const su2double & val) {
   
 }
 
-CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
-                       const su2double & val) {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
+                       const ScalarType & val) {
 
   nElm = numBlk*numVar; nElmDomain = numBlkDomain*numVar;
   nBlk = numBlk; nBlkDomain = numBlkDomain;
@@ -81,7 +160,7 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 	
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned int i = 0; i < nElm; i++)
     vec_val[i] = val;
   
@@ -92,14 +171,15 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
   
 }
 
-CSysVector::CSysVector(const CSysVector & u) {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(const TCSysVector<ScalarType> & u) {
   
   /*--- Copy size information, allocate memory, and initialize values ---*/
   nElm = u.nElm; nElmDomain = u.nElmDomain;
   nBlk = u.nBlk; nBlkDomain = u.nBlkDomain;
   nVar = u.nVar;
   
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = u.vec_val[i];
   
@@ -109,7 +189,8 @@ CSysVector::CSysVector(const CSysVector & u) {
   
 }
 
-CSysVector::CSysVector(const unsigned long & size, const su2double* u_array) {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(const unsigned long & size, const ScalarType* u_array) {
   
   nElm = size; nElmDomain = size;
   nBlk = nElm; nBlkDomain = nElmDomain;
@@ -122,7 +203,7 @@ CSysVector::CSysVector(const unsigned long & size, const su2double* u_array) {
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = u_array[i];
 
@@ -133,8 +214,9 @@ CSysVector::CSysVector(const unsigned long & size, const su2double* u_array) {
   
 }
 
-CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
-                       const su2double* u_array) {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar,
+                       const ScalarType* u_array) {
 
   nElm = numBlk*numVar; nElmDomain = numBlkDomain*numVar;
   nBlk = numBlk; nBlkDomain = numBlkDomain;
@@ -147,7 +229,7 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = u_array[i];
 
@@ -158,7 +240,27 @@ CSysVector::CSysVector(const unsigned long & numBlk, const unsigned long & numBl
   
 }
 
-CSysVector::~CSysVector() {
+template<class ScalarType>
+TCSysVector<ScalarType>::TCSysVector(TCSysVector<ScalarType> && u) noexcept {
+  
+  /*--- Take over the size information and the storage of u ---*/
+  nElm = u.nElm; nElmDomain = u.nElmDomain;
+  nBlk = u.nBlk; nBlkDomain = u.nBlkDomain;
+  nVar = u.nVar;
+  vec_val = u.vec_val;
+  
+#ifdef HAVE_MPI
+  nElmGlobal = u.nElmGlobal;
+#endif
+  
+  u.vec_val = NULL;
+  u.nElm = 0; u.nElmDomain = 0;
+  u.nBlk = 0; u.nBlkDomain = 0;
+  
+}
+
+template<class ScalarType>
+TCSysVector<ScalarType>::~TCSysVector() {
   delete [] vec_val;
   
   nElm = 0; nElmDomain = 0;
@@ -167,7 +269,8 @@ CSysVector::~CSysVector() {
   
 }
 
-void CSysVector::Initialize(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const su2double & val) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::Initialize(const unsigned long & numBlk, const unsigned long & numBlkDomain, const unsigned short & numVar, const ScalarType & val) {
   
   nElm = numBlk*numVar; nElmDomain = numBlkDomain*numVar;
   nBlk = numBlk; nBlkDomain = numBlkDomain;
@@ -180,7 +283,7 @@ void CSysVector::Initialize(const unsigned long & numBlk, const unsigned long &
     SU2_MPI::Error(string(buf), CURRENT_FUNCTION);
   }
 	
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = val;
   
@@ -191,7 +294,8 @@ void CSysVector::Initialize(const unsigned long & numBlk, const unsigned long &
   
 }
 
-void CSysVector::Equals_AX(const su2double & a, CSysVector & x) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::Equals_AX(const ScalarType & a, TCSysVector<ScalarType> & x) {
   /*--- check that *this and x are compatible ---*/
   if (nElm != x.nElm) {
     cerr << "CSysVector::Equals_AX(): " << "sizes do not match";
@@ -201,7 +305,8 @@ void CSysVector::Equals_AX(const su2double & a, CSysVector & x) {
     vec_val[i] = a * x.vec_val[i];
 }
 
-void CSysVector::Plus_AX(const su2double & a, CSysVector & x) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::Plus_AX(const ScalarType & a, TCSysVector<ScalarType> & x) {
   /*--- check that *this and x are compatible ---*/
   if (nElm != x.nElm) {
     SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
@@ -210,7 +315,8 @@ void CSysVector::Plus_AX(const su2double & a, CSysVector & x) {
     vec_val[i] += a * x.vec_val[i];
 }
 
-void CSysVector::Equals_AX_Plus_BY(const su2double & a, CSysVector & x, const su2double & b, CSysVector & y) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::Equals_AX_Plus_BY(const ScalarType & a, TCSysVector<ScalarType> & x, const ScalarType & b, TCSysVector<ScalarType> & y) {
   /*--- check that *this, x and y are compatible ---*/
   if ((nElm != x.nElm) || (nElm != y.nElm)) {
     SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
@@ -219,7 +325,71 @@ void CSysVector::Equals_AX_Plus_BY(const su2double & a, CSysVector & x, const su
     vec_val[i] = a * x.vec_val[i] + b * y.vec_val[i];
 }
 
-CSysVector & CSysVector::operator=(const CSysVector & u) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::Plus_AX_Plus_BY(const ScalarType & a, const TCSysVector<ScalarType> & x, const ScalarType & b, const TCSysVector<ScalarType> & y) {
+  /*--- check that *this, x and y are compatible ---*/
+  if ((nElm != x.nElm) || (nElm != y.nElm)) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+  for (unsigned long i = 0; i < nElm; i++)
+    vec_val[i] += a * x.vec_val[i] + b * y.vec_val[i];
+}
+
+template<class ScalarType>
+void TCSysVector<ScalarType>::Plus_AX(unsigned long nVec, const ScalarType *a, const vector<TCSysVector<ScalarType> > & x) {
+  
+  unsigned long i, k;
+  
+  /*--- check that *this and x are compatible ---*/
+  for (k = 0; k < nVec; k++) {
+    if (nElm != x[k].nElm) {
+      SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+    }
+  }
+  
+  /*--- Element by element, so that *this is read and written only once ---*/
+  for (i = 0; i < nElm; i++) {
+    ScalarType sum = vec_val[i];
+    for (k = 0; k < nVec; k++)
+      sum += a[k] * x[k].vec_val[i];
+    vec_val[i] = sum;
+  }
+}
+
+template<class ScalarType>
+ScalarType TCSysVector<ScalarType>::Plus_AX_Norm(const ScalarType & a, const TCSysVector<ScalarType> & x) {
+  /*--- check that *this and x are compatible ---*/
+  if (nElm != x.nElm) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+  
+  /*--- update all elements, and accumulate the inner product of the
+   domain elements (the first nElmDomain) as they are written ---*/
+  typename AccumType<ScalarType>::Type loc_prod = 0.0, glob_prod = 0.0;
+  unsigned long i;
+  for (i = 0; i < nElmDomain; i++) {
+    vec_val[i] += a * x.vec_val[i];
+    loc_prod += vec_val[i]*vec_val[i];
+  }
+  for (i = nElmDomain; i < nElm; i++)
+    vec_val[i] += a * x.vec_val[i];
+  
+  ScalarType prod = 0.0;
+  const ScalarType *vec_ptr = vec_val;
+  if (ReproducibleDotProd(vec_val, &vec_ptr, 1, nElmDomain, &prod))
+    return sqrt(prod);
+  
+#ifdef HAVE_MPI
+  SumAllProcessors(&loc_prod, &glob_prod, 1);
+#else
+  glob_prod = loc_prod;
+#endif
+  
+  return ScalarType(sqrt(glob_prod));
+}
+
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator=(const TCSysVector<ScalarType> & u) {
   
   /*--- check if self-assignment, otherwise perform deep copy ---*/
   if (this == &u) return *this;
@@ -232,7 +402,7 @@ CSysVector & CSysVector::operator=(const CSysVector & u) {
 	nBlkDomain = u.nBlkDomain;
   
   nVar = u.nVar;
-  vec_val = new su2double[nElm];
+  vec_val = new ScalarType[nElm];
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = u.vec_val[i];
   
@@ -243,21 +413,47 @@ CSysVector & CSysVector::operator=(const CSysVector & u) {
   return *this;
 }
 
-CSysVector & CSysVector::operator=(const su2double & val) {
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator=(TCSysVector<ScalarType> && u) noexcept {
+  
+  /*--- check if self-assignment, otherwise take over the storage of u ---*/
+  if (this == &u) return *this;
+  
+  delete [] vec_val;
+  nElm = u.nElm; nElmDomain = u.nElmDomain;
+  nBlk = u.nBlk; nBlkDomain = u.nBlkDomain;
+  nVar = u.nVar;
+  vec_val = u.vec_val;
+  
+#ifdef HAVE_MPI
+  nElmGlobal = u.nElmGlobal;
+#endif
+  
+  u.vec_val = NULL;
+  u.nElm = 0; u.nElmDomain = 0;
+  u.nBlk = 0; u.nBlkDomain = 0;
+  
+  return *this;
+}
+
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator=(const ScalarType & val) {
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] = val;
   return *this;
 }
 
-CSysVector CSysVector::operator+(const CSysVector & u) const {
+template<class ScalarType>
+TCSysVector<ScalarType> TCSysVector<ScalarType>::operator+(const TCSysVector<ScalarType> & u) const {
   
   /*--- Use copy constructor and compound addition-assignment ---*/
-  CSysVector sum(*this);
+  TCSysVector<ScalarType> sum(*this);
   sum += u;
   return sum;
 }
 
-CSysVector & CSysVector::operator+=(const CSysVector & u) {
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator+=(const TCSysVector<ScalarType> & u) {
   
   /*--- Check for consistent sizes, then add elements ---*/
   if (nElm != u.nElm) {
@@ -268,15 +464,17 @@ CSysVector & CSysVector::operator+=(const CSysVector & u) {
   return *this;
 }
 
-CSysVector CSysVector::operator-(const CSysVector & u) const {
+template<class ScalarType>
+TCSysVector<ScalarType> TCSysVector<ScalarType>::operator-(const TCSysVector<ScalarType> & u) const {
   
   /*--- Use copy constructor and compound subtraction-assignment ---*/
-  CSysVector diff(*this);
+  TCSysVector<ScalarType> diff(*this);
   diff -= u;
   return diff;
 }
 
-CSysVector & CSysVector::operator-=(const CSysVector & u) {
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator-=(const TCSysVector<ScalarType> & u) {
   
   /*--- Check for consistent sizes, then subtract elements ---*/
   if (nElm != u.nElm) {
@@ -287,109 +485,125 @@ CSysVector & CSysVector::operator-=(const CSysVector & u) {
   return *this;
 }
 
-CSysVector CSysVector::operator*(const su2double & val) const {
+template<class ScalarType>
+TCSysVector<ScalarType> TCSysVector<ScalarType>::operator*(const ScalarType & val) const {
   
   /*--- use copy constructor and compound scalar
    multiplication-assignment ---*/
-  CSysVector prod(*this);
+  TCSysVector<ScalarType> prod(*this);
   prod *= val;
   return prod;
 }
 
-CSysVector operator*(const su2double & val, const CSysVector & u) {
+template<class ScalarType>
+TCSysVector<ScalarType> operator*(const ScalarType & val, const TCSysVector<ScalarType> & u) {
   
   /*--- use copy constructor and compound scalar
    multiplication-assignment ---*/
-  CSysVector prod(u);
+  TCSysVector<ScalarType> prod(u);
   prod *= val;
   return prod;
 }
 
-CSysVector & CSysVector::operator*=(const su2double & val) {
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator*=(const ScalarType & val) {
   
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] *= val;
   return *this;
 }
 
-CSysVector CSysVector::operator/(const su2double & val) const {
+template<class ScalarType>
+TCSysVector<ScalarType> TCSysVector<ScalarType>::operator/(const ScalarType & val) const {
   
   /*--- use copy constructor and compound scalar
    division-assignment ---*/
-  CSysVector quotient(*this);
+  TCSysVector<ScalarType> quotient(*this);
   quotient /= val;
   return quotient;
 }
 
-CSysVector & CSysVector::operator/=(const su2double & val) {
+template<class ScalarType>
+TCSysVector<ScalarType> & TCSysVector<ScalarType>::operator/=(const ScalarType & val) {
   
   for (unsigned long i = 0; i < nElm; i++)
     vec_val[i] /= val;
   return *this;
 }
 
-su2double CSysVector::norm() const {
+template<class ScalarType>
+ScalarType TCSysVector<ScalarType>::norm() const {
   
   /*--- just call dotProd on this*, then sqrt ---*/
-  su2double val = dotProd(*this, *this);
+  ScalarType val = dotProd(*this, *this);
   if (val < 0.0) {
     SU2_MPI::Error("Inner product of CSysVector is negative", CURRENT_FUNCTION);
   }
   return sqrt(val);
 }
 
-void CSysVector::CopyToArray(su2double* u_array) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::CopyToArray(ScalarType* u_array) {
   
   for (unsigned long i = 0; i < nElm; i++)
     u_array[i] = vec_val[i];
 }
 
-void CSysVector::AddBlock(unsigned long val_ipoint, su2double *val_residual) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::AddBlock(unsigned long val_ipoint, ScalarType *val_residual) {
   unsigned short iVar;
   
   for (iVar = 0; iVar < nVar; iVar++)
     vec_val[val_ipoint*nVar+iVar] += val_residual[iVar];
 }
 
-void CSysVector::SubtractBlock(unsigned long val_ipoint, su2double *val_residual) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::SubtractBlock(unsigned long val_ipoint, ScalarType *val_residual) {
   unsigned short iVar;
   
   for (iVar = 0; iVar < nVar; iVar++)
     vec_val[val_ipoint*nVar+iVar] -= val_residual[iVar];
 }
 
-void CSysVector::SetBlock(unsigned long val_ipoint, su2double *val_residual) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::SetBlock(unsigned long val_ipoint, ScalarType *val_residual) {
   unsigned short iVar;
   
   for (iVar = 0; iVar < nVar; iVar++)
     vec_val[val_ipoint*nVar+iVar] = val_residual[iVar];
 }
 
-void CSysVector::SetBlock(unsigned long val_ipoint, unsigned short val_var, su2double val_residual) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::SetBlock(unsigned long val_ipoint, unsigned short val_var, ScalarType val_residual) {
 
   vec_val[val_ipoint*nVar+val_var] = val_residual;
 }
 
-void CSysVector::SetBlock_Zero(unsigned long val_ipoint) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::SetBlock_Zero(unsigned long val_ipoint) {
   unsigned short iVar;
 
   for (iVar = 0; iVar < nVar; iVar++)
     vec_val[val_ipoint*nVar+iVar] = 0.0;
 }
 
-void CSysVector::SetBlock_Zero(unsigned long val_ipoint, unsigned short val_var) {
+template<class ScalarType>
+void TCSysVector<ScalarType>::SetBlock_Zero(unsigned long val_ipoint, unsigned short val_var) {
     vec_val[val_ipoint*nVar+val_var] = 0.0;
 }
 
-su2double CSysVector::GetBlock(unsigned long val_ipoint, unsigned short val_var) {
+template<class ScalarType>
+ScalarType TCSysVector<ScalarType>::GetBlock(unsigned long val_ipoint, unsigned short val_var) {
   return vec_val[val_ipoint*nVar + val_var];
 }
 
-su2double *CSysVector::GetBlock(unsigned long val_ipoint) {
+template<class ScalarType>
+ScalarType *TCSysVector<ScalarType>::GetBlock(unsigned long val_ipoint) {
   return &vec_val[val_ipoint*nVar];
 }
 
-su2double dotProd(const CSysVector & u, const CSysVector & v) {
+template<class ScalarType>
+ScalarType dotProd(const TCSysVector<ScalarType> & u, const TCSysVector<ScalarType> & v) {
   
   /*--- check for consistent sizes ---*/
   if (u.nElm != v.nElm) {
@@ -398,16 +612,108 @@ su2double dotProd(const CSysVector & u, const CSysVector & v) {
   
   /*--- find local inner product and, if a parallel run, sum over all
    processors (we use nElemDomain instead of nElem) ---*/
-  su2double loc_prod = 0.0;
+  ScalarType prod = 0.0;
+  const ScalarType *v_ptr = v.vec_val;
+  if (ReproducibleDotProd(u.vec_val, &v_ptr, 1, u.nElmDomain, &prod))
+    return prod;
+  
+  typename AccumType<ScalarType>::Type loc_prod = 0.0, glob_prod = 0.0;
   for (unsigned long i = 0; i < u.nElmDomain; i++)
     loc_prod += u.vec_val[i]*v.vec_val[i];
-  su2double prod = 0.0;
   
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&loc_prod, &prod, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SumAllProcessors(&loc_prod, &glob_prod, 1);
 #else
-  prod = loc_prod;
+  glob_prod = loc_prod;
 #endif
   
+  prod = glob_prod;
+  
   return prod;
 }
+
+template<class ScalarType>
+void dotProd(const TCSysVector<ScalarType> & u, const vector<TCSysVector<ScalarType> > & v, unsigned long nVec, ScalarType *prod) {
+  
+  unsigned long i, k;
+  
+  for (k = 0; k < nVec; k++) {
+    if (u.nElm != v[k].nElm) {
+      SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+    }
+  }
+  
+  vector<const ScalarType*> v_ptr(nVec);
+  for (k = 0; k < nVec; k++) v_ptr[k] = v[k].vec_val;
+  if (ReproducibleDotProd(u.vec_val, v_ptr.data(), nVec, u.nElmDomain, prod))
+    return;
+  
+  /*--- find the local inner products, and sum all of them over the
+   processors with one reduction ---*/
+  typedef typename AccumType<ScalarType>::Type AccumScalar;
+  AccumScalar *loc_prod = new AccumScalar[nVec];
+  AccumScalar *glob_prod = new AccumScalar[nVec];
+  for (k = 0; k < nVec; k++) {
+    loc_prod[k] = 0.0;
+    for (i = 0; i < u.nElmDomain; i++)
+      loc_prod[k] += u.vec_val[i]*v[k].vec_val[i];
+  }
+  
+#ifdef HAVE_MPI
+  SumAllProcessors(loc_prod, glob_prod, nVec);
+#else
+  for (k = 0; k < nVec; k++) glob_prod[k] = loc_prod[k];
+#endif
+  
+  for (k = 0; k < nVec; k++) prod[k] = glob_prod[k];
+  
+  delete [] loc_prod;
+  delete [] glob_prod;
+}
+
+template<class ScalarType>
+void dotProd(const TCSysVector<ScalarType> & u, const TCSysVector<ScalarType> & v, const TCSysVector<ScalarType> & w, ScalarType *prod) {
+  
+  /*--- check for consistent sizes ---*/
+  if ((u.nElm != v.nElm) || (u.nElm != w.nElm)) {
+    SU2_MPI::Error("Sizes do not match", CURRENT_FUNCTION);
+  }
+  
+  const ScalarType *vw_ptr[2] = {v.vec_val, w.vec_val};
+  if (ReproducibleDotProd(u.vec_val, vw_ptr, 2, u.nElmDomain, prod))
+    return;
+  
+  /*--- find both local inner products in one pass over u, and sum them
+   over the processors with one reduction ---*/
+  typename AccumType<ScalarType>::Type loc_prod[2] = {0.0, 0.0}, glob_prod[2] = {0.0, 0.0};
+  for (unsigned long i = 0; i < u.nElmDomain; i++) {
+    loc_prod[0] += u.vec_val[i]*v.vec_val[i];
+    loc_prod[1] += u.vec_val[i]*w.vec_val[i];
+  }
+  
+#ifdef HAVE_MPI
+  SumAllProcessors(loc_prod, glob_prod, 2);
+#else
+  glob_prod[0] = loc_prod[0]; glob_prod[1] = loc_prod[1];
+#endif
+  
+  prod[0] = glob_prod[0]; prod[1] = glob_prod[1];
+  
+}
+
+/*--- Explicit instantiations, the passive vectors only differ from the
+ active ones in the AD and single precision builds ---*/
+
+template class TCSysVector<su2double>;
+template CSysVector operator*(const su2double & val, const CSysVector & u);
+template su2double dotProd(const CSysVector & u, const CSysVector & v);
+template void dotProd(const CSysVector & u, const vector<CSysVector> & v, unsigned long nVec, su2double *prod);
+template void dotProd(const CSysVector & u, const CSysVector & v, const CSysVector & w, su2double *prod);
+
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE) || defined(SINGLE_PRECISION)
+template class TCSysVector<passivedouble>;
+template CSysVectorPassive operator*(const passivedouble & val, const CSysVectorPassive & u);
+template passivedouble dotProd(const CSysVectorPassive & u, const CSysVectorPassive & v);
+template void dotProd(const CSysVectorPassive & u, const vector<CSysVectorPassive> & v, unsigned long nVec, passivedouble *prod);
+template void dotProd(const CSysVectorPassive & u, const CSysVectorPassive & v, const CSysVectorPassive & w, passivedouble *prod);
+#endif
@@ -34,12 +34,6 @@
 
 #include "../include/wall_model.hpp"
 
-/* Prototypes for Lapack functions, if MKL or LAPACK is used. */
-#if defined (HAVE_MKL) || defined(HAVE_LAPACK)
-extern "C" void dgtsv_(int*, int*, passivedouble*, passivedouble*,
-                       passivedouble*, passivedouble*, int*, int*);
-#endif
-
 void CWallModel1DEQ::Initialize(const unsigned short *intInfo,
                                 const su2double      *doubleInfo){
 
@@ -75,6 +69,31 @@ void CWallModel1DEQ::Initialize(const unsigned short *intInfo,
   }
 }
 
+void CWallModel::WallShearStressAndHeatFluxBatch(const unsigned short nPointsExchange,
+                                                 const su2double      *tExchange,
+                                                 const su2double      *velExchange,
+                                                 const su2double      *muExchange,
+                                                 const su2double      *pExchange,
+                                                 const su2double      Wall_HeatFlux,
+                                                 const bool           HeatFlux_Prescribed,
+                                                 const su2double      Wall_Temperature,
+                                                 const bool           Temperature_Prescribed,
+                                                       su2double      *tauWall,
+                                                       su2double      *qWall,
+                                                       su2double      *ViscosityWall,
+                                                       su2double      *kOverCvWall,
+                                                       su2double      *profiles) {
+
+  /* Default implementation. Loop over the exchange locations and call
+     the point wise function. */
+  for(unsigned short i=0; i<nPointsExchange; ++i)
+    WallShearStressAndHeatFlux(tExchange[i], velExchange[i], muExchange[i],
+                               pExchange[i], Wall_HeatFlux, HeatFlux_Prescribed,
+                               Wall_Temperature, Temperature_Prescribed,
+                               tauWall[i], qWall[i], ViscosityWall[i],
+                               kOverCvWall[i]);
+}
+
 void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                 const su2double velExchange,
                                                 const su2double muExchange,
@@ -88,223 +107,341 @@ void CWallModel1DEQ::WallShearStressAndHeatFlux(const su2double tExchange,
                                                       su2double &ViscosityWall,
                                                       su2double &kOverCvWall) {
 
-  
-  // Set tau wall to initial guess
-  tauWall = 0.5;
-  qWall = 0.0;
-  ViscosityWall = 0.0;
-  kOverCvWall = 0.0;
-  
+  /* The single point version is the batched version for one exchange
+     location without a warm start. */
+  WallShearStressAndHeatFluxBatch(1, &tExchange, &velExchange, &muExchange,
+                                  &pExchange, Wall_HeatFlux, HeatFlux_Prescribed,
+                                  TWall, Temperature_Prescribed, &tauWall, &qWall,
+                                  &ViscosityWall, &kOverCvWall, NULL);
+}
+
+void CWallModel1DEQ::WallShearStressAndHeatFluxBatch(const unsigned short nPointsExchange,
+                                                     const su2double      *tExchange,
+                                                     const su2double      *velExchange,
+                                                     const su2double      *muExchange,
+                                                     const su2double      *pExchange,
+                                                     const su2double      Wall_HeatFlux,
+                                                     const bool           HeatFlux_Prescribed,
+                                                     const su2double      TWall,
+                                                     const bool           Temperature_Prescribed,
+                                                           su2double      *tauWall,
+                                                           su2double      *qWall,
+                                                           su2double      *ViscosityWall,
+                                                           su2double      *kOverCvWall,
+                                                           su2double      *profiles) {
+
   // Set some constants, assuming air at standard conditions
   // TO DO: Get these values from solver or config classes
   //su2double C_1 = 2.03929e-04;
-  su2double C_1 = 1.716e-5;
-  su2double S = 110.4;
-  su2double T_ref = 273.15;
-  su2double R = 287.058;
-  su2double kappa = 0.41;
-  su2double A = 17;
-  su2double gamma = 1.4;
-  su2double Pr_lam = 0.7;
-  su2double Pr_turb = 0.9;
-  su2double c_p = (gamma*R)/(gamma-1);
-  su2double c_v = R/(gamma-1);
-  su2double h_wall = c_p * TWall;
-  su2double h_bc   = c_p * tExchange;
-  su2double tauWall_lam = muExchange * velExchange / h_wm;
-  unsigned short nfa = numPoints + 1;
+  const su2double C_1 = 1.716e-5;
+  const su2double S = 110.4;
+  const su2double T_ref = 273.15;
+  const su2double R = 287.058;
+  const su2double kappa = 0.41;
+  const su2double A = 17;
+  const su2double gamma = 1.4;
+  const su2double Pr_lam = 0.7;
+  const su2double Pr_turb = 0.9;
+  const su2double c_p = (gamma*R)/(gamma-1);
+  const su2double c_v = R/(gamma-1);
 
-  /*--- Set up vectors ---*/
-  
-  vector<su2double> T(nfa, tExchange);
-  vector<su2double> mu_fa(nfa, muExchange);
-  vector<su2double> tmp(nfa, 0.0);
-  vector<su2double> u(numPoints, 0.0);
-  vector<su2double> lower(numPoints-1,0.0);
-  vector<su2double> upper(numPoints-1,0.0);
-  vector<su2double> diagonal(numPoints,0.0);
-  vector<su2double> rhs(numPoints,0.0);
-  
   // Set parameters for control
-  bool converged = false;
-  unsigned short iter = 0, max_iter = 25;
-  su2double tauWall_prev = 0.0, tol = 1e-3,  aux_rhs=0.0;
-  //su2double qWall_prev=0.0;
-  su2double mut, nu, mu_lam, rho, utau, y_plus, D;
-  
-  while (converged == false){
-    
-    iter += 1;
-    if (iter == max_iter) converged = true;
-    
-    tauWall_prev = tauWall;
-    //qWall_prev = qWall;
-    
+  const unsigned short max_iter = 25;
+  const su2double tol = 1e-3;
+
+  /*--- Easier storage of the dimensions. All the arrays below are stored such
+        that the exchange locations are the consecutive entries, i.e. the entry
+        of wall model grid point i of exchange location p is at i*nPts + p. ---*/
+  const unsigned short nPts     = nPointsExchange;
+  const unsigned short nfa      = numPoints + 1;
+  const unsigned short sizeProf = GetSizeProfile();
+  if(nPts == 0) return;
+
+  const su2double dyWall = y_cv[0] - y_fa[0];
+
+  /*--- Set up vectors ---*/
+  vector<unsigned short> ind(nPts);
+  vector<su2double> tauW(nPts), tauW_prev(nPts), tauWall_lam(nPts);
+  vector<su2double> h_wall(nPts), h_bc(nPts), vel(nPts), p(nPts), aux_rhs(nPts);
+  vector<su2double> T(nfa*nPts), mu_fa(nfa*nPts), tmp(nfa*nPts);
+  vector<su2double> u(numPoints*nPts),     lower(numPoints*nPts);
+  vector<su2double> diagonal(numPoints*nPts), upper(numPoints*nPts);
+  vector<su2double> rhs(numPoints*nPts);
+
+  /*--- Initialization of the working set. If a valid profile of a previous
+        call is present it is used as initial guess, otherwise the wall shear
+        stress is set to 0.5 and the temperature to the exchange temperature. ---*/
+  for(unsigned short l=0; l<nPts; ++l) {
+    ind[l]         = l;
+    vel[l]         = velExchange[l];
+    p[l]           = pExchange[l];
+    h_wall[l]      = c_p * TWall;
+    h_bc[l]        = c_p * tExchange[l];
+    tauWall_lam[l] = muExchange[l] * velExchange[l] / h_wm;
+
+    const su2double *prof = profiles ? profiles + l*sizeProf : NULL;
+    if(prof && prof[0] > 0.0) {
+      tauW[l] = prof[0];
+      for(unsigned short i=0; i<numPoints; ++i) T[i*nPts+l] = prof[i+1];
+      T[numPoints*nPts+l] = tExchange[l];
+    }
+    else {
+      tauW[l] = 0.5;
+      for(unsigned short i=0; i<nfa; ++i) T[i*nPts+l] = tExchange[l];
+    }
+  }
+
+  /*--- Iterative loop. The number of exchange locations in the working set,
+        nAct, decreases when exchange locations are converged. ---*/
+  unsigned short nAct = nPts;
+  for(unsigned short iter=1; nAct>0; ++iter) {
+
+    for(unsigned short l=0; l<nAct; ++l) tauW_prev[l] = tauW[l];
+
     // total viscosity
     // note: rho and mu_lam will be a function of temperature when solving an energy equation
-    for(unsigned short i=0; i < nfa; ++i){
-      mu_lam = C_1 * pow(T[i]/T_ref, 1.5) * ((T_ref + S)/ (T[i] + S));
-      mu_fa[i] = mu_lam;
+    for(unsigned short i=0; i<nfa; ++i) {
+      const su2double *Ti  = T.data()     + i*nPts;
+            su2double *mui = mu_fa.data() + i*nPts;
+      for(unsigned short l=0; l<nAct; ++l)
+        mui[l] = C_1 * pow(Ti[l]/T_ref, 1.5) * ((T_ref + S)/ (Ti[l] + S));
     }
-    
-    for(unsigned short i=1; i < nfa; ++i){
-      rho = pExchange / (R*T[i]);
-      nu = mu_fa[i] / rho;
-      utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
-      D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * kappa * y_fa[i] * utau * D;
-      mu_fa[i] += mut;
+
+    for(unsigned short i=1; i<nfa; ++i) {
+      const su2double *Ti  = T.data()     + i*nPts;
+            su2double *mui = mu_fa.data() + i*nPts;
+      for(unsigned short l=0; l<nAct; ++l) {
+        const su2double rho    = p[l] / (R*Ti[l]);
+        const su2double nu     = mui[l] / rho;
+        const su2double utau   = sqrt(tauW[l] / rho);
+        const su2double y_plus = y_fa[i] * utau / nu;
+        const su2double D      = pow(1.0 - exp((-y_plus)/A),2.0);
+        mui[l] += rho * kappa * y_fa[i] * utau * D;
+      }
     }
-    
+
     // Momentum matrix
     // solution vector is u at y_cv
-    lower.assign(numPoints-1,0.0);
-    upper.assign(numPoints-1,0.0);
-    diagonal.assign(numPoints,0.0);
-    rhs.assign(numPoints,0.0);
-    
-    // top bc
-    diagonal[numPoints - 1] = 1.0;
-    rhs[numPoints - 1] = velExchange;
-    
+    for(unsigned short l=0; l<nAct; ++l) {
+
+      // top bc
+      lower[(numPoints-2)*nPts+l]    = 0.0;
+      diagonal[(numPoints-1)*nPts+l] = 1.0;
+      rhs[(numPoints-1)*nPts+l]      = vel[l];
+
+      // wall bc
+      upper[l]    = mu_fa[nPts+l]/(y_cv[1] - y_cv[0]);
+      diagonal[l] = -1.0 * (upper[l] + mu_fa[l]/dyWall);
+      rhs[l]      = 0.0;
+    }
+
     // internal cvs
-    for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  mu_fa[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = mu_fa[i] / (y_cv[i] -  y_cv[i - 1] );
-      diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
+    for(unsigned short i=1; i<(numPoints-1); ++i) {
+      const su2double dyU = 1.0/(y_cv[i+1] - y_cv[i]);
+      const su2double dyL = 1.0/(y_cv[i]   - y_cv[i-1]);
+      for(unsigned short l=0; l<nAct; ++l) {
+        upper[i*nPts+l]     = mu_fa[(i+1)*nPts+l]*dyU;
+        lower[(i-1)*nPts+l] = mu_fa[i*nPts+l]*dyL;
+        diagonal[i*nPts+l]  = -1.0 * (upper[i*nPts+l] + lower[(i-1)*nPts+l]);
+        rhs[i*nPts+l]       = 0.0;
+      }
     }
-    
-    // wall bc
-    upper[0] = mu_fa[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + mu_fa[0]/(y_cv[0]-y_fa[0]) );
-    rhs[0] = 0.0;
-    
+
     // Solve the matrix problem to get the velocity field
-    // rhs returned the solution
-    //********LAPACK CALL*******
-#if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    int info, nrhs = 1;
-
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
-#else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
-#endif
-
-    u = rhs;
-    
+    SolveTridiagonalSystems(nAct, nPts, lower.data(), diagonal.data(),
+                            upper.data(), rhs.data());
+
+    for(unsigned short i=0; i<numPoints; ++i)
+      for(unsigned short l=0; l<nAct; ++l)
+        u[i*nPts+l] = rhs[i*nPts+l];
+
     // update total viscosity
     // note: rho and mu_lam will be a function of temperature when solving an energy equation
-    for(unsigned short i=0; i < nfa; ++i){
-      mu_lam = C_1 * pow(T[i]/T_ref, 1.5) * ((T_ref + S)/ (T[i] + S));
-      mu_fa[i] = mu_lam;
-      tmp[i] = mu_lam/Pr_lam;
+    for(unsigned short i=0; i<nfa; ++i) {
+      const su2double *Ti   = T.data()     + i*nPts;
+            su2double *mui  = mu_fa.data() + i*nPts;
+            su2double *tmpi = tmp.data()   + i*nPts;
+      for(unsigned short l=0; l<nAct; ++l) {
+        mui[l]  = C_1 * pow(Ti[l]/T_ref, 1.5) * ((T_ref + S)/ (Ti[l] + S));
+        tmpi[l] = mui[l]/Pr_lam;
+      }
     }
+
     // update tauWall
-    tauWall = mu_fa[0] * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
-    for(unsigned short i=1; i < nfa; ++i){
-      rho = pExchange / (R*T[i]);
-      nu = mu_fa[i] / rho;
-      utau = sqrt(tauWall / rho);
-      y_plus = y_fa[i] * utau / nu;
-      D = pow(1.0 - exp((-y_plus)/A),2.0);
-      mut = rho * kappa * y_fa[i] * utau * D;
-      mu_fa[i] += mut;
-      tmp[i] += mut/Pr_turb;
-      tmp[i] *= c_p;
+    for(unsigned short l=0; l<nAct; ++l) {
+      tauW[l] = mu_fa[l] * (u[l] - 0.0)/dyWall;
+      tmp[l]  = tmp[l]*c_p;
     }
-    tmp[0] = tmp[0]*c_p;
-    
+
+    for(unsigned short i=1; i<nfa; ++i) {
+      const su2double *Ti   = T.data()     + i*nPts;
+            su2double *mui  = mu_fa.data() + i*nPts;
+            su2double *tmpi = tmp.data()   + i*nPts;
+      for(unsigned short l=0; l<nAct; ++l) {
+        const su2double rho    = p[l] / (R*Ti[l]);
+        const su2double nu     = mui[l] / rho;
+        const su2double utau   = sqrt(tauW[l] / rho);
+        const su2double y_plus = y_fa[i] * utau / nu;
+        const su2double D      = pow(1.0 - exp((-y_plus)/A),2.0);
+        const su2double mut    = rho * kappa * y_fa[i] * utau * D;
+        mui[l]  += mut;
+        tmpi[l] += mut/Pr_turb;
+        tmpi[l] *= c_p;
+      }
+    }
+
     // Energy matrix
     // solution vector is T at y_cv
-    lower.assign(numPoints-1,0.0);
-    upper.assign(numPoints-1,0.0);
-    diagonal.assign(numPoints,0.0);
-    rhs.assign(numPoints,0.0);
-    
+    for(unsigned short l=0; l<nAct; ++l) {
+
+      // top bc
+      lower[(numPoints-2)*nPts+l]    = 0.0;
+      diagonal[(numPoints-1)*nPts+l] = 1.0;
+
+      // wall bc
+      upper[l]    = tmp[nPts+l]/(y_cv[1] - y_cv[0]);
+      diagonal[l] = -1.0 * (upper[l] + tmp[l]/dyWall);
+      aux_rhs[l]  = tmp[l]/dyWall;
+    }
+
     // internal cvs
-    for (unsigned short i=1; i < (numPoints - 1); ++i){
-      upper[i]  =  tmp[i + 1] / (y_cv[i + 1] -  y_cv[i] );
-      lower[i-1]  = tmp[i] / (y_cv[i] -  y_cv[i - 1] );
-      diagonal[i] = -1.0 * (upper[i] + lower[i - 1]);
+    for(unsigned short i=1; i<(numPoints-1); ++i) {
+      const su2double dyU = 1.0/(y_cv[i+1] - y_cv[i]);
+      const su2double dyL = 1.0/(y_cv[i]   - y_cv[i-1]);
+      for(unsigned short l=0; l<nAct; ++l) {
+        upper[i*nPts+l]     = tmp[(i+1)*nPts+l]*dyU;
+        lower[(i-1)*nPts+l] = tmp[i*nPts+l]*dyL;
+        diagonal[i*nPts+l]  = -1.0 * (upper[i*nPts+l] + lower[(i-1)*nPts+l]);
+      }
     }
-    
-    // top bc
-    diagonal[numPoints - 1] = 1.0;
-    
-    // wall bc
-    upper[0] = tmp[1]/(y_cv[1] - y_cv[0]);
-    diagonal[0] = -1.0 * (upper[0] + tmp[0]/(y_cv[0]-y_fa[0]) );
-    aux_rhs = tmp[0]/(y_cv[0]-y_fa[0]);
-    
+
     // RHS Energy
     /* compute flux -- (mu + mu_t) * u * du/dy -- */
-    
+
     /* zero flux at the wall */
-    tmp[0] = 0. ;
-    for (unsigned short i=1; i < numPoints; ++i){
-      tmp[i] = 0.5* (mu_fa[i]) * (u[i] + u[i-1]) * (u[i] -u[i-1])/(y_cv[i] -  y_cv[i - 1] )  ;
-    }
-    for (unsigned short i=0; i < (numPoints - 1); ++i){
-      rhs[i] = -tmp[i+1] + tmp[i];
+    for(unsigned short l=0; l<nAct; ++l) tmp[l] = 0.0;
+    for(unsigned short i=1; i<numPoints; ++i) {
+      const su2double dyInv = 1.0/(y_cv[i] - y_cv[i-1]);
+      for(unsigned short l=0; l<nAct; ++l) {
+        const su2double ui = u[i*nPts+l], uim1 = u[(i-1)*nPts+l];
+        tmp[i*nPts+l] = 0.5*mu_fa[i*nPts+l]*(ui + uim1)*(ui - uim1)*dyInv;
+      }
     }
+    for(unsigned short i=0; i<(numPoints-1); ++i)
+      for(unsigned short l=0; l<nAct; ++l)
+        rhs[i*nPts+l] = -tmp[(i+1)*nPts+l] + tmp[i*nPts+l];
     // END RHS Energy
-    
-    if (HeatFlux_Prescribed == true){
-      /* dT/dy = 0 -> Twall = T[1] */
-      h_wall = c_p * T[1];
+
+    for(unsigned short l=0; l<nAct; ++l) {
+      if (HeatFlux_Prescribed == true){
+        /* dT/dy = 0 -> Twall = T[1] */
+        h_wall[l] = c_p * T[nPts+l];
+      }
+
+      rhs[l] -= aux_rhs[l] * h_wall[l];
+      rhs[(numPoints-1)*nPts+l] = h_bc[l];
     }
-    
-    rhs[0] -= aux_rhs * h_wall;
-    rhs[numPoints-1] = h_bc;
-    
+
     // Solve the matrix problem to get the temperature field
-    // *******LAPACK CALL********
-#if (defined(HAVE_MKL) || defined(HAVE_LAPACK)) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
-    dgtsv_(&numPoints,&nrhs,lower.data(),diagonal.data(),upper.data(),rhs.data(),&numPoints, &info);
-    if (info != 0)
-      SU2_MPI::Error("Unsuccessful call to dgtsv_", CURRENT_FUNCTION);
-#else
-    SU2_MPI::Error("Not compiled with MKL or LAPACK support", CURRENT_FUNCTION);
-#endif
+    SolveTridiagonalSystems(nAct, nPts, lower.data(), diagonal.data(),
+                            upper.data(), rhs.data());
 
     // Get Temperature from enthalpy
     // Temperature will be at cv or face?
-    T[0] = h_wall/c_p;
-    T[numPoints] = h_bc/c_p;
-    for (unsigned short i=0; i < numPoints-1; i++){
-      T[i+1] = 0.5 * (rhs[i] + rhs[i+1])/c_p;
+    for(unsigned short l=0; l<nAct; ++l) {
+      T[l]                = h_wall[l]/c_p;
+      T[numPoints*nPts+l] = h_bc[l]/c_p;
     }
-    
-    // final update tauWall
-    mu_lam = C_1 * pow(T[0]/T_ref, 1.5) * ((T_ref + S)/ (T[0] + S));
-    
-    // These quantities will be returned.
-    tauWall = mu_lam * (u[0] - 0.0)/(y_cv[0]-y_fa[0]);
-    qWall = mu_lam * (c_p / Pr_lam) * -(T[1] - T[0]) / (y_cv[0]-y_fa[0]);
-    ViscosityWall = mu_lam;
-    //kOverCvWall = c_p / c_v * (mu[0]/Pr_lam + muTurb[0]/Pr_turb);
-    kOverCvWall = c_p / c_v * (mu_lam/Pr_lam);
-    
-    // define a norm
-    //if (abs( (tauWall - tauWall_prev)/tauWall_lam ) < tol && abs(qWall - qWall_prev) < tol){
-    if (abs( (tauWall - tauWall_prev)/tauWall_lam ) < tol){
-      converged = true;
-//      mu_lam = C_1 * pow(T[0]/T_ref, 1.5) * ((T_ref + S)/ (T[0] + S));
-//      rho = pExchange / (R * T[0]);
-//      cout << "# " << tExchange << " " << velExchange << " " << muExchange << " " << pExchange << endl;
-//      cout << "#Number of iterations: " << iter << endl;
-//      cout << "#u tau:  " << sqrt(tauWall/rho) << endl;
-//      cout << "#tau wall: " << tauWall << endl;
-//      cout << "#qWall: " << qWall << endl;
-//      cout << "#Re_tau: " << sqrt(tauWall/rho)*1.0/(mu_lam/rho) << endl;
-//      cout << "#Y+  u+ u  T T+" << endl;
-//      for(unsigned short i=0; i < numPoints; ++i){
-//        cout<< y_cv[i] * sqrt(tauWall/rho) / (mu_lam/rho) << " " << u[i]/sqrt(tauWall/rho)  << " " << u[i] << " " << T[i+1] << " " << (TWall - T[i+1]) * (pExchange / (R * T[i+1])) *  sqrt(tauWall/rho) * c_p / qWall<< endl;
-//      }
+    for(unsigned short i=0; i<numPoints-1; ++i)
+      for(unsigned short l=0; l<nAct; ++l)
+        T[(i+1)*nPts+l] = 0.5 * (rhs[i*nPts+l] + rhs[(i+1)*nPts+l])/c_p;
+
+    /*--- Final update of tauWall, store the results and the profiles of the
+          exchange locations that are converged and compress the working set
+          to the exchange locations that still need to be iterated. ---*/
+    unsigned short nActNew = 0;
+    for(unsigned short l=0; l<nAct; ++l) {
+
+      const su2double mu_lam = C_1 * pow(T[l]/T_ref, 1.5) * ((T_ref + S)/ (T[l] + S));
+      tauW[l] = mu_lam * (u[l] - 0.0)/dyWall;
+
+      // define a norm
+      if((iter == max_iter) || (abs( (tauW[l] - tauW_prev[l])/tauWall_lam[l] ) < tol)) {
+
+        // These quantities will be returned.
+        const unsigned short ll = ind[l];
+        tauWall[ll]       = tauW[l];
+        qWall[ll]         = mu_lam * (c_p / Pr_lam) * -(T[nPts+l] - T[l]) / dyWall;
+        ViscosityWall[ll] = mu_lam;
+        kOverCvWall[ll]   = c_p / c_v * (mu_lam/Pr_lam);
+
+        if( profiles ) {
+          su2double *prof = profiles + ll*sizeProf;
+          prof[0] = tauW[l];
+          for(unsigned short i=0; i<nfa; ++i) prof[i+1] = T[i*nPts+l];
+        }
+      }
+      else {
+
+        /* Not converged yet. Copy the data that is carried over to the next
+           iteration to position nActNew of the working set. */
+        if(nActNew != l) {
+          ind[nActNew]         = ind[l];
+          tauW[nActNew]        = tauW[l];
+          tauWall_lam[nActNew] = tauWall_lam[l];
+          h_wall[nActNew]      = h_wall[l];
+          h_bc[nActNew]        = h_bc[l];
+          vel[nActNew]         = vel[l];
+          p[nActNew]           = p[l];
+          for(unsigned short i=0; i<nfa; ++i) T[i*nPts+nActNew] = T[i*nPts+l];
+        }
+        ++nActNew;
+      }
     }
+
+    nAct = nActNew;
+  }
+}
+
+void CWallModel1DEQ::SolveTridiagonalSystems(const unsigned short nSystems,
+                                             const unsigned short nStride,
+                                             const su2double      *lower,
+                                             const su2double      *diagonal,
+                                                   su2double      *upper,
+                                                   su2double      *rhs) {
+
+  /* Forward elimination. The matrices are diagonally dominant, such that
+     no pivoting is needed. The upper diagonal is overwritten by the
+     modified coefficients. */
+  for(unsigned short l=0; l<nSystems; ++l) {
+    const su2double dInv = 1.0/diagonal[l];
+    upper[l] *= dInv;
+    rhs[l]   *= dInv;
+  }
+
+  for(int i=1; i<numPoints; ++i) {
+    const su2double *a    = lower    + (i-1)*nStride;
+    const su2double *b    = diagonal +  i   *nStride;
+          su2double *c    = upper    +  i   *nStride;
+    const su2double *cm1  = upper    + (i-1)*nStride;
+          su2double *d    = rhs      +  i   *nStride;
+    const su2double *dm1  = rhs      + (i-1)*nStride;
+
+    for(unsigned short l=0; l<nSystems; ++l) {
+      const su2double mInv = 1.0/(b[l] - a[l]*cm1[l]);
+      if(i < numPoints-1) c[l] *= mInv;
+      d[l] = (d[l] - a[l]*dm1[l])*mInv;
+    }
+  }
+
+  /* Back substitution. */
+  for(int i=numPoints-2; i>=0; --i) {
+    const su2double *c   = upper + i*nStride;
+          su2double *x   = rhs   + i*nStride;
+    const su2double *xp1 = rhs   + (i+1)*nStride;
+
+    for(unsigned short l=0; l<nSystems; ++l)
+      x[l] -= c[l]*xp1[l];
   }
 }
 
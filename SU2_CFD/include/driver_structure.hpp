@@ -95,6 +95,8 @@ protected:
   CGeometry ****geometry_container;              /*!< \brief Geometrical definition of the problem. */
   CSolver *****solver_container;                 /*!< \brief Container vector with all the solutions. */
   CNumerics ******numerics_container;            /*!< \brief Description of the numerical method (the way in which the equations are solved). */
+  vector<vector<CNumerics *****> > numerics_Threads; /*!< \brief Copies of the numerics of every zone for the additional threads of the
+                                                             convective edge loops of the flow, see NUMBER_THREADS_FLOW. */
   CConfig **config_container;                   /*!< \brief Definition of the particular problem. */
   CConfig *driver_config;                       /*!< \brief Definition of the driver configuration. */
   CSurfaceMovement **surface_movement;          /*!< \brief Surface movement classes of the problem. */
@@ -219,6 +221,19 @@ public:
    */
   void Numerics_Postprocessing(CNumerics *****numerics_container, CSolver ***solver_container, CGeometry **geometry, CConfig *config, unsigned short val_iInst);
 
+  /*!
+   * \brief Create copies of the numerics of a zone for the additional threads of the convective edge loops
+   *        of the compressible flow solver, and hand them to the flow solvers of the finest grid.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  void Numerics_Threads_Preprocessing(unsigned short val_iZone);
+
+  /*!
+   * \brief Delete the copies of the numerics of a zone for the additional threads of the flow.
+   * \param[in] val_iZone - Index of the zone.
+   */
+  void Numerics_Threads_Postprocessing(unsigned short val_iZone);
+
   /*!
    * \brief Initialize Python interface functionalities
    */
@@ -239,6 +254,13 @@ public:
    */
   void TurbomachineryPreprocessing(void);
 
+  /*!
+   * \brief Print the memory used by the geometry, solver, numerics and output after the preprocessing.
+   * \param[in] val_memory - Growth of the resident memory of this rank during the geometry, solver,
+   *                         numerics/integration and output preprocessing (bytes).
+   */
+  void Memory_Report(const unsigned long *val_memory);
+
   /*!
    * \brief A virtual member.
    * \param[in] donorZone - zone in which the displacements will be predicted.
@@ -313,6 +335,12 @@ public:
    */
   void Output(unsigned long ExtIter);
 
+  /*!
+   * \brief Register the in-situ adaptor used with OUTPUT_FORMAT= INSITU.
+   * \param[in] adaptor - In-situ adaptor, it is not deleted by the driver.
+   */
+  void SetInSitu_Adaptor(CInSituAdaptor *adaptor);
+
   /*!
    * \brief Perform a dynamic mesh deformation, including grid velocity computation and update of the multigrid structure.
    */
@@ -464,7 +492,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \return True if the vertex is a halo node (non physical force).
    */
-  bool ComputeVertexForces(unsigned short iMarker, unsigned short iVertex);
+  bool ComputeVertexForces(unsigned short iMarker, unsigned long iVertex);
 
   /*!
    * \brief Get the x component of the force at a vertex on a specified marker.
@@ -552,7 +580,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \return Temperature of the vertex.
    */
-  su2double GetVertexTemperature(unsigned short iMarker, unsigned short iVertex);
+  su2double GetVertexTemperature(unsigned short iMarker, unsigned long iVertex);
 
   /*!
    * \brief Set the temperature of a vertex on a specified marker.
@@ -560,7 +588,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \param[in] val_WallTemp - Value of the temperature.
    */
-  void SetVertexTemperature(unsigned short iMarker, unsigned short iVertex, su2double val_WallTemp);
+  void SetVertexTemperature(unsigned short iMarker, unsigned long iVertex, su2double val_WallTemp);
 
   /*!
    * \brief Compute the heat flux at a vertex on a specified marker (3 components).
@@ -568,7 +596,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \return True if the vertex is a halo node.
    */
-  bool ComputeVertexHeatFluxes(unsigned short iMarker, unsigned short iVertex);
+  bool ComputeVertexHeatFluxes(unsigned short iMarker, unsigned long iVertex);
 
   /*!
    * \brief Get the x component of the heat flux at a vertex on a specified marker.
@@ -600,7 +628,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \return Wall normal component of the heat flux at the vertex.
    */
-  su2double GetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex);
+  su2double GetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex);
 
   /*!
    * \brief Set the wall normal component of the heat flux at a vertex on a specified marker.
@@ -608,7 +636,7 @@ public:
    * \param[in] iVertex - Vertex identifier.
    * \param[in] val_WallHeatFlux - Value of the normal heat flux.
    */
-  void SetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex, su2double val_WallHeatFlux);
+  void SetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex, su2double val_WallHeatFlux);
 
   /*!
    * \brief Get the thermal conductivity at a vertex on a specified marker.
@@ -635,6 +663,78 @@ public:
    */
   vector<su2double> GetVertexUnitNormal(unsigned short iMarker, unsigned short iVertex);
 
+  /*!
+   * \brief Get the coordinates of all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Coordinates, nDim values per vertex in the order of the vertices of the marker.
+   * \param[in] nValues - Size of values, must be the number of vertices times nDim.
+   */
+  void GetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Set the new coordinates of all the vertices of a specified marker (stored as the vertex variation of the coordinates).
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - New coordinates, nDim values per vertex in the order of the vertices of the marker.
+   * \param[in] nValues - Size of values, must be the number of vertices times nDim.
+   */
+  void SetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Set the displacements (variation of the coordinates) of all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Displacements, nDim values per vertex in the order of the vertices of the marker.
+   * \param[in] nValues - Size of values, must be the number of vertices times nDim.
+   */
+  void SetMarkerDisplacements(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Compute and get the fluid forces at all the vertices of a specified marker, zero at the halo vertices.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Forces, nDim values per vertex in the order of the vertices of the marker.
+   * \param[in] nValues - Size of values, must be the number of vertices times nDim.
+   */
+  void GetMarkerForces(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Get the temperature at all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Temperatures, one value per vertex.
+   * \param[in] nValues - Size of values, must be the number of vertices.
+   */
+  void GetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Set the wall temperature at all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Temperatures, one value per vertex.
+   * \param[in] nValues - Size of values, must be the number of vertices.
+   */
+  void SetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Compute and get the heat flux (vector) at all the vertices of a specified marker, zero at the halo vertices.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Heat fluxes, nDim values per vertex in the order of the vertices of the marker.
+   * \param[in] nValues - Size of values, must be the number of vertices times nDim.
+   */
+  void GetMarkerHeatFluxes(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Get the wall normal component of the heat flux at all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[out] values - Normal heat fluxes, one value per vertex.
+   * \param[in] nValues - Size of values, must be the number of vertices.
+   */
+  void GetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues);
+
+  /*!
+   * \brief Set the wall normal component of the heat flux at all the vertices of a specified marker.
+   * \param[in] iMarker - Marker identifier.
+   * \param[in] values - Normal heat fluxes, one value per vertex.
+   * \param[in] nValues - Size of values, must be the number of vertices.
+   */
+  void SetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues);
+
   /*!
    * \brief Get all the boundary markers tags.
    * \return List of boundary markers tags.
@@ -753,6 +853,16 @@ public:
  * \author T. Economon, G. Gori
  */
 class CFluidDriver : public CDriver {
+protected:
+
+  /*!
+   * \brief Prepare the next flow condition of the ensemble run: the angles and the output files are set, the
+   *        free-stream velocity is rotated to the new angles and the iterations and the convergence monitoring
+   *        start again, the solution of the previous condition is the initial solution.
+   * \param[in] iCond - Index of the flow condition.
+   */
+  void SetEnsemble_Condition(unsigned short iCond);
+
 public:
   
   /*!
@@ -774,6 +884,11 @@ public:
    */
   ~CFluidDriver(void);
 
+  /*!
+   * \brief [Overload] Launch the computation, once for each flow condition of an ensemble run.
+   */
+  void StartSolver();
+
   /*!
    * \brief Run a single iteration of the physics within multiple zones.
    */
@@ -913,8 +1028,75 @@ class CDiscAdjFluidDriver : public CFluidDriver {
 
 protected:
   unsigned short RecordingState; /*!< \brief The kind of recording the tape currently holds.*/
+  bool Geometry_Tape_Reported;   /*!< \brief The statistics of the geometry tape have been printed.*/
   su2double ObjFunc;             /*!< \brief The value of the objective function.*/
+  vector<su2double> ObjFunc_Sweep; /*!< \brief Each objective function, separate outputs of the tape (DISCADJ_OBJECTIVE_SWEEP).*/
+  CSysVector Adjoint_RHS;        /*!< \brief Constant term of the adjoint fixed-point iteration (DISCADJ_KRYLOV).*/
   CIteration** direct_iteration; /*!< \brief A pointer to the direct iteration.*/
+  vector<long> Checkpoint_Iter;  /*!< \brief Direct time steps of the checkpoints of the unsteady adjoint (increasing).*/
+  vector<vector<passivedouble> > Checkpoint_Solution; /*!< \brief Direct solution at time n and n-1 of each checkpoint.*/
+
+  /*!
+   * \brief Store the current direct solution (time n and n-1) as a new checkpoint.
+   * \param[in] val_iter - Direct time step of the solution.
+   */
+  void SetCheckpoint(long val_iter);
+
+  /*!
+   * \brief Restart the direct solver from the last checkpoint, as at the end of its time step.
+   */
+  void LoadCheckpoint(void);
+
+  /*!
+   * \brief Recompute one physical time step of the direct problem (dual time inner iterations).
+   * \param[in] val_iter - Direct time step to be computed.
+   * \param[in] val_update - If <code>TRUE</code> the time levels are shifted to start the next time step.
+   */
+  void DirectTimeStep(long val_iter, bool val_update);
+
+  /*!
+   * \brief Number of time steps that can be reversed with a number of checkpoints and of recomputations,
+   *        i.e. the binomial coefficient <i>(val_nCheckpoint+val_nRep)! / (val_nCheckpoint! val_nRep!)</i>.
+   * \param[in] val_nCheckpoint - Number of checkpoints.
+   * \param[in] val_nRep - Number of recomputations of each time step.
+   * \return Number of time steps.
+   */
+  passivedouble GetBinomial_nStep(unsigned short val_nCheckpoint, unsigned long val_nRep);
+
+  /*!
+   * \brief Set the direct solution of the current unsteady adjoint time step (and the two previous time levels)
+   *        by recomputing the direct problem from the checkpoints, with a binomial (revolve) schedule.
+   */
+  void SetUnsteady_Checkpoint(void);
+
+  /*!
+   * \brief Seed the adjoints of the conservative output variables of the recorded iteration.
+   * \param[in] val_seed - Adjoint values of the flow (and turbulence) variables at all the points of the rank.
+   */
+  void SetAdjoint_Krylov_Seed(const CSysVector & val_seed);
+
+  /*!
+   * \brief Get the adjoints of the conservative input variables after an evaluation of the tape.
+   * \param[out] val_adjoint - Adjoint values of the flow (and turbulence) variables at all the points of the rank.
+   */
+  void GetAdjoint_Krylov_Solution(CSysVector & val_adjoint);
+
+  /*!
+   * \brief Evaluate the constant term <i>b</i> of the adjoint fixed-point iteration <i>psi = G^T psi + b</i>,
+   *        i.e. the tape seeded only with the adjoint of the objective function.
+   */
+  void SetAdjoint_Krylov_RHS(void);
+
+  /*!
+   * \brief Perform one restart cycle of FGMRES on <i>(I - G^T) psi = b</i>, starting from the current adjoint solution.
+   */
+  void SetAdjoint_Krylov(void);
+
+  /*!
+   * \brief Prepare the adjoint of the next objective of the sweep: the adjoint solution is set to zero and
+   *        the iterations and the convergence monitoring start again, the primal solution is kept.
+   */
+  void ResetAdjoint_Sweep(void);
 
 public:
 
@@ -937,6 +1119,11 @@ public:
    */
   ~CDiscAdjFluidDriver(void);
 
+  /*!
+   * \brief [Overload] Launch the computation, once for each objective function with DISCADJ_OBJECTIVE_SWEEP.
+   */
+  void StartSolver();
+
   /*!
    * \brief Run a single iteration of the discrete adjoint solver within multiple zones.
    */
@@ -964,6 +1151,73 @@ public:
    * \brief Initialize the adjoint value of the objective function.
    */
   void SetAdj_ObjFunction();
+
+  /*!
+   * \brief Product with the matrix <i>(I - G^T)</i> of the linearized adjoint fixed-point iteration,
+   *        the product with <i>G^T</i> is one evaluation of the recorded tape.
+   * \param[in] u - CSysVector that is the left-hand side of the product.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void Adjoint_MatrixVectorProduct(const CSysVector & u, CSysVector & v);
+
+  /*!
+   * \brief Prepare a new design of a steady problem without restarting the driver (python wrapper).
+   *        The grid must have been deformed in place (SetVertexCoordX, ..., SetVertexVarCoord, StaticMeshUpdate).
+   *        The direct problem is converged from the solution of the previous design, the next call of StartSolver
+   *        records the tape again and starts the adjoint from the solution of the previous design.
+   * \param[in] val_nDirectIter - Maximum number of iterations of the direct problem.
+   */
+  void DesignUpdate(unsigned long val_nDirectIter);
+};
+
+/*!
+ * \class CDiscAdjMatrixVectorProduct
+ * \brief Specialization of matrix-vector product that evaluates the recorded tape of the discrete adjoint.
+ */
+class CDiscAdjMatrixVectorProduct : public CMatrixVectorProduct {
+private:
+  CDiscAdjFluidDriver* driver; /*!< \brief Pointer to the driver that holds the tape. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] driver_ref - Discrete adjoint driver.
+   */
+  CDiscAdjMatrixVectorProduct(CDiscAdjFluidDriver *driver_ref);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CDiscAdjMatrixVectorProduct() {}
+
+  /*!
+   * \brief Operator that defines the matrix-vector product.
+   * \param[in] u - CSysVector that is the left-hand side of the product.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CDiscAdjIdentityPreconditioner
+ * \brief Identity preconditioner of the discrete adjoint FGMRES solver, the fixed-point
+ *        operator recorded on the tape already contains the inverse of the primal Jacobian.
+ */
+class CDiscAdjIdentityPreconditioner : public CPreconditioner {
+public:
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CDiscAdjIdentityPreconditioner() {}
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const { v = u; }
 };
 
 /*!
@@ -1055,11 +1309,20 @@ public:
   void Run();
 
   /*!
-   * \brief Computation and storage of the Harmonic Balance method source terms.
+   * \brief Computation and storage of the Harmonic Balance method source terms of all instances.
    * \author T. Economon, K. Naik
-   * \param[in] iZone - Current zone number.
    */
-  void SetHarmonicBalance(unsigned short iZone);
+  void SetHarmonicBalance(void);
+
+  /*!
+   * \brief Apply the Harmonic Balance operator to the solutions of all instances of one solver, block of points by block of points.
+   * \param[in] iMGlevel - Multigrid level.
+   * \param[in] iSol - Solver whose source term is computed.
+   * \param[in] HBOperator - Row major Harmonic Balance operator (transposed for the adjoint).
+   * \param[in] implicit - Whether the change of the solution over the iteration is added.
+   */
+  void SetHarmonicBalance_Source(unsigned short iMGlevel, unsigned short iSol,
+                                 const su2double *HBOperator, bool implicit);
 	
   /*!
    * \brief Precondition Harmonic Balance source term for stability
@@ -1686,3 +1949,86 @@ public:
 
 };
 
+/*!
+ * \class CBenchmarkDriver
+ * \brief Class for timing the computational kernels of a flow problem in isolation.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ */
+class CBenchmarkDriver : public CDriver {
+protected:
+
+  unsigned long nRepeat;                   /*!< \brief Number of repetitions of each kernel. */
+  vector<string> Bench_Kernel;             /*!< \brief Name of each benchmarked kernel. */
+  vector<string> Bench_Unit;               /*!< \brief Unit of the throughput of each kernel. */
+  vector<passivedouble> Bench_Time,        /*!< \brief Time per call of each kernel (slowest rank). */
+  Bench_Throughput;                        /*!< \brief Throughput of each kernel (all ranks). */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] val_nDim - Number of dimensions.
+   * \param[in] val_periodic - Bool for periodic BCs.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   * \param[in] val_nRepeat - Number of repetitions of each kernel.
+   */
+  CBenchmarkDriver(char* confFile,
+                   unsigned short val_nZone,
+                   unsigned short val_nDim,
+                   bool val_periodic,
+                   SU2_Comm MPICommunicator,
+                   unsigned long val_nRepeat);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CBenchmarkDriver(void);
+
+  /*!
+   * \brief [Overload] Run all the kernels, print the results and write them to benchmark.csv.
+   */
+  void StartSolver();
+
+  /*!
+   * \brief Time the convective numerics (ComputeResidual) of every available scheme on the edges of the fine grid.
+   */
+  void Benchmark_Numerics(void);
+
+  /*!
+   * \brief Evaluate a convective scheme on all the edges of the fine grid.
+   * \param[in] numerics - Convective numerics of the flow solver.
+   * \param[in] matrix - Matrix where the Jacobians are added, NULL if not needed.
+   */
+  void Compute_Edge_Fluxes(CNumerics *numerics, CSysMatrix *matrix);
+
+  /*!
+   * \brief Time the sparse matrix vector product and the build/apply of the Jacobi, ILU and LU-SGS preconditioners.
+   */
+  void Benchmark_LinearSolver(void);
+
+  /*!
+   * \brief Time the dense matrix products of the DG-FEM solver for polynomial degrees 1 to 4.
+   */
+  void Benchmark_Gemm(void);
+
+  /*!
+   * \brief Time the halo exchange of the flow solution.
+   */
+  void Benchmark_Comms(void);
+
+  /*!
+   * \brief Store the result of one kernel.
+   * \param[in] val_kernel - Name of the kernel.
+   * \param[in] val_nCalls - Number of calls of the kernel.
+   * \param[in] val_time - Time of all the calls on this rank.
+   * \param[in] val_work - Work of one call on this rank (edges, flops, bytes).
+   * \param[in] val_scale - Scaling of the work in the reported unit.
+   * \param[in] val_unit - Unit of the throughput.
+   */
+  void SetResult(string val_kernel, unsigned long val_nCalls, passivedouble val_time,
+                 passivedouble val_work, passivedouble val_scale, string val_unit);
+
+};
@@ -243,6 +243,28 @@ public:
 
 		virtual void SetTDState_rhoe (su2double rho, su2double e );
 
+		/*!
+		 * \brief Set the thermodynamic state of a batch of points from density and internal energy.
+		 *        The default implementation loops over SetTDState_rhoe, so the internal state of the
+		 *        fluid model corresponds to the last point of the batch on exit.
+		 * \param[in]  nPoints  - Number of points in the batch.
+		 * \param[in]  rho      - Density of the points.
+		 * \param[in]  e        - Static energy of the points.
+		 * \param[out] P        - Pressure of the points.
+		 * \param[out] T        - Temperature of the points.
+		 * \param[out] c2       - Square of the speed of sound of the points.
+		 * \param[out] dPdrho_e - Derivative of the pressure w.r.t. the density at constant energy.
+		 * \param[out] dPde_rho - Derivative of the pressure w.r.t. the energy at constant density.
+		 */
+		virtual void SetTDState_rhoe_Batch(const unsigned long nPoints,
+		                                   const su2double     *rho,
+		                                   const su2double     *e,
+		                                   su2double           *P,
+		                                   su2double           *T,
+		                                   su2double           *c2,
+		                                   su2double           *dPdrho_e,
+		                                   su2double           *dPde_rho);
+
 		/*!
 		 * \brief virtual member that would be different for each gas model implemented
 		 * \param[in] InputSpec - Input pair for FLP calls ("PT").
@@ -370,6 +392,27 @@ public:
 
 		void SetTDState_rhoe (su2double rho, su2double e );
 
+		/*!
+		 * \brief Set the thermodynamic state of a batch of points from density and internal energy.
+		 *        The closed form expressions are evaluated in a single loop without calls per point.
+		 * \param[in]  nPoints  - Number of points in the batch.
+		 * \param[in]  rho      - Density of the points.
+		 * \param[in]  e        - Static energy of the points.
+		 * \param[out] P        - Pressure of the points.
+		 * \param[out] T        - Temperature of the points.
+		 * \param[out] c2       - Square of the speed of sound of the points.
+		 * \param[out] dPdrho_e - Derivative of the pressure w.r.t. the density at constant energy.
+		 * \param[out] dPde_rho - Derivative of the pressure w.r.t. the energy at constant density.
+		 */
+		void SetTDState_rhoe_Batch(const unsigned long nPoints,
+		                           const su2double     *rho,
+		                           const su2double     *e,
+		                           su2double           *P,
+		                           su2double           *T,
+		                           su2double           *c2,
+		                           su2double           *dPdrho_e,
+		                           su2double           *dPde_rho);
+
 		/*!
 		 * \brief Set the Dimensionless State using Pressure  and Temperature
 		 * \param[in] P - first thermodynamic variable.
@@ -638,6 +681,166 @@ public:
 
 };
 
+/*!
+ * \derived class CLookUpTable
+ * \brief Child class for defining a fluid model based on look-up tables. The tables
+ *        are generated from a real gas model (Van der Waals or Peng-Robinson) on uniform
+ *        grids in (log(rho),e), (P,T) and (h,s), such that the cell containing a state is found
+ *        directly and the state follows from a bilinear interpolation. The derivatives of
+ *        the thermodynamic state are tabulated as well, such that they are consistent with
+ *        the generating model. States outside the tables are computed with the generating model.
+ */
+class CLookUpTable : public CFluidModel {
+
+protected:
+  CFluidModel *Generator;  /*!< \brief Real gas model used to generate the tables and for states outside the tables. */
+
+  unsigned short nPoints;  /*!< \brief Number of points per direction of the tables. */
+
+  su2double rhoMin, rhoMax,  /*!< \brief Density range of the (rho,e) table. */
+            eMin, eMax,      /*!< \brief Energy range of the (rho,e) table. */
+            PMin, PMax,      /*!< \brief Pressure range of the (P,T) table. */
+            TMin, TMax,      /*!< \brief Temperature range of the (P,T) table. */
+            hMin, hMax,      /*!< \brief Enthalpy range of the (h,s) table. */
+            sMin, sMax;      /*!< \brief Entropy range of the (h,s) table. */
+
+  vector<su2double> TableRhoE; /*!< \brief Table in (log(rho),e) of P, T, c2, s, dPdrho_e, dPde_rho, dTdrho_e and dTde_rho. */
+  vector<su2double> TablePT;   /*!< \brief Table in (P,T) of rho and e. */
+  vector<su2double> TableHS;   /*!< \brief Table in (h,s) of log(rho) and e. */
+
+  vector<bool> ValidRhoE;      /*!< \brief Whether or not the nodes of the (rho,e) table contain a physical state. */
+  vector<bool> ValidPT;        /*!< \brief Whether or not the nodes of the (P,T) table contain a physical state. */
+  vector<bool> ValidHS;        /*!< \brief Whether or not the nodes of the (h,s) table contain a physical state. */
+
+  vector<passivedouble> Signature; /*!< \brief Parameters of the generating model, used to validate a cached table. */
+
+private:
+
+  /*!
+   * \brief Determine the cell of a uniform table containing the given state and
+   *        the corresponding interpolation weights.
+   * \param[in]  x, y           - State to be located.
+   * \param[in]  xMin, xMax     - Range of the first variable of the table.
+   * \param[in]  yMin, yMax     - Range of the second variable of the table.
+   * \param[in]  valid          - Validity of the nodes of the table.
+   * \param[out] iCell          - Index of the lower left node of the cell.
+   * \param[out] wx, wy         - Interpolation weights in the cell.
+   * \return <code>TRUE</code> if the state is inside a valid cell of the table.
+   */
+  bool FindCell(su2double x, su2double y, su2double xMin, su2double xMax,
+                su2double yMin, su2double yMax, const vector<bool> &valid,
+                unsigned long &iCell, su2double &wx, su2double &wy);
+
+  /*!
+   * \brief Bilinear interpolation of the variables stored in a table.
+   * \param[in]  table - Table to be interpolated.
+   * \param[in]  nVar  - Number of variables stored per node.
+   * \param[in]  iCell - Index of the lower left node of the cell.
+   * \param[in]  wx, wy - Interpolation weights in the cell.
+   * \param[out] val   - Interpolated variables.
+   */
+  void Interpolate(const vector<su2double> &table, unsigned short nVar,
+                   unsigned long iCell, su2double wx, su2double wy, su2double *val);
+
+  /*!
+   * \brief Generate the tables with the generating model.
+   */
+  void GenerateTables(void);
+
+  /*!
+   * \brief Read the tables from file.
+   * \param[in] filename - Name of the file.
+   * \return <code>TRUE</code> if the file exists and was generated with the same parameters.
+   */
+  bool ReadTables(string filename);
+
+  /*!
+   * \brief Write the tables to file.
+   * \param[in] filename - Name of the file.
+   */
+  void WriteTables(string filename);
+
+  /*!
+   * \brief Copy the thermodynamic state of the generating model.
+   */
+  void CopyStateGenerator(void);
+
+public:
+
+    /*!
+     * \brief Constructor of the class.
+     * \param[in] val_generator      - Real gas model used to generate the tables. The object becomes
+     *                                the owner of this model.
+     * \param[in] config             - Definition of the particular problem.
+     * \param[in] Pressure_FreeStreamND    - Non-dimensional free-stream pressure.
+     * \param[in] Temperature_FreeStreamND - Non-dimensional free-stream temperature.
+     */
+    CLookUpTable(CFluidModel *val_generator, CConfig *config,
+                 su2double Pressure_FreeStreamND, su2double Temperature_FreeStreamND);
+
+    /*!
+     * \brief Destructor of the class.
+     */
+    virtual ~CLookUpTable(void);
+
+    /*!
+     * \brief Set the Dimensionless State using Density and Internal Energy
+     * \param[in] rho - first thermodynamic variable.
+     * \param[in] e - second thermodynamic variable.
+     */
+    void SetTDState_rhoe (su2double rho, su2double e );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Temperature
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] T - second thermodynamic variable.
+     */
+    void SetTDState_PT (su2double P, su2double T );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Density
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] rho - second thermodynamic variable.
+     */
+    void SetTDState_Prho (su2double P, su2double rho );
+
+    /*!
+     * \brief Set the Dimensionless Energy using Pressure and Density
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] rho - second thermodynamic variable.
+     */
+    void SetEnergy_Prho (su2double P, su2double rho );
+
+    /*!
+     * \brief Set the Dimensionless State using Enthalpy and Entropy
+     * \param[in] h - first thermodynamic variable.
+     * \param[in] s - second thermodynamic variable.
+     */
+    void SetTDState_hs (su2double h, su2double s );
+
+    /*!
+     * \brief Set the Dimensionless State using Density and Temperature
+     * \param[in] rho - first thermodynamic variable.
+     * \param[in] T - second thermodynamic variable.
+     */
+    void SetTDState_rhoT (su2double rho, su2double T );
+
+    /*!
+     * \brief Set the Dimensionless State using Pressure and Entropy
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] s - second thermodynamic variable.
+     */
+    void SetTDState_Ps (su2double P, su2double s );
+
+    /*!
+     * \brief compute some derivatives of enthalpy and entropy needed for subsonic inflow BC
+     * \param[in] P - first thermodynamic variable.
+     * \param[in] rho - second thermodynamic variable.
+     */
+    void ComputeDerivativeNRBC_Prho (su2double P, su2double rho );
+
+};
+
 /*!
  * \class CConstantDensity
  * \brief Child class for defining a constant density gas model (incompressible only).
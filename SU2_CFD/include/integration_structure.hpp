@@ -71,6 +71,7 @@ protected:
   Convergence_FSI,    /*!< \brief To indicate if the FSI problem has converged or not. */
   Convergence_FullMG;    /*!< \brief To indicate if the Full Multigrid has converged and it is necessary to add a new level. */
   su2double InitResidual;  /*!< \brief Initial value of the residual to evaluate the convergence level. */
+  su2double DualTime_InitResidual;  /*!< \brief Residual at the first internal iteration of the current time step. */
 
 public:
   
@@ -122,6 +123,21 @@ public:
   void Time_Integration(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
               unsigned short iRKStep, unsigned short RunTime_EqSystem, unsigned long Iteration);
   
+  /*!
+   * \brief Do the space and time integration of a step of the multirate explicit Euler scheme
+   *        (LEVELS_TIME_ACCURATE_LTS). The step is made of substeps of the global time step, at each
+   *        substep the edges of the levels whose step starts are evaluated level by level, and the
+   *        points whose step ends are updated with their time integrated residual.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  void Multirate_Integration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
+                             unsigned short iMesh, unsigned short RunTime_EqSystem);
+  
   /*! 
    * \brief Do the time integration (explicit or implicit) of the numerical system on a FEM framework.
    * \author R. Sanchez
@@ -248,6 +264,14 @@ public:
    */
   void SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Second order extrapolation of the solution of the new time step from the solutions at time n and n-1.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Solver of the problem, the time levels must have been updated.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDualTime_Predictor(CGeometry *geometry, CSolver *solver, CConfig *config);
+  
   /*! 
    * \brief Save the structural solution at different time steps.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -391,6 +415,17 @@ public:
   virtual void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, 
                  CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - Index of the zone.
+   * \param[in] iInst - Index of the instance.
+   */
+  virtual void DiscAdj_MultiGrid_Correction(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                                            unsigned short iZone, unsigned short iInst);
+  
   /*! 
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -450,7 +485,37 @@ public:
  */
 class CMultiGridIntegration : public CIntegration {
 protected:
-    
+  bool MG_Adaptive;                          /*!< \brief Adapt the sweeps, the cycle, and the depth at runtime. */
+  unsigned short MG_AdaptCycle,              /*!< \brief Cycle (V_CYCLE or W_CYCLE) chosen by the adaptive controller. */
+  MG_AdaptDepth;                             /*!< \brief Coarsest level visited by the adaptive controller. */
+  vector<unsigned short> MG_AdaptPreSmooth,  /*!< \brief Pre-smoothing sweeps of each level. */
+  MG_AdaptPostSmooth,                        /*!< \brief Post-smoothing sweeps of each level. */
+  MG_AdaptStall;                             /*!< \brief Consecutive cycles in which a level did not reduce its residual. */
+  vector<su2double> MG_AdaptRes_First,       /*!< \brief Residual of each level at the first sweep of the last visit. */
+  MG_AdaptRes_Last,                          /*!< \brief Residual of each level at the last sweep of the last visit. */
+  MG_AdaptRate;                              /*!< \brief Averaged residual reduction factor per sweep (per cycle on the finest level). */
+  su2double MG_AdaptFine_Old,                /*!< \brief Residual of the finest level at the previous cycle. */
+  MG_AdaptRate_V;                            /*!< \brief Reduction factor of the V cycle when the W cycle was tried. */
+  unsigned long MG_AdaptWindow,              /*!< \brief Cycles since the last change of the cycle. */
+  MG_AdaptHold;                              /*!< \brief Cycles to wait before the next change of the cycle. */
+  
+  /*!
+   * \brief Size the state of the adaptive cycle controller from the options of the zone.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetAdaptive_Cycle(CConfig *config);
+  
+  /*!
+   * \brief Update the sweeps, the cycle, and the depth from the residual reduction measured on each level.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] FinestMesh - Current finest level of the cycle.
+   * \param[in] SolContainer_Position - Position of the solver in the container.
+   * \param[in] Iteration - Current iteration.
+   */
+  void Adapt_Cycle(CSolver ***solver_container, CConfig *config, unsigned short FinestMesh,
+                   unsigned short SolContainer_Position, unsigned long Iteration);
+  
 public:
   
   /*! 
@@ -612,6 +677,113 @@ public:
    */
   void SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, 
              CConfig *config, unsigned short iMesh);
+  
+  /*!
+   * \brief Coarse grid correction of the steady discrete adjoint fixed-point iteration.
+   *
+   * The recorded iteration is Psi^(n+1) = Psi^(n) - (dR/dU)^T P^-T Psi^(n) + b in terms of the implicit
+   * operator P, the error of the adjoint is therefore e = P^T y with (dR/dU)^T y = Psi^(n+1) - Psi^(n).
+   * The coarse levels do not solve that problem but P_c^T y = r, with the transposed Jacobians of the
+   * flow solver assembled during the recording. These are the implicit operators P_c = V/dt + dR/dU
+   * of the coarse levels, i.e. the coarse problem keeps the pseudo time term of the flow iteration.
+   * The correction P^T y, with the implicit operator of the fine grid, is added to the adjoint solution.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iZone - Index of the zone.
+   * \param[in] iInst - Index of the instance.
+   */
+  void DiscAdj_MultiGrid_Correction(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                                    unsigned short iZone, unsigned short iInst);
+  
+  /*!
+   * \brief Linear V cycle for P_c^T y = r, with the transposed implicit operator P_c = V/dt + dR/dU of the
+   *        flow on each coarse level (see DiscAdj_MultiGrid_Correction).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] iZone - Index of the zone.
+   * \param[in] iInst - Index of the instance.
+   */
+  void DiscAdj_MultiGrid_Cycle(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                               unsigned short iMesh, unsigned short iZone, unsigned short iInst);
+  
+  /*!
+   * \brief Restrict the defect of the discrete adjoint correction (LinSysAux) to the right hand side of the coarse grid.
+   * \param[in] sol_fine - Pointer to the adjoint solution on the fine grid.
+   * \param[out] sol_coarse - Pointer to the adjoint solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetRestricted_AdjointResidual(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+                                     CGeometry *geo_coarse, CConfig *config);
+  
+  /*!
+   * \brief Add the coarse grid solution of the discrete adjoint correction (LinSysSol) to the fine grid.
+   * \param[out] sol_fine - Pointer to the adjoint solution on the fine grid.
+   * \param[in] sol_coarse - Pointer to the adjoint solution on the coarse grid.
+   * \param[in] geo_fine - Geometrical definition of the fine grid.
+   * \param[in] geo_coarse - Geometrical definition of the coarse grid.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetProlongated_AdjointCorrection(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+                                        CGeometry *geo_coarse, CConfig *config);
+};
+
+/*!
+ * \class CJacobianFreeProduct
+ * \brief Product with the Jacobian of the implicit flow system from a finite difference of the residual.
+ *
+ * (V/dt + dR/dU)*u ~ V/dt*u + (R(U+eps*u)-R(U))/eps, the perturbed residual is computed with the
+ * same preprocessing and space integration as the unperturbed one, without assembling the Jacobian.
+ */
+class CJacobianFreeProduct : public CMatrixVectorProduct {
+private:
+  CIntegration *integration;           /*!< \brief Integration that computes the residual. */
+  CGeometry *geometry;                 /*!< \brief Geometry of the grid level. */
+  CSolver **solver_container;          /*!< \brief Solvers of the grid level. */
+  CNumerics **numerics;                /*!< \brief Numerics of the main solver. */
+  CConfig *config;                     /*!< \brief Definition of the problem. */
+  unsigned short iMesh,                /*!< \brief Grid level. */
+  iRKStep,                             /*!< \brief Runge-Kutta step of the unperturbed residual. */
+  RunTime_EqSystem,                    /*!< \brief System of equations. */
+  MainSolver,                          /*!< \brief Position of the main solver in the container. */
+  nVar;                                /*!< \brief Number of variables of the main solver. */
+  unsigned long nPointDomain;          /*!< \brief Number of points of the domain (this rank). */
+  vector<su2double> Solution_Ref,      /*!< \brief Unperturbed solution. */
+  Residual_Ref;                        /*!< \brief Unperturbed residual. */
+  su2double Solution_Norm;             /*!< \brief Global norm of the unperturbed solution. */
+  
+public:
+  
+  /*!
+   * \brief Constructor of the class, stores the state and the residual (must be called after the space integration).
+   * \param[in] val_integration - Integration that computes the residual.
+   * \param[in] val_geometry - Geometrical definition of the problem.
+   * \param[in] val_solver_container - Container vector with all the solutions.
+   * \param[in] val_numerics - Description of the numerical method.
+   * \param[in] val_config - Definition of the particular problem.
+   * \param[in] val_iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_iRKStep - Current step of the Runge-Kutta iteration.
+   * \param[in] val_RunTime_EqSystem - System of equations which is going to be solved.
+   */
+  CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                       CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                       unsigned short val_iRKStep, unsigned short val_RunTime_EqSystem);
+  
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CJacobianFreeProduct(void);
+  
+  /*!
+   * \brief Operator that defines the product with the Jacobian of the system.
+   * \param[in] u - CSysVector that is being multiplied.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
 /*! 
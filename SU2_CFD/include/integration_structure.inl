@@ -80,6 +80,9 @@ inline void CIntegration::SetResidual_Term(CGeometry *geometry, CSolver *flow) {
 inline void CIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, 
                       CConfig *config, unsigned short iMesh) { }
 
+inline void CIntegration::DiscAdj_MultiGrid_Correction(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                                                       unsigned short iZone, unsigned short iInst) { }
+
 inline void CIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolver *****solver_container, CNumerics ******numerics_container, 
                         CConfig **config, unsigned short RunTime_EqSystem, unsigned long Iteration, unsigned short iZone, unsigned short iInst) { }
 
@@ -50,6 +50,7 @@
 #include "../../Common/include/geometry_structure.hpp"
 #include "../../Common/include/grid_movement_structure.hpp"
 #include "../../Common/include/config_structure.hpp"
+#include "../../Common/include/anderson_acceleration.hpp"
 
 using namespace std;
 
@@ -72,6 +73,20 @@ protected:
             StopTime,
             UsedTime;
 
+  CAndersonAcceleration *Anderson;  /*!< \brief Anderson acceleration of the fixed-point iteration, NULL if it is not used. */
+  CSysVector Anderson_Solution;     /*!< \brief Solutions of the accelerated solvers, stacked point by point. */
+
+  /*!
+   * \brief Anderson acceleration of the fixed-point iteration of some solvers of the finest grid
+   *        (ANDERSON_DEPTH > 0). Their solutions are the image of the iterate of the last call,
+   *        they are overwritten with the next iterate.
+   * \param[in] solver - Solvers of the finest grid.
+   * \param[in] geometry - Finest grid.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iSol - Solvers accelerated together (e.g. the flow and turbulence solvers).
+   */
+  void Anderson_Iteration(CSolver **solver, CGeometry *geometry, CConfig *config, const vector<unsigned short> & val_iSol);
+
 public:
   
   /*!
@@ -84,6 +99,11 @@ public:
    */
   virtual ~CIteration(void);
 
+  /*!
+   * \brief Forget the history of the Anderson acceleration, e.g. when the solutions are reset.
+   */
+  void Anderson_Reset(void);
+
   /*!
    * \brief Updates the positions and grid velocities for dynamic meshes between physical time steps.
    * \author T. Economon
@@ -355,6 +375,12 @@ public:
  * \author T. Economon
  */
 class CFluidIteration : public CIteration {
+private:
+  
+  vector<pair<su2double, unsigned long> > Gust_Sorted; /*!< \brief Points of the finest grid sorted by their x coordinate, the direction of propagation of the gust. */
+  unsigned long Gust_Begin,  /*!< \brief Start of the range of Gust_Sorted set by the last evaluation of the gust. */
+  Gust_End;                  /*!< \brief End of the range of Gust_Sorted set by the last evaluation of the gust. */
+  
 public:
   
   /*!
@@ -483,7 +509,9 @@ public:
                    unsigned short val_iInst);
   
   /*!
-   * \brief Imposes a gust via the grid velocities.
+   * \brief Imposes a gust via the grid velocities. Only the points of the finest grid in the footprint of the
+   *        gust (and in the footprint of the previous call, which is cleared) are evaluated, the coarse grids
+   *        restrict the gust of the fine grid.
    * \author S. Padron
    * \param[in] config_container - Definition of the particular problem.
    * \param[in] geometry_container - Geometrical definition of the problem.
@@ -186,6 +186,7 @@ public:
   *Coord_3;      /*!< \brief Cartesians coordinates of point 3 (Galerkin method, tetrahedra). */
   unsigned short Neighbor_i,  /*!< \brief Number of neighbors of the point i. */
   Neighbor_j;          /*!< \brief Number of neighbors of the point j. */
+  su2double *Edge_Geometry;  /*!< \brief Precomputed x_j-x_i, |x_j-x_i|^2 and area of the face, NULL if not provided. */
   su2double *Normal,  /*!< \brief Normal vector, it norm is the area of the face. */
   *UnitNormal,    /*!< \brief Unitary normal vector. */
   *UnitNormald;    /*!< \brief derivatve of unitary normal vector. */
@@ -207,6 +208,18 @@ public:
   su2double StrainMag_i, StrainMag_j;   /*!< \brief Strain rate magnitude. */
   su2double Dissipation_i, Dissipation_j;
   su2double Dissipation_ij;
+  
+  unsigned short nPrimVar_Batch;  /*!< \brief Number of primitive variables of a batch of edges. */
+  su2double *Batch_V_i, *Batch_V_j, /*!< \brief Primitive variables of a batch of edges, stored as [iVar*SIMD_WIDTH+iLane]. */
+  *Batch_Normal,                    /*!< \brief Normals of a batch of edges, stored as [iDim*SIMD_WIDTH+iLane]. */
+  *Batch_Lambda_i, *Batch_Lambda_j, /*!< \brief Spectral radius at the points of a batch of edges. */
+  *Batch_Sensor_i, *Batch_Sensor_j, /*!< \brief Pressure sensor at the points of a batch of edges. */
+  *Batch_Und_Lapl_i, *Batch_Und_Lapl_j, /*!< \brief Undivided laplacians of a batch of edges, stored as [iVar*SIMD_WIDTH+iLane]. */
+  *Batch_Residual,                  /*!< \brief Residuals of a batch of edges, stored as [iVar*SIMD_WIDTH+iLane]. */
+  *Batch_Jacobian_i, *Batch_Jacobian_j; /*!< \brief Jacobians of a batch of edges, stored as [(iVar*nVar+jVar)*SIMD_WIDTH+iLane]. */
+  unsigned short *Batch_Neighbor_i, *Batch_Neighbor_j; /*!< \brief Number of neighbors at the points of a batch of edges. */
+  su2double *Lane_V_i, *Lane_V_j, *Lane_Normal, *Lane_Und_Lapl_i, *Lane_Und_Lapl_j, *Lane_Residual,
+  **Lane_Jacobian_i, **Lane_Jacobian_j; /*!< \brief Auxiliary structures to evaluate a batch edge by edge. */
     
   su2double *l, *m;
 
@@ -655,6 +668,12 @@ public:
    */
   void SetNormal(su2double *val_normal);
   
+  /*!
+   * \brief Set the precomputed geometric factors of the edge, they are discarded by the next call to SetCoord.
+   * \param[in] val_edge_geometry - x_j-x_i (nDim), |x_j-x_i|^2, and the area of the face.
+   */
+  void SetEdge_Geometry(su2double *val_edge_geometry);
+  
   /*!
    * \brief Set the value of the volume of the control volume.
    * \param[in] val_volume Volume of the control volume.
@@ -799,6 +818,19 @@ public:
                           su2double *val_normal, su2double val_scale,
                           su2double **val_Proj_Jac_tensor);
   
+  /*!
+   * \brief Kernel of GetInviscidProjJac for a fixed number of dimensions (instantiated for 2 and 3).
+   * \param[in] val_velocity Pointer to the velocity.
+   * \param[in] val_energy Value of the energy.
+   * \param[in] val_normal - Normal vector, the norm of the vector is the area of the face.
+   * \param[in] val_scale - Scale of the projection.
+   * \param[out] val_Proj_Jac_tensor - Pointer to the projected inviscid Jacobian.
+   */
+  template<unsigned short NDIM>
+  void GetInviscidProjJac_Kernel(su2double *val_velocity, su2double *val_energy,
+                                 su2double *val_normal, su2double val_scale,
+                                 su2double **val_Proj_Jac_tensor);
+  
   /*!
    * \brief Compute the projection of the inviscid Jacobian matrices (incompressible).
    * \param[in] val_density - Value of the density.
@@ -1073,7 +1105,7 @@ public:
   virtual void ComputeResidual_TransLM(su2double *val_residual,
                                        su2double **val_Jacobian_i,
                                        su2double **val_Jacobian_j, CConfig *config,
-                                       su2double &gamma_sep) ;
+                                       su2double &gamma_sep, su2double &f_lambda) ;
   
   /*!
    * \overload
@@ -1094,6 +1126,76 @@ public:
   virtual void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i,
                                su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Set the data of one edge of a batch (structure of arrays).
+   * \param[in] iLane - Position of the edge in the batch (< SIMD_WIDTH).
+   * \param[in] val_v_i - Primitive variables at point i.
+   * \param[in] val_v_j - Primitive variables at point j.
+   * \param[in] val_normal - Normal vector, the norm of the vector is the area of the face.
+   */
+  void SetBatch_Edge(unsigned short iLane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal);
+  
+  /*!
+   * \brief Set the artificial dissipation data (centered schemes) of one edge of a batch.
+   * \param[in] iLane - Position of the edge in the batch (< SIMD_WIDTH).
+   * \param[in] val_lambda_i - Spectral radius at point i.
+   * \param[in] val_lambda_j - Spectral radius at point j.
+   * \param[in] val_neighbor_i - Number of neighbors of point i.
+   * \param[in] val_neighbor_j - Number of neighbors of point j.
+   * \param[in] val_und_lapl_i - Undivided laplacian at point i (NULL if not used).
+   * \param[in] val_und_lapl_j - Undivided laplacian at point j (NULL if not used).
+   * \param[in] val_sensor_i - Pressure sensor at point i.
+   * \param[in] val_sensor_j - Pressure sensor at point j.
+   */
+  void SetBatch_Dissipation(unsigned short iLane, su2double val_lambda_i, su2double val_lambda_j,
+                            unsigned short val_neighbor_i, unsigned short val_neighbor_j,
+                            su2double *val_und_lapl_i, su2double *val_und_lapl_j,
+                            su2double val_sensor_i, su2double val_sensor_j);
+  
+  /*!
+   * \brief Get the residual of one edge of a batch.
+   * \param[in] iLane - Position of the edge in the batch.
+   * \param[out] val_residual - Residual of the edge.
+   */
+  void GetBatch_Residual(unsigned short iLane, su2double *val_residual);
+  
+  /*!
+   * \brief Get the Jacobians of one edge of a batch.
+   * \param[in] iLane - Position of the edge in the batch.
+   * \param[out] val_Jacobian_i - Jacobian of the edge with respect to point i.
+   * \param[out] val_Jacobian_j - Jacobian of the edge with respect to point j.
+   */
+  void GetBatch_Jacobian(unsigned short iLane, su2double **val_Jacobian_i, su2double **val_Jacobian_j);
+  
+  /*!
+   * \brief Get the Jacobian with respect to point i of one edge of a batch, in place.
+   * \param[in] iLane - Position of the edge in the batch.
+   * \return Entry (0,0) of the Jacobian, the entry (iVar,jVar) is at (iVar*nVar+jVar)*SIMD_WIDTH.
+   */
+  su2double *GetBatch_Jacobian_i(unsigned short iLane);
+  
+  /*!
+   * \brief Get the Jacobian with respect to point j of one edge of a batch, in place.
+   * \param[in] iLane - Position of the edge in the batch.
+   * \return Entry (0,0) of the Jacobian, the entry (iVar,jVar) is at (iVar*nVar+jVar)*SIMD_WIDTH.
+   */
+  su2double *GetBatch_Jacobian_j(unsigned short iLane);
+  
+  /*!
+   * \brief Copy the first edge of a batch in the unused positions, such that the
+   *        vectorized kernels can always work over the full SIMD_WIDTH.
+   * \param[in] nBatch - Number of edges in the batch.
+   */
+  void PadBatch(unsigned short nBatch);
+  
+  /*!
+   * \brief Compute the residuals and Jacobians of a batch of edges, set with SetBatch_Edge. By default
+   *        the edges are evaluated one by one with ComputeResidual, schemes with a vectorized kernel overload it.
+   * \param[in] nBatch - Number of edges in the batch (<= SIMD_WIDTH).
+   * \param[in] config - Definition of the particular problem.
+   */
+  virtual void ComputeResidual_Batch(unsigned short nBatch, CConfig *config);
+  
   /*!
    * \overload
    * \param[out] val_residual - Pointer to the total residual.
@@ -1419,6 +1521,15 @@ public:
    */
   virtual void Compute_Averaged_NodalStress(CElement *element_container, CConfig *config);
 
+  /*!
+   * \brief A virtual member to get the constitutive matrix of an element, used by the matrix-free
+   *        application of the stiffness matrix of linear elasticity.
+   * \param[in] element_container - Element structure for the particular element integrated.
+   * \param[in] config - Definition of the particular problem.
+   * \param[out] val_D - Constitutive matrix in Voigt notation, stored row by row (3x3 in 2D, 6x6 in 3D).
+   */
+  virtual void Get_Constitutive_Matrix(CElement *element_container, CConfig *config, su2double *val_D);
+
   /*!
    * \brief Computes a basis of orthogonal vectors from a suppled vector
    * \param[in] config - Normal vector
@@ -1589,6 +1700,32 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config);
   
+  /*!
+   * \brief Compute the Roe's flux of a batch of edges (vectorized over the edges).
+   * \param[in] nBatch - Number of edges in the batch.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(unsigned short nBatch, CConfig *config);
+  
+private:
+  
+  /*!
+   * \brief Kernel of ComputeResidual_Batch for a fixed number of dimensions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM> void ComputeResidual_Batch_Kernel(CConfig *config);
+  
+  /*!
+   * \brief Kernel of ComputeResidual for a fixed number of dimensions.
+   * \param[out] val_residual - Pointer to the total residual.
+   * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
+   * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM>
+  void ComputeResidual_Kernel(su2double *val_residual, su2double **val_Jacobian_i,
+                              su2double **val_Jacobian_j, CConfig *config);
+  
 };
 
 
@@ -2728,6 +2865,22 @@ public:
    */
   void ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                        CConfig *config);
+  
+  /*!
+   * \brief Compute the JST residual of a batch of edges (vectorized over the edges).
+   * \param[in] nBatch - Number of edges in the batch.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeResidual_Batch(unsigned short nBatch, CConfig *config);
+  
+private:
+  
+  /*!
+   * \brief Kernel of ComputeResidual_Batch for a fixed number of dimensions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  template<unsigned short NDIM> void ComputeResidual_Batch_Kernel(CConfig *config);
+  
 };
 
 /*!
@@ -3197,6 +3350,44 @@ class CAvgGrad_Base : public CNumerics {
    */
   void GetMeanRateOfStrainMatrix(su2double **S_ij) const;
 
+  /*!
+   * \brief Kernel of CorrectGradient for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void CorrectGradient_Kernel(su2double** GradPrimVar,
+                              const su2double* val_PrimVar_i,
+                              const su2double* val_PrimVar_j,
+                              const su2double* val_edge_vector,
+                              su2double val_dist_ij_2,
+                              const unsigned short val_nPrimVar);
+
+  /*!
+   * \brief Kernel of SetStressTensor for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void SetStressTensor_Kernel(const su2double *val_primvar,
+                              const su2double* const *val_gradprimvar,
+                              su2double val_turb_ke,
+                              su2double val_laminar_viscosity,
+                              su2double val_eddy_viscosity);
+
+  /*!
+   * \brief Kernel of SetTauJacobian for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void SetTauJacobian_Kernel(const su2double* val_Mean_PrimVar,
+                             su2double val_laminar_viscosity,
+                             su2double val_eddy_viscosity,
+                             su2double val_dist_ij,
+                             const su2double *val_normal);
+
+  /*!
+   * \brief Kernel of GetViscousProjFlux for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void GetViscousProjFlux_Kernel(const su2double *val_primvar,
+                                 const su2double *val_normal);
+
  public:
 
   /*!
@@ -3316,6 +3507,33 @@ public:
                            su2double val_eddy_viscosity,
                            su2double val_dist_ij,
                            const su2double *val_normal);
+
+private:
+
+  /*!
+   * \brief Kernel of ComputeResidual for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void ComputeResidual_Kernel(su2double *val_residual, su2double **val_Jacobian_i,
+                              su2double **val_Jacobian_j, CConfig *config);
+
+  /*!
+   * \brief Kernel of SetHeatFluxVector for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void SetHeatFluxVector_Kernel(const su2double* const *val_gradprimvar,
+                                su2double val_laminar_viscosity,
+                                su2double val_eddy_viscosity);
+
+  /*!
+   * \brief Kernel of SetHeatFluxJacobian for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void SetHeatFluxJacobian_Kernel(const su2double *val_Mean_PrimVar,
+                                  su2double val_laminar_viscosity,
+                                  su2double val_eddy_viscosity,
+                                  su2double val_dist_ij,
+                                  const su2double *val_normal);
 };
 
 /*!
@@ -4190,6 +4408,8 @@ public:
 
   void Compute_Averaged_NodalStress(CElement *element_container, CConfig *config);
 
+  void Get_Constitutive_Matrix(CElement *element_container, CConfig *config, su2double *val_D);
+
 };
 
 /*!
@@ -5009,7 +5229,24 @@ private:
   su2double alpha_global;
   su2double Vorticity;
 
+  /*-- Parts of the correlations that only depend on the freestream turbulence intensity --*/
+  su2double rey_tc_tu;       /*!< \brief Factor of Re_theta in the critical Reynolds number. */
+  su2double flen_tu;         /*!< \brief Transition length function. */
+  su2double re_theta_tu;     /*!< \brief Re_theta_t without pressure gradient (f_lambda = 1). */
+  su2double f_lambda_neg_tu; /*!< \brief Damping of the adverse pressure gradient correction. */
+  su2double f_lambda_pos_tu; /*!< \brief Damping of the favourable pressure gradient correction. */
+  su2double re_theta_corr;   /*!< \brief Re_theta_t of the last point, reused by the differentiated routine. */
+
   bool implicit;
+
+  /*!
+   * \brief Fixed point iterations of the Re_theta_t correlation, which depends on the pressure gradient.
+   * \param[in] du_ds - Streamwise derivative of the velocity magnitude.
+   * \param[in] Velocity_Mag - Velocity magnitude.
+   * \param[in,out] f_lambda - Pressure gradient function, initial guess (e.g. from the previous iteration) and converged value.
+   * \return Re_theta_t.
+   */
+  su2double ReThetaT_Correlation(su2double du_ds, su2double Velocity_Mag, su2double &f_lambda);
   
 public:
   bool debugme; // For debugging only, remove this. -AA
@@ -5033,8 +5270,11 @@ public:
    * \param[out] val_Jacobian_i - Jacobian of the numerical method at node i (implicit computation).
    * \param[out] val_Jacobian_j - Jacobian of the numerical method at node j (implicit computation).
    * \param[in] config - Definition of the particular problem.
+   * \param[out] gamma_sep - Separation induced intermittency.
+   * \param[in,out] f_lambda - Pressure gradient function of the Re_theta_t correlation, warm start of its iterations.
    */
-  void ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config, su2double &gamma_sep);
+  void ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config,
+                               su2double &gamma_sep, su2double &f_lambda);
   
   void CSourcePieceWise_TransLM__ComputeResidual_TransLM_d(su2double *TransVar_i, su2double *TransVar_id, su2double *val_residual, su2double *val_residuald, CConfig *config);
 };
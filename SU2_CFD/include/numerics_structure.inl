@@ -189,7 +189,7 @@ inline void CNumerics::GetEq_Rxn_Coefficients(su2double **EqnRxnConstants, CConf
                             
 inline void CNumerics::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, CConfig *config) { }
 
-inline void CNumerics::ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config, su2double &gamma_sep) {}
+inline void CNumerics::ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config, su2double &gamma_sep, su2double &f_lambda) {}
 
 inline void CNumerics::ComputeResidual_Axisymmetric(su2double *val_residual, CConfig *config) { }
 
@@ -381,6 +381,7 @@ inline void CNumerics::SetConsVarGradient(su2double **val_consvar_grad) {
 inline void CNumerics::SetCoord(su2double *val_coord_i, su2double *val_coord_j) {
   Coord_i = val_coord_i;
   Coord_j = val_coord_j;
+  Edge_Geometry = NULL;
 }
 
 inline void CNumerics::SetCoord(su2double *val_coord_0, su2double *val_coord_1, 
@@ -448,6 +449,47 @@ inline void CNumerics::SetNeighbor(unsigned short val_neighbor_i, unsigned short
   Neighbor_j = val_neighbor_j;
 }
 
+inline void CNumerics::SetBatch_Edge(unsigned short iLane, su2double *val_v_i, su2double *val_v_j, su2double *val_normal) {
+  for (unsigned short iVar = 0; iVar < nPrimVar_Batch; iVar++) {
+    Batch_V_i[iVar*SIMD_WIDTH+iLane] = val_v_i[iVar];
+    Batch_V_j[iVar*SIMD_WIDTH+iLane] = val_v_j[iVar];
+  }
+  for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    Batch_Normal[iDim*SIMD_WIDTH+iLane] = val_normal[iDim];
+}
+
+inline void CNumerics::SetBatch_Dissipation(unsigned short iLane, su2double val_lambda_i, su2double val_lambda_j,
+                                            unsigned short val_neighbor_i, unsigned short val_neighbor_j,
+                                            su2double *val_und_lapl_i, su2double *val_und_lapl_j,
+                                            su2double val_sensor_i, su2double val_sensor_j) {
+  Batch_Lambda_i[iLane] = val_lambda_i;     Batch_Lambda_j[iLane] = val_lambda_j;
+  Batch_Neighbor_i[iLane] = val_neighbor_i; Batch_Neighbor_j[iLane] = val_neighbor_j;
+  Batch_Sensor_i[iLane] = val_sensor_i;     Batch_Sensor_j[iLane] = val_sensor_j;
+  if (val_und_lapl_i != NULL) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      Batch_Und_Lapl_i[iVar*SIMD_WIDTH+iLane] = val_und_lapl_i[iVar];
+      Batch_Und_Lapl_j[iVar*SIMD_WIDTH+iLane] = val_und_lapl_j[iVar];
+    }
+  }
+}
+
+inline void CNumerics::GetBatch_Residual(unsigned short iLane, su2double *val_residual) {
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    val_residual[iVar] = Batch_Residual[iVar*SIMD_WIDTH+iLane];
+}
+
+inline void CNumerics::GetBatch_Jacobian(unsigned short iLane, su2double **val_Jacobian_i, su2double **val_Jacobian_j) {
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    for (unsigned short jVar = 0; jVar < nVar; jVar++) {
+      val_Jacobian_i[iVar][jVar] = Batch_Jacobian_i[(iVar*nVar+jVar)*SIMD_WIDTH+iLane];
+      val_Jacobian_j[iVar][jVar] = Batch_Jacobian_j[(iVar*nVar+jVar)*SIMD_WIDTH+iLane];
+    }
+}
+
+inline su2double *CNumerics::GetBatch_Jacobian_i(unsigned short iLane) { return &Batch_Jacobian_i[iLane]; }
+
+inline su2double *CNumerics::GetBatch_Jacobian_j(unsigned short iLane) { return &Batch_Jacobian_j[iLane]; }
+
 inline void CNumerics::SetTurbAdjointVar(su2double *val_turbpsivar_i, su2double *val_turbpsivar_j) {
   TurbPsi_i = val_turbpsivar_i;
   TurbPsi_j = val_turbpsivar_j;
@@ -470,6 +512,8 @@ inline void CNumerics::SetAuxVarGrad(su2double *val_auxvargrad_i, su2double *val
 
 inline void CNumerics::SetNormal(su2double *val_normal) { Normal = val_normal; }
 
+inline void CNumerics::SetEdge_Geometry(su2double *val_edge_geometry) { Edge_Geometry = val_edge_geometry; }
+
 inline void CNumerics::SetVolume(su2double val_volume) { Volume = val_volume; }
 
 inline void CNumerics::SetDissipation(su2double diss_i, su2double diss_j) {
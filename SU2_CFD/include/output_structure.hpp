@@ -46,10 +46,14 @@
 #ifdef HAVE_TECIO
   #include "TECIO.h"
 #endif
+#ifdef HAVE_PTHREAD
+  #include <pthread.h>
+#endif
 #include <fstream>
 #include <cmath>
 #include <time.h>
 #include <fstream>
+#include <fcntl.h>
 
 #include "solver_structure.hpp"
 #include "integration_structure.hpp"
@@ -62,6 +66,100 @@
 
 using namespace std;
 
+/*!
+ * \class CAsyncRestart
+ * \brief Chunk of a binary restart file of this rank, written to disk by a background thread.
+ * \details The data is copied when the chunk is prepared, such that the solver can proceed
+ *          while the file is written. The segments are written with positioned writes, so the
+ *          ranks do not communicate and the writing does not use MPI.
+ */
+class CAsyncRestart {
+
+public:
+
+  string FileName;                  /*!< \brief Name of the restart file. */
+  unsigned long File_Size;          /*!< \brief Size of the complete file in bytes, only set on the master rank. */
+  vector<unsigned long> Offset;     /*!< \brief Position of each segment in the file. */
+  vector<vector<char> > Segment;    /*!< \brief Bytes of each segment. */
+  bool Error;                       /*!< \brief The writing of the file failed. */
+#ifdef HAVE_PTHREAD
+  pthread_t Thread;                 /*!< \brief Thread that writes the file. */
+#endif
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_filename - Name of the restart file.
+   * \param[in] val_file_size - Size of the complete file, zero if the file is not resized by this rank.
+   */
+  CAsyncRestart(string val_filename, unsigned long val_file_size);
+
+  /*!
+   * \brief Add a copy of a segment of the file.
+   * \param[in] val_offset - Position of the segment in the file.
+   * \param[in] val_data - Bytes of the segment.
+   * \param[in] val_size - Number of bytes.
+   */
+  void AddSegment(unsigned long val_offset, const void *val_data, unsigned long val_size);
+
+  /*!
+   * \brief Write the segments to the file.
+   */
+  void Write(void);
+
+};
+
+/*!
+ * \struct CInSituData
+ * \brief Views of the sorted output data and the linearly partitioned connectivity of one rank.
+ * \details Nothing is copied: the arrays belong to COutput and are only valid inside
+ *          CInSituAdaptor::Execute. The points of this rank are the global points
+ *          PointOffset to PointOffset+nPoint-1, the connectivity uses 1-based global point
+ *          indices (the numbering of the parallel file writers).
+ */
+struct CInSituData {
+
+  static const unsigned short nElemType = 6;  /*!< \brief Number of volume element types. */
+
+  unsigned short iZone;               /*!< \brief Zone of the data. */
+  unsigned long iExtIter;             /*!< \brief External (time) iteration. */
+  su2double Time;                     /*!< \brief Physical time for unsteady problems. */
+  unsigned short nDim;                /*!< \brief Number of dimensions, the first nDim variables are the coordinates. */
+  unsigned short nVar;                /*!< \brief Number of variables of every point. */
+  const vector<string> *Variable_Names; /*!< \brief Names of the variables. */
+  su2double **Data;                   /*!< \brief Data[iVar][iPoint] of the points of this rank. */
+  unsigned long nPoint,               /*!< \brief Number of points of this rank. */
+  nGlobalPoint,                       /*!< \brief Global number of points. */
+  PointOffset;                        /*!< \brief Global index of the first point of this rank. */
+  unsigned short ElemType[nElemType]; /*!< \brief VTK type of each element type (TRIANGLE, ..., PYRAMID). */
+  unsigned short nNodeElem[nElemType];/*!< \brief Number of nodes of each element type. */
+  unsigned long nElem[nElemType];     /*!< \brief Number of elements of each type of this rank. */
+  int *Conn[nElemType];               /*!< \brief Connectivity of each element type of this rank. */
+
+};
+
+/*!
+ * \class CInSituAdaptor
+ * \brief Interface of an in-situ visualization or analysis library (or a streaming transport).
+ * \details An adaptor is registered by the application rather than owned by SU2. With
+ *          OUTPUT_FORMAT= INSITU it is called on all ranks instead of writing volume files.
+ */
+class CInSituAdaptor {
+
+public:
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  virtual ~CInSituAdaptor(void) {}
+
+  /*!
+   * \brief Process the output data of this rank, collective over all ranks.
+   * \param[in] data - Views of the output data, only valid during the call.
+   */
+  virtual void Execute(const CInSituData &data) = 0;
+
+};
+
 /*! 
  * \class COutput
  * \brief Class for writing the flow, adjoint and linearized solver 
@@ -121,6 +219,12 @@ class COutput {
   int *Conn_Pris_Par;
   int *Conn_Pyra_Par;
 
+  CGeometry *Conn_Cache_Geometry;   // Geometry of the sorted connectivity that is kept between the outputs
+  bool Conn_Cache_Vol, Conn_Cache_Surf;
+  int *Conn_BoundLine_Cache;        // Sorted surface connectivity before the renumbering for output
+  int *Conn_BoundTria_Cache;
+  int *Conn_BoundQuad_Cache;
+
   unsigned long nGlobalPoint_Sort;
   unsigned long nLocalPoint_Sort;
   unsigned long nPoint_Restart;
@@ -139,6 +243,16 @@ class COutput {
   su2double **Parallel_Surf_Data;   // node i (x, y, z) = (Coords[0][i], Coords[1][i], Coords[2][i])
   vector<string> Variable_Names;
 
+  vector<CAsyncRestart*> Async_Restart;   // Restart files being written by background threads
+  CInSituAdaptor *InSitu_Adaptor;         // In-situ adaptor registered by the application (not owned)
+  unsigned long nHistory_Buffered;        // History lines written since the history file was flushed
+
+  vector<bool> SrfHist_Init;                     // Surface history file of the zone created
+  vector<vector<unsigned long> > SrfHist_Point;  // Local points of the zone written to the surface history
+  vector<unsigned long> SrfHist_nGlobal,         // Global number of points in the surface history of the zone
+  SrfHist_Offset,                                // Position of the points of this rank in each record
+  SrfHist_nRecord;                               // Number of time records written to the surface history
+
   su2double **Data;
   unsigned short nVar_Consv, nVar_Total, nVar_Extra, nZones;
   bool wrote_surf_file, wrote_CGNS_base, wrote_Tecplot_base, wrote_Paraview_base;
@@ -260,6 +374,17 @@ public:
   void SetBaselineResult_Files(CSolver ***solver, CGeometry ***geometry, CConfig **config,
                                unsigned long iExtIter, unsigned short val_nZone);
 
+  /*!
+   * \brief Write the volume and surface files of the baseline solver (SU2_SOL) with the parallel writers.
+   * \param[in] solver - Baseline solver with the restart data.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   */
+  void SetBaselineResult_Files_Parallel(CSolver *solver, CGeometry *geometry, CConfig *config,
+                                        unsigned short val_iZone, unsigned short val_nZone);
+
   /*!
    * \brief Writes and organizes the all the output files, except the history one, for DG-FEM simulations (SU2_SOL).
    * \param[in] solver_container - Container vector with all the solutions.
@@ -503,6 +628,27 @@ public:
    */
   void WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst);
 
+  /*!
+   * \brief Write a compact native SU2 restart file (binary) in parallel: selected fields, with the
+   *        non-solution fields in single precision or quantized. It is read transparently by the solvers.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Flow solution.
+   * \param[in] val_iZone - iZone index.
+   */
+  void WriteRestart_Parallel_Compact(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst);
+
+  /*!
+   * \brief Start the background writing of the chunk of a restart file (WRT_ASYNC_RESTART).
+   * \param[in] job - Chunk of the restart file of this rank, owned by the output from now on.
+   */
+  void Start_Async_Restart(CAsyncRestart *job);
+
+  /*!
+   * \brief Wait for the restart files being written in the background, the files are complete on return.
+   */
+  void Wait_Async_Restart(void);
+
   /*!
    * \brief Write the x, y, & z coordinates to a CGNS output file.
    * \param[in] config - Definition of the particular problem.
@@ -564,6 +710,38 @@ public:
    * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
    */
   void WriteParaViewBinary_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+
+  /*!
+   * \brief Write an XDMF solution file (XML description and raw binary data) with parallel output.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
+   */
+  void WriteXDMF_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, bool surf_sol);
+
+  /*!
+   * \brief Hand the sorted volume data and connectivity to the registered in-situ adaptor.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] iExtIter - Current external (time) iteration.
+   * \param[in] val_iZone - Current zone.
+   */
+  void WriteInSitu_Parallel(CConfig *config, CGeometry *geometry, unsigned long iExtIter, unsigned short val_iZone);
+
+  /*!
+   * \brief Register the adaptor used with OUTPUT_FORMAT= INSITU.
+   * \param[in] adaptor - In-situ adaptor, it is not deleted by COutput.
+   */
+  void SetInSitu_Adaptor(CInSituAdaptor *adaptor);
+
+  /*!
+   * \brief Count a line written to the history file and decide whether the file is flushed.
+   * \param[in] config - Definition of the particular problem.
+   * \return <code>TRUE</code> every HISTORY_FLUSH_FREQ lines.
+   */
+  bool Flush_History(CConfig *config);
   
   /*!
    * \brief Write a Tecplot ASCII solution file.
@@ -615,6 +793,18 @@ public:
    */
   void WriteTecplotASCII_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, unsigned short val_iInst, unsigned short val_nInst, bool surf_sol);
   
+  /*!
+   * \brief Write the solution data and connectivity to a Tecplot binary (.szplt) file in parallel.
+   *        With MPI every rank writes its sorted partition of the zone through TecIO-MPI, the nodes
+   *        of its elements owned by other ranks are ghost nodes of the partition.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_iZone - Current zone.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] surf_sol - Flag controlling whether this is a volume or surface file.
+   */
+  void WriteTecplotBinary_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, unsigned short val_iInst, unsigned short val_nInst, bool surf_sol);
+  
   /*!
    * \brief Write the nodal coordinates and connectivity to a Tecplot binary mesh file.
    * \param[in] config - Definition of the particular problem.
@@ -784,6 +974,14 @@ public:
    * \param[in] val_nZone - iZone index.
    */
   void SetCFL_Number(CSolver *****solver_container, CConfig **config, unsigned short val_iZone);
+
+  /*!
+   * \brief Write the derivatives of the aerodynamic coefficients in each tangent direction of the direct differentiation.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iZone - Current zone.
+   */
+  void SetDirectDiff_Directions(CSolver *****solver_container, CConfig **config, unsigned short val_iZone);
   
   /*!
    * \brief Write the sensitivity (including mesh sensitivity) computed with the discrete adjoint method
@@ -874,6 +1072,17 @@ public:
   void SetSpecial_Output(CSolver *****solver_container, CGeometry ****geometry, CConfig **config,
                          unsigned long iExtIter, unsigned short val_nZone);
 
+  /*!
+   * \brief Append the pressure on the plotting markers to the surface history file of unsteady problems.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iExtIter - Current external (time) iteration.
+   * \param[in] val_nZone - Total number of domains in the grid file.
+   */
+  void SetSurface_History(CSolver *****solver_container, CGeometry ****geometry, CConfig **config,
+                          unsigned long iExtIter, unsigned short val_nZone);
+
   /*!
    * \brief Load the desired solution data into a structure used for parallel reordering and output file writing for flow problems.
    * \param[in] config - Definition of the particular problem.
@@ -919,6 +1128,15 @@ public:
    */
   void LoadLocalData_Base(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone);
 
+  /*!
+   * \brief Load the restart data of the baseline solver (SU2_SOL) into the structure used for parallel reordering and output file writing.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver - Baseline solver with the restart data.
+   * \param[in] val_iZone - iZone index.
+   */
+  void LoadLocalData_Baseline(CConfig *config, CGeometry *geometry, CSolver *solver, unsigned short val_iZone);
+
   /*!
    * \brief Load the desired solution data into a structure used for parallel reordering and output file writing for DG-FEM flow problems.
    * \param[in] config - Definition of the particular problem.
@@ -1017,6 +1235,12 @@ public:
    * \param[in] geometry - Geometrical definition of the problem.
    */
   void DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geometry, bool surf_sol);
+
+  /*!
+   * \brief Deallocate the sorted connectivity that is kept between the outputs, it is sorted again at the next output.
+   * \note To be called when the elements of the mesh change, e.g. after an adaptation.
+   */
+  void DeallocateConnectivity_Cache(void);
   
   /*!
    * \brief Deallocate temporary memory needed for merging and writing output data in parallel.
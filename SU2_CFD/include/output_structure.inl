@@ -43,4 +43,8 @@ inline su2double COutput::GetFlowAngleOut(unsigned short iMarkerTP, unsigned sho
 
 inline su2double COutput::GetMassFlowIn(unsigned short iMarkerTP, unsigned short iSpan) { return MassFlowIn[iMarkerTP][iSpan]; }
 
-inline bool COutput::PrintOutput(unsigned long iIter, unsigned long iFreq) { return (iIter % iFreq == 0); }
\ No newline at end of file
+inline bool COutput::PrintOutput(unsigned long iIter, unsigned long iFreq) { return (iIter % iFreq == 0); }
+
+inline void COutput::SetInSitu_Adaptor(CInSituAdaptor *adaptor) { InSitu_Adaptor = adaptor; }
+
+inline bool COutput::Flush_History(CConfig *config) { return (++nHistory_Buffered % config->GetHistory_Flush_Freq() == 0); }
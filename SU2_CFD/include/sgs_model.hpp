@@ -109,6 +109,44 @@ public:
                                             const su2double lenScale,
                                             const su2double distToWall);
 
+  /*!
+   * \brief Virtual function to determine the eddy viscosity in a chunk of
+            integration points for a 2D simulation. The base class
+            calls the single point version for every integration point.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dvdx, dvdy, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  virtual void ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                            const su2double     *rho,
+                                            const su2double     *velGrad,
+                                            const su2double     *lenScale,
+                                            const su2double     *distToWall,
+                                                  su2double     *eddyVisc);
+
+  /*!
+   * \brief Virtual function to determine the eddy viscosity in a chunk of
+            integration points for a 3D simulation. The base class
+            calls the single point version for every integration point.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dudz, dvdx, ..., dwdz, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  virtual void ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                            const su2double     *rho,
+                                            const su2double     *velGrad,
+                                            const su2double     *lenScale,
+                                            const su2double     *distToWall,
+                                                  su2double     *eddyVisc);
+
   /*!
    * \brief Virtual function to determine the gradients of the eddy viscosity
             for the given function arguments for a 2D simulation.
@@ -413,6 +451,44 @@ public:
                                          su2double &dMuTdx,
                                          su2double &dMuTdy,
                                          su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 2D simulation. The single point
+            function of the Smagorinsky model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dvdx, dvdy, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 3D simulation. The single point
+            function of the Smagorinsky model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dudz, dvdx, ..., dwdz, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
 };
 
 /*!
@@ -601,6 +677,44 @@ public:
                                          su2double &dMuTdx,
                                          su2double &dMuTdy,
                                          su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 2D simulation. The single point
+            function of the WALE model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dvdx, dvdy, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 3D simulation. The single point
+            function of the WALE model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dudz, dvdx, ..., dwdz, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
 };
 
 /*!
@@ -789,5 +903,43 @@ public:
                                    su2double &dMuTdx,
                                    su2double &dMuTdy,
                                    su2double &dMuTdz);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 2D simulation. The single point
+            function of the Vreman model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dvdx, dvdy, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
+
+  /*!
+   * \brief Function to determine the eddy viscosity in a chunk of
+            integration points for a 3D simulation. The single point
+            function of the Vreman model is inlined in the loop.
+   * \param[in]  nItems     - Number of integration points in the chunk.
+   * \param[in]  rho        - Density in the integration points.
+   * \param[in]  velGrad    - Velocity gradients, stored per component for all integration
+                              points: dudx, dudy, dudz, dvdx, ..., dwdz, each with nItems entries.
+   * \param[in]  lenScale   - Length scale of the element of every integration point.
+   * \param[in]  distToWall - Distance to the nearest wall of every integration point.
+   * \param[out] eddyVisc   - Eddy viscosity in the integration points.
+   */
+  void ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                    const su2double     *rho,
+                                    const su2double     *velGrad,
+                                    const su2double     *lenScale,
+                                    const su2double     *distToWall,
+                                          su2double     *eddyVisc);
 };
 #include "sgs_model.inl"
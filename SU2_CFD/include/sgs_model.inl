@@ -120,6 +120,37 @@ inline void CSGSModel::ComputeGradEddyViscosity_3D(const su2double rho,
   dMuTdx = dMuTdy = dMuTdz = 0.0;
 }
 
+inline void CSGSModel::ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                                    const su2double     *rho,
+                                                    const su2double     *velGrad,
+                                                    const su2double     *lenScale,
+                                                    const su2double     *distToWall,
+                                                          su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems;
+  const su2double *dvdx = dudy  + nItems, *dvdy = dvdx + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = ComputeEddyViscosity_2D(rho[i], dudx[i], dudy[i], dvdx[i], dvdy[i],
+                                          lenScale[i], distToWall[i]);
+}
+
+inline void CSGSModel::ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                                    const su2double     *rho,
+                                                    const su2double     *velGrad,
+                                                    const su2double     *lenScale,
+                                                    const su2double     *distToWall,
+                                                          su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems, *dudz = dudy + nItems;
+  const su2double *dvdx = dudz  + nItems, *dvdy = dvdx + nItems, *dvdz = dvdy + nItems;
+  const su2double *dwdx = dvdz  + nItems, *dwdy = dwdx + nItems, *dwdz = dwdy + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = ComputeEddyViscosity_3D(rho[i], dudx[i], dudy[i], dudz[i],
+                                          dvdx[i], dvdy[i], dvdz[i],
+                                          dwdx[i], dwdy[i], dwdz[i],
+                                          lenScale[i], distToWall[i]);
+}
+
 inline CSmagorinskyModel::CSmagorinskyModel(void) : CSGSModel() {
   const_smag  = 0.1;
   filter_mult = 2.0;
@@ -241,6 +272,37 @@ inline void CSmagorinskyModel::ComputeGradEddyViscosity_3D(const su2double rho,
   exit(1);
 }
 
+inline void CSmagorinskyModel::ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                                            const su2double     *rho,
+                                                            const su2double     *velGrad,
+                                                            const su2double     *lenScale,
+                                                            const su2double     *distToWall,
+                                                                  su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems;
+  const su2double *dvdx = dudy  + nItems, *dvdy = dvdx + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CSmagorinskyModel::ComputeEddyViscosity_2D(rho[i], dudx[i], dudy[i], dvdx[i], dvdy[i],
+                                                             lenScale[i], distToWall[i]);
+}
+
+inline void CSmagorinskyModel::ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                                            const su2double     *rho,
+                                                            const su2double     *velGrad,
+                                                            const su2double     *lenScale,
+                                                            const su2double     *distToWall,
+                                                                  su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems, *dudz = dudy + nItems;
+  const su2double *dvdx = dudz  + nItems, *dvdy = dvdx + nItems, *dvdz = dvdy + nItems;
+  const su2double *dwdx = dvdz  + nItems, *dwdy = dwdx + nItems, *dwdz = dwdy + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CSmagorinskyModel::ComputeEddyViscosity_3D(rho[i], dudx[i], dudy[i], dudz[i],
+                                                             dvdx[i], dvdy[i], dvdz[i],
+                                                             dwdx[i], dwdy[i], dwdz[i],
+                                                             lenScale[i], distToWall[i]);
+}
+
 inline CWALEModel::CWALEModel(void) : CSGSModel() {
   const_WALE = 0.325;
 }
@@ -413,6 +475,37 @@ inline void CWALEModel::ComputeGradEddyViscosity_3D(const su2double rho,
   exit(1);
 }
 
+inline void CWALEModel::ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                                     const su2double     *rho,
+                                                     const su2double     *velGrad,
+                                                     const su2double     *lenScale,
+                                                     const su2double     *distToWall,
+                                                           su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems;
+  const su2double *dvdx = dudy  + nItems, *dvdy = dvdx + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CWALEModel::ComputeEddyViscosity_2D(rho[i], dudx[i], dudy[i], dvdx[i], dvdy[i],
+                                                      lenScale[i], distToWall[i]);
+}
+
+inline void CWALEModel::ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                                     const su2double     *rho,
+                                                     const su2double     *velGrad,
+                                                     const su2double     *lenScale,
+                                                     const su2double     *distToWall,
+                                                           su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems, *dudz = dudy + nItems;
+  const su2double *dvdx = dudz  + nItems, *dvdy = dvdx + nItems, *dvdz = dvdy + nItems;
+  const su2double *dwdx = dvdz  + nItems, *dwdy = dwdx + nItems, *dwdz = dwdy + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CWALEModel::ComputeEddyViscosity_3D(rho[i], dudx[i], dudy[i], dudz[i],
+                                                      dvdx[i], dvdy[i], dvdz[i],
+                                                      dwdx[i], dwdy[i], dwdz[i],
+                                                      lenScale[i], distToWall[i]);
+}
+
 inline CVremanModel::CVremanModel(void) : CSGSModel() {
   
   /* const_Vreman = 2.5*Cs*Cs where Cs is the Smagorinsky constant */
@@ -543,3 +636,34 @@ inline void CVremanModel::ComputeGradEddyViscosity_3D(const su2double rho,
   cout << "CWALEModel::ComputeGradEddyViscosity_3D: Not implemented yet" << endl;
   exit(1);
 }
+
+inline void CVremanModel::ComputeEddyViscosityChunk_2D(const unsigned long nItems,
+                                                       const su2double     *rho,
+                                                       const su2double     *velGrad,
+                                                       const su2double     *lenScale,
+                                                       const su2double     *distToWall,
+                                                             su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems;
+  const su2double *dvdx = dudy  + nItems, *dvdy = dvdx + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CVremanModel::ComputeEddyViscosity_2D(rho[i], dudx[i], dudy[i], dvdx[i], dvdy[i],
+                                                        lenScale[i], distToWall[i]);
+}
+
+inline void CVremanModel::ComputeEddyViscosityChunk_3D(const unsigned long nItems,
+                                                       const su2double     *rho,
+                                                       const su2double     *velGrad,
+                                                       const su2double     *lenScale,
+                                                       const su2double     *distToWall,
+                                                             su2double     *eddyVisc) {
+  const su2double *dudx = velGrad,        *dudy = dudx + nItems, *dudz = dudy + nItems;
+  const su2double *dvdx = dudz  + nItems, *dvdy = dvdx + nItems, *dvdz = dvdy + nItems;
+  const su2double *dwdx = dvdz  + nItems, *dwdy = dwdx + nItems, *dwdz = dwdy + nItems;
+
+  for(unsigned long i=0; i<nItems; ++i)
+    eddyVisc[i] = CVremanModel::ComputeEddyViscosity_3D(rho[i], dudx[i], dudy[i], dudz[i],
+                                                        dvdx[i], dvdy[i], dvdz[i],
+                                                        dwdx[i], dwdy[i], dwdz[i],
+                                                        lenScale[i], distToWall[i]);
+}
@@ -54,6 +54,7 @@
 
 #include "fluid_model.hpp"
 #include "task_definition.hpp"
+#include "../../Common/include/task_thread_pool.hpp"
 #include "numerics_structure.hpp"
 #include "sgs_model.hpp"
 #include "variable_structure.hpp"
@@ -68,6 +69,7 @@
 #include "../../Common/include/grid_movement_structure.hpp"
 #include "../../Common/include/blas_structure.hpp"
 #include "../../Common/include/graph_coloring_structure.hpp"
+#include "../../Common/include/reproducible_sum.hpp"
 
 using namespace std;
 
@@ -82,6 +84,31 @@ protected:
   int rank, 	/*!< \brief MPI Rank. */
   size;       	/*!< \brief MPI Size. */
   unsigned short IterLinSolver;  /*!< \brief Linear solver iterations. */
+  su2double ResLinSolver;        /*!< \brief Residual reduction reached by the linear solver. */
+  unsigned short Jacobian_Age;   /*!< \brief Nonlinear iterations since the last assembly of the Jacobian. */
+  unsigned long Jacobian_LinIter;  /*!< \brief Linear iterations of the first solve with the last assembled Jacobian. */
+  su2double Jacobian_LinRes;     /*!< \brief Relative residual of the first solve with the last assembled Jacobian. */
+  bool Jacobian_Refresh;         /*!< \brief Force the assembly of the Jacobian at the next iteration. */
+  bool SensSmooth_Ready;         /*!< \brief The sparsity of StiffMatrix is set up for the sensitivity smoothing. */
+  bool Local_Freezing;           /*!< \brief Only the active points are updated in this iteration (LOCAL_FREEZING). */
+  vector<bool> Point_Active;     /*!< \brief Points updated between the sweeps of the entire domain. */
+  vector<su2double> Point_Residual;        /*!< \brief Residual norm of each point in the last sweep of the entire domain. */
+  vector<unsigned long> Active_Edge;       /*!< \brief Edges with at least one active point, color by color. */
+  vector<unsigned long> Active_Edge_Begin; /*!< \brief Start of each color in Active_Edge, cumulative storage format. */
+  vector<unsigned long> Active_Edge_End;   /*!< \brief End of each color in Active_Edge. */
+  bool Edge_Subset;              /*!< \brief The edge loops only visit the edges of Active_Edge. */
+  unsigned short Multirate_nLevel;         /*!< \brief Number of time levels in use by the multirate time stepping. */
+  su2double Multirate_Delta_Time;          /*!< \brief Time step of the lowest level of the multirate time stepping. */
+  vector<unsigned short> Multirate_Level;  /*!< \brief Time level of each point, including the halos. */
+  vector<unsigned long> Multirate_Edge_Begin; /*!< \brief Start of the edges of each color and level in Active_Edge. */
+  vector<bool> Multirate_Wall;             /*!< \brief Points whose velocity is imposed strongly (no-slip walls). */
+  vector<su2double> Multirate_Res;         /*!< \brief Residual integrated over the current time step of each point. */
+  vector<su2double> Res_Smooth;            /*!< \brief Smoothed residual of the implicit residual smoothing, variable by variable. */
+  vector<su2double> Res_Smooth_Old;        /*!< \brief Residual before the implicit residual smoothing, variable by variable. */
+  vector<su2double> Res_Smooth_Sum;        /*!< \brief Sum of the neighbor residuals in a sweep of the implicit residual smoothing. */
+  vector<su2double> Res_Smooth_Diag;       /*!< \brief Inverse diagonal of the implicit residual smoothing operator. */
+  vector<unsigned long> Res_Smooth_Edge;   /*!< \brief Points of the edges, in the order of the residual smoothing sweeps. */
+  vector<unsigned long> Res_Smooth_Wall;   /*!< \brief Points whose velocity residual is removed by the no-slip condition. */
   unsigned short nVar,          /*!< \brief Number of variables of the problem. */
   nPrimVar,                     /*!< \brief Number of primitive variables of the problem. */
   nPrimVarGrad,                 /*!< \brief Number of primitive variables of the problem in the gradient computation. */
@@ -93,11 +120,12 @@ protected:
   unsigned long nPointDomain;   /*!< \brief Number of points of the computational grid. */
   su2double Max_Delta_Time,  /*!< \brief Maximum value of the delta time for all the control volumes. */
   Min_Delta_Time;          /*!< \brief Minimum value of the delta time for all the control volumes. */
-  su2double *Residual_RMS,  /*!< \brief Vector with the mean residual for each variable. */
-  *Residual_Max,        /*!< \brief Vector with the maximal residual for each variable. */
+  accumdouble *Residual_RMS;  /*!< \brief Vector with the mean residual for each variable. */
+  su2double *Residual_Max,    /*!< \brief Vector with the maximal residual for each variable. */
   *Residual,            /*!< \brief Auxiliary nVar vector. */
   *Residual_i,          /*!< \brief Auxiliary nVar vector for storing the residual at point i. */
   *Residual_j;          /*!< \brief Auxiliary nVar vector for storing the residual at point j. */
+  CReproducibleSum *Residual_RMS_Sum; /*!< \brief Exact sums of the mean residuals (REPRODUCIBLE_REDUCTIONS). */
   su2double *Residual_BGS,  /*!< \brief Vector with the mean residual for each variable for BGS subiterations. */
   *Residual_Max_BGS;        /*!< \brief Vector with the maximal residual for each variable for BGS subiterations. */
   unsigned long *Point_Max; /*!< \brief Vector with the maximal residual for each variable. */
@@ -140,12 +168,28 @@ protected:
   unsigned long *nCol_InletFile;       /*!< \brief Auxiliary structure for holding the number of columns for a particular marker in an inlet profile file. */
   passivedouble *Inlet_Data; /*!< \brief Auxiliary structure for holding the data values from an inlet profile file. */
 
+  bool Periodic_Vector_Rotation; /*!< \brief The components 1 to nDim of the (primitive) solution form a vector that is rotated across periodic boundaries. */
+
+  CMatrixVectorProduct *JacobianFree_Product; /*!< \brief Jacobian-free product for the implicit system, NULL if the Jacobian is used. */
+
+  unsigned long nTimeAvg_Samples; /*!< \brief Number of time steps in the running flow statistics. */
+  su2double *TimeAvg;             /*!< \brief Running means and second moments of the flow variables, GetnTimeAverage_Var per point. */
+
+  unsigned short nMarker_ForceCache; /*!< \brief Number of markers in the surface force cache. */
+  unsigned long *nVertex_ForceCache; /*!< \brief Number of owned vertices of each monitored marker in the surface force cache. */
+  unsigned long **Vertex_ForceCache; /*!< \brief Vertex index of the owned vertices of each monitored marker. */
+  unsigned long **Point_ForceCache;  /*!< \brief Point index of the owned vertices of each monitored marker. */
+  su2double **Normal_ForceCache;     /*!< \brief Contiguous normals (nDim per vertex) of the owned vertices of each monitored marker. */
+  su2double **Coord_ForceCache;      /*!< \brief Contiguous coordinates (nDim per vertex) of the owned vertices of each monitored marker. */
+  bool Dynamic_ForceCache;           /*!< \brief The normals and coordinates of the cache are refreshed at every force evaluation. */
+
 public:
   
   CSysVector LinSysSol;    /*!< \brief vector to store iterative solution of implicit linear system. */
   CSysVector LinSysRes;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysVector LinSysAux;    /*!< \brief vector to store iterative residual of implicit linear system. */
   CSysMatrix Jacobian; /*!< \brief Complete sparse Jacobian structure for implicit computations. */
+  CSysSolve System;    /*!< \brief Linear solver of the implicit iterations, it keeps the space recycled by GCRO-DR. */
   
   CSysMatrix StiffMatrix; /*!< \brief Sparse structure for storing the stiffness matrix in Galerkin computations, and grid movement. */
   
@@ -171,6 +215,169 @@ public:
    */
   void SetIterLinSolver(unsigned short val_iterlinsolver);
   
+  /*!
+   * \brief Set the residual reduction reached by the linear solver.
+   * \param[in] val_reslinsolver - Final residual relative to the right hand side.
+   */
+  void SetResLinSolver(su2double val_reslinsolver);
+  
+  /*!
+   * \brief Set the Jacobian-free product used by the Krylov solver of the implicit iteration.
+   * \param[in] val_product - Matrix-vector product, NULL to use the Jacobian.
+   */
+  void SetJacobianFree_Product(CMatrixVectorProduct *val_product);
+  
+  /*!
+   * \brief Decide whether the Jacobian is assembled at this iteration (JACOBIAN_LAG), otherwise it is
+   *        frozen and the matrix and preconditioner of the last assembly are reused. Call before SetValZero.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetJacobian_Lag(CConfig *config);
+  
+  /*!
+   * \brief Request an early assembly of a frozen Jacobian when the linear solver stalls on it.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_iter - Linear iterations of the last solve.
+   * \param[in] val_res_rel - Residual of the last solve relative to the right hand side.
+   */
+  void CheckJacobian_Lag(CConfig *config, unsigned long val_iter, su2double val_res_rel);
+  
+  /*!
+   * \brief Update the local freezing after an implicit iteration. After a sweep of the entire domain the points
+   *        whose residual (Point_Residual) is small relative to the largest one are frozen, and the edges with
+   *        an active point are compacted color by color. Decides whether the next iteration is a full sweep.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetLocal_Freezing(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Get whether a point is updated in this iteration.
+   * \param[in] val_point - Index of the point.
+   * \return <code>FALSE</code> if the point is frozen.
+   */
+  bool GetPoint_Active(unsigned long val_point);
+  
+  /*!
+   * \brief Start of a color in the edge loop of this iteration (all the edges, or the edges with an active point).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_color - Color.
+   * \return Position of the first edge of the color.
+   */
+  unsigned long GetEdgeLoop_Begin(CGeometry *geometry, unsigned short val_color);
+  
+  /*!
+   * \brief End of a color in the edge loop of this iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_color - Color.
+   * \return Position after the last edge of the color.
+   */
+  unsigned long GetEdgeLoop_End(CGeometry *geometry, unsigned short val_color);
+  
+  /*!
+   * \brief Edge at a position of the edge loop of this iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_pos - Position in the loop.
+   * \return Index of the edge.
+   */
+  unsigned long GetEdgeLoop_Edge(CGeometry *geometry, unsigned long val_pos);
+  
+  /*!
+   * \brief Set the time levels of the multirate time stepping (LEVELS_TIME_ACCURATE_LTS). The level of a point
+   *        is the largest power of two such that its step, val_delta_time*2^level, does not exceed its local
+   *        time step, the level of an edge is the lowest level of its points. The edges are sorted by level
+   *        within each color.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_delta_time - Global (smallest) time step, the step of the lowest level.
+   */
+  void SetMultirate_Levels(CGeometry *geometry, CConfig *config, su2double val_delta_time);
+  
+  /*!
+   * \brief Get the number of substeps of the lowest level in one step of the multirate time stepping.
+   * \return Number of substeps, one if all the points are in the lowest level.
+   */
+  unsigned long GetMultirate_nSubStep(void);
+  
+  /*!
+   * \brief Get the number of time levels in use by the multirate time stepping.
+   * \return Number of levels.
+   */
+  unsigned short GetMultirate_nLevel(void);
+  
+  /*!
+   * \brief Prepare a residual evaluation of the multirate time stepping: clear the residual and restrict
+   *        the edge loops to the edges of one level, or to no edge at all for the boundary and source terms.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_level - Level of the edges, -1 for no edge, -2 to restore the loops over all the edges.
+   */
+  void SetMultirate_Pass(CGeometry *geometry, short val_level);
+  
+  /*!
+   * \brief Integrate the residual of a pass of the multirate time stepping in time. The fluxes of the edges
+   *        of a level are weighted with the step of the level, which keeps the scheme conservative across
+   *        levels; the boundary and source terms of a point are weighted with its own step at its start.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_level - Level of the edges of the pass, -1 for the boundary and source terms.
+   * \param[in] val_substep - Substep of the lowest level within the step.
+   */
+  void Multirate_Accumulate(CGeometry *geometry, short val_level, unsigned long val_substep);
+  
+  /*!
+   * \brief Update the points whose step ends with a substep of the multirate time stepping.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_substep - Substep of the lowest level within the step.
+   */
+  void Multirate_Update(CGeometry *geometry, CConfig *config, unsigned long val_substep);
+  
+  /*!
+   * \brief Central implicit residual smoothing of the explicit schemes: RES_SMOOTHING_ITER Jacobi sweeps of
+   *        (1 - RES_SMOOTHING_COEFF*Laplacian) R_smooth = R on the edges, including the multigrid forcing term.
+   *        The smoothed residual is stored in Res_Smooth, LinSysRes is left unchanged for the monitoring.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Smooth_Residual(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Add the current time step to the running means of density, velocity and pressure and
+   *        to their second moments (pressure variance and Reynolds stresses), with Welford's update.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Accumulate_TimeAverage(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Get the number of time steps in the running flow statistics.
+   * \return Number of samples, 0 if no statistics are accumulated.
+   */
+  unsigned long GetnTimeAverage_Samples(void);
+  
+  /*!
+   * \brief Get the number of flow statistics per point: the means of density, velocity and pressure,
+   *        the RMS of pressure and the nDim*(nDim+1)/2 Reynolds stresses.
+   * \param[in] val_nDim - Number of dimensions.
+   * \return Number of statistics per point.
+   */
+  unsigned short GetnTimeAverage_Var(unsigned short val_nDim);
+  
+  /*!
+   * \brief Get the flow statistics of a point, in the order given by GetnTimeAverage_Var.
+   * \param[in] val_point - Point of the grid.
+   * \param[out] val_stats - Means, RMS of pressure and Reynolds stresses (xx, xy, (xz), yy, (yz, zz)).
+   */
+  void GetTimeAverage(unsigned long val_point, su2double *val_stats);
+  
+  /*!
+   * \brief Restore the flow statistics from the restart data, with the number of samples read
+   *        by Read_SU2_Restart_Metadata. The statistics restart from zero when the restart file
+   *        does not hold them, and are kept when they were already restored by a previous call.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Load_TimeAverage_Restart(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Set number of linear solver iterations.
    * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -183,6 +390,25 @@ public:
    */
   virtual void Set_MPI_Primitive(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Pack a quantity of the halo senders and launch its non-blocking exchange with all
+   *        neighbors at once. Work that does not need the halo values may be done before
+   *        CompleteComms is called.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Quantity to be exchanged, see MPI_QUANTITIES.
+   */
+  void InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType);
+  
+  /*!
+   * \brief Complete the exchange launched with InitiateComms and store the received
+   *        values, including the periodic transformation, in the halo points.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] commType - Quantity to be exchanged, see MPI_QUANTITIES.
+   */
+  void CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType);
+  
   //  /*!
   //   * \brief Set number of linear solver iterations.
   //   * \param[in] val_iterlinsolver - Number of linear iterations.
@@ -194,6 +420,33 @@ public:
    * \param[in] val_iterlinsolver - Number of linear iterations.
    */
   void SetResidual_RMS(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Sum coefficients over all ranks with a single reduction.
+   * \param[in] nScalar - Number of scalar coefficients.
+   * \param[in,out] Scalar - Pointers to the scalar coefficients, replaced by their sum over all ranks.
+   * \param[in] nArray - Number of arrays of coefficients.
+   * \param[in,out] Array - Arrays of coefficients, replaced by their sum over all ranks.
+   * \param[in] nArray_Size - Number of entries of every array.
+   */
+  void SumCoefficients_AllRanks(unsigned short nScalar, su2double **Scalar,
+                                unsigned short nArray, su2double **Array,
+                                unsigned long nArray_Size);
+
+  /*!
+   * \brief Build the contiguous arrays of point indices, normals and coordinates of the owned vertices
+   *        of the monitored markers that are used by the surface force integration. The arrays are built
+   *        once for static grids; with grid movement, deformation or AD the normals and coordinates are
+   *        copied again at every call (the indices are kept).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetForce_Cache(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Release the surface force cache.
+   */
+  void DeleteForce_Cache(void);
 
   /*!
    * \brief Communicate the value of the max residual and RMS residual.
@@ -305,6 +558,12 @@ public:
    */
   unsigned short GetIterLinSolver(void);
   
+  /*!
+   * \brief Get the residual reduction reached by the linear solver.
+   * \return Final residual relative to the right hand side.
+   */
+  su2double GetResLinSolver(void);
+  
   /*!
    * \brief Get the value of the maximum delta time.
    * \return Value of the maximum delta time.
@@ -334,6 +593,16 @@ public:
    */
   unsigned short GetnVar(void);
   
+  /*!
+   * \brief Get the number of points of the grid that are owned by this rank.
+   */
+  unsigned long GetnPointDomain(void);
+  
+  /*!
+   * \brief Get the Jacobian of the implicit integration, allocated only if the solver is implicit.
+   */
+  CSysMatrix & GetJacobian(void);
+  
   /*!
    * \brief Get the number of variables of the problem.
    */
@@ -571,6 +840,26 @@ public:
    */
   void SetSolution_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Edge sweep of the Barth-Jespersen and Venkatakrishnan limiters. The projections of
+   *        all the variables of an edge are computed first, the limiter function is then a
+   *        loop over the variables without branches on the kind of limiter.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_kind - Kind of limiter (BARTH_JESPERSEN, VENKATAKRISHNAN or VENKATAKRISHNAN_WANG).
+   * \param[in] val_nVar - Number of limited variables.
+   * \param[in] val_primitive - Limit the primitive variables, otherwise the solution.
+   * \param[in] val_eps2 - Venkatakrishnan parameter of every variable, not used by Barth-Jespersen.
+   */
+  void SetEdge_Limiter(CGeometry *geometry, unsigned short val_kind, unsigned short val_nVar,
+                       bool val_primitive, const su2double *val_eps2);
+  
+  /*!
+   * \brief Kernel of SetEdge_Limiter for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void SetEdge_Limiter_Kernel(CGeometry *geometry, unsigned short val_kind, unsigned short val_nVar,
+                              bool val_primitive, const su2double *val_eps2);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -707,6 +996,29 @@ public:
   virtual void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Compute the upwind and viscous residuals. The default implementation calls
+   *        Upwind_Residual and Viscous_Residual, derived classes may fuse both edge loops.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the convective numerical method.
+   * \param[in] visc_numerics - Description of the viscous numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  virtual void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                       CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                                       unsigned short iRKStep);
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_numerics - Convective numerics of every thread, the first one is not used.
+   */
+  virtual void SetUp_EdgeThreads(CGeometry *geometry, CConfig *config, vector<CNumerics *> &val_numerics);
+  
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1336,6 +1648,16 @@ public:
   virtual void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                                       unsigned short iRKStep);
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  virtual void LowStorageRK_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                                      unsigned short iRKStep);
+
   /*!
    * \brief A virtual member.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -1721,7 +2043,10 @@ public:
   virtual void Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config);
   
   /*!
-   * \brief A virtual member.
+   * \brief Sobolev smoothing of the surface sensitivity, (M + eps*K) s_smooth = M s, with the lumped
+   *        mass M and the Laplace-Beltrami operator K of the solid wall surfaces (lines in 2D, triangles
+   *        and quadrilaterals in 3D). The system is assembled in StiffMatrix on the partitioned mesh and
+   *        solved in parallel with CG.
    * \param[in] geometry - Geometrical definition of the problem.
    * \param[in] solver_container - Container vector with all the solutions.
    * \param[in] numerics - Description of the numerical method.
@@ -3504,6 +3829,47 @@ public:
    */
   void Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename);
 
+  /*!
+   * \brief Read a compact native SU2 restart file, the stored fields are expanded to the full layout of the fields.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_filename - String name of the restart file.
+   */
+  void Read_SU2_Restart_Compact(CGeometry *geometry, CConfig *config, string val_filename);
+
+  /*!
+   * \brief Send the points read by each rank, a block of the linear partition of the restart file, to the ranks that own them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] Read_Data - Values of the points read by this rank.
+   * \param[in] nFields - Number of fields of each point.
+   * \param[in] nPoint_File - Number of points in the restart file.
+   * \param[in] val_filename - String name of the restart file.
+   */
+  void Redistribute_Restart_Data(CGeometry *geometry, passivedouble *Read_Data, int nFields, unsigned long nPoint_File, string val_filename);
+
+  /*!
+   * \brief Interpolate the points read by each rank, a block of the linear partition of a restart file of a different mesh, to the points owned by this rank.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Read_Data - Values of the points read by this rank, starting with the coordinates.
+   * \param[in] nFields - Number of fields of each point.
+   * \param[in] nPoint_File - Number of points in the restart file.
+   * \param[in] val_filename - String name of the restart file.
+   */
+  void Interpolate_Restart_Data(CGeometry *geometry, CConfig *config, passivedouble *Read_Data, int nFields, unsigned long nPoint_File, string val_filename);
+
+  /*!
+   * \brief Read the block of the linear partition of the elements of the mesh of a restart file of a different mesh, with the values of their nodes.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] Read_Data - Values of the points read by this rank, starting with the coordinates.
+   * \param[in] nFields - Number of fields of each point.
+   * \param[in] nPoint_File - Number of points in the restart file.
+   * \param[in] nNode_Max - Maximum number of nodes of the records.
+   * \param[out] Records - One record per element: VTK type, number of nodes and the fields of the nodes.
+   */
+  void Read_Restart_Donor_Elements(CConfig *config, passivedouble *Read_Data, int nFields, unsigned long nPoint_File,
+                                   unsigned short nNode_Max, vector<passivedouble> &Records);
+
   /*!
    * \brief Read the metadata from a native SU2 restart file (ASCII or binary).
    * \param[in] geometry - Geometrical definition of the problem.
@@ -4364,8 +4730,9 @@ public:
    * \param[in] solver - Solver container
    * \param[in] geometry - Geometrical definition.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_point - Index of the point.
    */
-  virtual void SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config);
+  virtual void SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config, unsigned long val_point);
 
 };
 
@@ -4702,6 +5069,8 @@ protected:
   
   su2double *iPoint_UndLapl,  /*!< \brief Auxiliary variable for the undivided Laplacians. */
   *jPoint_UndLapl;      /*!< \brief Auxiliary variable for the undivided Laplacians. */
+  bool Lambda_Ready,    /*!< \brief The max. eigenvalue (centered schemes) is up to date for the time step. */
+  Edge_Lambda_Ready;    /*!< \brief The edge part of the inviscid spectral radius was accumulated by the upwind residual. */
   su2double *SecondaryVar_i,  /*!< \brief Auxiliary vector for storing the solution at point i. */
   *SecondaryVar_j;      /*!< \brief Auxiliary vector for storing the solution at point j. */
   su2double *PrimVar_i,  /*!< \brief Auxiliary vector for storing the solution at point i. */
@@ -4723,6 +5092,12 @@ protected:
   *Secondary_i,        /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point i. */
   *Secondary_j;        /*!< \brief Auxiliary nPrimVar vector for storing the primitive at point j. */
   
+  su2double *BC_Normal,    /*!< \brief Auxiliary nDim vector for the normal of the boundary conditions. */
+  *BC_Velocity_i,          /*!< \brief Auxiliary nDim vector for the velocity at the boundary node. */
+  *BC_Velocity_b,          /*!< \brief Auxiliary nDim vector for the velocity of the boundary state. */
+  **BC_Jacobian_b,         /*!< \brief Auxiliary nVar x nVar matrix for the Jacobian of the boundary flux. */
+  **BC_DubDu;              /*!< \brief Auxiliary nVar x nVar matrix for the derivative of the boundary state. */
+  
   su2double Cauchy_Value,  /*!< \brief Summed value of the convergence indicator. */
   Cauchy_Func;      /*!< \brief Current value of the convergence indicator at one iteration. */
   unsigned short Cauchy_Counter;  /*!< \brief Number of elements of the Cauchy serial. */
@@ -4732,6 +5107,11 @@ protected:
   su2double AoA_old;  /*!< \brief Old value of the angle of attack (monitored). */
   unsigned long AoA_Counter;
   bool AoA_FD_Change;
+  su2double AoA_Newton_Prev,  /*!< \brief AoA (deg) of the previous Newton update of the fixed CL mode. */
+  CL_Newton_Prev,             /*!< \brief CL reached with AoA_Newton_Prev, for the secant estimate of dCL/dAlpha. */
+  dCL_dAlpha_Newton,          /*!< \brief Secant estimate of dCL/dAlpha (1/deg) of the fixed CL mode. */
+  Res_Newton_Max;             /*!< \brief Maximum log10 of the density residual since the last update of the AoA. */
+  unsigned long Iter_Newton_AoA;  /*!< \brief Iteration of the last update of the AoA. */
   unsigned long BCThrust_Counter;
   unsigned short nSpanWiseSections;  /*!< \brief Number of span-wise sections. */
   unsigned short nSpanMax; /*!< \brief Max number of maximum span-wise sections for all zones */
@@ -4784,6 +5164,99 @@ protected:
   su2double ****SlidingState;
   int **SlidingStateNodes;
 
+  /*!
+   * \brief Primitive variables of a point. The nodes of the flow solvers are CEulerVariable (or
+   *        derived from it), the getter is called with its qualified name to avoid the virtual
+   *        call of CVariable, such that it is inlined in the edge loops.
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the primitive variables of the point.
+   */
+  su2double *GetNode_Primitive(unsigned long iPoint);
+
+  /*!
+   * \brief Gradient of the primitive variables of a point, without virtual call (see GetNode_Primitive).
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the gradient of the primitive variables of the point.
+   */
+  su2double **GetNode_Gradient_Primitive(unsigned long iPoint);
+
+  /*!
+   * \brief Limiter of the primitive variables of a point, without virtual call (see GetNode_Primitive).
+   * \param[in] iPoint - Index of the point.
+   * \return Pointer to the limiter of the primitive variables of the point.
+   */
+  su2double *GetNode_Limiter_Primitive(unsigned long iPoint);
+
+  /*!
+   * \brief Kind of edge loop carried out by the chunks of the pool of threads.
+   */
+  enum EDGE_LOOP_KIND {
+    EDGE_CENTERED_RESIDUAL = 0,  /*!< \brief Convective residual of a centered scheme. */
+    EDGE_UPWIND_RESIDUAL   = 1   /*!< \brief Convective residual of an upwind scheme. */
+  };
+
+  CTaskThreadPool *taskThreadPool;                 /*!< \brief Pool of threads to carry out the convective edge loops color by color. NULL
+                                                                if the edges are traversed by one thread. */
+  vector<unsigned long> EdgeColorChunks;           /*!< \brief Bounds of the chunks of the color that is being carried out. */
+  vector<CNumerics *>   numerics_Threads;          /*!< \brief Convective numerics of the threads. The first one is the numerics
+                                                                passed by the integration. */
+  vector<su2double *>   Res_Conv_Threads;          /*!< \brief Convective residual of every thread, the first one is Res_Conv. */
+  vector<su2double **>  Jacobian_i_Threads;        /*!< \brief Jacobian of point i of every thread, the first one is Jacobian_i. */
+  vector<su2double **>  Jacobian_j_Threads;        /*!< \brief Jacobian of point j of every thread, the first one is Jacobian_j. */
+  vector<su2double *>   Primitive_i_Threads;       /*!< \brief Reconstructed primitive variables of point i of every thread. */
+  vector<su2double *>   Primitive_j_Threads;       /*!< \brief Reconstructed primitive variables of point j of every thread. */
+  vector<su2double *>   Secondary_i_Threads;       /*!< \brief Reconstructed secondary variables of point i of every thread. */
+  vector<su2double *>   Secondary_j_Threads;       /*!< \brief Reconstructed secondary variables of point j of every thread. */
+  vector<su2double *>   Vector_i_Threads;          /*!< \brief Half edge vector from point i of every thread. */
+  vector<su2double *>   Vector_j_Threads;          /*!< \brief Half edge vector from point j of every thread. */
+  vector<unsigned long> NonPhysical_Threads;       /*!< \brief Number of non-physical reconstructions found by every thread. */
+
+  unsigned short edgeLoopChunks;   /*!< \brief Kind of edge loop carried out by the chunks, see EDGE_LOOP_KIND. */
+  CGeometry *geometryChunks;       /*!< \brief Geometry used when carrying out the chunks. */
+  CConfig   *configChunks;         /*!< \brief Definition of the problem used when carrying out the chunks. */
+  unsigned short iMeshChunks;      /*!< \brief Grid level used when carrying out the chunks. */
+
+  /*!
+   * \brief Carry out a convective edge loop, color by color by the pool of threads if it is available.
+   * \param[in] val_loop - Kind of edge loop, see EDGE_LOOP_KIND.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   */
+  void Loop_Edges(unsigned short val_loop, CGeometry *geometry, CNumerics *numerics, CConfig *config, unsigned short iMesh);
+
+  /*!
+   * \brief Function called by the pool of threads to carry out a chunk of an edge color.
+   * \param[in] solver - The flow solver, cast to void.
+   * \param[in] chunk - Range of the edge loop.
+   */
+  static void ProcessTaskChunk_Flow(void *solver, const CTaskChunk &chunk);
+
+  /*!
+   * \brief Compute the centered convective residual of a range of the edge loop, which lies within one color.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_begin - First position in the edge loop.
+   * \param[in] val_end - Position past the last edge of the range.
+   * \param[in] iThread - Index of the thread, which determines the numerics and the work arrays.
+   */
+  void Centered_Residual_Range(CGeometry *geometry, CConfig *config, unsigned short iMesh,
+                               unsigned long val_begin, unsigned long val_end, unsigned short iThread);
+
+  /*!
+   * \brief Compute the upwind convective residual of a range of the edge loop, which lies within one color.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] val_begin - First position in the edge loop.
+   * \param[in] val_end - Position past the last edge of the range.
+   * \param[in] iThread - Index of the thread, which determines the numerics and the work arrays.
+   */
+  void Upwind_Residual_Range(CGeometry *geometry, CConfig *config, unsigned short iMesh,
+                             unsigned long val_begin, unsigned long val_end, unsigned short iThread);
+
 public:
   
   
@@ -4839,6 +5312,14 @@ public:
    */
   void Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Impose the send-receive boundary condition for the gradient and the limiter
+   *        of the primitive variables, packed in a single message.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
   //  /*!
   //   * \brief Impose the send-receive boundary condition.
   //   * \param[in] geometry - Geometrical definition of the problem.
@@ -4937,12 +5418,44 @@ public:
   void Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                        CConfig *config, unsigned short iMesh);
   
+  /*!
+   * \brief Create the pool of threads that carries out the colors of the convective edge loops on the finest
+   *        grid, with the numerics of the threads and their own work arrays.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_numerics - Convective numerics of every thread, the first one is not used.
+   */
+  void SetUp_EdgeThreads(CGeometry *geometry, CConfig *config, vector<CNumerics *> &val_numerics);
+  
   /*!
    * \brief Compute the extrapolated quantities, for MUSCL upwind 2nd reconstruction,
    * in a more thermodynamic consistent way
    * \param[in] config - Definition of the particular problem.
    */
   void ComputeConsExtrapolation(CConfig *config);
+  
+  /*!
+   * \brief Compute a batch of edges with the convective numerics, and update the residual and the Jacobian.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method, with the data of the batch.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nBatch - Number of edges in the batch.
+   * \param[in] val_edges - Edges of the batch.
+   * \param[in] val_residual - Work array for the residual of an edge.
+   */
+  void Batch_Residual(CGeometry *geometry, CNumerics *numerics, CConfig *config,
+                      unsigned short nBatch, unsigned long *val_edges, su2double *val_residual);
+  
+  /*!
+   * \brief Compute a batch of boundary vertices with the convective numerics (the data of the
+   *        boundary state is set as point j), and update the residual and the Jacobian of the nodes.
+   * \param[in] numerics - Description of the numerical method, with the data of the batch.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nBatch - Number of vertices in the batch.
+   * \param[in] val_points - Nodes of the vertices of the batch.
+   */
+  void Batch_Boundary_Residual(CNumerics *numerics, CConfig *config,
+                               unsigned short nBatch, unsigned long *val_points);
 
   /*!
    * \brief Source term integration.
@@ -5028,6 +5541,20 @@ public:
    */
   void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Green-Gauss gradient of the primitive variables on the domain points, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_bounds - Accumulate also the neighbor bounds of the limiter in the same edge loop.
+   */
+  void ComputePrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
+  /*!
+   * \brief Kernel of ComputePrimitive_Gradient_GG for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void ComputePrimitive_Gradient_GG_Kernel(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -5036,6 +5563,20 @@ public:
    */
   void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Least-Squares gradient of the primitive variables on the domain points, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_bounds - Accumulate also the neighbor bounds of the limiter in the same neighbor loop.
+   */
+  void ComputePrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
+  /*!
+   * \brief Kernel of ComputePrimitive_Gradient_LS for a fixed number of dimensions.
+   */
+  template<unsigned short NDIM>
+  void ComputePrimitive_Gradient_LS_Kernel(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -5051,6 +5592,28 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the gradient and the limiter of the primitive variables with a single
+   *        sweep for the gradient and the neighbor bounds, and a single halo exchange.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Initialize the neighbor bounds and the limiter of the primitive variables.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetPrimitive_Limiter_Init(CGeometry *geometry);
+  
+  /*!
+   * \brief Limiter of the primitive variables, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] val_bounds - The neighbor bounds were already computed with the gradient.
+   */
+  void ComputePrimitive_Limiter(CGeometry *geometry, CConfig *config, bool val_bounds);
+  
   /*!
    * \brief Compute the preconditioner for convergence acceleration by Roe-Turkel method.
    * \param[in] iPoint - Index of the grid point
@@ -5072,6 +5635,22 @@ public:
    */
   void Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the undivided laplacian and the pressure sensor of the JST scheme in a single
+   *        edge loop, and exchange both with a single halo message.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetUndivided_Laplacian_Sensor(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Impose the send-receive boundary condition for the undivided laplacian and the
+   *        pressure sensor, packed in a single message.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_MPI_Undivided_Laplacian_Sensor(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the max eigenvalue.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -5382,7 +5961,18 @@ public:
    * \param[in] config - Definition of the particular problem.
    * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
    */
-  void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+  void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
+                              unsigned short iRKStep);
+
+  /*!
+   * \brief Update the solution using the five stage, fourth-order, 2N-storage Runge-Kutta scheme
+   *        of Carpenter and Kennedy, the new solution of each point is the register of the scheme.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void LowStorageRK_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short iRKStep);
 
   /*!
@@ -7181,6 +7771,14 @@ public:
    */
   void Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Impose the send-receive boundary condition for the gradient and the limiter
+   *        of the primitive variables, packed in a single message.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Set the solver nondimensionalization.
    * \param[in] config - Definition of the particular problem.
@@ -7355,6 +7953,13 @@ public:
    */
   void SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Green-Gauss gradient of the primitive variables on the domain points, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputePrimitive_Gradient_GG(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -7363,6 +7968,13 @@ public:
    */
   void SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Least-Squares gradient of the primitive variables on the domain points, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputePrimitive_Gradient_LS(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the gradient of the primitive variables using a Least-Squares method,
    *        and stores the result in the <i>Gradient_Primitive</i> variable.
@@ -7378,6 +7990,21 @@ public:
    */
   void SetPrimitive_Limiter(CGeometry *geometry, CConfig *config);
   
+  /*!
+   * \brief Compute the gradient and the limiter of the primitive variables, with a single
+   *        halo exchange for both of them.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Limiter of the primitive variables, without MPI.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputePrimitive_Limiter(CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Compute the undivided laplacian for the solution, except the energy equation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -9336,6 +9963,21 @@ protected:
   su2double ****SlidingState;
   int **SlidingStateNodes;
 
+  CSysMatrix *Jacobian_Coupled;   /*!< \brief Jacobian of the coupled mean flow and turbulence system. */
+  CSysVector *LinSysRes_Coupled,  /*!< \brief Right hand side of the coupled system. */
+  *LinSysSol_Coupled;             /*!< \brief Solution of the coupled system. */
+
+  /*!
+   * \brief Solve the implicit systems of the mean flow and of the turbulence model as one
+   *        coupled system. The off-diagonal blocks contain the dependence of the viscous
+   *        fluxes of the mean flow on the eddy viscosity. The mean flow solution is updated,
+   *        the turbulence increments are returned in LinSysSol.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solve_Coupled_System(CGeometry *geometry, CSolver **solver_container, CConfig *config);
+
 public:
   
   /*!
@@ -9407,6 +10049,21 @@ public:
   void Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                         CConfig *config, unsigned short iMesh, unsigned short iRKStep);
   
+  /*!
+   * \brief Compute the upwind and viscous residuals of the turbulence equations in a single
+   *        edge loop, such that the flow and turbulence data of an edge is gathered only once.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the convective numerical method.
+   * \param[in] visc_numerics - Description of the viscous numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                               CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                               unsigned short iRKStep);
+  
   /*!
    * \brief Impose the Symmetry Plane boundary condition.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -9553,6 +10210,31 @@ class CTurbSASolver: public CTurbSolver {
 private:
   su2double nu_tilde_Inf, nu_tilde_Engine, nu_tilde_ActDisk;
   
+  vector<vector<unsigned long> > WF_Donor_Start; /*!< \brief Start of the wall function donors of each vertex, per marker. */
+  vector<vector<unsigned long> > WF_Donor_Point; /*!< \brief Wall function donors (interior neighbours of the vertices), per marker. */
+  vector<vector<su2double> > WF_Donor_TauWall;   /*!< \brief Wall shear stress of the last evaluation at each donor, initial guess of the next. */
+  
+  bool DES_Geometry_Ready;                /*!< \brief The geometric terms of the DES length scale are up to date. */
+  unsigned long DES_Geometry_Iter;        /*!< \brief Time iteration of the last update of the geometric terms. */
+  vector<su2double> DES_Delta;            /*!< \brief Largest distance to a neighbour in each direction (SA_ZDES), 3 per point. */
+  vector<unsigned long> DES_Neighbor_Begin; /*!< \brief Start of the neighbours of each point in DES_Neighbor_Delta (SA_EDDES). */
+  vector<su2double> DES_Neighbor_Delta;   /*!< \brief Absolute coordinate differences to each neighbour (SA_EDDES), 3 per neighbour. */
+  
+  /*!
+   * \brief Precompute the geometric terms of the DES length scale, only done on the first call and,
+   *        with grid movement, once per time iteration.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetDES_Geometry(CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Find the wall function donors of the vertices of a marker, only done on the first call.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] val_marker - Surface marker where the wall function is applied.
+   */
+  void SetWallFunction_Donors(CGeometry *geometry, unsigned short val_marker);
+  
 public:
   /*!
    * \brief Constructor of the class.
@@ -9800,12 +10482,13 @@ public:
   void SetFreeStream_Solution(CConfig *config);
   
   /*!
-   * \brief A virtual member.
+   * \brief Compute the DES length scale of a point from the flow terms and the geometric terms of SetDES_Geometry.
    * \param[in] solver - Solver container
    * \param[in] geometry - Geometrical definition.
    * \param[in] config - Definition of the particular problem.
+   * \param[in] val_point - Index of the point.
    */
-  void SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config);
+  void SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config, unsigned long val_point);
 
   /*!
    * \brief Store of a set of provided inlet profile values at a vertex.
@@ -10166,6 +10849,20 @@ public:
   void Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                         CConfig *config, unsigned short iMesh, unsigned short iRKStep);
   
+  /*!
+   * \brief Compute the upwind and viscous residuals with the separate edge loops of this class.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] conv_numerics - Description of the convective numerical method.
+   * \param[in] visc_numerics - Description of the viscous numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iMesh - Index of the mesh in multigrid computations.
+   * \param[in] iRKStep - Current step of the Runge-Kutta iteration.
+   */
+  void Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                               CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                               unsigned short iRKStep);
+  
   /*!
    * \brief Source term computation.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -10309,6 +11006,7 @@ protected:
   unsigned long AoA_Counter;
   su2double ACoeff, ACoeff_inc, ACoeff_old;
   bool Update_ACoeff;
+  bool Primal_Precond_Ready;  /*!< \brief The preconditioner of the transposed flow Jacobian is built (CONT_ADJ_PRIMAL_JACOBIAN). */
   
 public:
   
@@ -10762,15 +11460,6 @@ public:
    */
   void Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config);
   
-  /*!
-   * \brief Smooth the inviscid sensitivity of the functional.
-   * \param[in] geometry - Geometrical definition of the problem.
-   * \param[in] solver_container - Container vector with all the solutions.
-   * \param[in] numerics - Description of the numerical method.
-   * \param[in] config - Definition of the particular problem.
-   */
-  void Smooth_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config);
-  
   /*!
    * \brief Get the shape sensitivity coefficient.
    * \param[in] val_marker - Surface marker where the coefficient is computed.
@@ -11412,6 +12101,15 @@ protected:
             *Surface_Areas, Total_HeatFlux_Areas, Total_HeatFlux_Areas_Monitor;
   su2double ***ConjugateVar, ***InterfaceVar;
 
+  bool Reuse_Jacobian,             /*!< \brief Keep the operator of the solid and its preconditioner across iterations. */
+  Jacobian_Frozen,                 /*!< \brief The kept operator is assembled, only its variable diagonal terms are updated. */
+  Precond_Ready;                   /*!< \brief The preconditioner of the kept operator is built. */
+  su2double Diffusivity_Jacobian;  /*!< \brief Thermal diffusivity with which the kept operator was assembled. */
+  vector<su2double> Diag_Time,     /*!< \brief Time step terms in the diagonal of the kept operator. */
+  Diag_Time_New,                   /*!< \brief Time step terms of the current iteration. */
+  Diag_CHT,                        /*!< \brief CHT interface terms in the diagonal of the kept operator. */
+  Diag_CHT_New;                    /*!< \brief CHT interface terms of the current iteration. */
+
 public:
 
   /*!
@@ -11750,6 +12448,17 @@ private:
   
   su2double WAitken_Dyn;        /*!< \brief Aitken's dynamic coefficient */
   su2double WAitken_Dyn_tn1;      /*!< \brief Aitken's dynamic coefficient in the previous iteration */
+
+  bool IQN_Init;                           /*!< \brief True once the interface points of the IQN-ILS scheme are known. */
+  bool IQN_HaveOld;                        /*!< \brief True if the previous coupling iteration of the time step is stored. */
+  unsigned long IQN_TimeStep;              /*!< \brief Counter of the time steps seen by the IQN-ILS scheme. */
+  vector<unsigned long> IQN_Point;         /*!< \brief Owned points on the interface markers. */
+  vector<vector<su2double> > IQN_V;        /*!< \brief Differences of the interface residuals (newest first). */
+  vector<vector<su2double> > IQN_W;        /*!< \brief Differences of the computed displacements of all owned points (newest first). */
+  vector<unsigned long> IQN_Step;          /*!< \brief Time step in which every secant pair was created. */
+  vector<su2double> IQN_Res_Old;           /*!< \brief Interface residual of the previous coupling iteration. */
+  vector<su2double> IQN_Calc_Old;          /*!< \brief Computed displacements of the previous coupling iteration. */
+  vector<su2double> IQN_Coeff;             /*!< \brief Least-squares coefficients of the secant pairs. */
   
   su2double PenaltyValue;      /*!< \brief Penalty value to maintain total stiffness constant */
 
@@ -11766,6 +12475,114 @@ private:
   su2double RelaxCoeff;             /*!< \brief Relaxation coefficient . */
   su2double FSI_Residual;           /*!< \brief FSI residual. */
 
+  /*!
+   * \brief Element loops that can be carried out by the pool of threads.
+   */
+  enum ELEM_LOOP_KIND {
+    ELEM_STIFF_MATRIX                  = 0,  /*!< \brief Stiffness matrix of the linear problem. */
+    ELEM_STIFF_MATRIX_NODAL_STRESS_RES = 1,  /*!< \brief Tangent matrix and nodal stress residual. */
+    ELEM_NODAL_STRESS_RES              = 2,  /*!< \brief Nodal stress residual only. */
+    ELEM_MASS_MATRIX                   = 3,  /*!< \brief Mass matrix. */
+    ELEM_NODAL_STRESS                  = 4,  /*!< \brief Averaged nodal stresses and reactions for output. */
+    ELEM_MATRIX_FREE_SETUP             = 5,  /*!< \brief Constitutive matrices and diagonal blocks of the matrix-free operator. */
+    ELEM_MATRIX_FREE_PRODUCT           = 6   /*!< \brief Element by element product with the stiffness matrix. */
+  };
+
+  CTaskThreadPool *taskThreadPool;                 /*!< \brief Pool of threads to assemble the elements color by color. NULL
+                                                                if the elements are assembled by one thread. */
+  vector<vector<unsigned long> > ElemColorChunks;  /*!< \brief Bounds of the chunks of every element color. */
+  vector<CElement ***> element_container_Threads;  /*!< \brief Element containers of the threads, the first one is element_container. */
+  vector<CNumerics **> numerics_Threads;           /*!< \brief Numerics of the threads, because the numerics store the element
+                                                                matrices. The first one is the container of the driver. */
+  vector<su2double *>  Res_Stress_Threads;         /*!< \brief Nodal stress contribution of every thread. */
+  vector<su2double **> Jacobian_c_Threads;         /*!< \brief Constitutive (or mass) submatrix of every thread. */
+  vector<su2double **> Jacobian_s_Threads;         /*!< \brief Stress submatrix (diagonal) of every thread. */
+  vector<su2double **> Jacobian_k_Threads;         /*!< \brief Pressure submatrix of every thread. */
+
+  unsigned short elemLoopChunks;   /*!< \brief Kind of element loop carried out by the chunks, see ELEM_LOOP_KIND. */
+  CGeometry *geometryChunks;       /*!< \brief Geometry used when carrying out the chunks. */
+  CConfig   *configChunks;         /*!< \brief Definition of the problem used when carrying out the chunks. */
+
+  vector<su2double> RefGradients;          /*!< \brief Precomputed J_X and GradNi_Xj at the Gauss points of every element. */
+  vector<unsigned long> RefGradients_Ptr;  /*!< \brief Start of every element in RefGradients (empty if not precomputed). */
+
+  bool matrix_free;                   /*!< \brief The stiffness matrix of linear elasticity is applied element by element, it is not assembled. */
+  vector<su2double> MatFree_DMat;     /*!< \brief Constitutive matrix of every element, including the stiffness penalty of topology optimization. */
+  vector<su2double> MatFree_Diag;     /*!< \brief Diagonal blocks of the stiffness matrix. */
+  vector<su2double> MatFree_DiagInv;  /*!< \brief Inverse diagonal blocks with the essential boundary conditions (Jacobi preconditioner). */
+  vector<bool> MatFree_Clamped;       /*!< \brief Points whose displacement is imposed by a clamped boundary. */
+  const CSysVector *MatFree_Vec;      /*!< \brief Vector multiplied by the element chunks of the matrix-free product. */
+  CSysVector *MatFree_Prod;           /*!< \brief Result of the element chunks of the matrix-free product. */
+
+  /*!
+   * \brief Allocate the elements used by the numerics for every term of the equations.
+   * \param[in] config - Definition of the particular problem.
+   * \return Container of the elements, indexed by term and kind of element.
+   */
+  CElement ***Create_ElementContainer(CConfig *config);
+
+  /*!
+   * \brief Allocate a copy of the structural numerics of the driver for an additional thread.
+   * \param[in] config - Definition of the particular problem.
+   * \return Container of the numerics, indexed by term.
+   */
+  CNumerics **Create_NumericsThread(CConfig *config);
+
+  /*!
+   * \brief Color the elements and create the pool of threads with their own elements, numerics and submatrices.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetUp_Threads(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Precompute the gradients of the shape functions of the reference configuration of every element.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Set_RefGradients(CGeometry *geometry, CConfig *config);
+
+  /*!
+   * \brief Carry out an element loop, color by color by the pool of threads if it is available.
+   * \param[in] val_loop - Kind of element loop, see ELEM_LOOP_KIND.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Loop_Elements(unsigned short val_loop, CGeometry *geometry, CNumerics **numerics, CConfig *config);
+
+  /*!
+   * \brief Carry out an element loop for a range of the colored element list.
+   * \param[in] val_loop - Kind of element loop, see ELEM_LOOP_KIND.
+   * \param[in] val_begin - First position in the colored element list.
+   * \param[in] val_end - Position past the last element of the range.
+   * \param[in] iThread - Index of the thread, which determines the elements, numerics and submatrices.
+   */
+  void Loop_Elements_Range(unsigned short val_loop, unsigned long val_begin, unsigned long val_end, unsigned short iThread);
+
+  /*!
+   * \brief Function called by the pool of threads to carry out a chunk of an element color.
+   * \param[in] solver - The structural solver, cast to void.
+   * \param[in] chunk - Range of the colored element list.
+   */
+  static void ProcessTaskChunk_FEA(void *solver, const CTaskChunk &chunk);
+
+  /*!
+   * \brief Add the products of the element stiffness matrices of a range of the colored element list
+   *        with MatFree_Vec to MatFree_Prod, using the precomputed gradients of the shape functions.
+   * \param[in] val_begin - First position in the colored element list.
+   * \param[in] val_end - Position past the last element of the range.
+   */
+  void MatrixFree_Product_Range(unsigned long val_begin, unsigned long val_end);
+
+  /*!
+   * \brief Solve the linear system with the matrix-free stiffness operator and its Jacobi preconditioner.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   * \return Number of iterations of the linear solver.
+   */
+  unsigned long MatrixFree_Solve(CGeometry *geometry, CConfig *config);
+
 public:
   
   CSysVector TimeRes_Aux;      /*!< \brief Auxiliary vector for adding mass and damping contributions to the residual. */
@@ -12137,6 +12954,25 @@ public:
    */
   void Solve_System(CGeometry *geometry, CSolver **solver_container, CConfig *config);
   
+  /*!
+   * \brief Product with the stiffness matrix of linear elasticity, applied element by element, with the
+   *        clamped boundary conditions (zero columns and rows, unit diagonal) of the assembled system.
+   * \param[in] u - Vector multiplied by the matrix, consistent at the halo points.
+   * \param[out] v - Result of the product.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixFree_Product(const CSysVector & u, CSysVector & v, CGeometry *geometry, CConfig *config);
+  
+  /*!
+   * \brief Apply the block Jacobi preconditioner of the matrix-free stiffness operator.
+   * \param[in] u - Vector to be preconditioned.
+   * \param[out] v - Result of the preconditioning.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void MatrixFree_Precondition(const CSysVector & u, CSysVector & v, CGeometry *geometry, CConfig *config);
+  
   /*!
    * \brief Get the residual for FEM structural analysis.
    * \param[in] val_var - Index of the variable.
@@ -12252,6 +13088,16 @@ public:
                                  CConfig *fea_config,
                                  CSolver ***fea_solution,
                                  unsigned long iOuterIter);
+
+  /*!
+   * \brief Update the secant pairs of the IQN-ILS scheme and solve its least-squares problem for the interface residual.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] fea_config - Definition of the particular problem.
+   * \param[in] iOuterIter - Coupling iteration within the time step.
+   */
+  void ComputeIQN_Coefficients(CGeometry *geometry,
+                               CConfig *fea_config,
+                               unsigned long iOuterIter);
   
   /*!
    * \brief Aitken's relaxation of the solution.
@@ -12437,6 +13283,73 @@ public:
 
 };
 
+/*!
+ * \class CFEAMatrixFreeProduct
+ * \brief Matrix-vector product with the stiffness matrix of linear elasticity, applied element by
+ *        element by the structural solver instead of being assembled.
+ */
+class CFEAMatrixFreeProduct : public CMatrixVectorProduct {
+private:
+  CFEASolver *solver;  /*!< \brief Structural solver that owns the element data of the operator. */
+  CGeometry *geometry; /*!< \brief Geometrical definition of the problem. */
+  CConfig *config;     /*!< \brief Definition of the particular problem. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] solver_ref - Structural solver that applies the operator.
+   * \param[in] geometry_ref - Geometrical definition of the problem.
+   * \param[in] config_ref - Definition of the particular problem.
+   */
+  CFEAMatrixFreeProduct(CFEASolver *solver_ref, CGeometry *geometry_ref, CConfig *config_ref);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CFEAMatrixFreeProduct() {}
+
+  /*!
+   * \brief Operator that defines the product.
+   * \param[in] u - CSysVector that is being multiplied by the stiffness matrix.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CFEAMatrixFreePreconditioner
+ * \brief Block Jacobi preconditioner of the matrix-free stiffness operator of the structural solver.
+ */
+class CFEAMatrixFreePreconditioner : public CPreconditioner {
+private:
+  CFEASolver *solver;  /*!< \brief Structural solver that owns the inverse diagonal blocks. */
+  CGeometry *geometry; /*!< \brief Geometrical definition of the problem. */
+  CConfig *config;     /*!< \brief Definition of the particular problem. */
+
+public:
+
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] solver_ref - Structural solver that applies the preconditioner.
+   * \param[in] geometry_ref - Geometrical definition of the problem.
+   * \param[in] config_ref - Definition of the particular problem.
+   */
+  CFEAMatrixFreePreconditioner(CFEASolver *solver_ref, CGeometry *geometry_ref, CConfig *config_ref);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CFEAMatrixFreePreconditioner() {}
+
+  /*!
+   * \brief Operator that defines the preconditioner.
+   * \param[in] u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
 /*!
  * \class CTemplateSolver
  * \brief Main class for defining the template model solver.
@@ -13485,11 +14398,38 @@ protected:
 
   CBlasStructure *blasFunctions; /*!< \brief  Pointer to the object to carry out the BLAS functionalities. */
 
+  CTaskThreadPool *taskThreadPool;               /*!< \brief Pool of threads to carry out chunks of the tasks. NULL
+                                                              if the tasks are carried out by one thread. */
+  vector<CFluidModel *> FluidModelThreads;       /*!< \brief Fluid models of the additional threads of the pool,
+                                                              because the fluid model stores the thermodynamic state. */
+  vector<vector<su2double> > workArrayThreads;   /*!< \brief Work arrays of the threads of the pool. */
+
+  vector<unsigned long> startLocResInternalFace; /*!< \brief The starting location in the residual of the faces
+                                                              of every internal matching face. */
+
+  su2double      timeTaskListLoadBalance;        /*!< \brief Measured wall clock time of this rank in the tasks list
+                                                              since the last check of the load balance. */
+  unsigned long  nEvalTaskListLoadBalance;       /*!< \brief Number of evaluations of the tasks list since the
+                                                              last check of the load balance. */
+
+  CNumerics **numericsResidual;                  /*!< \brief Numerics of the last evaluation of the tasks list, used
+                                                              in the matrix-free products of the implicit iteration. */
+  vector<su2double> VecResDOFsRefImplicit;       /*!< \brief Unperturbed residual of the owned DOFs in the
+                                                              matrix-free implicit iteration. */
+  su2double normSolRefImplicit;                  /*!< \brief Global norm of the unperturbed solution in the
+                                                              matrix-free implicit iteration. */
+
 private:
 
 #ifdef HAVE_MPI
   vector<vector<SU2_MPI::Request> > commRequests;  /*!< \brief Communication requests in the communication of the solution for all
-                                                               time levels. These are both sending and receiving requests. */
+                                                               time levels. These are both sending and receiving requests. Persistent
+                                                               requests, except for the AD builds. */
+  vector<vector<SU2_MPI::Request> > reverseCommRequests;  /*!< \brief Communication requests in the reverse communication of the
+                                                                      residual for all time levels. Persistent requests,
+                                                                      except for the AD builds. */
+  vector<bool> commActive;         /*!< \brief Whether or not the communication of a time level is in progress. */
+  vector<bool> reverseCommActive;  /*!< \brief Whether or not the reverse communication of a time level is in progress. */
 
   vector<vector<vector<unsigned long> > > elementsRecvMPIComm;  /*!< \brief Triple vector, which contains the halo elements
                                                                             for MPI communication for all time levels. */
@@ -13521,6 +14461,11 @@ private:
 
   vector<CTaskDefinition> tasksList; /*!< \brief List of tasks to be carried out in the computationally
                                                  intensive part of the solver. */
+
+  vector<vector<unsigned long> > taskChunkBounds; /*!< \brief Bounds of the chunks of the tasks that are carried out
+                                                               by the pool of threads. Empty for the other tasks. */
+  CConfig   *configTaskChunks;    /*!< \brief Definition of the problem used when carrying out the chunks. */
+  CNumerics **numericsTaskChunks; /*!< \brief Description of the numerical method used when carrying out the chunks. */
 public:
 
   /*!
@@ -13720,11 +14665,21 @@ public:
                               CNumerics **numerics, CConfig *config,
                               unsigned short iMesh, unsigned short RunTime_EqSystem);
 
+  /*!
+   * \brief Function, which compares the measured time spent in the tasks list
+            over the ranks and reports the load imbalance if it exceeds the
+            tolerance specified in config. This is a diagnostic only, the
+            work is not redistributed.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ReportLoadImbalance_DG(CConfig *config);
+
   /*!
    * \brief Function, which determines the values of the tolerances in
             the predictor step of ADER-DG.
+   * \param[in] config - Definition of the particular problem.
    */
-  void TolerancesADERPredictorStep(void);
+  void TolerancesADERPredictorStep(CConfig *config);
 
   /*!
    * \brief Function, carries out the predictor step of the ADER-DG
@@ -14131,6 +15086,41 @@ public:
   void ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config,
                               unsigned short iRKStep);
 
+  /*!
+   * \brief Update the solution with one backward Euler step in pseudo time, for steady
+            problems. The linear system (I/dt + dR/dU) dU = -R, with R the residual
+            multiplied by the inverse mass matrix, is solved with FGMRES and
+            matrix-free products.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] solver_container - Container vector with all the solutions.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config);
+
+  /*!
+   * \brief Function, which computes the product of the matrix of the implicit pseudo
+            time system with a vector, using a finite difference of the residual.
+   * \param[in]  geometry         - Geometrical definition of the problem.
+   * \param[in]  solver_container - Container vector with all the solutions.
+   * \param[in]  config           - Definition of the particular problem.
+   * \param[in]  u                - Vector to be multiplied.
+   * \param[out] v                - Result of the product.
+   */
+  void JacobianFreeProduct_DG(CGeometry        *geometry,
+                              CSolver          **solver_container,
+                              CConfig          *config,
+                              const CSysVector &u,
+                              CSysVector       &v);
+
+  /*!
+   * \brief Function, which applies the preconditioner of the implicit pseudo time
+            system, i.e. the inverse of the pseudo time term of the elements.
+   * \param[in]  u - Vector to be preconditioned.
+   * \param[out] v - Result of the preconditioning.
+   */
+  void PseudoTimePreconditioner_DG(const CSysVector &u,
+                                   CSysVector       &v);
+
   /*!
    * \brief Update the solution for the ADER-DG scheme for the given range
             of elements.
@@ -14511,6 +15501,12 @@ protected:
                                          const unsigned short timeLevel,
                                          const bool commMustBeCompleted);
 
+  /*!
+   * \brief Routine that tests the communication requests in progress, such that
+            the MPI library can progress the communication while work is done.
+   */
+  void Progress_MPI_Communication(void);
+
   /*!
    * \brief Function, which computes the inviscid fluxes in face points.
    * \param[in]  config       - Definition of the particular problem.
@@ -14788,6 +15784,58 @@ private:
    */
   void SetUpTaskList(CConfig *config);
 
+  /*!
+   * \brief Function, which determines the chunks of the tasks that are carried
+            out by the pool of threads. These are the ADER predictor steps, the
+            volume residuals and, for the Roe and Lax-Friedrich Riemann solvers,
+            the surface residuals of the internal matching faces.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetUpTaskChunks(CConfig *config);
+
+  /*!
+   * \brief Function, which creates the kernels of the matrix products of the
+            standard elements and faces for all possible paddings of the chunks,
+            such that the matrix products need not be dispatched for every call.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetUpGemmKernels(CConfig *config);
+
+  /*!
+   * \brief Function, which carries out a single task of the tasks list.
+   * \param[in] indTask   - Index of the task in tasksList.
+   * \param[in] numerics  - Description of the numerical method.
+   * \param[in] config    - Definition of the particular problem.
+   * \param[in] waitComm  - Whether or not to wait for the completion of a communication.
+   * \param[out] workArray - Work array.
+   * \return False if a communication could not be completed yet, true otherwise.
+   */
+  bool ProcessTask_DG(const unsigned long indTask,
+                      CNumerics           **numerics,
+                      CConfig             *config,
+                      const bool          waitComm,
+                      su2double           *workArray);
+
+  /*!
+   * \brief Function, which processes the list of tasks with the pool of threads.
+            The chunks of the tasks in taskChunkBounds are carried out by all threads,
+            while the other tasks, among which the MPI communication, are carried out
+            by the calling thread.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config   - Definition of the particular problem.
+   */
+  void ProcessTaskListThreads_DG(CNumerics **numerics,
+                                 CConfig   *config);
+
+  /*!
+   * \brief Function, which carries out a chunk of a task. It is called by the
+            threads of the pool.
+   * \param[in] solver - Pointer to the solver.
+   * \param[in] chunk  - The chunk to be carried out.
+   */
+  static void ProcessTaskChunk_DG(void             *solver,
+                                  const CTaskChunk &chunk);
+
   /*!
    * \brief Function, which sets up the persistent communication of the flow
             variables in the DOFs.
@@ -14905,6 +15953,112 @@ protected:
     NPad  = llEnd*nVar;
     if( NPad%nPadMin ) NPad += nPadMin - (NPad%nPadMin);
   }
+
+  /*!
+   * \brief Template function, which splits a range of elements/faces in chunks
+            for the pool of threads. The chunks only end at the end of a chunk
+            of MetaDataChunkOfElem, such that the elements/faces are treated
+            simultaneously in the same way as by a single thread.
+   * \param[in]  elem       - Const pointer the volume or face elements.
+   * \param[in]  elemBeg    - Start index of the range.
+   * \param[in]  elemEnd    - End index (not included) of the range.
+   * \param[in]  nElemSimul - Number of elements/faces treated simultaneously, see
+                              MetaDataChunkOfElem. Use 1 if no simultaneous treatment
+                              takes place.
+   * \param[in]  nChunks    - Desired number of chunks.
+   * \param[out] bounds     - Bounds of the chunks, chunk i is [bounds[i], bounds[i+1]).
+   */
+  template <class TElemType>
+  void ChunkBoundsOfRange(const TElemType       *elem,
+                          const unsigned long   elemBeg,
+                          const unsigned long   elemEnd,
+                          const unsigned short  nElemSimul,
+                          const unsigned long   nChunks,
+                          vector<unsigned long> &bounds) {
+
+    /* Determine the desired number of elements per chunk. */
+    const unsigned long sizeChunk = max((elemEnd-elemBeg)/max(nChunks, (unsigned long) 1),
+                                        (unsigned long) 1);
+
+    /* Loop over the range in the same way as the residual functions do and
+       close a chunk as soon as it contains sizeChunk elements. */
+    bounds.clear();
+    bounds.push_back(elemBeg);
+    for(unsigned long l=elemBeg; l<elemEnd;) {
+      unsigned long lEnd;
+      unsigned short ind, llEnd, NPad;
+      MetaDataChunkOfElem(elem, l, elemEnd, nElemSimul, 1, lEnd, ind, llEnd, NPad);
+
+      if((lEnd-bounds.back() >= sizeChunk) || (lEnd == elemEnd)) bounds.push_back(lEnd);
+      l = lEnd;
+    }
+
+    if(elemEnd == elemBeg) bounds.push_back(elemEnd);
+  }
+
+  /*!
+   * \brief Function, which returns the fluid model to be used by the thread
+            from which this function is called.
+   * \return Pointer to the fluid model of this thread.
+   */
+  CFluidModel *GetThreadFluidModel(void);
+};
+
+/*!
+ * \class CFEM_DG_JacobianFreeProduct
+ * \brief Matrix-free product of the implicit pseudo time system of the DG solver.
+ * \author E. van der Weide
+ * \version 6.2.0 "Falcon"
+ */
+class CFEM_DG_JacobianFreeProduct : public CMatrixVectorProduct {
+private:
+  CFEM_DG_EulerSolver *solver;   /*!< \brief DG solver, which computes the residuals. */
+  CGeometry *geometry;           /*!< \brief Geometrical definition of the problem. */
+  CSolver **solver_container;    /*!< \brief Container vector with all the solutions. */
+  CConfig *config;               /*!< \brief Definition of the particular problem. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_solver           - DG solver, which computes the residuals.
+   * \param[in] val_geometry         - Geometrical definition of the problem.
+   * \param[in] val_solver_container - Container vector with all the solutions.
+   * \param[in] val_config           - Definition of the particular problem.
+   */
+  CFEM_DG_JacobianFreeProduct(CFEM_DG_EulerSolver *val_solver, CGeometry *val_geometry,
+                              CSolver **val_solver_container, CConfig *val_config);
+
+  /*!
+   * \brief Operator that defines the product with the matrix of the system.
+   * \param[in]  u - CSysVector that is being multiplied.
+   * \param[out] v - CSysVector that is the result of the product.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
+};
+
+/*!
+ * \class CFEM_DG_PseudoTimePreconditioner
+ * \brief Preconditioner of the implicit pseudo time system of the DG solver.
+ * \author E. van der Weide
+ * \version 6.2.0 "Falcon"
+ */
+class CFEM_DG_PseudoTimePreconditioner : public CPreconditioner {
+private:
+  CFEM_DG_EulerSolver *solver;   /*!< \brief DG solver, which stores the time steps. */
+
+public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] val_solver - DG solver, which stores the time steps.
+   */
+  CFEM_DG_PseudoTimePreconditioner(CFEM_DG_EulerSolver *val_solver);
+
+  /*!
+   * \brief Operator that defines the preconditioner operation.
+   * \param[in]  u - CSysVector that is being preconditioned.
+   * \param[out] v - CSysVector that is the result of the preconditioning.
+   */
+  void operator()(const CSysVector & u, CSysVector & v) const;
 };
 
 /*!
@@ -14924,6 +16078,9 @@ private:
   CSGSModel *SGSModel;     /*!< \brief LES Subgrid Scale model. */
   bool SGSModelUsed;       /*!< \brief Whether or not an LES Subgrid Scale model is used. */
 
+  vector<vector<su2double> > workSGSThreads; /*!< \brief Work arrays of the threads for the evaluation of
+                                                          the SGS model in chunks of integration points. */
+
   su2double
   *CL_Visc, 	            /*!< \brief Lift coefficient (viscous contribution) for each boundary. */
   *CD_Visc,              /*!< \brief Drag coefficient (viscous contribution) for each boundary. */
@@ -15712,6 +16869,57 @@ private:
                                          su2double      *paramFluxes);
 
   /*!
+   * \brief Function, which returns the SGS work array of the calling thread
+            with at least the given size.
+   * \param[in] sizeWork - Required size of the work array.
+   * \return Pointer to the SGS work array of the thread.
+   */
+  su2double *GetThreadWorkSGS(const unsigned long sizeWork);
+
+  /*!
+   * \brief Function to compute the eddy viscosity of the SGS model in the integration
+            points of a chunk of volume elements with one call to the model.
+   * \param[in] elemBeg       - Index of the first element of the chunk.
+   * \param[in] llEnd         - Number of elements in the chunk.
+   * \param[in] nInt          - Number of integration points of the elements.
+   * \param[in] NPad          - Value of the padding parameter to obtain optimal
+                                performance in the gemm computations.
+   * \param[in] nPoly         - Polynomial degree used for the LES length scale.
+   * \param[in] solAndGradInt - Solution and its parametric gradients in the integration points.
+   * \return Pointer to the eddy viscosities, stored per element of the chunk.
+   */
+  const su2double *EddyViscosityVolumeChunk(const unsigned long  elemBeg,
+                                            const unsigned short llEnd,
+                                            const unsigned short nInt,
+                                            const unsigned short NPad,
+                                            const unsigned short nPoly,
+                                            const su2double      *solAndGradInt);
+
+  /*!
+   * \brief Function to compute the eddy viscosity of the SGS model in the integration
+            points of a face with one call to the model.
+   * \param[in] indFaceChunk        - Index of the face in the chunk of fused faces.
+   * \param[in] nInt                - Number of integration points of the face.
+   * \param[in] NPad                - Value of the padding parameter to obtain optimal
+                                      performance in the gemm computations.
+   * \param[in] lenScale_LES        - LES length scale of the adjacent element.
+   * \param[in] solInt              - Solution in the integration points.
+   * \param[in] gradSolInt          - Gradient of the solution in the integration points.
+   * \param[in] metricCoorDerivFace - Derivatives of the parametric coordinates w.r.t.
+                                      the Cartesian coordinates in the integration points.
+   * \param[in] wallDistanceInt     - Wall distances in the integration points of the face.
+   * \return Pointer to the eddy viscosities in the integration points of the face.
+   */
+  const su2double *EddyViscosityFace(const unsigned short indFaceChunk,
+                                     const unsigned short nInt,
+                                     const unsigned short NPad,
+                                     const su2double      lenScale_LES,
+                                     const su2double      *solInt,
+                                     const su2double      *gradSolInt,
+                                     const su2double      *metricCoorDerivFace,
+                                     const su2double      *wallDistanceInt);
+
+/*!
    * \brief Function to compute the viscous normal fluxes in the integration points of a face.
    * \param[in]   adjVolElem          - Pointer to the adjacent volume.
    * \param[in]   indFaceChunk        - Index of the face in the chunk of fused faces.
@@ -15764,6 +16972,8 @@ private:
                                  to be computed.
    * \param[in]  wallDist      - Distance to the nearest viscous wall, if appropriate.
    * \param[in   lenScale_LES  - LES length scale, if appropriate.
+   * \param[in]  eddyVisc      - Eddy viscosity of the SGS model, if already computed
+                                 for a chunk of points. If NULL, it is computed here.
    * \param[out] Viscosity     - Total viscosity, to be computed.
    * \param[out] kOverCv       - Total thermal conductivity over Cv, to be computed.
    * \param[out] normalFlux    - Viscous normal flux, to be computed.
@@ -15775,6 +16985,7 @@ private:
                                             const su2double factHeatFlux,
                                             const su2double wallDist,
                                             const su2double lenScale_LES,
+                                            const su2double *eddyVisc,
                                                   su2double &Viscosity,
                                                   su2double &kOverCv,
                                                   su2double *normalFlux);
@@ -15792,6 +17003,8 @@ private:
                                  to be computed.
    * \param[in]  wallDist      - Distance to the nearest viscous wall, if appropriate.
    * \param[in   lenScale_LES  - LES length scale, if appropriate.
+   * \param[in]  eddyVisc      - Eddy viscosity of the SGS model, if already computed
+                                 for a chunk of points. If NULL, it is computed here.
    * \param[out] Viscosity     - Total viscosity, to be computed.
    * \param[out] kOverCv       - Total thermal conductivity over Cv, to be computed.
    * \param[out] normalFlux    - Viscous normal flux, to be computed.
@@ -15803,6 +17016,7 @@ private:
                                             const su2double factHeatFlux,
                                             const su2double wallDist,
                                             const su2double lenScale_LES,
+                                            const su2double *eddyVisc,
                                                   su2double &Viscosity,
                                                   su2double &kOverCv,
                                                   su2double *normalFlux);
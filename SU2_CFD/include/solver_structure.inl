@@ -39,6 +39,14 @@
 
 inline void CSolver::SetIterLinSolver(unsigned short val_iterlinsolver) { IterLinSolver = val_iterlinsolver; }
 
+inline void CSolver::SetResLinSolver(su2double val_reslinsolver) { ResLinSolver = val_reslinsolver; }
+
+inline void CSolver::SetJacobianFree_Product(CMatrixVectorProduct *val_product) { JacobianFree_Product = val_product; }
+
+inline unsigned long CSolver::GetnTimeAverage_Samples(void) { return nTimeAvg_Samples; }
+
+inline unsigned short CSolver::GetnTimeAverage_Var(unsigned short val_nDim) { return val_nDim+3 + (val_nDim*(val_nDim+1))/2; }
+
 inline void CSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) { }
 
 inline void CSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) { }
@@ -73,6 +81,26 @@ inline void CSolver::SetNondimensionalization(CConfig *config, unsigned short iM
 
 inline unsigned short CSolver::GetIterLinSolver(void) { return IterLinSolver; }
 
+inline bool CSolver::GetPoint_Active(unsigned long val_point) { return (!Local_Freezing || Point_Active[val_point]); }
+
+inline unsigned long CSolver::GetEdgeLoop_Begin(CGeometry *geometry, unsigned short val_color) {
+  return Edge_Subset? Active_Edge_Begin[val_color] : geometry->GetEdgeColor_Begin(val_color);
+}
+
+inline unsigned long CSolver::GetEdgeLoop_End(CGeometry *geometry, unsigned short val_color) {
+  return Edge_Subset? Active_Edge_End[val_color] : geometry->GetEdgeColor_End(val_color);
+}
+
+inline unsigned long CSolver::GetEdgeLoop_Edge(CGeometry *geometry, unsigned long val_pos) {
+  return Edge_Subset? Active_Edge[val_pos] : geometry->GetEdgeColor_Edge(val_pos);
+}
+
+inline unsigned long CSolver::GetMultirate_nSubStep(void) { return (Multirate_nLevel > 1)? (1ul << (Multirate_nLevel-1)) : 1; }
+
+inline unsigned short CSolver::GetMultirate_nLevel(void) { return Multirate_nLevel; }
+
+inline su2double CSolver::GetResLinSolver(void) { return ResLinSolver; }
+
 inline su2double CSolver::GetCSensitivity(unsigned short val_marker, unsigned long val_vertex) { return 0; }
 
 inline void CSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config, unsigned short iRKStep, 
@@ -118,8 +146,6 @@ inline void CSolver::SetCSensitivity(unsigned short val_marker, unsigned long va
 
 inline void CSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) { }
 
-inline void CSolver::Smooth_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) { }
-
 inline void CSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) { }
 
 inline su2double CSolver::GetPhi_Inf(unsigned short val_dim) { return 0; }
@@ -841,6 +867,15 @@ inline void CSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_con
 inline void CSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, 
                      CConfig *config, unsigned short iMesh) { }
 
+inline void CSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                             CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                                             unsigned short iRKStep) {
+  Upwind_Residual(geometry, solver_container, conv_numerics, config, iMesh);
+  Viscous_Residual(geometry, solver_container, visc_numerics, config, iMesh, iRKStep);
+}
+
+inline void CSolver::SetUp_EdgeThreads(CGeometry *geometry, CConfig *config, vector<CNumerics *> &val_numerics) { }
+
 inline void CSolver::Convective_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                        CConfig *config, unsigned short iMesh, unsigned short iRKStep) { }
 
@@ -890,6 +925,9 @@ inline void CSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_
 inline void CSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                             CConfig *config, unsigned short iRKStep) { }
 
+inline void CSolver::LowStorageRK_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                            CConfig *config, unsigned short iRKStep) { }
+
 inline void CSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
 
 inline void CSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) { }
@@ -911,9 +949,19 @@ inline void CSolver::GeneralizedAlpha_UpdateLoads(CGeometry *geometry, CSolver *
 inline void CSolver::Compute_Residual(CGeometry *geometry, CSolver **solver_container, CConfig *config, 
                     unsigned short iMesh) { }
 
-inline void CSolver::SetRes_RMS(unsigned short val_var, su2double val_residual) { Residual_RMS[val_var] = val_residual; }
+inline void CSolver::SetRes_RMS(unsigned short val_var, su2double val_residual) {
+  Residual_RMS[val_var] = val_residual;
+  if (CReproducibleSum::GetActive()) {
+    if (Residual_RMS_Sum == NULL) Residual_RMS_Sum = new CReproducibleSum(nVar);
+    Residual_RMS_Sum->Reset(val_var);
+    Residual_RMS_Sum->Add(val_var, SU2_TYPE::GetValue(val_residual));
+  }
+}
 
-inline void CSolver::AddRes_RMS(unsigned short val_var, su2double val_residual) { Residual_RMS[val_var] += val_residual; }
+inline void CSolver::AddRes_RMS(unsigned short val_var, su2double val_residual) {
+  Residual_RMS[val_var] += val_residual;
+  if (Residual_RMS_Sum != NULL) Residual_RMS_Sum->Add(val_var, SU2_TYPE::GetValue(val_residual));
+}
 
 inline su2double CSolver::GetRes_RMS(unsigned short val_var) { return Residual_RMS[val_var]; }
 
@@ -983,6 +1031,10 @@ inline void CSolver::Set_NewSolution(CGeometry *geometry) { }
 
 inline unsigned short CSolver::GetnVar(void) { return nVar; }
 
+inline unsigned long CSolver::GetnPointDomain(void) { return nPointDomain; }
+
+inline CSysMatrix & CSolver::GetJacobian(void) { return Jacobian; }
+
 inline unsigned short CSolver::GetnOutputVariables(void) { return nOutputVariables; }
 
 inline unsigned short CSolver::GetnPrimVar(void) { return nPrimVar; }
@@ -1179,12 +1231,24 @@ inline void CSolver::SetBeta_Parameter(CGeometry *geometry, CSolver **solver_con
 
 inline void CSolver::SetRoe_Dissipation(CGeometry *geometry, CConfig *config) {}
 
-inline void CSolver::SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config) { }
+inline void CSolver::SetDES_LengthScale(CSolver** solver, CGeometry *geometry, CConfig *config, unsigned long val_point) { }
 
 inline void CSolver::SetConjugateHeatVariable(unsigned short val_marker, unsigned long val_vertex, unsigned short pos_var, su2double relaxation_factor, su2double val_var) { }
 
 inline su2double CSolver::GetConjugateHeatVariable(unsigned short val_marker, unsigned long val_vertex, unsigned short pos_var) { return 0.0; }
 
+inline su2double *CEulerSolver::GetNode_Primitive(unsigned long iPoint) {
+  return static_cast<CEulerVariable*>(node[iPoint])->CEulerVariable::GetPrimitive();
+}
+
+inline su2double **CEulerSolver::GetNode_Gradient_Primitive(unsigned long iPoint) {
+  return static_cast<CEulerVariable*>(node[iPoint])->CEulerVariable::GetGradient_Primitive();
+}
+
+inline su2double *CEulerSolver::GetNode_Limiter_Primitive(unsigned long iPoint) {
+  return static_cast<CEulerVariable*>(node[iPoint])->CEulerVariable::GetLimiter_Primitive();
+}
+
 inline su2double CEulerSolver::GetDensity_Inf(void) { return Density_Inf; }
 
 inline su2double CEulerSolver::GetModVelocity_Inf(void) { 
@@ -1763,6 +1827,12 @@ inline void CNSSolver::SetConjugateHeatVariable(unsigned short val_marker, unsig
 
 inline CFluidModel* CFEM_DG_EulerSolver::GetFluidModel(void) { return FluidModel;}
 
+inline CFluidModel* CFEM_DG_EulerSolver::GetThreadFluidModel(void) {
+  if( !taskThreadPool ) return FluidModel;
+  const unsigned short iThread = taskThreadPool->GetThreadIndex();
+  return iThread ? FluidModelThreads[iThread-1] : FluidModel;
+}
+
 inline su2double* CFEM_DG_EulerSolver::GetVecSolDOFs(void) {return VecSolDOFs.data();}
 
 inline unsigned long CFEM_DG_EulerSolver::GetnDOFsGlobal(void) {return nDOFsGlobal;}
@@ -1904,6 +1974,13 @@ inline void CFEM_DG_EulerSolver::BC_Isothermal_Wall(CConfig                  *co
 
 inline su2double CFEM_DG_NSSolver::GetViscosity_Inf(void) { return Viscosity_Inf; }
 
+inline su2double *CFEM_DG_NSSolver::GetThreadWorkSGS(const unsigned long sizeWork) {
+  const unsigned short iThread = taskThreadPool ? taskThreadPool->GetThreadIndex() : 0;
+  vector<su2double> &workSGS = workSGSThreads[iThread];
+  if(workSGS.size() < sizeWork) workSGS.resize(sizeWork);
+  return workSGS.data();
+}
+
 inline su2double CFEM_DG_NSSolver::GetTke_Inf(void) { return Tke_Inf; }
 
 inline su2double CFEM_DG_NSSolver::GetCL_Visc(unsigned short val_marker) { return CL_Visc[val_marker]; }
@@ -2344,6 +2421,18 @@ inline su2double CFEASolver::GetRelaxCoeff(void) { return RelaxCoeff; }
 
 inline su2double CFEASolver::GetFSI_Residual(void) { return FSI_Residual; }
 
+inline CFEAMatrixFreeProduct::CFEAMatrixFreeProduct(CFEASolver *solver_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  solver   = solver_ref;
+  geometry = geometry_ref;
+  config   = config_ref;
+}
+
+inline CFEAMatrixFreePreconditioner::CFEAMatrixFreePreconditioner(CFEASolver *solver_ref, CGeometry *geometry_ref, CConfig *config_ref) {
+  solver   = solver_ref;
+  geometry = geometry_ref;
+  config   = config_ref;
+}
+
 inline void CSolver::SetAdjoint_OutputMesh(CGeometry *geometry, CConfig *config) {}
 
 inline void CSolver::ExtractAdjoint_Geometry(CGeometry *geometry, CConfig *config) {}
@@ -48,6 +48,8 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
+#include <map>
 
 #include "../../Common/include/config_structure.hpp"
 #include "../../Common/include/geometry_structure.hpp"
@@ -79,10 +81,46 @@ protected:
   unsigned short *SpanLevelDonor;
   unsigned short nSpanMaxAllZones;
 
+  /*--- Sparse communication plan of the interface data ---*/
+  struct CInterfacePlan {
+    bool ready;                           /*!< \brief Whether the plan has been built. */
+    vector<unsigned long> donorVertex;    /*!< \brief Owned donor vertices whose values are requested by some rank. */
+    vector<int> sendRank;                 /*!< \brief Ranks that request donor values from this rank. */
+    vector<unsigned long> sendStart;      /*!< \brief Start of the values of each send rank in the send buffer. */
+    vector<unsigned long> sendIndex;      /*!< \brief Position in donorVertex of each value in the send buffer. */
+    vector<int> recvRank;                 /*!< \brief Donor ranks from which this rank receives values. */
+    vector<unsigned long> recvStart;      /*!< \brief Start of the values of each donor rank in the receive buffer. */
+    vector<int> slotProc;                 /*!< \brief Donor rank of each donor slot of the owned target vertices. */
+    vector<unsigned long> slotPoint;      /*!< \brief Global donor point of each donor slot of the owned target vertices. */
+    vector<unsigned long> slotIndex;      /*!< \brief Position in the receive buffer of each donor slot. */
+
+    CInterfacePlan(void) : ready(false) { }
+  };
+  vector<CInterfacePlan> InterfacePlan;   /*!< \brief Communication plan of each interface marker. */
 
+  unsigned short nVar;
 
+  /*!
+   * \brief Check that the communication plan of an interface still matches the donor
+   *        information of the target vertices, which changes if the interpolation is recomputed.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] Marker_Target - Index of the target marker on this rank, -1 if not present.
+   * \param[in] iMarkerInt - Index of the interface.
+   * \return <code>true</code> on all ranks if the plan can be reused.
+   */
+  bool Check_InterfacePlan(CGeometry *target_geometry, int Marker_Target, unsigned short iMarkerInt);
 
-  unsigned short nVar;
+  /*!
+   * \brief Build the sparse communication plan of an interface from the donor point and
+   *        donor processor information stored in the target vertices.
+   * \param[in] donor_geometry - Geometry of the donor mesh.
+   * \param[in] target_geometry - Geometry of the target mesh.
+   * \param[in] Marker_Donor - Index of the donor marker on this rank, -1 if not present.
+   * \param[in] Marker_Target - Index of the target marker on this rank, -1 if not present.
+   * \param[in] iMarkerInt - Index of the interface.
+   */
+  void Build_InterfacePlan(CGeometry *donor_geometry, CGeometry *target_geometry,
+                           int Marker_Donor, int Marker_Target, unsigned short iMarkerInt);
 
 public:
   /*!
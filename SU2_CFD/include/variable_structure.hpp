@@ -46,6 +46,7 @@
 #include <cstdlib>
 
 #include "../../Common/include/config_structure.hpp"
+#include "../../Common/include/memory_pool.hpp"
 #include "fluid_model.hpp"
 
 
@@ -92,6 +93,22 @@ protected:
                                                        have different number of nVar in the same problem. */
   su2double *Solution_Adj_Old;    /*!< \brief Solution of the problem in the previous AD-BGS iteration. */
   
+  /*!
+   * \brief Allocate a matrix (e.g. a gradient) whose rows are stored in one contiguous block.
+   *        This replaces one allocation per row by a single one and keeps the entries of
+   *        a point together in memory. The entries are initialized to zero.
+   * \param[in] val_nrow - Number of rows of the matrix.
+   * \param[in] val_ncol - Number of columns of the matrix.
+   * \return Pointer to the row pointers of the matrix.
+   */
+  static su2double **AllocateMatrix(unsigned short val_nrow, unsigned short val_ncol);
+  
+  /*!
+   * \brief Release a matrix allocated with AllocateMatrix.
+   * \param[in] val_matrix - Matrix to be released, may be <code>NULL</code>.
+   */
+  static void FreeMatrix(su2double **val_matrix);
+  
 public:
   
   /*!
@@ -118,6 +135,19 @@ public:
    * \brief Destructor of the class.
    */
   virtual ~CVariable(void);
+
+  /*!
+   * \brief Allocate the object from the pool of the variable objects.
+   * \param[in] size - Size of the (derived) object in bytes.
+   */
+  static void *operator new(size_t size);
+  
+  /*!
+   * \brief Return the memory of the object to the pool of the variable objects.
+   * \param[in] ptr  - Pointer to the object.
+   * \param[in] size - Size of the (derived) object in bytes.
+   */
+  static void operator delete(void *ptr, size_t size);
   
   /*!
    * \brief Set the value of the solution.
@@ -266,6 +296,12 @@ public:
    */
   virtual su2double GetSolution_New(unsigned short val_var);
   
+  /*!
+   * \brief A virtual member.
+   * \return Pointer to the new solution vector.
+   */
+  virtual su2double *GetSolution_New(void);
+  
   /*!
    * \brief A virtual member.
    */
@@ -483,7 +519,7 @@ public:
   
   /*!
    * \brief Get the truncation error.
-   * \return Pointer to the truncation error.
+   * \return Pointer to the truncation error, <code>NULL</code> if it is not allocated (no multigrid).
    */
   su2double *GetResTruncError(void);
   
@@ -605,6 +641,18 @@ public:
    */
   su2double GetSolution_Min(unsigned short val_var);
   
+  /*!
+   * \brief Get the max solution (bounds of the limiters) of all the variables.
+   * \return Pointer to the max solution.
+   */
+  su2double *GetSolution_Max(void);
+  
+  /*!
+   * \brief Get the min solution (bounds of the limiters) of all the variables.
+   * \return Pointer to the min solution.
+   */
+  su2double *GetSolution_Min(void);
+  
   /*!
    * \brief Get the value of the preconditioner Beta.
    * \return Value of the low Mach preconditioner variable Beta
@@ -1037,6 +1085,18 @@ public:
    */
   virtual void SetGammaSep(su2double gamma_sep);
   
+  /*!
+   * \brief A virtual member.
+   * \return Pressure gradient function of the Re_theta_t correlation.
+   */
+  virtual su2double GetF_Lambda(void);
+  
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_f_lambda - Pressure gradient function of the Re_theta_t correlation.
+   */
+  virtual void SetF_Lambda(su2double val_f_lambda);
+  
   /*!
    * \brief A virtual member.
    * \return Sets separation intermittency
@@ -1111,6 +1171,16 @@ public:
    */
   virtual bool SetPrimVar(CFluidModel *FluidModel);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_pressure    - Pressure computed by the fluid model.
+   * \param[in] val_soundspeed2 - Square of the speed of sound computed by the fluid model.
+   * \param[in] val_temperature - Temperature computed by the fluid model.
+   * \param[in] FluidModel      - Fluid model, used when the state is not physical.
+   */
+  virtual bool SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2,
+                                  su2double val_temperature, CFluidModel *FluidModel);
+  
   /*!
    * \brief A virtual member.
    */
@@ -1197,6 +1267,18 @@ public:
    */
   virtual void SetdPde_rho(su2double dPde_rho);
   
+  /*!
+   * \brief A virtual member.
+   * \param[in] val_factor - Factor of the global CFL number for the local time step.
+   */
+  virtual void SetLocalCFL_Factor(su2double val_factor);
+  
+  /*!
+   * \brief A virtual member.
+   * \return Factor of the global CFL number for the local time step.
+   */
+  virtual su2double GetLocalCFL_Factor(void);
+  
   /*!
    * \brief A virtual member.
    */
@@ -3108,12 +3190,14 @@ protected:
   su2double **Gradient_Secondary;  /*!< \brief Gradient of the primitive variables (T, vx, vy, vz, P, rho). */
   su2double *Limiter_Secondary;   /*!< \brief Limiter of the primitive variables (T, vx, vy, vz, P, rho). */
 
-  /*--- New solution container for Classical RK4 ---*/
+  /*--- New solution container for Classical RK4, register of the low-storage RK ---*/
 
   su2double *Solution_New;
 
   /*--- Old solution container for BGS iterations ---*/
   su2double* Solution_BGS_k;
+
+  su2double LocalCFL_Factor; /*!< \brief Factor of the global CFL number for the local time step. */
   
 public:
   
@@ -3155,6 +3239,12 @@ public:
    */
   su2double GetSolution_New(unsigned short val_var);
 
+  /*!
+   * \brief Get the new solution of the problem, the register of the low-storage Runge-Kutta scheme.
+   * \return Pointer to the new solution vector.
+   */
+  su2double *GetSolution_New(void);
+
   /*!
    * \brief Set the new solution container for Classical RK4.
    */
@@ -3305,6 +3395,18 @@ public:
    */
   void SetdPde_rho(su2double dPde_rho);
   
+  /*!
+   * \brief Set the factor of the global CFL number for the local time step.
+   * \param[in] val_factor - Factor of the CFL number, reduced at non-physical points.
+   */
+  void SetLocalCFL_Factor(su2double val_factor);
+  
+  /*!
+   * \brief Get the factor of the global CFL number for the local time step.
+   * \return Factor of the CFL number.
+   */
+  su2double GetLocalCFL_Factor(void);
+  
   /*!
    * \brief Set the value of the pressure.
    */
@@ -3326,6 +3428,20 @@ public:
    */
   bool SetPrimVar(CFluidModel *FluidModel);
   
+  /*!
+   * \brief Set the primitive variables for compressible flows from a thermodynamic
+   *        state computed beforehand, e.g. by CFluidModel::SetTDState_rhoe_Batch. SetVelocity
+   *        must have been called. If the state is not physical the old solution is restored
+   *        and the primitive variables are recomputed with the fluid model.
+   * \param[in] val_pressure    - Pressure computed by the fluid model.
+   * \param[in] val_soundspeed2 - Square of the speed of sound computed by the fluid model.
+   * \param[in] val_temperature - Temperature computed by the fluid model.
+   * \param[in] FluidModel      - Fluid model, used when the state is not physical.
+   * \return <code>FALSE</code> if the old solution had to be restored, otherwise <code>TRUE</code>.
+   */
+  bool SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2,
+                          su2double val_temperature, CFluidModel *FluidModel);
+  
   /*!
    * \brief A virtual member.
    */
@@ -4271,6 +4387,7 @@ public:
 class CTransLMVariable : public CTurbVariable {
 protected:
   su2double gamma_sep;
+  su2double f_lambda;  /*!< \brief Pressure gradient function of the Re_theta_t correlation (warm start of its iterations). */
   
 public:
   
@@ -4311,6 +4428,18 @@ public:
    */
   void SetGammaEff(void);
   
+  /*!
+   * \brief Get the pressure gradient function of the Re_theta_t correlation.
+   * \return Value of the last iteration.
+   */
+  su2double GetF_Lambda(void);
+  
+  /*!
+   * \brief Set the pressure gradient function of the Re_theta_t correlation.
+   * \param[in] val_f_lambda - Converged value.
+   */
+  void SetF_Lambda(su2double val_f_lambda);
+  
 };
 
 /*!
@@ -169,6 +169,10 @@ inline su2double CVariable::GetSolution_Max(unsigned short val_var) { return Sol
 
 inline su2double CVariable::GetSolution_Min(unsigned short val_var) { return Solution_Min[val_var]; }
 
+inline su2double *CVariable::GetSolution_Max(void) { return Solution_Max; }
+
+inline su2double *CVariable::GetSolution_Min(void) { return Solution_Min; }
+
 inline su2double CVariable::GetPreconditioner_Beta() { return 0; }
 
 inline void CVariable::SetPreconditioner_Beta( su2double val_Beta) { }
@@ -265,6 +269,10 @@ inline void CVariable::SetGammaEff(void) { }
 
 inline void CVariable::SetGammaSep(su2double gamma_sep) { }
 
+inline su2double CVariable::GetF_Lambda(void) { return 1.0; }
+
+inline void CVariable::SetF_Lambda(su2double val_f_lambda) { }
+
 inline su2double CVariable::GetIntermittency(void) { return 0; }
 
 inline su2double CVariable::GetEnthalpy(void) { return 0; }
@@ -327,6 +335,9 @@ inline bool CVariable::SetPrimVar(CConfig *config) { return true; }
 
 inline bool CVariable::SetPrimVar(CFluidModel *FluidModel) { return true; }
 
+inline bool CVariable::SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2,
+                                          su2double val_temperature, CFluidModel *FluidModel) { return true; }
+
 inline void CVariable::SetSecondaryVar(CFluidModel *FluidModel) { }
 
 inline bool CVariable::SetPrimVar(su2double eddy_visc, su2double turb_ke, CConfig *config) { return true; }
@@ -367,6 +378,10 @@ inline void CVariable::SetdPdrho_e(su2double dPdrho_e) { }
 
 inline void CVariable::SetdPde_rho(su2double dPde_rho) { }
 
+inline void CVariable::SetLocalCFL_Factor(su2double val_factor) { }
+
+inline su2double CVariable::GetLocalCFL_Factor(void) { return 1.0; }
+
 inline void CVariable::SetdTdrho_e(su2double dTdrho_e) { }
 
 inline void CVariable::SetdTde_rho(su2double dTde_rho) { }
@@ -671,6 +686,8 @@ inline void CVariable::GetAdjointSolution_Accel_time_n(su2double *adj_sol) { }
 
 inline su2double CVariable::GetSolution_New(unsigned short val_var) { return 0.0; }
 
+inline su2double *CVariable::GetSolution_New(void) { return NULL; }
+
 
 inline su2double CVariable::GetRoe_Dissipation(void) { return 0.0; }
 
@@ -694,6 +711,8 @@ inline su2double CVariable::GetVortex_Tilting() { return 0.0; }
 
 inline su2double CEulerVariable::GetSolution_New(unsigned short val_var) { return Solution_New[val_var]; }
 
+inline su2double *CEulerVariable::GetSolution_New(void) { return Solution_New; }
+
 inline su2double CNSVariable::GetRoe_Dissipation(void) { return Roe_Dissipation; }
 
 inline su2double CNSVariable::GetDES_LengthScale(void) { return DES_LengthScale; }
@@ -774,6 +793,10 @@ inline void CEulerVariable::SetdPde_rho(su2double dPde_rho) {
   Secondary[1] = dPde_rho;
 }
 
+inline void CEulerVariable::SetLocalCFL_Factor(su2double val_factor) { LocalCFL_Factor = val_factor; }
+
+inline su2double CEulerVariable::GetLocalCFL_Factor(void) { return LocalCFL_Factor; }
+
 inline su2double CEulerVariable::GetPrimitive(unsigned short val_var) { return Primitive[val_var]; }
 
 inline void CEulerVariable::SetPrimitive(unsigned short val_var, su2double val_prim) { Primitive[val_var] = val_prim; }
@@ -1058,6 +1081,10 @@ inline su2double CTransLMVariable::GetIntermittency() { return Solution[0]; }
 
 inline void CTransLMVariable::SetGammaSep(su2double gamma_sep_in) {gamma_sep = gamma_sep_in;}
 
+inline su2double CTransLMVariable::GetF_Lambda(void) { return f_lambda; }
+
+inline void CTransLMVariable::SetF_Lambda(su2double val_f_lambda) { f_lambda = val_f_lambda; }
+
 inline void CFEAVariable::SetStress_FEM(unsigned short iVar, su2double val_stress) { Stress[iVar] = val_stress; }
 
 inline void CFEAVariable::AddStress_FEM(unsigned short iVar, su2double val_stress) { Stress[iVar] += val_stress; }
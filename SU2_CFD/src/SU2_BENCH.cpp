@@ -0,0 +1,104 @@
+/*!
+ * \file SU2_BENCH.cpp
+ * \brief Main file of the benchmark of the computational kernels (SU2_BENCH).
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "../include/SU2_CFD.hpp"
+
+using namespace std;
+
+int main(int argc, char *argv[]) {
+  
+  unsigned short nZone, nDim;
+  unsigned long nRepeat = 10;
+  char config_file_name[MAX_STRING_SIZE];
+  bool periodic = false;
+  
+  /*--- MPI initialization, and buffer setting ---*/
+  
+#ifdef HAVE_MPI
+  int  buffsize;
+  char *buffptr;
+  SU2_MPI::Init(&argc, &argv);
+  SU2_MPI::Buffer_attach( malloc(BUFSIZE), BUFSIZE );
+  SU2_Comm MPICommunicator(MPI_COMM_WORLD);
+#else
+  SU2_Comm MPICommunicator(0);
+#endif
+  
+  /*--- Usage: SU2_BENCH [config file] [number of repetitions of each kernel] ---*/
+  
+  if (argc >= 2) { strcpy(config_file_name, argv[1]); }
+  else { strcpy(config_file_name, "default.cfg"); }
+  if (argc >= 3) { nRepeat = atol(argv[2]); }
+  
+  /*--- Read the number of zones and dimensions of the mesh, as in SU2_CFD ---*/
+  
+  CConfig *config = NULL;
+  config = new CConfig(config_file_name, SU2_CFD);
+  nZone    = CConfig::GetnZone(config->GetMesh_FileName(), config->GetMesh_FileFormat(), config);
+  nDim     = CConfig::GetnDim(config->GetMesh_FileName(), config->GetMesh_FileFormat());
+  periodic = CConfig::GetPeriodic(config->GetMesh_FileName(), config->GetMesh_FileFormat(), config);
+  
+  if ((nZone > 1) || (config->GetKind_Solver() == MULTIZONE)) {
+    SU2_MPI::Error("SU2_BENCH only supports single zone problems.", CURRENT_FUNCTION);
+  }
+  
+  delete config;
+  config = NULL;
+  
+  /*--- The driver performs the usual preprocessing of SU2_CFD, then times the kernels ---*/
+  
+  CBenchmarkDriver *driver = new CBenchmarkDriver(config_file_name, nZone, nDim, periodic, MPICommunicator, nRepeat);
+  
+  driver->StartSolver();
+  
+  driver->Postprocessing();
+  
+  delete driver;
+  driver = NULL;
+  
+  /*--- Finalize MPI parallelization ---*/
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Buffer_detach(&buffptr, &buffsize);
+  free(buffptr);
+  SU2_MPI::Finalize();
+#endif
+  
+  return EXIT_SUCCESS;
+  
+}
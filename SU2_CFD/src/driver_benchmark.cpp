@@ -0,0 +1,413 @@
+/*!
+ * \file driver_benchmark.cpp
+ * \brief Driver for timing the computational kernels of a flow problem in isolation.
+ * \author SU2 Developers
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../include/driver_structure.hpp"
+#include "../include/definition_structure.hpp"
+
+/*--- Wall clock time, consistent with the timers of CDriver ---*/
+
+static passivedouble Bench_Clock(void) {
+#ifndef HAVE_MPI
+  return passivedouble(clock())/passivedouble(CLOCKS_PER_SEC);
+#else
+  return MPI_Wtime();
+#endif
+}
+
+CBenchmarkDriver::CBenchmarkDriver(char* confFile,
+                                   unsigned short val_nZone,
+                                   unsigned short val_nDim,
+                                   bool val_periodic,
+                                   SU2_Comm MPICommunicator,
+                                   unsigned long val_nRepeat) : CDriver(confFile,
+                                                                        val_nZone,
+                                                                        val_nDim,
+                                                                        val_periodic,
+                                                                        MPICommunicator) {
+
+  nRepeat = max(val_nRepeat, (unsigned long)1);
+
+}
+
+CBenchmarkDriver::~CBenchmarkDriver(void) {
+
+}
+
+void CBenchmarkDriver::StartSolver() {
+
+  unsigned short iKernel;
+  CConfig *config = config_container[ZONE_0];
+  CSolver **solver = solver_container[ZONE_0][INST_0][MESH_0];
+
+  if ((solver[FLOW_SOL] == NULL) || fem_solver)
+    SU2_MPI::Error("SU2_BENCH requires a finite volume flow solver (EULER, NAVIER_STOKES, RANS, ...).", CURRENT_FUNCTION);
+
+  if (rank == MASTER_NODE) {
+    cout << endl <<"----------------------------- Begin Benchmark ---------------------------" << endl;
+    cout << "Each kernel is called " << nRepeat << " times on " << size << " rank(s)." << endl;
+  }
+
+  /*--- One preprocessing of the flow solver sets the primitive variables,
+   the spectral radius and the time step used by the kernels ---*/
+
+  solver[FLOW_SOL]->Preprocessing(geometry_container[ZONE_0][INST_0][MESH_0], solver, config, MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+  solver[FLOW_SOL]->SetTime_Step(geometry_container[ZONE_0][INST_0][MESH_0], solver, config, MESH_0, 0);
+
+  Benchmark_Numerics();
+  Benchmark_LinearSolver();
+  Benchmark_Gemm();
+  Benchmark_Comms();
+
+  /*--- Print the results and write them in a file that can be compared between versions ---*/
+
+  if (rank == MASTER_NODE) {
+
+    cout << endl << setw(40) << left << "Kernel" << setw(16) << right << "Time/call [s]" << setw(16) << "Throughput" << "  Unit" << endl;
+    for (iKernel = 0; iKernel < Bench_Kernel.size(); iKernel++) {
+      cout << setw(40) << left << Bench_Kernel[iKernel] << right << scientific << setprecision(4);
+      cout << setw(16) << Bench_Time[iKernel] << setw(16) << Bench_Throughput[iKernel] << "  " << Bench_Unit[iKernel] << endl;
+    }
+    cout.unsetf(ios::floatfield);
+
+    ofstream Bench_File("benchmark.csv");
+    Bench_File << "\"Kernel\",\"Time_Per_Call\",\"Throughput\",\"Unit\"" << endl;
+    Bench_File << scientific << setprecision(6);
+    for (iKernel = 0; iKernel < Bench_Kernel.size(); iKernel++)
+      Bench_File << "\"" << Bench_Kernel[iKernel] << "\"," << Bench_Time[iKernel] << "," << Bench_Throughput[iKernel] << ",\"" << Bench_Unit[iKernel] << "\"" << endl;
+    Bench_File.close();
+
+    cout << endl << "Results written in benchmark.csv." << endl;
+    cout << endl <<"------------------------------ End Benchmark ----------------------------" << endl;
+
+  }
+
+}
+
+void CBenchmarkDriver::SetResult(string val_kernel, unsigned long val_nCalls, passivedouble val_time,
+                                 passivedouble val_work, passivedouble val_scale, string val_unit) {
+
+  passivedouble MaxTime = val_time, TotWork = val_work;
+
+  /*--- The slowest rank sets the time, the work is that of all the ranks ---*/
+
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Allreduce(&val_time, &MaxTime, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  CBaseMPIWrapper::Allreduce(&val_work, &TotWork, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+  MaxTime = max(MaxTime, passivedouble(EPS));
+
+  Bench_Kernel.push_back(val_kernel);
+  Bench_Unit.push_back(val_unit);
+  Bench_Time.push_back(MaxTime/passivedouble(val_nCalls));
+  Bench_Throughput.push_back(TotWork*passivedouble(val_nCalls)/(MaxTime*val_scale));
+
+}
+
+void CBenchmarkDriver::Compute_Edge_Fluxes(CNumerics *numerics, CSysMatrix *matrix) {
+
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iVar;
+
+  CConfig *config = config_container[ZONE_0];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  unsigned short nVar = solver->GetnVar();
+
+  su2double *Residual = new su2double [nVar];
+  su2double *Und_Lapl = new su2double [nVar];
+  su2double **Jacobian_i = new su2double* [nVar];
+  su2double **Jacobian_j = new su2double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    Und_Lapl[iVar] = 0.0;
+    Jacobian_i[iVar] = new su2double [nVar];
+    Jacobian_j[iVar] = new su2double [nVar];
+  }
+
+  /*--- All the inputs of the centered and upwind schemes are set, such that any
+   scheme can be evaluated whatever the configured one (no reconstruction) ---*/
+
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+
+    iPoint = geometry->GetEdge_Node(iEdge,0); jPoint = geometry->GetEdge_Node(iEdge,1);
+
+    numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+    numerics->SetPrimitive(solver->node[iPoint]->GetPrimitive(), solver->node[jPoint]->GetPrimitive());
+    numerics->SetSecondary(solver->node[iPoint]->GetSecondary(), solver->node[jPoint]->GetSecondary());
+    numerics->SetLambda(solver->node[iPoint]->GetLambda(), solver->node[jPoint]->GetLambda());
+    numerics->SetUndivided_Laplacian(Und_Lapl, Und_Lapl);
+    numerics->SetSensor(0.0, 0.0);
+
+    numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+
+    if (matrix != NULL) {
+      matrix->AddBlock(iPoint, iPoint, Jacobian_i);
+      matrix->AddBlock(iPoint, jPoint, Jacobian_j);
+      matrix->SubtractBlock(jPoint, iPoint, Jacobian_i);
+      matrix->SubtractBlock(jPoint, jPoint, Jacobian_j);
+    }
+
+  }
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    delete [] Jacobian_i[iVar];
+    delete [] Jacobian_j[iVar];
+  }
+  delete [] Jacobian_i;
+  delete [] Jacobian_j;
+  delete [] Residual;
+  delete [] Und_Lapl;
+
+}
+
+void CBenchmarkDriver::Benchmark_Numerics(void) {
+
+  unsigned short iScheme, nScheme = 0;
+  unsigned long iRepeat;
+  passivedouble StartTime;
+  CNumerics *Scheme[16];
+  string Scheme_Name[16];
+
+  CConfig *config = config_container[ZONE_0];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+
+  /*--- Every scheme of the compressible ideal gas solver is evaluated, for the
+   other regimes and fluid models only the configured scheme is available ---*/
+
+  bool ideal_gas = ((config->GetKind_FluidModel() == STANDARD_AIR) || (config->GetKind_FluidModel() == IDEAL_GAS));
+  bool all_schemes = ((config->GetKind_Regime() == COMPRESSIBLE) && ideal_gas);
+
+  if (all_schemes) {
+    Scheme[nScheme] = new CCentJST_Flow(nDim, nVar, config);              Scheme_Name[nScheme++] = "JST";
+    Scheme[nScheme] = new CCentJST_KE_Flow(nDim, nVar, config);           Scheme_Name[nScheme++] = "JST_KE";
+    Scheme[nScheme] = new CCentLax_Flow(nDim, nVar, config);              Scheme_Name[nScheme++] = "LAX-FRIEDRICH";
+    Scheme[nScheme] = new CUpwRoe_Flow(nDim, nVar, config, false);        Scheme_Name[nScheme++] = "ROE";
+    Scheme[nScheme] = new CUpwL2Roe_Flow(nDim, nVar, config);             Scheme_Name[nScheme++] = "L2ROE";
+    Scheme[nScheme] = new CUpwLMRoe_Flow(nDim, nVar, config);             Scheme_Name[nScheme++] = "LMROE";
+    Scheme[nScheme] = new CUpwAUSM_Flow(nDim, nVar, config);              Scheme_Name[nScheme++] = "AUSM";
+    Scheme[nScheme] = new CUpwAUSMPLUSUP_Flow(nDim, nVar, config);        Scheme_Name[nScheme++] = "AUSMPLUSUP";
+    Scheme[nScheme] = new CUpwAUSMPLUSUP2_Flow(nDim, nVar, config);       Scheme_Name[nScheme++] = "AUSMPLUSUP2";
+    Scheme[nScheme] = new CUpwSLAU_Flow(nDim, nVar, config, false);       Scheme_Name[nScheme++] = "SLAU";
+    Scheme[nScheme] = new CUpwSLAU2_Flow(nDim, nVar, config, false);      Scheme_Name[nScheme++] = "SLAU2";
+    Scheme[nScheme] = new CUpwHLLC_Flow(nDim, nVar, config);              Scheme_Name[nScheme++] = "HLLC";
+    Scheme[nScheme] = new CUpwMSW_Flow(nDim, nVar, config);               Scheme_Name[nScheme++] = "MSW";
+    Scheme[nScheme] = new CUpwCUSP_Flow(nDim, nVar, config);              Scheme_Name[nScheme++] = "CUSP";
+  }
+  else {
+    Scheme[nScheme] = numerics_container[ZONE_0][INST_0][MESH_0][FLOW_SOL][CONV_TERM];
+    Scheme_Name[nScheme++] = "CONV_NUM_METHOD_FLOW";
+  }
+
+  for (iScheme = 0; iScheme < nScheme; iScheme++) {
+
+    /*--- One untimed sweep to warm up the caches ---*/
+
+    Compute_Edge_Fluxes(Scheme[iScheme], NULL);
+
+    StartTime = Bench_Clock();
+    for (iRepeat = 0; iRepeat < nRepeat; iRepeat++)
+      Compute_Edge_Fluxes(Scheme[iScheme], NULL);
+
+    SetResult("ComputeResidual_"+Scheme_Name[iScheme], nRepeat, Bench_Clock()-StartTime,
+              passivedouble(geometry->GetnEdge()), 1.0E6, "Medge/s");
+
+  }
+
+  if (all_schemes) {
+    for (iScheme = 0; iScheme < nScheme; iScheme++)
+      delete Scheme[iScheme];
+  }
+
+}
+
+void CBenchmarkDriver::Benchmark_LinearSolver(void) {
+
+  unsigned short iKind, nVar;
+  unsigned long iPoint, iRepeat, nPoint, nPointDomain, nNonZero = 0;
+  passivedouble StartTime, ElapsedTime, MatrixBytes, VectorBytes;
+  unsigned short Prec_Kind[3] = {JACOBI, ILU, LU_SGS};
+  string Prec_Name[3] = {"Jacobi", "ILU", "LU_SGS"};
+  CSysMatrix *Matrix;
+
+  CConfig *config = config_container[ZONE_0];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  CNumerics *numerics = numerics_container[ZONE_0][INST_0][MESH_0][FLOW_SOL][CONV_TERM];
+  unsigned short Kind_Prec = config->GetKind_Linear_Solver_Prec();
+
+  nVar = solver->GetnVar();
+  nPoint = geometry->GetnPoint();
+  nPointDomain = geometry->GetnPointDomain();
+
+  CSysVector Vec(nPoint, nPointDomain, nVar, 1.0);
+  CSysVector Prod(nPoint, nPointDomain, nVar, 0.0);
+
+  /*--- Block nonzeros of the rows owned by this rank (first neighbors) ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    nNonZero += geometry->node[iPoint]->GetnPoint()+1;
+
+  MatrixBytes = passivedouble(nNonZero)*(nVar*nVar*sizeof(su2double)+sizeof(unsigned long));
+  VectorBytes = passivedouble(nPoint+nPointDomain)*nVar*sizeof(su2double);
+
+  /*--- The memory of the preconditioners depends on the configured one, a
+   matrix with the flow Jacobian is therefore assembled for each of them ---*/
+
+  for (iKind = 0; iKind < 3; iKind++) {
+
+    config->SetKind_Linear_Solver_Prec(Prec_Kind[iKind]);
+
+    Matrix = new CSysMatrix();
+    Matrix->Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+
+    StartTime = Bench_Clock();
+    Compute_Edge_Fluxes(numerics, Matrix);
+    if (iKind == 0)
+      SetResult("Jacobian_Assembly", 1, Bench_Clock()-StartTime, passivedouble(geometry->GetnEdge()), 1.0E6, "Medge/s");
+
+    /*--- Pseudo time term, to have the diagonal dominance of an actual implicit iteration ---*/
+
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      Matrix->AddVal2Diag(iPoint, geometry->node[iPoint]->GetVolume()/max(solver->node[iPoint]->GetDelta_Time(), su2double(EPS)));
+
+    if (iKind == 0) {
+      StartTime = Bench_Clock();
+      for (iRepeat = 0; iRepeat < nRepeat; iRepeat++)
+        Matrix->MatrixVectorProduct(Vec, Prod, geometry, config);
+      ElapsedTime = Bench_Clock()-StartTime;
+      SetResult("MatrixVectorProduct", nRepeat, ElapsedTime, 2.0*nNonZero*nVar*nVar, 1.0E9, "GFLOP/s");
+      SetResult("MatrixVectorProduct", nRepeat, ElapsedTime, MatrixBytes+VectorBytes, 1.0E9, "GB/s");
+    }
+
+    if (Prec_Kind[iKind] != LU_SGS) {
+      StartTime = Bench_Clock();
+      for (iRepeat = 0; iRepeat < nRepeat; iRepeat++) {
+        if (Prec_Kind[iKind] == JACOBI) Matrix->BuildJacobiPreconditioner();
+        else Matrix->BuildILUPreconditioner();
+      }
+      SetResult(Prec_Name[iKind]+"_Build", nRepeat, Bench_Clock()-StartTime, passivedouble(nPointDomain), 1.0E6, "Mrow/s");
+    }
+
+    StartTime = Bench_Clock();
+    for (iRepeat = 0; iRepeat < nRepeat; iRepeat++) {
+      switch (Prec_Kind[iKind]) {
+        case JACOBI: Matrix->ComputeJacobiPreconditioner(Vec, Prod, geometry, config); break;
+        case ILU:    Matrix->ComputeILUPreconditioner(Vec, Prod, geometry, config); break;
+        case LU_SGS: Matrix->ComputeLU_SGSPreconditioner(Vec, Prod, geometry, config); break;
+      }
+    }
+    SetResult(Prec_Name[iKind]+"_Apply", nRepeat, Bench_Clock()-StartTime, passivedouble(nPointDomain), 1.0E6, "Mrow/s");
+
+    delete Matrix;
+
+  }
+
+  config->SetKind_Linear_Solver_Prec(Kind_Prec);
+
+}
+
+void CBenchmarkDriver::Benchmark_Gemm(void) {
+
+  unsigned short iDim, nPoly;
+  unsigned long iCall, nCalls = 100*nRepeat, i;
+  int M, N, K, nDOFs, nInt;
+  passivedouble StartTime;
+  ostringstream Kernel_Name;
+  CBlasStructure blas;
+
+  CConfig *config = config_container[ZONE_0];
+
+  /*--- Sizes of the products of the DG-FEM residual on hexahedra (quadrilaterals in 2D):
+   the basis functions and their gradients in the integration points times the solution
+   in the DOFs, with an integration rule that is exact for polynomials of degree 2p+2 ---*/
+
+  for (nPoly = 1; nPoly <= 4; nPoly++) {
+
+    nDOFs = 1; nInt = 1;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      nDOFs *= nPoly+1;
+      nInt  *= nPoly+2;
+    }
+
+    M = nInt*(nDim+1); N = nDim+2; K = nDOFs;
+
+    vector<su2double> A(M*K), B(K*N), C(M*N);
+    for (i = 0; i < A.size(); i++) A[i] = 1.0/(1.0+i);
+    for (i = 0; i < B.size(); i++) B[i] = 1.0/(2.0+i);
+
+    StartTime = Bench_Clock();
+    for (iCall = 0; iCall < nCalls; iCall++)
+      blas.gemm(M, N, K, &A[0], &B[0], &C[0], config);
+
+    Kernel_Name.str("");
+    Kernel_Name << "gemm_P" << nPoly << "_" << M << "x" << N << "x" << K;
+    SetResult(Kernel_Name.str(), nCalls, Bench_Clock()-StartTime, 2.0*M*N*K, 1.0E9, "GFLOP/s");
+
+  }
+
+}
+
+void CBenchmarkDriver::Benchmark_Comms(void) {
+
+  unsigned short iMarker;
+  unsigned long iRepeat, nVertexSend = 0;
+  passivedouble StartTime;
+
+  CConfig *config = config_container[ZONE_0];
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  CSolver *solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+
+  if (size == SINGLE_NODE) return;
+
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0))
+      nVertexSend += geometry->nVertex[iMarker];
+  }
+
+  StartTime = Bench_Clock();
+  for (iRepeat = 0; iRepeat < nRepeat; iRepeat++) {
+    solver->InitiateComms(geometry, config, SOLUTION);
+    solver->CompleteComms(geometry, config, SOLUTION);
+  }
+  SetResult("Halo_Exchange_Solution", nRepeat, Bench_Clock()-StartTime,
+            passivedouble(nVertexSend)*solver->GetnVar()*sizeof(su2double), 1.0E9, "GB/s");
+
+}
@@ -561,6 +561,11 @@ void CMultizoneDriver::Output(unsigned long TimeIter) {
     if (config_container[ZONE_0]->GetnExtIter() - 1 == ExtIter) output_files = true;
   }
 
+  /*--- The surface history is written with its own frequency, independently
+   of the solution files and without the sorting of the output data. ---*/
+
+  output->SetSurface_History(solver_container, geometry_container, config_container, TimeIter, nZone);
+
   /*--- write the solution ---*/
 
   if (output_files) {
@@ -37,11 +37,44 @@
 
 #include "../include/driver_structure.hpp"
 #include "../include/definition_structure.hpp"
+#include "../../Common/include/comm_profiler.hpp"
 
 #ifdef VTUNEPROF
 #include <ittnotify.h>
 #endif
 
+#if defined(__linux__) || defined(__APPLE__)
+#include <unistd.h>
+#include <sys/resource.h>
+#endif
+
+/*--- Resident memory of this process in bytes, used to attribute the memory
+ to the preprocessing stages. Where the current value is not available the
+ peak value is used, and zero on unsupported platforms. ---*/
+
+static unsigned long GetResidentMemory(void) {
+#if defined(__linux__)
+  unsigned long nPages_Total = 0, nPages_Resident = 0;
+  ifstream statm("/proc/self/statm");
+  if (statm >> nPages_Total >> nPages_Resident)
+    return nPages_Resident*(unsigned long)sysconf(_SC_PAGESIZE);
+  return 0;
+#elif defined(__APPLE__)
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return (unsigned long)usage.ru_maxrss;
+#else
+  return 0;
+#endif
+}
+
+/*--- Growth of the resident memory since val_start, negative changes count as zero. ---*/
+
+static unsigned long GetMemoryGrowth(unsigned long val_start) {
+  const unsigned long current = GetResidentMemory();
+  return (current > val_start)? current - val_start : 0;
+}
+
 CDriver::CDriver(char* confFile,
                  unsigned short val_nZone,
                  unsigned short val_nDim,
@@ -52,6 +85,7 @@ CDriver::CDriver(char* confFile,
   unsigned short jZone, iSol;
   unsigned short Kind_Grid_Movement;
   bool initStaticMovement;
+  unsigned long Memory_Start, Memory_Stage[4] = {0, 0, 0, 0};
 
   SU2_MPI::SetComm(MPICommunicator);
 
@@ -94,6 +128,7 @@ CDriver::CDriver(char* confFile,
   solver_container               = new CSolver****[nZone];
   integration_container          = new CIntegration***[nZone];
   numerics_container             = new CNumerics*****[nZone];
+  numerics_Threads.resize(nZone);
   config_container               = new CConfig*[nZone];
   geometry_container             = new CGeometry***[nZone];
   surface_movement               = new CSurfaceMovement*[nZone];
@@ -134,6 +169,8 @@ CDriver::CDriver(char* confFile,
   if (rank == MASTER_NODE)
     cout << endl <<"------------------------- Geometry Preprocessing ------------------------" << endl;
 
+  Memory_Start = GetResidentMemory();
+
   /*--- Determine whether or not the FEM solver is used, which decides the
    type of geometry classes that are instantiated. Only adapted for single-zone problems ---*/
   fem_solver = ((config_container[ZONE_0]->GetKind_Solver() == FEM_EULER)          ||
@@ -191,6 +228,8 @@ CDriver::CDriver(char* confFile,
 
   }
 
+  Memory_Stage[0] = GetMemoryGrowth(Memory_Start);
+
   /*--- If activated by the compile directive, perform a partition analysis. ---*/
 #if PARTITION
   if( fem_solver ) Partition_Analysis_FEM(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0]);
@@ -286,6 +325,8 @@ CDriver::CDriver(char* confFile,
     if (rank == MASTER_NODE)
       cout << endl <<"------------------------- Solver Preprocessing --------------------------" << endl;
 
+    Memory_Start = GetResidentMemory();
+
     solver_container[iZone] = new CSolver*** [nInst[iZone]];
 
 
@@ -307,9 +348,13 @@ CDriver::CDriver(char* confFile,
 
     } // End of loop over iInst
 
+    Memory_Stage[1] += GetMemoryGrowth(Memory_Start);
+
     if (rank == MASTER_NODE)
       cout << endl <<"----------------- Integration and Numerics Preprocessing ----------------" << endl;
 
+    Memory_Start = GetResidentMemory();
+
     /*--- Definition of the integration class: integration_container[#ZONES][#INSTANCES][#EQ_SYSTEMS].
      The integration class orchestrates the execution of the spatial integration
      subroutines contained in the solver class (including multigrid) for computing
@@ -344,8 +389,12 @@ CDriver::CDriver(char* confFile,
           geometry_container[iZone], config_container[iZone], iInst);
     }
 
+    Numerics_Threads_Preprocessing(iZone);
+
     if (rank == MASTER_NODE) cout << "Numerics Preprocessing." << endl;
 
+    Memory_Stage[2] += GetMemoryGrowth(Memory_Start);
+
   }
 
   /*--- Definition of the interface and transfer conditions between different zones.
@@ -475,6 +524,8 @@ CDriver::CDriver(char* confFile,
    surface comma-separated value, and convergence history files (both in serial
    and in parallel). ---*/
 
+  Memory_Start = GetResidentMemory();
+
   output = new COutput(config_container[ZONE_0]);
 
   /*--- Open the convergence history file ---*/
@@ -490,6 +541,11 @@ CDriver::CDriver(char* confFile,
       }
     }
   }
+
+  Memory_Stage[3] = GetMemoryGrowth(Memory_Start);
+
+  Memory_Report(Memory_Stage);
+
   /*--- Check for an unsteady restart. Update ExtIter if necessary. ---*/
   if (config_container[ZONE_0]->GetWrt_Unsteady() && config_container[ZONE_0]->GetRestart())
     ExtIter = config_container[ZONE_0]->GetUnst_RestartIter();
@@ -589,6 +645,7 @@ void CDriver::Postprocessing() {
           geometry_container[iZone][iInst], config_container[iZone], iInst);
     }
     delete [] numerics_container[iZone];
+    Numerics_Threads_Postprocessing(iZone);
   }
   delete [] numerics_container;
   if (rank == MASTER_NODE) cout << "Deleted CNumerics container." << endl;
@@ -697,6 +754,7 @@ void CDriver::Postprocessing() {
 
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
+  CCommProfiler::WriteCSV();
 
   /*--- Deallocate config container ---*/
   if (config_container!= NULL) {
@@ -779,6 +837,64 @@ void CDriver::Postprocessing() {
 }
 
 
+void CDriver::Memory_Report(const unsigned long *val_memory) {
+
+  unsigned short iZone, iInst, iMesh, iSol;
+  unsigned long Memory_Jacobian = 0, Memory_Precond = 0;
+
+  /*--- The linear systems are allocated by the solvers, their share is
+   accounted exactly and the remainder of the solver stage is attributed
+   to the solver variables (nodes) and other per-point data. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (solver_container[iZone] == NULL) continue;
+    for (iInst = 0; iInst < nInst[iZone]; iInst++) {
+      if (solver_container[iZone][iInst] == NULL) continue;
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        if (solver_container[iZone][iInst][iMesh] == NULL) continue;
+        for (iSol = 0; iSol < MAX_SOLS; iSol++) {
+          CSolver *solver = solver_container[iZone][iInst][iMesh][iSol];
+          if (solver == NULL) continue;
+          Memory_Jacobian += solver->Jacobian.GetMatrixMemory() + solver->StiffMatrix.GetMatrixMemory();
+          Memory_Precond  += solver->Jacobian.GetPreconditionerMemory() + solver->StiffMatrix.GetPreconditionerMemory();
+        }
+      }
+    }
+  }
+
+  const unsigned long Memory_Linear = Memory_Jacobian + Memory_Precond;
+
+  unsigned long Memory_Local[6] = {val_memory[0],
+    (val_memory[1] > Memory_Linear)? val_memory[1] - Memory_Linear : 0,
+    Memory_Jacobian, Memory_Precond, val_memory[2], val_memory[3]};
+  unsigned long Memory_Sum[6], Memory_Max[6];
+
+  SU2_MPI::Reduce(Memory_Local, Memory_Sum, 6, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Reduce(Memory_Local, Memory_Max, 6, MPI_UNSIGNED_LONG, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+
+  if (rank == MASTER_NODE) {
+    const char *Subsystem[6] = {"Geometry:", "Solver variables:", "Jacobians:",
+                                "Preconditioners:", "Numerics:", "Output:"};
+    const su2double MB = 1024.0*1024.0;
+    su2double Total_Sum = 0.0, Total_Max = 0.0;
+
+    cout.precision(6);
+    cout << endl <<"---------------------------- Memory Summary -----------------------------" << endl;
+    cout << setw(25) << "Subsystem" << setw(12) << "Total (MB)" << " | ";
+    cout << setw(20) << "Max. per core (MB)" << endl;
+    for (unsigned short iSub = 0; iSub < 6; iSub++) {
+      cout << setw(25) << Subsystem[iSub] << setw(12) << su2double(Memory_Sum[iSub])/MB << " | ";
+      cout << setw(20) << su2double(Memory_Max[iSub])/MB << endl;
+      Total_Sum += su2double(Memory_Sum[iSub])/MB;
+      Total_Max += su2double(Memory_Max[iSub])/MB;
+    }
+    cout << setw(25) << "Total:" << setw(12) << Total_Sum << " | ";
+    cout << setw(20) << Total_Max << endl;
+    cout << "-------------------------------------------------------------------------" << endl;
+  }
+
+}
+
 void CDriver::Input_Preprocessing(SU2_Comm MPICommunicator, bool val_periodic) {
 
   char zone_file_name[MAX_STRING_SIZE];
@@ -930,9 +1046,12 @@ void CDriver::Geometrical_Preprocessing() {
       if (rank == MASTER_NODE) cout << "Setting point connectivity." << endl;
       geometry_container[iZone][iInst][MESH_0]->SetPoint_Connectivity();
 
-      /*--- Renumbering points using Reverse Cuthill McKee ordering ---*/
+      /*--- Renumbering points using Reverse Cuthill McKee ordering, or a Hilbert curve ---*/
 
-      if (rank == MASTER_NODE) cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      if (rank == MASTER_NODE) {
+        if (config_container[iZone]->GetKind_Point_Ordering() == HILBERT_ORDERING) cout << "Renumbering points (Hilbert Curve Ordering)." << endl;
+        else cout << "Renumbering points (Reverse Cuthill McKee Ordering)." << endl;
+      }
       geometry_container[iZone][iInst][MESH_0]->SetRCM_Ordering(config_container[iZone]);
 
       /*--- recompute elements surrounding points, points surrounding points ---*/
@@ -960,6 +1079,11 @@ void CDriver::Geometrical_Preprocessing() {
       geometry_container[iZone][iInst][MESH_0]->SetEdges();
       geometry_container[iZone][iInst][MESH_0]->SetVertex(config_container[iZone]);
 
+      /*--- Group the edges in colors for conflict free edge loops ---*/
+
+      if ((rank == MASTER_NODE) && config_container[iZone]->GetEdge_Coloring()) cout << "Coloring the edges." << endl;
+      geometry_container[iZone][iInst][MESH_0]->SetEdgeColoring(config_container[iZone]);
+
       /*--- Compute cell center of gravity ---*/
 
       if ((rank == MASTER_NODE) && (!fea)) cout << "Computing centers of gravity." << endl;
@@ -1033,6 +1157,7 @@ void CDriver::Geometrical_Preprocessing() {
 
         geometry_container[iZone][iInst][iMGlevel]->SetEdges();
         geometry_container[iZone][iInst][iMGlevel]->SetVertex(geometry_container[iZone][iInst][iMGlevel-1], config_container[iZone]);
+        geometry_container[iZone][iInst][iMGlevel]->SetEdgeColoring(config_container[iZone]);
 
         /*--- Create the control volume structures ---*/
 
@@ -1853,7 +1978,10 @@ void CDriver::Integration_Preprocessing(CIntegration ***integration_container,
   if (adj_ns) integration_container[val_iInst][ADJFLOW_SOL] = new CMultiGridIntegration(config);
   if (adj_turb) integration_container[val_iInst][ADJTURB_SOL] = new CSingleGridIntegration(config);
 
-  if (disc_adj) integration_container[val_iInst][ADJFLOW_SOL] = new CIntegration(config);
+  if (disc_adj) {
+    if (config->GetDiscAdj_MultiGrid()) integration_container[val_iInst][ADJFLOW_SOL] = new CMultiGridIntegration(config);
+    else integration_container[val_iInst][ADJFLOW_SOL] = new CIntegration(config);
+  }
   if (disc_adj_fem) integration_container[val_iInst][ADJFEA_SOL] = new CIntegration(config);
   if (disc_adj_heat) integration_container[val_iInst][ADJHEAT_SOL] = new CIntegration(config);
 
@@ -2759,6 +2887,58 @@ void CDriver::Numerics_Preprocessing(CNumerics *****numerics_container,
 
 }
 
+void CDriver::Numerics_Threads_Preprocessing(unsigned short val_iZone) {
+
+  unsigned short iThread, iInstance;
+
+  CConfig *config = config_container[val_iZone];
+  unsigned short nThreads = config->GetnThreads_Flow();
+
+  bool flow = ((config->GetKind_Regime() == COMPRESSIBLE) &&
+               ((config->GetKind_Solver() == EULER) || (config->GetKind_Solver() == NAVIER_STOKES) ||
+                (config->GetKind_Solver() == RANS)));
+
+  if (!flow || (nThreads < 2)) return;
+
+  /*--- The numerics store the data of the edge that is being computed, hence every
+   additional thread gets a full copy of the numerics of the zone. Only the convective
+   numerics of the flow on the finest grid are used by the threads. ---*/
+
+  numerics_Threads[val_iZone].assign(nThreads, (CNumerics *****) NULL);
+
+  for (iThread = 1; iThread < nThreads; iThread++) {
+    numerics_Threads[val_iZone][iThread] = new CNumerics****[nInst[val_iZone]];
+    for (iInstance = 0; iInstance < nInst[val_iZone]; iInstance++) {
+      numerics_Threads[val_iZone][iThread][iInstance] = new CNumerics***[config->GetnMGLevels()+1];
+      Numerics_Preprocessing(numerics_Threads[val_iZone][iThread], solver_container[val_iZone],
+                             geometry_container[val_iZone], config, iInstance);
+    }
+  }
+
+  for (iInstance = 0; iInstance < nInst[val_iZone]; iInstance++) {
+    vector<CNumerics *> conv_numerics(nThreads, (CNumerics *) NULL);
+    for (iThread = 1; iThread < nThreads; iThread++)
+      conv_numerics[iThread] = numerics_Threads[val_iZone][iThread][iInstance][MESH_0][FLOW_SOL][CONV_TERM];
+    solver_container[val_iZone][iInstance][MESH_0][FLOW_SOL]->SetUp_EdgeThreads(geometry_container[val_iZone][iInstance][MESH_0],
+                                                                                config, conv_numerics);
+  }
+
+}
+
+void CDriver::Numerics_Threads_Postprocessing(unsigned short val_iZone) {
+
+  unsigned short iThread, iInstance;
+
+  for (iThread = 1; iThread < numerics_Threads[val_iZone].size(); iThread++) {
+    for (iInstance = 0; iInstance < nInst[val_iZone]; iInstance++)
+      Numerics_Postprocessing(numerics_Threads[val_iZone][iThread], solver_container[val_iZone][iInstance],
+                              geometry_container[val_iZone][iInstance], config_container[val_iZone], iInstance);
+    delete [] numerics_Threads[val_iZone][iThread];
+  }
+  numerics_Threads[val_iZone].clear();
+
+}
+
 void CDriver::Numerics_Postprocessing(CNumerics *****numerics_container,
                                       CSolver ***solver_container, CGeometry **geometry,
                                       CConfig *config, unsigned short val_iInst) {
@@ -3782,12 +3962,16 @@ void CDriver::StartSolver(){
 
     /*--- Run a single iteration of the problem (fluid, elasticity, heat, ...). ---*/
 
+    CCommProfiler::BeginIteration();
+
     Run();
 
     /*--- Update the solution for dual time stepping strategy ---*/
 
     Update();
 
+    CCommProfiler::EndIteration();
+
     /*--- Terminate the simulation if only the Jacobian must be computed. ---*/
     if (config_container[ZONE_0]->GetJacobian_Spatial_Discretization_Only()) break;
 
@@ -3874,11 +4058,14 @@ bool CDriver::Monitor(unsigned long ExtIter) {
   /*--- Update the convergence history file (serial and parallel computations). ---*/
   
   if (!fsi) {
+    double tick = 0.0;
+    config_container[ZONE_0]->Tick(&tick);
     for (iZone = 0; iZone < nZone; iZone++) {
       for (iInst = 0; iInst < nInst[iZone]; iInst++)
         output->SetConvHistory_Body(&ConvHist_file[iZone][iInst], geometry_container, solver_container,
             config_container, integration_container, false, UsedTime, iZone, iInst);
     }
+    config_container[ZONE_0]->Tock(tick, "COutput::SetConvHistory_Body", PROFILE_OUTPUT);
   }
 
   /*--- Evaluate the new CFL number (adaptive). ---*/
@@ -3968,6 +4155,11 @@ void CDriver::Output(unsigned long ExtIter) {
     if (config_container[ZONE_0]->GetnExtIter()-config_container[ZONE_0]->GetIter_dCL_dAlpha() - 1 < ExtIter) output_files = false;
     if (config_container[ZONE_0]->GetnExtIter() - 1 == ExtIter) output_files = true;
   }
+
+  /*--- The surface history is written with its own frequency, independently
+   of the solution files and without the sorting of the output data. ---*/
+
+  output->SetSurface_History(solver_container, geometry_container, config_container, ExtIter, nZone);
   
   /*--- write the solution ---*/
   
@@ -4000,8 +4192,18 @@ void CDriver::Output(unsigned long ExtIter) {
     /*--- Execute the routine for writing restart, volume solution,
      surface solution, and surface comma-separated value files. ---*/
     
+    double tick = 0.0;
+    config_container[ZONE_0]->Tick(&tick);
+    
     output->SetResult_Files_Parallel(solver_container, geometry_container, config_container, ExtIter, nZone);
     
+    config_container[ZONE_0]->Tock(tick, "COutput::SetResult_Files_Parallel", PROFILE_OUTPUT);
+    
+    /*--- Derivatives of the coefficients in all the tangent directions (vector forward mode). ---*/
+    
+    if ((config_container[ZONE_0]->GetDirectDiff() == D_DESIGN) &&
+        (config_container[ZONE_0]->GetDirectDiff_Directions() > 1))
+      output->SetDirectDiff_Directions(solver_container, config_container, ZONE_0);
     
     if (rank == MASTER_NODE) cout << "-------------------------------------------------------------------------" << endl << endl;
     
@@ -4029,6 +4231,12 @@ void CDriver::Output(unsigned long ExtIter) {
 
 }
 
+void CDriver::SetInSitu_Adaptor(CInSituAdaptor *adaptor) {
+
+  output->SetInSitu_Adaptor(adaptor);
+
+}
+
 CDriver::~CDriver(void) {}
 
 CGeneralDriver::CGeneralDriver(char* confFile, unsigned short val_nZone,
@@ -4094,6 +4302,84 @@ CFluidDriver::CFluidDriver(char* confFile, unsigned short val_nZone, unsigned sh
 
 CFluidDriver::~CFluidDriver(void) { }
 
+void CFluidDriver::StartSolver() {
+
+  unsigned short iCond, nCond = config_container[ZONE_0]->GetnEnsemble();
+
+  if (nCond == 0) {
+    CDriver::StartSolver();
+    return;
+  }
+
+  if ((nZone > 1) || config_container[ZONE_0]->GetBoolTurbomachinery())
+    SU2_MPI::Error("An ensemble run is only available for single zone external flow problems.", CURRENT_FUNCTION);
+
+  /*--- The flow conditions are solved in turn with the same geometry, solver and numerics
+   containers, hence the grid is read, partitioned and preprocessed once. Each condition
+   starts from the solution of the previous one in the list. ---*/
+
+  for (iCond = 0; iCond < nCond; iCond++) {
+
+    if (iCond > 0) SetEnsemble_Condition(iCond);
+
+    if (rank == MASTER_NODE)
+      cout << endl << "Ensemble run, flow condition " << iCond+1 << " of " << nCond
+           << ": AoA " << config_container[ZONE_0]->GetAoA() << " deg, sideslip angle "
+           << config_container[ZONE_0]->GetAoS() << " deg." << endl;
+
+    CDriver::StartSolver();
+
+  }
+
+}
+
+void CFluidDriver::SetEnsemble_Condition(unsigned short iCond) {
+
+  unsigned short iDim;
+  CConfig *config = config_container[ZONE_0];
+  su2double *Vel = config->GetVelocity_FreeStream(), *VelND = config->GetVelocity_FreeStreamND();
+  su2double Vel_Mag = 0.0, VelND_Mag = 0.0, Dir[3] = {0.0, 0.0, 0.0};
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Vel_Mag   += Vel[iDim]*Vel[iDim];
+    VelND_Mag += VelND[iDim]*VelND[iDim];
+  }
+  Vel_Mag = sqrt(Vel_Mag); VelND_Mag = sqrt(VelND_Mag);
+
+  config->SetEnsemble_Condition(iCond);
+
+  /*--- Free-stream velocity with the new angles (as in SetNondimensionalization). The
+   flow solvers of all the grid levels use the velocity stored in config. ---*/
+
+  su2double Alpha = config->GetAoA()*PI_NUMBER/180.0;
+  su2double Beta  = config->GetAoS()*PI_NUMBER/180.0;
+
+  if (nDim == 2) {
+    Dir[0] = cos(Alpha); Dir[1] = sin(Alpha);
+  }
+  else {
+    Dir[0] = cos(Alpha)*cos(Beta); Dir[1] = sin(Beta); Dir[2] = sin(Alpha)*cos(Beta);
+  }
+
+  for (iDim = 0; iDim < nDim; iDim++) {
+    config->SetVelocity_FreeStream(Dir[iDim]*Vel_Mag, iDim);
+    config->SetVelocity_FreeStreamND(Dir[iDim]*VelND_Mag, iDim);
+  }
+
+  /*--- History file of this condition ---*/
+
+  if (rank == MASTER_NODE) {
+    ConvHist_file[ZONE_0][INST_0].close();
+    output->SetConvHistory_Header(&ConvHist_file[ZONE_0][INST_0], config, ZONE_0, INST_0);
+  }
+
+  integration_container[ZONE_0][INST_0][FLOW_SOL]->SetConvergence(false);
+
+  ExtIter  = 0;
+  StopCalc = false;
+
+}
+
 void CFluidDriver::Run() {
 
   unsigned short iZone, jZone, checkConvergence;
@@ -4428,6 +4714,7 @@ CDiscAdjFluidDriver::CDiscAdjFluidDriver(char* confFile,
                                                                                     MPICommunicator) {
 
   RecordingState = NONE;
+  Geometry_Tape_Reported = false;
   unsigned short iZone;
 
   direct_iteration = new CIteration*[nZone];
@@ -4439,6 +4726,27 @@ CDiscAdjFluidDriver::CDiscAdjFluidDriver(char* confFile,
     else{
       direct_iteration[iZone] = new CFluidIteration(config_container[iZone]);
     }
+    if ((config_container[iZone]->GetUnst_Adjoint_nCheckpoint() != 0) &&
+        (config_container[iZone]->GetKind_Solver() != DISC_ADJ_EULER) &&
+        (config_container[iZone]->GetKind_Solver() != DISC_ADJ_NAVIER_STOKES) &&
+        (config_container[iZone]->GetKind_Solver() != DISC_ADJ_RANS)) {
+      SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS is only available for the discrete adjoint flow solvers.", CURRENT_FUNCTION);
+    }
+    if ((config_container[iZone]->GetUnst_Adjoint_nCheckpoint() != 0) &&
+        (config_container[iZone]->GetKind_Solver() == DISC_ADJ_RANS) && config_container[iZone]->GetFrozen_Visc_Disc()) {
+      SU2_MPI::Error("UNST_ADJOINT_CHECKPOINTS requires FROZEN_VISC_DISC= NO to recompute the turbulence model.", CURRENT_FUNCTION);
+    }
+    if (config_container[iZone]->GetDiscAdj_Krylov() &&
+        ((nZone > 1) || config_container[iZone]->GetWeakly_Coupled_Heat() ||
+         ((config_container[iZone]->GetKind_Solver() != DISC_ADJ_EULER) &&
+          (config_container[iZone]->GetKind_Solver() != DISC_ADJ_NAVIER_STOKES) &&
+          (config_container[iZone]->GetKind_Solver() != DISC_ADJ_RANS)))) {
+      SU2_MPI::Error("DISCADJ_KRYLOV is only available for single zone discrete adjoint flow problems.", CURRENT_FUNCTION);
+    }
+    if (config_container[iZone]->GetDiscAdj_ObjSweep() &&
+        ((nZone > 1) || config_container[iZone]->GetBoolTurbomachinery())) {
+      SU2_MPI::Error("DISCADJ_OBJECTIVE_SWEEP is only available for single zone discrete adjoint flow problems.", CURRENT_FUNCTION);
+    }
   }
 
 }
@@ -4453,6 +4761,73 @@ CDiscAdjFluidDriver::~CDiscAdjFluidDriver(){
 
 }
 
+void CDiscAdjFluidDriver::StartSolver() {
+
+  unsigned short iObj, nObj = config_container[ZONE_0]->GetnObj();
+
+  if (!config_container[ZONE_0]->GetDiscAdj_ObjSweep()) {
+    CDriver::StartSolver();
+    return;
+  }
+
+  /*--- Every objective function is a separate output of the tape, the adjoint of each one
+   is converged in turn by seeding only that output, on the same primal solution. The adjoint
+   and sensitivity files are written with the extension of the current objective. ---*/
+
+  for (iObj = 0; iObj < nObj; iObj++) {
+
+    config_container[ZONE_0]->SetiObj_Sweep(iObj);
+
+    if (rank == MASTER_NODE)
+      cout << endl << "Discrete adjoint of the objective function " << iObj+1 << " of " << nObj << " ("
+           << config_container[ZONE_0]->GetObjFunc_Extension(config_container[ZONE_0]->GetRestart_AdjFileName()) << ")." << endl;
+
+    if (iObj > 0) ResetAdjoint_Sweep();
+
+    CDriver::StartSolver();
+
+  }
+
+}
+
+void CDiscAdjFluidDriver::ResetAdjoint_Sweep(void) {
+
+  unsigned short iMesh;
+  unsigned long iPoint;
+  bool turbulent = ((config_container[ZONE_0]->GetKind_Solver() == DISC_ADJ_RANS) && !config_container[ZONE_0]->GetFrozen_Visc_Disc());
+
+  iteration_container[ZONE_0][INST_0]->Anderson_Reset();
+
+  CSolver *adjflow_solver, *adjturb_solver = solver_container[ZONE_0][INST_0][MESH_0][ADJTURB_SOL];
+
+  for (iMesh = 0; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    adjflow_solver = solver_container[ZONE_0][INST_0][iMesh][ADJFLOW_SOL];
+    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][iMesh]->GetnPoint(); iPoint++) {
+      adjflow_solver->node[iPoint]->SetSolutionZero();
+      adjflow_solver->node[iPoint]->Set_OldSolution();
+    }
+  }
+
+  if (turbulent) {
+    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
+      adjturb_solver->node[iPoint]->SetSolutionZero();
+      adjturb_solver->node[iPoint]->Set_OldSolution();
+    }
+  }
+
+  /*--- The constant term of the Krylov solver depends on the seeded objective, if the
+   tape of the conservative variables is kept it is evaluated again here. ---*/
+
+  if (config_container[ZONE_0]->GetDiscAdj_Krylov() && (RecordingState == FLOW_CONS_VARS))
+    SetAdjoint_Krylov_RHS();
+
+  integration_container[ZONE_0][INST_0][ADJFLOW_SOL]->SetConvergence(false);
+
+  ExtIter  = 0;
+  StopCalc = false;
+
+}
+
 void CDiscAdjFluidDriver::Run() {
 
   unsigned short iZone = 0, checkConvergence;
@@ -4469,6 +4844,12 @@ void CDiscAdjFluidDriver::Run() {
   else
     nIntIter = 1;
 
+  /*--- For the unsteady adjoint with checkpoints, the direct solution is recomputed
+   in memory instead of being loaded from the restart files during the preprocessing. ---*/
+
+  if (unsteady && (config_container[ZONE_0]->GetUnst_Adjoint_nCheckpoint() != 0))
+    SetUnsteady_Checkpoint();
+
   for (iZone = 0; iZone < nZone; iZone++) {
 
     iteration_container[iZone][INST_0]->Preprocess(output, integration_container, geometry_container,
@@ -4492,8 +4873,17 @@ void CDiscAdjFluidDriver::Run() {
 
     SetRecording(FLOW_CONS_VARS);
 
+    if (config_container[ZONE_0]->GetDiscAdj_Krylov())
+      SetAdjoint_Krylov_RHS();
+
   }
 
+  /*--- With DISCADJ_KRYLOV, the tape only supplies the transposed Jacobian-vector products of FGMRES.
+   The fixed-point iteration below is still performed once to extract the sensitivities and the residuals. ---*/
+
+  if (config_container[ZONE_0]->GetDiscAdj_Krylov())
+    SetAdjoint_Krylov();
+
   for (IntIter = 0; IntIter < nIntIter; IntIter++) {
 
 
@@ -4545,11 +4935,14 @@ void CDiscAdjFluidDriver::Run() {
 
   }
 
-  /*--- Compute the geometrical sensitivities ---*/
+  /*--- Compute the geometrical sensitivities. Each evaluation replaces the flow tape by the geometry
+   tape, with DISCADJ_SENS_FINAL the steady adjoint keeps the flow tape until its last iteration. ---*/
+
+  bool sens_final = config_container[ZONE_0]->GetDiscAdj_Sens_Final() && !unsteady;
 
   if ((ExtIter+1 >= config_container[ZONE_0]->GetnExtIter()) ||
       integration_container[ZONE_0][INST_0][ADJFLOW_SOL]->GetConvergence() ||
-      (ExtIter % config_container[ZONE_0]->GetWrt_Sol_Freq() == 0) || unsteady){
+      (!sens_final && (ExtIter % config_container[ZONE_0]->GetWrt_Sol_Freq() == 0)) || unsteady){
 
     /*--- SetRecording stores the computational graph on one iteration of the direct problem. Calling it with NONE
      * as argument ensures that all information from a previous recording is removed. ---*/
@@ -4589,6 +4982,342 @@ void CDiscAdjFluidDriver::Run() {
   }
 }
 
+void CDiscAdjFluidDriver::SetCheckpoint(long val_iter) {
+
+  unsigned short iZone, iMesh, iSol, iVar, nVar;
+  unsigned long iPoint, iData = 0;
+  const unsigned short Sol_List[3] = {FLOW_SOL, TURB_SOL, HEAT_SOL};
+  CSolver *solver;
+  vector<passivedouble> Solution;
+
+  /*--- At the end of a time step the solution at time n is the current solution, the (second
+   order) dual time stepping also needs the solution at n-1 to restart from this time step. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+      for (iSol = 0; iSol < 3; iSol++) {
+        solver = solver_container[iZone][INST_0][iMesh][Sol_List[iSol]];
+        if (solver == NULL) continue;
+        nVar = solver->GetnVar();
+        Solution.resize(iData + 2*geometry_container[iZone][INST_0][iMesh]->GetnPoint()*nVar);
+        for (iPoint = 0; iPoint < geometry_container[iZone][INST_0][iMesh]->GetnPoint(); iPoint++) {
+          for (iVar = 0; iVar < nVar; iVar++) {
+            Solution[iData++] = SU2_TYPE::GetValue(solver->node[iPoint]->GetSolution(iVar));
+            Solution[iData++] = SU2_TYPE::GetValue(solver->node[iPoint]->GetSolution_time_n1()[iVar]);
+          }
+        }
+      }
+    }
+  }
+
+  Checkpoint_Iter.push_back(val_iter);
+  Checkpoint_Solution.push_back(Solution);
+
+}
+
+void CDiscAdjFluidDriver::LoadCheckpoint(void) {
+
+  unsigned short iZone, iMesh, iSol, iVar, nVar;
+  unsigned long iPoint, iData = 0;
+  const unsigned short Sol_List[3] = {FLOW_SOL, TURB_SOL, HEAT_SOL};
+  CSolver *solver;
+  vector<passivedouble> &Solution = Checkpoint_Solution.back();
+  vector<su2double> Solution_n, Solution_n1;
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+      for (iSol = 0; iSol < 3; iSol++) {
+        solver = solver_container[iZone][INST_0][iMesh][Sol_List[iSol]];
+        if (solver == NULL) continue;
+        nVar = solver->GetnVar();
+        Solution_n.resize(nVar);
+        Solution_n1.resize(nVar);
+        for (iPoint = 0; iPoint < geometry_container[iZone][INST_0][iMesh]->GetnPoint(); iPoint++) {
+          for (iVar = 0; iVar < nVar; iVar++) {
+            Solution_n[iVar]  = Solution[iData++];
+            Solution_n1[iVar] = Solution[iData++];
+          }
+          solver->node[iPoint]->SetSolution(&Solution_n[0]);
+          solver->node[iPoint]->Set_Solution_time_n(&Solution_n[0]);
+          solver->node[iPoint]->Set_Solution_time_n1(&Solution_n1[0]);
+        }
+      }
+    }
+  }
+
+}
+
+void CDiscAdjFluidDriver::DirectTimeStep(long val_iter, bool val_update) {
+
+  unsigned short iZone, jZone, iMesh, checkConvergence;
+  unsigned long IntIter, nIntIter = config_container[ZONE_0]->GetUnst_nIntIter();
+
+  if (rank == MASTER_NODE)
+    cout << " Recomputing flow solution of direct iteration " << val_iter << "." << endl;
+
+  /*--- The direct problem is not recorded, the time step is solved as in CFluidDriver::Run ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    config_container[iZone]->SetExtIter(val_iter);
+    direct_iteration[iZone]->Preprocess(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+  }
+
+  for (IntIter = 0; IntIter < nIntIter; IntIter++) {
+
+    for (iZone = 0; iZone < nZone; iZone++)
+      for (jZone = 0; jZone < nZone; jZone++)
+        if(jZone != iZone && transfer_container[iZone][jZone] != NULL)
+          Transfer_Data(iZone, jZone);
+
+    /*--- The flow solver does not reset its Jacobian in the discrete adjoint mode. ---*/
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+        solver_container[iZone][INST_0][iMesh][FLOW_SOL]->Jacobian.SetValZero();
+      config_container[iZone]->SetIntIter(IntIter);
+      direct_iteration[iZone]->Iterate(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    }
+
+    checkConvergence = 0;
+    for (iZone = 0; iZone < nZone; iZone++)
+      checkConvergence += (int) integration_container[iZone][INST_0][FLOW_SOL]->GetConvergence();
+
+    if (checkConvergence == nZone) break;
+
+  }
+
+  /*--- Shift the time levels (Solution -> time n -> time n-1) ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (val_update)
+      direct_iteration[iZone]->Update(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    integration_container[iZone][INST_0][FLOW_SOL]->SetConvergence(false);
+    config_container[iZone]->SetExtIter(ExtIter);
+  }
+
+}
+
+passivedouble CDiscAdjFluidDriver::GetBinomial_nStep(unsigned short val_nCheckpoint, unsigned long val_nRep) {
+
+  unsigned short iCheckpoint;
+  passivedouble nStep = 1.0;
+
+  for (iCheckpoint = 1; iCheckpoint <= val_nCheckpoint; iCheckpoint++)
+    nStep = nStep*passivedouble(val_nRep + iCheckpoint)/passivedouble(iCheckpoint);
+
+  return nStep;
+
+}
+
+void CDiscAdjFluidDriver::SetUnsteady_Checkpoint(void) {
+
+  unsigned short iZone, iMesh, iSol, nFree, nCheckpoint = config_container[ZONE_0]->GetUnst_Adjoint_nCheckpoint();
+  const unsigned short Sol_List[3] = {FLOW_SOL, TURB_SOL, HEAT_SOL};
+  unsigned long iPoint, nRep;
+  long Direct_Iter, Base_Iter, Target_Iter, nStep, nReverse, iStep;
+  CSolver *solver;
+
+  /*--- Direct time step of the current adjoint iteration (as in CDiscAdjFluidIteration::Preprocess),
+   it is obtained with one time step from the solution at the end of the previous one. ---*/
+
+  Direct_Iter = config_container[ZONE_0]->GetUnst_AdjointIter() - long(ExtIter) - 1;
+  Target_Iter = max(Direct_Iter - 1, long(-1));
+
+  /*--- The first checkpoint is the initial (freestream) condition, it is never released ---*/
+
+  if (Checkpoint_Iter.empty()) {
+    for (iZone = 0; iZone < nZone; iZone++) {
+      iteration_container[iZone][INST_0]->LoadUnsteady_Solution(geometry_container, solver_container, config_container, iZone, INST_0, -1);
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++) {
+        for (iSol = 0; iSol < 3; iSol++) {
+          solver = solver_container[iZone][INST_0][iMesh][Sol_List[iSol]];
+          if (solver == NULL) continue;
+          for (iPoint = 0; iPoint < geometry_container[iZone][INST_0][iMesh]->GetnPoint(); iPoint++) {
+            solver->node[iPoint]->Set_Solution_time_n();
+            solver->node[iPoint]->Set_Solution_time_n1();
+          }
+        }
+      }
+    }
+    SetCheckpoint(-1);
+  }
+
+  /*--- The reverse sweep never goes back to the checkpoints after the current time step ---*/
+
+  while (Checkpoint_Iter.back() > Target_Iter) {
+    Checkpoint_Iter.pop_back();
+    Checkpoint_Solution.pop_back();
+  }
+
+  LoadCheckpoint();
+  Base_Iter = Checkpoint_Iter.back();
+
+  while (Base_Iter < Target_Iter) {
+
+    /*--- Binomial schedule: nReverse time steps (the base to the target) can be reversed with nFree
+     checkpoints and nRep recomputations per step if nReverse <= C(nFree+nRep, nFree). The next checkpoint
+     is placed such that the time steps after it can be reversed with one checkpoint less. ---*/
+
+    nFree    = nCheckpoint - Checkpoint_Iter.size();
+    nReverse = Target_Iter - Base_Iter + 1;
+    nStep    = Target_Iter - Base_Iter;
+
+    if (nFree > 0) {
+      nRep = 0;
+      while (GetBinomial_nStep(nFree, nRep) < passivedouble(nReverse)) nRep++;
+      nStep = max(long(1), nReverse - long(GetBinomial_nStep(nFree-1, nRep)));
+    }
+
+    for (iStep = 1; iStep <= nStep; iStep++)
+      DirectTimeStep(Base_Iter + iStep, true);
+
+    Base_Iter += nStep;
+
+    if (Base_Iter < Target_Iter) SetCheckpoint(Base_Iter);
+
+  }
+
+  /*--- Time step of the adjoint iteration, the time levels are n, n-1 and n-2 ---*/
+
+  if (Direct_Iter >= 0) DirectTimeStep(Direct_Iter, false);
+
+}
+
+void CDiscAdjFluidDriver::SetAdjoint_Krylov_Seed(const CSysVector & val_seed) {
+
+  unsigned long iPoint, nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  unsigned short iVar, nVar_Flow, nVar_Turb = 0;
+  bool turbulent = ((config_container[ZONE_0]->GetKind_Solver() == DISC_ADJ_RANS) && !config_container[ZONE_0]->GetFrozen_Visc_Disc());
+
+  CSolver *flow_solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  CSolver *turb_solver = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL];
+
+  nVar_Flow = flow_solver->GetnVar();
+  if (turbulent) nVar_Turb = turb_solver->GetnVar();
+
+  vector<su2double> Solution(nVar_Flow+nVar_Turb);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar_Flow+nVar_Turb; iVar++)
+      Solution[iVar] = val_seed[iPoint*(nVar_Flow+nVar_Turb)+iVar];
+    flow_solver->node[iPoint]->SetAdjointSolution(&Solution[0]);
+    if (turbulent) turb_solver->node[iPoint]->SetAdjointSolution(&Solution[nVar_Flow]);
+  }
+
+}
+
+void CDiscAdjFluidDriver::GetAdjoint_Krylov_Solution(CSysVector & val_adjoint) {
+
+  unsigned long iPoint, nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  unsigned short iVar, nVar_Flow, nVar_Turb = 0;
+  bool turbulent = ((config_container[ZONE_0]->GetKind_Solver() == DISC_ADJ_RANS) && !config_container[ZONE_0]->GetFrozen_Visc_Disc());
+
+  CSolver *flow_solver = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL];
+  CSolver *turb_solver = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL];
+
+  nVar_Flow = flow_solver->GetnVar();
+  if (turbulent) nVar_Turb = turb_solver->GetnVar();
+
+  vector<su2double> Solution(nVar_Flow+nVar_Turb);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    flow_solver->node[iPoint]->GetAdjointSolution(&Solution[0]);
+    if (turbulent) turb_solver->node[iPoint]->GetAdjointSolution(&Solution[nVar_Flow]);
+    for (iVar = 0; iVar < nVar_Flow+nVar_Turb; iVar++)
+      val_adjoint[iPoint*(nVar_Flow+nVar_Turb)+iVar] = Solution[iVar];
+  }
+
+}
+
+void CDiscAdjFluidDriver::Adjoint_MatrixVectorProduct(const CSysVector & u, CSysVector & v) {
+
+  /*--- One evaluation of the tape without the seeding of the objective function gives v = G^T u ---*/
+
+  SetAdjoint_Krylov_Seed(u);
+
+  AD::ComputeAdjoint();
+
+  GetAdjoint_Krylov_Solution(v);
+
+  AD::ClearAdjoints();
+
+  /*--- v = u - G^T u ---*/
+
+  v -= u;
+  v *= -1.0;
+
+}
+
+void CDiscAdjFluidDriver::SetAdjoint_Krylov_RHS(void) {
+
+  unsigned long nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
+
+  if ((config_container[ZONE_0]->GetKind_Solver() == DISC_ADJ_RANS) && !config_container[ZONE_0]->GetFrozen_Visc_Disc())
+    nVar += solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
+
+  /*--- The adjoints of the conservative output variables are zero, only the objective function is seeded ---*/
+
+  Adjoint_RHS.Initialize(nPoint, nPoint, nVar, 0.0);
+
+  AD::ClearAdjoints();
+
+  solver_container[ZONE_0][INST_0][MESH_0][ADJFLOW_SOL]->SetAdj_ObjFunc(geometry_container[ZONE_0][INST_0][MESH_0], config_container[ZONE_0]);
+
+  SetAdj_ObjFunction();
+
+  AD::ComputeAdjoint();
+
+  GetAdjoint_Krylov_Solution(Adjoint_RHS);
+
+  AD::ClearAdjoints();
+
+}
+
+void CDiscAdjFluidDriver::SetAdjoint_Krylov(void) {
+
+  unsigned long iPoint, nPoint = geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint();
+  unsigned short iVar, nVar_Flow, nVar_Turb = 0;
+  bool turbulent = ((config_container[ZONE_0]->GetKind_Solver() == DISC_ADJ_RANS) && !config_container[ZONE_0]->GetFrozen_Visc_Disc());
+  su2double Residual = 0.0;
+
+  CSolver *adjflow_solver = solver_container[ZONE_0][INST_0][MESH_0][ADJFLOW_SOL];
+  CSolver *adjturb_solver = solver_container[ZONE_0][INST_0][MESH_0][ADJTURB_SOL];
+
+  nVar_Flow = adjflow_solver->GetnVar();
+  if (turbulent) nVar_Turb = adjturb_solver->GetnVar();
+
+  /*--- The halo points are kept as independent unknowns (the vector has no halo part), since the
+   tape is seeded and evaluated at all the points of the rank, as in the fixed-point iteration. ---*/
+
+  CSysVector Psi(nPoint, nPoint, nVar_Flow+nVar_Turb, 0.0);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar_Flow; iVar++)
+      Psi[iPoint*(nVar_Flow+nVar_Turb)+iVar] = adjflow_solver->node[iPoint]->GetSolution(iVar);
+    for (iVar = 0; iVar < nVar_Turb; iVar++)
+      Psi[iPoint*(nVar_Flow+nVar_Turb)+nVar_Flow+iVar] = adjturb_solver->node[iPoint]->GetSolution(iVar);
+  }
+
+  /*--- FGMRES cycle with a fixed number of tape evaluations (no tolerance), the residual
+   of the linear system is reported by the fixed-point iteration that follows. ---*/
+
+  CDiscAdjMatrixVectorProduct mat_vec(this);
+  CDiscAdjIdentityPreconditioner precond;
+  CSysSolve system;
+
+  system.FGMRES_LinSolver(Adjoint_RHS, Psi, mat_vec, precond, 0.0,
+                          config_container[ZONE_0]->GetDiscAdj_Krylov_Size(), &Residual, false);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVar_Flow; iVar++)
+      adjflow_solver->node[iPoint]->SetSolution(iVar, Psi[iPoint*(nVar_Flow+nVar_Turb)+iVar]);
+    for (iVar = 0; iVar < nVar_Turb; iVar++)
+      adjturb_solver->node[iPoint]->SetSolution(iVar, Psi[iPoint*(nVar_Flow+nVar_Turb)+nVar_Flow+iVar]);
+  }
+
+}
+
 void CDiscAdjFluidDriver::SetRecording(unsigned short kind_recording){
   unsigned short iZone, iMesh;
 
@@ -4667,6 +5396,16 @@ void CDiscAdjFluidDriver::SetRecording(unsigned short kind_recording){
 
   AD::StopRecording();
 
+  /*--- Report the size of the tape of the first recording of the flow and of the geometry, to monitor
+   the effect of preaccumulation and to choose the tape type (--with-codi-tape) that fits in memory ---*/
+
+  if (rank == MASTER_NODE && ((ExtIter == 0 && kind_recording == FLOW_CONS_VARS) ||
+                              (!Geometry_Tape_Reported && kind_recording == MESH_COORDS))) {
+    cout << endl;
+    AD::PrintStatistics();
+  }
+  if (kind_recording == MESH_COORDS) Geometry_Tape_Reported = true;
+
 }
 
 void CDiscAdjFluidDriver::SetAdj_ObjFunction(){
@@ -4685,10 +5424,15 @@ void CDiscAdjFluidDriver::SetAdj_ObjFunction(){
     }
   }
 
+  /*--- With the objective sweep only the current objective function is seeded ---*/
+
+  su2double &ObjFunc_Seed = (config_container[ZONE_0]->GetDiscAdj_ObjSweep()?
+                             ObjFunc_Sweep[config_container[ZONE_0]->GetiObj_Sweep()] : ObjFunc);
+
   if (rank == MASTER_NODE){
-    SU2_TYPE::SetDerivative(ObjFunc, SU2_TYPE::GetValue(seeding));
+    SU2_TYPE::SetDerivative(ObjFunc_Seed, SU2_TYPE::GetValue(seeding));
   } else {
-    SU2_TYPE::SetDerivative(ObjFunc, 0.0);
+    SU2_TYPE::SetDerivative(ObjFunc_Seed, 0.0);
   }
 
 }
@@ -4728,6 +5472,35 @@ void CDiscAdjFluidDriver::SetObjFunction(){
     }
   }
 
+  /*--- Objective sweep (single zone), each objective function is evaluated with the
+   weights of the others set to zero and is registered as a separate output. ---*/
+
+  if (config_container[ZONE_0]->GetDiscAdj_ObjSweep()) {
+
+    unsigned short iObj, jObj, nObj = config_container[ZONE_0]->GetnObj();
+    vector<su2double> Weight(nObj);
+
+    for (iObj = 0; iObj < nObj; iObj++)
+      Weight[iObj] = config_container[ZONE_0]->GetWeight_ObjFunc(iObj);
+
+    ObjFunc_Sweep.resize(nObj);
+
+    for (iObj = 0; iObj < nObj; iObj++) {
+      for (jObj = 0; jObj < nObj; jObj++)
+        config_container[ZONE_0]->SetWeight_ObjFunc(jObj, (jObj == iObj)? Weight[jObj] : su2double(0.0));
+      solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->Evaluate_ObjFunc(config_container[ZONE_0]);
+      ObjFunc_Sweep[iObj] = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetTotal_ComboObj();
+    }
+
+    for (iObj = 0; iObj < nObj; iObj++)
+      config_container[ZONE_0]->SetWeight_ObjFunc(iObj, Weight[iObj]);
+
+    if (rank == MASTER_NODE) {
+      for (iObj = 0; iObj < nObj; iObj++)
+        AD::RegisterOutput(ObjFunc_Sweep[iObj]);
+    }
+  }
+
   /*--- Surface based obj. function ---*/
 
   for (iZone = 0; iZone < nZone; iZone++){
@@ -4796,6 +5569,86 @@ void CDiscAdjFluidDriver::DirectRun(){
 
 }
 
+void CDiscAdjFluidDriver::DesignUpdate(unsigned long val_nDirectIter) {
+
+  unsigned short iZone, iMesh, checkConvergence;
+  unsigned long iDirectIter;
+
+  if (config_container[ZONE_0]->GetUnsteady_Simulation() != STEADY)
+    SU2_MPI::Error("The design update of the discrete adjoint driver is only available for steady problems.", CURRENT_FUNCTION);
+
+  /*--- Remove the recording of the previous design, this also resets the
+   direct solution to the converged solution of the previous design. ---*/
+
+  SetRecording(NONE);
+
+  /*--- Update the wall distance of the deformed grid. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    if (config_container[iZone]->GetKind_Solver() == DISC_ADJ_RANS)
+      geometry_container[iZone][INST_0][MESH_0]->ComputeWall_Distance(config_container[iZone]);
+  }
+
+  if (rank == MASTER_NODE)
+    cout << endl << "Converging the direct problem of the new design (at most " << val_nDirectIter << " iterations)." << endl;
+
+  /*--- The direct problem is not recorded, it is solved as in CFluidDriver::Run
+   (the flow solver does not reset its Jacobian in the discrete adjoint mode). ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++)
+    integration_container[iZone][INST_0][FLOW_SOL]->SetConvergence(false);
+
+  for (iDirectIter = 0; iDirectIter < val_nDirectIter; iDirectIter++) {
+
+    for (iZone = 0; iZone < nZone; iZone++) {
+      config_container[iZone]->SetExtIter(iDirectIter);
+      config_container[iZone]->SetIntIter(iDirectIter);
+      for (iMesh = 0; iMesh <= config_container[iZone]->GetnMGLevels(); iMesh++)
+        solver_container[iZone][INST_0][iMesh][FLOW_SOL]->Jacobian.SetValZero();
+      direct_iteration[iZone]->Preprocess(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+      direct_iteration[iZone]->Iterate(output, integration_container, geometry_container, solver_container, numerics_container, config_container, surface_movement, grid_movement, FFDBox, iZone, INST_0);
+    }
+
+    checkConvergence = 0;
+    for (iZone = 0; iZone < nZone; iZone++)
+      checkConvergence += (int) integration_container[iZone][INST_0][FLOW_SOL]->GetConvergence();
+
+    if (checkConvergence == nZone) break;
+
+  }
+
+  if (rank == MASTER_NODE)
+    cout << "Direct iterations: " << min(iDirectIter+1, val_nDirectIter) << ". log10[Conservative 0]: "
+         << log10(solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetRes_RMS(0)) << "." << endl;
+
+  /*--- Restart the external iterations, at the first one the direct solution is stored
+   again in the adjoint solver and the tape is recorded for the new design. ---*/
+
+  for (iZone = 0; iZone < nZone; iZone++) {
+    integration_container[iZone][INST_0][FLOW_SOL]->SetConvergence(false);
+    config_container[iZone]->SetExtIter(0);
+  }
+
+  ResetConvergence();
+
+  ExtIter = 0;
+  StopCalc = false;
+  RecordingState = NONE;
+
+}
+
+CDiscAdjMatrixVectorProduct::CDiscAdjMatrixVectorProduct(CDiscAdjFluidDriver *driver_ref) {
+
+  driver = driver_ref;
+
+}
+
+void CDiscAdjMatrixVectorProduct::operator()(const CSysVector & u, CSysVector & v) const {
+
+  driver->Adjoint_MatrixVectorProduct(u, v);
+
+}
+
 CDiscAdjTurbomachineryDriver::CDiscAdjTurbomachineryDriver(char* confFile,
                                                            unsigned short val_nZone,
                                                            unsigned short val_nDim,
@@ -4951,11 +5804,8 @@ void CHBDriver::Run() {
 
 void CHBDriver::Update() {
 
-  for (iInst = 0; iInst < nInstHB; iInst++) {
-    /*--- Compute the harmonic balance terms across all zones ---*/
-    SetHarmonicBalance(iInst);
-
-  }
+  /*--- Compute the harmonic balance terms of all instances ---*/
+  SetHarmonicBalance();
 
   /*--- Precondition the harmonic balance source terms ---*/
   if (config_container[ZONE_0]->GetHB_Precondition() == YES) {
@@ -4999,11 +5849,9 @@ void CHBDriver::ResetConvergence() {
 
 }
 
-void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
+void CHBDriver::SetHarmonicBalance(void) {
 
-  unsigned short iVar, jInst, iMGlevel;
-  unsigned short nVar = solver_container[ZONE_0][INST_0][MESH_0][FLOW_SOL]->GetnVar();
-  unsigned long iPoint;
+  unsigned short iInst, jInst, iMGlevel;
   bool implicit = (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool adjoint = (config_container[ZONE_0]->GetContinuous_Adjoint());
   if (adjoint) {
@@ -5012,114 +5860,81 @@ void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
   unsigned long ExtIter = config_container[ZONE_0]->GetExtIter();
 
-  /*--- Retrieve values from the config file ---*/
-  su2double *U = new su2double[nVar];
-  su2double *U_old = new su2double[nVar];
-  su2double *Psi = new su2double[nVar];
-  su2double *Psi_old = new su2double[nVar];
-  su2double *Source = new su2double[nVar];
-  su2double deltaU, deltaPsi;
-
-  /*--- Compute period of oscillation ---*/
-  su2double period = config_container[ZONE_0]->GetHarmonicBalance_Period();
-
-  /*--- Non-dimensionalize the input period, if necessary.  */
-  period /= config_container[ZONE_0]->GetTime_Ref();
-
   if (ExtIter == 0)
     ComputeHB_Operator();
 
-  /*--- Compute various source terms for explicit direct, implicit direct, and adjoint problems ---*/
-  /*--- Loop over all grid levels ---*/
+  /*--- Contiguous row major copies of the HB operator, the adjoint uses its transpose ---*/
+  vector<su2double> HBOperator(nInstHB*nInstHB), HBOperator_T(nInstHB*nInstHB);
+  for (iInst = 0; iInst < nInstHB; iInst++) {
+    for (jInst = 0; jInst < nInstHB; jInst++) {
+      HBOperator[iInst*nInstHB+jInst]   = D[iInst][jInst];
+      HBOperator_T[iInst*nInstHB+jInst] = D[jInst][iInst];
+    }
+  }
+
+  /*--- Compute the source terms of all instances for the explicit direct, implicit direct
+        and adjoint problems, on all grid levels ---*/
   for (iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+    if (!adjoint) SetHarmonicBalance_Source(iMGlevel, FLOW_SOL, HBOperator.data(), implicit);
+    else          SetHarmonicBalance_Source(iMGlevel, ADJFLOW_SOL, HBOperator_T.data(), implicit);
+  }
 
-    /*--- Loop over each node in the volume mesh ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][iInst][iMGlevel]->GetnPoint(); iPoint++) {
+  /*--- Source term for a turbulence model, only on the finest mesh level (turbulence
+        is always solved on the original grid only). ---*/
+  if (config_container[ZONE_0]->GetKind_Solver() == RANS)
+    SetHarmonicBalance_Source(MESH_0, TURB_SOL, HBOperator.data(), false);
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        Source[iVar] = 0.0;
-      }
+}
 
-      /*--- Step across the columns ---*/
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+void CHBDriver::SetHarmonicBalance_Source(unsigned short iMGlevel, unsigned short iSol,
+                                          const su2double *HBOperator, bool implicit) {
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
+  unsigned short iVar, iInst;
+  unsigned long iPoint, jPoint, iCol, nChunk, nCol;
 
-          if (!adjoint) {
-            U[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->node[iPoint]->GetSolution(iVar);
-            Source[iVar] += U[iVar]*D[iInst][jInst];
+  /*--- Number of points whose instance solutions are gathered in one dense block ---*/
+  const unsigned long chunkSize = 256;
 
-            if (implicit) {
-              U_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][FLOW_SOL]->node[iPoint]->GetSolution_Old(iVar);
-              deltaU = U[iVar] - U_old[iVar];
-              Source[iVar] += deltaU*D[iInst][jInst];
-            }
+  const unsigned short nVar = solver_container[ZONE_0][INST_0][iMGlevel][iSol]->GetnVar();
+  const unsigned long nPoint = geometry_container[ZONE_0][INST_0][iMGlevel]->GetnPoint();
 
-          }
+  CBlasStructure blas;
+  vector<su2double> U(nInstHB*chunkSize*nVar), Source(nInstHB*chunkSize*nVar);
 
-          else {
-            Psi[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->node[iPoint]->GetSolution(iVar);
-            Source[iVar] += Psi[iVar]*D[jInst][iInst];
+  for (iPoint = 0; iPoint < nPoint; iPoint += chunkSize) {
 
-            if (implicit) {
-              Psi_old[iVar] = solver_container[ZONE_0][jInst][iMGlevel][ADJFLOW_SOL]->node[iPoint]->GetSolution_Old(iVar);
-              deltaPsi = Psi[iVar] - Psi_old[iVar];
-              Source[iVar] += deltaPsi*D[jInst][iInst];
-            }
-          }
-        }
+    nChunk = min(chunkSize, nPoint-iPoint);
+    nCol   = nChunk*nVar;
 
-        /*--- Store sources for current row ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (!adjoint) {
-            solver_container[ZONE_0][iInst][iMGlevel][FLOW_SOL]->node[iPoint]->SetHarmonicBalance_Source(iVar, Source[iVar]);
-          }
-          else {
-            solver_container[ZONE_0][iInst][iMGlevel][ADJFLOW_SOL]->node[iPoint]->SetHarmonicBalance_Source(iVar, Source[iVar]);
-          }
+    /*--- Gather the solutions of all instances, one row per instance. The implicit
+          problems add the change of the solution over the iteration. ---*/
+    for (iInst = 0; iInst < nInstHB; iInst++) {
+      CSolver *solver = solver_container[ZONE_0][iInst][iMGlevel][iSol];
+      for (jPoint = 0; jPoint < nChunk; jPoint++) {
+        const su2double *Sol = solver->node[iPoint+jPoint]->GetSolution();
+        iCol = iInst*nCol + jPoint*nVar;
+        for (iVar = 0; iVar < nVar; iVar++) U[iCol+iVar] = Sol[iVar];
+        if (implicit) {
+          const su2double *Sol_Old = solver->node[iPoint+jPoint]->GetSolution_Old();
+          for (iVar = 0; iVar < nVar; iVar++) U[iCol+iVar] += Sol[iVar] - Sol_Old[iVar];
         }
-
       }
     }
-  }
-
-  /*--- Source term for a turbulence model ---*/
-  if (config_container[ZONE_0]->GetKind_Solver() == RANS) {
-
-    /*--- Extra variables needed if we have a turbulence model. ---*/
-    unsigned short nVar_Turb = solver_container[ZONE_0][INST_0][MESH_0][TURB_SOL]->GetnVar();
-    su2double *U_Turb = new su2double[nVar_Turb];
-    su2double *Source_Turb = new su2double[nVar_Turb];
 
-    /*--- Loop over only the finest mesh level (turbulence is always solved
-     on the original grid only). ---*/
-    for (iPoint = 0; iPoint < geometry_container[ZONE_0][INST_0][MESH_0]->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar_Turb; iVar++) Source_Turb[iVar] = 0.0;
-      for (jInst = 0; jInst < nInstHB; jInst++) {
+    /*--- Apply the operator to all points of the block at once ---*/
+    blas.gemm(nInstHB, nCol, nInstHB, HBOperator, U.data(), Source.data(), config_container[ZONE_0]);
 
-        /*--- Retrieve solution at this node in current zone ---*/
-        for (iVar = 0; iVar < nVar_Turb; iVar++) {
-          U_Turb[iVar] = solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->node[iPoint]->GetSolution(iVar);
-          Source_Turb[iVar] += U_Turb[iVar]*D[iInst][jInst];
-        }
+    /*--- Store the sources of every instance ---*/
+    for (iInst = 0; iInst < nInstHB; iInst++) {
+      CSolver *solver = solver_container[ZONE_0][iInst][iMGlevel][iSol];
+      for (jPoint = 0; jPoint < nChunk; jPoint++) {
+        iCol = iInst*nCol + jPoint*nVar;
+        for (iVar = 0; iVar < nVar; iVar++)
+          solver->node[iPoint+jPoint]->SetHarmonicBalance_Source(iVar, Source[iCol+iVar]);
       }
-
-      /*--- Store sources for current iZone ---*/
-      for (iVar = 0; iVar < nVar_Turb; iVar++)
-        solver_container[ZONE_0][iInst][MESH_0][TURB_SOL]->node[iPoint]->SetHarmonicBalance_Source(iVar, Source_Turb[iVar]);
     }
-
-    delete [] U_Turb;
-    delete [] Source_Turb;
   }
 
-  delete [] Source;
-  delete [] U;
-  delete [] U_old;
-  delete [] Psi;
-  delete [] Psi_old;
-
 }
 
 void CHBDriver::StabilizeHarmonicBalance() {
@@ -66,6 +66,27 @@ CFluidModel::~CFluidModel(void) {
   if (ThermalConductivity!= NULL) delete ThermalConductivity;
 }
 
+void CFluidModel::SetTDState_rhoe_Batch(const unsigned long nPoints,
+                                        const su2double     *rho,
+                                        const su2double     *e,
+                                        su2double           *P,
+                                        su2double           *T,
+                                        su2double           *c2,
+                                        su2double           *dPdrho_e,
+                                        su2double           *dPde_rho) {
+
+  /*--- Generic implementation, which evaluates the points one by one. ---*/
+  for(unsigned long i=0; i<nPoints; ++i) {
+    SetTDState_rhoe(rho[i], e[i]);
+
+    P[i]        = Pressure;
+    T[i]        = Temperature;
+    c2[i]       = SoundSpeed2;
+    dPdrho_e[i] = this->dPdrho_e;
+    dPde_rho[i] = this->dPde_rho;
+  }
+}
+
 void CFluidModel::SetLaminarViscosityModel (CConfig *config) {
   
   switch (config->GetKind_ViscosityModel()) {
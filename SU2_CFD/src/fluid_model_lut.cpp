@@ -0,0 +1,507 @@
+/*!
+ * fluid_model_lut.cpp
+ * \brief Source of the look-up table fluid model.
+ * \version 6.2.0 "Falcon"
+ *
+ * The current SU2 release has been coordinated by the
+ * SU2 International Developers Society <www.su2devsociety.org>
+ * with selected contributions from the open-source community.
+ *
+ * The main research teams contributing to the current release are:
+ *  - Prof. Juan J. Alonso's group at Stanford University.
+ *  - Prof. Piero Colonna's group at Delft University of Technology.
+ *  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+ *  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+ *  - Prof. Rafael Palacios' group at Imperial College London.
+ *  - Prof. Vincent Terrapon's group at the University of Liege.
+ *  - Prof. Edwin van der Weide's group at the University of Twente.
+ *  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+ *
+ * Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+ *                      Tim Albring, and the SU2 contributors.
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "./../include/fluid_model.hpp"
+
+CLookUpTable::CLookUpTable(CFluidModel *val_generator, CConfig *config,
+                           su2double Pressure_FreeStreamND,
+                           su2double Temperature_FreeStreamND) : CFluidModel() {
+
+  const int rank = SU2_MPI::GetRank();
+
+  Generator = val_generator;
+  nPoints   = config->GetLUT_nPoints();
+
+  Cp = Generator->GetCp();
+  Cv = Generator->GetCv();
+
+  /*--- Determine the non-dimensional pressure and temperature range of the
+        tables. Bounds which are not specified are based on the free-stream. ---*/
+  PMin = config->GetLUT_Pressure_Min()/config->GetPressure_Ref();
+  PMax = config->GetLUT_Pressure_Max()/config->GetPressure_Ref();
+  TMin = config->GetLUT_Temperature_Min()/config->GetTemperature_Ref();
+  TMax = config->GetLUT_Temperature_Max()/config->GetTemperature_Ref();
+
+  if (PMin == 0.0) PMin = 0.1*Pressure_FreeStreamND;
+  if (PMax == 0.0) PMax = 3.0*Pressure_FreeStreamND;
+  if (TMin == 0.0) TMin = 0.5*Temperature_FreeStreamND;
+  if (TMax == 0.0) TMax = 2.0*Temperature_FreeStreamND;
+
+  rhoMin = rhoMax = eMin = eMax = 0.0;
+  hMin   = hMax   = sMin = sMax = 0.0;
+
+  /*--- Store the parameters of the generating model and of the tables,
+        such that a cached table can be validated. ---*/
+  Signature.push_back(config->GetKind_FluidModel());
+  Signature.push_back(SU2_TYPE::GetValue(config->GetGamma()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetGas_Constant()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetPressure_Critical()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetTemperature_Critical()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetAcentric_Factor()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetPressure_Ref()));
+  Signature.push_back(SU2_TYPE::GetValue(config->GetTemperature_Ref()));
+  Signature.push_back(nPoints);
+  Signature.push_back(SU2_TYPE::GetValue(PMin));
+  Signature.push_back(SU2_TYPE::GetValue(PMax));
+  Signature.push_back(SU2_TYPE::GetValue(TMin));
+  Signature.push_back(SU2_TYPE::GetValue(TMax));
+
+  /*--- Read the tables from file if possible. Otherwise generate them and let
+        the master write them. The barrier makes sure that a file written by
+        a previous instance (e.g. another multigrid level) is complete. ---*/
+  const string filename = config->GetLUT_FileName();
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+
+  if ( ReadTables(filename) ) {
+    if (rank == MASTER_NODE)
+      cout << "Fluid look-up tables read from " << filename << "." << endl;
+  }
+  else {
+    if (rank == MASTER_NODE)
+      cout << "Generating the fluid look-up tables (" << nPoints << " x "
+           << nPoints << " points)." << endl;
+    GenerateTables();
+    if (rank == MASTER_NODE) WriteTables(filename);
+  }
+}
+
+CLookUpTable::~CLookUpTable(void) {
+
+  delete Generator;
+}
+
+bool CLookUpTable::FindCell(su2double x, su2double y, su2double xMin, su2double xMax,
+                            su2double yMin, su2double yMax, const vector<bool> &valid,
+                            unsigned long &iCell, su2double &wx, su2double &wy) {
+
+  if ((x < xMin) || (x > xMax) || (y < yMin) || (y > yMax)) return false;
+
+  /*--- The tables are uniform, hence the cell follows directly from the
+        scaled coordinates. ---*/
+  const su2double rx = (x-xMin)/(xMax-xMin)*(nPoints-1);
+  const su2double ry = (y-yMin)/(yMax-yMin)*(nPoints-1);
+
+  const unsigned long i = min((unsigned long) SU2_TYPE::GetValue(rx), (unsigned long) nPoints-2);
+  const unsigned long j = min((unsigned long) SU2_TYPE::GetValue(ry), (unsigned long) nPoints-2);
+
+  iCell = j*nPoints + i;
+  wx    = rx - i;
+  wy    = ry - j;
+
+  return (valid[iCell] && valid[iCell+1] && valid[iCell+nPoints] && valid[iCell+nPoints+1]);
+}
+
+void CLookUpTable::Interpolate(const vector<su2double> &table, unsigned short nVar,
+                               unsigned long iCell, su2double wx, su2double wy, su2double *val) {
+
+  const su2double *t00 = table.data() + nVar*iCell;
+  const su2double *t10 = t00 + nVar;
+  const su2double *t01 = t00 + nVar*nPoints;
+  const su2double *t11 = t01 + nVar;
+
+  const su2double w00 = (1.0-wx)*(1.0-wy), w10 = wx*(1.0-wy);
+  const su2double w01 = (1.0-wx)*wy,       w11 = wx*wy;
+
+  for (unsigned short iVar = 0; iVar < nVar; iVar++)
+    val[iVar] = w00*t00[iVar] + w10*t10[iVar] + w01*t01[iVar] + w11*t11[iVar];
+}
+
+void CLookUpTable::CopyStateGenerator(void) {
+
+  Density      = Generator->GetDensity();
+  StaticEnergy = Generator->GetStaticEnergy();
+  Pressure     = Generator->GetPressure();
+  Temperature  = Generator->GetTemperature();
+  SoundSpeed2  = Generator->GetSoundSpeed2();
+  Entropy      = Generator->GetEntropy();
+  dPdrho_e     = Generator->GetdPdrho_e();
+  dPde_rho     = Generator->GetdPde_rho();
+  dTdrho_e     = Generator->GetdTdrho_e();
+  dTde_rho     = Generator->GetdTde_rho();
+}
+
+void CLookUpTable::GenerateTables(void) {
+
+  const unsigned long nNodes = nPoints*nPoints;
+  const su2double nInt = nPoints-1;
+  unsigned long i, j, iNode;
+
+  TablePT.assign(2*nNodes, 0.0);   ValidPT.assign(nNodes, false);
+  TableRhoE.assign(8*nNodes, 0.0); ValidRhoE.assign(nNodes, false);
+  TableHS.assign(2*nNodes, 0.0);   ValidHS.assign(nNodes, false);
+
+  /*--- (P,T) table. It also determines the ranges of the other tables. ---*/
+  bool first = true;
+  vector<su2double> hPT(nNodes), sPT(nNodes);
+
+  for (j = 0; j < nPoints; j++) {
+    for (i = 0; i < nPoints; i++) {
+      iNode = j*nPoints + i;
+      const su2double P = PMin + i*(PMax-PMin)/nInt;
+      const su2double T = TMin + j*(TMax-TMin)/nInt;
+
+      Generator->SetTDState_PT(P, T);
+      const su2double rho = Generator->GetDensity();
+      const su2double e   = Generator->GetStaticEnergy();
+      const su2double s   = Generator->GetEntropy();
+
+      if ((rho > 0.0) && (e == e) && (s == s)) {
+        ValidPT[iNode]      = true;
+        TablePT[2*iNode]    = rho;
+        TablePT[2*iNode+1]  = e;
+        hPT[iNode] = e + P/rho;
+        sPT[iNode] = s;
+
+        if (first) {
+          rhoMin = rhoMax = rho; eMin = eMax = e;
+          hMin = hMax = hPT[iNode]; sMin = sMax = s;
+          first = false;
+        }
+        rhoMin = min(rhoMin, rho);        rhoMax = max(rhoMax, rho);
+        eMin   = min(eMin, e);            eMax   = max(eMax, e);
+        hMin   = min(hMin, hPT[iNode]);   hMax   = max(hMax, hPT[iNode]);
+        sMin   = min(sMin, s);            sMax   = max(sMax, s);
+      }
+    }
+  }
+
+  if (first)
+    SU2_MPI::Error("No physical state found in the pressure and temperature range of the look-up table.",
+                   CURRENT_FUNCTION);
+
+  /*--- (rho,e) table, which contains the thermodynamic state. The density
+        varies over orders of magnitude, hence the table is uniform in log(rho). ---*/
+  const su2double logRhoMin = log(rhoMin), logRhoMax = log(rhoMax);
+  for (j = 0; j < nPoints; j++) {
+    for (i = 0; i < nPoints; i++) {
+      iNode = j*nPoints + i;
+      const su2double rho = exp(logRhoMin + i*(logRhoMax-logRhoMin)/nInt);
+      const su2double e   = eMin   + j*(eMax-eMin)/nInt;
+
+      Generator->SetTDState_rhoe(rho, e);
+
+      su2double *val = TableRhoE.data() + 8*iNode;
+      val[0] = Generator->GetPressure();
+      val[1] = Generator->GetTemperature();
+      val[2] = Generator->GetSoundSpeed2();
+      val[3] = Generator->GetEntropy();
+      val[4] = Generator->GetdPdrho_e();
+      val[5] = Generator->GetdPde_rho();
+      val[6] = Generator->GetdTdrho_e();
+      val[7] = Generator->GetdTde_rho();
+
+      bool valid = (val[0] > 0.0) && (val[1] > 0.0) && (val[2] > 0.0);
+      for (unsigned short iVar = 0; iVar < 8; iVar++)
+        if (val[iVar] != val[iVar]) valid = false;
+      ValidRhoE[iNode] = valid;
+    }
+  }
+
+  /*--- (h,s) table. The density and energy of a node are obtained with a Newton
+        iteration on the generating model. The initial guess is the closest node
+        of the (P,T) table or, if not available, a converged neighbor. The
+        logarithm of the density is stored, which varies almost linearly with s. ---*/
+  vector<bool> hasGuess(nNodes, false);
+  for (iNode = 0; iNode < nNodes; iNode++) {
+    if (!ValidPT[iNode]) continue;
+    const unsigned long ih = (unsigned long) SU2_TYPE::GetValue((hPT[iNode]-hMin)/(hMax-hMin)*nInt + 0.5);
+    const unsigned long is = (unsigned long) SU2_TYPE::GetValue((sPT[iNode]-sMin)/(sMax-sMin)*nInt + 0.5);
+    const unsigned long iNodeHS = min(is, (unsigned long) nPoints-1)*nPoints + min(ih, (unsigned long) nPoints-1);
+    if (!hasGuess[iNodeHS]) {
+      TableHS[2*iNodeHS]   = TablePT[2*iNode];
+      TableHS[2*iNodeHS+1] = TablePT[2*iNode+1];
+      hasGuess[iNodeHS] = true;
+    }
+  }
+
+  const unsigned short maxIter = 50;
+  const su2double tolH = 1.e-10*(hMax-hMin), tolS = 1.e-10*(sMax-sMin);
+
+  for (j = 0; j < nPoints; j++) {
+    for (i = 0; i < nPoints; i++) {
+      iNode = j*nPoints + i;
+      const su2double h = hMin + i*(hMax-hMin)/nInt;
+      const su2double s = sMin + j*(sMax-sMin)/nInt;
+
+      su2double rho, e;
+      if      ( hasGuess[iNode] )             {rho = TableHS[2*iNode];         e = TableHS[2*iNode+1];}
+      else if ((i > 0) && ValidHS[iNode-1])   {rho = TableHS[2*(iNode-1)];     e = TableHS[2*(iNode-1)+1];}
+      else if ((j > 0) && ValidHS[iNode-nPoints])
+                                              {rho = TableHS[2*(iNode-nPoints)]; e = TableHS[2*(iNode-nPoints)+1];}
+      else continue;
+
+      /*--- As the cubic equations of state allow for several states with the same
+            enthalpy and entropy, only states within the (P,T) range are accepted. ---*/
+      bool converged = false;
+      for (unsigned short iter = 0; iter < maxIter; iter++) {
+        Generator->SetTDState_rhoe(rho, e);
+        const su2double P = Generator->GetPressure();
+        const su2double T = Generator->GetTemperature();
+        if (!((P > 0.0) && (T > 0.0))) break;
+
+        const su2double fh = e + P/rho - h;
+        const su2double fs = Generator->GetEntropy() - s;
+        if ((fabs(fh) < tolH) && (fabs(fs) < tolS)) {
+          converged = (P >= PMin) && (P <= PMax) && (T >= TMin) && (T <= TMax) &&
+                      (Generator->GetSoundSpeed2() > 0.0);
+          break;
+        }
+
+        /*--- Jacobian of (h,s) w.r.t. (rho,e), using T ds = de - P/rho^2 drho. ---*/
+        const su2double dhdrho = Generator->GetdPdrho_e()/rho - P/(rho*rho);
+        const su2double dhde   = 1.0 + Generator->GetdPde_rho()/rho;
+        const su2double dsdrho = -P/(rho*rho*T);
+        const su2double dsde   = 1.0/T;
+        const su2double det    = dhdrho*dsde - dhde*dsdrho;
+        if (det == 0.0) break;
+
+        su2double dRho = -( dsde*fh - dhde*fs)/det;
+        su2double dE   = -(-dsdrho*fh + dhdrho*fs)/det;
+
+        /*--- Limit the update of the density to keep it positive. ---*/
+        const su2double relax = (rho + dRho < 0.5*rho) ? su2double(0.5*rho/fabs(dRho)) : su2double(1.0);
+        rho += relax*dRho;
+        e   += relax*dE;
+      }
+
+      TableHS[2*iNode]   = rho;
+      TableHS[2*iNode+1] = e;
+      ValidHS[iNode]     = converged;
+    }
+  }
+
+  for (iNode = 0; iNode < nNodes; iNode++)
+    TableHS[2*iNode] = ValidHS[iNode] ? su2double(log(TableHS[2*iNode])) : su2double(0.0);
+}
+
+bool CLookUpTable::ReadTables(string filename) {
+
+  ifstream table_file(filename.data());
+  if (table_file.fail()) return false;
+
+  /*--- Check the header and the parameters of the generating model. ---*/
+  string header;
+  unsigned short nSignature;
+  table_file >> header >> nSignature;
+  if ((header != "SU2_FLUID_LUT") || (nSignature != Signature.size())) return false;
+
+  for (unsigned short iSig = 0; iSig < nSignature; iSig++) {
+    passivedouble val;
+    table_file >> val;
+    if (table_file.fail() || (fabs(val-Signature[iSig]) > 1.e-12*max(1.0, fabs(Signature[iSig]))))
+      return false;
+  }
+
+  /*--- Read the ranges and the tables. ---*/
+  passivedouble ranges[8];
+  for (unsigned short iRange = 0; iRange < 8; iRange++) table_file >> ranges[iRange];
+  rhoMin = ranges[0]; rhoMax = ranges[1]; eMin = ranges[2]; eMax = ranges[3];
+  hMin   = ranges[4]; hMax   = ranges[5]; sMin = ranges[6]; sMax = ranges[7];
+
+  const unsigned long nNodes = nPoints*nPoints;
+  vector<su2double>* tables[] = {&TablePT, &TableRhoE, &TableHS};
+  vector<bool>*      valids[] = {&ValidPT, &ValidRhoE, &ValidHS};
+  const unsigned short nVars[] = {2, 8, 2};
+
+  for (unsigned short iTable = 0; iTable < 3; iTable++) {
+    tables[iTable]->assign(nVars[iTable]*nNodes, 0.0);
+    valids[iTable]->assign(nNodes, false);
+
+    for (unsigned long iNode = 0; iNode < nNodes; iNode++) {
+      int valid;
+      table_file >> valid;
+      (*valids[iTable])[iNode] = (valid != 0);
+      for (unsigned short iVar = 0; iVar < nVars[iTable]; iVar++) {
+        passivedouble val;
+        table_file >> val;
+        (*tables[iTable])[nVars[iTable]*iNode+iVar] = val;
+      }
+    }
+  }
+
+  return !table_file.fail();
+}
+
+void CLookUpTable::WriteTables(string filename) {
+
+  ofstream table_file(filename.data());
+  if (table_file.fail()) {
+    cout << "WARNING: the fluid look-up tables could not be written to " << filename << "." << endl;
+    return;
+  }
+
+  table_file.precision(17);
+  table_file << scientific;
+
+  table_file << "SU2_FLUID_LUT " << Signature.size() << "\n";
+  for (unsigned short iSig = 0; iSig < Signature.size(); iSig++)
+    table_file << Signature[iSig] << "\n";
+
+  table_file << SU2_TYPE::GetValue(rhoMin) << " " << SU2_TYPE::GetValue(rhoMax) << " "
+             << SU2_TYPE::GetValue(eMin)   << " " << SU2_TYPE::GetValue(eMax)   << " "
+             << SU2_TYPE::GetValue(hMin)   << " " << SU2_TYPE::GetValue(hMax)   << " "
+             << SU2_TYPE::GetValue(sMin)   << " " << SU2_TYPE::GetValue(sMax)   << "\n";
+
+  const unsigned long nNodes = nPoints*nPoints;
+  vector<su2double>* tables[] = {&TablePT, &TableRhoE, &TableHS};
+  vector<bool>*      valids[] = {&ValidPT, &ValidRhoE, &ValidHS};
+  const unsigned short nVars[] = {2, 8, 2};
+
+  for (unsigned short iTable = 0; iTable < 3; iTable++) {
+    for (unsigned long iNode = 0; iNode < nNodes; iNode++) {
+      table_file << ((*valids[iTable])[iNode] ? 1 : 0);
+      for (unsigned short iVar = 0; iVar < nVars[iTable]; iVar++)
+        table_file << " " << SU2_TYPE::GetValue((*tables[iTable])[nVars[iTable]*iNode+iVar]);
+      table_file << "\n";
+    }
+  }
+
+  table_file.close();
+}
+
+void CLookUpTable::SetTDState_rhoe (su2double rho, su2double e ) {
+
+  unsigned long iCell;
+  su2double wx, wy;
+
+  if ( (rho > 0.0) &&
+       FindCell(log(rho), e, log(rhoMin), log(rhoMax), eMin, eMax, ValidRhoE, iCell, wx, wy) ) {
+
+    su2double val[8];
+    Interpolate(TableRhoE, 8, iCell, wx, wy, val);
+
+    Density      = rho;
+    StaticEnergy = e;
+    Pressure     = val[0];
+    Temperature  = val[1];
+    SoundSpeed2  = val[2];
+    Entropy      = val[3];
+    dPdrho_e     = val[4];
+    dPde_rho     = val[5];
+    dTdrho_e     = val[6];
+    dTde_rho     = val[7];
+  }
+  else {
+    Generator->SetTDState_rhoe(rho, e);
+    CopyStateGenerator();
+  }
+}
+
+void CLookUpTable::SetTDState_PT (su2double P, su2double T ) {
+
+  unsigned long iCell;
+  su2double wx, wy;
+
+  if ( FindCell(P, T, PMin, PMax, TMin, TMax, ValidPT, iCell, wx, wy) ) {
+    su2double val[2];
+    Interpolate(TablePT, 2, iCell, wx, wy, val);
+    SetTDState_rhoe(val[0], val[1]);
+  }
+  else {
+    Generator->SetTDState_PT(P, T);
+    CopyStateGenerator();
+  }
+}
+
+void CLookUpTable::SetTDState_Prho (su2double P, su2double rho ) {
+
+  Generator->SetEnergy_Prho(P, rho);
+  SetTDState_rhoe(rho, Generator->GetStaticEnergy());
+}
+
+void CLookUpTable::SetEnergy_Prho (su2double P, su2double rho ) {
+
+  Generator->SetEnergy_Prho(P, rho);
+  StaticEnergy = Generator->GetStaticEnergy();
+}
+
+void CLookUpTable::SetTDState_hs (su2double h, su2double s ) {
+
+  unsigned long iCell;
+  su2double wx, wy;
+
+  if ( FindCell(h, s, hMin, hMax, sMin, sMax, ValidHS, iCell, wx, wy) ) {
+    su2double val[2];
+    Interpolate(TableHS, 2, iCell, wx, wy, val);
+
+    /*--- The interpolated state serves as initial guess for a few Newton
+          iterations on the (rho,e) table, such that the state is consistent
+          with the tabulated enthalpy and entropy. ---*/
+    su2double rho = exp(val[0]), e = val[1];
+    for (unsigned short iter = 0; iter < 3; iter++) {
+      SetTDState_rhoe(rho, e);
+
+      const su2double fh     = StaticEnergy + Pressure/Density - h;
+      const su2double fs     = Entropy - s;
+      const su2double dhdrho = dPdrho_e/Density - Pressure/(Density*Density);
+      const su2double dhde   = 1.0 + dPde_rho/Density;
+      const su2double dsdrho = -Pressure/(Density*Density*Temperature);
+      const su2double dsde   = 1.0/Temperature;
+      const su2double det    = dhdrho*dsde - dhde*dsdrho;
+
+      rho -= ( dsde*fh - dhde*fs)/det;
+      e   -= (-dsdrho*fh + dhdrho*fs)/det;
+    }
+    SetTDState_rhoe(rho, e);
+  }
+  else {
+    Generator->SetTDState_hs(h, s);
+    CopyStateGenerator();
+  }
+}
+
+void CLookUpTable::SetTDState_rhoT (su2double rho, su2double T ) {
+
+  Generator->SetTDState_rhoT(rho, T);
+  CopyStateGenerator();
+}
+
+void CLookUpTable::SetTDState_Ps (su2double P, su2double s ) {
+
+  Generator->SetTDState_Ps(P, s);
+  CopyStateGenerator();
+}
+
+void CLookUpTable::ComputeDerivativeNRBC_Prho (su2double P, su2double rho ) {
+
+  Generator->ComputeDerivativeNRBC_Prho(P, rho);
+  CopyStateGenerator();
+
+  dhdrho_P = Generator->Getdhdrho_P();
+  dhdP_rho = Generator->GetdhdP_rho();
+  dsdrho_P = Generator->Getdsdrho_P();
+  dsdP_rho = Generator->GetdsdP_rho();
+}
@@ -84,6 +84,32 @@ void CIdealGas::SetTDState_rhoe (su2double rho, su2double e ) {
     Entropy = (1.0/Gamma_Minus_One*log(Temperature) + log(1.0/Density))*Gas_Constant;
 }
 
+void CIdealGas::SetTDState_rhoe_Batch(const unsigned long nPoints,
+                                      const su2double     *rho,
+                                      const su2double     *e,
+                                      su2double           *P,
+                                      su2double           *T,
+                                      su2double           *c2,
+                                      su2double           *dPdrho_e,
+                                      su2double           *dPde_rho) {
+
+  /*--- The ideal gas relations only contain multiplications, hence the
+        loop below can be vectorized by the compiler. ---*/
+  const su2double ovRgas = 1.0/Gas_Constant;
+
+  for(unsigned long i=0; i<nPoints; ++i) {
+    P[i]        = Gamma_Minus_One*rho[i]*e[i];
+    T[i]        = Gamma_Minus_One*e[i]*ovRgas;
+    c2[i]       = Gamma*Gamma_Minus_One*e[i];
+    dPdrho_e[i] = Gamma_Minus_One*e[i];
+    dPde_rho[i] = Gamma_Minus_One*rho[i];
+  }
+
+  /*--- Store the state of the last point, such that the internal state
+        is identical to the one of the generic implementation. ---*/
+  if( nPoints ) SetTDState_rhoe(rho[nPoints-1], e[nPoints-1]);
+}
+
 void CIdealGas::SetTDState_PT (su2double P, su2double T ) {
   su2double e = T*Gas_Constant/Gamma_Minus_One;
   su2double rho = P/(T*Gas_Constant);
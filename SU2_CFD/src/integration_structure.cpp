@@ -50,6 +50,7 @@ CIntegration::CIntegration(CConfig *config) {
   Convergence_FullMG = false;
   Cauchy_Serie = new su2double [config->GetCauchy_Elems()+1];
   InitResidual = 0.0;
+  DualTime_InitResidual = 0.0;
 }
 
 CIntegration::~CIntegration(void) {
@@ -75,16 +76,19 @@ void CIntegration::Space_Integration(CGeometry *geometry,
       solver_container[MainSolver]->Centered_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
     case SPACE_UPWIND:
-      solver_container[MainSolver]->Upwind_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh);
+      /*--- Upwind and viscous residuals, which may be computed in a single edge loop. ---*/
+      solver_container[MainSolver]->Upwind_Viscous_Residual(geometry, solver_container, numerics[CONV_TERM],
+                                                            numerics[VISC_TERM], config, iMesh, iRKStep);
       break;
     case FINITE_ELEMENT:
       solver_container[MainSolver]->Convective_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, iRKStep);
       break;
   }
   
-  /*--- Compute viscous residuals ---*/
+  /*--- Compute viscous residuals. For upwind schemes this has been done above. ---*/
   
-  solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, iRKStep);
+  if (config->GetKind_ConvNumScheme() != SPACE_UPWIND)
+    solver_container[MainSolver]->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, iRKStep);
   
   /*--- Compute source term residuals ---*/
 
@@ -346,6 +350,9 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
       case (CLASSICAL_RK4_EXPLICIT):
         solver_container[MainSolver]->ClassicalRK4_Iteration(geometry, solver_container, config, iRKStep);
         break;
+      case (LOW_STORAGE_RK_EXPLICIT):
+        solver_container[MainSolver]->LowStorageRK_Iteration(geometry, solver_container, config, iRKStep);
+        break;
       case (EULER_EXPLICIT):
         solver_container[MainSolver]->ExplicitEuler_Iteration(geometry, solver_container, config);
         break;
@@ -374,6 +381,63 @@ void CIntegration::Time_Integration(CGeometry *geometry, CSolver **solver_contai
 
 }
 
+void CIntegration::Multirate_Integration(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics,
+                                         CConfig *config, unsigned short iMesh, unsigned short RunTime_EqSystem) {
+  
+  unsigned short MainSolver = config->GetContainerPosition(RunTime_EqSystem);
+  CSolver *solver = solver_container[MainSolver];
+  
+  unsigned long iSubStep, nSubStep = solver->GetMultirate_nSubStep();
+  short iLevel, Level_Due, nLevel = solver->GetMultirate_nLevel();
+  
+  for (iSubStep = 0; iSubStep < nSubStep; iSubStep++) {
+    
+    /*--- The gradients and limiters of all the points are recomputed at each substep,
+     the first one has been preprocessed by the cycle ---*/
+    
+    if (iSubStep > 0)
+      solver->Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
+    
+    /*--- The step of a level starts at the substeps that are multiples of 2^level,
+     the fluxes of each level are integrated with the step of the level ---*/
+    
+    Level_Due = 0;
+    while ((Level_Due+1 < nLevel) && (iSubStep % (1ul << (Level_Due+1)) == 0)) Level_Due++;
+    
+    for (iLevel = 0; iLevel <= Level_Due; iLevel++) {
+      
+      solver->SetMultirate_Pass(geometry, iLevel);
+      
+      switch (config->GetKind_ConvNumScheme()) {
+        case SPACE_CENTERED:
+          solver->Centered_Residual(geometry, solver_container, numerics[CONV_TERM], config, iMesh, 0);
+          solver->Viscous_Residual(geometry, solver_container, numerics[VISC_TERM], config, iMesh, 0);
+          break;
+        case SPACE_UPWIND:
+          solver->Upwind_Viscous_Residual(geometry, solver_container, numerics[CONV_TERM],
+                                          numerics[VISC_TERM], config, iMesh, 0);
+          break;
+      }
+      
+      solver->Multirate_Accumulate(geometry, iLevel, iSubStep);
+      
+    }
+    
+    /*--- Source terms and boundary conditions, the edge loops are empty ---*/
+    
+    solver->SetMultirate_Pass(geometry, -1);
+    Space_Integration(geometry, solver_container, numerics, config, iMesh, 0, RunTime_EqSystem);
+    solver->Multirate_Accumulate(geometry, -1, iSubStep);
+    solver->SetMultirate_Pass(geometry, -2);
+    
+    /*--- Update the points whose step ends ---*/
+    
+    solver->Multirate_Update(geometry, config, iSubStep);
+    
+  }
+  
+}
+
 void CIntegration::Time_Integration_FEM(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config,
                                     unsigned short RunTime_EqSystem, unsigned long Iteration) {
 
@@ -578,18 +642,11 @@ void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CCon
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
     solver->node[iPoint]->Set_Solution_time_n1();
     solver->node[iPoint]->Set_Solution_time_n();
-    
-    geometry->node[iPoint]->SetVolume_nM1();
-    geometry->node[iPoint]->SetVolume_n();
-    
-    /*--- Store old coordinates in case there is grid movement ---*/
-    
-    if (config->GetGrid_Movement()) {
-      geometry->node[iPoint]->SetCoord_n1();
-      geometry->node[iPoint]->SetCoord_n();
-    }
   }
   
+  /*--- The old volumes and coordinates are stored once per geometry by
+   CGeometry::SetDualTime_History, before the solvers are shifted ---*/
+  
   /*--- Store old aeroelastic solutions ---*/
   if (config->GetGrid_Movement() && config->GetAeroelastic_Simulation() && (iMesh == MESH_0)) {
     config->SetAeroelastic_n1();
@@ -632,8 +689,8 @@ void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CCon
       
       /*--- Gather the data on the master node. ---*/
       
-      SU2_MPI::Gather(&plunge, 1, MPI_DOUBLE, plunge_all, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(&pitch, 1, MPI_DOUBLE, pitch_all, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&plunge, 1, MPI_SU2DOUBLE, plunge_all, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(&pitch, 1, MPI_SU2DOUBLE, pitch_all, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       SU2_MPI::Gather(&owner, 1, MPI_UNSIGNED_LONG, owner_all, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
       
       /*--- Set plunge and pitch on the master node ---*/
@@ -660,6 +717,37 @@ void CIntegration::SetDualTime_Solver(CGeometry *geometry, CSolver *solver, CCon
   
 }
 
+void CIntegration::SetDualTime_Predictor(CGeometry *geometry, CSolver *solver, CConfig *config) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  const unsigned short nVar = solver->GetnVar();
+  su2double *Solution_n, *Solution_n1, *Predictor = new su2double[nVar];
+  bool Valid;
+  
+  /*--- U^(n+1) = 2 U^n - U^(n-1), a variable that is positive at both time levels
+   (density, energy, turbulence variables) must stay positive, otherwise the point
+   keeps the solution at time n ---*/
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    
+    Solution_n  = solver->node[iPoint]->GetSolution_time_n();
+    Solution_n1 = solver->node[iPoint]->GetSolution_time_n1();
+    
+    Valid = true;
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Predictor[iVar] = 2.0*Solution_n[iVar] - Solution_n1[iVar];
+      if ((Solution_n[iVar] > 0.0) && (Solution_n1[iVar] > 0.0) && (Predictor[iVar] <= 0.0)) Valid = false;
+    }
+    
+    if (Valid) solver->node[iPoint]->SetSolution(Predictor);
+    
+  }
+  
+  delete [] Predictor;
+  
+}
+
 void CIntegration::SetStructural_Solver(CGeometry *geometry, CSolver *solver, CConfig *config, unsigned short iMesh) {
   
   unsigned long iPoint;
@@ -901,7 +989,7 @@ void CIntegration::Convergence_Monitoring_FSI(CGeometry *fea_geometry, CConfig *
     
 #ifdef HAVE_MPI
     /*--- We sum the squares of the norms across the different processors ---*/
-    SU2_MPI::Allreduce(&deltaURes, &deltaURes_recv, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&deltaURes, &deltaURes_recv, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
     deltaURes_recv         = deltaURes;
 #endif
@@ -974,6 +1062,9 @@ void CIntegration::Convergence_Monitoring_FSI(CGeometry *fea_geometry, CConfig *
     else if (RelaxMethod_FSI == AITKEN_DYNAMIC) {
       WAitken = fea_solver->GetWAitken_Dyn();
     }
+    else if (RelaxMethod_FSI == IQN_ILS) {
+      WAitken = fea_solver->GetWAitken_Dyn();
+    }
     else {
       WAitken = 1.0;
       cout << "No relaxation parameter used. " << endl;
@@ -37,10 +37,136 @@
 
 #include "../include/integration_structure.hpp"
 
-CMultiGridIntegration::CMultiGridIntegration(CConfig *config) : CIntegration(config) {}
+CMultiGridIntegration::CMultiGridIntegration(CConfig *config) : CIntegration(config) {
+  
+  SetAdaptive_Cycle(config);
+  
+}
 
 CMultiGridIntegration::~CMultiGridIntegration(void) { }
 
+void CMultiGridIntegration::SetAdaptive_Cycle(CConfig *config) {
+  
+  const unsigned short nLevels = config->GetnMGLevels()+1;
+  
+  /*--- The controller is only used by the direct flow problem, the adjoint problems
+   must repeat exactly the sequence of operations of the direct cycle ---*/
+  
+  MG_Adaptive = (config->GetMG_Adaptive_Cycle() && (config->GetnMGLevels() > 0) &&
+                 !config->GetContinuous_Adjoint() && !config->GetDiscrete_Adjoint());
+  
+  MG_AdaptCycle = (config->GetMGCycle() == W_CYCLE)? W_CYCLE : V_CYCLE;
+  MG_AdaptDepth = config->GetnMGLevels();
+  
+  MG_AdaptPreSmooth.resize(nLevels);
+  MG_AdaptPostSmooth.resize(nLevels);
+  
+  /*--- At least two pre-smoothing sweeps on the coarse levels, the reduction per sweep
+   is measured between the first and the last sweep of each visit ---*/
+  
+  for (unsigned short iMesh = 0; iMesh < nLevels; iMesh++) {
+    MG_AdaptPreSmooth[iMesh]  = config->GetMG_PreSmooth(iMesh);
+    MG_AdaptPostSmooth[iMesh] = config->GetMG_PostSmooth(iMesh);
+    if (iMesh != MESH_0) MG_AdaptPreSmooth[iMesh] = max(MG_AdaptPreSmooth[iMesh], (unsigned short)2);
+  }
+  
+  MG_AdaptStall.assign(nLevels, 0);
+  MG_AdaptRes_First.assign(nLevels, 0.0);
+  MG_AdaptRes_Last.assign(nLevels, 0.0);
+  MG_AdaptRate.assign(nLevels, 0.0);
+  
+  MG_AdaptFine_Old = 0.0;
+  MG_AdaptRate_V   = 0.0;
+  MG_AdaptWindow   = 0;
+  MG_AdaptHold     = 20;
+  
+}
+
+void CMultiGridIntegration::Adapt_Cycle(CSolver ***solver_container, CConfig *config, unsigned short FinestMesh,
+                                        unsigned short SolContainer_Position, unsigned long Iteration) {
+  
+  const unsigned short MaxSweeps = 8;
+  const unsigned short MaxStall = 3;
+  
+  /*--- Reduction factor per cycle of the finest level, the residual of the first
+   sweep is the residual at the start of the cycle ---*/
+  
+  su2double res = MG_AdaptRes_First[FinestMesh], rate = 0.0;
+  
+  if ((MG_AdaptFine_Old > EPS) && (res > EPS)) {
+    rate = res/MG_AdaptFine_Old;
+    if (MG_AdaptRate[FinestMesh] == 0.0) MG_AdaptRate[FinestMesh] = rate;
+    else MG_AdaptRate[FinestMesh] = 0.9*MG_AdaptRate[FinestMesh] + 0.1*rate;
+  }
+  MG_AdaptFine_Old = res;
+  MG_AdaptWindow++;
+  
+  /*--- A slow V cycle tries the W cycle, the W cycle is kept only if its reduction
+   factor beats the V cycle once the cost of the extra coarse visits is accounted for ---*/
+  
+  if ((MG_AdaptWindow >= MG_AdaptHold) && (MG_AdaptRate[FinestMesh] > 0.0) && (MG_AdaptDepth > FinestMesh+1)) {
+    
+    bool Changed = false;
+    
+    if ((MG_AdaptCycle == V_CYCLE) && (MG_AdaptRate[FinestMesh] > 0.99)) {
+      MG_AdaptRate_V = MG_AdaptRate[FinestMesh];
+      MG_AdaptCycle = W_CYCLE;
+      MG_AdaptHold = 20;
+      Changed = true;
+    }
+    else if ((MG_AdaptCycle == W_CYCLE) && (MG_AdaptRate_V > 0.0) &&
+             (pow(MG_AdaptRate[FinestMesh], 1.0/1.5) >= MG_AdaptRate_V)) {
+      MG_AdaptCycle = V_CYCLE;
+      MG_AdaptHold = 200;
+      Changed = true;
+    }
+    
+    if (Changed) {
+      MG_AdaptWindow = 0;
+      MG_AdaptRate[FinestMesh] = 0.0;
+    }
+    
+  }
+  
+  /*--- Coarse levels, more sweeps where the smoother is slow, fewer where it is fast,
+   and the levels that do not reduce their residual are removed from the cycle ---*/
+  
+  for (unsigned short iMesh = FinestMesh+1; iMesh <= MG_AdaptDepth; iMesh++) {
+    
+    if (MG_AdaptRes_First[iMesh] <= EPS) continue;
+    
+    rate = pow(MG_AdaptRes_Last[iMesh]/MG_AdaptRes_First[iMesh], 1.0/su2double(MG_AdaptPreSmooth[iMesh]-1));
+    if (MG_AdaptRate[iMesh] == 0.0) MG_AdaptRate[iMesh] = rate;
+    else MG_AdaptRate[iMesh] = 0.5*MG_AdaptRate[iMesh] + 0.5*rate;
+    
+    if ((MG_AdaptRate[iMesh] > 0.9) && (MG_AdaptPreSmooth[iMesh] < MaxSweeps)) MG_AdaptPreSmooth[iMesh]++;
+    if ((MG_AdaptRate[iMesh] < 0.5) && (MG_AdaptPreSmooth[iMesh] > 2)) MG_AdaptPreSmooth[iMesh]--;
+    
+    if (rate >= 1.0) MG_AdaptStall[iMesh]++;
+    else MG_AdaptStall[iMesh] = 0;
+    
+    if (MG_AdaptStall[iMesh] >= MaxStall) {
+      MG_AdaptDepth = iMesh-1;
+      MG_AdaptStall[iMesh] = 0;
+      MG_AdaptRate[iMesh] = 0.0;
+      if (rank == MASTER_NODE)
+        cout << "Multigrid level " << iMesh << " is not reducing its residual, the cycle stops at level " << MG_AdaptDepth << "." << endl;
+      break;
+    }
+    
+  }
+  
+  /*--- Periodically give the removed levels another chance ---*/
+  
+  if ((MG_AdaptDepth < config->GetnMGLevels()) && (Iteration % 100 == 0)) MG_AdaptDepth++;
+  
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    MG_AdaptRes_First[iMesh] = 0.0;
+    MG_AdaptRes_Last[iMesh] = 0.0;
+  }
+  
+}
+
 void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                                                 CSolver *****solver_container,
                                                 CNumerics ******numerics_container,
@@ -69,6 +195,8 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
                        (config[iZone]->GetKind_Solver() == DISC_ADJ_FEM_EULER)            ||
                        (config[iZone]->GetKind_Solver() == DISC_ADJ_FEM_NS)               ||
                        (config[iZone]->GetKind_Solver() == DISC_ADJ_RANS));
+  const bool dual_time = ((config[iZone]->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                          (config[iZone]->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   const unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
   unsigned short RecursiveParam = config[iZone]->GetMGCycle();
   
@@ -77,6 +205,13 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
     FullMG = true;
   }
   
+  /*--- The sizes of the adaptive controller follow the number of levels that were agglomerated ---*/
+  
+  if (MG_Adaptive && (MG_AdaptPreSmooth.size() != config[iZone]->GetnMGLevels()+1u))
+    SetAdaptive_Cycle(config[iZone]);
+  
+  if (MG_Adaptive && !FullMG) RecursiveParam = MG_AdaptCycle;
+  
   /*--- If restart, update multigrid levels at the first multigrid iteration ---*/
 	/*-- Since the restart takes care of this I dont think is required, but we should check after the new restart routines are added ---*/
   
@@ -130,6 +265,23 @@ void CMultiGridIntegration::MultiGrid_Iteration(CGeometry ****geometry,
   /*--- Convergence strategy ---*/
   
   Convergence_Monitoring(geometry[iZone][iInst][FinestMesh], config[iZone], Iteration, monitor, FinestMesh);
+  
+  /*--- Dual time stepping, the internal iterations of the time step end once the residual of
+   the first conservative variable (density, pressure for the incompressible solver) has dropped
+   by the requested orders of magnitude. The RMS residual is already reduced over all the
+   processors, the decision is the same on every rank ---*/
+  
+  if (dual_time && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && !config[iZone]->GetDiscrete_Adjoint() &&
+      (config[iZone]->GetUnst_Residual_Drop() > 0.0)) {
+    const su2double Residual = log10(max(solver_container[iZone][iInst][MESH_0][SolContainer_Position]->GetRes_RMS(0), EPS));
+    if (Iteration == 0) DualTime_InitResidual = Residual;
+    else if (DualTime_InitResidual - Residual >= config[iZone]->GetUnst_Residual_Drop()) Convergence = true;
+  }
+  
+  /*--- Tune the next cycle from the residual reduction of each level ---*/
+  
+  if (MG_Adaptive && (Iteration >= config[iZone]->GetnStartUpIter()))
+    Adapt_Cycle(solver_container[iZone][iInst], config[iZone], FinestMesh, SolContainer_Position, Iteration);
 
 }
 
@@ -146,16 +298,34 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
   
   unsigned short iPreSmooth, iPostSmooth, iRKStep, iRKLimit = 1;
   
+  const unsigned short nPreSmooth  = MG_Adaptive? MG_AdaptPreSmooth[iMesh]  : config[iZone]->GetMG_PreSmooth(iMesh);
+  const unsigned short nPostSmooth = MG_Adaptive? MG_AdaptPostSmooth[iMesh] : config[iZone]->GetMG_PostSmooth(iMesh);
+  const unsigned short nMGLevels   = MG_Adaptive? MG_AdaptDepth : config[iZone]->GetnMGLevels();
+  
   bool startup_multigrid = (config[iZone]->GetRestart_Flow() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) && (Iteration == 0));
   unsigned short SolContainer_Position = config[iZone]->GetContainerPosition(RunTime_EqSystem);
   
+  bool multirate = ((config[iZone]->GetnLevels_TimeAccurateLTS() > 1) && (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+                    (config[iZone]->GetKind_TimeIntScheme() == EULER_EXPLICIT) && (iMesh == MESH_0));
+  
+  bool newton_krylov = (config[iZone]->GetNewton_Krylov() && (RunTime_EqSystem == RUNTIME_FLOW_SYS) &&
+                        (config[iZone]->GetKind_Regime() == COMPRESSIBLE) &&
+                        (config[iZone]->GetKind_TimeIntScheme() == EULER_IMPLICIT) &&
+                        !config[iZone]->GetContinuous_Adjoint() && !config[iZone]->GetDiscrete_Adjoint());
+  
+  /*--- Only the cycle on the finest grid is timed, it includes the coarse levels ---*/
+  
+  double tick = 0.0;
+  if (iMesh == MESH_0) config[iZone]->Tick(&tick);
+  
   /*--- Do a presmoothing on the grid iMesh to be restricted to the grid iMesh+1 ---*/
   
-  for (iPreSmooth = 0; iPreSmooth < config[iZone]->GetMG_PreSmooth(iMesh); iPreSmooth++) {
+  for (iPreSmooth = 0; iPreSmooth < nPreSmooth; iPreSmooth++) {
     
     switch (config[iZone]->GetKind_TimeIntScheme()) {
       case RUNGE_KUTTA_EXPLICIT: iRKLimit = config[iZone]->GetnRKStep(); break;
       case CLASSICAL_RK4_EXPLICIT: iRKLimit = 4; break;
+      case LOW_STORAGE_RK_EXPLICIT: iRKLimit = 5; break;
       case EULER_EXPLICIT: case EULER_IMPLICIT: iRKLimit = 1; break; }
 
     /*--- Time and space integration ---*/
@@ -185,25 +355,57 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
         
       }
       
+      /*--- Multirate time stepping, substeps of the global time step replace the space and time integration ---*/
+      
+      if (multirate) {
+        Multirate_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, RunTime_EqSystem);
+        solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh);
+        continue;
+      }
+      
       /*--- Space integration ---*/
       
       Space_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone], iMesh, iRKStep, RunTime_EqSystem);
       
+      /*--- Jacobian-free Newton-Krylov on the finest grid, the products of the
+       linear solver are finite differences of the residual just computed ---*/
+      
+      CJacobianFreeProduct *JacobianFree_Product = NULL;
+      if (newton_krylov && (iMesh == MESH_0)) {
+        JacobianFree_Product = new CJacobianFreeProduct(this, geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh],
+                                                        numerics_container[iZone][iInst][iMesh][SolContainer_Position], config[iZone],
+                                                        iMesh, iRKStep, RunTime_EqSystem);
+        solver_container[iZone][iInst][iMesh][SolContainer_Position]->SetJacobianFree_Product(JacobianFree_Product);
+      }
+      
       /*--- Time integration, update solution using the old solution plus the solution increment ---*/
       
       Time_Integration(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iRKStep, RunTime_EqSystem, Iteration);
       
+      if (JacobianFree_Product != NULL) {
+        solver_container[iZone][iInst][iMesh][SolContainer_Position]->SetJacobianFree_Product(NULL);
+        delete JacobianFree_Product;
+      }
+      
       /*--- Send-Receive boundary conditions, and postprocessing ---*/
       
       solver_container[iZone][iInst][iMesh][SolContainer_Position]->Postprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh);
       
     }
     
+    /*--- The residual of each sweep is evaluated before the update, the first and the
+     last sweeps give the reduction of the smoother on this level ---*/
+    
+    if (MG_Adaptive) {
+      if (iPreSmooth == 0) MG_AdaptRes_First[iMesh] = solver_container[iZone][iInst][iMesh][SolContainer_Position]->GetRes_RMS(0);
+      MG_AdaptRes_Last[iMesh] = solver_container[iZone][iInst][iMesh][SolContainer_Position]->GetRes_RMS(0);
+    }
+    
   }
   
   /*--- Compute Forcing Term $P_(k+1) = I^(k+1)_k(P_k+F_k(u_k))-F_(k+1)(I^(k+1)_k u_k)$ and update solution for multigrid ---*/
   
-  if ( (iMesh < config[iZone]->GetnMGLevels() && ((Iteration >= config[iZone]->GetnStartUpIter()) || startup_multigrid)) ) {
+  if ( (iMesh < nMGLevels && ((Iteration >= config[iZone]->GetnStartUpIter()) || startup_multigrid)) ) {
     /*--- Compute $r_k = P_k + F_k(u_k)$ ---*/
     
     solver_container[iZone][iInst][iMesh][SolContainer_Position]->Preprocessing(geometry[iZone][iInst][iMesh], solver_container[iZone][iInst][iMesh], config[iZone], iMesh, NO_RK_ITER, RunTime_EqSystem, false);
@@ -223,7 +425,7 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     /*--- Recursive call to MultiGrid_Cycle ---*/
     
     for (unsigned short imu = 0; imu <= RecursiveParam; imu++) {
-      if (iMesh == config[iZone]->GetnMGLevels()-2) MultiGrid_Cycle(geometry, solver_container, numerics_container, config, iMesh+1, 0, RunTime_EqSystem, Iteration, iZone, iInst);
+      if (iMesh == nMGLevels-2) MultiGrid_Cycle(geometry, solver_container, numerics_container, config, iMesh+1, 0, RunTime_EqSystem, Iteration, iZone, iInst);
       else MultiGrid_Cycle(geometry, solver_container, numerics_container, config, iMesh+1, RecursiveParam, RunTime_EqSystem, Iteration, iZone, iInst);
     }
     
@@ -237,11 +439,12 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     
     /*--- Solution postsmoothing in the prolongated grid ---*/
     
-    for (iPostSmooth = 0; iPostSmooth < config[iZone]->GetMG_PostSmooth(iMesh); iPostSmooth++) {
+    for (iPostSmooth = 0; iPostSmooth < nPostSmooth; iPostSmooth++) {
       
       switch (config[iZone]->GetKind_TimeIntScheme()) {
         case RUNGE_KUTTA_EXPLICIT: iRKLimit = config[iZone]->GetnRKStep(); break;
         case CLASSICAL_RK4_EXPLICIT: iRKLimit = 4; break;
+        case LOW_STORAGE_RK_EXPLICIT: iRKLimit = 5; break;
         case EULER_EXPLICIT: case EULER_IMPLICIT: iRKLimit = 1; break; }
 
       for (iRKStep = 0; iRKStep < iRKLimit; iRKStep++) {
@@ -264,30 +467,34 @@ void CMultiGridIntegration::MultiGrid_Cycle(CGeometry ****geometry,
     }
   }
   
+  if (iMesh == MESH_0) config[iZone]->Tock(tick, "CMultiGridIntegration::MultiGrid_Cycle", PROFILE_ITERATION);
+  
 }
 
 void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                                       CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short Boundary, iMarker, iChildren, iVar;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Solution_Coarse;
+  unsigned long Point_Fine, Point_Coarse, iVertex, iChild;
+  unsigned short Boundary, iMarker, iVar;
+  su2double Weight, *Solution_Fine, *Solution_Coarse;
   
   const unsigned short nVar = sol_coarse->GetnVar();
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  const su2double *Child_Weight = geo_coarse->MG_Children_Weight.data();
+  
   su2double *Solution = new su2double[nVar];
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
     
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
-    
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
     
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->node[Point_Fine]->GetSolution();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Weight = Child_Weight[iChild];
+      Solution_Fine = sol_fine->node[Child[iChild]]->GetSolution();
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] -= Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] -= Solution_Fine[iVar]*Weight;
     }
     
     Solution_Coarse = sol_coarse->node[Point_Coarse]->GetSolution();
@@ -327,9 +534,10 @@ void CMultiGridIntegration::GetProlongated_Correction(unsigned short RunTime_EqS
   sol_coarse->Set_MPI_Solution_Old(geo_coarse, config);
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      sol_fine->LinSysRes.SetBlock(Point_Fine, sol_coarse->node[Point_Coarse]->GetSolution_Old());
+    Solution_Coarse = sol_coarse->node[Point_Coarse]->GetSolution_Old();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Point_Fine = Child[iChild];
+      sol_fine->LinSysRes.SetBlock(Point_Fine, Solution_Coarse);
     }
   }
   
@@ -501,34 +709,40 @@ void CMultiGridIntegration::SetProlongated_Correction(CSolver *sol_fine, CGeomet
 
 
 void CMultiGridIntegration::SetProlongated_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iChildren;
+  unsigned long Point_Coarse, iChild;
+  su2double *Solution_Coarse;
+  
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      sol_fine->node[Point_Fine]->SetSolution(sol_coarse->node[Point_Coarse]->GetSolution());
-    }
+    Solution_Coarse = sol_coarse->node[Point_Coarse]->GetSolution();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++)
+      sol_fine->node[Child[iChild]]->SetSolution(Solution_Coarse);
   }
 }
 
 void CMultiGridIntegration::SetForcing_Term(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config, unsigned short iMesh) {
-  unsigned long Point_Fine, Point_Coarse, iVertex;
-  unsigned short iMarker, iVar, iChildren;
+  unsigned long Point_Coarse, iVertex, iChild;
+  unsigned short iMarker, iVar;
   su2double *Residual_Fine;
   
   const unsigned short nVar = sol_coarse->GetnVar();
   su2double factor = config->GetDamp_Res_Restric(); //pow(config->GetDamp_Res_Restric(), iMesh);
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  
   su2double *Residual = new su2double[nVar];
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
     sol_coarse->node[Point_Coarse]->SetRes_TruncErrorZero();
     
     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Residual_Fine = sol_fine->LinSysRes.GetBlock(Child[iChild]);
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += factor*Residual_Fine[iVar];
     }
@@ -562,21 +776,24 @@ void CMultiGridIntegration::SetResidual_Term(CGeometry *geometry, CSolver *solve
 }
 
 void CMultiGridIntegration::SetRestricted_Residual(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren;
+  unsigned long iVertex, Point_Coarse, iChild;
+  unsigned short iMarker, iVar;
   su2double *Residual_Fine;
   
   const unsigned short nVar = sol_coarse->GetnVar();
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  
   su2double *Residual = new su2double[nVar];
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
     sol_coarse->node[Point_Coarse]->SetRes_TruncErrorZero();
     
     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar] = 0.0;
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Residual_Fine = sol_fine->LinSysRes.GetBlock(Point_Fine);
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Residual_Fine = sol_fine->LinSysRes.GetBlock(Child[iChild]);
       for (iVar = 0; iVar < nVar; iVar++)
         Residual[iVar] += Residual_Fine[iVar];
     }
@@ -598,31 +815,33 @@ void CMultiGridIntegration::SetRestricted_Residual(CSolver *sol_fine, CSolver *s
 }
 
 void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iVar, iChildren, iDim;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Grid_Vel, Vector[3];
+  unsigned long iVertex, Point_Coarse, iChild;
+  unsigned short iMarker, iVar, iDim;
+  su2double Weight, *Solution_Fine, *Grid_Vel, Vector[3];
   
   const unsigned short SolContainer_Position = config->GetContainerPosition(RunTime_EqSystem);
   const unsigned short nVar = sol_coarse->GetnVar();
   const unsigned short nDim = geo_fine->GetnDim();
   const bool grid_movement  = config->GetGrid_Movement();
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  const su2double *Child_Weight = geo_coarse->MG_Children_Weight.data();
+  
   su2double *Solution = new su2double[nVar];
   
   /*--- Compute coarse solution from fine solution ---*/
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
     
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
     
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->node[Point_Fine]->GetSolution();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Weight = Child_Weight[iChild];
+      Solution_Fine = sol_fine->node[Child[iChild]]->GetSolution();
       for (iVar = 0; iVar < nVar; iVar++) {
-        Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] += Solution_Fine[iVar]*Weight;
       }
     }
     
@@ -676,32 +895,35 @@ void CMultiGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSyst
 
 void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
                                                    CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iDim, iChildren;
-  su2double Area_Parent, Area_Children, **Gradient_fine;
+  unsigned long Point_Coarse, iChild;
+  unsigned short iVar, iDim;
+  su2double Weight, **Gradient_fine;
   
   const unsigned short nDim = geo_coarse->GetnDim();
   const unsigned short nVar = sol_coarse->GetnVar();
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  const su2double *Child_Weight = geo_coarse->MG_Children_Weight.data();
+  
   su2double **Gradient = new su2double* [nVar];
   for (iVar = 0; iVar < nVar; iVar++)
     Gradient[iVar] = new su2double [nDim];
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPoint(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
     
     for (iVar = 0; iVar < nVar; iVar++)
       for (iDim = 0; iDim < nDim; iDim++)
         Gradient[iVar][iDim] = 0.0;
     
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Gradient_fine = sol_fine->node[Point_Fine]->GetGradient();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Weight = Child_Weight[iChild];
+      Gradient_fine = sol_fine->node[Child[iChild]]->GetGradient();
       
       for (iVar = 0; iVar < nVar; iVar++)
         for (iDim = 0; iDim < nDim; iDim++)
-          Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Area_Children/Area_Parent;
+          Gradient[iVar][iDim] += Gradient_fine[iVar][iDim]*Weight;
     }
     sol_coarse->node[Point_Coarse]->SetGradient(Gradient);
   }
@@ -712,6 +934,158 @@ void CMultiGridIntegration::SetRestricted_Gradient(unsigned short RunTime_EqSyst
   
 }
 
+void CMultiGridIntegration::DiscAdj_MultiGrid_Correction(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                                                         unsigned short iZone, unsigned short iInst) {
+  unsigned long iPoint;
+  unsigned short iVar;
+  su2double *Solution_Fine, *Correction_Fine;
+  
+  CSolver *adj_fine = solver_container[iZone][iInst][MESH_0][ADJFLOW_SOL];
+  CSolver *flow_fine = solver_container[iZone][iInst][MESH_0][FLOW_SOL];
+  CGeometry *geo_fine = geometry[iZone][iInst][MESH_0];
+  
+  const unsigned short nVar = adj_fine->GetnVar();
+  su2double factor = config[iZone]->GetDamp_Correc_Prolong();
+  
+  su2double *Solution = new su2double [nVar];
+  
+  /*--- The defect on the finest grid is the residual of the fixed-point iteration ---*/
+  
+  adj_fine->LinSysAux = su2double(0.0);
+  for (iPoint = 0; iPoint < geo_fine->GetnPointDomain(); iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      adj_fine->LinSysAux[iPoint*nVar+iVar] = adj_fine->node[iPoint]->GetSolution(iVar) - adj_fine->node[iPoint]->GetSolution_Old(iVar);
+  }
+  
+  /*--- Approximate solution of P_c^T y = r on the coarse levels. P_c = V/dt + dR/dU is the implicit
+   operator of the flow on each level, i.e. the pseudo time term regularizes the coarse problem instead
+   of solving (dR/dU)^T y = r ---*/
+  
+  SetRestricted_AdjointResidual(adj_fine, solver_container[iZone][iInst][MESH_1][ADJFLOW_SOL],
+                                geo_fine, geometry[iZone][iInst][MESH_1], config[iZone]);
+  
+  DiscAdj_MultiGrid_Cycle(geometry, solver_container, config, MESH_1, iZone, iInst);
+  
+  adj_fine->LinSysSol = su2double(0.0);
+  SetProlongated_AdjointCorrection(adj_fine, solver_container[iZone][iInst][MESH_1][ADJFLOW_SOL],
+                                   geo_fine, geometry[iZone][iInst][MESH_1], config[iZone]);
+  
+  /*--- Correction of the adjoint solution, e = P^T y, the halo points are left to the fixed-point iteration ---*/
+  
+  flow_fine->Jacobian.MatrixVectorProductTransposed(adj_fine->LinSysSol, adj_fine->LinSysAux, geo_fine, config[iZone]);
+  
+  for (iPoint = 0; iPoint < geo_fine->GetnPointDomain(); iPoint++) {
+    Correction_Fine = adj_fine->LinSysAux.GetBlock(iPoint);
+    Solution_Fine = adj_fine->node[iPoint]->GetSolution();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      /*--- Prevent a fine grid divergence due to a coarse grid divergence ---*/
+      if (Correction_Fine[iVar] != Correction_Fine[iVar]) Correction_Fine[iVar] = 0.0;
+      Solution[iVar] = Solution_Fine[iVar]+factor*Correction_Fine[iVar];
+    }
+    adj_fine->node[iPoint]->SetSolution(Solution);
+  }
+  
+  delete [] Solution;
+  
+}
+
+void CMultiGridIntegration::DiscAdj_MultiGrid_Cycle(CGeometry ****geometry, CSolver *****solver_container, CConfig **config,
+                                                    unsigned short iMesh, unsigned short iZone, unsigned short iInst) {
+  su2double Residual = 0.0;
+  
+  CSolver *adj_solver = solver_container[iZone][iInst][iMesh][ADJFLOW_SOL];
+  CSolver *flow_solver = solver_container[iZone][iInst][iMesh][FLOW_SOL];
+  CGeometry *geo = geometry[iZone][iInst][iMesh];
+  
+  const unsigned long nSmooth = config[iZone]->GetDiscAdj_MultiGrid_Iter();
+  
+  /*--- The Jacobian of the level is the implicit operator V/dt + dR/dU of the last recorded flow iteration ---*/
+  
+  flow_solver->Jacobian.BuildJacobiPreconditioner(true);
+  
+  CSysMatrixVectorProductTransposed mat_vec(flow_solver->Jacobian, geo, config[iZone]);
+  CJacobiPreconditioner precond(flow_solver->Jacobian, geo, config[iZone]);
+  CSysSolve system;
+  
+  /*--- Presmoothing ---*/
+  
+  system.FGMRES_LinSolver(adj_solver->LinSysRes, adj_solver->LinSysSol, mat_vec, precond, 0.0, nSmooth, &Residual, false);
+  
+  if (iMesh < config[iZone]->GetnMGLevels()) {
+    
+    /*--- Restrict the defect d = r - P_c^T y and correct with the next coarser level ---*/
+    
+    mat_vec(adj_solver->LinSysSol, adj_solver->LinSysAux);
+    adj_solver->LinSysAux.Equals_AX_Plus_BY(1.0, adj_solver->LinSysRes, -1.0, adj_solver->LinSysAux);
+    
+    SetRestricted_AdjointResidual(adj_solver, solver_container[iZone][iInst][iMesh+1][ADJFLOW_SOL],
+                                  geo, geometry[iZone][iInst][iMesh+1], config[iZone]);
+    
+    DiscAdj_MultiGrid_Cycle(geometry, solver_container, config, iMesh+1, iZone, iInst);
+    
+    SetProlongated_AdjointCorrection(adj_solver, solver_container[iZone][iInst][iMesh+1][ADJFLOW_SOL],
+                                     geo, geometry[iZone][iInst][iMesh+1], config[iZone]);
+    
+    /*--- Postsmoothing ---*/
+    
+    system.FGMRES_LinSolver(adj_solver->LinSysRes, adj_solver->LinSysSol, mat_vec, precond, 0.0, nSmooth, &Residual, false);
+    
+  }
+  
+}
+
+void CMultiGridIntegration::SetRestricted_AdjointResidual(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+                                                          CGeometry *geo_coarse, CConfig *config) {
+  unsigned long iVertex, Point_Coarse, iChild;
+  unsigned short iMarker, iDim;
+  
+  const unsigned short nDim = geo_coarse->GetnDim();
+  
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  
+  sol_coarse->LinSysRes = su2double(0.0);
+  sol_coarse->LinSysSol = su2double(0.0);
+  
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++)
+      sol_coarse->LinSysRes.AddBlock(Point_Coarse, sol_fine->LinSysAux.GetBlock(Child[iChild]));
+  }
+  
+  /*--- The velocity is imposed strongly at the no-slip walls, as in SetRestricted_Residual ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX              ) ||
+        (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL             ) ||
+        (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE    )) {
+      for (iVertex = 0; iVertex < geo_coarse->nVertex[iMarker]; iVertex++) {
+        Point_Coarse = geo_coarse->vertex[iMarker][iVertex]->GetNode();
+        for (iDim = 0; iDim < nDim; iDim++)
+          sol_coarse->LinSysRes.SetBlock_Zero(Point_Coarse, iDim+1);
+      }
+    }
+  }
+  
+}
+
+void CMultiGridIntegration::SetProlongated_AdjointCorrection(CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine,
+                                                             CGeometry *geo_coarse, CConfig *config) {
+  unsigned long Point_Coarse, iChild;
+  su2double *Correction_Coarse;
+  
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  
+  for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
+    Correction_Coarse = sol_coarse->LinSysSol.GetBlock(Point_Coarse);
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++)
+      sol_fine->LinSysSol.AddBlock(Child[iChild], Correction_Coarse);
+  }
+  
+}
+
 void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSolver ***solver_container, CNumerics ****numerics_container,
                                                       CConfig *config, unsigned short FinestMesh, unsigned short RunTime_EqSystem, unsigned long Iteration,
                                                       su2double *monitor) {
@@ -784,6 +1158,110 @@ void CMultiGridIntegration::NonDimensional_Parameters(CGeometry **geometry, CSol
   
 }
 
+CJacobianFreeProduct::CJacobianFreeProduct(CIntegration *val_integration, CGeometry *val_geometry, CSolver **val_solver_container,
+                                           CNumerics **val_numerics, CConfig *val_config, unsigned short val_iMesh,
+                                           unsigned short val_iRKStep, unsigned short val_RunTime_EqSystem) {
+  
+  unsigned long iPoint, total_index;
+  unsigned short iVar;
+  su2double Norm_Local = 0.0;
+  
+  integration      = val_integration;
+  geometry         = val_geometry;
+  solver_container = val_solver_container;
+  numerics         = val_numerics;
+  config           = val_config;
+  iMesh            = val_iMesh;
+  iRKStep          = val_iRKStep;
+  RunTime_EqSystem = val_RunTime_EqSystem;
+  MainSolver       = config->GetContainerPosition(RunTime_EqSystem);
+  nVar             = solver_container[MainSolver]->GetnVar();
+  nPointDomain     = geometry->GetnPointDomain();
+  
+  if ((config->GetKind_Upwind_Flow() == TURKEL) || config->Low_Mach_Preconditioning())
+    SU2_MPI::Error("NEWTON_KRYLOV is not available with low Mach preconditioning.", CURRENT_FUNCTION);
+  
+  /*--- Unperturbed state, and residual from the space integration ---*/
+  
+  Solution_Ref.resize(nPointDomain*nVar);
+  Residual_Ref.resize(nPointDomain*nVar);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      Solution_Ref[total_index] = solver_container[MainSolver]->node[iPoint]->GetSolution(iVar);
+      Residual_Ref[total_index] = solver_container[MainSolver]->LinSysRes[total_index];
+      Norm_Local += Solution_Ref[total_index]*Solution_Ref[total_index];
+    }
+  }
+  
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&Norm_Local, &Solution_Norm, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  Solution_Norm = Norm_Local;
+#endif
+  Solution_Norm = sqrt(Solution_Norm);
+  
+}
+
+CJacobianFreeProduct::~CJacobianFreeProduct(void) { }
+
+void CJacobianFreeProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  
+  unsigned long iPoint, total_index;
+  unsigned short iVar;
+  su2double Delta, Eps, Norm_u;
+  CSolver *solver = solver_container[MainSolver];
+  
+  v = 0.0;
+  
+  Norm_u = u.norm();
+  if (Norm_u == 0.0) return;
+  
+  /*--- Size of the perturbation, balances the truncation and round off errors ---*/
+  
+  Eps = sqrt(numeric_limits<passivedouble>::epsilon())*(1.0+Solution_Norm)/Norm_u;
+  
+  /*--- Perturbed state ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      solver->node[iPoint]->SetSolution(iVar, Solution_Ref[total_index] + Eps*u[total_index]);
+    }
+  solver->Set_MPI_Solution(geometry, config);
+  
+  /*--- Residual of the perturbed state, the flow scheme is set to explicit
+   to skip the assembly of the Jacobian (it holds the preconditioner) ---*/
+  
+  config->SetKind_TimeIntScheme_Flow(EULER_EXPLICIT);
+  solver->Preprocessing(geometry, solver_container, config, iMesh, iRKStep, RunTime_EqSystem, false);
+  integration->Space_Integration(geometry, solver_container, numerics, config, iMesh, iRKStep, RunTime_EqSystem);
+  config->SetKind_TimeIntScheme_Flow(EULER_IMPLICIT);
+  
+  /*--- Finite difference of the residual, plus the pseudo time term. The points
+   with no time step are fixed, their rows are the identity (as in the Jacobian). ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      total_index = iPoint*nVar + iVar;
+      if (solver->node[iPoint]->GetDelta_Time() != 0.0) {
+        Delta = geometry->node[iPoint]->GetVolume() / solver->node[iPoint]->GetDelta_Time();
+        v[total_index] = (solver->LinSysRes[total_index] - Residual_Ref[total_index])/Eps + Delta*u[total_index];
+      }
+      else v[total_index] = u[total_index];
+    }
+  }
+  
+  /*--- Restore the unperturbed state ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      solver->node[iPoint]->SetSolution(iVar, Solution_Ref[iPoint*nVar + iVar]);
+  solver->Set_MPI_Solution(geometry, config);
+  
+}
+
 CSingleGridIntegration::CSingleGridIntegration(CConfig *config) : CIntegration(config) { }
 
 CSingleGridIntegration::~CSingleGridIntegration(void) { }
@@ -849,28 +1327,30 @@ void CSingleGridIntegration::SingleGrid_Iteration(CGeometry ****geometry, CSolve
 }
 
 void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
-  unsigned long Point_Fine, Point_Coarse;
-  unsigned short iVar, iChildren;
-  su2double Area_Parent, Area_Children, *Solution_Fine, *Solution;
+  unsigned long Point_Coarse, iChild;
+  unsigned short iVar;
+  su2double Weight, *Solution_Fine, *Solution;
   
   unsigned short nVar = sol_coarse->GetnVar();
   
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  const su2double *Child_Weight = geo_coarse->MG_Children_Weight.data();
+  
   Solution = new su2double[nVar];
   
   /*--- Compute coarse solution from fine solution ---*/
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
     
     for (iVar = 0; iVar < nVar; iVar++) Solution[iVar] = 0.0;
     
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      Solution_Fine = sol_fine->node[Point_Fine]->GetSolution();
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++) {
+      Weight = Child_Weight[iChild];
+      Solution_Fine = sol_fine->node[Child[iChild]]->GetSolution();
       for (iVar = 0; iVar < nVar; iVar++)
-        Solution[iVar] += Solution_Fine[iVar]*Area_Children/Area_Parent;
+        Solution[iVar] += Solution_Fine[iVar]*Weight;
     }
     
     sol_coarse->node[Point_Coarse]->SetSolution(Solution);
@@ -887,23 +1367,23 @@ void CSingleGridIntegration::SetRestricted_Solution(unsigned short RunTime_EqSys
 
 void CSingleGridIntegration::SetRestricted_EddyVisc(unsigned short RunTime_EqSystem, CSolver *sol_fine, CSolver *sol_coarse, CGeometry *geo_fine, CGeometry *geo_coarse, CConfig *config) {
   
-  unsigned long iVertex, Point_Fine, Point_Coarse;
-  unsigned short iMarker, iChildren;
-  su2double Area_Parent, Area_Children, EddyVisc_Fine, EddyVisc;
+  unsigned long iVertex, Point_Coarse, iChild;
+  unsigned short iMarker;
+  su2double EddyVisc;
+  
+  if (!geo_coarse->MG_Transfer_Ready) geo_coarse->PreprocessMG_Transfer(geo_fine);
+  const unsigned long *Child_Begin = geo_coarse->MG_Children_Begin.data();
+  const unsigned long *Child = geo_coarse->MG_Children.data();
+  const su2double *Child_Weight = geo_coarse->MG_Children_Weight.data();
   
   /*--- Compute coarse Eddy Viscosity from fine solution ---*/
   
   for (Point_Coarse = 0; Point_Coarse < geo_coarse->GetnPointDomain(); Point_Coarse++) {
-    Area_Parent = geo_coarse->node[Point_Coarse]->GetVolume();
     
     EddyVisc = 0.0;
     
-    for (iChildren = 0; iChildren < geo_coarse->node[Point_Coarse]->GetnChildren_CV(); iChildren++) {
-      Point_Fine = geo_coarse->node[Point_Coarse]->GetChildren_CV(iChildren);
-      Area_Children = geo_fine->node[Point_Fine]->GetVolume();
-      EddyVisc_Fine = sol_fine->node[Point_Fine]->GetmuT();
-      EddyVisc += EddyVisc_Fine*Area_Children/Area_Parent;
-    }
+    for (iChild = Child_Begin[Point_Coarse]; iChild < Child_Begin[Point_Coarse+1]; iChild++)
+      EddyVisc += sol_fine->node[Child[iChild]]->GetmuT()*Child_Weight[iChild];
     
     sol_coarse->node[Point_Coarse]->SetmuT(EddyVisc);
     
@@ -1009,6 +1489,7 @@ void CFEM_DG_Integration::SingleGrid_Iteration(CGeometry ****geometry,
   switch (config[iZone]->GetKind_TimeIntScheme()) {
     case RUNGE_KUTTA_EXPLICIT: iLimit = config[iZone]->GetnRKStep(); break;
     case CLASSICAL_RK4_EXPLICIT: iLimit = 4; break;
+    case LOW_STORAGE_RK_EXPLICIT: iLimit = 5; break;
     case ADER_DG: iLimit = 1; useADER = true; break;
     case EULER_EXPLICIT: case EULER_IMPLICIT: iLimit = 1; break; }
 
@@ -1123,6 +1604,9 @@ void CFEM_DG_Integration::Time_Integration(CGeometry *geometry, CSolver **solver
     case (CLASSICAL_RK4_EXPLICIT):
       solver_container[MainSolver]->ClassicalRK4_Iteration(geometry, solver_container, config, iStep);
       break;
+    case (EULER_IMPLICIT):
+      solver_container[MainSolver]->ImplicitEuler_Iteration(geometry, solver_container, config);
+      break;
     default:
       SU2_MPI::Error("Time integration scheme not implemented.", CURRENT_FUNCTION);
   }
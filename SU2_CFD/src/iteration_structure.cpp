@@ -47,9 +47,62 @@ CIteration::CIteration(CConfig *config) {
   multizone = config->GetMultizone_Problem();
   singlezone = !(config->GetMultizone_Problem());
 
+  Anderson = NULL;
+
+}
+
+CIteration::~CIteration(void) {
+
+  if (Anderson != NULL) delete Anderson;
+
 }
 
-CIteration::~CIteration(void) { }
+void CIteration::Anderson_Reset(void) {
+
+  if (Anderson != NULL) Anderson->Reset();
+
+}
+
+void CIteration::Anderson_Iteration(CSolver **solver, CGeometry *geometry, CConfig *config, const vector<unsigned short> & val_iSol) {
+
+  unsigned short iSol, iVar, nVar = 0, nVarSol, offset;
+  unsigned long iPoint, nPoint = geometry->GetnPoint();
+  CSolver *sol;
+
+  if (config->GetAnderson_Depth() == 0) return;
+
+  if (Anderson == NULL)
+    Anderson = new CAndersonAcceleration(config->GetAnderson_Depth(), config->GetAnderson_Relaxation());
+
+  /*--- The halo points are combined with the same coefficients as their owners,
+   the coefficients only depend on the domain points. ---*/
+
+  for (iSol = 0; iSol < val_iSol.size(); iSol++) nVar += solver[val_iSol[iSol]]->GetnVar();
+
+  if (Anderson_Solution.GetLocSize() != nPoint*nVar)
+    Anderson_Solution.Initialize(nPoint, geometry->GetnPointDomain(), nVar, 0.0);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iSol = 0, offset = 0; iSol < val_iSol.size(); iSol++, offset += nVarSol) {
+      sol = solver[val_iSol[iSol]];
+      nVarSol = sol->GetnVar();
+      for (iVar = 0; iVar < nVarSol; iVar++)
+        Anderson_Solution[iPoint*nVar+offset+iVar] = sol->node[iPoint]->GetSolution(iVar);
+    }
+  }
+
+  Anderson->Compute(Anderson_Solution);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iSol = 0, offset = 0; iSol < val_iSol.size(); iSol++, offset += nVarSol) {
+      sol = solver[val_iSol[iSol]];
+      nVarSol = sol->GetnVar();
+      for (iVar = 0; iVar < nVarSol; iVar++)
+        sol->node[iPoint]->SetSolution(iVar, Anderson_Solution[iPoint*nVar+offset+iVar]);
+    }
+  }
+
+}
 
 void CIteration::SetGrid_Movement(CGeometry ****geometry_container,
           CSurfaceMovement **surface_movement,
@@ -373,6 +426,20 @@ void CIteration::SetGrid_Movement(CGeometry ****geometry_container,
       break;
   }
 
+  /*--- Update the wall distance of the deformed grid (a rigid motion does
+   not change it). ---*/
+
+  bool deforming = ((Kind_Grid_Movement == DEFORMING) ||
+                    (Kind_Grid_Movement == FLUID_STRUCTURE) ||
+                    (Kind_Grid_Movement == FLUID_STRUCTURE_STATIC) ||
+                    (Kind_Grid_Movement == ELASTICITY));
+  bool rans = ((config_container[val_iZone]->GetKind_Solver() == RANS) ||
+               (config_container[val_iZone]->GetKind_Solver() == ADJ_RANS) ||
+               (config_container[val_iZone]->GetKind_Solver() == DISC_ADJ_RANS));
+
+  if (config_container[val_iZone]->GetUpdate_Wall_Distance() && deforming && rans)
+    geometry_container[val_iZone][val_iInst][MESH_0]->ComputeWall_Distance(config_container[val_iZone]);
+
 }
 
 void CIteration::Preprocess(COutput *output,
@@ -536,7 +603,12 @@ void CIteration::Postprocess(COutput *output,
 
 
 
-CFluidIteration::CFluidIteration(CConfig *config) : CIteration(config) { }
+CFluidIteration::CFluidIteration(CConfig *config) : CIteration(config) {
+  
+  Gust_Begin = 0;
+  Gust_End   = 0;
+  
+}
 CFluidIteration::~CFluidIteration(void) { }
 
 void CFluidIteration::Preprocess(COutput *output,
@@ -596,6 +668,9 @@ void CFluidIteration::Iterate(COutput *output,
                      (config_container[val_iZone]->GetDiscrete_Adjoint() && config_container[val_iZone]->GetFrozen_Visc_Disc());
   ExtIter = config_container[val_iZone]->GetExtIter();
   
+  double tick = 0.0;
+  config_container[val_iZone]->Tick(&tick);
+  
   /* --- Setting up iteration values depending on if this is a
    steady or an unsteady simulaiton */
   
@@ -648,6 +723,19 @@ void CFluidIteration::Iterate(COutput *output,
                                                                      config_container, RUNTIME_HEAT_SYS, IntIter, val_iZone, val_iInst);
   }
   
+  /*--- Anderson acceleration of the steady flow and turbulence solutions. Not while the
+   direct iteration is recorded for the discrete adjoint. ---*/
+  
+  if (!unsteady && !config_container[val_iZone]->GetDiscrete_Adjoint() &&
+      ((config_container[val_iZone]->GetKind_Solver() == EULER) ||
+       (config_container[val_iZone]->GetKind_Solver() == NAVIER_STOKES) ||
+       (config_container[val_iZone]->GetKind_Solver() == RANS))) {
+    vector<unsigned short> iSol(1, FLOW_SOL);
+    if (config_container[val_iZone]->GetKind_Solver() == RANS) iSol.push_back(TURB_SOL);
+    Anderson_Iteration(solver_container[val_iZone][val_iInst][MESH_0], geometry_container[val_iZone][val_iInst][MESH_0],
+                       config_container[val_iZone], iSol);
+  }
+  
   /*--- Call Dynamic mesh update if AEROELASTIC motion was specified ---*/
   
   if ((config_container[val_iZone]->GetGrid_Movement()) && (config_container[val_iZone]->GetAeroelastic_Simulation()) && unsteady) {
@@ -672,6 +760,8 @@ void CFluidIteration::Iterate(COutput *output,
     
   }
   
+  config_container[val_iZone]->Tock(tick, "CFluidIteration::Iterate", PROFILE_ITERATION);
+  
 }
 
 void CFluidIteration::Update(COutput *output,
@@ -698,6 +788,7 @@ void CFluidIteration::Update(COutput *output,
     /*--- Update dual time solver on all mesh levels ---*/
     
     for (iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++) {
+      geometry_container[val_iZone][val_iInst][iMesh]->SetDualTime_History(config_container[val_iZone]);
       integration_container[val_iZone][val_iInst][FLOW_SOL]->SetDualTime_Solver(geometry_container[val_iZone][val_iInst][iMesh], solver_container[val_iZone][val_iInst][iMesh][FLOW_SOL], config_container[val_iZone], iMesh);
       integration_container[val_iZone][val_iInst][FLOW_SOL]->SetConvergence(false);
     }
@@ -717,6 +808,15 @@ void CFluidIteration::Update(COutput *output,
       integration_container[val_iZone][val_iInst][TRANS_SOL]->SetConvergence(false);
     }
     
+    /*--- Initial guess of the next time step extrapolated from the two previous ones,
+     the coarse levels are restricted from the finest one by the multigrid cycle ---*/
+    
+    if (config_container[val_iZone]->GetUnst_Predictor() && !config_container[val_iZone]->GetDiscrete_Adjoint()) {
+      integration_container[val_iZone][val_iInst][FLOW_SOL]->SetDualTime_Predictor(geometry_container[val_iZone][val_iInst][MESH_0], solver_container[val_iZone][val_iInst][MESH_0][FLOW_SOL], config_container[val_iZone]);
+      if (config_container[val_iZone]->GetKind_Solver() == RANS)
+        integration_container[val_iZone][val_iInst][TURB_SOL]->SetDualTime_Predictor(geometry_container[val_iZone][val_iInst][MESH_0], solver_container[val_iZone][val_iInst][MESH_0][TURB_SOL], config_container[val_iZone]);
+    }
+    
     /*--- Verify convergence criteria (based on total time) ---*/
     
     Physical_dt = config_container[val_iZone]->GetDelta_UnstTime();
@@ -726,6 +826,13 @@ void CFluidIteration::Update(COutput *output,
     
   }
   
+  /*--- Add the completed physical time step to the running time averages. ---*/
+  
+  if (config_container[val_iZone]->GetWrt_Time_Average() &&
+      (ExtIter >= config_container[val_iZone]->GetTime_Average_Start_Iter()))
+    solver_container[val_iZone][val_iInst][MESH_0][FLOW_SOL]->Accumulate_TimeAverage(geometry_container[val_iZone][val_iInst][MESH_0],
+                                                                                      config_container[val_iZone]);
+  
 }
 
 bool CFluidIteration::Monitor(COutput *output,
@@ -925,113 +1032,205 @@ void CFluidIteration::SetWind_GustField(CConfig *config_container, CGeometry **g
     SU2_MPI::Error("The gust length needs to be positive", CURRENT_FUNCTION);
   }
   
-  /*--- Loop over all multigrid levels ---*/
+  /*--- Points of the finest grid sorted along the direction of propagation of the
+   gust, the first call sets all the points ---*/
+  
+  unsigned long iPos, iChild, nPoint = geometry_container[MESH_0]->GetnPoint();
+  unsigned long Begin = 0, End = 0, First, Last;
+  su2double Vol, Vol_Child, *Gust_Child, *GustDer_Child;
+  
+  if (Gust_Sorted.size() != nPoint) {
+    Gust_Sorted.resize(nPoint);
+    for (iPoint = 0; iPoint < nPoint; iPoint++)
+      Gust_Sorted[iPoint] = make_pair(geometry_container[MESH_0]->node[iPoint]->GetCoord()[0], iPoint);
+    sort(Gust_Sorted.begin(), Gust_Sorted.end());
+    Gust_Begin = 0;
+    Gust_End   = nPoint;
+  }
+  
+  /*--- Footprint of the gust, the slab between its front and its tail. The vortex
+   gust has no compact support, and the points move if the gust is combined with
+   another grid motion, in both cases all the points are evaluated. ---*/
+  
+  if (Physical_t >= tbegin) {
+    if ((Gust_Type == VORTEX) || (Kind_Grid_Movement != GUST)) {
+      Begin = 0; End = nPoint;
+    }
+    else {
+      su2double x_front = xbegin + Uinf*(Physical_t-tbegin);
+      su2double x_tail  = x_front + n*L;
+      su2double margin  = 1e-6*L;
+      Begin = lower_bound(Gust_Sorted.begin(), Gust_Sorted.end(),
+                          make_pair(min(x_front, x_tail)-margin, (unsigned long)0)) - Gust_Sorted.begin();
+      End   = upper_bound(Gust_Sorted.begin(), Gust_Sorted.end(),
+                          make_pair(max(x_front, x_tail)+margin, ULONG_MAX)) - Gust_Sorted.begin();
+    }
+  }
+  
+  /*--- The points of the previous footprint that are left behind are cleared ---*/
+  
+  if (Begin == End)                { First = Gust_Begin; Last = Gust_End; }
+  else if (Gust_Begin == Gust_End) { First = Begin; Last = End; }
+  else                             { First = min(Begin, Gust_Begin); Last = max(End, Gust_End); }
+  
+  Gust_Begin = Begin;
+  Gust_End   = End;
+  
+  /*--- Loop over the points of the finest grid to update ---*/
+  
+  vector<unsigned long> Point_Update;
+  Point_Update.reserve(Last-First);
   
-  for (iMGlevel = 0; iMGlevel <= nMGlevel; iMGlevel++) {
+  for (iPos = First; iPos < Last; iPos++) {
     
-    /*--- Loop over each node in the volume mesh ---*/
+    iPoint = Gust_Sorted[iPos].second;
+    Point_Update.push_back(iPoint);
     
-    for (iPoint = 0; iPoint < geometry_container[iMGlevel]->GetnPoint(); iPoint++) {
-      
-      /*--- Reset the Grid Velocity to zero if there is no grid movement ---*/
-      if (Kind_Grid_Movement == GUST) {
-        for (iDim = 0; iDim < nDim; iDim++)
-          geometry_container[iMGlevel]->node[iPoint]->SetGridVel(iDim, 0.0);
-      }
-      
-      /*--- initialize the gust and derivatives to zero everywhere ---*/
+    /*--- Reset the Grid Velocity to zero if there is no grid movement ---*/
+    if (Kind_Grid_Movement == GUST) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        geometry_container[MESH_0]->node[iPoint]->SetGridVel(iDim, 0.0);
+    }
+    
+    /*--- initialize the gust and derivatives to zero everywhere ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {Gust[iDim]=0.0;}
+    dgust_dx = 0.0; dgust_dy = 0.0; dgust_dt = 0.0;
+    
+    /*--- Begin applying the gust ---*/
+    
+    if (Physical_t >= tbegin) {
       
-      for (iDim = 0; iDim < nDim; iDim++) {Gust[iDim]=0.0;}
-      dgust_dx = 0.0; dgust_dy = 0.0; dgust_dt = 0.0;
+      x = geometry_container[MESH_0]->node[iPoint]->GetCoord()[0]; // x-location of the node.
+      y = geometry_container[MESH_0]->node[iPoint]->GetCoord()[1]; // y-location of the node.
       
-      /*--- Begin applying the gust ---*/
+      // Gust coordinate
+      x_gust = (x - xbegin - Uinf*(Physical_t-tbegin))/L;
       
-      if (Physical_t >= tbegin) {
-        
-        x = geometry_container[iMGlevel]->node[iPoint]->GetCoord()[0]; // x-location of the node.
-        y = geometry_container[iMGlevel]->node[iPoint]->GetCoord()[1]; // y-location of the node.
-        
-        // Gust coordinate
-        x_gust = (x - xbegin - Uinf*(Physical_t-tbegin))/L;
-        
-        /*--- Calculate the specified gust ---*/
-        switch (Gust_Type) {
-            
-          case TOP_HAT:
-            // Check if we are in the region where the gust is active
-            if (x_gust > 0 && x_gust < n) {
-              Gust[GustDir] = gust_amp;
-              // Still need to put the gust derivatives. Think about this.
-            }
-            break;
-            
-          case SINE:
-            // Check if we are in the region where the gust is active
-            if (x_gust > 0 && x_gust < n) {
-              Gust[GustDir] = gust_amp*(sin(2*PI_NUMBER*x_gust));
-              
-              // Gust derivatives
-              //dgust_dx = gust_amp*2*PI_NUMBER*(cos(2*PI_NUMBER*x_gust))/L;
-              //dgust_dy = 0;
-              //dgust_dt = gust_amp*2*PI_NUMBER*(cos(2*PI_NUMBER*x_gust))*(-Uinf)/L;
-            }
-            break;
-            
-          case ONE_M_COSINE:
-            // Check if we are in the region where the gust is active
-            if (x_gust > 0 && x_gust < n) {
-              Gust[GustDir] = gust_amp*(1-cos(2*PI_NUMBER*x_gust));
-              
-              // Gust derivatives
-              //dgust_dx = gust_amp*2*PI_NUMBER*(sin(2*PI_NUMBER*x_gust))/L;
-              //dgust_dy = 0;
-              //dgust_dt = gust_amp*2*PI_NUMBER*(sin(2*PI_NUMBER*x_gust))*(-Uinf)/L;
-            }
-            break;
-            
-          case EOG:
-            // Check if we are in the region where the gust is active
-            if (x_gust > 0 && x_gust < n) {
-              Gust[GustDir] = -0.37*gust_amp*sin(3*PI_NUMBER*x_gust)*(1-cos(2*PI_NUMBER*x_gust));
-            }
-            break;
-            
-          case VORTEX:
-            
-            /*--- Use vortex distribution ---*/
-            // Algebraic vortex equation.
-            for (unsigned long i=0; i<nVortex; i++) {
-              su2double r2 = pow(x-(x0[i]+Uinf*(Physical_t-tbegin)), 2) + pow(y-y0[i], 2);
-              su2double r = sqrt(r2);
-              su2double v_theta = vort_strenth[i]/(2*PI_NUMBER) * r/(r2+pow(r_core[i],2));
-              Gust[0] = Gust[0] + v_theta*(y-y0[i])/r;
-              Gust[1] = Gust[1] - v_theta*(x-(x0[i]+Uinf*(Physical_t-tbegin)))/r;
-            }
-            break;
-            
-          case NONE: default:
+      /*--- Calculate the specified gust ---*/
+      switch (Gust_Type) {
+          
+        case TOP_HAT:
+          // Check if we are in the region where the gust is active
+          if (x_gust > 0 && x_gust < n) {
+            Gust[GustDir] = gust_amp;
+            // Still need to put the gust derivatives. Think about this.
+          }
+          break;
+          
+        case SINE:
+          // Check if we are in the region where the gust is active
+          if (x_gust > 0 && x_gust < n) {
+            Gust[GustDir] = gust_amp*(sin(2*PI_NUMBER*x_gust));
             
-            /*--- There is no wind gust specified. ---*/
-            if (rank == MASTER_NODE) {
-              cout << "No wind gust specified." << endl;
-            }
-            break;
+            // Gust derivatives
+            //dgust_dx = gust_amp*2*PI_NUMBER*(cos(2*PI_NUMBER*x_gust))/L;
+            //dgust_dy = 0;
+            //dgust_dt = gust_amp*2*PI_NUMBER*(cos(2*PI_NUMBER*x_gust))*(-Uinf)/L;
+          }
+          break;
+          
+        case ONE_M_COSINE:
+          // Check if we are in the region where the gust is active
+          if (x_gust > 0 && x_gust < n) {
+            Gust[GustDir] = gust_amp*(1-cos(2*PI_NUMBER*x_gust));
             
-        }
+            // Gust derivatives
+            //dgust_dx = gust_amp*2*PI_NUMBER*(sin(2*PI_NUMBER*x_gust))/L;
+            //dgust_dy = 0;
+            //dgust_dt = gust_amp*2*PI_NUMBER*(sin(2*PI_NUMBER*x_gust))*(-Uinf)/L;
+          }
+          break;
+          
+        case EOG:
+          // Check if we are in the region where the gust is active
+          if (x_gust > 0 && x_gust < n) {
+            Gust[GustDir] = -0.37*gust_amp*sin(3*PI_NUMBER*x_gust)*(1-cos(2*PI_NUMBER*x_gust));
+          }
+          break;
+          
+        case VORTEX:
+          
+          /*--- Use vortex distribution ---*/
+          // Algebraic vortex equation.
+          for (unsigned long i=0; i<nVortex; i++) {
+            su2double r2 = pow(x-(x0[i]+Uinf*(Physical_t-tbegin)), 2) + pow(y-y0[i], 2);
+            su2double r = sqrt(r2);
+            su2double v_theta = vort_strenth[i]/(2*PI_NUMBER) * r/(r2+pow(r_core[i],2));
+            Gust[0] = Gust[0] + v_theta*(y-y0[i])/r;
+            Gust[1] = Gust[1] - v_theta*(x-(x0[i]+Uinf*(Physical_t-tbegin)))/r;
+          }
+          break;
+          
+        case NONE: default:
+          
+          /*--- There is no wind gust specified. ---*/
+          if (rank == MASTER_NODE) {
+            cout << "No wind gust specified." << endl;
+          }
+          break;
+          
       }
+    }
+    
+    /*--- Set the Wind Gust, Wind Gust Derivatives and the Grid Velocities ---*/
+    
+    GustDer[0] = dgust_dx;
+    GustDer[1] = dgust_dy;
+    GustDer[2] = dgust_dt;
+    
+    solver_container[MESH_0][FLOW_SOL]->node[iPoint]->SetWindGust(Gust);
+    solver_container[MESH_0][FLOW_SOL]->node[iPoint]->SetWindGustDer(GustDer);
+    
+    GridVel = geometry_container[MESH_0]->node[iPoint]->GetGridVel();
+    
+    /*--- Store new grid velocity ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      NewGridVel[iDim] = GridVel[iDim] - Gust[iDim];
+      geometry_container[MESH_0]->node[iPoint]->SetGridVel(iDim, NewGridVel[iDim]);
+    }
+    
+  }
+  
+  /*--- The coarse grids restrict the gust of the children of the control volumes
+   that contain an updated point, instead of evaluating it ---*/
+  
+  for (iMGlevel = 1; iMGlevel <= nMGlevel; iMGlevel++) {
+    
+    for (iPos = 0; iPos < Point_Update.size(); iPos++)
+      Point_Update[iPos] = geometry_container[iMGlevel-1]->node[Point_Update[iPos]]->GetParent_CV();
+    sort(Point_Update.begin(), Point_Update.end());
+    Point_Update.resize(unique(Point_Update.begin(), Point_Update.end()) - Point_Update.begin());
+    
+    for (iPos = 0; iPos < Point_Update.size(); iPos++) {
       
-      /*--- Set the Wind Gust, Wind Gust Derivatives and the Grid Velocities ---*/
+      iPoint = Point_Update[iPos];
+      Vol = geometry_container[iMGlevel]->node[iPoint]->GetVolume();
       
-      GustDer[0] = dgust_dx;
-      GustDer[1] = dgust_dy;
-      GustDer[2] = dgust_dt;
+      for (iDim = 0; iDim < nDim; iDim++) Gust[iDim] = 0.0;
+      for (unsigned short i = 0; i < 3; i++) GustDer[i] = 0.0;
+      
+      for (iChild = 0; iChild < geometry_container[iMGlevel]->node[iPoint]->GetnChildren_CV(); iChild++) {
+        unsigned long Point_Fine = geometry_container[iMGlevel]->node[iPoint]->GetChildren_CV(iChild);
+        Vol_Child     = geometry_container[iMGlevel-1]->node[Point_Fine]->GetVolume();
+        Gust_Child    = solver_container[iMGlevel-1][FLOW_SOL]->node[Point_Fine]->GetWindGust();
+        GustDer_Child = solver_container[iMGlevel-1][FLOW_SOL]->node[Point_Fine]->GetWindGustDer();
+        for (iDim = 0; iDim < nDim; iDim++) Gust[iDim] += Gust_Child[iDim]*Vol_Child/Vol;
+        for (unsigned short i = 0; i < 3; i++) GustDer[i] += GustDer_Child[i]*Vol_Child/Vol;
+      }
       
       solver_container[iMGlevel][FLOW_SOL]->node[iPoint]->SetWindGust(Gust);
       solver_container[iMGlevel][FLOW_SOL]->node[iPoint]->SetWindGustDer(GustDer);
       
-      GridVel = geometry_container[iMGlevel]->node[iPoint]->GetGridVel();
+      /*--- Reset the Grid Velocity to zero if there is no grid movement ---*/
       
-      /*--- Store new grid velocity ---*/
+      if (Kind_Grid_Movement == GUST) {
+        for (iDim = 0; iDim < nDim; iDim++)
+          geometry_container[iMGlevel]->node[iPoint]->SetGridVel(iDim, 0.0);
+      }
+      
+      GridVel = geometry_container[iMGlevel]->node[iPoint]->GetGridVel();
       
       for (iDim = 0; iDim < nDim; iDim++) {
         NewGridVel[iDim] = GridVel[iDim] - Gust[iDim];
@@ -1312,6 +1511,7 @@ void CHeatIteration::Update(COutput *output,
     
     /*--- Update dual time solver ---*/
     for (iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++) {
+      geometry_container[val_iZone][val_iInst][iMesh]->SetDualTime_History(config_container[val_iZone]);
       integration_container[val_iZone][val_iInst][HEAT_SOL]->SetDualTime_Solver(geometry_container[val_iZone][val_iInst][iMesh], solver_container[val_iZone][val_iInst][iMesh][HEAT_SOL], config_container[val_iZone], iMesh);
       integration_container[val_iZone][val_iInst][HEAT_SOL]->SetConvergence(false);
     }
@@ -2044,6 +2244,7 @@ void CAdjFluidIteration::Update(COutput *output,
     /*--- Update dual time solver ---*/
     
     for (iMesh = 0; iMesh <= config_container[val_iZone]->GetnMGLevels(); iMesh++) {
+      geometry_container[val_iZone][val_iInst][iMesh]->SetDualTime_History(config_container[val_iZone]);
       integration_container[val_iZone][val_iInst][ADJFLOW_SOL]->SetDualTime_Solver(geometry_container[val_iZone][val_iInst][iMesh], solver_container[val_iZone][val_iInst][iMesh][ADJFLOW_SOL], config_container[val_iZone], iMesh);
       integration_container[val_iZone][val_iInst][ADJFLOW_SOL]->SetConvergence(false);
     }
@@ -2107,9 +2308,11 @@ void CDiscAdjFluidIteration::Preprocess(COutput *output,
   int Direct_Iter;
   bool heat = config_container[val_iZone]->GetWeakly_Coupled_Heat();
 
-  /*--- For the unsteady adjoint, load direct solutions from restart files. ---*/
+  /*--- For the unsteady adjoint, load direct solutions from restart files
+   (unless they are recomputed from the checkpoints by the driver). ---*/
 
-  if (config_container[val_iZone]->GetUnsteady_Simulation()) {
+  if (config_container[val_iZone]->GetUnsteady_Simulation() &&
+      (config_container[val_iZone]->GetUnst_Adjoint_nCheckpoint() == 0)) {
 
     Direct_Iter = SU2_TYPE::Int(config_container[val_iZone]->GetUnst_AdjointIter()) - SU2_TYPE::Int(ExtIter) - 2;
 
@@ -2353,6 +2556,11 @@ void CDiscAdjFluidIteration::Iterate(COutput *output,
 
     solver_container[val_iZone][val_iInst][MESH_0][ADJFLOW_SOL]->ExtractAdjoint_Solution(geometry_container[val_iZone][val_iInst][MESH_0], config_container[val_iZone]);
 
+    /*--- Coarse grid correction of the adjoint solution (the residual of the fixed-point iteration is kept for the monitoring) ---*/
+
+    if (config_container[val_iZone]->GetDiscAdj_MultiGrid())
+      integration_container[val_iZone][val_iInst][ADJFLOW_SOL]->DiscAdj_MultiGrid_Correction(geometry_container, solver_container, config_container, val_iZone, val_iInst);
+
     solver_container[val_iZone][val_iInst][MESH_0][ADJFLOW_SOL]->ExtractAdjoint_Variables(geometry_container[val_iZone][val_iInst][MESH_0], config_container[val_iZone]);
 
     /*--- Set the convergence criteria (only residual possible) ---*/
@@ -2366,6 +2574,17 @@ void CDiscAdjFluidIteration::Iterate(COutput *output,
     solver_container[val_iZone][val_iInst][MESH_0][ADJTURB_SOL]->ExtractAdjoint_Solution(geometry_container[val_iZone][val_iInst][MESH_0],
                                                                               config_container[val_iZone]);
   }
+
+  /*--- Anderson acceleration of the fixed point of the flow and turbulence adjoints, the residuals
+   above are those of the current iterate ---*/
+
+  if ((Kind_Solver == DISC_ADJ_NAVIER_STOKES) || (Kind_Solver == DISC_ADJ_RANS) || (Kind_Solver == DISC_ADJ_EULER)) {
+    vector<unsigned short> iSol(1, ADJFLOW_SOL);
+    if (turbulent && !frozen_visc) iSol.push_back(ADJTURB_SOL);
+    Anderson_Iteration(solver_container[val_iZone][val_iInst][MESH_0], geometry_container[val_iZone][val_iInst][MESH_0],
+                       config_container[val_iZone], iSol);
+  }
+
   if (heat) {
 
     solver_container[val_iZone][val_iInst][MESH_0][ADJHEAT_SOL]->ExtractAdjoint_Solution(geometry_container[val_iZone][val_iInst][MESH_0],
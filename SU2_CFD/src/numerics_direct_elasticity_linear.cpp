@@ -255,6 +255,22 @@ void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_contain
 
 }
 
+void CFEALinearElasticity::Get_Constitutive_Matrix(CElement *element_container, CConfig *config, su2double *val_D) {
+
+  unsigned short iVar, jVar;
+  unsigned short bDim = (nDim == 2) ? 3 : 6;
+
+  /*--- Material properties of the element, as in Compute_Tangent_Matrix ---*/
+
+  SetElement_Properties(element_container, config);
+  Compute_Constitutive_Matrix(element_container, config);
+
+  for (iVar = 0; iVar < bDim; iVar++)
+    for (jVar = 0; jVar < bDim; jVar++)
+      val_D[iVar*bDim+jVar] = D_Mat[iVar][jVar];
+
+}
+
 void CFEALinearElasticity::Compute_Averaged_NodalStress(CElement *element, CConfig *config) {
 
   unsigned short iVar, jVar;
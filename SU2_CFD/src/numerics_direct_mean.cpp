@@ -232,6 +232,165 @@ void CCentJST_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   AD::EndPreacc();
 }
 
+void CCentJST_Flow::ComputeResidual_Batch(unsigned short nBatch, CConfig *config) {
+  
+  /*--- The vectorized kernel covers fixed grids, with grid movement the
+   edges are evaluated one by one ---*/
+  
+  if (grid_movement) {
+    CNumerics::ComputeResidual_Batch(nBatch, config);
+    return;
+  }
+  
+  PadBatch(nBatch);
+  
+  if (nDim == 2) ComputeResidual_Batch_Kernel<2>(config);
+  else ComputeResidual_Batch_Kernel<3>(config);
+  
+}
+
+template<unsigned short NDIM>
+void CCentJST_Flow::ComputeResidual_Batch_Kernel(CConfig *config) {
+  
+  /*--- Same data layout and loop structure as CUpwRoe_Flow::ComputeResidual_Batch_Kernel ---*/
+  
+  const unsigned short NVAR = NDIM+2, W = SIMD_WIDTH;
+  unsigned short iLane, iVar, iDim, jDim;
+  
+  su2double Area[W], Vel_i[NDIM][W], Vel_j[NDIM][W], MeanVel[NDIM][W];
+  su2double Rho_i[W], Rho_j[W], P_i[W], P_j[W], H_i[W], H_j[W], C_i[W], C_j[W];
+  su2double SqVel_i[W], SqVel_j[W], MeanRho[W], MeanP[W], MeanH[W], MeanE[W], MeanPhi[W], MeanA_1[W];
+  su2double ProjVel[W], ProjVel_i[W], ProjVel_j[W], MeanLambda_[W], Phi_i_[W], Phi_j_[W], Scale[W];
+  su2double Sc2[W], Sc4[W], Eps_2[W], Eps_4[W], Cte_0[W], Cte_1[W];
+  su2double U_i[NVAR][W], U_j[NVAR][W];
+  
+  const su2double Gm1 = Gamma_Minus_One;
+  
+  /*--- Primitive and conservative variables at points i and j ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    P_i[iLane]   = Batch_V_i[(NDIM+1)*W+iLane]; P_j[iLane]   = Batch_V_j[(NDIM+1)*W+iLane];
+    Rho_i[iLane] = Batch_V_i[(NDIM+2)*W+iLane]; Rho_j[iLane] = Batch_V_j[(NDIM+2)*W+iLane];
+    H_i[iLane]   = Batch_V_i[(NDIM+3)*W+iLane]; H_j[iLane]   = Batch_V_j[(NDIM+3)*W+iLane];
+    C_i[iLane]   = Batch_V_i[(NDIM+4)*W+iLane]; C_j[iLane]   = Batch_V_j[(NDIM+4)*W+iLane];
+    U_i[0][iLane] = Rho_i[iLane]; U_j[0][iLane] = Rho_j[iLane];
+    U_i[NVAR-1][iLane] = Rho_i[iLane]*H_i[iLane]-P_i[iLane];
+    U_j[NVAR-1][iLane] = Rho_j[iLane]*H_j[iLane]-P_j[iLane];
+    SqVel_i[iLane] = 0.0; SqVel_j[iLane] = 0.0;
+    ProjVel[iLane] = 0.0; ProjVel_i[iLane] = 0.0; ProjVel_j[iLane] = 0.0; Area[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      Vel_i[iDim][iLane] = Batch_V_i[(iDim+1)*W+iLane];
+      Vel_j[iDim][iLane] = Batch_V_j[(iDim+1)*W+iLane];
+      MeanVel[iDim][iLane] = 0.5*(Vel_i[iDim][iLane]+Vel_j[iDim][iLane]);
+      U_i[iDim+1][iLane] = Rho_i[iLane]*Vel_i[iDim][iLane];
+      U_j[iDim+1][iLane] = Rho_j[iLane]*Vel_j[iDim][iLane];
+      SqVel_i[iLane] += 0.5*Vel_i[iDim][iLane]*Vel_i[iDim][iLane];
+      SqVel_j[iLane] += 0.5*Vel_j[iDim][iLane]*Vel_j[iDim][iLane];
+      ProjVel[iLane]   += MeanVel[iDim][iLane]*Batch_Normal[iDim*W+iLane];
+      ProjVel_i[iLane] += Vel_i[iDim][iLane]*Batch_Normal[iDim*W+iLane];
+      ProjVel_j[iLane] += Vel_j[iDim][iLane]*Batch_Normal[iDim*W+iLane];
+      Area[iLane] += Batch_Normal[iDim*W+iLane]*Batch_Normal[iDim*W+iLane];
+    }
+  
+  /*--- Projected flux of the mean state ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    Area[iLane] = sqrt(Area[iLane]);
+    MeanRho[iLane] = 0.5*(Rho_i[iLane]+Rho_j[iLane]);
+    MeanP[iLane] = 0.5*(P_i[iLane]+P_j[iLane]);
+    MeanH[iLane] = 0.5*(H_i[iLane]+H_j[iLane]);
+    MeanE[iLane] = 0.5*(H_i[iLane]-P_i[iLane]/Rho_i[iLane] + H_j[iLane]-P_j[iLane]/Rho_j[iLane]);
+    Batch_Residual[0*W+iLane] = MeanRho[iLane]*ProjVel[iLane];
+    Batch_Residual[(NVAR-1)*W+iLane] = MeanRho[iLane]*MeanH[iLane]*ProjVel[iLane];
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++)
+      Batch_Residual[(iDim+1)*W+iLane] = MeanRho[iLane]*MeanVel[iDim][iLane]*ProjVel[iLane] + MeanP[iLane]*Batch_Normal[iDim*W+iLane];
+  
+  /*--- Artificial dissipation coefficients ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    MeanLambda_[iLane] = 0.5*(fabs(ProjVel_i[iLane])+C_i[iLane]*Area[iLane] + fabs(ProjVel_j[iLane])+C_j[iLane]*Area[iLane]);
+    Phi_i_[iLane] = pow(Batch_Lambda_i[iLane]/(4.0*MeanLambda_[iLane]), Param_p);
+    Phi_j_[iLane] = pow(Batch_Lambda_j[iLane]/(4.0*MeanLambda_[iLane]), Param_p);
+    Scale[iLane] = 4.0*Phi_i_[iLane]*Phi_j_[iLane]/(Phi_i_[iLane]+Phi_j_[iLane])*MeanLambda_[iLane];
+    Sc2[iLane] = 3.0*(su2double(Batch_Neighbor_i[iLane])+su2double(Batch_Neighbor_j[iLane]))/
+                 (su2double(Batch_Neighbor_i[iLane])*su2double(Batch_Neighbor_j[iLane]));
+    Sc4[iLane] = Sc2[iLane]*Sc2[iLane]/4.0;
+    Eps_2[iLane] = Param_Kappa_2*0.5*(Batch_Sensor_i[iLane]+Batch_Sensor_j[iLane])*Sc2[iLane];
+    Eps_4[iLane] = max(0.0, Param_Kappa_4-Eps_2[iLane])*Sc4[iLane];
+  }
+  
+  /*--- Dissipation, with the enthalpy in the difference of the last variable ---*/
+  
+  for (iVar = 0; iVar < NVAR; iVar++)
+    for (iLane = 0; iLane < W; iLane++)
+      Batch_Residual[iVar*W+iLane] += (Eps_2[iLane]*(U_i[iVar][iLane]-U_j[iVar][iLane] + ((iVar == NVAR-1)? P_i[iLane]-P_j[iLane] : 0.0)) -
+                                       Eps_4[iLane]*(Batch_Und_Lapl_i[iVar*W+iLane]-Batch_Und_Lapl_j[iVar*W+iLane]))*Scale[iLane];
+  
+  if (!implicit) return;
+  
+  /*--- Jacobian of the flux of the mean state, scale = 0.5 (see GetInviscidProjJac) ---*/
+  
+  su2double *J = Batch_Jacobian_i;
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    MeanPhi[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++)
+      MeanPhi[iLane] += 0.5*Gm1*MeanVel[iDim][iLane]*MeanVel[iDim][iLane];
+  for (iLane = 0; iLane < W; iLane++) {
+    MeanA_1[iLane] = Gamma*MeanE[iLane]-MeanPhi[iLane];
+    J[(0*NVAR+0)*W+iLane] = 0.0;
+    J[(0*NVAR+NVAR-1)*W+iLane] = 0.0;
+    J[((NVAR-1)*NVAR+0)*W+iLane] = 0.5*ProjVel[iLane]*(MeanPhi[iLane]-MeanA_1[iLane]);
+    J[((NVAR-1)*NVAR+NVAR-1)*W+iLane] = 0.5*Gamma*ProjVel[iLane];
+  }
+  for (iDim = 0; iDim < NDIM; iDim++) {
+    for (iLane = 0; iLane < W; iLane++) {
+      J[(0*NVAR+iDim+1)*W+iLane] = 0.5*Batch_Normal[iDim*W+iLane];
+      J[((iDim+1)*NVAR+0)*W+iLane] = 0.5*(Batch_Normal[iDim*W+iLane]*MeanPhi[iLane] - MeanVel[iDim][iLane]*ProjVel[iLane]);
+      J[((iDim+1)*NVAR+NVAR-1)*W+iLane] = 0.5*Gm1*Batch_Normal[iDim*W+iLane];
+      J[((NVAR-1)*NVAR+iDim+1)*W+iLane] = 0.5*(Batch_Normal[iDim*W+iLane]*MeanA_1[iLane] - Gm1*MeanVel[iDim][iLane]*ProjVel[iLane]);
+    }
+    for (jDim = 0; jDim < NDIM; jDim++)
+      for (iLane = 0; iLane < W; iLane++)
+        J[((iDim+1)*NVAR+jDim+1)*W+iLane] = 0.5*(Batch_Normal[jDim*W+iLane]*MeanVel[iDim][iLane] -
+                                                 Gm1*Batch_Normal[iDim*W+iLane]*MeanVel[jDim][iLane] +
+                                                 ((iDim == jDim)? ProjVel[iLane] : 0.0));
+  }
+  for (iVar = 0; iVar < NVAR*NVAR; iVar++)
+    for (iLane = 0; iLane < W; iLane++)
+      Batch_Jacobian_j[iVar*W+iLane] = J[iVar*W+iLane];
+  
+  /*--- Dissipation part of the Jacobians ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    Cte_0[iLane] = (Eps_2[iLane] + Eps_4[iLane]*su2double(Batch_Neighbor_i[iLane]+1))*Scale[iLane];
+    Cte_1[iLane] = (Eps_2[iLane] + Eps_4[iLane]*su2double(Batch_Neighbor_j[iLane]+1))*Scale[iLane];
+  }
+  for (iVar = 0; iVar < NVAR-1; iVar++)
+    for (iLane = 0; iLane < W; iLane++) {
+      Batch_Jacobian_i[(iVar*NVAR+iVar)*W+iLane] += Cte_0[iLane];
+      Batch_Jacobian_j[(iVar*NVAR+iVar)*W+iLane] -= Cte_1[iLane];
+    }
+  for (iLane = 0; iLane < W; iLane++) {
+    Batch_Jacobian_i[((NVAR-1)*NVAR+0)*W+iLane] += Cte_0[iLane]*Gm1*SqVel_i[iLane];
+    Batch_Jacobian_j[((NVAR-1)*NVAR+0)*W+iLane] -= Cte_1[iLane]*Gm1*SqVel_j[iLane];
+    Batch_Jacobian_i[((NVAR-1)*NVAR+NVAR-1)*W+iLane] += Cte_0[iLane]*Gamma;
+    Batch_Jacobian_j[((NVAR-1)*NVAR+NVAR-1)*W+iLane] -= Cte_1[iLane]*Gamma;
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      Batch_Jacobian_i[((NVAR-1)*NVAR+iDim+1)*W+iLane] -= Cte_0[iLane]*Gm1*Vel_i[iDim][iLane];
+      Batch_Jacobian_j[((NVAR-1)*NVAR+iDim+1)*W+iLane] += Cte_1[iLane]*Gm1*Vel_j[iDim][iLane];
+    }
+  
+}
+
 CCentJST_KE_Flow::CCentJST_KE_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -457,6 +616,14 @@ void CCentLax_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   
   su2double U_i[5] = {0.0,0.0,0.0,0.0,0.0}, U_j[5] = {0.0,0.0,0.0,0.0,0.0};
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+5); AD::SetPreaccIn(V_j, nDim+5);
+  AD::SetPreaccIn(Lambda_i);    AD::SetPreaccIn(Lambda_j);
+  if (grid_movement) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   /*--- Pressure, density, enthalpy, energy, and velocity at points i and j ---*/
   
   Pressure_i = V_i[nDim+1];                       Pressure_j = V_j[nDim+1];
@@ -589,6 +756,9 @@ void CCentLax_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
     val_Jacobian_j[nVar-1][nVar-1] -= cte*Gamma;
     
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
   
 }
 
@@ -633,6 +803,10 @@ CUpwCUSP_Flow::~CUpwCUSP_Flow(void) {
 void CUpwCUSP_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j,
                                      CConfig *config) {
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+
   /*--- Pressure, density, enthalpy, energy, and velocity at points i and j ---*/
   
   Pressure_i = V_i[nDim+1];                       Pressure_j = V_j[nDim+1];
@@ -778,6 +952,9 @@ void CUpwCUSP_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
         val_Jacobian_j[iVar][jVar] -= cte_1*Jacobian[iVar][jVar];
     
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
   
 }
 
@@ -829,6 +1006,10 @@ CUpwAUSM_Flow::~CUpwAUSM_Flow(void) {
 
 void CUpwAUSM_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+
   /*--- Face area (norm or the normal vector) ---*/
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
@@ -948,6 +1129,9 @@ void CUpwAUSM_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwAUSMPLUSUP_Flow::CUpwAUSMPLUSUP_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
@@ -1000,6 +1184,10 @@ CUpwAUSMPLUSUP_Flow::~CUpwAUSMPLUSUP_Flow(void) {
 
 void CUpwAUSMPLUSUP_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+
   /*--- Face area (norm or the normal vector) ---*/
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
@@ -1150,6 +1338,9 @@ void CUpwAUSMPLUSUP_Flow::ComputeResidual(su2double *val_residual, su2double **v
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwAUSMPLUSUP2_Flow::CUpwAUSMPLUSUP2_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
@@ -1202,6 +1393,10 @@ CUpwAUSMPLUSUP2_Flow::~CUpwAUSMPLUSUP2_Flow(void) {
 
 void CUpwAUSMPLUSUP2_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+
   /*--- Face area (norm or the normal vector) ---*/
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
@@ -1358,6 +1553,9 @@ void CUpwAUSMPLUSUP2_Flow::ComputeResidual(su2double *val_residual, su2double **
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwSLAU_Flow::CUpwSLAU_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config, bool val_low_dissipation) : CNumerics(val_nDim, val_nVar, config) {
@@ -1410,6 +1608,14 @@ CUpwSLAU_Flow::~CUpwSLAU_Flow(void) {
 
 void CUpwSLAU_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
    
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+  if (slau_low_diss) {
+    AD::SetPreaccIn(Sensor_i); AD::SetPreaccIn(Sensor_j);
+    AD::SetPreaccIn(Dissipation_i); AD::SetPreaccIn(Dissipation_j);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
@@ -1557,6 +1763,9 @@ void CUpwSLAU_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwSLAU2_Flow::CUpwSLAU2_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config, bool val_low_dissipation) : CNumerics(val_nDim, val_nVar, config) {
@@ -1609,6 +1818,14 @@ CUpwSLAU2_Flow::~CUpwSLAU2_Flow(void) {
 
 void CUpwSLAU2_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
    
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+  if (slau_low_dissipation) {
+    AD::SetPreaccIn(Sensor_i); AD::SetPreaccIn(Sensor_j);
+    AD::SetPreaccIn(Dissipation_i); AD::SetPreaccIn(Dissipation_j);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
   Area = 0.0;
   for (iDim = 0; iDim < nDim; iDim++)
@@ -1756,6 +1973,9 @@ void CUpwSLAU2_Flow::ComputeResidual(su2double *val_residual, su2double **val_Ja
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 CUpwHLLC_Flow::CUpwHLLC_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
@@ -1798,6 +2018,13 @@ CUpwHLLC_Flow::~CUpwHLLC_Flow(void) {
 
 void CUpwHLLC_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+  if (grid_movement) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
   
   Area = 0.0;
@@ -2264,6 +2491,9 @@ if (sM > 0.0) {
       val_Jacobian_j[iVar][jVar] *=   Area;
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
 }
 
 }
@@ -3200,66 +3430,75 @@ CUpwRoe_Flow::~CUpwRoe_Flow(void) {
 
 void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
+  if (nDim == 2) ComputeResidual_Kernel<2>(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  else ComputeResidual_Kernel<3>(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  
+}
+
+template<unsigned short NDIM>
+void CUpwRoe_Flow::ComputeResidual_Kernel(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
+  
   su2double U_i[5] = {0.0,0.0,0.0,0.0,0.0}, U_j[5] = {0.0,0.0,0.0,0.0,0.0};
   su2double ProjGridVel = 0.0;
+  const unsigned short NVAR = NDIM+2;
 
   AD::StartPreacc();
-  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4); AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, NDIM+4); AD::SetPreaccIn(V_j, NDIM+4); AD::SetPreaccIn(Normal, NDIM);
   if (grid_movement) {
-    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+    AD::SetPreaccIn(GridVel_i, NDIM); AD::SetPreaccIn(GridVel_j, NDIM);
   }
   if (roe_low_dissipation){
     AD::SetPreaccIn(Sensor_i); AD::SetPreaccIn(Sensor_j);
     AD::SetPreaccIn(Dissipation_i); AD::SetPreaccIn(Dissipation_j);
-    AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
+    AD::SetPreaccIn(Coord_i, NDIM); AD::SetPreaccIn(Coord_j, NDIM);
   }
   
   /*--- Face area (norm or the normal vector) ---*/
 
   Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     Area += Normal[iDim]*Normal[iDim];
   Area = sqrt(Area);
   
   /*-- Unit Normal ---*/
   
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     UnitNormal[iDim] = Normal[iDim]/Area;
   
   /*--- Primitive variables at point i ---*/
   
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     Velocity_i[iDim] = V_i[iDim+1];
-  Pressure_i = V_i[nDim+1];
-  Density_i = V_i[nDim+2];
-  Enthalpy_i = V_i[nDim+3];
+  Pressure_i = V_i[NDIM+1];
+  Density_i = V_i[NDIM+2];
+  Enthalpy_i = V_i[NDIM+3];
   Energy_i = Enthalpy_i - Pressure_i/Density_i;
   SoundSpeed_i = sqrt(fabs(Pressure_i*Gamma/Density_i));
  
   /*--- Primitive variables at point j ---*/
   
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     Velocity_j[iDim] = V_j[iDim+1];
-  Pressure_j = V_j[nDim+1];
-  Density_j = V_j[nDim+2];
-  Enthalpy_j = V_j[nDim+3];
+  Pressure_j = V_j[NDIM+1];
+  Density_j = V_j[NDIM+2];
+  Enthalpy_j = V_j[NDIM+3];
   Energy_j = Enthalpy_j - Pressure_j/Density_j;
   SoundSpeed_j = sqrt(fabs(Pressure_j*Gamma/Density_j));
 
   /*--- Recompute conservative variables ---*/
   
   U_i[0] = Density_i; U_j[0] = Density_j;
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (iDim = 0; iDim < NDIM; iDim++) {
     U_i[iDim+1] = Density_i*Velocity_i[iDim]; U_j[iDim+1] = Density_j*Velocity_j[iDim];
   }
-  U_i[nDim+1] = Density_i*Energy_i; U_j[nDim+1] = Density_j*Energy_j;
+  U_i[NDIM+1] = Density_i*Energy_i; U_j[NDIM+1] = Density_j*Energy_j;
   
   /*--- Roe-averaged variables at interface between i & j ---*/
   
   R = sqrt(fabs(Density_j/Density_i));
   RoeDensity = R*Density_i;
   sq_vel = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (iDim = 0; iDim < NDIM; iDim++) {
     RoeVelocity[iDim] = (R*Velocity_j[iDim]+Velocity_i[iDim])/(R+1);
     sq_vel += RoeVelocity[iDim]*RoeVelocity[iDim];
   }
@@ -3272,14 +3511,14 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
    without computing the fluxes ---*/
   
   if (RoeSoundSpeed2 <= 0.0) {
-    for (iVar = 0; iVar < nVar; iVar++) {
+    for (iVar = 0; iVar < NVAR; iVar++) {
       val_residual[iVar] = 0.0;
-      for (jVar = 0; jVar < nVar; jVar++) {
+      for (jVar = 0; jVar < NVAR; jVar++) {
         val_Jacobian_i[iVar][iVar] = 0.0;
         val_Jacobian_j[iVar][iVar] = 0.0;
       }
     }
-    AD::SetPreaccOut(val_residual, nVar);
+    AD::SetPreaccOut(val_residual, NVAR);
     AD::EndPreacc();
     return;
   }
@@ -3299,7 +3538,7 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   GetPMatrix(&RoeDensity, RoeVelocity, &RoeSoundSpeed, UnitNormal, P_Tensor);
   
   ProjVelocity = 0.0; ProjVelocity_i = 0.0; ProjVelocity_j = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (iDim = 0; iDim < NDIM; iDim++) {
     ProjVelocity   += RoeVelocity[iDim]*UnitNormal[iDim];
     ProjVelocity_i += Velocity_i[iDim]*UnitNormal[iDim];
     ProjVelocity_j += Velocity_j[iDim]*UnitNormal[iDim];
@@ -3309,7 +3548,7 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
   if (grid_movement) {
     ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++) {
+    for (iDim = 0; iDim < NDIM; iDim++) {
       ProjGridVel   += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*UnitNormal[iDim];
     }
     ProjVelocity   -= ProjGridVel;
@@ -3319,18 +3558,18 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
   /*--- Flow eigenvalues and entropy correctors ---*/
   
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     Lambda[iDim] = ProjVelocity;
   
-  Lambda[nVar-2] = ProjVelocity + RoeSoundSpeed;
-  Lambda[nVar-1] = ProjVelocity - RoeSoundSpeed;
+  Lambda[NVAR-2] = ProjVelocity + RoeSoundSpeed;
+  Lambda[NVAR-1] = ProjVelocity - RoeSoundSpeed;
   
   /*--- Compute absolute value with Mavriplis' entropy correction ---*/
   
   MaxLambda = fabs(ProjVelocity) + RoeSoundSpeed;
   Delta = config->GetEntropyFix_Coeff();
   
-  for (iVar = 0; iVar < nVar; iVar++) {
+  for (iVar = 0; iVar < NVAR; iVar++) {
     Lambda[iVar] = max(fabs(Lambda[iVar]), Delta*MaxLambda);
   }
   
@@ -3341,13 +3580,13 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   /*--- Jacobians of the inviscid flux, scaled by
    kappa because val_resconv ~ kappa*(fc_i+fc_j)*Normal ---*/
   if (implicit) {
-    GetInviscidProjJac(Velocity_i, &Energy_i, Normal, kappa, val_Jacobian_i);
-    GetInviscidProjJac(Velocity_j, &Energy_j, Normal, kappa, val_Jacobian_j);
+    GetInviscidProjJac_Kernel<NDIM>(Velocity_i, &Energy_i, Normal, kappa, val_Jacobian_i);
+    GetInviscidProjJac_Kernel<NDIM>(Velocity_j, &Energy_j, Normal, kappa, val_Jacobian_j);
   }
   
   /*--- Diference variables iPoint and jPoint ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++)
+  for (iVar = 0; iVar < NVAR; iVar++)
     Diff_U[iVar] = U_j[iVar]-U_i[iVar];
   
   if (roe_low_dissipation)
@@ -3355,15 +3594,15 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
   /*--- Roe's Flux approximation ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++) {
+  for (iVar = 0; iVar < NVAR; iVar++) {
     
     val_residual[iVar] = kappa*(ProjFlux_i[iVar]+ProjFlux_j[iVar]);
-    for (jVar = 0; jVar < nVar; jVar++) {
+    for (jVar = 0; jVar < NVAR; jVar++) {
       Proj_ModJac_Tensor_ij = 0.0;
       
         /*--- Compute |Proj_ModJac_Tensor| = P x |Lambda| x inverse P ---*/
         
-        for (kVar = 0; kVar < nVar; kVar++)
+        for (kVar = 0; kVar < NVAR; kVar++)
           Proj_ModJac_Tensor_ij += P_Tensor[iVar][kVar]*Lambda[kVar]*invP_Tensor[kVar][jVar];
 
         val_residual[iVar] -= (1.0-kappa)*Proj_ModJac_Tensor_ij*Diff_U[jVar]*Area*Dissipation_ij;
@@ -3378,9 +3617,9 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
   
   if (grid_movement) {
     ProjVelocity = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
+    for (iDim = 0; iDim < NDIM; iDim++)
       ProjVelocity += 0.5*(GridVel_i[iDim]+GridVel_j[iDim])*Normal[iDim];
-    for (iVar = 0; iVar < nVar; iVar++) {
+    for (iVar = 0; iVar < NVAR; iVar++) {
       val_residual[iVar] -= ProjVelocity * 0.5*(U_i[iVar]+U_j[iVar]);
       
       /*--- Implicit terms ---*/
@@ -3391,11 +3630,220 @@ void CUpwRoe_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jaco
     }
   }
   
-  AD::SetPreaccOut(val_residual, nVar);
+  AD::SetPreaccOut(val_residual, NVAR);
   AD::EndPreacc();
   
 }
 
+void CUpwRoe_Flow::ComputeResidual_Batch(unsigned short nBatch, CConfig *config) {
+  
+  /*--- The vectorized kernel covers the ideal gas on fixed grids, other
+   cases are evaluated edge by edge ---*/
+  
+  if (grid_movement || roe_low_dissipation) {
+    CNumerics::ComputeResidual_Batch(nBatch, config);
+    return;
+  }
+  
+  PadBatch(nBatch);
+  
+  if (nDim == 2) ComputeResidual_Batch_Kernel<2>(config);
+  else ComputeResidual_Batch_Kernel<3>(config);
+  
+}
+
+template<unsigned short NDIM>
+void CUpwRoe_Flow::ComputeResidual_Batch_Kernel(CConfig *config) {
+  
+  /*--- All the loops over the edges of the batch (iLane) are innermost and of
+   fixed length, the data is stored as [index*SIMD_WIDTH+iLane], such that the
+   compiler can vectorize them. The dissipation matrix P x |Lambda| x inverse P
+   is computed in closed form from the acoustic and shear waves. ---*/
+  
+  const unsigned short NVAR = NDIM+2, W = SIMD_WIDTH;
+  unsigned short iLane, iVar, jVar, iDim, jDim;
+  
+  su2double Area[W], UnitNormal_[NDIM][W];
+  su2double Vel_i[NDIM][W], Vel_j[NDIM][W], RoeVel[NDIM][W];
+  su2double Rho_i[W], Rho_j[W], P_i[W], P_j[W], H_i[W], H_j[W];
+  su2double U_i[NVAR][W], U_j[NVAR][W], Flux[NVAR][W];
+  su2double R_[W], RoeH[W], RoeC[W], SqVel[W], Valid[W];
+  su2double ProjVel[W], ProjVel_i[W], ProjVel_j[W], Lambda_1[W], Lambda_P[W], Lambda_M[W], MaxLambda_[W], S_1[W], S_2[W];
+  su2double L_p[NVAR][W], L_n[NVAR][W], R_1[NVAR][W], R_2[NVAR][W], C_1[NVAR][W], C_2[NVAR][W];
+  su2double ModJac[NVAR][NVAR][W];
+  
+  const su2double Delta_ = config->GetEntropyFix_Coeff(), Kappa_ = kappa, Gm1 = Gamma_Minus_One;
+  
+  /*--- Face area and unit normal ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) Area[iLane] = 0.0;
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++)
+      Area[iLane] += Batch_Normal[iDim*W+iLane]*Batch_Normal[iDim*W+iLane];
+  for (iLane = 0; iLane < W; iLane++) Area[iLane] = sqrt(Area[iLane]);
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++)
+      UnitNormal_[iDim][iLane] = Batch_Normal[iDim*W+iLane]/Area[iLane];
+  
+  /*--- Primitive and conservative variables at points i and j ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    P_i[iLane]   = Batch_V_i[(NDIM+1)*W+iLane]; P_j[iLane]   = Batch_V_j[(NDIM+1)*W+iLane];
+    Rho_i[iLane] = Batch_V_i[(NDIM+2)*W+iLane]; Rho_j[iLane] = Batch_V_j[(NDIM+2)*W+iLane];
+    H_i[iLane]   = Batch_V_i[(NDIM+3)*W+iLane]; H_j[iLane]   = Batch_V_j[(NDIM+3)*W+iLane];
+    U_i[0][iLane] = Rho_i[iLane]; U_j[0][iLane] = Rho_j[iLane];
+    U_i[NVAR-1][iLane] = Rho_i[iLane]*H_i[iLane]-P_i[iLane];
+    U_j[NVAR-1][iLane] = Rho_j[iLane]*H_j[iLane]-P_j[iLane];
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      Vel_i[iDim][iLane] = Batch_V_i[(iDim+1)*W+iLane];
+      Vel_j[iDim][iLane] = Batch_V_j[(iDim+1)*W+iLane];
+      U_i[iDim+1][iLane] = Rho_i[iLane]*Vel_i[iDim][iLane];
+      U_j[iDim+1][iLane] = Rho_j[iLane]*Vel_j[iDim][iLane];
+    }
+  
+  /*--- Roe-averaged variables, the edges with a negative Roe sound speed
+   (too large jump) get a zero flux, as in the scalar scheme ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    R_[iLane] = sqrt(fabs(Rho_j[iLane]/Rho_i[iLane]));
+    RoeH[iLane] = (R_[iLane]*H_j[iLane]+H_i[iLane])/(R_[iLane]+1.0);
+    SqVel[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      RoeVel[iDim][iLane] = (R_[iLane]*Vel_j[iDim][iLane]+Vel_i[iDim][iLane])/(R_[iLane]+1.0);
+      SqVel[iLane] += RoeVel[iDim][iLane]*RoeVel[iDim][iLane];
+    }
+  for (iLane = 0; iLane < W; iLane++) {
+    RoeC[iLane] = Gm1*(RoeH[iLane]-0.5*SqVel[iLane]);
+    Valid[iLane] = (RoeC[iLane] > 0.0)? 1.0 : 0.0;
+    RoeC[iLane] = sqrt(Valid[iLane]*RoeC[iLane] + (1.0-Valid[iLane]));
+  }
+  
+  /*--- Projected velocities and fluxes ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    ProjVel[iLane] = 0.0; ProjVel_i[iLane] = 0.0; ProjVel_j[iLane] = 0.0;
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      ProjVel[iLane]   += RoeVel[iDim][iLane]*UnitNormal_[iDim][iLane];
+      ProjVel_i[iLane] += Vel_i[iDim][iLane]*Batch_Normal[iDim*W+iLane];
+      ProjVel_j[iLane] += Vel_j[iDim][iLane]*Batch_Normal[iDim*W+iLane];
+    }
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    Flux[0][iLane] = Rho_i[iLane]*ProjVel_i[iLane] + Rho_j[iLane]*ProjVel_j[iLane];
+    Flux[NVAR-1][iLane] = Rho_i[iLane]*H_i[iLane]*ProjVel_i[iLane] + Rho_j[iLane]*H_j[iLane]*ProjVel_j[iLane];
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++)
+      Flux[iDim+1][iLane] = U_i[iDim+1][iLane]*ProjVel_i[iLane] + U_j[iDim+1][iLane]*ProjVel_j[iLane] +
+                            (P_i[iLane]+P_j[iLane])*Batch_Normal[iDim*W+iLane];
+  
+  /*--- Eigenvalues with Mavriplis' entropy correction, and the coefficients of
+   the acoustic waves: S_1 = (|l+|+|l-|)/2-|l|, S_2 = (|l+|-|l-|)/2 ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    MaxLambda_[iLane] = fabs(ProjVel[iLane]) + RoeC[iLane];
+    Lambda_1[iLane] = max(fabs(ProjVel[iLane]), Delta_*MaxLambda_[iLane]);
+    Lambda_P[iLane] = max(fabs(ProjVel[iLane]+RoeC[iLane]), Delta_*MaxLambda_[iLane]);
+    Lambda_M[iLane] = max(fabs(ProjVel[iLane]-RoeC[iLane]), Delta_*MaxLambda_[iLane]);
+    S_1[iLane] = 0.5*(Lambda_P[iLane]+Lambda_M[iLane]) - Lambda_1[iLane];
+    S_2[iLane] = 0.5*(Lambda_P[iLane]-Lambda_M[iLane]);
+  }
+  
+  /*--- |A| = |l| I + R_1 x (S_1/c^2 L_p + S_2/c L_n) + R_2 x (S_2/c L_p + S_1 L_n), where
+   L_p.dU = dp, L_n.dU = rho*dvn, R_1 = (1, u, H) and R_2 = (0, n, vn) ---*/
+  
+  for (iLane = 0; iLane < W; iLane++) {
+    L_p[0][iLane] = 0.5*Gm1*SqVel[iLane];        L_n[0][iLane] = -ProjVel[iLane];
+    L_p[NVAR-1][iLane] = Gm1;                    L_n[NVAR-1][iLane] = 0.0;
+    R_1[0][iLane] = 1.0;                         R_2[0][iLane] = 0.0;
+    R_1[NVAR-1][iLane] = RoeH[iLane];            R_2[NVAR-1][iLane] = ProjVel[iLane];
+  }
+  for (iDim = 0; iDim < NDIM; iDim++)
+    for (iLane = 0; iLane < W; iLane++) {
+      L_p[iDim+1][iLane] = -Gm1*RoeVel[iDim][iLane]; L_n[iDim+1][iLane] = UnitNormal_[iDim][iLane];
+      R_1[iDim+1][iLane] = RoeVel[iDim][iLane];      R_2[iDim+1][iLane] = UnitNormal_[iDim][iLane];
+    }
+  for (jVar = 0; jVar < NVAR; jVar++)
+    for (iLane = 0; iLane < W; iLane++) {
+      C_1[jVar][iLane] = S_1[iLane]/(RoeC[iLane]*RoeC[iLane])*L_p[jVar][iLane] + S_2[iLane]/RoeC[iLane]*L_n[jVar][iLane];
+      C_2[jVar][iLane] = S_2[iLane]/RoeC[iLane]*L_p[jVar][iLane] + S_1[iLane]*L_n[jVar][iLane];
+    }
+  for (iVar = 0; iVar < NVAR; iVar++)
+    for (jVar = 0; jVar < NVAR; jVar++)
+      for (iLane = 0; iLane < W; iLane++)
+        ModJac[iVar][jVar][iLane] = (R_1[iVar][iLane]*C_1[jVar][iLane] + R_2[iVar][iLane]*C_2[jVar][iLane] +
+                                     ((iVar == jVar)? Lambda_1[iLane] : 0.0))*(1.0-Kappa_)*Area[iLane];
+  
+  /*--- Roe's flux approximation ---*/
+  
+  for (iVar = 0; iVar < NVAR; iVar++) {
+    for (iLane = 0; iLane < W; iLane++)
+      Batch_Residual[iVar*W+iLane] = Kappa_*Flux[iVar][iLane];
+    for (jVar = 0; jVar < NVAR; jVar++)
+      for (iLane = 0; iLane < W; iLane++)
+        Batch_Residual[iVar*W+iLane] -= ModJac[iVar][jVar][iLane]*(U_j[jVar][iLane]-U_i[jVar][iLane]);
+    for (iLane = 0; iLane < W; iLane++)
+      Batch_Residual[iVar*W+iLane] *= Valid[iLane];
+  }
+  
+  if (!implicit) return;
+  
+  /*--- Jacobians of the inviscid flux (see GetInviscidProjJac), scaled by kappa,
+   plus the dissipation matrix ---*/
+  
+  su2double *Jac[2] = {Batch_Jacobian_i, Batch_Jacobian_j}, (*Vel)[W], *H, *P, *Rho, *ProjVel_N, *J, Phi[W], A_1[W], Sign;
+  unsigned short iSide;
+  
+  for (iSide = 0; iSide < 2; iSide++) {
+    
+    Vel = (iSide == 0)? Vel_i : Vel_j;
+    H   = (iSide == 0)? H_i : H_j;
+    P   = (iSide == 0)? P_i : P_j;
+    Rho = (iSide == 0)? Rho_i : Rho_j;
+    ProjVel_N = (iSide == 0)? ProjVel_i : ProjVel_j;
+    Sign = (iSide == 0)? 1.0 : -1.0;
+    J = Jac[iSide];
+    
+    for (iLane = 0; iLane < W; iLane++) Phi[iLane] = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++)
+      for (iLane = 0; iLane < W; iLane++)
+        Phi[iLane] += 0.5*Gm1*Vel[iDim][iLane]*Vel[iDim][iLane];
+    for (iLane = 0; iLane < W; iLane++) {
+      A_1[iLane] = Gamma*(H[iLane]-P[iLane]/Rho[iLane])-Phi[iLane];
+      J[(0*NVAR+0)*W+iLane] = 0.0;
+      J[(0*NVAR+NVAR-1)*W+iLane] = 0.0;
+      J[((NVAR-1)*NVAR+0)*W+iLane] = Kappa_*ProjVel_N[iLane]*(Phi[iLane]-A_1[iLane]);
+      J[((NVAR-1)*NVAR+NVAR-1)*W+iLane] = Kappa_*Gamma*ProjVel_N[iLane];
+    }
+    
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      for (iLane = 0; iLane < W; iLane++) {
+        J[(0*NVAR+iDim+1)*W+iLane] = Kappa_*Batch_Normal[iDim*W+iLane];
+        J[((iDim+1)*NVAR+0)*W+iLane] = Kappa_*(Batch_Normal[iDim*W+iLane]*Phi[iLane] - Vel[iDim][iLane]*ProjVel_N[iLane]);
+        J[((iDim+1)*NVAR+NVAR-1)*W+iLane] = Kappa_*Gm1*Batch_Normal[iDim*W+iLane];
+        J[((NVAR-1)*NVAR+iDim+1)*W+iLane] = Kappa_*(Batch_Normal[iDim*W+iLane]*A_1[iLane] - Gm1*Vel[iDim][iLane]*ProjVel_N[iLane]);
+      }
+      for (jDim = 0; jDim < NDIM; jDim++)
+        for (iLane = 0; iLane < W; iLane++)
+          J[((iDim+1)*NVAR+jDim+1)*W+iLane] = Kappa_*(Batch_Normal[jDim*W+iLane]*Vel[iDim][iLane] -
+                                                      Gm1*Batch_Normal[iDim*W+iLane]*Vel[jDim][iLane] +
+                                                      ((iDim == jDim)? ProjVel_N[iLane] : 0.0));
+    }
+    
+    for (iVar = 0; iVar < NVAR; iVar++)
+      for (jVar = 0; jVar < NVAR; jVar++)
+        for (iLane = 0; iLane < W; iLane++)
+          J[(iVar*NVAR+jVar)*W+iLane] = (J[(iVar*NVAR+jVar)*W+iLane] + Sign*ModJac[iVar][jVar][iLane])*Valid[iLane];
+  }
+  
+}
+
 CUpwGeneralRoe_Flow::CUpwGeneralRoe_Flow(unsigned short val_nDim, unsigned short val_nVar, CConfig *config) : CNumerics(val_nDim, val_nVar, config) {
 
   implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
@@ -4392,6 +4840,11 @@ void CUpwMSW_Flow::ComputeResidual(su2double *val_residual,
   su2double alpha, w, dp, onemw;
   su2double Proj_ModJac_Tensor_i, Proj_ModJac_Tensor_j;
   
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+5); AD::SetPreaccIn(V_j, nDim+5);
+  AD::SetPreaccIn(U_i, nVar); AD::SetPreaccIn(U_j, nVar);
+
   /*--- Set parameters in the numerical method ---*/
   alpha = 6.0;
   
@@ -4530,6 +4983,9 @@ void CUpwMSW_Flow::ComputeResidual(su2double *val_residual,
   for (iVar = 0; iVar < nVar; iVar++) {
     val_residual[iVar] = Fc_i[iVar]+Fc_j[iVar];
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
   
 }
 
@@ -4595,6 +5051,13 @@ void CUpwTurkel_Flow::ComputeResidual(su2double *val_residual, su2double **val_J
   
   su2double U_i[5] = {0.0,0.0,0.0,0.0,0.0}, U_j[5] = {0.0,0.0,0.0,0.0,0.0};
 
+  AD::StartPreacc();
+  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(V_i, nDim+4); AD::SetPreaccIn(V_j, nDim+4);
+  if (grid_movement) {
+    AD::SetPreaccIn(GridVel_i, nDim); AD::SetPreaccIn(GridVel_j, nDim);
+  }
+
   /*--- Face area (norm or the normal vector) ---*/
   
   Area = 0.0;
@@ -4758,6 +5221,9 @@ void CUpwTurkel_Flow::ComputeResidual(su2double *val_residual, su2double **val_J
       }
     }
   }
+
+  AD::SetPreaccOut(val_residual, nVar);
+  AD::EndPreacc();
   
 }
 
@@ -4834,12 +5300,23 @@ void CAvgGrad_Base::CorrectGradient(su2double** GradPrimVar,
                                     const su2double* val_edge_vector,
                                     const su2double val_dist_ij_2,
                                     const unsigned short val_nPrimVar) {
+  if (nDim == 2) CorrectGradient_Kernel<2>(GradPrimVar, val_PrimVar_i, val_PrimVar_j, val_edge_vector, val_dist_ij_2, val_nPrimVar);
+  else CorrectGradient_Kernel<3>(GradPrimVar, val_PrimVar_i, val_PrimVar_j, val_edge_vector, val_dist_ij_2, val_nPrimVar);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Base::CorrectGradient_Kernel(su2double** GradPrimVar,
+                                           const su2double* val_PrimVar_i,
+                                           const su2double* val_PrimVar_j,
+                                           const su2double* val_edge_vector,
+                                           const su2double val_dist_ij_2,
+                                           const unsigned short val_nPrimVar) {
   for (unsigned short iVar = 0; iVar < val_nPrimVar; iVar++) {
     Proj_Mean_GradPrimVar_Edge[iVar] = 0.0;
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
       Proj_Mean_GradPrimVar_Edge[iVar] += GradPrimVar[iVar][iDim]*val_edge_vector[iDim];
     }
-    for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
       GradPrimVar[iVar][iDim] -= (Proj_Mean_GradPrimVar_Edge[iVar] -
                                  (val_PrimVar_j[iVar]-val_PrimVar_i[iVar]))*val_edge_vector[iDim] / val_dist_ij_2;
     }
@@ -4851,27 +5328,37 @@ void CAvgGrad_Base::SetStressTensor(const su2double *val_primvar,
                            const su2double val_turb_ke,
                            const su2double val_laminar_viscosity,
                            const su2double val_eddy_viscosity) {
+  if (nDim == 2) SetStressTensor_Kernel<2>(val_primvar, val_gradprimvar, val_turb_ke, val_laminar_viscosity, val_eddy_viscosity);
+  else SetStressTensor_Kernel<3>(val_primvar, val_gradprimvar, val_turb_ke, val_laminar_viscosity, val_eddy_viscosity);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Base::SetStressTensor_Kernel(const su2double *val_primvar,
+                                           const su2double* const *val_gradprimvar,
+                                           const su2double val_turb_ke,
+                                           const su2double val_laminar_viscosity,
+                                           const su2double val_eddy_viscosity) {
 
   unsigned short iDim, jDim;
-  const su2double Density = val_primvar[nDim+2];
+  const su2double Density = val_primvar[NDIM+2];
   const su2double total_viscosity = val_laminar_viscosity + val_eddy_viscosity;
 
   su2double div_vel = 0.0;
-  for (iDim = 0 ; iDim < nDim; iDim++)
+  for (iDim = 0 ; iDim < NDIM; iDim++)
     div_vel += val_gradprimvar[iDim+1][iDim];
 
   /* --- If UQ methodology is used, calculate tau using the perturbed reynolds stress tensor --- */
 
   if (using_uq){
-    for (iDim = 0 ; iDim < nDim; iDim++)
-      for (jDim = 0 ; jDim < nDim; jDim++)
+    for (iDim = 0 ; iDim < NDIM; iDim++)
+      for (jDim = 0 ; jDim < NDIM; jDim++)
         tau[iDim][jDim] = val_laminar_viscosity*( val_gradprimvar[jDim+1][iDim] + val_gradprimvar[iDim+1][jDim] )
         - TWO3*val_laminar_viscosity*div_vel*delta[iDim][jDim] - Density * MeanPerturbedRSM[iDim][jDim];
 
   } else {
 
-    for (iDim = 0 ; iDim < nDim; iDim++)
-      for (jDim = 0 ; jDim < nDim; jDim++)
+    for (iDim = 0 ; iDim < NDIM; iDim++)
+      for (jDim = 0 ; jDim < NDIM; jDim++)
         tau[iDim][jDim] = total_viscosity*( val_gradprimvar[jDim+1][iDim] + val_gradprimvar[iDim+1][jDim] )
                           - TWO3*total_viscosity*div_vel*delta[iDim][jDim]
                           - TWO3*Density*val_turb_ke*delta[iDim][jDim];
@@ -5115,25 +5602,35 @@ void CAvgGrad_Base::SetTauJacobian(const su2double *val_Mean_PrimVar,
                                    const su2double val_eddy_viscosity,
                                    const su2double val_dist_ij,
                                    const su2double *val_normal) {
+  if (nDim == 2) SetTauJacobian_Kernel<2>(val_Mean_PrimVar, val_laminar_viscosity, val_eddy_viscosity, val_dist_ij, val_normal);
+  else SetTauJacobian_Kernel<3>(val_Mean_PrimVar, val_laminar_viscosity, val_eddy_viscosity, val_dist_ij, val_normal);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Base::SetTauJacobian_Kernel(const su2double *val_Mean_PrimVar,
+                                          const su2double val_laminar_viscosity,
+                                          const su2double val_eddy_viscosity,
+                                          const su2double val_dist_ij,
+                                          const su2double *val_normal) {
 
   /*--- QCR and wall functions are **not** accounted for here ---*/
 
-  const su2double Density = val_Mean_PrimVar[nDim+2];
+  const su2double Density = val_Mean_PrimVar[NDIM+2];
   const su2double total_viscosity = val_laminar_viscosity + val_eddy_viscosity;
   const su2double xi = total_viscosity/(Density*val_dist_ij);
 
-  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
-    for (unsigned short jDim = 0; jDim < nDim; jDim++) {
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+    for (unsigned short jDim = 0; jDim < NDIM; jDim++) {
       // Jacobian w.r.t. momentum
       tau_jacobian_i[iDim][jDim+1] = -xi*(delta[iDim][jDim] + val_normal[iDim]*val_normal[jDim]/3.0);
     }
     // Jacobian w.r.t. density
     tau_jacobian_i[iDim][0] = 0;
-    for (unsigned short jDim = 0; jDim < nDim; jDim++) {
+    for (unsigned short jDim = 0; jDim < NDIM; jDim++) {
        tau_jacobian_i[iDim][0] -= tau_jacobian_i[iDim][jDim+1]*val_Mean_PrimVar[jDim+1];
     }
     // Jacobian w.r.t. energy
-    tau_jacobian_i[iDim][nDim+1] = 0;
+    tau_jacobian_i[iDim][NDIM+1] = 0;
   }
 }
 
@@ -5156,10 +5653,17 @@ void CAvgGrad_Base::SetIncTauJacobian(const su2double val_laminar_viscosity,
 
 void CAvgGrad_Base::GetViscousProjFlux(const su2double *val_primvar,
                                        const su2double *val_normal) {
+  if (nDim == 2) GetViscousProjFlux_Kernel<2>(val_primvar, val_normal);
+  else GetViscousProjFlux_Kernel<3>(val_primvar, val_normal);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Base::GetViscousProjFlux_Kernel(const su2double *val_primvar,
+                                              const su2double *val_normal) {
 
   /*--- Primitive variables -> [Temp vel_x vel_y vel_z Pressure] ---*/
 
-  if (nDim == 2) {
+  if (NDIM == 2) {
     Flux_Tensor[0][0] = 0.0;
     Flux_Tensor[1][0] = tau[0][0];
     Flux_Tensor[2][0] = tau[0][1];
@@ -5193,7 +5697,7 @@ void CAvgGrad_Base::GetViscousProjFlux(const su2double *val_primvar,
   
   for (unsigned short iVar = 0; iVar < nVar; iVar++) {
     Proj_Flux_Tensor[iVar] = 0.0;
-    for (unsigned short iDim = 0; iDim < nDim; iDim++)
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
       Proj_Flux_Tensor[iVar] += Flux_Tensor[iVar][iDim] * val_normal[iDim];
   }
   
@@ -5307,25 +5811,47 @@ CAvgGrad_Flow::~CAvgGrad_Flow(void) {
 }
 
 void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
+  if (nDim == 2) ComputeResidual_Kernel<2>(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+  else ComputeResidual_Kernel<3>(val_residual, val_Jacobian_i, val_Jacobian_j, config);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Flow::ComputeResidual_Kernel(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
 
   AD::StartPreacc();
-  AD::SetPreaccIn(V_i, nDim+9);   AD::SetPreaccIn(V_j, nDim+9);
-  AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-  AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
-  AD::SetPreaccIn(PrimVar_Grad_j, nDim+1, nDim);
+  AD::SetPreaccIn(V_i, NDIM+9);   AD::SetPreaccIn(V_j, NDIM+9);
+  if (Edge_Geometry != NULL) { AD::SetPreaccIn(Edge_Geometry, NDIM+2); }
+  else { AD::SetPreaccIn(Coord_i, NDIM); AD::SetPreaccIn(Coord_j, NDIM); }
+  AD::SetPreaccIn(PrimVar_Grad_i, NDIM+1, NDIM);
+  AD::SetPreaccIn(PrimVar_Grad_j, NDIM+1, NDIM);
   AD::SetPreaccIn(turb_ke_i); AD::SetPreaccIn(turb_ke_j);
-  AD::SetPreaccIn(Normal, nDim);
+  AD::SetPreaccIn(Normal, NDIM);
 
   unsigned short iVar, jVar, iDim;
 
-  /*--- Normalized normal vector ---*/
+  /*--- Area of the face and vector going from iPoint to jPoint, precomputed
+   for the edges of static meshes ---*/
   
-  Area = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
-    Area += Normal[iDim]*Normal[iDim];
-  Area = sqrt(Area);
+  if (Edge_Geometry != NULL) {
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Edge_Vector[iDim] = Edge_Geometry[iDim];
+    dist_ij_2 = Edge_Geometry[NDIM];
+    Area = Edge_Geometry[NDIM+1];
+  }
+  else {
+    Area = 0.0;
+    dist_ij_2 = 0.0;
+    for (iDim = 0; iDim < NDIM; iDim++) {
+      Area += Normal[iDim]*Normal[iDim];
+      Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
+      dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
+    }
+    Area = sqrt(Area);
+  }
   
-  for (iDim = 0; iDim < nDim; iDim++)
+  /*--- Normalized normal vector ---*/
+  
+  for (iDim = 0; iDim < NDIM; iDim++)
     UnitNormal[iDim] = Normal[iDim]/Area;
   
   for (iVar = 0; iVar < nPrimVar; iVar++) {
@@ -5333,20 +5859,11 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
     PrimVar_j[iVar] = V_j[iVar];
     Mean_PrimVar[iVar] = 0.5*(PrimVar_i[iVar]+PrimVar_j[iVar]);
   }
-  
-
-  /*--- Compute vector going from iPoint to jPoint ---*/
-  
-  dist_ij_2 = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Edge_Vector[iDim] = Coord_j[iDim]-Coord_i[iDim];
-    dist_ij_2 += Edge_Vector[iDim]*Edge_Vector[iDim];
-  }
 
   /*--- Laminar and Eddy viscosity ---*/
   
-  Laminar_Viscosity_i = V_i[nDim+5]; Laminar_Viscosity_j = V_j[nDim+5];
-  Eddy_Viscosity_i = V_i[nDim+6]; Eddy_Viscosity_j = V_j[nDim+6];
+  Laminar_Viscosity_i = V_i[NDIM+5]; Laminar_Viscosity_j = V_j[NDIM+5];
+  Eddy_Viscosity_i = V_i[NDIM+6]; Eddy_Viscosity_j = V_j[NDIM+6];
 
   /*--- Mean Viscosities and turbulent kinetic energy---*/
   
@@ -5356,8 +5873,8 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   
   /*--- Mean gradient approximation ---*/
 
-  for (iVar = 0; iVar < nDim+1; iVar++) {
-    for (iDim = 0; iDim < nDim; iDim++) {
+  for (iVar = 0; iVar < NDIM+1; iVar++) {
+    for (iDim = 0; iDim < NDIM; iDim++) {
       Mean_GradPrimVar[iVar][iDim] = 0.5*(PrimVar_Grad_i[iVar][iDim] + PrimVar_Grad_j[iVar][iDim]);
     }
   }
@@ -5365,8 +5882,8 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
   /*--- Projection of the mean gradient in the direction of the edge ---*/
 
   if (correct_gradient && dist_ij_2 != 0.0) {
-    CorrectGradient(Mean_GradPrimVar, PrimVar_i, PrimVar_j, Edge_Vector,
-                    dist_ij_2, nDim+1);
+    CorrectGradient_Kernel<NDIM>(Mean_GradPrimVar, PrimVar_i, PrimVar_j, Edge_Vector,
+                    dist_ij_2, NDIM+1);
   }
   
   /*--- Wall shear stress values (wall functions) ---*/
@@ -5385,15 +5902,15 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
 
   /*--- Get projected flux tensor ---*/
 
-  SetStressTensor(Mean_PrimVar, Mean_GradPrimVar, Mean_turb_ke,
+  SetStressTensor_Kernel<NDIM>(Mean_PrimVar, Mean_GradPrimVar, Mean_turb_ke,
          Mean_Laminar_Viscosity, Mean_Eddy_Viscosity);
   if (config->GetQCR()) AddQCR(Mean_GradPrimVar);
   if (Mean_TauWall > 0) AddTauWall(Normal, Mean_TauWall);
 
-  SetHeatFluxVector(Mean_GradPrimVar, Mean_Laminar_Viscosity,
+  SetHeatFluxVector_Kernel<NDIM>(Mean_GradPrimVar, Mean_Laminar_Viscosity,
                     Mean_Eddy_Viscosity);
 
-  GetViscousProjFlux(Mean_PrimVar, Normal);
+  GetViscousProjFlux_Kernel<NDIM>(Mean_PrimVar, Normal);
 
   /*--- Update viscous residual ---*/
   
@@ -5413,9 +5930,9 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
       }
     } else {
       const su2double dist_ij = sqrt(dist_ij_2);
-      SetTauJacobian(Mean_PrimVar, Mean_Laminar_Viscosity, Mean_Eddy_Viscosity,
+      SetTauJacobian_Kernel<NDIM>(Mean_PrimVar, Mean_Laminar_Viscosity, Mean_Eddy_Viscosity,
                      dist_ij, UnitNormal);
-      SetHeatFluxJacobian(Mean_PrimVar, Mean_Laminar_Viscosity,
+      SetHeatFluxJacobian_Kernel<NDIM>(Mean_PrimVar, Mean_Laminar_Viscosity,
                           Mean_Eddy_Viscosity, dist_ij, UnitNormal);
       GetViscousProjJacs(Mean_PrimVar, Area, Proj_Flux_Tensor,
                          val_Jacobian_i, val_Jacobian_j);
@@ -5433,13 +5950,21 @@ void CAvgGrad_Flow::ComputeResidual(su2double *val_residual, su2double **val_Jac
 void CAvgGrad_Flow::SetHeatFluxVector(const su2double* const *val_gradprimvar,
                                       const su2double val_laminar_viscosity,
                                       const su2double val_eddy_viscosity) {
+  if (nDim == 2) SetHeatFluxVector_Kernel<2>(val_gradprimvar, val_laminar_viscosity, val_eddy_viscosity);
+  else SetHeatFluxVector_Kernel<3>(val_gradprimvar, val_laminar_viscosity, val_eddy_viscosity);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Flow::SetHeatFluxVector_Kernel(const su2double* const *val_gradprimvar,
+                                             const su2double val_laminar_viscosity,
+                                             const su2double val_eddy_viscosity) {
 
   const su2double Cp = (Gamma / Gamma_Minus_One) * Gas_Constant;
   const su2double heat_flux_factor = Cp * (val_laminar_viscosity/Prandtl_Lam + val_eddy_viscosity/Prandtl_Turb);
 
   /*--- Gradient of primitive variables -> [Temp vel_x vel_y vel_z Pressure] ---*/
 
-  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
     heat_flux_vector[iDim] = heat_flux_factor*val_gradprimvar[0][iDim];
   }
 }
@@ -5449,14 +5974,24 @@ void CAvgGrad_Flow::SetHeatFluxJacobian(const su2double *val_Mean_PrimVar,
                                         const su2double val_eddy_viscosity,
                                         const su2double val_dist_ij,
                                         const su2double *val_normal) {
+  if (nDim == 2) SetHeatFluxJacobian_Kernel<2>(val_Mean_PrimVar, val_laminar_viscosity, val_eddy_viscosity, val_dist_ij, val_normal);
+  else SetHeatFluxJacobian_Kernel<3>(val_Mean_PrimVar, val_laminar_viscosity, val_eddy_viscosity, val_dist_ij, val_normal);
+}
+
+template<unsigned short NDIM>
+void CAvgGrad_Flow::SetHeatFluxJacobian_Kernel(const su2double *val_Mean_PrimVar,
+                                               const su2double val_laminar_viscosity,
+                                               const su2double val_eddy_viscosity,
+                                               const su2double val_dist_ij,
+                                               const su2double *val_normal) {
   su2double sqvel = 0.0;
 
-  for (unsigned short iDim = 0; iDim < nDim; iDim++) {
+  for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
     sqvel += val_Mean_PrimVar[iDim+1]*val_Mean_PrimVar[iDim+1];
   }
 
-  const su2double Density = val_Mean_PrimVar[nDim+2];
-  const su2double Pressure = val_Mean_PrimVar[nDim+1];
+  const su2double Density = val_Mean_PrimVar[NDIM+2];
+  const su2double Pressure = val_Mean_PrimVar[NDIM+1];
   const su2double phi = Gamma_Minus_One/Density;
 
   /*--- R times partial derivatives of temp. ---*/
@@ -5473,7 +6008,7 @@ void CAvgGrad_Flow::SetHeatFluxJacobian(const su2double *val_Mean_PrimVar,
   heat_flux_jac_i[1] = conductivity_over_Rd * R_dTdu1;
   heat_flux_jac_i[2] = conductivity_over_Rd * R_dTdu2;
 
-  if (nDim == 2) {
+  if (NDIM == 2) {
 
     const su2double R_dTdu3 = phi;
     heat_flux_jac_i[3] = conductivity_over_Rd * R_dTdu3;
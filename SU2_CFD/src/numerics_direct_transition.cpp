@@ -351,13 +351,51 @@ CSourcePieceWise_TransLM::CSourcePieceWise_TransLM(unsigned short val_nDim, unsi
   flen_global  = 12.0;
   alpha_global = 0.85;
   
+  /*-- The freestream turbulence intensity is fixed, evaluate its part of the correlations once --*/
+  su2double tu = config->GetTurbulenceIntensity_FreeStream();
+  rey_tc_tu = 4.45*pow(tu,3) - 5.7*pow(tu,2) + 1.37*tu + 0.585;
+  flen_tu   = 0.171*pow(tu,2) - 0.0083*tu + 0.0306;
+  if (tu <= 1.3) re_theta_tu = 1173.51-589.428*tu+0.2196/(tu*tu);
+  else           re_theta_tu = 331.5*pow(tu-0.5658,-0.671);
+  f_lambda_neg_tu = exp(-pow(2./3*tu,1.5));
+  f_lambda_pos_tu = exp(-2.*tu);
+  re_theta_corr = 0.0;
+  
   /*-- For debugging -AA --*/
   debugme = 0;
 }
 
 CSourcePieceWise_TransLM::~CSourcePieceWise_TransLM(void) { }
 
-void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config, su2double &gamma_sep) {
+su2double CSourcePieceWise_TransLM::ReThetaT_Correlation(su2double du_ds, su2double Velocity_Mag, su2double &f_lambda) {
+  
+  const su2double re_theta_lim = 20.0, tol = 1.0e-10;
+  su2double re_theta = re_theta_lim, theta, lambda, f_lambda_old;
+  
+  /*-- Fixed-point iterations to solve REth correlation. When started from the value of
+   the previous solver iteration, they stop after very few iterations. --*/
+  for (int iter=0; iter<10; iter++) {
+    re_theta = max(f_lambda*re_theta_tu, re_theta_lim);
+    
+    theta  = re_theta * Laminar_Viscosity_i / (U_i[0]*Velocity_Mag);
+    
+    lambda = U_i[0]*theta*theta*du_ds / Laminar_Viscosity_i;
+    lambda = min(max(-0.1, lambda),0.1);
+    
+    f_lambda_old = f_lambda;
+    if (lambda<=0.0) {
+      f_lambda = 1. - (-12.986*lambda - 123.66*lambda*lambda -
+                       405.689*lambda*lambda*lambda)*f_lambda_neg_tu;
+    } else {
+      f_lambda = 1. + 0.275*(1.-exp(-35.*lambda))*f_lambda_pos_tu;
+    }
+    if (fabs(f_lambda-f_lambda_old) < tol) break;
+  }
+  return re_theta;
+}
+
+void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config,
+                                                       su2double &gamma_sep, su2double &f_lambda) {
   //************************************************//
   // Please do not delete //SU2_CPP2C comment lines //
   //************************************************//
@@ -377,11 +415,11 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
   //SU2_CPP2C DECL_LIST END
   
   /*-- Local intermediate variables --*/
-  su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset, f_turb, tu;
+  su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset, f_turb;
   
   su2double prod, des;
-  su2double f_lambda, re_theta = 0.0, re_theta_lim, r_t;
-  su2double Velocity_Mag = 0.0, du_ds, theta, lambda, time_scale, var1, f_theta;
+  su2double re_theta = 0.0, r_t;
+  su2double Velocity_Mag = 0.0, du_ds, time_scale, var1, f_theta;
   su2double f_reattach;
   su2double dU_dx, dU_dy, dU_dz = 0.0;
   
@@ -411,7 +449,6 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
   /* -- These lines must be manually reinserted into the differentiated routine! --*/
 //  rey  = config->GetReynolds();
 //  mach = config->GetMach();
-  tu   = config->GetTurbulenceIntensity_FreeStream();
   //SU2_CPP2C COMMENT END
   
   /*--- Compute vorticity and strain (TODO: Update for 3D) ---*/
@@ -428,8 +465,8 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
     
     /*-- Intermittency eq.: --*/
     
-    rey_tc = (4.45*pow(tu,3) - 5.7*pow(tu,2) + 1.37*tu + 0.585)*TransVar_i[1];
-    flen   = 0.171*pow(tu,2) - 0.0083*tu + 0.0306;
+    rey_tc = rey_tc_tu*TransVar_i[1];
+    flen   = flen_tu;
     
     re_v   = U_i[0]*pow(dist_i,2.)/Laminar_Viscosity_i*strain;  // Vorticity Reynolds number
     
@@ -478,30 +515,11 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
     if (nDim==3)
       du_ds += U_i[3]/(U_i[0]*Velocity_Mag) * dU_dz;
     
-    re_theta_lim = 20.;
-    
-    /*-- Fixed-point iterations to solve REth correlation --*/
-    f_lambda = 1.;
-    for (int iter=0; iter<10; iter++) {
-      if (tu <= 1.3) {
-        re_theta = f_lambda * (1173.51-589.428*tu+0.2196/(tu*tu));
-      } else {
-        re_theta = 331.5 * f_lambda*pow(tu-0.5658,-0.671);
-      }
-      re_theta = max(re_theta, re_theta_lim);
-      
-      theta  = re_theta * Laminar_Viscosity_i / (U_i[0]*Velocity_Mag);
-      
-      lambda = U_i[0]*theta*theta*du_ds / Laminar_Viscosity_i;
-      lambda = min(max(-0.1, lambda),0.1);
-      
-      if (lambda<=0.0) {
-        f_lambda = 1. - (-12.986*lambda - 123.66*lambda*lambda -
-                         405.689*lambda*lambda*lambda)*exp(-pow(2./3*tu,1.5));
-      } else {
-        f_lambda = 1. + 0.275*(1.-exp(-35.*lambda))*exp(-2.*tu);
-      }
-    }
+    /*-- Re_theta_t correlation, it does not depend on the transition variables
+     and is reused by the differentiated routine --*/
+    if (f_lambda <= 0.0) f_lambda = 1.;
+    re_theta = ReThetaT_Correlation(du_ds, Velocity_Mag, f_lambda);
+    re_theta_corr = re_theta;
     
     /*-- Calculate blending function f_theta --*/
     time_scale = 500.0*Laminar_Viscosity_i/(U_i[0]*Velocity_Mag*Velocity_Mag);
@@ -522,27 +540,6 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
     val_residual[1] = c_theta*U_i[0]/time_scale *  (1.-f_theta) * (re_theta-TransVar_i[1]);
     
     //SU2_CPP2C COMMENT START
-    cout << "val_res0: "  << val_residual[0]      << endl;
-    cout << "val_res1: "  << val_residual[1]      << endl;
-    cout << "dist_i: "    << dist_i               << endl;
-    cout << "re_v: "      << re_v                 << endl;
-    cout << "c_a1: "      << c_a1                 << endl;
-    cout << "strain: "    << strain               << endl;
-    cout << "primgrad10: "<< PrimVar_Grad_i[1][0] << endl;
-    cout << "primgrad11: "<< PrimVar_Grad_i[1][1] << endl;
-    cout << "primgrad20: "<< PrimVar_Grad_i[2][0] << endl;
-    cout << "primgrad21: "<< PrimVar_Grad_i[2][1] << endl;
-    cout << "f_onset: "   << f_onset              << endl;
-    cout << "TransVar0: " << TransVar_i[0]        << endl;
-    cout << "prod: "      << prod                 << endl;
-    cout << "c_a2: "      << c_a2                 << endl;
-    cout << "Vorticity: " << Vorticity            << endl;
-    cout << "f_turb: "    << f_turb               << endl;
-    cout << "des: "       << des                  << endl;
-    cout << "du_ds: "     << du_ds                << endl;
-    cout << "r_t:    "    << r_t                  << endl;
-    cout << "rey_tc: "    << rey_tc               << endl;
-    cout << "re_theta: "  << re_theta             << endl;
     
     /*-- Calculate term for separation correction --*/
     f_reattach = exp(-pow(0.05*r_t,4));
@@ -569,12 +566,12 @@ void CSourcePieceWise_TransLM::ComputeResidual_TransLM(su2double *val_residual,
 void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM_d(su2double *TransVar_i, su2double *TransVar_id, su2double *val_residual, su2double *val_residuald, CConfig *config)
 {
   su2double rey_tc, flen, re_v, strain, f_onset1, f_onset2, f_onset3, f_onset,
-  f_turb, tu;
+  f_turb;
   su2double rey_tcd, f_onset1d, f_onset2d, f_onsetd;
   su2double prod, des;
   su2double prodd, desd;
-  su2double f_lambda, re_theta = 0.0, re_theta_lim, r_t;
-  su2double Velocity_Mag = 0.0, du_ds, theta, lambda, time_scale,
+  su2double re_theta = 0.0, r_t;
+  su2double Velocity_Mag = 0.0, du_ds, time_scale,
   var1, f_theta;
   su2double var1d, f_thetad;
   su2double dU_dx, dU_dy, dU_dz = 0.0;
@@ -582,7 +579,6 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
   su2double result1d;
   su2double arg1;
   su2double arg1d;
-  su2double result2;
   su2double x2;
   su2double x1;
   su2double x1d;
@@ -598,7 +594,6 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
 //  tu = 0.0;
 //  rey  = config->GetReynolds();
 //  mach = config->GetMach();
-  tu   = config->GetTurbulenceIntensity_FreeStream();
   /*--- Compute vorticity and strain (TODO: Update for 3D) ---*/
   Vorticity = fabs(PrimVar_Grad_i[1][1] - PrimVar_Grad_i[2][0]);
   /*-- Strain = sqrt(2*Sij*Sij) --*/
@@ -610,12 +605,9 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
   if (dist_i > 0.0) {
     /*-- Intermittency eq.: --*/
     // Only operate away from wall
-    result1 = pow(tu, 3);
-    result2 = pow(tu, 2);
-    rey_tcd = (4.45*result1-5.7*result2+1.37*tu+0.585)*TransVar_id[1];
-    rey_tc = (4.45*result1-5.7*result2+1.37*tu+0.585)*TransVar_i[1];
-    result1 = pow(tu, 2);
-    flen = 0.171*result1 - 0.0083*tu + 0.0306;
+    rey_tcd = rey_tc_tu*TransVar_id[1];
+    rey_tc = rey_tc_tu*TransVar_i[1];
+    flen = flen_tu;
     result1 = pow(dist_i, 2.);
     re_v = U_i[0]*result1/Laminar_Viscosity_i*strain;
     /*-- f_onset controls transition onset location --*/
@@ -699,37 +691,8 @@ void CSourcePieceWise_TransLM::CSourcePieceWise_TransLM__ComputeResidual_TransLM
     // Streamwise velocity derivative
     if (nDim == 3)
       du_ds += U_i[3]/(U_i[0]*Velocity_Mag)*dU_dz;
-    re_theta_lim = 20.;
-    /*-- Fixed-point iterations to solve REth correlation --*/
-    f_lambda = 1.;
-    {
-      su2double x3;
-      for (int iter = 0; iter < 10; ++iter) {
-        if (tu <= 1.3)
-          re_theta = f_lambda*(1173.51-589.428*tu+0.2196/(tu*tu));
-        else {
-          result1 = pow(tu - 0.5658, -0.671);
-          re_theta = 331.5*f_lambda*result1;
-        }
-        if (re_theta < re_theta_lim) re_theta = re_theta_lim;
-        theta = re_theta*Laminar_Viscosity_i/(U_i[0]*Velocity_Mag);
-        lambda = U_i[0]*theta*theta*du_ds/Laminar_Viscosity_i;
-        if (-0.1 < lambda)
-          x3 = lambda;
-        else
-          x3 = -0.1;
-        if (x3 > 0.1)
-          lambda = 0.1;
-        else
-          lambda = x3;
-        if (lambda <= 0.0) {
-          result1 = pow(2./3*tu, 1.5);
-          f_lambda = 1. - (-12.986*lambda-123.66*lambda*lambda-405.689
-                           *lambda*lambda*lambda)*exp(-result1);
-        } else
-          f_lambda = 1. + 0.275*(1.-exp(-35.*lambda))*exp(-2.*tu);
-      }
-    }
+    /*-- REth correlation, passive w.r.t. the transition variables, from the primal routine --*/
+    re_theta = re_theta_corr;
     /*-- Calculate blending function f_theta --*/
     time_scale = 500.0*Laminar_Viscosity_i/(U_i[0]*Velocity_Mag*
                                             Velocity_Mag);
@@ -330,13 +330,13 @@ CSourcePieceWise_TurbSA::~CSourcePieceWise_TurbSA(void) { }
 
 void CSourcePieceWise_TurbSA::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+6);
+  AD::SetPreaccIn(Vorticity_i, 3);
+  AD::SetPreaccIn(StrainMag_i);
+  AD::SetPreaccIn(TurbVar_i[0]);
+  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
 
 //  BC Transition Model variables
   su2double vmag, rey, re_theta, re_theta_t, re_v;
@@ -472,8 +472,8 @@ void CSourcePieceWise_TurbSA::ComputeResidual(su2double *val_residual, su2double
     
   }
 
-//  AD::SetPreaccOut(val_residual[0]);
-//  AD::EndPreacc();
+  AD::SetPreaccOut(val_residual[0]);
+  AD::EndPreacc();
   
 }
 
@@ -503,13 +503,14 @@ CSourcePieceWise_TurbSA_E::~CSourcePieceWise_TurbSA_E(void) { }
 
 void CSourcePieceWise_TurbSA_E::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
     
-    //  AD::StartPreacc();
-    //  AD::SetPreaccIn(V_i, nDim+6);
-    //  AD::SetPreaccIn(Vorticity_i, nDim);
-    //  AD::SetPreaccIn(StrainMag_i);
-    //  AD::SetPreaccIn(TurbVar_i[0]);
-    //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-    //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+    AD::StartPreacc();
+    AD::SetPreaccIn(V_i, nDim+6);
+    AD::SetPreaccIn(Vorticity_i, 3);
+    AD::SetPreaccIn(StrainMag_i);
+    AD::SetPreaccIn(TurbVar_i[0]);
+    AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+    AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
+    AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
     
     if (incompressible) {
       Density_i = V_i[nDim+2];
@@ -615,8 +616,8 @@ void CSourcePieceWise_TurbSA_E::ComputeResidual(su2double *val_residual, su2doub
         
     }
     
-    //  AD::SetPreaccOut(val_residual[0]);
-    //  AD::EndPreacc();
+    AD::SetPreaccOut(val_residual[0]);
+    AD::EndPreacc();
     
 }
 
@@ -647,13 +648,14 @@ CSourcePieceWise_TurbSA_COMP::~CSourcePieceWise_TurbSA_COMP(void) { }
 
 void CSourcePieceWise_TurbSA_COMP::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
     
-    //  AD::StartPreacc();
-    //  AD::SetPreaccIn(V_i, nDim+6);
-    //  AD::SetPreaccIn(Vorticity_i, nDim);
-    //  AD::SetPreaccIn(StrainMag_i);
-    //  AD::SetPreaccIn(TurbVar_i[0]);
-    //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-    //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+    AD::StartPreacc();
+    AD::SetPreaccIn(V_i, nDim+6);
+    AD::SetPreaccIn(Vorticity_i, 3);
+    AD::SetPreaccIn(StrainMag_i);
+    AD::SetPreaccIn(TurbVar_i[0]);
+    AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+    AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
+    AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
     
     if (incompressible) {
       Density_i = V_i[nDim+2];
@@ -753,8 +755,8 @@ void CSourcePieceWise_TurbSA_COMP::ComputeResidual(su2double *val_residual, su2d
         
     }
     
-    //  AD::SetPreaccOut(val_residual[0]);
-    //  AD::EndPreacc();
+    AD::SetPreaccOut(val_residual[0]);
+    AD::EndPreacc();
     
 }
 
@@ -784,13 +786,14 @@ CSourcePieceWise_TurbSA_E_COMP::~CSourcePieceWise_TurbSA_E_COMP(void) { }
 
 void CSourcePieceWise_TurbSA_E_COMP::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
     
-    //  AD::StartPreacc();
-    //  AD::SetPreaccIn(V_i, nDim+6);
-    //  AD::SetPreaccIn(Vorticity_i, nDim);
-    //  AD::SetPreaccIn(StrainMag_i);
-    //  AD::SetPreaccIn(TurbVar_i[0]);
-    //  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-    //  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+    AD::StartPreacc();
+    AD::SetPreaccIn(V_i, nDim+6);
+    AD::SetPreaccIn(Vorticity_i, 3);
+    AD::SetPreaccIn(StrainMag_i);
+    AD::SetPreaccIn(TurbVar_i[0]);
+    AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+    AD::SetPreaccIn(PrimVar_Grad_i, nDim+1, nDim);
+    AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
     
     if (incompressible) {
       Density_i = V_i[nDim+2];
@@ -908,8 +911,8 @@ void CSourcePieceWise_TurbSA_E_COMP::ComputeResidual(su2double *val_residual, su
         
     }
     
-    //  AD::SetPreaccOut(val_residual[0]);
-    //  AD::EndPreacc();
+    AD::SetPreaccOut(val_residual[0]);
+    AD::EndPreacc();
     
 }
 
@@ -941,13 +944,13 @@ CSourcePieceWise_TurbSA_Neg::~CSourcePieceWise_TurbSA_Neg(void) {
 
 void CSourcePieceWise_TurbSA_Neg::ComputeResidual(su2double *val_residual, su2double **val_Jacobian_i, su2double **val_Jacobian_j, CConfig *config) {
   
-//  AD::StartPreacc();
-//  AD::SetPreaccIn(V_i, nDim+6);
-//  AD::SetPreaccIn(Vorticity_i, nDim);
-//  AD::SetPreaccIn(StrainMag_i);
-//  AD::SetPreaccIn(TurbVar_i[0]);
-//  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
-//  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
+  AD::StartPreacc();
+  AD::SetPreaccIn(V_i, nDim+6);
+  AD::SetPreaccIn(Vorticity_i, 3);
+  AD::SetPreaccIn(StrainMag_i);
+  AD::SetPreaccIn(TurbVar_i[0]);
+  AD::SetPreaccIn(TurbVar_Grad_i[0], nDim);
+  AD::SetPreaccIn(Volume); AD::SetPreaccIn(dist_i);
 
   if (incompressible) {
     Density_i = V_i[nDim+2];
@@ -1074,8 +1077,8 @@ void CSourcePieceWise_TurbSA_Neg::ComputeResidual(su2double *val_residual, su2do
     
   }
 
-//  AD::SetPreaccOut(val_residual, nVar);
-//  AD::EndPreacc();
+  AD::SetPreaccOut(val_residual[0]);
+  AD::EndPreacc();
 }
 
 CUpwSca_TurbSST::CUpwSca_TurbSST(unsigned short val_nDim,
@@ -43,6 +43,8 @@ CNumerics::CNumerics(void) {
   UnitNormal  = NULL;
   UnitNormald = NULL;
   
+  Edge_Geometry = NULL;
+  
   U_n   = NULL;
   U_nM1 = NULL;
   U_nP1 = NULL;
@@ -65,6 +67,20 @@ CNumerics::CNumerics(void) {
   l = NULL;
   m = NULL;
 
+  Batch_V_i = NULL;        Batch_V_j = NULL;
+  Batch_Normal = NULL;
+  Batch_Lambda_i = NULL;   Batch_Lambda_j = NULL;
+  Batch_Sensor_i = NULL;   Batch_Sensor_j = NULL;
+  Batch_Und_Lapl_i = NULL; Batch_Und_Lapl_j = NULL;
+  Batch_Neighbor_i = NULL; Batch_Neighbor_j = NULL;
+  Batch_Residual = NULL;
+  Batch_Jacobian_i = NULL; Batch_Jacobian_j = NULL;
+  Lane_V_i = NULL;         Lane_V_j = NULL;
+  Lane_Normal = NULL;      Lane_Residual = NULL;
+  Lane_Und_Lapl_i = NULL;  Lane_Und_Lapl_j = NULL;
+  Lane_Jacobian_i = NULL;  Lane_Jacobian_j = NULL;
+  nPrimVar_Batch = 0;
+
 }
 
 CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
@@ -76,6 +92,8 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   UnitNormal  = NULL;
   UnitNormald = NULL;
   
+  Edge_Geometry = NULL;
+  
   U_n   = NULL;
   U_nM1 = NULL;
   U_nP1 = NULL;
@@ -107,6 +125,20 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   Barycentric_Coord   = NULL;
   New_Coord           = NULL;    
  
+  Batch_V_i = NULL;        Batch_V_j = NULL;
+  Batch_Normal = NULL;
+  Batch_Lambda_i = NULL;   Batch_Lambda_j = NULL;
+  Batch_Sensor_i = NULL;   Batch_Sensor_j = NULL;
+  Batch_Und_Lapl_i = NULL; Batch_Und_Lapl_j = NULL;
+  Batch_Neighbor_i = NULL; Batch_Neighbor_j = NULL;
+  Batch_Residual = NULL;
+  Batch_Jacobian_i = NULL; Batch_Jacobian_j = NULL;
+  Lane_V_i = NULL;         Lane_V_j = NULL;
+  Lane_Normal = NULL;      Lane_Residual = NULL;
+  Lane_Und_Lapl_i = NULL;  Lane_Und_Lapl_j = NULL;
+  Lane_Jacobian_i = NULL;  Lane_Jacobian_j = NULL;
+  nPrimVar_Batch = 0;
+
   nDim = val_nDim;
   nVar = val_nVar;
   Gamma = config->GetGamma();
@@ -166,6 +198,49 @@ CNumerics::CNumerics(unsigned short val_nDim, unsigned short val_nVar,
   m = new su2double [nDim];
   
   Dissipation_ij = 1.0;
+  
+  /*--- Structures for the batched evaluation of the convective fluxes, the
+   primitive variables of a batch are (T, vel, P, rho, h, c) ---*/
+  
+  if (config->GetBatch_Flux()) {
+    nPrimVar_Batch = nDim+5;
+    Batch_V_i        = new su2double [nPrimVar_Batch*SIMD_WIDTH];
+    Batch_V_j        = new su2double [nPrimVar_Batch*SIMD_WIDTH];
+    Batch_Normal     = new su2double [nDim*SIMD_WIDTH];
+    Batch_Lambda_i   = new su2double [SIMD_WIDTH];
+    Batch_Lambda_j   = new su2double [SIMD_WIDTH];
+    Batch_Sensor_i   = new su2double [SIMD_WIDTH];
+    Batch_Sensor_j   = new su2double [SIMD_WIDTH];
+    Batch_Und_Lapl_i = new su2double [nVar*SIMD_WIDTH];
+    Batch_Und_Lapl_j = new su2double [nVar*SIMD_WIDTH];
+    Batch_Neighbor_i = new unsigned short [SIMD_WIDTH];
+    Batch_Neighbor_j = new unsigned short [SIMD_WIDTH];
+    Batch_Residual   = new su2double [nVar*SIMD_WIDTH];
+    Batch_Jacobian_i = new su2double [nVar*nVar*SIMD_WIDTH];
+    Batch_Jacobian_j = new su2double [nVar*nVar*SIMD_WIDTH];
+    
+    for (iVar = 0; iVar < nPrimVar_Batch*SIMD_WIDTH; iVar++) { Batch_V_i[iVar] = 1.0; Batch_V_j[iVar] = 1.0; }
+    for (iVar = 0; iVar < nDim*SIMD_WIDTH; iVar++) Batch_Normal[iVar] = 1.0;
+    for (iVar = 0; iVar < nVar*SIMD_WIDTH; iVar++) { Batch_Und_Lapl_i[iVar] = 0.0; Batch_Und_Lapl_j[iVar] = 0.0; }
+    for (iVar = 0; iVar < SIMD_WIDTH; iVar++) {
+      Batch_Lambda_i[iVar] = 1.0;   Batch_Lambda_j[iVar] = 1.0;
+      Batch_Sensor_i[iVar] = 0.0;   Batch_Sensor_j[iVar] = 0.0;
+      Batch_Neighbor_i[iVar] = 1;   Batch_Neighbor_j[iVar] = 1;
+    }
+    
+    Lane_V_i        = new su2double [nPrimVar_Batch];
+    Lane_V_j        = new su2double [nPrimVar_Batch];
+    Lane_Normal     = new su2double [nDim];
+    Lane_Und_Lapl_i = new su2double [nVar];
+    Lane_Und_Lapl_j = new su2double [nVar];
+    Lane_Residual   = new su2double [nVar];
+    Lane_Jacobian_i = new su2double* [nVar];
+    Lane_Jacobian_j = new su2double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Lane_Jacobian_i[iVar] = new su2double [nVar];
+      Lane_Jacobian_j[iVar] = new su2double [nVar];
+    }
+  }
 
   /* --- Initializing variables for the UQ methodology --- */
   using_uq = config->GetUsing_UQ();
@@ -256,6 +331,26 @@ CNumerics::~CNumerics(void) {
   if (l != NULL) delete [] l;
   if (m != NULL) delete [] m;
 
+  if (Batch_V_i != NULL) {
+    delete [] Batch_V_i;        delete [] Batch_V_j;
+    delete [] Batch_Normal;
+    delete [] Batch_Lambda_i;   delete [] Batch_Lambda_j;
+    delete [] Batch_Sensor_i;   delete [] Batch_Sensor_j;
+    delete [] Batch_Und_Lapl_i; delete [] Batch_Und_Lapl_j;
+    delete [] Batch_Neighbor_i; delete [] Batch_Neighbor_j;
+    delete [] Batch_Residual;
+    delete [] Batch_Jacobian_i; delete [] Batch_Jacobian_j;
+    delete [] Lane_V_i;         delete [] Lane_V_j;
+    delete [] Lane_Normal;      delete [] Lane_Residual;
+    delete [] Lane_Und_Lapl_i;  delete [] Lane_Und_Lapl_j;
+    for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+      delete [] Lane_Jacobian_i[iVar];
+      delete [] Lane_Jacobian_j[iVar];
+    }
+    delete [] Lane_Jacobian_i;
+    delete [] Lane_Jacobian_j;
+  }
+
   if (using_uq) {
     for (unsigned short iDim = 0; iDim < 3; iDim++){
       delete [] MeanReynoldsStress[iDim];
@@ -315,6 +410,75 @@ void CNumerics::GetInviscidFlux(su2double val_density, su2double *val_velocity,
   }
 }
 
+void CNumerics::Get_Constitutive_Matrix(CElement *element_container, CConfig *config, su2double *val_D) {
+
+  SU2_MPI::Error("The constitutive matrix is only available for linear elastic materials.", CURRENT_FUNCTION);
+
+}
+
+void CNumerics::PadBatch(unsigned short nBatch) {
+  
+  unsigned short iLane, iVar, iDim;
+  
+  for (iLane = nBatch; iLane < SIMD_WIDTH; iLane++) {
+    for (iVar = 0; iVar < nPrimVar_Batch; iVar++) {
+      Batch_V_i[iVar*SIMD_WIDTH+iLane] = Batch_V_i[iVar*SIMD_WIDTH];
+      Batch_V_j[iVar*SIMD_WIDTH+iLane] = Batch_V_j[iVar*SIMD_WIDTH];
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      Batch_Normal[iDim*SIMD_WIDTH+iLane] = Batch_Normal[iDim*SIMD_WIDTH];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Batch_Und_Lapl_i[iVar*SIMD_WIDTH+iLane] = Batch_Und_Lapl_i[iVar*SIMD_WIDTH];
+      Batch_Und_Lapl_j[iVar*SIMD_WIDTH+iLane] = Batch_Und_Lapl_j[iVar*SIMD_WIDTH];
+    }
+    Batch_Lambda_i[iLane] = Batch_Lambda_i[0];     Batch_Lambda_j[iLane] = Batch_Lambda_j[0];
+    Batch_Sensor_i[iLane] = Batch_Sensor_i[0];     Batch_Sensor_j[iLane] = Batch_Sensor_j[0];
+    Batch_Neighbor_i[iLane] = Batch_Neighbor_i[0]; Batch_Neighbor_j[iLane] = Batch_Neighbor_j[0];
+  }
+  
+}
+
+void CNumerics::ComputeResidual_Batch(unsigned short nBatch, CConfig *config) {
+  
+  unsigned short iLane, iVar, jVar, iDim;
+  
+  /*--- Generic implementation, the edges of the batch are gathered, evaluated
+   with the scalar scheme, and scattered back ---*/
+  
+  for (iLane = 0; iLane < nBatch; iLane++) {
+    
+    for (iVar = 0; iVar < nPrimVar_Batch; iVar++) {
+      Lane_V_i[iVar] = Batch_V_i[iVar*SIMD_WIDTH+iLane];
+      Lane_V_j[iVar] = Batch_V_j[iVar*SIMD_WIDTH+iLane];
+    }
+    for (iDim = 0; iDim < nDim; iDim++)
+      Lane_Normal[iDim] = Batch_Normal[iDim*SIMD_WIDTH+iLane];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Lane_Und_Lapl_i[iVar] = Batch_Und_Lapl_i[iVar*SIMD_WIDTH+iLane];
+      Lane_Und_Lapl_j[iVar] = Batch_Und_Lapl_j[iVar*SIMD_WIDTH+iLane];
+    }
+    
+    SetPrimitive(Lane_V_i, Lane_V_j);
+    SetNormal(Lane_Normal);
+    SetLambda(Batch_Lambda_i[iLane], Batch_Lambda_j[iLane]);
+    SetNeighbor(Batch_Neighbor_i[iLane], Batch_Neighbor_j[iLane]);
+    SetSensor(Batch_Sensor_i[iLane], Batch_Sensor_j[iLane]);
+    SetUndivided_Laplacian(Lane_Und_Lapl_i, Lane_Und_Lapl_j);
+    
+    ComputeResidual(Lane_Residual, Lane_Jacobian_i, Lane_Jacobian_j, config);
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Batch_Residual[iVar*SIMD_WIDTH+iLane] = Lane_Residual[iVar];
+      for (jVar = 0; jVar < nVar; jVar++) {
+        Batch_Jacobian_i[(iVar*nVar+jVar)*SIMD_WIDTH+iLane] = Lane_Jacobian_i[iVar][jVar];
+        Batch_Jacobian_j[(iVar*nVar+jVar)*SIMD_WIDTH+iLane] = Lane_Jacobian_j[iVar][jVar];
+      }
+    }
+    
+  }
+  
+}
+
 void CNumerics::GetInviscidProjFlux(su2double *val_density,
                                     su2double *val_velocity,
                                     su2double *val_pressure,
@@ -403,12 +567,22 @@ void CNumerics::GetInviscidIncProjFlux(su2double *val_density,
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energy,
                                    su2double *val_normal, su2double val_scale,
                                    su2double **val_Proj_Jac_Tensor) {
+  
+  if (nDim == 2) GetInviscidProjJac_Kernel<2>(val_velocity, val_energy, val_normal, val_scale, val_Proj_Jac_Tensor);
+  else GetInviscidProjJac_Kernel<3>(val_velocity, val_energy, val_normal, val_scale, val_Proj_Jac_Tensor);
+  
+}
+
+template<unsigned short NDIM>
+void CNumerics::GetInviscidProjJac_Kernel(su2double *val_velocity, su2double *val_energy,
+                                          su2double *val_normal, su2double val_scale,
+                                          su2double **val_Proj_Jac_Tensor) {
   AD_BEGIN_PASSIVE
   unsigned short iDim, jDim;
   su2double sqvel, proj_vel, phi, a1, a2;
   
   sqvel = 0.0; proj_vel = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (iDim = 0; iDim < NDIM; iDim++) {
     sqvel    += val_velocity[iDim]*val_velocity[iDim];
     proj_vel += val_velocity[iDim]*val_normal[iDim];
   }
@@ -418,25 +592,32 @@ void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_energ
   a2 = Gamma-1.0;
   
   val_Proj_Jac_Tensor[0][0] = 0.0;
-  for (iDim = 0; iDim < nDim; iDim++)
+  for (iDim = 0; iDim < NDIM; iDim++)
     val_Proj_Jac_Tensor[0][iDim+1] = val_scale*val_normal[iDim];
-  val_Proj_Jac_Tensor[0][nDim+1] = 0.0;
+  val_Proj_Jac_Tensor[0][NDIM+1] = 0.0;
   
-  for (iDim = 0; iDim < nDim; iDim++) {
+  for (iDim = 0; iDim < NDIM; iDim++) {
     val_Proj_Jac_Tensor[iDim+1][0] = val_scale*(val_normal[iDim]*phi - val_velocity[iDim]*proj_vel);
-    for (jDim = 0; jDim < nDim; jDim++)
+    for (jDim = 0; jDim < NDIM; jDim++)
       val_Proj_Jac_Tensor[iDim+1][jDim+1] = val_scale*(val_normal[jDim]*val_velocity[iDim]-a2*val_normal[iDim]*val_velocity[jDim]);
     val_Proj_Jac_Tensor[iDim+1][iDim+1] += val_scale*proj_vel;
-    val_Proj_Jac_Tensor[iDim+1][nDim+1] = val_scale*a2*val_normal[iDim];
+    val_Proj_Jac_Tensor[iDim+1][NDIM+1] = val_scale*a2*val_normal[iDim];
   }
   
-  val_Proj_Jac_Tensor[nDim+1][0] = val_scale*proj_vel*(phi-a1);
-  for (iDim = 0; iDim < nDim; iDim++)
-    val_Proj_Jac_Tensor[nDim+1][iDim+1] = val_scale*(val_normal[iDim]*a1-a2*val_velocity[iDim]*proj_vel);
-  val_Proj_Jac_Tensor[nDim+1][nDim+1] = val_scale*Gamma*proj_vel;
+  val_Proj_Jac_Tensor[NDIM+1][0] = val_scale*proj_vel*(phi-a1);
+  for (iDim = 0; iDim < NDIM; iDim++)
+    val_Proj_Jac_Tensor[NDIM+1][iDim+1] = val_scale*(val_normal[iDim]*a1-a2*val_velocity[iDim]*proj_vel);
+  val_Proj_Jac_Tensor[NDIM+1][NDIM+1] = val_scale*Gamma*proj_vel;
   AD_END_PASSIVE
 }
 
+template void CNumerics::GetInviscidProjJac_Kernel<2>(su2double *val_velocity, su2double *val_energy,
+                                                      su2double *val_normal, su2double val_scale,
+                                                      su2double **val_Proj_Jac_Tensor);
+template void CNumerics::GetInviscidProjJac_Kernel<3>(su2double *val_velocity, su2double *val_energy,
+                                                      su2double *val_normal, su2double val_scale,
+                                                      su2double **val_Proj_Jac_Tensor);
+
 
 void CNumerics::GetInviscidProjJac(su2double *val_velocity, su2double *val_enthalpy,
     su2double *val_chi, su2double *val_kappa,
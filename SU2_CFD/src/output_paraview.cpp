@@ -1957,6 +1957,38 @@ void COutput::SetParaview_MeshASCII(CConfig *config, CGeometry *geometry, unsign
   
 }
 
+/*--- Subroutine to store values in the heavy data file of the XDMF output,
+ as 8 or 4 byte floats, or as 1 or 2 byte unsigned integers of which the
+ value is offset + scale*integer. ---*/
+
+static void PackXDMFValues(const vector<double> & values, unsigned short nBytes,
+                           double offset, double scale, vector<char> & buffer) {
+  
+  buffer.resize(values.size()*nBytes);
+  
+  for (unsigned long i = 0; i < values.size(); i++) {
+    if (nBytes == sizeof(double)) {
+      memcpy(&buffer[i*nBytes], &values[i], nBytes);
+    }
+    else if (nBytes == sizeof(float)) {
+      float val = (float)values[i];
+      memcpy(&buffer[i*nBytes], &val, nBytes);
+    }
+    else {
+      double level = (scale > 0.0) ? floor((values[i]-offset)/scale + 0.5) : 0.0;
+      level = min(max(level, 0.0), (nBytes == 1) ? 255.0 : 65535.0);
+      if (nBytes == 1) {
+        unsigned char val = (unsigned char)level;
+        memcpy(&buffer[i*nBytes], &val, nBytes);
+      } else {
+        unsigned short val = (unsigned short)level;
+        memcpy(&buffer[i*nBytes], &val, nBytes);
+      }
+    }
+  }
+  
+}
+
 void COutput::WriteParaViewASCII_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, unsigned short val_iInst, unsigned short val_nInst, bool surf_sol) {
 
   unsigned short iDim, nDim = geometry->GetnDim();
@@ -3544,3 +3576,313 @@ void COutput::WriteParaViewBinary_Parallel(CConfig *config,
 #endif
   
 }
+
+void COutput::WriteXDMF_Parallel(CConfig *config,
+                                 CGeometry *geometry,
+                                 CSolver **solver,
+                                 unsigned short val_iZone,
+                                 unsigned short val_nZone,
+                                 bool surf_sol) {
+  
+  unsigned short iDim, iType, iNode, nDim = geometry->GetnDim();
+  unsigned long iPoint, iElem, iConn;
+  int iRank;
+  
+  const int NCOORDS = 3;
+  
+  /*--- The light data (XML) and the heavy data (raw binary) files share the
+   root of the VTK file name. The XML file refers to the binary file by its
+   name only, such that both can be moved together. ---*/
+  
+  string filename = GetVTKFilename(config, val_iZone, val_nZone, surf_sol);
+  if (filename.size() > 4 && filename.compare(filename.size()-4, 4, ".vtk") == 0)
+    filename.erase(filename.size()-4);
+  
+  string xmfname = filename + ".xmf";
+  string binname = filename + ".bin";
+  string binbase = binname.substr(binname.find_last_of("/\\") + 1);
+  
+  /*--- Check for big endian, the data is written in the native byte order
+   and the byte order is stated in the XML file. ---*/
+  
+  bool BigEndian;
+  union {int i; char c[4];} val;
+  val.i = 0x76543210;
+  if (val.c[0] == 0x10) BigEndian = false;
+  else BigEndian = true;
+  
+  /*--- Set pointer to our output data and the element lists of this rank. Every
+   element list is given by its connectivity, the number of elements, the number
+   of nodes per element and the XDMF topology type of the element. ---*/
+  
+  su2double **Data;
+  unsigned long myPoint;
+  vector<int *> Conn;
+  vector<unsigned long> nElem_Type;
+  vector<unsigned short> nNode_Type, XDMF_Type;
+  
+  if (surf_sol) {
+    Data    = Parallel_Surf_Data;
+    myPoint = nSurf_Poin_Par;
+    Conn.push_back(Conn_BoundLine_Par); nElem_Type.push_back(nParallel_Line);
+    nNode_Type.push_back(N_POINTS_LINE); XDMF_Type.push_back(2);
+    Conn.push_back(Conn_BoundTria_Par); nElem_Type.push_back(nParallel_BoundTria);
+    nNode_Type.push_back(N_POINTS_TRIANGLE); XDMF_Type.push_back(4);
+    Conn.push_back(Conn_BoundQuad_Par); nElem_Type.push_back(nParallel_BoundQuad);
+    nNode_Type.push_back(N_POINTS_QUADRILATERAL); XDMF_Type.push_back(5);
+  } else {
+    Data    = Parallel_Data;
+    myPoint = nParallel_Poin;
+    Conn.push_back(Conn_Tria_Par); nElem_Type.push_back(nParallel_Tria);
+    nNode_Type.push_back(N_POINTS_TRIANGLE); XDMF_Type.push_back(4);
+    Conn.push_back(Conn_Quad_Par); nElem_Type.push_back(nParallel_Quad);
+    nNode_Type.push_back(N_POINTS_QUADRILATERAL); XDMF_Type.push_back(5);
+    Conn.push_back(Conn_Tetr_Par); nElem_Type.push_back(nParallel_Tetr);
+    nNode_Type.push_back(N_POINTS_TETRAHEDRON); XDMF_Type.push_back(6);
+    Conn.push_back(Conn_Pyra_Par); nElem_Type.push_back(nParallel_Pyra);
+    nNode_Type.push_back(N_POINTS_PYRAMID); XDMF_Type.push_back(7);
+    Conn.push_back(Conn_Pris_Par); nElem_Type.push_back(nParallel_Pris);
+    nNode_Type.push_back(N_POINTS_PRISM); XDMF_Type.push_back(8);
+    Conn.push_back(Conn_Hexa_Par); nElem_Type.push_back(nParallel_Hexa);
+    nNode_Type.push_back(N_POINTS_HEXAHEDRON); XDMF_Type.push_back(9);
+  }
+  
+  /*--- Mixed topology: the XDMF type of every element is followed by its
+   (zero based) nodes, lines (polylines) also store their number of nodes. ---*/
+  
+  unsigned long myElem = 0, myConn = 0;
+  for (iType = 0; iType < Conn.size(); iType++) {
+    myElem += nElem_Type[iType];
+    myConn += nElem_Type[iType]*(nNode_Type[iType] + (XDMF_Type[iType] == 2 ? 2 : 1));
+  }
+  
+  vector<int> conn_buf(myConn);
+  iConn = 0;
+  for (iType = 0; iType < Conn.size(); iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      conn_buf[iConn++] = XDMF_Type[iType];
+      if (XDMF_Type[iType] == 2) conn_buf[iConn++] = nNode_Type[iType];
+      for (iNode = 0; iNode < nNode_Type[iType]; iNode++)
+        conn_buf[iConn++] = Conn[iType][iElem*nNode_Type[iType]+iNode]-1;
+    }
+  }
+  
+  /*--- Position of the slice of this rank in every block of the heavy data
+   file, from the points, elements and connectivity entries of the lower ranks. ---*/
+  
+  unsigned long myCount[3] = {myPoint, myElem, myConn};
+  vector<unsigned long> allCount(3*size);
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(myCount, 3, MPI_UNSIGNED_LONG, allCount.data(), 3, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  for (iDim = 0; iDim < 3; iDim++) allCount[iDim] = myCount[iDim];
+#endif
+  
+  unsigned long GlobalPoint = 0, GlobalElem = 0, GlobalConn = 0, PointBefore = 0, ConnBefore = 0;
+  for (iRank = 0; iRank < size; iRank++) {
+    if (iRank < rank) {
+      PointBefore += allCount[3*iRank];
+      ConnBefore  += allCount[3*iRank+2];
+    }
+    GlobalPoint += allCount[3*iRank];
+    GlobalElem  += allCount[3*iRank+1];
+    GlobalConn  += allCount[3*iRank+2];
+  }
+  
+  /*--- Fields written as node attributes, the coordinates are skipped. ---*/
+  
+  unsigned short iField, varStart = nDim;
+  vector<string> fieldNames;
+  for (iField = varStart; iField < Variable_Names.size(); iField++) {
+    string fieldname = Variable_Names[iField];
+    fieldname.erase(remove(fieldname.begin(), fieldname.end(), '"'), fieldname.end());
+    fieldNames.push_back(fieldname);
+  }
+  
+  /*--- Storage of the fields: 8 or 4 byte floats, or 1 or 2 byte unsigned
+   integers for the quantized fields, between the extrema of the field over
+   all ranks. The coordinates have the default precision of the output. ---*/
+  
+  const unsigned short nField = fieldNames.size();
+  vector<unsigned short> Field_Kind(nField), Field_Bytes(nField);
+  vector<double> Field_Offset(nField, 0.0), Field_Scale(nField, 0.0), Field_Error(nField, 0.0);
+  vector<double> Field_Extrema(2*nField, -numeric_limits<double>::max()), Global_Extrema(2*nField);
+  su2double error;
+  
+  for (iField = 0; iField < nField; iField++) {
+    Field_Kind[iField]  = config->GetOutput_Precision(fieldNames[iField], error);
+    Field_Error[iField] = SU2_TYPE::GetValue(error);
+    if (Field_Kind[iField] == OUTPUT_QUANTIZED) {
+      for (iPoint = 0; iPoint < myPoint; iPoint++) {
+        const double value = SU2_TYPE::GetValue(Data[varStart+iField][iPoint]);
+        Field_Extrema[2*iField]   = max(Field_Extrema[2*iField], -value);
+        Field_Extrema[2*iField+1] = max(Field_Extrema[2*iField+1], value);
+      }
+    }
+  }
+  
+#ifdef HAVE_MPI
+  CBaseMPIWrapper::Allreduce(Field_Extrema.data(), Global_Extrema.data(), 2*nField, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+  Global_Extrema = Field_Extrema;
+#endif
+  
+  /*--- A quantized field takes the smallest integer that meets its error bound,
+   the rounding error being half the scale. Fields that need more than 2 bytes
+   are written as 4 byte floats. ---*/
+  
+  for (iField = 0; iField < nField; iField++) {
+    Field_Bytes[iField] = (Field_Kind[iField] == OUTPUT_DOUBLE) ? sizeof(double) : sizeof(float);
+    if (Field_Kind[iField] != OUTPUT_QUANTIZED) continue;
+    const double minval = -Global_Extrema[2*iField];
+    const double range  = max(Global_Extrema[2*iField+1] - minval, 0.0);
+    const double levels = (Field_Error[iField] > 0.0) ? range/(2.0*Field_Error[iField]) : 65535.0;
+    if (levels > 65535.0) {
+      Field_Kind[iField] = OUTPUT_SINGLE;
+      continue;
+    }
+    Field_Bytes[iField]  = (levels > 255.0) ? 2 : 1;
+    Field_Offset[iField] = minval;
+    Field_Scale[iField]  = range/((Field_Bytes[iField] == 1) ? 255.0 : 65535.0);
+    Field_Error[iField]  = 0.5*Field_Scale[iField];
+  }
+  
+  /*--- Layout of the heavy data file: coordinates (always 3 per point), the
+   mixed connectivity and one block per field, all in native byte order. ---*/
+  
+  const unsigned short Coord_Bytes = (config->GetOutput_Precision() == OUTPUT_DOUBLE) ? sizeof(double) : sizeof(float);
+  
+  const unsigned long offCoord = 0;
+  const unsigned long offConn  = offCoord + GlobalPoint*NCOORDS*Coord_Bytes;
+  vector<unsigned long> offField(nField+1, offConn + GlobalConn*sizeof(int));
+  for (iField = 0; iField < nField; iField++)
+    offField[iField+1] = offField[iField] + GlobalPoint*Field_Bytes[iField];
+  
+  vector<double> coord_buf(myPoint*NCOORDS), scalar_buf(myPoint);
+  for (iPoint = 0; iPoint < myPoint; iPoint++) {
+    for (iDim = 0; iDim < NCOORDS; iDim++) {
+      if (nDim == 2 && iDim == 2) coord_buf[iPoint*NCOORDS + iDim] = 0.0;
+      else coord_buf[iPoint*NCOORDS + iDim] = SU2_TYPE::GetValue(Data[iDim][iPoint]);
+    }
+  }
+  
+  vector<char> byte_buf;
+  PackXDMFValues(coord_buf, Coord_Bytes, 0.0, 0.0, byte_buf);
+  
+#ifdef HAVE_MPI
+  
+  /*--- All ranks open the file and write their slice of every block with a
+   collective call, nothing is gathered on the master rank. Any existing file
+   is deleted first such that no stale data remains at the end. ---*/
+  
+  MPI_File fhw;
+  char fname[MAX_STRING_SIZE];
+  strcpy(fname, binname.c_str());
+  
+  if (rank == MASTER_NODE) MPI_File_delete(fname, MPI_INFO_NULL);
+  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  
+  int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                           MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    SU2_MPI::Error(string("Unable to open XDMF binary data file ") + binname, CURRENT_FUNCTION);
+  }
+  
+  MPI_File_write_at_all(fhw, offCoord + PointBefore*NCOORDS*Coord_Bytes, byte_buf.data(),
+                        byte_buf.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  
+  MPI_File_write_at_all(fhw, offConn + ConnBefore*sizeof(int), conn_buf.data(),
+                        myConn, MPI_INT, MPI_STATUS_IGNORE);
+  
+  for (iField = 0; iField < nField; iField++) {
+    for (iPoint = 0; iPoint < myPoint; iPoint++)
+      scalar_buf[iPoint] = SU2_TYPE::GetValue(Data[varStart+iField][iPoint]);
+    PackXDMFValues(scalar_buf, Field_Bytes[iField], Field_Offset[iField], Field_Scale[iField], byte_buf);
+    MPI_File_write_at_all(fhw, offField[iField] + PointBefore*Field_Bytes[iField],
+                          byte_buf.data(), byte_buf.size(), MPI_BYTE, MPI_STATUS_IGNORE);
+  }
+  
+  MPI_File_close(&fhw);
+  
+#else
+  
+  /*--- Serial implementation, the blocks are written one after the other. ---*/
+  
+  FILE* fhw = fopen(binname.c_str(), "wb");
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open XDMF binary data file ") + binname, CURRENT_FUNCTION);
+  }
+  
+  fwrite(byte_buf.data(), sizeof(char), byte_buf.size(), fhw);
+  fwrite(conn_buf.data(), sizeof(int), myConn, fhw);
+  
+  for (iField = 0; iField < nField; iField++) {
+    for (iPoint = 0; iPoint < myPoint; iPoint++)
+      scalar_buf[iPoint] = SU2_TYPE::GetValue(Data[varStart+iField][iPoint]);
+    PackXDMFValues(scalar_buf, Field_Bytes[iField], Field_Offset[iField], Field_Scale[iField], byte_buf);
+    fwrite(byte_buf.data(), sizeof(char), byte_buf.size(), fhw);
+  }
+  
+  fclose(fhw);
+  
+#endif
+  
+  /*--- The master writes the XML file that describes the heavy data. ---*/
+  
+  if (rank == MASTER_NODE) {
+    
+    ofstream XDMF_File(xmfname.c_str());
+    if (!XDMF_File.is_open()) {
+      SU2_MPI::Error(string("Unable to open XDMF file ") + xmfname, CURRENT_FUNCTION);
+    }
+    
+    string format = string("Format=\"Binary\" Endian=\"") + (BigEndian ? "Big" : "Little") + "\"";
+    
+    XDMF_File << "<?xml version=\"1.0\" ?>" << endl;
+    XDMF_File << "<!DOCTYPE Xdmf SYSTEM \"Xdmf.dtd\" []>" << endl;
+    XDMF_File << "<Xdmf Version=\"2.0\">" << endl;
+    XDMF_File << " <Domain>" << endl;
+    XDMF_File << "  <Grid Name=\"SU2\" GridType=\"Uniform\">" << endl;
+    
+    if (config->GetUnsteady_Simulation() != STEADY)
+      XDMF_File << "   <Time Value=\"" << config->GetCurrent_UnstTime() << "\"/>" << endl;
+    
+    XDMF_File << "   <Topology TopologyType=\"Mixed\" NumberOfElements=\"" << GlobalElem << "\">" << endl;
+    XDMF_File << "    <DataItem Dimensions=\"" << GlobalConn << "\" NumberType=\"Int\" Precision=\"4\" "
+              << format << " Seek=\"" << offConn << "\">" << binbase << "</DataItem>" << endl;
+    XDMF_File << "   </Topology>" << endl;
+    
+    XDMF_File << "   <Geometry GeometryType=\"XYZ\">" << endl;
+    XDMF_File << "    <DataItem Dimensions=\"" << GlobalPoint << " " << NCOORDS << "\" NumberType=\"Float\" Precision=\"" << Coord_Bytes << "\" "
+              << format << " Seek=\"" << offCoord << "\">" << binbase << "</DataItem>" << endl;
+    XDMF_File << "   </Geometry>" << endl;
+    
+    /*--- The quantized fields are decoded by a function of their integer data. ---*/
+    
+    XDMF_File.precision(17);
+    
+    for (iField = 0; iField < nField; iField++) {
+      XDMF_File << "   <Attribute Name=\"" << fieldNames[iField] << "\" AttributeType=\"Scalar\" Center=\"Node\">" << endl;
+      if (Field_Kind[iField] == OUTPUT_QUANTIZED) {
+        XDMF_File << "    <Information Name=\"QuantizationError\" Value=\"" << Field_Error[iField] << "\"/>" << endl;
+        XDMF_File << "    <DataItem ItemType=\"Function\" Dimensions=\"" << GlobalPoint << "\" Function=\"$0 * " << Field_Scale[iField]
+                  << (Field_Offset[iField] < 0.0 ? " - " : " + ") << fabs(Field_Offset[iField]) << "\">" << endl;
+        XDMF_File << "     <DataItem Dimensions=\"" << GlobalPoint << "\" NumberType=\"" << (Field_Bytes[iField] == 1 ? "UChar" : "UInt")
+                  << "\" Precision=\"" << Field_Bytes[iField] << "\" " << format << " Seek=\"" << offField[iField] << "\">"
+                  << binbase << "</DataItem>" << endl;
+        XDMF_File << "    </DataItem>" << endl;
+      } else {
+        XDMF_File << "    <DataItem Dimensions=\"" << GlobalPoint << "\" NumberType=\"Float\" Precision=\"" << Field_Bytes[iField] << "\" "
+                  << format << " Seek=\"" << offField[iField] << "\">" << binbase << "</DataItem>" << endl;
+      }
+      XDMF_File << "   </Attribute>" << endl;
+    }
+    
+    XDMF_File << "  </Grid>" << endl;
+    XDMF_File << " </Domain>" << endl;
+    XDMF_File << "</Xdmf>" << endl;
+    
+    XDMF_File.close();
+  }
+  
+}
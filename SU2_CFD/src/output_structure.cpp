@@ -37,6 +37,59 @@
 
 #include "../include/output_structure.hpp"
 
+CAsyncRestart::CAsyncRestart(string val_filename, unsigned long val_file_size) {
+
+  FileName  = val_filename;
+  File_Size = val_file_size;
+  Error     = false;
+
+}
+
+void CAsyncRestart::AddSegment(unsigned long val_offset, const void *val_data, unsigned long val_size) {
+
+  Offset.push_back(val_offset);
+  Segment.push_back(vector<char>(val_size));
+  if (val_size > 0) memcpy(&Segment.back()[0], val_data, val_size);
+
+}
+
+void CAsyncRestart::Write(void) {
+
+  unsigned long iSegment, nWritten;
+  ssize_t ret;
+  int fhw;
+
+  /*--- All ranks open the file without truncating it, the master rank sets
+   the final size. Since all the segments lie within the final size, the
+   order in which the ranks open and write the file does not matter. ---*/
+
+  fhw = open(FileName.c_str(), O_WRONLY|O_CREAT, 0644);
+  if (fhw < 0) { Error = true; return; }
+
+  if ((File_Size > 0) && (ftruncate(fhw, File_Size) != 0)) Error = true;
+
+  for (iSegment = 0; iSegment < Segment.size(); iSegment++) {
+    nWritten = 0;
+    while ((!Error) && (nWritten < Segment[iSegment].size())) {
+      ret = pwrite(fhw, &Segment[iSegment][nWritten], Segment[iSegment].size()-nWritten,
+                   Offset[iSegment]+nWritten);
+      if (ret <= 0) Error = true;
+      else nWritten += ret;
+    }
+    vector<char>().swap(Segment[iSegment]);
+  }
+
+  if (close(fhw) != 0) Error = true;
+
+}
+
+#ifdef HAVE_PTHREAD
+static void *Async_Restart_Thread(void *job) {
+  ((CAsyncRestart*)job)->Write();
+  return NULL;
+}
+#endif
+
 COutput::COutput(CConfig *config) {
 
   rank = SU2_MPI::GetRank();
@@ -67,6 +120,8 @@ COutput::COutput(CConfig *config) {
   Conn_Tria = NULL;     Conn_Quad = NULL;       Conn_Tetr = NULL;
   Conn_Hexa = NULL;     Conn_Pris = NULL;       Conn_Pyra = NULL;
   Data = NULL;
+  InSitu_Adaptor = NULL;
+  nHistory_Buffered = 0;
   
   /*--- Initialize parallel pointers to NULL ---*/
   
@@ -91,6 +146,10 @@ COutput::COutput(CConfig *config) {
   Conn_BoundLine_Par = NULL;  Conn_BoundTria_Par = NULL;  Conn_BoundQuad_Par = NULL;
   Conn_Tria_Par = NULL;  Conn_Quad_Par = NULL;       Conn_Tetr_Par = NULL;
   Conn_Hexa_Par = NULL;  Conn_Pris_Par = NULL;       Conn_Pyra_Par = NULL;
+
+  Conn_Cache_Geometry  = NULL;
+  Conn_Cache_Vol       = false;  Conn_Cache_Surf      = false;
+  Conn_BoundLine_Cache = NULL;  Conn_BoundTria_Cache = NULL;  Conn_BoundQuad_Cache = NULL;
   
   Local_Data         = NULL;
   Local_Data_Copy    = NULL;
@@ -326,6 +385,12 @@ COutput::~COutput(void) {
   /* Coords and Conn_*(Connectivity) have their own dealloc functions */
   /* Data is taken care of in DeallocateSolution function */
 
+  /*--- Complete the restart files that are still being written. ---*/
+
+  Wait_Async_Restart();
+
+  DeallocateConnectivity_Cache();
+
   if (RhoRes_Old != NULL) delete [] RhoRes_Old;
 
   /*--- Delete turboperformance pointers initiliazed at constrction  ---*/
@@ -659,17 +724,17 @@ void COutput::SetSurfaceCSV_Flow(CConfig *config, CGeometry *geometry,
   
   /*--- Send the information to the master node ---*/
   
-  SU2_MPI::Gather(Buffer_Send_Coord_x, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_x, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Coord_y, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_y, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_z, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Press, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Press, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_CPress, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_CPress, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  if (solver == EULER || solver == FEM_EULER) SU2_MPI::Gather(Buffer_Send_Mach, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Mach, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Coord_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Coord_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Press, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Press, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_CPress, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_CPress, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  if (solver == EULER || solver == FEM_EULER) SU2_MPI::Gather(Buffer_Send_Mach, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Mach, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if ((solver == NAVIER_STOKES) || (solver == RANS) || (solver == FEM_NAVIER_STOKES) || (solver == FEM_RANS) || (solver == FEM_LES)) {
-    SU2_MPI::Gather(Buffer_Send_SkinFriction_x, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_SkinFriction_x, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_SkinFriction_y, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_SkinFriction_y, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_SkinFriction_z, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_SkinFriction_z, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_HeatTransfer, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_HeatTransfer, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_SkinFriction_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_SkinFriction_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_SkinFriction_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_SkinFriction_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_SkinFriction_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_SkinFriction_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_HeatTransfer, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_HeatTransfer, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   }
   SU2_MPI::Gather(Buffer_Send_GlobalIndex, MaxLocalVertex_Surface, MPI_UNSIGNED_LONG, Buffer_Recv_GlobalIndex, MaxLocalVertex_Surface, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
   
@@ -1035,22 +1100,22 @@ void COutput::SetSurfaceCSV_Adjoint(CConfig *config, CGeometry *geometry, CSolve
   nBuffer_Scalar = MaxLocalVertex_Surface;
   
   /*--- Send the information to the Master node ---*/
-  SU2_MPI::Gather(Buffer_Send_Coord_x, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Coord_x, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Coord_y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Coord_y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Coord_z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Coord_x, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Coord_x, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Coord_y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Coord_y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Coord_z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   SU2_MPI::Gather(Buffer_Send_GlobalPoint, nBuffer_Scalar, MPI_UNSIGNED_LONG, Buffer_Receive_GlobalPoint, nBuffer_Scalar, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Sensitivity, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Sensitivity, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_PsiRho, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_PsiRho, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Phi_x, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Phi_x, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Phi_y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Phi_y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Phi_z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Phi_z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Sensitivity, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Sensitivity, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_PsiRho, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_PsiRho, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Phi_x, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Phi_x, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Phi_y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Phi_y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Phi_z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Phi_z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if (config->GetKind_Regime() == COMPRESSIBLE)
-      SU2_MPI::Gather(Buffer_Send_PsiE, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_PsiE, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_PsiE, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_PsiE, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if (config->GetDiscrete_Adjoint()) {
-    SU2_MPI::Gather(Buffer_Send_Sens_x, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Sens_x, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Sens_y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Sens_y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Sens_x, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Sens_x, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Sens_y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Sens_y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     if (nDim == 3) {
-      SU2_MPI::Gather(Buffer_Send_Sens_z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Receive_Sens_z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Sens_z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Receive_Sens_z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     }
   }
   
@@ -1513,10 +1578,10 @@ void COutput::MergeCoordinates(CConfig *config, CGeometry *geometry) {
   
   /*--- Gather the coordinate data on the master node using MPI. ---*/
   
-  SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if (nDim == 3) {
-    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   }
   SU2_MPI::Gather(Buffer_Send_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, Buffer_Recv_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
   
@@ -2635,7 +2700,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
     /*--- Gather the data on the master node. ---*/
     
 #ifdef HAVE_MPI
-    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
     for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -2643,7 +2708,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       
       if (config->GetWrt_Limiters()) {
 #ifdef HAVE_MPI
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
         for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Vol[iPoint] = Buffer_Send_Vol[iPoint];
 #endif
@@ -2651,7 +2716,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       
       if (config->GetWrt_Residuals()) {
 #ifdef HAVE_MPI
-        SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
         for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
 #endif
@@ -2735,10 +2800,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (geometry->GetnDim() == 3) {
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       }
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
@@ -2808,9 +2873,9 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -2871,7 +2936,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -2922,7 +2987,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
 #endif
@@ -2991,10 +3056,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (geometry->GetnDim() == 3) {
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       }
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++)
@@ -3077,8 +3142,8 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++)
         Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -3135,7 +3200,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -3187,7 +3252,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
         /*--- Gather the data on the master node. ---*/
         
 #ifdef HAVE_MPI
-        SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
         for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -3265,9 +3330,9 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (!config->GetDiscrete_Adjoint())
-        SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       if (!config->GetDiscrete_Adjoint())
@@ -3322,10 +3387,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (nDim == 3)
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -3384,10 +3449,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (geometry->GetnDim() == 3) {
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       }
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
@@ -3447,10 +3512,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (geometry->GetnDim() == 3) {
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       }
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
@@ -3513,9 +3578,9 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -3574,9 +3639,9 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -3630,7 +3695,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
       
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -3679,10 +3744,10 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
       /*--- Gather the data on the master node. ---*/
 
 #ifdef HAVE_MPI
-      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+      SU2_MPI::Gather(Buffer_Send_Res, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Res, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
       if (nDim == 3)
-        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Vol, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
       for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Res[iPoint] = Buffer_Send_Res[iPoint];
@@ -3740,7 +3805,7 @@ void COutput::MergeSolution(CConfig *config, CGeometry *geometry, CSolver **solv
         /*--- Gather the data on the master node. ---*/
         
 #ifdef HAVE_MPI
-        SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+        SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
         for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -3987,7 +4052,7 @@ void COutput::MergeBaselineSolution(CConfig *config, CGeometry *geometry, CSolve
     
     /*--- Gather the data on the master node. ---*/
     
-    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     if (iVar == 0) {
       SU2_MPI::Gather(Buffer_Send_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, Buffer_Recv_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
     }
@@ -4251,6 +4316,8 @@ void COutput::SetRestart(CConfig *config, CGeometry *geometry, CSolver **solver,
   restart_file <<"DCMX_DCL_VALUE= " << config->GetdCMx_dCL() << endl;
   restart_file <<"DCMY_DCL_VALUE= " << config->GetdCMy_dCL() << endl;
   restart_file <<"DCMZ_DCL_VALUE= " << config->GetdCMz_dCL() << endl;
+  if (config->GetWrt_Time_Average() && (solver[FLOW_SOL] != NULL))
+    restart_file <<"TIME_AVG_SAMPLES= " << solver[FLOW_SOL]->GetnTimeAverage_Samples() << endl;
   if (adjoint) restart_file << "SENS_AOA=" << solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0 << endl;
 
   /*--- Close the data portion of the restart file. ---*/
@@ -5956,7 +6023,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
             }
             if (output_comboObj) config[val_iZone]->GetHistFile()[0] << combo_obj;
             config[val_iZone]->GetHistFile()[0] << end;
-            config[val_iZone]->GetHistFile()[0].flush();
+            if (Flush_History(config[val_iZone])) config[val_iZone]->GetHistFile()[0].flush();
           }
 
           /*--- Write screen output ---*/
@@ -6051,7 +6118,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
             }
             if (output_comboObj) config[val_iZone]->GetHistFile()[0] << combo_obj;
             config[val_iZone]->GetHistFile()[0] << end;
-            config[val_iZone]->GetHistFile()[0].flush();
+            if (Flush_History(config[val_iZone])) config[val_iZone]->GetHistFile()[0].flush();
           }
           
           /*--- Write screen output ---*/
@@ -6124,7 +6191,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
 
           if (!DualTime_Iteration) {
             config[val_iZone]->GetHistFile()[0] << begin << direct_coeff << heat_resid << end;
-            config[val_iZone]->GetHistFile()[0].flush();
+            if (Flush_History(config[val_iZone])) config[val_iZone]->GetHistFile()[0].flush();
           }
           break;
 
@@ -6132,7 +6199,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
           
           if (!DualTime_Iteration) {
             config[val_iZone]->GetHistFile()[0] << begin << fem_coeff << fem_resid << end_fem;
-            config[val_iZone]->GetHistFile()[0].flush();
+            if (Flush_History(config[val_iZone])) config[val_iZone]->GetHistFile()[0].flush();
           
           cout.precision(6);
           cout.setf(ios::fixed, ios::floatfield);
@@ -6193,7 +6260,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
           
           if (!DualTime_Iteration) {
             ConvHist_file[0] << begin << adjoint_coeff << adj_flow_resid << end;
-            ConvHist_file[0].flush();
+            if (Flush_History(config[val_iZone])) ConvHist_file[0].flush();
           }
           if ((val_iZone == 0 && val_iInst == 0)|| fluid_structure){
             if (DualTime_Iteration || !Unsteady){
@@ -6248,7 +6315,7 @@ void COutput::SetConvHistory_Body(ofstream *ConvHist_file,
             if (!frozen_visc)
               ConvHist_file[0] << adj_turb_resid;
             ConvHist_file[0] << end;
-            ConvHist_file[0].flush();
+            if (Flush_History(config[val_iZone])) ConvHist_file[0].flush();
           }
           if ((val_iZone == 0 && val_iInst == 0)|| fluid_structure){
             if (DualTime_Iteration || !Unsteady){
@@ -6379,17 +6446,69 @@ void COutput::SetCFL_Number(CSolver *****solver_container, CConfig **config, uns
     else MGFactor[iMesh] = MGFactor[iMesh-1] * config[val_iZone]->GetCFL(iMesh)/config[val_iZone]->GetCFL(iMesh-1);
   }
 
-  if (Div < 1.0) power = config[val_iZone]->GetCFL_AdaptParam(0);
-  else power = config[val_iZone]->GetCFL_AdaptParam(1);
+  CFLMin = config[val_iZone]->GetCFL_AdaptParam(2);
+  CFLMax = config[val_iZone]->GetCFL_AdaptParam(3);
+
+  bool linsol_feedback = (config[val_iZone]->GetCFL_Adapt_LinSol() &&
+                          ((config[val_iZone]->GetKind_Solver() == EULER) ||
+                           (config[val_iZone]->GetKind_Solver() == NAVIER_STOKES) ||
+                           (config[val_iZone]->GetKind_Solver() == RANS)));
 
-  /*--- Detect a stall in the residual ---*/
+  if (linsol_feedback) {
 
-  if ((fabs(Diff) <= RhoRes_New*1E-8) && (ExtIter != 0)) { Div = 0.1; power = config[val_iZone]->GetCFL_AdaptParam(1); }
+    /*--- Controller with the feedback of the linear solver, of the nonlinear
+     residual and of the non-physical points. The CFL number is reduced when
+     the linear solver does not reach the required reduction of its residual
+     or when non-physical points appear, it is increased while the residual
+     decreases, and kept otherwise. With a local adaptation the non-physical
+     points only reduce their own CFL number. ---*/
 
-  CFLMin = config[val_iZone]->GetCFL_AdaptParam(2);
-  CFLMax = config[val_iZone]->GetCFL_AdaptParam(3);
+    CSolver *flow_solver = solver_container[val_iZone][INST_0][FinestMesh][FLOW_SOL];
+    bool local_cfl = config[val_iZone]->GetCFL_Adapt_Local();
+    su2double FactorDown = config[val_iZone]->GetCFL_AdaptParam_LinSol(0);
+    su2double FactorUp   = config[val_iZone]->GetCFL_AdaptParam_LinSol(1);
+    unsigned long iPoint, nPointDomain = flow_solver->GetnPointDomain();
+
+    unsigned long nNonPhysical = 0;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      if (flow_solver->node[iPoint]->GetNon_Physical() == 0.0) nNonPhysical++;
 
-  CFLFactor = pow(Div, power);
+#ifdef HAVE_MPI
+    unsigned long MyNonPhysical = nNonPhysical; nNonPhysical = 0;
+    SU2_MPI::Allreduce(&MyNonPhysical, &nNonPhysical, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#endif
+
+    bool linsol_failed = (flow_solver->GetResLinSolver() > config[val_iZone]->GetCFL_AdaptParam_LinSol(2));
+
+    if (linsol_failed || ((nNonPhysical > 0) && !local_cfl) || (Div < 0.5)) CFLFactor = FactorDown;
+    else if ((Div > 1.0) || (ExtIter == 0)) CFLFactor = FactorUp;
+    else CFLFactor = 1.0;
+
+    /*--- Local factors of the CFL number, which recover towards the global value. ---*/
+
+    if (local_cfl) {
+      su2double MinFactor = CFLMin/config[val_iZone]->GetCFL(MESH_0);
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        su2double Factor = flow_solver->node[iPoint]->GetLocalCFL_Factor();
+        if (flow_solver->node[iPoint]->GetNon_Physical() == 0.0) Factor = max(Factor*FactorDown, MinFactor);
+        else Factor = min(Factor*FactorUp, su2double(1.0));
+        flow_solver->node[iPoint]->SetLocalCFL_Factor(Factor);
+      }
+    }
+
+  }
+  else {
+
+    if (Div < 1.0) power = config[val_iZone]->GetCFL_AdaptParam(0);
+    else power = config[val_iZone]->GetCFL_AdaptParam(1);
+
+    /*--- Detect a stall in the residual ---*/
+
+    if ((fabs(Diff) <= RhoRes_New*1E-8) && (ExtIter != 0)) { Div = 0.1; power = config[val_iZone]->GetCFL_AdaptParam(1); }
+
+    CFLFactor = pow(Div, power);
+
+  }
 
   for (iMesh = 0; iMesh <= config[val_iZone]->GetnMGLevels(); iMesh++) {
     CFL = config[val_iZone]->GetCFL(iMesh);
@@ -6427,6 +6546,48 @@ void COutput::SetCFL_Number(CSolver *****solver_container, CConfig **config, uns
   
 }
 
+void COutput::SetDirectDiff_Directions(CSolver *****solver_container, CConfig **config, unsigned short val_iZone) {
+  
+  unsigned short iDir, iFunc, nFunc = 11, nDirections = config[val_iZone]->GetDirectDiff_Directions();
+  su2double Func[11];
+  ofstream Directions_file;
+  
+  if (rank != MASTER_NODE) return;
+  
+  CSolver *flow_solver = solver_container[val_iZone][INST_0][MESH_0][FLOW_SOL];
+  
+  Func[0]  = flow_solver->GetTotal_CL();
+  Func[1]  = flow_solver->GetTotal_CD();
+  Func[2]  = flow_solver->GetTotal_CSF();
+  Func[3]  = flow_solver->GetTotal_CMx();
+  Func[4]  = flow_solver->GetTotal_CMy();
+  Func[5]  = flow_solver->GetTotal_CMz();
+  Func[6]  = flow_solver->GetTotal_CFx();
+  Func[7]  = flow_solver->GetTotal_CFy();
+  Func[8]  = flow_solver->GetTotal_CFz();
+  Func[9]  = flow_solver->GetTotal_CEff();
+  Func[10] = flow_solver->GetTotal_Custom_ObjFunc();
+  
+  /*--- One row per tangent direction, the columns use the names of the
+   derivatives in the history file (the first row repeats its values). ---*/
+  
+  Directions_file.open("directdiff_directions.csv", ios::out);
+  Directions_file.precision(15);
+  
+  Directions_file << "\"Direction\",\"D(CL)\",\"D(CD)\",\"D(CSF)\",\"D(CMx)\",\"D(CMy)\",\"D(CMz)\",";
+  Directions_file << "\"D(CFx)\",\"D(CFy)\",\"D(CFz)\",\"D(CL/CD)\",\"D(Custom_ObjFunc)\"" << endl;
+  
+  for (iDir = 0; iDir < nDirections; iDir++) {
+    Directions_file << iDir;
+    for (iFunc = 0; iFunc < nFunc; iFunc++)
+      Directions_file << ", " << SU2_TYPE::GetDerivative(Func[iFunc], iDir);
+    Directions_file << endl;
+  }
+  
+  Directions_file.close();
+  
+}
+
 void COutput::SpecialOutput_ForcesBreakdown(CSolver *****solver, CGeometry ****geometry, CConfig **config, unsigned short val_iZone, bool output) {
   
   char cstr[200];
@@ -8499,6 +8660,15 @@ void COutput::SetBaselineResult_Files(CSolver ***solver, CGeometry ***geometry,
 
       unsigned short FileFormat = config[iZone]->GetOutput_FileFormat();
 
+      /*--- Formats with a parallel writer go through the sorting pipeline of
+       SU2_CFD, instead of merging the connectivity and the solution on the master. ---*/
+
+      if (((FileFormat == PARAVIEW_BINARY) || (FileFormat == XDMF)) && (nInst == 1) &&
+          (config[iZone]->GetKind_SU2() == SU2_SOL) && (!config[iZone]->GetWrt_Projected_Sensitivity())) {
+        SetBaselineResult_Files_Parallel(solver[iZone][iInst], geometry[iZone][iInst], config[iZone], iZone, val_nZone);
+        continue;
+      }
+
       /*--- Merge the node coordinates and connectivity if necessary. This
      is only performed if a volume solution file is requested, and it
      is active by default. ---*/
@@ -8663,6 +8833,63 @@ void COutput::SetBaselineResult_Files(CSolver ***solver, CGeometry ***geometry,
   }
 }
 
+void COutput::SetBaselineResult_Files_Parallel(CSolver *solver, CGeometry *geometry, CConfig *config,
+                                               unsigned short val_iZone, unsigned short val_nZone) {
+
+  bool Wrt_Vol = config->GetWrt_Vol_Sol();
+  bool Wrt_Srf = config->GetWrt_Srf_Sol();
+
+  unsigned short FileFormat = config->GetOutput_FileFormat();
+
+  if (!Wrt_Vol && !Wrt_Srf) return;
+
+  /*--- Load the restart data of this rank and sort it into the linear
+   partitioning, as in SU2_CFD. Nothing is gathered on the master rank. ---*/
+
+  LoadLocalData_Baseline(config, geometry, solver, val_iZone);
+
+  if (rank == MASTER_NODE) cout << "Sorting output data across all ranks." << endl;
+  SortOutputData(config, geometry);
+
+  /*--- The volume connectivity is kept between the snapshots (see SortConnectivity). ---*/
+
+  if (rank == MASTER_NODE) cout << "Preparing element connectivity across all ranks." << endl;
+  SortConnectivity(config, geometry, val_iZone);
+
+  if (Wrt_Srf) SortOutputData_Surface(config, geometry);
+
+  if (Wrt_Vol) {
+    if (FileFormat == PARAVIEW_BINARY) {
+      if (rank == MASTER_NODE) cout << "Writing Paraview binary volume solution file." << endl;
+      WriteParaViewBinary_Parallel(config, geometry, &solver, val_iZone, val_nZone, false);
+    } else {
+      if (rank == MASTER_NODE) cout << "Writing XDMF volume solution file." << endl;
+      WriteXDMF_Parallel(config, geometry, &solver, val_iZone, val_nZone, false);
+    }
+  }
+
+  if (Wrt_Srf) {
+    if (FileFormat == PARAVIEW_BINARY) {
+      if (rank == MASTER_NODE) cout << "Writing Paraview binary surface solution file." << endl;
+      WriteParaViewBinary_Parallel(config, geometry, &solver, val_iZone, val_nZone, true);
+    } else {
+      if (rank == MASTER_NODE) cout << "Writing XDMF surface solution file." << endl;
+      WriteXDMF_Parallel(config, geometry, &solver, val_iZone, val_nZone, true);
+    }
+  }
+
+  /*--- Clean up the surface connectivity and data, and the sorted data. ---*/
+
+  if (Wrt_Srf) {
+    DeallocateConnectivity_Parallel(config, geometry, true);
+    DeallocateSurfaceData_Parallel(config, geometry);
+  }
+
+  DeallocateData_Parallel(config, geometry);
+  Variable_Names.clear();
+
+}
+
 void COutput::SetMesh_Files(CGeometry **geometry, CConfig **config, unsigned short val_nZone, bool new_file, bool su2_file) {
 
   char cstr[MAX_STRING_SIZE], out_file[MAX_STRING_SIZE];
@@ -9360,7 +9587,7 @@ void COutput::SetCp_InverseDesign(CSolver *solver_container, CGeometry *geometry
   
 #ifdef HAVE_MPI
   su2double MyPressDiff = PressDiff;   PressDiff = 0.0;
-  SU2_MPI::Allreduce(&MyPressDiff, &PressDiff, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyPressDiff, &PressDiff, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
   /*--- Update the total Cp difference coeffient ---*/
@@ -9511,7 +9738,7 @@ void COutput::SetHeatFlux_InverseDesign(CSolver *solver_container, CGeometry *ge
   
 #ifdef HAVE_MPI
   su2double MyHeatFluxDiff = HeatFluxDiff;   HeatFluxDiff = 0.0;
-  SU2_MPI::Allreduce(&MyHeatFluxDiff, &HeatFluxDiff, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyHeatFluxDiff, &HeatFluxDiff, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
   /*--- Update the total HeatFlux difference coeffient ---*/
@@ -9527,16 +9754,17 @@ void COutput::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry, CCon
   
   ofstream EquivArea_file, FuncGrad_file;
   unsigned short iMarker = 0, iDim;
-  short *AzimuthalAngle = NULL;
-  su2double Gamma, auxXCoord, auxYCoord, auxZCoord, InverseDesign = 0.0, DeltaX, Coord_i, Coord_j, jp1Coord, *Coord = NULL, MeanFuntion,
-  *Face_Normal = NULL, auxArea, auxPress, Mach, Beta, R_Plane, Pressure_Inf,
-  ModVelocity_Inf, Velocity_Inf[3], factor, *Xcoord = NULL, *Ycoord = NULL, *Zcoord = NULL,
-  *Pressure = NULL, *FaceArea = NULL, *EquivArea = NULL, *TargetArea = NULL, *NearFieldWeight = NULL,
-  *Weight = NULL, jFunction, jp1Function;
-  unsigned long jVertex, iVertex, iPoint, nVertex_NearField = 0, auxPoint,
-  *IdPoint = NULL, *IdDomain = NULL, auxDomain;
-  unsigned short iPhiAngle;
+  su2double Gamma, InverseDesign = 0.0, DeltaX, Coord_i, Coord_j, jp1Coord, *Coord = NULL, MeanFuntion,
+  *Face_Normal = NULL, Mach, Beta, R_Plane, Pressure_Inf,
+  ModVelocity_Inf, Velocity_Inf[3], factor, jFunction, jp1Function;
+  unsigned long jVertex, iVertex, iPoint, iItem, nVertex_NearField = 0, nLocalVertex_NearField = 0;
+  unsigned short iPhiAngle, nPhiAngle;
   ofstream NearFieldEA_file; ifstream TargetEA_file;
+  int nProcessor = size;
+  
+  /*--- Each near-field point is packed as (x, z, pressure, azimuthal angle) ---*/
+  
+  const unsigned short nVar_NearField = 4;
   
   su2double XCoordBegin_OF = config->GetEA_IntLimit(0);
   su2double XCoordEnd_OF = config->GetEA_IntLimit(1);
@@ -9544,6 +9772,7 @@ void COutput::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry, CCon
   unsigned short nDim = geometry->GetnDim();
   su2double AoA = -(config->GetAoA()*PI_NUMBER/180.0);
   su2double EAScaleFactor = config->GetEA_ScaleFactor(); // The EA Obj. Func. should be ~ force based Obj. Func.
+  su2double FixAzimuthalLine = config->GetFixAzimuthalLine();
   
   Mach  = config->GetMach();
   Gamma = config->GetGamma();
@@ -9560,12 +9789,13 @@ void COutput::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry, CCon
   factor = 4.0*sqrt(2.0*Beta*R_Plane) / (Gamma*Pressure_Inf*Mach*Mach);
   
   if (rank == MASTER_NODE) cout << endl << "Writing Equivalent Area files.";
-
-#ifndef HAVE_MPI
   
-  /*--- Compute the total number of points on the near-field ---*/
+  /*--- Extract the owned near-field points on each rank. The azimuthal angle
+   is evaluated and filtered locally, so only the points that actually take
+   part in the equivalent area computation are communicated. ---*/
+  
+  vector<su2double> Buffer_Send_NearField;
   
-  nVertex_NearField = 0;
   for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
@@ -9576,413 +9806,231 @@ void COutput::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry, CCon
         /*--- Using Face_Normal(z), and Coord(z) we identify only a surface,
          note that there are 2 NEARFIELD_BOUNDARY surfaces ---*/
         
-        if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0)) nVertex_NearField ++;
-      }
-  
-  /*--- Create an array with all the coordinates, points, pressures, face area,
-   equivalent area, and nearfield weight ---*/
-  
-  Xcoord = new su2double[nVertex_NearField];
-  Ycoord = new su2double[nVertex_NearField];
-  Zcoord = new su2double[nVertex_NearField];
-  AzimuthalAngle = new short[nVertex_NearField];
-  IdPoint = new unsigned long[nVertex_NearField];
-  IdDomain = new unsigned long[nVertex_NearField];
-  Pressure = new su2double[nVertex_NearField];
-  FaceArea = new su2double[nVertex_NearField];
-  EquivArea = new su2double[nVertex_NearField];
-  TargetArea = new su2double[nVertex_NearField];
-  NearFieldWeight = new su2double[nVertex_NearField];
-  Weight = new su2double[nVertex_NearField];
-  
-  /*--- Copy the boundary information to an array ---*/
-  
-  nVertex_NearField = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-        Coord = geometry->node[iPoint]->GetCoord();
-        
-        if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0)) {
-          
-          IdPoint[nVertex_NearField] = iPoint;
-          Xcoord[nVertex_NearField] = geometry->node[iPoint]->GetCoord(0);
-          Ycoord[nVertex_NearField] = geometry->node[iPoint]->GetCoord(1);
-          
-          if (nDim ==2) {
-            AzimuthalAngle[nVertex_NearField] = 0;
-          }
-          
-          if (nDim == 3) {
-            Zcoord[nVertex_NearField] = geometry->node[iPoint]->GetCoord(2);
-            
-            /*--- Rotate the nearfield cylinder (AoA) only 3D ---*/
-            
-            su2double YcoordRot = Ycoord[nVertex_NearField];
-            su2double ZcoordRot = Xcoord[nVertex_NearField]*sin(AoA) + Zcoord[nVertex_NearField]*cos(AoA);
-            
-            /*--- Compute the Azimuthal angle (resolution of degress in the Azimuthal angle)---*/
-            
-            su2double AngleDouble; short AngleInt;
-            AngleDouble = fabs(atan(-YcoordRot/ZcoordRot)*180.0/PI_NUMBER);
-            
-            /*--- Fix an azimuthal line due to misalignments of the near-field ---*/
+        if (geometry->node[iPoint]->GetDomain())
+          if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0)) {
             
-            su2double FixAzimuthalLine = config->GetFixAzimuthalLine();
+            su2double Xcoord = Coord[0], Ycoord = Coord[1], Zcoord = 0.0;
+            short AzimuthalAngle = 0;
             
-            if ((AngleDouble >= FixAzimuthalLine - 0.1) && (AngleDouble <= FixAzimuthalLine + 0.1)) AngleDouble = FixAzimuthalLine - 0.1;
+            if (nDim == 3) {
+              Zcoord = Coord[2];
+              
+              /*--- Rotate the nearfield cylinder (AoA) only 3D ---*/
+              
+              su2double YcoordRot = Ycoord;
+              su2double ZcoordRot = Xcoord*sin(AoA) + Zcoord*cos(AoA);
+              
+              /*--- Compute the Azimuthal angle (resolution of degress in the Azimuthal angle)---*/
+              
+              su2double AngleDouble; short AngleInt;
+              AngleDouble = fabs(atan(-YcoordRot/ZcoordRot)*180.0/PI_NUMBER);
+              
+              /*--- Fix an azimuthal line due to misalignments of the near-field ---*/
+              
+              if ((AngleDouble >= FixAzimuthalLine - 0.1) && (AngleDouble <= FixAzimuthalLine + 0.1))
+                AngleDouble = FixAzimuthalLine - 0.1;
+              
+              AngleInt = SU2_TYPE::Short(floor(AngleDouble + 0.5));
+              if (AngleInt >= 0) AzimuthalAngle = AngleInt;
+              else AzimuthalAngle = 180 + AngleInt;
+            }
             
-            AngleInt = SU2_TYPE::Short(floor(AngleDouble + 0.5));
-            if (AngleInt >= 0) AzimuthalAngle[nVertex_NearField] = AngleInt;
-            else AzimuthalAngle[nVertex_NearField] = 180 + AngleInt;
-          }
+            if (AzimuthalAngle <= 60) {
+              Buffer_Send_NearField.push_back(Xcoord);
+              Buffer_Send_NearField.push_back(Zcoord);
+              Buffer_Send_NearField.push_back(solver->node[iPoint]->GetPressure());
+              Buffer_Send_NearField.push_back(su2double(AzimuthalAngle));
+              nLocalVertex_NearField++;
+            }
           
-          if (AzimuthalAngle[nVertex_NearField] <= 60) {
-            Pressure[nVertex_NearField] = solver->node[iPoint]->GetPressure();
-            FaceArea[nVertex_NearField] = fabs(Face_Normal[nDim-1]);
-            nVertex_NearField ++;
           }
-          
-        }
       }
   
+  /*--- Merge the partial lines of all the ranks with a single collective.
+   The near-field lines are one-dimensional, so the merged data is small
+   compared with the surface, and every rank can bin it without a second
+   round of communication. ---*/
+  
+  vector<su2double> NearField;
+
+#ifndef HAVE_MPI
+  
+  nVertex_NearField = nLocalVertex_NearField;
+  NearField.swap(Buffer_Send_NearField);
+
 #else
   
-  int nProcessor;
-  SU2_MPI::Comm_size(MPI_COMM_WORLD, &nProcessor);
+  int iProcessor, nLocal_Send = int(Buffer_Send_NearField.size());
+  int *Buffer_Recv_Count = new int[nProcessor];
+  int *Buffer_Recv_Displ = new int[nProcessor];
   
-  unsigned long nLocalVertex_NearField = 0, MaxLocalVertex_NearField = 0;
-  int iProcessor;
+  SU2_MPI::Allgather(&nLocal_Send, 1, MPI_INT, Buffer_Recv_Count, 1, MPI_INT, MPI_COMM_WORLD);
   
-  unsigned long *Buffer_Receive_nVertex = NULL;
-  if (rank == MASTER_NODE) {
-    Buffer_Receive_nVertex = new unsigned long [nProcessor];
-  }
+  Buffer_Recv_Displ[0] = 0;
+  for (iProcessor = 1; iProcessor < nProcessor; iProcessor++)
+    Buffer_Recv_Displ[iProcessor] = Buffer_Recv_Displ[iProcessor-1] + Buffer_Recv_Count[iProcessor-1];
   
-  /*--- Compute the total number of points of the near-field ghost nodes ---*/
+  unsigned long nRecv = Buffer_Recv_Displ[nProcessor-1] + Buffer_Recv_Count[nProcessor-1];
+  nVertex_NearField = nRecv/nVar_NearField;
   
-  nLocalVertex_NearField = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-        Coord = geometry->node[iPoint]->GetCoord();
-        
-        if (geometry->node[iPoint]->GetDomain())
-          if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0))
-            nLocalVertex_NearField ++;
-      }
+  NearField.resize(nRecv);
+  SU2_MPI::Allgatherv(nLocal_Send > 0 ? &Buffer_Send_NearField[0] : NULL, nLocal_Send, MPI_SU2DOUBLE,
+                      nRecv > 0 ? &NearField[0] : NULL, Buffer_Recv_Count, Buffer_Recv_Displ, MPI_SU2DOUBLE, MPI_COMM_WORLD);
   
-  unsigned long *Buffer_Send_nVertex = new unsigned long [1];
-  Buffer_Send_nVertex[0] = nLocalVertex_NearField;
+  delete [] Buffer_Recv_Count;
+  delete [] Buffer_Recv_Displ;
+
+#endif
   
-  /*--- Send Near-Field vertex information --*/
+  /*--- Build the list of azimuthal angles (global bins) ---*/
   
-  SU2_MPI::Allreduce(&nLocalVertex_NearField, &nVertex_NearField, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&nLocalVertex_NearField, &MaxLocalVertex_NearField, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_nVertex, 1, MPI_UNSIGNED_LONG, Buffer_Receive_nVertex, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-  delete [] Buffer_Send_nVertex;
+  vector<short> PhiAngleList;
+  vector<short>::iterator IterPhiAngleList;
   
-  su2double *Buffer_Send_Xcoord = new su2double[MaxLocalVertex_NearField];
-  su2double *Buffer_Send_Ycoord = new su2double[MaxLocalVertex_NearField];
-  su2double *Buffer_Send_Zcoord = new su2double[MaxLocalVertex_NearField];
-  unsigned long *Buffer_Send_IdPoint = new unsigned long [MaxLocalVertex_NearField];
-  su2double *Buffer_Send_Pressure = new su2double [MaxLocalVertex_NearField];
-  su2double *Buffer_Send_FaceArea = new su2double[MaxLocalVertex_NearField];
+  for (iVertex = 0; iVertex < nVertex_NearField; iVertex++)
+    PhiAngleList.push_back(SU2_TYPE::Short(NearField[iVertex*nVar_NearField+3]));
   
-  su2double *Buffer_Receive_Xcoord = NULL;
-  su2double *Buffer_Receive_Ycoord = NULL;
-  su2double *Buffer_Receive_Zcoord = NULL;
-  unsigned long *Buffer_Receive_IdPoint = NULL;
-  su2double *Buffer_Receive_Pressure = NULL;
-  su2double *Buffer_Receive_FaceArea = NULL;
+  sort( PhiAngleList.begin(), PhiAngleList.end());
+  IterPhiAngleList = unique( PhiAngleList.begin(), PhiAngleList.end());
+  PhiAngleList.resize( IterPhiAngleList - PhiAngleList.begin() );
+  nPhiAngle = PhiAngleList.size();
   
-  if (rank == MASTER_NODE) {
-    Buffer_Receive_Xcoord = new su2double[nProcessor*MaxLocalVertex_NearField];
-    Buffer_Receive_Ycoord = new su2double[nProcessor*MaxLocalVertex_NearField];
-    Buffer_Receive_Zcoord = new su2double[nProcessor*MaxLocalVertex_NearField];
-    Buffer_Receive_IdPoint = new unsigned long[nProcessor*MaxLocalVertex_NearField];
-    Buffer_Receive_Pressure = new su2double[nProcessor*MaxLocalVertex_NearField];
-    Buffer_Receive_FaceArea = new su2double[nProcessor*MaxLocalVertex_NearField];
+  if (nPhiAngle == 0) {
+    solver->SetTotal_CEquivArea(0.0);
+    return;
   }
   
-  unsigned long nBuffer_Xcoord = MaxLocalVertex_NearField;
-  unsigned long nBuffer_Ycoord = MaxLocalVertex_NearField;
-  unsigned long nBuffer_Zcoord = MaxLocalVertex_NearField;
-  unsigned long nBuffer_IdPoint = MaxLocalVertex_NearField;
-  unsigned long nBuffer_Pressure = MaxLocalVertex_NearField;
-  unsigned long nBuffer_FaceArea = MaxLocalVertex_NearField;
+  /*--- Distribute the points among the azimuthal bins and order each bin in x.
+   Sorting (x, index) pairs keeps points with the same x in their original
+   order. ---*/
   
-  for (iVertex = 0; iVertex < MaxLocalVertex_NearField; iVertex++) {
-    Buffer_Send_IdPoint[iVertex] = 0; Buffer_Send_Pressure[iVertex] = 0.0;
-    Buffer_Send_FaceArea[iVertex] = 0.0; Buffer_Send_Xcoord[iVertex] = 0.0;
-    Buffer_Send_Ycoord[iVertex] = 0.0; Buffer_Send_Zcoord[iVertex] = 0.0;
+  vector<vector<pair<su2double, unsigned long> > > Order_PhiAngle(nPhiAngle);
+  
+  for (iVertex = 0; iVertex < nVertex_NearField; iVertex++) {
+    short AzimuthalAngle = SU2_TYPE::Short(NearField[iVertex*nVar_NearField+3]);
+    iPhiAngle = lower_bound(PhiAngleList.begin(), PhiAngleList.end(), AzimuthalAngle) - PhiAngleList.begin();
+    Order_PhiAngle[iPhiAngle].push_back(make_pair(NearField[iVertex*nVar_NearField+0], iVertex));
   }
   
-  /*--- Copy coordinates, index points, and pressures to the auxiliar vector --*/
+  for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+    sort(Order_PhiAngle[iPhiAngle].begin(), Order_PhiAngle[iPhiAngle].end());
   
-  nLocalVertex_NearField = 0;
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++)
-    if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY)
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Face_Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-        Coord = geometry->node[iPoint]->GetCoord();
-        
-        if (geometry->node[iPoint]->GetDomain())
-          if ((Face_Normal[nDim-1] > 0.0) && (Coord[nDim-1] < 0.0)) {
-            Buffer_Send_IdPoint[nLocalVertex_NearField] = iPoint;
-            Buffer_Send_Xcoord[nLocalVertex_NearField] = geometry->node[iPoint]->GetCoord(0);
-            Buffer_Send_Ycoord[nLocalVertex_NearField] = geometry->node[iPoint]->GetCoord(1);
-            Buffer_Send_Zcoord[nLocalVertex_NearField] = geometry->node[iPoint]->GetCoord(2);
-            Buffer_Send_Pressure[nLocalVertex_NearField] = solver->node[iPoint]->GetPressure();
-            Buffer_Send_FaceArea[nLocalVertex_NearField] = fabs(Face_Normal[nDim-1]);
-            nLocalVertex_NearField++;
-          }
-      }
+  /*--- Flattened storage of each bin, Offset_PhiAngle gives the first entry of a bin ---*/
   
-  /*--- Send all the information --*/
+  vector<unsigned long> Offset_PhiAngle(nPhiAngle+1, 0);
+  for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+    Offset_PhiAngle[iPhiAngle+1] = Offset_PhiAngle[iPhiAngle] + Order_PhiAngle[iPhiAngle].size();
   
-  SU2_MPI::Gather(Buffer_Send_Xcoord, nBuffer_Xcoord, MPI_DOUBLE, Buffer_Receive_Xcoord, nBuffer_Xcoord, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Ycoord, nBuffer_Ycoord, MPI_DOUBLE, Buffer_Receive_Ycoord, nBuffer_Ycoord, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Zcoord, nBuffer_Zcoord, MPI_DOUBLE, Buffer_Receive_Zcoord, nBuffer_Zcoord, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_IdPoint, nBuffer_IdPoint, MPI_UNSIGNED_LONG, Buffer_Receive_IdPoint, nBuffer_IdPoint, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Pressure, nBuffer_Pressure, MPI_DOUBLE, Buffer_Receive_Pressure, nBuffer_Pressure, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_FaceArea, nBuffer_FaceArea, MPI_DOUBLE, Buffer_Receive_FaceArea, nBuffer_FaceArea, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  delete [] Buffer_Send_Xcoord;
-  delete [] Buffer_Send_Ycoord;
-  delete [] Buffer_Send_Zcoord;
-  delete [] Buffer_Send_IdPoint;
-  delete [] Buffer_Send_Pressure;
-  delete [] Buffer_Send_FaceArea;
+  vector<su2double> Xcoord_PhiAngle(nVertex_NearField), XcoordRot_PhiAngle(nVertex_NearField),
+  Pressure_PhiAngle(nVertex_NearField), EquivArea_PhiAngle(nVertex_NearField, 0.0),
+  TargetArea_PhiAngle(nVertex_NearField, 0.0), NearFieldWeight_PhiAngle(nVertex_NearField, 0.0);
   
-  if (rank == MASTER_NODE) {
-    
-    Xcoord = new su2double[nVertex_NearField];
-    Ycoord = new su2double[nVertex_NearField];
-    Zcoord = new su2double[nVertex_NearField];
-    AzimuthalAngle = new short[nVertex_NearField];
-    IdPoint = new unsigned long[nVertex_NearField];
-    IdDomain = new unsigned long[nVertex_NearField];
-    Pressure = new su2double[nVertex_NearField];
-    FaceArea = new su2double[nVertex_NearField];
-    EquivArea = new su2double[nVertex_NearField];
-    TargetArea = new su2double[nVertex_NearField];
-    NearFieldWeight = new su2double[nVertex_NearField];
-    Weight = new su2double[nVertex_NearField];
-    
-    nVertex_NearField = 0;
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++)
-      for (iVertex = 0; iVertex < Buffer_Receive_nVertex[iProcessor]; iVertex++) {
-        Xcoord[nVertex_NearField] = Buffer_Receive_Xcoord[iProcessor*MaxLocalVertex_NearField+iVertex];
-        Ycoord[nVertex_NearField] = Buffer_Receive_Ycoord[iProcessor*MaxLocalVertex_NearField+iVertex];
-        
-        if (nDim == 2) {
-          AzimuthalAngle[nVertex_NearField] = 0;
-        }
-        
-        if (nDim == 3) {
-          Zcoord[nVertex_NearField] = Buffer_Receive_Zcoord[iProcessor*MaxLocalVertex_NearField+iVertex];
-          
-          /*--- Rotate the nearfield cylinder  ---*/
-          
-          su2double YcoordRot = Ycoord[nVertex_NearField];
-          su2double ZcoordRot = Xcoord[nVertex_NearField]*sin(AoA) + Zcoord[nVertex_NearField]*cos(AoA);
-          
-          /*--- Compute the Azimuthal angle ---*/
-          
-          su2double AngleDouble; short AngleInt;
-          AngleDouble = fabs(atan(-YcoordRot/ZcoordRot)*180.0/PI_NUMBER);
-          
-          /*--- Fix an azimuthal line due to misalignments of the near-field ---*/
-          
-          su2double FixAzimuthalLine = config->GetFixAzimuthalLine();
-          
-          if ((AngleDouble >= FixAzimuthalLine - 0.1) && (AngleDouble <= FixAzimuthalLine + 0.1))
-            AngleDouble = FixAzimuthalLine - 0.1;
-          
-          AngleInt = SU2_TYPE::Short(floor(AngleDouble + 0.5));
-          
-          if (AngleInt >= 0) AzimuthalAngle[nVertex_NearField] = AngleInt;
-          else AzimuthalAngle[nVertex_NearField] = 180 + AngleInt;
-        }
+  for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+    for (iVertex = 0; iVertex < Order_PhiAngle[iPhiAngle].size(); iVertex++) {
+      iItem = Offset_PhiAngle[iPhiAngle] + iVertex;
+      jVertex = Order_PhiAngle[iPhiAngle][iVertex].second;
+      Xcoord_PhiAngle[iItem] = NearField[jVertex*nVar_NearField+0];
+      XcoordRot_PhiAngle[iItem] = NearField[jVertex*nVar_NearField+0]*cos(AoA) - NearField[jVertex*nVar_NearField+1]*sin(AoA);
+      Pressure_PhiAngle[iItem] = NearField[jVertex*nVar_NearField+2];
+    }
+  
+  NearField.clear();
+  Order_PhiAngle.clear();
+  
+  /*--- Check that all the azimuth lists have the same size ---*/
+  
+  unsigned long nVertex = Offset_PhiAngle[1] - Offset_PhiAngle[0];
+  for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+    unsigned long nVertex_aux = Offset_PhiAngle[iPhiAngle+1] - Offset_PhiAngle[iPhiAngle];
+    if ((nVertex_aux != nVertex) && (rank == MASTER_NODE))
+      cout <<"Be careful!!! one azimuth list is shorter than the other"<< endl;
+    nVertex = min(nVertex, nVertex_aux);
+  }
+  
+  /*--- Compute equivalent area distribution at each azimuth angle. The cost of
+   each station grows with its distance from the start of the line, so the
+   stations are dealt out round-robin among the ranks and summed afterwards. ---*/
+  
+  for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+    unsigned long Offset = Offset_PhiAngle[iPhiAngle];
+    unsigned long nVertex_PhiAngle = Offset_PhiAngle[iPhiAngle+1] - Offset;
+    for (iVertex = 1; iVertex < nVertex_PhiAngle; iVertex++) {
+      if (int((Offset + iVertex) % nProcessor) != rank) continue;
+      
+      Coord_i = XcoordRot_PhiAngle[Offset+iVertex];
+      
+      for (jVertex = 0; jVertex < iVertex-1; jVertex++) {
         
-        if (AzimuthalAngle[nVertex_NearField] <= 60) {
-          IdPoint[nVertex_NearField] = Buffer_Receive_IdPoint[iProcessor*MaxLocalVertex_NearField+iVertex];
-          Pressure[nVertex_NearField] = Buffer_Receive_Pressure[iProcessor*MaxLocalVertex_NearField+iVertex];
-          FaceArea[nVertex_NearField] = Buffer_Receive_FaceArea[iProcessor*MaxLocalVertex_NearField+iVertex];
-          IdDomain[nVertex_NearField] = iProcessor;
-          nVertex_NearField++;
-        }
+        Coord_j = XcoordRot_PhiAngle[Offset+jVertex];
+        jp1Coord = XcoordRot_PhiAngle[Offset+jVertex+1];
         
+        jFunction = factor*(Pressure_PhiAngle[Offset+jVertex] - Pressure_Inf)*sqrt(Coord_i-Coord_j);
+        jp1Function = factor*(Pressure_PhiAngle[Offset+jVertex+1] - Pressure_Inf)*sqrt(Coord_i-jp1Coord);
+        
+        DeltaX = (jp1Coord-Coord_j);
+        MeanFuntion = 0.5*(jp1Function + jFunction);
+        EquivArea_PhiAngle[Offset+iVertex] += DeltaX * MeanFuntion;
       }
-    
-    delete [] Buffer_Receive_nVertex;
-    
-    delete [] Buffer_Receive_Xcoord;
-    delete [] Buffer_Receive_Ycoord;
-    delete [] Buffer_Receive_Zcoord;
-    delete [] Buffer_Receive_IdPoint;
-    delete [] Buffer_Receive_Pressure;
-    delete [] Buffer_Receive_FaceArea;
-    
+    }
   }
-  
+
+#ifdef HAVE_MPI
+  vector<su2double> EquivArea_Local(EquivArea_PhiAngle);
+  SU2_MPI::Allreduce(&EquivArea_Local[0], &EquivArea_PhiAngle[0], nVertex_NearField, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
-  if (rank == MASTER_NODE) {
-    
-    vector<short> PhiAngleList;
-    vector<short>::iterator IterPhiAngleList;
-    
-    for (iVertex = 0; iVertex < nVertex_NearField; iVertex++)
-      PhiAngleList.push_back(AzimuthalAngle[iVertex]);
-    
-    sort( PhiAngleList.begin(), PhiAngleList.end());
-    IterPhiAngleList = unique( PhiAngleList.begin(), PhiAngleList.end());
-    PhiAngleList.resize( IterPhiAngleList - PhiAngleList.begin() );
-    
-    /*--- Create vectors and distribute the values among the different PhiAngle queues ---*/
-    
-    vector<vector<su2double> > Xcoord_PhiAngle; Xcoord_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > Ycoord_PhiAngle; Ycoord_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > Zcoord_PhiAngle; Zcoord_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<unsigned long> > IdPoint_PhiAngle; IdPoint_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<unsigned long> > IdDomain_PhiAngle; IdDomain_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > Pressure_PhiAngle; Pressure_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > FaceArea_PhiAngle; FaceArea_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > EquivArea_PhiAngle; EquivArea_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > TargetArea_PhiAngle; TargetArea_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > NearFieldWeight_PhiAngle; NearFieldWeight_PhiAngle.resize(PhiAngleList.size());
-    vector<vector<su2double> > Weight_PhiAngle; Weight_PhiAngle.resize(PhiAngleList.size());
-    
-    /*--- Distribute the values among the different PhiAngles ---*/
-    
-    for (iVertex = 0; iVertex < nVertex_NearField; iVertex++)
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-        if (AzimuthalAngle[iVertex] == PhiAngleList[iPhiAngle]) {
-          Xcoord_PhiAngle[iPhiAngle].push_back(Xcoord[iVertex]);
-          Ycoord_PhiAngle[iPhiAngle].push_back(Ycoord[iVertex]);
-          Zcoord_PhiAngle[iPhiAngle].push_back(Zcoord[iVertex]);
-          IdPoint_PhiAngle[iPhiAngle].push_back(IdPoint[iVertex]);
-          IdDomain_PhiAngle[iPhiAngle].push_back(IdDomain[iVertex]);
-          Pressure_PhiAngle[iPhiAngle].push_back(Pressure[iVertex]);
-          FaceArea_PhiAngle[iPhiAngle].push_back(FaceArea[iVertex]);
-          EquivArea_PhiAngle[iPhiAngle].push_back(EquivArea[iVertex]);
-          TargetArea_PhiAngle[iPhiAngle].push_back(TargetArea[iVertex]);
-          NearFieldWeight_PhiAngle[iPhiAngle].push_back(NearFieldWeight[iVertex]);
-          Weight_PhiAngle[iPhiAngle].push_back(Weight[iVertex]);
-        }
-    
-    /*--- Order the arrays (x Coordinate, Pressure, Point, and Domain) ---*/
-    
-    for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-      for (iVertex = 0; iVertex < Xcoord_PhiAngle[iPhiAngle].size(); iVertex++)
-        for (jVertex = 0; jVertex < Xcoord_PhiAngle[iPhiAngle].size() - 1 - iVertex; jVertex++)
-          if (Xcoord_PhiAngle[iPhiAngle][jVertex] > Xcoord_PhiAngle[iPhiAngle][jVertex+1]) {
-            auxXCoord = Xcoord_PhiAngle[iPhiAngle][jVertex]; Xcoord_PhiAngle[iPhiAngle][jVertex] = Xcoord_PhiAngle[iPhiAngle][jVertex+1]; Xcoord_PhiAngle[iPhiAngle][jVertex+1] = auxXCoord;
-            auxYCoord = Ycoord_PhiAngle[iPhiAngle][jVertex]; Ycoord_PhiAngle[iPhiAngle][jVertex] = Ycoord_PhiAngle[iPhiAngle][jVertex+1]; Ycoord_PhiAngle[iPhiAngle][jVertex+1] = auxYCoord;
-            auxZCoord = Zcoord_PhiAngle[iPhiAngle][jVertex]; Zcoord_PhiAngle[iPhiAngle][jVertex] = Zcoord_PhiAngle[iPhiAngle][jVertex+1]; Zcoord_PhiAngle[iPhiAngle][jVertex+1] = auxZCoord;
-            auxPress = Pressure_PhiAngle[iPhiAngle][jVertex]; Pressure_PhiAngle[iPhiAngle][jVertex] = Pressure_PhiAngle[iPhiAngle][jVertex+1]; Pressure_PhiAngle[iPhiAngle][jVertex+1] = auxPress;
-            auxArea = FaceArea_PhiAngle[iPhiAngle][jVertex]; FaceArea_PhiAngle[iPhiAngle][jVertex] = FaceArea_PhiAngle[iPhiAngle][jVertex+1]; FaceArea_PhiAngle[iPhiAngle][jVertex+1] = auxArea;
-            auxPoint = IdPoint_PhiAngle[iPhiAngle][jVertex]; IdPoint_PhiAngle[iPhiAngle][jVertex] = IdPoint_PhiAngle[iPhiAngle][jVertex+1]; IdPoint_PhiAngle[iPhiAngle][jVertex+1] = auxPoint;
-            auxDomain = IdDomain_PhiAngle[iPhiAngle][jVertex]; IdDomain_PhiAngle[iPhiAngle][jVertex] = IdDomain_PhiAngle[iPhiAngle][jVertex+1]; IdDomain_PhiAngle[iPhiAngle][jVertex+1] = auxDomain;
-          }
-    
-    
-    /*--- Check that all the azimuth lists have the same size ---*/
+  /*--- Create a file with the equivalent area distribution at each azimuthal angle ---*/
+  
+  if ((rank == MASTER_NODE) && output) {
     
-    unsigned short nVertex = Xcoord_PhiAngle[0].size();
-    for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++) {
-      unsigned short nVertex_aux = Xcoord_PhiAngle[iPhiAngle].size();
-      if (nVertex_aux != nVertex) cout <<"Be careful!!! one azimuth list is shorter than the other"<< endl;
-      nVertex = min(nVertex, nVertex_aux);
-    }
+    NearFieldEA_file.precision(15);
+    NearFieldEA_file.open("Equivalent_Area.dat", ios::out);
+    NearFieldEA_file << "TITLE = \"Equivalent Area evaluation at each azimuthal angle\"" << "\n";
     
-    /*--- Compute equivalent area distribution at each azimuth angle ---*/
+    if (config->GetSystemMeasurements() == US)
+      NearFieldEA_file << "VARIABLES = \"Height (in) at r="<< R_Plane*12.0 << " in. (cyl. coord. system)\"";
+    else
+      NearFieldEA_file << "VARIABLES = \"Height (m) at r="<< R_Plane << " m. (cylindrical coordinate system)\"";
     
-    for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++) {
-      EquivArea_PhiAngle[iPhiAngle][0] = 0.0;
-      for (iVertex = 1; iVertex < EquivArea_PhiAngle[iPhiAngle].size(); iVertex++) {
-        EquivArea_PhiAngle[iPhiAngle][iVertex] = 0.0;
-        
-        Coord_i = Xcoord_PhiAngle[iPhiAngle][iVertex]*cos(AoA) - Zcoord_PhiAngle[iPhiAngle][iVertex]*sin(AoA);
-        
-        for (jVertex = 0; jVertex < iVertex-1; jVertex++) {
-          
-          Coord_j = Xcoord_PhiAngle[iPhiAngle][jVertex]*cos(AoA) - Zcoord_PhiAngle[iPhiAngle][jVertex]*sin(AoA);
-          jp1Coord = Xcoord_PhiAngle[iPhiAngle][jVertex+1]*cos(AoA) - Zcoord_PhiAngle[iPhiAngle][jVertex+1]*sin(AoA);
-          
-          jFunction = factor*(Pressure_PhiAngle[iPhiAngle][jVertex] - Pressure_Inf)*sqrt(Coord_i-Coord_j);
-          jp1Function = factor*(Pressure_PhiAngle[iPhiAngle][jVertex+1] - Pressure_Inf)*sqrt(Coord_i-jp1Coord);
-          
-          DeltaX = (jp1Coord-Coord_j);
-          MeanFuntion = 0.5*(jp1Function + jFunction);
-          EquivArea_PhiAngle[iPhiAngle][iVertex] += DeltaX * MeanFuntion;
-        }
-      }
+    for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+      if (config->GetSystemMeasurements() == US)
+        NearFieldEA_file << ", \"Equivalent Area (ft<sup>2</sup>), <greek>F</greek>= " << PhiAngleList[iPhiAngle] << " deg.\"";
+      else
+        NearFieldEA_file << ", \"Equivalent Area (m<sup>2</sup>), <greek>F</greek>= " << PhiAngleList[iPhiAngle] << " deg.\"";
     }
     
-    /*--- Create a file with the equivalent area distribution at each azimuthal angle ---*/
-    
-    NearFieldEA_file.precision(15);
-    
-    if (output) {
+    NearFieldEA_file << "\n";
+    for (iVertex = 0; iVertex < Offset_PhiAngle[1]; iVertex++) {
       
-      NearFieldEA_file.open("Equivalent_Area.dat", ios::out);
-      NearFieldEA_file << "TITLE = \"Equivalent Area evaluation at each azimuthal angle\"" << "\n";
+      su2double XcoordRot = XcoordRot_PhiAngle[iVertex];
+      su2double XcoordRot_init = XcoordRot_PhiAngle[0];
       
       if (config->GetSystemMeasurements() == US)
-        NearFieldEA_file << "VARIABLES = \"Height (in) at r="<< R_Plane*12.0 << " in. (cyl. coord. system)\"";
+        NearFieldEA_file << scientific << (XcoordRot - XcoordRot_init) * 12.0;
       else
-        NearFieldEA_file << "VARIABLES = \"Height (m) at r="<< R_Plane << " m. (cylindrical coordinate system)\"";
+        NearFieldEA_file << scientific << (XcoordRot - XcoordRot_init);
       
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++) {
-        if (config->GetSystemMeasurements() == US)
-          NearFieldEA_file << ", \"Equivalent Area (ft<sup>2</sup>), <greek>F</greek>= " << PhiAngleList[iPhiAngle] << " deg.\"";
-        else
-          NearFieldEA_file << ", \"Equivalent Area (m<sup>2</sup>), <greek>F</greek>= " << PhiAngleList[iPhiAngle] << " deg.\"";
+      for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+        NearFieldEA_file << scientific << ", " << EquivArea_PhiAngle[Offset_PhiAngle[iPhiAngle]+iVertex];
       }
       
       NearFieldEA_file << "\n";
-      for (iVertex = 0; iVertex < EquivArea_PhiAngle[0].size(); iVertex++) {
-        
-        su2double XcoordRot = Xcoord_PhiAngle[0][iVertex]*cos(AoA) - Zcoord_PhiAngle[0][iVertex]*sin(AoA);
-        su2double XcoordRot_init = Xcoord_PhiAngle[0][0]*cos(AoA) - Zcoord_PhiAngle[0][0]*sin(AoA);
-        
-        if (config->GetSystemMeasurements() == US)
-          NearFieldEA_file << scientific << (XcoordRot - XcoordRot_init) * 12.0;
-        else
-          NearFieldEA_file << scientific << (XcoordRot - XcoordRot_init);
-        
-        for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++) {
-          NearFieldEA_file << scientific << ", " << EquivArea_PhiAngle[iPhiAngle][iVertex];
-        }
-        
-        NearFieldEA_file << "\n";
-        
-      }
-      NearFieldEA_file.close();
-      
-    }
     
-    /*--- Read target equivalent area from the configuration file,
-     this first implementation requires a complete table (same as the original
-     EA table). so... no interpolation. ---*/
+    }
+    NearFieldEA_file.close();
+  
+  }
+  
+  /*--- Read target equivalent area from the configuration file,
+   this first implementation requires a complete table (same as the original
+   EA table). so... no interpolation. Only the master reads the table. ---*/
+  
+  if (rank == MASTER_NODE) {
     
     vector<vector<su2double> > TargetArea_PhiAngle_Trans;
     TargetEA_file.open("TargetEA.dat", ios::in);
     
-    if (TargetEA_file.fail()) {
-      /*--- Set the table to 0 ---*/
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-        for (iVertex = 0; iVertex < TargetArea_PhiAngle[iPhiAngle].size(); iVertex++)
-          TargetArea_PhiAngle[iPhiAngle][iVertex] = 0.0;
-    }
-    else {
+    if (!TargetEA_file.fail()) {
       
       /*--- skip header lines ---*/
       
@@ -10011,144 +10059,129 @@ void COutput::SpecialOutput_SonicBoom(CSolver *solver, CGeometry *geometry, CCon
           
           if (iter != 0) row.push_back(data);
           iter++;
-          
+        
         }
         TargetArea_PhiAngle_Trans.push_back(row);
       }
       
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-        for (iVertex = 0; iVertex < EquivArea_PhiAngle[iPhiAngle].size(); iVertex++)
-          TargetArea_PhiAngle[iPhiAngle][iVertex] = TargetArea_PhiAngle_Trans[iVertex][iPhiAngle];
-      
+      for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+        for (iVertex = 0; iVertex < Offset_PhiAngle[iPhiAngle+1] - Offset_PhiAngle[iPhiAngle]; iVertex++)
+          TargetArea_PhiAngle[Offset_PhiAngle[iPhiAngle]+iVertex] = TargetArea_PhiAngle_Trans[iVertex][iPhiAngle];
+    
     }
+  }
+
+#ifdef HAVE_MPI
+  SU2_MPI::Bcast(&TargetArea_PhiAngle[0], nVertex_NearField, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Divide by the number of Phi angles in the nearfield ---*/
+  
+  su2double PhiFactor = 1.0/su2double(nPhiAngle);
+  
+  /*--- Evaluate the objective function, the data is replicated so every rank
+   obtains the same value without a broadcast. The difference at each station
+   is stored since it is reused by the weight of the nearfield pressure. ---*/
+  
+  vector<su2double> Difference_PhiAngle(nVertex_NearField, 0.0);
+  
+  InverseDesign = 0;
+  for (iItem = 0; iItem < nVertex_NearField; iItem++) {
+    Coord_i = Xcoord_PhiAngle[iItem];
     
-    /*--- Divide by the number of Phi angles in the nearfield ---*/
+    su2double Difference = EquivArea_PhiAngle[iItem]-TargetArea_PhiAngle[iItem];
+    su2double percentage = fabs(Difference)*100/fabs(TargetArea_PhiAngle[iItem]);
     
-    su2double PhiFactor = 1.0/su2double(PhiAngleList.size());
+    if ((percentage < 0.1) || (Coord_i < XCoordBegin_OF) || (Coord_i > XCoordEnd_OF)) Difference = 0.0;
     
-    /*--- Evaluate the objective function ---*/
-    
-    InverseDesign = 0;
-    for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-      for (iVertex = 0; iVertex < EquivArea_PhiAngle[iPhiAngle].size(); iVertex++) {
-        Weight_PhiAngle[iPhiAngle][iVertex] = 1.0;
-        Coord_i = Xcoord_PhiAngle[iPhiAngle][iVertex];
-        
-        su2double Difference = EquivArea_PhiAngle[iPhiAngle][iVertex]-TargetArea_PhiAngle[iPhiAngle][iVertex];
-        su2double percentage = fabs(Difference)*100/fabs(TargetArea_PhiAngle[iPhiAngle][iVertex]);
-        
-        if ((percentage < 0.1) || (Coord_i < XCoordBegin_OF) || (Coord_i > XCoordEnd_OF)) Difference = 0.0;
-        
-        InverseDesign += EAScaleFactor*PhiFactor*Weight_PhiAngle[iPhiAngle][iVertex]*Difference*Difference;
+    Difference_PhiAngle[iItem] = Difference;
+    InverseDesign += EAScaleFactor*PhiFactor*Difference*Difference;
+  }
+  
+  /*--- Evaluate the weight of the nearfield pressure (adjoint input), only
+   the master writes it so the partial sums are reduced onto that rank.
+   It is only needed when the files are written. ---*/
+  
+  if (output) {
+    for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+      unsigned long Offset = Offset_PhiAngle[iPhiAngle];
+      unsigned long nVertex_PhiAngle = Offset_PhiAngle[iPhiAngle+1] - Offset;
+      for (iVertex = 0; iVertex < nVertex_PhiAngle; iVertex++) {
+        if (int((Offset + iVertex) % nProcessor) != rank) continue;
         
-      }
-    
-    /*--- Evaluate the weight of the nearfield pressure (adjoint input) ---*/
-    
-    for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-      for (iVertex = 0; iVertex < EquivArea_PhiAngle[iPhiAngle].size(); iVertex++) {
-        Coord_i = Xcoord_PhiAngle[iPhiAngle][iVertex];
-        NearFieldWeight_PhiAngle[iPhiAngle][iVertex] = 0.0;
-        for (jVertex = iVertex; jVertex < EquivArea_PhiAngle[iPhiAngle].size(); jVertex++) {
-          Coord_j = Xcoord_PhiAngle[iPhiAngle][jVertex];
-          Weight_PhiAngle[iPhiAngle][iVertex] = 1.0;
-          
-          su2double Difference = EquivArea_PhiAngle[iPhiAngle][jVertex]-TargetArea_PhiAngle[iPhiAngle][jVertex];
-          su2double percentage = fabs(Difference)*100/fabs(TargetArea_PhiAngle[iPhiAngle][jVertex]);
-          
-          if ((percentage < 0.1) || (Coord_j < XCoordBegin_OF) || (Coord_j > XCoordEnd_OF)) Difference = 0.0;
-          
-          NearFieldWeight_PhiAngle[iPhiAngle][iVertex] += EAScaleFactor*PhiFactor*Weight_PhiAngle[iPhiAngle][iVertex]*2.0*Difference*factor*sqrt(Coord_j-Coord_i);
+        Coord_i = Xcoord_PhiAngle[Offset+iVertex];
+        for (jVertex = iVertex; jVertex < nVertex_PhiAngle; jVertex++) {
+          Coord_j = Xcoord_PhiAngle[Offset+jVertex];
+          NearFieldWeight_PhiAngle[Offset+iVertex] += EAScaleFactor*PhiFactor*2.0*Difference_PhiAngle[Offset+jVertex]*factor*sqrt(Coord_j-Coord_i);
         }
       }
+    }
+  }
+
+#ifdef HAVE_MPI
+  if (output) {
+    vector<su2double> NearFieldWeight_Local(NearFieldWeight_PhiAngle);
+    SU2_MPI::Reduce(&NearFieldWeight_Local[0], &NearFieldWeight_PhiAngle[0], nVertex_NearField, MPI_SU2DOUBLE, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+  }
+#endif
+  
+  if ((rank == MASTER_NODE) && output) {
     
     /*--- Write the Nearfield pressure at each Azimuthal PhiAngle ---*/
     
     EquivArea_file.precision(15);
+    EquivArea_file.open("nearfield_flow.dat", ios::out);
+    EquivArea_file << "TITLE = \"Equivalent Area evaluation at each azimuthal angle\"" << "\n";
     
-    if (output) {
-      
-      EquivArea_file.open("nearfield_flow.dat", ios::out);
-      EquivArea_file << "TITLE = \"Equivalent Area evaluation at each azimuthal angle\"" << "\n";
-      
-      if (config->GetSystemMeasurements() == US)
-        EquivArea_file << "VARIABLES = \"Height (in) at r="<< R_Plane*12.0 << " in. (cyl. coord. system)\",\"Equivalent Area (ft<sup>2</sup>)\",\"Target Equivalent Area (ft<sup>2</sup>)\",\"Cp\"" << "\n";
-      else
-        EquivArea_file << "VARIABLES = \"Height (m) at r="<< R_Plane << " m. (cylindrical coordinate system)\",\"Equivalent Area (m<sup>2</sup>)\",\"Target Equivalent Area (m<sup>2</sup>)\",\"Cp\"" << "\n";
-      
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++) {
-        EquivArea_file << fixed << "ZONE T= \"<greek>F</greek>=" << PhiAngleList[iPhiAngle] << " deg.\"" << "\n";
-        for (iVertex = 0; iVertex < Xcoord_PhiAngle[iPhiAngle].size(); iVertex++) {
-          
-          su2double XcoordRot = Xcoord_PhiAngle[0][iVertex]*cos(AoA) - Zcoord_PhiAngle[0][iVertex]*sin(AoA);
-          su2double XcoordRot_init = Xcoord_PhiAngle[0][0]*cos(AoA) - Zcoord_PhiAngle[0][0]*sin(AoA);
-          
-          if (config->GetSystemMeasurements() == US)
-            EquivArea_file << scientific << (XcoordRot - XcoordRot_init) * 12.0;
-          else
-            EquivArea_file << scientific << (XcoordRot - XcoordRot_init);
-          
-          EquivArea_file << scientific << ", " << EquivArea_PhiAngle[iPhiAngle][iVertex]
-          << ", " << TargetArea_PhiAngle[iPhiAngle][iVertex] << ", " << (Pressure_PhiAngle[iPhiAngle][iVertex]-Pressure_Inf)/Pressure_Inf << "\n";
-        }
+    if (config->GetSystemMeasurements() == US)
+      EquivArea_file << "VARIABLES = \"Height (in) at r="<< R_Plane*12.0 << " in. (cyl. coord. system)\",\"Equivalent Area (ft<sup>2</sup>)\",\"Target Equivalent Area (ft<sup>2</sup>)\",\"Cp\"" << "\n";
+    else
+      EquivArea_file << "VARIABLES = \"Height (m) at r="<< R_Plane << " m. (cylindrical coordinate system)\",\"Equivalent Area (m<sup>2</sup>)\",\"Target Equivalent Area (m<sup>2</sup>)\",\"Cp\"" << "\n";
+    
+    for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++) {
+      EquivArea_file << fixed << "ZONE T= \"<greek>F</greek>=" << PhiAngleList[iPhiAngle] << " deg.\"" << "\n";
+      for (iVertex = 0; iVertex < Offset_PhiAngle[iPhiAngle+1] - Offset_PhiAngle[iPhiAngle]; iVertex++) {
+        
+        iItem = Offset_PhiAngle[iPhiAngle] + iVertex;
+        su2double XcoordRot = XcoordRot_PhiAngle[iVertex];
+        su2double XcoordRot_init = XcoordRot_PhiAngle[0];
+        
+        if (config->GetSystemMeasurements() == US)
+          EquivArea_file << scientific << (XcoordRot - XcoordRot_init) * 12.0;
+        else
+          EquivArea_file << scientific << (XcoordRot - XcoordRot_init);
+        
+        EquivArea_file << scientific << ", " << EquivArea_PhiAngle[iItem]
+        << ", " << TargetArea_PhiAngle[iItem] << ", " << (Pressure_PhiAngle[iItem]-Pressure_Inf)/Pressure_Inf << "\n";
       }
-      
-      EquivArea_file.close();
-      
     }
     
+    EquivArea_file.close();
+    
     /*--- Write Weight file for adjoint computation ---*/
     
     FuncGrad_file.precision(15);
+    FuncGrad_file.open("WeightNF.dat", ios::out);
     
-    if (output) {
-      
-      FuncGrad_file.open("WeightNF.dat", ios::out);
-      
-      FuncGrad_file << scientific << "-1.0";
-      for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-        FuncGrad_file << scientific << "\t" << PhiAngleList[iPhiAngle];
+    FuncGrad_file << scientific << "-1.0";
+    for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+      FuncGrad_file << scientific << "\t" << PhiAngleList[iPhiAngle];
+    FuncGrad_file << "\n";
+    
+    for (iVertex = 0; iVertex < Offset_PhiAngle[1]; iVertex++) {
+      FuncGrad_file << scientific << XcoordRot_PhiAngle[iVertex];
+      for (iPhiAngle = 0; iPhiAngle < nPhiAngle; iPhiAngle++)
+        FuncGrad_file << scientific << "\t" << NearFieldWeight_PhiAngle[Offset_PhiAngle[iPhiAngle]+iVertex];
       FuncGrad_file << "\n";
-      
-      for (iVertex = 0; iVertex < NearFieldWeight_PhiAngle[0].size(); iVertex++) {
-        su2double XcoordRot = Xcoord_PhiAngle[0][iVertex]*cos(AoA) - Zcoord_PhiAngle[0][iVertex]*sin(AoA);
-        FuncGrad_file << scientific << XcoordRot;
-        for (iPhiAngle = 0; iPhiAngle < PhiAngleList.size(); iPhiAngle++)
-          FuncGrad_file << scientific << "\t" << NearFieldWeight_PhiAngle[iPhiAngle][iVertex];
-        FuncGrad_file << "\n";
-      }
-      FuncGrad_file.close();
-      
     }
-    
-    /*--- Delete structures ---*/
-    
-    delete [] Xcoord; delete [] Ycoord; delete [] Zcoord;
-    delete [] AzimuthalAngle; delete [] IdPoint; delete [] IdDomain;
-    delete [] Pressure; delete [] FaceArea;
-    delete [] EquivArea; delete [] TargetArea;
-    delete [] NearFieldWeight; delete [] Weight;
-    
-  }
-  
-#ifndef HAVE_MPI
-  
-  /*--- Store the value of the NearField coefficient ---*/
+    FuncGrad_file.close();
   
-  solver->SetTotal_CEquivArea(InverseDesign);
-  
-#else
-  
-  /*--- Send the value of the NearField coefficient to all the processors ---*/
-  
-  SU2_MPI::Bcast(&InverseDesign, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  }
   
   /*--- Store the value of the NearField coefficient ---*/
   
   solver->SetTotal_CEquivArea(InverseDesign);
-  
-#endif
-  
+
 }
 
 void COutput::SpecialOutput_Distortion(CSolver *solver, CGeometry *geometry, CConfig *config, bool output) {
@@ -10389,19 +10422,19 @@ void COutput::SpecialOutput_Distortion(CSolver *solver, CGeometry *geometry, CCo
     
 #ifdef HAVE_MPI
     
-    SU2_MPI::Gather(Buffer_Send_Coord_x, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_x, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Coord_y, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_y, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Coord_z, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_PT, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_PT, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_TT, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_TT, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_P, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_P, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_T, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_T, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Mach, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Mach, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Vel_x, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Vel_x, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Vel_y, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Vel_y, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Vel_z, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Vel_z, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_q, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_q, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_Area, MaxLocalVertex_Surface, MPI_DOUBLE, Buffer_Recv_Area, MaxLocalVertex_Surface, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Coord_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Coord_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Coord_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Coord_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_PT, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_PT, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_TT, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_TT, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_P, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_P, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_T, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_T, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Mach, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Mach, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Vel_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Vel_x, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Vel_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Vel_y, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    if (nDim == 3) SU2_MPI::Gather(Buffer_Send_Vel_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Vel_z, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_q, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_q, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Area, MaxLocalVertex_Surface, MPI_SU2DOUBLE, Buffer_Recv_Area, MaxLocalVertex_Surface, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     
 #else
     
@@ -12276,6 +12309,179 @@ void COutput::SetSpecial_Output(CSolver *****solver_container,
 
 }
 
+void COutput::SetSurface_History(CSolver *****solver_container,
+                                 CGeometry ****geometry,
+                                 CConfig **config,
+                                 unsigned long iExtIter,
+                                 unsigned short val_nZone) {
+
+  unsigned short iZone, iMarker, iDim;
+  unsigned long iPoint, iVertex, iLocal;
+  int iRank;
+
+  if (SrfHist_Init.size() < val_nZone) {
+    SrfHist_Init.resize(val_nZone, false);
+    SrfHist_Point.resize(val_nZone);
+    SrfHist_nGlobal.resize(val_nZone, 0);
+    SrfHist_Offset.resize(val_nZone, 0);
+    SrfHist_nRecord.resize(val_nZone, 0);
+  }
+
+  for (iZone = 0; iZone < val_nZone; iZone++) {
+
+    /*--- The surface history is a stream of its own, independent of the
+     solution files, written every WRT_SRF_HIST_FREQ time steps. ---*/
+
+    unsigned long Freq = config[iZone]->GetWrt_Srf_Hist_Freq();
+    if ((Freq == 0) || (config[iZone]->GetUnsteady_Simulation() == STEADY) ||
+        (config[iZone]->GetUnsteady_Simulation() == HARMONIC_BALANCE)) continue;
+    if (config[iZone]->GetContinuous_Adjoint() || config[iZone]->GetDiscrete_Adjoint()) continue;
+    if (iExtIter % Freq != 0) continue;
+
+    CGeometry *geo = geometry[iZone][INST_0][MESH_0];
+    CSolver *solver = solver_container[iZone][INST_0][MESH_0][FLOW_SOL];
+    if (solver == NULL) continue;
+
+    unsigned short nDim = geo->GetnDim();
+
+    string filename = config[iZone]->GetMultizone_HistoryFileName("surface_history", iZone) + ".bin";
+
+    /*--- The points of the plotting markers owned by this rank are collected
+     once. A record holds the points of all ranks one rank after the other, such
+     that no sorting of the data across ranks is needed for any write. ---*/
+
+    if (!SrfHist_Init[iZone]) {
+
+      vector<bool> onSurface(geo->GetnPoint(), false);
+      for (iMarker = 0; iMarker < config[iZone]->GetnMarker_All(); iMarker++) {
+        if (config[iZone]->GetMarker_All_Plotting(iMarker) != YES) continue;
+        for (iVertex = 0; iVertex < geo->GetnVertex(iMarker); iVertex++) {
+          iPoint = geo->vertex[iMarker][iVertex]->GetNode();
+          if (geo->node[iPoint]->GetDomain() && !onSurface[iPoint]) {
+            onSurface[iPoint] = true;
+            SrfHist_Point[iZone].push_back(iPoint);
+          }
+        }
+      }
+
+      unsigned long nLocal = SrfHist_Point[iZone].size();
+      vector<unsigned long> nLocal_All(size);
+#ifdef HAVE_MPI
+      SU2_MPI::Allgather(&nLocal, 1, MPI_UNSIGNED_LONG, nLocal_All.data(), 1, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+      nLocal_All[0] = nLocal;
+#endif
+      SrfHist_nGlobal[iZone] = 0;
+      SrfHist_Offset[iZone] = 0;
+      for (iRank = 0; iRank < size; iRank++) {
+        if (iRank < rank) SrfHist_Offset[iZone] += nLocal_All[iRank];
+        SrfHist_nGlobal[iZone] += nLocal_All[iRank];
+      }
+
+    }
+
+    const unsigned long nLocal  = SrfHist_Point[iZone].size();
+    const unsigned long nGlobal = SrfHist_nGlobal[iZone];
+
+    /*--- Layout of the file (doubles in native byte order): the number of points
+     and of dimensions, the global index of every point, the coordinates (one
+     block per dimension) and then one record per write with the physical time
+     followed by the pressure of every point. ---*/
+
+    const unsigned long HeaderSize = (2 + nGlobal*(1+nDim))*sizeof(double);
+    const unsigned long RecordSize = (1 + nGlobal)*sizeof(double);
+    const unsigned long RecordPos  = HeaderSize + SrfHist_nRecord[iZone]*RecordSize;
+
+    double Time = SU2_TYPE::GetValue(config[iZone]->GetCurrent_UnstTime());
+    vector<double> buf(nLocal);
+    for (iLocal = 0; iLocal < nLocal; iLocal++)
+      buf[iLocal] = SU2_TYPE::GetValue(solver->node[SrfHist_Point[iZone][iLocal]]->GetPressure());
+
+#ifdef HAVE_MPI
+
+    const unsigned long Offset = SrfHist_Offset[iZone];
+
+    MPI_File fhw;
+    char fname[MAX_STRING_SIZE];
+    strcpy(fname, filename.c_str());
+
+    if (!SrfHist_Init[iZone]) {
+      if (rank == MASTER_NODE) MPI_File_delete(fname, MPI_INFO_NULL);
+      SU2_MPI::Barrier(MPI_COMM_WORLD);
+    }
+
+    int ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_CREATE|MPI_MODE_WRONLY,
+                             MPI_INFO_NULL, &fhw);
+    if (ierr != MPI_SUCCESS) {
+      SU2_MPI::Error(string("Unable to open surface history file ") + filename, CURRENT_FUNCTION);
+    }
+
+    if (!SrfHist_Init[iZone]) {
+
+      double header[2] = {double(nGlobal), double(nDim)};
+      if (rank == MASTER_NODE)
+        MPI_File_write_at(fhw, 0, header, 2, MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+      vector<double> geo_buf(nLocal);
+      for (iLocal = 0; iLocal < nLocal; iLocal++)
+        geo_buf[iLocal] = double(geo->node[SrfHist_Point[iZone][iLocal]]->GetGlobalIndex());
+      MPI_File_write_at_all(fhw, (2 + Offset)*sizeof(double), geo_buf.data(), nLocal,
+                            MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        for (iLocal = 0; iLocal < nLocal; iLocal++)
+          geo_buf[iLocal] = SU2_TYPE::GetValue(geo->node[SrfHist_Point[iZone][iLocal]]->GetCoord(iDim));
+        MPI_File_write_at_all(fhw, (2 + (1+iDim)*nGlobal + Offset)*sizeof(double), geo_buf.data(), nLocal,
+                              MPI_DOUBLE, MPI_STATUS_IGNORE);
+      }
+    }
+
+    if (rank == MASTER_NODE)
+      MPI_File_write_at(fhw, RecordPos, &Time, 1, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    MPI_File_write_at_all(fhw, RecordPos + (1 + Offset)*sizeof(double), buf.data(), nLocal,
+                          MPI_DOUBLE, MPI_STATUS_IGNORE);
+
+    MPI_File_close(&fhw);
+
+#else
+
+    FILE* fhw = fopen(filename.c_str(), SrfHist_Init[iZone] ? "r+b" : "wb");
+    if (!fhw) {
+      SU2_MPI::Error(string("Unable to open surface history file ") + filename, CURRENT_FUNCTION);
+    }
+
+    if (!SrfHist_Init[iZone]) {
+
+      double header[2] = {double(nGlobal), double(nDim)};
+      fwrite(header, sizeof(double), 2, fhw);
+
+      vector<double> geo_buf(nLocal);
+      for (iLocal = 0; iLocal < nLocal; iLocal++)
+        geo_buf[iLocal] = double(geo->node[SrfHist_Point[iZone][iLocal]]->GetGlobalIndex());
+      fwrite(geo_buf.data(), sizeof(double), nLocal, fhw);
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        for (iLocal = 0; iLocal < nLocal; iLocal++)
+          geo_buf[iLocal] = SU2_TYPE::GetValue(geo->node[SrfHist_Point[iZone][iLocal]]->GetCoord(iDim));
+        fwrite(geo_buf.data(), sizeof(double), nLocal, fhw);
+      }
+    }
+
+    fseek(fhw, RecordPos, SEEK_SET);
+    fwrite(&Time, sizeof(double), 1, fhw);
+    fwrite(buf.data(), sizeof(double), nLocal, fhw);
+
+    fclose(fhw);
+
+#endif
+
+    SrfHist_Init[iZone] = true;
+    SrfHist_nRecord[iZone]++;
+
+  }
+
+}
+
 void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
                                        CGeometry ****geometry,
                                        CConfig **config,
@@ -12287,6 +12493,11 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
   unsigned short nInst = 1;
   bool compressible = true;
 
+  /*--- The restart files of the previous output may still be written in the
+   background, they are completed before they are written again. ---*/
+
+  Wait_Async_Restart();
+
   for (iZone = 0; iZone < val_nZone; iZone++) {
 
     /*--- Bool to distinguish between the FVM and FEM solvers. ---*/
@@ -12318,16 +12529,22 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
 #ifdef HAVE_MPI
       /*--- Do not merge the connectivity or write the visualization files
-     if we are running in parallel, unless we are using ParaView binary.
+     if we are running in parallel, unless we are using ParaView binary or XDMF.
        Force the use of SU2_SOL to merge and write the viz. files in this
        case to save overhead. ---*/
 
-      if ((size > SINGLE_NODE) && (FileFormat != PARAVIEW_BINARY)) {
+      if ((size > SINGLE_NODE) && (FileFormat != PARAVIEW_BINARY) && (FileFormat != XDMF) &&
+          (FileFormat != INSITU)) {
         Wrt_Vol = false;
         Wrt_Srf = false;
       }
 #endif
 
+      /*--- The in-situ adaptor only receives the volume data, the sorting
+       of the surface data is skipped. ---*/
+
+      if (FileFormat == INSITU) Wrt_Srf = false;
+
     /*--- Check for compressible/incompressible flow problems. ---*/
 
     compressible = (config[iZone]->GetKind_Regime() == COMPRESSIBLE);
@@ -12448,7 +12665,10 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
     
     /*--- Write either a binary or ASCII restart file in parallel. ---*/
 
-    if (config[iZone]->GetWrt_Binary_Restart()) {
+    if (config[iZone]->GetWrt_Compact_Restart()) {
+      if (rank == MASTER_NODE) cout << "Writing compact binary SU2 native restart file." << endl;
+      WriteRestart_Parallel_Compact(config[iZone], geometry[iZone][iInst][MESH_0], solver_container[iZone][iInst][MESH_0], iZone, iInst);
+    } else if (config[iZone]->GetWrt_Binary_Restart()) {
       if (rank == MASTER_NODE) cout << "Writing binary SU2 native restart file." << endl;
       WriteRestart_Parallel_Binary(config[iZone], geometry[iZone][iInst][MESH_0], solver_container[iZone][iInst][MESH_0], iZone, iInst);
     } else {
@@ -12515,12 +12735,10 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
           case TECPLOT_BINARY:
 
-            /*--- Write a Tecplot ASCII file instead for now in serial. ---*/
+            /*--- Write a Tecplot SZL binary file, each rank writes its own partition ---*/
 
-            if (rank == MASTER_NODE) cout << "Tecplot binary volume files not available in serial with SU2_CFD." << endl;
-            if (rank == MASTER_NODE) cout << "  Run SU2_SOL to generate Tecplot binary." << endl;
-            if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII file volume solution file instead." << endl;
-            WriteTecplotASCII_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
+            if (rank == MASTER_NODE) cout << "Writing Tecplot binary (.szplt) volume solution file." << endl;
+            WriteTecplotBinary_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
                 solver_container[iZone][iInst][MESH_0], iZone, val_nZone, iInst, nInst, false);
             break;
 
@@ -12550,6 +12768,23 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
                                         solver_container[iZone][iInst][MESH_0], iZone, val_nZone, false);
             break;
 
+          case XDMF:
+
+            /*--- Write an XDMF file, the binary data is written collectively by all ranks ---*/
+
+            if (rank == MASTER_NODE) cout << "Writing XDMF volume solution file." << endl;
+            WriteXDMF_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
+                               solver_container[iZone][iInst][MESH_0], iZone, val_nZone, false);
+            break;
+
+          case INSITU:
+
+            /*--- Hand the volume data to the in-situ adaptor, no file is written ---*/
+
+            if (rank == MASTER_NODE) cout << "Passing the volume solution to the in-situ adaptor." << endl;
+            WriteInSitu_Parallel(config[iZone], geometry[iZone][iInst][MESH_0], iExtIter, iZone);
+            break;
+
           default:
             break;
           }
@@ -12571,12 +12806,10 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
           case TECPLOT_BINARY:
 
-            /*--- Write a Tecplot ASCII file instead for now in serial. ---*/
+            /*--- Write a Tecplot SZL binary file, each rank writes its own partition ---*/
 
-            if (rank == MASTER_NODE) cout << "Tecplot binary surface files not available in serial with SU2_CFD." << endl;
-            if (rank == MASTER_NODE) cout << "  Run SU2_SOL to generate Tecplot binary." << endl;
-            if (rank == MASTER_NODE) cout << "Writing Tecplot ASCII file surface solution file instead." << endl;
-            WriteTecplotASCII_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
+            if (rank == MASTER_NODE) cout << "Writing Tecplot binary (.szplt) surface solution file." << endl;
+            WriteTecplotBinary_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
                 solver_container[iZone][iInst][MESH_0], iZone, val_nZone, iInst, nInst, true);
             break;
 
@@ -12597,6 +12830,15 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
             WriteParaViewBinary_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
                                          solver_container[iZone][iInst][MESH_0], iZone, val_nZone, true);
             break;
+
+          case XDMF:
+
+            /*--- Write an XDMF file, the binary data is written collectively by all ranks ---*/
+
+            if (rank == MASTER_NODE) cout << "Writing XDMF surface solution file." << endl;
+            WriteXDMF_Parallel(config[iZone], geometry[iZone][iInst][MESH_0],
+                               solver_container[iZone][iInst][MESH_0], iZone, val_nZone, true);
+            break;
             
 
           default:
@@ -12605,9 +12847,9 @@ void COutput::SetResult_Files_Parallel(CSolver *****solver_container,
 
         }
 
-        /*--- Clean up the connectivity data that was allocated for output. ---*/
+        /*--- Clean up the surface connectivity that was renumbered for output. The
+         volume connectivity is kept for the next output (see SortConnectivity). ---*/
 
-        DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][iInst][MESH_0], false);
         if (Wrt_Srf) DeallocateConnectivity_Parallel(config[iZone], geometry[iZone][iInst][MESH_0], true);
 
         /*--- Clean up the surface data that was only needed for output. ---*/
@@ -12648,6 +12890,28 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
   bool transition           = (config->GetKind_Trans_Model() == BC);
   bool grid_movement        = (config->GetGrid_Movement());
   bool Wrt_Halo             = config->GetWrt_Halo(), isPeriodic;
+  bool viscous              = ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS));
+  bool buffet               = (config->GetBuffet_Monitoring() || config->GetKind_ObjFunc() == BUFFET_SENSOR);
+  bool paraview             = ((config->GetOutput_FileFormat() == PARAVIEW) ||
+                               (config->GetOutput_FileFormat() == PARAVIEW_BINARY));
+  
+  /*--- Derived fields are only computed and stored when they are selected
+   with VOLUME_OUTPUT_FIELDS (all of them by default). ---*/
+  
+  bool wrt_pressure   = config->GetVolume_Output_Field("PRESSURE");
+  bool wrt_temperature = config->GetVolume_Output_Field("TEMPERATURE");
+  bool wrt_mach       = config->GetVolume_Output_Field("MACH");
+  bool wrt_press_coef = config->GetVolume_Output_Field("PRESSURE_COEFF");
+  bool wrt_lam_visc   = viscous && config->GetVolume_Output_Field("LAMINAR_VISCOSITY");
+  bool wrt_skin_frict = viscous && config->GetVolume_Output_Field("SKIN_FRICTION");
+  bool wrt_heat_flux  = viscous && config->GetVolume_Output_Field("HEAT_FLUX");
+  bool wrt_buffet     = viscous && buffet && !paraview && config->GetVolume_Output_Field("BUFFET");
+  bool wrt_yplus      = (Kind_Solver == RANS) && config->GetVolume_Output_Field("Y_PLUS");
+  bool wrt_eddy_visc  = (Kind_Solver == RANS) && config->GetVolume_Output_Field("EDDY_VISCOSITY");
+  bool wrt_gamma_bc   = transition && config->GetVolume_Output_Field("INTERMITTENCY");
+  bool wrt_des        = (config->GetKind_HybridRANSLES() != NO_HYBRIDRANSLES) && config->GetVolume_Output_Field("DES_LENGTHSCALE");
+  bool wrt_roe_diss   = (config->GetKind_RoeLowDiss() != NO_ROELOWDISS) && config->GetVolume_Output_Field("ROE_DISSIPATION");
+  bool wrt_surface    = (wrt_skin_frict || wrt_heat_flux || wrt_buffet || wrt_yplus);
   
   int *Local_Halo = NULL;
   
@@ -12785,64 +13049,71 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
     
     /*--- Add Pressure, Temperature, Cp, Mach. ---*/
     
-    nVar_Par += 1;
-    Variable_Names.push_back("Pressure");
+    if (wrt_pressure) {
+      nVar_Par += 1;
+      Variable_Names.push_back("Pressure");
+    }
     
-    nVar_Par += 2;
-    Variable_Names.push_back("Temperature");
-    Variable_Names.push_back("Mach");
+    if (wrt_temperature) {
+      nVar_Par += 1;
+      Variable_Names.push_back("Temperature");
+    }
     
-    nVar_Par += 1;
-    if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-        (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-      Variable_Names.push_back("Pressure_Coefficient");
-    } else {
-      Variable_Names.push_back("C<sub>p</sub>");
+    if (wrt_mach) {
+      nVar_Par += 1;
+      Variable_Names.push_back("Mach");
+    }
+    
+    if (wrt_press_coef) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Pressure_Coefficient");
+      else Variable_Names.push_back("C<sub>p</sub>");
     }
     
     /*--- Add Laminar Viscosity, Skin Friction, Heat Flux, & yPlus to the restart file ---*/
     
-    if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        nVar_Par += 1; Variable_Names.push_back("Laminar_Viscosity");
-        nVar_Par += 2;
+    if (wrt_lam_visc) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Laminar_Viscosity");
+      else Variable_Names.push_back("<greek>m</greek>");
+    }
+    
+    if (wrt_skin_frict) {
+      nVar_Par += nDim;
+      if (paraview) {
         Variable_Names.push_back("Skin_Friction_Coefficient_x");
         Variable_Names.push_back("Skin_Friction_Coefficient_y");
-        if (geometry->GetnDim() == 3) {
-          nVar_Par += 1; Variable_Names.push_back("Skin_Friction_Coefficient_z");
-        }
-        nVar_Par += 1;
-        Variable_Names.push_back("Heat_Flux");
+        if (nDim == 3) Variable_Names.push_back("Skin_Friction_Coefficient_z");
       } else {
-        nVar_Par += 1; Variable_Names.push_back("<greek>m</greek>");
-        nVar_Par += 2;
         Variable_Names.push_back("C<sub>f</sub>_x");
         Variable_Names.push_back("C<sub>f</sub>_y");
-        if (geometry->GetnDim() == 3) {
-          nVar_Par += 1; Variable_Names.push_back("C<sub>f</sub>_z");
-        }
-        if (config->GetBuffet_Monitoring() || config->GetKind_ObjFunc() == BUFFET_SENSOR){
-          Variable_Names.push_back("Buffet_Sensor");
-          nVar_Par += 1;
-        }
-        nVar_Par += 1;
-        Variable_Names.push_back("h");
+        if (nDim == 3) Variable_Names.push_back("C<sub>f</sub>_z");
       }
     }
     
+    if (wrt_buffet) {
+      nVar_Par += 1;
+      Variable_Names.push_back("Buffet_Sensor");
+    }
+    
+    if (wrt_heat_flux) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Heat_Flux");
+      else Variable_Names.push_back("h");
+    }
+    
     /*--- Add Eddy Viscosity. ---*/
     
-    if (Kind_Solver == RANS) {
-      nVar_Par += 2;
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        Variable_Names.push_back("Y_Plus");
-        Variable_Names.push_back("Eddy_Viscosity");
-      } else {
-        Variable_Names.push_back("y<sup>+</sup>");
-        Variable_Names.push_back("<greek>m</greek><sub>t</sub>");
-      }
+    if (wrt_yplus) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Y_Plus");
+      else Variable_Names.push_back("y<sup>+</sup>");
+    }
+    
+    if (wrt_eddy_visc) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Eddy_Viscosity");
+      else Variable_Names.push_back("<greek>m</greek><sub>t</sub>");
     }
     
     /*--- Add the distance to the nearest sharp edge if requested. ---*/
@@ -12854,35 +13125,51 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
     
     /*--- Add the intermittency for the BC trans. model. ---*/
     
-    if (transition) {
+    if (wrt_gamma_bc) {
       nVar_Par += 1;
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        Variable_Names.push_back("gamma_BC");
-      } else {
-        Variable_Names.push_back("<greek>g</greek><sub>BC</sub>");
-      }
+      if (paraview) Variable_Names.push_back("gamma_BC");
+      else Variable_Names.push_back("<greek>g</greek><sub>BC</sub>");
     }
     
-    if (config->GetKind_HybridRANSLES()!=NO_HYBRIDRANSLES){
+    if (wrt_des) {
       nVar_Par +=1;
       Variable_Names.push_back("DES_LengthScale");
       nVar_Par +=1;
       Variable_Names.push_back("Wall_Distance");
     }
     
-    if (config->GetKind_RoeLowDiss() != NO_ROELOWDISS){
+    if (wrt_roe_diss) {
       nVar_Par +=1;
       Variable_Names.push_back("Roe_Dissipation");
     }
     
+    /*--- Add the running time averages, the pressure RMS and the Reynolds stresses. ---*/
+    
+    if (config->GetWrt_Time_Average()) {
+      nVar_Par += nDim+3 + (nDim*(nDim+1))/2;
+      Variable_Names.push_back("Mean_Density");
+      Variable_Names.push_back("Mean_Velocity_x");
+      Variable_Names.push_back("Mean_Velocity_y");
+      if (nDim == 3) Variable_Names.push_back("Mean_Velocity_z");
+      Variable_Names.push_back("Mean_Pressure");
+      Variable_Names.push_back("RMS_Pressure");
+      Variable_Names.push_back("Reynolds_Stress_xx");
+      Variable_Names.push_back("Reynolds_Stress_xy");
+      if (nDim == 3) Variable_Names.push_back("Reynolds_Stress_xz");
+      Variable_Names.push_back("Reynolds_Stress_yy");
+      if (nDim == 3) {
+        Variable_Names.push_back("Reynolds_Stress_yz");
+        Variable_Names.push_back("Reynolds_Stress_zz");
+      }
+    }
+    
     /*--- New variables get registered here before the end of the loop. ---*/
     
   }
   
   /*--- Auxiliary vectors for variables defined on surfaces only. ---*/
   
-  if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+  if (wrt_surface && !config->GetLow_MemoryOutput()) {
     Aux_Frict_x = new su2double[geometry->GetnPoint()];
     Aux_Frict_y = new su2double[geometry->GetnPoint()];
     Aux_Frict_z = new su2double[geometry->GetnPoint()];
@@ -12912,7 +13199,7 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
           if (geometry->GetnDim() == 3) Aux_Frict_z[iPoint] = solver[FLOW_SOL]->GetCSkinFriction(iMarker, iVertex, 2);
           Aux_Heat[iPoint] = solver[FLOW_SOL]->GetHeatFlux(iMarker, iVertex);
           Aux_yPlus[iPoint] = solver[FLOW_SOL]->GetYPlus(iMarker, iVertex);
-          if (config->GetBuffet_Monitoring() || config->GetKind_ObjFunc() == BUFFET_SENSOR) Aux_Buffet[iPoint] = solver[FLOW_SOL]->GetBuffetSensor(iMarker, iVertex);
+          if (wrt_buffet) Aux_Buffet[iPoint] = solver[FLOW_SOL]->GetBuffetSensor(iMarker, iVertex);
         }
       }
     }
@@ -13053,37 +13340,48 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
         
         /*--- Load data for the pressure, temperature, Cp, and Mach variables. ---*/
         
-        Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetPressure(); iVar++;
-        Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetTemperature(); iVar++;
-        Local_Data[jPoint][iVar] = sqrt(solver[FLOW_SOL]->node[iPoint]->GetVelocity2())/solver[FLOW_SOL]->node[iPoint]->GetSoundSpeed(); iVar++;
-        Local_Data[jPoint][iVar] = (solver[FLOW_SOL]->node[iPoint]->GetPressure() - RefPressure)*factor*RefArea; iVar++;
+        if (wrt_pressure) {
+          Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetPressure(); iVar++;
+        }
+        if (wrt_temperature) {
+          Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetTemperature(); iVar++;
+        }
+        if (wrt_mach) {
+          Local_Data[jPoint][iVar] = sqrt(solver[FLOW_SOL]->node[iPoint]->GetVelocity2())/solver[FLOW_SOL]->node[iPoint]->GetSoundSpeed(); iVar++;
+        }
+        if (wrt_press_coef) {
+          Local_Data[jPoint][iVar] = (solver[FLOW_SOL]->node[iPoint]->GetPressure() - RefPressure)*factor*RefArea; iVar++;
+        }
+        
+        /*--- Load data for the laminar viscosity. ---*/
         
-        if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-          
-          /*--- Load data for the laminar viscosity. ---*/
-          
+        if (wrt_lam_visc) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetLaminarViscosity(); iVar++;
-          
-          /*--- Load data for the skin friction, heat flux, buffet, and y-plus. ---*/
-          
+        }
+        
+        /*--- Load data for the skin friction, heat flux, buffet, and y-plus. ---*/
+        
+        if (wrt_skin_frict) {
           Local_Data[jPoint][iVar] = Aux_Frict_x[iPoint]; iVar++;
           Local_Data[jPoint][iVar] = Aux_Frict_y[iPoint]; iVar++;
           if (geometry->GetnDim() == 3) {
             Local_Data[jPoint][iVar] = Aux_Frict_z[iPoint];
             iVar++;
           }
-          if (config->GetBuffet_Monitoring() || config->GetKind_ObjFunc() == BUFFET_SENSOR) {
-            Local_Data[jPoint][iVar] = Aux_Buffet[iPoint]; 
-            iVar++;
-          }
+        }
+        if (wrt_buffet) {
+          Local_Data[jPoint][iVar] = Aux_Buffet[iPoint]; iVar++;
+        }
+        if (wrt_heat_flux) {
           Local_Data[jPoint][iVar] = Aux_Heat[iPoint]; iVar++;
-          
         }
         
         /*--- Load data for the Eddy viscosity for RANS. ---*/
         
-        if (Kind_Solver == RANS) {
+        if (wrt_yplus) {
           Local_Data[jPoint][iVar] = Aux_yPlus[iPoint]; iVar++;
+        }
+        if (wrt_eddy_visc) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetEddyViscosity(); iVar++;
         }
         
@@ -13095,19 +13393,24 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
         
         /*--- Load data for the intermittency of the BC trans. model. ---*/
         
-        if (transition) {
+        if (wrt_gamma_bc) {
           Local_Data[jPoint][iVar] = solver[TURB_SOL]->node[iPoint]->GetGammaBC(); iVar++;
         }
         
-        if (config->GetKind_HybridRANSLES()!=NO_HYBRIDRANSLES){
+        if (wrt_des) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetDES_LengthScale(); iVar++;
           Local_Data[jPoint][iVar] = geometry->node[iPoint]->GetWall_Distance(); iVar++;
         }
         
-        if (config->GetKind_RoeLowDiss() != NO_ROELOWDISS){
+        if (wrt_roe_diss) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetRoe_Dissipation(); iVar++;
         }
         
+        if (config->GetWrt_Time_Average()) {
+          solver[FLOW_SOL]->GetTimeAverage(iPoint, &Local_Data[jPoint][iVar]);
+          iVar += nDim+3 + (nDim*(nDim+1))/2;
+        }
+        
         /*--- New variables can be loaded to the Local_Data structure here,
          assuming they were registered above correctly. ---*/
         
@@ -13123,7 +13426,7 @@ void COutput::LoadLocalData_Flow(CConfig *config, CGeometry *geometry, CSolver *
   
   /*--- Free memory for auxiliary vectors. ---*/
   
-  if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+  if (wrt_surface && !config->GetLow_MemoryOutput()) {
     delete [] Aux_Frict_x;
     delete [] Aux_Frict_y;
     delete [] Aux_Frict_z;
@@ -13163,7 +13466,26 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
                            (config->GetKind_FluidModel() == INC_IDEAL_GAS_POLY));
   bool wrt_kt           = ((config->GetKind_ConductivityModel() != CONSTANT_CONDUCTIVITY) &&
                            (config->GetViscous()));
-  int *Local_Halo = NULL;
+  bool viscous              = ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS));
+  bool paraview             = ((config->GetOutput_FileFormat() == PARAVIEW) ||
+                               (config->GetOutput_FileFormat() == PARAVIEW_BINARY));
+
+  /*--- Derived fields are only computed and stored when they are selected
+   with VOLUME_OUTPUT_FIELDS (all of them by default). ---*/
+
+  bool wrt_press_coef = config->GetVolume_Output_Field("PRESSURE_COEFF");
+  bool wrt_lam_visc   = viscous && config->GetVolume_Output_Field("LAMINAR_VISCOSITY");
+  bool wrt_skin_frict = viscous && config->GetVolume_Output_Field("SKIN_FRICTION");
+  bool wrt_heat_flux  = viscous && (energy || weakly_coupled_heat) && config->GetVolume_Output_Field("HEAT_FLUX");
+  bool wrt_yplus      = (Kind_Solver == RANS) && config->GetVolume_Output_Field("Y_PLUS");
+  bool wrt_eddy_visc  = (Kind_Solver == RANS) && config->GetVolume_Output_Field("EDDY_VISCOSITY");
+  bool wrt_gamma_bc   = transition && config->GetVolume_Output_Field("INTERMITTENCY");
+  bool wrt_density    = variable_density && config->GetVolume_Output_Field("DENSITY");
+  bool wrt_surface    = (wrt_skin_frict || wrt_heat_flux || wrt_yplus);
+
+  wrt_cp = wrt_cp && config->GetVolume_Output_Field("SPECIFIC_HEAT");
+  wrt_kt = wrt_kt && config->GetVolume_Output_Field("THERMAL_CONDUCTIVITY");
+int *Local_Halo = NULL;
 
   stringstream varname;
 
@@ -13312,57 +13634,51 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
 
     /*--- Add Cp. ---*/
 
-    nVar_Par += 1;
-    if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-        (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-      Variable_Names.push_back("Pressure_Coefficient");
-    } else {
-      Variable_Names.push_back("C<sub>p</sub>");
+    if (wrt_press_coef) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Pressure_Coefficient");
+      else Variable_Names.push_back("C<sub>p</sub>");
     }
 
     /*--- Add Laminar Viscosity, Skin Friction, and Heat Flux to the restart file ---*/
 
-    if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        nVar_Par += 1; Variable_Names.push_back("Laminar_Viscosity");
-        nVar_Par += 2;
+    if (wrt_lam_visc) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Laminar_Viscosity");
+      else Variable_Names.push_back("<greek>m</greek>");
+    }
+
+    if (wrt_skin_frict) {
+      nVar_Par += nDim;
+      if (paraview) {
         Variable_Names.push_back("Skin_Friction_Coefficient_x");
         Variable_Names.push_back("Skin_Friction_Coefficient_y");
-        if (geometry->GetnDim() == 3) {
-          nVar_Par += 1; Variable_Names.push_back("Skin_Friction_Coefficient_z");
-        }
-        if (energy || weakly_coupled_heat) {
-          nVar_Par += 1;
-          Variable_Names.push_back("Heat_Flux");
-        }
+        if (nDim == 3) Variable_Names.push_back("Skin_Friction_Coefficient_z");
       } else {
-        nVar_Par += 1; Variable_Names.push_back("<greek>m</greek>");
-        nVar_Par += 2;
         Variable_Names.push_back("C<sub>f</sub>_x");
         Variable_Names.push_back("C<sub>f</sub>_y");
-        if (geometry->GetnDim() == 3) {
-          nVar_Par += 1; Variable_Names.push_back("C<sub>f</sub>_z");
-        }
-        if (energy || weakly_coupled_heat) {
-          nVar_Par += 1;
-          Variable_Names.push_back("h");
-        }
+        if (nDim == 3) Variable_Names.push_back("C<sub>f</sub>_z");
       }
     }
 
+    if (wrt_heat_flux) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Heat_Flux");
+      else Variable_Names.push_back("h");
+    }
+
     /*--- Add Y+ and Eddy Viscosity. ---*/
 
-    if (Kind_Solver == RANS) {
-      nVar_Par += 2;
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        Variable_Names.push_back("Y_Plus");
-        Variable_Names.push_back("Eddy_Viscosity");
-      } else {
-        Variable_Names.push_back("y<sup>+</sup>");
-        Variable_Names.push_back("<greek>m</greek><sub>t</sub>");
-      }
+    if (wrt_yplus) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Y_Plus");
+      else Variable_Names.push_back("y<sup>+</sup>");
+    }
+
+    if (wrt_eddy_visc) {
+      nVar_Par += 1;
+      if (paraview) Variable_Names.push_back("Eddy_Viscosity");
+      else Variable_Names.push_back("<greek>m</greek><sub>t</sub>");
     }
 
     /*--- Add the distance to the nearest sharp edge if requested. ---*/
@@ -13374,21 +13690,17 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
 
     /*--- Add the intermittency for the BC trans. model. ---*/
 
-    if (transition) {
+    if (wrt_gamma_bc) {
       nVar_Par += 1;
-      if ((config->GetOutput_FileFormat() == PARAVIEW) ||
-          (config->GetOutput_FileFormat() == PARAVIEW_BINARY)){
-        Variable_Names.push_back("gamma_BC");
-      } else {
-        Variable_Names.push_back("<greek>g</greek><sub>BC</sub>");
-      }
+      if (paraview) Variable_Names.push_back("gamma_BC");
+      else Variable_Names.push_back("<greek>g</greek><sub>BC</sub>");
     }
 
-    if (variable_density) {
+    if (wrt_density) {
       nVar_Par += 1;
       Variable_Names.push_back("Density");
     }
-    
+
     if (wrt_cp) {
       nVar_Par += 1;
       Variable_Names.push_back("Specific_Heat");
@@ -13399,13 +13711,33 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
       Variable_Names.push_back("Thermal_Conductivity");
     }
     
+    /*--- Add the running time averages, the pressure RMS and the Reynolds stresses. ---*/
+    
+    if (config->GetWrt_Time_Average()) {
+      nVar_Par += nDim+3 + (nDim*(nDim+1))/2;
+      Variable_Names.push_back("Mean_Density");
+      Variable_Names.push_back("Mean_Velocity_x");
+      Variable_Names.push_back("Mean_Velocity_y");
+      if (nDim == 3) Variable_Names.push_back("Mean_Velocity_z");
+      Variable_Names.push_back("Mean_Pressure");
+      Variable_Names.push_back("RMS_Pressure");
+      Variable_Names.push_back("Reynolds_Stress_xx");
+      Variable_Names.push_back("Reynolds_Stress_xy");
+      if (nDim == 3) Variable_Names.push_back("Reynolds_Stress_xz");
+      Variable_Names.push_back("Reynolds_Stress_yy");
+      if (nDim == 3) {
+        Variable_Names.push_back("Reynolds_Stress_yz");
+        Variable_Names.push_back("Reynolds_Stress_zz");
+      }
+    }
+    
     /*--- New variables get registered here before the end of the loop. ---*/
 
   }
 
   /*--- Auxiliary vectors for variables defined on surfaces only. ---*/
 
-  if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+  if (wrt_surface && !config->GetLow_MemoryOutput()) {
     Aux_Frict_x = new su2double[geometry->GetnPoint()];
     Aux_Frict_y = new su2double[geometry->GetnPoint()];
     Aux_Frict_z = new su2double[geometry->GetnPoint()];
@@ -13578,33 +13910,37 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
 
         /*--- Load data for Cp and Mach variables. ---*/
 
-        Local_Data[jPoint][iVar] = (solver[FLOW_SOL]->node[iPoint]->GetPressure() - RefPressure)*factor*RefArea; iVar++;
-
-        if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+        if (wrt_press_coef) {
+          Local_Data[jPoint][iVar] = (solver[FLOW_SOL]->node[iPoint]->GetPressure() - RefPressure)*factor*RefArea; iVar++;
+        }
 
-          /*--- Load data for the laminar viscosity. ---*/
+        /*--- Load data for the laminar viscosity. ---*/
 
+        if (wrt_lam_visc) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetLaminarViscosity(); iVar++;
+        }
 
-          /*--- Load data for the skin friction, heat flux, and y-plus. ---*/
+        /*--- Load data for the skin friction, heat flux, and y-plus. ---*/
 
+        if (wrt_skin_frict) {
           Local_Data[jPoint][iVar] = Aux_Frict_x[iPoint]; iVar++;
           Local_Data[jPoint][iVar] = Aux_Frict_y[iPoint]; iVar++;
           if (geometry->GetnDim() == 3) {
             Local_Data[jPoint][iVar] = Aux_Frict_z[iPoint];
             iVar++;
           }
-          
-          if (energy || weakly_coupled_heat) {
-            Local_Data[jPoint][iVar] = Aux_Heat[iPoint]; iVar++;
-          }
+        }
 
+        if (wrt_heat_flux) {
+          Local_Data[jPoint][iVar] = Aux_Heat[iPoint]; iVar++;
         }
 
         /*--- Load data for the Eddy viscosity for RANS. ---*/
 
-        if (Kind_Solver == RANS) {
+        if (wrt_yplus) {
           Local_Data[jPoint][iVar] = Aux_yPlus[iPoint]; iVar++;
+        }
+        if (wrt_eddy_visc) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetEddyViscosity(); iVar++;
         }
 
@@ -13616,13 +13952,13 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
 
         /*--- Load data for the intermittency of the BC trans. model. ---*/
 
-        if (transition) {
+        if (wrt_gamma_bc) {
           Local_Data[jPoint][iVar] = solver[TURB_SOL]->node[iPoint]->GetGammaBC(); iVar++;
         }
 
         /*--- Load density if we are solving a variable density problem. ---*/
         
-        if (variable_density) {
+        if (wrt_density) {
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetDensity(); iVar++;
         }
         
@@ -13635,6 +13971,11 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
           Local_Data[jPoint][iVar] = solver[FLOW_SOL]->node[iPoint]->GetThermalConductivity(); iVar++;
         }
         
+        if (config->GetWrt_Time_Average()) {
+          solver[FLOW_SOL]->GetTimeAverage(iPoint, &Local_Data[jPoint][iVar]);
+          iVar += nDim+3 + (nDim*(nDim+1))/2;
+        }
+        
         /*--- New variables can be loaded to the Local_Data structure here,
          assuming they were registered above correctly. ---*/
 
@@ -13649,8 +13990,8 @@ void COutput::LoadLocalData_IncFlow(CConfig *config, CGeometry *geometry, CSolve
   }
 
   /*--- Free memory for auxiliary vectors. ---*/
-  
-  if ((Kind_Solver == NAVIER_STOKES) || (Kind_Solver == RANS)) {
+
+  if (wrt_surface && !config->GetLow_MemoryOutput()) {
     delete [] Aux_Frict_x;
     delete [] Aux_Frict_y;
     delete [] Aux_Frict_z;
@@ -14517,6 +14858,61 @@ void COutput::LoadLocalData_Base(CConfig *config, CGeometry *geometry, CSolver *
   
 }
 
+void COutput::LoadLocalData_Baseline(CConfig *config, CGeometry *geometry, CSolver *solver, unsigned short val_iZone) {
+
+  unsigned short iVar;
+  unsigned long iPoint, jPoint, iMarker, iVertex;
+
+  bool Wrt_Halo = config->GetWrt_Halo(), isPeriodic;
+
+  int *Local_Halo;
+
+  /*--- The variables are the fields of the restart file (the coordinates
+   come first), without the point index. ---*/
+
+  nVar_Par = config->fields.size() - 1;
+  for (iVar = 0; iVar < nVar_Par; iVar++)
+    Variable_Names.push_back(config->fields[iVar+1]);
+
+  Local_Data = new su2double*[geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    Local_Data[iPoint] = new su2double[nVar_Par];
+  }
+
+  Local_Halo = new int[geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    Local_Halo[iPoint] = !geometry->node[iPoint]->GetDomain();
+
+  /*--- Recover the periodic nodes that were part of the original domain. ---*/
+
+  if (!Wrt_Halo) {
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) {
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          isPeriodic = ((geometry->vertex[iMarker][iVertex]->GetRotation_Type() > 0) &&
+                        (geometry->vertex[iMarker][iVertex]->GetRotation_Type() % 2 == 1));
+          if (isPeriodic) Local_Halo[iPoint] = false;
+        }
+      }
+    }
+  }
+
+  /*--- Load the solution of the baseline solver, in the order of the fields. ---*/
+
+  jPoint = 0;
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    if (!Local_Halo[iPoint] || Wrt_Halo) {
+      for (iVar = 0; iVar < nVar_Par; iVar++)
+        Local_Data[jPoint][iVar] = solver->node[iPoint]->GetSolution(iVar);
+      jPoint++;
+    }
+  }
+
+  delete [] Local_Halo;
+
+}
+
 void COutput::SortConnectivity(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
 
   /*--- Flags identifying the types of files to be written. ---*/
@@ -14524,13 +14920,21 @@ void COutput::SortConnectivity(CConfig *config, CGeometry *geometry, unsigned sh
   bool Wrt_Vol = config->GetWrt_Vol_Sol();
   bool Wrt_Srf = config->GetWrt_Srf_Sol();
   
+  /*--- The sorted connectivity only depends on the elements and on the
+   partitioning of the mesh, it is kept between the outputs of the same
+   geometry (the coordinates of a deforming mesh are part of the output data).
+   Only the solution is sorted again, see SortOutputData. ---*/
+  
+  if (geometry != Conn_Cache_Geometry) DeallocateConnectivity_Cache();
+  Conn_Cache_Geometry = geometry;
+  
   /*--- Sort connectivity for each type of element (excluding halos). Note
    In these routines, we sort the connectivity into a linear partitioning
    across all processors based on the global index of the grid nodes. ---*/
   
   /*--- Sort volumetric grid connectivity. ---*/
   
-  if (Wrt_Vol) {
+  if (Wrt_Vol && !Conn_Cache_Vol) {
     
     if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
       cout <<"Sorting volumetric grid connectivity." << endl;
@@ -14542,11 +14946,14 @@ void COutput::SortConnectivity(CConfig *config, CGeometry *geometry, unsigned sh
     SortVolumetricConnectivity(config, geometry, PRISM        );
     SortVolumetricConnectivity(config, geometry, PYRAMID      );
     
+    Conn_Cache_Vol = true;
+    
   }
   
-  /*--- Sort surface grid connectivity. ---*/
+  /*--- Sort surface grid connectivity. The surface connectivity is renumbered
+   for each output (SortOutputData_Surface), the sorted one is kept aside. ---*/
   
-  if (Wrt_Srf) {
+  if (Wrt_Srf && !Conn_Cache_Surf) {
     
     if ((rank == MASTER_NODE) && (size != SINGLE_NODE))
       cout <<"Sorting surface grid connectivity." << endl;
@@ -14555,6 +14962,37 @@ void COutput::SortConnectivity(CConfig *config, CGeometry *geometry, unsigned sh
     SortSurfaceConnectivity(config, geometry, TRIANGLE     );
     SortSurfaceConnectivity(config, geometry, QUADRILATERAL);
     
+    if (nParallel_Line > 0) {
+      Conn_BoundLine_Cache = new int[N_POINTS_LINE*nParallel_Line];
+      memcpy(Conn_BoundLine_Cache, Conn_BoundLine_Par, N_POINTS_LINE*nParallel_Line*sizeof(int));
+    }
+    if (nParallel_BoundTria > 0) {
+      Conn_BoundTria_Cache = new int[N_POINTS_TRIANGLE*nParallel_BoundTria];
+      memcpy(Conn_BoundTria_Cache, Conn_BoundTria_Par, N_POINTS_TRIANGLE*nParallel_BoundTria*sizeof(int));
+    }
+    if (nParallel_BoundQuad > 0) {
+      Conn_BoundQuad_Cache = new int[N_POINTS_QUADRILATERAL*nParallel_BoundQuad];
+      memcpy(Conn_BoundQuad_Cache, Conn_BoundQuad_Par, N_POINTS_QUADRILATERAL*nParallel_BoundQuad*sizeof(int));
+    }
+    
+    Conn_Cache_Surf = true;
+    
+  }
+  else if (Wrt_Srf) {
+    
+    if (nParallel_Line > 0) {
+      Conn_BoundLine_Par = new int[N_POINTS_LINE*nParallel_Line];
+      memcpy(Conn_BoundLine_Par, Conn_BoundLine_Cache, N_POINTS_LINE*nParallel_Line*sizeof(int));
+    }
+    if (nParallel_BoundTria > 0) {
+      Conn_BoundTria_Par = new int[N_POINTS_TRIANGLE*nParallel_BoundTria];
+      memcpy(Conn_BoundTria_Par, Conn_BoundTria_Cache, N_POINTS_TRIANGLE*nParallel_BoundTria*sizeof(int));
+    }
+    if (nParallel_BoundQuad > 0) {
+      Conn_BoundQuad_Par = new int[N_POINTS_QUADRILATERAL*nParallel_BoundQuad];
+      memcpy(Conn_BoundQuad_Par, Conn_BoundQuad_Cache, N_POINTS_QUADRILATERAL*nParallel_BoundQuad*sizeof(int));
+    }
+    
   }
   
   /*--- Reduce the total number of cells we will be writing in the output files. ---*/
@@ -16023,7 +16461,7 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
       int count  = VARS_PER_POINT*kk;
       int source = ii;
       int tag    = ii + 1;
-      SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_DOUBLE, source, tag,
+      SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_SU2DOUBLE, source, tag,
                      MPI_COMM_WORLD, &(recv_req[iMessage]));
       iMessage++;
     }
@@ -16039,7 +16477,7 @@ void COutput::SortOutputData(CConfig *config, CGeometry *geometry) {
       int count  = VARS_PER_POINT*kk;
       int dest = ii;
       int tag    = rank + 1;
-      SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
+      SU2_MPI::Isend(&(connSend[ll]), count, MPI_SU2DOUBLE, dest, tag,
                      MPI_COMM_WORLD, &(send_req[iMessage]));
       iMessage++;
     }
@@ -17680,6 +18118,8 @@ void COutput::WriteRestart_Parallel_ASCII(CConfig *config, CGeometry *geometry,
     restart_file <<"DCMX_DCL_VALUE= " << config->GetdCMx_dCL() << endl;
     restart_file <<"DCMY_DCL_VALUE= " << config->GetdCMy_dCL() << endl;
     restart_file <<"DCMZ_DCL_VALUE= " << config->GetdCMz_dCL() << endl;
+    if (config->GetWrt_Time_Average() && (solver[FLOW_SOL] != NULL))
+      restart_file <<"TIME_AVG_SAMPLES= " << solver[FLOW_SOL]->GetnTimeAverage_Samples() << endl;
 
     if (( config->GetKind_Solver() == DISC_ADJ_EULER ||
           config->GetKind_Solver() == DISC_ADJ_NAVIER_STOKES ||
@@ -17780,12 +18220,46 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
     0.0
   };
 
+  /*--- The last slot holds the number of time steps in the flow statistics. ---*/
+
+  if (config->GetWrt_Time_Average() && (solver[FLOW_SOL] != NULL))
+    Restart_Metadata[7] = (passivedouble)solver[FLOW_SOL]->GetnTimeAverage_Samples();
+
   if (( config->GetKind_Solver() == DISC_ADJ_EULER ||
         config->GetKind_Solver() == DISC_ADJ_NAVIER_STOKES ||
         config->GetKind_Solver() == DISC_ADJ_RANS ) && adjoint) {
     Restart_Metadata[4] = SU2_TYPE::GetValue(solver[ADJFLOW_SOL]->GetTotal_Sens_AoA() * PI_NUMBER / 180.0);
   }
 
+  /*--- Asynchronous writing: the chunk of this rank (and the header and the
+   metadata on the master rank) is handed to a background thread. ---*/
+
+  if (config->GetWrt_Async_Restart()) {
+
+    unsigned long Header_Size = var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char);
+    unsigned long Data_Size   = nVar_Par*nGlobalPoint_Sort*sizeof(passivedouble);
+
+    CAsyncRestart *job = new CAsyncRestart(filename, (rank == MASTER_NODE)?
+                                           Header_Size+Data_Size+sizeof(int)+8*sizeof(passivedouble) : 0);
+
+    if (rank == MASTER_NODE) {
+      vector<char> Names(nVar_Par*CGNS_STRING_SIZE);
+      for (iVar = 0; iVar < nVar_Par; iVar++)
+        strncpy(&Names[iVar*CGNS_STRING_SIZE], Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+      job->AddSegment(0, var_buf, var_buf_size*sizeof(int));
+      job->AddSegment(var_buf_size*sizeof(int), &Names[0], Names.size());
+      job->AddSegment(Header_Size+Data_Size, &Restart_ExtIter, sizeof(int));
+      job->AddSegment(Header_Size+Data_Size+sizeof(int), Restart_Metadata, 8*sizeof(passivedouble));
+    }
+    job->AddSegment(Header_Size + nVar_Par*nPoint_Cum[rank]*sizeof(passivedouble),
+                    buf, nVar_Par*nParallel_Poin*sizeof(passivedouble));
+
+    Start_Async_Restart(job);
+
+    delete [] buf;
+    return;
+  }
+
   /*--- Set a timer for the binary file writing. ---*/
   
 #ifndef HAVE_MPI
@@ -17967,7 +18441,7 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
 #ifdef HAVE_MPI
   su2double my_file_size = file_size;
   SU2_MPI::Allreduce(&my_file_size, &file_size, 1,
-                     MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+                     MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
   
   /*--- Compute and store the bandwidth ---*/
@@ -17986,6 +18460,430 @@ void COutput::WriteRestart_Parallel_Binary(CConfig *config, CGeometry *geometry,
 
 }
 
+void COutput::WriteRestart_Parallel_Compact(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_iInst) {
+
+  /*--- Local variables ---*/
+
+  unsigned short iVar, iField, nZone = geometry->GetnZone(), nInst = config->GetnTimeInstances();
+  unsigned short nDim = geometry->GetnDim();
+  unsigned short Kind_Storage = config->GetKind_Compact_Restart();
+  unsigned long iPoint, iExtIter = config->GetExtIter(), Header_Size, Record_Size, Value_Size;
+  bool fem       = (config->GetKind_Solver() == FEM_ELASTICITY);
+  bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
+                    (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
+  bool grid_movement = config->GetGrid_Movement();
+  bool wrt_perf  = config->GetWrt_Performance();
+  string filename;
+  char str_buf[CGNS_STRING_SIZE], fname[100];
+  su2double file_size = 0.0, StartTime, StopTime, UsedTime, Bandwidth;
+  passivedouble Value;
+  float Value_Float;
+  unsigned short Value_Quant;
+
+  /*--- Retrieve filename from config ---*/
+
+  if (fem) {
+    filename = config->GetRestart_FEMFileName();
+  } else {
+    filename = config->GetRestart_FlowFileName();
+  }
+
+  /*--- Append the zone number if multizone problems ---*/
+  if (nZone > 1)
+    filename= config->GetMultizone_FileName(filename, val_iZone);
+
+  /*--- Append the zone number if multiple instance problems ---*/
+  if (nInst > 1)
+    filename= config->GetMultiInstance_FileName(filename, val_iInst);
+
+  /*--- Unsteady problems require an iteration number to be appended. ---*/
+  if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(val_iInst));
+  } else if (config->GetWrt_Unsteady()) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  } else if ((fem) && (config->GetWrt_Dynamic())) {
+    filename = config->GetUnsteady_FileName(filename, SU2_TYPE::Int(iExtIter));
+  }
+
+  strcpy(fname, filename.c_str());
+
+  /*--- Select the fields. The coordinates and the conservative variables
+   (the block read by the LoadRestart routines) are always written in double
+   precision. They are followed by the grid velocities and the requested
+   fields, in the storage of COMPACT_RESTART_STORAGE. ---*/
+
+  int nVar_Solution = nDim + solver[FLOW_SOL]->GetnVar();
+  if (config->GetKind_Solver() == RANS) nVar_Solution += solver[TURB_SOL]->GetnVar();
+
+  vector<int> Stored_Index;
+  bool keep;
+  for (iVar = 0; iVar < nVar_Par; iVar++) {
+    keep = ((int)iVar < nVar_Solution);
+    if (grid_movement && (Variable_Names[iVar].compare(0, 13, "Grid_Velocity") == 0)) keep = true;
+    for (iField = 0; iField < config->GetnCompact_Restart_Fields(); iField++)
+      if (Variable_Names[iVar] == config->GetCompact_Restart_Fields(iField)) keep = true;
+    if (keep) Stored_Index.push_back(iVar);
+  }
+
+  int nStored = Stored_Index.size();
+  int nDouble = (Kind_Storage == COMPACT_DOUBLE) ? nStored : nVar_Solution;
+  int nCompact = nStored - nDouble;
+
+  switch (Kind_Storage) {
+    case COMPACT_FLOAT32:     Value_Size = sizeof(float); break;
+    case COMPACT_QUANTIZED16: Value_Size = sizeof(unsigned short); break;
+    default:                  Value_Size = sizeof(passivedouble); break;
+  }
+  Record_Size = nDouble*sizeof(passivedouble) + nCompact*Value_Size;
+
+  /*--- The quantization uses the global range of each compact field, such that
+   the records have a fixed size and the file can be read with any partition.
+   The error is below half of the step, (max-min)/(2*65535). ---*/
+
+  vector<passivedouble> Quant_Param(2*nCompact, 0.0);
+
+  if (Kind_Storage == COMPACT_QUANTIZED16) {
+    vector<passivedouble> MinMax(2*nCompact), MinMax_Global(2*nCompact);
+    for (iField = 0; iField < nCompact; iField++) {
+      MinMax[iField] = 1.0E300; MinMax[nCompact+iField] = 1.0E300;
+      for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
+        Value = SU2_TYPE::GetValue(Parallel_Data[Stored_Index[nDouble+iField]][iPoint]);
+        MinMax[iField] = min(MinMax[iField], Value);
+        MinMax[nCompact+iField] = min(MinMax[nCompact+iField], -Value);
+      }
+    }
+    MinMax_Global = MinMax;
+#ifdef HAVE_MPI
+    if (nCompact > 0)
+      CBaseMPIWrapper::Allreduce(&MinMax[0], &MinMax_Global[0], 2*nCompact, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+#endif
+    for (iField = 0; iField < nCompact; iField++) {
+      Quant_Param[2*iField]   = MinMax_Global[iField];
+      Quant_Param[2*iField+1] = max(-MinMax_Global[nCompact+iField]-MinMax_Global[iField], 0.0)/65535.0;
+    }
+  }
+
+  /*--- Header: the ints that identify the compact format (535533) and give the
+   number of fields of the full layout, the number of points, the number of stored
+   fields and the storage. The names of all the fields follow, then the number of
+   double fields, the column of each stored field and the quantization parameters. ---*/
+
+  int var_buf_size = 5;
+  int var_buf[5] = {535533, nVar_Par, (int)nGlobalPoint_Sort, nStored, Kind_Storage};
+
+  Header_Size = var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char) +
+                (1+nStored)*sizeof(int) + 2*nCompact*sizeof(passivedouble);
+
+  /*--- Pack the records of the local points. ---*/
+
+  char *buf = new char[max(nParallel_Poin*Record_Size, (unsigned long)1)];
+  char *record;
+
+  for (iPoint = 0; iPoint < nParallel_Poin; iPoint++) {
+    record = &buf[iPoint*Record_Size];
+    for (iField = 0; iField < nDouble; iField++) {
+      Value = SU2_TYPE::GetValue(Parallel_Data[Stored_Index[iField]][iPoint]);
+      memcpy(&record[iField*sizeof(passivedouble)], &Value, sizeof(passivedouble));
+    }
+    record += nDouble*sizeof(passivedouble);
+    for (iField = 0; iField < nCompact; iField++) {
+      Value = SU2_TYPE::GetValue(Parallel_Data[Stored_Index[nDouble+iField]][iPoint]);
+      if (Kind_Storage == COMPACT_FLOAT32) {
+        Value_Float = (float)Value;
+        memcpy(&record[iField*Value_Size], &Value_Float, Value_Size);
+      } else {
+        Value_Quant = 0;
+        if (Quant_Param[2*iField+1] > 0.0)
+          Value_Quant = (unsigned short)min(floor((Value-Quant_Param[2*iField])/Quant_Param[2*iField+1]+0.5), 65535.0);
+        memcpy(&record[iField*Value_Size], &Value_Quant, Value_Size);
+      }
+    }
+  }
+
+  /*--- Prepare metadata. ---*/
+
+  int Restart_ExtIter;
+  if (dual_time)
+    Restart_ExtIter= (int)config->GetExtIter() + 1;
+  else
+    Restart_ExtIter = (int)config->GetExtIter() + (int)config->GetExtIter_OffSet() + 1;
+
+  passivedouble Restart_Metadata[8] = {
+    SU2_TYPE::GetValue(config->GetAoA() - config->GetAoA_Offset()),
+    SU2_TYPE::GetValue(config->GetAoS() - config->GetAoS_Offset()),
+    SU2_TYPE::GetValue(config->GetInitial_BCThrust()),
+    SU2_TYPE::GetValue(config->GetdCD_dCL()),
+    SU2_TYPE::GetValue(config->GetdCMx_dCL()),
+    SU2_TYPE::GetValue(config->GetdCMy_dCL()),
+    SU2_TYPE::GetValue(config->GetdCMz_dCL()),
+    0.0
+  };
+
+  /*--- The last slot holds the number of time steps in the flow statistics. ---*/
+
+  if (config->GetWrt_Time_Average() && (solver[FLOW_SOL] != NULL))
+    Restart_Metadata[7] = (passivedouble)solver[FLOW_SOL]->GetnTimeAverage_Samples();
+
+  /*--- Asynchronous writing, see WriteRestart_Parallel_Binary. ---*/
+
+  if (config->GetWrt_Async_Restart()) {
+
+    CAsyncRestart *job = new CAsyncRestart(filename, (rank == MASTER_NODE)?
+                                           Header_Size+nGlobalPoint_Sort*Record_Size+sizeof(int)+8*sizeof(passivedouble) : 0);
+
+    if (rank == MASTER_NODE) {
+      vector<char> Names(nVar_Par*CGNS_STRING_SIZE);
+      for (iVar = 0; iVar < nVar_Par; iVar++)
+        strncpy(&Names[iVar*CGNS_STRING_SIZE], Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+      unsigned long Names_End = var_buf_size*sizeof(int) + Names.size();
+      job->AddSegment(0, var_buf, var_buf_size*sizeof(int));
+      job->AddSegment(var_buf_size*sizeof(int), &Names[0], Names.size());
+      job->AddSegment(Names_End, &nDouble, sizeof(int));
+      job->AddSegment(Names_End+sizeof(int), &Stored_Index[0], nStored*sizeof(int));
+      if (nCompact > 0)
+        job->AddSegment(Names_End+(1+nStored)*sizeof(int), &Quant_Param[0], 2*nCompact*sizeof(passivedouble));
+      job->AddSegment(Header_Size+nGlobalPoint_Sort*Record_Size, &Restart_ExtIter, sizeof(int));
+      job->AddSegment(Header_Size+nGlobalPoint_Sort*Record_Size+sizeof(int), Restart_Metadata, 8*sizeof(passivedouble));
+    }
+    job->AddSegment(Header_Size + nPoint_Cum[rank]*Record_Size, buf, nParallel_Poin*Record_Size);
+
+    Start_Async_Restart(job);
+
+    delete [] buf;
+    return;
+  }
+
+  /*--- Set a timer for the binary file writing. ---*/
+  
+#ifndef HAVE_MPI
+  StartTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StartTime = MPI_Wtime();
+#endif
+  
+#ifndef HAVE_MPI
+
+  FILE* fhw;
+  fhw = fopen(fname, "wb");
+
+  /*--- Error check for opening the file. ---*/
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- Header, names of all the fields and description of the stored fields. ---*/
+
+  fwrite(var_buf, var_buf_size, sizeof(int), fhw);
+  for (iVar = 0; iVar < nVar_Par; iVar++) {
+    strncpy(str_buf, Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+    fwrite(str_buf, CGNS_STRING_SIZE, sizeof(char), fhw);
+  }
+  fwrite(&nDouble, 1, sizeof(int), fhw);
+  fwrite(&Stored_Index[0], nStored, sizeof(int), fhw);
+  if (nCompact > 0) fwrite(&Quant_Param[0], 2*nCompact, sizeof(passivedouble), fhw);
+  file_size += (su2double)Header_Size;
+
+  /*--- Records of all the points, then the external iteration and the metadata. ---*/
+
+  fwrite(buf, nParallel_Poin, Record_Size, fhw);
+  file_size += (su2double)nParallel_Poin*Record_Size;
+
+  fwrite(&Restart_ExtIter, 1, sizeof(int), fhw);
+  fwrite(Restart_Metadata, 8, sizeof(passivedouble), fhw);
+  file_size += (su2double)(sizeof(int) + 8*sizeof(passivedouble));
+
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel binary output using MPI I/O, each rank writes the records of its
+   linear partition of the points as one contiguous chunk. ---*/
+
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype etype;
+  MPI_Offset disp;
+  int ierr;
+
+  MPI_Type_contiguous(Record_Size, MPI_BYTE, &etype);
+  MPI_Type_commit(&etype);
+
+  /*--- All ranks open a fresh file (see WriteRestart_Parallel_Binary). ---*/
+
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname,
+                       MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                       MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS)  {
+    MPI_File_close(&fhw);
+    if (rank == 0)
+      MPI_File_delete(fname, MPI_INFO_NULL);
+    ierr = MPI_File_open(MPI_COMM_WORLD, fname,
+                         MPI_MODE_CREATE|MPI_MODE_EXCL|MPI_MODE_WRONLY,
+                         MPI_INFO_NULL, &fhw);
+  }
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- The master rank writes the header. ---*/
+
+  if (rank == MASTER_NODE) {
+    MPI_File_write_at(fhw, 0, var_buf, var_buf_size, MPI_INT, MPI_STATUS_IGNORE);
+    for (iVar = 0; iVar < nVar_Par; iVar++) {
+      disp = var_buf_size*sizeof(int) + iVar*CGNS_STRING_SIZE*sizeof(char);
+      strncpy(str_buf, Variable_Names[iVar].c_str(), CGNS_STRING_SIZE);
+      MPI_File_write_at(fhw, disp, str_buf, CGNS_STRING_SIZE, MPI_CHAR, MPI_STATUS_IGNORE);
+    }
+    disp = var_buf_size*sizeof(int) + nVar_Par*CGNS_STRING_SIZE*sizeof(char);
+    MPI_File_write_at(fhw, disp, &nDouble, 1, MPI_INT, MPI_STATUS_IGNORE);
+    disp += sizeof(int);
+    MPI_File_write_at(fhw, disp, &Stored_Index[0], nStored, MPI_INT, MPI_STATUS_IGNORE);
+    disp += nStored*sizeof(int);
+    if (nCompact > 0)
+      MPI_File_write_at(fhw, disp, &Quant_Param[0], 2*nCompact, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    file_size += (su2double)Header_Size;
+  }
+
+  /*--- Collective write of the chunks of all ranks. ---*/
+
+  disp = Header_Size + (MPI_Offset)nPoint_Cum[rank]*Record_Size;
+  MPI_File_write_at_all(fhw, disp, buf, nParallel_Poin, etype, &status);
+  file_size += (su2double)nParallel_Poin*Record_Size;
+
+  MPI_Type_free(&etype);
+
+  /*--- Finally, the master rank writes the metadata. ---*/
+
+  if (rank == MASTER_NODE) {
+    disp = Header_Size + (MPI_Offset)nGlobalPoint_Sort*Record_Size;
+    MPI_File_write_at(fhw, disp, &Restart_ExtIter, 1, MPI_INT, MPI_STATUS_IGNORE);
+    disp += sizeof(int);
+    MPI_File_write_at(fhw, disp, Restart_Metadata, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    file_size += (su2double)(sizeof(int) + 8*sizeof(passivedouble));
+  }
+
+  MPI_File_close(&fhw);
+
+#endif
+
+  /*--- Compute and store the write time. ---*/
+  
+#ifndef HAVE_MPI
+  StopTime = su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  StopTime = MPI_Wtime();
+#endif
+  UsedTime = StopTime-StartTime;
+  
+  /*--- Communicate the total file size for the restart ---*/
+  
+#ifdef HAVE_MPI
+  su2double my_file_size = file_size;
+  SU2_MPI::Allreduce(&my_file_size, &file_size, 1,
+                     MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  
+  /*--- Compute and store the bandwidth ---*/
+  
+  Bandwidth = file_size/(1.0e6)/UsedTime;
+  config->SetRestart_Bandwidth_Agg(config->GetRestart_Bandwidth_Agg()+Bandwidth);
+  
+  if ((rank == MASTER_NODE) && (wrt_perf)) {
+    cout << "Wrote " << file_size/1.0e6 << " MB to disk in ";
+    cout << UsedTime << " s. (" << Bandwidth << " MB/s)." << endl;
+  }
+  
+  delete [] buf;
+
+}
+
+void COutput::Start_Async_Restart(CAsyncRestart *job) {
+
+  /*--- The file is written synchronously if no thread can be created. ---*/
+
+#ifdef HAVE_PTHREAD
+  if (pthread_create(&job->Thread, NULL, Async_Restart_Thread, (void*)job) == 0) {
+    Async_Restart.push_back(job);
+    return;
+  }
+#endif
+
+  job->Write();
+  if (job->Error) {
+    SU2_MPI::Error(string("Unable to write SU2 restart file ") + job->FileName, CURRENT_FUNCTION);
+  }
+  delete job;
+
+}
+
+void COutput::Wait_Async_Restart(void) {
+
+  unsigned long iJob;
+  bool Error = false;
+  string FileName;
+
+  for (iJob = 0; iJob < Async_Restart.size(); iJob++) {
+#ifdef HAVE_PTHREAD
+    pthread_join(Async_Restart[iJob]->Thread, NULL);
+#endif
+    if (Async_Restart[iJob]->Error) {
+      Error = true;
+      FileName = Async_Restart[iJob]->FileName;
+    }
+    delete Async_Restart[iJob];
+  }
+  Async_Restart.clear();
+
+  if (Error) {
+    SU2_MPI::Error(string("Unable to write SU2 restart file ") + FileName, CURRENT_FUNCTION);
+  }
+
+}
+
+void COutput::WriteInSitu_Parallel(CConfig *config, CGeometry *geometry,
+                                   unsigned long iExtIter, unsigned short val_iZone) {
+
+  if (InSitu_Adaptor == NULL) {
+    if (rank == MASTER_NODE) cout << "No in-situ adaptor registered, the volume solution is not output." << endl;
+    return;
+  }
+
+  /*--- Views of the sorted data and connectivity of this rank, which are
+   already in the linear partitioning of the parallel file writers. ---*/
+
+  CInSituData data;
+
+  data.iZone    = val_iZone;
+  data.iExtIter = iExtIter;
+  data.Time     = config->GetCurrent_UnstTime();
+  data.nDim     = geometry->GetnDim();
+  data.nVar     = Variable_Names.size();
+  data.Variable_Names = &Variable_Names;
+  data.Data     = Parallel_Data;
+
+  data.nPoint       = nParallel_Poin;
+  data.nGlobalPoint = nGlobal_Poin_Par;
+  data.PointOffset  = beg_node[rank];
+
+  data.ElemType[0] = TRIANGLE;      data.nNodeElem[0] = N_POINTS_TRIANGLE;
+  data.nElem[0]    = nParallel_Tria; data.Conn[0]     = Conn_Tria_Par;
+  data.ElemType[1] = QUADRILATERAL; data.nNodeElem[1] = N_POINTS_QUADRILATERAL;
+  data.nElem[1]    = nParallel_Quad; data.Conn[1]     = Conn_Quad_Par;
+  data.ElemType[2] = TETRAHEDRON;   data.nNodeElem[2] = N_POINTS_TETRAHEDRON;
+  data.nElem[2]    = nParallel_Tetr; data.Conn[2]     = Conn_Tetr_Par;
+  data.ElemType[3] = HEXAHEDRON;    data.nNodeElem[3] = N_POINTS_HEXAHEDRON;
+  data.nElem[3]    = nParallel_Hexa; data.Conn[3]     = Conn_Hexa_Par;
+  data.ElemType[4] = PRISM;         data.nNodeElem[4] = N_POINTS_PRISM;
+  data.nElem[4]    = nParallel_Pris; data.Conn[4]     = Conn_Pris_Par;
+  data.ElemType[5] = PYRAMID;       data.nNodeElem[5] = N_POINTS_PYRAMID;
+  data.nElem[5]    = nParallel_Pyra; data.Conn[5]     = Conn_Pyra_Par;
+
+  InSitu_Adaptor->Execute(data);
+
+}
+
 void COutput::WriteCSV_Slice(CConfig *config, CGeometry *geometry,
                              CSolver *FlowSolver, unsigned long iExtIter,
                              unsigned short val_iZone, unsigned short val_direction) {
@@ -18156,7 +19054,7 @@ void COutput::WriteCSV_Slice(CConfig *config, CGeometry *geometry,
   /*--- Send the information to the master node ---*/
 
 #ifdef HAVE_MPI
-  SU2_MPI::Gather(Buffer_Send_Data, MaxLocalVertex_Surface*nVar_Par, MPI_DOUBLE, Buffer_Recv_Data, MaxLocalVertex_Surface*nVar_Par, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Data, MaxLocalVertex_Surface*nVar_Par, MPI_SU2DOUBLE, Buffer_Recv_Data, MaxLocalVertex_Surface*nVar_Par, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   SU2_MPI::Gather(Buffer_Send_GlobalIndex, MaxLocalVertex_Surface, MPI_UNSIGNED_LONG, Buffer_Recv_GlobalIndex, MaxLocalVertex_Surface, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
 #else
   for (iVertex = 0; iVertex < Buffer_Recv_nVertex[0]; iVertex++) {
@@ -18260,6 +19158,25 @@ void COutput::DeallocateConnectivity_Parallel(CConfig *config, CGeometry *geomet
   
 }
 
+void COutput::DeallocateConnectivity_Cache(void) {
+
+  if (Conn_Cache_Vol) {
+    DeallocateConnectivity_Parallel(NULL, NULL, false);
+    Conn_Tria_Par = NULL;  Conn_Quad_Par = NULL;  Conn_Tetr_Par = NULL;
+    Conn_Hexa_Par = NULL;  Conn_Pris_Par = NULL;  Conn_Pyra_Par = NULL;
+  }
+
+  if (Conn_BoundLine_Cache != NULL) delete [] Conn_BoundLine_Cache;
+  if (Conn_BoundTria_Cache != NULL) delete [] Conn_BoundTria_Cache;
+  if (Conn_BoundQuad_Cache != NULL) delete [] Conn_BoundQuad_Cache;
+  Conn_BoundLine_Cache = NULL;  Conn_BoundTria_Cache = NULL;  Conn_BoundQuad_Cache = NULL;
+
+  Conn_Cache_Geometry = NULL;
+  Conn_Cache_Vol      = false;
+  Conn_Cache_Surf     = false;
+
+}
+
 void COutput::DeallocateData_Parallel(CConfig *config, CGeometry *geometry) {
   
   /*--- Deallocate memory for solution data ---*/
@@ -18434,10 +19351,10 @@ void COutput::MergeInletCoordinates(CConfig *config, CGeometry *geometry) {
   /*--- Gather the coordinate data on the master node using MPI. ---*/
 
 #ifdef HAVE_MPI
-  SU2_MPI::Gather(Buffer_Send_X, MaxLocalPoint, MPI_DOUBLE, Buffer_Recv_X, MaxLocalPoint, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Y, MaxLocalPoint, MPI_DOUBLE, Buffer_Recv_Y, MaxLocalPoint, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_X, MaxLocalPoint, MPI_SU2DOUBLE, Buffer_Recv_X, MaxLocalPoint, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Y, MaxLocalPoint, MPI_SU2DOUBLE, Buffer_Recv_Y, MaxLocalPoint, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if (nDim == 3) {
-    SU2_MPI::Gather(Buffer_Send_Z, MaxLocalPoint, MPI_DOUBLE, Buffer_Recv_Z, MaxLocalPoint, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Z, MaxLocalPoint, MPI_SU2DOUBLE, Buffer_Recv_Z, MaxLocalPoint, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   }
   SU2_MPI::Gather(Buffer_Send_Str, MaxLocalPoint*MAX_STRING_SIZE, MPI_CHAR, Buffer_Recv_Str, MaxLocalPoint*MAX_STRING_SIZE, MPI_CHAR, MASTER_NODE, MPI_COMM_WORLD);
 #else
@@ -18936,19 +19853,19 @@ void COutput::SpecialOutput_AnalyzeSurface(CSolver *solver, CGeometry *geometry,
   
 #ifdef HAVE_MPI
   
-  SU2_MPI::Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Mach_Local, Surface_Mach_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Temperature_Local, Surface_Temperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Density_Local, Surface_Density_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Pressure_Local, Surface_Pressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_Area_Local, Surface_Area_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total, nMarker_Analyze, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_MassFlow_Local, Surface_MassFlow_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Mach_Local, Surface_Mach_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Temperature_Local, Surface_Temperature_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Density_Local, Surface_Density_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Enthalpy_Local, Surface_Enthalpy_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_NormalVelocity_Local, Surface_NormalVelocity_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_StreamVelocity2_Local, Surface_StreamVelocity2_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_TransvVelocity2_Local, Surface_TransvVelocity2_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Pressure_Local, Surface_Pressure_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_TotalTemperature_Local, Surface_TotalTemperature_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_TotalPressure_Local, Surface_TotalPressure_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_Area_Local, Surface_Area_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(Surface_MassFlow_Abs_Local, Surface_MassFlow_Abs_Total, nMarker_Analyze, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
 #else
   
@@ -19449,10 +20366,10 @@ void COutput::MergeCoordinates_FEM(CConfig *config, CGeometry *geometry) {
 
   /*--- Gather the coordinate data on the master node using MPI. ---*/
 
-  SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-  SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_X, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_X, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(Buffer_Send_Y, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Y, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   if (nDim == 3) {
-    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Z, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Z, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
   }
   SU2_MPI::Gather(Buffer_Send_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, Buffer_Recv_GlobalIndex, nBuffer_Scalar, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
 
@@ -20179,7 +21096,7 @@ void COutput::MergeSolution_FEM(CConfig *config, CGeometry *geometry, CSolver **
     /*--- Gather the data on the master node. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
     for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -20347,7 +21264,7 @@ void COutput::MergeBaselineSolution_FEM(CConfig *config, CGeometry *geometry, CS
     /*--- Gather the data on the master node. ---*/
 
 #ifdef HAVE_MPI
-    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Gather(Buffer_Send_Var, nBuffer_Scalar, MPI_SU2DOUBLE, Buffer_Recv_Var, nBuffer_Scalar, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 #else
     for (iPoint = 0; iPoint < nBuffer_Scalar; iPoint++) Buffer_Recv_Var[iPoint] = Buffer_Send_Var[iPoint];
 #endif
@@ -21334,7 +22251,7 @@ void COutput::SortOutputData_FEM(CConfig *config, CGeometry *geometry) {
       int count  = VARS_PER_POINT*kk;
       int source = ii;
       int tag    = ii + 1;
-      SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_DOUBLE, source, tag,
+      SU2_MPI::Irecv(&(connRecv[ll]), count, MPI_SU2DOUBLE, source, tag,
                      MPI_COMM_WORLD, &(recv_req[iMessage]));
       iMessage++;
     }
@@ -21350,7 +22267,7 @@ void COutput::SortOutputData_FEM(CConfig *config, CGeometry *geometry) {
       int count  = VARS_PER_POINT*kk;
       int dest = ii;
       int tag    = rank + 1;
-      SU2_MPI::Isend(&(connSend[ll]), count, MPI_DOUBLE, dest, tag,
+      SU2_MPI::Isend(&(connSend[ll]), count, MPI_SU2DOUBLE, dest, tag,
                      MPI_COMM_WORLD, &(send_req[iMessage]));
       iMessage++;
     }
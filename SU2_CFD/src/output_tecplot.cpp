@@ -1016,6 +1016,343 @@ void COutput::WriteTecplotASCII_Parallel(CConfig *config, CGeometry *geometry, C
   
 }
 
+void COutput::WriteTecplotBinary_Parallel(CConfig *config, CGeometry *geometry, CSolver **solver, unsigned short val_iZone, unsigned short val_nZone, unsigned short val_iInst, unsigned short val_nInst, bool surf_sol) {
+  
+#ifdef HAVE_TECIO
+  
+  unsigned short iVar, iType, iNode, nDim = geometry->GetnDim();
+  unsigned short Kind_Solver = config->GetKind_Solver();
+  
+  unsigned long iPoint, iElem, iGhost, iConn, GlobalIndex;
+  unsigned long iExtIter = config->GetExtIter();
+  
+  bool adjoint = config->GetContinuous_Adjoint() || config->GetDiscrete_Adjoint();
+  
+  int iRank, err = 0;
+  
+  char cstr[200], buffer[50];
+  string filename;
+  
+  /*--- Write file name with extension, as for the ASCII file ---*/
+  
+  if (surf_sol) {
+    if (adjoint) filename = config->GetSurfAdjCoeff_FileName();
+    else filename = config->GetSurfFlowCoeff_FileName();
+  }
+  else {
+    if (adjoint)
+      filename = config->GetAdj_FileName();
+    else filename = config->GetFlow_FileName();
+  }
+  
+  if (Kind_Solver == FEM_ELASTICITY) {
+    if (surf_sol) filename = config->GetSurfStructure_FileName().c_str();
+    else filename = config->GetStructure_FileName().c_str();
+  }
+  
+  if (config->GetKind_SU2() == SU2_DOT) {
+    if (surf_sol) filename = config->GetSurfSens_FileName();
+    else filename = config->GetVolSens_FileName();
+  }
+  
+  strcpy (cstr, filename.c_str());
+  
+  if ((Kind_Solver == EULER || Kind_Solver == NAVIER_STOKES || Kind_Solver == RANS ||
+       Kind_Solver == ADJ_EULER || Kind_Solver == ADJ_NAVIER_STOKES || Kind_Solver == ADJ_RANS ||
+       Kind_Solver == DISC_ADJ_EULER || Kind_Solver == DISC_ADJ_NAVIER_STOKES || Kind_Solver == DISC_ADJ_RANS) &&
+      (val_nZone > 1) ) {
+    SPRINTF (buffer, "_%d", SU2_TYPE::Int(val_iZone));
+    strcat(cstr, buffer);
+  }
+  
+  if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && config->GetUnsteady_Simulation() != HARMONIC_BALANCE) {
+    if (SU2_TYPE::Int(iExtIter) < 10) SPRINTF (buffer, "_0000%d.szplt", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 10) && (SU2_TYPE::Int(iExtIter) < 100)) SPRINTF (buffer, "_000%d.szplt", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 100) && (SU2_TYPE::Int(iExtIter) < 1000)) SPRINTF (buffer, "_00%d.szplt", SU2_TYPE::Int(iExtIter));
+    if ((SU2_TYPE::Int(iExtIter) >= 1000) && (SU2_TYPE::Int(iExtIter) < 10000)) SPRINTF (buffer, "_0%d.szplt", SU2_TYPE::Int(iExtIter));
+    if (SU2_TYPE::Int(iExtIter) >= 10000) SPRINTF (buffer, "_%d.szplt", SU2_TYPE::Int(iExtIter));
+  }
+  else { SPRINTF (buffer, ".szplt"); }
+  
+  strcat(cstr, buffer);
+  
+  /*--- Data and element lists of this rank. A zone has a single cell type, the
+   other elements repeat nodes as in the ASCII file: every element list is given by
+   its connectivity, the number of elements, its number of nodes and the map from
+   the nodes of the cell to the nodes of the element. ---*/
+  
+  static const unsigned short Map_Line[] = {0,1};
+  static const unsigned short Map_Tria[] = {0,1,2,2};
+  static const unsigned short Map_Quad[] = {0,1,2,3};
+  static const unsigned short Map_Tetr[] = {0,1,2,2,3,3,3,3};
+  static const unsigned short Map_Hexa[] = {0,1,2,3,4,5,6,7};
+  static const unsigned short Map_Pris[] = {0,1,1,2,3,4,4,5};
+  static const unsigned short Map_Pyra[] = {0,1,2,3,4,4,4,4};
+  
+  su2double **Data;
+  unsigned long myPoint;
+  vector<int *> Conn;
+  vector<unsigned long> nElem_Type;
+  vector<unsigned short> nNode_Type;
+  vector<const unsigned short *> Map_Type;
+  int32_t zoneType;
+  unsigned short nNode_Cell;
+  
+  if (surf_sol) {
+    Data    = Parallel_Surf_Data;
+    myPoint = nSurf_Poin_Par;
+    if (nDim == 2) {
+      zoneType = ZONETYPE_FELINESEG; nNode_Cell = N_POINTS_LINE;
+      Conn.push_back(Conn_BoundLine_Par); nElem_Type.push_back(nParallel_Line);
+      nNode_Type.push_back(N_POINTS_LINE); Map_Type.push_back(Map_Line);
+    } else {
+      zoneType = ZONETYPE_FEQUADRILATERAL; nNode_Cell = N_POINTS_QUADRILATERAL;
+      Conn.push_back(Conn_BoundTria_Par); nElem_Type.push_back(nParallel_BoundTria);
+      nNode_Type.push_back(N_POINTS_TRIANGLE); Map_Type.push_back(Map_Tria);
+      Conn.push_back(Conn_BoundQuad_Par); nElem_Type.push_back(nParallel_BoundQuad);
+      nNode_Type.push_back(N_POINTS_QUADRILATERAL); Map_Type.push_back(Map_Quad);
+    }
+  } else {
+    Data    = Parallel_Data;
+    myPoint = nParallel_Poin;
+    if (nDim == 2) {
+      zoneType = ZONETYPE_FEQUADRILATERAL; nNode_Cell = N_POINTS_QUADRILATERAL;
+      Conn.push_back(Conn_Tria_Par); nElem_Type.push_back(nParallel_Tria);
+      nNode_Type.push_back(N_POINTS_TRIANGLE); Map_Type.push_back(Map_Tria);
+      Conn.push_back(Conn_Quad_Par); nElem_Type.push_back(nParallel_Quad);
+      nNode_Type.push_back(N_POINTS_QUADRILATERAL); Map_Type.push_back(Map_Quad);
+    } else {
+      zoneType = ZONETYPE_FEBRICK; nNode_Cell = N_POINTS_HEXAHEDRON;
+      Conn.push_back(Conn_Tetr_Par); nElem_Type.push_back(nParallel_Tetr);
+      nNode_Type.push_back(N_POINTS_TETRAHEDRON); Map_Type.push_back(Map_Tetr);
+      Conn.push_back(Conn_Hexa_Par); nElem_Type.push_back(nParallel_Hexa);
+      nNode_Type.push_back(N_POINTS_HEXAHEDRON); Map_Type.push_back(Map_Hexa);
+      Conn.push_back(Conn_Pris_Par); nElem_Type.push_back(nParallel_Pris);
+      nNode_Type.push_back(N_POINTS_PRISM); Map_Type.push_back(Map_Pris);
+      Conn.push_back(Conn_Pyra_Par); nElem_Type.push_back(nParallel_Pyra);
+      nNode_Type.push_back(N_POINTS_PYRAMID); Map_Type.push_back(Map_Pyra);
+    }
+  }
+  
+  unsigned long myElem = 0;
+  for (iType = 0; iType < Conn.size(); iType++) myElem += nElem_Type[iType];
+  
+  /*--- The sorted points are linearly partitioned, the points of rank r start at
+   PointBefore[r]. Every rank with points or elements writes one partition. ---*/
+  
+  unsigned long myCount[2] = {myPoint, myElem};
+  vector<unsigned long> allCount(2*size), PointBefore(size+1, 0);
+#ifdef HAVE_MPI
+  SU2_MPI::Allgather(myCount, 2, MPI_UNSIGNED_LONG, allCount.data(), 2, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+#else
+  allCount[0] = myCount[0]; allCount[1] = myCount[1];
+#endif
+  
+  unsigned long GlobalElem = 0;
+  vector<int32_t> Partition(size, 0), Partition_Rank;
+  for (iRank = 0; iRank < size; iRank++) {
+    PointBefore[iRank+1] = PointBefore[iRank] + allCount[2*iRank];
+    GlobalElem += allCount[2*iRank+1];
+    if (allCount[2*iRank] + allCount[2*iRank+1] > 0) {
+      Partition_Rank.push_back(iRank);
+      Partition[iRank] = Partition_Rank.size();
+    }
+  }
+  
+  const unsigned long myBegin = PointBefore[rank], myEnd = PointBefore[rank+1];
+  
+  /*--- Nodes of the local elements owned by other ranks (ghost nodes), sorted,
+   so that they are grouped by their owner. ---*/
+  
+  vector<unsigned long> Ghost_Global;
+  for (iType = 0; iType < Conn.size(); iType++) {
+    for (iConn = 0; iConn < nElem_Type[iType]*nNode_Type[iType]; iConn++) {
+      GlobalIndex = Conn[iType][iConn]-1;
+      if ((GlobalIndex < myBegin) || (GlobalIndex >= myEnd)) Ghost_Global.push_back(GlobalIndex);
+    }
+  }
+  sort(Ghost_Global.begin(), Ghost_Global.end());
+  Ghost_Global.erase(unique(Ghost_Global.begin(), Ghost_Global.end()), Ghost_Global.end());
+  
+  const unsigned long nGhost = Ghost_Global.size();
+  
+  /*--- Values of the partition, the owned points followed by the ghost points ---*/
+  
+  vector<double> Values((myPoint+nGhost)*nVar_Par);
+  for (iPoint = 0; iPoint < myPoint; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Values[iVar*(myPoint+nGhost)+iPoint] = SU2_TYPE::GetValue(Data[iVar][iPoint]);
+  
+  vector<int32_t> Ghost_Node(nGhost), Ghost_Partition(nGhost), Ghost_Partition_Node(nGhost);
+  
+#ifdef HAVE_MPI
+  
+  /*--- Ask the owners for the values of the ghost points ---*/
+  
+  vector<int> nGhost_Send(size, 0), nGhost_Recv(size, 0);
+  vector<int> Ghost_Owner(nGhost);
+  for (iGhost = 0; iGhost < nGhost; iGhost++) {
+    Ghost_Owner[iGhost] = int(upper_bound(PointBefore.begin(), PointBefore.end(), Ghost_Global[iGhost]) - PointBefore.begin()) - 1;
+    nGhost_Send[Ghost_Owner[iGhost]]++;
+  }
+  
+  SU2_MPI::Alltoall(nGhost_Send.data(), 1, MPI_INT, nGhost_Recv.data(), 1, MPI_INT, MPI_COMM_WORLD);
+  
+  vector<unsigned long> Send_Begin(size+1, 0), Recv_Begin(size+1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    Send_Begin[iRank+1] = Send_Begin[iRank] + nGhost_Send[iRank];
+    Recv_Begin[iRank+1] = Recv_Begin[iRank] + nGhost_Recv[iRank];
+  }
+  
+  vector<unsigned long> Request_Index(Recv_Begin[size]);
+  vector<SU2_MPI::Request> Requests;
+  SU2_MPI::Request request;
+  
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nGhost_Recv[iRank] > 0) {
+      SU2_MPI::Irecv(&Request_Index[Recv_Begin[iRank]], nGhost_Recv[iRank], MPI_UNSIGNED_LONG, iRank, iRank, MPI_COMM_WORLD, &request);
+      Requests.push_back(request);
+    }
+    if (nGhost_Send[iRank] > 0) {
+      SU2_MPI::Isend(&Ghost_Global[Send_Begin[iRank]], nGhost_Send[iRank], MPI_UNSIGNED_LONG, iRank, rank, MPI_COMM_WORLD, &request);
+      Requests.push_back(request);
+    }
+  }
+  if (!Requests.empty()) SU2_MPI::Waitall(Requests.size(), Requests.data(), MPI_STATUSES_IGNORE);
+  Requests.clear();
+  
+  /*--- Reply with the values of the requested points ---*/
+  
+  /*--- The values are passive doubles, they bypass the datatype conversion of
+   the AD and single precision wrappers. ---*/
+  
+  vector<double> Reply_Data(Recv_Begin[size]*nVar_Par), Ghost_Data(nGhost*nVar_Par);
+  for (iPoint = 0; iPoint < Recv_Begin[size]; iPoint++)
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Reply_Data[iPoint*nVar_Par+iVar] = SU2_TYPE::GetValue(Data[iVar][Request_Index[iPoint]-myBegin]);
+  
+  vector<CBaseMPIWrapper::Request> Data_Requests;
+  CBaseMPIWrapper::Request data_request;
+  
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nGhost_Send[iRank] > 0) {
+      CBaseMPIWrapper::Irecv(&Ghost_Data[Send_Begin[iRank]*nVar_Par], nGhost_Send[iRank]*nVar_Par, MPI_DOUBLE, iRank, iRank, MPI_COMM_WORLD, &data_request);
+      Data_Requests.push_back(data_request);
+    }
+    if (nGhost_Recv[iRank] > 0) {
+      CBaseMPIWrapper::Isend(&Reply_Data[Recv_Begin[iRank]*nVar_Par], nGhost_Recv[iRank]*nVar_Par, MPI_DOUBLE, iRank, rank, MPI_COMM_WORLD, &data_request);
+      Data_Requests.push_back(data_request);
+    }
+  }
+  if (!Data_Requests.empty()) CBaseMPIWrapper::Waitall(Data_Requests.size(), Data_Requests.data(), MPI_STATUSES_IGNORE);
+  
+  /*--- Ghost points of the partition: local index (after the owned points), owning
+   partition and index in the owning partition, all one based ---*/
+  
+  for (iGhost = 0; iGhost < nGhost; iGhost++) {
+    Ghost_Node[iGhost]           = int32_t(myPoint + iGhost + 1);
+    Ghost_Partition[iGhost]      = Partition[Ghost_Owner[iGhost]];
+    Ghost_Partition_Node[iGhost] = int32_t(Ghost_Global[iGhost] - PointBefore[Ghost_Owner[iGhost]] + 1);
+    for (iVar = 0; iVar < nVar_Par; iVar++)
+      Values[iVar*(myPoint+nGhost)+myPoint+iGhost] = Ghost_Data[iGhost*nVar_Par+iVar];
+  }
+  
+#endif
+  
+  /*--- Cell connectivity in the one based numbering of the partition ---*/
+  
+  vector<int32_t> Cell_Nodes(myElem*nNode_Cell);
+  iConn = 0;
+  for (iType = 0; iType < Conn.size(); iType++) {
+    for (iElem = 0; iElem < nElem_Type[iType]; iElem++) {
+      for (iNode = 0; iNode < nNode_Cell; iNode++) {
+        GlobalIndex = Conn[iType][iElem*nNode_Type[iType]+Map_Type[iType][iNode]]-1;
+        if ((GlobalIndex >= myBegin) && (GlobalIndex < myEnd))
+          Cell_Nodes[iConn++] = int32_t(GlobalIndex - myBegin + 1);
+        else
+          Cell_Nodes[iConn++] = int32_t(myPoint + (lower_bound(Ghost_Global.begin(), Ghost_Global.end(), GlobalIndex) - Ghost_Global.begin()) + 1);
+      }
+    }
+  }
+  
+  /*--- Open the file (all ranks) and create the zone. The coordinates have the
+   default precision of the output, the fields their own; the quantized fields
+   are written in single precision, the file is compressed by TecIO. ---*/
+  
+  string variables;
+  vector<int32_t> Var_Type(nVar_Par);
+  su2double error;
+  for (iVar = 0; iVar < nVar_Par; iVar++) {
+    string name = Variable_Names[iVar];
+    name.erase(remove(name.begin(), name.end(), '"'), name.end());
+    variables += (iVar > 0 ? "," : "") + name;
+    unsigned short precision = (iVar < nDim) ? config->GetOutput_Precision() : config->GetOutput_Precision(name, error);
+    Var_Type[iVar] = (precision == OUTPUT_DOUBLE) ? FieldDataType_Double : FieldDataType_Float;
+  }
+  
+  string title = surf_sol ? "Visualization of the surface solution" : "Visualization of the volumetric solution";
+  
+  void *file_handle = NULL;
+  int32_t zone = 0, partition = 0;
+  
+  err = tecFileWriterOpen(cstr, title.c_str(), variables.c_str(), 1, 0, 2, NULL, &file_handle);
+  
+#ifdef HAVE_MPI
+  if (err == 0) err = tecMPIInitialize(file_handle, MPI_COMM_WORLD, MASTER_NODE);
+#endif
+  
+  if (err == 0) err = tecZoneCreateFE(file_handle, "Zone", zoneType, PointBefore[size], GlobalElem,
+                                      Var_Type.data(), NULL, NULL, NULL, 0, 0, 0, &zone);
+  
+  if (err == 0) {
+    if (config->GetUnsteady_Simulation() && config->GetWrt_Unsteady() && config->GetUnsteady_Simulation() != HARMONIC_BALANCE) {
+      err = tecZoneSetUnsteadyOptions(file_handle, zone, SU2_TYPE::GetValue(config->GetDelta_UnstTime()*iExtIter), SU2_TYPE::Int(iExtIter+1));
+    } else if (config->GetUnsteady_Simulation() == HARMONIC_BALANCE) {
+      su2double period = config->GetHarmonicBalance_Period();
+      su2double deltaT = period/(su2double)(config->GetnTimeInstances());
+      err = tecZoneSetUnsteadyOptions(file_handle, zone, SU2_TYPE::GetValue(deltaT*val_iZone), SU2_TYPE::Int(val_iZone+1));
+    }
+  }
+  
+  /*--- Every rank writes its partition, the master rank assembles the file ---*/
+  
+#ifdef HAVE_MPI
+  if (err == 0) err = tecZoneMapPartitionsToMPIRanks(file_handle, zone, Partition_Rank.size(), Partition_Rank.data());
+  partition = Partition[rank];
+  if ((err == 0) && (partition > 0))
+    err = tecFEPartitionCreate32(file_handle, zone, partition, myPoint+nGhost, myElem,
+                                 nGhost, Ghost_Node.data(), Ghost_Partition.data(), Ghost_Partition_Node.data(), 0, NULL);
+  if (partition > 0)
+#endif
+  {
+    vector<float> Float_Values;
+    for (iVar = 0; (iVar < nVar_Par) && (err == 0); iVar++) {
+      if (Var_Type[iVar] == FieldDataType_Double) {
+        err = tecZoneVarWriteDoubleValues(file_handle, zone, iVar+1, partition, myPoint+nGhost, &Values[iVar*(myPoint+nGhost)]);
+      } else {
+        Float_Values.assign(Values.begin()+iVar*(myPoint+nGhost), Values.begin()+(iVar+1)*(myPoint+nGhost));
+        err = tecZoneVarWriteFloatValues(file_handle, zone, iVar+1, partition, myPoint+nGhost, Float_Values.data());
+      }
+    }
+    if (err == 0) err = tecZoneNodeMapWrite32(file_handle, zone, partition, 1, Cell_Nodes.size(), Cell_Nodes.data());
+  }
+  
+  if (err == 0) err = tecFileWriterClose(&file_handle);
+  
+  if (err != 0)
+    SU2_MPI::Error(string("Unable to write the Tecplot binary file ") + cstr, CURRENT_FUNCTION);
+  
+#else
+  
+  /*--- Without TecIO the ASCII file is written instead ---*/
+  
+  if (rank == MASTER_NODE) cout << "SU2 was built without TecIO, writing a Tecplot ASCII file instead." << endl;
+  WriteTecplotASCII_Parallel(config, geometry, solver, val_iZone, val_nZone, val_iInst, val_nInst, surf_sol);
+  
+#endif
+  
+}
+
 void COutput::SetTecplotBinary_DomainMesh(CConfig *config, CGeometry *geometry, unsigned short val_iZone) {
   
 #ifdef HAVE_TECIO
@@ -331,7 +331,7 @@ su2double CDriver::GetVertexCoordZ(unsigned short iMarker, unsigned short iVerte
 
 }
 
-bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned short iVertex) {
+bool CDriver::ComputeVertexForces(unsigned short iMarker, unsigned long iVertex) {
 
   unsigned long iPoint;
   unsigned short iDim, jDim;
@@ -501,7 +501,7 @@ su2double CDriver::SetVertexVarCoord(unsigned short iMarker, unsigned short iVer
 
 }
 
-su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   su2double vertexWallTemp(0.0);
@@ -518,12 +518,12 @@ su2double CDriver::GetVertexTemperature(unsigned short iMarker, unsigned short i
 
 }
 
-void CDriver::SetVertexTemperature(unsigned short iMarker, unsigned short iVertex, su2double val_WallTemp){
+void CDriver::SetVertexTemperature(unsigned short iMarker, unsigned long iVertex, su2double val_WallTemp){
 
   geometry_container[ZONE_0][INST_0][MESH_0]->SetCustomBoundaryTemperature(iMarker, iVertex, val_WallTemp);
 }
 
-bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned short iVertex){
+bool CDriver::ComputeVertexHeatFluxes(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   unsigned short iDim;
@@ -574,7 +574,7 @@ su2double CDriver::GetVertexHeatFluxZ(unsigned short iMarker, unsigned short iVe
   return PyWrapNodalHeatFlux[2];
 }
 
-su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex){
+su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex){
 
   unsigned long iPoint;
   unsigned short iDim;
@@ -619,7 +619,7 @@ su2double CDriver::GetVertexNormalHeatFlux(unsigned short iMarker, unsigned shor
   return vertexWallHeatFlux;
 }
 
-void CDriver::SetVertexNormalHeatFlux(unsigned short iMarker, unsigned short iVertex, su2double val_WallHeatFlux){
+void CDriver::SetVertexNormalHeatFlux(unsigned short iMarker, unsigned long iVertex, su2double val_WallHeatFlux){
 
   geometry_container[ZONE_0][INST_0][MESH_0]->SetCustomBoundaryHeatFlux(iMarker, iVertex, val_WallHeatFlux);
 }
@@ -664,6 +664,146 @@ vector<su2double> CDriver::GetVertexUnitNormal(unsigned short iMarker, unsigned
 
 }
 
+void CDriver::GetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex, iPoint;
+  unsigned short iDim;
+  su2double *Coord;
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  if ((unsigned long)nValues != geometry->GetnVertex(iMarker)*nDim)
+    SU2_MPI::Error("The size of the array must be the number of vertices times the number of dimensions.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    Coord = geometry->node[iPoint]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++) values[iVertex*nDim+iDim] = Coord[iDim];
+  }
+
+}
+
+void CDriver::SetMarkerCoordinates(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex, iPoint;
+  unsigned short iDim;
+  su2double *Coord, VarCoord[3] = {0.0, 0.0, 0.0};
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  if ((unsigned long)nValues != geometry->GetnVertex(iMarker)*nDim)
+    SU2_MPI::Error("The size of the array must be the number of vertices times the number of dimensions.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+    Coord = geometry->node[iPoint]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++) VarCoord[iDim] = values[iVertex*nDim+iDim] - Coord[iDim];
+    geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+
+}
+
+void CDriver::SetMarkerDisplacements(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned short iDim;
+  su2double VarCoord[3] = {0.0, 0.0, 0.0};
+  CGeometry *geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+
+  if ((unsigned long)nValues != geometry->GetnVertex(iMarker)*nDim)
+    SU2_MPI::Error("The size of the array must be the number of vertices times the number of dimensions.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+    for (iDim = 0; iDim < nDim; iDim++) VarCoord[iDim] = values[iVertex*nDim+iDim];
+    geometry->vertex[iMarker][iVertex]->SetVarCoord(VarCoord);
+  }
+
+}
+
+void CDriver::GetMarkerForces(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned short iDim;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  if ((unsigned long)nValues != nVertex*nDim)
+    SU2_MPI::Error("The size of the array must be the number of vertices times the number of dimensions.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    bool halo = ComputeVertexForces(iMarker, iVertex);
+    for (iDim = 0; iDim < nDim; iDim++) values[iVertex*nDim+iDim] = halo? 0.0 : PyWrapNodalForce[iDim];
+  }
+
+}
+
+void CDriver::GetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  if ((unsigned long)nValues != nVertex)
+    SU2_MPI::Error("The size of the array must be the number of vertices.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexTemperature(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerTemperatures(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  if ((unsigned long)nValues != nVertex)
+    SU2_MPI::Error("The size of the array must be the number of vertices.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    SetVertexTemperature(iMarker, iVertex, values[iVertex]);
+
+}
+
+void CDriver::GetMarkerHeatFluxes(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned short iDim;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+  bool compressible = (config_container[ZONE_0]->GetKind_Regime() == COMPRESSIBLE);
+
+  if ((unsigned long)nValues != nVertex*nDim)
+    SU2_MPI::Error("The size of the array must be the number of vertices times the number of dimensions.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++) {
+    bool halo = ComputeVertexHeatFluxes(iMarker, iVertex);
+    for (iDim = 0; iDim < nDim; iDim++)
+      values[iVertex*nDim+iDim] = (halo || !compressible)? 0.0 : PyWrapNodalHeatFlux[iDim];
+  }
+
+}
+
+void CDriver::GetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  if ((unsigned long)nValues != nVertex)
+    SU2_MPI::Error("The size of the array must be the number of vertices.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    values[iVertex] = GetVertexNormalHeatFlux(iMarker, iVertex);
+
+}
+
+void CDriver::SetMarkerNormalHeatFluxes(unsigned short iMarker, su2double *values, int nValues) {
+
+  unsigned long iVertex;
+  unsigned long nVertex = geometry_container[ZONE_0][INST_0][MESH_0]->GetnVertex(iMarker);
+
+  if ((unsigned long)nValues != nVertex)
+    SU2_MPI::Error("The size of the array must be the number of vertices.", CURRENT_FUNCTION);
+
+  for (iVertex = 0; iVertex < nVertex; iVertex++)
+    SetVertexNormalHeatFlux(iMarker, iVertex, values[iVertex]);
+
+}
+
 vector<string> CDriver::GetAllBoundaryMarkersTag(){
 
   vector<string> boundariesTagList;
@@ -55,6 +55,7 @@ CAdjEulerSolver::CAdjEulerSolver(void) : CSolver() {
   FlowPrimVar_j = NULL;
   DonorAdjVar = NULL;
   DonorGlobalIndex = NULL;
+  Primal_Precond_Ready = false;
 
 }
 
@@ -97,6 +98,7 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   FlowPrimVar_j = NULL;
   DonorAdjVar = NULL;
   DonorGlobalIndex = NULL;
+  Primal_Precond_Ready = false;
 
   /*--- Set the gamma value ---*/
   Gamma = config->GetGamma();
@@ -118,7 +120,7 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
   
   /*--- Define some auxiliary vectors related to the residual ---*/
   Residual = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]      = 0.0;
-  Residual_RMS = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+  Residual_RMS = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
   Residual_Max = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
   Point_Max = new unsigned long[nVar];  for (iVar = 0; iVar < nVar; iVar++) Point_Max[iVar]  = 0;
   Point_Max_Coord = new su2double*[nVar];
@@ -181,9 +183,19 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
       Jacobian_jj[iVar] = new su2double [nVar];
     }
     
-    if (rank == MASTER_NODE)
-      cout << "Initialize Jacobian structure (Adjoint Euler). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    /*--- The transposed Jacobian of the flow solver may stand in for the one of the adjoint,
+     which is then not allocated and, frozen, ignores the assembly ---*/
+    
+    if (config->GetCont_Adj_Primal_Jacobian()) {
+      if (rank == MASTER_NODE)
+        cout << "Use the transposed flow Jacobian (Adjoint Euler). MG level: " << iMesh <<"." << endl;
+      Jacobian.SetFrozen(true);
+    }
+    else {
+      if (rank == MASTER_NODE)
+        cout << "Initialize Jacobian structure (Adjoint Euler). MG level: " << iMesh <<"." << endl;
+      Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    }
     
     if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
@@ -340,7 +352,7 @@ CAdjEulerSolver::CAdjEulerSolver(CGeometry *geometry, CConfig *config, unsigned
 
 #ifdef HAVE_MPI
   Area_Monitored = 0.0;
-  SU2_MPI::Allreduce(&myArea_Monitored, &Area_Monitored, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&myArea_Monitored, &Area_Monitored, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
   Area_Monitored = myArea_Monitored;
 #endif
@@ -459,8 +471,8 @@ void CAdjEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -576,8 +588,8 @@ void CAdjEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config)
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -692,8 +704,8 @@ void CAdjEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *con
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_Limit, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -813,8 +825,8 @@ void CAdjEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *co
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_Gradient, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -931,8 +943,8 @@ void CAdjEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -1045,8 +1057,8 @@ void CAdjEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_Lambda, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -1078,311 +1090,34 @@ void CAdjEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
 
 void CAdjEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
   
-  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
-  Buffer_Send_nPointTotal = 0, iGlobalIndex, iGlobal;
-  unsigned short iVar, iMarker, jMarker;
-  long nDomain = 0, iDomain, jDomain;
-
-#ifdef HAVE_MPI
-  
-  /*--- MPI status and request arrays for non-blocking communications ---*/
-  
-  SU2_MPI::Status status, status_;
-  
-
-#endif
-  
-  /*--- Define buffer vector interior domain ---*/
-  
-  su2double        *Buffer_Send_AdjVar          = NULL;
-  su2double        *iAdjVar          = new su2double [nVar];
-  
-  unsigned long *nPointTotal_s = new unsigned long[size];
-  unsigned long *nPointTotal_r = new unsigned long[size];
-  
-  unsigned long Buffer_Size_AdjVar          = 0;
-  unsigned long PointTotal_Counter = 0;
-  
-  /*--- Allocate the memory that we only need if we have MPI support ---*/
-  
-  su2double        *Buffer_Receive_AdjVar          = NULL;
-  
-  /*--- Basic dimensionalization ---*/
-  
-  nDomain = size;
-  
-  /*--- This loop gets the array sizes of points for each
-   rank to send to each other rank. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- Loop over the markers to perform the dimensionalizaton
-     of the domain variables ---*/
-    
-    Buffer_Send_nPointTotal = 0;
-    
-    /*--- Loop over all of the markers and count the number of each
-     type of point and element that needs to be sent. ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            Buffer_Send_nPointTotal++;
-          }
-        }
-      }
-    }
-    
-    /*--- Store the counts on a partition by partition basis. ---*/
-    
-    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
-    
-    /*--- Total counts for allocating send buffers below ---*/
-    
-    Buffer_Size_AdjVar          += nPointTotal_s[iDomain]*(nVar+3);
-    
-  }
-  
-  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
-  
-  Buffer_Send_AdjVar          = new su2double[Buffer_Size_AdjVar];
-  
-  /*--- Now that we know the sizes of the point, we can
-   allocate and send the information in large chunks to all processors. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- A rank does not communicate with itself through MPI ---*/
-    
-    if (rank != iDomain) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
-      
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
-      
-#endif
-      
-    } else {
-      
-      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
-      
-      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
-      
-    }
-    
-    /*--- Receive the counts. All processors are sending their counters to
-     iDomain up above, so only iDomain needs to perform the recv here from
-     all other ranks. ---*/
-    
-    if (rank == iDomain) {
-      
-      for (jDomain = 0; jDomain < size; jDomain++) {
-        
-        /*--- A rank does not communicate with itself through MPI ---*/
-        
-        if (rank != jDomain) {
-          
-#ifdef HAVE_MPI
-          
-          /*--- Recv the data by probing for the current sender, jDomain,
-           first and then receiving the values from it. ---*/
-          
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
-          
-#endif
-          
-        }
-      }
-      
-    }
-  }
-  
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  unsigned long iPoint, iVertex, iSend, iRecv;
+  unsigned short iVar, iMarker;
   
-#endif
+  /*--- Exchange with the pattern set up by the matching of the disk sides ---*/
   
-  /*--- Initialize the counters for the larger send buffers (by domain) ---*/
+  unsigned long nSend = geometry->GetnVertex_ActDiskSend();
+  unsigned long nRecv = geometry->GetnVertex_ActDiskRecv();
   
-  PointTotal_Counter  = 0;
+  vector<su2double> Buffer_Send_AdjVar(nSend*nVar), Buffer_Receive_AdjVar(nRecv*nVar);
   
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- Set the value of the interior geometry. Initialize counters. ---*/
-    
-    iPointTotal = 0;
-    
-    /*--- Load up the actual values into the buffers for sending. ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            
-            iGlobalIndex = geometry->node[iPoint]->GetGlobalIndex();
-            jVertex = geometry->vertex[iMarker][iVertex]->GetDonorVertex();
-            jMarker = geometry->vertex[iMarker][iVertex]->GetDonorMarker();
-            
-            for (iVar = 0; iVar < nVar; iVar++) {
-              Buffer_Send_AdjVar[(nVar+3)*(PointTotal_Counter+iPointTotal)+iVar] = node[iPoint]->GetSolution(iVar);
-            }
-            Buffer_Send_AdjVar[(nVar+3)*(PointTotal_Counter+iPointTotal)+(nVar+0)]  = su2double(iGlobalIndex);
-            Buffer_Send_AdjVar[(nVar+3)*(PointTotal_Counter+iPointTotal)+(nVar+1)] = su2double(jVertex);
-            Buffer_Send_AdjVar[(nVar+3)*(PointTotal_Counter+iPointTotal)+(nVar+2)]  = su2double(jMarker);
-            
-            iPointTotal++;
-            
-          }
-          
-        }
-        
-      }
-      
-    }
-    
-    /*--- Send the buffers with the geometrical information ---*/
-    
-    if (iDomain != rank) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Communicate the coordinates, global index, colors, and element
-       date to iDomain with non-blocking sends. ---*/
-      
-      SU2_MPI::Bsend(&Buffer_Send_AdjVar[PointTotal_Counter*(nVar+3)],
-                     nPointTotal_s[iDomain]*(nVar+3), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
-      
-#endif
-      
-    }
-    
-    else {
-      
-      /*--- Allocate local memory for the local recv of the elements ---*/
-      
-      Buffer_Receive_AdjVar            = new su2double[nPointTotal_s[iDomain]*(nVar+3)];
-      
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(nVar+3); iter++)
-        Buffer_Receive_AdjVar[iter] = Buffer_Send_AdjVar[PointTotal_Counter*(nVar+3)+iter];
-      
-      /*--- Recv the point data from ourselves (same procedure as above) ---*/
-      
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-        
-        iGlobal       =  SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+0)]);
-        iVertex      = SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+1)]);
-        iMarker      = SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+2)]);
-        for (iVar = 0; iVar < nVar; iVar++)
-          iAdjVar[iVar] = Buffer_Receive_AdjVar[iPoint*(nVar+3)+iVar];
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          SetDonorAdjVar(iMarker, iVertex, iVar, iAdjVar[iVar]);
-        
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-        
-      }
-      
-      /*--- Delete memory for recv the point stuff ---*/
-      
-      delete [] Buffer_Receive_AdjVar;
-      
-    }
-    
-    /*--- Increment the counters for the send buffers (iDomain loop) ---*/
-    
-    PointTotal_Counter += iPointTotal;
-    
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetPoint_ActDiskSend(iSend);
+    for (iVar = 0; iVar < nVar; iVar++)
+      Buffer_Send_AdjVar[nVar*iSend+iVar] = node[iPoint]->GetSolution(iVar);
   }
   
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
+  geometry->ExchangeActDisk(nVar, Buffer_Send_AdjVar.data(), Buffer_Receive_AdjVar.data());
   
-#endif
+  /*--- Store the values at the donor vertices ---*/
   
-  /*--- The next section begins the recv of all data for the interior
-   points/elements in the mesh. First, create the domain structures for
-   the points on this rank. First, we recv all of the point data ---*/
-  
-  for (iDomain = 0; iDomain < size; iDomain++) {
-    
-    if (rank != iDomain) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Allocate the receive buffer vector. Send the colors so that we
-       know whether what we recv is an owned or halo node. ---*/
-      
-      Buffer_Receive_AdjVar            = new su2double [nPointTotal_r[iDomain]*nVar];
-      
-      /*--- Receive the buffers with the coords, global index, and colors ---*/
-      
-      SU2_MPI::Recv(Buffer_Receive_AdjVar, nPointTotal_r[iDomain]*(nVar+3) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status_);
-      
-      /*--- Loop over all of the points that we have recv'd and store the
-       coords, global index vertex and markers ---*/
-      
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-        
-        iGlobal      = SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+0)]);
-        iVertex      = SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+1)]);
-        iMarker      = SU2_TYPE::Int(Buffer_Receive_AdjVar[iPoint*(nVar+3)+(nVar+2)]);
-        for (iVar = 0; iVar < nVar; iVar++)
-          iAdjVar[iVar] = Buffer_Receive_AdjVar[iPoint*(nVar+3)+iVar];
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          SetDonorAdjVar(iMarker, iVertex, iVar, iAdjVar[iVar]);
-        
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-        
-      }
-      
-      /*--- Delete memory for recv the point stuff ---*/
-      
-      delete [] Buffer_Receive_AdjVar;
-      
-#endif
-      
-    }
-    
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iMarker = geometry->GetMarker_ActDiskRecv(iRecv);
+    iVertex = geometry->GetVertex_ActDiskRecv(iRecv);
+    for (iVar = 0; iVar < nVar; iVar++)
+      SetDonorAdjVar(iMarker, iVertex, iVar, Buffer_Receive_AdjVar[nVar*iRecv+iVar]);
+    SetDonorGlobalIndex(iMarker, iVertex, geometry->GetGlobalIndex_ActDiskRecv(iRecv));
   }
   
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-  
-#endif
-  
-  /*--- Free all of the memory used for communicating points and elements ---*/
-  
-  delete[] Buffer_Send_AdjVar;
-  
-  /*--- Release all of the temporary memory ---*/
-  
-  delete [] nPointTotal_s;
-  delete [] nPointTotal_r;
-  delete [] iAdjVar;
-  
 }
 
 void CAdjEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
@@ -1579,7 +1314,7 @@ void CAdjEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
        date to iDomain with non-blocking sends. ---*/
       
       SU2_MPI::Bsend(&Buffer_Send_AdjVar[PointTotal_Counter*(nVar+3)],
-                     nPointTotal_s[iDomain]*(nVar+3), MPI_DOUBLE, iDomain,
+                     nPointTotal_s[iDomain]*(nVar+3), MPI_SU2DOUBLE, iDomain,
                      iDomain,  MPI_COMM_WORLD);
       
 #endif
@@ -1649,7 +1384,7 @@ void CAdjEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
       
       /*--- Receive the buffers with the coords, global index, and colors ---*/
       
-      SU2_MPI::Recv(Buffer_Receive_AdjVar, nPointTotal_r[iDomain]*(nVar+3) , MPI_DOUBLE,
+      SU2_MPI::Recv(Buffer_Receive_AdjVar, nPointTotal_r[iDomain]*(nVar+3) , MPI_SU2DOUBLE,
                     iDomain, rank, MPI_COMM_WORLD, &status_);
       
       
@@ -1888,7 +1623,7 @@ void CAdjEulerSolver::Set_MPI_Interface(CGeometry *geometry, CConfig *config) {
        date to iDomain with non-blocking sends. ---*/
       
       SU2_MPI::Bsend(&Buffer_Send_AdjVar[PointTotal_Counter*(nVar+3)],
-                     nPointTotal_s[iDomain]*(nVar+3), MPI_DOUBLE, iDomain,
+                     nPointTotal_s[iDomain]*(nVar+3), MPI_SU2DOUBLE, iDomain,
                      iDomain,  MPI_COMM_WORLD);
       
 #endif
@@ -1958,7 +1693,7 @@ void CAdjEulerSolver::Set_MPI_Interface(CGeometry *geometry, CConfig *config) {
       
       /*--- Receive the buffers with the coords, global index, and colors ---*/
       
-      SU2_MPI::Recv(Buffer_Receive_AdjVar, nPointTotal_r[iDomain]*(nVar+3) , MPI_DOUBLE,
+      SU2_MPI::Recv(Buffer_Receive_AdjVar, nPointTotal_r[iDomain]*(nVar+3) , MPI_SU2DOUBLE,
                     iDomain, rank, MPI_COMM_WORLD, &status_);
       
       
@@ -3213,10 +2948,18 @@ void CAdjEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **sol
     }
   }
   
-  /*--- Solve or smooth the linear system ---*/
+  /*--- Solve or smooth the linear system. The transposed Jacobian of the last flow
+   iteration (it already holds Vol/Delta_Time on its diagonal) may replace the one of the
+   adjoint, its transposed preconditioner is then built once and kept. ---*/
   
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (config->GetCont_Adj_Primal_Jacobian()) {
+    System.Solve(solver_container[FLOW_SOL]->GetJacobian(), LinSysRes, LinSysSol, geometry, config,
+                 NULL, !Primal_Precond_Ready, true);
+    Primal_Precond_Ready = true;
+  }
+  else {
+    System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  }
   
   /*--- Update solution (system written in terms of increments) ---*/
   
@@ -3696,12 +3439,12 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
   su2double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
   su2double MyTotal_Sens_BPress  = Total_Sens_BPress;    Total_Sens_BPress = 0.0;
   
-  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_BPress, &Total_Sens_BPress, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_BPress, &Total_Sens_BPress, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
 #endif
   
@@ -3710,137 +3453,6 @@ void CAdjEulerSolver::Inviscid_Sensitivity(CGeometry *geometry, CSolver **solver
   
 }
 
-void CAdjEulerSolver::Smooth_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) {
-  unsigned short iMarker;
-  unsigned long iVertex, jVertex, nVertex, iPoint;
-  su2double **A, *b, Sens, *ArchLength, *Coord_begin, *Coord_end, dist;
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) == EULER_WALL) {
-      nVertex = geometry->nVertex[iMarker];
-      
-      /*--- Allocate the linear system ---*/
-      
-      A = new su2double* [nVertex];
-      b = new su2double [nVertex];
-      ArchLength = new su2double [nVertex];
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        A[iVertex] = new su2double [nVertex];
-      }
-      
-      /*--- Initialization ---*/
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        b[iVertex] = 0.0; ArchLength[iVertex] = 0.0;
-        for (jVertex = 0; jVertex < nVertex; jVertex++)
-          A[iVertex][jVertex] = 0.0;
-      }
-      
-      /*--- Set the arch length ---*/
-      
-      ArchLength[0] = 0.0;
-      for (iVertex = 1; iVertex < nVertex; iVertex++) {
-        iPoint = geometry->vertex[iMarker][iVertex-1]->GetNode();
-        Coord_begin = geometry->node[iPoint]->GetCoord();
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-        Coord_end = geometry->node[iPoint]->GetCoord();
-        dist = sqrt (pow( Coord_end[0]-Coord_begin[0], 2.0) + pow( Coord_end[1]-Coord_begin[1], 2.0));
-        ArchLength[iVertex] = ArchLength[iVertex-1] + dist;
-      }
-      
-      /*--- Remove the trailing edge effect ---*/
-      
-      su2double MinPosSens = 0.0; su2double MinNegSens = 0.0;
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        Sens = CSensitivity[iMarker][iVertex];
-        if (ArchLength[iVertex] > ArchLength[nVertex-1]*0.01) { MinNegSens = Sens; break; }
-      }
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        Sens = CSensitivity[iMarker][iVertex];
-        if (ArchLength[iVertex] > ArchLength[nVertex-1]*0.99) { MinPosSens = Sens; break; }
-      }
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        if (ArchLength[iVertex] < ArchLength[nVertex-1]*0.01)
-          CSensitivity[iMarker][iVertex] = MinNegSens;
-        if (ArchLength[iVertex] > ArchLength[nVertex-1]*0.99)
-          CSensitivity[iMarker][iVertex] = MinPosSens;
-      }
-      
-      /*--- Set the right hand side of the system ---*/
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        b[iVertex] = CSensitivity[iMarker][iVertex];
-      }
-      
-      /*--- Set the mass matrix ---*/
-      
-      su2double Coeff = 0.0, BackDiff = 0.0, ForwDiff = 0.0, CentDiff = 0.0;
-      su2double epsilon = 5E-5;
-      for (iVertex = 0; iVertex < nVertex; iVertex++) {
-        
-        if ((iVertex != nVertex-1) && (iVertex != 0)) {
-          BackDiff = (ArchLength[iVertex]-ArchLength[iVertex-1]);
-          ForwDiff = (ArchLength[iVertex+1]-ArchLength[iVertex]);
-          CentDiff = (ArchLength[iVertex+1]-ArchLength[iVertex-1]);
-        }
-        if (iVertex == nVertex-1) {
-          BackDiff = (ArchLength[nVertex-1]-ArchLength[nVertex-2]);
-          ForwDiff = (ArchLength[0]-ArchLength[nVertex-1]);
-          CentDiff = (ArchLength[0]-ArchLength[nVertex-2]);
-        }
-        if (iVertex == 0) {
-          BackDiff = (ArchLength[0]-ArchLength[nVertex-1]);
-          ForwDiff = (ArchLength[1]-ArchLength[0]);
-          CentDiff = (ArchLength[1]-ArchLength[nVertex-1]);
-        }
-        
-        Coeff = epsilon*2.0/(BackDiff*ForwDiff*CentDiff);
-        
-        A[iVertex][iVertex] = Coeff*CentDiff;
-        
-        if (iVertex != 0) A[iVertex][iVertex-1] = -Coeff*ForwDiff;
-        else A[iVertex][nVertex-1] = -Coeff*ForwDiff;
-        
-        if (iVertex != nVertex-1) A[iVertex][iVertex+1] = -Coeff*BackDiff;
-        else A[iVertex][0] = -Coeff*BackDiff;
-        
-      }
-      
-      /*--- Add the gradient value in the main diagonal ---*/
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++)
-        A[iVertex][iVertex] += 1.0;
-      
-      /*--- Dirichlet boundary condition ---*/
-      
-      unsigned long iVertex = SU2_TYPE::Int(nVertex/2);
-      A[iVertex][iVertex] = 1.0;
-      A[iVertex][iVertex+1] = 0.0;
-      A[iVertex][iVertex-1] = 0.0;
-      
-      Gauss_Elimination(A, b, (unsigned short)nVertex);
-      
-      /*--- Set the new value of the sensitiviy ---*/
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++)
-        CSensitivity[iMarker][iVertex] = b[iVertex];
-      
-      /*--- Deallocate the linear system ---*/
-      
-      for (iVertex = 0; iVertex < nVertex; iVertex++)
-        delete [] A[iVertex];
-      delete [] A;
-      delete [] b;
-      delete [] ArchLength;
-      
-    }
-  }
-  
-  
-}
-
 void CAdjEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_container,
                                       CConfig *config, unsigned short iMesh, bool Output) {
   
@@ -5880,7 +5492,7 @@ CAdjNSSolver::CAdjNSSolver(CGeometry *geometry, CConfig *config, unsigned short
     for (iDim = 0; iDim < nDim; iDim++) Point_Max_Coord[iVar][iDim] = 0.0;
   }
   Residual     = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]     = 0.0;
-  Residual_RMS = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar] = 0.0;
+  Residual_RMS = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar] = 0.0;
   Residual_Max = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar] = 0.0;
   Residual_i   = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]   = 0.0;
   Residual_j   = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]   = 0.0;
@@ -6066,7 +5678,7 @@ CAdjNSSolver::CAdjNSSolver(CGeometry *geometry, CConfig *config, unsigned short
 
  #ifdef HAVE_MPI
    Area_Monitored = 0.0;
-   SU2_MPI::Allreduce(&myArea_Monitored, &Area_Monitored, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+   SU2_MPI::Allreduce(&myArea_Monitored, &Area_Monitored, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
  #else
    Area_Monitored = myArea_Monitored;
  #endif
@@ -6953,11 +6565,11 @@ void CAdjNSSolver::Viscous_Sensitivity(CGeometry *geometry, CSolver **solver_con
   su2double MyTotal_Sens_Press = Total_Sens_Press;   Total_Sens_Press = 0.0;
   su2double MyTotal_Sens_Temp  = Total_Sens_Temp;    Total_Sens_Temp = 0.0;
   
-  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Geo, &Total_Sens_Geo, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Mach, &Total_Sens_Mach, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_AoA, &Total_Sens_AoA, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Press, &Total_Sens_Press, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Sens_Temp, &Total_Sens_Temp, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
 #endif
 
@@ -61,7 +61,7 @@ CAdjTurbSolver::CAdjTurbSolver(CGeometry *geometry, CConfig *config, unsigned sh
   nPoint = geometry->GetnPoint();
   nPointDomain = geometry->GetnPointDomain();
   
-  Residual   = new su2double [nVar]; Residual_RMS = new su2double[nVar];
+  Residual   = new su2double [nVar]; Residual_RMS = new accumdouble[nVar];
   Residual_i = new su2double [nVar]; Residual_j = new su2double [nVar];
   Residual_Max = new su2double [nVar]; Point_Max = new unsigned long[nVar];
   Point_Max_Coord = new su2double*[nVar];
@@ -246,8 +246,8 @@ void CAdjTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-    SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                               Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+    SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                               Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -321,8 +321,8 @@ void CAdjTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config)
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-    SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                               Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+    SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                               Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -402,8 +402,8 @@ void CAdjTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *con
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-    SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                               Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+    SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                               Buffer_Receive_Gradient, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 #else
       
       /*--- Receive information without MPI ---*/
@@ -857,8 +857,7 @@ void CAdjTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
   
   /*--- Solve or smooth the linear system ---*/
   
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   
   /*--- Update solution (system written in terms of increments) ---*/
   
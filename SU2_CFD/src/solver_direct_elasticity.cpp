@@ -52,6 +52,9 @@ CFEASolver::CFEASolver(void) : CSolver() {
   Total_CFEA = 0.0;
   WAitken_Dyn = 0.0;
   WAitken_Dyn_tn1 = 0.0;
+  IQN_Init = false;
+  IQN_HaveOld = false;
+  IQN_TimeStep = 0;
   loadIncrement = 1.0;
   
   element_container = NULL;
@@ -92,13 +95,21 @@ CFEASolver::CFEASolver(void) : CSolver() {
   
   iElem_iDe   = NULL;
   
+  taskThreadPool = NULL;
+  elemLoopChunks = ELEM_STIFF_MATRIX;
+  geometryChunks = NULL;
+  configChunks   = NULL;
+  
+  matrix_free  = false;
+  MatFree_Vec  = NULL;
+  MatFree_Prod = NULL;
+  
 }
 
 CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   
   unsigned long iPoint;
   unsigned short iVar, jVar, iDim, jDim;
-  unsigned short iTerm, iKind;
 
   bool dynamic = (config->GetDynamic_Analysis() == DYNAMIC);              // Dynamic simulations.
   bool nonlinear_analysis = (config->GetGeometricConditions() == LARGE_DEFORMATIONS);  // Nonlinear analysis.
@@ -126,51 +137,7 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   
   /*--- Here is where we assign the kind of each element ---*/
   
-  /*--- First level: different possible terms of the equations ---*/
-  element_container = new CElement** [MAX_TERMS];
-  for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
-    element_container[iTerm] = new CElement* [MAX_FE_KINDS];
-  
-  for (iTerm = 0; iTerm < MAX_TERMS; iTerm++) {
-    for (iKind = 0; iKind < MAX_FE_KINDS; iKind++) {
-      element_container[iTerm][iKind] = NULL;
-    }
-  }
-  
-  if (nDim == 2) {
-    
-      /*--- Basic terms ---*/
-      element_container[FEA_TERM][EL_TRIA] = new CTRIA1(nDim, config);
-      element_container[FEA_TERM][EL_QUAD] = new CQUAD4(nDim, config);
-    
-      if (de_effects){
-        element_container[DE_TERM][EL_TRIA] = new CTRIA1(nDim, config);
-        element_container[DE_TERM][EL_QUAD] = new CQUAD4(nDim, config);
-      }
-
-      if (incompressible){
-        element_container[INC_TERM][EL_TRIA] = new CTRIA1(nDim, config);
-        element_container[INC_TERM][EL_QUAD] = new CQUAD1(nDim, config);
-      }
-
-  }
-  else if (nDim == 3) {
-
-      element_container[FEA_TERM][EL_TETRA] = new CTETRA1(nDim, config);
-      element_container[FEA_TERM][EL_HEXA] = new CHEXA8(nDim, config);
-
-      if (de_effects){
-        element_container[DE_TERM][EL_TETRA] = new CTETRA1(nDim, config);
-        element_container[DE_TERM][EL_HEXA] = new CHEXA8(nDim, config);
-      }
-
-      if (incompressible) {
-        element_container[INC_TERM][EL_TETRA] = new CTETRA1(nDim, config);
-        element_container[INC_TERM][EL_HEXA] = new CHEXA1(nDim, config);
-      }
-
-
-  }
+  element_container = Create_ElementContainer(config);
   
   node              = new CVariable*[nPoint];
   
@@ -186,6 +153,9 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   Total_CFEA      = 0.0;
   WAitken_Dyn       = 0.0;
   WAitken_Dyn_tn1   = 0.0;
+  IQN_Init          = false;
+  IQN_HaveOld       = false;
+  IQN_TimeStep      = 0;
   loadIncrement     = 0.0;
   
   SetFSI_ConvValue(0,0.0);
@@ -196,7 +166,7 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   /*--- Define some auxiliary vectors related to the residual ---*/
   
   Residual = new su2double[nVar];          for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]      = 0.0;
-  Residual_RMS = new su2double[nVar];      for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+  Residual_RMS = new accumdouble[nVar];      for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
   Residual_Max = new su2double[nVar];      for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
   Point_Max = new unsigned long[nVar];  for (iVar = 0; iVar < nVar; iVar++) Point_Max[iVar]     = 0;
   Point_Max_Coord = new su2double*[nVar];
@@ -350,10 +320,22 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   }
   
   
-  /*--- Initialization of matrix structures ---*/
-  if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
+  /*--- Initialization of matrix structures. The matrix-free operator of linear
+   elasticity only keeps the sizes of the system, for the halo exchanges. ---*/
   
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  matrix_free  = config->GetMatrixFree_FEA();
+  MatFree_Vec  = NULL;
+  MatFree_Prod = NULL;
+  
+  if (matrix_free) {
+    if (rank == MASTER_NODE) cout << "Matrix-free stiffness operator (Linear Elasticity)." << endl;
+    Jacobian.Initialize_MatrixFree(nPoint, nPointDomain, nVar, nVar);
+    MatFree_Clamped.assign(nPoint, false);
+  }
+  else {
+    if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Non-Linear Elasticity)." << endl;
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  }
   
   if (dynamic) {
     MassMatrix.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
@@ -456,6 +438,17 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
   /*--- Penalty value - to maintain constant the stiffness in optimization problems - TODO: this has to be improved ---*/
   PenaltyValue = 0.0;
 
+  /*--- Threads and element coloring of the element loops ---*/
+
+  elemLoopChunks = ELEM_STIFF_MATRIX;
+  geometryChunks = NULL;
+  configChunks   = NULL;
+  SetUp_Threads(geometry, config);
+
+  /*--- Gradients of the shape functions in the reference configuration ---*/
+
+  if (config->GetPrecompute_RefGrad_FEA() || matrix_free) Set_RefGradients(geometry, config);
+
   /*--- Perform the MPI communication of the solution ---*/
   
   Set_MPI_Solution(geometry, config);
@@ -468,9 +461,41 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CSolver() {
 
 CFEASolver::~CFEASolver(void) {
   
-  unsigned short iVar, jVar;
+  unsigned short iVar, jVar, iThread;
   unsigned long iElem;
   
+  /*--- Terminate the threads before their elements and numerics are deleted ---*/
+  
+  if (taskThreadPool != NULL) delete taskThreadPool;
+  
+  for (iThread = 0; iThread < Res_Stress_Threads.size(); iThread++) {
+    
+    if (iThread > 0) {
+      for (iVar = 0; iVar < MAX_TERMS; iVar++) {
+        for (jVar = 0; jVar < MAX_FE_KINDS; jVar++) {
+          if (element_container_Threads[iThread][iVar][jVar] != NULL) delete element_container_Threads[iThread][iVar][jVar];
+        }
+        delete [] element_container_Threads[iThread][iVar];
+      }
+      delete [] element_container_Threads[iThread];
+      
+      for (iVar = 0; iVar < MAX_TERMS_FEA; iVar++) {
+        if (numerics_Threads[iThread][iVar] != NULL) delete numerics_Threads[iThread][iVar];
+      }
+      delete [] numerics_Threads[iThread];
+    }
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      delete [] Jacobian_c_Threads[iThread][iVar];
+      delete [] Jacobian_s_Threads[iThread][iVar];
+      delete [] Jacobian_k_Threads[iThread][iVar];
+    }
+    delete [] Jacobian_c_Threads[iThread];
+    delete [] Jacobian_s_Threads[iThread];
+    delete [] Jacobian_k_Threads[iThread];
+    delete [] Res_Stress_Threads[iThread];
+  }
+  
   if (element_container != NULL) {
     for (iVar = 0; iVar < MAX_TERMS; iVar++) {
       for (jVar = 0; jVar < MAX_FE_KINDS; jVar++) {
@@ -572,8 +597,8 @@ void CFEASolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -674,8 +699,8 @@ void CFEASolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -759,8 +784,8 @@ void CFEASolver::Set_MPI_Solution_DispOnly(CGeometry *geometry, CConfig *config)
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -841,8 +866,8 @@ void CFEASolver::Set_MPI_Solution_Pred(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -928,8 +953,8 @@ void CFEASolver::Set_MPI_Solution_Pred_Old(CGeometry *geometry, CConfig *config)
 #ifdef HAVE_MPI
       
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -1239,8 +1264,8 @@ void CFEASolver::Set_Prestretch(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 
 #else
 
@@ -1438,7 +1463,9 @@ void CFEASolver::Preprocessing(CGeometry *geometry, CSolver **solver_container,
       (restart && initial_calc_restart && linear_analysis) ||
       (dynamic && disc_adj_fem) ||
       (dynamic && linear_analysis)) {
+    if (initial_calc || (restart && initial_calc_restart)) Jacobian.SetFrozen(false);
     Jacobian.SetValZero();
+    if (matrix_free) MatFree_Clamped.assign(nPoint, false);
   }
   
   /*
@@ -1579,307 +1606,830 @@ void CFEASolver::ResetInitialCondition(CGeometry **geometry, CSolver ***solver_c
   
 }
 
-void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
-  
-  unsigned long iElem, iVar, jVar;
+CElement ***CFEASolver::Create_ElementContainer(CConfig *config) {
+
+  unsigned short iTerm, iKind;
+
+  bool de_effects = config->GetDE_Effects();
+  bool incompressible = (config->GetMaterialCompressibility() == INCOMPRESSIBLE_MAT);
+
+  /*--- First level: different possible terms of the equations ---*/
+  CElement ***container = new CElement** [MAX_TERMS];
+  for (iTerm = 0; iTerm < MAX_TERMS; iTerm++)
+    container[iTerm] = new CElement* [MAX_FE_KINDS];
+
+  for (iTerm = 0; iTerm < MAX_TERMS; iTerm++) {
+    for (iKind = 0; iKind < MAX_FE_KINDS; iKind++) {
+      container[iTerm][iKind] = NULL;
+    }
+  }
+
+  if (nDim == 2) {
+
+    /*--- Basic terms ---*/
+    container[FEA_TERM][EL_TRIA] = new CTRIA1(nDim, config);
+    container[FEA_TERM][EL_QUAD] = new CQUAD4(nDim, config);
+
+    if (de_effects){
+      container[DE_TERM][EL_TRIA] = new CTRIA1(nDim, config);
+      container[DE_TERM][EL_QUAD] = new CQUAD4(nDim, config);
+    }
+
+    if (incompressible){
+      container[INC_TERM][EL_TRIA] = new CTRIA1(nDim, config);
+      container[INC_TERM][EL_QUAD] = new CQUAD1(nDim, config);
+    }
+
+  }
+  else if (nDim == 3) {
+
+    container[FEA_TERM][EL_TETRA] = new CTETRA1(nDim, config);
+    container[FEA_TERM][EL_HEXA] = new CHEXA8(nDim, config);
+
+    if (de_effects){
+      container[DE_TERM][EL_TETRA] = new CTETRA1(nDim, config);
+      container[DE_TERM][EL_HEXA] = new CHEXA8(nDim, config);
+    }
+
+    if (incompressible) {
+      container[INC_TERM][EL_TETRA] = new CTETRA1(nDim, config);
+      container[INC_TERM][EL_HEXA] = new CHEXA1(nDim, config);
+    }
+
+  }
+
+  return container;
+
+}
+
+CNumerics **CFEASolver::Create_NumericsThread(CConfig *config) {
+
+  unsigned short iTerm;
+
+  bool nonlinear_analysis = (config->GetGeometricConditions() == LARGE_DEFORMATIONS);
+  bool incompressible = (config->GetMaterialCompressibility() == INCOMPRESSIBLE_MAT);
+
+  CNumerics **numerics = new CNumerics* [MAX_TERMS_FEA];
+  for (iTerm = 0; iTerm < MAX_TERMS_FEA; iTerm++) numerics[iTerm] = NULL;
+
+  /*--- Same numerics as defined by the driver, see CDriver::Numerics_Preprocessing.
+   The combinations that are not valid were already rejected there. ---*/
+
+  if (!nonlinear_analysis) {
+    numerics[FEA_TERM] = new CFEALinearElasticity(nDim, nVar, config);
+    return numerics;
+  }
+
+  switch (config->GetMaterialModel()) {
+    case NEO_HOOKEAN:
+      if (incompressible) numerics[FEA_TERM] = new CFEM_NeoHookean_Incomp(nDim, nVar, config);
+      else                numerics[FEA_TERM] = new CFEM_NeoHookean_Comp(nDim, nVar, config);
+      break;
+    case KNOWLES:  numerics[FEA_TERM] = new CFEM_Knowles_NearInc(nDim, nVar, config); break;
+    case IDEAL_DE: numerics[FEA_TERM] = new CFEM_IdealDE(nDim, nVar, config); break;
+  }
+
+  if (config->GetDE_Effects()) numerics[DE_TERM] = new CFEM_DielectricElastomer(nDim, nVar, config);
+
+  if (element_based) {
+    numerics[MAT_NHCOMP]  = new CFEM_NeoHookean_Comp(nDim, nVar, config);
+    numerics[MAT_NHINC]   = new CFEM_NeoHookean_Incomp(nDim, nVar, config);
+    numerics[MAT_IDEALDE] = new CFEM_IdealDE(nDim, nVar, config);
+    numerics[MAT_KNOWLES] = new CFEM_Knowles_NearInc(nDim, nVar, config);
+  }
+
+  return numerics;
+
+}
+
+void CFEASolver::SetUp_Threads(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iThread, iColor, iVar, jVar, nThreads = config->GetnThreads_FEA();
+  unsigned long iChunk, nChunksColor, nElemColor, elemBeg;
+
+  /*--- With more than one thread the elements are colored, such that the elements
+   of one color can be assembled concurrently. The colors are carried out one after
+   the other, each split in more chunks than threads to balance the load. ---*/
+
+  taskThreadPool = NULL;
+  ElemColorChunks.clear();
+
+  if (nThreads > 1) {
+
+    geometry->SetElemColoring();
+
+    taskThreadPool = new CTaskThreadPool(nThreads, ProcessTaskChunk_FEA, this);
+    nThreads = taskThreadPool->GetnThreads();
+
+    if (rank == MASTER_NODE)
+      cout << "Assembly of the elements by " << nThreads << " threads in "
+           << geometry->GetnElemColor() << " element colors." << endl;
+
+    const unsigned long nChunks = 4*nThreads;
+
+    ElemColorChunks.resize(geometry->GetnElemColor());
+    for (iColor = 0; iColor < geometry->GetnElemColor(); iColor++) {
+      elemBeg      = geometry->GetElemColor_Begin(iColor);
+      nElemColor   = geometry->GetElemColor_End(iColor) - elemBeg;
+      nChunksColor = max((unsigned long) 1, min(nChunks, nElemColor));
+      ElemColorChunks[iColor].resize(nChunksColor+1);
+      for (iChunk = 0; iChunk <= nChunksColor; iChunk++)
+        ElemColorChunks[iColor][iChunk] = elemBeg + (iChunk*nElemColor)/nChunksColor;
+    }
+
+    /*--- The same number of threads shares the products and preconditioners of
+     the linear solver of the structure. ---*/
+
+    if (!matrix_free) Jacobian.SetThreads(nThreads);
+  }
+
+  /*--- The elements and the numerics store the element matrices, hence every
+   additional thread gets its own copy. The same holds for the submatrices
+   that are scattered into the Jacobian. ---*/
+
+  element_container_Threads.assign(nThreads, (CElement ***) NULL);
+  numerics_Threads.assign(nThreads, (CNumerics **) NULL);
+  Res_Stress_Threads.assign(nThreads, (su2double *) NULL);
+  Jacobian_c_Threads.assign(nThreads, (su2double **) NULL);
+  Jacobian_s_Threads.assign(nThreads, (su2double **) NULL);
+  Jacobian_k_Threads.assign(nThreads, (su2double **) NULL);
+
+  element_container_Threads[0] = element_container;
+
+  for (iThread = 0; iThread < nThreads; iThread++) {
+
+    if (iThread > 0) {
+      element_container_Threads[iThread] = Create_ElementContainer(config);
+      numerics_Threads[iThread] = Create_NumericsThread(config);
+    }
+
+    Res_Stress_Threads[iThread] = new su2double [nVar];
+    Jacobian_c_Threads[iThread] = new su2double* [nVar];
+    Jacobian_s_Threads[iThread] = new su2double* [nVar];
+    Jacobian_k_Threads[iThread] = new su2double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Res_Stress_Threads[iThread][iVar] = 0.0;
+      Jacobian_c_Threads[iThread][iVar] = new su2double [nVar];
+      Jacobian_s_Threads[iThread][iVar] = new su2double [nVar];
+      Jacobian_k_Threads[iThread][iVar] = new su2double [nVar];
+      for (jVar = 0; jVar < nVar; jVar++) {
+        Jacobian_c_Threads[iThread][iVar][jVar] = 0.0;
+        Jacobian_s_Threads[iThread][iVar][jVar] = 0.0;
+        Jacobian_k_Threads[iThread][iVar][jVar] = 0.0;
+      }
+    }
+  }
+
+}
+
+void CFEASolver::Set_RefGradients(CGeometry *geometry, CConfig *config) {
+
+  unsigned long iElem;
   unsigned short iNode, iDim, nNodes = 0;
-  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord, val_Sol;
   int EL_KIND = 0;
-  
-  su2double *Kab = NULL, *Ta  = NULL;
-  unsigned short NelNodes, jNode;
-  
-  bool topology_mode = config->GetTopology_Optimization();
-  su2double simp_exponent = config->GetSIMP_Exponent();
-  su2double simp_minstiff = config->GetSIMP_MinStiffness();
-  
-  /*--- Loops over all the elements ---*/
-  
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
+
+  /*--- The reference configuration is the undeformed mesh, which does not change
+   during the simulation. The gradients of the shape functions with respect to it
+   are therefore computed once and reused by every element loop. ---*/
+
+  RefGradients_Ptr.assign(nElement+1, 0);
+
+  for (iElem = 0; iElem < nElement; iElem++) {
+
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
     if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
     if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
-    
-    /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-    
+
+    RefGradients_Ptr[iElem+1] = RefGradients_Ptr[iElem] + element_container[FEA_TERM][EL_KIND]->GetnRefGradients();
+  }
+
+  RefGradients.resize(RefGradients_Ptr[nElement]);
+
+  for (iElem = 0; iElem < nElement; iElem++) {
+
+    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
+    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
+    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
+
     for (iNode = 0; iNode < nNodes; iNode++) {
-      
-      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
-      
       for (iDim = 0; iDim < nDim; iDim++) {
-        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
-        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
-        element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-        element_container[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
+        element_container[FEA_TERM][EL_KIND]->SetRef_Coord(geometry->node[geometry->elem[iElem]->GetNode(iNode)]->GetCoord(iDim), iNode, iDim);
       }
     }
-    
-    /*--- In topology mode determine the penalty to apply to the stiffness ---*/
-    su2double simp_penalty = 1.0;
-    if (topology_mode) {
-      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
-    }
-    
-    /*--- Set the properties of the element ---*/
-    element_container[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    
-    /*--- Compute the components of the jacobian and the stress term ---*/
-    if (element_based){
-      numerics[element_properties[iElem]->GetMat_Mod()]->Compute_Tangent_Matrix(element_container[FEA_TERM][EL_KIND], config);
-    }
-    else{
-      numerics[FEA_TERM]->Compute_Tangent_Matrix(element_container[FEA_TERM][EL_KIND], config);
-    }
-    
-    NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
-    
-    for (iNode = 0; iNode < NelNodes; iNode++) {
-      
-      Ta = element_container[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
-      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Ta[iVar];
-      
-      LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
-      
-      for (jNode = 0; jNode < NelNodes; jNode++) {
-        
-        Kab = element_container[FEA_TERM][EL_KIND]->Get_Kab(iNode, jNode);
-        
-        for (iVar = 0; iVar < nVar; iVar++) {
-          for (jVar = 0; jVar < nVar; jVar++) {
-            Jacobian_ij[iVar][jVar] = simp_penalty*Kab[iVar*nVar+jVar];
-          }
-        }
-    
-        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_ij);
+
+    element_container[FEA_TERM][EL_KIND]->ComputeGrad_Linear();
+    element_container[FEA_TERM][EL_KIND]->Store_RefGradients(&RefGradients[RefGradients_Ptr[iElem]]);
+  }
+
+}
+
+void CFEASolver::Loop_Elements(unsigned short val_loop, CGeometry *geometry, CNumerics **numerics, CConfig *config) {
+
+  unsigned short iColor;
+
+  elemLoopChunks = val_loop;
+  geometryChunks = geometry;
+  configChunks   = config;
+  numerics_Threads[0] = numerics;
+
+  /*--- A single thread traverses the elements in their natural order. ---*/
+
+  if (taskThreadPool == NULL) {
+    Loop_Elements_Range(val_loop, 0, geometry->GetnElem(), 0);
+    return;
+  }
+
+  /*--- The elements of one color do not share any point, hence their contributions
+   to the residual, the matrices and the nodal stresses are independent. The calling
+   thread launches the colors one after the other and helps carrying out the chunks. ---*/
+
+  taskThreadPool->ResetTasks(ElemColorChunks.size());
+
+  for (iColor = 0; iColor < ElemColorChunks.size(); iColor++) {
+    taskThreadPool->LaunchTask(iColor, ElemColorChunks[iColor]);
+    while (!taskThreadPool->TaskCompleted(iColor)) {
+      if (!taskThreadPool->RunChunk()) {
+#ifdef HAVE_PTHREAD
+        sched_yield();
+#endif
       }
-      
     }
-    
   }
-  
-  
+
 }
 
-void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
-  
-  unsigned long iElem, iVar, jVar;
-  unsigned short iNode, iDim, nNodes = 0;
+void CFEASolver::ProcessTaskChunk_FEA(void *solver, const CTaskChunk &chunk) {
+
+  CFEASolver *FEASolver = (CFEASolver *) solver;
+
+  FEASolver->Loop_Elements_Range(FEASolver->elemLoopChunks, chunk.indBeg, chunk.indEnd,
+                                 FEASolver->taskThreadPool->GetThreadIndex());
+
+}
+
+void CFEASolver::Loop_Elements_Range(unsigned short val_loop, unsigned long val_begin, unsigned long val_end, unsigned short iThread) {
+
+  unsigned long iPos, iElem, iVar, jVar;
+  unsigned short iNode, jNode, iDim, jDim, iStress, jStress, iGauss, nNodes = 0, NelNodes;
   unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord, val_Sol, val_Ref = 0.0;
+  su2double val_Coord, val_Sol, val_Ref, Mab, Ks_ab, Ks_ab_DE, Weight_J, GradNi, Kaa_ij;
+  su2double *Kab = NULL, *Kk_ab = NULL, *Ta = NULL, *Ta_DE = NULL, *DMat = NULL;
+  su2double Ba_Mat[6][3], BaD_Mat[3][6];
   int EL_KIND = 0;
-  
+
+  CGeometry *geometry = geometryChunks;
+  CConfig   *config   = configChunks;
+
+  /*--- The matrix-free product only uses the stored element data ---*/
+
+  if (val_loop == ELEM_MATRIX_FREE_PRODUCT) {
+    MatrixFree_Product_Range(val_begin, val_end);
+    return;
+  }
+
+  /*--- Elements, numerics and submatrices of this thread ---*/
+
+  CElement  ***elements  = element_container_Threads[iThread];
+  CNumerics **numerics   = numerics_Threads[iThread];
+  su2double *Res_Stress  = Res_Stress_Threads[iThread];
+  su2double **Jacobian_c = Jacobian_c_Threads[iThread];
+  su2double **Jacobian_s = Jacobian_s_Threads[iThread];
+  su2double **Jacobian_k = Jacobian_k_Threads[iThread];
+
   bool prestretch_fem = config->GetPrestretch();
-  
-  su2double Ks_ab;
-  su2double *Kab = NULL;
-  su2double *Kk_ab = NULL;
-  su2double *Ta = NULL;
-  
-  su2double *Ta_DE = NULL;
-  su2double Ks_ab_DE = 0.0;
-  
-  unsigned short NelNodes, jNode;
-  
   bool incompressible = (config->GetMaterialCompressibility() == INCOMPRESSIBLE_MAT);
   bool de_effects = config->GetDE_Effects();
 
   bool topology_mode = config->GetTopology_Optimization();
   su2double simp_exponent = config->GetSIMP_Exponent();
   su2double simp_minstiff = config->GetSIMP_MinStiffness();
-  
-  /*--- Loops over all the elements ---*/
-  
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
+
+  unsigned short nStress = (nDim == 2)? 3 : 6;
+
+  /*--- The linear stiffness and the mass matrix are always computed in the undeformed
+   mesh, the other loops in the prestretched configuration if available. Only the
+   tangent matrix needs the dielectric and incompressible terms. ---*/
+
+  bool tangent = (val_loop == ELEM_STIFF_MATRIX_NODAL_STRESS_RES);
+  bool prestretch_ref = prestretch_fem && (val_loop != ELEM_STIFF_MATRIX) && (val_loop != ELEM_MASS_MATRIX) &&
+                        (val_loop != ELEM_MATRIX_FREE_SETUP);
+  bool de_term  = tangent && de_effects;
+  bool inc_term = tangent && incompressible;
+
+  for (iPos = val_begin; iPos < val_end; iPos++) {
+
+    iElem = geometry->GetElemColor_Elem(iPos);
+
     if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)      {nNodes = 3; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
     if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)   {nNodes = 4; EL_KIND = EL_TETRA;}
     if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)       {nNodes = 5; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == PRISM)         {nNodes = 6; EL_KIND = EL_TRIA;}
     if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)    {nNodes = 8; EL_KIND = EL_HEXA;}
-    
+
     /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-    
+
     for (iNode = 0; iNode < nNodes; iNode++) {
       indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
       for (iDim = 0; iDim < nDim; iDim++) {
         val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
         val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
+        val_Ref = (prestretch_ref)? node[indexNode[iNode]]->GetPrestretch(iDim) : val_Coord;
 
-        /*--- Set current coordinate ---*/
-        element_container[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-        if (de_effects) element_container[DE_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-        if (incompressible) element_container[INC_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-
-        /*--- Set reference coordinate ---*/
-        if (prestretch_fem) {
-          val_Ref = node[indexNode[iNode]]->GetPrestretch(iDim);
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
-          if (de_effects) element_container[DE_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
-          if (incompressible) element_container[INC_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
+        elements[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
+        elements[FEA_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
+        if (de_term) {
+          elements[DE_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
+          elements[DE_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
         }
-        else {
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-          if (de_effects) element_container[DE_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-          if (incompressible) element_container[INC_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
+        if (inc_term) {
+          elements[INC_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
+          elements[INC_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
         }
       }
     }
-    
-    /*--- In topology mode determine the penalty to apply to the stiffness ---*/
+
+    /*--- In topology mode determine the penalty to apply to the stiffness (the mass
+     is a linear function of the physical density, the stresses are only corrected) ---*/
     su2double simp_penalty = 1.0;
     if (topology_mode) {
-      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
+      su2double density = element_properties[iElem]->GetPhysicalDensity();
+      switch (val_loop) {
+        case ELEM_MASS_MATRIX:  simp_penalty = simp_minstiff+(1.0-simp_minstiff)*density; break;
+        case ELEM_NODAL_STRESS: simp_penalty = pow(density,simp_exponent); break;
+        default: simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent); break;
+      }
     }
-    
+
     /*--- Set the properties of the element ---*/
-    element_container[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    if (de_effects) element_container[DE_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    if (incompressible) element_container[INC_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    
-    /*--- If incompressible, we compute the Mean Dilatation term first so the volume is already computed ---*/
-    if (incompressible) numerics[FEA_TERM]->Compute_MeanDilatation_Term(element_container[INC_TERM][EL_KIND], config);
-    
-    /*--- Compute the components of the Jacobian and the stress term for the material ---*/
-    if (element_based){
-      numerics[element_properties[iElem]->GetMat_Mod()]->Compute_Tangent_Matrix(element_container[FEA_TERM][EL_KIND], config);
-    }
-    else{
-      numerics[FEA_TERM]->Compute_Tangent_Matrix(element_container[FEA_TERM][EL_KIND], config);
-    }
-    
-    /*--- Compute the electric component of the Jacobian and the stress term ---*/
-    if (de_effects) numerics[DE_TERM]->Compute_Tangent_Matrix(element_container[DE_TERM][EL_KIND], config);
-    
-    NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
-    
-    for (iNode = 0; iNode < NelNodes; iNode++) {
-      
-      Ta = element_container[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
-      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Ta[iVar];
-      
-      /*--- Check if this is my node or not ---*/
-      LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
-      
-      /*--- Retrieve the electric contribution to the Residual ---*/
-      if (de_effects){
-        Ta_DE = element_container[DE_TERM][EL_KIND]->Get_Kt_a(iNode);
-        for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Ta_DE[iVar];
-        LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
-        
-      }
-      
-      for (jNode = 0; jNode < NelNodes; jNode++) {
-        
-        /*--- Retrieve the values of the FEA term ---*/
-        Kab = element_container[FEA_TERM][EL_KIND]->Get_Kab(iNode, jNode);
-        Ks_ab = element_container[FEA_TERM][EL_KIND]->Get_Ks_ab(iNode,jNode);
-        if (incompressible) Kk_ab = element_container[INC_TERM][EL_KIND]->Get_Kk_ab(iNode,jNode);
-        
-        for (iVar = 0; iVar < nVar; iVar++) {
-          Jacobian_s_ij[iVar][iVar] = simp_penalty*Ks_ab;
-          for (jVar = 0; jVar < nVar; jVar++) {
-            Jacobian_c_ij[iVar][jVar] = simp_penalty*Kab[iVar*nVar+jVar];
-            if (incompressible) Jacobian_k_ij[iVar][jVar] = simp_penalty*Kk_ab[iVar*nVar+jVar];
+    elements[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
+    if (de_term) elements[DE_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
+    if (inc_term) elements[INC_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
+
+    /*--- Precomputed gradients of the reference configuration, if available ---*/
+    if (!RefGradients_Ptr.empty())
+      elements[FEA_TERM][EL_KIND]->Set_RefGradients(&RefGradients[RefGradients_Ptr[iElem]]);
+
+    /*--- Numerics of the material of this element ---*/
+    CNumerics *numerics_mat = (element_based)? numerics[element_properties[iElem]->GetMat_Mod()] : numerics[FEA_TERM];
+
+    NelNodes = elements[FEA_TERM][EL_KIND]->GetnNodes();
+
+    switch (val_loop) {
+
+      case ELEM_STIFF_MATRIX:
+
+        /*--- Compute the components of the jacobian and the stress term ---*/
+        numerics_mat->Compute_Tangent_Matrix(elements[FEA_TERM][EL_KIND], config);
+
+        for (iNode = 0; iNode < NelNodes; iNode++) {
+
+          Ta = elements[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
+          for (iVar = 0; iVar < nVar; iVar++) Res_Stress[iVar] = simp_penalty*Ta[iVar];
+
+          LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress);
+
+          for (jNode = 0; jNode < NelNodes; jNode++) {
+
+            Kab = elements[FEA_TERM][EL_KIND]->Get_Kab(iNode, jNode);
+
+            for (iVar = 0; iVar < nVar; iVar++) {
+              for (jVar = 0; jVar < nVar; jVar++) {
+                Jacobian_c[iVar][jVar] = simp_penalty*Kab[iVar*nVar+jVar];
+              }
+            }
+
+            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_c);
           }
         }
-        
-        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_c_ij);
-        Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s_ij);
-        if (incompressible) Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_k_ij);
-        
-        /*--- Retrieve the electric contribution to the Jacobian ---*/
-        if (de_effects){
-          //          Kab_DE = element_container[DE_TERM][EL_KIND]->Get_Kab(iNode, jNode);
-          Ks_ab_DE = element_container[DE_TERM][EL_KIND]->Get_Ks_ab(iNode,jNode);
-          
-          for (iVar = 0; iVar < nVar; iVar++){
-            Jacobian_s_ij[iVar][iVar] = simp_penalty*Ks_ab_DE;
+        break;
+
+      case ELEM_STIFF_MATRIX_NODAL_STRESS_RES:
+
+        /*--- If incompressible, we compute the Mean Dilatation term first so the volume is already computed ---*/
+        if (inc_term) numerics[FEA_TERM]->Compute_MeanDilatation_Term(elements[INC_TERM][EL_KIND], config);
+
+        /*--- Compute the components of the Jacobian and the stress term for the material ---*/
+        numerics_mat->Compute_Tangent_Matrix(elements[FEA_TERM][EL_KIND], config);
+
+        /*--- Compute the electric component of the Jacobian and the stress term ---*/
+        if (de_term) numerics[DE_TERM]->Compute_Tangent_Matrix(elements[DE_TERM][EL_KIND], config);
+
+        for (iNode = 0; iNode < NelNodes; iNode++) {
+
+          Ta = elements[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
+          for (iVar = 0; iVar < nVar; iVar++) Res_Stress[iVar] = simp_penalty*Ta[iVar];
+
+          LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress);
+
+          /*--- Retrieve the electric contribution to the Residual ---*/
+          if (de_term) {
+            Ta_DE = elements[DE_TERM][EL_KIND]->Get_Kt_a(iNode);
+            for (iVar = 0; iVar < nVar; iVar++) Res_Stress[iVar] = simp_penalty*Ta_DE[iVar];
+            LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress);
+          }
+
+          for (jNode = 0; jNode < NelNodes; jNode++) {
+
+            /*--- Retrieve the values of the FEA term ---*/
+            Kab = elements[FEA_TERM][EL_KIND]->Get_Kab(iNode, jNode);
+            Ks_ab = elements[FEA_TERM][EL_KIND]->Get_Ks_ab(iNode,jNode);
+            if (inc_term) Kk_ab = elements[INC_TERM][EL_KIND]->Get_Kk_ab(iNode,jNode);
+
+            for (iVar = 0; iVar < nVar; iVar++) {
+              Jacobian_s[iVar][iVar] = simp_penalty*Ks_ab;
+              for (jVar = 0; jVar < nVar; jVar++) {
+                Jacobian_c[iVar][jVar] = simp_penalty*Kab[iVar*nVar+jVar];
+                if (inc_term) Jacobian_k[iVar][jVar] = simp_penalty*Kk_ab[iVar*nVar+jVar];
+              }
+            }
+
+            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_c);
+            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s);
+            if (inc_term) Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_k);
+
+            /*--- Retrieve the electric contribution to the Jacobian ---*/
+            if (de_term) {
+              Ks_ab_DE = elements[DE_TERM][EL_KIND]->Get_Ks_ab(iNode,jNode);
+              for (iVar = 0; iVar < nVar; iVar++) Jacobian_s[iVar][iVar] = simp_penalty*Ks_ab_DE;
+              Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s);
+            }
           }
-          
-          Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s_ij);
         }
-        
-      }
-      
+        break;
+
+      case ELEM_NODAL_STRESS_RES:
+
+        numerics_mat->Compute_NodalStress_Term(elements[FEA_TERM][EL_KIND], config);
+
+        for (iNode = 0; iNode < NelNodes; iNode++) {
+          Ta = elements[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
+          for (iVar = 0; iVar < nVar; iVar++) Res_Stress[iVar] = simp_penalty*Ta[iVar];
+          LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress);
+        }
+        break;
+
+      case ELEM_MASS_MATRIX:
+
+        numerics[FEA_TERM]->Compute_Mass_Matrix(elements[FEA_TERM][EL_KIND], config);
+
+        for (iNode = 0; iNode < NelNodes; iNode++) {
+          for (jNode = 0; jNode < NelNodes; jNode++) {
+            Mab = elements[FEA_TERM][EL_KIND]->Get_Mab(iNode, jNode);
+            for (iVar = 0; iVar < nVar; iVar++) Jacobian_s[iVar][iVar] = simp_penalty*Mab;
+            MassMatrix.AddBlock(indexNode[iNode], indexNode[jNode], Jacobian_s);
+          }
+        }
+        break;
+
+      case ELEM_NODAL_STRESS:
+
+        numerics_mat->Compute_Averaged_NodalStress(elements[FEA_TERM][EL_KIND], config);
+
+        for (iNode = 0; iNode < NelNodes; iNode++) {
+
+          /*--- This only works if the problem is nonlinear ---*/
+          Ta = elements[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
+          for (iVar = 0; iVar < nVar; iVar++) Res_Stress[iVar] = simp_penalty*Ta[iVar];
+
+          LinSysReact.AddBlock(indexNode[iNode], Res_Stress);
+
+          for (iStress = 0; iStress < nStress; iStress++) {
+            node[indexNode[iNode]]->AddStress_FEM(iStress, simp_penalty *
+                                                  (elements[FEA_TERM][EL_KIND]->Get_NodalStress(iNode, iStress) /
+                                                   geometry->node[indexNode[iNode]]->GetnElem()) );
+          }
+        }
+        break;
+
+      case ELEM_MATRIX_FREE_SETUP:
+
+        /*--- Constitutive matrix of the element, with the stiffness penalty ---*/
+        DMat = &MatFree_DMat[iElem*nStress*nStress];
+        numerics_mat->Get_Constitutive_Matrix(elements[FEA_TERM][EL_KIND], config, DMat);
+        for (iStress = 0; iStress < nStress*nStress; iStress++) DMat[iStress] *= simp_penalty;
+
+        /*--- Diagonal blocks Kaa = sum_g w*J*Ba^T*D*Ba for the Jacobi preconditioner ---*/
+        elements[FEA_TERM][EL_KIND]->ComputeGrad_Linear();
+
+        for (iStress = 0; iStress < nStress; iStress++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Ba_Mat[iStress][iDim] = 0.0;
+
+        for (iGauss = 0; iGauss < elements[FEA_TERM][EL_KIND]->GetnGaussPoints(); iGauss++) {
+
+          Weight_J = elements[FEA_TERM][EL_KIND]->GetWeight(iGauss) * elements[FEA_TERM][EL_KIND]->GetJ_X(iGauss);
+
+          for (iNode = 0; iNode < NelNodes; iNode++) {
+
+            for (iDim = 0; iDim < nDim; iDim++) {
+              GradNi = elements[FEA_TERM][EL_KIND]->GetGradNi_X(iNode, iGauss, iDim);
+              Ba_Mat[iDim][iDim] = GradNi;
+              if (nDim == 2) Ba_Mat[2][1-iDim] = GradNi;
+            }
+            if (nDim == 3) {
+              Ba_Mat[3][0] = Ba_Mat[1][1];  Ba_Mat[3][1] = Ba_Mat[0][0];
+              Ba_Mat[4][0] = Ba_Mat[2][2];  Ba_Mat[4][2] = Ba_Mat[0][0];
+              Ba_Mat[5][1] = Ba_Mat[2][2];  Ba_Mat[5][2] = Ba_Mat[1][1];
+            }
+
+            for (iDim = 0; iDim < nDim; iDim++) {
+              for (jStress = 0; jStress < nStress; jStress++) {
+                BaD_Mat[iDim][jStress] = 0.0;
+                for (iStress = 0; iStress < nStress; iStress++)
+                  BaD_Mat[iDim][jStress] += Ba_Mat[iStress][iDim]*DMat[iStress*nStress+jStress];
+              }
+            }
+
+            for (iDim = 0; iDim < nDim; iDim++) {
+              for (jDim = 0; jDim < nDim; jDim++) {
+                Kaa_ij = 0.0;
+                for (iStress = 0; iStress < nStress; iStress++)
+                  Kaa_ij += BaD_Mat[iDim][iStress]*Ba_Mat[iStress][jDim];
+                MatFree_Diag[(indexNode[iNode]*nVar+iDim)*nVar+jDim] += Weight_J*Kaa_ij;
+              }
+            }
+          }
+        }
+        break;
     }
-    
+
+    /*--- The precomputed gradients are only valid for this element ---*/
+    elements[FEA_TERM][EL_KIND]->Set_RefGradients(NULL);
+
   }
-  
+
 }
 
-void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
-  
-  unsigned long iElem, iVar;
-  unsigned short iNode, iDim, nNodes = 0;
+void CFEASolver::MatrixFree_Product_Range(unsigned long val_begin, unsigned long val_end) {
+
+  unsigned long iPos, iElem, iPoint;
+  unsigned short iNode, iDim, jDim, iGauss, iStress, jStress, nNodes, nGauss;
   unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord;
-  int EL_KIND = 0;
-  
-  su2double Mab;
-  unsigned short NelNodes, jNode;
-  
-  bool topology_mode = config->GetTopology_Optimization();
-  su2double simp_minstiff = config->GetSIMP_MinStiffness();
-  
-  /*--- Loops over all the elements ---*/
-  
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL)    {nNodes = 4; EL_KIND = EL_QUAD;}
-    
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
-    
-    /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-    
+  su2double Disp_Elem[8][3], Res_Elem[8][3], GradDisp[3][3], Strain[6], Stress[6], Weight_J;
+  const su2double *RefGrad = NULL, *GradN = NULL, *DMat = NULL;
+  CElement *element = NULL;
+
+  CGeometry *geometry = geometryChunks;
+  const CSysVector &vec = *MatFree_Vec;
+  CSysVector &prod = *MatFree_Prod;
+
+  const unsigned short nStress = (nDim == 2)? 3 : 6;
+
+  for (iPos = val_begin; iPos < val_end; iPos++) {
+
+    iElem = geometry->GetElemColor_Elem(iPos);
+
+    switch (geometry->elem[iElem]->GetVTK_Type()) {
+      case QUADRILATERAL: element = element_container[FEA_TERM][EL_QUAD];  break;
+      case TETRAHEDRON:   element = element_container[FEA_TERM][EL_TETRA]; break;
+      case HEXAHEDRON:    element = element_container[FEA_TERM][EL_HEXA];  break;
+      default:            element = element_container[FEA_TERM][EL_TRIA];  break;
+    }
+    nNodes = element->GetnNodes();
+    nGauss = element->GetnGaussPoints();
+
+    /*--- Displacements of the nodes, the columns of the clamped points are removed ---*/
+
     for (iNode = 0; iNode < nNodes; iNode++) {
-      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+      iPoint = geometry->elem[iElem]->GetNode(iNode);
+      indexNode[iNode] = iPoint;
       for (iDim = 0; iDim < nDim; iDim++) {
-        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
-        element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
+        Disp_Elem[iNode][iDim] = (MatFree_Clamped[iPoint])? 0.0 : vec[iPoint*nVar+iDim];
+        Res_Elem[iNode][iDim] = 0.0;
       }
     }
-    
-    /*--- In topology mode determine the penalty to apply to the mass, linear function of the physical density ---*/
-    su2double simp_penalty = 1.0;
-    if (topology_mode) {
-      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*element_properties[iElem]->GetPhysicalDensity();
+
+    RefGrad = &RefGradients[RefGradients_Ptr[iElem]];
+    DMat = &MatFree_DMat[iElem*nStress*nStress];
+
+    for (iGauss = 0; iGauss < nGauss; iGauss++) {
+
+      /*--- Layout of the reference gradients: J_X, then dNi/dXj node by node ---*/
+
+      Weight_J = element->GetWeight(iGauss) * RefGrad[0];
+      GradN = RefGrad+1;
+      RefGrad += 1+nNodes*nDim;
+
+      /*--- Strain in Voigt notation from the displacement gradient, stress = D*strain ---*/
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        for (jDim = 0; jDim < nDim; jDim++) {
+          GradDisp[iDim][jDim] = 0.0;
+          for (iNode = 0; iNode < nNodes; iNode++)
+            GradDisp[iDim][jDim] += Disp_Elem[iNode][iDim]*GradN[iNode*nDim+jDim];
+        }
+      }
+
+      if (nDim == 2) {
+        Strain[0] = GradDisp[0][0];
+        Strain[1] = GradDisp[1][1];
+        Strain[2] = GradDisp[0][1] + GradDisp[1][0];
+      }
+      else {
+        Strain[0] = GradDisp[0][0];
+        Strain[1] = GradDisp[1][1];
+        Strain[2] = GradDisp[2][2];
+        Strain[3] = GradDisp[0][1] + GradDisp[1][0];
+        Strain[4] = GradDisp[0][2] + GradDisp[2][0];
+        Strain[5] = GradDisp[1][2] + GradDisp[2][1];
+      }
+
+      for (iStress = 0; iStress < nStress; iStress++) {
+        Stress[iStress] = 0.0;
+        for (jStress = 0; jStress < nStress; jStress++)
+          Stress[iStress] += DMat[iStress*nStress+jStress]*Strain[jStress];
+        Stress[iStress] *= Weight_J;
+      }
+
+      /*--- Nodal forces Ba^T*stress ---*/
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+        const su2double *g = &GradN[iNode*nDim];
+        if (nDim == 2) {
+          Res_Elem[iNode][0] += g[0]*Stress[0] + g[1]*Stress[2];
+          Res_Elem[iNode][1] += g[1]*Stress[1] + g[0]*Stress[2];
+        }
+        else {
+          Res_Elem[iNode][0] += g[0]*Stress[0] + g[1]*Stress[3] + g[2]*Stress[4];
+          Res_Elem[iNode][1] += g[1]*Stress[1] + g[0]*Stress[3] + g[2]*Stress[5];
+          Res_Elem[iNode][2] += g[2]*Stress[2] + g[0]*Stress[4] + g[1]*Stress[5];
+        }
+      }
     }
-    
-    /*--- Set the properties of the element ---*/
-    element_container[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    
-    numerics[FEA_TERM]->Compute_Mass_Matrix(element_container[FEA_TERM][EL_KIND], config);
-    
-    NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
 
-    for (iNode = 0; iNode < NelNodes; iNode++) {
-      
-      for (jNode = 0; jNode < NelNodes; jNode++) {
-        
-        Mab = element_container[FEA_TERM][EL_KIND]->Get_Mab(iNode, jNode);
-        
-        for (iVar = 0; iVar < nVar; iVar++) {
-          MassMatrix_ij[iVar][iVar] = simp_penalty*Mab;
+    /*--- The elements of a color do not share points ---*/
+
+    for (iNode = 0; iNode < nNodes; iNode++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        prod[indexNode[iNode]*nVar+iDim] += Res_Elem[iNode][iDim];
+
+  }
+
+}
+
+void CFEASolver::MatrixFree_Product(const CSysVector & u, CSysVector & v, CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iVar;
+
+  v = su2double(0.0);
+
+  MatFree_Vec  = &u;
+  MatFree_Prod = &v;
+  Loop_Elements(ELEM_MATRIX_FREE_PRODUCT, geometry, numerics_Threads[0], config);
+  MatFree_Vec  = NULL;
+  MatFree_Prod = NULL;
+
+  /*--- Rows of the clamped points are the identity, the halo entries are communicated ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (MatFree_Clamped[iPoint]) {
+      for (iVar = 0; iVar < nVar; iVar++) v[iPoint*nVar+iVar] = u[iPoint*nVar+iVar];
+    }
+  }
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) v[iPoint*nVar+iVar] = 0.0;
+
+  Jacobian.SendReceive_Solution(v, geometry, config);
+
+}
+
+void CFEASolver::MatrixFree_Precondition(const CSysVector & u, CSysVector & v, CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iVar, jVar;
+  const su2double *invBlock = NULL;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    invBlock = &MatFree_DiagInv[iPoint*nVar*nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      v[iPoint*nVar+iVar] = 0.0;
+      for (jVar = 0; jVar < nVar; jVar++)
+        v[iPoint*nVar+iVar] += invBlock[iVar*nVar+jVar]*u[iPoint*nVar+jVar];
+    }
+  }
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++) v[iPoint*nVar+iVar] = 0.0;
+
+  Jacobian.SendReceive_Solution(v, geometry, config);
+
+}
+
+void CFEAMatrixFreeProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->MatrixFree_Product(u, v, geometry, config);
+}
+
+void CFEAMatrixFreePreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->MatrixFree_Precondition(u, v, geometry, config);
+}
+
+unsigned long CFEASolver::MatrixFree_Solve(CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint, IterLinSol = 0;
+  unsigned short iVar, jVar, kVar;
+  su2double Residual = 0.0, *invBlock = NULL;
+  su2double **Block = Jacobian_c_Threads[0];
+
+  /*--- Inverse of the diagonal blocks, column by column. The clamped points
+   have a unit diagonal block, as in the assembled system. ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    invBlock = &MatFree_DiagInv[iPoint*nVar*nVar];
+    for (jVar = 0; jVar < nVar; jVar++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Solution[iVar] = (iVar == jVar)? 1.0 : 0.0;
+        for (kVar = 0; kVar < nVar; kVar++) {
+          if (MatFree_Clamped[iPoint]) Block[iVar][kVar] = (iVar == kVar)? 1.0 : 0.0;
+          else Block[iVar][kVar] = MatFree_Diag[(iPoint*nVar+iVar)*nVar+kVar];
         }
-        
-        MassMatrix.AddBlock(indexNode[iNode], indexNode[jNode], MassMatrix_ij);
-        
       }
-      
+      Gauss_Elimination(Block, Solution, nVar);
+      for (iVar = 0; iVar < nVar; iVar++) invBlock[iVar*nVar+jVar] = Solution[iVar];
     }
-    
   }
-  
+
+  CFEAMatrixFreeProduct mat_vec(this, geometry, config);
+  CFEAMatrixFreePreconditioner precond(this, geometry, config);
+
+  switch (config->GetKind_Linear_Solver()) {
+    case CONJUGATE_GRADIENT:
+      IterLinSol = System.CG_LinSolver(LinSysRes, LinSysSol, mat_vec, precond, config->GetLinear_Solver_Error(),
+                                       config->GetLinear_Solver_Iter(), &Residual, false);
+      break;
+    case BCGSTAB:
+      IterLinSol = System.BCGSTAB_LinSolver(LinSysRes, LinSysSol, mat_vec, precond, config->GetLinear_Solver_Error(),
+                                            config->GetLinear_Solver_Iter(), &Residual, false);
+      break;
+    case GCRO_DR:
+      IterLinSol = System.GCRODR_LinSolver(LinSysRes, LinSysSol, mat_vec, precond, config->GetLinear_Solver_Error(),
+                                           config->GetLinear_Solver_Restart_Frequency(), config->GetLinear_Solver_Iter(),
+                                           config->GetLinear_Solver_Recycle_Size(), System.GetRecycle_Space(), &Residual, false);
+      break;
+    default:
+      IterLinSol = System.FGMRES_LinSolver(LinSysRes, LinSysSol, mat_vec, precond, config->GetLinear_Solver_Error(),
+                                           config->GetLinear_Solver_Iter(), &Residual, false);
+      break;
+  }
+
+  return IterLinSol;
+
+}
+
+void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
+
+  unsigned long iPoint;
+  unsigned short iVar;
+
+  if (!matrix_free) {
+    Loop_Elements(ELEM_STIFF_MATRIX, geometry, numerics, config);
+    return;
+  }
+
+  /*--- Matrix-free operator: only the constitutive matrices of the elements and the
+   diagonal blocks are stored. The stress term K*u of the current displacements is
+   then subtracted from the residual, as in the assembly of the linear problem. ---*/
+
+  MatFree_DMat.assign(nElement*((nDim == 2)? 9 : 36), 0.0);
+  MatFree_Diag.assign(nPoint*nVar*nVar, 0.0);
+  MatFree_DiagInv.assign(nPoint*nVar*nVar, 0.0);
+
+  Loop_Elements(ELEM_MATRIX_FREE_SETUP, geometry, numerics, config);
+
+  CSysVector Displacement(nPoint, nPointDomain, nVar, 0.0);
+  CSysVector StressRes(nPoint, nPointDomain, nVar, 0.0);
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      Displacement[iPoint*nVar+iVar] = node[iPoint]->GetSolution(iVar);
+
+  MatFree_Vec  = &Displacement;
+  MatFree_Prod = &StressRes;
+  Loop_Elements(ELEM_MATRIX_FREE_PRODUCT, geometry, numerics, config);
+  MatFree_Vec  = NULL;
+  MatFree_Prod = NULL;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    LinSysRes.SubtractBlock(iPoint, &StressRes[iPoint*nVar]);
+
+}
+
+void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
+
+  Loop_Elements(ELEM_STIFF_MATRIX_NODAL_STRESS_RES, geometry, numerics, config);
+
+}
+
+void CFEASolver::Compute_MassMatrix(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
+
+  Loop_Elements(ELEM_MASS_MATRIX, geometry, numerics, config);
+
 }
 
 void CFEASolver::Compute_MassRes(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
@@ -1959,107 +2509,23 @@ void CFEASolver::Compute_MassRes(CGeometry *geometry, CSolver **solver_container
 }
 
 void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
-  
-  
-  unsigned long iElem, iVar;
-  unsigned short iNode, iDim, nNodes = 0;
-  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord, val_Sol, val_Ref = 0.0;
-  int EL_KIND = 0;
-  
-  bool prestretch_fem = config->GetPrestretch();
-  
-  su2double *Ta = NULL;
-  unsigned short NelNodes;
-  
-  bool topology_mode = config->GetTopology_Optimization();
-  su2double simp_exponent = config->GetSIMP_Exponent();
-  su2double simp_minstiff = config->GetSIMP_MinStiffness();
-  
-  /*--- Loops over all the elements ---*/
-  
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
-    
-    /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-    
-    for (iNode = 0; iNode < nNodes; iNode++) {
-      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
-      for (iDim = 0; iDim < nDim; iDim++) {
-        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
-        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
-        element_container[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-        if (prestretch_fem) {
-          val_Ref = node[indexNode[iNode]]->GetPrestretch(iDim);
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
-        }
-        else {
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-        }
-      }
-    }
-    
-    /*--- In topology mode determine the penalty to apply to the stiffness ---*/
-    su2double simp_penalty = 1.0;
-    if (topology_mode) {
-      simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
-    }
-    
-    /*--- Set the properties of the element ---*/
-    element_container[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    
-    /*--- Compute the components of the jacobian and the stress term ---*/
-    if (element_based){
-      numerics[element_properties[iElem]->GetMat_Mod()]->Compute_NodalStress_Term(element_container[FEA_TERM][EL_KIND], config);
-    }
-    else{
-      numerics[FEA_TERM]->Compute_NodalStress_Term(element_container[FEA_TERM][EL_KIND], config);
-    }
-    
-    NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
-    
-    for (iNode = 0; iNode < NelNodes; iNode++) {
-      
-      Ta = element_container[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
-      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Ta[iVar];
-      
-      LinSysRes.SubtractBlock(indexNode[iNode], Res_Stress_i);
-      
-    }
-    
-  }
+
+  Loop_Elements(ELEM_NODAL_STRESS_RES, geometry, numerics, config);
 
 }
 
 void CFEASolver::Compute_NodalStress(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics, CConfig *config) {
   
-  unsigned long iPoint, iElem, iVar;
-  unsigned short iNode, iDim, iStress;
-  unsigned short nNodes = 0, nStress;
-  unsigned long indexNode[8]={0,0,0,0,0,0,0,0};
-  su2double val_Coord, val_Sol, val_Ref = 0.0;
-  int EL_KIND = 0;
-  
-  bool prestretch_fem = config->GetPrestretch();
+  unsigned long iPoint, iVar;
+  unsigned short iDim, iStress;
+  unsigned short nStress;
+  su2double val_Coord;
   
   bool dynamic = (config->GetDynamic_Analysis() == DYNAMIC);
   
-  bool topology_mode = config->GetTopology_Optimization();
-  su2double simp_exponent = config->GetSIMP_Exponent();
-  
   if (nDim == 2) nStress = 3;
   else nStress = 6;
   
-  su2double *Ta = NULL;
-  
-  unsigned short NelNodes;
-  
   /*--- Restart stress to avoid adding results from previous time steps ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -2070,75 +2536,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CSolver **solver_conta
   
   /*--- Loops over all the elements ---*/
   
-  for (iElem = 0; iElem < geometry->GetnElem(); iElem++) {
-    
-    if (geometry->elem[iElem]->GetVTK_Type() == TRIANGLE)     {nNodes = 3; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == QUADRILATERAL) {nNodes = 4; EL_KIND = EL_QUAD;}
-    if (geometry->elem[iElem]->GetVTK_Type() == TETRAHEDRON)  {nNodes = 4; EL_KIND = EL_TETRA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PYRAMID)      {nNodes = 5; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == PRISM)        {nNodes = 6; EL_KIND = EL_TRIA;}
-    if (geometry->elem[iElem]->GetVTK_Type() == HEXAHEDRON)   {nNodes = 8; EL_KIND = EL_HEXA;}
-    
-    /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-    
-    for (iNode = 0; iNode < nNodes; iNode++) {
-      indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
-      //      for (iDim = 0; iDim < nDim; iDim++) {
-      //        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
-      //        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
-      //        element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-      //        element_container[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-      //      }
-      for (iDim = 0; iDim < nDim; iDim++) {
-        val_Coord = geometry->node[indexNode[iNode]]->GetCoord(iDim);
-        val_Sol = node[indexNode[iNode]]->GetSolution(iDim) + val_Coord;
-        element_container[FEA_TERM][EL_KIND]->SetCurr_Coord(val_Sol, iNode, iDim);
-        if (prestretch_fem) {
-          val_Ref = node[indexNode[iNode]]->GetPrestretch(iDim);
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Ref, iNode, iDim);
-        }
-        else {
-          element_container[FEA_TERM][EL_KIND]->SetRef_Coord(val_Coord, iNode, iDim);
-        }
-      }
-    }
-    
-    /*--- Correct the stresses and reactions for topology optimization densities. ---*/
-    su2double simp_penalty = 1.0;
-    if (topology_mode) {
-      simp_penalty = pow(element_properties[iElem]->GetPhysicalDensity(),simp_exponent);
-    }
-    
-    /*--- Set the properties of the element ---*/
-    element_container[FEA_TERM][EL_KIND]->Set_ElProperties(element_properties[iElem]);
-    
-    /*--- Compute the components of the jacobian and the stress term ---*/
-    if (element_based){
-      numerics[element_properties[iElem]->GetMat_Mod()]->Compute_Averaged_NodalStress(element_container[FEA_TERM][EL_KIND], config);
-    }
-    else{
-      numerics[FEA_TERM]->Compute_Averaged_NodalStress(element_container[FEA_TERM][EL_KIND], config);
-    }
-    
-    NelNodes = element_container[FEA_TERM][EL_KIND]->GetnNodes();
-    
-    for (iNode = 0; iNode < NelNodes; iNode++) {
-      
-      /*--- This only works if the problem is nonlinear ---*/
-      Ta = element_container[FEA_TERM][EL_KIND]->Get_Kt_a(iNode);
-      for (iVar = 0; iVar < nVar; iVar++) Res_Stress_i[iVar] = simp_penalty*Ta[iVar];
-      
-      LinSysReact.AddBlock(indexNode[iNode], Res_Stress_i);
-      
-      for (iStress = 0; iStress < nStress; iStress++) {
-        node[indexNode[iNode]]->AddStress_FEM(iStress, simp_penalty *
-                                              (element_container[FEA_TERM][EL_KIND]->Get_NodalStress(iNode, iStress) /
-                                               geometry->node[indexNode[iNode]]->GetnElem()) );
-      }
-      
-    }
-    
-  }
+  Loop_Elements(ELEM_NODAL_STRESS, geometry, numerics, config);
   
   su2double *Stress;
   su2double VonMises_Stress, MaxVonMises_Stress = 0.0;
@@ -2196,7 +2594,7 @@ void CFEASolver::Compute_NodalStress(CGeometry *geometry, CSolver **solver_conta
   /*--- Compute MaxVonMises_Stress using all the nodes ---*/
   
   su2double MyMaxVonMises_Stress = MaxVonMises_Stress; MaxVonMises_Stress = 0.0;
-  SU2_MPI::Allreduce(&MyMaxVonMises_Stress, &MaxVonMises_Stress, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyMaxVonMises_Stress, &MaxVonMises_Stress, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
   
 #endif
   
@@ -2484,22 +2882,31 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, CSolver **solver_container, CNu
       
       /*--- STRONG ENFORCEMENT OF THE DISPLACEMENT BOUNDARY CONDITION ---*/
       
-      /*--- Delete the columns for a particular node ---*/
+      /*--- The matrix-free operator removes the rows and columns when it is applied ---*/
       
-      for (iVar = 0; iVar < nPoint; iVar++) {
-        if (iVar==iPoint) {
-          Jacobian.SetBlock(iVar,iPoint,mId_Aux);
-        }
-        else {
-          Jacobian.SetBlock(iVar,iPoint,mZeros_Aux);
-        }
+      if (matrix_free) {
+        MatFree_Clamped[iPoint] = true;
       }
-      
-      /*--- Delete the rows for a particular node ---*/
-      for (jVar = 0; jVar < nPoint; jVar++) {
-        if (iPoint!=jVar) {
-          Jacobian.SetBlock(iPoint,jVar,mZeros_Aux);
+      else {
+        
+        /*--- Delete the columns for a particular node ---*/
+        
+        for (iVar = 0; iVar < nPoint; iVar++) {
+          if (iVar==iPoint) {
+            Jacobian.SetBlock(iVar,iPoint,mId_Aux);
+          }
+          else {
+            Jacobian.SetBlock(iVar,iPoint,mZeros_Aux);
+          }
+        }
+        
+        /*--- Delete the rows for a particular node ---*/
+        for (jVar = 0; jVar < nPoint; jVar++) {
+          if (iPoint!=jVar) {
+            Jacobian.SetBlock(iPoint,jVar,mZeros_Aux);
+          }
         }
+        
       }
       
       /*--- If the problem is dynamic ---*/
@@ -2808,7 +3215,7 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
 
 #ifdef HAVE_MPI
         /*--- We sum the squares of the norms across the different processors ---*/
-        SU2_MPI::Allreduce(&solNorm, &solNorm_recv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        SU2_MPI::Allreduce(&solNorm, &solNorm_recv, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
         solNorm_recv         = solNorm;
 #endif
@@ -2845,7 +3252,16 @@ void CFEASolver::Postprocessing(CGeometry *geometry, CSolver **solver_container,
 
       /*---  Compute the residual Ax-f ---*/
 
-      Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
+      if (matrix_free) {
+        MatrixFree_Product(LinSysSol, LinSysAux, geometry, config);
+        for (total_index = 0; total_index < nPointDomain*nVar; total_index++)
+          LinSysAux[total_index] -= LinSysRes[total_index];
+        for (total_index = nPointDomain*nVar; total_index < nPoint*nVar; total_index++)
+          LinSysAux[total_index] = 0.0;
+      }
+      else {
+        Jacobian.ComputeResidual(LinSysSol, LinSysRes, LinSysAux);
+      }
 
       /*--- Set maximum residual to zero ---*/
 
@@ -3529,7 +3945,7 @@ void CFEASolver::Integrate_FSI_Loads(CGeometry *geometry, CConfig *config) {
   
   MPI_Allgather(&nHaloLoc,1,MPI_UNSIGNED_LONG,halo_point_num,1,MPI_UNSIGNED_LONG,MPI_COMM_WORLD);
   MPI_Allgather(&halo_point_glb[0],nHaloLoc,MPI_UNSIGNED_LONG,halo_point_all,nHaloMax,MPI_UNSIGNED_LONG,MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&halo_force[0],nHaloMax*nDim,MPI_DOUBLE,halo_force_all,nHaloMax*nDim,MPI_DOUBLE,MPI_COMM_WORLD);
+  SU2_MPI::Allgather(&halo_force[0],nHaloMax*nDim,MPI_SU2DOUBLE,halo_force_all,nHaloMax*nDim,MPI_SU2DOUBLE,MPI_COMM_WORLD);
 
   /*--- Find shared points with other ranks and update our values ---*/
   for (int proc = 0; proc < size; ++proc)
@@ -3636,8 +4052,8 @@ void CFEASolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_c
 
 void CFEASolver::ImplicitNewmark_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
   
-  unsigned long iPoint, jPoint;
-  unsigned short iVar, jVar;
+  unsigned long iPoint;
+  unsigned short iVar;
   
   bool first_iter = (config->GetIntIter() == 0);
   bool dynamic = (config->GetDynamic_Analysis() == DYNAMIC);              // Dynamic simulations.
@@ -3719,16 +4135,7 @@ void CFEASolver::ImplicitNewmark_Iteration(CGeometry *geometry, CSolver **solver
      *
      */
     if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
-      for (iPoint = 0; iPoint < nPoint; iPoint++) {
-        for (jPoint = 0; jPoint < nPoint; jPoint++) {
-          for(iVar = 0; iVar < nVar; iVar++) {
-            for (jVar = 0; jVar < nVar; jVar++) {
-              Jacobian_ij[iVar][jVar] = a_dt[0] * MassMatrix.GetBlock(iPoint, jPoint, iVar, jVar);
-            }
-          }
-          Jacobian.AddBlock(iPoint, jPoint, Jacobian_ij);
-        }
-      }
+      Jacobian.MatrixMatrixAddition(a_dt[0], MassMatrix);
     }
     
     
@@ -3948,8 +4355,8 @@ void CFEASolver::ImplicitNewmark_Relaxation(CGeometry *geometry, CSolver **solve
 
 void CFEASolver::GeneralizedAlpha_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
   
-  unsigned long iPoint, jPoint;
-  unsigned short iVar, jVar;
+  unsigned long iPoint;
+  unsigned short iVar;
   
   bool first_iter = (config->GetIntIter() == 0);
   bool dynamic = (config->GetDynamic_Analysis() == DYNAMIC);              // Dynamic simulations.
@@ -4019,16 +4426,7 @@ void CFEASolver::GeneralizedAlpha_Iteration(CGeometry *geometry, CSolver **solve
      *
      */
     if ((nonlinear_analysis && (newton_raphson || first_iter)) || linear_analysis) {
-      for (iPoint = 0; iPoint < nPoint; iPoint++) {
-        for (jPoint = 0; jPoint < nPoint; jPoint++) {
-          for(iVar = 0; iVar < nVar; iVar++) {
-            for (jVar = 0; jVar < nVar; jVar++) {
-              Jacobian_ij[iVar][jVar] = a_dt[0] * MassMatrix.GetBlock(iPoint, jPoint, iVar, jVar);
-            }
-          }
-          Jacobian.AddBlock(iPoint, jPoint, Jacobian_ij);
-        }
-      }
+      Jacobian.MatrixMatrixAddition(a_dt[0], MassMatrix);
     }
     
     
@@ -4233,13 +4631,27 @@ void CFEASolver::Solve_System(CGeometry *geometry, CSolver **solver_container, C
     
   }
   
-  CSysSolve femSystem;
-  IterLinSol = femSystem.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (matrix_free) {
+    IterLinSol = MatrixFree_Solve(geometry, config);
+  }
+  else {
+    IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  }
   
   /*--- The the number of iterations of the linear solver ---*/
   
   SetIterLinSolver(IterLinSol);
   
+  /*--- In linear dynamics the effective matrix K + a0*M (with the essential boundary
+   conditions) is the same at every time step, it is kept with its preconditioner.
+   The discrete adjoint needs the matrix recorded at every time step. ---*/
+  
+  if ((config->GetDynamic_Analysis() == DYNAMIC) &&
+      (config->GetGeometricConditions() == SMALL_DEFORMATIONS) &&
+      !config->GetDiscrete_Adjoint()) {
+    Jacobian.SetFrozen(true);
+  }
+  
 }
 
 
@@ -4388,8 +4800,8 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry **fea_geometry, CConfig *fe
         }
         
 #ifdef HAVE_MPI
-        SU2_MPI::Allreduce(&sbuf_numAitk, &rbuf_numAitk, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-        SU2_MPI::Allreduce(&sbuf_denAitk, &rbuf_denAitk, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        SU2_MPI::Allreduce(&sbuf_numAitk, &rbuf_numAitk, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+        SU2_MPI::Allreduce(&sbuf_denAitk, &rbuf_denAitk, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
         rbuf_numAitk = sbuf_numAitk;
         rbuf_denAitk = sbuf_denAitk;
@@ -4414,6 +4826,25 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry **fea_geometry, CConfig *fe
         
       }
       
+    }
+    else if (RelaxMethod_FSI == IQN_ILS) {
+      
+      ComputeIQN_Coefficients(fea_geometry[MESH_0], fea_config, iOuterIter);
+      
+      /*--- Without secant pairs the predictor falls back to the static relaxation ---*/
+      if (IQN_Coeff.empty()) WAitkDyn = fea_config->GetAitkenStatRelax();
+      else WAitkDyn = 1.0;
+      
+      SetWAitken_Dyn(WAitkDyn);
+      
+      if (writeHistFSI && (rank == MASTER_NODE)) {
+        if (iOuterIter == 0) historyFile_FSI << " " << endl ;
+        historyFile_FSI << setiosflags(ios::fixed) << setprecision(4) << CurrentTime << "," ;
+        historyFile_FSI << setiosflags(ios::fixed) << setprecision(1) << iOuterIter << "," ;
+        if (iOuterIter == 0) historyFile_FSI << setiosflags(ios::scientific) << setprecision(4) << WAitkDyn ;
+        else historyFile_FSI << setiosflags(ios::scientific) << setprecision(4) << WAitkDyn << "," ;
+      }
+      
     }
     else {
       if (rank == MASTER_NODE) cout << "No relaxation method used. " << endl;
@@ -4423,6 +4854,177 @@ void CFEASolver::ComputeAitken_Coefficient(CGeometry **fea_geometry, CConfig *fe
   
 }
 
+void CFEASolver::ComputeIQN_Coefficients(CGeometry *geometry, CConfig *fea_config, unsigned long iOuterIter) {
+  
+  unsigned long iPoint, iVertex, iInt, iVar;
+  unsigned short iDim, iMarker;
+  size_t iVec, jVec, nVec, nKept, iPass;
+  su2double *dispPred, *dispCalc, norm, norm_Ini;
+  
+  const unsigned short nMaxVectors = fea_config->GetIQN_ILS_MaxVectors();
+  const unsigned short nReuseSteps = fea_config->GetIQN_ILS_ReuseSteps();
+  
+  /*--- Tolerance of the filter that removes secant pairs which are (almost) linearly dependent ---*/
+  const su2double filterTol = 1E-8;
+  
+  /*--- The least-squares model is built on the displacements of the owned interface points ---*/
+  if (!IQN_Init) {
+    vector<bool> onInterface(nPointDomain, false);
+    for (iMarker = 0; iMarker < fea_config->GetnMarker_All(); iMarker++) {
+      if (fea_config->GetMarker_All_ZoneInterface(iMarker) == 0) continue;
+      for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (iPoint < nPointDomain) onInterface[iPoint] = true;
+      }
+    }
+    IQN_Point.clear();
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      if (onInterface[iPoint]) IQN_Point.push_back(iPoint);
+    IQN_Init = true;
+  }
+  
+  const unsigned long nVarInt = IQN_Point.size()*nDim;
+  const unsigned long nVarAll = nPointDomain*nDim;
+  
+  /*--- A new time step discards the previous iterate and the secant pairs that are too old ---*/
+  if (iOuterIter == 0) {
+    IQN_TimeStep++;
+    for (iVec = IQN_V.size(); iVec > 0; iVec--) {
+      if (IQN_Step[iVec-1] + nReuseSteps < IQN_TimeStep) {
+        IQN_V.erase(IQN_V.begin()+iVec-1);
+        IQN_W.erase(IQN_W.begin()+iVec-1);
+        IQN_Step.erase(IQN_Step.begin()+iVec-1);
+      }
+    }
+    IQN_HaveOld = false;
+  }
+  
+  /*--- Interface residual (computed minus predicted) and computed displacements ---*/
+  vector<su2double> Res(nVarInt), Calc(nVarAll);
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    dispCalc = node[iPoint]->GetSolution();
+    for (iDim = 0; iDim < nDim; iDim++) Calc[iPoint*nDim+iDim] = dispCalc[iDim];
+  }
+  for (iInt = 0; iInt < IQN_Point.size(); iInt++) {
+    dispPred = node[IQN_Point[iInt]]->GetSolution_Pred();
+    dispCalc = node[IQN_Point[iInt]]->GetSolution();
+    for (iDim = 0; iDim < nDim; iDim++) Res[iInt*nDim+iDim] = dispCalc[iDim] - dispPred[iDim];
+  }
+  
+  /*--- The newest secant pair is the change with respect to the previous coupling iteration ---*/
+  if (IQN_HaveOld) {
+    vector<su2double> deltaRes(nVarInt), deltaCalc(nVarAll);
+    for (iVar = 0; iVar < nVarInt; iVar++) deltaRes[iVar] = Res[iVar] - IQN_Res_Old[iVar];
+    for (iVar = 0; iVar < nVarAll; iVar++) deltaCalc[iVar] = Calc[iVar] - IQN_Calc_Old[iVar];
+    
+    IQN_V.insert(IQN_V.begin(), deltaRes);
+    IQN_W.insert(IQN_W.begin(), deltaCalc);
+    IQN_Step.insert(IQN_Step.begin(), IQN_TimeStep);
+    
+    if (IQN_V.size() > nMaxVectors) {
+      IQN_V.resize(nMaxVectors);
+      IQN_W.resize(nMaxVectors);
+      IQN_Step.resize(nMaxVectors);
+    }
+  }
+  IQN_Res_Old  = Res;
+  IQN_Calc_Old = Calc;
+  IQN_HaveOld  = true;
+  
+  IQN_Coeff.clear();
+  nVec = IQN_V.size();
+  if (nVec == 0) return;
+  
+  /*--- QR decomposition of V by classical Gram-Schmidt with one reorthogonalization. The columns
+        are processed from the newest to the oldest, so the filter removes the oldest information.
+        The dot products of every pass are reduced together, which keeps the number of collectives
+        proportional to the number of secant pairs. ---*/
+  vector<vector<su2double> > Q, R;
+  vector<bool> keep(nVec, false);
+  vector<su2double> sbuf, rbuf;
+  
+  for (iVec = 0; iVec < nVec; iVec++) {
+    
+    nKept = Q.size();
+    vector<su2double> q = IQN_V[iVec], rCol(nKept+1, 0.0);
+    
+    for (iPass = 0; iPass < 2; iPass++) {
+      
+      /*--- Projections on the kept columns, plus the squared norm of the column in the first pass ---*/
+      sbuf.assign(nKept+1, 0.0);
+      for (jVec = 0; jVec < nKept; jVec++)
+        for (iVar = 0; iVar < nVarInt; iVar++) sbuf[jVec] += Q[jVec][iVar]*q[iVar];
+      if (iPass == 0)
+        for (iVar = 0; iVar < nVarInt; iVar++) sbuf[nKept] += q[iVar]*q[iVar];
+      
+      rbuf.resize(nKept+1);
+#ifdef HAVE_MPI
+      SU2_MPI::Allreduce(sbuf.data(), rbuf.data(), nKept+1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+      rbuf = sbuf;
+#endif
+      if (iPass == 0) rCol[nKept] = rbuf[nKept];
+      
+      for (jVec = 0; jVec < nKept; jVec++) {
+        rCol[jVec] += rbuf[jVec];
+        for (iVar = 0; iVar < nVarInt; iVar++) q[iVar] -= rbuf[jVec]*Q[jVec][iVar];
+      }
+    }
+    
+    norm_Ini = sqrt(rCol[nKept]);
+    
+    norm = 0.0;
+    for (iVar = 0; iVar < nVarInt; iVar++) norm += q[iVar]*q[iVar];
+#ifdef HAVE_MPI
+    su2double norm_Local = norm;
+    SU2_MPI::Allreduce(&norm_Local, &norm, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    norm = sqrt(norm);
+    
+    /*--- Filter the column if it is parallel to the newer ones ---*/
+    if ((norm_Ini <= EPS) || (norm < filterTol*norm_Ini)) continue;
+    
+    for (iVar = 0; iVar < nVarInt; iVar++) q[iVar] /= norm;
+    rCol[nKept] = norm;
+    
+    Q.push_back(q);
+    R.push_back(rCol);
+    keep[iVec] = true;
+  }
+  
+  /*--- Remove the filtered secant pairs, the kept ones remain aligned with the columns of R ---*/
+  for (iVec = nVec; iVec > 0; iVec--) {
+    if (!keep[iVec-1]) {
+      IQN_V.erase(IQN_V.begin()+iVec-1);
+      IQN_W.erase(IQN_W.begin()+iVec-1);
+      IQN_Step.erase(IQN_Step.begin()+iVec-1);
+    }
+  }
+  nKept = Q.size();
+  if (nKept == 0) return;
+  
+  /*--- Least-squares solution of V*alpha = -Res, i.e. R*alpha = -Q'*Res ---*/
+  sbuf.assign(nKept, 0.0);
+  for (jVec = 0; jVec < nKept; jVec++)
+    for (iVar = 0; iVar < nVarInt; iVar++) sbuf[jVec] -= Q[jVec][iVar]*Res[iVar];
+  rbuf.resize(nKept);
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(sbuf.data(), rbuf.data(), nKept, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  rbuf = sbuf;
+#endif
+  
+  /*--- Back substitution, R[j][i] is the entry in row i and column j ---*/
+  IQN_Coeff.assign(nKept, 0.0);
+  for (iVec = nKept; iVec > 0; iVec--) {
+    su2double val = rbuf[iVec-1];
+    for (jVec = iVec; jVec < nKept; jVec++) val -= R[jVec][iVec-1]*IQN_Coeff[jVec];
+    IQN_Coeff[iVec-1] = val/R[iVec-1][iVec-1];
+  }
+  
+}
+
 void CFEASolver::SetAitken_Relaxation(CGeometry **fea_geometry,
                                                  CConfig *fea_config, CSolver ***fea_solution) {
   
@@ -4430,6 +5032,7 @@ void CFEASolver::SetAitken_Relaxation(CGeometry **fea_geometry,
   unsigned short RelaxMethod_FSI;
   su2double *dispPred, *dispCalc;
   su2double WAitken;
+  size_t iVec;
   
   RelaxMethod_FSI = fea_config->GetRelaxation_Method_FSI();
   
@@ -4444,10 +5047,16 @@ void CFEASolver::SetAitken_Relaxation(CGeometry **fea_geometry,
     else if (RelaxMethod_FSI == AITKEN_DYNAMIC) {
       WAitken = GetWAitken_Dyn();
     }
+    else if (RelaxMethod_FSI == IQN_ILS) {
+      WAitken = GetWAitken_Dyn();
+    }
     else {
       WAitken = 1.0;
     }
     
+    /*--- The IQN-ILS predictor is the computed solution corrected with the secant pairs ---*/
+    bool iqnUpdate = (RelaxMethod_FSI == IQN_ILS) && !IQN_Coeff.empty();
+    
     // To nPointDomain; we need to communicate the solutions (predicted, old and old predicted) after this routine
     for (iPoint=0; iPoint < nPointDomain; iPoint++) {
       
@@ -4462,8 +5071,17 @@ void CFEASolver::SetAitken_Relaxation(CGeometry **fea_geometry,
       fea_solution[MESH_0][FEA_SOL]->node[iPoint]->SetSolution_Old(dispCalc);
       
       /*--- Apply the Aitken relaxation ---*/
-      for (iDim=0; iDim < nDim; iDim++) {
-        dispPred[iDim] = (1.0 - WAitken)*dispPred[iDim] + WAitken*dispCalc[iDim];
+      if (iqnUpdate) {
+        for (iDim=0; iDim < nDim; iDim++) {
+          dispPred[iDim] = dispCalc[iDim];
+          for (iVec = 0; iVec < IQN_Coeff.size(); iVec++)
+            dispPred[iDim] += IQN_Coeff[iVec]*IQN_W[iVec][iPoint*nDim+iDim];
+        }
+      }
+      else {
+        for (iDim=0; iDim < nDim; iDim++) {
+          dispPred[iDim] = (1.0 - WAitken)*dispPred[iDim] + WAitken*dispCalc[iDim];
+        }
       }
       
     }
@@ -4536,7 +5154,7 @@ void CFEASolver::Compute_OFRefGeom(CGeometry *geometry, CSolver **solver_contain
   }
 
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&objective_function,  &objective_function_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&objective_function,  &objective_function_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
     objective_function_reduce        = objective_function;
 #endif
@@ -4679,9 +5297,9 @@ void CFEASolver::Compute_OFRefNode(CGeometry *geometry, CSolver **solver_contain
   }
 
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&objective_function,  &objective_function_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&difX,  &difX_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&difY,  &difY_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&objective_function,  &objective_function_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&difX,  &difX_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&difY,  &difY_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
     objective_function_reduce        = objective_function;
     difX_reduce                      = difX;
@@ -4802,9 +5420,9 @@ void CFEASolver::Compute_OFVolFrac(CGeometry *geometry, CSolver **solver_contain
 #ifdef HAVE_MPI
   {
     su2double tmp;
-    SU2_MPI::Allreduce(&total_volume,&tmp,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&total_volume,&tmp,1,MPI_SU2DOUBLE,MPI_SUM,MPI_COMM_WORLD);
     total_volume = tmp;
-    SU2_MPI::Allreduce(&integral,&tmp,1,MPI_DOUBLE,MPI_SUM,MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&integral,&tmp,1,MPI_SU2DOUBLE,MPI_SUM,MPI_COMM_WORLD);
     integral = tmp;
   }
 #endif
@@ -4886,8 +5504,8 @@ void CFEASolver::Stiffness_Penalty(CGeometry *geometry, CSolver **solver, CNumer
 // Reduce value across processors for parallelization
 
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&weightedValue,  &weightedValue_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&totalVolume,  &totalVolume_reduce,  1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&weightedValue,  &weightedValue_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&totalVolume,  &totalVolume_reduce,  1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
     weightedValue_reduce        = weightedValue;
     totalVolume_reduce          = totalVolume;
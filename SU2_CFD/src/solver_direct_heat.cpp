@@ -40,6 +40,11 @@
 CHeatSolverFVM::CHeatSolverFVM(void) : CSolver() {
 
   ConjugateVar = NULL;
+
+  Reuse_Jacobian  = false;
+  Jacobian_Frozen = false;
+  Precond_Ready   = false;
+  Diffusivity_Jacobian = 0.0;
 }
 
 CHeatSolverFVM::CHeatSolverFVM(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
@@ -82,7 +87,7 @@ CHeatSolverFVM::CHeatSolverFVM(CGeometry *geometry, CConfig *config, unsigned sh
   /*--- Define some auxiliar vector related with the residual ---*/
 
   Residual      = new su2double[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]      = 0.0;
-  Residual_RMS  = new su2double[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+  Residual_RMS  = new accumdouble[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
   Residual_i    = new su2double[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]    = 0.0;
   Residual_j    = new su2double[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]    = 0.0;
   Residual_Max  = new su2double[nVar];  for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
@@ -138,6 +143,23 @@ CHeatSolverFVM::CHeatSolverFVM(CGeometry *geometry, CConfig *config, unsigned sh
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
 
+  /*--- The operator of the solid is linear with constant coefficients, it may be assembled
+   and preconditioned once. Only the terms of the diagonal that change from one iteration
+   to the next (time step and CHT interface) are then updated. Not used for the derivatives,
+   moving grids, or when the heat equation is coupled with the flow. ---*/
+
+  Reuse_Jacobian = (config->GetLinear_Solver_Reuse_Heat() && !flow &&
+                    (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) &&
+                    !config->GetDiscrete_Adjoint() && !config->GetGrid_Movement());
+  Jacobian_Frozen = false;
+  Precond_Ready   = false;
+  Diffusivity_Jacobian = 0.0;
+
+  if (Reuse_Jacobian) {
+    Diag_Time.resize(nPoint,0.0);  Diag_Time_New.resize(nPoint,0.0);
+    Diag_CHT.resize(nPoint,0.0);   Diag_CHT_New.resize(nPoint,0.0);
+  }
+
   if (config->GetExtraOutput()) {
     if (nDim == 2) { nOutputVariables = 13; }
     else if (nDim == 3) { nOutputVariables = 19; }
@@ -262,8 +284,23 @@ void CHeatSolverFVM::Preprocessing(CGeometry *geometry, CSolver **solver_contain
     LinSysRes.SetBlock_Zero(iPoint);
   }
 
-  /*--- Initialize the Jacobian matrices ---*/
-  Jacobian.SetValZero();
+  /*--- Initialize the Jacobian matrices, the kept operator of the solid is only
+   assembled again if the material changed. Its variable diagonal terms are
+   gathered by the residual routines and applied in ImplicitEuler_Iteration. ---*/
+
+  if (Reuse_Jacobian) {
+    if (Diffusivity_Jacobian != config->GetThermalDiffusivity_Solid()) Jacobian_Frozen = false;
+    if (!Jacobian_Frozen) {
+      Jacobian.SetValZero();
+      Precond_Ready = false;
+      Diffusivity_Jacobian = config->GetThermalDiffusivity_Solid();
+      for (iPoint = 0; iPoint < nPoint; iPoint++) { Diag_Time[iPoint] = 0.0; Diag_CHT[iPoint] = 0.0; }
+    }
+    for (iPoint = 0; iPoint < nPoint; iPoint++) { Diag_Time_New[iPoint] = 0.0; Diag_CHT_New[iPoint] = 0.0; }
+  }
+  else {
+    Jacobian.SetValZero();
+  }
 
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config);
   if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) SetSolution_Gradient_LS(geometry, config);
@@ -525,8 +562,8 @@ void CHeatSolverFVM::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *c
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 
 #else
 
@@ -583,9 +620,9 @@ void CHeatSolverFVM::Centered_Residual(CGeometry *geometry, CSolver **solver_con
       for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
 
         /*--- Points in edge ---*/
-        iPoint = geometry->edge[iEdge]->GetNode(0);
-        jPoint = geometry->edge[iEdge]->GetNode(1);
-        numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        iPoint = geometry->GetEdge_Node(iEdge,0);
+        jPoint = geometry->GetEdge_Node(iEdge,1);
+        numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
 
         /*--- Primitive variables w/o reconstruction ---*/
         V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
@@ -634,9 +671,9 @@ void CHeatSolverFVM::Upwind_Residual(CGeometry *geometry, CSolver **solver_conta
       for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
 
         /*--- Points in edge ---*/
-        iPoint = geometry->edge[iEdge]->GetNode(0);
-        jPoint = geometry->edge[iEdge]->GetNode(1);
-        numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+        iPoint = geometry->GetEdge_Node(iEdge,0);
+        jPoint = geometry->GetEdge_Node(iEdge,1);
+        numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
 
         /*--- Primitive variables w/o reconstruction ---*/
         V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
@@ -776,10 +813,12 @@ void CHeatSolverFVM::Viscous_Residual(CGeometry *geometry, CSolver **solver_cont
     LinSysRes.SubtractBlock(iPoint, Residual);
     LinSysRes.AddBlock(jPoint, Residual);
 
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    if (!Jacobian_Frozen) {
+      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
+      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
+      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    }
   }
 }
 
@@ -834,8 +873,8 @@ void CHeatSolverFVM::Set_Heatflux_Areas(CGeometry *geometry, CConfig *config) {
     }
   }
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(Local_Surface_Areas, Surface_Areas, config->GetnMarker_HeatFlux(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&Local_HeatFlux_Areas_Monitor, &Total_HeatFlux_Areas_Monitor, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Local_Surface_Areas, Surface_Areas, config->GetnMarker_HeatFlux(), MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&Local_HeatFlux_Areas_Monitor, &Total_HeatFlux_Areas_Monitor, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
     for( iMarker_HeatFlux = 0; iMarker_HeatFlux < config->GetnMarker_HeatFlux(); iMarker_HeatFlux++ ) {
       Surface_Areas[iMarker_HeatFlux] = Local_Surface_Areas[iMarker_HeatFlux];
@@ -911,7 +950,7 @@ void CHeatSolverFVM::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_co
         }
 
         LinSysRes.SubtractBlock(iPoint, Res_Visc);
-        Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+        if (!Jacobian_Frozen) Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
     }
   }
 }
@@ -1252,7 +1291,8 @@ void CHeatSolverFVM::BC_ConjugateHeat_Interface(CGeometry *geometry, CSolver **s
             if (implicit) {
 
               Jacobian_i[0][0] = Conductance*Area;
-              Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
+              if (Reuse_Jacobian) Diag_CHT_New[iPoint] -= Jacobian_i[0][0];
+              else Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
             }
           }
         }
@@ -1387,8 +1427,8 @@ void CHeatSolverFVM::Heat_Fluxes(CGeometry *geometry, CSolver **solver_container
 #ifdef HAVE_MPI
   MyAllBound_HeatFlux = AllBound_HeatFlux;
   MyAllBound_AvgTemperature = AllBound_AvgTemperature;
-  SU2_MPI::Allreduce(&MyAllBound_HeatFlux, &AllBound_HeatFlux, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_AvgTemperature, &AllBound_AvgTemperature, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyAllBound_HeatFlux, &AllBound_HeatFlux, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyAllBound_AvgTemperature, &AllBound_AvgTemperature, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #endif
 
   if (Total_HeatFlux_Areas_Monitor != 0.0) {
@@ -1570,13 +1610,13 @@ void CHeatSolverFVM::SetTime_Step(CGeometry *geometry, CSolver **solver_containe
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Min_Delta_Time = rbuf_time;
 
     sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Max_Delta_Time = rbuf_time;
 #endif
   }
@@ -1586,8 +1626,8 @@ void CHeatSolverFVM::SetTime_Step(CGeometry *geometry, CSolver **solver_containe
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_Time = rbuf_time;
 #endif
     for (iPoint = 0; iPoint < nPointDomain; iPoint++)
@@ -1602,8 +1642,8 @@ void CHeatSolverFVM::SetTime_Step(CGeometry *geometry, CSolver **solver_containe
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_UnstTimeND = rbuf_time;
 #endif
     config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
@@ -1673,6 +1713,7 @@ void CHeatSolverFVM::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
                || (config->GetKind_Solver() == RANS)
                || (config->GetKind_Solver() == DISC_ADJ_NAVIER_STOKES)
                || (config->GetKind_Solver() == DISC_ADJ_RANS));
+  bool Build_Precond = true, Reassemble = false;
 
 
   /*--- Set maximum residual to zero ---*/
@@ -1704,11 +1745,13 @@ void CHeatSolverFVM::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
       }
       else {
         Delta = Vol / node[iPoint]->GetDelta_Time();
-        Jacobian.AddVal2Diag(iPoint, Delta);
+        if (Reuse_Jacobian) Diag_Time_New[iPoint] += Delta;
+        else Jacobian.AddVal2Diag(iPoint, Delta);
       }
 
     } else {
       Jacobian.SetVal2Diag(iPoint, 1.0);
+      Reassemble = true;
       for (iVar = 0; iVar < nVar; iVar++) {
         total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = 0.0;
@@ -1737,10 +1780,38 @@ void CHeatSolverFVM::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
     }
   }
 
+  /*--- Update the variable diagonal terms of the kept operator. Its preconditioner is
+   only rebuilt when the time step changes, the CHT interface terms only modify the
+   boundary rows and are left to the Krylov solver. A diagonal overwritten above
+   (zero time step) invalidates the kept operator for the next iteration. ---*/
+
+  if (Reuse_Jacobian) {
+    int TimeStep_Changed = !Precond_Ready;
+
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (node[iPoint]->GetDelta_Time() == 0.0) continue;
+      if (Diag_Time_New[iPoint] != Diag_Time[iPoint]) TimeStep_Changed = 1;
+      Delta = (Diag_Time_New[iPoint]-Diag_Time[iPoint]) + (Diag_CHT_New[iPoint]-Diag_CHT[iPoint]);
+      if (Delta != 0.0) Jacobian.AddVal2Diag(iPoint, Delta);
+    }
+    Diag_Time.swap(Diag_Time_New);
+    Diag_CHT.swap(Diag_CHT_New);
+
+#ifdef HAVE_MPI
+    int TimeStep_Changed_Local = TimeStep_Changed;
+    SU2_MPI::Allreduce(&TimeStep_Changed_Local, &TimeStep_Changed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+    Build_Precond = (TimeStep_Changed != 0);
+  }
+
   /*--- Solve or smooth the linear system ---*/
 
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config, NULL, Build_Precond);
+
+  if (Reuse_Jacobian) {
+    Jacobian_Frozen = !Reassemble;
+    Precond_Ready = Jacobian_Frozen;
+  }
 
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     for (iVar = 0; iVar < nVar; iVar++) {
@@ -1798,8 +1869,8 @@ void CHeatSolverFVM::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 
 #else
 
@@ -1870,8 +1941,8 @@ void CHeatSolverFVM::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config)
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 
 #else
 
@@ -1946,8 +2017,8 @@ void CHeatSolverFVM::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *con
 #ifdef HAVE_MPI
 
       /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
 
 #else
 
@@ -2154,7 +2225,8 @@ void CHeatSolverFVM::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_
             Jacobian_i[iVar][iVar] = (Volume_nP1*3.0)/(2.0*TimeStep);
         }
 
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        if (Reuse_Jacobian) Diag_Time_New[iPoint] += Jacobian_i[0][0];
+        else Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
       }
     }
   }
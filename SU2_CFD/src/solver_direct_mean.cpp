@@ -42,6 +42,8 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   
   /*--- Basic array initialization ---*/
   
+  Periodic_Vector_Rotation = true;
+
   CD_Inv = NULL; CL_Inv = NULL; CSF_Inv = NULL;  CEff_Inv = NULL;
   CMx_Inv = NULL; CMy_Inv = NULL; CMz_Inv = NULL;
   CFx_Inv = NULL; CFy_Inv = NULL; CFz_Inv = NULL;
@@ -92,9 +94,15 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   
   iPoint_UndLapl = NULL;
   jPoint_UndLapl = NULL;
+  Lambda_Ready = false; Edge_Lambda_Ready = false;
   LowMach_Precontioner = NULL;
   Primitive = NULL; Primitive_i = NULL; Primitive_j = NULL;
   CharacPrimVar = NULL;
+  taskThreadPool = NULL;
+  edgeLoopChunks = EDGE_CENTERED_RESIDUAL;
+  geometryChunks = NULL;
+  configChunks   = NULL;
+  iMeshChunks    = MESH_0;
 
   DonorPrimVar = NULL; DonorGlobalIndex = NULL;
   ActDisk_DeltaP = NULL; ActDisk_DeltaT = NULL;
@@ -105,6 +113,9 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   Smatrix = NULL; Cvector = NULL;
  
   Secondary = NULL; Secondary_i = NULL; Secondary_j = NULL;
+  
+  BC_Normal = NULL; BC_Velocity_i = NULL; BC_Velocity_b = NULL;
+  BC_Jacobian_b = NULL; BC_DubDu = NULL;
 
   /*--- Fixed CL mode initialization (cauchy criteria) ---*/
   
@@ -116,6 +127,11 @@ CEulerSolver::CEulerSolver(void) : CSolver() {
   Cauchy_Serie = NULL;
   
   AoA_FD_Change = false;
+  AoA_Newton_Prev = 0.0;
+  CL_Newton_Prev = 0.0;
+  dCL_dAlpha_Newton = 0.0;
+  Res_Newton_Max = -1E30;
+  Iter_Newton_AoA = 0;
 
   FluidModel   = NULL;
   
@@ -279,15 +295,24 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   
   iPoint_UndLapl = NULL;
   jPoint_UndLapl = NULL;
+  Lambda_Ready = false; Edge_Lambda_Ready = false;
   LowMach_Precontioner = NULL;
   Primitive = NULL; Primitive_i = NULL; Primitive_j = NULL;
   CharacPrimVar = NULL;
+  taskThreadPool = NULL;
+  edgeLoopChunks = EDGE_CENTERED_RESIDUAL;
+  geometryChunks = NULL;
+  configChunks   = NULL;
+  iMeshChunks    = MESH_0;
   DonorPrimVar = NULL; DonorGlobalIndex = NULL;
   ActDisk_DeltaP = NULL; ActDisk_DeltaT = NULL;
 
   Smatrix = NULL; Cvector = NULL;
 
   Secondary=NULL; Secondary_i=NULL; Secondary_j=NULL;
+  
+  BC_Normal = NULL; BC_Velocity_i = NULL; BC_Velocity_b = NULL;
+  BC_Jacobian_b = NULL; BC_DubDu = NULL;
 
   /*--- Fixed CL mode initialization (cauchy criteria) ---*/
 
@@ -299,6 +324,11 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   Cauchy_Serie = NULL;
   
   AoA_FD_Change = false;
+  AoA_Newton_Prev = 0.0;
+  CL_Newton_Prev = 0.0;
+  dCL_dAlpha_Newton = config->GetdCL_dAlpha();
+  Res_Newton_Max = -1E30;
+  Iter_Newton_AoA = 0;
 
   FluidModel = NULL;
   
@@ -362,6 +392,9 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   nPrimVar = nDim+9; nPrimVarGrad = nDim+4;
   nSecondaryVar = 2; nSecondaryVarGrad = 2;
 
+  /*--- The momentum (velocity) of the halo points is rotated across periodic boundaries. ---*/
+
+  Periodic_Vector_Rotation = true;
   
   /*--- Initialize nVarGrad for deallocation ---*/
   
@@ -389,7 +422,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   /*--- Define some auxiliary vectors related to the residual ---*/
   
   Residual      = new su2double[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]      = 0.0;
-  Residual_RMS  = new su2double[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+  Residual_RMS  = new accumdouble[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
   Residual_Max  = new su2double[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
   Residual_i    = new su2double[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]    = 0.0;
   Residual_j    = new su2double[nVar];         for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]    = 0.0;
@@ -430,6 +463,18 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
   Secondary_i = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_i[iVar] = 0.0;
   Secondary_j = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_j[iVar] = 0.0;
   
+  /*--- Define some auxiliary vectors of the boundary conditions ---*/
+  
+  BC_Normal     = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Normal[iDim]     = 0.0;
+  BC_Velocity_i = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Velocity_i[iDim] = 0.0;
+  BC_Velocity_b = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Velocity_b[iDim] = 0.0;
+  BC_Jacobian_b = new su2double*[nVar];
+  BC_DubDu      = new su2double*[nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    BC_Jacobian_b[iVar] = new su2double[nVar];
+    BC_DubDu[iVar]      = new su2double[nVar];
+  }
+  
   /*--- Define some auxiliary vectors related to the undivided lapalacian ---*/
   
   if (config->GetKind_ConvNumScheme_Flow() == SPACE_CENTERED) {
@@ -464,7 +509,7 @@ CEulerSolver::CEulerSolver(CGeometry *geometry, CConfig *config, unsigned short
     }
     
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Euler). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, config->GetJacobian_Edge_Format());
     
     if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
@@ -970,6 +1015,20 @@ CEulerSolver::~CEulerSolver(void) {
   if (Secondary_i != NULL)      delete [] Secondary_i;
   if (Secondary_j != NULL)      delete [] Secondary_j;
 
+  if (BC_Normal != NULL)        delete [] BC_Normal;
+  if (BC_Velocity_i != NULL)    delete [] BC_Velocity_i;
+  if (BC_Velocity_b != NULL)    delete [] BC_Velocity_b;
+  if (BC_Jacobian_b != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      delete [] BC_Jacobian_b[iVar];
+    delete [] BC_Jacobian_b;
+  }
+  if (BC_DubDu != NULL) {
+    for (iVar = 0; iVar < nVar; iVar++)
+      delete [] BC_DubDu[iVar];
+    delete [] BC_DubDu;
+  }
+
   if (LowMach_Precontioner != NULL) {
     for (iVar = 0; iVar < nVar; iVar ++)
       delete [] LowMach_Precontioner[iVar];
@@ -1339,6 +1398,26 @@ CEulerSolver::~CEulerSolver(void) {
     delete [] CkOutflow2;
   }
 
+  /*--- The threads of the edge loops, the numerics of the threads belong to the driver ---*/
+
+  if (taskThreadPool != NULL) delete taskThreadPool;
+
+  for (unsigned short iThread = 1; iThread < Res_Conv_Threads.size(); iThread++) {
+    delete [] Res_Conv_Threads[iThread];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      delete [] Jacobian_i_Threads[iThread][iVar];
+      delete [] Jacobian_j_Threads[iThread][iVar];
+    }
+    delete [] Jacobian_i_Threads[iThread];
+    delete [] Jacobian_j_Threads[iThread];
+    delete [] Primitive_i_Threads[iThread];
+    delete [] Primitive_j_Threads[iThread];
+    delete [] Secondary_i_Threads[iThread];
+    delete [] Secondary_j_Threads[iThread];
+    delete [] Vector_i_Threads[iThread];
+    delete [] Vector_j_Threads[iThread];
+  }
+
 }
 
 void CEulerSolver::InitTurboContainers(CGeometry *geometry, CConfig *config){
@@ -1516,1462 +1595,245 @@ void CEulerSolver::InitTurboContainers(CGeometry *geometry, CConfig *config){
 }
 
 void CEulerSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi, *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  
+  InitiateComms(geometry, config, SOLUTION);
+  CompleteComms(geometry, config, SOLUTION);
+  
+}
+
+void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, SOLUTION_OLD);
+  CompleteComms(geometry, config, SOLUTION_OLD);
+  
+}
+
+void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN);
+  
+}
+
+void CEulerSolver::Set_MPI_Undivided_Laplacian_Sensor(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, UNDIVIDED_LAPLACIAN_SENSOR);
+  CompleteComms(geometry, config, UNDIVIDED_LAPLACIAN_SENSOR);
+  
+}
+
+void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, MAX_EIGENVALUE);
+  CompleteComms(geometry, config, MAX_EIGENVALUE);
+  
+}
+
+void CEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, SENSOR);
+  CompleteComms(geometry, config, SENSOR);
+  
+}
+
+void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, SOLUTION_GRADIENT);
+  CompleteComms(geometry, config, SOLUTION_GRADIENT);
+  
+}
+
+void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, SOLUTION_LIMITER);
+  CompleteComms(geometry, config, SOLUTION_LIMITER);
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, PRIMITIVE_GRADIENT);
+  CompleteComms(geometry, config, PRIMITIVE_GRADIENT);
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, PRIMITIVE_LIMITER);
+  CompleteComms(geometry, config, PRIMITIVE_LIMITER);
+  
+}
+
+void CEulerSolver::Set_MPI_Primitive_Gradient_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  InitiateComms(geometry, config, PRIMITIVE_GRAD_LIMITER);
+  CompleteComms(geometry, config, PRIMITIVE_GRAD_LIMITER);
+  
+}
+
+void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iPoint, iVertex, iSend, iRecv;
+  unsigned short iVar, iMarker;
+  bool rans = ((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS));
+  
+  unsigned short nPrimVar_ = nPrimVar;
+  if (rans) nPrimVar_ += 2; // Add two extra variables for the turbulence.
+  
+  /*--- The pattern of the exchange was set up with the matching of the disk
+   sides, the buffers hold only the matched donor/target pairs. ---*/
+  
+  unsigned long nSend = geometry->GetnVertex_ActDiskSend();
+  unsigned long nRecv = geometry->GetnVertex_ActDiskRecv();
+  
+  vector<su2double> Buffer_Send_PrimVar(nSend*nPrimVar_), Buffer_Receive_PrimVar(nRecv*nPrimVar_);
+  
+  for (iSend = 0; iSend < nSend; iSend++) {
+    iPoint = geometry->GetPoint_ActDiskSend(iSend);
+    for (iVar = 0; iVar < nPrimVar; iVar++)
+      Buffer_Send_PrimVar[nPrimVar_*iSend+iVar] = node[iPoint]->GetPrimitive(iVar);
+    if (rans) {
+      Buffer_Send_PrimVar[nPrimVar_*iSend+nPrimVar]   = solver_container[TURB_SOL]->node[iPoint]->GetSolution(0);
+      Buffer_Send_PrimVar[nPrimVar_*iSend+nPrimVar+1] = 0.0;
+    }
+  }
+  
+  geometry->ExchangeActDisk(nPrimVar_, Buffer_Send_PrimVar.data(), Buffer_Receive_PrimVar.data());
+  
+  /*--- Store the values at the donor vertices ---*/
+  
+  for (iRecv = 0; iRecv < nRecv; iRecv++) {
+    iMarker = geometry->GetMarker_ActDiskRecv(iRecv);
+    iVertex = geometry->GetVertex_ActDiskRecv(iRecv);
+    for (iVar = 0; iVar < nPrimVar_; iVar++)
+      SetDonorPrimVar(iMarker, iVertex, iVar, Buffer_Receive_PrimVar[nPrimVar_*iRecv+iVar]);
+    SetDonorGlobalIndex(iMarker, iVertex, geometry->GetGlobalIndex_ActDiskRecv(iRecv));
+  }
+  
+}
+
+void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
+  Buffer_Send_nPointTotal = 0;
+  long iGlobalIndex, iGlobal;
+  unsigned short iVar, iMarker, jMarker;
+  long nDomain = 0, iDomain, jDomain;
   
 #ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
+  
+  /*--- MPI status and request arrays for non-blocking communications ---*/
+  
+  SU2_MPI::Status status, status_;
+  
+
 #endif
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  /*--- Define buffer vector interior domain ---*/
+  
+  su2double        *Buffer_Send_PrimVar          = NULL;
+  
+  unsigned long *nPointTotal_s = new unsigned long[size];
+  unsigned long *nPointTotal_r = new unsigned long[size];
+  su2double        *iPrimVar          = new su2double [nPrimVar];
+  
+  unsigned long Buffer_Size_PrimVar          = 0;
+  
+  unsigned long PointTotal_Counter = 0;
+  
+  /*--- Allocate the memory that we only need if we have MPI support ---*/
+  
+  su2double        *Buffer_Receive_PrimVar          = NULL;
+  
+  /*--- Basic dimensionalization ---*/
+  
+  nDomain = size;
+  
+  /*--- This loop gets the array sizes of points for each
+   rank to send to each other rank. ---*/
+  
+  for (iDomain = 0; iDomain < nDomain; iDomain++) {
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
+    /*--- Loop over the markers to perform the dimensionalizaton
+     of the domain variables ---*/
+    
+    Buffer_Send_nPointTotal = 0;
+    
+    /*--- Loop over all of the markers and count the number of each
+     type of point and element that needs to be sent. ---*/
+    
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
+          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
+            Buffer_Send_nPointTotal++;
+          }
         }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Solution[iVar]);
-        
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
     }
     
+    /*--- Store the counts on a partition by partition basis. ---*/
+    
+    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
+    
+    /*--- Total counts for allocating send buffers below ---*/
+    
+    Buffer_Size_PrimVar          += nPointTotal_s[iDomain]*(nPrimVar+3);
+    
   }
   
-}
-
-void CEulerSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
+  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  Buffer_Send_PrimVar          = new su2double[Buffer_Size_PrimVar];
   
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+  /*--- Now that we know the sizes of the point, we can
+   allocate and send the information in large chunks to all processors. ---*/
+  
+  for (iDomain = 0; iDomain < nDomain; iDomain++) {
     
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
+    /*--- A rank does not communicate with itself through MPI ---*/
+    
+    if (rank != iDomain) {
       
 #ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
       
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
+      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
       
-#ifdef HAVE_MPI
+      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
       
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+#endif
       
-#else
+    } else {
       
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
+      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
       
-#endif
+      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
       
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
+    }
+    
+    /*--- Receive the counts. All processors are sending their counters to
+     iDomain up above, so only iDomain needs to perform the recv here from
+     all other ranks. ---*/
+    
+    if (rank == iDomain) {
       
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
+      for (jDomain = 0; jDomain < size; jDomain++) {
         
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_U[iVar*nVertexR+iVertex];
+        /*--- A rank does not communicate with itself through MPI ---*/
         
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_U[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_U[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_U[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Undivided_Laplacian(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Undivided_Laplacian = NULL, *Buffer_Send_Undivided_Laplacian = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Undivided_Laplacian = new su2double [nBufferR_Vector];
-      Buffer_Send_Undivided_Laplacian = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Undivided_Laplacian[iVar*nVertexS+iVertex] = node[iPoint]->GetUndivided_Laplacian(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Undivided_Laplacian, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Undivided_Laplacian, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex] = Buffer_Send_Undivided_Laplacian[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Undivided_Laplacian;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = Buffer_Receive_Undivided_Laplacian[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex];
-        }
-        else {
-          Solution[1] = rotMatrix[0][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[2] = rotMatrix[1][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-          Solution[3] = rotMatrix[2][0]*Buffer_Receive_Undivided_Laplacian[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Undivided_Laplacian[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Undivided_Laplacian[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetUndivided_Laplacian(iVar, Solution[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Undivided_Laplacian;
-      
-    }
-    
-  }
-  
-}
-
-void CEulerSolver::Set_MPI_MaxEigenvalue(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR, *Buffer_Receive_Neighbor = NULL, *Buffer_Send_Neighbor = NULL;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      Buffer_Receive_Neighbor = new unsigned short [nBufferR_Vector];
-      Buffer_Send_Neighbor = new unsigned short[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetLambda();
-        Buffer_Send_Neighbor[iVertex] = geometry->node[iPoint]->GetnPoint();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_Neighbor, nBufferS_Vector, MPI_UNSIGNED_SHORT, send_to, 1,
-                        Buffer_Receive_Neighbor, nBufferR_Vector, MPI_UNSIGNED_SHORT, receive_from, 1, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-        Buffer_Receive_Neighbor[iVertex] = Buffer_Send_Neighbor[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      delete [] Buffer_Send_Neighbor;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetLambda(Buffer_Receive_Lambda[iVertex]);
-        geometry->node[iPoint]->SetnNeighbor(Buffer_Receive_Neighbor[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      delete [] Buffer_Receive_Neighbor;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Sensor(CGeometry *geometry, CConfig *config) {
-  unsigned short iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Lambda = NULL, *Buffer_Send_Lambda = NULL;
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS;        nBufferR_Vector = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Lambda = new su2double [nBufferR_Vector];
-      Buffer_Send_Lambda = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_Lambda[iVertex] = node[iPoint]->GetSensor();
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Lambda, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Lambda, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        Buffer_Receive_Lambda[iVertex] = Buffer_Send_Lambda[iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Lambda;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        node[iPoint]->SetSensor(Buffer_Receive_Lambda[iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Lambda;
-      
-    }
-    
-  }
-}
-
-void CEulerSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
-  
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
-}
-
-void CEulerSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nVar];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Limiter[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
-  
-  delete [] Limiter;
-  
-}
-
-void CEulerSolver::Set_MPI_Primitive_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad*nDim;        nBufferR_Vector = nVertexR*nPrimVarGrad*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nPrimVarGrad*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient_Primitive(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
-  
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
-}
-
-void CEulerSolver::Set_MPI_Primitive_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nPrimVarGrad];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < nMarker; iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nPrimVarGrad;        nBufferR_Vector = nVertexR*nPrimVarGrad;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter_Primitive(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          Limiter[iVar] = Buffer_Receive_Limit[iVar*nVertexR+iVertex];
-        
-        /*--- Rotate the momentum components. ---*/
-        if (nDim == 2) {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex];
-        }
-        else {
-          Limiter[1] = rotMatrix[0][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[0][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[0][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[2] = rotMatrix[1][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[1][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[1][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-          Limiter[3] = rotMatrix[2][0]*Buffer_Receive_Limit[1*nVertexR+iVertex] +
-          rotMatrix[2][1]*Buffer_Receive_Limit[2*nVertexR+iVertex] +
-          rotMatrix[2][2]*Buffer_Receive_Limit[3*nVertexR+iVertex];
-        }
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          node[iPoint]->SetLimiter_Primitive(iVar, Limiter[iVar]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
-  
-  delete [] Limiter;
-  
-}
-
-void CEulerSolver::Set_MPI_ActDisk(CSolver **solver_container, CGeometry *geometry, CConfig *config) {
-  
-  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
-  Buffer_Send_nPointTotal = 0;
-  long iGlobalIndex, iGlobal;
-  unsigned short iVar, iMarker, jMarker;
-  long nDomain = 0, iDomain, jDomain;
-  //bool ActDisk_Perimeter;
-  bool rans = ((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS));
-  
-  unsigned short nPrimVar_ = nPrimVar;
-  if (rans) nPrimVar_ += 2; // Add two extra variables for the turbulence.
-  
-#ifdef HAVE_MPI
-  
-  /*--- MPI status and request arrays for non-blocking communications ---*/
-  
-  SU2_MPI::Status status;
-  
-#endif
-  
-  /*--- Define buffer vector interior domain ---*/
-  
-  su2double *Buffer_Send_PrimVar = NULL;
-  long      *Buffer_Send_Data    = NULL;
-  
-  unsigned long *nPointTotal_s = new unsigned long[size];
-  unsigned long *nPointTotal_r = new unsigned long[size];
-  su2double *iPrimVar = new su2double [nPrimVar_];
-  
-  unsigned long Buffer_Size_PrimVar = 0;
-  unsigned long Buffer_Size_Data    = 0;
-  
-  unsigned long PointTotal_Counter = 0;
-  
-  /*--- Allocate the memory that we only need if we have MPI support ---*/
-  
-  su2double *Buffer_Receive_PrimVar = NULL;
-  long      *Buffer_Receive_Data    = NULL;
-  
-  /*--- Basic dimensionalization ---*/
-  
-  nDomain = size;
-  
-  /*--- This loop gets the array sizes of points for each
-   rank to send to each other rank. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- Loop over the markers to perform the dimensionalizaton
-     of the domain variables ---*/
-    
-    Buffer_Send_nPointTotal = 0;
-    
-    /*--- Loop over all of the markers and count the number of each
-     type of point and element that needs to be sent. ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-//          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain()) && (!ActDisk_Perimeter)) {
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            Buffer_Send_nPointTotal++;
-          }
-        }
-      }
-    }
-    
-    /*--- Store the counts on a partition by partition basis. ---*/
-    
-    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
-    
-    /*--- Total counts for allocating send buffers below ---*/
-    
-    Buffer_Size_PrimVar += nPointTotal_s[iDomain]*(nPrimVar_);
-    Buffer_Size_Data += nPointTotal_s[iDomain]*(3);
-    
-  }
-  
-  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
-  
-  Buffer_Send_PrimVar = new su2double[Buffer_Size_PrimVar];
-  Buffer_Send_Data    = new long[Buffer_Size_Data];
-  
-  /*--- Now that we know the sizes of the point, we can
-   allocate and send the information in large chunks to all processors. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- A rank does not communicate with itself through MPI ---*/
-    
-    if (rank != iDomain) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
-      
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
-      
-#endif
-      
-    } else {
-      
-      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
-      
-      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
-      
-    }
-    
-    /*--- Receive the counts. All processors are sending their counters to
-     iDomain up above, so only iDomain needs to perform the recv here from
-     all other ranks. ---*/
-    
-    if (rank == iDomain) {
-      
-      for (jDomain = 0; jDomain < size; jDomain++) {
-        
-        /*--- A rank does not communicate with itself through MPI ---*/
-        
-        if (rank != jDomain) {
-          
-#ifdef HAVE_MPI
-          
-          /*--- Recv the data by probing for the current sender, jDomain,
-           first and then receiving the values from it. ---*/
-          
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
-          
-#endif
-          
-        }
-      }
-      
-    }
-  }
-  
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-  
-#endif
-  
-  /*--- Initialize the counters for the larger send buffers (by domain) ---*/
-  
-  PointTotal_Counter  = 0;
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- Set the value of the interior geometry. Initialize counters. ---*/
-    
-    iPointTotal = 0;
-    
-    /*--- Load up the actual values into the buffers for sending. ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      
-      if ((config->GetMarker_All_KindBC(iMarker) == ACTDISK_INLET) ||
-          (config->GetMarker_All_KindBC(iMarker) == ACTDISK_OUTLET)) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          //ActDisk_Perimeter = geometry->vertex[iMarker][iVertex]->GetActDisk_Perimeter();
-          
-//          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain()) && (!ActDisk_Perimeter)) {
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            
-            for (iVar = 0; iVar < nPrimVar; iVar++) {
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+iVar] = node[iPoint]->GetPrimitive(iVar);
-            }
-            if (rans) {
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+nPrimVar] = solver_container[TURB_SOL]->node[iPoint]->GetSolution(0);
-              Buffer_Send_PrimVar[(nPrimVar_)*(PointTotal_Counter+iPointTotal)+(nPrimVar+1)] = 0.0;
-            }
-            
-            iGlobalIndex = geometry->node[iPoint]->GetGlobalIndex();
-            jVertex = geometry->vertex[iMarker][iVertex]->GetDonorVertex();
-            jMarker = geometry->vertex[iMarker][iVertex]->GetDonorMarker();
-            
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(0)]  = iGlobalIndex;
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(1)] = jVertex;
-            Buffer_Send_Data[(3)*(PointTotal_Counter+iPointTotal)+(2)]  = jMarker;
-            
-            iPointTotal++;
-            
-          }
-          
-        }
-        
-      }
-      
-    }
-    
-    /*--- Send the buffers with the geometrical information ---*/
-    
-    if (iDomain != rank) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Communicate the coordinates, global index, colors, and element
-       date to iDomain with non-blocking sends. ---*/
-      
-      SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar_)],
-                     nPointTotal_s[iDomain]*(nPrimVar_), MPI_DOUBLE, iDomain,
-                     iDomain,  MPI_COMM_WORLD);
-      
-      SU2_MPI::Bsend(&Buffer_Send_Data[PointTotal_Counter*(3)],
-                     nPointTotal_s[iDomain]*(3), MPI_LONG, iDomain,
-                     iDomain+nDomain,  MPI_COMM_WORLD);
-      
-#endif
-      
-    }
-    
-    else {
-      
-      /*--- Allocate local memory for the local recv of the elements ---*/
-      
-      Buffer_Receive_PrimVar            = new su2double[nPointTotal_s[iDomain]*(nPrimVar_)];
-      Buffer_Receive_Data               = new long[nPointTotal_s[iDomain]*(3)];
-      
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(nPrimVar_); iter++)
-        Buffer_Receive_PrimVar[iter] = Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar_)+iter];
-      
-      for (iter = 0; iter < nPointTotal_s[iDomain]*(3); iter++)
-        Buffer_Receive_Data[iter] = Buffer_Send_Data[PointTotal_Counter*(3)+iter];
-      
-      
-      /*--- Recv the point data from ourselves (same procedure as above) ---*/
-      
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-        
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar_)+iVar];
-        
-        iGlobal       =  Buffer_Receive_Data[iPoint*(3)+(0)];
-        iVertex      =  Buffer_Receive_Data[iPoint*(3)+(1)];
-        iMarker      = Buffer_Receive_Data[iPoint*(3)+(2)];
-        
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          SetDonorPrimVar(iMarker, iVertex, iVar, iPrimVar[iVar]);
-        
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-        
-      }
-      
-      /*--- Delete memory for recv the point stuff ---*/
-      
-      delete [] Buffer_Receive_PrimVar;
-      delete [] Buffer_Receive_Data;
-      
-    }
-    
-    /*--- Increment the counters for the send buffers (iDomain loop) ---*/
-    
-    PointTotal_Counter += iPointTotal;
-    
-  }
-  
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-  
-#endif
-  
-  /*--- The next section begins the recv of all data for the interior
-   points/elements in the mesh. First, create the domain structures for
-   the points on this rank. First, we recv all of the point data ---*/
-  
-  for (iDomain = 0; iDomain < size; iDomain++) {
-    
-    if (rank != iDomain) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Allocate the receive buffer vector. Send the colors so that we
-       know whether what we recv is an owned or halo node. ---*/
-      
-      Buffer_Receive_PrimVar            = new su2double [nPointTotal_r[iDomain]*(nPrimVar_)];
-      Buffer_Receive_Data               = new long [nPointTotal_r[iDomain]*(3)];
-      
-      /*--- Receive the buffers with the coords, global index, and colors ---*/
-      
-      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar_) , MPI_DOUBLE,
-                    iDomain, rank, MPI_COMM_WORLD, &status);
-      
-      SU2_MPI::Recv(Buffer_Receive_Data, nPointTotal_r[iDomain]*(3) , MPI_LONG,
-                    iDomain, rank+nDomain, MPI_COMM_WORLD, &status);
-      
-      /*--- Loop over all of the points that we have recv'd and store the
-       coords, global index vertex and markers ---*/
-      
-      for (iPoint = 0; iPoint < nPointTotal_r[iDomain]; iPoint++) {
-        
-        iGlobal      = Buffer_Receive_Data[iPoint*(3)+(0)];
-        iVertex      = Buffer_Receive_Data[iPoint*(3)+(1)];
-        iMarker      = Buffer_Receive_Data[iPoint*(3)+(2)];
-        
-        for (iVar = 0; iVar < nPrimVar_; iVar++)
-          iPrimVar[iVar] = Buffer_Receive_PrimVar[iPoint*(nPrimVar_)+iVar];
-        
-        for (iVar = 0; iVar < nPrimVar_; iVar++) {
-          SetDonorPrimVar(iMarker, iVertex, iVar, iPrimVar[iVar]);
-        }
-        
-        SetDonorGlobalIndex(iMarker, iVertex, iGlobal);
-        
-      }
-      
-      /*--- Delete memory for recv the point stuff ---*/
-      
-      delete [] Buffer_Receive_PrimVar;
-      delete [] Buffer_Receive_Data;
-      
-#endif
-      
-    }
-    
-  }
-  
-  /*--- Wait for the non-blocking sends to complete. ---*/
-  
-#ifdef HAVE_MPI
-  
-  SU2_MPI::Barrier(MPI_COMM_WORLD);
-  
-#endif
-  
-  /*--- Free all of the memory used for communicating points and elements ---*/
-  
-  delete[] Buffer_Send_PrimVar;
-  delete[] Buffer_Send_Data;
-  
-  /*--- Release all of the temporary memory ---*/
-  
-  delete [] nPointTotal_s;
-  delete [] nPointTotal_r;
-  delete [] iPrimVar;
-  
-}
-
-void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
-  
-  unsigned long iter,  iPoint, iVertex, jVertex, iPointTotal,
-  Buffer_Send_nPointTotal = 0;
-  long iGlobalIndex, iGlobal;
-  unsigned short iVar, iMarker, jMarker;
-  long nDomain = 0, iDomain, jDomain;
-  
-#ifdef HAVE_MPI
-  
-  /*--- MPI status and request arrays for non-blocking communications ---*/
-  
-  SU2_MPI::Status status, status_;
-  
-
-#endif
-  
-  /*--- Define buffer vector interior domain ---*/
-  
-  su2double        *Buffer_Send_PrimVar          = NULL;
-  
-  unsigned long *nPointTotal_s = new unsigned long[size];
-  unsigned long *nPointTotal_r = new unsigned long[size];
-  su2double        *iPrimVar          = new su2double [nPrimVar];
-  
-  unsigned long Buffer_Size_PrimVar          = 0;
-  
-  unsigned long PointTotal_Counter = 0;
-  
-  /*--- Allocate the memory that we only need if we have MPI support ---*/
-  
-  su2double        *Buffer_Receive_PrimVar          = NULL;
-  
-  /*--- Basic dimensionalization ---*/
-  
-  nDomain = size;
-  
-  /*--- This loop gets the array sizes of points for each
-   rank to send to each other rank. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- Loop over the markers to perform the dimensionalizaton
-     of the domain variables ---*/
-    
-    Buffer_Send_nPointTotal = 0;
-    
-    /*--- Loop over all of the markers and count the number of each
-     type of point and element that needs to be sent. ---*/
-    
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-      if (config->GetMarker_All_KindBC(iMarker) == NEARFIELD_BOUNDARY) {
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          jDomain = geometry->vertex[iMarker][iVertex]->GetDonorProcessor();
-          if ((iDomain == jDomain) && (geometry->node[iPoint]->GetDomain())) {
-            Buffer_Send_nPointTotal++;
-          }
-        }
-      }
-    }
-    
-    /*--- Store the counts on a partition by partition basis. ---*/
-    
-    nPointTotal_s[iDomain] = Buffer_Send_nPointTotal;
-    
-    /*--- Total counts for allocating send buffers below ---*/
-    
-    Buffer_Size_PrimVar          += nPointTotal_s[iDomain]*(nPrimVar+3);
-    
-  }
-  
-  /*--- Allocate the buffer vectors in the appropiate domain (master, iDomain) ---*/
-  
-  Buffer_Send_PrimVar          = new su2double[Buffer_Size_PrimVar];
-  
-  /*--- Now that we know the sizes of the point, we can
-   allocate and send the information in large chunks to all processors. ---*/
-  
-  for (iDomain = 0; iDomain < nDomain; iDomain++) {
-    
-    /*--- A rank does not communicate with itself through MPI ---*/
-    
-    if (rank != iDomain) {
-      
-#ifdef HAVE_MPI
-      
-      /*--- Communicate the counts to iDomain with non-blocking sends ---*/
-      
-      SU2_MPI::Bsend(&nPointTotal_s[iDomain], 1, MPI_UNSIGNED_LONG, iDomain, iDomain, MPI_COMM_WORLD);
-      
-#endif
-      
-    } else {
-      
-      /*--- If iDomain = rank, we simply copy values into place in memory ---*/
-      
-      nPointTotal_r[iDomain] = nPointTotal_s[iDomain];
-      
-    }
-    
-    /*--- Receive the counts. All processors are sending their counters to
-     iDomain up above, so only iDomain needs to perform the recv here from
-     all other ranks. ---*/
-    
-    if (rank == iDomain) {
-      
-      for (jDomain = 0; jDomain < size; jDomain++) {
-        
-        /*--- A rank does not communicate with itself through MPI ---*/
-        
-        if (rank != jDomain) {
-          
-#ifdef HAVE_MPI
-          
-          /*--- Recv the data by probing for the current sender, jDomain,
-           first and then receiving the values from it. ---*/
-          
-          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
-          
-#endif
-          
+        if (rank != jDomain) {
+          
+#ifdef HAVE_MPI
+          
+          /*--- Recv the data by probing for the current sender, jDomain,
+           first and then receiving the values from it. ---*/
+          
+          SU2_MPI::Recv(&nPointTotal_r[jDomain], 1, MPI_UNSIGNED_LONG, jDomain, rank, MPI_COMM_WORLD, &status);
+          
+#endif
+          
         }
       }
       
@@ -3036,7 +1898,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
        date to iDomain with non-blocking sends. ---*/
       
       SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar+3)],
-                     nPointTotal_s[iDomain]*(nPrimVar+3), MPI_DOUBLE, iDomain,
+                     nPointTotal_s[iDomain]*(nPrimVar+3), MPI_SU2DOUBLE, iDomain,
                      iDomain,  MPI_COMM_WORLD);
       
 #endif
@@ -3112,7 +1974,7 @@ void CEulerSolver::Set_MPI_Nearfield(CGeometry *geometry, CConfig *config) {
       
       /*--- Receive the buffers with the coords, global index, and colors ---*/
       
-      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_DOUBLE,
+      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_SU2DOUBLE,
                     iDomain, rank, MPI_COMM_WORLD, &status_);
       
       /*--- Loop over all of the points that we have recv'd and store the
@@ -3357,7 +2219,7 @@ void CEulerSolver::Set_MPI_Interface(CGeometry *geometry, CConfig *config) {
        date to iDomain with non-blocking sends. ---*/
       
       SU2_MPI::Bsend(&Buffer_Send_PrimVar[PointTotal_Counter*(nPrimVar+3)],
-                     nPointTotal_s[iDomain]*(nPrimVar+3), MPI_DOUBLE, iDomain,
+                     nPointTotal_s[iDomain]*(nPrimVar+3), MPI_SU2DOUBLE, iDomain,
                      iDomain,  MPI_COMM_WORLD);
       
 #endif
@@ -3428,7 +2290,7 @@ void CEulerSolver::Set_MPI_Interface(CGeometry *geometry, CConfig *config) {
       
       /*--- Receive the buffers with the coords, global index, and colors ---*/
       
-      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_DOUBLE,
+      SU2_MPI::Recv(Buffer_Receive_PrimVar, nPointTotal_r[iDomain]*(nPrimVar+3) , MPI_SU2DOUBLE,
                     iDomain, rank, MPI_COMM_WORLD, &status_);
       
       /*--- Loop over all of the points that we have recv'd and store the
@@ -3802,6 +2664,13 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
       
   }
   
+  /*--- Replace the real gas model by look-up tables generated from it. ---*/
+  
+  if (config->GetLUT_FluidModel()) {
+    FluidModel = new CLookUpTable(FluidModel, config, Pressure_FreeStreamND, Temperature_FreeStreamND);
+    FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+  }
+  
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
   
   if (viscous) {
@@ -3943,10 +2812,10 @@ void CEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMes
       ModelTable << "IDEAL_GAS";
       break;
     case VW_GAS:
-      ModelTable << "VW_GAS";
+      ModelTable << (config->GetLUT_FluidModel() ? "VW_GAS (LUT)" : "VW_GAS");
       break;
     case PR_GAS:
-      ModelTable << "PR_GAS";
+      ModelTable << (config->GetLUT_FluidModel() ? "PR_GAS (LUT)" : "PR_GAS");
       break;
     }
  
@@ -4212,6 +3081,13 @@ void CEulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_c
       if (rans)
         solver_container[MESH_0][TURB_SOL]->LoadRestart(geometry, solver_container, config, SU2_TYPE::Int(config->GetUnst_RestartIter()-1), false);
       
+      /*--- The statistics were restored from the first restart file, add the
+       time step of this one as the original run did. ---*/
+      
+      if (config->GetWrt_Time_Average() &&
+          ((unsigned long)(config->GetUnst_RestartIter()-1) >= config->GetTime_Average_Start_Iter()))
+        solver_container[MESH_0][FLOW_SOL]->Accumulate_TimeAverage(geometry[MESH_0], config);
+      
       /*--- Push back this new solution to time level N. ---*/
       
       for (iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
@@ -4231,6 +3107,9 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   
   unsigned long ErrorCounter = 0;
   
+  double tick = 0.0;
+  config->Tick(&tick);
+  
   unsigned long ExtIter = config->GetExtIter();
   bool cont_adjoint     = config->GetContinuous_Adjoint();
   bool disc_adjoint     = config->GetDiscrete_Adjoint();
@@ -4284,20 +3163,29 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   
   if ((muscl && !center) && (iMesh == MESH_0) && !Output) {
     
-    /*--- Gradient computation ---*/
+    /*--- Gradient and limiter computation, fused in a single pass if requested ---*/
     
-    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-      SetPrimitive_Gradient_GG(geometry, config);
+    if (limiter && !van_albada && config->GetFused_Gradient_Limiter()) {
+      SetPrimitive_Gradient_Limiter(geometry, config);
     }
-    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-      SetPrimitive_Gradient_LS(geometry, config);
+    else {
+      
+      /*--- Gradient computation ---*/
+      
+      if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+        SetPrimitive_Gradient_GG(geometry, config);
+      }
+      if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+        SetPrimitive_Gradient_LS(geometry, config);
+      }
+      
+      /*--- Limiter computation ---*/
+      
+      if (limiter && (iMesh == MESH_0)
+          && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
+      
     }
     
-    /*--- Limiter computation ---*/
-    
-    if (limiter && (iMesh == MESH_0)
-        && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
-    
   }
   
   /*--- Artificial dissipation ---*/
@@ -4305,8 +3193,7 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
   if (center && !Output) {
     SetMax_Eigenvalue(geometry, config);
     if ((center_jst) && (iMesh == MESH_0)) {
-      SetCentered_Dissipation_Sensor(geometry, config);
-      SetUndivided_Laplacian(geometry, config);
+      SetUndivided_Laplacian_Sensor(geometry, config);
     }
   }
   
@@ -4319,9 +3206,12 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     }
   }
   
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, unless the last one is reused (JACOBIAN_LAG) ---*/
   
-  if (implicit && !disc_adjoint) Jacobian.SetValZero();
+  if (implicit && !disc_adjoint) {
+    SetJacobian_Lag(config);
+    Jacobian.SetValZero();
+  }
 
   /*--- Error message ---*/
   
@@ -4333,6 +3223,8 @@ void CEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container
     if (iMesh == MESH_0) config->SetNonphysical_Points(ErrorCounter);
   }
   
+  config->Tock(tick, "CEulerSolver::Preprocessing", PROFILE_PREPROCESSING);
+  
 }
 
 void CEulerSolver::Postprocessing(CGeometry *geometry, CSolver **solver_container, CConfig *config,
@@ -4342,23 +3234,54 @@ unsigned long CEulerSolver::SetPrimitive_Variables(CSolver **solver_container, C
   
   unsigned long iPoint, ErrorCounter = 0;
   bool RightSol = true;
-  
-  for (iPoint = 0; iPoint < nPoint; iPoint ++) {
+
+  /*--- The thermodynamic state is computed for chunks of points with a
+        single call to the fluid model, which avoids a virtual call per
+        point and allows the fluid model to vectorize its evaluation. ---*/
+
+  const unsigned long sizeChunk = 256;
+  su2double rho[sizeChunk], e[sizeChunk], P[sizeChunk], T[sizeChunk],
+            c2[sizeChunk], dPdrho_e[sizeChunk], dPde_rho[sizeChunk];
+
+  for (unsigned long iBeg = 0; iBeg < nPoint; iBeg += sizeChunk) {
+    const unsigned long nChunk = min(sizeChunk, nPoint-iBeg);
+
+    /*--- Gather the density and static energy of the points in the chunk. ---*/
+
+    for (unsigned long i = 0; i < nChunk; ++i) {
+      iPoint = iBeg + i;
+      node[iPoint]->SetVelocity();   // Computes velocity and velocity^2
+      rho[i] = node[iPoint]->GetDensity();
+      e[i]   = node[iPoint]->GetEnergy() - 0.5*node[iPoint]->GetVelocity2();
+    }
+
+    FluidModel->SetTDState_rhoe_Batch(nChunk, rho, e, P, T, c2, dPdrho_e, dPde_rho);
+
+    for (unsigned long i = 0; i < nChunk; ++i) {
+      iPoint = iBeg + i;
     
-    /*--- Initialize the non-physical points vector ---*/
+      /*--- Initialize the non-physical points vector ---*/
     
-    node[iPoint]->SetNon_Physical(false);
+      node[iPoint]->SetNon_Physical(false);
     
-    /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp) ---*/
+      /*--- Compressible flow, primitive variables nDim+5, (T, vx, vy, vz, P, rho, h, c, lamMu, eddyMu, ThCond, Cp).
+            For non-physical points the fluid model holds the state of the restored solution. ---*/
     
-    RightSol = node[iPoint]->SetPrimVar(FluidModel);
-    node[iPoint]->SetSecondaryVar(FluidModel);
+      RightSol = node[iPoint]->SetPrimVar_TDState(P[i], c2[i], T[i], FluidModel);
 
-    if (!RightSol) { node[iPoint]->SetNon_Physical(true); ErrorCounter++; }
+      if (RightSol) {
+        node[iPoint]->SetdPdrho_e(dPdrho_e[i]);
+        node[iPoint]->SetdPde_rho(dPde_rho[i]);
+      }
+      else {
+        node[iPoint]->SetSecondaryVar(FluidModel);
+        node[iPoint]->SetNon_Physical(true); ErrorCounter++;
+      }
     
-    /*--- Initialize the convective, source and viscous residual vector ---*/
+      /*--- Initialize the convective, source and viscous residual vector ---*/
     
-    if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+      if (!Output) LinSysRes.SetBlock_Zero(iPoint);
+    }
     
   }
   
@@ -4378,52 +3301,72 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   
+  /*--- The max. eigenvalue of the centered schemes is the same spectral radius, computed
+   in this iteration. The upwind residual only provides the edge part, of the previous
+   iteration. Either one is used by a single time step, after that the loops are run again. ---*/
+  
+  bool reuse_radius = config->GetReuse_Spectral_Radius();
+  bool full_radius  = (reuse_radius && Lambda_Ready);
+  bool edge_radius  = (reuse_radius && Edge_Lambda_Ready);
+  
+  Lambda_Ready = false; Edge_Lambda_Ready = false;
+  
   Min_Delta_Time = 1.E6; Max_Delta_Time = 0.0;
   
-  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
+  if (full_radius) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetMax_Lambda_Inv(node[iPoint]->GetLambda());
+  }
   
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-    node[iPoint]->SetMax_Lambda_Inv(0.0);
+  /*--- Set maximum inviscid eigenvalue to zero, and compute sound speed ---*/
   
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Point identification, Normal vector and area ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-    
-    /*--- Mean Values ---*/
+  if (!full_radius && !edge_radius) {
     
-    Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
-    Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
-    
-    /*--- Adjustment for grid movement ---*/
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetMax_Lambda_Inv(0.0);
     
-    if (grid_movement) {
-      su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-      su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-      ProjVel_i = 0.0; ProjVel_j = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++) {
-        ProjVel_i += GridVel_i[iDim]*Normal[iDim];
-        ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+    /*--- Loop interior edges ---*/
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      
+      /*--- Point identification, Normal vector and area ---*/
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      Normal = geometry->edge[iEdge]->GetNormal();
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      
+      /*--- Mean Values ---*/
+      
+      Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
+      Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+      
+      /*--- Adjustment for grid movement ---*/
+      
+      if (grid_movement) {
+        su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+        su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+        ProjVel_i = 0.0; ProjVel_j = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          ProjVel_i += GridVel_i[iDim]*Normal[iDim];
+          ProjVel_j += GridVel_j[iDim]*Normal[iDim];
+        }
+        Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
       }
-      Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
+      
+      /*--- Inviscid contribution ---*/
+      
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
+      
     }
     
-    /*--- Inviscid contribution ---*/
-    
-    Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
-    if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
-    if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
-    
   }
   
   /*--- Loop boundary edges ---*/
   
+  if (!full_radius)
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
     if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
     for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
@@ -4469,6 +3412,7 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
       Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
       Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
       Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
+      Local_Delta_Time *= node[iPoint]->GetLocalCFL_Factor();
       if (Local_Delta_Time > config->GetMax_DeltaTime())
         Local_Delta_Time = config->GetMax_DeltaTime();
       node[iPoint]->SetDelta_Time(Local_Delta_Time);
@@ -4485,13 +3429,13 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Min_Delta_Time = rbuf_time;
     
     sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Max_Delta_Time = rbuf_time;
 #endif
   }
@@ -4502,23 +3446,33 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_Time = rbuf_time;
 #endif
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    
+    /*--- Multirate time stepping, the local time step is rounded down to a power of two
+     of the global one ---*/
+    
+    if ((config->GetnLevels_TimeAccurateLTS() > 1) && (config->GetUnst_CFL() != 0.0) && (iMesh == MESH_0)) {
+      config->SetCFL(iMesh,config->GetUnst_CFL());
+      SetMultirate_Levels(geometry, config, Global_Delta_Time);
+    }
+    else {
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
             
-            /*--- Sets the regular CFL equal to the unsteady CFL ---*/
-            config->SetCFL(iMesh,config->GetUnst_CFL());
+              /*--- Sets the regular CFL equal to the unsteady CFL ---*/
+              config->SetCFL(iMesh,config->GetUnst_CFL());
             
-            /*--- If the unsteady CFL is set to zero, it uses the defined unsteady time step, otherwise
-             it computes the time step based on the unsteady CFL ---*/
-            if (config->GetCFL(iMesh) == 0.0) {
-                node[iPoint]->SetDelta_Time(config->GetDelta_UnstTime());
-            } else {
-                node[iPoint]->SetDelta_Time(Global_Delta_Time);
-            }
-        }
+              /*--- If the unsteady CFL is set to zero, it uses the defined unsteady time step, otherwise
+               it computes the time step based on the unsteady CFL ---*/
+              if (config->GetCFL(iMesh) == 0.0) {
+                  node[iPoint]->SetDelta_Time(config->GetDelta_UnstTime());
+              } else {
+                  node[iPoint]->SetDelta_Time(Global_Delta_Time);
+              }
+          }
+    }
   }
   
   /*--- Recompute the unsteady time step for the dual time strategy
@@ -4530,8 +3484,8 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_UnstTimeND = rbuf_time;
 #endif
     config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
@@ -4549,59 +3503,249 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
   
 }
 
+void CEulerSolver::SetUp_EdgeThreads(CGeometry *geometry, CConfig *config, vector<CNumerics *> &val_numerics) {
+
+  unsigned short iThread, iVar, nThreads = config->GetnThreads_Flow();
+
+  /*--- The edges of one color do not share any point (EDGE_COLORING is implied by
+   NUMBER_THREADS_FLOW), hence the threads carry out the colors one after the other,
+   each split in more chunks than threads to balance the load. The numerics store
+   the data of the edge, hence every additional thread gets its own copy, created
+   by the driver, and its own work arrays. ---*/
+
+  if ((nThreads < 2) || (val_numerics.size() < nThreads)) return;
+
+  taskThreadPool = new CTaskThreadPool(nThreads, ProcessTaskChunk_Flow, this);
+  nThreads = taskThreadPool->GetnThreads();
+
+  if (rank == MASTER_NODE)
+    cout << "Convective edge loops of the flow by " << nThreads << " threads in "
+         << geometry->GetnEdgeColor() << " edge colors." << endl;
+
+  numerics_Threads.assign(nThreads, (CNumerics *) NULL);
+  Res_Conv_Threads.assign(nThreads, (su2double *) NULL);
+  Jacobian_i_Threads.assign(nThreads, (su2double **) NULL);
+  Jacobian_j_Threads.assign(nThreads, (su2double **) NULL);
+  Primitive_i_Threads.assign(nThreads, (su2double *) NULL);
+  Primitive_j_Threads.assign(nThreads, (su2double *) NULL);
+  Secondary_i_Threads.assign(nThreads, (su2double *) NULL);
+  Secondary_j_Threads.assign(nThreads, (su2double *) NULL);
+  Vector_i_Threads.assign(nThreads, (su2double *) NULL);
+  Vector_j_Threads.assign(nThreads, (su2double *) NULL);
+  NonPhysical_Threads.assign(nThreads, 0);
+
+  /*--- The first thread uses the numerics of the integration and the work arrays
+   of the solver, which are set by Loop_Edges. ---*/
+
+  for (iThread = 1; iThread < nThreads; iThread++) {
+    numerics_Threads[iThread]    = val_numerics[iThread];
+    Res_Conv_Threads[iThread]    = new su2double [nVar];
+    Jacobian_i_Threads[iThread]  = new su2double* [nVar];
+    Jacobian_j_Threads[iThread]  = new su2double* [nVar];
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Jacobian_i_Threads[iThread][iVar] = new su2double [nVar];
+      Jacobian_j_Threads[iThread][iVar] = new su2double [nVar];
+    }
+    Primitive_i_Threads[iThread] = new su2double [nPrimVar];
+    Primitive_j_Threads[iThread] = new su2double [nPrimVar];
+    Secondary_i_Threads[iThread] = new su2double [nSecondaryVar];
+    Secondary_j_Threads[iThread] = new su2double [nSecondaryVar];
+    Vector_i_Threads[iThread]    = new su2double [nDim];
+    Vector_j_Threads[iThread]    = new su2double [nDim];
+  }
+
+}
+
+void CEulerSolver::Loop_Edges(unsigned short val_loop, CGeometry *geometry, CNumerics *numerics, CConfig *config, unsigned short iMesh) {
+
+  unsigned short iColor, iThread;
+  unsigned long iChunk, nChunks, nEdgeColor, edgeBeg;
+
+  bool ideal_gas     = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS );
+  bool low_mach_corr = config->Low_Mach_Correction();
+  bool muscl         = config->GetMUSCL_Flow();
+
+  if (numerics_Threads.empty()) {
+    numerics_Threads.resize(1);    Res_Conv_Threads.resize(1);
+    Jacobian_i_Threads.resize(1);  Jacobian_j_Threads.resize(1);
+    Primitive_i_Threads.resize(1); Primitive_j_Threads.resize(1);
+    Secondary_i_Threads.resize(1); Secondary_j_Threads.resize(1);
+    Vector_i_Threads.resize(1);    Vector_j_Threads.resize(1);
+    NonPhysical_Threads.resize(1);
+  }
+
+  numerics_Threads[0]    = numerics;
+  Res_Conv_Threads[0]    = Res_Conv;
+  Jacobian_i_Threads[0]  = Jacobian_i;  Jacobian_j_Threads[0]  = Jacobian_j;
+  Primitive_i_Threads[0] = Primitive_i; Primitive_j_Threads[0] = Primitive_j;
+  Secondary_i_Threads[0] = Secondary_i; Secondary_j_Threads[0] = Secondary_j;
+  Vector_i_Threads[0]    = Vector_i;    Vector_j_Threads[0]    = Vector_j;
+
+  for (iThread = 0; iThread < NonPhysical_Threads.size(); iThread++)
+    NonPhysical_Threads[iThread] = 0;
+
+  edgeLoopChunks = val_loop;
+  geometryChunks = geometry;
+  configChunks   = config;
+  iMeshChunks    = iMesh;
+
+  /*--- The pool only carries out the finest grid, for which the numerics of the
+   threads were created. The thermodynamically consistent reconstruction shares
+   the fluid model of the solver, hence it is carried out by one thread. ---*/
+
+  bool threads = ((taskThreadPool != NULL) && (iMesh == MESH_0));
+  if ((val_loop == EDGE_UPWIND_RESIDUAL) && muscl && (!ideal_gas || low_mach_corr)) threads = false;
+
+  if (threads) taskThreadPool->ResetTasks(geometry->GetnEdgeColor());
+
+  for (iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+
+    edgeBeg    = GetEdgeLoop_Begin(geometry, iColor);
+    nEdgeColor = GetEdgeLoop_End(geometry, iColor) - edgeBeg;
+
+    if (!threads) {
+      if (val_loop == EDGE_CENTERED_RESIDUAL)
+        Centered_Residual_Range(geometry, config, iMesh, edgeBeg, edgeBeg+nEdgeColor, 0);
+      else
+        Upwind_Residual_Range(geometry, config, iMesh, edgeBeg, edgeBeg+nEdgeColor, 0);
+      continue;
+    }
+
+    /*--- The calling thread launches the colors one after the other and helps
+     carrying out the chunks. ---*/
+
+    nChunks = max((unsigned long) 1, min((unsigned long) 4*taskThreadPool->GetnThreads(), nEdgeColor));
+    EdgeColorChunks.resize(nChunks+1);
+    for (iChunk = 0; iChunk <= nChunks; iChunk++)
+      EdgeColorChunks[iChunk] = edgeBeg + (iChunk*nEdgeColor)/nChunks;
+
+    taskThreadPool->LaunchTask(iColor, EdgeColorChunks);
+    while (!taskThreadPool->TaskCompleted(iColor)) {
+      if (!taskThreadPool->RunChunk()) {
+#ifdef HAVE_PTHREAD
+        sched_yield();
+#endif
+      }
+    }
+  }
+
+}
+
+void CEulerSolver::ProcessTaskChunk_Flow(void *solver, const CTaskChunk &chunk) {
+
+  CEulerSolver *FlowSolver = (CEulerSolver *) solver;
+  unsigned short iThread = FlowSolver->taskThreadPool->GetThreadIndex();
+
+  if (FlowSolver->edgeLoopChunks == EDGE_CENTERED_RESIDUAL)
+    FlowSolver->Centered_Residual_Range(FlowSolver->geometryChunks, FlowSolver->configChunks, FlowSolver->iMeshChunks,
+                                        chunk.indBeg, chunk.indEnd, iThread);
+  else
+    FlowSolver->Upwind_Residual_Range(FlowSolver->geometryChunks, FlowSolver->configChunks, FlowSolver->iMeshChunks,
+                                      chunk.indBeg, chunk.indEnd, iThread);
+
+}
+
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iEdge, iPoint, jPoint;
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  Loop_Edges(EDGE_CENTERED_RESIDUAL, geometry, numerics, config, iMesh);
+  
+  config->Tock(tick, "CEulerSolver::Centered_Residual", PROFILE_RESIDUAL);
+  
+}
+
+void CEulerSolver::Centered_Residual_Range(CGeometry *geometry, CConfig *config, unsigned short iMesh,
+                                           unsigned long val_begin, unsigned long val_end, unsigned short iThread) {
+  
+  unsigned long iEdge, iEdgeColor, iPoint, jPoint, Batch_Edge[SIMD_WIDTH];
+  unsigned short nBatch = 0;
   
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool jst_scheme = ((config->GetKind_Centered_Flow() == JST) && (iMesh == MESH_0));
   bool grid_movement = config->GetGrid_Movement();
+  bool batch_flux = (config->GetBatch_Flux() && !grid_movement);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
+  /*--- Numerics and work arrays of this thread ---*/
+  
+  CNumerics *numerics   = numerics_Threads[iThread];
+  su2double *Res_Conv   = Res_Conv_Threads[iThread];
+  su2double **Jacobian_i = Jacobian_i_Threads[iThread];
+  su2double **Jacobian_j = Jacobian_j_Threads[iThread];
+  
+  /*--- The edges of the range belong to one color, hence they do not share any
+   point, such that their contributions to the residual and to the Jacobian are
+   independent of each other. With LOCAL_FREEZING only the edges of the active
+   points are visited. ---*/
+
+  for (iEdgeColor = val_begin; iEdgeColor < val_end; iEdgeColor++) {
+
+    iEdge = GetEdgeLoop_Edge(geometry, iEdgeColor);
+
     /*--- Points in edge, set normal vectors, and number of neighbors ---*/
+  
+    iPoint = geometry->GetEdge_Node(iEdge,0); jPoint = geometry->GetEdge_Node(iEdge,1);
     
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
-    
-    /*--- Set primitive variables w/o reconstruction ---*/
+    /*--- Batched evaluation, the edge is queued and the batch is computed
+     when it is full or at the end of the color ---*/
     
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
+    if (batch_flux) {
+      numerics->SetBatch_Edge(nBatch, GetNode_Primitive(iPoint), GetNode_Primitive(jPoint), geometry->GetEdge_Normal(iEdge));
+      if (jst_scheme)
+        numerics->SetBatch_Dissipation(nBatch, node[iPoint]->GetLambda(), node[jPoint]->GetLambda(),
+                                       geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor(),
+                                       node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian(),
+                                       node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
+      else
+        numerics->SetBatch_Dissipation(nBatch, node[iPoint]->GetLambda(), node[jPoint]->GetLambda(),
+                                       geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor(),
+                                       NULL, NULL, 0.0, 0.0);
+      Batch_Edge[nBatch++] = iEdge;
+      if ((nBatch == SIMD_WIDTH) || (iEdgeColor+1 == val_end)) {
+        Batch_Residual(geometry, numerics, config, nBatch, Batch_Edge, Res_Conv);
+        nBatch = 0;
+      }
+      continue;
+    }
     
+    numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+    numerics->SetNeighbor(geometry->node[iPoint]->GetnNeighbor(), geometry->node[jPoint]->GetnNeighbor());
+  
+    /*--- Set primitive variables w/o reconstruction ---*/
+  
+    numerics->SetPrimitive(GetNode_Primitive(iPoint), GetNode_Primitive(jPoint));
+  
     /*--- Set the largest convective eigenvalue ---*/
-    
+  
     numerics->SetLambda(node[iPoint]->GetLambda(), node[jPoint]->GetLambda());
-    
+  
     /*--- Set undivided laplacian an pressure based sensor ---*/
-    
+  
     if (jst_scheme) {
       numerics->SetUndivided_Laplacian(node[iPoint]->GetUndivided_Laplacian(), node[jPoint]->GetUndivided_Laplacian());
       numerics->SetSensor(node[iPoint]->GetSensor(), node[jPoint]->GetSensor());
     }
-    
+  
     /*--- Grid movement ---*/
-    
+  
     if (grid_movement) {
       numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
     }
-    
+  
     /*--- Compute residuals, and Jacobians ---*/
-    
+  
     numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
-    
+  
     /*--- Update convective and artificial dissipation residuals ---*/
-    
+  
     LinSysRes.AddBlock(iPoint, Res_Conv);
     LinSysRes.SubtractBlock(jPoint, Res_Conv);
-    
+  
     /*--- Set implicit computation ---*/
     if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+      Jacobian.AddEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     }
   }
   
@@ -4610,13 +3754,57 @@ void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_conta
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                    CConfig *config, unsigned short iMesh) {
   
+  unsigned long iPoint, counter_local = 0, counter_global = 0;
+  unsigned short iThread;
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  bool reuse_radius = (config->GetReuse_Spectral_Radius() && !config->GetViscous());
+  
+  /*--- The edge part of the inviscid spectral radius of the next time step is
+   accumulated in this loop, while the point data of the edge is at hand ---*/
+  
+  if (reuse_radius)
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetMax_Lambda_Inv(0.0);
+    
+  /*--- Loop over all the edges, color by color (see Centered_Residual_Range) ---*/
+
+  Loop_Edges(EDGE_UPWIND_RESIDUAL, geometry, numerics, config, iMesh);
+
+  for (iThread = 0; iThread < NonPhysical_Threads.size(); iThread++)
+    counter_local += NonPhysical_Threads[iThread];
+
+  /*--- Warning message about non-physical reconstructions ---*/
+  
+  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
+#ifdef HAVE_MPI
+    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
+#else
+    counter_global = counter_local;
+#endif
+    if (iMesh == MESH_0) config->SetNonphysical_Reconstr(counter_global);
+  }
+  
+  if (reuse_radius) Edge_Lambda_Ready = true;
+  
+  config->Tock(tick, "CEulerSolver::Upwind_Residual", PROFILE_RESIDUAL);
+  
+}
+
+void CEulerSolver::Upwind_Residual_Range(CGeometry *geometry, CConfig *config, unsigned short iMesh,
+                                         unsigned long val_begin, unsigned long val_end, unsigned short iThread) {
+  
   su2double **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j, RoeVelocity[3] = {0.0,0.0,0.0}, R, sq_vel, RoeEnthalpy,
   *V_i, *V_j, *S_i, *S_j, *Limiter_i = NULL, *Limiter_j = NULL, sqvel, Non_Physical = 1.0, Sensor_i, Sensor_j, Dissipation_i, Dissipation_j, *Coord_i, *Coord_j;
   
   su2double z, velocity2_i, velocity2_j, mach_i, mach_j, vel_i_corr[3], vel_j_corr[3];
   
-  unsigned long iEdge, iPoint, jPoint, counter_local = 0, counter_global = 0;
-  unsigned short iDim, iVar;
+  su2double *Normal, Area, Mean_ProjVel, Mean_SoundSpeed, Lambda, ProjVel_i, ProjVel_j;
+  
+  unsigned long iEdge, iEdgeColor, iPoint, jPoint, Batch_Edge[SIMD_WIDTH];
+  unsigned short iDim, iVar, nBatch = 0;
   
   bool neg_density_i = false, neg_density_j = false, neg_pressure_i = false, neg_pressure_j = false, neg_sound_speed = false;
   
@@ -4631,51 +3819,91 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
   bool van_albada       = config->GetKind_SlopeLimit_Flow() == VAN_ALBADA_EDGE;
   bool low_mach_corr    = config->Low_Mach_Correction();
   unsigned short kind_dissipation = config->GetKind_RoeLowDiss();
-    
-  /*--- Loop over all the edges ---*/
+  bool batch_flux       = (config->GetBatch_Flux() && ideal_gas && !grid_movement && !roe_turkel &&
+                           (kind_dissipation == NO_ROELOWDISS));
+  bool reuse_radius     = (config->GetReuse_Spectral_Radius() && !config->GetViscous());
+  
+  /*--- Numerics and work arrays of this thread. ComputeConsExtrapolation and the
+   low Mach correction use the fluid model and the work arrays of the solver, hence
+   Loop_Edges carries out the loop by one thread in these cases. ---*/
+  
+  CNumerics *numerics    = numerics_Threads[iThread];
+  su2double *Res_Conv    = Res_Conv_Threads[iThread];
+  su2double **Jacobian_i = Jacobian_i_Threads[iThread];
+  su2double **Jacobian_j = Jacobian_j_Threads[iThread];
+  su2double *Primitive_i = Primitive_i_Threads[iThread];
+  su2double *Primitive_j = Primitive_j_Threads[iThread];
+  su2double *Secondary_i = Secondary_i_Threads[iThread];
+  su2double *Secondary_j = Secondary_j_Threads[iThread];
+  su2double *Vector_i    = Vector_i_Threads[iThread];
+  su2double *Vector_j    = Vector_j_Threads[iThread];
+  
+  /*--- Loop over the edges of the range, which belong to one color ---*/
+
+  for (iEdgeColor = val_begin; iEdgeColor < val_end; iEdgeColor++) {
+
+    iEdge = GetEdgeLoop_Edge(geometry, iEdgeColor);
 
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
     /*--- Points in edge and normal vectors ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0); jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
+  
+    iPoint = geometry->GetEdge_Node(iEdge,0); jPoint = geometry->GetEdge_Node(iEdge,1);
+    numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+  
     /*--- Roe Turkel preconditioning ---*/
-    
+  
     if (roe_turkel) {
       sqvel = 0.0;
       for (iDim = 0; iDim < nDim; iDim ++)
         sqvel += config->GetVelocity_FreeStream()[iDim]*config->GetVelocity_FreeStream()[iDim];
       numerics->SetVelocity2_Inf(sqvel);
     }
-    
+  
     /*--- Grid movement ---*/
-    
+  
     if (grid_movement)
       numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
-    
+  
     /*--- Get primitive variables ---*/
-    
-    V_i = node[iPoint]->GetPrimitive(); V_j = node[jPoint]->GetPrimitive();
+  
+    V_i = GetNode_Primitive(iPoint); V_j = GetNode_Primitive(jPoint);
     S_i = node[iPoint]->GetSecondary(); S_j = node[jPoint]->GetSecondary();
 
+    /*--- Inviscid spectral radius of the edge, as in SetTime_Step ---*/
+
+    if (reuse_radius) {
+      Normal = geometry->GetEdge_Normal(iEdge);
+      Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+      Mean_ProjVel = 0.5 * (node[iPoint]->GetProjVel(Normal) + node[jPoint]->GetProjVel(Normal));
+      Mean_SoundSpeed = 0.5 * (node[iPoint]->GetSoundSpeed() + node[jPoint]->GetSoundSpeed()) * Area;
+      if (grid_movement) {
+        ProjVel_i = 0.0; ProjVel_j = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          ProjVel_i += geometry->node[iPoint]->GetGridVel()[iDim]*Normal[iDim];
+          ProjVel_j += geometry->node[jPoint]->GetGridVel()[iDim]*Normal[iDim];
+        }
+        Mean_ProjVel -= 0.5 * (ProjVel_i + ProjVel_j);
+      }
+      Lambda = fabs(Mean_ProjVel) + Mean_SoundSpeed;
+      if (geometry->node[iPoint]->GetDomain()) node[iPoint]->AddMax_Lambda_Inv(Lambda);
+      if (geometry->node[jPoint]->GetDomain()) node[jPoint]->AddMax_Lambda_Inv(Lambda);
+    }
+
     /*--- High order reconstruction using MUSCL strategy ---*/
-    
+  
     if (muscl) {
-      
+    
       for (iDim = 0; iDim < nDim; iDim++) {
         Vector_i[iDim] = 0.5*(geometry->node[jPoint]->GetCoord(iDim) - geometry->node[iPoint]->GetCoord(iDim));
         Vector_j[iDim] = 0.5*(geometry->node[iPoint]->GetCoord(iDim) - geometry->node[jPoint]->GetCoord(iDim));
       }
-      
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
+    
+      Gradient_i = GetNode_Gradient_Primitive(iPoint);
+      Gradient_j = GetNode_Gradient_Primitive(jPoint);
       if (limiter) {
-        Limiter_i = node[iPoint]->GetLimiter_Primitive();
-        Limiter_j = node[jPoint]->GetLimiter_Primitive();
+        Limiter_i = GetNode_Limiter_Primitive(iPoint);
+        Limiter_j = GetNode_Limiter_Primitive(jPoint);
       }
-      
+    
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         Project_Grad_i = 0.0; Project_Grad_j = 0.0;
         Non_Physical = node[iPoint]->GetNon_Physical()*node[jPoint]->GetNon_Physical();
@@ -4708,7 +3936,7 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
         velocity2_i = 0.0;
         velocity2_j = 0.0;
-        
+      
         for (iDim = 0; iDim < nDim; iDim++) {
           velocity2_i += Primitive_i[iDim+1]*Primitive_i[iDim+1];
           velocity2_j += Primitive_j[iDim+1]*Primitive_j[iDim+1];
@@ -4734,18 +3962,18 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
 
         FluidModel->SetEnergy_Prho(Primitive_i[nDim+1],Primitive_i[nDim+2]);
         Primitive_i[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_i[nDim+1]/Primitive_i[nDim+2] + 0.5*velocity2_i;
-        
+      
         FluidModel->SetEnergy_Prho(Primitive_j[nDim+1],Primitive_j[nDim+2]);
         Primitive_j[nDim+3]= FluidModel->GetStaticEnergy() + Primitive_j[nDim+1]/Primitive_j[nDim+2] + 0.5*velocity2_j;
-        
-      }
       
+      }
+    
       /*--- Check for non-physical solutions after reconstruction. If found,
        use the cell-average value of the solution. This results in a locally
        first-order approximation, but this is typically only active
        during the start-up of a calculation. If non-physical, use the 
        cell-averaged state. ---*/
-      
+    
       neg_pressure_i = (Primitive_i[nDim+1] < 0.0); neg_pressure_j = (Primitive_j[nDim+1] < 0.0);
       neg_density_i  = (Primitive_i[nDim+2] < 0.0); neg_density_j  = (Primitive_j[nDim+2] < 0.0);
 
@@ -4757,49 +3985,49 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
       }
       RoeEnthalpy = (R*Primitive_j[nDim+3]+Primitive_i[nDim+3])/(R+1);
       neg_sound_speed = ((Gamma-1)*(RoeEnthalpy-0.5*sq_vel) < 0.0);
-      
+    
       if (neg_sound_speed) {
         for (iVar = 0; iVar < nPrimVar; iVar++) {
           Primitive_i[iVar] = V_i[iVar];
           Primitive_j[iVar] = V_j[iVar]; }
         Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
         Secondary_j[0] = S_i[0]; Secondary_j[1] = S_i[1];
-        counter_local++;
+        NonPhysical_Threads[iThread]++;
       }
-      
+    
       if (neg_density_i || neg_pressure_i) {
         for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_i[iVar] = V_i[iVar];
         Secondary_i[0] = S_i[0]; Secondary_i[1] = S_i[1];
-        counter_local++;
+        NonPhysical_Threads[iThread]++;
       }
-      
+    
       if (neg_density_j || neg_pressure_j) {
         for (iVar = 0; iVar < nPrimVar; iVar++) Primitive_j[iVar] = V_j[iVar];
         Secondary_j[0] = S_j[0]; Secondary_j[1] = S_j[1];
-        counter_local++;
+        NonPhysical_Threads[iThread]++;
       }
 
       numerics->SetPrimitive(Primitive_i, Primitive_j);
       numerics->SetSecondary(Secondary_i, Secondary_j);
-      
+    
     }
     else {
-      
+    
       /*--- Set conservative variables without reconstruction ---*/
-      
+    
       numerics->SetPrimitive(V_i, V_j);
       numerics->SetSecondary(S_i, S_j);
-      
-    }
     
+    }
+  
     /*--- Roe Low Dissipation Scheme ---*/
-    
+  
     if (kind_dissipation != NO_ROELOWDISS){
-      
+    
       Dissipation_i = node[iPoint]->GetRoe_Dissipation();
       Dissipation_j = node[jPoint]->GetRoe_Dissipation();
       numerics->SetDissipation(Dissipation_i, Dissipation_j);
-            
+          
       if (kind_dissipation == FD_DUCROS || kind_dissipation == NTS_DUCROS){
         Sensor_i = node[iPoint]->GetSensor();
         Sensor_j = node[jPoint]->GetSensor();
@@ -4811,51 +4039,107 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
         numerics->SetCoord(Coord_i, Coord_j);
       }
     }
-      
-    /*--- Compute the residual ---*/
     
+    /*--- Batched evaluation (see Centered_Residual) ---*/
+    
+    if (batch_flux) {
+      if (muscl) numerics->SetBatch_Edge(nBatch, Primitive_i, Primitive_j, geometry->GetEdge_Normal(iEdge));
+      else numerics->SetBatch_Edge(nBatch, V_i, V_j, geometry->GetEdge_Normal(iEdge));
+      Batch_Edge[nBatch++] = iEdge;
+      if ((nBatch == SIMD_WIDTH) || (iEdgeColor+1 == val_end)) {
+        Batch_Residual(geometry, numerics, config, nBatch, Batch_Edge, Res_Conv);
+        nBatch = 0;
+      }
+      continue;
+    }
+    
+    /*--- Compute the residual ---*/
+  
     numerics->ComputeResidual(Res_Conv, Jacobian_i, Jacobian_j, config);
 
     /*--- Update residual value ---*/
-    
+  
     LinSysRes.AddBlock(iPoint, Res_Conv);
     LinSysRes.SubtractBlock(jPoint, Res_Conv);
+  
+    /*--- Set implicit Jacobians ---*/
+  
+    if (implicit) {
+      Jacobian.AddEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    }
+  
+    /*--- Roe Turkel preconditioning, set the value of beta ---*/
+  
+    if (roe_turkel) {
+      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
+      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
+    }
+  
+    /*--- Set the final value of the Roe dissipation coefficient ---*/
+  
+    if (kind_dissipation != NO_ROELOWDISS){
+      node[iPoint]->SetRoe_Dissipation(numerics->GetDissipation());
+      node[jPoint]->SetRoe_Dissipation(numerics->GetDissipation());      
+    }
+  
+  }
+  
+}
+
+void CEulerSolver::Batch_Residual(CGeometry *geometry, CNumerics *numerics, CConfig *config,
+                                  unsigned short nBatch, unsigned long *val_edges, su2double *val_residual) {
+  
+  unsigned long iPoint, jPoint;
+  unsigned short iLane;
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  
+  /*--- Compute the fluxes of the batch at once ---*/
+  
+  numerics->ComputeResidual_Batch(nBatch, config);
+  
+  /*--- Update the residual and the Jacobian edge by edge ---*/
+  
+  for (iLane = 0; iLane < nBatch; iLane++) {
     
-    /*--- Set implicit Jacobians ---*/
+    iPoint = geometry->GetEdge_Node(val_edges[iLane],0);
+    jPoint = geometry->GetEdge_Node(val_edges[iLane],1);
     
-    if (implicit) {
-      Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
-    }
+    numerics->GetBatch_Residual(iLane, val_residual);
+    LinSysRes.AddBlock(iPoint, val_residual);
+    LinSysRes.SubtractBlock(jPoint, val_residual);
     
-    /*--- Roe Turkel preconditioning, set the value of beta ---*/
+    /*--- The Jacobians are read in place from the batch ---*/
     
-    if (roe_turkel) {
-      node[iPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-      node[jPoint]->SetPreconditioner_Beta(numerics->GetPrecond_Beta());
-    }
+    if (implicit)
+      Jacobian.AddEdgeBlocks(val_edges[iLane], iPoint, jPoint, numerics->GetBatch_Jacobian_i(iLane),
+                             numerics->GetBatch_Jacobian_j(iLane), SIMD_WIDTH);
+  }
+  
+}
+
+void CEulerSolver::Batch_Boundary_Residual(CNumerics *numerics, CConfig *config,
+                                           unsigned short nBatch, unsigned long *val_points) {
+  
+  unsigned short iLane;
+  bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  
+  /*--- Compute the fluxes of the batch at once ---*/
+  
+  numerics->ComputeResidual_Batch(nBatch, config);
+  
+  /*--- Only the boundary node is updated, point j is the boundary state ---*/
+  
+  for (iLane = 0; iLane < nBatch; iLane++) {
     
-    /*--- Set the final value of the Roe dissipation coefficient ---*/
+    numerics->GetBatch_Residual(iLane, Res_Conv);
+    LinSysRes.AddBlock(val_points[iLane], Res_Conv);
     
-    if (kind_dissipation != NO_ROELOWDISS){
-      node[iPoint]->SetRoe_Dissipation(numerics->GetDissipation());
-      node[jPoint]->SetRoe_Dissipation(numerics->GetDissipation());      
+    if (implicit) {
+      numerics->GetBatch_Jacobian(iLane, Jacobian_i, Jacobian_j);
+      Jacobian.AddBlock(val_points[iLane], val_points[iLane], Jacobian_i);
     }
-    
   }
-
-  /*--- Warning message about non-physical reconstructions ---*/
   
-  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-#ifdef HAVE_MPI
-    SU2_MPI::Reduce(&counter_local, &counter_global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MASTER_NODE, MPI_COMM_WORLD);
-#else
-    counter_global = counter_local;
-#endif
-    if (iMesh == MESH_0) config->SetNonphysical_Reconstr(counter_global);
-  }
 }
 
 void CEulerSolver::ComputeConsExtrapolation(CConfig *config) {
@@ -5172,6 +4456,8 @@ void CEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
   
   Set_MPI_MaxEigenvalue(geometry, config);
   
+  Lambda_Ready = true;
+  
 }
 
 void CEulerSolver::SetUndivided_Laplacian(CGeometry *geometry, CConfig *config) {
@@ -5288,6 +4574,74 @@ void CEulerSolver::SetCentered_Dissipation_Sensor(CGeometry *geometry, CConfig *
   
 }
 
+void CEulerSolver::SetUndivided_Laplacian_Sensor(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iEdge, iPoint, jPoint;
+  su2double Pressure_i = 0.0, Pressure_j = 0.0, *Diff;
+  unsigned short iVar;
+  bool boundary_i, boundary_j, domain_i, domain_j;
+  
+  Diff = new su2double[nVar];
+  
+  /*--- Reset the undivided laplacian and the variables to store the undivided pressure ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    node[iPoint]->SetUnd_LaplZero();
+    iPoint_UndLapl[iPoint] = 0.0;
+    jPoint_UndLapl[iPoint] = 0.0;
+  }
+  
+  /*--- Both quantities use the same edge weights, evaluate them in one loop ---*/
+  
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    
+    Pressure_i = node[iPoint]->GetPressure();
+    Pressure_j = node[jPoint]->GetPressure();
+    
+    /*--- Solution differences, with the enthalpy for the energy equation ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Diff[iVar] = node[iPoint]->GetSolution(iVar) - node[jPoint]->GetSolution(iVar);
+    Diff[nVar-1] = (node[iPoint]->GetSolution(nVar-1) + Pressure_i) - (node[jPoint]->GetSolution(nVar-1) + Pressure_j);
+    
+    boundary_i = geometry->node[iPoint]->GetPhysicalBoundary();
+    boundary_j = geometry->node[jPoint]->GetPhysicalBoundary();
+    
+    /*--- Both points inside the domain, or both on the boundary. If only one of
+     them is on the boundary, only the interior point is updated ---*/
+    
+    domain_i = geometry->node[iPoint]->GetDomain() && (!boundary_i || boundary_j);
+    domain_j = geometry->node[jPoint]->GetDomain() && (boundary_i || !boundary_j);
+    
+    if (domain_i) {
+      node[iPoint]->SubtractUnd_Lapl(Diff);
+      iPoint_UndLapl[iPoint] += (Pressure_j - Pressure_i);
+      jPoint_UndLapl[iPoint] += (Pressure_i + Pressure_j);
+    }
+    if (domain_j) {
+      node[jPoint]->AddUnd_Lapl(Diff);
+      iPoint_UndLapl[jPoint] += (Pressure_i - Pressure_j);
+      jPoint_UndLapl[jPoint] += (Pressure_i + Pressure_j);
+    }
+    
+  }
+  
+  /*--- Set pressure switch for each point ---*/
+  
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    node[iPoint]->SetSensor(fabs(iPoint_UndLapl[iPoint]) / jPoint_UndLapl[iPoint]);
+  
+  /*--- MPI parallelization, one message for both quantities ---*/
+  
+  Set_MPI_Undivided_Laplacian_Sensor(geometry, config);
+  
+  delete [] Diff;
+  
+}
+
 void CEulerSolver::SetUpwind_Ducros_Sensor(CGeometry *geometry, CConfig *config){
   
   unsigned long iPoint, jPoint;
@@ -5363,7 +4717,7 @@ void CEulerSolver::SetUpwind_Ducros_Sensor(CGeometry *geometry, CConfig *config)
 
 void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iVertex, iPoint;
+  unsigned long iVertex, iPoint, kVertex;
   unsigned short iDim, iMarker, Boundary, Monitoring, iMarker_Monitoring;
   su2double Pressure = 0.0, *Normal = NULL, MomentDist[3] = {0.0,0.0,0.0}, *Coord,
   factor, NFPressOF, RefVel2, RefTemp, RefDensity, RefPressure, Mach2Vel, Mach_Motion,
@@ -5372,9 +4726,6 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Inv, MyAllBound_CL_Inv, MyAllBound_CSF_Inv, MyAllBound_CMx_Inv, MyAllBound_CMy_Inv, MyAllBound_CMz_Inv, MyAllBound_CoPx_Inv, MyAllBound_CoPy_Inv, MyAllBound_CoPz_Inv, MyAllBound_CFx_Inv, MyAllBound_CFy_Inv, MyAllBound_CFz_Inv, MyAllBound_CT_Inv, MyAllBound_CQ_Inv, MyAllBound_CNearFieldOF_Inv, *MySurface_CL_Inv = NULL, *MySurface_CD_Inv = NULL, *MySurface_CSF_Inv = NULL, *MySurface_CEff_Inv = NULL, *MySurface_CFx_Inv = NULL, *MySurface_CFy_Inv = NULL, *MySurface_CFz_Inv = NULL, *MySurface_CMx_Inv = NULL, *MySurface_CMy_Inv = NULL, *MySurface_CMz_Inv = NULL;
-#endif
   
   su2double Alpha           = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta            = config->GetAoS()*PI_NUMBER/180.0;
@@ -5388,6 +4739,10 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   bool grid_movement        = config->GetGrid_Movement();
   bool axisymmetric         = config->GetAxisymmetric();
 
+  /*--- Contiguous normals and coordinates of the owned monitored vertices ---*/
+  
+  SetForce_Cache(geometry, config);
+  
   /*--- Evaluate reference values for non-dimensionalization.
    For dynamic meshes, use the motion Mach number as a reference value
    for computing the force coefficients. Otherwise, use the freestream
@@ -5480,61 +4835,62 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
       NFPressOF = 0.0;
       
-      /*--- Loop over the vertices to compute the forces ---*/
+      /*--- Loop over the vertices to compute the pressure coefficient ---*/
       
       for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-        
         iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        Pressure = node[iPoint]->GetPressure();
+        CPressure[iMarker][iVertex] = (Pressure - RefPressure)*factor*RefArea;
+      }
+      
+      /*--- Note that the pressure coefficient is computed at the
+       halo cells (for visualization purposes), but not the forces, the
+       cache only holds the owned vertices of the monitored markers ---*/
+      
+      for (kVertex = 0; kVertex < nVertex_ForceCache[iMarker]; kVertex++) {
+        
+        iPoint = Point_ForceCache[iMarker][kVertex];
+        Normal = &Normal_ForceCache[iMarker][kVertex*nDim];
+        Coord  = &Coord_ForceCache[iMarker][kVertex*nDim];
         
         Pressure = node[iPoint]->GetPressure();
         
-        CPressure[iMarker][iVertex] = (Pressure - RefPressure)*factor*RefArea;
+        /*--- Quadratic objective function for the near-field.
+         This uses the infinity pressure regardless of Mach number. ---*/
         
-        /*--- Note that the pressure coefficient is computed at the
-         halo cells (for visualization purposes), but not the forces ---*/
+        NFPressOF += 0.5*(Pressure - Pressure_Inf)*(Pressure - Pressure_Inf)*Normal[nDim-1];
         
-        if ( (geometry->node[iPoint]->GetDomain()) && (Monitoring == YES) ) {
-          
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-          Coord = geometry->node[iPoint]->GetCoord();
-          
-          /*--- Quadratic objective function for the near-field.
-           This uses the infinity pressure regardless of Mach number. ---*/
-          
-          NFPressOF += 0.5*(Pressure - Pressure_Inf)*(Pressure - Pressure_Inf)*Normal[nDim-1];
-          
-          for (iDim = 0; iDim < nDim; iDim++) {
-            MomentDist[iDim] = Coord[iDim] - Origin[iDim];
-          }
-          
-          /*--- Axisymmetric simulations ---*/
+        for (iDim = 0; iDim < nDim; iDim++) {
+          MomentDist[iDim] = Coord[iDim] - Origin[iDim];
+        }
+        
+        /*--- Axisymmetric simulations ---*/
 
-          if (axisymmetric) AxiFactor = 2.0*PI_NUMBER*geometry->node[iPoint]->GetCoord(1);
-          else AxiFactor = 1.0;
+        if (axisymmetric) AxiFactor = 2.0*PI_NUMBER*Coord[1];
+        else AxiFactor = 1.0;
 
-          /*--- Force computation, note the minus sign due to the
-           orientation of the normal (outward) ---*/
-          
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Force[iDim] = -(Pressure - Pressure_Inf) * Normal[iDim] * factor * AxiFactor;
-            ForceInviscid[iDim] += Force[iDim];
-          }
-          
-          /*--- Moment with respect to the reference axis ---*/
-          
-          if (nDim == 3) {
-            MomentInviscid[0] += (Force[2]*MomentDist[1]-Force[1]*MomentDist[2])/RefLength;
-            MomentX_Force[1]  += (-Force[1]*Coord[2]);
-            MomentX_Force[2]  += (Force[2]*Coord[1]);
+        /*--- Force computation, note the minus sign due to the
+         orientation of the normal (outward) ---*/
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Force[iDim] = -(Pressure - Pressure_Inf) * Normal[iDim] * factor * AxiFactor;
+          ForceInviscid[iDim] += Force[iDim];
+        }
+        
+        /*--- Moment with respect to the reference axis ---*/
+        
+        if (nDim == 3) {
+          MomentInviscid[0] += (Force[2]*MomentDist[1]-Force[1]*MomentDist[2])/RefLength;
+          MomentX_Force[1]  += (-Force[1]*Coord[2]);
+          MomentX_Force[2]  += (Force[2]*Coord[1]);
 
-            MomentInviscid[1] += (Force[0]*MomentDist[2]-Force[2]*MomentDist[0])/RefLength;
-            MomentY_Force[2]  += (-Force[2]*Coord[0]);
-            MomentY_Force[0]  += (Force[0]*Coord[2]);
-          }
-          MomentInviscid[2] += (Force[1]*MomentDist[0]-Force[0]*MomentDist[1])/RefLength;
-          MomentZ_Force[0]  += (-Force[0]*Coord[1]);
-          MomentZ_Force[1]  += (Force[1]*Coord[0]);
+          MomentInviscid[1] += (Force[0]*MomentDist[2]-Force[2]*MomentDist[0])/RefLength;
+          MomentY_Force[2]  += (-Force[2]*Coord[0]);
+          MomentY_Force[0]  += (Force[0]*Coord[2]);
         }
+        MomentInviscid[2] += (Force[1]*MomentDist[0]-Force[0]*MomentDist[1])/RefLength;
+        MomentZ_Force[0]  += (-Force[0]*Coord[1]);
+        MomentZ_Force[1]  += (Force[1]*Coord[0]);
         
       }
       
@@ -5627,97 +4983,20 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Inv        = AllBound_CD_Inv;        AllBound_CD_Inv = 0.0;
-  MyAllBound_CL_Inv        = AllBound_CL_Inv;        AllBound_CL_Inv = 0.0;
-  MyAllBound_CSF_Inv   = AllBound_CSF_Inv;   AllBound_CSF_Inv = 0.0;
-  AllBound_CEff_Inv = 0.0;
-  MyAllBound_CMx_Inv          = AllBound_CMx_Inv;          AllBound_CMx_Inv = 0.0;
-  MyAllBound_CMy_Inv          = AllBound_CMy_Inv;          AllBound_CMy_Inv = 0.0;
-  MyAllBound_CMz_Inv          = AllBound_CMz_Inv;          AllBound_CMz_Inv = 0.0;
-  MyAllBound_CoPx_Inv          = AllBound_CoPx_Inv;          AllBound_CoPx_Inv = 0.0;
-  MyAllBound_CoPy_Inv          = AllBound_CoPy_Inv;          AllBound_CoPy_Inv = 0.0;
-  MyAllBound_CoPz_Inv          = AllBound_CoPz_Inv;          AllBound_CoPz_Inv = 0.0;
-  MyAllBound_CFx_Inv          = AllBound_CFx_Inv;          AllBound_CFx_Inv = 0.0;
-  MyAllBound_CFy_Inv          = AllBound_CFy_Inv;          AllBound_CFy_Inv = 0.0;
-  MyAllBound_CFz_Inv          = AllBound_CFz_Inv;          AllBound_CFz_Inv = 0.0;
-  MyAllBound_CT_Inv           = AllBound_CT_Inv;           AllBound_CT_Inv = 0.0;
-  MyAllBound_CQ_Inv           = AllBound_CQ_Inv;           AllBound_CQ_Inv = 0.0;
-  AllBound_CMerit_Inv = 0.0;
-  MyAllBound_CNearFieldOF_Inv = AllBound_CNearFieldOF_Inv; AllBound_CNearFieldOF_Inv = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Inv, &AllBound_CD_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Inv, &AllBound_CL_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Inv, &AllBound_CSF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CEff_Inv = AllBound_CL_Inv / (AllBound_CD_Inv + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Inv, &AllBound_CMx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Inv, &AllBound_CMy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Inv, &AllBound_CMz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Inv, &AllBound_CoPx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Inv, &AllBound_CoPy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Inv, &AllBound_CoPz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Inv, &AllBound_CFx_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Inv, &AllBound_CFy_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Inv, &AllBound_CFz_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Inv, &AllBound_CT_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Inv, &AllBound_CQ_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CMerit_Inv = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CNearFieldOF_Inv, &AllBound_CNearFieldOF_Inv, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, packed into a single reduction. ---*/
   
-  /*--- Add the forces on the surfaces using all the nodes ---*/
+  su2double *AllBound_Inv[] = {&AllBound_CD_Inv, &AllBound_CL_Inv, &AllBound_CSF_Inv, &AllBound_CMx_Inv, &AllBound_CMy_Inv, &AllBound_CMz_Inv, &AllBound_CoPx_Inv, &AllBound_CoPy_Inv, &AllBound_CoPz_Inv, &AllBound_CFx_Inv, &AllBound_CFy_Inv, &AllBound_CFz_Inv, &AllBound_CT_Inv, &AllBound_CQ_Inv, &AllBound_CNearFieldOF_Inv};
+  su2double *Surface_Inv[] = {Surface_CL_Inv, Surface_CD_Inv, Surface_CSF_Inv, Surface_CFx_Inv, Surface_CFy_Inv, Surface_CFz_Inv, Surface_CMx_Inv, Surface_CMy_Inv, Surface_CMz_Inv};
   
-  MySurface_CL_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Inv      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Inv = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Inv       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Inv        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Inv        = new su2double[config->GetnMarker_Monitoring()];
-
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Inv[iMarker_Monitoring]      = Surface_CL_Inv[iMarker_Monitoring];
-    MySurface_CD_Inv[iMarker_Monitoring]      = Surface_CD_Inv[iMarker_Monitoring];
-    MySurface_CSF_Inv[iMarker_Monitoring] = Surface_CSF_Inv[iMarker_Monitoring];
-    MySurface_CEff_Inv[iMarker_Monitoring]       = Surface_CEff_Inv[iMarker_Monitoring];
-    MySurface_CFx_Inv[iMarker_Monitoring]        = Surface_CFx_Inv[iMarker_Monitoring];
-    MySurface_CFy_Inv[iMarker_Monitoring]        = Surface_CFy_Inv[iMarker_Monitoring];
-    MySurface_CFz_Inv[iMarker_Monitoring]        = Surface_CFz_Inv[iMarker_Monitoring];
-    MySurface_CMx_Inv[iMarker_Monitoring]        = Surface_CMx_Inv[iMarker_Monitoring];
-    MySurface_CMy_Inv[iMarker_Monitoring]        = Surface_CMy_Inv[iMarker_Monitoring];
-    MySurface_CMz_Inv[iMarker_Monitoring]        = Surface_CMz_Inv[iMarker_Monitoring];
-
-    Surface_CL_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Inv[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Inv[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Inv[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Inv[iMarker_Monitoring]        = 0.0;
-  }
-  
-  SU2_MPI::Allreduce(MySurface_CL_Inv, Surface_CL_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Inv, Surface_CD_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Inv, Surface_CSF_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SumCoefficients_AllRanks(sizeof(AllBound_Inv)/sizeof(su2double*), AllBound_Inv,
+                           sizeof(Surface_Inv)/sizeof(su2double*), Surface_Inv,
+                           config->GetnMarker_Monitoring());
+  
+  AllBound_CEff_Inv = AllBound_CL_Inv / (AllBound_CD_Inv + EPS);
+  AllBound_CMerit_Inv = AllBound_CT_Inv / (AllBound_CQ_Inv + EPS);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Inv[iMarker_Monitoring] = Surface_CL_Inv[iMarker_Monitoring] / (Surface_CD_Inv[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Inv, Surface_CFx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Inv, Surface_CFy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Inv, Surface_CFz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Inv, Surface_CMx_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Inv, Surface_CMy_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Inv, Surface_CMz_Inv, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Inv; delete [] MySurface_CD_Inv; delete [] MySurface_CSF_Inv;
-  delete [] MySurface_CEff_Inv;  delete [] MySurface_CFx_Inv;   delete [] MySurface_CFy_Inv;
-  delete [] MySurface_CFz_Inv;   delete [] MySurface_CMx_Inv;   delete [] MySurface_CMy_Inv;
-  delete [] MySurface_CMz_Inv;
   
 #endif
   
@@ -5760,7 +5039,7 @@ void CEulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config) {
 
 void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   
-  unsigned long iVertex, iPoint;
+  unsigned long kVertex, iPoint;
   unsigned short iDim, iMarker, Boundary, Monitoring, iMarker_Monitoring;
   su2double *Normal = NULL, MomentDist[3] = {0.0,0.0,0.0}, *Coord, Area,
   factor, RefVel2, RefTemp, RefDensity,  Mach2Vel, Mach_Motion,
@@ -5769,17 +5048,6 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
   
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Mnt, MyAllBound_CL_Mnt, MyAllBound_CSF_Mnt,
-  MyAllBound_CMx_Mnt, MyAllBound_CMy_Mnt, MyAllBound_CMz_Mnt,
-  MyAllBound_CoPx_Mnt, MyAllBound_CoPy_Mnt, MyAllBound_CoPz_Mnt,
-  MyAllBound_CFx_Mnt, MyAllBound_CFy_Mnt, MyAllBound_CFz_Mnt, MyAllBound_CT_Mnt,
-  MyAllBound_CQ_Mnt,
-  *MySurface_CL_Mnt = NULL, *MySurface_CD_Mnt = NULL, *MySurface_CSF_Mnt = NULL,
-  *MySurface_CEff_Mnt = NULL, *MySurface_CFx_Mnt = NULL, *MySurface_CFy_Mnt = NULL,
-  *MySurface_CFz_Mnt = NULL,
-  *MySurface_CMx_Mnt = NULL, *MySurface_CMy_Mnt = NULL,  *MySurface_CMz_Mnt = NULL;
-#endif
   
   su2double Alpha            = config->GetAoA()*PI_NUMBER/180.0;
   su2double Beta             = config->GetAoS()*PI_NUMBER/180.0;
@@ -5793,6 +5061,10 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   bool grid_movement         = config->GetGrid_Movement();
   bool axisymmetric          = config->GetAxisymmetric();
   
+  /*--- The surface force cache is built by Pressure_Forces ---*/
+  
+  if (nVertex_ForceCache == NULL) SetForce_Cache(geometry, config);
+  
   /*--- Evaluate reference values for non-dimensionalization.
    For dynamic meshes, use the motion Mach number as a reference value
    for computing the force coefficients. Otherwise, use the freestream values,
@@ -5869,60 +5141,55 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
       
       /*--- Loop over the vertices to compute the forces ---*/
       
-      for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      for (kVertex = 0; kVertex < nVertex_ForceCache[iMarker]; kVertex++) {
         
-        iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        iPoint = Point_ForceCache[iMarker][kVertex];
+        Normal = &Normal_ForceCache[iMarker][kVertex*nDim];
+        Coord  = &Coord_ForceCache[iMarker][kVertex*nDim];
         
-        /*--- Note that the pressure coefficient is computed at the
-         halo cells (for visualization purposes), but not the forces ---*/
+        /*--- The cache only holds the owned vertices of the monitored markers ---*/
         
-        if ( (geometry->node[iPoint]->GetDomain()) && (Monitoring == YES) ) {
-          
-          Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-          Coord = geometry->node[iPoint]->GetCoord();
-          Density   = node[iPoint]->GetDensity();
-          
-          /*--- Quadratic objective function for the near-field.
-           This uses the infinity pressure regardless of Mach number. ---*/
-          
-          Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
-          
-          MassFlow = 0.0;
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Velocity[iDim]  = node[iPoint]->GetVelocity(iDim);
-            MomentDist[iDim] = Coord[iDim] - Origin[iDim];
-            MassFlow -= Normal[iDim]*Velocity[iDim]*Density;
-          }
-          
-          /*--- Axisymmetric simulations ---*/
-          
-          if (axisymmetric) AxiFactor = 2.0*PI_NUMBER*geometry->node[iPoint]->GetCoord(1);
-          else AxiFactor = 1.0;
-          
-          /*--- Force computation, note the minus sign due to the
-           orientation of the normal (outward) ---*/
-          
-          for (iDim = 0; iDim < nDim; iDim++) {
-            Force[iDim] = MassFlow * Velocity[iDim] * factor * AxiFactor;
-            ForceMomentum[iDim] += Force[iDim];
-          }
-          
-          /*--- Moment with respect to the reference axis ---*/
-          
-          if (iDim == 3) {
-            MomentMomentum[0] += (Force[2]*MomentDist[1]-Force[1]*MomentDist[2])/RefLength;
-            MomentX_Force[1]  += (-Force[1]*Coord[2]);
-            MomentX_Force[2]  += (Force[2]*Coord[1]);
-            
-            MomentMomentum[1] += (Force[0]*MomentDist[2]-Force[2]*MomentDist[0])/RefLength;
-            MomentY_Force[2]  += (-Force[2]*Coord[0]);
-            MomentY_Force[0]  += (Force[0]*Coord[2]);
-          }
-          MomentMomentum[2] += (Force[1]*MomentDist[0]-Force[0]*MomentDist[1])/RefLength;
-          MomentZ_Force[0]  += (-Force[0]*Coord[1]);
-          MomentZ_Force[1]  += (Force[1]*Coord[0]);
+        Density   = node[iPoint]->GetDensity();
+        
+        /*--- Quadratic objective function for the near-field.
+         This uses the infinity pressure regardless of Mach number. ---*/
+        
+        Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt(Area);
+        
+        MassFlow = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Velocity[iDim]  = node[iPoint]->GetVelocity(iDim);
+          MomentDist[iDim] = Coord[iDim] - Origin[iDim];
+          MassFlow -= Normal[iDim]*Velocity[iDim]*Density;
+        }
+        
+        /*--- Axisymmetric simulations ---*/
+        
+        if (axisymmetric) AxiFactor = 2.0*PI_NUMBER*Coord[1];
+        else AxiFactor = 1.0;
+        
+        /*--- Force computation, note the minus sign due to the
+         orientation of the normal (outward) ---*/
+        
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Force[iDim] = MassFlow * Velocity[iDim] * factor * AxiFactor;
+          ForceMomentum[iDim] += Force[iDim];
+        }
+        
+        /*--- Moment with respect to the reference axis ---*/
+        
+        if (iDim == 3) {
+          MomentMomentum[0] += (Force[2]*MomentDist[1]-Force[1]*MomentDist[2])/RefLength;
+          MomentX_Force[1]  += (-Force[1]*Coord[2]);
+          MomentX_Force[2]  += (Force[2]*Coord[1]);
           
+          MomentMomentum[1] += (Force[0]*MomentDist[2]-Force[2]*MomentDist[0])/RefLength;
+          MomentY_Force[2]  += (-Force[2]*Coord[0]);
+          MomentY_Force[0]  += (Force[0]*Coord[2]);
         }
+        MomentMomentum[2] += (Force[1]*MomentDist[0]-Force[0]*MomentDist[1])/RefLength;
+        MomentZ_Force[0]  += (-Force[0]*Coord[1]);
+        MomentZ_Force[1]  += (Force[1]*Coord[0]);
         
       }
       
@@ -6004,93 +5271,20 @@ void CEulerSolver::Momentum_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Mnt           = AllBound_CD_Mnt;           AllBound_CD_Mnt = 0.0;
-  MyAllBound_CL_Mnt           = AllBound_CL_Mnt;           AllBound_CL_Mnt = 0.0;
-  MyAllBound_CSF_Mnt          = AllBound_CSF_Mnt;          AllBound_CSF_Mnt = 0.0;
-  MyAllBound_CFx_Mnt          = AllBound_CFx_Mnt;          AllBound_CFx_Mnt = 0.0;
-  MyAllBound_CFy_Mnt          = AllBound_CFy_Mnt;          AllBound_CFy_Mnt = 0.0;
-  MyAllBound_CFz_Mnt          = AllBound_CFz_Mnt;          AllBound_CFz_Mnt = 0.0;
-  MyAllBound_CMx_Mnt          = AllBound_CMx_Mnt;          AllBound_CMx_Mnt = 0.0;
-  MyAllBound_CMy_Mnt          = AllBound_CMy_Mnt;          AllBound_CMy_Mnt = 0.0;
-  MyAllBound_CMz_Mnt          = AllBound_CMz_Mnt;          AllBound_CMz_Mnt = 0.0;
-  MyAllBound_CoPx_Mnt         = AllBound_CoPx_Mnt;         AllBound_CoPx_Mnt = 0.0;
-  MyAllBound_CoPy_Mnt         = AllBound_CoPy_Mnt;         AllBound_CoPy_Mnt = 0.0;
-  MyAllBound_CoPz_Mnt         = AllBound_CoPz_Mnt;         AllBound_CoPz_Mnt = 0.0;
-  MyAllBound_CT_Mnt           = AllBound_CT_Mnt;           AllBound_CT_Mnt = 0.0;
-  MyAllBound_CQ_Mnt           = AllBound_CQ_Mnt;           AllBound_CQ_Mnt = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Mnt, &AllBound_CD_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Mnt, &AllBound_CL_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Mnt, &AllBound_CSF_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CEff_Mnt = AllBound_CL_Mnt / (AllBound_CD_Mnt + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Mnt, &AllBound_CFx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Mnt, &AllBound_CFy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Mnt, &AllBound_CFz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Mnt, &AllBound_CMx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Mnt, &AllBound_CMy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Mnt, &AllBound_CMz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Mnt, &AllBound_CoPx_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Mnt, &AllBound_CoPy_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Mnt, &AllBound_CoPz_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Mnt, &AllBound_CT_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Mnt, &AllBound_CQ_Mnt, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  AllBound_CMerit_Mnt = AllBound_CT_Mnt / (AllBound_CQ_Mnt + EPS);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, packed into a single reduction. ---*/
   
-  MySurface_CL_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Mnt      = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Mnt = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Mnt       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Mnt        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Mnt        = new su2double[config->GetnMarker_Monitoring()];
+  su2double *AllBound_Mnt[] = {&AllBound_CD_Mnt, &AllBound_CL_Mnt, &AllBound_CSF_Mnt, &AllBound_CFx_Mnt, &AllBound_CFy_Mnt, &AllBound_CFz_Mnt, &AllBound_CMx_Mnt, &AllBound_CMy_Mnt, &AllBound_CMz_Mnt, &AllBound_CoPx_Mnt, &AllBound_CoPy_Mnt, &AllBound_CoPz_Mnt, &AllBound_CT_Mnt, &AllBound_CQ_Mnt};
+  su2double *Surface_Mnt[] = {Surface_CL_Mnt, Surface_CD_Mnt, Surface_CSF_Mnt, Surface_CFx_Mnt, Surface_CFy_Mnt, Surface_CFz_Mnt, Surface_CMx_Mnt, Surface_CMy_Mnt, Surface_CMz_Mnt};
   
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    MySurface_CL_Mnt[iMarker_Monitoring]      = Surface_CL_Mnt[iMarker_Monitoring];
-    MySurface_CD_Mnt[iMarker_Monitoring]      = Surface_CD_Mnt[iMarker_Monitoring];
-    MySurface_CSF_Mnt[iMarker_Monitoring] = Surface_CSF_Mnt[iMarker_Monitoring];
-    MySurface_CEff_Mnt[iMarker_Monitoring]       = Surface_CEff_Mnt[iMarker_Monitoring];
-    MySurface_CFx_Mnt[iMarker_Monitoring]        = Surface_CFx_Mnt[iMarker_Monitoring];
-    MySurface_CFy_Mnt[iMarker_Monitoring]        = Surface_CFy_Mnt[iMarker_Monitoring];
-    MySurface_CFz_Mnt[iMarker_Monitoring]        = Surface_CFz_Mnt[iMarker_Monitoring];
-    MySurface_CMx_Mnt[iMarker_Monitoring]        = Surface_CMx_Mnt[iMarker_Monitoring];
-    MySurface_CMy_Mnt[iMarker_Monitoring]        = Surface_CMy_Mnt[iMarker_Monitoring];
-    MySurface_CMz_Mnt[iMarker_Monitoring]        = Surface_CMz_Mnt[iMarker_Monitoring];
-    
-    Surface_CL_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Mnt[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Mnt[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Mnt[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Mnt[iMarker_Monitoring]        = 0.0;
-  }
+  SumCoefficients_AllRanks(sizeof(AllBound_Mnt)/sizeof(su2double*), AllBound_Mnt,
+                           sizeof(Surface_Mnt)/sizeof(su2double*), Surface_Mnt,
+                           config->GetnMarker_Monitoring());
   
-  SU2_MPI::Allreduce(MySurface_CL_Mnt, Surface_CL_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Mnt, Surface_CD_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Mnt, Surface_CSF_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  AllBound_CEff_Mnt = AllBound_CL_Mnt / (AllBound_CD_Mnt + EPS);
+  AllBound_CMerit_Mnt = AllBound_CT_Mnt / (AllBound_CQ_Mnt + EPS);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Mnt[iMarker_Monitoring] = Surface_CL_Mnt[iMarker_Monitoring] / (Surface_CD_Mnt[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Mnt, Surface_CFx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Mnt, Surface_CFy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Mnt, Surface_CFz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Mnt, Surface_CMx_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Mnt, Surface_CMy_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Mnt, Surface_CMz_Mnt, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Mnt; delete [] MySurface_CD_Mnt; delete [] MySurface_CSF_Mnt;
-  delete [] MySurface_CEff_Mnt;  delete [] MySurface_CFx_Mnt;   delete [] MySurface_CFy_Mnt;
-  delete [] MySurface_CFz_Mnt;
-  delete [] MySurface_CMx_Mnt;   delete [] MySurface_CMy_Mnt;  delete [] MySurface_CMz_Mnt;
   
 #endif
   
@@ -6138,12 +5332,17 @@ void CEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_co
   
   su2double RK_AlphaCoeff = config->Get_Alpha_RKStep(iRKStep);
   bool adjoint = config->GetContinuous_Adjoint();
+  bool res_smooth = (config->GetnRes_Smooth_Iter() > 0);
   
   for (iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
   
+  /*--- Implicit residual smoothing, the residual before the smoothing is monitored ---*/
+  
+  if (res_smooth && !adjoint) Smooth_Residual(geometry, config);
+  
   /*--- Update the solution ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -6155,8 +5354,10 @@ void CEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solver_co
     
     if (!adjoint) {
       for (iVar = 0; iVar < nVar; iVar++) {
-        Res = Residual[iVar] + Res_TruncError[iVar];
-        node[iPoint]->AddSolution(iVar, -Res*Delta*RK_AlphaCoeff);
+        Res = Residual[iVar];
+        if (Res_TruncError != NULL) Res += Res_TruncError[iVar];
+        if (res_smooth) node[iPoint]->AddSolution(iVar, -Res_Smooth[iVar*nPoint+iPoint]*Delta*RK_AlphaCoeff);
+        else node[iPoint]->AddSolution(iVar, -Res*Delta*RK_AlphaCoeff);
         AddRes_RMS(iVar, Res*Res);
         AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
@@ -6207,7 +5408,8 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
 
     if (!adjoint) {
       for (iVar = 0; iVar < nVar; iVar++) {
-        Res = Residual[iVar] + Res_TruncError[iVar];
+        Res = Residual[iVar];
+        if (Res_TruncError != NULL) Res += Res_TruncError[iVar];
         if (iRKStep < 3) {
           /* Base Solution Update */
           node[iPoint]->AddSolution(iVar, tmp_time*Res);
@@ -6235,18 +5437,87 @@ void CEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_
 
 }
 
+void CEulerSolver::LowStorageRK_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                          CConfig *config, unsigned short iRKStep) {
+  su2double *Residual, *Res_TruncError, *Solution, *Register, Vol, Delta, Res;
+  unsigned short iVar;
+  unsigned long iPoint;
+
+  /*--- Coefficients of the five stage, fourth-order, 2N-storage scheme of
+   Carpenter and Kennedy (NASA TM-109112, 1994), dU = A*dU + dt*R, U = U + B*dU ---*/
+
+  const su2double RK_A[5] = {0.0,
+                             -567301805773.0/1357537059087.0,
+                             -2404267990393.0/2016746695238.0,
+                             -3550918686646.0/2091501179385.0,
+                             -1275806237668.0/842570457699.0};
+  const su2double RK_B[5] = {1432997174477.0/9575080441755.0,
+                             5161836677717.0/13612068292357.0,
+                             1720146321549.0/2090206949498.0,
+                             3134564353537.0/4481467310338.0,
+                             2277821191437.0/14882151754819.0};
+
+  const su2double A = RK_A[iRKStep], B = RK_B[iRKStep];
+  bool adjoint = config->GetContinuous_Adjoint();
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    SetRes_RMS(iVar, 0.0);
+    SetRes_Max(iVar, 0.0, 0);
+  }
+
+  /*--- Update the solution, the register and the solution of each point are
+   contiguous, and the first stage overwrites the register of the previous step ---*/
+
+  if (!adjoint) {
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+      Vol = geometry->node[iPoint]->GetVolume();
+      Delta = node[iPoint]->GetDelta_Time() / Vol;
+
+      Res_TruncError = node[iPoint]->GetResTruncError();
+      Residual = LinSysRes.GetBlock(iPoint);
+      Solution = node[iPoint]->GetSolution();
+      Register = node[iPoint]->GetSolution_New();
+
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Res = Residual[iVar];
+        if (Res_TruncError != NULL) Res += Res_TruncError[iVar];
+        if (iRKStep == 0) Register[iVar] = -Delta*Res;
+        else Register[iVar] = A*Register[iVar] - Delta*Res;
+        Solution[iVar] += B*Register[iVar];
+        AddRes_RMS(iVar, Res*Res);
+        AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+      }
+    }
+  }
+
+  /*--- MPI solution ---*/
+
+  Set_MPI_Solution(geometry, config);
+
+  /*--- Compute the root mean square residual ---*/
+
+  SetResidual_RMS(geometry, config);
+
+}
+
 void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
   su2double *local_Residual, *local_Res_TruncError, Vol, Delta, Res;
   unsigned short iVar;
   unsigned long iPoint;
   
   bool adjoint = config->GetContinuous_Adjoint();
+  bool res_smooth = (config->GetnRes_Smooth_Iter() > 0);
   
   for (iVar = 0; iVar < nVar; iVar++) {
     SetRes_RMS(iVar, 0.0);
     SetRes_Max(iVar, 0.0, 0);
   }
   
+  /*--- Implicit residual smoothing, the residual before the smoothing is monitored ---*/
+  
+  if (res_smooth && !adjoint) Smooth_Residual(geometry, config);
+  
   /*--- Update the solution ---*/
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
@@ -6258,8 +5529,10 @@ void CEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
     
     if (!adjoint) {
       for (iVar = 0; iVar < nVar; iVar++) {
-        Res = local_Residual[iVar] + local_Res_TruncError[iVar];
-        node[iPoint]->AddSolution(iVar, -Res*Delta);
+        Res = local_Residual[iVar];
+        if (local_Res_TruncError != NULL) Res += local_Res_TruncError[iVar];
+        if (res_smooth) node[iPoint]->AddSolution(iVar, -Res_Smooth[iVar*nPoint+iPoint]*Delta);
+        else node[iPoint]->AddSolution(iVar, -Res*Delta);
         AddRes_RMS(iVar, Res*Res);
         AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
@@ -6286,6 +5559,12 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   bool adjoint = config->GetContinuous_Adjoint();
   bool roe_turkel = config->GetKind_Upwind_Flow() == TURKEL;
   bool low_mach_prec = config->Low_Mach_Preconditioning();
+  bool freezing = config->GetLocal_Freezing();
+  
+  /*--- The residual of each point is kept for the local freezing in the sweeps
+   of the entire domain, the residual of the frozen points is incomplete ---*/
+  
+  if (freezing && !Local_Freezing) Point_Residual.assign(nPointDomain, 0.0);
   
   /*--- Set maximum residual to zero ---*/
   
@@ -6327,18 +5606,32 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       for (iVar = 0; iVar < nVar; iVar++) {
         total_index = iPoint*nVar + iVar;
         LinSysRes[total_index] = 0.0;
-        local_Res_TruncError[iVar] = 0.0;
+        if (local_Res_TruncError != NULL) local_Res_TruncError[iVar] = 0.0;
+      }
+    }
+    
+    /*--- Frozen points are not updated ---*/
+    
+    if (!GetPoint_Active(iPoint)) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        total_index = iPoint*nVar + iVar;
+        LinSysRes[total_index] = 0.0;
+        LinSysSol[total_index] = 0.0;
       }
+      continue;
     }
     
-    /*--- Right hand side of the system (-Residual) and initial guess (x = 0) ---*/
+    /*--- Right hand side of the system (-Residual) and initial guess (x = 0),
+     the truncation error is only present with multigrid ---*/
     
     for (iVar = 0; iVar < nVar; iVar++) {
       total_index = iPoint*nVar + iVar;
-      LinSysRes[total_index] = - (LinSysRes[total_index] + local_Res_TruncError[iVar]);
+      if (local_Res_TruncError != NULL) LinSysRes[total_index] += local_Res_TruncError[iVar];
+      LinSysRes[total_index] = -LinSysRes[total_index];
       LinSysSol[total_index] = 0.0;
       AddRes_RMS(iVar, LinSysRes[total_index]*LinSysRes[total_index]);
       AddRes_Max(iVar, fabs(LinSysRes[total_index]), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
+      if (freezing && !Local_Freezing) Point_Residual[iPoint] += LinSysRes[total_index]*LinSysRes[total_index];
     }
   }
   
@@ -6351,20 +5644,39 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
       LinSysSol[total_index] = 0.0;
     }
   }
+
+  /*--- In the coupled mode the system is solved together with the one of the
+   turbulence model, which also updates the mean flow solution. Only the
+   residuals for the monitoring are finalized here. ---*/
+
+  if (config->GetCoupled_Turb_Implicit()) {
+    SetResidual_RMS(geometry, config);
+    return;
+  }
   
-  /*--- Solve or smooth the linear system ---*/
+  /*--- Solve or smooth the linear system. With Jacobian-free products the
+   Jacobian is only the preconditioner, and the residual evaluations of the
+   products overwrite LinSysRes, hence the copy of the right hand side. ---*/
   
-  CSysSolve system;
-  IterLinSol = system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (JacobianFree_Product != NULL) {
+    CSysVector LinSysRhs(LinSysRes);
+    IterLinSol = System.Solve(Jacobian, LinSysRhs, LinSysSol, geometry, config, JacobianFree_Product);
+  }
+  else {
+    IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  }
   
-  /*--- The the number of iterations of the linear solver ---*/
+  /*--- The the number of iterations and the residual reduction of the linear solver ---*/
   
   SetIterLinSolver(IterLinSol);
+  SetResLinSolver(System.GetResidual_Rel());
+  CheckJacobian_Lag(config, IterLinSol, System.GetResidual_Rel());
   
   /*--- Update solution (system written in terms of increments) ---*/
   
   if (!adjoint) {
     for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (!GetPoint_Active(iPoint)) continue;
       for (iVar = 0; iVar < nVar; iVar++) {
         node[iPoint]->AddSolution(iVar, config->GetRelaxation_Factor_Flow()*LinSysSol[iPoint*nVar+iVar]);
       }
@@ -6373,19 +5685,44 @@ void CEulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver
   
   /*--- MPI solution ---*/
   
-  Set_MPI_Solution(geometry, config);
+  Set_MPI_Solution(geometry, config);
+  
+  /*--- Compute the root mean square residual ---*/
+  
+  SetResidual_RMS(geometry, config);
+  
+  /*--- Update the set of active points for the next iteration ---*/
+  
+  if (freezing) SetLocal_Freezing(geometry, config);
+  
+}
+
+void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  ComputePrimitive_Gradient_GG(geometry, config, false);
+  
+  Set_MPI_Primitive_Gradient(geometry, config);
+  
+  config->Tock(tick, "CEulerSolver::SetPrimitive_Gradient_GG", PROFILE_GRADIENT);
   
-  /*--- Compute the root mean square residual ---*/
+}
+
+void CEulerSolver::ComputePrimitive_Gradient_GG(CGeometry *geometry, CConfig *config, bool val_bounds) {
   
-  SetResidual_RMS(geometry, config);
+  if (nDim == 2) ComputePrimitive_Gradient_GG_Kernel<2>(geometry, config, val_bounds);
+  else ComputePrimitive_Gradient_GG_Kernel<3>(geometry, config, val_bounds);
   
 }
 
-void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config) {
+template<unsigned short NDIM>
+void CEulerSolver::ComputePrimitive_Gradient_GG_Kernel(CGeometry *geometry, CConfig *config, bool val_bounds) {
   unsigned long iPoint, jPoint, iEdge, iVertex;
   unsigned short iDim, iVar, iMarker;
   su2double *PrimVar_Vertex, *PrimVar_i, *PrimVar_j, PrimVar_Average,
-  Partial_Gradient, Partial_Res, *Normal;
+  Partial_Gradient, Partial_Res, *Normal, du;
   
   /*--- Gradient primitive variables compressible (temp, vx, vy, vz, P, rho) ---*/
 
@@ -6397,6 +5734,11 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++)
     node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+  
+  /*--- Initialize the limiter bounds in the entire domain, they are
+   accumulated in the same edge loop as the gradient. ---*/
+  
+  if (val_bounds) SetPrimitive_Limiter_Init(geometry);
 
   /*--- Loop interior edges ---*/
   
@@ -6405,19 +5747,31 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
     jPoint = geometry->edge[iEdge]->GetNode(1);
     
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      PrimVar_i[iVar] = node[iPoint]->GetPrimitive(iVar);
-      PrimVar_j[iVar] = node[jPoint]->GetPrimitive(iVar);
+      PrimVar_i[iVar] = GetNode_Primitive(iPoint)[iVar];
+      PrimVar_j[iVar] = GetNode_Primitive(jPoint)[iVar];
     }
     
     Normal = geometry->edge[iEdge]->GetNormal();
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
       PrimVar_Average =  0.5 * ( PrimVar_i[iVar] + PrimVar_j[iVar] );
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (iDim = 0; iDim < NDIM; iDim++) {
         Partial_Res = PrimVar_Average*Normal[iDim];
         if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient_Primitive(iVar, iDim, Partial_Res);
+          GetNode_Gradient_Primitive(iPoint)[iVar][iDim] += Partial_Res;
         if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+          GetNode_Gradient_Primitive(jPoint)[iVar][iDim] -= Partial_Res;
+      }
+    }
+    
+    /*--- Neighbor bounds for the limiter (Spekreijse monotonicity) ---*/
+    
+    if (val_bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        du = (PrimVar_j[iVar] - PrimVar_i[iVar]);
+        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
       }
     }
   }
@@ -6432,13 +5786,13 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
       if (geometry->node[iPoint]->GetDomain()) {
         
         for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          PrimVar_Vertex[iVar] = node[iPoint]->GetPrimitive(iVar);
+          PrimVar_Vertex[iVar] = GetNode_Primitive(iPoint)[iVar];
         
         Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
         for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++) {
+          for (iDim = 0; iDim < NDIM; iDim++) {
             Partial_Res = PrimVar_Vertex[iVar]*Normal[iDim];
-            node[iPoint]->SubtractGradient_Primitive(iVar, iDim, Partial_Res);
+            GetNode_Gradient_Primitive(iPoint)[iVar][iDim] -= Partial_Res;
           }
       }
     }
@@ -6448,7 +5802,7 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   
   for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (iDim = 0; iDim < NDIM; iDim++) {
         Partial_Gradient = node[iPoint]->GetGradient_Primitive(iVar, iDim) / (geometry->node[iPoint]->GetVolume());
         node[iPoint]->SetGradient_Primitive(iVar, iDim, Partial_Gradient);
       }
@@ -6459,17 +5813,87 @@ void CEulerSolver::SetPrimitive_Gradient_GG(CGeometry *geometry, CConfig *config
   delete [] PrimVar_i;
   delete [] PrimVar_j;
 
+}
+
+void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config) {
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  ComputePrimitive_Gradient_LS(geometry, config, false);
+  
   Set_MPI_Primitive_Gradient(geometry, config);
+  
+  config->Tock(tick, "CEulerSolver::SetPrimitive_Gradient_LS", PROFILE_GRADIENT);
+  
+}
 
+void CEulerSolver::ComputePrimitive_Gradient_LS(CGeometry *geometry, CConfig *config, bool val_bounds) {
+  
+  if (nDim == 2) ComputePrimitive_Gradient_LS_Kernel<2>(geometry, config, val_bounds);
+  else ComputePrimitive_Gradient_LS_Kernel<3>(geometry, config, val_bounds);
+  
 }
 
-void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config) {
+template<unsigned short NDIM>
+void CEulerSolver::ComputePrimitive_Gradient_LS_Kernel(CGeometry *geometry, CConfig *config, bool val_bounds) {
   
   unsigned short iVar, iDim, jDim, iNeigh;
-  unsigned long iPoint, jPoint;
+  unsigned long iPoint, jPoint, iEdge;
   su2double *PrimVar_i, *PrimVar_j, *Coord_i, *Coord_j, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2;
-  bool singular;
+  r23_b, r33, weight, product, z11, z12, z13, z22, z23, z33, detR2, du,
+  *Bound_Min = NULL, *Bound_Max = NULL, *Weight_i, *Weight_j;
+  bool singular, domain_i, domain_j;
+  
+  /*--- With the weights cached in the geometry the gradient is a weighted
+   sum over the edges, and the bounds are accumulated as in Green-Gauss ---*/
+  
+  if (config->GetCache_LS_Weights()) {
+    
+    if (!geometry->LS_Weights_Ready) geometry->PreprocessLS_Weights();
+    
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      node[iPoint]->SetGradient_PrimitiveZero(nPrimVarGrad);
+    
+    if (val_bounds) SetPrimitive_Limiter_Init(geometry);
+    
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      iPoint = geometry->GetEdge_Node(iEdge, 0);
+      jPoint = geometry->GetEdge_Node(iEdge, 1);
+      domain_i = geometry->node[iPoint]->GetDomain();
+      domain_j = geometry->node[jPoint]->GetDomain();
+      
+      PrimVar_i = GetNode_Primitive(iPoint);
+      PrimVar_j = GetNode_Primitive(jPoint);
+      Weight_i = geometry->GetLS_Weight(iEdge, 0);
+      Weight_j = geometry->GetLS_Weight(iEdge, 1);
+      
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        du = PrimVar_j[iVar] - PrimVar_i[iVar];
+        for (iDim = 0; iDim < NDIM; iDim++) {
+          if (domain_i) GetNode_Gradient_Primitive(iPoint)[iVar][iDim] += Weight_i[iDim]*du;
+          if (domain_j) GetNode_Gradient_Primitive(jPoint)[iVar][iDim] += Weight_j[iDim]*du;
+        }
+        if (val_bounds) {
+          node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
+          node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
+          node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
+          node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        }
+      }
+    }
+    
+    return;
+  }
+  
+  /*--- The limiter bounds are accumulated over the same neighbor loop,
+   the halo values are not needed since the halo limiters are exchanged. ---*/
+  
+  if (val_bounds) {
+    SetPrimitive_Limiter_Init(geometry);
+    Bound_Min = new su2double [nPrimVarGrad];
+    Bound_Max = new su2double [nPrimVarGrad];
+  }
   
   /*--- Loop over points of the grid ---*/
   
@@ -6484,32 +5908,47 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     
     /*--- Get primitives from CVariable ---*/
     
-    PrimVar_i = node[iPoint]->GetPrimitive();
+    PrimVar_i = GetNode_Primitive(iPoint);
     
     /*--- Inizialization of variables ---*/
     
     for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      for (iDim = 0; iDim < nDim; iDim++)
+      for (iDim = 0; iDim < NDIM; iDim++)
         Cvector[iVar][iDim] = 0.0;
     
     r11 = 0.0; r12 = 0.0;   r13 = 0.0;    r22 = 0.0;
     r23 = 0.0; r23_a = 0.0; r23_b = 0.0;  r33 = 0.0;
     
+    if (val_bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        Bound_Min[iVar] = EPS;
+        Bound_Max[iVar] = -EPS;
+      }
+    }
+    
     AD::StartPreacc();
     AD::SetPreaccIn(PrimVar_i, nPrimVarGrad);
-    AD::SetPreaccIn(Coord_i, nDim);
+    AD::SetPreaccIn(Coord_i, NDIM);
     
     for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
       jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
       Coord_j = geometry->node[jPoint]->GetCoord();
       
-      PrimVar_j = node[jPoint]->GetPrimitive();
+      PrimVar_j = GetNode_Primitive(jPoint);
       
-      AD::SetPreaccIn(Coord_j, nDim);
+      AD::SetPreaccIn(Coord_j, NDIM);
       AD::SetPreaccIn(PrimVar_j, nPrimVarGrad);
+      
+      if (val_bounds) {
+        for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+          du = (PrimVar_j[iVar] - PrimVar_i[iVar]);
+          Bound_Min[iVar] = min(Bound_Min[iVar], du);
+          Bound_Max[iVar] = max(Bound_Max[iVar], du);
+        }
+      }
 
       weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
+      for (iDim = 0; iDim < NDIM; iDim++)
         weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
       
       /*--- Sumations for entries of upper triangular matrix R ---*/
@@ -6520,7 +5959,7 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
         r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
         r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
         
-        if (nDim == 3) {
+        if (NDIM == 3) {
           r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
           r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
           r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
@@ -6530,7 +5969,7 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
         /*--- Entries of c:= transpose(A)*b ---*/
         
         for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
+          for (iDim = 0; iDim < NDIM; iDim++)
             Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(PrimVar_j[iVar]-PrimVar_i[iVar])/weight;
         
       }
@@ -6543,7 +5982,7 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
     if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
     
-    if (nDim == 3) {
+    if (NDIM == 3) {
       if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
       if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
       if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
@@ -6551,7 +5990,7 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     
     /*--- Compute determinant ---*/
     
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    if (NDIM == 2) detR2 = (r11*r22)*(r11*r22);
     else detR2 = (r11*r22*r33)*(r11*r22*r33);
     
     /*--- Detect singular matrices ---*/
@@ -6561,12 +6000,12 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
     
     if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
+      for (iDim = 0; iDim < NDIM; iDim++)
+        for (jDim = 0; jDim < NDIM; jDim++)
           Smatrix[iDim][jDim] = 0.0;
     }
     else {
-      if (nDim == 2) {
+      if (NDIM == 2) {
         Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
         Smatrix[0][1] = -r11*r12/detR2;
         Smatrix[1][0] = Smatrix[0][1];
@@ -6589,9 +6028,9 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
     
     /*--- Computation of the gradient: S*c ---*/
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
+      for (iDim = 0; iDim < NDIM; iDim++) {
         product = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++) {
+        for (jDim = 0; jDim < NDIM; jDim++) {
           product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
         }
         
@@ -6599,22 +6038,92 @@ void CEulerSolver::SetPrimitive_Gradient_LS(CGeometry *geometry, CConfig *config
       }
     }
     
-    AD::SetPreaccOut(node[iPoint]->GetGradient_Primitive(), nPrimVarGrad, nDim);
+    AD::SetPreaccOut(GetNode_Gradient_Primitive(iPoint), nPrimVarGrad, NDIM);
+    if (val_bounds) {
+      AD::SetPreaccOut(Bound_Min, nPrimVarGrad);
+      AD::SetPreaccOut(Bound_Max, nPrimVarGrad);
+    }
     AD::EndPreacc();
+    
+    if (val_bounds) {
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        node[iPoint]->SetSolution_Min(iVar, Bound_Min[iVar]);
+        node[iPoint]->SetSolution_Max(iVar, Bound_Max[iVar]);
+      }
+    }
   }
   
-  Set_MPI_Primitive_Gradient(geometry, config);
+  if (val_bounds) {
+    delete [] Bound_Min;
+    delete [] Bound_Max;
+  }
   
 }
 
 void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  ComputePrimitive_Limiter(geometry, config, false);
+  
+  /*--- Limiter MPI ---*/
+  
+  Set_MPI_Primitive_Limiter(geometry, config);
+  
+  config->Tock(tick, "CEulerSolver::SetPrimitive_Limiter", PROFILE_GRADIENT);
+  
+}
+
+void CEulerSolver::SetPrimitive_Gradient_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  bool bounds = (config->GetKind_SlopeLimit_Flow() != NO_LIMITER);
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  /*--- Gradient and neighbor bounds in a single sweep. Only the values of the
+   domain points are needed by the limiter, the halos are completed below. ---*/
+  
+  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+    ComputePrimitive_Gradient_GG(geometry, config, bounds);
+  }
+  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+    ComputePrimitive_Gradient_LS(geometry, config, bounds);
+  }
+  
+  ComputePrimitive_Limiter(geometry, config, bounds);
+  
+  /*--- Gradient and limiter MPI, as a single message ---*/
+  
+  Set_MPI_Primitive_Gradient_Limiter(geometry, config);
+  
+  config->Tock(tick, "CEulerSolver::SetPrimitive_Gradient_Limiter", PROFILE_GRADIENT);
+  
+}
+
+void CEulerSolver::SetPrimitive_Limiter_Init(CGeometry *geometry) {
+  
+  unsigned long iPoint;
+  unsigned short iVar;
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      node[iPoint]->SetSolution_Max(iVar, -EPS);
+      node[iPoint]->SetSolution_Min(iVar, EPS);
+      node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
+    }
+  }
+  
+}
+
+void CEulerSolver::ComputePrimitive_Limiter(CGeometry *geometry, CConfig *config, bool val_bounds) {
+  
   unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar, iDim;
-  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
-  *Primitive, *Primitive_i, *Primitive_j, *LocalMinPrimitive, *LocalMaxPrimitive,
-  *GlobalMinPrimitive, *GlobalMaxPrimitive,
-  dave, LimK, eps2, eps1, dm, dp, du, y, limiter;
+  unsigned short iVar;
+  su2double *Primitive, *Primitive_i, *Primitive_j, *LocalMinPrimitive, *LocalMaxPrimitive,
+  *GlobalMinPrimitive, *GlobalMaxPrimitive, *Max_i, *Min_i, *Max_j, *Min_j, *Limiter,
+  dave, LimK, eps1, du, y;
   
   dave = config->GetRefElemLength();
   LimK = config->GetVenkat_LimiterCoeff();
@@ -6629,17 +6138,11 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     
   }
   
-  else {
+  else if (!val_bounds) {
     
     /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
     
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        node[iPoint]->SetSolution_Max(iVar, -EPS);
-        node[iPoint]->SetSolution_Min(iVar, EPS);
-        node[iPoint]->SetLimiter_Primitive(iVar, 2.0);
-      }
-    }
+    SetPrimitive_Limiter_Init(geometry);
     
     /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
     
@@ -6650,19 +6153,21 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
       iPoint = geometry->edge[iEdge]->GetNode(0);
       jPoint = geometry->edge[iEdge]->GetNode(1);
       
-      /*--- Get the primitive variables ---*/
+      /*--- Get the primitive variables and the bounds ---*/
       
-      Primitive_i = node[iPoint]->GetPrimitive();
-      Primitive_j = node[jPoint]->GetPrimitive();
+      Primitive_i = GetNode_Primitive(iPoint);
+      Primitive_j = GetNode_Primitive(jPoint);
+      Max_i = node[iPoint]->GetSolution_Max(); Min_i = node[iPoint]->GetSolution_Min();
+      Max_j = node[jPoint]->GetSolution_Max(); Min_j = node[jPoint]->GetSolution_Min();
       
       /*--- Compute the maximum, and minimum values for nodes i & j ---*/
       
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
         du = (Primitive_j[iVar] - Primitive_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
+        Min_i[iVar] = min(Min_i[iVar], du);
+        Max_i[iVar] = max(Max_i[iVar], du);
+        Min_j[iVar] = min(Min_j[iVar], -du);
+        Max_j[iVar] = max(Max_j[iVar], -du);
       }
       
     }
@@ -6673,74 +6178,13 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
   
   if (config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) {
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
-
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-          else dp = node[iPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
-          node[iPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
-        }
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-          else dp = node[jPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
-          node[jPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
-        }
-        
-      }
-      
-      AD::EndPreacc();
-
-    }
+    SetEdge_Limiter(geometry, BARTH_JESPERSEN, nPrimVarGrad, true, NULL);
     
     for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      Limiter = GetNode_Limiter_Primitive(iPoint);
       for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        y =  node[iPoint]->GetLimiter_Primitive(iVar);
-        limiter = (y*y + 2.0*y) / (y*y + y + 2.0);
-        node[iPoint]->SetLimiter_Primitive(iVar, limiter);
+        y = Limiter[iVar];
+        Limiter[iVar] = (y*y + 2.0*y) / (y*y + y + 2.0);
       }
     }
     
@@ -6778,8 +6222,8 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     }
     
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(LocalMinPrimitive, GlobalMinPrimitive, nPrimVarGrad, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(LocalMaxPrimitive, GlobalMaxPrimitive, nPrimVarGrad, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
     for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
       GlobalMinPrimitive[iVar] = LocalMinPrimitive[iVar];
@@ -6787,86 +6231,27 @@ void CEulerSolver::SetPrimitive_Limiter(CGeometry *geometry, CConfig *config) {
     }
 #endif
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient_Primitive();
-      Gradient_j = node[jPoint]->GetGradient_Primitive();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Gradient_j, nPrimVarGrad, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-      AD::SetPreaccIn(eps2);
-
-      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-        
-        if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
-          eps1 = LimK * (GlobalMaxPrimitive[iVar] - GlobalMinPrimitive[iVar]);
-          eps2 = eps1*eps1;
-        }
-        else {
-          eps1 = LimK*dave;
-          eps2 = eps1*eps1*eps1;
-        }
-
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
-
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter_Primitive(iVar)) {
-          node[iPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter_Primitive()[iVar]);
-        }
-        
-        /*-- Repeat for point j on the edge ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[jPoint]->GetLimiter_Primitive(iVar)) {
-          node[jPoint]->SetLimiter_Primitive(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter_Primitive()[iVar]);
-        }
-        
+    /*--- The parameter of every variable is computed once, not per edge. ---*/
+    
+    vector<su2double> Eps2(nPrimVarGrad);
+    for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+      if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+        eps1 = LimK * (GlobalMaxPrimitive[iVar] - GlobalMinPrimitive[iVar]);
+        Eps2[iVar] = eps1*eps1;
+      }
+      else {
+        eps1 = LimK*dave;
+        Eps2[iVar] = eps1*eps1*eps1;
       }
-
-      AD::EndPreacc();
-      
     }
     
+    SetEdge_Limiter(geometry, VENKATAKRISHNAN, nPrimVarGrad, true, Eps2.data());
+    
     delete [] LocalMinPrimitive; delete [] GlobalMinPrimitive;
     delete [] LocalMaxPrimitive; delete [] GlobalMaxPrimitive;
     
   }
 
-  /*--- Limiter MPI ---*/
-  
-  Set_MPI_Primitive_Limiter(geometry, config);
-
 }
 
 void CEulerSolver::SetPreconditioner(CConfig *config, unsigned long iPoint) {
@@ -7325,32 +6710,32 @@ void CEulerSolver::GetPower_Properties(CGeometry *geometry, CConfig *config, uns
     
 #ifdef HAVE_MPI
     
-    SU2_MPI::Allreduce(Inlet_MassFlow_Local, Inlet_MassFlow_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_ReverseMassFlow_Local, Inlet_ReverseMassFlow_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Pressure_Local, Inlet_Pressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Mach_Local, Inlet_Mach_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_MinPressure_Local, Inlet_MinPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_MaxPressure_Local, Inlet_MaxPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_TotalPressure_Local, Inlet_TotalPressure_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Temperature_Local, Inlet_Temperature_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_TotalTemperature_Local, Inlet_TotalTemperature_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_RamDrag_Local, Inlet_RamDrag_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Force_Local, Inlet_Force_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Power_Local, Inlet_Power_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_Area_Local, Inlet_Area_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_XCG_Local, Inlet_XCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Inlet_YCG_Local, Inlet_YCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    if (nDim == 3) SU2_MPI::Allreduce(Inlet_ZCG_Local, Inlet_ZCG_Total, nMarker_Inlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    
-    SU2_MPI::Allreduce(Outlet_MassFlow_Local, Outlet_MassFlow_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Pressure_Local, Outlet_Pressure_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_TotalPressure_Local, Outlet_TotalPressure_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Temperature_Local, Outlet_Temperature_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_TotalTemperature_Local, Outlet_TotalTemperature_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_GrossThrust_Local, Outlet_GrossThrust_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Force_Local, Outlet_Force_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Power_Local, Outlet_Power_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(Outlet_Area_Local, Outlet_Area_Total, nMarker_Outlet, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_MassFlow_Local, Inlet_MassFlow_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_ReverseMassFlow_Local, Inlet_ReverseMassFlow_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Pressure_Local, Inlet_Pressure_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Mach_Local, Inlet_Mach_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_MinPressure_Local, Inlet_MinPressure_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_MaxPressure_Local, Inlet_MaxPressure_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_TotalPressure_Local, Inlet_TotalPressure_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Temperature_Local, Inlet_Temperature_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_TotalTemperature_Local, Inlet_TotalTemperature_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_RamDrag_Local, Inlet_RamDrag_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Force_Local, Inlet_Force_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Power_Local, Inlet_Power_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_Area_Local, Inlet_Area_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_XCG_Local, Inlet_XCG_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Inlet_YCG_Local, Inlet_YCG_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    if (nDim == 3) SU2_MPI::Allreduce(Inlet_ZCG_Local, Inlet_ZCG_Total, nMarker_Inlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    
+    SU2_MPI::Allreduce(Outlet_MassFlow_Local, Outlet_MassFlow_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_Pressure_Local, Outlet_Pressure_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_TotalPressure_Local, Outlet_TotalPressure_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_Temperature_Local, Outlet_Temperature_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_TotalTemperature_Local, Outlet_TotalTemperature_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_GrossThrust_Local, Outlet_GrossThrust_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_Force_Local, Outlet_Force_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_Power_Local, Outlet_Power_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(Outlet_Area_Local, Outlet_Area_Total, nMarker_Outlet, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
     
 #else
     
@@ -8364,7 +7749,7 @@ void CEulerSolver::SetActDisk_BCThrust(CGeometry *geometry, CSolver **solver_con
   
   MyBCThrust = config->GetInitial_BCThrust();
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(&MyBCThrust, &BCThrust, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyBCThrust, &BCThrust, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #else
   BCThrust = MyBCThrust;
 #endif
@@ -8388,8 +7773,19 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
   su2double Beta                 = config->GetAoS()*PI_NUMBER/180.0;
   su2double dCL_dAlpha           = config->GetdCL_dAlpha()*180.0/PI_NUMBER;
   bool Update_AoA             = false;
+  bool newton                 = config->GetFixed_CL_Newton();
+  su2double Res_Log, dCL_dAlpha_Secant;
+  
+  if (ExtIter == 0) {
+    AoA_Counter       = 0;
+    Iter_Newton_AoA   = 0;
+    Res_Newton_Max    = -1E30;
+    dCL_dAlpha_Newton = config->GetdCL_dAlpha();
+  }
+  
+  /*--- Newton updates are announced each time, not at fixed iterations ---*/
   
-  if (ExtIter == 0) AoA_Counter = 0;
+  if (newton) write_heads = Output;
   
   /*--- Only the fine mesh level should check the convergence criteria ---*/
   
@@ -8401,12 +7797,28 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
 
     /*--- Reevaluate Angle of Attack at a fixed number of iterations ---*/
     
-    if ((ExtIter % Iter_Fixed_CL == 0) && (ExtIter != 0)) {
+    if (!newton && (ExtIter % Iter_Fixed_CL == 0) && (ExtIter != 0)) {
       AoA_Counter++;
       if ((AoA_Counter <= Update_Alpha)) Update_AoA = true;
       else Update_AoA = false;
     }
     
+    /*--- Newton updates as soon as the density residual has dropped by the given orders
+     of magnitude from its peak after the last change of AoA, or at the latest after
+     Iter_Fixed_CL iterations. The residual is the one of the previous iteration. ---*/
+    
+    if (newton && (ExtIter > Iter_Newton_AoA+1) && (AoA_Counter < Update_Alpha)) {
+      
+      Res_Log = (GetRes_RMS(0) > 0.0)? log10(GetRes_RMS(0)) : Res_Newton_Max;
+      Res_Newton_Max = max(Res_Newton_Max, Res_Log);
+      
+      if ((Res_Log <= Res_Newton_Max - config->GetFixed_CL_Newton_Residual()) ||
+          (ExtIter - Iter_Newton_AoA >= Iter_Fixed_CL)) {
+        AoA_Counter++;
+        Update_AoA = true;
+      }
+    }
+    
     /*--- Store the update boolean for use on other mesh levels in the MG ---*/
     
     config->SetUpdate_AoA(Update_AoA);
@@ -8427,6 +7839,25 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
     
     AoA_old = config->GetAoA()*PI_NUMBER/180.0;
     
+    /*--- Secant estimate of dCL/dAlpha through the (AoA, CL) of the previous and of the
+     current update. It is only taken if it has the sign of the given estimate and is
+     within a factor of ten of it, otherwise the last accepted slope is kept. ---*/
+    
+    if (newton) {
+      if ((iMesh == MESH_0) && (AoA_Counter > 1) && (fabs(config->GetAoA()-AoA_Newton_Prev) > EPS)) {
+        dCL_dAlpha_Secant = (Total_CL-CL_Newton_Prev)/(config->GetAoA()-AoA_Newton_Prev);
+        if ((dCL_dAlpha_Secant/config->GetdCL_dAlpha() > 0.1) && (dCL_dAlpha_Secant/config->GetdCL_dAlpha() < 10.0))
+          dCL_dAlpha_Newton = dCL_dAlpha_Secant;
+      }
+      if (iMesh == MESH_0) {
+        AoA_Newton_Prev = config->GetAoA();
+        CL_Newton_Prev  = Total_CL;
+        Iter_Newton_AoA = ExtIter;
+        Res_Newton_Max  = -1E30;
+      }
+      dCL_dAlpha = dCL_dAlpha_Newton*180.0/PI_NUMBER;
+    }
+    
     /*--- Estimate the increment in AoA based on dCL_dAlpha (radians) ---*/
     
     AoA_inc = (1.0/dCL_dAlpha)*(Target_CL - Total_CL);
@@ -8492,6 +7923,7 @@ void CEulerSolver::SetFarfield_AoA(CGeometry *geometry, CSolver **solver_contain
       cout.precision(4);
       cout << "Previous AoA: " << Old_AoA << " deg";
       cout << ", new AoA: " << config->GetAoA() << " deg." << endl;
+      if (newton) cout << "Newton update " << AoA_Counter << ", dCL/dAlpha: " << dCL_dAlpha_Newton << " (1/deg)." << endl;
       cout << "-------------------------------------------------------------------------" << endl << endl;
     }
 
@@ -8916,21 +8348,22 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
   
-  Normal = new su2double[nDim];
-  NormalArea = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
-  Velocity_i = new su2double[nDim];
-  Jacobian_b = new su2double*[nVar];
-  DubDu = new su2double*[nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Jacobian_b[iVar] = new su2double[nVar];
-    DubDu[iVar] = new su2double[nVar];
-  }
+  /*--- Auxiliary vectors allocated once by the solver ---*/
+  
+  NormalArea = BC_Normal;
+  Velocity_b = BC_Velocity_b;
+  Velocity_i = BC_Velocity_i;
+  Jacobian_b = BC_Jacobian_b;
+  DubDu = BC_DubDu;
+  
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     /*--- Check if the node belongs to the domain (i.e, not a halo node) ---*/
     
@@ -8938,7 +8371,7 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
       
       /*--- Normal vector for this vertex (negative for outward convention) ---*/
       
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
+      Normal = geometry->GetVertex_Normal(val_marker, iVertex);
       
       Area = 0.0;
       for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
@@ -9066,24 +8499,13 @@ void CEulerSolver::BC_Euler_Wall(CGeometry *geometry, CSolver **solver_container
     }
   }
   
-  delete [] Normal;
-  delete [] NormalArea;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
-  for (iVar = 0; iVar < nVar; iVar++) {
-    delete [] Jacobian_b[iVar];
-    delete [] DubDu[iVar];
-  }
-  delete [] Jacobian_b;
-  delete [] DubDu;
-  
 }
 
 void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
                                 CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
   
-  unsigned short iDim;
-  unsigned long iVertex, iPoint, Point_Normal;
+  unsigned short iDim, nBatch = 0;
+  unsigned long iVertex, iPoint, Point_Normal, Batch_Point[SIMD_WIDTH];
   
   su2double *GridVel;
   su2double Area, UnitNormal[3] = {0.0,0.0,0.0};
@@ -9094,7 +8516,7 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   su2double SoundSpeed_Bound, Entropy_Bound, Vel2_Bound, Vn_Bound;
   su2double SoundSpeed_Infty, Entropy_Infty, Vel2_Infty, Vn_Infty, Qn_Infty;
   su2double RiemannPlus, RiemannMinus;
-  su2double *V_infty, *V_domain;
+  su2double *V_infty, *V_domain, *Vertex_Normal;
   
   su2double Gas_Constant     = config->GetGas_ConstantND();
   
@@ -9104,13 +8526,20 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
   bool tkeNeeded = (((config->GetKind_Solver() == RANS ) ||
                      (config->GetKind_Solver() == DISC_ADJ_RANS))
                     && (config->GetKind_Turb_Model() == SST));
+  bool ideal_gas      = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS);
+  bool batch_flux     = (config->GetBatch_Flux() && ideal_gas && !grid_movement &&
+                         (config->GetKind_Upwind() != TURKEL) && (config->GetKind_RoeLowDiss() == NO_ROELOWDISS));
     
-  su2double *Normal = new su2double[nDim];
+  su2double *Normal = BC_Normal;
+  
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     /*--- Allocate the value at the infinity ---*/
     V_infty = GetCharacPrimVar(val_marker, iVertex);
@@ -9121,12 +8550,12 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Index of the closest interior node ---*/
       
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->GetVertex_Neighbor(val_marker, iVertex);
       
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
       
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+      Vertex_Normal = geometry->GetVertex_Normal(val_marker, iVertex);
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Vertex_Normal[iDim];
       conv_numerics->SetNormal(Normal);
       
       /*--- Retrieve solution at the farfield boundary node ---*/
@@ -9268,32 +8697,46 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
 
 
       
-      /*--- Set various quantities in the numerics class ---*/
-      
-      conv_numerics->SetPrimitive(V_domain, V_infty);
+      /*--- Batched evaluation, the vertex is queued and the batch is computed
+       when it is full or at the end of the marker ---*/
       
-      if (grid_movement) {
-        conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
-                                  geometry->node[iPoint]->GetGridVel());
+      if (batch_flux) {
+        conv_numerics->SetBatch_Edge(nBatch, V_domain, V_infty, Normal);
+        Batch_Point[nBatch++] = iPoint;
+        if (nBatch == SIMD_WIDTH) {
+          Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
+          nBatch = 0;
+        }
+      }
+      else {
+        
+        /*--- Set various quantities in the numerics class ---*/
+        
+        conv_numerics->SetPrimitive(V_domain, V_infty);
+        
+        if (grid_movement) {
+          conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(),
+                                    geometry->node[iPoint]->GetGridVel());
+        }
+        
+        /*--- Compute the convective residual using an upwind scheme ---*/
+        
+        conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+        
+        /*--- Update residual value ---*/
+        
+        LinSysRes.AddBlock(iPoint, Residual);
+        
+        /*--- Convective Jacobian contribution for implicit integration ---*/
+        
+        if (implicit)
+          Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        
+        /*--- Roe Turkel preconditioning, set the value of beta ---*/
+        
+        if (config->GetKind_Upwind() == TURKEL)
+          node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
       }
-      
-      /*--- Compute the convective residual using an upwind scheme ---*/
-
-      conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
-      
-      /*--- Update residual value ---*/
-      
-      LinSysRes.AddBlock(iPoint, Residual);
-      
-      /*--- Convective Jacobian contribution for implicit integration ---*/
-      
-      if (implicit)
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      
-      /*--- Roe Turkel preconditioning, set the value of beta ---*/
-      
-      if (config->GetKind_Upwind() == TURKEL)
-        node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
       
       /*--- Viscous residual contribution ---*/
       
@@ -9341,8 +8784,9 @@ void CEulerSolver::BC_Far_Field(CGeometry *geometry, CSolver **solver_container,
     }
   }
   
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+  /*--- Last, incomplete, batch of the marker ---*/
+  
+  if (nBatch > 0) Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
   
 }
 
@@ -9357,7 +8801,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   su2double ProjVelocity_i;
   su2double **P_Tensor, **invP_Tensor, *Lambda_i, **Jacobian_b, **DubDu, *dw, *u_e, *u_i, *u_b;
   su2double *gridVel;
-  su2double *V_boundary, *V_domain, *S_boundary, *S_domain;
+  su2double *V_boundary, *V_domain, *S_boundary, *S_domain, *Vertex_Normal;
   
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool grid_movement        = config->GetGrid_Movement();
@@ -9368,10 +8812,12 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
                     (config->GetKind_Turb_Model() == SST));
   
   su2double *Normal, *FlowDirMix, TangVelocity, NormalVelocity;
-  Normal = new su2double[nDim];
+  Normal = BC_Normal;
 
-  Velocity_i = new su2double[nDim];
-  Velocity_b = new su2double[nDim];
+  Velocity_i = BC_Velocity_i;
+  Velocity_b = BC_Velocity_b;
+  Jacobian_b = BC_Jacobian_b;
+  DubDu = BC_DubDu;
   Velocity_e = new su2double[nDim];
   FlowDirMix = new su2double[nDim];
   Lambda_i = new su2double[nVar];
@@ -9390,22 +8836,25 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
     invP_Tensor[iVar] = new su2double[nVar];
   }
   
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
+  
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     
     V_boundary= GetCharacPrimVar(val_marker, iVertex);
     
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     if (geometry->node[iPoint]->GetDomain()) {
       
       /*--- Index of the closest interior node ---*/
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->GetVertex_Neighbor(val_marker, iVertex);
       
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+      Vertex_Normal = geometry->GetVertex_Normal(val_marker, iVertex);
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Vertex_Normal[iDim];
       conv_numerics->SetNormal(Normal);
       
       Area = 0.0;
@@ -9671,14 +9120,6 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
       
       if (implicit) {
         
-        Jacobian_b = new su2double*[nVar];
-        DubDu = new su2double*[nVar];
-        for (iVar = 0; iVar < nVar; iVar++)
-        {
-          Jacobian_b[iVar] = new su2double[nVar];
-          DubDu[iVar] = new su2double[nVar];
-        }
-        
         /*--- Initialize DubDu to unit matrix---*/
         
         for (iVar = 0; iVar < nVar; iVar++)
@@ -9732,13 +9173,6 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
             }
           }
         }
-        
-        for (iVar = 0; iVar < nVar; iVar++) {
-          delete [] Jacobian_b[iVar];
-          delete [] DubDu[iVar];
-        }
-        delete [] Jacobian_b;
-        delete [] DubDu;
       }
       
       /*--- Update residual value ---*/
@@ -9829,10 +9263,7 @@ void CEulerSolver::BC_Riemann(CGeometry *geometry, CSolver **solver_container,
   }
   
   /*--- Free locally allocated memory ---*/
-  delete [] Normal;
   delete [] Velocity_e;
-  delete [] Velocity_b;
-  delete [] Velocity_i;
   delete [] FlowDirMix;
   
   delete [] S_boundary;
@@ -10480,12 +9911,12 @@ void CEulerSolver::PreprocessBC_Giles(CGeometry *geometry, CConfig *config, CNum
       cktemp_out2 = complex<su2double>(0.0,0.0);
 
 
-      SU2_MPI::Allreduce(&MyRe_inf, &Re_inf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_inf, &Im_inf, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyRe_out1, &Re_out1, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_out1, &Im_out1, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyRe_out2, &Re_out2, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-      SU2_MPI::Allreduce(&MyIm_out2, &Im_out2, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyRe_inf, &Re_inf, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyIm_inf, &Im_inf, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyRe_out1, &Re_out1, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyIm_out1, &Im_out1, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyRe_out2, &Re_out2, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&MyIm_out2, &Im_out2, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
       cktemp_inf = complex<su2double>(Re_inf,Im_inf);
       cktemp_out1 = complex<su2double>(Re_out1,Im_out1);
@@ -11265,12 +10696,12 @@ void CEulerSolver::BC_Giles(CGeometry *geometry, CSolver **solver_container,
 
 void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
                             CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
-  unsigned short iDim;
-  unsigned long iVertex, iPoint;
+  unsigned short iDim, nBatch = 0;
+  unsigned long iVertex, iPoint, Batch_Point[SIMD_WIDTH];
   su2double P_Total, T_Total, Velocity[3], Velocity2, H_Total, Temperature, Riemann,
   Pressure, Density, Energy, *Flow_Dir, Mach2, SoundSpeed2, SoundSpeed_Total2, Vel_Mag,
   alpha, aa, bb, cc, dd, Area, UnitNormal[3];
-  su2double *V_inlet, *V_domain;
+  su2double *V_inlet, *V_domain, *Vertex_Normal;
   
   bool implicit             = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   bool grid_movement        = config->GetGrid_Movement();
@@ -11280,7 +10711,14 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
   string Marker_Tag         = config->GetMarker_All_TagBound(val_marker);
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
-  su2double *Normal = new su2double[nDim];
+  bool ideal_gas            = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS);
+  bool batch_flux           = (config->GetBatch_Flux() && ideal_gas && !grid_movement &&
+                               (config->GetKind_Upwind() != TURKEL) && (config->GetKind_RoeLowDiss() == NO_ROELOWDISS));
+  su2double *Normal = BC_Normal;
+  
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
     
   /*--- Loop over all the vertices on this boundary marker ---*/
   
@@ -11290,7 +10728,7 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
     
     V_inlet = GetCharacPrimVar(val_marker, iVertex);
     
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     
@@ -11298,8 +10736,8 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
       
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
       
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+      Vertex_Normal = geometry->GetVertex_Normal(val_marker, iVertex);
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Vertex_Normal[iDim];
       conv_numerics->SetNormal(Normal);
       
       Area = 0.0;
@@ -11491,30 +10929,44 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
           break;
       }
       
-      /*--- Set various quantities in the solver class ---*/
+      /*--- Batched evaluation, the vertex is queued and the batch is computed
+       when it is full or at the end of the marker ---*/
       
-      conv_numerics->SetPrimitive(V_domain, V_inlet);
+      if (batch_flux) {
+        conv_numerics->SetBatch_Edge(nBatch, V_domain, V_inlet, Normal);
+        Batch_Point[nBatch++] = iPoint;
+        if (nBatch == SIMD_WIDTH) {
+          Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
+          nBatch = 0;
+        }
+      }
+      else {
+        
+        /*--- Set various quantities in the solver class ---*/
       
-      if (grid_movement)
-        conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[iPoint]->GetGridVel());
+        conv_numerics->SetPrimitive(V_domain, V_inlet);
       
-      /*--- Compute the residual using an upwind scheme ---*/
+        if (grid_movement)
+          conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[iPoint]->GetGridVel());
       
-      conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+        /*--- Compute the residual using an upwind scheme ---*/
       
-      /*--- Update residual value ---*/
+        conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
       
-      LinSysRes.AddBlock(iPoint, Residual);
+        /*--- Update residual value ---*/
       
-      /*--- Jacobian contribution for implicit integration ---*/
+        LinSysRes.AddBlock(iPoint, Residual);
       
-      if (implicit)
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        /*--- Jacobian contribution for implicit integration ---*/
       
-      /*--- Roe Turkel preconditioning, set the value of beta ---*/
+        if (implicit)
+          Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
       
-      if (config->GetKind_Upwind() == TURKEL)
-        node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
+        /*--- Roe Turkel preconditioning, set the value of beta ---*/
+      
+        if (config->GetKind_Upwind() == TURKEL)
+          node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
+      }
       
 //      /*--- Viscous contribution, commented out because serious convergence problems ---*/
 //
@@ -11559,20 +11011,20 @@ void CEulerSolver::BC_Inlet(CGeometry *geometry, CSolver **solver_container,
     }
   }
   
-  /*--- Free locally allocated memory ---*/
+  /*--- Last, incomplete, batch of the marker ---*/
   
-  delete [] Normal;
+  if (nBatch > 0) Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
   
 }
 
 void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
                              CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
-  unsigned short iVar, iDim;
-  unsigned long iVertex, iPoint;
+  unsigned short iVar, iDim, nBatch = 0;
+  unsigned long iVertex, iPoint, Batch_Point[SIMD_WIDTH];
   su2double Pressure, P_Exit, Velocity[3],
   Velocity2, Entropy, Density, Energy, Riemann, Vn, SoundSpeed, Mach_Exit, Vn_Exit,
   Area, UnitNormal[3];
-  su2double *V_outlet, *V_domain;
+  su2double *V_outlet, *V_domain, *Vertex_Normal;
   
   bool implicit           = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   su2double Gas_Constant     = config->GetGas_ConstantND();
@@ -11581,7 +11033,14 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
   bool gravity = (config->GetGravityForce());
   bool tkeNeeded = (((config->GetKind_Solver() == RANS )|| (config->GetKind_Solver() == DISC_ADJ_RANS)) &&
                     (config->GetKind_Turb_Model() == SST));
-  su2double *Normal = new su2double[nDim];
+  bool ideal_gas            = (config->GetKind_FluidModel() == STANDARD_AIR || config->GetKind_FluidModel() == IDEAL_GAS);
+  bool batch_flux           = (config->GetBatch_Flux() && ideal_gas && !grid_movement &&
+                               (config->GetKind_Upwind() != TURKEL) && (config->GetKind_RoeLowDiss() == NO_ROELOWDISS));
+  su2double *Normal = BC_Normal;
+  
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
   
   /*--- Loop over all the vertices on this boundary marker ---*/
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
@@ -11589,14 +11048,14 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
     /*--- Allocate the value at the outlet ---*/
     V_outlet = GetCharacPrimVar(val_marker, iVertex);
     
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     /*--- Check if the node belongs to the domain (i.e., not a halo node) ---*/
     if (geometry->node[iPoint]->GetDomain()) {
       
       /*--- Normal vector for this vertex (negate for outward convention) ---*/
-      geometry->vertex[val_marker][iVertex]->GetNormal(Normal);
-      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Normal[iDim];
+      Vertex_Normal = geometry->GetVertex_Normal(val_marker, iVertex);
+      for (iDim = 0; iDim < nDim; iDim++) Normal[iDim] = -Vertex_Normal[iDim];
       conv_numerics->SetNormal(Normal);
       
       Area = 0.0;
@@ -11675,26 +11134,40 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
 
       }
       
-      /*--- Set various quantities in the solver class ---*/
-      conv_numerics->SetPrimitive(V_domain, V_outlet);
+      /*--- Batched evaluation, the vertex is queued and the batch is computed
+       when it is full or at the end of the marker ---*/
       
-      if (grid_movement)
-        conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[iPoint]->GetGridVel());
+      if (batch_flux) {
+        conv_numerics->SetBatch_Edge(nBatch, V_domain, V_outlet, Normal);
+        Batch_Point[nBatch++] = iPoint;
+        if (nBatch == SIMD_WIDTH) {
+          Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
+          nBatch = 0;
+        }
+      }
+      else {
+        
+        /*--- Set various quantities in the solver class ---*/
+        conv_numerics->SetPrimitive(V_domain, V_outlet);
       
-      /*--- Compute the residual using an upwind scheme ---*/
-      conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+        if (grid_movement)
+          conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[iPoint]->GetGridVel());
       
-      /*--- Update residual value ---*/
-      LinSysRes.AddBlock(iPoint, Residual);
+        /*--- Compute the residual using an upwind scheme ---*/
+        conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
       
-      /*--- Jacobian contribution for implicit integration ---*/
-      if (implicit) {
-        Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-      }
+        /*--- Update residual value ---*/
+        LinSysRes.AddBlock(iPoint, Residual);
       
-      /*--- Roe Turkel preconditioning, set the value of beta ---*/
-      if (config->GetKind_Upwind() == TURKEL)
-        node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
+        /*--- Jacobian contribution for implicit integration ---*/
+        if (implicit) {
+          Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
+        }
+      
+        /*--- Roe Turkel preconditioning, set the value of beta ---*/
+        if (config->GetKind_Upwind() == TURKEL)
+          node[iPoint]->SetPreconditioner_Beta(conv_numerics->GetPrecond_Beta());
+      }
       
 //      /*--- Viscous contribution, commented out because serious convergence problems  ---*/
 //
@@ -11738,8 +11211,8 @@ void CEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container,
     }
   }
   
-  /*--- Free locally allocated memory ---*/
-  delete [] Normal;
+  /*--- Last, incomplete, batch of the marker ---*/
+  if (nBatch > 0) Batch_Boundary_Residual(conv_numerics, config, nBatch, Batch_Point);
   
 }
 
@@ -13680,6 +13153,10 @@ void CEulerSolver::LoadRestart(CGeometry **geometry, CSolver ***solver, CConfig
 
   delete [] Coord;
 
+  /*--- Restore the running time averages of the flow statistics. ---*/
+
+  Load_TimeAverage_Restart(geometry[MESH_0], config);
+
   /*--- Delete the class memory that is used to load the restart. ---*/
 
   if (Restart_Vars != NULL) delete [] Restart_Vars;
@@ -13833,8 +13310,8 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
     MyTotalAreaDensity   = TotalAreaDensity;          TotalAreaDensity     = 0;
     MyTotalAreaPressure  = TotalAreaPressure;         TotalAreaPressure    = 0;
 
-    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
 
     MyTotalAreaVelocity    = new su2double[nDim];
@@ -13845,7 +13322,7 @@ void CEulerSolver::PreprocessAverage(CSolver **solver, CGeometry *geometry, CCon
       TotalAreaVelocity[iDim]      = 0.0;
     }
 
-    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
     delete [] MyTotalAreaVelocity;
 
@@ -13965,11 +13442,10 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
   avgMixTurboVelocity = new su2double[nDim];
 
 
-#ifdef HAVE_MPI
-  su2double MyTotalDensity, MyTotalPressure, MyTotalAreaDensity, MyTotalAreaPressure, MyTotalMassPressure, MyTotalMassDensity, *MyTotalFluxes = NULL;
-  su2double *MyTotalVelocity = NULL, *MyTotalAreaVelocity = NULL, *MyTotalMassVelocity = NULL;
-  su2double MyTotalNu, MyTotalKine, MyTotalOmega, MyTotalAreaNu, MyTotalAreaKine, MyTotalAreaOmega, MyTotalMassNu, MyTotalMassKine, MyTotalMassOmega;
-#endif
+  /*--- The integral quantities of all the spans are packed in one buffer, such that a single
+        reduction is needed. Per span: 15 scalars, the fluxes and the three velocity sums. ---*/
+  const unsigned short nTotal = 15 + nVar + 3*nDim;
+  vector<su2double> SpanTotals((nSpanWiseSections+1)*nTotal, 0.0);
 
 
   for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
@@ -14166,75 +13642,47 @@ void CEulerSolver::TurboAverageProcess(CSolver **solver, CGeometry *geometry, CC
       }
     }
 
+    /*--- Pack the local sums of this span ---*/
+    su2double *Totals = &SpanTotals[iSpan*nTotal];
+    Totals[0]  = TotalDensity;      Totals[1]  = TotalPressure;
+    Totals[2]  = TotalAreaDensity;  Totals[3]  = TotalAreaPressure;
+    Totals[4]  = TotalMassDensity;  Totals[5]  = TotalMassPressure;
+    Totals[6]  = TotalNu;           Totals[7]  = TotalKine;         Totals[8]  = TotalOmega;
+    Totals[9]  = TotalAreaNu;       Totals[10] = TotalAreaKine;     Totals[11] = TotalAreaOmega;
+    Totals[12] = TotalMassNu;       Totals[13] = TotalMassKine;     Totals[14] = TotalMassOmega;
+    for (iVar = 0; iVar < nVar; iVar++) Totals[15+iVar] = TotalFluxes[iVar];
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Totals[15+nVar+iDim]        = TotalVelocity[iDim];
+      Totals[15+nVar+nDim+iDim]   = TotalAreaVelocity[iDim];
+      Totals[15+nVar+2*nDim+iDim] = TotalMassVelocity[iDim];
+    }
+  }
+
 #ifdef HAVE_MPI
 
-    /*--- Add information using all the nodes ---*/
+  /*--- Add information using all the nodes, for all the spans at once ---*/
+  vector<su2double> MySpanTotals(SpanTotals);
+  SU2_MPI::Allreduce(MySpanTotals.data(), SpanTotals.data(), SpanTotals.size(), MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
-    MyTotalDensity       = TotalDensity;              TotalDensity         = 0;
-    MyTotalPressure      = TotalPressure;             TotalPressure        = 0;
-    MyTotalAreaDensity   = TotalAreaDensity;          TotalAreaDensity     = 0;
-    MyTotalAreaPressure  = TotalAreaPressure;         TotalAreaPressure    = 0;
-    MyTotalMassDensity   = TotalMassDensity;          TotalMassDensity     = 0;
-    MyTotalMassPressure  = TotalMassPressure;         TotalMassPressure    = 0;
-    MyTotalNu            = TotalNu;                   TotalNu              = 0;
-    MyTotalKine          = TotalKine;                 TotalKine            = 0;
-    MyTotalOmega         = TotalOmega;                TotalOmega           = 0;
-    MyTotalAreaNu        = TotalAreaNu;               TotalAreaNu          = 0;
-    MyTotalAreaKine      = TotalAreaKine;             TotalAreaKine        = 0;
-    MyTotalAreaOmega     = TotalAreaOmega;            TotalAreaOmega       = 0;
-    MyTotalMassNu        = TotalMassNu;               TotalMassNu          = 0;
-    MyTotalMassKine      = TotalMassKine;             TotalMassKine        = 0;
-    MyTotalMassOmega     = TotalMassOmega;            TotalMassOmega       = 0;
-
-
-
-
-    SU2_MPI::Allreduce(&MyTotalDensity, &TotalDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalPressure, &TotalPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaDensity, &TotalAreaDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaPressure, &TotalAreaPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassDensity, &TotalMassDensity, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassPressure, &TotalMassPressure, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalNu, &TotalNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalKine, &TotalKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalOmega, &TotalOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaNu, &TotalAreaNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaKine, &TotalAreaKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalAreaOmega, &TotalAreaOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassNu, &TotalMassNu, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassKine, &TotalMassKine, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyTotalMassOmega, &TotalMassOmega, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-
-    MyTotalFluxes          = new su2double[nVar];
-    MyTotalVelocity        = new su2double[nDim];
-    MyTotalAreaVelocity    = new su2double[nDim];
-    MyTotalMassVelocity    = new su2double[nDim];
+#endif
 
-    for (iVar = 0; iVar < nVar; iVar++) {
-      MyTotalFluxes[iVar]  = TotalFluxes[iVar];
-      TotalFluxes[iVar]    = 0.0;
-    }
+  for (iSpan= 0; iSpan < nSpanWiseSections + 1; iSpan++){
 
+    /*--- Unpack the global sums of this span ---*/
+    const su2double *Totals = &SpanTotals[iSpan*nTotal];
+    TotalDensity      = Totals[0];   TotalPressure     = Totals[1];
+    TotalAreaDensity  = Totals[2];   TotalAreaPressure = Totals[3];
+    TotalMassDensity  = Totals[4];   TotalMassPressure = Totals[5];
+    TotalNu           = Totals[6];   TotalKine         = Totals[7];   TotalOmega     = Totals[8];
+    TotalAreaNu       = Totals[9];   TotalAreaKine     = Totals[10];  TotalAreaOmega = Totals[11];
+    TotalMassNu       = Totals[12];  TotalMassKine     = Totals[13];  TotalMassOmega = Totals[14];
+    for (iVar = 0; iVar < nVar; iVar++) TotalFluxes[iVar] = Totals[15+iVar];
     for (iDim = 0; iDim < nDim; iDim++) {
-      MyTotalVelocity[iDim]        = TotalVelocity[iDim];
-      TotalVelocity[iDim]          = 0.0;
-      MyTotalAreaVelocity[iDim]    = TotalAreaVelocity[iDim];
-      TotalAreaVelocity[iDim]      = 0.0;
-      MyTotalMassVelocity[iDim]    = TotalMassVelocity[iDim];
-      TotalMassVelocity[iDim]      = 0.0;
+      TotalVelocity[iDim]     = Totals[15+nVar+iDim];
+      TotalAreaVelocity[iDim] = Totals[15+nVar+nDim+iDim];
+      TotalMassVelocity[iDim] = Totals[15+nVar+2*nDim+iDim];
     }
 
-    SU2_MPI::Allreduce(MyTotalFluxes, TotalFluxes, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalVelocity, TotalVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalAreaVelocity, TotalAreaVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(MyTotalMassVelocity, TotalMassVelocity, nDim, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-
-    delete [] MyTotalFluxes; delete [] MyTotalVelocity; delete [] MyTotalAreaVelocity; delete [] MyTotalMassVelocity;
-
-
-#endif
-
 
     for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
       for (iMarkerTP=1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
@@ -14613,202 +14061,117 @@ void CEulerSolver::GatherInOutAverageValues(CConfig *config, CGeometry *geometry
   unsigned short iMarker, iMarkerTP;
   unsigned short iSpan;
   int markerTP;
-  su2double     densityIn, pressureIn, normalVelocityIn, tangVelocityIn, radialVelocityIn;
-  su2double     densityOut, pressureOut, normalVelocityOut, tangVelocityOut, radialVelocityOut;
-  su2double     kineIn, omegaIn, nuIn, kineOut, omegaOut, nuOut;
+  su2double *PerfIn, *PerfOut;
   //TODO (turbo) implement interpolation so that Inflow and Outflow spanwise section can be different
 
-  for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
-    
-#ifdef HAVE_MPI
-    unsigned short i, n1, n2, n1t,n2t;
-    su2double *TurbPerfIn= NULL,*TurbPerfOut= NULL;
-    su2double *TotTurbPerfIn = NULL,*TotTurbPerfOut = NULL;
-    int *TotMarkerTP = NULL;
-
-    n1          = 8;
-    n2          = 8;
-    n1t         = n1*size;
-    n2t         = n2*size;
-    TurbPerfIn  = new su2double[n1];
-    TurbPerfOut = new su2double[n2];
-
-    for (i=0;i<n1;i++)
-      TurbPerfIn[i]    = -1.0;
-    for (i=0;i<n2;i++)
-      TurbPerfOut[i]   = -1.0;
-#endif
-
-
-    densityIn            = -1.0;
-    pressureIn           = -1.0;
-    normalVelocityIn     = -1.0;
-    tangVelocityIn       = -1.0;
-    radialVelocityIn     = -1.0;
-    densityOut           = -1.0;
-    pressureOut          = -1.0;
-    normalVelocityOut    = -1.0;
-    tangVelocityOut      = -1.0;
-    radialVelocityOut    = -1.0;
-    kineIn               = -1.0;
-    omegaIn              = -1.0;
-    nuIn                 = -1.0;
-    kineOut              = -1.0;
-    omegaOut             = -1.0;
-    nuOut                = -1.0;
+  /*--- Turbo performance values of every span: density, pressure, normal, tangential and radial
+        velocity, kine, omega and nu of the inflow, followed by the same values of the outflow.
+        The spans are packed in one buffer, such that the data of all the spans is gathered at once. ---*/
+  const unsigned short nPerf = 8;
+  const unsigned long nPerfSpan = 2*nPerf;
+  const unsigned long nPerfTot  = (nSpanWiseSections+1)*nPerfSpan;
 
+  vector<su2double> TurbPerf(nPerfTot, -1.0);
+  markerTP = -1;
 
-    markerTP             = -1;
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
+    for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
+      if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
 
-    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++){
-      for (iMarkerTP = 1; iMarkerTP < config->GetnMarker_Turbomachinery()+1; iMarkerTP++){
-        if (config->GetMarker_All_Turbomachinery(iMarker) == iMarkerTP){
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
-            markerTP            = iMarkerTP;
-            densityIn           = DensityIn[iMarkerTP -1][iSpan];
-            pressureIn          = PressureIn[iMarkerTP -1][iSpan];
-            normalVelocityIn    = TurboVelocityIn[iMarkerTP -1][iSpan][0];
-            tangVelocityIn      = TurboVelocityIn[iMarkerTP -1][iSpan][1];
+        /*--- retrieve inlet information ---*/
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == INFLOW){
+          markerTP = iMarkerTP;
+          for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+            PerfIn    = &TurbPerf[iSpan*nPerfSpan];
+            PerfIn[0] = DensityIn[iMarkerTP -1][iSpan];
+            PerfIn[1] = PressureIn[iMarkerTP -1][iSpan];
+            PerfIn[2] = TurboVelocityIn[iMarkerTP -1][iSpan][0];
+            PerfIn[3] = TurboVelocityIn[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityIn  = TurboVelocityIn[iMarkerTP -1][iSpan][2];
+              PerfIn[4] = TurboVelocityIn[iMarkerTP -1][iSpan][2];
             }
-            kineIn              = KineIn[iMarkerTP -1][iSpan];
-            omegaIn             = OmegaIn[iMarkerTP -1][iSpan];
-            nuIn                = NuIn[iMarkerTP -1][iSpan];
-
-
-#ifdef HAVE_MPI
-            TurbPerfIn[0]  = densityIn;
-            TurbPerfIn[1]  = pressureIn;
-            TurbPerfIn[2]  = normalVelocityIn;
-            TurbPerfIn[3]  = tangVelocityIn;
-            TurbPerfIn[4]  = radialVelocityIn;
-            TurbPerfIn[5]  = kineIn;
-            TurbPerfIn[6]  = omegaIn;
-            TurbPerfIn[7]  = nuIn;
-#endif
+            PerfIn[5] = KineIn[iMarkerTP -1][iSpan];
+            PerfIn[6] = OmegaIn[iMarkerTP -1][iSpan];
+            PerfIn[7] = NuIn[iMarkerTP -1][iSpan];
           }
+        }
 
-          /*--- retrieve outlet information ---*/
-          if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
-            densityOut           = DensityOut[iMarkerTP -1][iSpan];
-            pressureOut          = PressureOut[iMarkerTP -1][iSpan];
-            normalVelocityOut    = TurboVelocityOut[iMarkerTP -1][iSpan][0];
-            tangVelocityOut      = TurboVelocityOut[iMarkerTP -1][iSpan][1];
+        /*--- retrieve outlet information ---*/
+        if (config->GetMarker_All_TurbomachineryFlag(iMarker) == OUTFLOW){
+          for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+            PerfOut    = &TurbPerf[iSpan*nPerfSpan + nPerf];
+            PerfOut[0] = DensityOut[iMarkerTP -1][iSpan];
+            PerfOut[1] = PressureOut[iMarkerTP -1][iSpan];
+            PerfOut[2] = TurboVelocityOut[iMarkerTP -1][iSpan][0];
+            PerfOut[3] = TurboVelocityOut[iMarkerTP -1][iSpan][1];
             if (nDim ==3){
-              radialVelocityOut  = TurboVelocityOut[iMarkerTP -1][iSpan][2];
+              PerfOut[4] = TurboVelocityOut[iMarkerTP -1][iSpan][2];
             }
-            kineOut              = KineOut[iMarkerTP -1][iSpan];
-            omegaOut             = OmegaOut[iMarkerTP -1][iSpan];
-            nuOut                = NuOut[iMarkerTP -1][iSpan];
-
-
-
-#ifdef HAVE_MPI
-            TurbPerfOut[0]  = densityOut;
-            TurbPerfOut[1]  = pressureOut;
-            TurbPerfOut[2]  = normalVelocityOut;
-            TurbPerfOut[3]  = tangVelocityOut;
-            TurbPerfOut[4]  = radialVelocityOut;
-            TurbPerfOut[5]  = kineOut;
-            TurbPerfOut[6]  = omegaOut;
-            TurbPerfOut[7]  = nuOut;
-#endif
+            PerfOut[5] = KineOut[iMarkerTP -1][iSpan];
+            PerfOut[6] = OmegaOut[iMarkerTP -1][iSpan];
+            PerfOut[7] = NuOut[iMarkerTP -1][iSpan];
           }
         }
       }
     }
+  }
 
 #ifdef HAVE_MPI
-    if (rank == MASTER_NODE){
-      TotTurbPerfIn       = new su2double[n1t];
-      TotTurbPerfOut      = new su2double[n2t];
-      for (i=0;i<n1t;i++)
-        TotTurbPerfIn[i]  = -1.0;
-      for (i=0;i<n2t;i++)
-        TotTurbPerfOut[i] = -1.0;
-      TotMarkerTP = new int[size];
-      for(i=0; i<size; i++){
-        TotMarkerTP[i]    = -1;
-      }
-    }
-    SU2_MPI::Gather(TurbPerfIn, n1, MPI_DOUBLE, TotTurbPerfIn, n1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(TurbPerfOut, n2, MPI_DOUBLE,TotTurbPerfOut, n2, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(&markerTP, 1, MPI_INT,TotMarkerTP, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
-    if (rank == MASTER_NODE){
-      delete [] TurbPerfIn, delete [] TurbPerfOut;
-    }
-
-    if (rank == MASTER_NODE){
-      for (i=0;i<size;i++){
-        if(TotTurbPerfIn[n1*i] > 0.0){
-          densityIn        = 0.0;
-          densityIn        = TotTurbPerfIn[n1*i];
-          pressureIn       = 0.0;
-          pressureIn       = TotTurbPerfIn[n1*i+1];
-          normalVelocityIn = 0.0;
-          normalVelocityIn = TotTurbPerfIn[n1*i+2];
-          tangVelocityIn   = 0.0;
-          tangVelocityIn   = TotTurbPerfIn[n1*i+3];
-          radialVelocityIn = 0.0;
-          radialVelocityIn = TotTurbPerfIn[n1*i+4];
-          kineIn           = 0.0;
-          kineIn           = TotTurbPerfIn[n1*i+5];
-          omegaIn          = 0.0;
-          omegaIn          = TotTurbPerfIn[n1*i+6];
-          nuIn             = 0.0;
-          nuIn             = TotTurbPerfIn[n1*i+7];
-
-          markerTP         = -1;
-          markerTP         = TotMarkerTP[i];
+  int iRank;
+  unsigned short i;
+  vector<su2double> TotTurbPerf;
+  vector<int> TotMarkerTP;
+
+  if (rank == MASTER_NODE){
+    TotTurbPerf.assign(nPerfTot*size, -1.0);
+    TotMarkerTP.assign(size, -1);
+  }
+  SU2_MPI::Gather(TurbPerf.data(), nPerfTot, MPI_SU2DOUBLE, TotTurbPerf.data(), nPerfTot, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+  SU2_MPI::Gather(&markerTP, 1, MPI_INT, TotMarkerTP.data(), 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- The master takes the values of the ranks that hold the inflow and outflow markers ---*/
+  if (rank == MASTER_NODE){
+    for (iRank = 0; iRank < size; iRank++){
+      for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+        const su2double *RankPerf = &TotTurbPerf[iRank*nPerfTot + iSpan*nPerfSpan];
+        if (RankPerf[0] > 0.0){
+          for (i = 0; i < nPerf; i++) TurbPerf[iSpan*nPerfSpan+i] = RankPerf[i];
+          markerTP = TotMarkerTP[iRank];
         }
-
-        if(TotTurbPerfOut[n2*i] > 0.0){
-          densityOut        = 0.0;
-          densityOut        = TotTurbPerfOut[n1*i];
-          pressureOut       = 0.0;
-          pressureOut       = TotTurbPerfOut[n1*i+1];
-          normalVelocityOut = 0.0;
-          normalVelocityOut = TotTurbPerfOut[n1*i+2];
-          tangVelocityOut   = 0.0;
-          tangVelocityOut   = TotTurbPerfOut[n1*i+3];
-          radialVelocityOut = 0.0;
-          radialVelocityOut = TotTurbPerfOut[n1*i+4];
-          kineOut           = 0.0;
-          kineOut           = TotTurbPerfOut[n1*i+5];
-          omegaOut          = 0.0;
-          omegaOut          = TotTurbPerfOut[n1*i+6];
-          nuOut             = 0.0;
-          nuOut             = TotTurbPerfOut[n1*i+7];
+        if (RankPerf[nPerf] > 0.0){
+          for (i = 0; i < nPerf; i++) TurbPerf[iSpan*nPerfSpan+nPerf+i] = RankPerf[nPerf+i];
         }
       }
-
-      delete [] TotTurbPerfIn, delete [] TotTurbPerfOut; delete [] TotMarkerTP;
     }
+  }
 
 #endif
 
-    if (rank == MASTER_NODE && markerTP > -1){
+  if (rank == MASTER_NODE && markerTP > -1){
+    for (iSpan= 0; iSpan < nSpanWiseSections + 1 ; iSpan++) {
+      PerfIn  = &TurbPerf[iSpan*nPerfSpan];
+      PerfOut = &TurbPerf[iSpan*nPerfSpan + nPerf];
+
       /*----Quantities needed for computing the turbomachinery performance -----*/
-      DensityIn[markerTP -1][iSpan]              = densityIn;
-      PressureIn[markerTP -1][iSpan]             = pressureIn;
-      TurboVelocityIn[markerTP -1][iSpan][0]     = normalVelocityIn;
-      TurboVelocityIn[markerTP -1][iSpan][1]     = tangVelocityIn;
+      DensityIn[markerTP -1][iSpan]              = PerfIn[0];
+      PressureIn[markerTP -1][iSpan]             = PerfIn[1];
+      TurboVelocityIn[markerTP -1][iSpan][0]     = PerfIn[2];
+      TurboVelocityIn[markerTP -1][iSpan][1]     = PerfIn[3];
       if (nDim == 3)
-        TurboVelocityIn[markerTP -1][iSpan][2]   = radialVelocityIn;
-      KineIn[markerTP -1][iSpan]                 = kineIn;
-      OmegaIn[markerTP -1][iSpan]                = omegaIn;
-      NuIn[markerTP -1][iSpan]                   = nuIn;
-
-      DensityOut[markerTP -1][iSpan]             = densityOut;
-      PressureOut[markerTP -1][iSpan]            = pressureOut;
-      TurboVelocityOut[markerTP -1][iSpan][0]    = normalVelocityOut;
-      TurboVelocityOut[markerTP -1][iSpan][1]    = tangVelocityOut;
+        TurboVelocityIn[markerTP -1][iSpan][2]   = PerfIn[4];
+      KineIn[markerTP -1][iSpan]                 = PerfIn[5];
+      OmegaIn[markerTP -1][iSpan]                = PerfIn[6];
+      NuIn[markerTP -1][iSpan]                   = PerfIn[7];
+
+      DensityOut[markerTP -1][iSpan]             = PerfOut[0];
+      PressureOut[markerTP -1][iSpan]            = PerfOut[1];
+      TurboVelocityOut[markerTP -1][iSpan][0]    = PerfOut[2];
+      TurboVelocityOut[markerTP -1][iSpan][1]    = PerfOut[3];
       if (nDim == 3)
-        TurboVelocityOut[markerTP -1][iSpan][2]  = radialVelocityOut;
-      KineOut[markerTP -1][iSpan]                = kineOut;
-      OmegaOut[markerTP -1][iSpan]               = omegaOut;
-      NuOut[markerTP -1][iSpan]                  = nuOut;
+        TurboVelocityOut[markerTP -1][iSpan][2]  = PerfOut[4];
+      KineOut[markerTP -1][iSpan]                = PerfOut[5];
+      OmegaOut[markerTP -1][iSpan]               = PerfOut[6];
+      NuOut[markerTP -1][iSpan]                  = PerfOut[7];
     }
   }
 }
@@ -15009,7 +14372,7 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   /*--- Define some auxiliar vector related with the residual ---*/
   
   Residual      = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]      = 0.0;
-  Residual_RMS  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+  Residual_RMS  = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
   Residual_Max  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
   Residual_i    = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]    = 0.0;
   Residual_j    = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]    = 0.0;
@@ -15049,6 +14412,18 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
   Secondary   = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary[iVar]   = 0.0;
   Secondary_i = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_i[iVar] = 0.0;
   Secondary_j = new su2double[nSecondaryVar]; for (iVar = 0; iVar < nSecondaryVar; iVar++) Secondary_j[iVar] = 0.0;
+  
+  /*--- Define some auxiliary vectors of the boundary conditions ---*/
+  
+  BC_Normal     = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Normal[iDim]     = 0.0;
+  BC_Velocity_i = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Velocity_i[iDim] = 0.0;
+  BC_Velocity_b = new su2double[nDim]; for (iDim = 0; iDim < nDim; iDim++) BC_Velocity_b[iDim] = 0.0;
+  BC_Jacobian_b = new su2double*[nVar];
+  BC_DubDu      = new su2double*[nVar];
+  for (iVar = 0; iVar < nVar; iVar++) {
+    BC_Jacobian_b[iVar] = new su2double[nVar];
+    BC_DubDu[iVar]      = new su2double[nVar];
+  }
 
   /*--- Define some auxiliar vector related with the undivided lapalacian computation ---*/
   
@@ -15084,7 +14459,7 @@ CNSSolver::CNSSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh)
     }
     
     if (rank == MASTER_NODE) cout << "Initialize Jacobian structure (Navier-Stokes). MG level: " << iMesh <<"." << endl;
-    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config);
+    Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, true, geometry, config, config->GetJacobian_Edge_Format());
     
     if ((config->GetKind_Linear_Solver_Prec() == LINELET) ||
         (config->GetKind_Linear_Solver() == SMOOTHER_LINELET)) {
@@ -15682,6 +15057,9 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   unsigned long iPoint, ErrorCounter = 0;
   su2double StrainMag = 0.0, Omega = 0.0, *Vorticity;
     
+  double tick = 0.0;
+  config->Tick(&tick);
+  
   unsigned long ExtIter     = config->GetExtIter();
   bool cont_adjoint         = config->GetContinuous_Adjoint();
   bool disc_adjoint         = config->GetDiscrete_Adjoint();
@@ -15736,8 +15114,7 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   if (center && !Output) {
     SetMax_Eigenvalue(geometry, config);
     if ((center_jst) && (iMesh == MESH_0)) {
-      SetCentered_Dissipation_Sensor(geometry, config);
-      SetUndivided_Laplacian(geometry, config);
+      SetUndivided_Laplacian_Sensor(geometry, config);
     }
   }
   
@@ -15750,20 +15127,30 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     }
   }
   
-  /*--- Compute gradient of the primitive variables ---*/
+  /*--- Compute gradient and limiter of the primitive variables in a single pass ---*/
   
-  if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
-    SetPrimitive_Gradient_GG(geometry, config);
+  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow)
+      && !Output && !van_albada && config->GetFused_Gradient_Limiter()) {
+    SetPrimitive_Gradient_Limiter(geometry, config);
   }
-  if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
-    SetPrimitive_Gradient_LS(geometry, config);
+  else {
+    
+    /*--- Compute gradient of the primitive variables ---*/
+    
+    if (config->GetKind_Gradient_Method() == GREEN_GAUSS) {
+      SetPrimitive_Gradient_GG(geometry, config);
+    }
+    if (config->GetKind_Gradient_Method() == WEIGHTED_LEAST_SQUARES) {
+      SetPrimitive_Gradient_LS(geometry, config);
+    }
+    
+    /*--- Compute the limiter in case we need it in the turbulence model
+     or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
+    
+    if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow)
+        && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
+    
   }
-
-  /*--- Compute the limiter in case we need it in the turbulence model
-   or to limit the viscous terms (check this logic with JST and 2nd order turbulence model) ---*/
-
-  if ((iMesh == MESH_0) && (limiter_flow || limiter_turb || limiter_adjflow)
-      && !Output && !van_albada) { SetPrimitive_Limiter(geometry, config); }
   
   /*--- Evaluate the vorticity and strain rate magnitude ---*/
   
@@ -15787,9 +15174,12 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
   if (wall_functions)
     SetTauWall_WF(geometry, solver_container, config);
 
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, unless the last one is reused (JACOBIAN_LAG) ---*/
   
-  if (implicit && !config->GetDiscrete_Adjoint()) Jacobian.SetValZero();
+  if (implicit && !config->GetDiscrete_Adjoint()) {
+    SetJacobian_Lag(config);
+    Jacobian.SetValZero();
+  }
 
   /*--- Error message ---*/
   
@@ -15801,8 +15191,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     su2double MyStrainMag_Max = StrainMag_Max; StrainMag_Max = 0.0;
     
     SU2_MPI::Allreduce(&MyErrorCounter, &ErrorCounter, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyStrainMag_Max, &StrainMag_Max, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&MyOmega_Max, &Omega_Max, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
     
     if (iMesh == MESH_0) {
@@ -15813,6 +15203,8 @@ void CNSSolver::Preprocessing(CGeometry *geometry, CSolver **solver_container, C
     
   }
   
+  config->Tock(tick, "CNSSolver::Preprocessing", PROFILE_PREPROCESSING);
+  
 }
 
 unsigned long CNSSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
@@ -15998,6 +15390,7 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
       Global_Delta_Time = min(Global_Delta_Time, Local_Delta_Time);
       Min_Delta_Time = min(Min_Delta_Time, Local_Delta_Time);
       Max_Delta_Time = max(Max_Delta_Time, Local_Delta_Time);
+      Local_Delta_Time *= node[iPoint]->GetLocalCFL_Factor();
       if (Local_Delta_Time > config->GetMax_DeltaTime())
         Local_Delta_Time = config->GetMax_DeltaTime();
       node[iPoint]->SetDelta_Time(Local_Delta_Time);
@@ -16014,13 +15407,13 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Min_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Min_Delta_Time = rbuf_time;
     
     sbuf_time = Max_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MAX, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Max_Delta_Time = rbuf_time;
 #endif
   }
@@ -16030,12 +15423,15 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_Time;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_Time = rbuf_time;
 #endif
-    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
-      node[iPoint]->SetDelta_Time(Global_Delta_Time);
+    if ((config->GetnLevels_TimeAccurateLTS() > 1) && (iMesh == MESH_0))
+      SetMultirate_Levels(geometry, config, Global_Delta_Time);
+    else
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        node[iPoint]->SetDelta_Time(Global_Delta_Time);
   }
   
   /*--- Recompute the unsteady time step for the dual time strategy
@@ -16046,8 +15442,8 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 #ifdef HAVE_MPI
     su2double rbuf_time, sbuf_time;
     sbuf_time = Global_Delta_UnstTimeND;
-    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(&rbuf_time, 1, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Reduce(&sbuf_time, &rbuf_time, 1, MPI_SU2DOUBLE, MPI_MIN, MASTER_NODE, MPI_COMM_WORLD);
+    SU2_MPI::Bcast(&rbuf_time, 1, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
     Global_Delta_UnstTimeND = rbuf_time;
 #endif
     config->SetDelta_UnstTimeND(Global_Delta_UnstTimeND);
@@ -16067,56 +15463,72 @@ void CNSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container, CC
 void CNSSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics,
                                  CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
   
-  unsigned long iPoint, jPoint, iEdge;
+  unsigned long iPoint, jPoint, iEdge, iEdgeColor;
+  unsigned short iColor;
+  
+  double tick = 0.0;
+  config->Tick(&tick);
   
   bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    /*--- Points, coordinates and normal vector in edge ---*/
-    
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
-    
-    /*--- Primitive and secondary variables ---*/
-    
-    numerics->SetPrimitive(node[iPoint]->GetPrimitive(), node[jPoint]->GetPrimitive());
-    numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
-    
-    /*--- Gradient and limiters ---*/
-    
-    numerics->SetPrimVarGradient(node[iPoint]->GetGradient_Primitive(), node[jPoint]->GetGradient_Primitive());
-    
-    /*--- Turbulent kinetic energy ---*/
-    
-    if (config->GetKind_Turb_Model() == SST)
-      numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
-                                     solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
-    
-    /*--- Wall shear stress values (wall functions) ---*/
-    
-    numerics->SetTauWall(node[iPoint]->GetTauWall(), node[iPoint]->GetTauWall());
+  /*--- Geometric factors of the edges, computed once for each set of coordinates.
+   The discrete adjoint records them with the coordinates instead. ---*/
+  
+  const bool edge_geometry = !config->GetDiscrete_Adjoint();
+  if (edge_geometry && !geometry->Edge_Geometry_Ready) geometry->PreprocessEdge_Geometry();
+  
+  /*--- Edge loop of this iteration (only the edges of the active points with LOCAL_FREEZING) ---*/
+  
+  for (iColor = 0; iColor < geometry->GetnEdgeColor(); iColor++) {
+    for (iEdgeColor = GetEdgeLoop_Begin(geometry, iColor); iEdgeColor < GetEdgeLoop_End(geometry, iColor); iEdgeColor++) {
+      
+      iEdge = GetEdgeLoop_Edge(geometry, iEdgeColor);
+      
+      /*--- Points, coordinates and normal vector in edge ---*/
+      
+      iPoint = geometry->GetEdge_Node(iEdge, 0);
+      jPoint = geometry->GetEdge_Node(iEdge, 1);
+      numerics->SetCoord(geometry->node[iPoint]->GetCoord(), geometry->node[jPoint]->GetCoord());
+      numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
+      if (edge_geometry) numerics->SetEdge_Geometry(geometry->GetEdge_Geometry(iEdge));
+      
+      /*--- Primitive and secondary variables ---*/
+      
+      numerics->SetPrimitive(GetNode_Primitive(iPoint), GetNode_Primitive(jPoint));
+      numerics->SetSecondary(node[iPoint]->GetSecondary(), node[jPoint]->GetSecondary());
+      
+      /*--- Gradient and limiters ---*/
+      
+      numerics->SetPrimVarGradient(GetNode_Gradient_Primitive(iPoint), GetNode_Gradient_Primitive(jPoint));
+      
+      /*--- Turbulent kinetic energy ---*/
+      
+      if (config->GetKind_Turb_Model() == SST)
+        numerics->SetTurbKineticEnergy(solver_container[TURB_SOL]->node[iPoint]->GetSolution(0),
+                                       solver_container[TURB_SOL]->node[jPoint]->GetSolution(0));
+      
+      /*--- Wall shear stress values (wall functions) ---*/
+      
+      numerics->SetTauWall(node[iPoint]->GetTauWall(), node[iPoint]->GetTauWall());
 
-    /*--- Compute and update residual ---*/
-    
-    numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
-    
-    LinSysRes.SubtractBlock(iPoint, Res_Visc);
-    LinSysRes.AddBlock(jPoint, Res_Visc);
-    
-    /*--- Implicit part ---*/
-    
-    if (implicit) {
-      Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-      Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-      Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-      Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+      /*--- Compute and update residual ---*/
+      
+      numerics->ComputeResidual(Res_Visc, Jacobian_i, Jacobian_j, config);
+      
+      LinSysRes.SubtractBlock(iPoint, Res_Visc);
+      LinSysRes.AddBlock(jPoint, Res_Visc);
+      
+      /*--- Implicit part ---*/
+      
+      if (implicit) {
+        Jacobian.SubtractEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+      }
+      
     }
-    
   }
   
+  config->Tock(tick, "CNSSolver::Viscous_Residual", PROFILE_RESIDUAL);
+  
 }
 
 void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
@@ -16133,9 +15545,6 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   su2double MomentX_Force[3] = {0.0,0.0,0.0}, MomentY_Force[3] = {0.0,0.0,0.0}, MomentZ_Force[3] = {0.0,0.0,0.0};
   su2double AxiFactor;
 
-#ifdef HAVE_MPI
-  su2double MyAllBound_CD_Visc, MyAllBound_CL_Visc, MyAllBound_CSF_Visc, MyAllBound_CMx_Visc, MyAllBound_CMy_Visc, MyAllBound_CMz_Visc, MyAllBound_CoPx_Visc, MyAllBound_CoPy_Visc, MyAllBound_CoPz_Visc, MyAllBound_CFx_Visc, MyAllBound_CFy_Visc, MyAllBound_CFz_Visc, MyAllBound_CT_Visc, MyAllBound_CQ_Visc, MyAllBound_HF_Visc, MyAllBound_MaxHF_Visc, *MySurface_CL_Visc = NULL, *MySurface_CD_Visc = NULL, *MySurface_CSF_Visc = NULL, *MySurface_CEff_Visc = NULL, *MySurface_CFx_Visc = NULL, *MySurface_CFy_Visc = NULL, *MySurface_CFz_Visc = NULL, *MySurface_CMx_Visc = NULL, *MySurface_CMy_Visc = NULL, *MySurface_CMz_Visc = NULL, *MySurface_HF_Visc = NULL, *MySurface_MaxHF_Visc;
-#endif
   
   string Marker_Tag, Monitoring_Tag;
   
@@ -16460,109 +15869,23 @@ void CNSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   
 #ifdef HAVE_MPI
   
-  /*--- Add AllBound information using all the nodes ---*/
-  
-  MyAllBound_CD_Visc        = AllBound_CD_Visc;                      AllBound_CD_Visc = 0.0;
-  MyAllBound_CL_Visc        = AllBound_CL_Visc;                      AllBound_CL_Visc = 0.0;
-  MyAllBound_CSF_Visc   = AllBound_CSF_Visc;                 AllBound_CSF_Visc = 0.0;
-  AllBound_CEff_Visc = 0.0;
-  MyAllBound_CMx_Visc          = AllBound_CMx_Visc;                        AllBound_CMx_Visc = 0.0;
-  MyAllBound_CMy_Visc          = AllBound_CMy_Visc;                        AllBound_CMy_Visc = 0.0;
-  MyAllBound_CMz_Visc          = AllBound_CMz_Visc;                        AllBound_CMz_Visc = 0.0;
-  MyAllBound_CoPx_Visc          = AllBound_CoPx_Visc;                        AllBound_CoPx_Visc = 0.0;
-  MyAllBound_CoPy_Visc          = AllBound_CoPy_Visc;                        AllBound_CoPy_Visc = 0.0;
-  MyAllBound_CoPz_Visc          = AllBound_CoPz_Visc;                        AllBound_CoPz_Visc = 0.0;
-  MyAllBound_CFx_Visc          = AllBound_CFx_Visc;                        AllBound_CFx_Visc = 0.0;
-  MyAllBound_CFy_Visc          = AllBound_CFy_Visc;                        AllBound_CFy_Visc = 0.0;
-  MyAllBound_CFz_Visc          = AllBound_CFz_Visc;                        AllBound_CFz_Visc = 0.0;
-  MyAllBound_CT_Visc           = AllBound_CT_Visc;                         AllBound_CT_Visc = 0.0;
-  MyAllBound_CQ_Visc           = AllBound_CQ_Visc;                         AllBound_CQ_Visc = 0.0;
-  AllBound_CMerit_Visc = 0.0;
-  MyAllBound_HF_Visc     = AllBound_HF_Visc;                   AllBound_HF_Visc = 0.0;
-  MyAllBound_MaxHF_Visc  = pow(AllBound_MaxHF_Visc, MaxNorm);  AllBound_MaxHF_Visc = 0.0;
-  
-  SU2_MPI::Allreduce(&MyAllBound_CD_Visc, &AllBound_CD_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CL_Visc, &AllBound_CL_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CSF_Visc, &AllBound_CSF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  /*--- Add AllBound information and the forces on the surfaces using all
+   the nodes, packed into a single reduction. ---*/
+  
+  su2double *AllBound_Visc[] = {&AllBound_CD_Visc, &AllBound_CL_Visc, &AllBound_CSF_Visc, &AllBound_CMx_Visc, &AllBound_CMy_Visc, &AllBound_CMz_Visc, &AllBound_CFx_Visc, &AllBound_CFy_Visc, &AllBound_CFz_Visc, &AllBound_CoPx_Visc, &AllBound_CoPy_Visc, &AllBound_CoPz_Visc, &AllBound_CT_Visc, &AllBound_CQ_Visc, &AllBound_HF_Visc, &AllBound_MaxHF_Visc};
+  su2double *Surface_Visc[] = {Surface_CL_Visc, Surface_CD_Visc, Surface_CSF_Visc, Surface_CFx_Visc, Surface_CFy_Visc, Surface_CFz_Visc, Surface_CMx_Visc, Surface_CMy_Visc, Surface_CMz_Visc, Surface_HF_Visc, Surface_MaxHF_Visc};
+  
+  AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, MaxNorm);
+  
+  SumCoefficients_AllRanks(sizeof(AllBound_Visc)/sizeof(su2double*), AllBound_Visc,
+                           sizeof(Surface_Visc)/sizeof(su2double*), Surface_Visc,
+                           config->GetnMarker_Monitoring());
+  
   AllBound_CEff_Visc = AllBound_CL_Visc / (AllBound_CD_Visc + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_CMx_Visc, &AllBound_CMx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMy_Visc, &AllBound_CMy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CMz_Visc, &AllBound_CMz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFx_Visc, &AllBound_CFx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFy_Visc, &AllBound_CFy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CFz_Visc, &AllBound_CFz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPx_Visc, &AllBound_CoPx_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPy_Visc, &AllBound_CoPy_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CoPz_Visc, &AllBound_CoPz_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CT_Visc, &AllBound_CT_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_CQ_Visc, &AllBound_CQ_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_CMerit_Visc = AllBound_CT_Visc / (AllBound_CQ_Visc + EPS);
-  SU2_MPI::Allreduce(&MyAllBound_HF_Visc, &AllBound_HF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&MyAllBound_MaxHF_Visc, &AllBound_MaxHF_Visc, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   AllBound_MaxHF_Visc = pow(AllBound_MaxHF_Visc, 1.0/MaxNorm);
-  
-  /*--- Add the forces on the surfaces using all the nodes ---*/
-  
-  MySurface_CL_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CD_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CSF_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CEff_Visc       = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CFz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMx_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMy_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_CMz_Visc        = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_HF_Visc         = new su2double[config->GetnMarker_Monitoring()];
-  MySurface_MaxHF_Visc      = new su2double[config->GetnMarker_Monitoring()];
-  
-  for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-    
-    MySurface_CL_Visc[iMarker_Monitoring]      = Surface_CL_Visc[iMarker_Monitoring];
-    MySurface_CD_Visc[iMarker_Monitoring]      = Surface_CD_Visc[iMarker_Monitoring];
-    MySurface_CSF_Visc[iMarker_Monitoring] = Surface_CSF_Visc[iMarker_Monitoring];
-    MySurface_CEff_Visc[iMarker_Monitoring]       = Surface_CEff_Visc[iMarker_Monitoring];
-    MySurface_CFx_Visc[iMarker_Monitoring]        = Surface_CFx_Visc[iMarker_Monitoring];
-    MySurface_CFy_Visc[iMarker_Monitoring]        = Surface_CFy_Visc[iMarker_Monitoring];
-    MySurface_CFz_Visc[iMarker_Monitoring]        = Surface_CFz_Visc[iMarker_Monitoring];
-    MySurface_CMx_Visc[iMarker_Monitoring]        = Surface_CMx_Visc[iMarker_Monitoring];
-    MySurface_CMy_Visc[iMarker_Monitoring]        = Surface_CMy_Visc[iMarker_Monitoring];
-    MySurface_CMz_Visc[iMarker_Monitoring]        = Surface_CMz_Visc[iMarker_Monitoring];
-    MySurface_HF_Visc[iMarker_Monitoring]         = Surface_HF_Visc[iMarker_Monitoring];
-    MySurface_MaxHF_Visc[iMarker_Monitoring]      = Surface_MaxHF_Visc[iMarker_Monitoring];
-    
-    Surface_CL_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_CD_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_CSF_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CEff_Visc[iMarker_Monitoring]       = 0.0;
-    Surface_CFx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CFz_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMx_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMy_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_CMz_Visc[iMarker_Monitoring]        = 0.0;
-    Surface_HF_Visc[iMarker_Monitoring]         = 0.0;
-    Surface_MaxHF_Visc[iMarker_Monitoring]      = 0.0;
-  }
-  
-  SU2_MPI::Allreduce(MySurface_CL_Visc, Surface_CL_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CD_Visc, Surface_CD_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CSF_Visc, Surface_CSF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++)
     Surface_CEff_Visc[iMarker_Monitoring] = Surface_CL_Visc[iMarker_Monitoring] / (Surface_CD_Visc[iMarker_Monitoring] + EPS);
-  SU2_MPI::Allreduce(MySurface_CFx_Visc, Surface_CFx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFy_Visc, Surface_CFy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CFz_Visc, Surface_CFz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMx_Visc, Surface_CMx_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMy_Visc, Surface_CMy_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_CMz_Visc, Surface_CMz_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_HF_Visc, Surface_HF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(MySurface_MaxHF_Visc, Surface_MaxHF_Visc, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  
-  delete [] MySurface_CL_Visc; delete [] MySurface_CD_Visc; delete [] MySurface_CSF_Visc;
-  delete [] MySurface_CEff_Visc;  delete [] MySurface_CFx_Visc;   delete [] MySurface_CFy_Visc;
-  delete [] MySurface_CFz_Visc;   delete [] MySurface_CMx_Visc;   delete [] MySurface_CMy_Visc;
-  delete [] MySurface_CMz_Visc;   delete [] MySurface_HF_Visc; delete [] MySurface_MaxHF_Visc;
   
 #endif
   
@@ -16700,7 +16023,7 @@ void CNSSolver::Buffet_Monitoring(CGeometry *geometry, CConfig *config) {
   su2double MyTotal_Buffet_Metric = Total_Buffet_Metric;
   Total_Buffet_Metric = 0.0;
     
-  SU2_MPI::Allreduce(&MyTotal_Buffet_Metric, &Total_Buffet_Metric, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&MyTotal_Buffet_Metric, &Total_Buffet_Metric, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
     
   /*--- Add the buffet metric on the surfaces using all the nodes ---*/
 
@@ -16713,7 +16036,7 @@ void CNSSolver::Buffet_Monitoring(CGeometry *geometry, CConfig *config) {
       
   }
     
-  SU2_MPI::Allreduce(MySurface_Buffet_Metric, Surface_Buffet_Metric, config->GetnMarker_Monitoring(), MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(MySurface_Buffet_Metric, Surface_Buffet_Metric, config->GetnMarker_Monitoring(), MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
   
   delete [] MySurface_Buffet_Metric;
     
@@ -17030,11 +16353,15 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
 //    SU2_MPI::Error("Wall function treament not implemented yet", CURRENT_FUNCTION);
 //  }
   
+  /*--- Nodes and normals of the vertices, contiguous for the marker ---*/
+  
+  if (!geometry->Vertex_Arrays_Ready) geometry->PreprocessVertex_Arrays(!config->GetDiscrete_Adjoint());
+  
   /*--- Loop over boundary points ---*/
   
   for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     
-    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    iPoint = geometry->GetVertex_Node(val_marker, iVertex);
     
     if (geometry->node[iPoint]->GetDomain()) {
 
@@ -17044,7 +16371,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
       
       /*--- Compute dual-grid area and boundary normal ---*/
       
-      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      Normal = geometry->GetVertex_Normal(val_marker, iVertex);
       
       Area = 0.0; for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim]; Area = sqrt (Area);
       
@@ -17059,7 +16386,7 @@ void CNSSolver::BC_Isothermal_Wall(CGeometry *geometry, CSolver **solver_contain
       
       /*--- Compute closest normal neighbor ---*/
       
-      Point_Normal = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+      Point_Normal = geometry->GetVertex_Neighbor(val_marker, iVertex);
       
       /*--- Get coordinates of i & nearest normal and compute distance ---*/
       
@@ -17783,10 +17110,11 @@ void CNSSolver::SetTauWall_WF(CGeometry *geometry, CSolver **solver_container, C
           WallShearStress = sqrt(WallShearStress);
           
           /*--- Calculate the quantities from boundary layer theory and
-           iteratively solve for a new wall shear stress. Use the current wall
-           shear stress as a starting guess for the wall function. ---*/
+           iteratively solve for a new wall shear stress. Use the value of the
+           previous iteration, or the current wall shear stress, as a starting
+           guess for the wall function. ---*/
           
-          Tau_Wall_Old = WallShearStress;
+          Tau_Wall_Old = (node[iPoint]->GetTauWall() > 0.0)? node[iPoint]->GetTauWall() : WallShearStress;
           counter = 0; diff = 1.0;
           
           while (diff > tol) {
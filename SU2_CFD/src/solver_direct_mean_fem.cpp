@@ -67,6 +67,19 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(void) : CSolver() {
 
   /*--- Initialize the pointer for performing the BLAS functionalities. ---*/
   blasFunctions = NULL;
+
+  /*--- Initialize the pointers for the pool of threads. ---*/
+  taskThreadPool     = NULL;
+  configTaskChunks   = NULL;
+  numericsTaskChunks = NULL;
+
+  /*--- Initialize the data for the measurement of the load balance. ---*/
+  timeTaskListLoadBalance  = 0.0;
+  nEvalTaskListLoadBalance = 0;
+
+  /*--- Initialize the data of the matrix-free implicit iteration. ---*/
+  numericsResidual   = NULL;
+  normSolRefImplicit = 0.0;
 }
 
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDim, unsigned short iMesh) : CSolver() {
@@ -111,6 +124,19 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CConfig *config, unsigned short val_nDi
 
   /*--- Initialize the pointer for performing the BLAS functionalities. ---*/
   blasFunctions = NULL;
+
+  /*--- Initialize the pointers for the pool of threads. ---*/
+  taskThreadPool     = NULL;
+  configTaskChunks   = NULL;
+  numericsTaskChunks = NULL;
+
+  /*--- Initialize the data for the measurement of the load balance. ---*/
+  timeTaskListLoadBalance  = 0.0;
+  nEvalTaskListLoadBalance = 0;
+
+  /*--- Initialize the data of the matrix-free implicit iteration. ---*/
+  numericsResidual   = NULL;
+  normSolRefImplicit = 0.0;
 }
 
 CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, unsigned short iMesh) : CSolver() {
@@ -135,6 +161,19 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   /*--- Allocate the memory for blasFunctions. ---*/
   blasFunctions = new CBlasStructure;
 
+  /*--- Initialize the pointers for the pool of threads. ---*/
+  taskThreadPool     = NULL;
+  configTaskChunks   = NULL;
+  numericsTaskChunks = NULL;
+
+  /*--- Initialize the data for the measurement of the load balance. ---*/
+  timeTaskListLoadBalance  = 0.0;
+  nEvalTaskListLoadBalance = 0;
+
+  /*--- Initialize the data of the matrix-free implicit iteration. ---*/
+  numericsResidual   = NULL;
+  normSolRefImplicit = 0.0;
+
   /*--- Set the gamma value ---*/
   Gamma = config->GetGamma();
   Gamma_Minus_One = Gamma - 1.0;
@@ -259,13 +298,23 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- When sum-factorization is used, the volume integrals need additional
+        memory for the intermediate results. This memory is located after
+        the data of the volume integrals, hence it is added to sizeWorkArray. ---*/
+  unsigned long sizeWorkSumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i)
+    sizeWorkSumFact = max(sizeWorkSumFact,
+                          standardElementsSol[i].GetSizeWorkSumFactorization());
+
+  sizeWorkArray += nPadGemm*sizeWorkSumFact;
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
 
   /*--- Define some auxiliary vectors related to the residual ---*/
 
-  Residual_RMS = new su2double[nVar];     for(unsigned short iVar=0; iVar<nVar; ++iVar) Residual_RMS[iVar] = 1.e-35;
+  Residual_RMS = new accumdouble[nVar];     for(unsigned short iVar=0; iVar<nVar; ++iVar) Residual_RMS[iVar] = 1.e-35;
   Residual_Max = new su2double[nVar];     for(unsigned short iVar=0; iVar<nVar; ++iVar) Residual_Max[iVar] = 1.e-35;
   Point_Max    = new unsigned long[nVar]; for(unsigned short iVar=0; iVar<nVar; ++iVar) Point_Max[iVar]    = 0;
 
@@ -411,10 +460,15 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
   if(config->GetViscous() && (fabs(config->GetTheta_Interior_Penalty_DGFEM()) > 1.e-8))
     symmetrizingTermsPresent = true;
 
-  /*--- First the internal matching faces. ---*/
+  /*--- First the internal matching faces. Also the starting position of
+        every internal face is stored, such that ranges of faces can be
+        treated independently by the pool of threads. ---*/
   unsigned long sizeVecResFaces = 0;
+  startLocResInternalFace.resize(nMatchingInternalFacesWithHaloElem[nTimeLevels]+1);
   for(unsigned long i=0; i<nMatchingInternalFacesWithHaloElem[nTimeLevels]; ++i) {
 
+    startLocResInternalFace[i] = sizeVecResFaces;
+
     /* Determine the time level of the face. */
     const unsigned long  elem0     = matchingInternalFaces[i].elemID0;
     const unsigned long  elem1     = matchingInternalFaces[i].elemID1;
@@ -481,6 +535,8 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
       startLocResInternalFacesWithHaloElem[timeLevel+1] = sizeVecResFaces;
   }
 
+  startLocResInternalFace[nMatchingInternalFacesWithHaloElem[nTimeLevels]] = sizeVecResFaces;
+
   /* Set the uninitialized values of startLocResInternalFacesLocalElem. */
   for(unsigned short i=1; i<=nTimeLevels; ++i) {
     if(startLocResInternalFacesLocalElem[i] == 0)
@@ -716,13 +772,37 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
      computation of the spatial residual, while for ADER this list contains
      the tasks to be done for one space time step. */
   SetUpTaskList(config);
+
+  /* Create the kernels of the matrix products carried out for the chunks
+     of elements and faces. */
+  SetUpGemmKernels(config);
+
+  /* Create the pool of threads and determine the chunks of the tasks
+     carried out by it, if multiple threads are requested. */
+  if(config->GetnThreads_DGFEM() > 1) SetUpTaskChunks(config);
 }
 
 CFEM_DG_EulerSolver::~CFEM_DG_EulerSolver(void) {
 
+  /*--- The pool of threads must be terminated before the objects
+        used by its threads are released. ---*/
+  if(taskThreadPool != NULL) delete taskThreadPool;
+  for(unsigned long i=0; i<FluidModelThreads.size(); ++i)
+    delete FluidModelThreads[i];
+
   if(FluidModel    != NULL) delete FluidModel;
   if(blasFunctions != NULL) delete blasFunctions;
 
+#if defined(HAVE_MPI) && !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  /*--- Release the persistent communication requests. ---*/
+  for(unsigned long i=0; i<commRequests.size(); ++i) {
+    for(unsigned long j=0; j<commRequests[i].size(); ++j) {
+      SU2_MPI::Request_free(&commRequests[i][j]);
+      SU2_MPI::Request_free(&reverseCommRequests[i][j]);
+    }
+  }
+#endif
+
   /*--- Array deallocation ---*/
   if (CD_Inv != NULL)           delete [] CD_Inv;
   if (CL_Inv != NULL)           delete [] CL_Inv;
@@ -1032,31 +1112,44 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
   /*--- Delete the original (dimensional) FluidModel object before replacing. ---*/
 
   delete FluidModel;
+  for(unsigned long i=0; i<FluidModelThreads.size(); ++i)
+    delete FluidModelThreads[i];
+  FluidModelThreads.clear();
 
-  switch (config->GetKind_FluidModel()) {
+  /*--- The fluid model stores the state of its last evaluation and can therefore
+        not be shared between threads. Every additional thread of the pool of
+        threads, see SetUpTaskChunks, gets its own copy. ---*/
+  for(unsigned short iThread=0; iThread<config->GetnThreads_DGFEM(); ++iThread) {
 
-    case STANDARD_AIR:
-      FluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+    CFluidModel *fluidModel = NULL;
+    switch (config->GetKind_FluidModel()) {
 
-    case IDEAL_GAS:
-      FluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case STANDARD_AIR:
+        fluidModel = new CIdealGas(1.4, Gas_ConstantND, config->GetCompute_Entropy());
+        fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case VW_GAS:
-      FluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                       config->GetTemperature_Critical()/config->GetTemperature_Ref());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case IDEAL_GAS:
+        fluidModel = new CIdealGas(Gamma, Gas_ConstantND, config->GetCompute_Entropy());
+        fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
-    case PR_GAS:
-      FluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
-                                     config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
-      FluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
-      break;
+      case VW_GAS:
+        fluidModel = new CVanDerWaalsGas(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                         config->GetTemperature_Critical()/config->GetTemperature_Ref());
+        fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
 
+      case PR_GAS:
+        fluidModel = new CPengRobinson(Gamma, Gas_ConstantND, config->GetPressure_Critical() /config->GetPressure_Ref(),
+                                       config->GetTemperature_Critical()/config->GetTemperature_Ref(), config->GetAcentric_Factor());
+        fluidModel->SetEnergy_Prho(Pressure_FreeStreamND, Density_FreeStreamND);
+        break;
+
+    }
+
+    if(iThread == 0) FluidModel = fluidModel;
+    else             FluidModelThreads.push_back(fluidModel);
   }
 
   Energy_FreeStreamND = FluidModel->GetStaticEnergy() + 0.5*ModVel_FreeStreamND*ModVel_FreeStreamND;
@@ -1078,6 +1171,10 @@ void CFEM_DG_EulerSolver::SetNondimensionalization(CConfig        *config,
     FluidModel->SetLaminarViscosityModel(config);
     FluidModel->SetThermalConductivityModel(config);
 
+    for(unsigned long i=0; i<FluidModelThreads.size(); ++i) {
+      FluidModelThreads[i]->SetLaminarViscosityModel(config);
+      FluidModelThreads[i]->SetThermalConductivityModel(config);
+    }
   }
 
   if (tkeNeeded) { Energy_FreeStreamND += Tke_FreeStreamND; };  config->SetEnergy_FreeStreamND(Energy_FreeStreamND);
@@ -2335,7 +2432,7 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
             /* Create the dependencies for this task. */
             prevInd[0] = indexInList[CTaskDefinition::VOLUME_RESIDUAL][level];
             prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED][level];
-            prevInd[1] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
+            prevInd[2] = indexInList[CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO][level];
             prevInd[3] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS][level];
             prevInd[4] = indexInList[CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS][level];
 
@@ -2492,6 +2589,151 @@ void CFEM_DG_EulerSolver::SetUpTaskList(CConfig *config) {
   }
 }
 
+void CFEM_DG_EulerSolver::SetUpGemmKernels(CConfig *config) {
+
+  /*--- The elements and faces are treated in chunks, see MetaDataChunkOfElem,
+        in which the data of the entities is interleaved. The number of columns
+        in the matrix products, N, is a multiple of the minimum padding and
+        at most the padding specified in the input. Also the ADER predictor
+        uses these values. Loop over the possible values of N. ---*/
+  const unsigned short nPadInput = config->GetSizeMatMulPadding();
+  const unsigned short nPadMin   = 64/sizeof(passivedouble);
+
+  for(unsigned short NPad=nPadMin; NPad<=nPadInput; NPad+=nPadMin) {
+
+    /*--- Loop over the standard volume elements and create the kernels for
+          the interpolation to the integration points, the residuals and the
+          multiplication with the inverse of the mass matrix. ---*/
+    for(unsigned short i=0; i<nStandardElementsSol; ++i) {
+      const int nInt  = standardElementsSol[i].GetNIntegration();
+      const int nDOFs = standardElementsSol[i].GetNDOFs();
+
+      blasFunctions->CreateGemmKernel(nInt,                 NPad, nDOFs);
+      blasFunctions->CreateGemmKernel(nInt*nDim,            NPad, nDOFs);
+      blasFunctions->CreateGemmKernel(nInt*(nDim+1),        NPad, nDOFs);
+      blasFunctions->CreateGemmKernel(nDOFs,                NPad, nInt);
+      blasFunctions->CreateGemmKernel(nDOFs,                NPad, nInt*nDim);
+      blasFunctions->CreateGemmKernel(nDOFs*nDim,           NPad, nDOFs);
+      blasFunctions->CreateGemmKernel(nDOFs,                NPad, nDOFs);
+      blasFunctions->CreateGemmKernel(nInt*nDim*(nDim+1)/2, NPad, nDOFs);
+    }
+
+    /*--- Loop over the standard matching faces and create the kernels for
+          both sides of the faces. ---*/
+    for(unsigned short i=0; i<nStandardMatchingFacesSol; ++i) {
+      const int nInt       = standardMatchingFacesSol[i].GetNIntegration();
+      const int nDOFsFace0 = standardMatchingFacesSol[i].GetNDOFsFaceSide0();
+      const int nDOFsFace1 = standardMatchingFacesSol[i].GetNDOFsFaceSide1();
+      const int nDOFsElem0 = standardMatchingFacesSol[i].GetNDOFsElemSide0();
+      const int nDOFsElem1 = standardMatchingFacesSol[i].GetNDOFsElemSide1();
+
+      blasFunctions->CreateGemmKernel(nInt,       NPad, nDOFsFace0);
+      blasFunctions->CreateGemmKernel(nInt,       NPad, nDOFsFace1);
+      blasFunctions->CreateGemmKernel(nDOFsFace0, NPad, nInt);
+      blasFunctions->CreateGemmKernel(nDOFsFace1, NPad, nInt);
+      blasFunctions->CreateGemmKernel(nInt*nDim,  NPad, nDOFsElem0);
+      blasFunctions->CreateGemmKernel(nInt*nDim,  NPad, nDOFsElem1);
+      blasFunctions->CreateGemmKernel(nDOFsElem0, NPad, nInt*nDim);
+      blasFunctions->CreateGemmKernel(nDOFsElem1, NPad, nInt*nDim);
+    }
+
+    /*--- Loop over the standard boundary faces. ---*/
+    for(unsigned short i=0; i<nStandardBoundaryFacesSol; ++i) {
+      const int nInt      = standardBoundaryFacesSol[i].GetNIntegration();
+      const int nDOFsFace = standardBoundaryFacesSol[i].GetNDOFsFace();
+      const int nDOFsElem = standardBoundaryFacesSol[i].GetNDOFsElem();
+
+      blasFunctions->CreateGemmKernel(nInt,      NPad, nDOFsFace);
+      blasFunctions->CreateGemmKernel(nDOFsFace, NPad, nInt);
+      blasFunctions->CreateGemmKernel(nInt*nDim, NPad, nDOFsElem);
+      blasFunctions->CreateGemmKernel(nDOFsElem, NPad, nInt*nDim);
+    }
+  }
+
+  /*--- The multiplication with the inverse of the mass matrix of the
+        Runge-Kutta schemes is carried out per element. ---*/
+  for(unsigned short i=0; i<nStandardElementsSol; ++i) {
+    const int nDOFs = standardElementsSol[i].GetNDOFs();
+    blasFunctions->CreateGemmKernel(nDOFs, nVar, nDOFs);
+  }
+}
+
+void CFEM_DG_EulerSolver::SetUpTaskChunks(CConfig *config) {
+
+  /*--- Create the pool of threads and the work arrays of its threads. ---*/
+  taskThreadPool = new CTaskThreadPool(config->GetnThreads_DGFEM(),
+                                       ProcessTaskChunk_DG, this);
+  const unsigned short nThreads = taskThreadPool->GetnThreads();
+
+  workArrayThreads.assign(nThreads, vector<su2double>(sizeWorkArray, 0.0));
+
+  /*--- Determine the desired number of chunks per task. This is larger than
+        the number of threads, such that the load is balanced by work stealing
+        when the cost of the elements/faces differs. ---*/
+  const unsigned long nChunks = 4*nThreads;
+
+  /* Determine the number of elements/faces that are treated simultaneously
+     in the residual computations, see Volume_Residual and ResidualFaces. */
+  const unsigned short nSimul = config->GetSizeMatMulPadding()/nVar;
+
+  /* The surface residuals can only be split in chunks for the Riemann solvers
+     that do not use the numerics object, because this object is not thread safe. */
+  const bool chunkFaces = (config->GetRiemann_Solver_FEM() == ROE) ||
+                          (config->GetRiemann_Solver_FEM() == LAX_FRIEDRICH);
+
+  /*--- Loop over the tasks and determine the chunks of the tasks that are
+        carried out by the pool of threads. ---*/
+  taskChunkBounds.assign(tasksList.size(), vector<unsigned long>(0));
+  for(unsigned long i=0; i<tasksList.size(); ++i) {
+
+    const unsigned short level = tasksList[i].timeLevel;
+    vector<unsigned long> &bounds = taskChunkBounds[i];
+
+    switch( tasksList[i].task ) {
+
+      case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+        const unsigned long elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                    + nVolElemInternalPerTimeLevel[level];
+        ChunkBoundsOfRange(volElem, elemBeg, nVolElemOwnedPerTimeLevel[level+1],
+                           1, nChunks, bounds);
+        break;
+      }
+
+      case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+        const unsigned long elemBeg = nVolElemOwnedPerTimeLevel[level];
+        ChunkBoundsOfRange(volElem, elemBeg, elemBeg + nVolElemInternalPerTimeLevel[level],
+                           1, nChunks, bounds);
+        break;
+      }
+
+      case CTaskDefinition::VOLUME_RESIDUAL: {
+        ChunkBoundsOfRange(volElem, nVolElemOwnedPerTimeLevel[level],
+                           nVolElemOwnedPerTimeLevel[level+1], nSimul, nChunks, bounds);
+        break;
+      }
+
+      case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+        if( chunkFaces )
+          ChunkBoundsOfRange(matchingInternalFaces, nMatchingInternalFacesLocalElem[level],
+                             nMatchingInternalFacesLocalElem[level+1], nSimul, nChunks, bounds);
+        break;
+      }
+
+      case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+        if( chunkFaces )
+          ChunkBoundsOfRange(matchingInternalFaces, nMatchingInternalFacesWithHaloElem[level],
+                             nMatchingInternalFacesWithHaloElem[level+1], nSimul, nChunks, bounds);
+        break;
+      }
+
+      default: break;
+    }
+
+    /* A task with a single chunk is carried out by the calling thread. */
+    if(bounds.size() < 3) bounds.clear();
+  }
+}
+
 void CFEM_DG_EulerSolver::Prepare_MPI_Communication(const CMeshFEM *FEMGeometry,
                                                     CConfig        *config) {
 
@@ -2588,6 +2830,9 @@ void CFEM_DG_EulerSolver::Prepare_MPI_Communication(const CMeshFEM *FEMGeometry,
   /* Allocate the memory for the first index of the vectors that
      determine the MPI communication patterns. */
   commRequests.resize(nTimeLevels);
+  reverseCommRequests.resize(nTimeLevels);
+  commActive.assign(nTimeLevels, false);
+  reverseCommActive.assign(nTimeLevels, false);
   elementsRecvMPIComm.resize(nTimeLevels);
   elementsSendMPIComm.resize(nTimeLevels);
   ranksRecvMPI.resize(nTimeLevels);
@@ -2615,6 +2860,7 @@ void CFEM_DG_EulerSolver::Prepare_MPI_Communication(const CMeshFEM *FEMGeometry,
     /* Allocate the memory for the second index of the vectors that
        determine the MPI communication. */
     commRequests[level].resize(nRankRecv+nRankSend);
+    reverseCommRequests[level].resize(nRankRecv+nRankSend);
     elementsRecvMPIComm[level].resize(nRankRecv);
     elementsSendMPIComm[level].resize(nRankSend);
     ranksRecvMPI[level].resize(nRankRecv);
@@ -2669,6 +2915,49 @@ void CFEM_DG_EulerSolver::Prepare_MPI_Communication(const CMeshFEM *FEMGeometry,
         ++nRankSend;
       }
     }
+
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+
+    /*--- Create the persistent requests of the communication of the solution,
+          which are started in Initiate_MPI_Communication. The send buffers are
+          completely filled, hence their sizes are the message sizes. ---*/
+    int indComm = 0;
+    for(int i=0; i<nRankSend; ++i, ++indComm) {
+      int dest = ranksSendMPI[level][i];
+      int tag  = dest + level;
+      SU2_MPI::Send_init(commSendBuf[level][i].data(), commSendBuf[level][i].size(),
+                         MPI_SU2DOUBLE, dest, tag, MPI_COMM_WORLD,
+                         &commRequests[level][indComm]);
+    }
+
+    for(int i=0; i<nRankRecv; ++i, ++indComm) {
+      int source = ranksRecvMPI[level][i];
+      int tag    = rank + level;
+      SU2_MPI::Recv_init(commRecvBuf[level][i].data(), commRecvBuf[level][i].size(),
+                         MPI_SU2DOUBLE, source, tag, MPI_COMM_WORLD,
+                         &commRequests[level][indComm]);
+    }
+
+    /*--- Create the persistent requests of the reverse communication of the
+          residual. The buffers of the original pattern are reused with the roles
+          of sending and receiving swapped. Only the spatial DOFs are sent. ---*/
+    indComm = 0;
+    for(int i=0; i<nRankRecv; ++i, ++indComm) {
+      int dest = ranksRecvMPI[level][i];
+      int tag  = dest + level + 20;
+      SU2_MPI::Send_init(commRecvBuf[level][i].data(), commRecvBuf[level][i].size()/nTimeDOFs,
+                         MPI_SU2DOUBLE, dest, tag, MPI_COMM_WORLD,
+                         &reverseCommRequests[level][indComm]);
+    }
+
+    for(int i=0; i<nRankSend; ++i, ++indComm) {
+      int source = ranksSendMPI[level][i];
+      int tag    = rank + level + 20;
+      SU2_MPI::Recv_init(commSendBuf[level][i].data(), commSendBuf[level][i].size()/nTimeDOFs,
+                         MPI_SU2DOUBLE, source, tag, MPI_COMM_WORLD,
+                         &reverseCommRequests[level][indComm]);
+    }
+#endif
   }
 
 #endif
@@ -2772,13 +3061,16 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
         }
       }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
       /* Send the data using non-blocking sends. */
       int dest = ranksSendMPI[timeLevel][i];
       int tag  = dest + timeLevel;
-      SU2_MPI::Isend(sendBuf, ii, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
+      SU2_MPI::Isend(sendBuf, ii, MPI_SU2DOUBLE, dest, tag, MPI_COMM_WORLD,
                      &commRequests[timeLevel][indComm]);
+#endif
     }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
     /* Loop over the number of ranks from which data is received. */
     for(unsigned long i=0; i<ranksRecvMPI[timeLevel].size(); ++i, ++indComm) {
 
@@ -2787,9 +3079,16 @@ void CFEM_DG_EulerSolver::Initiate_MPI_Communication(CConfig *config,
       int tag    = rank + timeLevel;
       SU2_MPI::Irecv(commRecvBuf[timeLevel][i].data(),
                      commRecvBuf[timeLevel][i].size(),
-                     MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
+                     MPI_SU2DOUBLE, source, tag, MPI_COMM_WORLD,
                      &commRequests[timeLevel][indComm]);
     }
+#else
+    /* Start the persistent sends and receives, created in
+       Prepare_MPI_Communication, now that the send buffers are filled. */
+    SU2_MPI::Startall(commRequests[timeLevel].size(), commRequests[timeLevel].data());
+#endif
+
+    commActive[timeLevel] = true;
   }
 
 #endif
@@ -2839,6 +3138,8 @@ bool CFEM_DG_EulerSolver::Complete_MPI_Communication(CConfig *config,
       if( !flag ) return false;
     }
 
+    commActive[timeLevel] = false;
+
     /* Loop over the number of ranks from which this rank has received data. */
     for(unsigned long i=0; i<ranksRecvMPI[timeLevel].size(); ++i) {
       unsigned long ii = 0;
@@ -3017,13 +3318,16 @@ void CFEM_DG_EulerSolver::Initiate_MPI_ReverseCommunication(CConfig *config,
         ii += nItems;
       }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
       /* Send the data using non-blocking sends. */
       int dest = ranksRecvMPI[timeLevel][i];
       int tag  = dest + timeLevel + 20;
-      SU2_MPI::Isend(recvBuf, ii, MPI_DOUBLE, dest, tag, MPI_COMM_WORLD,
-                     &commRequests[timeLevel][indComm]);
+      SU2_MPI::Isend(recvBuf, ii, MPI_SU2DOUBLE, dest, tag, MPI_COMM_WORLD,
+                     &reverseCommRequests[timeLevel][indComm]);
+#endif
     }
 
+#if defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
     /* Post the non-blocking receives. As this is the reverse communication,
        a loop over the sending ranks must be carried out. */
     for(unsigned long i=0; i<ranksSendMPI[timeLevel].size(); ++i, ++indComm) {
@@ -3032,9 +3336,16 @@ void CFEM_DG_EulerSolver::Initiate_MPI_ReverseCommunication(CConfig *config,
       int tag    = rank + timeLevel + 20;
       SU2_MPI::Irecv(commSendBuf[timeLevel][i].data(),
                      commSendBuf[timeLevel][i].size(),
-                     MPI_DOUBLE, source, tag, MPI_COMM_WORLD,
-                     &commRequests[timeLevel][indComm]);
+                     MPI_SU2DOUBLE, source, tag, MPI_COMM_WORLD,
+                     &reverseCommRequests[timeLevel][indComm]);
     }
+#else
+    /* Start the persistent sends and receives of the reverse communication. */
+    SU2_MPI::Startall(reverseCommRequests[timeLevel].size(),
+                      reverseCommRequests[timeLevel].data());
+#endif
+
+    reverseCommActive[timeLevel] = true;
   }
 
 #endif
@@ -3063,16 +3374,18 @@ bool CFEM_DG_EulerSolver::Complete_MPI_ReverseCommunication(CConfig *config,
           Otherwise, Testall is used to check if all the requests have
           been completed. If not, return false. ---*/
     if( commMustBeCompleted ) {
-      SU2_MPI::Waitall(commRequests[timeLevel].size(),
-                       commRequests[timeLevel].data(), MPI_STATUSES_IGNORE);
+      SU2_MPI::Waitall(reverseCommRequests[timeLevel].size(),
+                       reverseCommRequests[timeLevel].data(), MPI_STATUSES_IGNORE);
     }
     else {
       int flag;
-      SU2_MPI::Testall(commRequests[timeLevel].size(),
-                       commRequests[timeLevel].data(), &flag, MPI_STATUSES_IGNORE);
+      SU2_MPI::Testall(reverseCommRequests[timeLevel].size(),
+                       reverseCommRequests[timeLevel].data(), &flag, MPI_STATUSES_IGNORE);
       if( !flag ) return false;
     }
 
+    reverseCommActive[timeLevel] = false;
+
     /*-------------------------------------------------------------------------*/
     /*---    Update the residuals of the owned DOFs with the data received. ---*/
     /*-------------------------------------------------------------------------*/
@@ -3136,6 +3449,25 @@ bool CFEM_DG_EulerSolver::Complete_MPI_ReverseCommunication(CConfig *config,
   return true;
 }
 
+void CFEM_DG_EulerSolver::Progress_MPI_Communication(void) {
+#ifdef HAVE_MPI
+
+  /*--- Loop over the time levels and test the requests of the communication
+        in progress. The result of the test is not needed, because the actual
+        completion takes place in the Complete functions. Completed requests
+        are inactive and are therefore not tested again. ---*/
+  for(unsigned short level=0; level<commActive.size(); ++level) {
+    int flag;
+    if( commActive[level] )
+      SU2_MPI::Testall(commRequests[level].size(), commRequests[level].data(),
+                       &flag, MPI_STATUSES_IGNORE);
+    if( reverseCommActive[level] )
+      SU2_MPI::Testall(reverseCommRequests[level].size(), reverseCommRequests[level].data(),
+                       &flag, MPI_STATUSES_IGNORE);
+  }
+#endif
+}
+
 void CFEM_DG_EulerSolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_container, CConfig *config, unsigned long ExtIter) {
 
 #ifdef INVISCID_VORTEX
@@ -3960,10 +4292,10 @@ void CFEM_DG_EulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_con
     if ((config->GetConsole_Output_Verb() == VERB_HIGH) || time_stepping) {
 #ifdef HAVE_MPI
       su2double rbuf_time = Min_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 
       rbuf_time = Max_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
     }
 
@@ -4015,11 +4347,35 @@ void CFEM_DG_EulerSolver::CheckTimeSynchronization(CConfig         *config,
   else syncTimeReached = false;
 }
 
+/* Function, which returns the wall clock time in seconds. Used to measure
+   the work of a rank for the load balance check of the DG solver. */
+static su2double WallClockTime_DG(void) {
+#ifndef HAVE_MPI
+  return su2double(clock())/su2double(CLOCKS_PER_SEC);
+#else
+  return MPI_Wtime();
+#endif
+}
+
 void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **solver_container,
                                              CNumerics **numerics, CConfig *config,
                                              unsigned short iMesh) {
-  /* Easier storage of the number of time levels.. */
-  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
+  /* Store the start time for the measurement of the work of this rank. */
+  const su2double timeStart = WallClockTime_DG();
+
+  /* Store the numerics for the residual evaluations of the matrix-free
+     products of the implicit iteration. */
+  numericsResidual = numerics;
+
+  /* When a pool of threads is present, the tasks are processed
+     by the threads of this pool. */
+  if( taskThreadPool ) {
+    ProcessTaskListThreads_DG(numerics, config);
+
+    timeTaskListLoadBalance += WallClockTime_DG() - timeStart;
+    ReportLoadImbalance_DG(config);
+    return;
+  }
 
   /* Define and initialize the bool vector, that indicates whether or
      not the tasks from the list have been completed. */
@@ -4051,275 +4407,416 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
 
         if( taskCanBeCarriedOut ) {
 
-          /*--- Determine the actual task to be carried out and do so. The
-                only tasks that may fail are the completion of the non-blocking
-                communication. If that is the case the next task needs to be
-                found. ---*/
-          switch( tasksList[i].task ) {
+          /*--- Carry out the task. The only tasks that may fail are the
+                completion of the non-blocking communication. If that is the
+                case the next task needs to be found. For j==1 the next tasks
+                are waiting for this communication to be completed and hence
+                the communication is completed in a blocking way. ---*/
+          if( ProcessTask_DG(i, numerics, config, j==1, workArray) )
+            taskCarriedOut = taskCompleted[i] = true;
+        }
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
+        /* Break the inner loop if a task has been carried out. */
+        if( taskCarriedOut ) break;
+      }
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+      /* Break the outer loop if a task has been carried out. */
+      if( taskCarriedOut ) break;
+    }
 
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    /* Update the value of lowestIndexInList. */
+    for(; lowestIndexInList < tasksList.size(); ++lowestIndexInList)
+      if( !taskCompleted[lowestIndexInList] ) break;
+  }
 
-            case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+  /* Update the measured work of this rank and check the load balance. */
+  timeTaskListLoadBalance += WallClockTime_DG() - timeStart;
+  ReportLoadImbalance_DG(config);
+}
 
-              /* Carry out the ADER predictor step for the elements whose
-                 solution must not be communicated for this time level. */
-              const unsigned short level   = tasksList[i].timeLevel;
-              const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
-              const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
-                                           + nVolElemInternalPerTimeLevel[level];
-              ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+void CFEM_DG_EulerSolver::ReportLoadImbalance_DG(CConfig *config) {
 
-            case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
+  /* Return immediately if no report is requested or if the number of
+     evaluations of the tasks list is not yet reached. This is a diagnostic
+     only, the elements are not redistributed over the ranks. */
+  const unsigned long freqReport = config->GetLoadImbalance_Report_Freq_DGFEM();
+  if(freqReport == 0) return;
 
-              /* Start the MPI communication of the solution in the halo elements. */
-              Initiate_MPI_Communication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  ++nEvalTaskListLoadBalance;
+  if(nEvalTaskListLoadBalance < freqReport) return;
 
-            case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the solution data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_Communication(config, tasksList[i].timeLevel,
-                                             j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Determine the maximum and the sum of the measured work over the ranks.
+     Note that the measured time also contains the time spent waiting for
+     the completion of the communication, which reduces the apparent
+     imbalance. Hence the reported ratio is a lower bound. */
+  su2double timeMax = timeTaskListLoadBalance, timeSum = timeTaskListLoadBalance;
 
-            case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&timeTaskListLoadBalance, &timeMax, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&timeTaskListLoadBalance, &timeSum, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#endif
 
-              /* Start the communication of the residuals, for which the
-                 reverse communication must be used. */
-              Initiate_MPI_ReverseCommunication(config, tasksList[i].timeLevel);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Determine the ratio of the maximum and average work. Report the
+     imbalance if this ratio exceeds the specified tolerance. */
+  const su2double timeAvg = timeSum/size;
+  const su2double ratio   = (timeAvg > 0.0) ? timeMax/timeAvg : 1.0;
+
+  if((rank == MASTER_NODE) && (ratio > config->GetLoadImbalance_Report_Tol_DGFEM())) {
+    cout << endl << "WARNING: Load imbalance of the DG solver of " << ratio
+         << " measured over the last " << nEvalTaskListLoadBalance
+         << " evaluations of the tasks list." << endl
+         << "         Maximum work per rank: " << timeMax << " s, average: "
+         << timeAvg << " s. Consider repartitioning the grid." << endl << endl;
+  }
 
-            case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
-
-              /* Attempt to complete the MPI communication of the residual data.
-                 For j==0, SU2_MPI::Testall will be used, which returns false if
-                 not all requests can be completed. In that case the next task on
-                 the list is carried out. If j==1, this means that the next
-                 tasks are waiting for this communication to be completed and
-                 hence MPI_Waitall is used. */
-              if( Complete_MPI_ReverseCommunication(config, tasksList[i].timeLevel,
-                                                    j==1) )
-                taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Reset the data for the next check. */
+  timeTaskListLoadBalance  = 0.0;
+  nEvalTaskListLoadBalance = 0;
+}
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
+bool CFEM_DG_EulerSolver::ProcessTask_DG(const unsigned long indTask,
+                                         CNumerics           **numerics,
+                                         CConfig             *config,
+                                         const bool          waitComm,
+                                         su2double           *workArray) {
 
-              /* Interpolate the predictor solution of the owned elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
-                adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
-              }
+  /* Easier storage of the number of time levels.. */
+  const unsigned short nTimeLevels = config->GetnLevels_TimeAccurateLTS();
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Number of elements treated between two tests of the communication in
+     progress in the volume tasks. A multiple of the number of elements
+     treated simultaneously in the matrix products. */
+  const unsigned long nElemProgressMPI = 8*(config->GetSizeMatMulPadding()/nVar);
 
-            case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
+  /*--- Determine the actual task to be carried out and do so. The
+        only tasks that may fail are the completion of the non-blocking
+        communication, for which false is returned. ---*/
+  switch( tasksList[indTask].task ) {
 
-              /* Interpolate the predictor solution of the halo elements
-                 in time to the given time integration point for the
-                 given time level. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long nAdjElem = 0, *adjElem = NULL;
-              if(level < (nTimeLevels-1)) {
-                nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
-                adjElem  = haloElemAdjLowTimeLevel[level+1].data();
-              }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS: {
 
-              ADER_DG_TimeInterpolatePredictorSol(config, tasksList[i].intPointADER,
-                                                  nVolElemHaloPerTimeLevel[level],
-                                                  nVolElemHaloPerTimeLevel[level+1],
-                                                  nAdjElem, adjElem,
-                                                  tasksList[i].secondPartTimeIntADER,
-                                                  VecWorkSolDOFs[level].data());
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Carry out the ADER predictor step for the elements whose
+         solution must be communicated for this time level. */
+      const unsigned short level   = tasksList[indTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+      ADER_DG_PredictorStep(config, elemBeg, elemEnd, workArray);
+      break;
+    }
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
-                                 nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
 
-            case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+      /* Carry out the ADER predictor step for the elements whose
+         solution must not be communicated for this time level. */
+      const unsigned short level   = tasksList[indTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level]
+                                   + nVolElemInternalPerTimeLevel[level];
 
-              /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
-                                 nVolElemHaloPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* The communication of the other elements is in progress. Test it
+         after every block of elements. */
+      for(unsigned long l=elemBeg; l<elemEnd; l+=nElemProgressMPI) {
+        ADER_DG_PredictorStep(config, l, min(l+nElemProgressMPI, elemEnd), workArray);
+        Progress_MPI_Communication();
+      }
+      break;
+    }
 
-            case CTaskDefinition::VOLUME_RESIDUAL: {
+    case CTaskDefinition::INITIATE_MPI_COMMUNICATION: {
 
-              /*--- Compute the volume portion of the residual. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              Volume_Residual(config, nVolElemOwnedPerTimeLevel[level],
-                              nVolElemOwnedPerTimeLevel[level+1], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the MPI communication of the solution in the halo elements. */
+      Initiate_MPI_Communication(config, tasksList[indTask].timeLevel);
+      break;
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+    case CTaskDefinition::COMPLETE_MPI_COMMUNICATION: {
 
-              /* Compute the residual of the faces that only involve owned elements. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
-              ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
-                            nMatchingInternalFacesLocalElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the solution data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the next
+         task on the list is carried out. If waitComm is true, this means
+         that the next tasks are waiting for this communication to be
+         completed and hence MPI_Waitall is used. */
+      return Complete_MPI_Communication(config, tasksList[indTask].timeLevel,
+                                        waitComm);
+    }
 
-            case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+    case CTaskDefinition::INITIATE_REVERSE_MPI_COMMUNICATION: {
 
-              /* Compute the residual of the faces that involve a halo element. */
-              const unsigned short level = tasksList[i].timeLevel;
-              unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
-              ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
-                            nMatchingInternalFacesWithHaloElem[level+1],
-                            indResFaces, numerics[CONV_TERM], workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Start the communication of the residuals, for which the
+         reverse communication must be used. */
+      Initiate_MPI_ReverseCommunication(config, tasksList[indTask].timeLevel);
+      break;
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+    case CTaskDefinition::COMPLETE_REVERSE_MPI_COMMUNICATION: {
 
-              /*--- Apply the boundary conditions that only depend on data
-                    of owned elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, false,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Attempt to complete the MPI communication of the residual data.
+         If waitComm is false, SU2_MPI::Testall will be used, which returns
+         false if not all requests can be completed. In that case the next
+         task on the list is carried out. If waitComm is true, this means
+         that the next tasks are waiting for this communication to be
+         completed and hence MPI_Waitall is used. */
+      return Complete_MPI_ReverseCommunication(config, tasksList[indTask].timeLevel,
+                                               waitComm);
+    }
 
-            case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_OWNED_ELEMENTS: {
 
-              /*--- Apply the boundary conditions that also depend on data
-                    of halo elements. ---*/
-              Boundary_Conditions(tasksList[i].timeLevel, config, numerics, true,
-                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      /* Interpolate the predictor solution of the owned elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[indTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = ownedElemAdjLowTimeLevel[level+1].size();
+        adjElem  = ownedElemAdjLowTimeLevel[level+1].data();
+      }
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[indTask].intPointADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[indTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      break;
+    }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, true);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    case CTaskDefinition::ADER_TIME_INTERPOLATE_HALO_ELEMENTS: {
 
-            case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+      /* Interpolate the predictor solution of the halo elements
+         in time to the given time integration point for the
+         given time level. */
+      const unsigned short level = tasksList[indTask].timeLevel;
+      unsigned long nAdjElem = 0, *adjElem = NULL;
+      if(level < (nTimeLevels-1)) {
+        nAdjElem = haloElemAdjLowTimeLevel[level+1].size();
+        adjElem  = haloElemAdjLowTimeLevel[level+1].data();
+      }
 
-              /* Create the final residual by summing up all contributions. */
-              CreateFinalResidual(tasksList[i].timeLevel, false);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      ADER_DG_TimeInterpolatePredictorSol(config, tasksList[indTask].intPointADER,
+                                          nVolElemHaloPerTimeLevel[level],
+                                          nVolElemHaloPerTimeLevel[level+1],
+                                          nAdjElem, adjElem,
+                                          tasksList[indTask].secondPartTimeIntADER,
+                                          VecWorkSolDOFs[level].data());
+      break;
+    }
+
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_OWNED_ELEMENTS: {
+
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[indTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemOwnedPerTimeLevel[level],
+                         nVolElemOwnedPerTimeLevel[level+1], workArray);
+      break;
+    }
+
+    case CTaskDefinition::SHOCK_CAPTURING_VISCOSITY_HALO_ELEMENTS: {
+
+      /*--- Compute the artificial viscosity for shock capturing in DG. ---*/
+      const unsigned short level = tasksList[indTask].timeLevel;
+      Shock_Capturing_DG(config, nVolElemHaloPerTimeLevel[level],
+                         nVolElemHaloPerTimeLevel[level+1], workArray);
+      break;
+    }
+
+    case CTaskDefinition::VOLUME_RESIDUAL: {
+
+      /*--- Compute the volume portion of the residual. ---*/
+      /*--- Compute the volume portion of the residual in blocks of elements,
+            such that the communication in progress can be tested in between. ---*/
+      const unsigned short level   = tasksList[indTask].timeLevel;
+      const unsigned long  elemBeg = nVolElemOwnedPerTimeLevel[level];
+      const unsigned long  elemEnd = nVolElemOwnedPerTimeLevel[level+1];
+
+      for(unsigned long l=elemBeg; l<elemEnd; l+=nElemProgressMPI) {
+        Volume_Residual(config, l, min(l+nElemProgressMPI, elemEnd), workArray);
+        Progress_MPI_Communication();
+      }
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Compute the residual of the faces that only involve owned elements. */
+      const unsigned short level = tasksList[indTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesLocalElem[level];
+      ResidualFaces(config, nMatchingInternalFacesLocalElem[level],
+                    nMatchingInternalFacesLocalElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Compute the residual of the faces that involve a halo element. */
+      const unsigned short level = tasksList[indTask].timeLevel;
+      unsigned long indResFaces = startLocResInternalFacesWithHaloElem[level];
+      ResidualFaces(config, nMatchingInternalFacesWithHaloElem[level],
+                    nMatchingInternalFacesWithHaloElem[level+1],
+                    indResFaces, numerics[CONV_TERM], workArray);
+      break;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_OWNED: {
+
+      /*--- Apply the boundary conditions that only depend on data
+            of owned elements. ---*/
+      Boundary_Conditions(tasksList[indTask].timeLevel, config, numerics, false,
+                          workArray);
+      break;
+    }
+
+    case CTaskDefinition::BOUNDARY_CONDITIONS_DEPEND_ON_HALO: {
+
+      /*--- Apply the boundary conditions that also depend on data
+            of halo elements. ---*/
+      Boundary_Conditions(tasksList[indTask].timeLevel, config, numerics, true,
+                          workArray);
+      break;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_OWNED_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[indTask].timeLevel, true);
+      break;
+    }
+
+    case CTaskDefinition::SUM_UP_RESIDUAL_CONTRIBUTIONS_HALO_ELEMENTS: {
+
+      /* Create the final residual by summing up all contributions. */
+      CreateFinalResidual(tasksList[indTask].timeLevel, false);
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the owned elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[indTask].timeLevel,
+                                               tasksList[indTask].intPointADER);
+      break;
+    }
+
+    case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+
+      /* Accumulate the space time residuals for the halo elements
+         for ADER-DG. */
+      AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[indTask].timeLevel,
+                                              tasksList[indTask].intPointADER);
+      break;
+    }
+
+    case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+
+      /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
+      const unsigned short level = tasksList[indTask].timeLevel;
+      const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
+      MultiplyResidualByInverseMassMatrix(config, useADER,
+                                          nVolElemOwnedPerTimeLevel[level],
+                                          nVolElemOwnedPerTimeLevel[level+1],
+                                          workArray);
+      break;
+    }
+
+    case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+
+      /*--- Perform the update step for ADER-DG. ---*/
+      const unsigned short level = tasksList[indTask].timeLevel;
+      ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
+                        nVolElemOwnedPerTimeLevel[level+1]);
+      break;
+    }
+
+    default: {
+
+      cout << "Task not defined. This should not happen." << endl;
+      exit(1);
+    }
+  }
+
+  return true;
+}
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_OWNED_ELEMENTS: {
+void CFEM_DG_EulerSolver::ProcessTaskListThreads_DG(CNumerics **numerics,
+                                                    CConfig   *config) {
 
-              /* Accumulate the space time residuals for the owned elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADEROwnedElem(config, tasksList[i].timeLevel,
-                                                       tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Store the data needed to carry out the chunks and reset the
+     chunk counters of the pool of threads. */
+  configTaskChunks   = config;
+  numericsTaskChunks = numerics;
+  taskThreadPool->ResetTasks(tasksList.size());
 
-            case CTaskDefinition::ADER_ACCUMULATE_SPACETIME_RESIDUAL_HALO_ELEMENTS: {
+  /* The calling thread uses the first work array of the pool. */
+  su2double *workArray = workArrayThreads[0].data();
 
-              /* Accumulate the space time residuals for the halo elements
-                 for ADER-DG. */
-              AccumulateSpaceTimeResidualADERHaloElem(config, tasksList[i].timeLevel,
-                                                      tasksList[i].intPointADER);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+  /* Define and initialize the bool vectors, that indicate whether or not
+     the tasks from the list have been completed and whether or not the
+     chunks of a task have been handed to the pool of threads. */
+  vector<bool> taskCompleted(tasksList.size(), false);
+  vector<bool> taskLaunched(tasksList.size(), false);
 
-            case CTaskDefinition::MULTIPLY_INVERSE_MASS_MATRIX: {
+  /* While loop to carry out all the tasks in tasksList. */
+  unsigned long lowestIndexInList = 0;
+  while(lowestIndexInList < tasksList.size()) {
 
-              /*--- Multiply the residual by the (lumped) mass matrix, to obtain the final value. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              const bool useADER = config->GetKind_TimeIntScheme() == ADER_DG;
-              MultiplyResidualByInverseMassMatrix(config, useADER,
-                                                  nVolElemOwnedPerTimeLevel[level],
-                                                  nVolElemOwnedPerTimeLevel[level+1],
-                                                  workArray);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+    /*--- Loop over the tasks that are not completed yet. The tasks with chunks
+          are launched as soon as their dependencies are fulfilled, such that
+          the other threads can work on them. The tasks without chunks, among
+          which all MPI communication, are carried out by this thread. ---*/
+    bool progress       = false;
+    bool chunksInFlight = false;
+    long indCommPending = -1;
+
+    for(unsigned long i=lowestIndexInList; i<tasksList.size(); ++i) {
+      if( taskCompleted[i] ) continue;
+
+      /* Check whether all chunks of a launched task have been completed. */
+      if( taskLaunched[i] ) {
+        if( taskThreadPool->TaskCompleted(i) ) progress = taskCompleted[i] = true;
+        else                                   chunksInFlight = true;
+        continue;
+      }
 
-            case CTaskDefinition::ADER_UPDATE_SOLUTION: {
+      /* Determine whether or not it can be attempted to carry out
+         this task. */
+      bool taskCanBeCarriedOut = true;
+      for(unsigned short ind=0; ind<tasksList[i].nIndMustBeCompleted; ++ind) {
+        if( !taskCompleted[tasksList[i].indMustBeCompleted[ind]] )
+          taskCanBeCarriedOut = false;
+      }
 
-              /*--- Perform the update step for ADER-DG. ---*/
-              const unsigned short level = tasksList[i].timeLevel;
-              ADER_DG_Iteration(nVolElemOwnedPerTimeLevel[level],
-                                nVolElemOwnedPerTimeLevel[level+1]);
-              taskCarriedOut = taskCompleted[i] = true;
-              break;
-            }
+      if( !taskCanBeCarriedOut ) continue;
 
-            default: {
+      /* Launch the task or carry it out. The only tasks that may fail are
+         the completion of the non-blocking communication. */
+      if( taskChunkBounds[i].size() ) {
+        taskThreadPool->LaunchTask(i, taskChunkBounds[i]);
+        progress = chunksInFlight = taskLaunched[i] = true;
+      }
+      else if( ProcessTask_DG(i, numerics, config, false, workArray) )
+        progress = taskCompleted[i] = true;
+      else if(indCommPending < 0)
+        indCommPending = i;
+    }
 
-              cout << "Task not defined. This should not happen." << endl;
-              exit(1);
-            }
-          }
+    /*--- If no progress was made, this thread helps carrying out the chunks.
+          If there are no chunks left and no chunks in progress, the next
+          tasks are waiting for a communication to be completed. ---*/
+    if( !progress ) {
+      if( !taskThreadPool->RunChunk() ) {
+        if(!chunksInFlight && (indCommPending >= 0)) {
+          ProcessTask_DG(indCommPending, numerics, config, true, workArray);
+          taskCompleted[indCommPending] = true;
         }
-
-        /* Break the inner loop if a task has been carried out. */
-        if( taskCarriedOut ) break;
+#ifdef HAVE_PTHREAD
+        else sched_yield();
+#endif
       }
-
-      /* Break the outer loop if a task has been carried out. */
-      if( taskCarriedOut ) break;
     }
 
     /* Update the value of lowestIndexInList. */
@@ -4328,12 +4825,55 @@ void CFEM_DG_EulerSolver::ProcessTaskList_DG(CGeometry *geometry,  CSolver **sol
   }
 }
 
+void CFEM_DG_EulerSolver::ProcessTaskChunk_DG(void             *solver,
+                                              const CTaskChunk &chunk) {
+
+  /* Retrieve the solver and the work array of the thread that carries
+     out this chunk. */
+  CFEM_DG_EulerSolver *DGSolver = (CFEM_DG_EulerSolver *) solver;
+
+  CConfig   *config    = DGSolver->configTaskChunks;
+  su2double *workArray = DGSolver->workArrayThreads[DGSolver->taskThreadPool->GetThreadIndex()].data();
+
+  /*--- Carry out the chunk of the task. ---*/
+  switch( DGSolver->tasksList[chunk.indTask].task ) {
+
+    case CTaskDefinition::ADER_PREDICTOR_STEP_COMM_ELEMENTS:
+    case CTaskDefinition::ADER_PREDICTOR_STEP_INTERNAL_ELEMENTS: {
+      DGSolver->ADER_DG_PredictorStep(config, chunk.indBeg, chunk.indEnd, workArray);
+      break;
+    }
+
+    case CTaskDefinition::VOLUME_RESIDUAL: {
+      DGSolver->Volume_Residual(config, chunk.indBeg, chunk.indEnd, workArray);
+      break;
+    }
+
+    case CTaskDefinition::SURFACE_RESIDUAL_OWNED_ELEMENTS:
+    case CTaskDefinition::SURFACE_RESIDUAL_HALO_ELEMENTS: {
+
+      /* The residuals of the faces of this chunk are stored from the
+         starting position of the first face of the chunk onwards. */
+      unsigned long indResFaces = DGSolver->startLocResInternalFace[chunk.indBeg];
+      DGSolver->ResidualFaces(config, chunk.indBeg, chunk.indEnd, indResFaces,
+                              DGSolver->numericsTaskChunks[CONV_TERM], workArray);
+      break;
+    }
+
+    default: {
+
+      cout << "Task cannot be split in chunks. This should not happen." << endl;
+      exit(1);
+    }
+  }
+}
+
 void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolver **solver_container,
                                                     CNumerics **numerics, CConfig *config,
                                                     unsigned short iMesh, unsigned short RunTime_EqSystem) {
   /* Preprocessing. */
   Preprocessing(geometry, solver_container, config, iMesh, 0, RunTime_EqSystem, false);
-  TolerancesADERPredictorStep();
+  TolerancesADERPredictorStep(config);
 
   /* Process the tasks list to carry out one ADER space time integration step. */
   ProcessTaskList_DG(geometry, solver_container, numerics, config, iMesh);
@@ -4342,7 +4882,7 @@ void CFEM_DG_EulerSolver::ADER_SpaceTimeIntegration(CGeometry *geometry,  CSolve
   Postprocessing(geometry, solver_container, config, iMesh);
 }
 
-void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(void) {
+void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(CConfig *config) {
 
   /* Determine the maximum values of the conservative variables of the
      locally stored DOFs. Make a distinction between 2D and 3D for
@@ -4378,7 +4918,7 @@ void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(void) {
   TolSolADER.resize(nVar);
 
 #ifdef HAVE_MPI
-  SU2_MPI::Allreduce(URef, TolSolADER.data(), nVar, MPI_DOUBLE, MPI_MAX,
+  SU2_MPI::Allreduce(URef, TolSolADER.data(), nVar, MPI_SU2DOUBLE, MPI_MAX,
                      MPI_COMM_WORLD);
 #else
   for(unsigned short i=0; i<nVar; ++i) TolSolADER[i] = URef[i];
@@ -4392,7 +4932,8 @@ void CFEM_DG_EulerSolver::TolerancesADERPredictorStep(void) {
 
   /* Currently the maximum values of the conserved variables are stored.
      Multiply by the relative tolerance to obtain the true tolerance values. */
-  for(unsigned short i=0; i<nVar; ++i) TolSolADER[i] *= 1.e-6;
+  const su2double tolRel = config->GetTol_Predictor_ADER_DG();
+  for(unsigned short i=0; i<nVar; ++i) TolSolADER[i] *= tolRel;
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
@@ -4405,6 +4946,7 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
   const unsigned short nTimeIntegrationPoints = config->GetnTimeIntegrationADER_DG();
   const su2double     *timeIntegrationWeights = config->GetWeightsIntegrationADER_DG();
   const bool          useAliasedPredictor     = config->GetKind_ADER_Predictor() == ADER_ALIASED_PREDICTOR;
+  const unsigned short maxIterPredictor       = config->GetMaxIter_Predictor_ADER_DG();
 
    /* Determine the number of solution entities that are treated simultaneously
       in the matrix products to obtain good gemm performance. A solution entity
@@ -4478,10 +5020,12 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
 
     /*-------------------------------------------------------------------------*/
     /*--- Iterative algorithm to compute the predictor solution for all     ---*/
-    /*--- the time DOFs of this element simultaneously.                     ---*/
+    /*--- the time DOFs of this element simultaneously. The iterations stop ---*/
+    /*--- when the update of all DOFs is below the tolerance or when the    ---*/
+    /*--- maximum number of iterations is reached.                          ---*/
     /*-------------------------------------------------------------------------*/
 
-    for(;;) {
+    for(unsigned short iterPredictor=1; ; ++iterPredictor) {
 
       /* Initialize the total residual to zero. */
       for(unsigned short i=0; i<(NPadResTot*nDOFs); ++i) resTot[i] = 0.0;
@@ -4902,8 +5446,9 @@ void CFEM_DG_EulerSolver::ADER_DG_PredictorStep(CConfig             *config,
         }
       }
 
-      /* Break the iteration loop if the solution is considered converged. */
-      if( converged ) break;
+      /* Break the iteration loop if the solution is considered converged
+         or if the maximum number of iterations has been reached. */
+      if(converged || iterPredictor >= maxIterPredictor) break;
     }
 
     /* Store the predictor solution in the correct location of
@@ -4926,13 +5471,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -4945,6 +5490,10 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   su2double *gradFluxYInt = gradFluxXInt + nDim*NPad*nInt;
   su2double *divFlux      = work;
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = gradFluxYInt + nDim*NPad*nInt;
+
   /* Determine the offset between the r-derivatives and s-derivatives of
      the fluxes. */
   const unsigned short offDeriv = NPad*nInt;
@@ -4981,8 +5530,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double v            = DensityInv*solDOF[2];
       const su2double StaticEnergy = DensityInv*solDOF[3] - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5005,8 +5554,10 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxXDOF, gradFluxXInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxYDOF, gradFluxYInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5031,7 +5582,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -5068,7 +5620,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, 1, NPad, sol, solInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5085,7 +5638,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = elem->metricTerms.data()
+                                     + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -5111,7 +5665,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
@@ -5122,13 +5677,13 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   /* Set the pointers for fluxes in the DOFs, the gradient of the fluxes in
@@ -5143,6 +5698,10 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   su2double *gradFluxZInt = gradFluxYInt + nDim*NPad*nInt;
   su2double *divFlux      = work;
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = gradFluxZInt + nDim*NPad*nInt;
+
   /* Determine the offset between the r-derivatives and s-derivatives, which is
      also the offset between s- and t-derivatives, of the fluxes. */
   const unsigned short offDeriv = NPad*nInt;
@@ -5181,8 +5740,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double w            = DensityInv*solDOF[3];
       const su2double StaticEnergy = DensityInv*solDOF[4] - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
 
       /* The Cartesian fluxes in the x-direction. */
       const su2double uRel = u - gridVel[0];
@@ -5215,9 +5774,12 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxXDOF, gradFluxXInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxYDOF, gradFluxYInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxZDOF, gradFluxZInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -5247,7 +5809,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -5296,7 +5859,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, 1, NPad, sol, solInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5313,7 +5877,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = elem->metricTerms.data()
+                                     + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -5342,7 +5907,8 @@ void CFEM_DG_EulerSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -5353,6 +5919,9 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5361,11 +5930,12 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /* Get the necessary information from the standard element. */
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = solAndGradInt + 3*NPad*nInt;
+
   /* Check if a body force is present and set it accordingly. */
   su2double bodyForceX = 0.0, bodyForceY = 0.0;
   if( config->GetBody_Force() ) {
@@ -5387,7 +5957,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(0, nDim+1, NPad, sol, solAndGradInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the inviscid fluxes, multiplied by the   ---*/
@@ -5421,8 +5992,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5435,7 +6006,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5502,7 +6074,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
@@ -5513,6 +6086,9 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                                  su2double            *res,
                                                                  su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Set the pointers for solAndGradInt and divFlux to work. The same array
      can be used for both help arrays. */
   su2double *solAndGradInt = work;
@@ -5521,11 +6097,12 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- Get the necessary information from the standard element. ---*/
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
-  const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = solAndGradInt + 4*NPad*nInt;
+
   /* Check if a body force is present and set it accordingly. */
   su2double bodyForceX = 0.0, bodyForceY = 0.0, bodyForceZ = 0.0;
   if( config->GetBody_Force() ) {
@@ -5549,7 +6126,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- the call to blasFunctions->gemm is nInt*(nDim+1).                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(0, nDim+1, NPad, sol, solAndGradInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--- Loop over the number of entities that are treated simultaneously. */
   for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -5587,8 +6165,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double kinEnergy    = 0.5*(u*u + v*v + w*w);
       const su2double StaticEnergy = rhoInv*rE - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Set the pointer to the grid velocities in this integration point.
@@ -5601,7 +6179,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       const su2double drdx = metricTerms[1];
       const su2double drdy = metricTerms[2];
@@ -5688,7 +6267,8 @@ void CFEM_DG_EulerSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_EulerSolver::ADER_DG_TimeInterpolatePredictorSol(CConfig             *config,
@@ -5797,6 +6377,9 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
                                           const unsigned long elemEnd,
                                           su2double           *workArray) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : NULL;
@@ -5834,9 +6417,6 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
     /*--- Set the pointers for the local arrays. ---*/
@@ -5845,6 +6425,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
 
+    /* Work array for the sum-factorization, if used, located after the
+       local arrays of this function. */
+    su2double *workSumFact = fluxes + nInt*NPad*nDim;
+
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
     /*---         the element.                                             ---*/
@@ -5867,7 +6451,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product to determine
        the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, 1, NPad, solDOFs, solInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -5893,7 +6478,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+                                         + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
@@ -5918,8 +6503,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -5981,7 +6566,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             /* Easier storage of the metric terms and grid velocities
                in this integration point. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+                                         + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
             const su2double Jac          = metricTerms[0];
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
 
@@ -6013,8 +6598,8 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
             const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
             /*--- Compute the pressure. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure = FluidModel->GetPressure();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure = fluidModel->GetPressure();
 
             /* Compute the relative velocities w.r.t. the grid. */
             const su2double uRel = u - gridVel[0];
@@ -6105,7 +6690,7 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
         /* Determine the integration weight multiplied by the Jacobian. */
         const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                     + i*nMetricPerPoint;
+                                     + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
         const su2double weightJac    = weights[i]*metricTerms[0];
 
         /* Set the pointer to the coordinates in this integration point and
@@ -6136,14 +6721,16 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    standardElementsSol[ind].ProductDerBasisIntegrationTrans(NPad, fluxes, solDOFs, workSumFact,
+                                                             blasFunctions, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, sources, solInt, workSumFact,
+                                                            blasFunctions, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -7100,7 +7687,7 @@ void CFEM_DG_EulerSolver::Pressure_Forces(CGeometry *geometry, CConfig *config)
 
   /* Sum up all the data from all ranks. The result will be available on all ranks. */
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-    SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), nCommSize, MPI_DOUBLE,
+    SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), nCommSize, MPI_SU2DOUBLE,
                        MPI_SUM, MPI_COMM_WORLD);
   }
 
@@ -7212,20 +7799,148 @@ void CFEM_DG_EulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **so
 
     /*--- The local L2 norms must be added to obtain the
           global value. Also check for divergence. ---*/
-    vector<su2double> rbufRes(nVar);
-    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    vector<accumdouble> rbufRMS(nVar);
+    SU2_MPI::Allreduce(Residual_RMS, rbufRMS.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      if (rbufRMS[iVar] != rbufRMS[iVar])
+        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+
+      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRMS[iVar]/nDOFsGlobal)));
+    }
+
+    /*--- The global maximum norms must be obtained. ---*/
+    vector<su2double> rbufRes(nVar*size);
+    SU2_MPI::Allgather(Residual_Max, nVar, MPI_SU2DOUBLE, rbufRes.data(),
+                       nVar, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+
+    vector<unsigned long> rbufPoint(nVar*size);
+    SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
+                       nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+
+    vector<su2double> sbufCoor(nDim*nVar);
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      for(unsigned short iDim=0; iDim<nDim; ++iDim)
+        sbufCoor[iVar*nDim+iDim] = Point_Max_Coord[iVar][iDim];
+    }
+
+    vector<su2double> rbufCoor(nDim*nVar*size);
+    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_SU2DOUBLE, rbufCoor.data(),
+                       nVar*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+
+    for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+      for(int proc=0; proc<size; ++proc)
+        AddRes_Max(iVar, rbufRes[proc*nVar+iVar], rbufPoint[proc*nVar+iVar],
+                   &rbufCoor[proc*nVar*nDim+iVar*nDim]);
+    }
+  }
+
+#else
+  /*--- Sequential mode. Check for a divergence of the solver and compute
+        the L2-norm of the residuals. ---*/
+  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+
+    if(GetRes_RMS(iVar) != GetRes_RMS(iVar))
+      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(GetRes_RMS(iVar)/nDOFsGlobal)));
+  }
+
+#endif
+}
+
+void CFEM_DG_EulerSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container,
+                                                  CConfig *config) {
+
+  for(unsigned short iVar=0; iVar<nVar; ++iVar) {
+    SetRes_RMS(iVar, 0.0);
+    SetRes_Max(iVar, 0.0, 0);
+  }
+
+  /* Easier storage of the number of entries of the owned DOFs, which are
+     stored contiguously at the start of the solution and residual vectors. */
+  const unsigned long nEntriesOwned = nVar*nDOFsLocOwned;
+
+  /*--- Store the unperturbed residual, which has just been computed in the
+        space integration, and the global norm of the unperturbed solution,
+        which is needed to determine the perturbation of the products. ---*/
+  VecResDOFsRefImplicit.assign(VecResDOFs.begin(), VecResDOFs.begin()+nEntriesOwned);
+
+  su2double normLocal = 0.0;
+  for(unsigned long i=0; i<nEntriesOwned; ++i)
+    normLocal += VecSolDOFs[i]*VecSolDOFs[i];
+
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&normLocal, &normSolRefImplicit, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+  normSolRefImplicit = normLocal;
+#endif
+  normSolRefImplicit = sqrt(normSolRefImplicit);
+
+  /*--- Solve the linear system (I/dt + dR/dU) dU = -R with FGMRES. The pseudo
+        time term is used as preconditioner. ---*/
+  CSysVector rhs(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+  CSysVector dSol(nDOFsLocOwned, nDOFsLocOwned, nVar, 0.0);
+
+  for(unsigned long i=0; i<nEntriesOwned; ++i) rhs[i] = -VecResDOFsRefImplicit[i];
+
+  CFEM_DG_JacobianFreeProduct      matVec(this, geometry, solver_container, config);
+  CFEM_DG_PseudoTimePreconditioner precond(this);
+
+  CSysSolve system;
+  su2double linSolRes;
+  const unsigned long nIterLin = system.FGMRES_LinSolver(rhs, dSol, matVec, precond,
+                                                         config->GetLinear_Solver_Error(),
+                                                         config->GetLinear_Solver_Iter(),
+                                                         &linSolRes, false);
+  SetIterLinSolver(nIterLin);
+
+  /*--- Update the solution by looping over the owned volume elements. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+
+    /* Set the pointers for the residual, solution and update of this element. */
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    const su2double *res       = VecResDOFsRefImplicit.data() + offset;
+    su2double *solDOFs         = VecSolDOFs.data()            + offset;
+
+    /* Loop over the DOFs for this element and update the solution and the L2 norm. */
+    unsigned int i = 0;
+    for(unsigned short j=0; j<volElem[l].nDOFsSol; ++j) {
+      const unsigned long globalIndex = volElem[l].offsetDOFsSolGlobal + j;
+      const su2double *coor = volElem[l].coorSolDOFs.data() + j*nDim;
+
+      for(unsigned short iVar=0; iVar<nVar; ++iVar, ++i) {
+        solDOFs[i] += dSol[offset+i];
+
+        AddRes_RMS(iVar, res[i]*res[i]);
+        AddRes_Max(iVar, fabs(res[i]), globalIndex, coor);
+      }
+    }
+  }
+
+  /*--- Compute the root mean square residual. Note that the SetResidual_RMS
+        function cannot be used, because that is for the FV solver.    ---*/
+
+#ifdef HAVE_MPI
+  /* Parallel mode. Disable the reduce for the residual to avoid overhead if requested. */
+  if (config->GetConsole_Output_Verb() == VERB_HIGH) {
+
+    /*--- The local L2 norms must be added to obtain the
+          global value. Also check for divergence. ---*/
+    vector<accumdouble> rbufRMS(nVar);
+    SU2_MPI::Allreduce(Residual_RMS, rbufRMS.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      if (rbufRes[iVar] != rbufRes[iVar])
+      if (rbufRMS[iVar] != rbufRMS[iVar])
         SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
 
-      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRes[iVar]/nDOFsGlobal)));
+      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRMS[iVar]/nDOFsGlobal)));
     }
 
     /*--- The global maximum norms must be obtained. ---*/
-    rbufRes.resize(nVar*size);
-    SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
-                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
+    vector<su2double> rbufRes(nVar*size);
+    SU2_MPI::Allgather(Residual_Max, nVar, MPI_SU2DOUBLE, rbufRes.data(),
+                       nVar, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
     vector<unsigned long> rbufPoint(nVar*size);
     SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
@@ -7238,8 +7953,8 @@ void CFEM_DG_EulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **so
     }
 
     vector<su2double> rbufCoor(nDim*nVar*size);
-    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
-                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_SU2DOUBLE, rbufCoor.data(),
+                       nVar*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
       for(int proc=0; proc<size; ++proc)
@@ -7262,6 +7977,84 @@ void CFEM_DG_EulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **so
 #endif
 }
 
+void CFEM_DG_EulerSolver::JacobianFreeProduct_DG(CGeometry        *geometry,
+                                                 CSolver          **solver_container,
+                                                 CConfig          *config,
+                                                 const CSysVector &u,
+                                                 CSysVector       &v) {
+
+  /* Easier storage of the number of entries of the owned DOFs. */
+  const unsigned long nEntriesOwned = nVar*nDOFsLocOwned;
+
+  /* Return a zero vector if u is zero. */
+  v = 0.0;
+  const su2double normU = u.norm();
+  if(normU == 0.0) return;
+
+  /* Size of the perturbation, which balances the truncation and round off errors. */
+  const su2double eps = sqrt(numeric_limits<passivedouble>::epsilon())
+                      * (1.0+normSolRefImplicit)/normU;
+
+  /*--- Set the perturbed state of the owned DOFs in the working solution and
+        compute the corresponding residual. The halo data is obtained via the
+        communication tasks in the tasks list. ---*/
+  su2double *solWork = VecWorkSolDOFs[0].data();
+  for(unsigned long i=0; i<nEntriesOwned; ++i)
+    solWork[i] = VecSolDOFs[i] + eps*u[i];
+
+  ProcessTaskList_DG(geometry, solver_container, numericsResidual, config, MESH_0);
+
+  /*--- Finite difference of the residual plus the pseudo time term, looping
+        over the owned elements, because the time step is stored per element. ---*/
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned long nItems = nVar*volElem[l].nDOFsSol;
+    const su2double     dtInv  = 1.0/VecDeltaTime[l];
+
+    for(unsigned long i=offset; i<(offset+nItems); ++i)
+      v[i] = (VecResDOFs[i] - VecResDOFsRefImplicit[i])/eps + dtInv*u[i];
+  }
+
+  /* Restore the unperturbed working solution of the owned DOFs. */
+  for(unsigned long i=0; i<nEntriesOwned; ++i)
+    solWork[i] = VecSolDOFs[i];
+}
+
+void CFEM_DG_EulerSolver::PseudoTimePreconditioner_DG(const CSysVector &u,
+                                                      CSysVector       &v) {
+
+  /* Multiply u by the time step of the elements. */
+  for(unsigned long l=0; l<nVolElemOwned; ++l) {
+    const unsigned long offset = nVar*volElem[l].offsetDOFsSolLocal;
+    const unsigned long nItems = nVar*volElem[l].nDOFsSol;
+
+    for(unsigned long i=offset; i<(offset+nItems); ++i)
+      v[i] = VecDeltaTime[l]*u[i];
+  }
+}
+
+CFEM_DG_JacobianFreeProduct::CFEM_DG_JacobianFreeProduct(CFEM_DG_EulerSolver *val_solver,
+                                                         CGeometry           *val_geometry,
+                                                         CSolver             **val_solver_container,
+                                                         CConfig             *val_config) {
+  solver           = val_solver;
+  geometry         = val_geometry;
+  solver_container = val_solver_container;
+  config           = val_config;
+}
+
+void CFEM_DG_JacobianFreeProduct::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->JacobianFreeProduct_DG(geometry, solver_container, config, u, v);
+}
+
+CFEM_DG_PseudoTimePreconditioner::CFEM_DG_PseudoTimePreconditioner(CFEM_DG_EulerSolver *val_solver) {
+  solver = val_solver;
+}
+
+void CFEM_DG_PseudoTimePreconditioner::operator()(const CSysVector & u, CSysVector & v) const {
+  solver->PseudoTimePreconditioner_DG(u, v);
+}
+
 void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                                CConfig *config, unsigned short iRKStep) {
 
@@ -7321,20 +8114,20 @@ void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **
 
     /*--- The local L2 norms must be added to obtain the
           global value. Also check for divergence. ---*/
-    vector<su2double> rbufRes(nVar);
-    SU2_MPI::Allreduce(Residual_RMS, rbufRes.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    vector<accumdouble> rbufRMS(nVar);
+    SU2_MPI::Allreduce(Residual_RMS, rbufRMS.data(), nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
-      if (rbufRes[iVar] != rbufRes[iVar])
+      if (rbufRMS[iVar] != rbufRMS[iVar])
         SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
 
-      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRes[iVar]/nDOFsGlobal)));
+      SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbufRMS[iVar]/nDOFsGlobal)));
     }
 
     /*--- The global maximum norms must be obtained. ---*/
-    rbufRes.resize(nVar*size);
-    SU2_MPI::Allgather(Residual_Max, nVar, MPI_DOUBLE, rbufRes.data(),
-                       nVar, MPI_DOUBLE, MPI_COMM_WORLD);
+    vector<su2double> rbufRes(nVar*size);
+    SU2_MPI::Allgather(Residual_Max, nVar, MPI_SU2DOUBLE, rbufRes.data(),
+                       nVar, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
     vector<unsigned long> rbufPoint(nVar*size);
     SU2_MPI::Allgather(Point_Max, nVar, MPI_UNSIGNED_LONG, rbufPoint.data(),
@@ -7347,8 +8140,8 @@ void CFEM_DG_EulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **
     }
 
     vector<su2double> rbufCoor(nDim*nVar*size);
-    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_DOUBLE, rbufCoor.data(),
-                       nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+    SU2_MPI::Allgather(sbufCoor.data(), nVar*nDim, MPI_SU2DOUBLE, rbufCoor.data(),
+                       nVar*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
 
     for(unsigned short iVar=0; iVar<nVar; ++iVar) {
       for(int proc=0; proc<size; ++proc)
@@ -9710,6 +10503,13 @@ CFEM_DG_NSSolver::CFEM_DG_NSSolver(CGeometry *geometry, CConfig *config, unsigne
     SGSModel     = NULL;
     SGSModelUsed = false;
   }
+
+  /*--- Create the work arrays of the threads, in which the eddy viscosity is
+        computed for chunks of integration points. They grow on demand. ---*/
+  if( SGSModelUsed ) {
+    const unsigned short nThreads = taskThreadPool ? taskThreadPool->GetnThreads() : 1;
+    workSGSThreads.resize(nThreads);
+  }
 }
 
 CFEM_DG_NSSolver::~CFEM_DG_NSSolver(void) {
@@ -10276,7 +11076,7 @@ void CFEM_DG_NSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
 
   /* Sum up all the data from all ranks. The result will be available on all ranks. */
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-    SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), nCommSize, MPI_DOUBLE,
+    SU2_MPI::Allreduce(locBuf.data(), globBuf.data(), nCommSize, MPI_SU2DOUBLE,
                        MPI_SUM, MPI_COMM_WORLD);
   }
 
@@ -10303,7 +11103,7 @@ void CFEM_DG_NSSolver::Friction_Forces(CGeometry *geometry, CConfig *config) {
   /* Determine the maximum heat flux over all ranks. */
   su2double localMax = AllBound_MaxHeatFlux_Visc;
   if (config->GetConsole_Output_Verb() == VERB_HIGH) {
-    SU2_MPI::Allreduce(&localMax, &AllBound_MaxHeatFlux_Visc, 1, MPI_DOUBLE,
+    SU2_MPI::Allreduce(&localMax, &AllBound_MaxHeatFlux_Visc, 1, MPI_SU2DOUBLE,
                        MPI_MAX, MPI_COMM_WORLD);
   }
 #endif
@@ -10511,7 +11311,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
                   /* Compute the true value of the metric terms in this DOF. Note that in
                      metricTerms the metric terms scaled by the Jacobian are stored. */
                   const su2double *metricTerms = volElem[lInd].metricTermsSolDOFs.data()
-                                               + i*nMetricPerPoint;
+                                               + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
                   const su2double JacInv       = 1.0/metricTerms[0];
 
                   const su2double drdx = JacInv*metricTerms[1];
@@ -10630,7 +11430,7 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
                   /* Compute the true value of the metric terms in this DOF. Note that in
                      metricTerms the metric terms scaled by the Jacobian are stored. */
                   const su2double *metricTerms = volElem[lInd].metricTermsSolDOFs.data()
-                                               + i*nMetricPerPoint;
+                                               + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
                   const su2double JacInv       = 1.0/metricTerms[0];
 
                   const su2double drdx = JacInv*metricTerms[1];
@@ -10730,10 +11530,10 @@ void CFEM_DG_NSSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_contai
     if ((config->GetConsole_Output_Verb() == VERB_HIGH) || time_stepping) {
 #ifdef HAVE_MPI
       su2double rbuf_time = Min_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Min_Delta_Time, 1, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
 
       rbuf_time = Max_Delta_Time;
-      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+      SU2_MPI::Allreduce(&rbuf_time, &Max_Delta_Time, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
 #endif
     }
 
@@ -10755,6 +11555,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -10763,10 +11566,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *matDerBasisSolDOFs     = standardElementsSol[ind].GetMatDerBasisFunctionsSolDOFs();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -10787,6 +11587,10 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   su2double *gradSolDOFs  = gradFluxXInt;
   su2double *divFlux      = work;
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = gradFluxYInt + nDim*NPad*nInt;
+
   /* Determine the offset between the r-derivatives and s-derivatives of the
      fluxes in the integration points and the offset between the r-derivatives
      and s-derivatives of the solution in the DOFs. */
@@ -10830,7 +11634,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED, THE
          DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST BE TAKEN. */
       const su2double *metricTerms = elem->metricTermsSolDOFs.data()
-                                   + i*nMetricPerPoint;
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
       const su2double JacInv       = 1.0/metricTerms[0];
 
       const su2double drdx = JacInv*metricTerms[1];
@@ -10858,9 +11662,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[3];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -10914,8 +11718,10 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxXDOF, gradFluxXInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxYDOF, gradFluxYInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -10940,7 +11746,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
          BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -10977,7 +11784,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, 1, NPad, sol, solInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -10994,7 +11802,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = elem->metricTerms.data()
+                                     + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -11020,7 +11829,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig              *config,
@@ -11030,6 +11840,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
                                                            const unsigned short NPad,
                                                            su2double            *res,
                                                            su2double            *work) {
+
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
   /* Constant factor present in the heat flux vector. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
   const su2double factHeatFlux_Turb = Gamma/Prandtl_Turb;
@@ -11038,10 +11851,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-  const su2double *matDerBasisInt         = matBasisInt + nDOFs*nInt;
   const su2double *matDerBasisSolDOFs     = standardElementsSol[ind].GetMatDerBasisFunctionsSolDOFs();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -11064,6 +11874,10 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   su2double *gradSolDOFs  = gradFluxXInt;
   su2double *divFlux      = work;
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = gradFluxZInt + nDim*NPad*nInt;
+
   /* Determine the offset between the r-derivatives and s-derivatives of the
      fluxes in the integration points and the offset between the r-derivatives
      and s-derivatives of the solution in the DOFs. */
@@ -11109,7 +11923,7 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED, THE
          DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST BE TAKEN. */
       const su2double *metricTerms = elem->metricTermsSolDOFs.data()
-                                   + i*nMetricPerPoint;
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
       const su2double JacInv       = 1.0/metricTerms[0];
 
       const su2double drdx = JacInv*metricTerms[1];
@@ -11152,9 +11966,9 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = DensityInv*solDOF[4];
       const su2double StaticEnergy = TotalEnergy - 0.5*(u*u + v*v + w*w);
 
-      FluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
-      const su2double Pressure     = FluidModel->GetPressure();
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+      fluidModel->SetTDState_rhoe(solDOF[0], StaticEnergy);
+      const su2double Pressure     = fluidModel->GetPressure();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
       /* Compute the Cartesian gradients of the velocities and static energy. */
       const su2double dudx = DensityInv*(drudx - u*drhodx);
@@ -11231,9 +12045,12 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- parametric coordinates in the integration points.                  ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxXDOF, gradFluxXInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxYDOF, gradFluxYInt, config);
-  blasFunctions->gemm(nInt*nDim, NPad, nDOFs, matDerBasisInt, fluxZDOF, gradFluxZInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxXDOF, gradFluxXInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxYDOF, gradFluxYInt, workSumFact,
+                                                   blasFunctions, config);
+  standardElementsSol[ind].ProductBasisIntegration(1, nDim+1, NPad, fluxZDOF, gradFluxZInt, workSumFact,
+                                                   blasFunctions, config);
 
   /*--------------------------------------------------------------------------*/
   /*--- Compute the divergence of the fluxes in the integration points,    ---*/
@@ -11263,7 +12080,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the metric terms multiplied by the integration weight. Note that the
          first term in the metric terms is the Jacobian. */
@@ -11312,7 +12130,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
        Use gradFluxYInt to store this solution. */
     su2double *solInt = gradFluxYInt;
 
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, sol, solInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, 1, NPad, sol, solInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*--- Loop over the number of entities that are treated simultaneously. */
     for(unsigned short simul=0; simul<nSimul; ++simul) {
@@ -11329,7 +12148,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
            THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
            THE DATA FOR THIS DOF FOR THE CURRENT TIME INTEGRATION POINT MUST
            BE TAKEN. */
-        const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+        const su2double *metricTerms = elem->metricTerms.data()
+                                     + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
         /* Compute the velocities. */
         const su2double rhoInv = 1.0/solThisInt[0];
@@ -11358,7 +12178,8 @@ void CFEM_DG_NSSolver::ADER_DG_AliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig              *config,
@@ -11369,6 +12190,9 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -11381,9 +12205,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *mat2ndDerBasisInt      = standardElementsSol[ind].GetMat2ndDerBasisFunctionsInt();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -11414,6 +12236,10 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
      after the first derivatives. */
   su2double *secDerSol = solAndGradInt + 3*NPad*nInt;   /*(nDim+1)*NPad*nInt. */
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = secDerSol + 3*NPad*nInt;
+
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 5;  /* nDim*nDim + 1. */
 
@@ -11431,7 +12257,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
 
   /* Compute the solution and the derivatives w.r.t. the parametric coordinates
      in the integration points. The first argument is nInt*(nDim+1). */
-  blasFunctions->gemm(nInt*3, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(0, nDim+1, NPad, sol, solAndGradInt, workSumFact,
+                                                   blasFunctions, config);
 
   /* Compute the second derivatives w.r.t. the parametric coordinates
      in the integration points. */
@@ -11475,13 +12302,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
       /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -11493,7 +12320,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -11524,7 +12352,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
       const su2double *metricTerms2ndDer = elem->metricTerms2ndDer.data()
-                                         + i*nMetric2ndDerPerPoint;
+                                         + (elem->metricTermsConstant ? 0 : i*nMetric2ndDerPerPoint);
 
       /* Compute the Cartesian second derivatives of the independent solution
          variables from the gradients and second derivatives in parametric
@@ -11701,7 +12529,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_2D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig              *config,
@@ -11712,6 +12541,9 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
                                                               su2double            *res,
                                                               su2double            *work) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, the inverse of
      the specific heat at constant volume and ratio lambdaOverMu. */
   const su2double factHeatFlux_Lam  =  Gamma/Prandtl_Lam;
@@ -11724,9 +12556,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   const unsigned short ind                = elem->indStandardElement;
   const unsigned short nInt               = standardElementsSol[ind].GetNIntegration();
   const unsigned short nDOFs              = elem->nDOFsSol;
-  const su2double *matBasisInt            = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
   const su2double *mat2ndDerBasisInt      = standardElementsSol[ind].GetMat2ndDerBasisFunctionsInt();
-  const su2double *basisFunctionsIntTrans = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
   const su2double *weights                = standardElementsSol[ind].GetWeightsIntegration();
 
   unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -11758,6 +12588,10 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
      after the first derivatives. */
   su2double *secDerSol = solAndGradInt + 4*NPad*nInt;  /*(nDim+1)*NPad*nInt. */
 
+  /* Work array for the sum-factorization, if used, located after the
+     local arrays of this function. */
+  su2double *workSumFact = secDerSol + 6*NPad*nInt;
+
   /* Store the number of metric points per integration point for readability. */
   const unsigned short nMetricPerPoint = 10;  /* nDim*nDim + 1. */
 
@@ -11775,7 +12609,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
 
   /* Compute the solution and the derivatives w.r.t. the parametric coordinates
      in the integration points. The first argument is nInt*(nDim+1). */
-  blasFunctions->gemm(nInt*4, NPad, nDOFs, matBasisInt, sol, solAndGradInt, config);
+  standardElementsSol[ind].ProductBasisIntegration(0, nDim+1, NPad, sol, solAndGradInt, workSumFact,
+                                                   blasFunctions, config);
 
   /* Compute the second derivatives w.r.t. the parametric coordinates
      in the integration points. */
@@ -11825,13 +12660,13 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
       const su2double TotalEnergy  = rhoInv*rE;
       const su2double StaticEnergy = TotalEnergy - kinEnergy;
 
-      FluidModel->SetTDState_rhoe(rho, StaticEnergy);
-      const su2double Pressure = FluidModel->GetPressure();
+      fluidModel->SetTDState_rhoe(rho, StaticEnergy);
+      const su2double Pressure = fluidModel->GetPressure();
       const su2double Htot     = rhoInv*(rE + Pressure);
 
        /* Compute the laminar viscosity and its derivative w.r.t. temperature. */
-      const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
-      const su2double dViscLamdT   = FluidModel->GetdmudT_rho();
+      const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
+      const su2double dViscLamdT   = fluidModel->GetdmudT_rho();
 
       /* Set the pointer to the grid velocities in this integration point.
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
@@ -11843,7 +12678,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THIS IS A TEMPORARY IMPLEMENTATION. WHEN AN ACTUAL MOTION IS SPECIFIED,
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
-      const su2double *metricTerms = elem->metricTerms.data() + i*nMetricPerPoint;
+      const su2double *metricTerms = elem->metricTerms.data()
+                                   + (elem->metricTermsConstant ? 0 : i*nMetricPerPoint);
 
       /* Compute the true metric terms. Note in metricTerms the actual metric
          terms multiplied by the Jacobian are stored. */
@@ -11889,7 +12725,7 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
          THE DATA FOR THIS SPATIAL INTEGRATION POINT FOR THE CURRENT TIME
          INTEGRATION POINT MUST BE TAKEN. */
       const su2double *metricTerms2ndDer = elem->metricTerms2ndDer.data()
-                                         + i*nMetric2ndDerPerPoint;
+                                         + (elem->metricTermsConstant ? 0 : i*nMetric2ndDerPerPoint);
 
       /* Compute the Cartesian second derivatives of the independent solution
          variables from the gradients and second derivatives in parametric
@@ -12214,7 +13050,8 @@ void CFEM_DG_NSSolver::ADER_DG_NonAliasedPredictorResidual_3D(CConfig
   /*--- basisFunctionsIntTrans and divFlux.                                ---*/
   /*--------------------------------------------------------------------------*/
 
-  blasFunctions->gemm(nDOFs, NPad, nInt, basisFunctionsIntTrans, divFlux, res, config);
+  standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, divFlux, res, workSumFact,
+                                                        blasFunctions, config);
 }
 
 void CFEM_DG_NSSolver::Shock_Capturing_DG(CConfig             *config,
@@ -12393,11 +13230,88 @@ void CFEM_DG_NSSolver::Shock_Capturing_DG_Persson(const unsigned long elemBeg,
   }
 }
 
+const su2double *CFEM_DG_NSSolver::EddyViscosityVolumeChunk(const unsigned long  elemBeg,
+                                                            const unsigned short llEnd,
+                                                            const unsigned short nInt,
+                                                            const unsigned short NPad,
+                                                            const unsigned short nPoly,
+                                                            const su2double      *solAndGradInt) {
+
+  /* Set the pointers in the work array of this thread. The velocity gradients
+     are stored per component for all integration points of the chunk, such
+     that the model can loop over contiguous data. */
+  const unsigned long nItems  = llEnd*nInt;
+  const unsigned short nGrad  = nDim*nDim;
+  su2double *rho        = GetThreadWorkSGS(nItems*(nGrad+4));
+  su2double *lenScale   = rho        + nItems;
+  su2double *distToWall = lenScale   + nItems;
+  su2double *eddyVisc   = distToWall + nItems;
+  su2double *velGrad    = eddyVisc   + nItems;
+
+  /* Determine the offset between the solution variables and the r-derivatives,
+     which is also the offset between the r- and s-derivatives and the offset
+     between s- and t-derivatives. */
+  const unsigned short offDeriv        = NPad*nInt;
+  const unsigned short nMetricPerPoint = nGrad + 1;
+
+  /*--- Loop over the elements of the chunk and their integration points to
+        store the density, the Cartesian velocity gradients, the length scale
+        and the wall distance. ---*/
+  for(unsigned short ll=0; ll<llEnd; ++ll) {
+    const unsigned long lInd = elemBeg + ll;
+    const su2double lenScaleElem = volElem[lInd].lenScale/nPoly;
+
+    for(unsigned short i=0; i<nInt; ++i) {
+      const unsigned long item = ll*nInt + i;
+
+      const su2double *metricTerms = volElem[lInd].metricTerms.data()
+                                   + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
+      const su2double JacInv = 1.0/metricTerms[0];
+      const su2double *sol   = solAndGradInt + i*NPad + ll*nVar;
+
+      /* Cartesian gradients of the density and momentum. */
+      su2double solGradCart[4][3];
+      for(unsigned short iVar=0; iVar<=nDim; ++iVar) {
+        for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+          solGradCart[iVar][iDim] = 0.0;
+          for(unsigned short jDim=0; jDim<nDim; ++jDim)
+            solGradCart[iVar][iDim] += sol[(jDim+1)*offDeriv + iVar]
+                                     * (JacInv*metricTerms[1+jDim*nDim+iDim]);
+        }
+      }
+
+      /* Velocity gradients from the gradients of the conservative variables. */
+      const su2double rhoInv = 1.0/sol[0];
+      for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+        const su2double vel = sol[iDim+1]*rhoInv;
+        for(unsigned short jDim=0; jDim<nDim; ++jDim)
+          velGrad[(iDim*nDim+jDim)*nItems + item] = rhoInv*(solGradCart[iDim+1][jDim]
+                                                  -         vel*solGradCart[0][jDim]);
+      }
+
+      rho[item]        = sol[0];
+      lenScale[item]   = lenScaleElem;
+      distToWall[item] = volElem[lInd].wallDistance[i];
+    }
+  }
+
+  /* Evaluate the SGS model for all integration points of the chunk. */
+  if(nDim == 2)
+    SGSModel->ComputeEddyViscosityChunk_2D(nItems, rho, velGrad, lenScale, distToWall, eddyVisc);
+  else
+    SGSModel->ComputeEddyViscosityChunk_3D(nItems, rho, velGrad, lenScale, distToWall, eddyVisc);
+
+  return eddyVisc;
+}
+
 void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
                                        const unsigned long elemBeg,
                                        const unsigned long elemEnd,
                                        su2double           *workArray) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /*--- Determine whether a body force term is present. ---*/
   bool body_force = config->GetBody_Force();
   const su2double *body_force_vector = body_force ? config->GetBody_Force_Vector() : NULL;
@@ -12439,9 +13353,6 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Get the required data from the corresponding standard element. */
     const unsigned short nInt            = standardElementsSol[ind].GetNIntegration();
     const unsigned short nDOFs           = volElem[l].nDOFsSol;
-    const su2double *matBasisInt         = standardElementsSol[ind].GetMatBasisFunctionsIntegration();
-    const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
-    const su2double *matBasisIntTrans    = standardElementsSol[ind].GetBasisFunctionsIntegrationTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
     unsigned short nPoly = standardElementsSol[ind].GetNPoly();
@@ -12453,6 +13364,10 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
 
+    /* Work array for the sum-factorization, if used, located after the
+       local arrays of this function. */
+    su2double *workSumFact = fluxes + nInt*NPad*nDim;
+
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
     /*---         w.r.t. the parametric coordinates in the integration     ---*/
@@ -12477,7 +13392,8 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
        of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+    standardElementsSol[ind].ProductBasisIntegration(0, nDim+1, NPad, solDOFs, solAndGradInt, workSumFact,
+                                                     blasFunctions, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -12496,8 +13412,14 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
       case 2: {
 
-        /* 2D simulation. Loop over the chunk of elements and loop over the
-           integration points of the elements to compute the fluxes. */
+        /* 2D simulation. If an SGS model is used, compute the eddy viscosity
+           in all integration points of the chunk with one call to the model. */
+        const su2double *eddyViscChunk = NULL;
+        if( SGSModelUsed )
+          eddyViscChunk = EddyViscosityVolumeChunk(l, llEnd, nInt, NPad, nPoly, solAndGradInt);
+
+        /* Loop over the chunk of elements and loop over the integration
+           points of the elements to compute the fluxes. */
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
@@ -12508,7 +13430,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+                                         + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
             const su2double JacInv       = 1.0/Jac;
@@ -12571,18 +13493,13 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
-            if( SGSModelUsed ) {
-              const su2double lenScale = volElem[lInd].lenScale/nPoly;
-              ViscosityTurb = SGSModel->ComputeEddyViscosity_2D(sol[0], dudx, dudy,
-                                                                dvdx, dvdy, lenScale,
-                                                                volElem[lInd].wallDistance[i]);
-            }
+            if( SGSModelUsed ) ViscosityTurb = eddyViscChunk[ll*nInt + i];
 
             /* Compute the total viscosity and heat conductivity. Note that the heat
                conductivity is divided by the Cv, because gradients of internal energy
@@ -12659,8 +13576,14 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
       case 3: {
 
-        /* 3D simulation. Loop over the chunk of elements and loop over the
-           integration points of the elements to compute the fluxes. */
+        /* 3D simulation. If an SGS model is used, compute the eddy viscosity
+           in all integration points of the chunk with one call to the model. */
+        const su2double *eddyViscChunk = NULL;
+        if( SGSModelUsed )
+          eddyViscChunk = EddyViscosityVolumeChunk(l, llEnd, nInt, NPad, nPoly, solAndGradInt);
+
+        /* Loop over the chunk of elements and loop over the integration
+           points of the elements to compute the fluxes. */
         for(unsigned short ll=0; ll<llEnd; ++ll) {
           const unsigned short llNVar = ll*nVar;
           const unsigned long  lInd   = l + ll;
@@ -12671,7 +13594,7 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             /* Easier storage of the metric terms and grid velocities in this
                integration point and compute the inverse of the Jacobian. */
             const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                         + i*nMetricPerPoint;
+                                         + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
             const su2double *gridVel     = volElem[lInd].gridVelocities.data() + i*nDim;
             const su2double Jac          = metricTerms[0];
             const su2double JacInv       = 1.0/Jac;
@@ -12764,19 +13687,13 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
             const su2double divVel = dudx + dvdy + dwdz;
 
             /*--- Compute the pressure and the laminar viscosity. ---*/
-            FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-            const su2double Pressure     = FluidModel->GetPressure();
-            const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+            fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+            const su2double Pressure     = fluidModel->GetPressure();
+            const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
             /*--- If an SGS model is used the eddy viscosity must be computed. ---*/
             su2double ViscosityTurb = 0.0;
-            if( SGSModelUsed ) {
-              const su2double lenScale = volElem[lInd].lenScale/nPoly;
-              ViscosityTurb = SGSModel->ComputeEddyViscosity_3D(sol[0], dudx, dudy, dudz,
-                                                                dvdx, dvdy, dvdz, dwdx,
-                                                                dwdy, dwdz, lenScale,
-                                                                volElem[lInd].wallDistance[i]);
-            }
+            if( SGSModelUsed ) ViscosityTurb = eddyViscChunk[ll*nInt + i];
 
             /* Compute the total viscosity and heat conductivity. Note that the heat
                conductivity is divided by the Cv, because gradients of internal energy
@@ -12910,13 +13827,13 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
         }
         const su2double StaticEnergy = sol[nVar-1]*rhoInv - kinEner;
 
-        FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-        const su2double ViscosityLam        = FluidModel->GetLaminarViscosity();
-        const su2double ThermalConductivity = FluidModel->GetThermalConductivity();
+        fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+        const su2double ViscosityLam        = fluidModel->GetLaminarViscosity();
+        const su2double ThermalConductivity = fluidModel->GetThermalConductivity();
 
         /* Determine the integration weight multiplied by the Jacobian. */
         const su2double *metricTerms = volElem[lInd].metricTerms.data()
-                                     + i*nMetricPerPoint;
+                                     + (volElem[lInd].metricTermsConstant ? 0 : i*nMetricPerPoint);
         const su2double weightJac    = weights[i]*metricTerms[0];
 
         /* Set the pointer to the coordinates in this integration point and
@@ -12948,14 +13865,16 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    standardElementsSol[ind].ProductDerBasisIntegrationTrans(NPad, fluxes, solDOFs, workSumFact,
+                                                             blasFunctions, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      standardElementsSol[ind].ProductBasisIntegrationTrans(NPad, sources, solAndGradInt, workSumFact,
+                                                            blasFunctions, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -13392,6 +14311,70 @@ void CFEM_DG_NSSolver::ResidualFaces(CConfig             *config,
   }
 }
 
+const su2double *CFEM_DG_NSSolver::EddyViscosityFace(const unsigned short indFaceChunk,
+                                                     const unsigned short nInt,
+                                                     const unsigned short NPad,
+                                                     const su2double      lenScale_LES,
+                                                     const su2double      *solInt,
+                                                     const su2double      *gradSolInt,
+                                                     const su2double      *metricCoorDerivFace,
+                                                     const su2double      *wallDistanceInt) {
+
+  /* Set the pointers in the work array of this thread. The velocity gradients
+     are stored per component for all integration points of the face. */
+  const unsigned short nGrad = nDim*nDim;
+  su2double *rho        = GetThreadWorkSGS(nInt*(nGrad+4));
+  su2double *lenScale   = rho        + nInt;
+  su2double *distToWall = lenScale   + nInt;
+  su2double *eddyVisc   = distToWall + nInt;
+  su2double *velGrad    = eddyVisc   + nInt;
+
+  /* Determine the offset between r- and -s-derivatives, which is also the
+     offset between s- and t-derivatives. */
+  const unsigned short offDeriv = NPad*nInt;
+
+  /*--- Loop over the integration points to store the density, the Cartesian
+        velocity gradients, the length scale and the wall distance. ---*/
+  for(unsigned short i=0; i<nInt; ++i) {
+
+    const unsigned short offPointer = NPad*i + nVar*indFaceChunk;
+    const su2double *metricTerms = metricCoorDerivFace + i*nGrad;
+    const su2double *sol         = solInt     + offPointer;
+    const su2double *dSolDr      = gradSolInt + offPointer;
+
+    /* Cartesian gradients of the density and momentum. */
+    su2double solGradCart[4][3];
+    for(unsigned short iVar=0; iVar<=nDim; ++iVar) {
+      for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+        solGradCart[iVar][iDim] = 0.0;
+        for(unsigned short jDim=0; jDim<nDim; ++jDim)
+          solGradCart[iVar][iDim] += dSolDr[jDim*offDeriv + iVar]*metricTerms[jDim*nDim+iDim];
+      }
+    }
+
+    /* Velocity gradients from the gradients of the conservative variables. */
+    const su2double rhoInv = 1.0/sol[0];
+    for(unsigned short iDim=0; iDim<nDim; ++iDim) {
+      const su2double vel = rhoInv*sol[iDim+1];
+      for(unsigned short jDim=0; jDim<nDim; ++jDim)
+        velGrad[(iDim*nDim+jDim)*nInt + i] = rhoInv*(solGradCart[iDim+1][jDim]
+                                           -         vel*solGradCart[0][jDim]);
+    }
+
+    rho[i]        = sol[0];
+    lenScale[i]   = lenScale_LES;
+    distToWall[i] = wallDistanceInt ? wallDistanceInt[i] : 0.0;
+  }
+
+  /* Evaluate the SGS model for all integration points of the face. */
+  if(nDim == 2)
+    SGSModel->ComputeEddyViscosityChunk_2D(nInt, rho, velGrad, lenScale, distToWall, eddyVisc);
+  else
+    SGSModel->ComputeEddyViscosityChunk_3D(nInt, rho, velGrad, lenScale, distToWall, eddyVisc);
+
+  return eddyVisc;
+}
+
 void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem,
                                              const unsigned short    indFaceChunk,
                                              const unsigned short    nInt,
@@ -13421,6 +14404,13 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
 
   const su2double lenScale_LES = adjVolElem->lenScale/nPoly;
 
+  /* If an SGS model is used, compute the eddy viscosity in all
+     integration points of the face with one call to the model. */
+  const su2double *eddyViscInt = NULL;
+  if( SGSModelUsed )
+    eddyViscInt = EddyViscosityFace(indFaceChunk, nInt, NPad, lenScale_LES, solInt,
+                                    gradSolInt, metricCoorDerivFace, wallDistanceInt);
+
   /* Determine the offset between r- and -s-derivatives, which is also the
      offset between s- and t-derivatives. */
   const unsigned short offDeriv = NPad*nInt;
@@ -13474,9 +14464,11 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
 
         su2double Viscosity, kOverCv;
 
+        const su2double *eddyVisc = eddyViscInt ? eddyViscInt + i : NULL;
+
         ViscousNormalFluxIntegrationPoint_2D(sol, solGradCart, normal, HeatFlux,
                                              factHeatFlux, wallDist, lenScale_LES,
-                                             Viscosity, kOverCv, normalFlux);
+                                             eddyVisc, Viscosity, kOverCv, normalFlux);
 
         const unsigned short ind = indFaceChunk*nInt + i;
         viscosityInt[ind] = Viscosity;
@@ -13548,9 +14540,11 @@ void CFEM_DG_NSSolver::ViscousNormalFluxFace(const CVolumeElementFEM *adjVolElem
 
         su2double Viscosity, kOverCv;
 
+        const su2double *eddyVisc = eddyViscInt ? eddyViscInt + i : NULL;
+
         ViscousNormalFluxIntegrationPoint_3D(sol, solGradCart, normal, HeatFlux,
                                              factHeatFlux, wallDist, lenScale_LES,
-                                             Viscosity, kOverCv, normalFlux);
+                                             eddyVisc, Viscosity, kOverCv, normalFlux);
 
         const unsigned short ind = indFaceChunk*nInt + i;
         viscosityInt[ind] = Viscosity;
@@ -13569,10 +14563,14 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
                                                             const su2double factHeatFlux,
                                                             const su2double wallDist,
                                                             const su2double lenScale_LES,
+                                                            const su2double *eddyVisc,
                                                                   su2double &Viscosity,
                                                                   su2double &kOverCv,
                                                                   su2double *normalFlux) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, namely the ratio of
      thermal conductivity and viscosity. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
@@ -13604,12 +14602,14 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_2D(const su2double *sol
   const su2double divVel = dudx + dvdy;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
-  if( SGSModelUsed )
+  if( eddyVisc )
+    ViscosityTurb = eddyVisc[0];
+  else if( SGSModelUsed )
     ViscosityTurb = SGSModel->ComputeEddyViscosity_2D(sol[0], dudx, dudy, dvdx,
                                                       dvdy, lenScale_LES, wallDist);
 
@@ -13655,10 +14655,14 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
                                                             const su2double factHeatFlux,
                                                             const su2double wallDist,
                                                             const su2double lenScale_LES,
+                                                            const su2double *eddyVisc,
                                                                   su2double &Viscosity,
                                                                   su2double &kOverCv,
                                                                   su2double *normalFlux) {
 
+  /* Get the fluid model of the thread that carries out this function. */
+  CFluidModel *fluidModel = GetThreadFluidModel();
+
   /* Constant factor present in the heat flux vector, namely the ratio of
      thermal conductivity and viscosity. */
   const su2double factHeatFlux_Lam  = Gamma/Prandtl_Lam;
@@ -13700,12 +14704,14 @@ void CFEM_DG_NSSolver::ViscousNormalFluxIntegrationPoint_3D(const su2double *sol
   const su2double divVel = dudx + dvdy + dwdz;
 
   /*--- Compute the laminar viscosity. ---*/
-  FluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
-  const su2double ViscosityLam = FluidModel->GetLaminarViscosity();
+  fluidModel->SetTDState_rhoe(sol[0], StaticEnergy);
+  const su2double ViscosityLam = fluidModel->GetLaminarViscosity();
 
   /*--- Compute the eddy viscosity, if needed. ---*/
   su2double ViscosityTurb = 0.0;
-  if( SGSModelUsed )
+  if( eddyVisc )
+    ViscosityTurb = eddyVisc[0];
+  else if( SGSModelUsed )
     ViscosityTurb = SGSModel->ComputeEddyViscosity_3D(sol[0], dudx, dudy, dudz,
                                                       dvdx, dvdy, dvdz, dwdx,
                                                       dwdy, dwdz, lenScale_LES,
@@ -14603,10 +15609,10 @@ void CFEM_DG_NSSolver::BC_Sym_Plane(CConfig                  *config,
             su2double Viscosity, kOverCv;
 
             ViscousNormalFluxIntegrationPoint_2D(UR, URGradCart, normals, 0.0, 1.0,
-                                                 wallDist, lenScale_LES, Viscosity,
+                                                 wallDist, lenScale_LES, NULL, Viscosity,
                                                  kOverCv, viscFluxR);
             ViscousNormalFluxIntegrationPoint_2D(UL, ULGradCart, normals, 0.0, 1.0,
-                                                 wallDist, lenScale_LES, Viscosity,
+                                                 wallDist, lenScale_LES, NULL, Viscosity,
                                                  kOverCv, viscFluxL);
             viscosityInt[nInt*llRel+i] = Viscosity;
             kOverCvInt[nInt*llRel+i]   = kOverCv;
@@ -14749,10 +15755,10 @@ void CFEM_DG_NSSolver::BC_Sym_Plane(CConfig                  *config,
             su2double Viscosity, kOverCv;
 
             ViscousNormalFluxIntegrationPoint_3D(UR, URGradCart, normals, 0.0, 1.0,
-                                                 wallDist, lenScale_LES, Viscosity,
+                                                 wallDist, lenScale_LES, NULL, Viscosity,
                                                  kOverCv, viscFluxR);
             ViscousNormalFluxIntegrationPoint_3D(UL, ULGradCart, normals, 0.0, 1.0,
-                                                 wallDist, lenScale_LES, Viscosity,
+                                                 wallDist, lenScale_LES, NULL, Viscosity,
                                                  kOverCv, viscFluxL);
             viscosityInt[nInt*llRel+i] = Viscosity;
             kOverCvInt[nInt*llRel+i]   = kOverCv;
@@ -15580,9 +16586,26 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
                                         su2double          *kOverCvInt,
                                         CWallModel         *wallModel) {
 
+  /* The wall model is evaluated for all the integration points of the
+     simultaneously treated faces in one call. Allocate the memory for the
+     data in the exchange locations, which is stored per integration point
+     with index l*nInt + ii. Also the profiles of the previous call of the
+     wall model are copied, such that they can be used as initial guess. */
+  const unsigned short nPointsExchange = nFaceSimul*nInt;
+  const unsigned short sizeProfile     = wallModel->GetSizeProfile();
+
+  vector<su2double> tExchange(nPointsExchange),   velExchange(nPointsExchange);
+  vector<su2double> muExchange(nPointsExchange),  pExchange(nPointsExchange);
+  vector<su2double> tauWall(nPointsExchange),     qWall(nPointsExchange);
+  vector<su2double> dirTanExchange(nPointsExchange*nDim);
+  vector<su2double> profiles(nPointsExchange*sizeProfile);
+
+  for(unsigned short l=0; l<nFaceSimul; ++l)
+    for(unsigned long k=0; k<surfElem[l].wallModelProfile.size(); ++k)
+      profiles[l*nInt*sizeProfile+k] = surfElem[l].wallModelProfile[k];
+
   /* Loop over the simultaneously treated faces. */
   for(unsigned short l=0; l<nFaceSimul; ++l) {
-    const unsigned short llNVar = l*nVar;
 
     /* Loop over the donors for this boundary face. */
     for(unsigned long j=0; j<surfElem[l].donorsWallFunction.size(); ++j) {
@@ -15628,9 +16651,6 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double eInt    = rhoInv*solInt[nVar-1] - 0.5*vel2Mag;
 
         FluidModel->SetTDState_rhoe(solInt[0], eInt);
-        const su2double Pressure = FluidModel->GetPressure();
-        const su2double Temperature = FluidModel->GetTemperature();
-        const su2double LaminarViscosity= FluidModel->GetLaminarViscosity();
 
         /* Subtract the prescribed wall velocity, i.e. grid velocity
            from the velocity in the exchange point. */
@@ -15647,37 +16667,62 @@ void CFEM_DG_NSSolver::WallTreatmentViscousFluxes(
         su2double velTan = sqrt(vel[0]*vel[0] + vel[1]*vel[1] + vel[2]*vel[2]);
         velTan = max(velTan,1.e-25);
 
-        su2double dirTan[] = {0.0, 0.0, 0.0};
+        /* Store the data of the exchange location, which is needed
+           in the wall model and in the computation of the fluxes. */
+        const unsigned short ind = l*nInt + ii;
+        tExchange[ind]   = FluidModel->GetTemperature();
+        velExchange[ind] = velTan;
+        muExchange[ind]  = FluidModel->GetLaminarViscosity();
+        pExchange[ind]   = FluidModel->GetPressure();
+
+        su2double *dirTan = dirTanExchange.data() + ind*nDim;
         for(unsigned short k=0; k<nDim; ++k) dirTan[k] = vel[k]/velTan;
-        
-        /* Compute the wall shear stress and heat flux vector using
-           the wall model. */
-        su2double tauWall, qWall, ViscosityWall, kOverCvWall;
-        
-        wallModel->WallShearStressAndHeatFlux(Temperature, velTan, LaminarViscosity, Pressure,
-                                              Wall_HeatFlux, HeatFlux_Prescribed,
-                                              Wall_Temperature, Temperature_Prescribed,
-                                              tauWall, qWall, ViscosityWall, kOverCvWall);
-        /* Determine the position where the viscous fluxes, viscosity and
-           thermal conductivity must be stored. */
-        su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
+      }
+    }
+  }
 
-        const unsigned short ind = l*nInt + ii;
-        viscosityInt[ind] = ViscosityWall;
-        kOverCvInt[ind]   = kOverCvWall;
+  /* Compute the wall shear stress and heat flux vector in all the exchange
+     locations using the wall model. The viscosity and thermal conductivity
+     at the wall are stored directly in viscosityInt and kOverCvInt. */
+  wallModel->WallShearStressAndHeatFluxBatch(nPointsExchange, tExchange.data(),
+                                             velExchange.data(), muExchange.data(),
+                                             pExchange.data(), Wall_HeatFlux,
+                                             HeatFlux_Prescribed, Wall_Temperature,
+                                             Temperature_Prescribed, tauWall.data(),
+                                             qWall.data(), viscosityInt, kOverCvInt,
+                                             sizeProfile ? profiles.data() : NULL);
+
+  /* Loop over the simultaneously treated faces to store the profiles
+     of the wall model and to compute the viscous normal fluxes. */
+  for(unsigned short l=0; l<nFaceSimul; ++l) {
+    const unsigned short llNVar = l*nVar;
 
-        /* Compute the prescribed velocity in tangential direction. */
-        su2double velTanPrescribed = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          velTanPrescribed += gridVel[k]*dirTan[k];
+    for(unsigned long k=0; k<surfElem[l].wallModelProfile.size(); ++k)
+      surfElem[l].wallModelProfile[k] = profiles[l*nInt*sizeProfile+k];
 
-        /* Compute the viscous normal flux. Note that the unscaled normals
-           must be used, hence the multiplication with normals[nDim]. */
-        normalFlux[0] = 0.0;
-        for(unsigned short k=0; k<nDim; ++k)
-          normalFlux[k+1] = -normals[nDim]*tauWall*dirTan[k];
-        normalFlux[nVar-1] = normals[nDim]*(qWall - tauWall*velTanPrescribed);
-      }
+    for(unsigned short ii=0; ii<nInt; ++ii) {
+
+      /* Easier storage of the normal, the wall velocity and the
+         tangential direction for this integration point. */
+      const unsigned short ind = l*nInt + ii;
+      const su2double *normals = surfElem[l].metricNormalsFace.data() + ii*(nDim+1);
+      const su2double *gridVel = surfElem[l].gridVelocities.data() + ii*nDim;
+      const su2double *dirTan  = dirTanExchange.data() + ind*nDim;
+
+      /* Determine the position where the viscous fluxes must be stored. */
+      su2double *normalFlux = viscFluxes + NPad*ii + llNVar;
+
+      /* Compute the prescribed velocity in tangential direction. */
+      su2double velTanPrescribed = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        velTanPrescribed += gridVel[k]*dirTan[k];
+
+      /* Compute the viscous normal flux. Note that the unscaled normals
+         must be used, hence the multiplication with normals[nDim]. */
+      normalFlux[0] = 0.0;
+      for(unsigned short k=0; k<nDim; ++k)
+        normalFlux[k+1] = -normals[nDim]*tauWall[ind]*dirTan[k];
+      normalFlux[nVar-1] = normals[nDim]*(qWall[ind] - tauWall[ind]*velTanPrescribed);
     }
   }
 }
@@ -70,7 +70,7 @@ CTransLMSolver::CTransLMSolver(CGeometry *geometry, CConfig *config, unsigned sh
   if (iMesh == MESH_0) {
     
     /*--- Define some auxillary vectors related to the residual ---*/
-    Residual     = new su2double[nVar]; Residual_RMS = new su2double[nVar];
+    Residual     = new su2double[nVar]; Residual_RMS = new accumdouble[nVar];
     Residual_i   = new su2double[nVar]; Residual_j   = new su2double[nVar];
     Residual_Max = new su2double[nVar];
 
@@ -255,8 +255,7 @@ void CTransLMSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solv
   
   /*--- Solve or smooth the linear system ---*/
   
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
   
   /*--- Update solution (system written in terms of increments) ---*/
   
@@ -362,15 +361,23 @@ void CTransLMSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_cont
   }
 }
 
+void CTransLMSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                             CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                                             unsigned short iRKStep) {
+
+  /*--- The transition model has its own edge loops, which must not be
+        replaced by the fused loop of CTurbSolver. ---*/
+
+  Upwind_Residual(geometry, solver_container, conv_numerics, config, iMesh);
+  Viscous_Residual(geometry, solver_container, visc_numerics, config, iMesh, iRKStep);
+}
+
 void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CNumerics *second_numerics,
                                        CConfig *config, unsigned short iMesh) {
   unsigned long iPoint;
-  su2double gamma_sep = 0.0;
+  su2double gamma_sep = 0.0, f_lambda;
 
-  //cout << "Setting Trans residual -AA " << endl;
-  cout << "\nBeginAA" << endl;
   for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    cout << "\niPoint: " << iPoint << endl;
     
     /*--- Conservative variables w/o reconstruction ---*/
     
@@ -400,11 +407,16 @@ void CTransLMSolver::Source_Residual(CGeometry *geometry, CSolver **solver_conta
     
     /*--- Compute the source term ---*/
     
-    numerics->ComputeResidual_TransLM(Residual, Jacobian_i, NULL, config, gamma_sep);
+    /*--- The Re_theta_t correlation is started from the value of the previous iteration ---*/
+    
+    f_lambda = node[iPoint]->GetF_Lambda();
+    
+    numerics->ComputeResidual_TransLM(Residual, Jacobian_i, NULL, config, gamma_sep, f_lambda);
     
-    /*-- Store gamma_sep in variable class --*/
+    /*-- Store gamma_sep and f_lambda in variable class --*/
     
     node[iPoint]->SetGammaSep(gamma_sep);
+    node[iPoint]->SetF_Lambda(f_lambda);
 
     /*--- Subtract residual and the Jacobian ---*/
     
@@ -46,6 +46,10 @@ CTurbSolver::CTurbSolver(void) : CSolver() {
   nVertex       = NULL;
   nMarker       = 0;
   Inlet_TurbVars = NULL;
+
+  Jacobian_Coupled  = NULL;
+  LinSysRes_Coupled = NULL;
+  LinSysSol_Coupled = NULL;
   
 }
 
@@ -59,6 +63,10 @@ CTurbSolver::CTurbSolver(CGeometry* geometry, CConfig *config) : CSolver() {
   lowerlimit    = NULL;
   upperlimit    = NULL;
   nMarker       = config->GetnMarker_All();
+
+  Jacobian_Coupled  = NULL;
+  LinSysRes_Coupled = NULL;
+  LinSysSol_Coupled = NULL;
   
   /*--- Store the number of vertices on each marker for deallocation later ---*/
   nVertex = new unsigned long[nMarker];
@@ -86,369 +94,39 @@ CTurbSolver::~CTurbSolver(void) {
   if (lowerlimit != NULL) delete [] lowerlimit;
   if (upperlimit != NULL) delete [] upperlimit;
   if (nVertex != NULL) delete [] nVertex;
+
+  if (Jacobian_Coupled  != NULL) delete Jacobian_Coupled;
+  if (LinSysRes_Coupled != NULL) delete LinSysRes_Coupled;
+  if (LinSysSol_Coupled != NULL) delete LinSysSol_Coupled;
   
 
 }
 
 void CTurbSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector, nBufferS_Scalar, nBufferR_Scalar;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL, *Buffer_Receive_muT = NULL, *Buffer_Send_muT = NULL;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-  
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      nBufferS_Scalar = nVertexS;             nBufferR_Scalar = nVertexR;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      Buffer_Receive_muT = new su2double [nBufferR_Scalar];
-      Buffer_Send_muT = new su2double[nBufferS_Scalar];
-      
-      /*--- Copy the solution that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        Buffer_Send_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-      SU2_MPI::Sendrecv(Buffer_Send_muT, nBufferS_Scalar, MPI_DOUBLE, send_to, 1,
-                   Buffer_Receive_muT, nBufferR_Scalar, MPI_DOUBLE, receive_from, 1, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        Buffer_Receive_muT[iVertex] = node[iPoint]->GetmuT();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      delete [] Buffer_Send_muT;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy conservative variables. ---*/
-        node[iPoint]->SetmuT(Buffer_Receive_muT[iVertex]);
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_muT;
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
+  InitiateComms(geometry, config, SOLUTION_EDDY_VISCOSITY);
+  CompleteComms(geometry, config, SOLUTION_EDDY_VISCOSITY);
   
 }
 
 void CTurbSolver::Set_MPI_Solution_Old(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_U = NULL, *Buffer_Send_U = NULL;
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
+  InitiateComms(geometry, config, SOLUTION_OLD);
+  CompleteComms(geometry, config, SOLUTION_OLD);
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_U = new su2double [nBufferR_Vector];
-      Buffer_Send_U = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_U[iVar*nVertexS+iVertex] = node[iPoint]->GetSolution_Old(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_U[iVar*nVertexR+iVertex] = Buffer_Send_U[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_U;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetSolution_Old(iVar, Buffer_Receive_U[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_U;
-      
-    }
-    
-  }
 }
 
 void CTurbSolver::Set_MPI_Solution_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  su2double **Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
- 
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar*nDim;        nBufferR_Vector = nVertexR*nVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-        }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
-    }
-    
-  }
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
+  InitiateComms(geometry, config, SOLUTION_GRADIENT);
+  CompleteComms(geometry, config, SOLUTION_GRADIENT);
   
 }
 
 void CTurbSolver::Set_MPI_Solution_Limiter(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iMarker, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double *Buffer_Receive_Limit = NULL, *Buffer_Send_Limit = NULL;
-  
-  su2double *Limiter = new su2double [nVar];
   
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-  
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nVar;        nBufferR_Vector = nVertexR*nVar;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Limit = new su2double [nBufferR_Vector];
-      Buffer_Send_Limit = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Send_Limit[iVar*nVertexS+iVertex] = node[iPoint]->GetLimiter(iVar);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Limit, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_Limit, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nVar; iVar++)
-          Buffer_Receive_Limit[iVar*nVertexR+iVertex] = Buffer_Send_Limit[iVar*nVertexR+iVertex];
-      }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Limit;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        
-        /*--- Copy transformed conserved variables back into buffer. ---*/
-        for (iVar = 0; iVar < nVar; iVar++)
-          node[iPoint]->SetLimiter(iVar, Buffer_Receive_Limit[iVar*nVertexR+iVertex]);
-        
-      }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Limit;
-      
-    }
-    
-  }
-  
-  delete [] Limiter;
+  InitiateComms(geometry, config, SOLUTION_LIMITER);
+  CompleteComms(geometry, config, SOLUTION_LIMITER);
   
 }
 
@@ -467,9 +145,9 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     
     /*--- Points in edge and normal vectors ---*/
     
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    numerics->SetNormal(geometry->edge[iEdge]->GetNormal());
+    iPoint = geometry->GetEdge_Node(iEdge,0);
+    jPoint = geometry->GetEdge_Node(iEdge,1);
+    numerics->SetNormal(geometry->GetEdge_Normal(iEdge));
     
     /*--- Primitive variables w/o reconstruction ---*/
     
@@ -560,10 +238,7 @@ void CTurbSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_containe
     
     /*--- Implicit part ---*/
     
-    Jacobian.AddBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.SubtractBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(jPoint, jPoint, Jacobian_j);
+    Jacobian.AddEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     
   }
   
@@ -609,10 +284,153 @@ void CTurbSolver::Viscous_Residual(CGeometry *geometry, CSolver **solver_contain
     LinSysRes.SubtractBlock(iPoint, Residual);
     LinSysRes.AddBlock(jPoint, Residual);
     
-    Jacobian.SubtractBlock(iPoint, iPoint, Jacobian_i);
-    Jacobian.SubtractBlock(iPoint, jPoint, Jacobian_j);
-    Jacobian.AddBlock(jPoint, iPoint, Jacobian_i);
-    Jacobian.AddBlock(jPoint, jPoint, Jacobian_j);
+    Jacobian.SubtractEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+    
+  }
+  
+}
+
+void CTurbSolver::Upwind_Viscous_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics *conv_numerics,
+                                          CNumerics *visc_numerics, CConfig *config, unsigned short iMesh,
+                                          unsigned short iRKStep) {
+  
+  su2double *Turb_i, *Turb_j, *Limiter_i = NULL, *Limiter_j = NULL, *V_i, *V_j, **Gradient_i, **Gradient_j, Project_Grad_i, Project_Grad_j;
+  su2double *Coord_i, *Coord_j, *Normal;
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iDim, iVar;
+  
+  bool muscl         = config->GetMUSCL_Turb();
+  bool limiter       = (config->GetKind_SlopeLimit_Turb() != NO_LIMITER);
+  bool grid_movement = config->GetGrid_Movement();
+  bool sst           = (config->GetKind_Turb_Model() == SST);
+
+  const unsigned short nPrimVarGrad = solver_container[FLOW_SOL]->GetnPrimVarGrad();
+  
+  /*--- Single loop over the edges, in which the data of the flow and the
+        turbulence solver is gathered once and passed to both the convective
+        and the viscous numerics. The contributions are identical to the ones
+        of Upwind_Residual and Viscous_Residual. ---*/
+
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    
+    /*--- Points in edge, coordinates and normal vector ---*/
+    
+    iPoint = geometry->GetEdge_Node(iEdge,0);
+    jPoint = geometry->GetEdge_Node(iEdge,1);
+
+    Coord_i = geometry->node[iPoint]->GetCoord();
+    Coord_j = geometry->node[jPoint]->GetCoord();
+    Normal  = geometry->GetEdge_Normal(iEdge);
+    
+    /*--- Primitive and turbulent variables w/o reconstruction ---*/
+    
+    V_i = solver_container[FLOW_SOL]->node[iPoint]->GetPrimitive();
+    V_j = solver_container[FLOW_SOL]->node[jPoint]->GetPrimitive();
+    
+    Turb_i = node[iPoint]->GetSolution();
+    Turb_j = node[jPoint]->GetSolution();
+
+    /*--- Convective part. ---*/
+
+    conv_numerics->SetNormal(Normal);
+    conv_numerics->SetPrimitive(V_i, V_j);
+    conv_numerics->SetTurbVar(Turb_i, Turb_j);
+    
+    if (grid_movement)
+      conv_numerics->SetGridVel(geometry->node[iPoint]->GetGridVel(), geometry->node[jPoint]->GetGridVel());
+    
+    if (muscl) {
+
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Vector_i[iDim] = 0.5*(Coord_j[iDim] - Coord_i[iDim]);
+        Vector_j[iDim] = 0.5*(Coord_i[iDim] - Coord_j[iDim]);
+      }
+      
+      /*--- Mean flow primitive variables using gradient reconstruction and limiters ---*/
+      
+      Gradient_i = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+      Gradient_j = solver_container[FLOW_SOL]->node[jPoint]->GetGradient_Primitive();
+      if (limiter) {
+        Limiter_i = solver_container[FLOW_SOL]->node[iPoint]->GetLimiter_Primitive();
+        Limiter_j = solver_container[FLOW_SOL]->node[jPoint]->GetLimiter_Primitive();
+      }
+      
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+        }
+        if (limiter) {
+          FlowPrimVar_i[iVar] = V_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+          FlowPrimVar_j[iVar] = V_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+        }
+        else {
+          FlowPrimVar_i[iVar] = V_i[iVar] + Project_Grad_i;
+          FlowPrimVar_j[iVar] = V_j[iVar] + Project_Grad_j;
+        }
+      }
+      
+      conv_numerics->SetPrimitive(FlowPrimVar_i, FlowPrimVar_j);
+      
+      /*--- Turbulent variables using gradient reconstruction and limiters ---*/
+      
+      Gradient_i = node[iPoint]->GetGradient();
+      Gradient_j = node[jPoint]->GetGradient();
+      if (limiter) {
+        Limiter_i = node[iPoint]->GetLimiter();
+        Limiter_j = node[jPoint]->GetLimiter();
+      }
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        Project_Grad_i = 0.0; Project_Grad_j = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Project_Grad_i += Vector_i[iDim]*Gradient_i[iVar][iDim];
+          Project_Grad_j += Vector_j[iDim]*Gradient_j[iVar][iDim];
+        }
+        if (limiter) {
+          Solution_i[iVar] = Turb_i[iVar] + Limiter_i[iVar]*Project_Grad_i;
+          Solution_j[iVar] = Turb_j[iVar] + Limiter_j[iVar]*Project_Grad_j;
+        }
+        else {
+          Solution_i[iVar] = Turb_i[iVar] + Project_Grad_i;
+          Solution_j[iVar] = Turb_j[iVar] + Project_Grad_j;
+        }
+      }
+      
+      conv_numerics->SetTurbVar(Solution_i, Solution_j);
+      
+    }
+    
+    /*--- Add and subtract the convective residual, and update Jacobians ---*/
+    
+    conv_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    
+    LinSysRes.AddBlock(iPoint, Residual);
+    LinSysRes.SubtractBlock(jPoint, Residual);
+    
+    Jacobian.AddEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
+
+    /*--- Viscous part, which uses the variables w/o reconstruction. ---*/
+
+    visc_numerics->SetCoord(Coord_i, Coord_j);
+    visc_numerics->SetNormal(Normal);
+    visc_numerics->SetPrimitive(V_i, V_j);
+    visc_numerics->SetTurbVar(Turb_i, Turb_j);
+    visc_numerics->SetTurbVarGradient(node[iPoint]->GetGradient(), node[jPoint]->GetGradient());
+    
+    /*--- Menter's first blending function (only SST)---*/
+    if (sst)
+      visc_numerics->SetF1blending(node[iPoint]->GetF1blending(), node[jPoint]->GetF1blending());
+    
+    /*--- Subtract and add the viscous residual, and update Jacobians ---*/
+    
+    visc_numerics->ComputeResidual(Residual, Jacobian_i, Jacobian_j, config);
+    
+    LinSysRes.SubtractBlock(iPoint, Residual);
+    LinSysRes.AddBlock(jPoint, Residual);
+    
+    Jacobian.SubtractEdgeBlocks(iEdge, iPoint, jPoint, Jacobian_i, Jacobian_j);
     
   }
   
@@ -737,10 +555,15 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
     }
   }
   
-  /*--- Solve or smooth the linear system ---*/
+  /*--- Solve or smooth the linear system, possibly coupled to the mean flow ---*/
   
-  CSysSolve system;
-  system.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+  if (config->GetCoupled_Turb_Implicit()) {
+    Solve_Coupled_System(geometry, solver_container, config);
+  }
+  else {
+    unsigned long IterLinSol = System.Solve(Jacobian, LinSysRes, LinSysSol, geometry, config);
+    CheckJacobian_Lag(config, IterLinSol, System.GetResidual_Rel());
+  }
   
   /*--- Update solution (system written in terms of increments) ---*/
   
@@ -789,16 +612,189 @@ void CTurbSolver::ImplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_
         
     }
   }
-  
-  
-  /*--- MPI solution ---*/
-  
-  Set_MPI_Solution(geometry, config);
-  
-  /*--- Compute the root mean square residual ---*/
-  
-  SetResidual_RMS(geometry, config);
-  
+  
+  
+  /*--- MPI solution ---*/
+  
+  Set_MPI_Solution(geometry, config);
+  
+  /*--- Compute the root mean square residual ---*/
+  
+  SetResidual_RMS(geometry, config);
+  
+}
+
+void CTurbSolver::Solve_Coupled_System(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
+
+  unsigned short iVar, jVar, iDim, jDim, iNode;
+  unsigned long iPoint, jPoint, iEdge, IterLinSol;
+
+  CSolver *flowSolver = solver_container[FLOW_SOL];
+  const unsigned short nVarFlow = flowSolver->GetnVar();
+  const unsigned short nVarCpl  = nVarFlow + nVar;
+
+  /*--- Allocate the coupled system the first time it is needed. It has the
+        same sparsity pattern as the systems of the mean flow and turbulence. ---*/
+
+  if (Jacobian_Coupled == NULL) {
+    Jacobian_Coupled = new CSysMatrix;
+    Jacobian_Coupled->Initialize(nPoint, nPointDomain, nVarCpl, nVarCpl, true, geometry, config);
+    LinSysRes_Coupled = new CSysVector(nPoint, nPointDomain, nVarCpl, 0.0);
+    LinSysSol_Coupled = new CSysVector(nPoint, nPointDomain, nVarCpl, 0.0);
+  }
+
+  /*--- Copy the Jacobians of the mean flow and the turbulence model into the
+        diagonal sub-blocks of the coupled Jacobian. The blocks of the edges
+        and the diagonal blocks of the points cover the entire pattern. ---*/
+
+  su2double *blockCpl = new su2double[nVarCpl*nVarCpl];
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iNode = 0; iNode <= geometry->node[iPoint]->GetnPoint(); iNode++) {
+      jPoint = (iNode == 0) ? iPoint : geometry->node[iPoint]->GetPoint(iNode-1);
+
+      const su2double *blockFlow = flowSolver->Jacobian.GetBlock(iPoint, jPoint);
+      const su2double *blockTurb = Jacobian.GetBlock(iPoint, jPoint);
+      if ((blockFlow == NULL) || (blockTurb == NULL)) continue;
+
+      for (iVar = 0; iVar < nVarCpl*nVarCpl; iVar++) blockCpl[iVar] = 0.0;
+
+      for (iVar = 0; iVar < nVarFlow; iVar++)
+        for (jVar = 0; jVar < nVarFlow; jVar++)
+          blockCpl[iVar*nVarCpl+jVar] = blockFlow[iVar*nVarFlow+jVar];
+
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (jVar = 0; jVar < nVar; jVar++)
+          blockCpl[(nVarFlow+iVar)*nVarCpl+nVarFlow+jVar] = blockTurb[iVar*nVar+jVar];
+
+      Jacobian_Coupled->SetBlock(iPoint, jPoint, blockCpl);
+    }
+  }
+
+  /*--- Derivative of the eddy viscosity of the SA models w.r.t. nu_tilde,
+        mu_t = rho*nu_tilde*fv1(chi), hence dmu_t/dnu_tilde = rho*(fv1 + 3*fv1*(1-fv1)). ---*/
+
+  const su2double cv1_3 = 7.1*7.1*7.1;
+  su2double *dMuTdNu = new su2double[nPoint];
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    const su2double rho     = flowSolver->node[iPoint]->GetDensity();
+    const su2double mu_lam  = flowSolver->node[iPoint]->GetLaminarViscosity();
+    const su2double nu_hat  = node[iPoint]->GetSolution(0);
+    const su2double chi_3   = pow(nu_hat*rho/mu_lam, 3.0);
+    const su2double fv1     = chi_3/(chi_3+cv1_3);
+
+    dMuTdNu[iPoint] = (nu_hat > 0.0) ? su2double(rho*(fv1 + 3.0*fv1*(1.0-fv1))) : su2double(0.0);
+  }
+
+  /*--- Contribution of the eddy viscosity to the viscous fluxes of the mean
+        flow. These are linear in the mean eddy viscosity of the edge, hence
+        the derivative is the flux evaluated with a unit eddy viscosity, using
+        the averaged gradients. The sign convention is the one of the viscous
+        residual of the mean flow, which is subtracted at iPoint. ---*/
+
+  const su2double Cp        = config->GetGamma()*config->GetGas_ConstantND()/(config->GetGamma()-1.0);
+  const su2double factHeat  = Cp/config->GetPrandtl_Turb();
+  su2double dFluxdMuT[5], Mean_Vel[3], Mean_Grad[4][3], tau[3][3];
+
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    const su2double *Normal = geometry->edge[iEdge]->GetNormal();
+
+    su2double *V_i = flowSolver->node[iPoint]->GetPrimitive();
+    su2double *V_j = flowSolver->node[jPoint]->GetPrimitive();
+    su2double **Grad_i = flowSolver->node[iPoint]->GetGradient_Primitive();
+    su2double **Grad_j = flowSolver->node[jPoint]->GetGradient_Primitive();
+
+    /*--- Mean velocity and mean gradients of temperature and velocity. ---*/
+
+    for (iDim = 0; iDim < nDim; iDim++)
+      Mean_Vel[iDim] = 0.5*(V_i[iDim+1] + V_j[iDim+1]);
+
+    for (iVar = 0; iVar < nDim+1; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Mean_Grad[iVar][iDim] = 0.5*(Grad_i[iVar][iDim] + Grad_j[iVar][iDim]);
+
+    /*--- Stress tensor per unit viscosity and the resulting fluxes. ---*/
+
+    su2double div_vel = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) div_vel += Mean_Grad[iDim+1][iDim];
+
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (jDim = 0; jDim < nDim; jDim++)
+        tau[iDim][jDim] = Mean_Grad[iDim+1][jDim] + Mean_Grad[jDim+1][iDim]
+                        - ((iDim == jDim) ? TWO3*div_vel : 0.0);
+
+    dFluxdMuT[0]          = 0.0;
+    dFluxdMuT[nVarFlow-1] = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      dFluxdMuT[iDim+1] = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        dFluxdMuT[iDim+1] += tau[iDim][jDim]*Normal[jDim];
+      dFluxdMuT[nVarFlow-1] += dFluxdMuT[iDim+1]*Mean_Vel[iDim]
+                             + factHeat*Mean_Grad[0][iDim]*Normal[iDim];
+    }
+
+    /*--- The mean eddy viscosity is 0.5*(mu_t_i + mu_t_j). Add the derivatives
+          to the flow rows and turbulence columns of the four blocks of the edge. ---*/
+
+    su2double *block_ii = Jacobian_Coupled->GetBlock(iPoint, iPoint);
+    su2double *block_ij = Jacobian_Coupled->GetBlock(iPoint, jPoint);
+    su2double *block_ji = Jacobian_Coupled->GetBlock(jPoint, iPoint);
+    su2double *block_jj = Jacobian_Coupled->GetBlock(jPoint, jPoint);
+
+    for (iVar = 0; iVar < nVarFlow; iVar++) {
+      const su2double dFlux_i = 0.5*dFluxdMuT[iVar]*dMuTdNu[iPoint];
+      const su2double dFlux_j = 0.5*dFluxdMuT[iVar]*dMuTdNu[jPoint];
+      const unsigned long idx = iVar*nVarCpl + nVarFlow;
+
+      block_ii[idx] -= dFlux_i;
+      block_ij[idx] -= dFlux_j;
+      block_ji[idx] += dFlux_i;
+      block_jj[idx] += dFlux_j;
+    }
+  }
+
+  delete [] dMuTdNu;
+  delete [] blockCpl;
+
+  /*--- Right hand side and initial guess of the coupled system. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVarFlow; iVar++) {
+      (*LinSysRes_Coupled)[iPoint*nVarCpl+iVar] = flowSolver->LinSysRes[iPoint*nVarFlow+iVar];
+      (*LinSysSol_Coupled)[iPoint*nVarCpl+iVar] = 0.0;
+    }
+    for (iVar = 0; iVar < nVar; iVar++) {
+      (*LinSysRes_Coupled)[iPoint*nVarCpl+nVarFlow+iVar] = LinSysRes[iPoint*nVar+iVar];
+      (*LinSysSol_Coupled)[iPoint*nVarCpl+nVarFlow+iVar] = 0.0;
+    }
+  }
+
+  /*--- Solve the coupled system. ---*/
+
+  IterLinSol = System.Solve(*Jacobian_Coupled, *LinSysRes_Coupled, *LinSysSol_Coupled, geometry, config);
+  flowSolver->SetIterLinSolver(IterLinSol);
+  flowSolver->SetResLinSolver(System.GetResidual_Rel());
+
+  /*--- Extract the increments of the turbulence variables, and update the
+        mean flow solution as in CEulerSolver::ImplicitEuler_Iteration. ---*/
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+    for (iVar = 0; iVar < nVarFlow; iVar++)
+      flowSolver->LinSysSol[iPoint*nVarFlow+iVar] = (*LinSysSol_Coupled)[iPoint*nVarCpl+iVar];
+    for (iVar = 0; iVar < nVar; iVar++)
+      LinSysSol[iPoint*nVar+iVar] = (*LinSysSol_Coupled)[iPoint*nVarCpl+nVarFlow+iVar];
+  }
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+    for (iVar = 0; iVar < nVarFlow; iVar++)
+      flowSolver->node[iPoint]->AddSolution(iVar, config->GetRelaxation_Factor_Flow()*flowSolver->LinSysSol[iPoint*nVarFlow+iVar]);
+
+  flowSolver->Set_MPI_Solution(geometry, config);
+
 }
 
 void CTurbSolver::SetResidual_DualTime(CGeometry *geometry, CSolver **solver_container, CConfig *config,
@@ -1231,6 +1227,9 @@ CTurbSASolver::CTurbSASolver(void) : CTurbSolver() {
 
   Inlet_TurbVars = NULL;
 
+  DES_Geometry_Ready = false;
+  DES_Geometry_Iter  = 0;
+
 }
 
 CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned short iMesh, CFluidModel* FluidModel)
@@ -1244,6 +1243,9 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
   Gamma = config->GetGamma();
   Gamma_Minus_One = Gamma - 1.0;
   
+  DES_Geometry_Ready = false;
+  DES_Geometry_Iter  = 0;
+  
   /*--- Dimension of the problem --> dependent of the turbulent model ---*/
   
   nVar = 1;
@@ -1267,7 +1269,7 @@ CTurbSASolver::CTurbSASolver(CGeometry *geometry, CConfig *config, unsigned shor
     /*--- Define some auxiliar vector related with the residual ---*/
     
     Residual = new su2double[nVar];     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]  = 0.0;
-    Residual_RMS = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+    Residual_RMS = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
     Residual_i = new su2double[nVar];   for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]  = 0.0;
     Residual_j = new su2double[nVar];   for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]  = 0.0;
     Residual_Max = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
@@ -1501,8 +1503,9 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
     
   }
   
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, unless the last one is reused (JACOBIAN_LAG) ---*/
   
+  SetJacobian_Lag(config);
   Jacobian.SetValZero();
 
   if (config->GetKind_Gradient_Method() == GREEN_GAUSS) SetSolution_Gradient_GG(geometry, config);
@@ -1527,9 +1530,10 @@ void CTurbSASolver::Preprocessing(CGeometry *geometry, CSolver **solver_containe
       }
     }
     
-    /*--- Compute the DES length scale ---*/
+    /*--- Geometric terms of the DES length scale, the length scale itself is
+     computed in the loop of the source terms ---*/
     
-    SetDES_LengthScale(solver_container, geometry, config);
+    SetDES_Geometry(geometry, config);
     
   }
 }
@@ -1617,6 +1621,7 @@ void CTurbSASolver::Source_Residual(CGeometry *geometry, CSolver **solver_contai
     
       /*--- Set DES length scale ---*/
       
+      SetDES_LengthScale(solver_container, geometry, config, iPoint);
       numerics->SetDistance(node[iPoint]->GetDES_LengthScale(), 0.0);
       
     }
@@ -3031,8 +3036,8 @@ void CTurbSASolver::SetNuTilde_WF(CGeometry *geometry, CSolver **solver_containe
   
   /*--- Local variables ---*/
   
-  unsigned short iDim, jDim, iVar, iNode;
-  unsigned long iVertex, iPoint, iPoint_Neighbor, counter;
+  unsigned short iDim, jDim, iVar;
+  unsigned long iVertex, iPoint, iPoint_Neighbor, iDonor, counter;
   
   su2double func, func_prim;
   su2double *Normal, Area;
@@ -3077,264 +3082,361 @@ void CTurbSASolver::SetNuTilde_WF(CGeometry *geometry, CSolver **solver_containe
   
   // Wall_HeatFlux = config->GetWall_HeatFlux(Marker_Tag);
   
+  /*--- The donors of the wall vertices are only found on the first call ---*/
+  
+  SetWallFunction_Donors(geometry, val_marker);
+  
   /*--- Loop over all of the vertices on this boundary marker ---*/
   
   for(iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
     iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
     
-    /*--- We can use also GetNormal_Neighbor, and eliminate the following loop ---*/
+    /*--- Donors of the vertex, i.e. its neighbours off the physical boundary ---*/
     
-    iPoint_Neighbor = geometry->vertex[val_marker][iVertex]->GetNormal_Neighbor();
+    for (iDonor = WF_Donor_Start[val_marker][iVertex]; iDonor < WF_Donor_Start[val_marker][iVertex+1]; iDonor++) {
+      iPoint_Neighbor = WF_Donor_Point[val_marker][iDonor];
+      
+      /*--- Get coordinates of the current vertex and nearest normal point ---*/
+      
+      Coord = geometry->node[iPoint]->GetCoord();
+      Coord_Normal = geometry->node[iPoint_Neighbor]->GetCoord();
+      
+      /*--- Compute dual-grid area and boundary normal ---*/
+      
+      Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+      
+      Area = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        Area += Normal[iDim]*Normal[iDim];
+      Area = sqrt (Area);
+      
+      for (iDim = 0; iDim < nDim; iDim++)
+        UnitNormal[iDim] = -Normal[iDim]/Area;
+      
+      /*--- Get the velocity, pressure, and temperature at the nearest
+       (normal) interior point. ---*/
+      
+      for (iDim = 0; iDim < nDim; iDim++)
+        Vel[iDim]    = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetVelocity(iDim);
+      P_Normal       = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetPressure();
+      T_Normal       = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetTemperature();
 
-    for(iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
-      iPoint_Neighbor = geometry->node[iPoint]->GetPoint(iNode);
+      /*--- Compute the wall-parallel velocity at first point off the wall ---*/
+      
+      VelNormal = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        VelNormal += Vel[iDim] * UnitNormal[iDim];
+      for (iDim = 0; iDim < nDim; iDim++)
+        VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
+      
+      VelTangMod = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        VelTangMod += VelTang[iDim]*VelTang[iDim];
+      VelTangMod = sqrt(VelTangMod);
+      
+      /*--- Compute normal distance of the interior point from the wall ---*/
+      
+      for (iDim = 0; iDim < nDim; iDim++)
+        WallDist[iDim] = (Coord[iDim] - Coord_Normal[iDim]);
+      
+      WallDistMod = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        WallDistMod += WallDist[iDim]*WallDist[iDim];
+      WallDistMod = sqrt(WallDistMod);
+      
+      /*--- Compute mach number ---*/
+      
+      // M_Normal = VelTangMod / sqrt(Gamma * Gas_Constant * T_Normal);
+      
+      /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
+      
+      //T_Wall = T_Normal * (1.0 + 0.5*Gamma_Minus_One*Recovery*M_Normal*M_Normal);
+      T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
+      
+      /*--- Extrapolate the pressure from the interior & compute the
+       wall density using the equation of state ---*/
+      
+      P_Wall = P_Normal;
+      Density_Wall = P_Wall/(Gas_Constant*T_Wall);
+      
+      /*--- Compute the shear stress at the wall in the regular fashion
+       by using the stress tensor on the surface ---*/
       
-      /*--- Check if the node belongs to the domain (i.e, not a halo node)
-       and the neighbor is not part of the physical boundary ---*/
+      Lam_Visc_Wall = solver_container[FLOW_SOL]->node[iPoint]->GetLaminarViscosity();
+      grad_primvar  = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
       
-      if (geometry->node[iPoint]->GetDomain() && (!geometry->node[iPoint_Neighbor]->GetBoundary())) {
+      div_vel = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        div_vel += grad_primvar[iDim+1][iDim];
+      
+      for (iDim = 0; iDim < nDim; iDim++) {
+        for (jDim = 0 ; jDim < nDim; jDim++) {
+          Delta = 0.0; if (iDim == jDim) Delta = 1.0;
+          tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
+                                           + grad_primvar[iDim+1][jDim]) -
+          TWO3*Lam_Visc_Wall*div_vel*Delta;
+        }
+        TauElem[iDim] = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
+      }
+      
+      /*--- Compute wall shear stress as the magnitude of the wall-tangential
+       component of the shear stress tensor---*/
+      
+      TauNormal = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        TauNormal += TauElem[iDim] * UnitNormal[iDim];
+      
+      for (iDim = 0; iDim < nDim; iDim++)
+        TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
+      
+      WallShearStress = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        WallShearStress += TauTangent[iDim]*TauTangent[iDim];
+      WallShearStress = sqrt(WallShearStress);
+      
+      /*--- Calculate the quantities from boundary layer theory and
+       iteratively solve for a new wall shear stress. Use the value of the
+       previous iteration, or the current wall shear stress, as a starting
+       guess for the wall function. ---*/
+      
+      Tau_Wall_Old = (WF_Donor_TauWall[val_marker][iDonor] > 0.0)? WF_Donor_TauWall[val_marker][iDonor] : WallShearStress;
+      counter = 0; diff = 1.0;
+      
+      while (diff > tol) {
         
-        /*--- Get coordinates of the current vertex and nearest normal point ---*/
+        /*--- Friction velocity and u+ ---*/
         
-        Coord = geometry->node[iPoint]->GetCoord();
-        Coord_Normal = geometry->node[iPoint_Neighbor]->GetCoord();
+        U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
+        U_Plus = VelTangMod/U_Tau;
         
-        /*--- Compute dual-grid area and boundary normal ---*/
+        /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
         
-        Normal = geometry->vertex[val_marker][iVertex]->GetNormal();
+        Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
+        Beta = 0.0; // For adiabatic flows only
+        Q    = sqrt(Beta*Beta + 4.0*Gam);
+        Phi  = asin(-1.0*Beta/Q);
         
-        Area = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          Area += Normal[iDim]*Normal[iDim];
-        Area = sqrt (Area);
+        /*--- Y+ defined by White & Christoph (compressibility and heat transfer) ---*/
         
-        for (iDim = 0; iDim < nDim; iDim++)
-          UnitNormal[iDim] = -Normal[iDim]/Area;
+        Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
         
-        /*--- Get the velocity, pressure, and temperature at the nearest
-         (normal) interior point. ---*/
+        /*--- Spalding's universal form for the BL velocity with the
+         outer velocity form of White & Christoph above. ---*/
         
-        for (iDim = 0; iDim < nDim; iDim++)
-          Vel[iDim]    = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetVelocity(iDim);
-        P_Normal       = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetPressure();
-        T_Normal       = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetTemperature();
+        Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
+                                          (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
+                                           kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
 
-        /*--- Compute the wall-parallel velocity at first point off the wall ---*/
-        
-        VelNormal = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelNormal += Vel[iDim] * UnitNormal[iDim];
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelTang[iDim] = Vel[iDim] - VelNormal*UnitNormal[iDim];
-        
-        VelTangMod = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          VelTangMod += VelTang[iDim]*VelTang[iDim];
-        VelTangMod = sqrt(VelTangMod);
-        
-        /*--- Compute normal distance of the interior point from the wall ---*/
-        
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallDist[iDim] = (Coord[iDim] - Coord_Normal[iDim]);
-        
-        WallDistMod = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallDistMod += WallDist[iDim]*WallDist[iDim];
-        WallDistMod = sqrt(WallDistMod);
-        
-        /*--- Compute mach number ---*/
-        
-        // M_Normal = VelTangMod / sqrt(Gamma * Gas_Constant * T_Normal);
-        
-        /*--- Compute the wall temperature using the Crocco-Buseman equation ---*/
-        
-        //T_Wall = T_Normal * (1.0 + 0.5*Gamma_Minus_One*Recovery*M_Normal*M_Normal);
-        T_Wall = T_Normal + Recovery*pow(VelTangMod,2.0)/(2.0*Cp);
+        /*--- Calculate an updated value for the wall shear stress
+         using the y+ value, the definition of y+, and the definition of
+         the friction velocity. ---*/
         
-        /*--- Extrapolate the pressure from the interior & compute the
-         wall density using the equation of state ---*/
+        Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
         
-        P_Wall = P_Normal;
-        Density_Wall = P_Wall/(Gas_Constant*T_Wall);
+        /*--- Difference between the old and new Tau. Update old value. ---*/
         
-        /*--- Compute the shear stress at the wall in the regular fashion
-         by using the stress tensor on the surface ---*/
+        diff = fabs(Tau_Wall-Tau_Wall_Old);
+        Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
         
-        Lam_Visc_Wall = solver_container[FLOW_SOL]->node[iPoint]->GetLaminarViscosity();
-        grad_primvar  = solver_container[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-        
-        div_vel = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          div_vel += grad_primvar[iDim+1][iDim];
-        
-        for (iDim = 0; iDim < nDim; iDim++) {
-          for (jDim = 0 ; jDim < nDim; jDim++) {
-            Delta = 0.0; if (iDim == jDim) Delta = 1.0;
-            tau[iDim][jDim] = Lam_Visc_Wall*(  grad_primvar[jDim+1][iDim]
-                                             + grad_primvar[iDim+1][jDim]) -
-            TWO3*Lam_Visc_Wall*div_vel*Delta;
-          }
-          TauElem[iDim] = 0.0;
-          for (jDim = 0; jDim < nDim; jDim++)
-            TauElem[iDim] += tau[iDim][jDim]*UnitNormal[jDim];
+        counter++;
+        if (counter > max_iter) {
+          cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_turbulent" << endl;
+          break;
         }
-        
-        /*--- Compute wall shear stress as the magnitude of the wall-tangential
-         component of the shear stress tensor---*/
-        
-        TauNormal = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          TauNormal += TauElem[iDim] * UnitNormal[iDim];
-        
-        for (iDim = 0; iDim < nDim; iDim++)
-          TauTangent[iDim] = TauElem[iDim] - TauNormal * UnitNormal[iDim];
-        
-        WallShearStress = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          WallShearStress += TauTangent[iDim]*TauTangent[iDim];
-        WallShearStress = sqrt(WallShearStress);
-        
-        /*--- Calculate the quantities from boundary layer theory and
-         iteratively solve for a new wall shear stress. Use the current wall
-         shear stress as a starting guess for the wall function. ---*/
-        
-        Tau_Wall_Old = WallShearStress;
-        counter = 0; diff = 1.0;
-        
-        while (diff > tol) {
-          
-          /*--- Friction velocity and u+ ---*/
-          
-          U_Tau = sqrt(Tau_Wall_Old/Density_Wall);
-          U_Plus = VelTangMod/U_Tau;
-          
-          /*--- Gamma, Beta, Q, and Phi, defined by Nichols & Nelson (2004) ---*/
-          
-          Gam  = Recovery*U_Tau*U_Tau/(2.0*Cp*T_Wall);
-          Beta = 0.0; // For adiabatic flows only
-          Q    = sqrt(Beta*Beta + 4.0*Gam);
-          Phi  = asin(-1.0*Beta/Q);
-          
-          /*--- Y+ defined by White & Christoph (compressibility and heat transfer) ---*/
-          
-          Y_Plus_White = exp((kappa/sqrt(Gam))*(asin((2.0*Gam*U_Plus - Beta)/Q) - Phi))*exp(-1.0*kappa*B);
-          
-          /*--- Spalding's universal form for the BL velocity with the
-           outer velocity form of White & Christoph above. ---*/
-          
-          Y_Plus = U_Plus + Y_Plus_White - (exp(-1.0*kappa*B)*
-                                            (1.0 + kappa*U_Plus + kappa*kappa*U_Plus*U_Plus/2.0 +
-                                             kappa*kappa*kappa*U_Plus*U_Plus*U_Plus/6.0));
 
-          /*--- Calculate an updated value for the wall shear stress
-           using the y+ value, the definition of y+, and the definition of
-           the friction velocity. ---*/
-          
-          Tau_Wall = (1.0/Density_Wall)*pow(Y_Plus*Lam_Visc_Wall/WallDistMod,2.0);
-          
-          /*--- Difference between the old and new Tau. Update old value. ---*/
-          
-          diff = fabs(Tau_Wall-Tau_Wall_Old);
-          Tau_Wall_Old += 0.25*(Tau_Wall-Tau_Wall_Old);
-          
-          counter++;
-          if (counter > max_iter) {
-            cout << "WARNING: Tau_Wall evaluation has not converged in solver_direct_turbulent" << endl;
-            break;
-          }
+      }
+      
+      WF_Donor_TauWall[val_marker][iDonor] = Tau_Wall;
+      
+      /*--- Now compute the Eddy viscosity at the first point off of the wall ---*/
+      
+      Lam_Visc_Normal = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetLaminarViscosity();
+      Density_Normal = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetDensity();
+      Kin_Visc_Normal = Lam_Visc_Normal/Density_Normal;
 
-        }
-        
-        /*--- Now compute the Eddy viscosity at the first point off of the wall ---*/
-        
-        Lam_Visc_Normal = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetLaminarViscosity();
-        Density_Normal = solver_container[FLOW_SOL]->node[iPoint_Neighbor]->GetDensity();
-        Kin_Visc_Normal = Lam_Visc_Normal/Density_Normal;
-
-        dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
-        Eddy_Visc = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
-                                             (1.0 + kappa*U_Plus
-                                              + kappa*kappa*U_Plus*U_Plus/2.0)
-                                             - Lam_Visc_Normal/Lam_Visc_Wall);
-        
-        /*--- Eddy viscosity should be always a positive number ---*/
-        
-        Eddy_Visc = max(0.0, Eddy_Visc);
+      dypw_dyp = 2.0*Y_Plus_White*(kappa*sqrt(Gam)/Q)*sqrt(1.0 - pow(2.0*Gam*U_Plus - Beta,2.0)/(Q*Q));
+      Eddy_Visc = Lam_Visc_Wall*(1.0 + dypw_dyp - kappa*exp(-1.0*kappa*B)*
+                                           (1.0 + kappa*U_Plus
+                                            + kappa*kappa*U_Plus*U_Plus/2.0)
+                                           - Lam_Visc_Normal/Lam_Visc_Wall);
+      
+      /*--- Eddy viscosity should be always a positive number ---*/
+      
+      Eddy_Visc = max(0.0, Eddy_Visc);
+      
+      /*--- Solve for the new value of nu_tilde given the eddy viscosity and using a Newton method ---*/
+      
+      nu_til_old = 0.0; nu_til = 0.0; cv1_3 = 7.1*7.1*7.1;
+      nu_til_old = node[iPoint]->GetSolution(0);
+      counter = 0; diff = 1.0;
+      
+      while (diff > tol) {
         
-        /*--- Solve for the new value of nu_tilde given the eddy viscosity and using a Newton method ---*/
+        func = nu_til_old*nu_til_old*nu_til_old*nu_til_old - (Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old*nu_til_old + Kin_Visc_Normal*Kin_Visc_Normal*Kin_Visc_Normal*cv1_3);
+        func_prim = 4.0 * nu_til_old*nu_til_old*nu_til_old - 3.0*(Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old);
+        nu_til = nu_til_old - func/func_prim;
         
-        nu_til_old = 0.0; nu_til = 0.0; cv1_3 = 7.1*7.1*7.1;
-        nu_til_old = node[iPoint]->GetSolution(0);
-        counter = 0; diff = 1.0;
+        diff = fabs(nu_til-nu_til_old);
+        nu_til_old = nu_til;
         
-        while (diff > tol) {
-          
-          func = nu_til_old*nu_til_old*nu_til_old*nu_til_old - (Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old*nu_til_old + Kin_Visc_Normal*Kin_Visc_Normal*Kin_Visc_Normal*cv1_3);
-          func_prim = 4.0 * nu_til_old*nu_til_old*nu_til_old - 3.0*(Eddy_Visc/Density_Normal)*(nu_til_old*nu_til_old);
-          nu_til = nu_til_old - func/func_prim;
-          
-          diff = fabs(nu_til-nu_til_old);
-          nu_til_old = nu_til;
-          
-          counter++;
-          if (counter > max_iter) {
-            cout << "WARNING: Nu_tilde evaluation has not converged." << endl;
-            break;
-          }
-          
+        counter++;
+        if (counter > max_iter) {
+          cout << "WARNING: Nu_tilde evaluation has not converged." << endl;
+          break;
         }
-  
-        for (iVar = 0; iVar < nVar; iVar++)
-          Solution[iVar] = nu_til;
-        
-        node[iPoint_Neighbor]->SetSolution_Old(Solution);
-        LinSysRes.SetBlock_Zero(iPoint_Neighbor);
-        
-        /*--- includes 1 in the diagonal ---*/
-        
-        Jacobian.DeleteValsRowi(iPoint_Neighbor);
         
       }
+
+      for (iVar = 0; iVar < nVar; iVar++)
+        Solution[iVar] = nu_til;
+      
+      node[iPoint_Neighbor]->SetSolution_Old(Solution);
+      LinSysRes.SetBlock_Zero(iPoint_Neighbor);
+      
+      /*--- includes 1 in the diagonal ---*/
       
+      Jacobian.DeleteValsRowi(iPoint_Neighbor);
+      
+    }
+  }
+}
+
+void CTurbSASolver::SetWallFunction_Donors(CGeometry *geometry, unsigned short val_marker) {
+  
+  unsigned long iVertex, iPoint, jPoint;
+  unsigned short iNode;
+  
+  if (WF_Donor_Start.size() < nMarker) {
+    WF_Donor_Start.resize(nMarker);
+    WF_Donor_Point.resize(nMarker);
+    WF_Donor_TauWall.resize(nMarker);
+  }
+  if (!WF_Donor_Start[val_marker].empty()) return;
+  
+  /*--- The donors are the neighbours of the wall vertices (of the domain) that are not
+   on the physical boundary. They only depend on the connectivity, hence they remain
+   valid when the grid moves or deforms and only their coordinates are updated. ---*/
+  
+  vector<unsigned long> &donor_start = WF_Donor_Start[val_marker];
+  vector<unsigned long> &donor_point = WF_Donor_Point[val_marker];
+  
+  donor_start.resize(geometry->nVertex[val_marker]+1, 0);
+  
+  for (iVertex = 0; iVertex < geometry->nVertex[val_marker]; iVertex++) {
+    iPoint = geometry->vertex[val_marker][iVertex]->GetNode();
+    
+    if (geometry->node[iPoint]->GetDomain()) {
+      for (iNode = 0; iNode < geometry->node[iPoint]->GetnPoint(); iNode++) {
+        jPoint = geometry->node[iPoint]->GetPoint(iNode);
+        if (!geometry->node[jPoint]->GetBoundary()) donor_point.push_back(jPoint);
+      }
+    }
+    donor_start[iVertex+1] = donor_point.size();
+  }
+  
+  /*--- No wall shear stress is available yet as initial guess ---*/
+  
+  WF_Donor_TauWall[val_marker].assign(donor_point.size(), -1.0);
+  
+}
+
+void CTurbSASolver::SetDES_Geometry(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short kindHybridRANSLES = config->GetKind_HybridRANSLES();
+  unsigned long iPoint, jPoint, iNeigh, nNeigh, ExtIter = config->GetExtIter();
+  unsigned short iDim;
+  su2double *coord_i, *coord_j, *delta;
+  
+  /*--- The terms only depend on the coordinates, they are refreshed when the grid moves ---*/
+  
+  if (DES_Geometry_Ready && !(config->GetGrid_Movement() && (ExtIter != DES_Geometry_Iter))) return;
+  
+  DES_Geometry_Ready = true;
+  DES_Geometry_Iter  = ExtIter;
+  
+  if (kindHybridRANSLES == SA_ZDES) {
+    
+    /*--- Largest distance to a neighbour in each direction, for the
+     vorticity weighted measure of the cell size ---*/
+    
+    DES_Delta.assign(3*nPointDomain, 0.0);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      coord_i = geometry->node[iPoint]->GetCoord();
+      delta   = &DES_Delta[3*iPoint];
+      for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+        jPoint  = geometry->node[iPoint]->GetPoint(iNeigh);
+        coord_j = geometry->node[jPoint]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++)
+          delta[iDim] = max(delta[iDim], fabs(coord_j[iDim] - coord_i[iDim]));
+      }
+    }
+    
+  }
+  
+  if (kindHybridRANSLES == SA_EDDES) {
+    
+    /*--- Coordinate differences to the neighbours, the largest cross product
+     with the direction of the vorticity is taken at each iteration ---*/
+    
+    DES_Neighbor_Begin.assign(nPointDomain+1, 0);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      DES_Neighbor_Begin[iPoint+1] = DES_Neighbor_Begin[iPoint] + geometry->node[iPoint]->GetnPoint();
+    
+    DES_Neighbor_Delta.assign(3*DES_Neighbor_Begin[nPointDomain], 0.0);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      coord_i = geometry->node[iPoint]->GetCoord();
+      nNeigh  = geometry->node[iPoint]->GetnPoint();
+      for (iNeigh = 0; iNeigh < nNeigh; iNeigh++) {
+        jPoint  = geometry->node[iPoint]->GetPoint(iNeigh);
+        coord_j = geometry->node[jPoint]->GetCoord();
+        delta   = &DES_Neighbor_Delta[3*(DES_Neighbor_Begin[iPoint]+iNeigh)];
+        for (iDim = 0; iDim < nDim; iDim++)
+          delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);
+      }
     }
+    
   }
+  
 }
 
-void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config){
+void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CConfig *config, unsigned long iPoint){
   
   unsigned short kindHybridRANSLES = config->GetKind_HybridRANSLES();
-  unsigned long iPoint = 0, jPoint = 0;
-  unsigned short iDim = 0, jDim = 0, iNeigh = 0, nNeigh = 0;
+  unsigned long jPoint = 0, iNeigh = 0, nNeigh = 0;
+  unsigned short iDim = 0, jDim = 0;
   
   su2double constDES = config->GetConst_DES();
   
   su2double density = 0.0, laminarViscosity = 0.0, kinematicViscosity = 0.0,
       eddyViscosity = 0.0, kinematicViscosityTurb = 0.0, wallDistance = 0.0, lengthScale = 0.0;
   
-  su2double maxDelta = 0.0, deltaAux = 0.0, distDES = 0.0, uijuij = 0.0, k2 = 0.0, r_d = 0.0, f_d = 0.0,
+  su2double maxDelta = 0.0, distDES = 0.0, uijuij = 0.0, k2 = 0.0, r_d = 0.0, f_d = 0.0,
       deltaDDES = 0.0, omega = 0.0, ln_max = 0.0, ln[3] = {0.0, 0.0, 0.0},
       aux_ln = 0.0, f_kh = 0.0;
   
-  su2double nu_hat, fw_star = 0.424, cv1_3 = pow(7.1, 3.0); k2 = pow(0.41, 2.0);
-  su2double cb1   = 0.1355, ct3 = 1.2, ct4   = 0.5;
-  su2double sigma = 2./3., cb2 = 0.622, f_max=1.0, f_min=0.1, a1=0.15, a2=0.3;
-  su2double cw1 = 0.0, Ji = 0.0, Ji_2 = 0.0, Ji_3 = 0.0, fv1 = 0.0, fv2 = 0.0, ft2 = 0.0, psi_2 = 0.0;
-  su2double *coord_i = NULL, *coord_j = NULL, **primVarGrad = NULL, *vorticity = NULL, delta[3] = {0.0,0.0,0.0},
+  su2double f_max=1.0, f_min=0.1, a1=0.15, a2=0.3; k2 = pow(0.41, 2.0);
+  su2double **primVarGrad = NULL, *vorticity = NULL, *delta = NULL,
       ratioOmega[3] = {0.0, 0.0, 0.0}, vortexTiltingMeasure = 0.0;
-
-  for (iPoint = 0; iPoint < nPointDomain; iPoint++){
-    
-    coord_i                 = geometry->node[iPoint]->GetCoord();
-    nNeigh                  = geometry->node[iPoint]->GetnPoint();
-    wallDistance            = geometry->node[iPoint]->GetWall_Distance();
-    primVarGrad             = solver[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
-    vorticity               = solver[FLOW_SOL]->node[iPoint]->GetVorticity();    
-    density                 = solver[FLOW_SOL]->node[iPoint]->GetDensity();
-    laminarViscosity        = solver[FLOW_SOL]->node[iPoint]->GetLaminarViscosity();
-    eddyViscosity           = solver[TURB_SOL]->node[iPoint]->GetmuT();
-    kinematicViscosity      = laminarViscosity/density;
-    kinematicViscosityTurb  = eddyViscosity/density;
-    
+  
+  nNeigh                  = geometry->node[iPoint]->GetnPoint();
+  wallDistance            = geometry->node[iPoint]->GetWall_Distance();
+  primVarGrad             = solver[FLOW_SOL]->node[iPoint]->GetGradient_Primitive();
+  vorticity               = solver[FLOW_SOL]->node[iPoint]->GetVorticity();    
+  density                 = solver[FLOW_SOL]->node[iPoint]->GetDensity();
+  laminarViscosity        = solver[FLOW_SOL]->node[iPoint]->GetLaminarViscosity();
+  eddyViscosity           = solver[TURB_SOL]->node[iPoint]->GetmuT();
+  kinematicViscosity      = laminarViscosity/density;
+  kinematicViscosityTurb  = eddyViscosity/density;
+  
+  /*--- Largest edge of the cell, stored by the geometry ---*/
+  
+  deltaDDES = geometry->node[iPoint]->GetMaxLength();
+  
+  /*--- The shielding function is not needed by the original DES ---*/
+  
+  if (kindHybridRANSLES != SA_DES) {
     uijuij = 0.0;
     for(iDim = 0; iDim < nDim; iDim++){
       for(jDim = 0; jDim < nDim; jDim++){
@@ -3344,144 +3446,108 @@ void CTurbSASolver::SetDES_LengthScale(CSolver **solver, CGeometry *geometry, CC
     uijuij = sqrt(fabs(uijuij));
     uijuij = max(uijuij,1e-10);
     
-    /*--- Low Reynolds number correction term ---*/
-    
-    nu_hat = node[iPoint]->GetSolution()[0];
-    Ji   = nu_hat/kinematicViscosity;
-    Ji_2 = Ji * Ji;
-    Ji_3 = Ji*Ji*Ji;
-    fv1  = Ji_3/(Ji_3+cv1_3);
-    fv2 = 1.0 - Ji/(1.0+Ji*fv1);
-    ft2 = ct3*exp(-ct4*Ji_2);
-    cw1 = cb1/k2+(1.0+cb2)/sigma;
-    
-    psi_2 = (1.0 - (cb1/(cw1*k2*fw_star))*(ft2 + (1.0 - ft2)*fv2))/(fv1 * max(1.0e-10,1.0-ft2));
-    psi_2 = min(100.0,psi_2);
-    
-    switch(kindHybridRANSLES){
-      case SA_DES:
-        /*--- Original Detached Eddy Simulation (DES97)
-        Spalart
-        1997
-        ---*/
-        
-        maxDelta = geometry->node[iPoint]->GetMaxLength();
-        distDES         = constDES * maxDelta;
-        lengthScale = min(distDES,wallDistance);
-                
-        break;
-        
-      case SA_DDES:
-        /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
-         Spalart et al.
-         Theoretical and Computational Fluid Dynamics - 2006
-         ---*/
-            
-        maxDelta = geometry->node[iPoint]->GetMaxLength();
-        
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-        
-        distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-        
-        break;
-      case SA_ZDES:
-        /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
-         Deck
-         Theoretical and Computational Fluid Dynamics - 2012
-         ---*/
-        
-        for (iNeigh = 0; iNeigh < nNeigh; iNeigh++){
-            jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-            coord_j = geometry->node[jPoint]->GetCoord();
-            for ( iDim = 0; iDim < nDim; iDim++){
-              deltaAux       = abs(coord_j[iDim] - coord_i[iDim]);
-              delta[iDim]     = max(delta[iDim], deltaAux);
-            }
-            deltaDDES = geometry->node[iPoint]->GetMaxLength();
-        }
-        
-        omega = sqrt(vorticity[0]*vorticity[0] + 
-                     vorticity[1]*vorticity[1] +
-                     vorticity[2]*vorticity[2]);
-        
-        for (iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
+    r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
+    f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+  }
   
-        maxDelta = sqrt(pow(ratioOmega[0],2.0)*delta[1]*delta[2] +
-                        pow(ratioOmega[1],2.0)*delta[0]*delta[2] +
-                        pow(ratioOmega[2],2.0)*delta[0]*delta[1]);
-            
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
-        
-        if (f_d < 0.99){
-          maxDelta = deltaDDES;
-        }
-        
-        distDES = constDES * maxDelta;
-        lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
-        
-        break;
-        
-      case SA_EDDES:
-        
-        /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
-         Shur et al.
-         Flow Turbulence Combust - 2015
-         ---*/
-        
-        vortexTiltingMeasure = node[iPoint]->GetVortex_Tilting();
-        
-        omega = sqrt(vorticity[0]*vorticity[0] + 
-                     vorticity[1]*vorticity[1] +
-                     vorticity[2]*vorticity[2]);
-        
-        for (iDim = 0; iDim < 3; iDim++){
-          ratioOmega[iDim] = vorticity[iDim]/omega;
-        }
-        
-        ln_max = 0.0;
-        deltaDDES = 0.0;
-        for (iNeigh = 0;iNeigh < nNeigh; iNeigh++){
-          jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-          coord_j = geometry->node[jPoint]->GetCoord();
-          for (iDim = 0; iDim < nDim; iDim++){
-            delta[iDim] = fabs(coord_j[iDim] - coord_i[iDim]);            
-          }
-          deltaDDES = geometry->node[iPoint]->GetMaxLength();
-          ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
-          ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
-          ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
-          aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
-          ln_max = max(ln_max,aux_ln);
-          vortexTiltingMeasure += node[jPoint]->GetVortex_Tilting();
-        }
+  switch(kindHybridRANSLES){
+    case SA_DES:
+      /*--- Original Detached Eddy Simulation (DES97)
+      Spalart
+      1997
+      ---*/
+      
+      distDES         = constDES * deltaDDES;
+      lengthScale = min(distDES,wallDistance);
+              
+      break;
+      
+    case SA_DDES:
+      /*--- A New Version of Detached-eddy Simulation, Resistant to Ambiguous Grid Densities.
+       Spalart et al.
+       Theoretical and Computational Fluid Dynamics - 2006
+       ---*/
+      
+      distDES = constDES * deltaDDES;
+      lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
+      
+      break;
+    case SA_ZDES:
+      /*--- Recent improvements in the Zonal Detached Eddy Simulation (ZDES) formulation.
+       Deck
+       Theoretical and Computational Fluid Dynamics - 2012
+       ---*/
+      
+      delta = &DES_Delta[3*iPoint];
+      
+      omega = sqrt(vorticity[0]*vorticity[0] + 
+                   vorticity[1]*vorticity[1] +
+                   vorticity[2]*vorticity[2]);
+      
+      for (iDim = 0; iDim < 3; iDim++){
+        ratioOmega[iDim] = vorticity[iDim]/omega;
+      }
 
-        vortexTiltingMeasure = (vortexTiltingMeasure/fabs(nNeigh + 1.0));
-        
-        f_kh = max(f_min, min(f_max, f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
-        
-        r_d = (kinematicViscosityTurb+kinematicViscosity)/(uijuij*k2*pow(wallDistance, 2.0));
-        f_d = 1.0-tanh(pow(8.0*r_d,3.0));
+      maxDelta = sqrt(pow(ratioOmega[0],2.0)*delta[1]*delta[2] +
+                      pow(ratioOmega[1],2.0)*delta[0]*delta[2] +
+                      pow(ratioOmega[2],2.0)*delta[0]*delta[1]);
+      
+      if (f_d < 0.99){
+        maxDelta = deltaDDES;
+      }
+      
+      distDES = constDES * maxDelta;
+      lengthScale = wallDistance-f_d*max(0.0,(wallDistance-distDES));
+      
+      break;
+      
+    case SA_EDDES:
+      
+      /*--- An Enhanced Version of DES with Rapid Transition from RANS to LES in Separated Flows.
+       Shur et al.
+       Flow Turbulence Combust - 2015
+       ---*/
+      
+      vortexTiltingMeasure = node[iPoint]->GetVortex_Tilting();
+      
+      omega = sqrt(vorticity[0]*vorticity[0] + 
+                   vorticity[1]*vorticity[1] +
+                   vorticity[2]*vorticity[2]);
+      
+      for (iDim = 0; iDim < 3; iDim++){
+        ratioOmega[iDim] = vorticity[iDim]/omega;
+      }
+      
+      ln_max = 0.0;
+      for (iNeigh = 0;iNeigh < nNeigh; iNeigh++){
+        jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+        delta = &DES_Neighbor_Delta[3*(DES_Neighbor_Begin[iPoint]+iNeigh)];
+        ln[0] = delta[1]*ratioOmega[2] - delta[2]*ratioOmega[1];
+        ln[1] = delta[2]*ratioOmega[0] - delta[0]*ratioOmega[2];
+        ln[2] = delta[0]*ratioOmega[1] - delta[1]*ratioOmega[0];
+        aux_ln = sqrt(ln[0]*ln[0] + ln[1]*ln[1] + ln[2]*ln[2]);
+        ln_max = max(ln_max,aux_ln);
+        vortexTiltingMeasure += node[jPoint]->GetVortex_Tilting();
+      }
 
-        maxDelta = (ln_max/sqrt(3.0)) * f_kh;
-        if (f_d < 0.999){
-          maxDelta = deltaDDES;
-        }
-        
-        distDES = constDES * maxDelta;
-        lengthScale=wallDistance-f_d*max(0.0,(wallDistance-distDES));
-        
-        break;
-        
-    }
-    
-    node[iPoint]->SetDES_LengthScale(lengthScale);
-  
+      vortexTiltingMeasure = (vortexTiltingMeasure/fabs(nNeigh + 1.0));
+      
+      f_kh = max(f_min, min(f_max, f_min + ((f_max - f_min)/(a2 - a1)) * (vortexTiltingMeasure - a1)));
+
+      maxDelta = (ln_max/sqrt(3.0)) * f_kh;
+      if (f_d < 0.999){
+        maxDelta = deltaDDES;
+      }
+      
+      distDES = constDES * maxDelta;
+      lengthScale=wallDistance-f_d*max(0.0,(wallDistance-distDES));
+      
+      break;
+      
   }
+  
+  node[iPoint]->SetDES_LengthScale(lengthScale);
+  
 }
 
 void CTurbSASolver::SetInletAtVertex(su2double *val_inlet,
@@ -3608,7 +3674,7 @@ CTurbSSTSolver::CTurbSSTSolver(CGeometry *geometry, CConfig *config, unsigned sh
     /*--- Define some auxiliary vector related with the residual ---*/
     
     Residual = new su2double[nVar];     for (iVar = 0; iVar < nVar; iVar++) Residual[iVar]  = 0.0;
-    Residual_RMS = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
+    Residual_RMS = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_RMS[iVar]  = 0.0;
     Residual_i = new su2double[nVar];   for (iVar = 0; iVar < nVar; iVar++) Residual_i[iVar]  = 0.0;
     Residual_j = new su2double[nVar];   for (iVar = 0; iVar < nVar; iVar++) Residual_j[iVar]  = 0.0;
     Residual_Max = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) Residual_Max[iVar]  = 0.0;
@@ -3835,8 +3901,9 @@ void CTurbSSTSolver::Preprocessing(CGeometry *geometry, CSolver **solver_contain
     
   }
   
-  /*--- Initialize the Jacobian matrices ---*/
+  /*--- Initialize the Jacobian matrices, unless the last one is reused (JACOBIAN_LAG) ---*/
   
+  SetJacobian_Lag(config);
   Jacobian.SetValZero();
 
   /*--- Upwind second order reconstruction ---*/
@@ -36,6 +36,8 @@
  */
 
 #include "../include/solver_structure.hpp"
+#include "../../Common/include/adt_structure.hpp"
+#include "../../Common/include/comm_profiler.hpp"
 
 CSolver::CSolver(void) {
 
@@ -46,6 +48,7 @@ CSolver::CSolver(void) {
   
   OutputHeadingNames = NULL;
   Residual_RMS       = NULL;
+  Residual_RMS_Sum   = NULL;
   Residual_Max       = NULL;
   Residual_BGS       = NULL;
   Residual_Max_BGS   = NULL;
@@ -82,6 +85,20 @@ CSolver::CSolver(void) {
   node               = NULL;
   nOutputVariables   = 0;
 
+  Periodic_Vector_Rotation = false;
+  JacobianFree_Product     = NULL;
+
+  nTimeAvg_Samples = 0;
+  TimeAvg          = NULL;
+
+  nMarker_ForceCache = 0;
+  nVertex_ForceCache = NULL;
+  Vertex_ForceCache  = NULL;
+  Point_ForceCache   = NULL;
+  Normal_ForceCache  = NULL;
+  Coord_ForceCache   = NULL;
+  Dynamic_ForceCache = false;
+
   /*--- Inlet profile data structures. ---*/
 
   nRowCum_InletFile = NULL;
@@ -91,6 +108,19 @@ CSolver::CSolver(void) {
 
   /*--- Variable initialization to avoid valgrid warnings when not used. ---*/
   IterLinSolver = 0;
+  ResLinSolver  = 0.0;
+
+  Jacobian_Age     = 0;
+  Jacobian_LinIter = 0;
+  Jacobian_LinRes  = 0.0;
+  Jacobian_Refresh = true;
+
+  SensSmooth_Ready = false;
+  Local_Freezing   = false;
+  Edge_Subset      = false;
+
+  Multirate_nLevel     = 0;
+  Multirate_Delta_Time = 0.0;
 }
 
 CSolver::~CSolver(void) {
@@ -114,6 +144,7 @@ CSolver::~CSolver(void) {
   /*--- Private ---*/
 
   if (Residual_RMS != NULL) delete [] Residual_RMS;
+  if (Residual_RMS_Sum != NULL) delete Residual_RMS_Sum;
   if (Residual_Max != NULL) delete [] Residual_Max;
   if (Residual != NULL) delete [] Residual;
   if (Residual_i != NULL) delete [] Residual_i;
@@ -208,2005 +239,3582 @@ CSolver::~CSolver(void) {
   if (nCol_InletFile    != NULL) {delete [] nCol_InletFile;    nCol_InletFile    = NULL;}
   if (Inlet_Data        != NULL) {delete [] Inlet_Data;        Inlet_Data        = NULL;}
 
+  if (TimeAvg != NULL) delete [] TimeAvg;
+
+  DeleteForce_Cache();
+
 }
 
-void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar;
+/*--- Name of the quantities exchanged by InitiateComms/CompleteComms, for the profiling ---*/
+
+static string MPI_Quantity_Name(unsigned short commType) {
+  switch (commType) {
+    case SOLUTION:               return "SOLUTION";
+    case SOLUTION_OLD:           return "SOLUTION_OLD";
+    case UNDIVIDED_LAPLACIAN:    return "UNDIVIDED_LAPLACIAN";
+    case MAX_EIGENVALUE:         return "MAX_EIGENVALUE";
+    case SENSOR:                 return "SENSOR";
+    case SOLUTION_GRADIENT:      return "SOLUTION_GRADIENT";
+    case SOLUTION_LIMITER:       return "SOLUTION_LIMITER";
+    case PRIMITIVE_GRADIENT:     return "PRIMITIVE_GRADIENT";
+    case PRIMITIVE_LIMITER:      return "PRIMITIVE_LIMITER";
+    case PRIMITIVE_GRAD_LIMITER: return "PRIMITIVE_GRAD_LIMITER";
+    case SOLUTION_EDDY_VISCOSITY: return "SOLUTION_EDDY_VISCOSITY";
+    case UNDIVIDED_LAPLACIAN_SENSOR: return "UNDIVIDED_LAPLACIAN_SENSOR";
+    case DELTA_TIME:             return "DELTA_TIME";
+    case RES_SMOOTH:             return "RES_SMOOTH";
+    default:                     return "UNKNOWN";
+  }
+}
+
+void CSolver::InitiateComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+  
+  unsigned short iVar, iDim, MarkerS, countPerPoint = 0;
+  unsigned long iVertex, iPoint, nVertexS;
+  int iMessage;
+  su2double *bufDSend;
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  /*--- The pattern is built once per geometry, the first time it is needed. ---*/
+  
+  if (!geometry->P2P_Ready) geometry->PreprocessP2PComms(config);
+  
+  switch (commType) {
+    case SOLUTION: case SOLUTION_OLD: case UNDIVIDED_LAPLACIAN: case SOLUTION_LIMITER: case RES_SMOOTH:
+      countPerPoint = nVar; break;
+    case SOLUTION_EDDY_VISCOSITY: case UNDIVIDED_LAPLACIAN_SENSOR:
+      countPerPoint = nVar+1; break;
+    case MAX_EIGENVALUE:
+      countPerPoint = 2; break;
+    case SENSOR: case DELTA_TIME:
+      countPerPoint = 1; break;
+    case SOLUTION_GRADIENT:
+      countPerPoint = nVar*nDim; break;
+    case PRIMITIVE_GRADIENT:
+      countPerPoint = nPrimVarGrad*nDim; break;
+    case PRIMITIVE_LIMITER:
+      countPerPoint = nPrimVarGrad; break;
+    case PRIMITIVE_GRAD_LIMITER:
+      countPerPoint = nPrimVarGrad*(nDim+1); break;
+    default:
+      SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.", CURRENT_FUNCTION);
+      break;
+  }
   
-#ifndef HAVE_MPI
+  geometry->AllocateP2PComms(countPerPoint);
   
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Post the receives first, such that the sends can complete as soon as possible. ---*/
+  
+  geometry->PostP2PRecvs(commType);
+  
+  /*--- Pack the values of all send markers, point by point, in the send buffer. ---*/
+  
+  for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++) {
     
-    if (GetRes_RMS(iVar) != GetRes_RMS(iVar)) {
-        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
-    }
-
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(GetRes_RMS(iVar)/geometry->GetnPoint())));
+    MarkerS  = geometry->Marker_P2PSend[iMessage];
+    nVertexS = geometry->nVertex[MarkerS];
+    bufDSend = &(geometry->bufD_P2PSend[countPerPoint*geometry->nVertex_P2PSend[iMessage]]);
     
+    for (iVertex = 0; iVertex < nVertexS; iVertex++, bufDSend += countPerPoint) {
+      iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+      switch (commType) {
+        case SOLUTION:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetSolution(iVar);
+          break;
+        case SOLUTION_OLD:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetSolution_Old(iVar);
+          break;
+        case UNDIVIDED_LAPLACIAN:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+          break;
+        case SOLUTION_LIMITER:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetLimiter(iVar);
+          break;
+        case SOLUTION_EDDY_VISCOSITY:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetSolution(iVar);
+          bufDSend[nVar] = node[iPoint]->GetmuT();
+          break;
+        case UNDIVIDED_LAPLACIAN_SENSOR:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = node[iPoint]->GetUndivided_Laplacian(iVar);
+          bufDSend[nVar] = node[iPoint]->GetSensor();
+          break;
+        case MAX_EIGENVALUE:
+          bufDSend[0] = node[iPoint]->GetLambda();
+          bufDSend[1] = su2double(geometry->node[iPoint]->GetnPoint());
+          break;
+        case SENSOR:
+          bufDSend[0] = node[iPoint]->GetSensor();
+          break;
+        case DELTA_TIME:
+          bufDSend[0] = node[iPoint]->GetDelta_Time();
+          break;
+        case RES_SMOOTH:
+          for (iVar = 0; iVar < nVar; iVar++) bufDSend[iVar] = Res_Smooth[iVar*nPoint+iPoint];
+          break;
+        case SOLUTION_GRADIENT:
+          for (iVar = 0; iVar < nVar; iVar++)
+            for (iDim = 0; iDim < nDim; iDim++)
+              bufDSend[iVar*nDim+iDim] = node[iPoint]->GetGradient(iVar, iDim);
+          break;
+        case PRIMITIVE_GRADIENT:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+            for (iDim = 0; iDim < nDim; iDim++)
+              bufDSend[iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+          break;
+        case PRIMITIVE_LIMITER:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) bufDSend[iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+          break;
+        case PRIMITIVE_GRAD_LIMITER:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            for (iDim = 0; iDim < nDim; iDim++)
+              bufDSend[iVar*nDim+iDim] = node[iPoint]->GetGradient_Primitive(iVar, iDim);
+            bufDSend[nPrimVarGrad*nDim+iVar] = node[iPoint]->GetLimiter_Primitive(iVar);
+          }
+          break;
+        default:
+          break;
+      }
+    }
   }
   
-#else
-  
-  int nProcessor = size, iProcessor;
-
-  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
-  unsigned long *sbuf_point, *rbuf_point, Local_nPointDomain, Global_nPointDomain;
-  unsigned short iDim;
+  /*--- Launch the sends to all neighbors at once. ---*/
   
-  /*--- Set the L2 Norm residual in all the processors ---*/
+  geometry->PostP2PSends(commType);
   
-  sbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  rbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = 0.0;
+  /*--- Messages and bytes sent to each neighbor, for the communication statistics. ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_RMS(iVar);
-  Local_nPointDomain = geometry->GetnPointDomain();
+  if (CCommProfiler::GetActive()) {
+    const unsigned short category = CCommProfiler::GetCategory(MPI_Quantity_Name(commType), false);
+    for (iMessage = 0; iMessage < geometry->nP2PSend; iMessage++)
+      CCommProfiler::AddMessage(category, geometry->Neighbor_P2PSend[iMessage],
+                                countPerPoint*(geometry->nVertex_P2PSend[iMessage+1] -
+                                               geometry->nVertex_P2PSend[iMessage])*sizeof(passivedouble));
+  }
   
+  config->Tock(tick, "InitiateComms_"+MPI_Quantity_Name(commType), PROFILE_COMMS);
   
-  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+}
+
+void CSolver::CompleteComms(CGeometry *geometry, CConfig *config, unsigned short commType) {
+  
+  unsigned short iVar, iDim, MarkerR, countPerPoint = geometry->countPerPoint, nVector = 0;
+  unsigned long iVertex, iPoint, nVertexR, firstPoint;
+  int iMessage, ind;
+  su2double *bufDRecv;
+  vector<unsigned short> vecOffset;
+  
+  double tick = 0.0;
+  config->Tick(&tick);
+  
+  /*--- Time spent waiting for the messages, for the communication statistics. ---*/
+  
+  const bool profile_comms = CCommProfiler::GetActive();
+  double tick_wait = 0.0, time_wait = 0.0;
+  
+  /*--- Positions of the vectors that are rotated for the periodic vertices:
+   the vector components (momentum, velocity) of the solution-like quantities
+   of the flow solvers, and the gradients of all the variables. ---*/
+  
+  switch (commType) {
+    case SOLUTION: case SOLUTION_OLD: case UNDIVIDED_LAPLACIAN: case RES_SMOOTH:
+    case UNDIVIDED_LAPLACIAN_SENSOR: case SOLUTION_LIMITER: case PRIMITIVE_LIMITER:
+      if (Periodic_Vector_Rotation) vecOffset.push_back(1);
+      break;
+    case SOLUTION_GRADIENT:
+      for (iVar = 0; iVar < nVar; iVar++) vecOffset.push_back(iVar*nDim);
+      break;
+    case PRIMITIVE_GRADIENT:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) vecOffset.push_back(iVar*nDim);
+      break;
+    case PRIMITIVE_GRAD_LIMITER:
+      for (iVar = 0; iVar < nPrimVarGrad; iVar++) vecOffset.push_back(iVar*nDim);
+      
+      /*--- The limiter follows the gradient in the combined message. ---*/
+      
+      if (Periodic_Vector_Rotation) vecOffset.push_back(nPrimVarGrad*nDim+1);
+      break;
+    default:
+      break;
+  }
+  nVector = vecOffset.size();
   
+  /*--- Unpack the messages in the order in which they arrive. ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++) {
+  for (iMessage = 0; iMessage < geometry->nP2PRecv; iMessage++) {
     
-    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
-      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
-    }
+    if (profile_comms) tick_wait = CCommProfiler::GetTime();
+    ind = geometry->WaitP2PRecv();
+    if (profile_comms) time_wait += CCommProfiler::GetTime() - tick_wait;
+    
+    MarkerR    = geometry->Marker_P2PRecv[ind];
+    nVertexR   = geometry->nVertex[MarkerR];
+    firstPoint = geometry->FirstPoint_P2PRecv[ind];
+    bufDRecv   = &(geometry->bufD_P2PRecv[countPerPoint*geometry->nVertex_P2PRecv[ind]]);
+    
+    /*--- Rotate the vectors of the periodic vertices in the packed buffer. ---*/
     
-    SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+    if (nVector > 0) geometry->RotateP2PRecv(ind, nVector, vecOffset.data());
     
+    for (iVertex = 0; iVertex < nVertexR; iVertex++, bufDRecv += countPerPoint) {
+      
+      /*--- The halo points of a message are usually consecutive. ---*/
+      
+      if (firstPoint < nPoint) iPoint = firstPoint+iVertex;
+      else iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+      
+      /*--- Store the received values in the halo point. ---*/
+      
+      switch (commType) {
+        case SOLUTION:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, bufDRecv[iVar]);
+          break;
+        case SOLUTION_OLD:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution_Old(iVar, bufDRecv[iVar]);
+          break;
+        case UNDIVIDED_LAPLACIAN:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetUndivided_Laplacian(iVar, bufDRecv[iVar]);
+          break;
+        case SOLUTION_LIMITER:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetLimiter(iVar, bufDRecv[iVar]);
+          break;
+        case SOLUTION_EDDY_VISCOSITY:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetSolution(iVar, bufDRecv[iVar]);
+          node[iPoint]->SetmuT(bufDRecv[nVar]);
+          break;
+        case UNDIVIDED_LAPLACIAN_SENSOR:
+          for (iVar = 0; iVar < nVar; iVar++) node[iPoint]->SetUndivided_Laplacian(iVar, bufDRecv[iVar]);
+          node[iPoint]->SetSensor(bufDRecv[nVar]);
+          break;
+        case MAX_EIGENVALUE:
+          node[iPoint]->SetLambda(bufDRecv[0]);
+          geometry->node[iPoint]->SetnNeighbor((unsigned short)SU2_TYPE::Int(bufDRecv[1]));
+          break;
+        case SENSOR:
+          node[iPoint]->SetSensor(bufDRecv[0]);
+          break;
+        case DELTA_TIME:
+          node[iPoint]->SetDelta_Time(bufDRecv[0]);
+          break;
+        case RES_SMOOTH:
+          for (iVar = 0; iVar < nVar; iVar++) Res_Smooth[iVar*nPoint+iPoint] = bufDRecv[iVar];
+          break;
+        case SOLUTION_GRADIENT:
+          for (iVar = 0; iVar < nVar; iVar++)
+            for (iDim = 0; iDim < nDim; iDim++)
+              node[iPoint]->SetGradient(iVar, iDim, bufDRecv[iVar*nDim+iDim]);
+          break;
+        case PRIMITIVE_GRADIENT:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++)
+            for (iDim = 0; iDim < nDim; iDim++)
+              node[iPoint]->SetGradient_Primitive(iVar, iDim, bufDRecv[iVar*nDim+iDim]);
+          break;
+        case PRIMITIVE_LIMITER:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) node[iPoint]->SetLimiter_Primitive(iVar, bufDRecv[iVar]);
+          break;
+        case PRIMITIVE_GRAD_LIMITER:
+          for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
+            for (iDim = 0; iDim < nDim; iDim++)
+              node[iPoint]->SetGradient_Primitive(iVar, iDim, bufDRecv[iVar*nDim+iDim]);
+            node[iPoint]->SetLimiter_Primitive(iVar, bufDRecv[nPrimVarGrad*nDim+iVar]);
+          }
+          break;
+        default:
+          break;
+      }
+    }
   }
   
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
+  /*--- Make sure the sends are done before the send buffer is reused. ---*/
   
-  /*--- Set the Maximum residual in all the processors ---*/
-  sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
-  sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
+  if (profile_comms) tick_wait = CCommProfiler::GetTime();
+  geometry->CompleteP2PSends();
   
-  rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
-  rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
-  rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
-
-  for (iVar = 0; iVar < nVar; iVar++) {
-    sbuf_residual[iVar] = GetRes_Max(iVar);
-    sbuf_point[iVar] = GetPoint_Max(iVar);
-    Coord = GetPoint_Max_Coord(iVar);
-    for (iDim = 0; iDim < nDim; iDim++)
-      sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+  if (profile_comms) {
+    time_wait += CCommProfiler::GetTime() - tick_wait;
+    CCommProfiler::AddCall(CCommProfiler::GetCategory(MPI_Quantity_Name(commType), false), time_wait);
   }
   
-  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+  config->Tock(tick, "CompleteComms_"+MPI_Quantity_Name(commType), PROFILE_COMMS);
+  
+}
 
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      AddRes_Max(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
-    }
+void CSolver::SumCoefficients_AllRanks(unsigned short nScalar, su2double **Scalar,
+                                       unsigned short nArray, su2double **Array,
+                                       unsigned long nArray_Size) {
+
+#ifdef HAVE_MPI
+
+  /*--- One reduction of all coefficients instead of one per coefficient,
+   the reductions are latency bound and done in every iteration. ---*/
+
+  unsigned short iScalar, iArray;
+  unsigned long iEntry, nBuffer = nScalar + nArray*nArray_Size, iBuffer = 0;
+
+  accumdouble *MyBuffer = new accumdouble[nBuffer];
+  accumdouble *Buffer   = new accumdouble[nBuffer];
+
+  for (iScalar = 0; iScalar < nScalar; iScalar++)
+    MyBuffer[iBuffer++] = *Scalar[iScalar];
+  for (iArray = 0; iArray < nArray; iArray++)
+    for (iEntry = 0; iEntry < nArray_Size; iEntry++)
+      MyBuffer[iBuffer++] = Array[iArray][iEntry];
+
+  /*--- With REPRODUCIBLE_REDUCTIONS the sum over the ranks is exact, it does
+   not depend on the order of the reduction. The AD builds keep the MPI sum,
+   which is differentiated by the AD wrapper. ---*/
+
+#if !(defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE))
+  if (CReproducibleSum::GetActive()) {
+    CReproducibleSum Sum(nBuffer);
+    for (iBuffer = 0; iBuffer < nBuffer; iBuffer++)
+      Sum.Add(iBuffer, MyBuffer[iBuffer]);
+    Sum.AllReduce(Buffer);
   }
-  
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
-  
-  delete [] sbuf_point;
-  delete [] rbuf_point;
-  
-  delete [] sbuf_coord;
-  delete [] rbuf_coord;
-  
+  else
 #endif
-  
+    SU2_MPI::Allreduce(MyBuffer, Buffer, nBuffer, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+  iBuffer = 0;
+  for (iScalar = 0; iScalar < nScalar; iScalar++)
+    *Scalar[iScalar] = Buffer[iBuffer++];
+  for (iArray = 0; iArray < nArray; iArray++)
+    for (iEntry = 0; iEntry < nArray_Size; iEntry++)
+      Array[iArray][iEntry] = Buffer[iBuffer++];
+
+  delete [] MyBuffer;
+  delete [] Buffer;
+
+#endif
+
 }
 
-void CSolver::SetResidual_BGS(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar;
+void CSolver::SetJacobian_Lag(CConfig *config) {
 
-#ifndef HAVE_MPI
+  unsigned short lag = config->GetJacobian_Lag();
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  /*--- Only steady implicit solves of the uncoupled systems are lagged, the
+        discrete adjoint and time accurate runs need the current Jacobian. ---*/
 
-    if (GetRes_BGS(iVar) != GetRes_BGS(iVar)) {
-      SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
-    }
+  bool lagged = ((lag > 1) && (config->GetUnsteady_Simulation() == STEADY) &&
+                 !config->GetDiscrete_Adjoint() && !config->GetCoupled_Turb_Implicit());
 
-    SetRes_BGS(iVar, max(EPS*EPS, sqrt(GetRes_BGS(iVar)/geometry->GetnPoint())));
+  if (!lagged) { Jacobian.SetFrozen(false); return; }
 
+  Jacobian_Age++;
+
+  if (Jacobian_Refresh || (Jacobian_Age >= lag)) {
+    Jacobian.SetFrozen(false);
+    Jacobian_Age     = 0;
+    Jacobian_Refresh = false;
+  }
+  else {
+    Jacobian.SetFrozen(true);
   }
 
-#else
+}
 
-  int nProcessor = size, iProcessor;
+void CSolver::CheckJacobian_Lag(CConfig *config, unsigned long val_iter, su2double val_res_rel) {
 
-  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
-  unsigned long *sbuf_point, *rbuf_point, Local_nPointDomain, Global_nPointDomain;
-  unsigned short iDim;
+  /*--- Reference cost of the linear solve with a fresh Jacobian ---*/
 
-  /*--- Set the L2 Norm residual in all the processors ---*/
+  if (!Jacobian.GetFrozen()) {
+    Jacobian_LinIter = val_iter;
+    Jacobian_LinRes  = val_res_rel;
+    return;
+  }
 
-  sbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  rbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = 0.0;
+  /*--- The frozen Jacobian is too far off if the solve no longer reaches the
+        tolerance (or what the fresh Jacobian reached) or needs twice the
+        iterations it took after the last assembly ---*/
 
-  for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_BGS(iVar);
-  Local_nPointDomain = geometry->GetnPointDomain();
+  if ((val_res_rel > max(config->GetLinear_Solver_Error(), Jacobian_LinRes)) ||
+      (val_iter > 2*max(Jacobian_LinIter, (unsigned long)1)))
+    Jacobian_Refresh = true;
 
+}
 
-  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
-  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+void CSolver::SetLocal_Freezing(CGeometry *geometry, CConfig *config) {
 
+  unsigned long iPoint, jPoint, iEdge, iEdgeColor, nActive = 0, nActive_Global = 0;
+  unsigned short iColor, nColor = geometry->GetnEdgeColor();
+  su2double MyRes_Max = 0.0, Res_Max = 0.0;
 
-  for (iVar = 0; iVar < nVar; iVar++) {
+  unsigned long ExtIter = config->GetExtIter();
+  su2double Tolerance   = config->GetLocal_Freezing_Param(0);
+  unsigned long Sweep   = SU2_TYPE::Int(config->GetLocal_Freezing_Param(1));
+  unsigned long Start   = SU2_TYPE::Int(config->GetLocal_Freezing_Param(2));
 
-    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
+  /*--- After a sweep of the entire domain, the points with a small residual are
+        frozen and the edges are compacted, color by color. The residual of a
+        frozen point is incomplete, so it is only updated by the next sweep. ---*/
 
-      SU2_MPI::Error("SU2 has diverged (NaN detected)", CURRENT_FUNCTION);
+  if (!Local_Freezing && (ExtIter+1 >= Start)) {
 
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      MyRes_Max = max(MyRes_Max, Point_Residual[iPoint]);
+
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&MyRes_Max, &Res_Max, 1, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    Res_Max = MyRes_Max;
+#endif
+
+    /*--- The halo points are active on the rank that owns them, an edge to a
+          halo point is only needed here if the local point is active. The
+          residuals are squared norms. ---*/
+
+    Point_Active.assign(nPoint, false);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      Point_Active[iPoint] = (Point_Residual[iPoint] >= Tolerance*Tolerance*Res_Max);
+      if (Point_Active[iPoint]) nActive++;
     }
 
-    SetRes_BGS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+    Active_Edge.clear();
+    Active_Edge_Begin.assign(nColor+1, 0);
+    for (iColor = 0; iColor < nColor; iColor++) {
+      Active_Edge_Begin[iColor] = Active_Edge.size();
+      for (iEdgeColor = geometry->GetEdgeColor_Begin(iColor); iEdgeColor < geometry->GetEdgeColor_End(iColor); iEdgeColor++) {
+        iEdge = geometry->GetEdgeColor_Edge(iEdgeColor);
+        iPoint = geometry->GetEdge_Node(iEdge, 0); jPoint = geometry->GetEdge_Node(iEdge, 1);
+        if (Point_Active[iPoint] || Point_Active[jPoint]) Active_Edge.push_back(iEdge);
+      }
+    }
+    Active_Edge_Begin[nColor] = Active_Edge.size();
+    Active_Edge_End.assign(Active_Edge_Begin.begin()+1, Active_Edge_Begin.end());
+
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&nActive, &nActive_Global, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+#else
+    nActive_Global = nActive;
+#endif
+
+    if ((rank == MASTER_NODE) && (config->GetConsole_Output_Verb() == VERB_HIGH))
+      cout << "Local freezing: " << nActive_Global << " of " << geometry->GetGlobal_nPointDomain()
+           << " points are active." << endl;
 
   }
 
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
+  /*--- The next iteration sweeps the entire domain periodically, and until the
+        first frozen iteration ---*/
 
-  /*--- Set the Maximum residual in all the processors ---*/
-  sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
-  sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
-  sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
+  Local_Freezing = ((ExtIter+1 >= Start) && ((ExtIter+1) % Sweep != 0));
+  Edge_Subset    = Local_Freezing;
 
-  rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
-  rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
-  rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
+}
 
-  for (iVar = 0; iVar < nVar; iVar++) {
-    sbuf_residual[iVar] = GetRes_Max_BGS(iVar);
-    sbuf_point[iVar] = GetPoint_Max_BGS(iVar);
-    Coord = GetPoint_Max_Coord_BGS(iVar);
-    for (iDim = 0; iDim < nDim; iDim++)
-      sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+void CSolver::SetMultirate_Levels(CGeometry *geometry, CConfig *config, su2double val_delta_time) {
+
+  unsigned long iPoint, jPoint, iEdge, iEdgeColor, iVertex;
+  unsigned short iColor, iMarker, Level, Level_Edge, MyLevel_Max = 0, Level_Max = 0;
+  unsigned short nColor = geometry->GetnEdgeColor();
+  unsigned short nLevel_Max = config->GetnLevels_TimeAccurateLTS();
+  su2double Ratio;
+
+  /*--- The step of a point is the global time step times the largest power of
+        two that does not exceed its own stable time step. ---*/
+
+  Multirate_Delta_Time = val_delta_time;
+  Multirate_Level.assign(nPoint, 0);
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Ratio = node[iPoint]->GetDelta_Time()/val_delta_time;
+    Level = 0;
+    while ((Level+1 < nLevel_Max) && (Ratio >= 2.0)) { Ratio *= 0.5; Level++; }
+    Multirate_Level[iPoint] = Level;
+    MyLevel_Max = max(MyLevel_Max, Level);
+    node[iPoint]->SetDelta_Time(val_delta_time*su2double(1ul << Level));
   }
 
-  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_DOUBLE, rbuf_residual, nVar, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_DOUBLE, rbuf_coord, nVar*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
+#ifdef HAVE_MPI
+  SU2_MPI::Allreduce(&MyLevel_Max, &Level_Max, 1, MPI_UNSIGNED_SHORT, MPI_MAX, MPI_COMM_WORLD);
+#else
+  Level_Max = MyLevel_Max;
+#endif
+  Multirate_nLevel = Level_Max+1;
 
-  for (iVar = 0; iVar < nVar; iVar++) {
-    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
-      AddRes_Max_BGS(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
+  /*--- The level of a halo point is the one of its owner, its step is an exact
+        power of two of the global time step. ---*/
+
+  InitiateComms(geometry, config, DELTA_TIME);
+  CompleteComms(geometry, config, DELTA_TIME);
+
+  for (iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+    Ratio = node[iPoint]->GetDelta_Time()/val_delta_time;
+    Level = 0;
+    while (Ratio > 1.5) { Ratio *= 0.5; Level++; }
+    Multirate_Level[iPoint] = Level;
+  }
+
+  /*--- Sort the edges of each color by level, the level of an edge is the lowest
+        level of its points such that both points see all its fluxes. ---*/
+
+  Multirate_Edge_Begin.assign(nColor*Multirate_nLevel+1, 0);
+  for (iColor = 0; iColor < nColor; iColor++) {
+    for (iEdgeColor = geometry->GetEdgeColor_Begin(iColor); iEdgeColor < geometry->GetEdgeColor_End(iColor); iEdgeColor++) {
+      iEdge = geometry->GetEdgeColor_Edge(iEdgeColor);
+      iPoint = geometry->GetEdge_Node(iEdge, 0); jPoint = geometry->GetEdge_Node(iEdge, 1);
+      Level_Edge = min(Multirate_Level[iPoint], Multirate_Level[jPoint]);
+      Multirate_Edge_Begin[iColor*Multirate_nLevel+Level_Edge+1]++;
+    }
+  }
+  for (iEdge = 1; iEdge < Multirate_Edge_Begin.size(); iEdge++)
+    Multirate_Edge_Begin[iEdge] += Multirate_Edge_Begin[iEdge-1];
+
+  vector<unsigned long> Position(Multirate_Edge_Begin.begin(), Multirate_Edge_Begin.end()-1);
+  Active_Edge.resize(Multirate_Edge_Begin.back());
+  for (iColor = 0; iColor < nColor; iColor++) {
+    for (iEdgeColor = geometry->GetEdgeColor_Begin(iColor); iEdgeColor < geometry->GetEdgeColor_End(iColor); iEdgeColor++) {
+      iEdge = geometry->GetEdgeColor_Edge(iEdgeColor);
+      iPoint = geometry->GetEdge_Node(iEdge, 0); jPoint = geometry->GetEdge_Node(iEdge, 1);
+      Level_Edge = min(Multirate_Level[iPoint], Multirate_Level[jPoint]);
+      Active_Edge[Position[iColor*Multirate_nLevel+Level_Edge]++] = iEdge;
     }
   }
 
-  delete [] sbuf_residual;
-  delete [] rbuf_residual;
+  /*--- The strong no-slip condition removes the velocity residual of the wall
+        points, the fluxes of the edges must not move them either. ---*/
 
-  delete [] sbuf_point;
-  delete [] rbuf_point;
+  Multirate_Wall.assign(nPoint, false);
+  if (config->GetViscous()) {
+    for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+      if ((config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
+          (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+          (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++)
+          Multirate_Wall[geometry->vertex[iMarker][iVertex]->GetNode()] = true;
+      }
+    }
+  }
 
-  delete [] sbuf_coord;
-  delete [] rbuf_coord;
+  if (Multirate_Res.size() != nPointDomain*nVar) Multirate_Res.assign(nPointDomain*nVar, 0.0);
 
-#endif
+}
+
+void CSolver::SetMultirate_Pass(CGeometry *geometry, short val_level) {
+
+  unsigned short iColor, nColor = geometry->GetnEdgeColor();
+
+  Edge_Subset = (val_level != -2);
+  if (!Edge_Subset) return;
+
+  Active_Edge_Begin.assign(nColor, 0);
+  Active_Edge_End.assign(nColor, 0);
+  if (val_level >= 0) {
+    for (iColor = 0; iColor < nColor; iColor++) {
+      Active_Edge_Begin[iColor] = Multirate_Edge_Begin[iColor*Multirate_nLevel+val_level];
+      Active_Edge_End[iColor]   = Multirate_Edge_Begin[iColor*Multirate_nLevel+val_level+1];
+    }
+  }
+
+  LinSysRes.SetValZero();
 
 }
 
-void CSolver::SetGrid_Movement_Residual (CGeometry *geometry, CConfig *config) {
-  
-  unsigned short iDim, nDim = geometry->GetnDim(), iVar, nVar = GetnVar(), iMarker;
-  unsigned long iVertex, iEdge;
-  su2double ProjGridVel, *Normal;
-  
-  /*--- Loop interior edges ---*/
-   
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    
-    const unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
-    const unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    /*--- Solution at each edge point ---*/
-    
-    su2double *Solution_i = node[iPoint]->GetSolution();
-    su2double *Solution_j = node[jPoint]->GetSolution();
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      Solution[iVar] = 0.5* (Solution_i[iVar] + Solution_j[iVar]);
-    
-    /*--- Grid Velocity at each edge point ---*/
-    
-    su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
-    su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
-    for (iDim = 0; iDim < nDim; iDim++)
-      Vector[iDim] = 0.5* (GridVel_i[iDim] + GridVel_j[iDim]);
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    
-    ProjGridVel = 0.0;
-    for (iDim = 0; iDim < nDim; iDim++)
-      ProjGridVel += Vector[iDim]*Normal[iDim];
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      Residual[iVar] = ProjGridVel*Solution[iVar];
-    
-    LinSysRes.SubtractBlock(iPoint, Residual);
-    LinSysRes.AddBlock(jPoint, Residual);
-    
-  }
-  
-  /*--- Loop boundary edges ---*/
-  
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-      const unsigned long Point = geometry->vertex[iMarker][iVertex]->GetNode();
-      
-      /*--- Solution at each edge point ---*/
-      
-      su2double *Solution = node[Point]->GetSolution();
-      
-      /*--- Grid Velocity at each edge point ---*/
-      
-      su2double *GridVel = geometry->node[Point]->GetGridVel();
-      
-      /*--- Summed normal components ---*/
-      
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      
-      ProjGridVel = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        ProjGridVel -= GridVel[iDim]*Normal[iDim];
-      
-      for (iVar = 0; iVar < nVar; iVar++)
-        Residual[iVar] = ProjGridVel*Solution[iVar];
-      
-      LinSysRes.AddBlock(Point, Residual);
+void CSolver::Multirate_Accumulate(CGeometry *geometry, short val_level, unsigned long val_substep) {
+
+  unsigned long iPoint;
+  unsigned short iVar;
+  su2double Weight, *Residual;
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    /*--- The boundary and source terms of a point are evaluated once per step of
+          the point, at its start, the fluxes of an edge once per step of the edge. ---*/
+
+    if (val_level < 0) {
+      if (val_substep % (1ul << Multirate_Level[iPoint]) != 0) continue;
+      Weight = node[iPoint]->GetDelta_Time();
+    }
+    else {
+      Weight = Multirate_Delta_Time*su2double(1ul << val_level);
     }
+
+    Residual = LinSysRes.GetBlock(iPoint);
+    for (iVar = 0; iVar < nVar; iVar++) {
+      if ((val_level >= 0) && Multirate_Wall[iPoint] && (iVar > 0) && (iVar <= nDim)) continue;
+      Multirate_Res[iPoint*nVar+iVar] += Weight*Residual[iVar];
+    }
+
   }
-  
+
 }
 
-void CSolver::Set_MPI_AuxVar_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
-  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
-  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
-  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
-  
-  unsigned short nAuxVar = 1;
-  
-  su2double **Gradient = new su2double* [nAuxVar];
-  for (iVar = 0; iVar < nAuxVar; iVar++)
-    Gradient[iVar] = new su2double[nDim];
-  
-#ifdef HAVE_MPI
-  int send_to, receive_from;
-  SU2_MPI::Status status;
-#endif
-  
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    
-    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
-        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
-      
-      MarkerS = iMarker;  MarkerR = iMarker+1;
-      
-#ifdef HAVE_MPI
-      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
-      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
-#endif
-      
-      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
-      nBufferS_Vector = nVertexS*nAuxVar*nDim;        nBufferR_Vector = nVertexR*nAuxVar*nDim;
-      
-      /*--- Allocate Receive and send buffers  ---*/
-      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
-      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
-      
-      /*--- Copy the solution old that should be sended ---*/
-      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
-        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
-        for (iVar = 0; iVar < nAuxVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Send_Gradient[iDim*nAuxVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
-      }
-      
-#ifdef HAVE_MPI
-      
-      /*--- Send/Receive information using Sendrecv ---*/
-      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
-#else
-      
-      /*--- Receive information without MPI ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        for (iVar = 0; iVar < nAuxVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Buffer_Receive_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+void CSolver::Multirate_Update(CGeometry *geometry, CConfig *config, unsigned long val_substep) {
+
+  unsigned long iPoint;
+  unsigned short iVar;
+  su2double Vol, Res;
+
+  /*--- The residual of the step is reported after the last substep, when all the
+        points have completed their step. ---*/
+
+  bool last = (val_substep+1 == GetMultirate_nSubStep());
+
+  if (last) {
+    for (iVar = 0; iVar < nVar; iVar++) {
+      SetRes_RMS(iVar, 0.0);
+      SetRes_Max(iVar, 0.0, 0);
+    }
+  }
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+
+    if ((val_substep+1) % (1ul << Multirate_Level[iPoint]) != 0) continue;
+
+    Vol = geometry->node[iPoint]->GetVolume();
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Res = Multirate_Res[iPoint*nVar+iVar];
+      node[iPoint]->AddSolution(iVar, -Res/Vol);
+      if (last) {
+        Res /= node[iPoint]->GetDelta_Time();
+        AddRes_RMS(iVar, Res*Res);
+        AddRes_Max(iVar, fabs(Res), geometry->node[iPoint]->GetGlobalIndex(), geometry->node[iPoint]->GetCoord());
       }
-      
-#endif
-      
-      /*--- Deallocate send buffer ---*/
-      delete [] Buffer_Send_Gradient;
-      
-      /*--- Do the coordinate transformation ---*/
-      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
-        
-        /*--- Find point and its type of transformation ---*/
-        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
-        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
-        
-        /*--- Retrieve the supplied periodic information. ---*/
-        angles = config->GetPeriodicRotation(iPeriodic_Index);
-        
-        /*--- Store angles separately for clarity. ---*/
-        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
-        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
-        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
-        
-        /*--- Compute the rotation matrix. Note that the implicit
-         ordering is rotation about the x-axis, y-axis,
-         then z-axis. Note that this is the transpose of the matrix
-         used during the preprocessing stage. ---*/
-        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
-        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
-        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
-        
-        /*--- Copy conserved variables before performing transformation. ---*/
-        for (iVar = 0; iVar < nAuxVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
-        
-        /*--- Need to rotate the gradients for all conserved variables. ---*/
-        for (iVar = 0; iVar < nAuxVar; iVar++) {
-          if (nDim == 2) {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
-          }
-          else {
-            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
-            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+      Multirate_Res[iPoint*nVar+iVar] = 0.0;
+    }
+
+  }
+
+  Set_MPI_Solution(geometry, config);
+
+  if (last) SetResidual_RMS(geometry, config);
+
+}
+
+void CSolver::Smooth_Residual(CGeometry *geometry, CConfig *config) {
+
+  unsigned long iPoint, iEdge, iVertex, i, j;
+  unsigned short iVar, iSmooth, iMarker;
+  su2double *Residual, *Res_TruncError, *Res, *Sum;
+  const su2double *Res_Old;
+
+  const unsigned short nSmooth = config->GetnRes_Smooth_Iter();
+  const su2double Epsilon = config->GetRes_Smooth_Coeff();
+  const unsigned long nEdge = geometry->GetnEdge();
+
+  /*--- The edges, the diagonal of the smoothing operator and the wall points are
+        set up once. The residuals are stored variable by variable (nVar arrays of
+        nPoint values), such that the sweeps stream through contiguous arrays. ---*/
+
+  if (Res_Smooth_Edge.size() != 2*nEdge) {
+
+    Res_Smooth_Edge.resize(2*nEdge);
+    for (iEdge = 0; iEdge < nEdge; iEdge++) {
+      Res_Smooth_Edge[2*iEdge]   = geometry->edge[iEdge]->GetNode(0);
+      Res_Smooth_Edge[2*iEdge+1] = geometry->edge[iEdge]->GetNode(1);
+    }
+
+    Res_Smooth_Diag.resize(nPointDomain);
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      Res_Smooth_Diag[iPoint] = 1.0/(1.0 + Epsilon*su2double(geometry->node[iPoint]->GetnPoint()));
+
+    /*--- The strong no-slip condition removes the velocity residual of the wall
+          points, the smoothing must not bring it back. ---*/
+
+    Res_Smooth_Wall.clear();
+    if (config->GetViscous()) {
+      for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+        if ((config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL) ||
+            (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX) ||
+            (config->GetMarker_All_KindBC(iMarker) == CHT_WALL_INTERFACE)) {
+          for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+            iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+            if (iPoint < nPointDomain) Res_Smooth_Wall.push_back(iPoint);
           }
         }
-        
-        /*--- Store the received information ---*/
-        for (iVar = 0; iVar < nAuxVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
-        
       }
-      
-      /*--- Deallocate receive buffer ---*/
-      delete [] Buffer_Receive_Gradient;
-      
     }
-    
+
+    Res_Smooth.assign(nVar*nPoint, 0.0);
+    Res_Smooth_Old.assign(nVar*nPoint, 0.0);
+    Res_Smooth_Sum.assign(nVar*nPoint, 0.0);
   }
-  
-  for (iVar = 0; iVar < nAuxVar; iVar++)
-    delete [] Gradient[iVar];
-  delete [] Gradient;
-  
-}
 
-void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  
-  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
-  unsigned short nDim = geometry->GetnDim(), iDim, iMarker;
-  
-  su2double AuxVar_Vertex, AuxVar_i, AuxVar_j, AuxVar_Average;
-  su2double *Gradient, DualArea, Partial_Res, Grad_Val, *Normal;
-  
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-    node[iPoint]->SetAuxVarGradientZero();    // Set Gradient to Zero
-  
-  /*--- Loop interior edges ---*/
-  
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    AuxVar_i = node[iPoint]->GetAuxVar();
-    AuxVar_j = node[jPoint]->GetAuxVar();
-    
-    Normal = geometry->edge[iEdge]->GetNormal();
-    AuxVar_Average =  0.5 * ( AuxVar_i + AuxVar_j);
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Partial_Res = AuxVar_Average*Normal[iDim];
-      node[iPoint]->AddAuxVarGradient(iDim, Partial_Res);
-      node[jPoint]->SubtractAuxVarGradient(iDim, Partial_Res);
+  /*--- Residual to be smoothed, with the multigrid forcing term, and its halo values ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    Residual = LinSysRes.GetBlock(iPoint);
+    Res_TruncError = node[iPoint]->GetResTruncError();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Res_Smooth[iVar*nPoint+iPoint] = Residual[iVar];
+      if (Res_TruncError != NULL) Res_Smooth[iVar*nPoint+iPoint] += Res_TruncError[iVar];
     }
   }
-  
-  /*--- Loop boundary edges ---*/
-  
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
-    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-      Point = geometry->vertex[iMarker][iVertex]->GetNode();
-      AuxVar_Vertex = node[Point]->GetAuxVar();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = AuxVar_Vertex*Normal[iDim];
-        node[Point]->SubtractAuxVarGradient(iDim, Partial_Res);
-      }
-    }
-  
-  for (iPoint=0; iPoint<geometry->GetnPoint(); iPoint++)
-    for (iDim = 0; iDim < nDim; iDim++) {
-      Gradient = node[iPoint]->GetAuxVarGradient();
-      DualArea = geometry->node[iPoint]->GetVolume();
-      Grad_Val = Gradient[iDim]/(DualArea+EPS);
-      node[iPoint]->SetAuxVarGradient(iDim, Grad_Val);
+
+  InitiateComms(geometry, config, RES_SMOOTH);
+  CompleteComms(geometry, config, RES_SMOOTH);
+
+  Res_Smooth_Old = Res_Smooth;
+
+  /*--- Jacobi sweeps of (1 - Epsilon*Laplacian) R_smooth = R, all the variables
+        are exchanged in one message per sweep, none after the last one. ---*/
+
+  for (iSmooth = 0; iSmooth < nSmooth; iSmooth++) {
+
+    Res_Smooth_Sum.assign(nVar*nPoint, 0.0);
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Res = &Res_Smooth[iVar*nPoint];
+      Sum = &Res_Smooth_Sum[iVar*nPoint];
+      for (iEdge = 0; iEdge < nEdge; iEdge++) {
+        i = Res_Smooth_Edge[2*iEdge];
+        j = Res_Smooth_Edge[2*iEdge+1];
+        Sum[i] += Res[j];
+        Sum[j] += Res[i];
+      }
     }
-  
-  /*--- Gradient MPI ---*/
-  
-  Set_MPI_AuxVar_Gradient(geometry, config);
-  
+
+    for (iVar = 0; iVar < nVar; iVar++) {
+      Res     = &Res_Smooth[iVar*nPoint];
+      Res_Old = &Res_Smooth_Old[iVar*nPoint];
+      Sum     = &Res_Smooth_Sum[iVar*nPoint];
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+        Res[iPoint] = (Res_Old[iPoint] + Epsilon*Sum[iPoint])*Res_Smooth_Diag[iPoint];
+    }
+
+    for (iVertex = 0; iVertex < Res_Smooth_Wall.size(); iVertex++)
+      for (iVar = 1; iVar <= nDim; iVar++)
+        Res_Smooth[iVar*nPoint+Res_Smooth_Wall[iVertex]] = Res_Smooth_Old[iVar*nPoint+Res_Smooth_Wall[iVertex]];
+
+    if (iSmooth+1 < nSmooth) {
+      InitiateComms(geometry, config, RES_SMOOTH);
+      CompleteComms(geometry, config, RES_SMOOTH);
+    }
+  }
+
 }
 
-void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
-  
-  unsigned short iDim, jDim, iNeigh;
-  unsigned short nDim = geometry->GetnDim();
-  unsigned long iPoint, jPoint;
-  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j, weight, r11, r12, r13, r22, r23, r23_a,
-  r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, product;
-  bool singular = false;
-  
-  su2double *Cvector = new su2double [nDim];
-  
-  /*--- Loop over points of the grid ---*/
-  
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    
-    Coord_i = geometry->node[iPoint]->GetCoord();
-    AuxVar_i = node[iPoint]->GetAuxVar();
-    
-    /*--- Inizialization of variables ---*/
-    for (iDim = 0; iDim < nDim; iDim++)
-      Cvector[iDim] = 0.0;
-    
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
-    
-    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
-      AuxVar_j = node[jPoint]->GetAuxVar();
-      
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-      /*--- Sumations for entries of upper triangular matrix R ---*/
-      
-      if (fabs(weight) > EPS) {
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+void CSolver::Smooth_Sensitivity(CGeometry *geometry, CSolver **solver_container, CNumerics *numerics, CConfig *config) {
+
+  unsigned short iMarker, iNode, jNode, kNode, nNodes, iDim;
+  unsigned long iVertex, iPoint, jPoint, iElem, nElem, Point[4];
+  su2double Area, Weight, Length2, Edge_a[3], Edge_b[3], Cross[3], Residual_Smooth = 0.0;
+  su2double *Coord_i, *Coord_j, *Coord_k, **Block;
+
+  su2double Epsilon = config->GetSensSmooth_Coeff();
+  unsigned short nMarker = config->GetnMarker_All();
+
+  /*--- Surfaces where the sensitivity is smoothed ---*/
+
+  vector<bool> Smooth_Marker(nMarker, false);
+  for (iMarker = 0; iMarker < nMarker; iMarker++)
+    Smooth_Marker[iMarker] = ((config->GetMarker_All_KindBC(iMarker) == EULER_WALL) ||
+                              (config->GetMarker_All_KindBC(iMarker) == HEAT_FLUX)  ||
+                              (config->GetMarker_All_KindBC(iMarker) == ISOTHERMAL));
+
+  /*--- The sparsity pattern of the (scalar) point graph is set up once, the
+        surface rows only use the edges of the boundary elements ---*/
+
+  if (!SensSmooth_Ready) {
+    StiffMatrix.Initialize(nPoint, nPointDomain, 1, 1, false, geometry, config);
+    SensSmooth_Ready = true;
+  }
+  StiffMatrix.SetValZero();
+
+  CSysVector Sens_Point(nPoint, nPointDomain, 1, 0.0);
+  CSysVector Sens_Smooth(nPoint, nPointDomain, 1, 0.0);
+  CSysVector Sens_Rhs(nPoint, nPointDomain, 1, 0.0);
+  vector<su2double> Mass(nPoint, 0.0);
+  vector<unsigned short> nMarker_Point(nPoint, 0);
+
+  Block = new su2double* [1];
+  Block[0] = new su2double [1];
+
+  /*--- Surface sensitivity at the points, averaged where markers meet ---*/
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (!Smooth_Marker[iMarker]) continue;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      Sens_Point[iPoint] += GetCSensitivity(iMarker, iVertex);
+      nMarker_Point[iPoint]++;
+    }
+  }
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++)
+    if (nMarker_Point[iPoint] > 1) Sens_Point[iPoint] /= su2double(nMarker_Point[iPoint]);
+
+  /*--- Assembly of the lumped mass and of the Laplace-Beltrami operator, element by
+        element. Only the rows of the owned points are assembled, the boundary elements
+        touching them are all present on this rank, so the rows are complete. ---*/
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (!Smooth_Marker[iMarker]) continue;
+
+    nElem = geometry->GetnElem_Bound(iMarker);
+
+    for (iElem = 0; iElem < nElem; iElem++) {
+
+      CPrimalGrid *Elem = geometry->bound[iMarker][iElem];
+      nNodes = Elem->GetnNodes();
+      for (iNode = 0; iNode < nNodes; iNode++)
+        Point[iNode] = Elem->GetNode(iNode);
+
+      /*--- Measure of the element (length in 2D, area in 3D) ---*/
+
+      Area = 0.0;
+
+      if (Elem->GetVTK_Type() == LINE) {
+        Coord_i = geometry->node[Point[0]]->GetCoord();
+        Coord_j = geometry->node[Point[1]]->GetCoord();
+        for (iDim = 0; iDim < nDim; iDim++)
+          Area += pow(Coord_j[iDim]-Coord_i[iDim], 2.0);
+        Area = sqrt(Area);
+      }
+      else {
+
+        /*--- Triangles and (split) quadrilaterals ---*/
+
+        for (kNode = 1; kNode < nNodes-1; kNode++) {
+          Coord_i = geometry->node[Point[0]]->GetCoord();
+          Coord_j = geometry->node[Point[kNode]]->GetCoord();
+          Coord_k = geometry->node[Point[kNode+1]]->GetCoord();
+          for (iDim = 0; iDim < 3; iDim++) {
+            Edge_a[iDim] = Coord_j[iDim]-Coord_i[iDim];
+            Edge_b[iDim] = Coord_k[iDim]-Coord_i[iDim];
+          }
+          Cross[0] = Edge_a[1]*Edge_b[2]-Edge_a[2]*Edge_b[1];
+          Cross[1] = Edge_a[2]*Edge_b[0]-Edge_a[0]*Edge_b[2];
+          Cross[2] = Edge_a[0]*Edge_b[1]-Edge_a[1]*Edge_b[0];
+          Area += 0.5*sqrt(Cross[0]*Cross[0]+Cross[1]*Cross[1]+Cross[2]*Cross[2]);
         }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
+
+      }
+
+      if (Area <= EPS) continue;
+
+      for (iNode = 0; iNode < nNodes; iNode++)
+        Mass[Point[iNode]] += Area/su2double(nNodes);
+
+      /*--- Edge weights: 1/L on lines, (cot(a)+cot(b))/2 from the angles facing the
+            edge on triangles, A/(2 L^2) on quadrilaterals. ---*/
+
+      for (iNode = 0; iNode < nNodes; iNode++) {
+
+        if ((nNodes == 2) && (iNode == 1)) break;
+
+        jNode = (iNode+1) % nNodes;
+        iPoint = Point[iNode]; jPoint = Point[jNode];
+
+        Coord_i = geometry->node[iPoint]->GetCoord();
+        Coord_j = geometry->node[jPoint]->GetCoord();
+        Length2 = 0.0;
         for (iDim = 0; iDim < nDim; iDim++)
-          Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/(weight);
+          Length2 += pow(Coord_j[iDim]-Coord_i[iDim], 2.0);
+
+        if (Length2 <= EPS*EPS) continue;
+
+        if (nNodes == 2) {
+          Weight = 1.0/sqrt(Length2);
+        }
+        else if (nNodes == 3) {
+          kNode = (iNode+2) % nNodes;
+          Coord_k = geometry->node[Point[kNode]]->GetCoord();
+          Weight = 0.0;
+          for (iDim = 0; iDim < 3; iDim++)
+            Weight += (Coord_i[iDim]-Coord_k[iDim])*(Coord_j[iDim]-Coord_k[iDim]);
+          Weight /= 4.0*Area;
+        }
+        else {
+          Weight = 0.5*Area/Length2;
+        }
+
+        Block[0][0] = Epsilon*Weight;
+        if (iPoint < nPointDomain) {
+          StiffMatrix.AddVal2Diag(iPoint, Block[0][0]);
+          StiffMatrix.SubtractBlock(iPoint, jPoint, Block);
+        }
+        if (jPoint < nPointDomain) {
+          StiffMatrix.AddVal2Diag(jPoint, Block[0][0]);
+          StiffMatrix.SubtractBlock(jPoint, iPoint, Block);
+        }
+
       }
-      
-    }
-    
-    /*--- Entries of upper triangular matrix R ---*/
-    
-    if (fabs(r11) < EPS) r11 = EPS;
-    r11 = sqrt(r11);
-    r12 = r12/r11;
-    r22 = sqrt(r22-r12*r12);
-    if (fabs(r22) < EPS) r22 = EPS;
-    if (nDim == 3) {
-      r13 = r13/r11;
-      r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
-      r33 = sqrt(r33-r23*r23-r13*r13);
     }
-    
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (fabs(detR2) < EPS) singular = true;
-    
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
+  }
+
+  /*--- Mass and right hand side, identity away from the smoothed surfaces ---*/
+
+  for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    if (Mass[iPoint] > 0.0) {
+      StiffMatrix.AddVal2Diag(iPoint, Mass[iPoint]);
+      Sens_Rhs[iPoint] = Mass[iPoint]*Sens_Point[iPoint];
     }
     else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
+      StiffMatrix.SetVal2Diag(iPoint, 1.0);
+      Sens_Rhs[iPoint] = Sens_Point[iPoint];
     }
-    
-    /*--- Computation of the gradient: S*c ---*/
-    
-    for (iDim = 0; iDim < nDim; iDim++) {
-      product = 0.0;
-      for (jDim = 0; jDim < nDim; jDim++)
-        product += Smatrix[iDim][jDim]*Cvector[jDim];
-      if (geometry->node[iPoint]->GetDomain())
-        node[iPoint]->SetAuxVarGradient(iDim, product);
+    Sens_Smooth[iPoint] = Sens_Point[iPoint];
+  }
+
+  /*--- One parallel solve of the symmetric positive definite system ---*/
+
+  StiffMatrix.BuildJacobiPreconditioner();
+
+  CMatrixVectorProduct* mat_vec = new CSysMatrixVectorProduct(StiffMatrix, geometry, config);
+  CPreconditioner* precond = new CJacobiPreconditioner(StiffMatrix, geometry, config);
+  CSysSolve *system = new CSysSolve();
+
+  system->CG_LinSolver(Sens_Rhs, Sens_Smooth, *mat_vec, *precond, 1E-10, nPointDomain, &Residual_Smooth, false);
+
+  delete system;
+  delete mat_vec;
+  delete precond;
+
+  /*--- Halo values from their owning ranks, then back to the vertices ---*/
+
+  StiffMatrix.SendReceive_Solution(Sens_Smooth, geometry, config);
+
+  for (iMarker = 0; iMarker < nMarker; iMarker++) {
+    if (!Smooth_Marker[iMarker]) continue;
+    for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+      iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+      SetCSensitivity(iMarker, iVertex, Sens_Smooth[iPoint]);
     }
   }
-  
-  delete [] Cvector;
-  
-  /*--- Gradient MPI ---*/
-  
-  Set_MPI_AuxVar_Gradient(geometry, config);
-  
+
+  delete [] Block[0];
+  delete [] Block;
+
 }
 
-void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
-  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
-  unsigned short iVar, iDim, iMarker;
-  su2double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
-  Partial_Res, Grad_Val, *Normal;
-  
-  /*--- Set Gradient to Zero ---*/
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-    node[iPoint]->SetGradientZero();
-  
-  /*--- Loop interior edges ---*/
-  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-    iPoint = geometry->edge[iEdge]->GetNode(0);
-    jPoint = geometry->edge[iEdge]->GetNode(1);
-    
-    Solution_i = node[iPoint]->GetSolution();
-    Solution_j = node[jPoint]->GetSolution();
-    Normal = geometry->edge[iEdge]->GetNormal();
-    for (iVar = 0; iVar< nVar; iVar++) {
-      Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
+void CSolver::SetForce_Cache(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iMarker, iDim;
+  unsigned long iVertex, iPoint, kVertex;
+
+  /*--- Build the indices of the owned vertices of the monitored markers,
+   the halo vertices never contribute to the forces. ---*/
+
+  if (nVertex_ForceCache == NULL) {
+
+    nMarker_ForceCache = config->GetnMarker_All();
+    Dynamic_ForceCache = (config->GetGrid_Movement() || config->GetFSI_Simulation() ||
+                          config->GetDiscrete_Adjoint() || config->GetAD_Mode());
+
+    nVertex_ForceCache = new unsigned long[nMarker_ForceCache];
+    Vertex_ForceCache  = new unsigned long*[nMarker_ForceCache];
+    Point_ForceCache   = new unsigned long*[nMarker_ForceCache];
+    Normal_ForceCache  = new su2double*[nMarker_ForceCache];
+    Coord_ForceCache   = new su2double*[nMarker_ForceCache];
+
+    for (iMarker = 0; iMarker < nMarker_ForceCache; iMarker++) {
+
+      nVertex_ForceCache[iMarker] = 0;
+      if (config->GetMarker_All_Monitoring(iMarker) == YES)
+        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++)
+          if (geometry->node[geometry->vertex[iMarker][iVertex]->GetNode()]->GetDomain())
+            nVertex_ForceCache[iMarker]++;
+
+      Vertex_ForceCache[iMarker] = new unsigned long[nVertex_ForceCache[iMarker]];
+      Point_ForceCache[iMarker]  = new unsigned long[nVertex_ForceCache[iMarker]];
+      Normal_ForceCache[iMarker] = new su2double[nVertex_ForceCache[iMarker]*nDim];
+      Coord_ForceCache[iMarker]  = new su2double[nVertex_ForceCache[iMarker]*nDim];
+
+      kVertex = 0;
+      if (config->GetMarker_All_Monitoring(iMarker) == YES)
+        for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          if (geometry->node[iPoint]->GetDomain()) {
+            Vertex_ForceCache[iMarker][kVertex] = iVertex;
+            Point_ForceCache[iMarker][kVertex]  = iPoint;
+            kVertex++;
+          }
+        }
+    }
+
+  }
+  else if (!Dynamic_ForceCache) return;
+
+  /*--- Copy the normals and the coordinates ---*/
+
+  for (iMarker = 0; iMarker < nMarker_ForceCache; iMarker++)
+    for (kVertex = 0; kVertex < nVertex_ForceCache[iMarker]; kVertex++) {
+      su2double *Normal = geometry->vertex[iMarker][Vertex_ForceCache[iMarker][kVertex]]->GetNormal();
+      su2double *Coord  = geometry->node[Point_ForceCache[iMarker][kVertex]]->GetCoord();
       for (iDim = 0; iDim < nDim; iDim++) {
-        Partial_Res = Solution_Average*Normal[iDim];
-        if (geometry->node[iPoint]->GetDomain())
-          node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
-        if (geometry->node[jPoint]->GetDomain())
-          node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+        Normal_ForceCache[iMarker][kVertex*nDim+iDim] = Normal[iDim];
+        Coord_ForceCache[iMarker][kVertex*nDim+iDim]  = Coord[iDim];
       }
     }
+
+}
+
+void CSolver::DeleteForce_Cache(void) {
+
+  unsigned short iMarker;
+
+  if (nVertex_ForceCache == NULL) return;
+
+  for (iMarker = 0; iMarker < nMarker_ForceCache; iMarker++) {
+    delete [] Vertex_ForceCache[iMarker];
+    delete [] Point_ForceCache[iMarker];
+    delete [] Normal_ForceCache[iMarker];
+    delete [] Coord_ForceCache[iMarker];
   }
-  
-  /*--- Loop boundary edges ---*/
-  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
-    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY &&
-        config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)
-    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
-      Point = geometry->vertex[iMarker][iVertex]->GetNode();
-      Solution_Vertex = node[Point]->GetSolution();
-      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      for (iVar = 0; iVar < nVar; iVar++)
-        for (iDim = 0; iDim < nDim; iDim++) {
-          Partial_Res = Solution_Vertex[iVar]*Normal[iDim];
-          if (geometry->node[Point]->GetDomain())
-            node[Point]->SubtractGradient(iVar, iDim, Partial_Res);
-        }
+  delete [] nVertex_ForceCache; nVertex_ForceCache = NULL;
+  delete [] Vertex_ForceCache;  Vertex_ForceCache  = NULL;
+  delete [] Point_ForceCache;   Point_ForceCache   = NULL;
+  delete [] Normal_ForceCache;  Normal_ForceCache  = NULL;
+  delete [] Coord_ForceCache;   Coord_ForceCache   = NULL;
+  nMarker_ForceCache = 0;
+
+}
+
+void CSolver::Accumulate_TimeAverage(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iDim, jDim, iStress;
+  unsigned long iPoint;
+
+  const unsigned short nVar_Avg = GetnTimeAverage_Var(nDim);
+  const unsigned short iPres = nDim+1, iPres2 = nDim+2, iStress0 = nDim+3;
+
+  if (TimeAvg == NULL) {
+    TimeAvg = new su2double[nPoint*nVar_Avg];
+    for (iPoint = 0; iPoint < nPoint*nVar_Avg; iPoint++) TimeAvg[iPoint] = 0.0;
+    nTimeAvg_Samples = 0;
+  }
+
+  nTimeAvg_Samples++;
+  const su2double factor = 1.0/su2double(nTimeAvg_Samples);
+
+  su2double Delta[3] = {0.0, 0.0, 0.0}, Velocity[3] = {0.0, 0.0, 0.0};
+
+  for (iPoint = 0; iPoint < nPoint; iPoint++) {
+
+    /*--- Means of density, velocity and pressure, the second moments are
+     updated with the deviations from the old and the new mean. ---*/
+
+    su2double *Avg = &TimeAvg[iPoint*nVar_Avg];
+    su2double Density = node[iPoint]->GetDensity(), Pressure = node[iPoint]->GetPressure();
+
+    Avg[0] += (Density-Avg[0])*factor;
+
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Velocity[iDim] = node[iPoint]->GetVelocity(iDim);
+      Delta[iDim] = Velocity[iDim]-Avg[iDim+1];
+      Avg[iDim+1] += Delta[iDim]*factor;
     }
+
+    su2double Delta_Pres = Pressure-Avg[iPres];
+    Avg[iPres] += Delta_Pres*factor;
+    Avg[iPres2] += Delta_Pres*(Pressure-Avg[iPres]);
+
+    iStress = iStress0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      for (jDim = iDim; jDim < nDim; jDim++)
+        Avg[iStress++] += Delta[iDim]*(Velocity[jDim]-Avg[jDim+1]);
   }
-  
-  /*--- Compute gradient ---*/
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (iDim = 0; iDim < nDim; iDim++) {
-        Gradient = node[iPoint]->GetGradient();
-        DualArea = geometry->node[iPoint]->GetVolume();
-        Grad_Val = Gradient[iVar][iDim] / (DualArea+EPS);
-        node[iPoint]->SetGradient(iVar, iDim, Grad_Val);
-      }
-  
-  /*--- Gradient MPI ---*/
-  Set_MPI_Solution_Gradient(geometry, config);
-  
+
 }
 
-void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
-  
-  unsigned short iDim, jDim, iVar, iNeigh;
-  unsigned long iPoint, jPoint;
-  su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
-  r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-  z22, z23, z33, product;
-  bool singular = false;
-  
-  su2double **Cvector = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++)
-    Cvector[iVar] = new su2double [nDim];
-  
-  /*--- Loop over points of the grid ---*/
-  
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
-    
-    /*--- Set the value of the singular ---*/
-    singular = false;
-    
-    /*--- Get coordinates ---*/
-    
-    Coord_i = geometry->node[iPoint]->GetCoord();
-    
-    /*--- Get consevative solution ---*/
-    
-    Solution_i = node[iPoint]->GetSolution();
-    
-    /*--- Inizialization of variables ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++)
-      for (iDim = 0; iDim < nDim; iDim++)
-        Cvector[iVar][iDim] = 0.0;
-    
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
-    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+void CSolver::GetTimeAverage(unsigned long val_point, su2double *val_stats) {
 
-    AD::StartPreacc();
-    AD::SetPreaccIn(Solution_i, nVar);
-    AD::SetPreaccIn(Coord_i, nDim);
+  unsigned short iVar;
 
-    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
-      
-      Solution_j = node[jPoint]->GetSolution();
+  const unsigned short nVar_Avg = GetnTimeAverage_Var(nDim);
 
-      AD::SetPreaccIn(Coord_j, nDim);
-      AD::SetPreaccIn(Solution_j, nVar);
+  if ((TimeAvg == NULL) || (nTimeAvg_Samples == 0)) {
+    for (iVar = 0; iVar < nVar_Avg; iVar++) val_stats[iVar] = 0.0;
+    return;
+  }
 
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-      /*--- Sumations for entries of upper triangular matrix R ---*/
-      
-      if (weight != 0.0) {
-        
-        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-        if (nDim == 3) {
-          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-        }
-        
-        /*--- Entries of c:= transpose(A)*b ---*/
-        
-        for (iVar = 0; iVar < nVar; iVar++)
-          for (iDim = 0; iDim < nDim; iDim++)
-            Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/weight;
-      }
-      
-    }
-    
-    /*--- Entries of upper triangular matrix R ---*/
-    
-    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
-    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
-    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
-    
-    if (nDim == 3) {
-      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
-      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
-      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
-    }
-    
-    /*--- Compute determinant ---*/
-    
-    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
-    else detR2 = (r11*r22*r33)*(r11*r22*r33);
-    
-    /*--- Detect singular matrices ---*/
-    
-    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
-    
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    
-    if (singular) {
-      for (iDim = 0; iDim < nDim; iDim++)
-        for (jDim = 0; jDim < nDim; jDim++)
-          Smatrix[iDim][jDim] = 0.0;
-    }
-    else {
-      if (nDim == 2) {
-        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-        Smatrix[0][1] = -r11*r12/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = r11*r11/detR2;
-      }
-      else {
-        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
-        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
-        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-        Smatrix[0][2] = (z13*z33)/detR2;
-        Smatrix[1][0] = Smatrix[0][1];
-        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-        Smatrix[1][2] = (z23*z33)/detR2;
-        Smatrix[2][0] = Smatrix[0][2];
-        Smatrix[2][1] = Smatrix[1][2];
-        Smatrix[2][2] = (z33*z33)/detR2;
-      }
+  /*--- The means are stored directly, the RMS of pressure and the Reynolds
+   stresses follow from the sums of the squared deviations. ---*/
+
+  const su2double *Avg = &TimeAvg[val_point*nVar_Avg];
+  const su2double factor = 1.0/su2double(nTimeAvg_Samples);
+
+  for (iVar = 0; iVar < nVar_Avg; iVar++) val_stats[iVar] = Avg[iVar];
+  val_stats[nDim+2] = sqrt(Avg[nDim+2]*factor);
+  for (iVar = nDim+3; iVar < nVar_Avg; iVar++) val_stats[iVar] = Avg[iVar]*factor;
+
+}
+
+void CSolver::Load_TimeAverage_Restart(CGeometry *geometry, CConfig *config) {
+
+  unsigned short iVar;
+  unsigned long iPoint, iPoint_Global, counter = 0;
+  long iPoint_Local;
+
+  if (!config->GetWrt_Time_Average() || (TimeAvg != NULL)) return;
+
+  const unsigned short nVar_Avg = GetnTimeAverage_Var(nDim);
+
+  /*--- Column of the mean density in the restart data (the fields start
+   with the Point_ID, which is not part of the data). ---*/
+
+  int iField_Avg = -1;
+  for (iVar = 1; iVar < config->fields.size(); iVar++) {
+    string fieldname = config->fields[iVar];
+    fieldname.erase(remove(fieldname.begin(), fieldname.end(), '"'), fieldname.end());
+    if (fieldname == "Mean_Density") { iField_Avg = iVar-1; break; }
+  }
+
+  if ((iField_Avg < 0) || (iField_Avg+nVar_Avg > Restart_Vars[1]) || (nTimeAvg_Samples == 0)) {
+    nTimeAvg_Samples = 0;
+    return;
+  }
+
+  TimeAvg = new su2double[nPoint*nVar_Avg];
+  for (iPoint = 0; iPoint < nPoint*nVar_Avg; iPoint++) TimeAvg[iPoint] = 0.0;
+
+  /*--- The means are stored directly, the sums of the squared deviations
+   follow from the RMS of pressure and the Reynolds stresses. The halo
+   points are not part of the restart data and start from zero. ---*/
+
+  const su2double nSamples = su2double(nTimeAvg_Samples);
+
+  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+
+    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+
+    if (iPoint_Local > -1) {
+      const passivedouble *Data = &Restart_Data[counter*Restart_Vars[1] + iField_Avg];
+      su2double *Avg = &TimeAvg[iPoint_Local*nVar_Avg];
+
+      for (iVar = 0; iVar < nVar_Avg; iVar++) Avg[iVar] = Data[iVar];
+      Avg[nDim+2] = Data[nDim+2]*Data[nDim+2]*nSamples;
+      for (iVar = nDim+3; iVar < nVar_Avg; iVar++) Avg[iVar] = Data[iVar]*nSamples;
+
+      counter++;
     }
+  }
+
+}
+
+void CSolver::SetResidual_RMS(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar;
+  
+  /*--- Exact sums of the squared residuals (REPRODUCIBLE_REDUCTIONS), the
+   RMS does not depend on the partitioning ---*/
+  
+  passivedouble *Exact_RMS = NULL;
+  if (Residual_RMS_Sum != NULL) {
+    Exact_RMS = new passivedouble[nVar];
+    Residual_RMS_Sum->AllReduce(Exact_RMS);
+  }
+  
+#ifndef HAVE_MPI
+  
+  if (Exact_RMS != NULL)
+    for (iVar = 0; iVar < nVar; iVar++) SetRes_RMS(iVar, Exact_RMS[iVar]);
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
     
-    /*--- Computation of the gradient: S*c ---*/
-    
-    for (iVar = 0; iVar < nVar; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        product = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++)
-          product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
-        node[iPoint]->SetGradient(iVar, iDim, product);
-      }
+    if (GetRes_RMS(iVar) != GetRes_RMS(iVar)) {
+        SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
     }
 
-    AD::SetPreaccOut(node[iPoint]->GetGradient(), nVar, nDim);
-    AD::EndPreacc();
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(Residual_RMS[iVar]/geometry->GetnPoint())));
+    
   }
   
-  /*--- Deallocate memory ---*/
+#else
   
-  for (iVar = 0; iVar < nVar; iVar++)
-    delete [] Cvector[iVar];
-  delete [] Cvector;
+  int nProcessor = size, iProcessor;
+
+  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
+  accumdouble *sbuf_rms, *rbuf_rms;
+  unsigned long *sbuf_point, *rbuf_point, Local_nPointDomain, Global_nPointDomain;
+  unsigned short iDim;
   
-  /*--- Gradient MPI ---*/
+  /*--- Set the L2 Norm residual in all the processors, the sums of the
+   squares are reduced in accumdouble. ---*/
   
-  Set_MPI_Solution_Gradient(geometry, config);
+  sbuf_rms = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_rms[iVar] = 0.0;
+  rbuf_rms = new accumdouble[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_rms[iVar] = 0.0;
   
-}
-
-void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
-  unsigned short iDim, jDim, iVar, iNeigh;
-  unsigned long iPoint, jPoint;
-  su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j, Smatrix[3][3],
-  r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
-  z22, z23, z33, product;
-  su2double **Cvector;
+  for (iVar = 0; iVar < nVar; iVar++) sbuf_rms[iVar] = Residual_RMS[iVar];
+  Local_nPointDomain = geometry->GetnPointDomain();
   
-  /*--- Note that all nVar entries in this routine have been changed to nDim ---*/
-  Cvector = new su2double* [nDim];
-  for (iVar = 0; iVar < nDim; iVar++)
-    Cvector[iVar] = new su2double [nDim];
   
-  /*--- Loop over points of the grid ---*/
-  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+  if (Exact_RMS != NULL)
+    for (iVar = 0; iVar < nVar; iVar++) rbuf_rms[iVar] = Exact_RMS[iVar];
+  else
+    SU2_MPI::Allreduce(sbuf_rms, rbuf_rms, nVar, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+  
+  
+  for (iVar = 0; iVar < nVar; iVar++) {
     
-    Coord_i = geometry->node[iPoint]->GetCoord();
-    Solution_i = geometry->node[iPoint]->GetGridVel();
+    if (rbuf_rms[iVar] != rbuf_rms[iVar]) {
+      SU2_MPI::Error("SU2 has diverged. (NaN detected)", CURRENT_FUNCTION);
+    }
     
-    /*--- Inizialization of variables ---*/
-    for (iVar = 0; iVar < nDim; iVar++)
-      for (iDim = 0; iDim < nDim; iDim++)
-        Cvector[iVar][iDim] = 0.0;
-    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0; r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
-    
-    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-      Coord_j = geometry->node[jPoint]->GetCoord();
-      Solution_j = geometry->node[jPoint]->GetGridVel();
-      
-      weight = 0.0;
-      for (iDim = 0; iDim < nDim; iDim++)
-        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-      
-      /*--- Sumations for entries of upper triangular matrix R ---*/
-      r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/(weight);
-      r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/(weight);
-      r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/(weight);
-      if (nDim == 3) {
-        r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/(weight);
-        r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/(weight);
-        r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/(weight);
-        r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/(weight);
-      }
-      
-      /*--- Entries of c:= transpose(A)*b ---*/
-      for (iVar = 0; iVar < nDim; iVar++)
-        for (iDim = 0; iDim < nDim; iDim++)
-          Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/(weight);
-    }
+    SetRes_RMS(iVar, max(EPS*EPS, sqrt(rbuf_rms[iVar]/Global_nPointDomain)));
     
-    /*--- Entries of upper triangular matrix R ---*/
-    r11 = sqrt(r11);
-    r12 = r12/(r11);
-    r22 = sqrt(r22-r12*r12);
-    if (nDim == 3) {
-      r13 = r13/(r11);
-      r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
-      r33 = sqrt(r33-r23*r23-r13*r13);
-    }
-    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-    if (nDim == 2) {
-      detR2 = (r11*r22)*(r11*r22);
-      Smatrix[0][0] = (r12*r12+r22*r22)/(detR2);
-      Smatrix[0][1] = -r11*r12/(detR2);
-      Smatrix[1][0] = Smatrix[0][1];
-      Smatrix[1][1] = r11*r11/(detR2);
-    }
-    else {
-      detR2 = (r11*r22*r33)*(r11*r22*r33);
-      z11 = r22*r33;
-      z12 = -r12*r33;
-      z13 = r12*r23-r13*r22;
-      z22 = r11*r33;
-      z23 = -r11*r23;
-      z33 = r11*r22;
-      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/(detR2);
-      Smatrix[0][1] = (z12*z22+z13*z23)/(detR2);
-      Smatrix[0][2] = (z13*z33)/(detR2);
-      Smatrix[1][0] = Smatrix[0][1];
-      Smatrix[1][1] = (z22*z22+z23*z23)/(detR2);
-      Smatrix[1][2] = (z23*z33)/(detR2);
-      Smatrix[2][0] = Smatrix[0][2];
-      Smatrix[2][1] = Smatrix[1][2];
-      Smatrix[2][2] = (z33*z33)/(detR2);
-    }
-    /*--- Computation of the gradient: S*c ---*/
-    for (iVar = 0; iVar < nDim; iVar++) {
-      for (iDim = 0; iDim < nDim; iDim++) {
-        product = 0.0;
-        for (jDim = 0; jDim < nDim; jDim++)
-          product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
-        geometry->node[iPoint]->SetGridVel_Grad(iVar, iDim, product);
-      }
-    }
   }
   
-  /*--- Deallocate memory ---*/
-  for (iVar = 0; iVar < nDim; iVar++)
-    delete [] Cvector[iVar];
-  delete [] Cvector;
+  delete [] sbuf_rms;
+  delete [] rbuf_rms;
   
-  /*--- Gradient MPI ---*/
-  // TO DO!!!
-  //Set_MPI_Solution_Gradient(geometry, config);
+  /*--- Set the Maximum residual in all the processors ---*/
+  sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
+  sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
+  sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
   
-}
+  rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
+  rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
+  rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
 
-void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
-  
-  unsigned short iDim, jDim, iNeigh, iMarker, Boundary;
-  unsigned short nDim = geometry->GetnDim();
-  unsigned long iPoint, jPoint, iVertex;
-  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j;
-  su2double **Smatrix, *Cvector;
-  
-  Smatrix = new su2double* [nDim];
-  Cvector = new su2double [nDim];
-  for (iDim = 0; iDim < nDim; iDim++)
-    Smatrix[iDim] = new su2double [nDim];
-  
+  for (iVar = 0; iVar < nVar; iVar++) {
+    sbuf_residual[iVar] = GetRes_Max(iVar);
+    sbuf_point[iVar] = GetPoint_Max(iVar);
+    Coord = GetPoint_Max_Coord(iVar);
+    for (iDim = 0; iDim < nDim; iDim++)
+      sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+  }
   
-  /*--- Loop over boundary markers to select those for Euler or NS walls ---*/
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    Boundary = config->GetMarker_All_KindBC(iMarker);
-    switch (Boundary) {
-      case EULER_WALL:
-      case HEAT_FLUX:
-      case ISOTHERMAL:
-      case CHT_WALL_INTERFACE:
-        
-        /*--- Loop over points on the surface (Least-Squares approximation) ---*/
-        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
-          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
-          if (geometry->node[iPoint]->GetDomain()) {
-            Coord_i = geometry->node[iPoint]->GetCoord();
-            AuxVar_i = node[iPoint]->GetAuxVar();
-            
-            /*--- Inizialization of variables ---*/
-            for (iDim = 0; iDim < nDim; iDim++)
-              Cvector[iDim] = 0.0;
-            su2double r11 = 0.0, r12 = 0.0, r13 = 0.0, r22 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
-            
-            for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
-              jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
-              Coord_j = geometry->node[jPoint]->GetCoord();
-              AuxVar_j = node[jPoint]->GetAuxVar();
-              
-              su2double weight = 0;
-              for (iDim = 0; iDim < nDim; iDim++)
-                weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
-              
-              /*--- Sumations for entries of upper triangular matrix R ---*/
-              r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
-              r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
-              r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
-              if (nDim == 3) {
-                r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-                r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
-                r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
-                r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
-              }
-              
-              /*--- Entries of c:= transpose(A)*b ---*/
-              for (iDim = 0; iDim < nDim; iDim++)
-                Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/weight;
-            }
-            
-            /*--- Entries of upper triangular matrix R ---*/
-            r11 = sqrt(r11);
-            r12 = r12/r11;
-            r22 = sqrt(r22-r12*r12);
-            if (nDim == 3) {
-              r13 = r13/r11;
-              r23 = r23_a/r22 - r23_b*r12/(r11*r22);
-              r33 = sqrt(r33-r23*r23-r13*r13);
-            }
-            /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
-            if (nDim == 2) {
-              su2double detR2 = (r11*r22)*(r11*r22);
-              Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
-              Smatrix[0][1] = -r11*r12/detR2;
-              Smatrix[1][0] = Smatrix[0][1];
-              Smatrix[1][1] = r11*r11/detR2;
-            }
-            else {
-              su2double detR2 = (r11*r22*r33)*(r11*r22*r33);
-              su2double z11, z12, z13, z22, z23, z33; // aux vars
-              z11 = r22*r33;
-              z12 = -r12*r33;
-              z13 = r12*r23-r13*r22;
-              z22 = r11*r33;
-              z23 = -r11*r23;
-              z33 = r11*r22;
-              Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
-              Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
-              Smatrix[0][2] = (z13*z33)/detR2;
-              Smatrix[1][0] = Smatrix[0][1];
-              Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
-              Smatrix[1][2] = (z23*z33)/detR2;
-              Smatrix[2][0] = Smatrix[0][2];
-              Smatrix[2][1] = Smatrix[1][2];
-              Smatrix[2][2] = (z33*z33)/detR2;
-            }
-            /*--- Computation of the gradient: S*c ---*/
-            su2double product;
-            for (iDim = 0; iDim < nDim; iDim++) {
-              product = 0.0;
-              for (jDim = 0; jDim < nDim; jDim++)
-                product += Smatrix[iDim][jDim]*Cvector[jDim];
-              node[iPoint]->SetAuxVarGradient(iDim, product);
-            }
-          }
-        } /*--- End of loop over surface points ---*/
-        break;
-      default:
-        break;
+  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_SU2DOUBLE, rbuf_residual, nVar, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_SU2DOUBLE, rbuf_coord, nVar*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      AddRes_Max(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
     }
   }
   
-  /*--- Memory deallocation ---*/
-  for (iDim = 0; iDim < nDim; iDim++)
-    delete [] Smatrix[iDim];
-  delete [] Cvector;
-  delete [] Smatrix;
-}
-
-void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
+  delete [] sbuf_residual;
+  delete [] rbuf_residual;
   
-  unsigned long iEdge, iPoint, jPoint;
-  unsigned short iVar, iDim;
-  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
-  *Solution, *Solution_i, *Solution_j, *LocalMinSolution, *LocalMaxSolution,
-  *GlobalMinSolution, *GlobalMaxSolution,
-  dave, LimK, eps1, eps2, dm, dp, du, ds, y, limiter, SharpEdge_Distance;
+  delete [] sbuf_point;
+  delete [] rbuf_point;
   
-  dave = config->GetRefElemLength();
-  LimK = config->GetVenkat_LimiterCoeff();
+  delete [] sbuf_coord;
+  delete [] rbuf_coord;
   
-  if (config->GetKind_SlopeLimit() == NO_LIMITER) {
-    
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        node[iPoint]->SetLimiter(iVar, 1.0);
-      }
+#endif
+  
+  if (Exact_RMS != NULL) delete [] Exact_RMS;
+  
+}
+
+void CSolver::SetResidual_BGS(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar;
+
+#ifndef HAVE_MPI
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+
+    if (GetRes_BGS(iVar) != GetRes_BGS(iVar)) {
+      SU2_MPI::Error("SU2 has diverged.", CURRENT_FUNCTION);
     }
-    
+
+    SetRes_BGS(iVar, max(EPS*EPS, sqrt(GetRes_BGS(iVar)/geometry->GetnPoint())));
+
   }
-  
-  else {
-    
-    /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
-    
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        node[iPoint]->SetSolution_Max(iVar, -EPS);
-        node[iPoint]->SetSolution_Min(iVar, EPS);
-        node[iPoint]->SetLimiter(iVar, 2.0);
-      }
-    }
-    
-    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
-    
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      /*--- Point identification, Normal vector and area ---*/
-      
-      iPoint = geometry->edge[iEdge]->GetNode(0);
-      jPoint = geometry->edge[iEdge]->GetNode(1);
-      
-      /*--- Get the conserved variables ---*/
-      
-      Solution_i = node[iPoint]->GetSolution();
-      Solution_j = node[jPoint]->GetSolution();
-      
-      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
-      
-      for (iVar = 0; iVar < nVar; iVar++) {
-        du = (Solution_j[iVar] - Solution_i[iVar]);
-        node[iPoint]->SetSolution_Min(iVar, min(node[iPoint]->GetSolution_Min(iVar), du));
-        node[iPoint]->SetSolution_Max(iVar, max(node[iPoint]->GetSolution_Max(iVar), du));
-        node[jPoint]->SetSolution_Min(iVar, min(node[jPoint]->GetSolution_Min(iVar), -du));
-        node[jPoint]->SetSolution_Max(iVar, max(node[jPoint]->GetSolution_Max(iVar), -du));
-      }
-      
+
+#else
+
+  int nProcessor = size, iProcessor;
+
+  su2double *sbuf_residual, *rbuf_residual, *sbuf_coord, *rbuf_coord, *Coord;
+  unsigned long *sbuf_point, *rbuf_point, Local_nPointDomain, Global_nPointDomain;
+  unsigned short iDim;
+
+  /*--- Set the L2 Norm residual in all the processors ---*/
+
+  sbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
+  rbuf_residual  = new su2double[nVar]; for (iVar = 0; iVar < nVar; iVar++) rbuf_residual[iVar] = 0.0;
+
+  for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = GetRes_BGS(iVar);
+  Local_nPointDomain = geometry->GetnPointDomain();
+
+
+  SU2_MPI::Allreduce(sbuf_residual, rbuf_residual, nVar, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+  SU2_MPI::Allreduce(&Local_nPointDomain, &Global_nPointDomain, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
+
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+
+    if (rbuf_residual[iVar] != rbuf_residual[iVar]) {
+
+      SU2_MPI::Error("SU2 has diverged (NaN detected)", CURRENT_FUNCTION);
+
     }
-    
+
+    SetRes_BGS(iVar, max(EPS*EPS, sqrt(rbuf_residual[iVar]/Global_nPointDomain)));
+
   }
-  
-  /*--- Barth-Jespersen limiter with Venkatakrishnan modification ---*/
-  
-  if (config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) {
-    
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
-      
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
-      
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nVar, nDim);
-      AD::SetPreaccIn(Gradient_j, nVar, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
 
-      for (iVar = 0; iVar < nVar; iVar++) {
-        
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
+  delete [] sbuf_residual;
+  delete [] rbuf_residual;
 
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-          else dp = node[iPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[iPoint]->GetLimiter(iVar)) {
-          node[iPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
-        }
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if (dm == 0.0) { limiter = 2.0; }
-        else {
-          if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-          else dp = node[jPoint]->GetSolution_Min(iVar);
-          limiter = dp/dm;
-        }
-        
-        if (limiter < node[jPoint]->GetLimiter(iVar)) {
-          node[jPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
-        }
+  /*--- Set the Maximum residual in all the processors ---*/
+  sbuf_residual = new su2double [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_residual[iVar] = 0.0;
+  sbuf_point = new unsigned long [nVar]; for (iVar = 0; iVar < nVar; iVar++) sbuf_point[iVar] = 0;
+  sbuf_coord = new su2double[nVar*nDim]; for (iVar = 0; iVar < nVar*nDim; iVar++) sbuf_coord[iVar] = 0.0;
 
-      }
-      
-      AD::EndPreacc();
-      
-    }
+  rbuf_residual = new su2double [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_residual[iVar] = 0.0;
+  rbuf_point = new unsigned long [nProcessor*nVar]; for (iVar = 0; iVar < nProcessor*nVar; iVar++) rbuf_point[iVar] = 0;
+  rbuf_coord = new su2double[nProcessor*nVar*nDim]; for (iVar = 0; iVar < nProcessor*nVar*nDim; iVar++) rbuf_coord[iVar] = 0.0;
 
+  for (iVar = 0; iVar < nVar; iVar++) {
+    sbuf_residual[iVar] = GetRes_Max_BGS(iVar);
+    sbuf_point[iVar] = GetPoint_Max_BGS(iVar);
+    Coord = GetPoint_Max_Coord_BGS(iVar);
+    for (iDim = 0; iDim < nDim; iDim++)
+      sbuf_coord[iVar*nDim+iDim] = Coord[iDim];
+  }
 
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-      for (iVar = 0; iVar < nVar; iVar++) {
-        y =  node[iPoint]->GetLimiter(iVar);
-        limiter = (y*y + 2.0*y) / (y*y + y + 2.0);
-        node[iPoint]->SetLimiter(iVar, limiter);
-      }
+  SU2_MPI::Allgather(sbuf_residual, nVar, MPI_SU2DOUBLE, rbuf_residual, nVar, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_point, nVar, MPI_UNSIGNED_LONG, rbuf_point, nVar, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
+  SU2_MPI::Allgather(sbuf_coord, nVar*nDim, MPI_SU2DOUBLE, rbuf_coord, nVar*nDim, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+
+  for (iVar = 0; iVar < nVar; iVar++) {
+    for (iProcessor = 0; iProcessor < nProcessor; iProcessor++) {
+      AddRes_Max_BGS(iVar, rbuf_residual[iProcessor*nVar+iVar], rbuf_point[iProcessor*nVar+iVar], &rbuf_coord[iProcessor*nVar*nDim+iVar*nDim]);
     }
-    
   }
 
-  /*--- Venkatakrishnan limiter ---*/
+  delete [] sbuf_residual;
+  delete [] rbuf_residual;
+
+  delete [] sbuf_point;
+  delete [] rbuf_point;
+
+  delete [] sbuf_coord;
+  delete [] rbuf_coord;
+
+#endif
+
+}
+
+void CSolver::SetGrid_Movement_Residual (CGeometry *geometry, CConfig *config) {
   
-  if ((config->GetKind_SlopeLimit() == VENKATAKRISHNAN) || (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG)) {
+  unsigned short iDim, nDim = geometry->GetnDim(), iVar, nVar = GetnVar(), iMarker;
+  unsigned long iVertex, iEdge;
+  su2double ProjGridVel, *Normal;
+  
+  /*--- Loop interior edges ---*/
+   
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
     
-    /*--- Allocate memory for the max and min solution value --*/
+    const unsigned long iPoint = geometry->edge[iEdge]->GetNode(0);
+    const unsigned long jPoint = geometry->edge[iEdge]->GetNode(1);
     
-    LocalMinSolution = new su2double [nVar]; GlobalMinSolution = new su2double [nVar];
-    LocalMaxSolution = new su2double [nVar]; GlobalMaxSolution = new su2double [nVar];
+    /*--- Solution at each edge point ---*/
     
-    /*--- Compute the max value and min value of the solution ---*/
+    su2double *Solution_i = node[iPoint]->GetSolution();
+    su2double *Solution_j = node[jPoint]->GetSolution();
     
-    Solution = node[iPoint]->GetSolution();
-    for (iVar = 0; iVar < nVar; iVar++) {
-      LocalMinSolution[iVar] = Solution[iVar];
-      LocalMaxSolution[iVar] = Solution[iVar];
-    }
+    for (iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = 0.5* (Solution_i[iVar] + Solution_j[iVar]);
     
-    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    /*--- Grid Velocity at each edge point ---*/
+    
+    su2double *GridVel_i = geometry->node[iPoint]->GetGridVel();
+    su2double *GridVel_j = geometry->node[jPoint]->GetGridVel();
+    for (iDim = 0; iDim < nDim; iDim++)
+      Vector[iDim] = 0.5* (GridVel_i[iDim] + GridVel_j[iDim]);
+    
+    Normal = geometry->edge[iEdge]->GetNormal();
+    
+    ProjGridVel = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      ProjGridVel += Vector[iDim]*Normal[iDim];
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      Residual[iVar] = ProjGridVel*Solution[iVar];
+    
+    LinSysRes.SubtractBlock(iPoint, Residual);
+    LinSysRes.AddBlock(jPoint, Residual);
+    
+  }
+  
+  /*--- Loop boundary edges ---*/
+  
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
+    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      const unsigned long Point = geometry->vertex[iMarker][iVertex]->GetNode();
       
-      /*--- Get the solution variables ---*/
+      /*--- Solution at each edge point ---*/
       
-      Solution = node[iPoint]->GetSolution();
+      su2double *Solution = node[Point]->GetSolution();
       
-      for (iVar = 0; iVar < nVar; iVar++) {
-        LocalMinSolution[iVar] = min (LocalMinSolution[iVar], Solution[iVar]);
-        LocalMaxSolution[iVar] = max (LocalMaxSolution[iVar], Solution[iVar]);
-      }
+      /*--- Grid Velocity at each edge point ---*/
+      
+      su2double *GridVel = geometry->node[Point]->GetGridVel();
+      
+      /*--- Summed normal components ---*/
       
+      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      
+      ProjGridVel = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        ProjGridVel -= GridVel[iDim]*Normal[iDim];
+      
+      for (iVar = 0; iVar < nVar; iVar++)
+        Residual[iVar] = ProjGridVel*Solution[iVar];
+      
+      LinSysRes.AddBlock(Point, Residual);
     }
-    
+  }
+  
+}
+
+void CSolver::Set_MPI_AuxVar_Gradient(CGeometry *geometry, CConfig *config) {
+  unsigned short iVar, iDim, iMarker, iPeriodic_Index, MarkerS, MarkerR;
+  unsigned long iVertex, iPoint, nVertexS, nVertexR, nBufferS_Vector, nBufferR_Vector;
+  su2double rotMatrix[3][3], *angles, theta, cosTheta, sinTheta, phi, cosPhi, sinPhi, psi, cosPsi, sinPsi,
+  *Buffer_Receive_Gradient = NULL, *Buffer_Send_Gradient = NULL;
+  
+  unsigned short nAuxVar = 1;
+  
+  su2double **Gradient = new su2double* [nAuxVar];
+  for (iVar = 0; iVar < nAuxVar; iVar++)
+    Gradient[iVar] = new su2double[nDim];
+  
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(LocalMinSolution, GlobalMinSolution, nVar, MPI_DOUBLE, MPI_MIN, MPI_COMM_WORLD);
-    SU2_MPI::Allreduce(LocalMaxSolution, GlobalMaxSolution, nVar, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD);
-#else
-    for (iVar = 0; iVar < nVar; iVar++) {
-      GlobalMinSolution[iVar] = LocalMinSolution[iVar];
-      GlobalMaxSolution[iVar] = LocalMaxSolution[iVar];
-    }
+  int send_to, receive_from;
+  SU2_MPI::Status status;
 #endif
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
     
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    if ((config->GetMarker_All_KindBC(iMarker) == SEND_RECEIVE) &&
+        (config->GetMarker_All_SendRecv(iMarker) > 0)) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      MarkerS = iMarker;  MarkerR = iMarker+1;
       
-      AD::StartPreacc();
-      AD::SetPreaccIn(Gradient_i, nVar, nDim);
-      AD::SetPreaccIn(Gradient_j, nVar, nDim);
-      AD::SetPreaccIn(Coord_i, nDim); AD::SetPreaccIn(Coord_j, nDim);
-
-      for (iVar = 0; iVar < nVar; iVar++) {
-        
-        if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
-          eps1 = LimK * (GlobalMaxSolution[iVar] - GlobalMinSolution[iVar]);
-          eps2 = eps1*eps1;
-        }
-        else {
-          eps1 = LimK*dave;
-          eps2 = eps1*eps1*eps1;
-        }
-        
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[iPoint]->GetSolution_Min(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Max(iVar));
-        AD::SetPreaccIn(node[jPoint]->GetSolution_Min(iVar));
-
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter(iVar)) {
-          node[iPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[iPoint]->GetLimiter()[iVar]);
-        }
-        
-        /*-- Repeat for point j on the edge ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
-        
-        limiter = ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[jPoint]->GetLimiter(iVar)) {
-          node[jPoint]->SetLimiter(iVar, limiter);
-          AD::SetPreaccOut(node[jPoint]->GetLimiter()[iVar]);
-        }
+#ifdef HAVE_MPI
+      send_to = config->GetMarker_All_SendRecv(MarkerS)-1;
+      receive_from = abs(config->GetMarker_All_SendRecv(MarkerR))-1;
+#endif
+      
+      nVertexS = geometry->nVertex[MarkerS];  nVertexR = geometry->nVertex[MarkerR];
+      nBufferS_Vector = nVertexS*nAuxVar*nDim;        nBufferR_Vector = nVertexR*nAuxVar*nDim;
+      
+      /*--- Allocate Receive and send buffers  ---*/
+      Buffer_Receive_Gradient = new su2double [nBufferR_Vector];
+      Buffer_Send_Gradient = new su2double[nBufferS_Vector];
+      
+      /*--- Copy the solution old that should be sended ---*/
+      for (iVertex = 0; iVertex < nVertexS; iVertex++) {
+        iPoint = geometry->vertex[MarkerS][iVertex]->GetNode();
+        for (iVar = 0; iVar < nAuxVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Buffer_Send_Gradient[iDim*nAuxVar*nVertexS+iVar*nVertexS+iVertex] = node[iPoint]->GetGradient(iVar, iDim);
       }
       
-      AD::EndPreacc();
-
-    }
-    
-    delete [] LocalMinSolution; delete [] GlobalMinSolution;
-    delete [] LocalMaxSolution; delete [] GlobalMaxSolution;
-
-  }
-  
-  /*--- Sharp edges limiter ---*/
-  
-  if (config->GetKind_SlopeLimit() == SHARP_EDGES) {
-    
-    /*-- Get limiter parameters from the configuration file ---*/
-    
-    dave = config->GetRefElemLength();
-    LimK = config->GetVenkat_LimiterCoeff();
-    eps1 = LimK*dave;
-    eps2 = eps1*eps1*eps1;
-    
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+#ifdef HAVE_MPI
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+      /*--- Send/Receive information using Sendrecv ---*/
+      SU2_MPI::Sendrecv(Buffer_Send_Gradient, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                        Buffer_Receive_Gradient, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+#else
       
-      for (iVar = 0; iVar < nVar; iVar++) {
-        
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        /*--- Compute the distance to a sharp edge ---*/
-        
-        SharpEdge_Distance = (geometry->node[iPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
-        ds = 0.0;
-        if (SharpEdge_Distance < -eps1) ds = 0.0;
-        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
-        if (SharpEdge_Distance > eps1) ds = 1.0;
-        
-        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter(iVar))
-          node[iPoint]->SetLimiter(iVar, limiter);
-        
-        /*-- Repeat for point j on the edge ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
-        
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
-        
-        /*--- Compute the distance to a sharp edge ---*/
-        
-        SharpEdge_Distance = (geometry->node[jPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
-        ds = 0.0;
-        if (SharpEdge_Distance < -eps1) ds = 0.0;
-        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
-        if (SharpEdge_Distance > eps1) ds = 1.0;
-        
-        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[jPoint]->GetLimiter(iVar))
-          node[jPoint]->SetLimiter(iVar, limiter);
-        
+      /*--- Receive information without MPI ---*/
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
+        for (iVar = 0; iVar < nAuxVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Buffer_Receive_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex] = Buffer_Send_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
       }
-    }
-  }
-  
-  /*--- Sharp edges limiter ---*/
-  
-  if (config->GetKind_SlopeLimit() == WALL_DISTANCE) {
-    
-    /*-- Get limiter parameters from the configuration file ---*/
-    
-    dave = config->GetRefElemLength();
-    LimK = config->GetVenkat_LimiterCoeff();
-    eps1 = LimK*dave;
-    eps2 = eps1*eps1*eps1;
-    
-    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
       
-      iPoint     = geometry->edge[iEdge]->GetNode(0);
-      jPoint     = geometry->edge[iEdge]->GetNode(1);
-      Gradient_i = node[iPoint]->GetGradient();
-      Gradient_j = node[jPoint]->GetGradient();
-      Coord_i    = geometry->node[iPoint]->GetCoord();
-      Coord_j    = geometry->node[jPoint]->GetCoord();
+#endif
       
-      for (iVar = 0; iVar < nVar; iVar++) {
-        
-        /*--- Calculate the interface left gradient, delta- (dm) ---*/
-        
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
-        
-        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
-        
-        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
-        else dp = node[iPoint]->GetSolution_Min(iVar);
-        
-        /*--- Compute the distance to a sharp edge ---*/
-        
-        SharpEdge_Distance = (geometry->node[iPoint]->GetWall_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
-        ds = 0.0;
-        if (SharpEdge_Distance < -eps1) ds = 0.0;
-        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
-        if (SharpEdge_Distance > eps1) ds = 1.0;
-        
-        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
-        
-        if (limiter < node[iPoint]->GetLimiter(iVar))
-          node[iPoint]->SetLimiter(iVar, limiter);
+      /*--- Deallocate send buffer ---*/
+      delete [] Buffer_Send_Gradient;
+      
+      /*--- Do the coordinate transformation ---*/
+      for (iVertex = 0; iVertex < nVertexR; iVertex++) {
         
-        /*-- Repeat for point j on the edge ---*/
+        /*--- Find point and its type of transformation ---*/
+        iPoint = geometry->vertex[MarkerR][iVertex]->GetNode();
+        iPeriodic_Index = geometry->vertex[MarkerR][iVertex]->GetRotation_Type();
         
-        dm = 0.0;
-        for (iDim = 0; iDim < nDim; iDim++)
-          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+        /*--- Retrieve the supplied periodic information. ---*/
+        angles = config->GetPeriodicRotation(iPeriodic_Index);
         
-        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
-        else dp = node[jPoint]->GetSolution_Min(iVar);
+        /*--- Store angles separately for clarity. ---*/
+        theta    = angles[0];   phi    = angles[1];     psi    = angles[2];
+        cosTheta = cos(theta);  cosPhi = cos(phi);      cosPsi = cos(psi);
+        sinTheta = sin(theta);  sinPhi = sin(phi);      sinPsi = sin(psi);
         
-        /*--- Compute the distance to a sharp edge ---*/
+        /*--- Compute the rotation matrix. Note that the implicit
+         ordering is rotation about the x-axis, y-axis,
+         then z-axis. Note that this is the transpose of the matrix
+         used during the preprocessing stage. ---*/
+        rotMatrix[0][0] = cosPhi*cosPsi;    rotMatrix[1][0] = sinTheta*sinPhi*cosPsi - cosTheta*sinPsi;     rotMatrix[2][0] = cosTheta*sinPhi*cosPsi + sinTheta*sinPsi;
+        rotMatrix[0][1] = cosPhi*sinPsi;    rotMatrix[1][1] = sinTheta*sinPhi*sinPsi + cosTheta*cosPsi;     rotMatrix[2][1] = cosTheta*sinPhi*sinPsi - sinTheta*cosPsi;
+        rotMatrix[0][2] = -sinPhi;          rotMatrix[1][2] = sinTheta*cosPhi;                              rotMatrix[2][2] = cosTheta*cosPhi;
         
-        SharpEdge_Distance = (geometry->node[jPoint]->GetWall_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
-        ds = 0.0;
-        if (SharpEdge_Distance < -eps1) ds = 0.0;
-        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
-        if (SharpEdge_Distance > eps1) ds = 1.0;
+        /*--- Copy conserved variables before performing transformation. ---*/
+        for (iVar = 0; iVar < nAuxVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Gradient[iVar][iDim] = Buffer_Receive_Gradient[iDim*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
         
-        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+        /*--- Need to rotate the gradients for all conserved variables. ---*/
+        for (iVar = 0; iVar < nAuxVar; iVar++) {
+          if (nDim == 2) {
+            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+          }
+          else {
+            Gradient[iVar][0] = rotMatrix[0][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[0][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][1] = rotMatrix[1][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[1][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+            Gradient[iVar][2] = rotMatrix[2][0]*Buffer_Receive_Gradient[0*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][1]*Buffer_Receive_Gradient[1*nAuxVar*nVertexR+iVar*nVertexR+iVertex] + rotMatrix[2][2]*Buffer_Receive_Gradient[2*nAuxVar*nVertexR+iVar*nVertexR+iVertex];
+          }
+        }
         
-        if (limiter < node[jPoint]->GetLimiter(iVar))
-          node[jPoint]->SetLimiter(iVar, limiter);
+        /*--- Store the received information ---*/
+        for (iVar = 0; iVar < nAuxVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            node[iPoint]->SetGradient(iVar, iDim, Gradient[iVar][iDim]);
         
       }
+      
+      /*--- Deallocate receive buffer ---*/
+      delete [] Buffer_Receive_Gradient;
+      
     }
+    
   }
-
-  
-  /*--- Limiter MPI ---*/
   
-  Set_MPI_Solution_Limiter(geometry, config);
+  for (iVar = 0; iVar < nAuxVar; iVar++)
+    delete [] Gradient[iVar];
+  delete [] Gradient;
   
 }
 
-void CSolver::SetPressureLaplacian(CGeometry *geometry, CConfig *config, su2double *PressureLaplacian) {
+void CSolver::SetAuxVar_Gradient_GG(CGeometry *geometry, CConfig *config) {
   
   unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
-  unsigned short iMarker, iVar;
-  su2double DualArea, Partial_Res, *Normal;
-  su2double **UxVar_Gradient, **UyVar_Gradient;
+  unsigned short nDim = geometry->GetnDim(), iDim, iMarker;
   
-  UxVar_Gradient = new su2double* [geometry->GetnPoint()];
-  UyVar_Gradient = new su2double* [geometry->GetnPoint()];
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    UxVar_Gradient[iPoint] = new su2double [2];
-    UyVar_Gradient[iPoint] = new su2double [2];
-  }
+  su2double AuxVar_Vertex, AuxVar_i, AuxVar_j, AuxVar_Average;
+  su2double *Gradient, DualArea, Partial_Res, Grad_Val, *Normal;
   
   for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
-    for (iVar = 0; iVar < 2; iVar++) {
-      UxVar_Gradient[iPoint][iVar] = 0.0;
-      UyVar_Gradient[iPoint][iVar] = 0.0;
-    }
+    node[iPoint]->SetAuxVarGradientZero();    // Set Gradient to Zero
   
-  /*---  Loop interior edges ---*/
+  /*--- Loop interior edges ---*/
   
   for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
     iPoint = geometry->edge[iEdge]->GetNode(0);
     jPoint = geometry->edge[iEdge]->GetNode(1);
-    Normal = geometry->edge[iEdge]->GetNormal();
-    
-    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(1) + node[jPoint]->GetSolution(1)) * Normal[0];
-    UxVar_Gradient[iPoint][0] += Partial_Res;
-    UxVar_Gradient[jPoint][0] -= Partial_Res;
-    
-    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(1) + node[jPoint]->GetSolution(1)) * Normal[1];
-    UxVar_Gradient[iPoint][1] += Partial_Res;
-    UxVar_Gradient[jPoint][1] -= Partial_Res;
-    
-    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(2) + node[jPoint]->GetSolution(2)) * Normal[0];
-    UyVar_Gradient[iPoint][0] += Partial_Res;
-    UyVar_Gradient[jPoint][0] -= Partial_Res;
     
-    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(2) + node[jPoint]->GetSolution(2)) * Normal[1];
-    UyVar_Gradient[iPoint][1] += Partial_Res;
-    UyVar_Gradient[jPoint][1] -= Partial_Res;
+    AuxVar_i = node[iPoint]->GetAuxVar();
+    AuxVar_j = node[jPoint]->GetAuxVar();
     
+    Normal = geometry->edge[iEdge]->GetNormal();
+    AuxVar_Average =  0.5 * ( AuxVar_i + AuxVar_j);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Partial_Res = AuxVar_Average*Normal[iDim];
+      node[iPoint]->AddAuxVarGradient(iDim, Partial_Res);
+      node[jPoint]->SubtractAuxVarGradient(iDim, Partial_Res);
+    }
   }
   
-  /*---  Loop boundary edges ---*/
+  /*--- Loop boundary edges ---*/
   
   for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
     if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
     for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
       Point = geometry->vertex[iMarker][iVertex]->GetNode();
+      AuxVar_Vertex = node[Point]->GetAuxVar();
       Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
-      
-      Partial_Res =  node[Point]->GetSolution(1) * Normal[0];
-      UxVar_Gradient[Point][0] -= Partial_Res;
-      
-      Partial_Res =  node[Point]->GetSolution(1) * Normal[1];
-      UxVar_Gradient[Point][1] -= Partial_Res;
-      
-      Partial_Res =  node[Point]->GetSolution(2) * Normal[0];
-      UyVar_Gradient[Point][0] -= Partial_Res;
-      
-      Partial_Res =  node[Point]->GetSolution(2) * Normal[1];
-      UyVar_Gradient[Point][1] -= Partial_Res;
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Partial_Res = AuxVar_Vertex*Normal[iDim];
+        node[Point]->SubtractAuxVarGradient(iDim, Partial_Res);
+      }
     }
   
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    DualArea = geometry->node[iPoint]->GetVolume();
-    PressureLaplacian[iPoint] = (UxVar_Gradient[iPoint][0]*UxVar_Gradient[iPoint][0] + UyVar_Gradient[iPoint][1]*UyVar_Gradient[iPoint][1] +
-                                 UxVar_Gradient[iPoint][1]*UyVar_Gradient[iPoint][0] + UxVar_Gradient[iPoint][0]*UyVar_Gradient[iPoint][1])/DualArea ;
-    
-  }
+  for (iPoint=0; iPoint<geometry->GetnPoint(); iPoint++)
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Gradient = node[iPoint]->GetAuxVarGradient();
+      DualArea = geometry->node[iPoint]->GetVolume();
+      Grad_Val = Gradient[iDim]/(DualArea+EPS);
+      node[iPoint]->SetAuxVarGradient(iDim, Grad_Val);
+    }
   
-  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
-    delete[] UxVar_Gradient[iPoint];
-    delete[] UyVar_Gradient[iPoint];
-  }
+  /*--- Gradient MPI ---*/
   
-  delete[] UxVar_Gradient;
-  delete[] UyVar_Gradient;
+  Set_MPI_AuxVar_Gradient(geometry, config);
   
 }
 
-void CSolver::Gauss_Elimination(su2double** A, su2double* rhs, unsigned short nVar) {
+void CSolver::SetAuxVar_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  short iVar, jVar, kVar;
-  su2double weight, aux;
+  unsigned short iDim, jDim, iNeigh;
+  unsigned short nDim = geometry->GetnDim();
+  unsigned long iPoint, jPoint;
+  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j, weight, r11, r12, r13, r22, r23, r23_a,
+  r23_b, r33, z11, z12, z13, z22, z23, z33, detR2, product;
+  bool singular = false;
   
-  if (nVar == 1)
-    rhs[0] /= A[0][0];
-  else {
+  su2double *Cvector = new su2double [nDim];
+  
+  /*--- Loop over points of the grid ---*/
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
     
-    /*--- Transform system in Upper Matrix ---*/
+    Coord_i = geometry->node[iPoint]->GetCoord();
+    AuxVar_i = node[iPoint]->GetAuxVar();
     
-    for (iVar = 1; iVar < (short)nVar; iVar++) {
-      for (jVar = 0; jVar < iVar; jVar++) {
-        weight = A[iVar][jVar]/A[jVar][jVar];
-        for (kVar = jVar; kVar < (short)nVar; kVar++)
-          A[iVar][kVar] -= weight*A[jVar][kVar];
-        rhs[iVar] -= weight*rhs[jVar];
+    /*--- Inizialization of variables ---*/
+    for (iDim = 0; iDim < nDim; iDim++)
+      Cvector[iDim] = 0.0;
+    
+    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+    
+    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      Coord_j = geometry->node[jPoint]->GetCoord();
+      AuxVar_j = node[jPoint]->GetAuxVar();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      /*--- Sumations for entries of upper triangular matrix R ---*/
+      
+      if (fabs(weight) > EPS) {
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+        
+        /*--- Entries of c:= transpose(A)*b ---*/
+        
+        for (iDim = 0; iDim < nDim; iDim++)
+          Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/(weight);
       }
+      
     }
     
-    /*--- Backwards substitution ---*/
+    /*--- Entries of upper triangular matrix R ---*/
     
-    rhs[nVar-1] = rhs[nVar-1]/A[nVar-1][nVar-1];
-    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
-      aux = 0;
-      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
-        aux += A[iVar][jVar]*rhs[jVar];
-      rhs[iVar] = (rhs[iVar]-aux)/A[iVar][iVar];
-      if (iVar == 0) break;
+    if (fabs(r11) < EPS) r11 = EPS;
+    r11 = sqrt(r11);
+    r12 = r12/r11;
+    r22 = sqrt(r22-r12*r12);
+    if (fabs(r22) < EPS) r22 = EPS;
+    if (nDim == 3) {
+      r13 = r13/r11;
+      r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
+      r33 = sqrt(r33-r23*r23-r13*r13);
+    }
+    
+    /*--- Compute determinant ---*/
+    
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+    
+    /*--- Detect singular matrices ---*/
+    
+    if (fabs(detR2) < EPS) singular = true;
+    
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+    
+    if (singular) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        for (jDim = 0; jDim < nDim; jDim++)
+          Smatrix[iDim][jDim] = 0.0;
+    }
+    else {
+      if (nDim == 2) {
+        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+        Smatrix[0][1] = -r11*r12/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = r11*r11/detR2;
+      }
+      else {
+        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+        Smatrix[0][2] = (z13*z33)/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+        Smatrix[1][2] = (z23*z33)/detR2;
+        Smatrix[2][0] = Smatrix[0][2];
+        Smatrix[2][1] = Smatrix[1][2];
+        Smatrix[2][2] = (z33*z33)/detR2;
+      }
+    }
+    
+    /*--- Computation of the gradient: S*c ---*/
+    
+    for (iDim = 0; iDim < nDim; iDim++) {
+      product = 0.0;
+      for (jDim = 0; jDim < nDim; jDim++)
+        product += Smatrix[iDim][jDim]*Cvector[jDim];
+      if (geometry->node[iPoint]->GetDomain())
+        node[iPoint]->SetAuxVarGradient(iDim, product);
     }
   }
   
+  delete [] Cvector;
+  
+  /*--- Gradient MPI ---*/
+  
+  Set_MPI_AuxVar_Gradient(geometry, config);
+  
 }
 
-void CSolver::Aeroelastic(CSurfaceMovement *surface_movement, CGeometry *geometry, CConfig *config, unsigned long ExtIter) {
-  
-  /*--- Variables used for Aeroelastic case ---*/
+void CSolver::SetSolution_Gradient_GG(CGeometry *geometry, CConfig *config) {
+  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
+  unsigned short iVar, iDim, iMarker;
+  su2double *Solution_Vertex, *Solution_i, *Solution_j, Solution_Average, **Gradient, DualArea,
+  Partial_Res, Grad_Val, *Normal;
   
-  su2double Cl, Cd, Cn, Ct, Cm, Cn_rot;
-  su2double Alpha = config->GetAoA()*PI_NUMBER/180.0;
-  vector<su2double> structural_solution(4,0.0); //contains solution(displacements and rates) of typical section wing model.
+  double tick = 0.0;
+  config->Tick(&tick);
   
-  unsigned short iMarker, iMarker_Monitoring, Monitoring;
-  string Marker_Tag, Monitoring_Tag;
+  /*--- Set Gradient to Zero ---*/
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+    node[iPoint]->SetGradientZero();
   
-  /*--- Loop over markers and find the ones being monitored. ---*/
+  /*--- Loop interior edges ---*/
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    
+    Solution_i = node[iPoint]->GetSolution();
+    Solution_j = node[jPoint]->GetSolution();
+    Normal = geometry->edge[iEdge]->GetNormal();
+    for (iVar = 0; iVar< nVar; iVar++) {
+      Solution_Average =  0.5 * (Solution_i[iVar] + Solution_j[iVar]);
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Partial_Res = Solution_Average*Normal[iDim];
+        if (geometry->node[iPoint]->GetDomain())
+          node[iPoint]->AddGradient(iVar, iDim, Partial_Res);
+        if (geometry->node[jPoint]->GetDomain())
+          node[jPoint]->SubtractGradient(iVar, iDim, Partial_Res);
+      }
+    }
+  }
   
-  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
-    Monitoring = config->GetMarker_All_Monitoring(iMarker);
-    if (Monitoring == YES) {
-      
-      /*--- Find the particular marker being monitored and get the forces acting on it. ---*/
-      
-      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
-        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
-        Marker_Tag = config->GetMarker_All_TagBound(iMarker);
-        if (Marker_Tag == Monitoring_Tag) {
-          
-          Cl = GetSurface_CL(iMarker_Monitoring);
-          Cd = GetSurface_CD(iMarker_Monitoring);
-          
-          /*--- For typical section wing model want the force normal to the airfoil (in the direction of the spring) ---*/
-          Cn = Cl*cos(Alpha) + Cd*sin(Alpha);
-          Ct = -Cl*sin(Alpha) + Cd*cos(Alpha);
-          
-          Cm = GetSurface_CMz(iMarker_Monitoring);
-          
-          /*--- Calculate forces for the Typical Section Wing Model taking into account rotation ---*/
-          
-          /*--- Note that the calculation of the forces and the subsequent displacements ...
-           is only correct for the airfoil that starts at the 0 degree position ---*/
-          
-          if (config->GetKind_GridMovement(ZONE_0) == AEROELASTIC_RIGID_MOTION) {
-            su2double Omega, dt, psi;
-            dt = config->GetDelta_UnstTimeND();
-            Omega  = (config->GetRotation_Rate_Z(ZONE_0)/config->GetOmega_Ref());
-            psi = Omega*(dt*ExtIter);
-            
-            /*--- Correct for the airfoil starting position (This is hardcoded in here) ---*/
-            if (Monitoring_Tag == "Airfoil1") {
-              psi = psi + 0.0;
-            }
-            else if (Monitoring_Tag == "Airfoil2") {
-              psi = psi + 2.0/3.0*PI_NUMBER;
-            }
-            else if (Monitoring_Tag == "Airfoil3") {
-              psi = psi + 4.0/3.0*PI_NUMBER;
-            }
-            else
-              cout << "WARNING: There is a marker that we are monitoring that doesn't match the values hardcoded above!" << endl;
-            
-            cout << Monitoring_Tag << " position " << psi*180.0/PI_NUMBER << " degrees. " << endl;
-            
-            Cn_rot = Cn*cos(psi) - Ct*sin(psi); //Note the signs are different for accounting for the AOA.
-            Cn = Cn_rot;
-          }
-          
-          /*--- Solve the aeroelastic equations for the particular marker(surface) ---*/
-          
-          SolveTypicalSectionWingModel(geometry, Cn, Cm, config, iMarker_Monitoring, structural_solution);
-          
-          break;
+  /*--- Loop boundary edges ---*/
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++) {
+    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY &&
+        config->GetMarker_All_KindBC(iMarker) != PERIODIC_BOUNDARY)
+    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      Point = geometry->vertex[iMarker][iVertex]->GetNode();
+      Solution_Vertex = node[Point]->GetSolution();
+      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      for (iVar = 0; iVar < nVar; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++) {
+          Partial_Res = Solution_Vertex[iVar]*Normal[iDim];
+          if (geometry->node[Point]->GetDomain())
+            node[Point]->SubtractGradient(iVar, iDim, Partial_Res);
         }
-      }
-      
-      /*--- Compute the new surface node locations ---*/
-      surface_movement->AeroelasticDeform(geometry, config, ExtIter, iMarker, iMarker_Monitoring, structural_solution);
-      
     }
-    
   }
   
-}
-
-void CSolver::SetUpTypicalSectionWingModel(vector<vector<su2double> >& Phi, vector<su2double>& omega, CConfig *config) {
-  
-  /*--- Retrieve values from the config file ---*/
-  su2double w_h = config->GetAeroelastic_Frequency_Plunge();
-  su2double w_a = config->GetAeroelastic_Frequency_Pitch();
-  su2double x_a = config->GetAeroelastic_CG_Location();
-  su2double r_a = sqrt(config->GetAeroelastic_Radius_Gyration_Squared());
-  su2double w = w_h/w_a;
+  /*--- Compute gradient ---*/
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++) {
+        Gradient = node[iPoint]->GetGradient();
+        DualArea = geometry->node[iPoint]->GetVolume();
+        Grad_Val = Gradient[iVar][iDim] / (DualArea+EPS);
+        node[iPoint]->SetGradient(iVar, iDim, Grad_Val);
+      }
   
-  // Mass Matrix
-  vector<vector<su2double> > M(2,vector<su2double>(2,0.0));
-  M[0][0] = 1;
-  M[0][1] = x_a;
-  M[1][0] = x_a;
-  M[1][1] = r_a*r_a;
+  /*--- Gradient MPI ---*/
+  Set_MPI_Solution_Gradient(geometry, config);
   
-  // Stiffness Matrix
-  //  vector<vector<su2double> > K(2,vector<su2double>(2,0.0));
-  //  K[0][0] = (w_h/w_a)*(w_h/w_a);
-  //  K[0][1] = 0.0;
-  //  K[1][0] = 0.0;
-  //  K[1][1] = r_a*r_a;
+  config->Tock(tick, "CSolver::SetSolution_Gradient_GG", PROFILE_GRADIENT);
   
-  /* Eigenvector and Eigenvalue Matrices of the Generalized EigenValue Problem. */
+}
+
+void CSolver::SetSolution_Gradient_LS(CGeometry *geometry, CConfig *config) {
   
-  vector<vector<su2double> > Omega2(2,vector<su2double>(2,0.0));
-  su2double aux; // auxiliary variable
-  aux = sqrt(pow(r_a,2)*pow(w,4) - 2*pow(r_a,2)*pow(w,2) + pow(r_a,2) + 4*pow(x_a,2)*pow(w,2));
-  Phi[0][0] = (r_a * (r_a - r_a*pow(w,2) + aux)) / (2*x_a*pow(w, 2));
-  Phi[0][1] = (r_a * (r_a - r_a*pow(w,2) - aux)) / (2*x_a*pow(w, 2));
-  Phi[1][0] = 1.0;
-  Phi[1][1] = 1.0;
+  unsigned short iDim, jDim, iVar, iNeigh;
+  unsigned long iPoint, jPoint, iEdge;
+  su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j,
+  r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
+  z22, z23, z33, product, *Weight_i, *Weight_j, du;
+  bool singular = false, domain_i, domain_j;
   
-  Omega2[0][0] = (r_a * (r_a + r_a*pow(w,2) - aux)) / (2*(pow(r_a, 2) - pow(x_a, 2)));
-  Omega2[0][1] = 0;
-  Omega2[1][0] = 0;
-  Omega2[1][1] = (r_a * (r_a + r_a*pow(w,2) + aux)) / (2*(pow(r_a, 2) - pow(x_a, 2)));
+  double tick = 0.0;
+  config->Tick(&tick);
   
-  /* Nondimesionalize the Eigenvectors such that Phi'*M*Phi = I and PHI'*K*PHI = Omega */
-  // Phi'*M*Phi = D
-  // D^(-1/2)*Phi'*M*Phi*D^(-1/2) = D^(-1/2)*D^(1/2)*D^(1/2)*D^(-1/2) = I,  D^(-1/2) = inv(sqrt(D))
-  // Phi = Phi*D^(-1/2)
+  /*--- With the weights cached in the geometry the gradient is a weighted
+   sum of the differences of the solution over the edges ---*/
   
-  vector<vector<su2double> > Aux(2,vector<su2double>(2,0.0));
-  vector<vector<su2double> > D(2,vector<su2double>(2,0.0));
-  // Aux = M*Phi
-  for (int i=0; i<2; i++) {
-    for (int j=0; j<2; j++) {
-      Aux[i][j] = 0;
-      for (int k=0; k<2; k++) {
-        Aux[i][j] += M[i][k]*Phi[k][j];
+  if (config->GetCache_LS_Weights()) {
+    
+    if (!geometry->LS_Weights_Ready) geometry->PreprocessLS_Weights();
+    
+    for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++)
+      node[iPoint]->SetGradientZero();
+    
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      iPoint = geometry->GetEdge_Node(iEdge, 0);
+      jPoint = geometry->GetEdge_Node(iEdge, 1);
+      domain_i = geometry->node[iPoint]->GetDomain();
+      domain_j = geometry->node[jPoint]->GetDomain();
+      
+      Solution_i = node[iPoint]->GetSolution();
+      Solution_j = node[jPoint]->GetSolution();
+      Weight_i = geometry->GetLS_Weight(iEdge, 0);
+      Weight_j = geometry->GetLS_Weight(iEdge, 1);
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        du = Solution_j[iVar] - Solution_i[iVar];
+        for (iDim = 0; iDim < nDim; iDim++) {
+          if (domain_i) node[iPoint]->AddGradient(iVar, iDim, Weight_i[iDim]*du);
+          if (domain_j) node[jPoint]->AddGradient(iVar, iDim, Weight_j[iDim]*du);
+        }
       }
     }
+    
+    Set_MPI_Solution_Gradient(geometry, config);
+    
+    config->Tock(tick, "CSolver::SetSolution_Gradient_LS", PROFILE_GRADIENT);
+    return;
   }
   
-  // D = Phi'*Aux
-  for (int i=0; i<2; i++) {
-    for (int j=0; j<2; j++) {
-      D[i][j] = 0;
-      for (int k=0; k<2; k++) {
-        D[i][j] += Phi[k][i]*Aux[k][j]; //PHI transpose
+  su2double **Cvector = new su2double* [nVar];
+  for (iVar = 0; iVar < nVar; iVar++)
+    Cvector[iVar] = new su2double [nDim];
+  
+  /*--- Loop over points of the grid ---*/
+  
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    
+    /*--- Set the value of the singular ---*/
+    singular = false;
+    
+    /*--- Get coordinates ---*/
+    
+    Coord_i = geometry->node[iPoint]->GetCoord();
+    
+    /*--- Get consevative solution ---*/
+    
+    Solution_i = node[iPoint]->GetSolution();
+    
+    /*--- Inizialization of variables ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Cvector[iVar][iDim] = 0.0;
+    
+    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0;
+    r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+
+    AD::StartPreacc();
+    AD::SetPreaccIn(Solution_i, nVar);
+    AD::SetPreaccIn(Coord_i, nDim);
+
+    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      Coord_j = geometry->node[jPoint]->GetCoord();
+      
+      Solution_j = node[jPoint]->GetSolution();
+
+      AD::SetPreaccIn(Coord_j, nDim);
+      AD::SetPreaccIn(Solution_j, nVar);
+
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      /*--- Sumations for entries of upper triangular matrix R ---*/
+      
+      if (weight != 0.0) {
+        
+        r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+        r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+        r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+        if (nDim == 3) {
+          r13   += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+          r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+          r33   += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+        }
+        
+        /*--- Entries of c:= transpose(A)*b ---*/
+        
+        for (iVar = 0; iVar < nVar; iVar++)
+          for (iDim = 0; iDim < nDim; iDim++)
+            Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/weight;
+      }
+      
+    }
+    
+    /*--- Entries of upper triangular matrix R ---*/
+    
+    if (r11 >= 0.0) r11 = sqrt(r11); else r11 = 0.0;
+    if (r11 != 0.0) r12 = r12/r11; else r12 = 0.0;
+    if (r22-r12*r12 >= 0.0) r22 = sqrt(r22-r12*r12); else r22 = 0.0;
+    
+    if (nDim == 3) {
+      if (r11 != 0.0) r13 = r13/r11; else r13 = 0.0;
+      if ((r22 != 0.0) && (r11*r22 != 0.0)) r23 = r23_a/r22 - r23_b*r12/(r11*r22); else r23 = 0.0;
+      if (r33-r23*r23-r13*r13 >= 0.0) r33 = sqrt(r33-r23*r23-r13*r13); else r33 = 0.0;
+    }
+    
+    /*--- Compute determinant ---*/
+    
+    if (nDim == 2) detR2 = (r11*r22)*(r11*r22);
+    else detR2 = (r11*r22*r33)*(r11*r22*r33);
+    
+    /*--- Detect singular matrices ---*/
+    
+    if (abs(detR2) <= EPS) { detR2 = 1.0; singular = true; }
+    
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+    
+    if (singular) {
+      for (iDim = 0; iDim < nDim; iDim++)
+        for (jDim = 0; jDim < nDim; jDim++)
+          Smatrix[iDim][jDim] = 0.0;
+    }
+    else {
+      if (nDim == 2) {
+        Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+        Smatrix[0][1] = -r11*r12/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = r11*r11/detR2;
       }
+      else {
+        z11 = r22*r33; z12 = -r12*r33; z13 = r12*r23-r13*r22;
+        z22 = r11*r33; z23 = -r11*r23; z33 = r11*r22;
+        Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+        Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+        Smatrix[0][2] = (z13*z33)/detR2;
+        Smatrix[1][0] = Smatrix[0][1];
+        Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+        Smatrix[1][2] = (z23*z33)/detR2;
+        Smatrix[2][0] = Smatrix[0][2];
+        Smatrix[2][1] = Smatrix[1][2];
+        Smatrix[2][2] = (z33*z33)/detR2;
+      }
+    }
+    
+    /*--- Computation of the gradient: S*c ---*/
+    
+    for (iVar = 0; iVar < nVar; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        product = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
+        node[iPoint]->SetGradient(iVar, iDim, product);
+      }
+    }
+
+    AD::SetPreaccOut(node[iPoint]->GetGradient(), nVar, nDim);
+    AD::EndPreacc();
+  }
+  
+  /*--- Deallocate memory ---*/
+  
+  for (iVar = 0; iVar < nVar; iVar++)
+    delete [] Cvector[iVar];
+  delete [] Cvector;
+  
+  /*--- Gradient MPI ---*/
+  
+  Set_MPI_Solution_Gradient(geometry, config);
+  
+  config->Tock(tick, "CSolver::SetSolution_Gradient_LS", PROFILE_GRADIENT);
+  
+}
+
+void CSolver::SetGridVel_Gradient(CGeometry *geometry, CConfig *config) {
+  unsigned short iDim, jDim, iVar, iNeigh;
+  unsigned long iPoint, jPoint;
+  su2double *Coord_i, *Coord_j, *Solution_i, *Solution_j, Smatrix[3][3],
+  r11, r12, r13, r22, r23, r23_a, r23_b, r33, weight, detR2, z11, z12, z13,
+  z22, z23, z33, product;
+  su2double **Cvector;
+  
+  /*--- Note that all nVar entries in this routine have been changed to nDim ---*/
+  Cvector = new su2double* [nDim];
+  for (iVar = 0; iVar < nDim; iVar++)
+    Cvector[iVar] = new su2double [nDim];
+  
+  /*--- Loop over points of the grid ---*/
+  for (iPoint = 0; iPoint < geometry->GetnPointDomain(); iPoint++) {
+    
+    Coord_i = geometry->node[iPoint]->GetCoord();
+    Solution_i = geometry->node[iPoint]->GetGridVel();
+    
+    /*--- Inizialization of variables ---*/
+    for (iVar = 0; iVar < nDim; iVar++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Cvector[iVar][iDim] = 0.0;
+    r11 = 0.0; r12 = 0.0; r13 = 0.0; r22 = 0.0; r23 = 0.0; r23_a = 0.0; r23_b = 0.0; r33 = 0.0;
+    
+    for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+      jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+      Coord_j = geometry->node[jPoint]->GetCoord();
+      Solution_j = geometry->node[jPoint]->GetGridVel();
+      
+      weight = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++)
+        weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+      
+      /*--- Sumations for entries of upper triangular matrix R ---*/
+      r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/(weight);
+      r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/(weight);
+      r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/(weight);
+      if (nDim == 3) {
+        r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/(weight);
+        r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/(weight);
+        r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/(weight);
+        r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/(weight);
+      }
+      
+      /*--- Entries of c:= transpose(A)*b ---*/
+      for (iVar = 0; iVar < nDim; iVar++)
+        for (iDim = 0; iDim < nDim; iDim++)
+          Cvector[iVar][iDim] += (Coord_j[iDim]-Coord_i[iDim])*(Solution_j[iVar]-Solution_i[iVar])/(weight);
+    }
+    
+    /*--- Entries of upper triangular matrix R ---*/
+    r11 = sqrt(r11);
+    r12 = r12/(r11);
+    r22 = sqrt(r22-r12*r12);
+    if (nDim == 3) {
+      r13 = r13/(r11);
+      r23 = r23_a/(r22) - r23_b*r12/(r11*r22);
+      r33 = sqrt(r33-r23*r23-r13*r13);
+    }
+    /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+    if (nDim == 2) {
+      detR2 = (r11*r22)*(r11*r22);
+      Smatrix[0][0] = (r12*r12+r22*r22)/(detR2);
+      Smatrix[0][1] = -r11*r12/(detR2);
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = r11*r11/(detR2);
+    }
+    else {
+      detR2 = (r11*r22*r33)*(r11*r22*r33);
+      z11 = r22*r33;
+      z12 = -r12*r33;
+      z13 = r12*r23-r13*r22;
+      z22 = r11*r33;
+      z23 = -r11*r23;
+      z33 = r11*r22;
+      Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/(detR2);
+      Smatrix[0][1] = (z12*z22+z13*z23)/(detR2);
+      Smatrix[0][2] = (z13*z33)/(detR2);
+      Smatrix[1][0] = Smatrix[0][1];
+      Smatrix[1][1] = (z22*z22+z23*z23)/(detR2);
+      Smatrix[1][2] = (z23*z33)/(detR2);
+      Smatrix[2][0] = Smatrix[0][2];
+      Smatrix[2][1] = Smatrix[1][2];
+      Smatrix[2][2] = (z33*z33)/(detR2);
+    }
+    /*--- Computation of the gradient: S*c ---*/
+    for (iVar = 0; iVar < nDim; iVar++) {
+      for (iDim = 0; iDim < nDim; iDim++) {
+        product = 0.0;
+        for (jDim = 0; jDim < nDim; jDim++)
+          product += Smatrix[iDim][jDim]*Cvector[iVar][jDim];
+        geometry->node[iPoint]->SetGridVel_Grad(iVar, iDim, product);
+      }
+    }
+  }
+  
+  /*--- Deallocate memory ---*/
+  for (iVar = 0; iVar < nDim; iVar++)
+    delete [] Cvector[iVar];
+  delete [] Cvector;
+  
+  /*--- Gradient MPI ---*/
+  // TO DO!!!
+  //Set_MPI_Solution_Gradient(geometry, config);
+  
+}
+
+void CSolver::SetAuxVar_Surface_Gradient(CGeometry *geometry, CConfig *config) {
+  
+  unsigned short iDim, jDim, iNeigh, iMarker, Boundary;
+  unsigned short nDim = geometry->GetnDim();
+  unsigned long iPoint, jPoint, iVertex;
+  su2double *Coord_i, *Coord_j, AuxVar_i, AuxVar_j;
+  su2double **Smatrix, *Cvector;
+  
+  Smatrix = new su2double* [nDim];
+  Cvector = new su2double [nDim];
+  for (iDim = 0; iDim < nDim; iDim++)
+    Smatrix[iDim] = new su2double [nDim];
+  
+  
+  /*--- Loop over boundary markers to select those for Euler or NS walls ---*/
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    Boundary = config->GetMarker_All_KindBC(iMarker);
+    switch (Boundary) {
+      case EULER_WALL:
+      case HEAT_FLUX:
+      case ISOTHERMAL:
+      case CHT_WALL_INTERFACE:
+        
+        /*--- Loop over points on the surface (Least-Squares approximation) ---*/
+        for (iVertex = 0; iVertex < geometry->nVertex[iMarker]; iVertex++) {
+          iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+          if (geometry->node[iPoint]->GetDomain()) {
+            Coord_i = geometry->node[iPoint]->GetCoord();
+            AuxVar_i = node[iPoint]->GetAuxVar();
+            
+            /*--- Inizialization of variables ---*/
+            for (iDim = 0; iDim < nDim; iDim++)
+              Cvector[iDim] = 0.0;
+            su2double r11 = 0.0, r12 = 0.0, r13 = 0.0, r22 = 0.0, r23 = 0.0, r23_a = 0.0, r23_b = 0.0, r33 = 0.0;
+            
+            for (iNeigh = 0; iNeigh < geometry->node[iPoint]->GetnPoint(); iNeigh++) {
+              jPoint = geometry->node[iPoint]->GetPoint(iNeigh);
+              Coord_j = geometry->node[jPoint]->GetCoord();
+              AuxVar_j = node[jPoint]->GetAuxVar();
+              
+              su2double weight = 0;
+              for (iDim = 0; iDim < nDim; iDim++)
+                weight += (Coord_j[iDim]-Coord_i[iDim])*(Coord_j[iDim]-Coord_i[iDim]);
+              
+              /*--- Sumations for entries of upper triangular matrix R ---*/
+              r11 += (Coord_j[0]-Coord_i[0])*(Coord_j[0]-Coord_i[0])/weight;
+              r12 += (Coord_j[0]-Coord_i[0])*(Coord_j[1]-Coord_i[1])/weight;
+              r22 += (Coord_j[1]-Coord_i[1])*(Coord_j[1]-Coord_i[1])/weight;
+              if (nDim == 3) {
+                r13 += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+                r23_a += (Coord_j[1]-Coord_i[1])*(Coord_j[2]-Coord_i[2])/weight;
+                r23_b += (Coord_j[0]-Coord_i[0])*(Coord_j[2]-Coord_i[2])/weight;
+                r33 += (Coord_j[2]-Coord_i[2])*(Coord_j[2]-Coord_i[2])/weight;
+              }
+              
+              /*--- Entries of c:= transpose(A)*b ---*/
+              for (iDim = 0; iDim < nDim; iDim++)
+                Cvector[iDim] += (Coord_j[iDim]-Coord_i[iDim])*(AuxVar_j-AuxVar_i)/weight;
+            }
+            
+            /*--- Entries of upper triangular matrix R ---*/
+            r11 = sqrt(r11);
+            r12 = r12/r11;
+            r22 = sqrt(r22-r12*r12);
+            if (nDim == 3) {
+              r13 = r13/r11;
+              r23 = r23_a/r22 - r23_b*r12/(r11*r22);
+              r33 = sqrt(r33-r23*r23-r13*r13);
+            }
+            /*--- S matrix := inv(R)*traspose(inv(R)) ---*/
+            if (nDim == 2) {
+              su2double detR2 = (r11*r22)*(r11*r22);
+              Smatrix[0][0] = (r12*r12+r22*r22)/detR2;
+              Smatrix[0][1] = -r11*r12/detR2;
+              Smatrix[1][0] = Smatrix[0][1];
+              Smatrix[1][1] = r11*r11/detR2;
+            }
+            else {
+              su2double detR2 = (r11*r22*r33)*(r11*r22*r33);
+              su2double z11, z12, z13, z22, z23, z33; // aux vars
+              z11 = r22*r33;
+              z12 = -r12*r33;
+              z13 = r12*r23-r13*r22;
+              z22 = r11*r33;
+              z23 = -r11*r23;
+              z33 = r11*r22;
+              Smatrix[0][0] = (z11*z11+z12*z12+z13*z13)/detR2;
+              Smatrix[0][1] = (z12*z22+z13*z23)/detR2;
+              Smatrix[0][2] = (z13*z33)/detR2;
+              Smatrix[1][0] = Smatrix[0][1];
+              Smatrix[1][1] = (z22*z22+z23*z23)/detR2;
+              Smatrix[1][2] = (z23*z33)/detR2;
+              Smatrix[2][0] = Smatrix[0][2];
+              Smatrix[2][1] = Smatrix[1][2];
+              Smatrix[2][2] = (z33*z33)/detR2;
+            }
+            /*--- Computation of the gradient: S*c ---*/
+            su2double product;
+            for (iDim = 0; iDim < nDim; iDim++) {
+              product = 0.0;
+              for (jDim = 0; jDim < nDim; jDim++)
+                product += Smatrix[iDim][jDim]*Cvector[jDim];
+              node[iPoint]->SetAuxVarGradient(iDim, product);
+            }
+          }
+        } /*--- End of loop over surface points ---*/
+        break;
+      default:
+        break;
+    }
+  }
+  
+  /*--- Memory deallocation ---*/
+  for (iDim = 0; iDim < nDim; iDim++)
+    delete [] Smatrix[iDim];
+  delete [] Cvector;
+  delete [] Smatrix;
+}
+
+void CSolver::SetEdge_Limiter(CGeometry *geometry, unsigned short val_kind, unsigned short val_nVar,
+                              bool val_primitive, const su2double *val_eps2) {
+  
+  if (nDim == 2) SetEdge_Limiter_Kernel<2>(geometry, val_kind, val_nVar, val_primitive, val_eps2);
+  else SetEdge_Limiter_Kernel<3>(geometry, val_kind, val_nVar, val_primitive, val_eps2);
+  
+}
+
+template<unsigned short NDIM>
+void CSolver::SetEdge_Limiter_Kernel(CGeometry *geometry, unsigned short val_kind, unsigned short val_nVar,
+                                     bool val_primitive, const su2double *val_eps2) {
+  
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iVar, iDim;
+  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j, *Limiter_i, *Limiter_j,
+  *Max_i, *Min_i, *Max_j, *Min_j, dm, dp, limiter, Edge_Vector[NDIM];
+  
+  const bool barth = (val_kind == BARTH_JESPERSEN);
+  
+  /*--- Projections of the gradients of points i and j on the edge ---*/
+  
+  vector<su2double> Projection(2*val_nVar, 0.0);
+  su2double *dm_i = &Projection[0], *dm_j = &Projection[val_nVar];
+  
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    
+    iPoint  = geometry->edge[iEdge]->GetNode(0);
+    jPoint  = geometry->edge[iEdge]->GetNode(1);
+    Coord_i = geometry->node[iPoint]->GetCoord();
+    Coord_j = geometry->node[jPoint]->GetCoord();
+    
+    if (val_primitive) {
+      Gradient_i = node[iPoint]->GetGradient_Primitive(); Limiter_i = node[iPoint]->GetLimiter_Primitive();
+      Gradient_j = node[jPoint]->GetGradient_Primitive(); Limiter_j = node[jPoint]->GetLimiter_Primitive();
+    }
+    else {
+      Gradient_i = node[iPoint]->GetGradient(); Limiter_i = node[iPoint]->GetLimiter();
+      Gradient_j = node[jPoint]->GetGradient(); Limiter_j = node[jPoint]->GetLimiter();
+    }
+    Max_i = node[iPoint]->GetSolution_Max(); Min_i = node[iPoint]->GetSolution_Min();
+    Max_j = node[jPoint]->GetSolution_Max(); Min_j = node[jPoint]->GetSolution_Min();
+    
+    AD::StartPreacc();
+    AD::SetPreaccIn(Gradient_i, val_nVar, NDIM);
+    AD::SetPreaccIn(Gradient_j, val_nVar, NDIM);
+    AD::SetPreaccIn(Coord_i, NDIM); AD::SetPreaccIn(Coord_j, NDIM);
+    AD::SetPreaccIn(Max_i, val_nVar); AD::SetPreaccIn(Min_i, val_nVar);
+    AD::SetPreaccIn(Max_j, val_nVar); AD::SetPreaccIn(Min_j, val_nVar);
+    if (!barth) AD::SetPreaccIn(val_eps2, val_nVar);
+    
+    /*--- Interface gradients, delta- (dm), of all the variables. The
+     projection of point j is the negated sum of the same products. ---*/
+    
+    for (iDim = 0; iDim < NDIM; iDim++)
+      Edge_Vector[iDim] = 0.5*(Coord_j[iDim]-Coord_i[iDim]);
+    
+    for (iVar = 0; iVar < val_nVar; iVar++) {
+      dm_i[iVar] = 0.0; dm_j[iVar] = 0.0;
+      for (iDim = 0; iDim < NDIM; iDim++) {
+        dm_i[iVar] += Edge_Vector[iDim]*Gradient_i[iVar][iDim];
+        dm_j[iVar] -= Edge_Vector[iDim]*Gradient_j[iVar][iDim];
+      }
+    }
+    
+    /*--- Limiter function of point i, delta+ (dp) from the bounds ---*/
+    
+    for (iVar = 0; iVar < val_nVar; iVar++) {
+      dm = dm_i[iVar];
+      dp = (dm > 0.0)? Max_i[iVar] : Min_i[iVar];
+      if (barth) limiter = (dm == 0.0)? 2.0 : dp/dm;
+      else limiter = ( dp*dp + 2.0*dp*dm + val_eps2[iVar] )/( dp*dp + dp*dm + 2.0*dm*dm + val_eps2[iVar]);
+      if (limiter < Limiter_i[iVar]) {
+        Limiter_i[iVar] = limiter;
+        AD::SetPreaccOut(Limiter_i[iVar]);
+      }
+    }
+    
+    /*--- Repeat for point j on the edge ---*/
+    
+    for (iVar = 0; iVar < val_nVar; iVar++) {
+      dm = dm_j[iVar];
+      dp = (dm > 0.0)? Max_j[iVar] : Min_j[iVar];
+      if (barth) limiter = (dm == 0.0)? 2.0 : dp/dm;
+      else limiter = ( dp*dp + 2.0*dp*dm + val_eps2[iVar] )/( dp*dp + dp*dm + 2.0*dm*dm + val_eps2[iVar]);
+      if (limiter < Limiter_j[iVar]) {
+        Limiter_j[iVar] = limiter;
+        AD::SetPreaccOut(Limiter_j[iVar]);
+      }
+    }
+    
+    AD::EndPreacc();
+    
+  }
+  
+}
+
+void CSolver::SetSolution_Limiter(CGeometry *geometry, CConfig *config) {
+  
+  unsigned long iEdge, iPoint, jPoint;
+  unsigned short iVar, iDim;
+  su2double **Gradient_i, **Gradient_j, *Coord_i, *Coord_j,
+  *Solution, *Solution_i, *Solution_j, *LocalMinSolution, *LocalMaxSolution,
+  *GlobalMinSolution, *GlobalMaxSolution, *Max_i, *Min_i, *Max_j, *Min_j, *Limiter,
+  dave, LimK, eps1, eps2, dm, dp, du, ds, y, limiter, SharpEdge_Distance;
+  
+  dave = config->GetRefElemLength();
+  LimK = config->GetVenkat_LimiterCoeff();
+  
+  if (config->GetKind_SlopeLimit() == NO_LIMITER) {
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        node[iPoint]->SetLimiter(iVar, 1.0);
+      }
+    }
+    
+  }
+  
+  else {
+    
+    /*--- Initialize solution max and solution min and the limiter in the entire domain --*/
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      for (iVar = 0; iVar < nVar; iVar++) {
+        node[iPoint]->SetSolution_Max(iVar, -EPS);
+        node[iPoint]->SetSolution_Min(iVar, EPS);
+        node[iPoint]->SetLimiter(iVar, 2.0);
+      }
+    }
+    
+    /*--- Establish bounds for Spekreijse monotonicity by finding max & min values of neighbor variables --*/
+    
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      
+      /*--- Point identification, Normal vector and area ---*/
+      
+      iPoint = geometry->edge[iEdge]->GetNode(0);
+      jPoint = geometry->edge[iEdge]->GetNode(1);
+      
+      /*--- Get the conserved variables and the bounds ---*/
+      
+      Solution_i = node[iPoint]->GetSolution();
+      Solution_j = node[jPoint]->GetSolution();
+      Max_i = node[iPoint]->GetSolution_Max(); Min_i = node[iPoint]->GetSolution_Min();
+      Max_j = node[jPoint]->GetSolution_Max(); Min_j = node[jPoint]->GetSolution_Min();
+      
+      /*--- Compute the maximum, and minimum values for nodes i & j ---*/
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        du = (Solution_j[iVar] - Solution_i[iVar]);
+        Min_i[iVar] = min(Min_i[iVar], du);
+        Max_i[iVar] = max(Max_i[iVar], du);
+        Min_j[iVar] = min(Min_j[iVar], -du);
+        Max_j[iVar] = max(Max_j[iVar], -du);
+      }
+      
+    }
+    
+  }
+  
+  /*--- Barth-Jespersen limiter with Venkatakrishnan modification ---*/
+  
+  if (config->GetKind_SlopeLimit_Flow() == BARTH_JESPERSEN) {
+    
+    SetEdge_Limiter(geometry, BARTH_JESPERSEN, nVar, false, NULL);
+
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      Limiter = node[iPoint]->GetLimiter();
+      for (iVar = 0; iVar < nVar; iVar++) {
+        y = Limiter[iVar];
+        Limiter[iVar] = (y*y + 2.0*y) / (y*y + y + 2.0);
+      }
+    }
+    
+  }
+
+  /*--- Venkatakrishnan limiter ---*/
+  
+  if ((config->GetKind_SlopeLimit() == VENKATAKRISHNAN) || (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG)) {
+    
+    /*--- Allocate memory for the max and min solution value --*/
+    
+    LocalMinSolution = new su2double [nVar]; GlobalMinSolution = new su2double [nVar];
+    LocalMaxSolution = new su2double [nVar]; GlobalMaxSolution = new su2double [nVar];
+    
+    /*--- Compute the max value and min value of the solution ---*/
+    
+    Solution = node[iPoint]->GetSolution();
+    for (iVar = 0; iVar < nVar; iVar++) {
+      LocalMinSolution[iVar] = Solution[iVar];
+      LocalMaxSolution[iVar] = Solution[iVar];
+    }
+    
+    for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+      
+      /*--- Get the solution variables ---*/
+      
+      Solution = node[iPoint]->GetSolution();
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        LocalMinSolution[iVar] = min (LocalMinSolution[iVar], Solution[iVar]);
+        LocalMaxSolution[iVar] = max (LocalMaxSolution[iVar], Solution[iVar]);
+      }
+      
+    }
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(LocalMinSolution, GlobalMinSolution, nVar, MPI_SU2DOUBLE, MPI_MIN, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(LocalMaxSolution, GlobalMaxSolution, nVar, MPI_SU2DOUBLE, MPI_MAX, MPI_COMM_WORLD);
+#else
+    for (iVar = 0; iVar < nVar; iVar++) {
+      GlobalMinSolution[iVar] = LocalMinSolution[iVar];
+      GlobalMaxSolution[iVar] = LocalMaxSolution[iVar];
+    }
+#endif
+    
+    /*--- The parameter of every variable is computed once, not per edge. ---*/
+    
+    vector<su2double> Eps2(nVar);
+    for (iVar = 0; iVar < nVar; iVar++) {
+      if (config->GetKind_SlopeLimit_Flow() == VENKATAKRISHNAN_WANG) {
+        eps1 = LimK * (GlobalMaxSolution[iVar] - GlobalMinSolution[iVar]);
+        Eps2[iVar] = eps1*eps1;
+      }
+      else {
+        eps1 = LimK*dave;
+        Eps2[iVar] = eps1*eps1*eps1;
+      }
+    }
+    
+    SetEdge_Limiter(geometry, VENKATAKRISHNAN, nVar, false, Eps2.data());
+    
+    delete [] LocalMinSolution; delete [] GlobalMinSolution;
+    delete [] LocalMaxSolution; delete [] GlobalMaxSolution;
+
+  }
+  
+  /*--- Sharp edges limiter ---*/
+  
+  if (config->GetKind_SlopeLimit() == SHARP_EDGES) {
+    
+    /*-- Get limiter parameters from the configuration file ---*/
+    
+    dave = config->GetRefElemLength();
+    LimK = config->GetVenkat_LimiterCoeff();
+    eps1 = LimK*dave;
+    eps2 = eps1*eps1*eps1;
+    
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      
+      iPoint     = geometry->edge[iEdge]->GetNode(0);
+      jPoint     = geometry->edge[iEdge]->GetNode(1);
+      Gradient_i = node[iPoint]->GetGradient();
+      Gradient_j = node[jPoint]->GetGradient();
+      Coord_i    = geometry->node[iPoint]->GetCoord();
+      Coord_j    = geometry->node[jPoint]->GetCoord();
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        
+        /*--- Calculate the interface left gradient, delta- (dm) ---*/
+        
+        dm = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+        
+        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+        
+        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+        else dp = node[iPoint]->GetSolution_Min(iVar);
+        
+        /*--- Compute the distance to a sharp edge ---*/
+        
+        SharpEdge_Distance = (geometry->node[iPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
+        ds = 0.0;
+        if (SharpEdge_Distance < -eps1) ds = 0.0;
+        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
+        if (SharpEdge_Distance > eps1) ds = 1.0;
+        
+        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+        
+        if (limiter < node[iPoint]->GetLimiter(iVar))
+          node[iPoint]->SetLimiter(iVar, limiter);
+        
+        /*-- Repeat for point j on the edge ---*/
+        
+        dm = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+        
+        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+        else dp = node[jPoint]->GetSolution_Min(iVar);
+        
+        /*--- Compute the distance to a sharp edge ---*/
+        
+        SharpEdge_Distance = (geometry->node[jPoint]->GetSharpEdge_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
+        ds = 0.0;
+        if (SharpEdge_Distance < -eps1) ds = 0.0;
+        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
+        if (SharpEdge_Distance > eps1) ds = 1.0;
+        
+        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+        
+        if (limiter < node[jPoint]->GetLimiter(iVar))
+          node[jPoint]->SetLimiter(iVar, limiter);
+        
+      }
+    }
+  }
+  
+  /*--- Sharp edges limiter ---*/
+  
+  if (config->GetKind_SlopeLimit() == WALL_DISTANCE) {
+    
+    /*-- Get limiter parameters from the configuration file ---*/
+    
+    dave = config->GetRefElemLength();
+    LimK = config->GetVenkat_LimiterCoeff();
+    eps1 = LimK*dave;
+    eps2 = eps1*eps1*eps1;
+    
+    for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+      
+      iPoint     = geometry->edge[iEdge]->GetNode(0);
+      jPoint     = geometry->edge[iEdge]->GetNode(1);
+      Gradient_i = node[iPoint]->GetGradient();
+      Gradient_j = node[jPoint]->GetGradient();
+      Coord_i    = geometry->node[iPoint]->GetCoord();
+      Coord_j    = geometry->node[jPoint]->GetCoord();
+      
+      for (iVar = 0; iVar < nVar; iVar++) {
+        
+        /*--- Calculate the interface left gradient, delta- (dm) ---*/
+        
+        dm = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          dm += 0.5*(Coord_j[iDim]-Coord_i[iDim])*Gradient_i[iVar][iDim];
+        
+        /*--- Calculate the interface right gradient, delta+ (dp) ---*/
+        
+        if ( dm > 0.0 ) dp = node[iPoint]->GetSolution_Max(iVar);
+        else dp = node[iPoint]->GetSolution_Min(iVar);
+        
+        /*--- Compute the distance to a sharp edge ---*/
+        
+        SharpEdge_Distance = (geometry->node[iPoint]->GetWall_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
+        ds = 0.0;
+        if (SharpEdge_Distance < -eps1) ds = 0.0;
+        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
+        if (SharpEdge_Distance > eps1) ds = 1.0;
+        
+        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+        
+        if (limiter < node[iPoint]->GetLimiter(iVar))
+          node[iPoint]->SetLimiter(iVar, limiter);
+        
+        /*-- Repeat for point j on the edge ---*/
+        
+        dm = 0.0;
+        for (iDim = 0; iDim < nDim; iDim++)
+          dm += 0.5*(Coord_i[iDim]-Coord_j[iDim])*Gradient_j[iVar][iDim];
+        
+        if ( dm > 0.0 ) dp = node[jPoint]->GetSolution_Max(iVar);
+        else dp = node[jPoint]->GetSolution_Min(iVar);
+        
+        /*--- Compute the distance to a sharp edge ---*/
+        
+        SharpEdge_Distance = (geometry->node[jPoint]->GetWall_Distance() - config->GetAdjSharp_LimiterCoeff()*eps1);
+        ds = 0.0;
+        if (SharpEdge_Distance < -eps1) ds = 0.0;
+        if (fabs(SharpEdge_Distance) <= eps1) ds = 0.5*(1.0+(SharpEdge_Distance/eps1)+(1.0/PI_NUMBER)*sin(PI_NUMBER*SharpEdge_Distance/eps1));
+        if (SharpEdge_Distance > eps1) ds = 1.0;
+        
+        limiter = ds * ( dp*dp + 2.0*dp*dm + eps2 )/( dp*dp + dp*dm + 2.0*dm*dm + eps2);
+        
+        if (limiter < node[jPoint]->GetLimiter(iVar))
+          node[jPoint]->SetLimiter(iVar, limiter);
+        
+      }
+    }
+  }
+
+  
+  /*--- Limiter MPI ---*/
+  
+  Set_MPI_Solution_Limiter(geometry, config);
+  
+}
+
+void CSolver::SetPressureLaplacian(CGeometry *geometry, CConfig *config, su2double *PressureLaplacian) {
+  
+  unsigned long Point = 0, iPoint = 0, jPoint = 0, iEdge, iVertex;
+  unsigned short iMarker, iVar;
+  su2double DualArea, Partial_Res, *Normal;
+  su2double **UxVar_Gradient, **UyVar_Gradient;
+  
+  UxVar_Gradient = new su2double* [geometry->GetnPoint()];
+  UyVar_Gradient = new su2double* [geometry->GetnPoint()];
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    UxVar_Gradient[iPoint] = new su2double [2];
+    UyVar_Gradient[iPoint] = new su2double [2];
+  }
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++)
+    for (iVar = 0; iVar < 2; iVar++) {
+      UxVar_Gradient[iPoint][iVar] = 0.0;
+      UyVar_Gradient[iPoint][iVar] = 0.0;
+    }
+  
+  /*---  Loop interior edges ---*/
+  
+  for (iEdge = 0; iEdge < geometry->GetnEdge(); iEdge++) {
+    iPoint = geometry->edge[iEdge]->GetNode(0);
+    jPoint = geometry->edge[iEdge]->GetNode(1);
+    Normal = geometry->edge[iEdge]->GetNormal();
+    
+    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(1) + node[jPoint]->GetSolution(1)) * Normal[0];
+    UxVar_Gradient[iPoint][0] += Partial_Res;
+    UxVar_Gradient[jPoint][0] -= Partial_Res;
+    
+    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(1) + node[jPoint]->GetSolution(1)) * Normal[1];
+    UxVar_Gradient[iPoint][1] += Partial_Res;
+    UxVar_Gradient[jPoint][1] -= Partial_Res;
+    
+    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(2) + node[jPoint]->GetSolution(2)) * Normal[0];
+    UyVar_Gradient[iPoint][0] += Partial_Res;
+    UyVar_Gradient[jPoint][0] -= Partial_Res;
+    
+    Partial_Res =  0.5 * ( node[iPoint]->GetSolution(2) + node[jPoint]->GetSolution(2)) * Normal[1];
+    UyVar_Gradient[iPoint][1] += Partial_Res;
+    UyVar_Gradient[jPoint][1] -= Partial_Res;
+    
+  }
+  
+  /*---  Loop boundary edges ---*/
+  
+  for (iMarker = 0; iMarker < geometry->GetnMarker(); iMarker++)
+    if (config->GetMarker_All_KindBC(iMarker) != INTERNAL_BOUNDARY)
+    for (iVertex = 0; iVertex < geometry->GetnVertex(iMarker); iVertex++) {
+      Point = geometry->vertex[iMarker][iVertex]->GetNode();
+      Normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+      
+      Partial_Res =  node[Point]->GetSolution(1) * Normal[0];
+      UxVar_Gradient[Point][0] -= Partial_Res;
+      
+      Partial_Res =  node[Point]->GetSolution(1) * Normal[1];
+      UxVar_Gradient[Point][1] -= Partial_Res;
+      
+      Partial_Res =  node[Point]->GetSolution(2) * Normal[0];
+      UyVar_Gradient[Point][0] -= Partial_Res;
+      
+      Partial_Res =  node[Point]->GetSolution(2) * Normal[1];
+      UyVar_Gradient[Point][1] -= Partial_Res;
+    }
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    DualArea = geometry->node[iPoint]->GetVolume();
+    PressureLaplacian[iPoint] = (UxVar_Gradient[iPoint][0]*UxVar_Gradient[iPoint][0] + UyVar_Gradient[iPoint][1]*UyVar_Gradient[iPoint][1] +
+                                 UxVar_Gradient[iPoint][1]*UyVar_Gradient[iPoint][0] + UxVar_Gradient[iPoint][0]*UyVar_Gradient[iPoint][1])/DualArea ;
+    
+  }
+  
+  for (iPoint = 0; iPoint < geometry->GetnPoint(); iPoint++) {
+    delete[] UxVar_Gradient[iPoint];
+    delete[] UyVar_Gradient[iPoint];
+  }
+  
+  delete[] UxVar_Gradient;
+  delete[] UyVar_Gradient;
+  
+}
+
+void CSolver::Gauss_Elimination(su2double** A, su2double* rhs, unsigned short nVar) {
+  
+  short iVar, jVar, kVar;
+  su2double weight, aux;
+  
+  if (nVar == 1)
+    rhs[0] /= A[0][0];
+  else {
+    
+    /*--- Transform system in Upper Matrix ---*/
+    
+    for (iVar = 1; iVar < (short)nVar; iVar++) {
+      for (jVar = 0; jVar < iVar; jVar++) {
+        weight = A[iVar][jVar]/A[jVar][jVar];
+        for (kVar = jVar; kVar < (short)nVar; kVar++)
+          A[iVar][kVar] -= weight*A[jVar][kVar];
+        rhs[iVar] -= weight*rhs[jVar];
+      }
+    }
+    
+    /*--- Backwards substitution ---*/
+    
+    rhs[nVar-1] = rhs[nVar-1]/A[nVar-1][nVar-1];
+    for (iVar = (short)nVar-2; iVar >= 0; iVar--) {
+      aux = 0;
+      for (jVar = iVar+1; jVar < (short)nVar; jVar++)
+        aux += A[iVar][jVar]*rhs[jVar];
+      rhs[iVar] = (rhs[iVar]-aux)/A[iVar][iVar];
+      if (iVar == 0) break;
+    }
+  }
+  
+}
+
+void CSolver::Aeroelastic(CSurfaceMovement *surface_movement, CGeometry *geometry, CConfig *config, unsigned long ExtIter) {
+  
+  /*--- Variables used for Aeroelastic case ---*/
+  
+  su2double Cl, Cd, Cn, Ct, Cm, Cn_rot;
+  su2double Alpha = config->GetAoA()*PI_NUMBER/180.0;
+  vector<su2double> structural_solution(4,0.0); //contains solution(displacements and rates) of typical section wing model.
+  
+  unsigned short iMarker, iMarker_Monitoring, Monitoring;
+  string Marker_Tag, Monitoring_Tag;
+  
+  /*--- Loop over markers and find the ones being monitored. ---*/
+  
+  for (iMarker = 0; iMarker < config->GetnMarker_All(); iMarker++) {
+    Monitoring = config->GetMarker_All_Monitoring(iMarker);
+    if (Monitoring == YES) {
+      
+      /*--- Find the particular marker being monitored and get the forces acting on it. ---*/
+      
+      for (iMarker_Monitoring = 0; iMarker_Monitoring < config->GetnMarker_Monitoring(); iMarker_Monitoring++) {
+        Monitoring_Tag = config->GetMarker_Monitoring_TagBound(iMarker_Monitoring);
+        Marker_Tag = config->GetMarker_All_TagBound(iMarker);
+        if (Marker_Tag == Monitoring_Tag) {
+          
+          Cl = GetSurface_CL(iMarker_Monitoring);
+          Cd = GetSurface_CD(iMarker_Monitoring);
+          
+          /*--- For typical section wing model want the force normal to the airfoil (in the direction of the spring) ---*/
+          Cn = Cl*cos(Alpha) + Cd*sin(Alpha);
+          Ct = -Cl*sin(Alpha) + Cd*cos(Alpha);
+          
+          Cm = GetSurface_CMz(iMarker_Monitoring);
+          
+          /*--- Calculate forces for the Typical Section Wing Model taking into account rotation ---*/
+          
+          /*--- Note that the calculation of the forces and the subsequent displacements ...
+           is only correct for the airfoil that starts at the 0 degree position ---*/
+          
+          if (config->GetKind_GridMovement(ZONE_0) == AEROELASTIC_RIGID_MOTION) {
+            su2double Omega, dt, psi;
+            dt = config->GetDelta_UnstTimeND();
+            Omega  = (config->GetRotation_Rate_Z(ZONE_0)/config->GetOmega_Ref());
+            psi = Omega*(dt*ExtIter);
+            
+            /*--- Correct for the airfoil starting position (This is hardcoded in here) ---*/
+            if (Monitoring_Tag == "Airfoil1") {
+              psi = psi + 0.0;
+            }
+            else if (Monitoring_Tag == "Airfoil2") {
+              psi = psi + 2.0/3.0*PI_NUMBER;
+            }
+            else if (Monitoring_Tag == "Airfoil3") {
+              psi = psi + 4.0/3.0*PI_NUMBER;
+            }
+            else
+              cout << "WARNING: There is a marker that we are monitoring that doesn't match the values hardcoded above!" << endl;
+            
+            cout << Monitoring_Tag << " position " << psi*180.0/PI_NUMBER << " degrees. " << endl;
+            
+            Cn_rot = Cn*cos(psi) - Ct*sin(psi); //Note the signs are different for accounting for the AOA.
+            Cn = Cn_rot;
+          }
+          
+          /*--- Solve the aeroelastic equations for the particular marker(surface) ---*/
+          
+          SolveTypicalSectionWingModel(geometry, Cn, Cm, config, iMarker_Monitoring, structural_solution);
+          
+          break;
+        }
+      }
+      
+      /*--- Compute the new surface node locations ---*/
+      surface_movement->AeroelasticDeform(geometry, config, ExtIter, iMarker, iMarker_Monitoring, structural_solution);
+      
+    }
+    
+  }
+  
+}
+
+void CSolver::SetUpTypicalSectionWingModel(vector<vector<su2double> >& Phi, vector<su2double>& omega, CConfig *config) {
+  
+  /*--- Retrieve values from the config file ---*/
+  su2double w_h = config->GetAeroelastic_Frequency_Plunge();
+  su2double w_a = config->GetAeroelastic_Frequency_Pitch();
+  su2double x_a = config->GetAeroelastic_CG_Location();
+  su2double r_a = sqrt(config->GetAeroelastic_Radius_Gyration_Squared());
+  su2double w = w_h/w_a;
+  
+  // Mass Matrix
+  vector<vector<su2double> > M(2,vector<su2double>(2,0.0));
+  M[0][0] = 1;
+  M[0][1] = x_a;
+  M[1][0] = x_a;
+  M[1][1] = r_a*r_a;
+  
+  // Stiffness Matrix
+  //  vector<vector<su2double> > K(2,vector<su2double>(2,0.0));
+  //  K[0][0] = (w_h/w_a)*(w_h/w_a);
+  //  K[0][1] = 0.0;
+  //  K[1][0] = 0.0;
+  //  K[1][1] = r_a*r_a;
+  
+  /* Eigenvector and Eigenvalue Matrices of the Generalized EigenValue Problem. */
+  
+  vector<vector<su2double> > Omega2(2,vector<su2double>(2,0.0));
+  su2double aux; // auxiliary variable
+  aux = sqrt(pow(r_a,2)*pow(w,4) - 2*pow(r_a,2)*pow(w,2) + pow(r_a,2) + 4*pow(x_a,2)*pow(w,2));
+  Phi[0][0] = (r_a * (r_a - r_a*pow(w,2) + aux)) / (2*x_a*pow(w, 2));
+  Phi[0][1] = (r_a * (r_a - r_a*pow(w,2) - aux)) / (2*x_a*pow(w, 2));
+  Phi[1][0] = 1.0;
+  Phi[1][1] = 1.0;
+  
+  Omega2[0][0] = (r_a * (r_a + r_a*pow(w,2) - aux)) / (2*(pow(r_a, 2) - pow(x_a, 2)));
+  Omega2[0][1] = 0;
+  Omega2[1][0] = 0;
+  Omega2[1][1] = (r_a * (r_a + r_a*pow(w,2) + aux)) / (2*(pow(r_a, 2) - pow(x_a, 2)));
+  
+  /* Nondimesionalize the Eigenvectors such that Phi'*M*Phi = I and PHI'*K*PHI = Omega */
+  // Phi'*M*Phi = D
+  // D^(-1/2)*Phi'*M*Phi*D^(-1/2) = D^(-1/2)*D^(1/2)*D^(1/2)*D^(-1/2) = I,  D^(-1/2) = inv(sqrt(D))
+  // Phi = Phi*D^(-1/2)
+  
+  vector<vector<su2double> > Aux(2,vector<su2double>(2,0.0));
+  vector<vector<su2double> > D(2,vector<su2double>(2,0.0));
+  // Aux = M*Phi
+  for (int i=0; i<2; i++) {
+    for (int j=0; j<2; j++) {
+      Aux[i][j] = 0;
+      for (int k=0; k<2; k++) {
+        Aux[i][j] += M[i][k]*Phi[k][j];
+      }
+    }
+  }
+  
+  // D = Phi'*Aux
+  for (int i=0; i<2; i++) {
+    for (int j=0; j<2; j++) {
+      D[i][j] = 0;
+      for (int k=0; k<2; k++) {
+        D[i][j] += Phi[k][i]*Aux[k][j]; //PHI transpose
+      }
+    }
+  }
+  
+  //Modify the first column
+  Phi[0][0] = Phi[0][0] * 1/sqrt(D[0][0]);
+  Phi[1][0] = Phi[1][0] * 1/sqrt(D[0][0]);
+  //Modify the second column
+  Phi[0][1] = Phi[0][1] * 1/sqrt(D[1][1]);
+  Phi[1][1] = Phi[1][1] * 1/sqrt(D[1][1]);
+  
+  // Sqrt of the eigenvalues (frequency of vibration of the modes)
+  omega[0] = sqrt(Omega2[0][0]);
+  omega[1] = sqrt(Omega2[1][1]);
+  
+}
+
+void CSolver::SolveTypicalSectionWingModel(CGeometry *geometry, su2double Cl, su2double Cm, CConfig *config, unsigned short iMarker, vector<su2double>& displacements) {
+  
+  /*--- The aeroelastic model solved in this routine is the typical section wing model
+   The details of the implementation are similar to those found in J.J. Alonso 
+   "Fully-Implicit Time-Marching Aeroelastic Solutions" 1994. ---*/
+  
+  /*--- Retrieve values from the config file ---*/
+  su2double w_alpha = config->GetAeroelastic_Frequency_Pitch();
+  su2double vf      = config->GetAeroelastic_Flutter_Speed_Index();
+  su2double b       = config->GetLength_Reynolds()/2.0; // airfoil semichord, Reynolds length is by defaul 1.0
+  su2double dt      = config->GetDelta_UnstTimeND();
+  dt = dt*w_alpha; //Non-dimensionalize the structural time.
+  
+  /*--- Structural Equation damping ---*/
+  vector<su2double> xi(2,0.0);
+  
+  /*--- Eigenvectors and Eigenvalues of the Generalized EigenValue Problem. ---*/
+  vector<vector<su2double> > Phi(2,vector<su2double>(2,0.0));   // generalized eigenvectors.
+  vector<su2double> w(2,0.0);        // sqrt of the generalized eigenvalues (frequency of vibration of the modes).
+  SetUpTypicalSectionWingModel(Phi, w, config);
+  
+  /*--- Solving the Decoupled Aeroelastic Problem with second order time discretization Eq (9) ---*/
+  
+  /*--- Solution variables description. //x[j][i], j-entry, i-equation. // Time (n+1)->np1, n->n, (n-1)->n1 ---*/
+  vector<vector<su2double> > x_np1(2,vector<su2double>(2,0.0));
+  
+  /*--- Values from previous movement of spring at true time step n+1
+   We use this values because we are solving for delta changes not absolute changes ---*/
+  vector<vector<su2double> > x_np1_old = config->GetAeroelastic_np1(iMarker);
+  
+  /*--- Values at previous timesteps. ---*/
+  vector<vector<su2double> > x_n = config->GetAeroelastic_n(iMarker);
+  vector<vector<su2double> > x_n1 = config->GetAeroelastic_n1(iMarker);
+  
+  /*--- Set up of variables used to solve the structural problem. ---*/
+  vector<su2double> f_tilde(2,0.0);
+  vector<vector<su2double> > A_inv(2,vector<su2double>(2,0.0));
+  su2double detA;
+  su2double s1, s2;
+  vector<su2double> rhs(2,0.0); //right hand side
+  vector<su2double> eta(2,0.0);
+  vector<su2double> eta_dot(2,0.0);
+  
+  /*--- Forcing Term ---*/
+  su2double cons = vf*vf/PI_NUMBER;
+  vector<su2double> f(2,0.0);
+  f[0] = cons*(-Cl);
+  f[1] = cons*(2*-Cm);
+  
+  //f_tilde = Phi'*f
+  for (int i=0; i<2; i++) {
+    f_tilde[i] = 0;
+    for (int k=0; k<2; k++) {
+      f_tilde[i] += Phi[k][i]*f[k]; //PHI transpose
+    }
+  }
+  
+  /*--- solve each decoupled equation (The inverse of the 2x2 matrix is provided) ---*/
+  for (int i=0; i<2; i++) {
+    /* Matrix Inverse */
+    detA = 9.0/(4.0*dt*dt) + 3*w[i]*xi[i]/(dt) + w[i]*w[i];
+    A_inv[0][0] = 1/detA * (3/(2.0*dt) + 2*xi[i]*w[i]);
+    A_inv[0][1] = 1/detA * 1;
+    A_inv[1][0] = 1/detA * -w[i]*w[i];
+    A_inv[1][1] = 1/detA * 3/(2.0*dt);
+    
+    /* Source Terms from previous iterations */
+    s1 = (-4*x_n[0][i] + x_n1[0][i])/(2.0*dt);
+    s2 = (-4*x_n[1][i] + x_n1[1][i])/(2.0*dt);
+    
+    /* Problem Right Hand Side */
+    rhs[0] = -s1;
+    rhs[1] = f_tilde[i]-s2;
+    
+    /* Solve the equations */
+    x_np1[0][i] = A_inv[0][0]*rhs[0] + A_inv[0][1]*rhs[1];
+    x_np1[1][i] = A_inv[1][0]*rhs[0] + A_inv[1][1]*rhs[1];
+    
+    eta[i] = x_np1[0][i]-x_np1_old[0][i];  // For displacements, the change(deltas) is used.
+    eta_dot[i] = x_np1[1][i]; // For velocities, absolute values are used.
+  }
+  
+  /*--- Transform back from the generalized coordinates to get the actual displacements in plunge and pitch  q = Phi*eta ---*/
+  vector<su2double> q(2,0.0);
+  vector<su2double> q_dot(2,0.0);
+  for (int i=0; i<2; i++) {
+    q[i] = 0;
+    q_dot[i] = 0;
+    for (int k=0; k<2; k++) {
+      q[i] += Phi[i][k]*eta[k];
+      q_dot[i] += Phi[i][k]*eta_dot[k];
+    }
+  }
+  
+  su2double dh = b*q[0];
+  su2double dalpha = q[1];
+  
+  su2double h_dot = w_alpha*b*q_dot[0];  //The w_a brings it back to actual time.
+  su2double alpha_dot = w_alpha*q_dot[1];
+  
+  /*--- Set the solution of the structural equations ---*/
+  displacements[0] = dh;
+  displacements[1] = dalpha;
+  displacements[2] = h_dot;
+  displacements[3] = alpha_dot;
+  
+  /*--- Calculate the total plunge and total pitch displacements for the unsteady step by summing the displacement at each sudo time step ---*/
+  su2double pitch, plunge;
+  pitch = config->GetAeroelastic_pitch(iMarker);
+  plunge = config->GetAeroelastic_plunge(iMarker);
+  
+  config->SetAeroelastic_pitch(iMarker , pitch+dalpha);
+  config->SetAeroelastic_plunge(iMarker , plunge+dh/b);
+  
+  /*--- Set the Aeroelastic solution at time n+1. This gets update every sudo time step
+   and after convering the sudo time step the solution at n+1 get moved to the solution at n
+   in SetDualTime_Solver method ---*/
+  
+  config->SetAeroelastic_np1(iMarker, x_np1);
+  
+}
+
+void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
+
+  /*--- This function is intended for dual time simulations ---*/
+
+  unsigned long index;
+
+  int Unst_RestartIter;
+  ifstream restart_file_n;
+  unsigned short iZone = config->GetiZone();
+  unsigned short nZone = geometry->GetnZone();
+  string filename = config->GetSolution_FlowFileName();
+  string filename_n;
+
+  /*--- Auxiliary vector for storing the coordinates ---*/
+  su2double *Coord;
+  Coord = new su2double[nDim];
+
+  /*--- Variables for reading the restart files ---*/
+  string text_line;
+  long iPoint_Local;
+  unsigned long iPoint_Global_Local = 0, iPoint_Global = 0;
+  unsigned short rbuf_NotMatching, sbuf_NotMatching;
+
+  /*--- Multizone problems require the number of the zone to be appended. ---*/
+
+  if (nZone > 1)
+    filename = config->GetMultizone_FileName(filename, iZone);
+
+  /*--- First, we load the restart file for time n ---*/
+
+  /*-------------------------------------------------------------------------------------------*/
+
+  /*--- Modify file name for an unsteady restart ---*/
+  Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-1;
+  filename_n = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+
+  /*--- Open the restart file, throw an error if this fails. ---*/
+
+  restart_file_n.open(filename_n.data(), ios::in);
+  if (restart_file_n.fail()) {
+    SU2_MPI::Error(string("There is no flow restart file ") + filename_n, CURRENT_FUNCTION);
+  }
+
+  /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
+  iPoint_Global_Local = 0; iPoint_Global = 0;
+
+  /*--- Read all lines in the restart file ---*/
+  /*--- The first line is the header ---*/
+
+  getline (restart_file_n, text_line);
+
+  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+    
+    getline (restart_file_n, text_line);
+    
+    istringstream point_line(text_line);
+
+    /*--- Retrieve local index. If this node from the restart file lives
+     on the current processor, we will load and instantiate the vars. ---*/
+
+    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+
+    if (iPoint_Local > -1) {
+
+      if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
+      if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+
+      geometry->node[iPoint_Local]->SetCoord_n(Coord);
+
+      iPoint_Global_Local++;
+    }
+  }
+
+  /*--- Detect a wrong solution file ---*/
+
+  rbuf_NotMatching = 0; sbuf_NotMatching = 0;
+
+  if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+
+#ifndef HAVE_MPI
+  rbuf_NotMatching = sbuf_NotMatching;
+#else
+  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+  if (rbuf_NotMatching != 0) {
+    SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
+                   string("It could be empty lines at the end of the file."), CURRENT_FUNCTION);
+  }
+
+  /*--- Close the restart file ---*/
+
+  restart_file_n.close();
+
+  /*-------------------------------------------------------------------------------------------*/
+  /*-------------------------------------------------------------------------------------------*/
+
+  /*--- Now, we load the restart file for time n-1, if the simulation is 2nd Order ---*/
+
+  if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) {
+
+    ifstream restart_file_n1;
+    string filename_n1;
+
+    /*--- Modify file name for an unsteady restart ---*/
+    Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-2;
+    filename_n1 = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+
+    /*--- Open the restart file, throw an error if this fails. ---*/
+
+    restart_file_n.open(filename_n1.data(), ios::in);
+    if (restart_file_n.fail()) {
+        SU2_MPI::Error(string("There is no flow restart file ") + filename_n1, CURRENT_FUNCTION);
+
+    }
+
+    /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
+    iPoint_Global_Local = 0; iPoint_Global = 0;
+
+    /*--- Read all lines in the restart file ---*/
+    /*--- The first line is the header ---*/
+
+    getline (restart_file_n, text_line);
+
+    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+      
+      getline (restart_file_n, text_line);
+      
+      istringstream point_line(text_line);
+
+      /*--- Retrieve local index. If this node from the restart file lives
+       on the current processor, we will load and instantiate the vars. ---*/
+
+      iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+
+      if (iPoint_Local > -1) {
+
+        if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
+        if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+
+        geometry->node[iPoint_Local]->SetCoord_n1(Coord);
+
+        iPoint_Global_Local++;
+      }
+
+    }
+
+    /*--- Detect a wrong solution file ---*/
+
+    rbuf_NotMatching = 0; sbuf_NotMatching = 0;
+
+    if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+
+#ifndef HAVE_MPI
+    rbuf_NotMatching = sbuf_NotMatching;
+#else
+    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
+#endif
+    if (rbuf_NotMatching != 0) {
+      SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
+                     string("It could be empty lines at the end of the file."), CURRENT_FUNCTION);
+    }
+
+    /*--- Close the restart file ---*/
+
+    restart_file_n1.close();
+
+  }
+
+  /*--- It's necessary to communicate this information ---*/
+
+  geometry->Set_MPI_OldCoord(config);
+  
+  delete [] Coord;
+
+}
+
+void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename) {
+
+  ifstream restart_file;
+  string text_line, Tag;
+  unsigned short iVar;
+  long index, iPoint_Local = 0; unsigned long iPoint_Global = 0;
+  int counter = 0;
+  config->fields.clear();
+
+  Restart_Vars = new int[5];
+
+  if (config->GetRestart_Interpolate()) {
+    SU2_MPI::Error("RESTART_INTERPOLATE requires binary restart files (READ_BINARY_RESTART= YES).", CURRENT_FUNCTION);
+  }
+
+  /*--- First, check that this is not a binary restart file. ---*/
+
+  char fname[100];
+  strcpy(fname, val_filename.c_str());
+  int magic_number;
+
+#ifndef HAVE_MPI
+
+  /*--- Serial binary input. ---*/
+
+  FILE *fhw;
+  fhw = fopen(fname,"rb");
+  size_t ret;
+
+  /*--- Error check for opening the file. ---*/
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+  }
+
+  /*--- Attempt to read the first int, which should be our magic number. ---*/
+
+  ret = fread(&magic_number, sizeof(int), 1, fhw);
+  if (ret != 1) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
+
+  if ((magic_number == 535532) || (magic_number == 535533)) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  }
+
+  fclose(fhw);
+
+#else
+
+  /*--- Parallel binary input using MPI I/O. ---*/
+
+  MPI_File fhw;
+  int ierr;
+
+  /*--- All ranks open the file using MPI. ---*/
+
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+
+  /*--- Error check opening the file. ---*/
+
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+  }
+
+  /*--- Have the master attempt to read the magic number. ---*/
+
+  if (rank == MASTER_NODE)
+    MPI_File_read(fhw, &magic_number, 1, MPI_INT, MPI_STATUS_IGNORE);
+
+  /*--- Broadcast the number of variables to all procs and store clearly. ---*/
+
+  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
+
+  if ((magic_number == 535532) || (magic_number == 535533)) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  }
+
+  MPI_File_close(&fhw);
+
+#endif
+
+  /*--- Open the restart file ---*/
+
+  restart_file.open(val_filename.data(), ios::in);
+
+  /*--- In case there is no restart file ---*/
+
+  if (restart_file.fail()) {
+    SU2_MPI::Error(string("SU2 ASCII solution file  ") + string(fname) + string(" not found."), CURRENT_FUNCTION);
+  }
+
+  /*--- Identify the number of fields (and names) in the restart file ---*/
+
+  getline (restart_file, text_line);
+  stringstream ss(text_line);
+  while (ss >> Tag) {
+    config->fields.push_back(Tag);
+    if (ss.peek() == ',') ss.ignore();
+  }
+
+  /*--- Set the number of variables, one per field in the
+   restart file (without including the PointID) ---*/
+
+  Restart_Vars[1] = (int)config->fields.size() - 1;
+
+  /*--- Allocate memory for the restart data. ---*/
+
+  Restart_Data = new passivedouble[Restart_Vars[1]*geometry->GetnPointDomain()];
+
+  /*--- Read all lines in the restart file and extract data. ---*/
+
+  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+
+    getline (restart_file, text_line);
+
+    istringstream point_line(text_line);
+
+    /*--- Retrieve local index. If this node from the restart file lives
+     on the current processor, we will load and instantiate the vars. ---*/
+
+    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+
+    if (iPoint_Local > -1) {
+
+      /*--- The PointID is not stored --*/
+
+      point_line >> index;
+
+      /*--- Store the solution (starting with node coordinates) --*/
+
+      for (iVar = 0; iVar < Restart_Vars[1]; iVar++)
+        point_line >> Restart_Data[counter*Restart_Vars[1] + iVar];
+
+      /*--- Increment our local point counter. ---*/
+
+      counter++;
+
     }
   }
-  
-  //Modify the first column
-  Phi[0][0] = Phi[0][0] * 1/sqrt(D[0][0]);
-  Phi[1][0] = Phi[1][0] * 1/sqrt(D[0][0]);
-  //Modify the second column
-  Phi[0][1] = Phi[0][1] * 1/sqrt(D[1][1]);
-  Phi[1][1] = Phi[1][1] * 1/sqrt(D[1][1]);
-  
-  // Sqrt of the eigenvalues (frequency of vibration of the modes)
-  omega[0] = sqrt(Omega2[0][0]);
-  omega[1] = sqrt(Omega2[1][1]);
-  
+
 }
 
-void CSolver::SolveTypicalSectionWingModel(CGeometry *geometry, su2double Cl, su2double Cm, CConfig *config, unsigned short iMarker, vector<su2double>& displacements) {
-  
-  /*--- The aeroelastic model solved in this routine is the typical section wing model
-   The details of the implementation are similar to those found in J.J. Alonso 
-   "Fully-Implicit Time-Marching Aeroelastic Solutions" 1994. ---*/
-  
-  /*--- Retrieve values from the config file ---*/
-  su2double w_alpha = config->GetAeroelastic_Frequency_Pitch();
-  su2double vf      = config->GetAeroelastic_Flutter_Speed_Index();
-  su2double b       = config->GetLength_Reynolds()/2.0; // airfoil semichord, Reynolds length is by defaul 1.0
-  su2double dt      = config->GetDelta_UnstTimeND();
-  dt = dt*w_alpha; //Non-dimensionalize the structural time.
-  
-  /*--- Structural Equation damping ---*/
-  vector<su2double> xi(2,0.0);
-  
-  /*--- Eigenvectors and Eigenvalues of the Generalized EigenValue Problem. ---*/
-  vector<vector<su2double> > Phi(2,vector<su2double>(2,0.0));   // generalized eigenvectors.
-  vector<su2double> w(2,0.0);        // sqrt of the generalized eigenvalues (frequency of vibration of the modes).
-  SetUpTypicalSectionWingModel(Phi, w, config);
-  
-  /*--- Solving the Decoupled Aeroelastic Problem with second order time discretization Eq (9) ---*/
-  
-  /*--- Solution variables description. //x[j][i], j-entry, i-equation. // Time (n+1)->np1, n->n, (n-1)->n1 ---*/
-  vector<vector<su2double> > x_np1(2,vector<su2double>(2,0.0));
-  
-  /*--- Values from previous movement of spring at true time step n+1
-   We use this values because we are solving for delta changes not absolute changes ---*/
-  vector<vector<su2double> > x_np1_old = config->GetAeroelastic_np1(iMarker);
-  
-  /*--- Values at previous timesteps. ---*/
-  vector<vector<su2double> > x_n = config->GetAeroelastic_n(iMarker);
-  vector<vector<su2double> > x_n1 = config->GetAeroelastic_n1(iMarker);
-  
-  /*--- Set up of variables used to solve the structural problem. ---*/
-  vector<su2double> f_tilde(2,0.0);
-  vector<vector<su2double> > A_inv(2,vector<su2double>(2,0.0));
-  su2double detA;
-  su2double s1, s2;
-  vector<su2double> rhs(2,0.0); //right hand side
-  vector<su2double> eta(2,0.0);
-  vector<su2double> eta_dot(2,0.0);
-  
-  /*--- Forcing Term ---*/
-  su2double cons = vf*vf/PI_NUMBER;
-  vector<su2double> f(2,0.0);
-  f[0] = cons*(-Cl);
-  f[1] = cons*(2*-Cm);
-  
-  //f_tilde = Phi'*f
-  for (int i=0; i<2; i++) {
-    f_tilde[i] = 0;
-    for (int k=0; k<2; k++) {
-      f_tilde[i] += Phi[k][i]*f[k]; //PHI transpose
-    }
-  }
-  
-  /*--- solve each decoupled equation (The inverse of the 2x2 matrix is provided) ---*/
-  for (int i=0; i<2; i++) {
-    /* Matrix Inverse */
-    detA = 9.0/(4.0*dt*dt) + 3*w[i]*xi[i]/(dt) + w[i]*w[i];
-    A_inv[0][0] = 1/detA * (3/(2.0*dt) + 2*xi[i]*w[i]);
-    A_inv[0][1] = 1/detA * 1;
-    A_inv[1][0] = 1/detA * -w[i]*w[i];
-    A_inv[1][1] = 1/detA * 3/(2.0*dt);
-    
-    /* Source Terms from previous iterations */
-    s1 = (-4*x_n[0][i] + x_n1[0][i])/(2.0*dt);
-    s2 = (-4*x_n[1][i] + x_n1[1][i])/(2.0*dt);
-    
-    /* Problem Right Hand Side */
-    rhs[0] = -s1;
-    rhs[1] = f_tilde[i]-s2;
-    
-    /* Solve the equations */
-    x_np1[0][i] = A_inv[0][0]*rhs[0] + A_inv[0][1]*rhs[1];
-    x_np1[1][i] = A_inv[1][0]*rhs[0] + A_inv[1][1]*rhs[1];
-    
-    eta[i] = x_np1[0][i]-x_np1_old[0][i];  // For displacements, the change(deltas) is used.
-    eta_dot[i] = x_np1[1][i]; // For velocities, absolute values are used.
+void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
+
+  char str_buf[CGNS_STRING_SIZE], fname[100];
+  unsigned short iVar;
+  strcpy(fname, val_filename.c_str());
+  int nRestart_Vars = 5, nFields;
+  Restart_Vars = new int[5];
+  config->fields.clear();
+
+#ifndef HAVE_MPI
+
+  /*--- Serial binary input. ---*/
+
+  FILE *fhw;
+  fhw = fopen(fname,"rb");
+  size_t ret;
+
+  /*--- Error check for opening the file. ---*/
+
+  if (!fhw) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
   }
-  
-  /*--- Transform back from the generalized coordinates to get the actual displacements in plunge and pitch  q = Phi*eta ---*/
-  vector<su2double> q(2,0.0);
-  vector<su2double> q_dot(2,0.0);
-  for (int i=0; i<2; i++) {
-    q[i] = 0;
-    q_dot[i] = 0;
-    for (int k=0; k<2; k++) {
-      q[i] += Phi[i][k]*eta[k];
-      q_dot[i] += Phi[i][k]*eta_dot[k];
-    }
+
+  /*--- First, read the number of variables and points. ---*/
+
+  ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+  if (ret != (unsigned long)nRestart_Vars) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
   }
-  
-  su2double dh = b*q[0];
-  su2double dalpha = q[1];
-  
-  su2double h_dot = w_alpha*b*q_dot[0];  //The w_a brings it back to actual time.
-  su2double alpha_dot = w_alpha*q_dot[1];
-  
-  /*--- Set the solution of the structural equations ---*/
-  displacements[0] = dh;
-  displacements[1] = dalpha;
-  displacements[2] = h_dot;
-  displacements[3] = alpha_dot;
-  
-  /*--- Calculate the total plunge and total pitch displacements for the unsteady step by summing the displacement at each sudo time step ---*/
-  su2double pitch, plunge;
-  pitch = config->GetAeroelastic_pitch(iMarker);
-  plunge = config->GetAeroelastic_plunge(iMarker);
-  
-  config->SetAeroelastic_pitch(iMarker , pitch+dalpha);
-  config->SetAeroelastic_plunge(iMarker , plunge+dh/b);
-  
-  /*--- Set the Aeroelastic solution at time n+1. This gets update every sudo time step
-   and after convering the sudo time step the solution at n+1 get moved to the solution at n
-   in SetDualTime_Solver method ---*/
-  
-  config->SetAeroelastic_np1(iMarker, x_np1);
-  
-}
 
-void CSolver::Restart_OldGeometry(CGeometry *geometry, CConfig *config) {
+  /*--- Compact restart files are expanded by a dedicated reader. ---*/
 
-  /*--- This function is intended for dual time simulations ---*/
+  if (Restart_Vars[0] == 535533) {
+    fclose(fhw);
+    Read_SU2_Restart_Compact(geometry, config, val_filename);
+    return;
+  }
 
-  unsigned long index;
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
 
-  int Unst_RestartIter;
-  ifstream restart_file_n;
-  unsigned short iZone = config->GetiZone();
-  unsigned short nZone = geometry->GetnZone();
-  string filename = config->GetSolution_FlowFileName();
-  string filename_n;
+  if (Restart_Vars[0] != 535532) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  }
 
-  /*--- Auxiliary vector for storing the coordinates ---*/
-  su2double *Coord;
-  Coord = new su2double[nDim];
+  /*--- Store the number of fields to be read for clarity. ---*/
 
-  /*--- Variables for reading the restart files ---*/
-  string text_line;
-  long iPoint_Local;
-  unsigned long iPoint_Global_Local = 0, iPoint_Global = 0;
-  unsigned short rbuf_NotMatching, sbuf_NotMatching;
+  nFields = Restart_Vars[1];
 
-  /*--- Multizone problems require the number of the zone to be appended. ---*/
+  /*--- Read the variable names from the file. Note that we are adopting a
+   fixed length of 33 for the string length to match with CGNS. This is
+   needed for when we read the strings later. We pad the beginning of the
+   variable string vector with the Point_ID tag that wasn't written. ---*/
 
-  if (nZone > 1)
-    filename = config->GetMultizone_FileName(filename, iZone);
+  config->fields.push_back("Point_ID");
+  for (iVar = 0; iVar < nFields; iVar++) {
+    ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
+    if (ret != (unsigned long)CGNS_STRING_SIZE) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    config->fields.push_back(str_buf);
+  }
 
-  /*--- First, we load the restart file for time n ---*/
+  /*--- A restart of a different mesh is read entirely and interpolated. ---*/
 
-  /*-------------------------------------------------------------------------------------------*/
+  if (config->GetRestart_Interpolate()) {
+    unsigned long nPoint_File = Restart_Vars[2];
+    passivedouble *Read_Data = new passivedouble[max(nFields*nPoint_File, (unsigned long)1)];
+    ret = fread(Read_Data, sizeof(passivedouble), nFields*nPoint_File, fhw);
+    if (ret != (unsigned long)nFields*nPoint_File) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    fclose(fhw);
+    Interpolate_Restart_Data(geometry, config, Read_Data, nFields, nPoint_File, val_filename);
+    delete [] Read_Data;
+    return;
+  }
 
-  /*--- Modify file name for an unsteady restart ---*/
-  Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-1;
-  filename_n = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
 
-  /*--- Open the restart file, throw an error if this fails. ---*/
+  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
 
-  restart_file_n.open(filename_n.data(), ios::in);
-  if (restart_file_n.fail()) {
-    SU2_MPI::Error(string("There is no flow restart file ") + filename_n, CURRENT_FUNCTION);
+  /*--- Read in the data for the restart at all local points. ---*/
+
+  ret = fread(Restart_Data, sizeof(passivedouble), nFields*geometry->GetnPointDomain(), fhw);
+  if (ret != (unsigned long)nFields*geometry->GetnPointDomain()) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
   }
 
-  /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
-  iPoint_Global_Local = 0; iPoint_Global = 0;
+  /*--- Close the file. ---*/
 
-  /*--- Read all lines in the restart file ---*/
-  /*--- The first line is the header ---*/
+  fclose(fhw);
 
-  getline (restart_file_n, text_line);
+#else
 
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    
-    getline (restart_file_n, text_line);
-    
-    istringstream point_line(text_line);
+  /*--- Parallel binary input using MPI I/O. ---*/
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype etype;
+  MPI_Offset disp;
+  unsigned long index, iChar;
+  string field_buf;
 
-    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+  int ierr;
 
-    if (iPoint_Local > -1) {
+  /*--- All ranks open the file using MPI. ---*/
 
-      if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
-      if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
 
-      geometry->node[iPoint_Local]->SetCoord_n(Coord);
+  /*--- Error check opening the file. ---*/
 
-      iPoint_Global_Local++;
-    }
+  if (ierr) {
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
   }
 
-  /*--- Detect a wrong solution file ---*/
+  /*--- First, read the number of variables and points (i.e., cols and rows),
+   which we will need in order to read the file later. Also, read the
+   variable string names here. Only the master rank reads the header. ---*/
 
-  rbuf_NotMatching = 0; sbuf_NotMatching = 0;
+  if (rank == MASTER_NODE)
+    MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
 
-  if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  /*--- Broadcast the number of variables to all procs and store clearly. ---*/
 
-#ifndef HAVE_MPI
-  rbuf_NotMatching = sbuf_NotMatching;
-#else
-  SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-  if (rbuf_NotMatching != 0) {
-    SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
-                   string("It could be empty lines at the end of the file."), CURRENT_FUNCTION);
-  }
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
 
-  /*--- Close the restart file ---*/
+  /*--- Compact restart files are expanded by a dedicated reader. ---*/
 
-  restart_file_n.close();
+  if (Restart_Vars[0] == 535533) {
+    MPI_File_close(&fhw);
+    Read_SU2_Restart_Compact(geometry, config, val_filename);
+    return;
+  }
 
-  /*-------------------------------------------------------------------------------------------*/
-  /*-------------------------------------------------------------------------------------------*/
+  /*--- Check that this is an SU2 binary file. SU2 binary files
+   have the hex representation of "SU2" as the first int in the file. ---*/
 
-  /*--- Now, we load the restart file for time n-1, if the simulation is 2nd Order ---*/
+  if (Restart_Vars[0] != 535532) {
+    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
+                   string("SU2 reads/writes binary restart files by default.\n") +
+                   string("Note that backward compatibility for ASCII restart files is\n") +
+                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  }
 
-  if (config->GetUnsteady_Simulation() == DT_STEPPING_2ND) {
+  /*--- Store the number of fields to be read for clarity. ---*/
 
-    ifstream restart_file_n1;
-    string filename_n1;
+  nFields = Restart_Vars[1];
 
-    /*--- Modify file name for an unsteady restart ---*/
-    Unst_RestartIter = SU2_TYPE::Int(config->GetUnst_RestartIter())-2;
-    filename_n1 = config->GetUnsteady_FileName(filename, Unst_RestartIter);
+  /*--- Read the variable names from the file. Note that we are adopting a
+   fixed length of 33 for the string length to match with CGNS. This is
+   needed for when we read the strings later. ---*/
 
-    /*--- Open the restart file, throw an error if this fails. ---*/
+  char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
+  if (rank == MASTER_NODE) {
+    disp = nRestart_Vars*sizeof(int);
+    MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
+                     MPI_CHAR, MPI_STATUS_IGNORE);
+  }
 
-    restart_file_n.open(filename_n1.data(), ios::in);
-    if (restart_file_n.fail()) {
-        SU2_MPI::Error(string("There is no flow restart file ") + filename_n1, CURRENT_FUNCTION);
+  /*--- Broadcast the string names of the variables. ---*/
 
-    }
+  SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
+                 MASTER_NODE, MPI_COMM_WORLD);
 
-    /*--- First, set all indices to a negative value by default, and Global n indices to 0 ---*/
-    iPoint_Global_Local = 0; iPoint_Global = 0;
+  /*--- Now parse the string names and load into the config class in case
+   we need them for writing visualization files (SU2_SOL). ---*/
 
-    /*--- Read all lines in the restart file ---*/
-    /*--- The first line is the header ---*/
+  config->fields.push_back("Point_ID");
+  for (iVar = 0; iVar < nFields; iVar++) {
+    index = iVar*CGNS_STRING_SIZE;
+    field_buf.append("\"");
+    for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
+      str_buf[iChar] = mpi_str_buf[index + iChar];
+    }
+    field_buf.append(str_buf);
+    field_buf.append("\"");
+    config->fields.push_back(field_buf.c_str());
+    field_buf.clear();
+  }
 
-    getline (restart_file_n, text_line);
+  /*--- Free string buffer memory. ---*/
 
-    for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-      
-      getline (restart_file_n, text_line);
-      
-      istringstream point_line(text_line);
+  delete [] mpi_str_buf;
 
-      /*--- Retrieve local index. If this node from the restart file lives
-       on the current processor, we will load and instantiate the vars. ---*/
+  /*--- The data portion of the file starts after the 5 ints describing the
+   restart and the string names of the variables. ---*/
 
-      iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
 
-      if (iPoint_Local > -1) {
+  /*--- Each rank reads one contiguous block of a linear partition of the points
+   in the file, i.e. the layout of the parallel writing, such that the file is
+   accessed with large collective reads instead of one small block per point. ---*/
 
-        if (nDim == 2) point_line >> index >> Coord[0] >> Coord[1];
-        if (nDim == 3) point_line >> index >> Coord[0] >> Coord[1] >> Coord[2];
+  unsigned long nPoint_File = Restart_Vars[2], nPoint_Lin = nPoint_File/size,
+  nPoint_Rem = nPoint_File%size, Point_Beg, Point_End;
 
-        geometry->node[iPoint_Local]->SetCoord_n1(Coord);
+  Point_Beg = rank*nPoint_Lin + min((unsigned long)rank, nPoint_Rem);
+  Point_End = Point_Beg + nPoint_Lin + ((unsigned long)rank < nPoint_Rem ? 1 : 0);
 
-        iPoint_Global_Local++;
-      }
+  /*--- All the fields of one point form one element of the file. ---*/
 
-    }
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &etype);
+  MPI_Type_commit(&etype);
 
-    /*--- Detect a wrong solution file ---*/
+  passivedouble *Read_Data = new passivedouble[nFields*(Point_End-Point_Beg)];
 
-    rbuf_NotMatching = 0; sbuf_NotMatching = 0;
+  disp += (MPI_Offset)Point_Beg*nFields*sizeof(passivedouble);
+  MPI_File_read_at_all(fhw, disp, Read_Data, (int)(Point_End-Point_Beg), etype, &status);
 
-    if (iPoint_Global_Local < geometry->GetnPointDomain()) { sbuf_NotMatching = 1; }
+  /*--- All ranks close the file after reading. ---*/
 
-#ifndef HAVE_MPI
-    rbuf_NotMatching = sbuf_NotMatching;
-#else
-    SU2_MPI::Allreduce(&sbuf_NotMatching, &rbuf_NotMatching, 1, MPI_UNSIGNED_SHORT, MPI_SUM, MPI_COMM_WORLD);
-#endif
-    if (rbuf_NotMatching != 0) {
-      SU2_MPI::Error(string("The solution file ") + filename + string(" doesn't match with the mesh file!\n") +
-                     string("It could be empty lines at the end of the file."), CURRENT_FUNCTION);
-    }
+  MPI_File_close(&fhw);
 
-    /*--- Close the restart file ---*/
+  /*--- Redistribute the points to the ranks that own them, or interpolate
+   them to the points of this mesh. ---*/
 
-    restart_file_n1.close();
+  MPI_Type_free(&etype);
 
-  }
+  if (config->GetRestart_Interpolate())
+    Interpolate_Restart_Data(geometry, config, Read_Data, nFields, nPoint_File, val_filename);
+  else
+    Redistribute_Restart_Data(geometry, Read_Data, nFields, nPoint_File, val_filename);
 
-  /*--- It's necessary to communicate this information ---*/
+  delete [] Read_Data;
 
-  geometry->Set_MPI_OldCoord(config);
+#endif
   
-  delete [] Coord;
-
 }
 
-void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, string val_filename) {
+void CSolver::Read_SU2_Restart_Compact(CGeometry *geometry, CConfig *config, string val_filename) {
 
-  ifstream restart_file;
-  string text_line, Tag;
+  char str_buf[CGNS_STRING_SIZE], fname[100];
   unsigned short iVar;
-  long index, iPoint_Local = 0; unsigned long iPoint_Global = 0;
-  int counter = 0;
-  config->fields.clear();
-
-  Restart_Vars = new int[5];
-
-  /*--- First, check that this is not a binary restart file. ---*/
-
-  char fname[100];
   strcpy(fname, val_filename.c_str());
-  int magic_number;
+  int nRestart_Vars = 5, nFields, nStored, nDouble, nCompact, iField;
+  unsigned short Kind_Storage;
+  unsigned long iPoint, nRecord, Record_Size, Value_Size;
+  passivedouble Value;
+  float Value_Float;
+  unsigned short Value_Quant;
+  config->fields.clear();
 
 #ifndef HAVE_MPI
 
@@ -2219,33 +3827,62 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
   /*--- Error check for opening the file. ---*/
 
   if (!fhw) {
-    SU2_MPI::Error(string("Unable to open SU2 restart file ") + fname, CURRENT_FUNCTION);
+    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
   }
 
-  /*--- Attempt to read the first int, which should be our magic number. ---*/
+  /*--- Header: format, number of fields of the full layout, number of
+   points, number of stored fields and storage of the compact fields. ---*/
 
-  ret = fread(&magic_number, sizeof(int), 1, fhw);
-  if (ret != 1) {
+  ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
+  if (ret != (unsigned long)nRestart_Vars) {
     SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
   }
 
-  /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+  nFields = Restart_Vars[1]; nStored = Restart_Vars[3];
+  Kind_Storage = Restart_Vars[4];
 
-  if (magic_number == 535532) {
-    SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
-                   string("SU2 reads/writes binary restart files by default.\n") +
-                   string("Note that backward compatibility for ASCII restart files is\n") +
-                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  /*--- The names of all the fields are written, including the fields that
+   were not stored. We pad the beginning with the Point_ID tag. ---*/
+
+  config->fields.push_back("Point_ID");
+  for (iVar = 0; iVar < nFields; iVar++) {
+    ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
+    if (ret != (unsigned long)CGNS_STRING_SIZE) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+    config->fields.push_back(str_buf);
   }
 
-  fclose(fhw);
+  /*--- Number of double fields, column of each stored field and
+   quantization parameters. ---*/
+
+  vector<int> Stored_Index(nStored+1);
+  ret = fread(&Stored_Index[0], sizeof(int), nStored+1, fhw);
+  if (ret != (unsigned long)nStored+1) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+  nDouble = Stored_Index[0]; Stored_Index.erase(Stored_Index.begin());
+  nCompact = nStored - nDouble;
+
+  vector<passivedouble> Quant_Param(2*nCompact+1, 0.0);
+  if (Kind_Storage == COMPACT_QUANTIZED16) {
+    ret = fread(&Quant_Param[0], sizeof(passivedouble), 2*nCompact, fhw);
+    if (ret != (unsigned long)2*nCompact) {
+      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+    }
+  }
 
 #else
 
   /*--- Parallel binary input using MPI I/O. ---*/
 
   MPI_File fhw;
+  SU2_MPI::Status status;
+  MPI_Datatype etype;
+  MPI_Offset disp, Header_Size;
+  unsigned long index, iChar;
+  string field_buf;
+
   int ierr;
 
   /*--- All ranks open the file using MPI. ---*/
@@ -2258,299 +3895,694 @@ void CSolver::Read_SU2_Restart_ASCII(CGeometry *geometry, CConfig *config, strin
     SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
   }
 
-  /*--- Have the master attempt to read the magic number. ---*/
+  /*--- Header: format, number of fields of the full layout, number of
+   points, number of stored fields and storage of the compact fields.
+   Only the master rank reads the header. ---*/
 
   if (rank == MASTER_NODE)
-    MPI_File_read(fhw, &magic_number, 1, MPI_INT, MPI_STATUS_IGNORE);
+    MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
 
-  /*--- Broadcast the number of variables to all procs and store clearly. ---*/
+  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+
+  nFields = Restart_Vars[1]; nStored = Restart_Vars[3];
+  Kind_Storage = Restart_Vars[4];
+
+  /*--- The names of all the fields are written, including the fields that
+   were not stored. ---*/
+
+  char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
+  if (rank == MASTER_NODE) {
+    disp = nRestart_Vars*sizeof(int);
+    MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
+                     MPI_CHAR, MPI_STATUS_IGNORE);
+  }
+
+  SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
+                 MASTER_NODE, MPI_COMM_WORLD);
+
+  config->fields.push_back("Point_ID");
+  for (iVar = 0; iVar < nFields; iVar++) {
+    index = iVar*CGNS_STRING_SIZE;
+    field_buf.append("\"");
+    for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
+      str_buf[iChar] = mpi_str_buf[index + iChar];
+    }
+    field_buf.append(str_buf);
+    field_buf.append("\"");
+    config->fields.push_back(field_buf.c_str());
+    field_buf.clear();
+  }
+
+  delete [] mpi_str_buf;
+
+  /*--- Number of double fields, column of each stored field and
+   quantization parameters. ---*/
+
+  vector<int> Stored_Index(nStored+1);
+  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+  if (rank == MASTER_NODE)
+    MPI_File_read_at(fhw, disp, &Stored_Index[0], nStored+1, MPI_INT, MPI_STATUS_IGNORE);
+  SU2_MPI::Bcast(&Stored_Index[0], nStored+1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  disp += (nStored+1)*sizeof(int);
+
+  nDouble = Stored_Index[0]; Stored_Index.erase(Stored_Index.begin());
+  nCompact = nStored - nDouble;
+
+  vector<passivedouble> Quant_Param(2*nCompact+1, 0.0);
+  if (Kind_Storage == COMPACT_QUANTIZED16) {
+    if (rank == MASTER_NODE)
+      MPI_File_read_at(fhw, disp, &Quant_Param[0], 2*nCompact, MPI_DOUBLE, MPI_STATUS_IGNORE);
+    CBaseMPIWrapper::Bcast(&Quant_Param[0], 2*nCompact, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+    disp += 2*nCompact*sizeof(passivedouble);
+  }
+  Header_Size = disp;
+
+#endif
+
+  /*--- Size of the records of the points. ---*/
+
+  switch (Kind_Storage) {
+    case COMPACT_FLOAT32:     Value_Size = sizeof(float); break;
+    case COMPACT_QUANTIZED16: Value_Size = sizeof(unsigned short); break;
+    default:                  Value_Size = sizeof(passivedouble); break;
+  }
+  Record_Size = nDouble*sizeof(passivedouble) + nCompact*Value_Size;
+
+  for (iField = 0; iField < nStored; iField++) {
+    if ((Stored_Index[iField] < 0) || (Stored_Index[iField] >= nFields)) {
+      SU2_MPI::Error(string("File ") + string(fname) + string(" is not a valid compact SU2 restart file."), CURRENT_FUNCTION);
+    }
+  }
+
+#ifndef HAVE_MPI
+
+  /*--- Read in the records of all local points, or of all the points of a
+   restart of a different mesh that is interpolated. ---*/
+
+  nRecord = config->GetRestart_Interpolate()? (unsigned long)Restart_Vars[2] : geometry->GetnPointDomain();
+  char *Record_Buf = new char[max(nRecord*Record_Size, (unsigned long)1)];
+
+  ret = fread(Record_Buf, Record_Size, nRecord, fhw);
+  if (ret != nRecord) {
+    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  }
+
+  fclose(fhw);
+
+#else
+
+  /*--- Each rank reads one contiguous block of a linear partition of the
+   points in the file, the records are redistributed after the expansion. ---*/
+
+  unsigned long nPoint_File = Restart_Vars[2], nPoint_Lin = nPoint_File/size,
+  nPoint_Rem = nPoint_File%size, Point_Beg, Point_End;
+
+  Point_Beg = rank*nPoint_Lin + min((unsigned long)rank, nPoint_Rem);
+  Point_End = Point_Beg + nPoint_Lin + ((unsigned long)rank < nPoint_Rem ? 1 : 0);
+  nRecord   = Point_End-Point_Beg;
 
-  SU2_MPI::Bcast(&magic_number, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+  MPI_Type_contiguous(Record_Size, MPI_BYTE, &etype);
+  MPI_Type_commit(&etype);
 
-  /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+  char *Record_Buf = new char[max(nRecord*Record_Size, (unsigned long)1)];
 
-  if (magic_number == 535532) {
-    SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
-                   string("SU2 reads/writes binary restart files by default.\n") +
-                   string("Note that backward compatibility for ASCII restart files is\n") +
-                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-  }
+  disp = Header_Size + (MPI_Offset)Point_Beg*Record_Size;
+  MPI_File_read_at_all(fhw, disp, Record_Buf, (int)nRecord, etype, &status);
 
   MPI_File_close(&fhw);
+  MPI_Type_free(&etype);
 
 #endif
 
-  /*--- Open the restart file ---*/
-
-  restart_file.open(val_filename.data(), ios::in);
+  /*--- Expand the records to the full layout of the fields, as expected by the
+   LoadRestart routines. The fields that were not stored are set to zero. ---*/
 
-  /*--- In case there is no restart file ---*/
+  passivedouble *Read_Data = new passivedouble[max(nFields*nRecord, (unsigned long)1)];
+  char *record;
 
-  if (restart_file.fail()) {
-    SU2_MPI::Error(string("SU2 ASCII solution file  ") + string(fname) + string(" not found."), CURRENT_FUNCTION);
+  for (iPoint = 0; iPoint < nRecord; iPoint++) {
+    record = &Record_Buf[iPoint*Record_Size];
+    for (iVar = 0; iVar < nFields; iVar++)
+      Read_Data[iPoint*nFields+iVar] = 0.0;
+    for (iField = 0; iField < nDouble; iField++) {
+      memcpy(&Value, &record[iField*sizeof(passivedouble)], sizeof(passivedouble));
+      Read_Data[iPoint*nFields+Stored_Index[iField]] = Value;
+    }
+    record += nDouble*sizeof(passivedouble);
+    for (iField = 0; iField < nCompact; iField++) {
+      if (Kind_Storage == COMPACT_FLOAT32) {
+        memcpy(&Value_Float, &record[iField*Value_Size], Value_Size);
+        Value = Value_Float;
+      } else {
+        memcpy(&Value_Quant, &record[iField*Value_Size], Value_Size);
+        Value = Quant_Param[2*iField] + Value_Quant*Quant_Param[2*iField+1];
+      }
+      Read_Data[iPoint*nFields+Stored_Index[nDouble+iField]] = Value;
+    }
   }
 
-  /*--- Identify the number of fields (and names) in the restart file ---*/
+  delete [] Record_Buf;
 
-  getline (restart_file, text_line);
-  stringstream ss(text_line);
-  while (ss >> Tag) {
-    config->fields.push_back(Tag);
-    if (ss.peek() == ',') ss.ignore();
+  if (config->GetRestart_Interpolate()) {
+    Interpolate_Restart_Data(geometry, config, Read_Data, nFields, Restart_Vars[2], val_filename);
+    delete [] Read_Data;
+  } else {
+#ifndef HAVE_MPI
+    Restart_Data = Read_Data;
+#else
+    Redistribute_Restart_Data(geometry, Read_Data, nFields, nPoint_File, val_filename);
+    delete [] Read_Data;
+#endif
   }
 
-  /*--- Set the number of variables, one per field in the
-   restart file (without including the PointID) ---*/
+}
 
-  Restart_Vars[1] = (int)config->fields.size() - 1;
+void CSolver::Redistribute_Restart_Data(CGeometry *geometry, passivedouble *Read_Data, int nFields, unsigned long nPoint_File, string val_filename) {
 
-  /*--- Allocate memory for the restart data. ---*/
+#ifdef HAVE_MPI
 
-  Restart_Data = new passivedouble[Restart_Vars[1]*geometry->GetnPointDomain()];
+  /*--- The rank holds the points of its block of the linear partition of
+   the file in Read_Data, with the nFields values of each point. ---*/
 
-  /*--- Read all lines in the restart file and extract data. ---*/
+  char fname[100];
+  strcpy(fname, val_filename.c_str());
+  unsigned short iVar;
+  unsigned long nPoint_Lin = nPoint_File/size, nPoint_Rem = nPoint_File%size, Point_Beg,
+  iPoint, iPoint_Read, nPoint_Reply, nPoint_Request_Tot;
+  unsigned long nPointDomain = geometry->GetnPointDomain();
+  int iProcessor;
+  MPI_Datatype etype;
+
+  Point_Beg = rank*nPoint_Lin + min((unsigned long)rank, nPoint_Rem);
+
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &etype);
+  MPI_Type_commit(&etype);
+
+  /*--- Global indices of the points owned by this rank, in increasing order as
+   the data is expected by the LoadRestart routines. This also makes the requests
+   to each reading rank contiguous. ---*/
+
+  vector<unsigned long> Global_Index;
+  Global_Index.reserve(nPointDomain);
+  for (iPoint = 0; iPoint < geometry->GetGlobal_nPointDomain(); iPoint++)
+    if (geometry->GetGlobal_to_Local_Point(iPoint) > -1) Global_Index.push_back(iPoint);
+  nPoint_Request_Tot = Global_Index.size();
+  if (Global_Index.empty()) Global_Index.push_back(0);
+
+  int *nPoint_Request = new int[size];
+  int *nPoint_Send    = new int[size];
+  int *Request_Displ  = new int[size];
+  int *Send_Displ     = new int[size];
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) nPoint_Request[iProcessor] = 0;
+
+  for (iPoint = 0; iPoint < nPoint_Request_Tot; iPoint++) {
+    if (Global_Index[iPoint] >= nPoint_File) {
+      SU2_MPI::Error(string("The number of points in the restart file ") + string(fname) +
+                     string(" does not match the mesh."), CURRENT_FUNCTION);
+    }
+    if (Global_Index[iPoint] < nPoint_Rem*(nPoint_Lin+1))
+      iProcessor = Global_Index[iPoint]/(nPoint_Lin+1);
+    else
+      iProcessor = nPoint_Rem + (Global_Index[iPoint]-nPoint_Rem*(nPoint_Lin+1))/nPoint_Lin;
+    nPoint_Request[iProcessor]++;
+  }
 
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
+  /*--- Send the requested global indices to the reading ranks. ---*/
 
-    getline (restart_file, text_line);
+  MPI_Alltoall(nPoint_Request, 1, MPI_INT, nPoint_Send, 1, MPI_INT, MPI_COMM_WORLD);
 
-    istringstream point_line(text_line);
+  Request_Displ[0] = 0; Send_Displ[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Request_Displ[iProcessor] = Request_Displ[iProcessor-1] + nPoint_Request[iProcessor-1];
+    Send_Displ[iProcessor]    = Send_Displ[iProcessor-1]    + nPoint_Send[iProcessor-1];
+  }
+  nPoint_Reply = Send_Displ[size-1] + nPoint_Send[size-1];
 
-    /*--- Retrieve local index. If this node from the restart file lives
-     on the current processor, we will load and instantiate the vars. ---*/
+  unsigned long *Reply_Index = new unsigned long[max(nPoint_Reply, (unsigned long)1)];
 
-    iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+  MPI_Alltoallv(&Global_Index[0], nPoint_Request, Request_Displ, MPI_UNSIGNED_LONG,
+                Reply_Index, nPoint_Send, Send_Displ, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
 
-    if (iPoint_Local > -1) {
+  /*--- Pack the requested points and redistribute them to their owners with
+   a single exchange, the data is received directly in the restart buffer. ---*/
 
-      /*--- The PointID is not stored --*/
+  passivedouble *Send_Data = new passivedouble[max(nFields*nPoint_Reply, (unsigned long)1)];
 
-      point_line >> index;
+  for (iPoint = 0; iPoint < nPoint_Reply; iPoint++) {
+    iPoint_Read = Reply_Index[iPoint]-Point_Beg;
+    for (iVar = 0; iVar < nFields; iVar++)
+      Send_Data[iPoint*nFields+iVar] = Read_Data[iPoint_Read*nFields+iVar];
+  }
 
-      /*--- Store the solution (starting with node coordinates) --*/
+  Restart_Data = new passivedouble[nFields*max(nPointDomain, nPoint_Request_Tot)];
 
-      for (iVar = 0; iVar < Restart_Vars[1]; iVar++)
-        point_line >> Restart_Data[counter*Restart_Vars[1] + iVar];
+  MPI_Alltoallv(Send_Data, nPoint_Send, Send_Displ, etype,
+                Restart_Data, nPoint_Request, Request_Displ, etype, MPI_COMM_WORLD);
 
-      /*--- Increment our local point counter. ---*/
+  /*--- Free the derived datatype and release temp memory. ---*/
 
-      counter++;
+  MPI_Type_free(&etype);
 
-    }
-  }
+  delete [] Send_Data;
+  delete [] Reply_Index;
+  delete [] nPoint_Request;
+  delete [] nPoint_Send;
+  delete [] Request_Displ;
+  delete [] Send_Displ;
+  
+#endif
 
 }
 
-void CSolver::Read_SU2_Restart_Binary(CGeometry *geometry, CConfig *config, string val_filename) {
+void CSolver::Interpolate_Restart_Data(CGeometry *geometry, CConfig *config, passivedouble *Read_Data, int nFields, unsigned long nPoint_File, string val_filename) {
 
-  char str_buf[CGNS_STRING_SIZE], fname[100];
-  unsigned short iVar;
+  /*--- The rank holds the points of its block of the linear partition of
+   the file in Read_Data (the whole file without MPI), the first nDim fields
+   of each point are its coordinates. ---*/
+
+  char fname[100];
   strcpy(fname, val_filename.c_str());
-  int nRestart_Vars = 5, nFields;
-  Restart_Vars = new int[5];
-  config->fields.clear();
+  unsigned short iDim, iVar, iNode, nNode, nDim = geometry->GetnDim();
+  unsigned long iPoint, iRecord, iPoint_Global, nRecord, nDonor;
+  unsigned long nPointDomain = geometry->GetnPointDomain();
+  su2double *Coord;
 
-#ifndef HAVE_MPI
+  if (nFields < nDim) {
+    SU2_MPI::Error(string("The restart file ") + string(fname) +
+                   string(" has no coordinates to interpolate from."), CURRENT_FUNCTION);
+  }
 
-  /*--- Serial binary input. ---*/
+  /*--- With the mesh of the restart file the values are interpolated linearly
+   in its elements, otherwise the values of the nearest point are taken. The
+   donors are exchanged as records of fixed size: the VTK type, the number of
+   nodes and the fields of the nodes. ---*/
 
-  FILE *fhw;
-  fhw = fopen(fname,"rb");
-  size_t ret;
+  const bool elements = (config->GetRestart_Interpolate_Mesh() != "NONE");
+  const unsigned short nNode_Max = elements? 8 : 1;
+  const unsigned long Record_Size = 2 + nNode_Max*nFields;
 
-  /*--- Error check for opening the file. ---*/
+  /*--- Coordinates of the points owned by this rank, in increasing order of
+   their global indices as the data is expected by the LoadRestart routines,
+   and their bounding box. ---*/
 
-  if (!fhw) {
-    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
-  }
+  vector<su2double> Target_Coord;
+  Target_Coord.reserve(nDim*nPointDomain);
 
-  /*--- First, read the number of variables and points. ---*/
+  passivedouble Box[6];
+  for (iDim = 0; iDim < nDim; iDim++) {
+    Box[iDim] = numeric_limits<passivedouble>::max();
+    Box[nDim+iDim] = -numeric_limits<passivedouble>::max();
+  }
 
-  ret = fread(Restart_Vars, sizeof(int), nRestart_Vars, fhw);
-  if (ret != (unsigned long)nRestart_Vars) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++) {
+    long iPoint_Local = geometry->GetGlobal_to_Local_Point(iPoint_Global);
+    if (iPoint_Local < 0) continue;
+    Coord = geometry->node[iPoint_Local]->GetCoord();
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Target_Coord.push_back(Coord[iDim]);
+      Box[iDim] = min(Box[iDim], SU2_TYPE::GetValue(Coord[iDim]));
+      Box[nDim+iDim] = max(Box[nDim+iDim], SU2_TYPE::GetValue(Coord[iDim]));
+    }
   }
 
-  /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+  /*--- Donor records of this rank: the elements of its block of the linear
+   partition of the elements of the mesh, or the points it read. ---*/
 
-  if (Restart_Vars[0] != 535532) {
-    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                   string("SU2 reads/writes binary restart files by default.\n") +
-                   string("Note that backward compatibility for ASCII restart files is\n") +
-                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
+  vector<passivedouble> Records;
+
+  if (elements) {
+    Read_Restart_Donor_Elements(config, Read_Data, nFields, nPoint_File, nNode_Max, Records);
+  }
+  else {
+    unsigned long nPoint_Lin = nPoint_File/size, nPoint_Rem = nPoint_File%size;
+    unsigned long nPoint_Read = nPoint_Lin + ((unsigned long)rank < nPoint_Rem ? 1 : 0);
+    Records.resize(nPoint_Read*Record_Size);
+    for (iPoint = 0; iPoint < nPoint_Read; iPoint++) {
+      Records[iPoint*Record_Size]   = VERTEX;
+      Records[iPoint*Record_Size+1] = 1;
+      for (iVar = 0; iVar < nFields; iVar++)
+        Records[iPoint*Record_Size+2+iVar] = Read_Data[iPoint*nFields+iVar];
+    }
   }
+  nRecord = Records.size()/Record_Size;
 
-  /*--- Store the number of fields to be read for clarity. ---*/
+#ifdef HAVE_MPI
 
-  nFields = Restart_Vars[1];
+  /*--- The records are sent to the ranks whose bounding box, enlarged by a
+   fraction of its size to find the nearest donor of the points close to its
+   boundary, intersects the bounding box of the nodes of the record. ---*/
 
-  /*--- Read the variable names from the file. Note that we are adopting a
-   fixed length of 33 for the string length to match with CGNS. This is
-   needed for when we read the strings later. We pad the beginning of the
-   variable string vector with the Point_ID tag that wasn't written. ---*/
+  int iProcessor;
+  MPI_Datatype etype;
 
-  config->fields.push_back("Point_ID");
-  for (iVar = 0; iVar < nFields; iVar++) {
-    ret = fread(str_buf, sizeof(char), CGNS_STRING_SIZE, fhw);
-    if (ret != (unsigned long)CGNS_STRING_SIZE) {
-      SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  if (nPointDomain > 0) {
+    passivedouble Margin = 0.0;
+    for (iDim = 0; iDim < nDim; iDim++)
+      Margin = max(Margin, Box[nDim+iDim]-Box[iDim]);
+    Margin *= 0.1;
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Box[iDim] -= Margin; Box[nDim+iDim] += Margin;
     }
-    config->fields.push_back(str_buf);
   }
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+  passivedouble *All_Box = new passivedouble[2*nDim*size];
+  CBaseMPIWrapper::Allgather(Box, 2*nDim, MPI_DOUBLE, All_Box, 2*nDim, MPI_DOUBLE, MPI_COMM_WORLD);
 
-  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+  int *nRecord_Send = new int[size];
+  int *nRecord_Recv = new int[size];
+  int *Send_Displ   = new int[size];
+  int *Recv_Displ   = new int[size];
 
-  /*--- Read in the data for the restart at all local points. ---*/
+  vector<vector<unsigned long> > Send_Records(size);
+  passivedouble Record_Box[6];
 
-  ret = fread(Restart_Data, sizeof(passivedouble), nFields*geometry->GetnPointDomain(), fhw);
-  if (ret != (unsigned long)nFields*geometry->GetnPointDomain()) {
-    SU2_MPI::Error("Error reading restart file.", CURRENT_FUNCTION);
+  for (iRecord = 0; iRecord < nRecord; iRecord++) {
+    const passivedouble *Record = &Records[iRecord*Record_Size];
+    nNode = (unsigned short)Record[1];
+    for (iDim = 0; iDim < nDim; iDim++) {
+      Record_Box[iDim] = Record_Box[nDim+iDim] = Record[2+iDim];
+      for (iNode = 1; iNode < nNode; iNode++) {
+        Record_Box[iDim] = min(Record_Box[iDim], Record[2+iNode*nFields+iDim]);
+        Record_Box[nDim+iDim] = max(Record_Box[nDim+iDim], Record[2+iNode*nFields+iDim]);
+      }
+    }
+    for (iProcessor = 0; iProcessor < size; iProcessor++) {
+      const passivedouble *Box_Proc = &All_Box[2*nDim*iProcessor];
+      for (iDim = 0; iDim < nDim; iDim++)
+        if ((Record_Box[nDim+iDim] < Box_Proc[iDim]) || (Record_Box[iDim] > Box_Proc[nDim+iDim])) break;
+      if (iDim == nDim) Send_Records[iProcessor].push_back(iRecord);
+    }
   }
 
-  /*--- Close the file. ---*/
+  for (iProcessor = 0; iProcessor < size; iProcessor++)
+    nRecord_Send[iProcessor] = (int)Send_Records[iProcessor].size();
 
-  fclose(fhw);
+  MPI_Alltoall(nRecord_Send, 1, MPI_INT, nRecord_Recv, 1, MPI_INT, MPI_COMM_WORLD);
 
-#else
+  Send_Displ[0] = 0; Recv_Displ[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Send_Displ[iProcessor] = Send_Displ[iProcessor-1] + nRecord_Send[iProcessor-1];
+    Recv_Displ[iProcessor] = Recv_Displ[iProcessor-1] + nRecord_Recv[iProcessor-1];
+  }
+  unsigned long nRecord_Send_Tot = Send_Displ[size-1] + nRecord_Send[size-1];
+  nDonor = Recv_Displ[size-1] + nRecord_Recv[size-1];
+
+  vector<passivedouble> Send_Data(max(Record_Size*nRecord_Send_Tot, (unsigned long)1));
+  vector<passivedouble> Donor(max(Record_Size*nDonor, (unsigned long)1));
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) {
+    for (iRecord = 0; iRecord < Send_Records[iProcessor].size(); iRecord++) {
+      unsigned long iRecord_Send = Send_Displ[iProcessor] + iRecord;
+      copy(&Records[Send_Records[iProcessor][iRecord]*Record_Size],
+           &Records[Send_Records[iProcessor][iRecord]*Record_Size] + Record_Size,
+           &Send_Data[iRecord_Send*Record_Size]);
+    }
+  }
 
-  /*--- Parallel binary input using MPI I/O. ---*/
+  MPI_Type_contiguous(Record_Size, MPI_DOUBLE, &etype);
+  MPI_Type_commit(&etype);
 
-  MPI_File fhw;
-  SU2_MPI::Status status;
-  MPI_Datatype etype, filetype;
-  MPI_Offset disp;
-  unsigned long iPoint_Global, index, iChar;
-  string field_buf;
+  MPI_Alltoallv(Send_Data.data(), nRecord_Send, Send_Displ, etype,
+                Donor.data(), nRecord_Recv, Recv_Displ, etype, MPI_COMM_WORLD);
 
-  int ierr;
+  MPI_Type_free(&etype);
 
-  /*--- All ranks open the file using MPI. ---*/
+  delete [] All_Box;
+  delete [] nRecord_Send;
+  delete [] nRecord_Recv;
+  delete [] Send_Displ;
+  delete [] Recv_Displ;
 
-  ierr = MPI_File_open(MPI_COMM_WORLD, fname, MPI_MODE_RDONLY, MPI_INFO_NULL, &fhw);
+#else
 
-  /*--- Error check opening the file. ---*/
+  vector<passivedouble> &Donor = Records;
+  nDonor = nRecord;
 
-  if (ierr) {
-    SU2_MPI::Error(string("Unable to open SU2 restart file ") + string(fname), CURRENT_FUNCTION);
+#endif
+
+  if ((nPointDomain > 0) && (nDonor == 0)) {
+    SU2_MPI::Error(string("No point of the restart file ") + string(fname) +
+                   string(" lies near the points of rank ") + to_string(rank) + string("."), CURRENT_FUNCTION);
   }
 
-  /*--- First, read the number of variables and points (i.e., cols and rows),
-   which we will need in order to read the file later. Also, read the
-   variable string names here. Only the master rank reads the header. ---*/
+  Restart_Data = new passivedouble[max(nFields*nPointDomain, (unsigned long)1)];
 
-  if (rank == MASTER_NODE)
-    MPI_File_read(fhw, Restart_Vars, nRestart_Vars, MPI_INT, MPI_STATUS_IGNORE);
+  if (nPointDomain > 0) {
 
-  /*--- Broadcast the number of variables to all procs and store clearly. ---*/
+    /*--- Nodes of the donor records, with the offset of their fields. ---*/
 
-  SU2_MPI::Bcast(Restart_Vars, nRestart_Vars, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    vector<su2double> Node_Coord;
+    vector<unsigned long> Node_Offset, Node_ID, Elem_Conn, Elem_ID;
+    vector<unsigned short> Elem_Type, Elem_Marker;
 
-  /*--- Check that this is an SU2 binary file. SU2 binary files
-   have the hex representation of "SU2" as the first int in the file. ---*/
+    for (iRecord = 0; iRecord < nDonor; iRecord++) {
+      const unsigned long Offset = iRecord*Record_Size;
+      nNode = (unsigned short)Donor[Offset+1];
+      for (iNode = 0; iNode < nNode; iNode++) {
+        Elem_Conn.push_back(Node_Offset.size());
+        Node_ID.push_back(Node_Offset.size());
+        Node_Offset.push_back(Offset+2+iNode*nFields);
+        for (iDim = 0; iDim < nDim; iDim++)
+          Node_Coord.push_back(Donor[Offset+2+iNode*nFields+iDim]);
+      }
+      Elem_Type.push_back((unsigned short)Donor[Offset]);
+      Elem_Marker.push_back(0);
+      Elem_ID.push_back(iRecord);
+    }
 
-  if (Restart_Vars[0] != 535532) {
-    SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
-                   string("SU2 reads/writes binary restart files by default.\n") +
-                   string("Note that backward compatibility for ASCII restart files is\n") +
-                   string("possible with the WRT_BINARY_RESTART / READ_BINARY_RESTART options."), CURRENT_FUNCTION);
-  }
+    vector<bool> Found(nPointDomain, false);
 
-  /*--- Store the number of fields to be read for clarity. ---*/
+    /*--- Linear interpolation in the donor element that contains the point. ---*/
 
-  nFields = Restart_Vars[1];
+    if (elements) {
 
-  /*--- Read the variable names from the file. Note that we are adopting a
-   fixed length of 33 for the string length to match with CGNS. This is
-   needed for when we read the strings later. ---*/
+      CADTElemClass Elem_ADT(nDim, Node_Coord, Elem_Conn, Elem_Type, Elem_Marker, Elem_ID, false);
 
-  char *mpi_str_buf = new char[nFields*CGNS_STRING_SIZE];
-  if (rank == MASTER_NODE) {
-    disp = nRestart_Vars*sizeof(int);
-    MPI_File_read_at(fhw, disp, mpi_str_buf, nFields*CGNS_STRING_SIZE,
-                     MPI_CHAR, MPI_STATUS_IGNORE);
+      unsigned short Marker_Donor;
+      unsigned long Elem_Donor;
+      int Rank_Donor;
+      su2double Par_Coord[3], Weight[8];
+
+      for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+        if (!Elem_ADT.DetermineContainingElement(&Target_Coord[iPoint*nDim], Marker_Donor,
+                                                 Elem_Donor, Rank_Donor, Par_Coord, Weight)) continue;
+
+        const passivedouble *Record = &Donor[Elem_Donor*Record_Size];
+        nNode = (unsigned short)Record[1];
+        for (iVar = 0; iVar < nFields; iVar++) {
+          passivedouble Value = 0.0;
+          for (iNode = 0; iNode < nNode; iNode++)
+            Value += SU2_TYPE::GetValue(Weight[iNode])*Record[2+iNode*nFields+iVar];
+          Restart_Data[iPoint*nFields+iVar] = Value;
+        }
+        Found[iPoint] = true;
+      }
+    }
+
+    /*--- The other points (outside of the donor elements, e.g. near curved
+     walls, or all of them without the mesh) take the values of the nearest
+     donor node, searched in an ADT along a space filling curve. ---*/
+
+    vector<unsigned long> Missing;
+    vector<su2double> Missing_Coord;
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (Found[iPoint]) continue;
+      Missing.push_back(iPoint);
+      for (iDim = 0; iDim < nDim; iDim++)
+        Missing_Coord.push_back(Target_Coord[iPoint*nDim+iDim]);
+    }
+
+    if (!Missing.empty()) {
+
+      CADTPointsOnlyClass Node_ADT(nDim, Node_ID.size(), Node_Coord.data(), Node_ID.data(), false);
+
+      vector<su2double> Dist(Missing.size());
+      vector<unsigned long> Nearest(Missing.size());
+      vector<int> Rank_Nearest(Missing.size());
+
+      Node_ADT.DetermineNearestNodes(Missing.size(), Missing_Coord.data(), Dist.data(),
+                                     Nearest.data(), Rank_Nearest.data());
+
+      for (iPoint = 0; iPoint < Missing.size(); iPoint++)
+        for (iVar = 0; iVar < nFields; iVar++)
+          Restart_Data[Missing[iPoint]*nFields+iVar] = Donor[Node_Offset[Nearest[iPoint]]+iVar];
+    }
+
+    /*--- The coordinates are the ones of this mesh, such that no grid
+     displacement is restarted. ---*/
+
+    for (iPoint = 0; iPoint < nPointDomain; iPoint++)
+      for (iDim = 0; iDim < nDim; iDim++)
+        Restart_Data[iPoint*nFields+iDim] = SU2_TYPE::GetValue(Target_Coord[iPoint*nDim+iDim]);
   }
 
-  /*--- Broadcast the string names of the variables. ---*/
+}
 
-  SU2_MPI::Bcast(mpi_str_buf, nFields*CGNS_STRING_SIZE, MPI_CHAR,
-                 MASTER_NODE, MPI_COMM_WORLD);
+void CSolver::Read_Restart_Donor_Elements(CConfig *config, passivedouble *Read_Data, int nFields, unsigned long nPoint_File,
+                                          unsigned short nNode_Max, vector<passivedouble> &Records) {
 
-  /*--- Now parse the string names and load into the config class in case
-   we need them for writing visualization files (SU2_SOL). ---*/
+  string Mesh_FileName = config->GetRestart_Interpolate_Mesh(), text_line;
+  string::size_type position;
+  unsigned short iVar, iNode, nNode, VTK_Type;
+  unsigned long iElem, iPoint, nElem_File = 0, Elem_Beg, Elem_End, Point;
+  unsigned long nPoint_Lin = nPoint_File/size, nPoint_Rem = nPoint_File%size;
+  const unsigned long Record_Size = 2 + nNode_Max*nFields;
+  bool found = false;
+
+  /*--- Every rank scans the element section of the native mesh file and keeps
+   its block of the linear partition of the elements. The point numbering of
+   the mesh is the one of its restart file. ---*/
+
+  ifstream mesh_file(Mesh_FileName.c_str());
+  if (mesh_file.fail()) {
+    SU2_MPI::Error(string("Unable to open the mesh file ") + Mesh_FileName +
+                   string(" of the restart file."), CURRENT_FUNCTION);
+  }
 
-  config->fields.push_back("Point_ID");
-  for (iVar = 0; iVar < nFields; iVar++) {
-    index = iVar*CGNS_STRING_SIZE;
-    field_buf.append("\"");
-    for (iChar = 0; iChar < (unsigned long)CGNS_STRING_SIZE; iChar++) {
-      str_buf[iChar] = mpi_str_buf[index + iChar];
+  while (getline(mesh_file, text_line)) {
+    position = text_line.find("NELEM=", 0);
+    if (position != string::npos) {
+      text_line.erase(0, position+6);
+      nElem_File = atol(text_line.c_str());
+      found = true;
+      break;
     }
-    field_buf.append(str_buf);
-    field_buf.append("\"");
-    config->fields.push_back(field_buf.c_str());
-    field_buf.clear();
+  }
+  if (!found) {
+    SU2_MPI::Error(string("No elements found in the mesh file ") + Mesh_FileName + string("."), CURRENT_FUNCTION);
   }
 
-  /*--- Free string buffer memory. ---*/
+  unsigned long nElem_Lin = nElem_File/size, nElem_Rem = nElem_File%size;
+  Elem_Beg = rank*nElem_Lin + min((unsigned long)rank, nElem_Rem);
+  Elem_End = Elem_Beg + nElem_Lin + ((unsigned long)rank < nElem_Rem ? 1 : 0);
+
+  vector<unsigned short> Elem_Type;
+  vector<unsigned long> Elem_Conn;
+
+  for (iElem = 0; iElem < Elem_End; iElem++) {
+    getline(mesh_file, text_line);
+    if (iElem < Elem_Beg) continue;
+
+    istringstream elem_line(text_line);
+    elem_line >> VTK_Type;
+    switch (VTK_Type) {
+      case TRIANGLE:      nNode = 3; break;
+      case QUADRILATERAL: nNode = 4; break;
+      case TETRAHEDRON:   nNode = 4; break;
+      case PYRAMID:       nNode = 5; break;
+      case PRISM:         nNode = 6; break;
+      case HEXAHEDRON:    nNode = 8; break;
+      default:
+        SU2_MPI::Error(string("Unknown element type in the mesh file ") + Mesh_FileName + string("."), CURRENT_FUNCTION);
+        nNode = 0;
+    }
+    Elem_Type.push_back(VTK_Type);
+    for (iNode = 0; iNode < nNode; iNode++) {
+      elem_line >> Point;
+      if (Point >= nPoint_File) {
+        SU2_MPI::Error(string("The mesh file ") + Mesh_FileName +
+                       string(" does not match the points of the restart file."), CURRENT_FUNCTION);
+      }
+      Elem_Conn.push_back(Point);
+    }
+    for (iNode = nNode; iNode < nNode_Max; iNode++) Elem_Conn.push_back(nPoint_File);
+  }
 
-  delete [] mpi_str_buf;
+  mesh_file.close();
 
-  /*--- We're writing only su2doubles in the data portion of the file. ---*/
+  /*--- Fields of the nodes of these elements, sent by the ranks that read
+   them from the restart file. ---*/
 
-  etype = MPI_DOUBLE;
+  vector<unsigned long> Node_Global;
+  for (iPoint = 0; iPoint < Elem_Conn.size(); iPoint++)
+    if (Elem_Conn[iPoint] < nPoint_File) Node_Global.push_back(Elem_Conn[iPoint]);
+  sort(Node_Global.begin(), Node_Global.end());
+  Node_Global.resize(unique(Node_Global.begin(), Node_Global.end()) - Node_Global.begin());
 
-  /*--- We need to ignore the 4 ints describing the nVar_Restart and nPoints,
-   along with the string names of the variables. ---*/
+  vector<passivedouble> Node_Data(max(nFields*Node_Global.size(), (size_t)1));
 
-  disp = nRestart_Vars*sizeof(int) + CGNS_STRING_SIZE*nFields*sizeof(char);
+#ifdef HAVE_MPI
 
-  /*--- Define a derived datatype for this rank's set of non-contiguous data
-   that will be placed in the restart. Here, we are collecting each one of the
-   points which are distributed throughout the file in blocks of nVar_Restart data. ---*/
+  int iProcessor;
+  unsigned long Point_Beg = rank*nPoint_Lin + min((unsigned long)rank, nPoint_Rem), nPoint_Reply;
+  MPI_Datatype etype;
 
-  int *blocklen = new int[geometry->GetnPointDomain()];
-  int *displace = new int[geometry->GetnPointDomain()];
-  int counter = 0;
-  for (iPoint_Global = 0; iPoint_Global < geometry->GetGlobal_nPointDomain(); iPoint_Global++ ) {
-    if (geometry->GetGlobal_to_Local_Point(iPoint_Global) > -1) {
-      blocklen[counter] = nFields;
-      displace[counter] = iPoint_Global*nFields;
-      counter++;
-    }
+  int *nPoint_Request = new int[size];
+  int *nPoint_Send    = new int[size];
+  int *Request_Displ  = new int[size];
+  int *Send_Displ     = new int[size];
+
+  for (iProcessor = 0; iProcessor < size; iProcessor++) nPoint_Request[iProcessor] = 0;
+
+  for (iPoint = 0; iPoint < Node_Global.size(); iPoint++) {
+    if (Node_Global[iPoint] < nPoint_Rem*(nPoint_Lin+1))
+      iProcessor = Node_Global[iPoint]/(nPoint_Lin+1);
+    else
+      iProcessor = nPoint_Rem + (Node_Global[iPoint]-nPoint_Rem*(nPoint_Lin+1))/nPoint_Lin;
+    nPoint_Request[iProcessor]++;
   }
-  MPI_Type_indexed(geometry->GetnPointDomain(), blocklen, displace, MPI_DOUBLE, &filetype);
-  MPI_Type_commit(&filetype);
 
-  /*--- Set the view for the MPI file write, i.e., describe the location in
-   the file that this rank "sees" for writing its piece of the restart file. ---*/
+  MPI_Alltoall(nPoint_Request, 1, MPI_INT, nPoint_Send, 1, MPI_INT, MPI_COMM_WORLD);
 
-  MPI_File_set_view(fhw, disp, etype, filetype, (char*)"native", MPI_INFO_NULL);
+  Request_Displ[0] = 0; Send_Displ[0] = 0;
+  for (iProcessor = 1; iProcessor < size; iProcessor++) {
+    Request_Displ[iProcessor] = Request_Displ[iProcessor-1] + nPoint_Request[iProcessor-1];
+    Send_Displ[iProcessor]    = Send_Displ[iProcessor-1]    + nPoint_Send[iProcessor-1];
+  }
+  nPoint_Reply = Send_Displ[size-1] + nPoint_Send[size-1];
 
-  /*--- For now, create a temp 1D buffer to read the data from file. ---*/
+  vector<unsigned long> Reply_Index(max(nPoint_Reply, (unsigned long)1));
+  if (Node_Global.empty()) Node_Global.push_back(0);
 
-  Restart_Data = new passivedouble[nFields*geometry->GetnPointDomain()];
+  MPI_Alltoallv(Node_Global.data(), nPoint_Request, Request_Displ, MPI_UNSIGNED_LONG,
+                Reply_Index.data(), nPoint_Send, Send_Displ, MPI_UNSIGNED_LONG, MPI_COMM_WORLD);
 
-  /*--- Collective call for all ranks to read from their view simultaneously. ---*/
+  vector<passivedouble> Send_Data(max(nFields*nPoint_Reply, (unsigned long)1));
+  for (iPoint = 0; iPoint < nPoint_Reply; iPoint++)
+    for (iVar = 0; iVar < nFields; iVar++)
+      Send_Data[iPoint*nFields+iVar] = Read_Data[(Reply_Index[iPoint]-Point_Beg)*nFields+iVar];
 
-  MPI_File_read_all(fhw, Restart_Data, nFields*geometry->GetnPointDomain(), MPI_DOUBLE, &status);
+  MPI_Type_contiguous(nFields, MPI_DOUBLE, &etype);
+  MPI_Type_commit(&etype);
 
-  /*--- All ranks close the file after writing. ---*/
+  MPI_Alltoallv(Send_Data.data(), nPoint_Send, Send_Displ, etype,
+                Node_Data.data(), nPoint_Request, Request_Displ, etype, MPI_COMM_WORLD);
 
-  MPI_File_close(&fhw);
+  MPI_Type_free(&etype);
 
-  /*--- Free the derived datatype and release temp memory. ---*/
+  delete [] nPoint_Request;
+  delete [] nPoint_Send;
+  delete [] Request_Displ;
+  delete [] Send_Displ;
 
-  MPI_Type_free(&filetype);
+#else
+
+  for (iPoint = 0; iPoint < Node_Global.size(); iPoint++)
+    for (iVar = 0; iVar < nFields; iVar++)
+      Node_Data[iPoint*nFields+iVar] = Read_Data[Node_Global[iPoint]*nFields+iVar];
 
-  delete [] blocklen;
-  delete [] displace;
-  
 #endif
-  
+
+  /*--- One record per element. ---*/
+
+  Records.assign(Elem_Type.size()*Record_Size, 0.0);
+
+  for (iElem = 0; iElem < Elem_Type.size(); iElem++) {
+    passivedouble *Record = &Records[iElem*Record_Size];
+    nNode = 0;
+    Record[0] = Elem_Type[iElem];
+    for (iNode = 0; iNode < nNode_Max; iNode++) {
+      Point = Elem_Conn[iElem*nNode_Max+iNode];
+      if (Point >= nPoint_File) break;
+      iPoint = lower_bound(Node_Global.begin(), Node_Global.end(), Point) - Node_Global.begin();
+      for (iVar = 0; iVar < nFields; iVar++)
+        Record[2+iNode*nFields+iVar] = Node_Data[iPoint*nFields+iVar];
+      nNode++;
+    }
+    Record[1] = nNode;
+  }
+
 }
 
 void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bool adjoint_run, string val_filename) {
@@ -2563,7 +4595,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
  su2double dCMy_dCL_ = config->GetdCMy_dCL();
  su2double dCMz_dCL_ = config->GetdCMz_dCL();
   string::size_type position;
-	unsigned long ExtIter_ = 0;
+	unsigned long ExtIter_ = 0, TimeAvg_Samples_ = 0;
 	ifstream restart_file;
 	bool adjoint = (config->GetContinuous_Adjoint()) || (config->GetDiscrete_Adjoint());
 
@@ -2601,7 +4633,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2666,7 +4698,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2677,16 +4709,20 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
 
 		if (rank == MASTER_NODE) {
 
-      /*--- External iteration. ---*/
+      /*--- External iteration. The records of compact files have a variable
+       size, the metadata is found from the end of the file. ---*/
 
       disp = (nVar_Buf*sizeof(int) + var_buf[1]*CGNS_STRING_SIZE*sizeof(char) +
               var_buf[1]*var_buf[2]*sizeof(passivedouble));
+      if (var_buf[0] == 535533) {
+        MPI_File_get_size(fhw, &disp);
+        disp -= sizeof(int) + 8*sizeof(passivedouble);
+      }
       MPI_File_read_at(fhw, disp, &Restart_Iter, 1, MPI_INT, MPI_STATUS_IGNORE);
 
 			/*--- Additional doubles for AoA, AoS, etc. ---*/
 
-      disp = (nVar_Buf*sizeof(int) + var_buf[1]*CGNS_STRING_SIZE*sizeof(char) +
-              var_buf[1]*var_buf[2]*sizeof(passivedouble) + 1*sizeof(int));
+      disp += 1*sizeof(int);
       MPI_File_read_at(fhw, disp, Restart_Meta_Passive, 8, MPI_DOUBLE, MPI_STATUS_IGNORE);
 
 		}
@@ -2701,7 +4737,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
 		for (unsigned short iVar = 0; iVar < 8; iVar++)
 			Restart_Meta[iVar] = Restart_Meta_Passive[iVar];
 
-		SU2_MPI::Bcast(Restart_Meta, 8, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
+		SU2_MPI::Bcast(Restart_Meta, 8, MPI_SU2DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
 
 		/*--- All ranks close the file after writing. ---*/
 
@@ -2719,6 +4755,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
   dCMx_dCL_  = Restart_Meta[4];
   dCMy_dCL_  = Restart_Meta[5];
   dCMz_dCL_  = Restart_Meta[6];
+  TimeAvg_Samples_ = (unsigned long)SU2_TYPE::Int(Restart_Meta[7]);
 
 	} else {
 
@@ -2752,7 +4789,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2790,7 +4827,7 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -2858,6 +4895,13 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
 					text_line.erase (0,17); BCThrust_ = atof(text_line.c_str());
 				}
 
+				/*--- Number of time steps in the flow statistics ---*/
+
+				position = text_line.find ("TIME_AVG_SAMPLES=",0);
+				if (position != string::npos) {
+					text_line.erase (0,17); TimeAvg_Samples_ = atol(text_line.c_str());
+				}
+
 				if (adjoint_run) {
 
 					if (config->GetEval_dOF_dCX() == true) {
@@ -2952,6 +4996,11 @@ void CSolver::Read_SU2_Restart_Metadata(CGeometry *geometry, CConfig *config, bo
 				cout <<"WARNING: Discarding the BC Thrust in the solution file." << endl;
 		}
 
+		/*--- Number of time steps in the flow statistics, the statistics
+		 themselves are read back by LoadRestart. ---*/
+
+		nTimeAvg_Samples = config->GetWrt_Time_Average()? TimeAvg_Samples_ : 0;
+
 
 		/*--- The adjoint problem needs this information from the direct solution ---*/
 
@@ -3183,7 +5232,7 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
   unsigned short iDim, iVar, iMesh, iMarker, jMarker;
   unsigned long iPoint, iVertex, index, iChildren, Point_Fine, iRow;
-  su2double Area_Children, Area_Parent, *Coord, dist, min_dist;
+  su2double Area_Children, Area_Parent, *Coord, min_dist;
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool time_stepping = config->GetUnsteady_Simulation() == TIME_STEPPING;
@@ -3260,35 +5309,53 @@ void CSolver::LoadInletProfile(CGeometry **geometry,
 
             Marker_Counter++;
 
-            /*--- Loop through the nodes on this marker. ---*/
+            /*--- Find the closest point in our inlet profile data for all the
+             nodes on this marker at once. The rows of the marker are stored in a
+             local ADT and the nodes are searched along a space filling curve. ---*/
 
-            for (iVertex = 0; iVertex < geometry[MESH_0]->nVertex[iMarker]; iVertex++) {
+            const unsigned long nVertex_Marker = geometry[MESH_0]->nVertex[iMarker];
+            const unsigned long nRow_Marker    = nRowCum_InletFile[jMarker+1] - nRowCum_InletFile[jMarker];
 
-              iPoint   = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
-              Coord    = geometry[MESH_0]->node[iPoint]->GetCoord();
-              min_dist = 1e16;
+            vector<su2double> Vertex_Dist(nVertex_Marker, 1e16);
+            vector<unsigned long> Vertex_Row(nVertex_Marker, 0);
+
+            if ((nVertex_Marker > 0) && (nRow_Marker > 0)) {
 
-              /*--- Find the distance to the closest point in our inlet profile data. ---*/
+              vector<su2double> Row_Coord(nRow_Marker*nDim), Vertex_Coord(nVertex_Marker*nDim);
+              vector<unsigned long> Row_ID(nRow_Marker);
+              vector<int> Vertex_Rank(nVertex_Marker);
 
-              for (iRow = nRowCum_InletFile[jMarker]; iRow < nRowCum_InletFile[jMarker+1]; iRow++) {
+              for (iRow = 0; iRow < nRow_Marker; iRow++) {
+                index = (nRowCum_InletFile[jMarker]+iRow)*maxCol_InletFile;
+                for (iDim = 0; iDim < nDim; iDim++)
+                  Row_Coord[iRow*nDim+iDim] = Inlet_Data[index+iDim];
+                Row_ID[iRow] = nRowCum_InletFile[jMarker]+iRow;
+              }
 
-                /*--- Get the coords for this data point. ---*/
+              for (iVertex = 0; iVertex < nVertex_Marker; iVertex++) {
+                iPoint = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+                Coord  = geometry[MESH_0]->node[iPoint]->GetCoord();
+                for (iDim = 0; iDim < nDim; iDim++)
+                  Vertex_Coord[iVertex*nDim+iDim] = Coord[iDim];
+              }
 
-                index = iRow*maxCol_InletFile;
+              CADTPointsOnlyClass InletADT(nDim, nRow_Marker, Row_Coord.data(), Row_ID.data(), false);
+              InletADT.DetermineNearestNodes(nVertex_Marker, Vertex_Coord.data(), Vertex_Dist.data(),
+                                             Vertex_Row.data(), Vertex_Rank.data());
+            }
 
-                dist = 0.0;
-                for (unsigned short iDim = 0; iDim < nDim; iDim++)
-                  dist += pow(Inlet_Data[index+iDim] - Coord[iDim], 2);
-                dist = sqrt(dist);
+            /*--- Loop through the nodes on this marker. ---*/
 
-                /*--- Check is this is the closest point and store data if so. ---*/
+            for (iVertex = 0; iVertex < nVertex_Marker; iVertex++) {
 
-                if (dist < min_dist) {
-                  min_dist = dist;
-                  for (iVar = 0; iVar < maxCol_InletFile; iVar++)
-                    Inlet_Values[iVar] = Inlet_Data[index+iVar];
-                }
+              iPoint   = geometry[MESH_0]->vertex[iMarker][iVertex]->GetNode();
+              Coord    = geometry[MESH_0]->node[iPoint]->GetCoord();
+              min_dist = Vertex_Dist[iVertex];
 
+              if (nRow_Marker > 0) {
+                index = Vertex_Row[iVertex]*maxCol_InletFile;
+                for (iVar = 0; iVar < maxCol_InletFile; iVar++)
+                  Inlet_Values[iVar] = Inlet_Data[index+iVar];
               }
 
               /*--- If the diff is less than the tolerance, match the two.
@@ -3562,7 +5629,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3605,7 +5672,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532) {
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3655,7 +5722,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3693,7 +5760,7 @@ void CBaselineSolver::SetOutputVariables(CGeometry *geometry, CConfig *config) {
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532) {
+    if ((magic_number == 535532) || (magic_number == 535533)) {
       SU2_MPI::Error(string("File ") + string(fname) + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -3793,8 +5860,8 @@ void CBaselineSolver::Set_MPI_Solution(CGeometry *geometry, CConfig *config) {
       
       /*--- Send/Receive information using Sendrecv ---*/
       
-      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_DOUBLE, send_to, 0,
-                   Buffer_Receive_U, nBufferR_Vector, MPI_DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
+      SU2_MPI::Sendrecv(Buffer_Send_U, nBufferS_Vector, MPI_SU2DOUBLE, send_to, 0,
+                   Buffer_Receive_U, nBufferR_Vector, MPI_SU2DOUBLE, receive_from, 0, MPI_COMM_WORLD, &status);
       
 #else
       
@@ -4277,7 +6344,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4320,7 +6387,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (var_buf[0] != 535532)
+    if ((var_buf[0] != 535532) && (var_buf[0] != 535533))
       SU2_MPI::Error(string("File ") + filename + string(" is not a binary SU2 restart file.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4367,7 +6434,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == 535533))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
@@ -4405,7 +6472,7 @@ void CBaselineSolver_FEM::SetOutputVariables(CGeometry *geometry, CConfig *confi
     /*--- Check that this is an SU2 binary file. SU2 binary files
      have the hex representation of "SU2" as the first int in the file. ---*/
 
-    if (magic_number == 535532)
+    if ((magic_number == 535532) || (magic_number == 535533))
       SU2_MPI::Error(string("File ") + filename + string(" is a binary SU2 restart file, expected ASCII.\n") +
                      string("SU2 reads/writes binary restart files by default.\n") +
                      string("Note that backward compatibility for ASCII restart files is\n") +
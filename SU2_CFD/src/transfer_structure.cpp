@@ -98,6 +98,190 @@ CTransfer::~CTransfer(void) {
   
 }
 
+bool CTransfer::Check_InterfacePlan(CGeometry *target_geometry, int Marker_Target, unsigned short iMarkerInt) {
+
+  unsigned long iVertex, Point_Target, iSlot = 0;
+  unsigned short iDonorPoint, nDonorPoints;
+  int changed = 0;
+
+  if (InterfacePlan.size() <= iMarkerInt) InterfacePlan.resize(iMarkerInt+1);
+  const CInterfacePlan &plan = InterfacePlan[iMarkerInt];
+
+  if (!plan.ready) changed = 1;
+
+  /*--- Compare the donor slots of the owned target vertices with the ones of the plan ---*/
+  if ((changed == 0) && (Marker_Target >= 0)) {
+    for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target) && (changed == 0); iVertex++) {
+      Point_Target = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+      if (!target_geometry->node[Point_Target]->GetDomain()) continue;
+
+      nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
+      for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++, iSlot++) {
+        if ((iSlot >= plan.slotPoint.size()) ||
+            (plan.slotProc[iSlot]  != target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorProcessor(iDonorPoint)) ||
+            (plan.slotPoint[iSlot] != (unsigned long) target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonorPoint))) {
+          changed = 1;
+          break;
+        }
+      }
+    }
+  }
+  if (iSlot != plan.slotPoint.size()) changed = 1;
+
+#ifdef HAVE_MPI
+  int changedLocal = changed;
+  SU2_MPI::Allreduce(&changedLocal, &changed, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#endif
+
+  return (changed == 0);
+}
+
+void CTransfer::Build_InterfacePlan(CGeometry *donor_geometry, CGeometry *target_geometry,
+                                    int Marker_Donor, int Marker_Target, unsigned short iMarkerInt) {
+
+  unsigned long iVertex, iPoint, iSlot, nSlot, iRequest;
+  unsigned short iDonorPoint, nDonorPoints;
+  int iRank, iProc;
+  size_t iSend;
+
+  if (InterfacePlan.size() <= iMarkerInt) InterfacePlan.resize(iMarkerInt+1);
+  CInterfacePlan &plan = InterfacePlan[iMarkerInt];
+
+  /*--- Donor slots of the owned target vertices, in the order in which they are recovered ---*/
+
+  plan.slotProc.clear();
+  plan.slotPoint.clear();
+
+  if (Marker_Target >= 0) {
+    for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
+      iPoint = target_geometry->vertex[Marker_Target][iVertex]->GetNode();
+      if (!target_geometry->node[iPoint]->GetDomain()) continue;
+
+      nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
+      for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++) {
+        plan.slotProc.push_back(target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorProcessor(iDonorPoint));
+        plan.slotPoint.push_back(target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonorPoint));
+      }
+    }
+  }
+  nSlot = plan.slotPoint.size();
+
+  /*--- Donor points requested from each rank, each point is requested only once ---*/
+
+  vector<map<unsigned long, unsigned long> > requested(size);
+  for (iSlot = 0; iSlot < nSlot; iSlot++) {
+    if ((plan.slotProc[iSlot] < 0) || (plan.slotProc[iSlot] >= size))
+      SU2_MPI::Error("Invalid donor processor of an interface vertex.", CURRENT_FUNCTION);
+    map<unsigned long, unsigned long> &requestedRank = requested[plan.slotProc[iSlot]];
+    requestedRank.insert(make_pair(plan.slotPoint[iSlot], (unsigned long) requestedRank.size()));
+  }
+
+  vector<int> nRequest(size), nRequested(size);
+  for (iRank = 0; iRank < size; iRank++) nRequest[iRank] = requested[iRank].size();
+
+#ifdef HAVE_MPI
+  SU2_MPI::Alltoall(nRequest.data(), 1, MPI_INT, nRequested.data(), 1, MPI_INT, MPI_COMM_WORLD);
+#else
+  nRequested = nRequest;
+#endif
+
+  /*--- Receive side, the values of each donor rank are stored contiguously ---*/
+
+  vector<unsigned long> rankOffset(size, 0);
+  plan.recvRank.clear();
+  plan.recvStart.assign(1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nRequest[iRank] == 0) continue;
+    rankOffset[iRank] = plan.recvStart.back();
+    plan.recvRank.push_back(iRank);
+    plan.recvStart.push_back(plan.recvStart.back() + nRequest[iRank]);
+  }
+
+  plan.slotIndex.resize(nSlot);
+  for (iSlot = 0; iSlot < nSlot; iSlot++) {
+    iProc = plan.slotProc[iSlot];
+    plan.slotIndex[iSlot] = rankOffset[iProc] + requested[iProc][plan.slotPoint[iSlot]];
+  }
+
+  vector<unsigned long> requestBuf(plan.recvStart.back());
+  map<unsigned long, unsigned long>::const_iterator MI;
+  for (iRank = 0; iRank < size; iRank++)
+    for (MI = requested[iRank].begin(); MI != requested[iRank].end(); MI++)
+      requestBuf[rankOffset[iRank] + MI->second] = MI->first;
+
+  /*--- Send side, exchange the requested global indices ---*/
+
+  plan.sendRank.clear();
+  plan.sendStart.assign(1, 0);
+  for (iRank = 0; iRank < size; iRank++) {
+    if (nRequested[iRank] == 0) continue;
+    plan.sendRank.push_back(iRank);
+    plan.sendStart.push_back(plan.sendStart.back() + nRequested[iRank]);
+  }
+
+  vector<unsigned long> requestedBuf(plan.sendStart.back());
+
+  for (iSend = 0; iSend < plan.sendRank.size(); iSend++) {
+    if (plan.sendRank[iSend] != rank) continue;
+    for (iRequest = 0; iRequest < (unsigned long) nRequest[rank]; iRequest++)
+      requestedBuf[plan.sendStart[iSend] + iRequest] = requestBuf[rankOffset[rank] + iRequest];
+  }
+
+#ifdef HAVE_MPI
+  size_t iRecv;
+  vector<SU2_MPI::Request> commReqs;
+  commReqs.reserve(plan.sendRank.size() + plan.recvRank.size());
+
+  for (iSend = 0; iSend < plan.sendRank.size(); iSend++) {
+    if (plan.sendRank[iSend] == rank) continue;
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Irecv(&requestedBuf[plan.sendStart[iSend]], plan.sendStart[iSend+1]-plan.sendStart[iSend],
+                   MPI_UNSIGNED_LONG, plan.sendRank[iSend], plan.sendRank[iSend], MPI_COMM_WORLD, &commReqs.back());
+  }
+  for (iRecv = 0; iRecv < plan.recvRank.size(); iRecv++) {
+    if (plan.recvRank[iRecv] == rank) continue;
+    commReqs.push_back(SU2_MPI::Request());
+    SU2_MPI::Isend(&requestBuf[plan.recvStart[iRecv]], plan.recvStart[iRecv+1]-plan.recvStart[iRecv],
+                   MPI_UNSIGNED_LONG, plan.recvRank[iRecv], rank, MPI_COMM_WORLD, &commReqs.back());
+  }
+
+  if (!commReqs.empty())
+    SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
+#endif
+
+  /*--- Map the requested global indices to the owned donor vertices, the values of
+        a vertex requested by several ranks are evaluated only once ---*/
+
+  map<unsigned long, unsigned long> ownedVertex, donorPosition;
+  map<unsigned long, unsigned long>::iterator MJ;
+
+  if (Marker_Donor >= 0) {
+    for (iVertex = 0; iVertex < donor_geometry->GetnVertex(Marker_Donor); iVertex++) {
+      iPoint = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+      if (donor_geometry->node[iPoint]->GetDomain())
+        ownedVertex[donor_geometry->node[iPoint]->GetGlobalIndex()] = iVertex;
+    }
+  }
+
+  plan.donorVertex.clear();
+  plan.sendIndex.resize(requestedBuf.size());
+
+  for (iRequest = 0; iRequest < requestedBuf.size(); iRequest++) {
+    MI = ownedVertex.find(requestedBuf[iRequest]);
+    if (MI == ownedVertex.end())
+      SU2_MPI::Error("Requested donor point is not owned by this rank.", CURRENT_FUNCTION);
+
+    MJ = donorPosition.find(requestedBuf[iRequest]);
+    if (MJ == donorPosition.end()) {
+      MJ = donorPosition.insert(make_pair(requestedBuf[iRequest], (unsigned long) plan.donorVertex.size())).first;
+      plan.donorVertex.push_back(MI->second);
+    }
+    plan.sendIndex[iRequest] = MJ->second;
+  }
+
+  plan.ready = true;
+}
+
 void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target_solution,
                                         CGeometry *donor_geometry, CGeometry *target_geometry,
                                         CConfig *donor_config, CConfig *target_config) {
@@ -108,51 +292,27 @@ void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target
   int Marker_Donor, Marker_Target;
   int Target_check, Donor_check;
   
-  unsigned long iVertex;                            // Variables for iteration over vertices and nodes
+  unsigned long iVertex, iDonor, iValue, iSlot;     // Variables for iteration over vertices and nodes
+  size_t iSend, iRecv;
   
   unsigned short iVar;
   
   GetPhysical_Constants(donor_solution, target_solution, donor_geometry, target_geometry,
                         donor_config, target_config);
   
-  unsigned long Point_Donor_Global, Donor_Global_Index;
   unsigned long Point_Donor, Point_Target;
   
-#ifdef HAVE_MPI
-  int *Buffer_Recv_mark = NULL, iRank;
-
-  if (rank == MASTER_NODE) 
-    Buffer_Recv_mark = new int[size];
-#endif
-  
-  unsigned long Buffer_Send_nVertexDonor[1], *Buffer_Recv_nVertexDonor;
-  unsigned long iLocalVertex = 0;
-  unsigned long nLocalVertexDonor = 0, nLocalVertexDonorOwned = 0;
-  
-  unsigned long MaxLocalVertexDonor = 0, TotalVertexDonor = 0;
-  
-  unsigned long nBuffer_DonorVariables = 0;
-  unsigned long nBuffer_DonorIndices = 0;
-  
-  unsigned long nBuffer_BcastVariables = 0, nBuffer_BcastIndices = 0;
-  
-  int nProcessor = 0;
-  
   /*--- Number of markers on the FSI interface ---*/
   
   nMarkerInt     = (donor_config->GetMarker_n_ZoneInterface())/2;
   nMarkerTarget  = target_config->GetnMarker_All();
   nMarkerDonor   = donor_config->GetnMarker_All();
   
-  nProcessor = size;
-  
   /*--- Outer loop over the markers on the FSI interface: compute one by one ---*/
   /*--- The tags are always an integer greater than 1: loop from 1 to nMarkerFSI ---*/
   
   for (iMarkerInt = 1; iMarkerInt <= nMarkerInt; iMarkerInt++) {
     
-    Buffer_Recv_nVertexDonor = NULL;
-    
     Marker_Donor = -1;
     Marker_Target = -1;
     
@@ -185,181 +345,80 @@ void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target
       }
     }
     
-    #ifdef HAVE_MPI
+    /*--- Determine if the boundary is not on the processor because of the partition or because the zone does not include it  ---*/
+
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&Marker_Donor,  &Donor_check,  1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&Marker_Target, &Target_check, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+#else
+    Donor_check  = Marker_Donor;
+    Target_check = Marker_Target;   
+#endif
 
-    Donor_check  = -1;
-    Target_check = -1;
+    if(Target_check == -1 || Donor_check == -1) {
+      continue;
+    }
 
-    /*--- We gather a vector in MASTER_NODE that determines if the boundary is not on the processor because of the partition or because the zone does not include it  ---*/
+    /*--- The plan is only rebuilt when the interpolation has changed the donor information ---*/
 
-    SU2_MPI::Gather(&Marker_Donor , 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    if (!Check_InterfacePlan(target_geometry, Marker_Target, iMarkerInt))
+      Build_InterfacePlan(donor_geometry, target_geometry, Marker_Donor, Marker_Target, iMarkerInt);
 
-    if (rank == MASTER_NODE) {
-      for (iRank = 0; iRank < nProcessor; iRank++) {
-        if( Buffer_Recv_mark[iRank] != -1 ) {
-          Donor_check = Buffer_Recv_mark[iRank];
-          break;
-        }       
-      }
-    }
+    const CInterfacePlan &plan = InterfacePlan[iMarkerInt];
 
-    SU2_MPI::Bcast(&Donor_check , 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    /*--- Evaluate the donor variables of the requested vertices ---*/
 
-    SU2_MPI::Gather(&Marker_Target, 1, MPI_INT, Buffer_Recv_mark, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    vector<su2double> donorValues(plan.donorVertex.size()*nVar);
 
-    if (rank == MASTER_NODE) {
-      for (iRank = 0; iRank < nProcessor; iRank++) {
-        if( Buffer_Recv_mark[iRank] != -1 ) {
-          Target_check = Buffer_Recv_mark[iRank];
-          break;
-        }   
-      }
+    for (iDonor = 0; iDonor < plan.donorVertex.size(); iDonor++) {
+      iVertex = plan.donorVertex[iDonor];
+      Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
+
+      GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
+
+      for (iVar = 0; iVar < nVar; iVar++)
+        donorValues[iDonor*nVar+iVar] = Donor_Variable[iVar];
     }
 
-    SU2_MPI::Bcast(&Target_check, 1, MPI_INT, MASTER_NODE, MPI_COMM_WORLD);
+    /*--- Pack the values for each requesting rank and exchange them point-to-point ---*/
 
-    #else
-    Donor_check  = Marker_Donor;
-    Target_check = Marker_Target;   
-    #endif
+    vector<su2double> Buffer_Send_DonorVariables(plan.sendStart.back()*nVar);
+    vector<su2double> Buffer_Recv_DonorVariables(plan.recvStart.back()*nVar);
 
-    if(Target_check == -1 || Donor_check == -1) {
-      continue;
-    }
+    for (iValue = 0; iValue < plan.sendIndex.size(); iValue++)
+      for (iVar = 0; iVar < nVar; iVar++)
+        Buffer_Send_DonorVariables[iValue*nVar+iVar] = donorValues[plan.sendIndex[iValue]*nVar+iVar];
 
-    nLocalVertexDonorOwned = 0;
-    nLocalVertexDonor      = 0;
-    
-    if( Marker_Donor != -1 ) {
-        nLocalVertexDonor = donor_geometry->GetnVertex(Marker_Donor);
-    
-        for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-              Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
-              if (donor_geometry->node[Point_Donor]->GetDomain())
-                nLocalVertexDonorOwned++;
-            }
+    for (iSend = 0; iSend < plan.sendRank.size(); iSend++) {
+      if (plan.sendRank[iSend] != rank) continue;
+      for (iRecv = 0; iRecv < plan.recvRank.size(); iRecv++) {
+        if (plan.recvRank[iRecv] != rank) continue;
+        for (iValue = 0; iValue < (plan.sendStart[iSend+1]-plan.sendStart[iSend])*nVar; iValue++)
+          Buffer_Recv_DonorVariables[plan.recvStart[iRecv]*nVar+iValue] = Buffer_Send_DonorVariables[plan.sendStart[iSend]*nVar+iValue];
+      }
     }
-    
-    Buffer_Send_nVertexDonor[0] = nLocalVertexDonor;                   // Retrieve total number of vertices on Donor marker
 
-    if (rank == MASTER_NODE) Buffer_Recv_nVertexDonor = new unsigned long[size];   // Allocate memory to receive how many vertices are on each rank on the structural side
-    
 #ifdef HAVE_MPI
-    /*--- We receive MaxLocalVertexDonor as the maximum number of vertices in one single processor on the donor side---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonor, &MaxLocalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_MAX, MPI_COMM_WORLD);
-    /*--- We receive TotalVertexDonorOwned as the total (real) number of vertices in one single interface marker on the donor side ---*/
-    SU2_MPI::Allreduce(&nLocalVertexDonorOwned, &TotalVertexDonor, 1, MPI_UNSIGNED_LONG, MPI_SUM, MPI_COMM_WORLD);
-    /*--- We gather a vector in MASTER_NODE that determines how many elements are there on each processor on the structural side ---*/
-    SU2_MPI::Gather(&Buffer_Send_nVertexDonor, 1, MPI_UNSIGNED_LONG, Buffer_Recv_nVertexDonor, 1, MPI_UNSIGNED_LONG, MASTER_NODE, MPI_COMM_WORLD);
-#else
-    MaxLocalVertexDonor         = nLocalVertexDonor;
-    TotalVertexDonor            = nLocalVertexDonorOwned;
-    Buffer_Recv_nVertexDonor[0] = Buffer_Send_nVertexDonor[0];
-#endif
-    
-    /*--- We will be gathering the donor information into the master node ---*/
-    nBuffer_DonorVariables = MaxLocalVertexDonor * nVar;
-    nBuffer_DonorIndices   = MaxLocalVertexDonor;
-    
-    /*--- Then we will broadcasting it to all the processors so they can retrieve the info they need ---*/
-    /*--- We only broadcast those nodes that we need ---*/
-    nBuffer_BcastVariables = TotalVertexDonor * nVar;
-    nBuffer_BcastIndices   = TotalVertexDonor;
-    
-    /*--- Send and Recv buffers ---*/
-    
-    /*--- Buffers to send and receive the variables in the donor mesh ---*/
-    su2double *Buffer_Send_DonorVariables = new su2double[nBuffer_DonorVariables];
-    su2double *Buffer_Recv_DonorVariables = NULL;
-    
-    /*--- Buffers to send and receive the indices in the donor mesh ---*/
-    long *Buffer_Send_DonorIndices = new long[nBuffer_DonorIndices];
-    long *Buffer_Recv_DonorIndices = NULL;
-    
-    /*--- Buffers to broadcast the variables and the indices ---*/
-    su2double *Buffer_Bcast_Variables = new su2double[nBuffer_BcastVariables];
-    long *Buffer_Bcast_Indices        = new long[nBuffer_BcastIndices];
-    
-    /*--- Prepare the receive buffers (1st step) and send buffers (2nd step) on the master node only. ---*/
-    
-    if (rank == MASTER_NODE) {
-      Buffer_Recv_DonorVariables  = new su2double[size*nBuffer_DonorVariables];
-      Buffer_Recv_DonorIndices    = new long[size*nBuffer_DonorIndices];
+    vector<SU2_MPI::Request> commReqs;
+    commReqs.reserve(plan.sendRank.size() + plan.recvRank.size());
+
+    for (iRecv = 0; iRecv < plan.recvRank.size(); iRecv++) {
+      if (plan.recvRank[iRecv] == rank) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Irecv(&Buffer_Recv_DonorVariables[plan.recvStart[iRecv]*nVar], (plan.recvStart[iRecv+1]-plan.recvStart[iRecv])*nVar,
+                     MPI_SU2DOUBLE, plan.recvRank[iRecv], plan.recvRank[iRecv], MPI_COMM_WORLD, &commReqs.back());
     }
-    
-    /*--- On the donor side ---*/
-    /*--- First we initialize all of the indices and processors to -1 ---*/
-    /*--- This helps on identifying halo nodes and avoids setting wrong values ---*/
-    for (iVertex = 0; iVertex < nBuffer_DonorIndices; iVertex++)
-      Buffer_Send_DonorIndices[iVertex] = -1;
-    
-
-    for (iVertex = 0; iVertex < nLocalVertexDonor; iVertex++) {
-    Point_Donor = donor_geometry->vertex[Marker_Donor][iVertex]->GetNode();
-    
-    /*--- If this processor owns the node ---*/
-        
-    if (donor_geometry->node[Point_Donor]->GetDomain()) {
-    
-        GetDonor_Variable(donor_solution, donor_geometry, donor_config, Marker_Donor, iVertex, Point_Donor);
-    
-        for (iVar = 0; iVar < nVar; iVar++) 
-            Buffer_Send_DonorVariables[iVertex*nVar+iVar] = Donor_Variable[iVar];
-        
-        Point_Donor_Global = donor_geometry->node[Point_Donor]->GetGlobalIndex();
-        Buffer_Send_DonorIndices[iVertex]     = Point_Donor_Global;
+    for (iSend = 0; iSend < plan.sendRank.size(); iSend++) {
+      if (plan.sendRank[iSend] == rank) continue;
+      commReqs.push_back(SU2_MPI::Request());
+      SU2_MPI::Isend(&Buffer_Send_DonorVariables[plan.sendStart[iSend]*nVar], (plan.sendStart[iSend+1]-plan.sendStart[iSend])*nVar,
+                     MPI_SU2DOUBLE, plan.sendRank[iSend], rank, MPI_COMM_WORLD, &commReqs.back());
     }
 
-    }
-      
-#ifdef HAVE_MPI
-    /*--- Once all the messages have been prepared, we gather them all into the MASTER_NODE ---*/
-    SU2_MPI::Gather(Buffer_Send_DonorVariables, nBuffer_DonorVariables, MPI_DOUBLE, Buffer_Recv_DonorVariables, nBuffer_DonorVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Gather(Buffer_Send_DonorIndices, nBuffer_DonorIndices, MPI_LONG, Buffer_Recv_DonorIndices, nBuffer_DonorIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
-    
-#else
-    for (unsigned long iVariable = 0; iVariable < nBuffer_DonorVariables; iVariable++)
-      Buffer_Recv_DonorVariables[iVariable] = Buffer_Send_DonorVariables[iVariable];
-    for (unsigned long iVariable = 0; iVariable < nBuffer_DonorIndices; iVariable++)
-      Buffer_Recv_DonorIndices[iVariable] = Buffer_Send_DonorIndices[iVariable];
+    if (!commReqs.empty())
+      SU2_MPI::Waitall(commReqs.size(), commReqs.data(), MPI_STATUSES_IGNORE);
 #endif
-    
-    /*--- Now we pack the information to send it over to the different processors ---*/
-    
-    if (rank == MASTER_NODE) {
 
-        /*--- For all the data we have received ---*/
-        /*--- We initialize a counter to determine the position in the broadcast vector ---*/
-        iLocalVertex = 0;
-      
-        for (iVertex = 0; iVertex < nProcessor*nBuffer_DonorIndices; iVertex++) {
-        
-            /*--- If the donor index is not -1 (this is, if the node is not originally a halo node) ---*/
-            if (Buffer_Recv_DonorIndices[iVertex] != -1) {
-          
-                /*--- We set the donor index ---*/
-                Buffer_Bcast_Indices[iLocalVertex] = Buffer_Recv_DonorIndices[iVertex];
-          
-                for (iVar = 0; iVar < nVar; iVar++)
-                    Buffer_Bcast_Variables[iLocalVertex*nVar+iVar] = Buffer_Recv_DonorVariables[iVertex*nVar + iVar];
-                
-          
-                iLocalVertex++;
-          
-            }
-        
-            if (iLocalVertex == TotalVertexDonor) break;
-        
-        }
-      
-    }
-    
-#ifdef HAVE_MPI
-    SU2_MPI::Bcast(Buffer_Bcast_Variables, nBuffer_BcastVariables, MPI_DOUBLE, MASTER_NODE, MPI_COMM_WORLD);
-    SU2_MPI::Bcast(Buffer_Bcast_Indices, nBuffer_BcastIndices, MPI_LONG, MASTER_NODE, MPI_COMM_WORLD);
-#endif
-
-    long indexPoint_iVertex;
     unsigned short iDonorPoint, nDonorPoints;
     su2double donorCoeff;
 
@@ -368,6 +427,8 @@ void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target
       
       /*--- We have identified the local index of the Structural marker ---*/
       /*--- We loop over all the vertices in that marker and in that particular processor ---*/
+
+      iSlot = 0;
       
       for (iVertex = 0; iVertex < target_geometry->GetnVertex(Marker_Target); iVertex++) {
         
@@ -375,26 +436,18 @@ void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target
 
         /*--- If this processor owns the node ---*/
         if (target_geometry->node[Point_Target]->GetDomain()) {
-          TotalVertexDonor++;
           nDonorPoints = target_geometry->vertex[Marker_Target][iVertex]->GetnDonorPoints();
           
           InitializeTarget_Variable(target_solution, Marker_Target, iVertex, nDonorPoints);
           
           /*--- For the number of donor points ---*/
-          for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++) {
-            
-            /*--- Find the global index of the donor points for Point_Target ---*/
-            Donor_Global_Index = target_geometry->vertex[Marker_Target][iVertex]->GetInterpDonorPoint(iDonorPoint);
+          for (iDonorPoint = 0; iDonorPoint < nDonorPoints; iDonorPoint++, iSlot++) {
             
             /*--- We need to get the donor coefficient in a way like this: ---*/
             donorCoeff = target_geometry->vertex[Marker_Target][iVertex]->GetDonorCoeff(iDonorPoint);
             
-            /*--- Find the index of the global donor point in the buffer Buffer_Bcast_Indices ---*/
-           
-            indexPoint_iVertex = std::distance(Buffer_Bcast_Indices, std::find(Buffer_Bcast_Indices, Buffer_Bcast_Indices + nBuffer_BcastIndices, Donor_Global_Index));
-           
-            /*--- Recover the Target_Variable from the buffer of variables ---*/
-            RecoverTarget_Variable(indexPoint_iVertex, Buffer_Bcast_Variables, donorCoeff);
+            /*--- Recover the Target_Variable from the position of the donor point in the receive buffer ---*/
+            RecoverTarget_Variable(plan.slotIndex[iSlot], Buffer_Recv_DonorVariables.data(), donorCoeff);
 
             /*--- If the value is not directly aggregated in the previous function ---*/
             if (!valAggregated) SetTarget_Variable(target_solution, target_geometry, target_config, Marker_Target, iVertex, Point_Target);
@@ -408,24 +461,9 @@ void CTransfer::Broadcast_InterfaceData(CSolver *donor_solution, CSolver *target
       }
       
     }
-
-    delete [] Buffer_Send_DonorVariables;
-    delete [] Buffer_Send_DonorIndices;
-    delete [] Buffer_Bcast_Variables;
-    delete [] Buffer_Bcast_Indices;
-    
-    if (rank == MASTER_NODE) {
-      delete [] Buffer_Recv_nVertexDonor;
-      delete [] Buffer_Recv_DonorVariables;
-      delete [] Buffer_Recv_DonorIndices;
-    }
       
   }
   
-  #ifdef HAVE_MPI
-  if (rank == MASTER_NODE && Buffer_Recv_mark != NULL) 
-    delete [] Buffer_Recv_mark;
-  #endif
 }
 
 void CTransfer::Preprocessing_InterfaceAverage(CGeometry *donor_geometry, CGeometry *target_geometry,
@@ -579,9 +617,7 @@ void CTransfer::Allgather_InterfaceAverage(CSolver *donor_solution, CSolver *tar
 
 #ifdef HAVE_MPI
   int iSize;
-  su2double *BuffAvgPressureDonor = NULL, *BuffAvgDensityDonor = NULL, *BuffAvgNormalVelDonor = NULL, *BuffAvg3DVelDonor = NULL,
-      *BuffAvgTangVelDonor = NULL, *BuffAvgNuDonor = NULL, *BuffAvgKineDonor = NULL, *BuffAvgOmegaDonor = NULL;
-  int nSpanSize, *BuffMarkerDonor;
+  unsigned short iVar;
 #endif
 
 
@@ -675,80 +711,37 @@ void CTransfer::Allgather_InterfaceAverage(CSolver *donor_solution, CSolver *tar
   }
 
 #ifdef HAVE_MPI
-  nSpanSize = size*nSpanDonor;
-  BuffAvgDensityDonor                 = new su2double[nSpanSize];
-  BuffAvgPressureDonor                = new su2double[nSpanSize];
-  BuffAvgNormalVelDonor               = new su2double[nSpanSize];
-  BuffAvgTangVelDonor                 = new su2double[nSpanSize];
-  BuffAvg3DVelDonor                   = new su2double[nSpanSize];
-  BuffAvgNuDonor                      = new su2double[nSpanSize];
-  BuffAvgKineDonor                    = new su2double[nSpanSize];
-  BuffAvgOmegaDonor                   = new su2double[nSpanSize];
-  BuffMarkerDonor                     = new int[size];
-
-  for (iSpan=0;iSpan<nSpanSize;iSpan++){
-    BuffAvgDensityDonor[iSpan]        = -1.0;
-    BuffAvgPressureDonor[iSpan]       = -1.0;
-    BuffAvgNormalVelDonor[iSpan]      = -1.0;
-    BuffAvgTangVelDonor[iSpan]        = -1.0;
-    BuffAvg3DVelDonor[iSpan]          = -1.0;
-    BuffAvgNuDonor[iSpan]             = -1.0;
-    BuffAvgKineDonor[iSpan]           = -1.0;
-    BuffAvgOmegaDonor[iSpan]          = -1.0;
-  }
 
-  for (iSize=0; iSize<size;iSize++){
-    BuffMarkerDonor[iSize]            = -1;
-  }
+  /*--- The eight averaged quantities of all the spans and the donor marker are packed in one
+        buffer, such that a single Allgather makes them available on all the processors ---*/
+  const unsigned long nPack = 8*nSpanDonor + 1;
+  su2double *avgDonor[8] = {avgDensityDonor, avgPressureDonor, avgNormalVelDonor, avgTangVelDonor,
+                            avg3DVelDonor, avgNuDonor, avgKineDonor, avgOmegaDonor};
 
-  SU2_MPI::Allgather(avgDensityDonor, nSpanDonor , MPI_DOUBLE, BuffAvgDensityDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgPressureDonor, nSpanDonor , MPI_DOUBLE, BuffAvgPressureDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNormalVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNormalVelDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgTangVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvgTangVelDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avg3DVelDonor, nSpanDonor , MPI_DOUBLE, BuffAvg3DVelDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgNuDonor, nSpanDonor , MPI_DOUBLE, BuffAvgNuDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgKineDonor, nSpanDonor , MPI_DOUBLE, BuffAvgKineDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(avgOmegaDonor, nSpanDonor , MPI_DOUBLE, BuffAvgOmegaDonor, nSpanDonor, MPI_DOUBLE, MPI_COMM_WORLD);
-  SU2_MPI::Allgather(&Marker_Donor, 1 , MPI_INT, BuffMarkerDonor, 1, MPI_INT, MPI_COMM_WORLD);
+  vector<su2double> SendAvgDonor(nPack), BuffAvgDonor(nPack*size, -1.0);
+  for (iVar = 0; iVar < 8; iVar++)
+    for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+      SendAvgDonor[iVar*nSpanDonor + iSpan] = avgDonor[iVar][iSpan];
+  SendAvgDonor[8*nSpanDonor] = Marker_Donor;
 
-  for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-    avgDensityDonor[iSpan]            = -1.0;
-    avgPressureDonor[iSpan]           = -1.0;
-    avgNormalVelDonor[iSpan]          = -1.0;
-    avgTangVelDonor[iSpan]            = -1.0;
-    avg3DVelDonor[iSpan]              = -1.0;
-    avgNuDonor[iSpan]                 = -1.0;
-    avgKineDonor[iSpan]               = -1.0;
-    avgOmegaDonor[iSpan]              = -1.0;
-  }
+  SU2_MPI::Allgather(SendAvgDonor.data(), nPack, MPI_SU2DOUBLE, BuffAvgDonor.data(), nPack, MPI_SU2DOUBLE, MPI_COMM_WORLD);
+
+  for (iVar = 0; iVar < 8; iVar++)
+    for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+      avgDonor[iVar][iSpan] = -1.0;
 
   Marker_Donor= -1;
 
   for (iSize=0; iSize<size;iSize++){
-    if(BuffAvgDensityDonor[nSpanDonor*iSize] > 0.0){
-      for (iSpan = 0; iSpan < nSpanDonor; iSpan++){
-        avgDensityDonor[iSpan]        = BuffAvgDensityDonor[nSpanDonor*iSize + iSpan];
-        avgPressureDonor[iSpan]       = BuffAvgPressureDonor[nSpanDonor*iSize + iSpan];
-        avgNormalVelDonor[iSpan]      = BuffAvgNormalVelDonor[nSpanDonor*iSize + iSpan];
-        avgTangVelDonor[iSpan]        = BuffAvgTangVelDonor[nSpanDonor*iSize + iSpan];
-        avg3DVelDonor[iSpan]          = BuffAvg3DVelDonor[nSpanDonor*iSize + iSpan];
-        avgNuDonor[iSpan]             = BuffAvgNuDonor[nSpanDonor*iSize + iSpan];
-        avgKineDonor[iSpan]           = BuffAvgKineDonor[nSpanDonor*iSize + iSpan];
-        avgOmegaDonor[iSpan]          = BuffAvgOmegaDonor[nSpanDonor*iSize + iSpan];
-      }
-      Marker_Donor                    = BuffMarkerDonor[iSize];
+    const su2double *RankAvgDonor = &BuffAvgDonor[nPack*iSize];
+    if(RankAvgDonor[0] > 0.0){
+      for (iVar = 0; iVar < 8; iVar++)
+        for (iSpan = 0; iSpan < nSpanDonor; iSpan++)
+          avgDonor[iVar][iSpan] = RankAvgDonor[iVar*nSpanDonor + iSpan];
+      Marker_Donor = SU2_TYPE::Int(RankAvgDonor[8*nSpanDonor]);
       break;
     }
   }
-  delete [] BuffAvgDensityDonor;
-  delete [] BuffAvgPressureDonor;
-  delete [] BuffAvgNormalVelDonor;
-  delete [] BuffAvgTangVelDonor;
-  delete [] BuffAvg3DVelDonor;
-  delete [] BuffAvgNuDonor;
-  delete [] BuffAvgKineDonor;
-  delete [] BuffAvgOmegaDonor;
-  delete [] BuffMarkerDonor;
 
 #endif
 
@@ -41,6 +41,8 @@ CEulerVariable::CEulerVariable(void) : CVariable() {
   
   /*--- Array initialization ---*/
   
+  LocalCFL_Factor = 1.0;
+
   HB_Source = NULL;
   Primitive = NULL;
   Secondary = NULL;
@@ -76,11 +78,14 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   bool viscous = config->GetViscous();
   bool windgust = config->GetWind_Gust();
   bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT);
+  bool low_storage_rk = (config->GetKind_TimeIntScheme_Flow() == LOW_STORAGE_RK_EXPLICIT);
   bool fsi = config->GetFSI_Simulation();
   bool multizone = config->GetMultizone_Problem();
 
   /*--- Array initialization ---*/
   
+  LocalCFL_Factor = 1.0;
+
   HB_Source = NULL;
   Primitive = NULL;
   Secondary = NULL;
@@ -110,12 +115,13 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   else { nSecondaryVar = 2; nSecondaryVarGrad = 2; }
 
 
-  /*--- Allocate residual structures ---*/
+  /*--- Allocate residual structures, the truncation error is only
+   needed to transfer the forcing term between multigrid levels ---*/
   
-  Res_TruncError = new su2double [nVar];
-  
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Res_TruncError[iVar] = 0.0;
+  if (config->GetnMGLevels() > 0) {
+    Res_TruncError = new su2double [nVar];
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res_TruncError[iVar] = 0.0;
   }
   
   /*--- Only for residual smoothing (multigrid) ---*/
@@ -167,9 +173,9 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   Solution[nVar-1] = val_density*val_energy;
   Solution_Old[nVar-1] = val_density*val_energy;
 
-  /*--- New solution initialization for Classical RK4 ---*/
+  /*--- New solution initialization for Classical RK4, and register of the low-storage RK ---*/
 
-  if (classical_rk4) {
+  if (classical_rk4 || low_storage_rk) {
     Solution_New = new su2double[nVar];
     Solution_New[0] = val_density;
     for (iDim = 0; iDim < nDim; iDim++) {
@@ -217,19 +223,9 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
-  }
+  Gradient_Primitive = AllocateMatrix(nPrimVarGrad, nDim);
 
-  Gradient_Secondary = new su2double* [nSecondaryVarGrad];
-  for (iVar = 0; iVar < nSecondaryVarGrad; iVar++) {
-    Gradient_Secondary[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Secondary[iVar][iDim] = 0.0;
-  }
+  Gradient_Secondary = AllocateMatrix(nSecondaryVarGrad, nDim);
 
   Solution_BGS_k = NULL;
   if (fsi || multizone){
@@ -244,18 +240,21 @@ CEulerVariable::CEulerVariable(su2double val_density, su2double *val_velocity, s
 }
 
 CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim, unsigned short val_nvar, CConfig *config) : CVariable(val_nDim, val_nvar, config) {
-    unsigned short iVar, iDim, iMesh, nMGSmooth = 0;
+    unsigned short iVar, iMesh, nMGSmooth = 0;
   
   bool dual_time = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                     (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
   bool viscous = config->GetViscous();
   bool windgust = config->GetWind_Gust();
   bool classical_rk4 = (config->GetKind_TimeIntScheme_Flow() == CLASSICAL_RK4_EXPLICIT);
+  bool low_storage_rk = (config->GetKind_TimeIntScheme_Flow() == LOW_STORAGE_RK_EXPLICIT);
   bool fsi = config->GetFSI_Simulation();
   bool multizone = config->GetMultizone_Problem();
 
   /*--- Array initialization ---*/
   
+  LocalCFL_Factor = 1.0;
+
   HB_Source = NULL;
   Primitive = NULL;
   Secondary = NULL;
@@ -286,12 +285,13 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   else { nSecondaryVar = 2; nSecondaryVarGrad = 2; }
 
   
-  /*--- Allocate residual structures ---*/
-  
-  Res_TruncError = new su2double [nVar];
+  /*--- Allocate residual structures, the truncation error is only
+   needed to transfer the forcing term between multigrid levels ---*/
   
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Res_TruncError[iVar] = 0.0;
+  if (config->GetnMGLevels() > 0) {
+    Res_TruncError = new su2double [nVar];
+    for (iVar = 0; iVar < nVar; iVar++)
+      Res_TruncError[iVar] = 0.0;
   }
   
   /*--- Only for residual smoothing (multigrid) ---*/
@@ -338,9 +338,9 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
     Solution_Old[iVar] = val_solution[iVar];
   }
 
-  /*--- New solution initialization for Classical RK4 ---*/
+  /*--- New solution initialization for Classical RK4, and register of the low-storage RK ---*/
 
-  if (classical_rk4) {
+  if (classical_rk4 || low_storage_rk) {
     Solution_New = new su2double[nVar];
     for (iVar = 0; iVar < nVar; iVar++) {
       Solution_New[iVar] = val_solution[iVar];
@@ -385,19 +385,9 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
   /*--- Compressible flow, gradients primitive variables nDim+4, (T, vx, vy, vz, P, rho, h)
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
-  }
+  Gradient_Primitive = AllocateMatrix(nPrimVarGrad, nDim);
 
-  Gradient_Secondary = new su2double* [nSecondaryVarGrad];
-  for (iVar = 0; iVar < nSecondaryVarGrad; iVar++) {
-    Gradient_Secondary[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Secondary[iVar][iDim] = 0.0;
-  }
+  Gradient_Secondary = AllocateMatrix(nSecondaryVarGrad, nDim);
   
   Solution_BGS_k = NULL;
   if (fsi || multizone){
@@ -410,7 +400,6 @@ CEulerVariable::CEulerVariable(su2double *val_solution, unsigned short val_nDim,
 }
 
 CEulerVariable::~CEulerVariable(void) {
-    unsigned short iVar;
 
   if (HB_Source         != NULL) delete [] HB_Source;
   if (Primitive         != NULL) delete [] Primitive;
@@ -420,16 +409,8 @@ CEulerVariable::~CEulerVariable(void) {
   if (WindGust          != NULL) delete [] WindGust;
   if (WindGustDer       != NULL) delete [] WindGustDer;
 
-  if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive[iVar] != NULL) delete [] Gradient_Primitive[iVar];
-    delete [] Gradient_Primitive;
-  }
-  if (Gradient_Secondary != NULL) {
-    for (iVar = 0; iVar < nSecondaryVarGrad; iVar++)
-      if (Gradient_Secondary[iVar] != NULL) delete [] Gradient_Secondary[iVar];
-    delete [] Gradient_Secondary;
-  }
+  FreeMatrix(Gradient_Primitive);
+  FreeMatrix(Gradient_Secondary);
 
   if (Undivided_Laplacian != NULL) delete [] Undivided_Laplacian;
 
@@ -518,6 +499,47 @@ bool CEulerVariable::SetPrimVar(CFluidModel *FluidModel) {
   
 }
 
+bool CEulerVariable::SetPrimVar_TDState(su2double val_pressure, su2double val_soundspeed2,
+                                        su2double val_temperature, CFluidModel *FluidModel) {
+  bool check_dens = false, check_press = false, check_sos = false, check_temp = false, RightVol = true;
+
+  /*--- The velocity has already been set by the caller. ---*/
+
+  check_dens = SetDensity();
+  check_press = SetPressure(val_pressure);
+  check_sos = SetSoundSpeed(val_soundspeed2);
+  check_temp = SetTemperature(val_temperature);
+
+  /*--- Check that the solution has a physical meaning. If not, fall back
+        to the standard treatment, which restores the old solution. ---*/
+
+  if (check_dens || check_press || check_sos || check_temp) {
+
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      Solution[iVar] = Solution_Old[iVar];
+
+    SetVelocity();   // Computes velocity and velocity^2
+    su2double density = GetDensity();
+    su2double staticEnergy = GetEnergy()-0.5*Velocity2;
+    FluidModel->SetTDState_rhoe(density, staticEnergy);
+
+    SetDensity();
+    SetPressure(FluidModel->GetPressure());
+    SetSoundSpeed(FluidModel->GetSoundSpeed2());
+    SetTemperature(FluidModel->GetTemperature());
+
+    RightVol = false;
+
+  }
+
+  /*--- Set enthalpy ---*/
+
+  SetEnthalpy();                                // Requires pressure computation.
+
+  return RightVol;
+
+}
+
 void CEulerVariable::SetSecondaryVar(CFluidModel *FluidModel) {
 
    /*--- Compute secondary thermo-physical properties (partial derivatives...) ---*/
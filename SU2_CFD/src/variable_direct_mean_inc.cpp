@@ -164,12 +164,7 @@ CIncEulerVariable::CIncEulerVariable(su2double val_pressure, su2double *val_velo
   /*--- Incompressible flow, gradients primitive variables nDim+4, (P, vx, vy, vz, T, rho, beta)
    * We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
-  }
+  Gradient_Primitive = AllocateMatrix(nPrimVarGrad, nDim);
 
   /*--- If axisymmetric and viscous, we need an auxiliary gradient. ---*/
 
@@ -189,7 +184,7 @@ CIncEulerVariable::CIncEulerVariable(su2double val_pressure, su2double *val_velo
 }
 
 CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val_nDim, unsigned short val_nvar, CConfig *config) : CVariable(val_nDim, val_nvar, config) {
-  unsigned short iVar, iDim, iMesh, nMGSmooth = 0;
+  unsigned short iVar, iMesh, nMGSmooth = 0;
   
   bool dual_time    = ((config->GetUnsteady_Simulation() == DT_STEPPING_1ST) ||
                       (config->GetUnsteady_Simulation() == DT_STEPPING_2ND));
@@ -285,12 +280,7 @@ CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val
   /*--- Incompressible flow, gradients primitive variables nDim+4, (P, vx, vy, vz, T, rho, beta),
         We need P, and rho for running the adjoint problem ---*/
   
-  Gradient_Primitive = new su2double* [nPrimVarGrad];
-  for (iVar = 0; iVar < nPrimVarGrad; iVar++) {
-    Gradient_Primitive[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim++)
-      Gradient_Primitive[iVar][iDim] = 0.0;
-  }
+  Gradient_Primitive = AllocateMatrix(nPrimVarGrad, nDim);
 
   /*--- If axisymmetric and viscous, we need an auxiliary gradient. ---*/
 
@@ -308,16 +298,11 @@ CIncEulerVariable::CIncEulerVariable(su2double *val_solution, unsigned short val
 }
 
 CIncEulerVariable::~CIncEulerVariable(void) {
-  unsigned short iVar;
 
   if (Primitive         != NULL) delete [] Primitive;
   if (Limiter_Primitive != NULL) delete [] Limiter_Primitive;
 
-  if (Gradient_Primitive != NULL) {
-    for (iVar = 0; iVar < nPrimVarGrad; iVar++)
-      if (Gradient_Primitive!=NULL) delete [] Gradient_Primitive[iVar];
-    delete [] Gradient_Primitive;
-  }
+  FreeMatrix(Gradient_Primitive);
 
   if (Undivided_Laplacian != NULL) delete [] Undivided_Laplacian;
   
@@ -37,7 +37,11 @@
 
 #include "../include/variable_structure.hpp"
 
-CTransLMVariable::CTransLMVariable(void) : CTurbVariable() {}
+CTransLMVariable::CTransLMVariable(void) : CTurbVariable() {
+  
+  f_lambda = 1.0;
+  
+}
 
 CTransLMVariable::CTransLMVariable(su2double val_nu_tilde, su2double val_intermittency, su2double val_REth,  unsigned short val_nDim, unsigned short val_nvar, CConfig *config)
 : CTurbVariable(val_nDim, val_nvar, config) {
@@ -46,6 +50,9 @@ CTransLMVariable::CTransLMVariable(su2double val_nu_tilde, su2double val_intermi
   Solution[0] = val_intermittency; Solution_Old[0] = val_intermittency;
   Solution[1] = val_REth;          Solution_Old[1] = val_REth;
   
+  /*--- Cold start of the Re_theta_t correlation (zero pressure gradient) ---*/
+  f_lambda = 1.0;
+  
 }
 
 CTransLMVariable::~CTransLMVariable(void) { }
@@ -93,7 +93,7 @@ CVariable::CVariable(unsigned short val_nvar, CConfig *config) {
 
 CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *config) {
   
-  unsigned short iVar, iDim;
+  unsigned short iVar;
   
   /*--- Array initialization ---*/
   Solution = NULL;
@@ -126,12 +126,7 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 
   Solution_Old = new su2double [nVar];
   
-  Gradient = new su2double* [nVar];
-  for (iVar = 0; iVar < nVar; iVar++) {
-    Gradient[iVar] = new su2double [nDim];
-    for (iDim = 0; iDim < nDim; iDim ++)
-      Gradient[iVar][iDim] = 0.0;
-  }
+  Gradient = AllocateMatrix(nVar, nDim);
   
   if (config->GetUnsteady_Simulation() != NO) {
     Solution_time_n = new su2double [nVar];
@@ -149,7 +144,6 @@ CVariable::CVariable(unsigned short val_nDim, unsigned short val_nvar, CConfig *
 }
 
 CVariable::~CVariable(void) {
-  unsigned short iVar;
 
   if (Solution            != NULL) delete [] Solution;
   if (Solution_Old        != NULL) delete [] Solution_Old;
@@ -165,14 +159,48 @@ CVariable::~CVariable(void) {
   if (Residual_Sum        != NULL) delete [] Residual_Sum;
   if (Solution_Adj_Old    != NULL) delete [] Solution_Adj_Old;
   
-  if (Gradient != NULL) {
-    for (iVar = 0; iVar < nVar; iVar++)
-      delete [] Gradient[iVar];
-    delete [] Gradient;
-  }
+  FreeMatrix(Gradient);
 
 }
 
+static CMemoryPool& VariablePool(void) {
+  static CMemoryPool pool;
+  return pool;
+}
+
+void *CVariable::operator new(size_t size) { return VariablePool().Allocate(size); }
+
+void CVariable::operator delete(void *ptr, size_t size) { VariablePool().Deallocate(ptr, size); }
+
+su2double **CVariable::AllocateMatrix(unsigned short val_nrow, unsigned short val_ncol) {
+  
+  unsigned long iEntry, nEntry = (unsigned long)val_nrow*val_ncol;
+  unsigned short iRow;
+  
+  /*--- The row pointer array has at least one entry, such that the
+   block can always be retrieved from the first row when releasing it. ---*/
+  
+  su2double **val_matrix = new su2double* [max(val_nrow, (unsigned short)1)];
+  val_matrix[0] = new su2double [nEntry];
+  for (iEntry = 0; iEntry < nEntry; iEntry++)
+    val_matrix[0][iEntry] = 0.0;
+  
+  for (iRow = 1; iRow < val_nrow; iRow++)
+    val_matrix[iRow] = val_matrix[0] + (unsigned long)iRow*val_ncol;
+  
+  return val_matrix;
+  
+}
+
+void CVariable::FreeMatrix(su2double **val_matrix) {
+  
+  if (val_matrix != NULL) {
+    delete [] val_matrix[0];
+    delete [] val_matrix;
+  }
+  
+}
+
 void CVariable::AddUnd_Lapl(su2double *val_und_lapl) {
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     Undivided_Laplacian[iVar] += val_und_lapl[iVar];
@@ -322,6 +350,8 @@ void CVariable::AddResidual_Sum(su2double *val_residual) {
 
 void CVariable::SetVel_ResTruncError_Zero(void) {
   
+  if (Res_TruncError == NULL) return;
+  
   for (unsigned short iDim = 0; iDim < nDim; iDim++)
     Res_TruncError[iDim+1] = 0.0;
   
@@ -329,6 +359,8 @@ void CVariable::SetVel_ResTruncError_Zero(void) {
 
 void CVariable::SetEnergy_ResTruncError_Zero(void) {
   
+  if (Res_TruncError == NULL) return;
+  
   Res_TruncError[nDim+1] = 0.0;
   
 }
@@ -406,6 +438,8 @@ void CVariable::SetGradient(su2double **val_gradient) {
 
 void CVariable::SetRes_TruncErrorZero(void) {
   
+  if (Res_TruncError == NULL) return;
+  
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     Res_TruncError[iVar] = 0.0;
   
@@ -413,6 +447,8 @@ void CVariable::SetRes_TruncErrorZero(void) {
 
 void CVariable::SetVal_ResTruncError_Zero(unsigned short val_var) {
   
+  if (Res_TruncError == NULL) return;
+  
     Res_TruncError[val_var] = 0.0;
   
 }
@@ -426,6 +462,12 @@ void CVariable::GetResidual_Sum(su2double *val_residual) {
 
 void CVariable::GetResTruncError(su2double *val_trunc_error) {
   
+  if (Res_TruncError == NULL) {
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      val_trunc_error[iVar] = 0.0;
+    return;
+  }
+  
   for (unsigned short iVar = 0; iVar < nVar; iVar++)
     val_trunc_error[iVar] = Res_TruncError[iVar];
   
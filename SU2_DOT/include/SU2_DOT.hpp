@@ -63,6 +63,17 @@ using namespace std;
 
 void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double **Gradient);
 
+/*!
+ * \brief Projection of the surface sensitivity onto the FFD design variables using the sparse Jacobian
+ *        of the surface points w.r.t. the control points (falls back to AD or FD for other variables).
+ * \param[in] geometry - Geometrical definition of the problem.
+ * \param[in] config - Definition of the particular problem.
+ * \param[in] surface_movement - Surface movement class of the problem.
+ * \param[in] Gradient_file - Output file to store the gradient data.
+ */
+
+void SetProjection_FFD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double **Gradient);
+
 /*!
  * \brief Projection of the surface sensitivity using algorithmic differentiation (AD).
  * \param[in] geometry - Geometrical definition of the problem.
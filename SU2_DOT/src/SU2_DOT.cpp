@@ -242,6 +242,25 @@ int main(int argc, char *argv[]) {
   if (rank == MASTER_NODE)
     cout << endl <<"----------------------- Preprocessing computations ----------------------" << endl;
   
+  /*--- The projection of the continuous adjoint surface sensitivities only needs the
+   boundary control volume, which is built from the boundary elements. The discrete
+   adjoint deforms the volume mesh and always needs the full preprocessing. ---*/
+  
+  bool surface_only = (config_container[iZone]->GetDot_Surface_Only() &&
+                       !config_container[iZone]->GetDiscrete_Adjoint());
+  
+  if (surface_only) {
+    
+    if (rank == MASTER_NODE) cout << "Surface-only preprocessing (no point connectivity, edges or dual grid)." << endl;
+    
+    /*--- Compute the center of gravity of the boundary elements ---*/
+    
+    if (rank == MASTER_NODE) cout << "Computing centers of gravity of the boundary elements." << endl;
+    geometry_container[iZone][INST_0]->SetBoundCoord_CG();
+    
+  }
+  else {
+  
   /*--- Compute elements surrounding points, points surrounding points ---*/
 
   if (rank == MASTER_NODE) cout << "Setting local point connectivity." <<endl;
@@ -266,6 +285,8 @@ int main(int argc, char *argv[]) {
   if (rank == MASTER_NODE) cout << "Computing centers of gravity." << endl;
   geometry_container[iZone][INST_0]->SetCoord_CG();
   
+  }
+  
   /*--- Create the dual control volume structures ---*/
   
   if (rank == MASTER_NODE) cout << "Setting the bound control volume structure." << endl;
@@ -345,10 +366,13 @@ int main(int argc, char *argv[]) {
 
        surface_movement[iZone]->CopyBoundary(geometry_container[iZone][INST_0], config_container[iZone]);
 
-       /*--- If AD mode is enabled we can use it to compute the projection,
-        *    otherwise we use finite differences. ---*/
+       /*--- If requested, the FFD variables are projected with the Jacobian of the surface
+        *    w.r.t. the control points. If AD mode is enabled we can use it to compute the
+        *    projection, otherwise we use finite differences. ---*/
 
-       if (config_container[iZone]->GetAD_Mode()){
+       if (config_container[iZone]->GetFFD_Jacobian_Projection()){
+         SetProjection_FFD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
+       }else if (config_container[iZone]->GetAD_Mode()){
          SetProjection_AD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
        }else{
          SetProjection_FD(geometry_container[iZone][INST_0], config_container[iZone], surface_movement[iZone] , Gradient);
@@ -696,7 +720,7 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
       }
       
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
     localGradient = my_Gradient;
 #endif
@@ -720,6 +744,283 @@ void SetProjection_FD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
 }
   
 
+void SetProjection_FFD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
+  
+  unsigned short iDV, nDV, iFFDBox, nFFDBox, iMarker, iDim, nDim, iOrder, jOrder, kOrder;
+  unsigned long iVertex, iPoint, nPoint, iSurfacePoints, iRow, iCP, nCP, iNonZero;
+  su2double delta_eps, my_Gradient, *Normal, Area, Sensitivity[3] = {0.0, 0.0, 0.0}, *Coord_CP;
+  bool Local_MoveSurface, Jacobian_Projection = true;
+  CFreeFormDefBox **FFDBox;
+  vector<unsigned long> Index_CP;
+  vector<su2double> Basis_CP;
+  
+  int rank = SU2_MPI::GetRank();
+  
+  nDV    = config->GetnDV();
+  nDim   = geometry->GetnDim();
+  nPoint = geometry->GetnPoint();
+  
+  /*--- The surface coordinates are a linear combination of the control points of a
+   cartesian box (the Jacobian does not depend on the design), hence all the FFD
+   variables with a single design value can be projected with the same Jacobian. ---*/
+  
+  if (config->GetFFD_CoordSystem() != CARTESIAN) Jacobian_Projection = false;
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    if (config->GetnDV_Value(iDV) != 1) Jacobian_Projection = false;
+    switch (config->GetDesign_Variable(iDV)) {
+      case FFD_CONTROL_POINT_2D: case FFD_CAMBER_2D: case FFD_THICKNESS_2D: case FFD_TWIST_2D:
+      case FFD_CONTROL_POINT: case FFD_NACELLE: case FFD_GULL: case FFD_TWIST: case FFD_ROTATION:
+      case FFD_CAMBER: case FFD_THICKNESS: case FFD_ANGLE_OF_ATTACK:
+        break;
+      default:
+        Jacobian_Projection = false;
+        break;
+    }
+  }
+  
+  /*--- Definition of the FFD deformation class ---*/
+  
+  FFDBox = new CFreeFormDefBox*[MAX_NUMBER_FFD];
+  for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) FFDBox[iFFDBox] = NULL;
+  
+  nFFDBox = 0;
+  
+  if (Jacobian_Projection) {
+    
+    if (rank == MASTER_NODE)
+      cout << "Read the FFD information from mesh file." << endl;
+    
+    /*--- Read the FFD information from the grid file ---*/
+    
+    surface_movement->ReadFFDInfo(geometry, config, FFDBox, config->GetMesh_FileName());
+    
+    /*--- If the FFDBox was not defined in the input file ---*/
+    
+    if (!surface_movement->GetFFDBoxDefinition()) {
+      SU2_MPI::Error("The input grid doesn't have the entire FFD information!", CURRENT_FUNCTION);
+    }
+    
+    nFFDBox = surface_movement->GetnFFDBox();
+    
+    /*--- The control points of nested boxes are moved by their parent box ---*/
+    
+    for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++) {
+      if ((FFDBox[iFFDBox]->GetnParentFFDBox() != 0) ||
+          (FFDBox[iFFDBox]->GetnChildFFDBox() != 0)) Jacobian_Projection = false;
+    }
+    
+  }
+  
+  if (!Jacobian_Projection) {
+    
+    if (rank == MASTER_NODE)
+      cout << "The FFD Jacobian projection requires FFD design variables of non-nested cartesian boxes." << endl;
+    
+    for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) {
+      if (FFDBox[iFFDBox] != NULL) delete FFDBox[iFFDBox];
+    }
+    delete [] FFDBox;
+    
+    if (config->GetAD_Mode())
+      SetProjection_AD(geometry, config, surface_movement, Gradient);
+    else
+      SetProjection_FD(geometry, config, surface_movement, Gradient);
+    
+    return;
+    
+  }
+  
+  if (rank == MASTER_NODE)
+    cout << "Evaluate functional gradient using the FFD control point Jacobian." << endl;
+  
+  for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++) {
+    
+    if (rank == MASTER_NODE) cout << "Checking FFD box dimension." << endl;
+    surface_movement->CheckFFDDimension(geometry, config, FFDBox[iFFDBox], iFFDBox);
+    
+    if (rank == MASTER_NODE) cout << "Check the FFD box intersections with the solid surfaces." << endl;
+    surface_movement->CheckFFDIntersections(geometry, config, FFDBox[iFFDBox], iFFDBox);
+    
+  }
+  
+  if (rank == MASTER_NODE)
+    cout <<"-------------------------------------------------------------------------" << endl;
+  
+  /*--- As in the surface deformation, a point inside several boxes is
+   moved by the last one, and markers share points, so each point is visited once. ---*/
+  
+  vector<short> Point_FFDBox(nPoint, -1);
+  vector<bool> Point_Visited(nPoint, false);
+  
+  for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++) {
+    for (iSurfacePoints = 0; iSurfacePoints < FFDBox[iFFDBox]->GetnSurfacePoint(); iSurfacePoints++) {
+      iMarker = FFDBox[iFFDBox]->Get_MarkerIndex(iSurfacePoints);
+      if (config->GetMarker_All_DV(iMarker) == YES)
+        Point_FFDBox[FFDBox[iFFDBox]->Get_PointIndex(iSurfacePoints)] = iFFDBox;
+    }
+  }
+  
+  vector<vector<su2double> > Gradient_CP(nFFDBox), Coord_Original_CP(nFFDBox);
+  
+  for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++) {
+    
+    nCP = FFDBox[iFFDBox]->GetlOrder()*FFDBox[iFFDBox]->GetmOrder()*FFDBox[iFFDBox]->GetnOrder();
+    
+    /*--- Assemble the sparse (CSR) Jacobian of the surface points of the box
+     w.r.t. its control points, only the parametric coordinates are needed. ---*/
+    
+    vector<unsigned long> Jacobian_RowPtr(1, 0), Jacobian_Col, Jacobian_Vertex;
+    vector<unsigned short> Jacobian_Marker;
+    vector<su2double> Jacobian_Val;
+    
+    for (iSurfacePoints = 0; iSurfacePoints < FFDBox[iFFDBox]->GetnSurfacePoint(); iSurfacePoints++) {
+      
+      iMarker = FFDBox[iFFDBox]->Get_MarkerIndex(iSurfacePoints);
+      iVertex = FFDBox[iFFDBox]->Get_VertexIndex(iSurfacePoints);
+      iPoint  = FFDBox[iFFDBox]->Get_PointIndex(iSurfacePoints);
+      
+      if ((config->GetMarker_All_DV(iMarker) == YES) && (iPoint < geometry->GetnPointDomain()) &&
+          (Point_FFDBox[iPoint] == iFFDBox) && (!Point_Visited[iPoint])) {
+        
+        FFDBox[iFFDBox]->EvalCartesianCoord_Jacobian(FFDBox[iFFDBox]->Get_ParametricCoord(iSurfacePoints), Index_CP, Basis_CP);
+        
+        Jacobian_Col.insert(Jacobian_Col.end(), Index_CP.begin(), Index_CP.end());
+        Jacobian_Val.insert(Jacobian_Val.end(), Basis_CP.begin(), Basis_CP.end());
+        Jacobian_RowPtr.push_back(Jacobian_Col.size());
+        Jacobian_Marker.push_back(iMarker);
+        Jacobian_Vertex.push_back(iVertex);
+        
+        Point_Visited[iPoint] = true;
+      }
+    }
+    
+    /*--- Sensitivity w.r.t. the control points, product of the transposed Jacobian and the surface sensitivity ---*/
+    
+    vector<su2double> my_Gradient_CP(nCP*3, 0.0);
+    
+    for (iRow = 0; iRow < Jacobian_Marker.size(); iRow++) {
+      
+      iMarker = Jacobian_Marker[iRow];
+      iVertex = Jacobian_Vertex[iRow];
+      iPoint  = geometry->vertex[iMarker][iVertex]->GetNode();
+      Normal  = geometry->vertex[iMarker][iVertex]->GetNormal();
+      
+      Area = 0.0;
+      for (iDim = 0; iDim < nDim; iDim++) Area += Normal[iDim]*Normal[iDim];
+      Area = sqrt(Area);
+      
+      for (iDim = 0; iDim < nDim; iDim++) {
+        if (config->GetDiscrete_Adjoint())
+          Sensitivity[iDim] = geometry->GetSensitivity(iPoint, iDim);
+        else
+          Sensitivity[iDim] = -Normal[iDim]*geometry->vertex[iMarker][iVertex]->GetAuxVar()/Area;
+      }
+      
+      for (iNonZero = Jacobian_RowPtr[iRow]; iNonZero < Jacobian_RowPtr[iRow+1]; iNonZero++) {
+        iCP = Jacobian_Col[iNonZero];
+        for (iDim = 0; iDim < nDim; iDim++)
+          my_Gradient_CP[iCP*3+iDim] += Jacobian_Val[iNonZero]*Sensitivity[iDim];
+      }
+    }
+    
+    Gradient_CP[iFFDBox].resize(nCP*3, 0.0);
+    
+#ifdef HAVE_MPI
+    SU2_MPI::Allreduce(&my_Gradient_CP[0], &Gradient_CP[iFFDBox][0], nCP*3, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+#else
+    Gradient_CP[iFFDBox] = my_Gradient_CP;
+#endif
+    
+    /*--- Store the original position of the control points ---*/
+    
+    FFDBox[iFFDBox]->SetOriginalControlPoints();
+    
+    Coord_Original_CP[iFFDBox].resize(nCP*3, 0.0);
+    
+    for (iOrder = 0; iOrder < FFDBox[iFFDBox]->GetlOrder(); iOrder++)
+      for (jOrder = 0; jOrder < FFDBox[iFFDBox]->GetmOrder(); jOrder++)
+        for (kOrder = 0; kOrder < FFDBox[iFFDBox]->GetnOrder(); kOrder++) {
+          iCP = (iOrder*FFDBox[iFFDBox]->GetmOrder() + jOrder)*FFDBox[iFFDBox]->GetnOrder() + kOrder;
+          Coord_CP = FFDBox[iFFDBox]->GetCoordControlPoints(iOrder, jOrder, kOrder);
+          for (iDim = 0; iDim < 3; iDim++)
+            Coord_Original_CP[iFFDBox][iCP*3+iDim] = Coord_CP[iDim];
+        }
+    
+  }
+  
+  /*--- Loop over the design variables, each one only requires the movement of the
+   control points (finite difference step), independently of the surface size. ---*/
+  
+  for (iDV = 0; iDV < nDV; iDV++) {
+    
+    if (config->GetDesign_Variable(iDV) == FFD_ANGLE_OF_ATTACK) {
+      Gradient[iDV][0] = config->GetAoA_Sens();
+      continue;
+    }
+    
+    delta_eps = config->GetDV_Value(iDV);
+    
+    if (delta_eps == 0.0) {
+      SU2_MPI::Error("The FFD Jacobian projection requires a nonzero DV_VALUE (finite difference step).", CURRENT_FUNCTION);
+    }
+    
+    my_Gradient = 0.0;
+    
+    for (iFFDBox = 0; iFFDBox < nFFDBox; iFFDBox++) {
+      
+      /*--- Apply the control point change ---*/
+      
+      Local_MoveSurface = false;
+      
+      switch (config->GetDesign_Variable(iDV) ) {
+        case FFD_CONTROL_POINT_2D : Local_MoveSurface = surface_movement->SetFFDCPChange_2D(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_CAMBER_2D :        Local_MoveSurface = surface_movement->SetFFDCamber_2D(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_THICKNESS_2D :     Local_MoveSurface = surface_movement->SetFFDThickness_2D(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_TWIST_2D :         Local_MoveSurface = surface_movement->SetFFDTwist_2D(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_CONTROL_POINT :    Local_MoveSurface = surface_movement->SetFFDCPChange(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_NACELLE :          Local_MoveSurface = surface_movement->SetFFDNacelle(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_GULL :             Local_MoveSurface = surface_movement->SetFFDGull(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_TWIST :            Local_MoveSurface = surface_movement->SetFFDTwist(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_ROTATION :         Local_MoveSurface = surface_movement->SetFFDRotation(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_CAMBER :           Local_MoveSurface = surface_movement->SetFFDCamber(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+        case FFD_THICKNESS :        Local_MoveSurface = surface_movement->SetFFDThickness(geometry, config, FFDBox[iFFDBox], FFDBox, iDV, false); break;
+      }
+      
+      if (!Local_MoveSurface) continue;
+      
+      /*--- Product of the control point displacement and the control point sensitivity ---*/
+      
+      for (iOrder = 0; iOrder < FFDBox[iFFDBox]->GetlOrder(); iOrder++)
+        for (jOrder = 0; jOrder < FFDBox[iFFDBox]->GetmOrder(); jOrder++)
+          for (kOrder = 0; kOrder < FFDBox[iFFDBox]->GetnOrder(); kOrder++) {
+            iCP = (iOrder*FFDBox[iFFDBox]->GetmOrder() + jOrder)*FFDBox[iFFDBox]->GetnOrder() + kOrder;
+            Coord_CP = FFDBox[iFFDBox]->GetCoordControlPoints(iOrder, jOrder, kOrder);
+            for (iDim = 0; iDim < nDim; iDim++)
+              my_Gradient += Gradient_CP[iFFDBox][iCP*3+iDim]*(Coord_CP[iDim] - Coord_Original_CP[iFFDBox][iCP*3+iDim])/delta_eps;
+          }
+      
+      /*--- Reset the FFD box ---*/
+      
+      FFDBox[iFFDBox]->SetOriginalControlPoints();
+      
+    }
+    
+    /*--- The control point sensitivity is already summed over all the ranks ---*/
+    
+    Gradient[iDV][0] = my_Gradient;
+    
+  }
+  
+  /*--- Delete memory for parameterization. ---*/
+  
+  for (iFFDBox = 0; iFFDBox < MAX_NUMBER_FFD; iFFDBox++) {
+    if (FFDBox[iFFDBox] != NULL) delete FFDBox[iFFDBox];
+  }
+  delete [] FFDBox;
+  
+}
+
 void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *surface_movement, su2double** Gradient){
 
   su2double DV_Value, *VarCoord, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
@@ -826,7 +1127,7 @@ void SetProjection_AD(CGeometry *geometry, CConfig *config, CSurfaceMovement *su
       DV_Value = config->GetDV_Value(iDV, iDV_Value);
       my_Gradient = SU2_TYPE::GetDerivative(DV_Value);
 #ifdef HAVE_MPI
-    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+    SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_SU2DOUBLE, MPI_SUM, MPI_COMM_WORLD);
 #else
       localGradient = my_Gradient;
 #endif
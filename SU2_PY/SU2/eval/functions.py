@@ -44,6 +44,7 @@ from .. import run  as su2run
 from .. import io   as su2io
 from .. import util as su2util
 from ..io import redirect_folder, redirect_output
+from .scheduler import Scheduler
 
 
 # ----------------------------------------------------------------------
@@ -527,31 +528,30 @@ def multipoint( config, state=None, step=1e-2 ):
         string = "ln -s " + src + " " + dst
         os.system(string)
 
+    # the other points are independent, concurrent with CONCURRENT_EVALUATIONS
+    scheduler = Scheduler(config)
+
     for i in range(len(weight_list)-1):
 
+      konfig = copy.deepcopy(config)
+
+      konfig.AOA = aoa_list[i+1]
+      konfig.SIDESLIP_ANGLE = sideslip_list[i+1]
+      konfig.MACH_NUMBER = mach_list[i+1]
+      konfig.REYNOLDS_NUMBER = reynolds_list[i+1]
+      konfig.FREESTREAM_TEMPERATURE = freestream_temp_list[i+1]
+      konfig.FREESTREAM_PRESSURE = freestream_press_list[i+1]
+      konfig.TARGET_CL = target_cl_list[i+1]
+
+      orig_marker_outlet = config['MARKER_OUTLET']
+      orig_marker_outlet = orig_marker_outlet.replace("(", "").replace(")", "").split(',')
+      new_marker_outlet = "(" + orig_marker_outlet[0] + "," + outlet_value_list[i+1] + ")"
+      konfig.MARKER_OUTLET = new_marker_outlet
+
       # pull needed files, start folder_1
-      with redirect_folder( folder[i+1], pull, link ) as push:
-        with redirect_output(log_direct):
-          
-          konfig = copy.deepcopy(config)
-          ztate  = copy.deepcopy(state)
-
-          konfig.AOA = aoa_list[i+1]
-          konfig.SIDESLIP_ANGLE = sideslip_list[i+1]
-          konfig.MACH_NUMBER = mach_list[i+1]
-          konfig.REYNOLDS_NUMBER = reynolds_list[i+1]
-          konfig.FREESTREAM_TEMPERATURE = freestream_temp_list[i+1]
-          konfig.FREESTREAM_PRESSURE = freestream_press_list[i+1]
-          konfig.TARGET_CL = target_cl_list[i+1]
-
-          orig_marker_outlet = config['MARKER_OUTLET']
-          orig_marker_outlet = orig_marker_outlet.replace("(", "").replace(")", "").split(',')
-          new_marker_outlet = "(" + orig_marker_outlet[0] + "," + outlet_value_list[i+1] + ")"
-          konfig.MARKER_OUTLET = new_marker_outlet
-
-          ztate.FUNCTIONS.clear()
-            
-          func[i+1] = aerodynamics(konfig,ztate)
+      scheduler.submit( multipoint_point, konfig, state, folder[i+1], pull, link, log_direct )
+
+    func[1:] = scheduler.wait()
       
     # ----------------------------------------------------
     #  WEIGHT FUNCTIONS
@@ -579,6 +579,24 @@ def multipoint( config, state=None, step=1e-2 ):
     return funcs
 
 
+def multipoint_point( config, state, folder, pull, link, log_direct ):
+    """ funcs = multipoint_point(config,state,folder,pull,link,log_direct)
+
+        Evaluates the aerodynamics of one of the other points of a
+        multipoint design in its own folder, the state is not updated.
+    """
+
+    with redirect_folder( folder, pull, link ) as push:
+        with redirect_output(log_direct):
+
+            ztate = copy.deepcopy(state)
+            ztate.FUNCTIONS.clear()
+
+            return aerodynamics(config,ztate)
+
+#: def multipoint_point()
+
+
 # ----------------------------------------------------------------------
 #  Geometric Functions
 # ----------------------------------------------------------------------
@@ -45,6 +45,7 @@ from .. import io   as su2io
 from .. import util as su2util
 from .functions import function, update_mesh
 from ..io import redirect_folder, redirect_output
+from .scheduler import Scheduler
 from SU2.eval import functions
 
 # ----------------------------------------------------------------------
@@ -525,29 +526,25 @@ def multipoint( func_name, config, state=None, step=1e-2 ):
           string = "ln -s " + src + " " + dst
           os.system(string)
 
+    # the other points are independent, concurrent with CONCURRENT_EVALUATIONS
+    scheduler = Scheduler(config)
+
     for i in range(len(weight_list)-1):
 
+      konfig = copy.deepcopy(config)
+
+      konfig.AOA = aoa_list[i+1]
+      konfig.SIDESLIP_ANGLE = sideslip_list[i+1]
+      konfig.MACH_NUMBER = mach_list[i+1]
+      konfig.REYNOLDS_NUMBER = reynolds_list[i+1]
+      konfig.FREESTREAM_TEMPERATURE = freestream_temp_list[i+1]
+      konfig.FREESTREAM_PRESSURE = freestream_press_list[i+1]
+      konfig.TARGET_CL = target_cl_list[i+1]
+
       # pull needed files, start folder
-      with redirect_folder( folder[i+1], pull, link ) as push:
-        with redirect_output(log_direct):
-    
-          konfig = copy.deepcopy(config)
-          ztate  = copy.deepcopy(state)
-        
-          konfig.AOA = aoa_list[i+1]
-          konfig.SIDESLIP_ANGLE = sideslip_list[i+1]
-          konfig.MACH_NUMBER = mach_list[i+1]
-          konfig.REYNOLDS_NUMBER = reynolds_list[i+1]
-          konfig.FREESTREAM_TEMPERATURE = freestream_temp_list[i+1]
-          konfig.FREESTREAM_PRESSURE = freestream_press_list[i+1]
-          konfig.TARGET_CL = target_cl_list[i+1]         
- 
-          # let's start somethin somthin
-          del ztate.GRADIENTS[base_name]
-          #ztate.find_files(konfig)
-            
-          # the gradient
-          grads[i+1] = gradient(base_name,'DISCRETE_ADJOINT',konfig,ztate)
+      scheduler.submit( multipoint_point, konfig, state, base_name, folder[i+1], pull, link, log_direct )
+
+    grads[1:] = scheduler.wait()
         
     # ----------------------------------------------------
     #  WEIGHT FUNCTIONS
@@ -569,6 +566,28 @@ def multipoint( func_name, config, state=None, step=1e-2 ):
     return grads_out
 
 
+def multipoint_point( config, state, base_name, folder, pull, link, log_direct ):
+    """ grads = multipoint_point(config,state,base_name,folder,pull,link,log_direct)
+
+        Evaluates the adjoint gradient of one of the other points of a
+        multipoint design in its own folder, the state is not updated.
+    """
+
+    with redirect_folder( folder, pull, link ) as push:
+        with redirect_output(log_direct):
+
+            ztate = copy.deepcopy(state)
+
+            # let's start somethin somthin
+            del ztate.GRADIENTS[base_name]
+            #ztate.find_files(konfig)
+
+            # the gradient
+            return gradient(base_name,'DISCRETE_ADJOINT',config,ztate)
+
+#: def multipoint_point()
+
+
 # ----------------------------------------------------------------------
 #  Finite Difference Gradients
 # ----------------------------------------------------------------------
@@ -704,6 +723,11 @@ def findiff( config, state=None ):
         pull.append(files['TARGET_HEATFLUX'])
 
        
+    # the steps are independent, concurrent with CONCURRENT_EVALUATIONS,
+    # each one in its own folder then
+    scheduler = Scheduler(konfig)
+    step_link = [ os.path.split(name)[-1] for name in pull + link ]
+
     # output redirection
     with redirect_folder('FINDIFF',pull,link) as push:
         with redirect_output(log_findiff):
@@ -712,7 +736,6 @@ def findiff( config, state=None ):
             for i_dv in range(n_dv):
 
                 this_step = step[i_dv]
-                temp_config_name = 'config_FINDIFF_%i.cfg' % i_dv 
 
                 this_dvs    = copy.deepcopy(dvs_base)
                 this_konfig = copy.deepcopy(konfig)
@@ -722,15 +745,16 @@ def findiff( config, state=None ):
                 this_state.FILES = copy.deepcopy( state.FILES )
                 this_konfig.unpack_dvs(this_dvs,dvs_base)
 
-                this_konfig.dump(temp_config_name)
+                step_folder = 'STEP_%i' % i_dv if scheduler.concurrent() else os.curdir
 
-                # Direct Solution, findiff step
-                func_step = function( 'ALL', this_konfig, this_state )
+                scheduler.submit( findiff_step, this_konfig, this_state, i_dv, step_folder, step_link )
 
-                # remove deform step files
-                meshfiles = this_state.FILES.MESH
-                meshfiles = su2io.expand_part(meshfiles,this_konfig)
-                for name in meshfiles: os.remove(name)
+            func_steps = scheduler.wait()
+
+            for i_dv in range(n_dv):
+
+                this_step = step[i_dv]
+                func_step = func_steps[i_dv]
 
                 # calc finite difference and store
                 for key in grads.keys():
@@ -746,7 +770,6 @@ def findiff( config, state=None ):
                 #: for each grad name
                     
                 su2util.write_plot(grad_filename,output_format,grads)
-                os.remove(temp_config_name)
 
             #: for each dv
 
@@ -763,6 +786,32 @@ def findiff( config, state=None ):
 
 #: def findiff()
 
+def findiff_step( config, state, i_dv, folder, link ):
+    """ funcs = findiff_step(config,state,i_dv,folder,link)
+
+        Evaluates the functions of one finite difference step
+        in folder (linking the base files), returns the functions.
+    """
+
+    with redirect_folder( folder, [], link ) as push:
+
+        temp_config_name = 'config_FINDIFF_%i.cfg' % i_dv
+        config.dump(temp_config_name)
+
+        # Direct Solution, findiff step
+        func_step = function( 'ALL', config, state )
+
+        # remove deform step files
+        meshfiles = state.FILES.MESH
+        meshfiles = su2io.expand_part(meshfiles,config)
+        for name in meshfiles: os.remove(name)
+
+        os.remove(temp_config_name)
+
+    return func_step
+
+#: def findiff_step()
+
 
 # ----------------------------------------------------------------------
 #  Geometric Gradients
@@ -981,17 +1030,23 @@ def directdiff( config, state=None ):
     with redirect_folder('DIRECTDIFF',pull,link) as push:
         with redirect_output(log_directdiff):
 
-            # iterate each dv
-            for i_dv in range(n_dv):
+            # number of dvs differentiated in each run (vector forward mode)
+            n_dir = int(konfig.get('DIRECT_DIFF_DIRECTIONS',1))
+
+            # iterate each group of dvs
+            for i_dv_first in range(0,n_dv,n_dir):
+
+                i_dv_last = min(i_dv_first+n_dir,n_dv)
 
-                temp_config_name = 'config_DIRECTDIFF_%i.cfg' % i_dv
+                temp_config_name = 'config_DIRECTDIFF_%i.cfg' % i_dv_first
 
                 this_konfig = copy.deepcopy(konfig)
 
                 this_dvs = [0.0]*n_dv
-                this_dvs[i_dv] = 1.0
                 this_dvs_old = [0.0]*n_dv
-                this_dvs_old[i_dv] = 1.0
+                for i_dv in range(i_dv_first,i_dv_last):
+                    this_dvs[i_dv] = 1.0
+                    this_dvs_old[i_dv] = 1.0
                 this_state = su2io.State()
                 this_state.FILES = copy.deepcopy( state.FILES )
                 this_konfig.unpack_dvs(this_dvs, this_dvs_old)
@@ -1001,22 +1056,27 @@ def directdiff( config, state=None ):
                 # Direct Solution
                 func_step = function( 'ALL', this_konfig, this_state )
 
-                # store
-                for key in grads.keys():
-                    if key == 'VARIABLE':
-                        grads[key].append(i_dv)
-                    else:
-                        if su2io.grad_names_map[key] in func_step:
-                          this_grad = func_step[su2io.grad_names_map[key]]
+                # store, the n-th dv of the group is the n-th direction
+                directions = this_state.HISTORY.get('DIRECTDIFF',{})
+                for i_dv in range(i_dv_first,i_dv_last):
+                    i_dir = i_dv - i_dv_first
+                    for key in grads.keys():
+                        if key == 'VARIABLE':
+                            grads[key].append(i_dv)
                         else:
-                          this_grad = 0.0
-                        grads[key].append(this_grad)
-                #: for each grad name
+                            if n_dir > 1 and su2io.grad_names_map[key] in directions:
+                              this_grad = directions[su2io.grad_names_map[key]][i_dir]
+                            elif n_dir == 1 and su2io.grad_names_map[key] in func_step:
+                              this_grad = func_step[su2io.grad_names_map[key]]
+                            else:
+                              this_grad = 0.0
+                            grads[key].append(this_grad)
+                    #: for each grad name
 
                 su2util.write_plot(grad_filename,output_format,grads)
                 os.remove(temp_config_name)
 
-            #: for each dv
+            #: for each group of dvs
 
     #: with output redirection
 
@@ -0,0 +1,174 @@
+#!/usr/bin/env python
+
+## \file scheduler.py
+#  \brief python package for the concurrent evaluation of independent cases
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import sys, copy, traceback
+import multiprocessing as mp
+
+if sys.version_info[0] > 2:
+    import queue
+else:
+    import Queue as queue
+
+
+# ----------------------------------------------------------------------
+#  Scheduler Class
+# ----------------------------------------------------------------------
+
+class Scheduler(object):
+    """ SU2.eval.Scheduler(config)
+
+        Runs independent evaluations (multipoint cases, finite difference
+        steps, ...) concurrently. The NUMBER_PART ranks of the allocation
+        are split into CONCURRENT_EVALUATIONS disjoint groups, and each
+        evaluation runs in its own process (own working folder) with
+        NUMBER_PART set to the size of one group.
+        With CONCURRENT_EVALUATIONS= 1 (default) or a serial run, the
+        evaluations run in sequence in this process, as before.
+
+        Methods:
+            submit(function,config,*args) - queue function(config,*args),
+                                            config is copied and gets the
+                                            group size as NUMBER_PART
+            wait()                        - run the queued evaluations,
+                                            returns their results in the
+                                            order of submission
+
+        Notes:
+            Concurrent evaluations can not update their inputs by
+            reference, everything needed by the caller must be returned.
+            The first failed evaluation is raised again by wait(), after
+            the other ones have finished.
+    """
+
+    def __init__(self, config):
+
+        n_part   = int( config.get('NUMBER_PART', 0) )
+        n_groups = int( config.get('CONCURRENT_EVALUATIONS', 1) )
+
+        # at least one rank per group
+        n_groups = max( 1, min(n_groups, n_part) )
+
+        self.n_groups = n_groups
+        self.n_part   = n_part // n_groups if n_groups > 1 else n_part
+        self.jobs     = []
+
+    def concurrent(self):
+        """ True if the evaluations run in separate processes """
+        return self.n_groups > 1
+
+    def submit(self, function, config, *args):
+        """ queues the evaluation function(config,*args) """
+
+        konfig = copy.deepcopy(config)
+        if self.concurrent():
+            konfig['NUMBER_PART'] = self.n_part
+
+        self.jobs.append( (function, (konfig,) + args) )
+
+    def wait(self):
+        """ runs the queued evaluations, returns their results """
+
+        jobs = self.jobs
+        self.jobs = []
+
+        # sequential evaluation
+        if not self.concurrent():
+            return [ function(*args) for function,args in jobs ]
+
+        results  = [None] * len(jobs)
+        failures = []
+        pending  = list(range(len(jobs)))
+        running  = {}
+        messages = mp.Queue()
+
+        sys.stdout.flush()
+
+        while pending or running:
+
+            # fill the free rank groups
+            while pending and len(running) < self.n_groups:
+                index = pending.pop(0)
+                function,args = jobs[index]
+                proc = mp.Process( target=_evaluate,
+                                   args=(function,args,index,messages) )
+                proc.start()
+                running[index] = proc
+
+            # wait for one evaluation to finish
+            try:
+                index,result,failure = messages.get(timeout=1.0)
+            except queue.Empty:
+                # processes that died without reporting
+                for index,proc in list(running.items()):
+                    if proc.exitcode is not None and proc.exitcode != 0:
+                        del running[index]
+                        failures.append( (index, RuntimeError,
+                            'evaluation process terminated with exit code %i' % proc.exitcode) )
+                continue
+
+            running.pop(index).join()
+            if failure is None:
+                results[index] = result
+            else:
+                failures.append( (index,) + failure )
+
+        #: while evaluations
+
+        if failures:
+            index,exception,message = sorted(failures, key=lambda f: f[0])[0]
+            if not (isinstance(exception,type) and issubclass(exception,Exception)):
+                exception = RuntimeError
+            raise exception('concurrent evaluation %i failed\n%s' % (index,message))
+
+        return results
+
+#: class Scheduler()
+
+
+def _evaluate(function, args, index, messages):
+    """ runs one evaluation in a child process, reports the result """
+
+    try:
+        result = function(*args)
+        messages.put( (index, result, None) )
+    except Exception as exception:
+        messages.put( (index, None, (type(exception), traceback.format_exc())) )
+    sys.stdout.flush()
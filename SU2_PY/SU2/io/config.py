@@ -406,6 +406,7 @@ def read_config(filename):
             
             # int parameters
             if case("NUMBER_PART")            or\
+               case("CONCURRENT_EVALUATIONS") or\
                case("AVAILABLE_PROC")         or\
                case("EXT_ITER")               or\
                case("TIME_INSTANCES")         or\
@@ -864,6 +865,7 @@ def write_config(filename,param_dict):
             
             # int parameters
             if case("NUMBER_PART")            : pass
+            if case("CONCURRENT_EVALUATIONS") : pass
             if case("ADAPT_CYCLES")           : pass
             if case("TIME_INSTANCES")         : pass
             if case("AVAILABLE_PROC")         : pass
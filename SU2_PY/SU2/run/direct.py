@@ -39,7 +39,7 @@
 #  Imports
 # ----------------------------------------------------------------------
 
-import copy
+import os, copy
 
 from .. import io  as su2io
 from .merge     import merge     as su2merge
@@ -122,5 +122,7 @@ def direct ( config ):
     if 'INV_DESIGN_HEATFLUX' in special_cases:
         info.FILES.TARGET_HEATFLUX = 'TargetHeatFlux.dat'
     info.HISTORY.DIRECT = history
+    if os.path.exists('directdiff_directions.csv'):
+        info.HISTORY.DIRECTDIFF = su2io.read_history('directdiff_directions.csv', config.NZONES)
     
     return info
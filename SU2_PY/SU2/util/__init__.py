@@ -6,3 +6,4 @@ from .plot          import write_plot, tecplot, paraview
 from .lhc_unif      import lhc_unif
 from .mp_eval       import mp_eval
 from .which         import which
+from .rom           import ROM, read_restart, write_restart
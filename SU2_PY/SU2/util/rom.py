@@ -0,0 +1,372 @@
+#!/usr/bin/env python
+
+## \file rom.py
+#  \brief python package for reduced order models built from restart snapshots
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# ----------------------------------------------------------------------
+#  Imports
+# ----------------------------------------------------------------------
+
+import struct
+import numpy as np
+
+# magic number of the binary restart files ("SU2" in hex)
+BINARY_MAGIC  = 535532
+COMPACT_MAGIC = 535533
+
+# fixed length of the field names in the binary restart files
+STRING_SIZE   = 33
+
+# names of the coordinate fields, copied from the first snapshot
+COORD_NAMES   = ['x','y','z']
+
+
+# ----------------------------------------------------------------------
+#  Restart Files
+# ----------------------------------------------------------------------
+
+def read_restart(filename):
+    """ names,data,ext_iter,metadata = read_restart(filename)
+
+        Reads an SU2 restart file, binary or ASCII.
+
+        Outputs:
+            names    - list of field names, without the point index
+            data     - array [nPoint,nField], ordered by global point index
+            ext_iter - external iteration stored in the file (binary only)
+            metadata - array of the 8 metadata values (binary only)
+    """
+
+    with open(filename,'rb') as restart:
+        header = restart.read(5*4)
+
+    if len(header) == 5*4 and struct.unpack('5i',header)[0] in (BINARY_MAGIC,COMPACT_MAGIC):
+        return _read_binary(filename)
+
+    return _read_ascii(filename)
+
+#: def read_restart()
+
+
+def write_restart(filename, names, data, ext_iter=0, metadata=None):
+    """ write_restart(filename,names,data,ext_iter=0,metadata=None)
+
+        Writes an SU2 binary restart file (READ_BINARY_RESTART= YES).
+    """
+
+    data = np.ascontiguousarray(data, dtype=np.float64)
+    n_point,n_field = data.shape
+
+    if metadata is None:
+        metadata = np.zeros(8)
+
+    with open(filename,'wb') as restart:
+        restart.write( struct.pack('5i', BINARY_MAGIC, n_field, n_point, 1, 8) )
+        for name in names:
+            restart.write( struct.pack('%is' % STRING_SIZE, name.encode('ascii')[:STRING_SIZE-1]) )
+        restart.write( data.tobytes() )
+        restart.write( struct.pack('i', int(ext_iter)) )
+        restart.write( np.asarray(metadata, dtype=np.float64)[:8].tobytes() )
+
+#: def write_restart()
+
+
+def _read_binary(filename):
+
+    with open(filename,'rb') as restart:
+
+        magic,n_field,n_point = struct.unpack('3i', restart.read(3*4))
+        restart.read(2*4)
+
+        if magic == COMPACT_MAGIC:
+            raise Exception('%s is a compact restart file, write the snapshots with WRT_COMPACT_RESTART= NO' % filename)
+
+        names = []
+        for i in range(n_field):
+            name = restart.read(STRING_SIZE)
+            names.append( name.split(b'\0')[0].decode('ascii') )
+
+        data = np.frombuffer( restart.read(8*n_field*n_point), dtype=np.float64 )
+        if data.size != n_field*n_point:
+            raise Exception('%s is truncated' % filename)
+        data = data.reshape(n_point,n_field).copy()
+
+        tail = restart.read(4+8*8)
+        ext_iter = 0
+        metadata = np.zeros(8)
+        if len(tail) == 4+8*8:
+            ext_iter = struct.unpack('i', tail[:4])[0]
+            metadata = np.frombuffer(tail[4:], dtype=np.float64).copy()
+
+    return names, data, ext_iter, metadata
+
+#: def _read_binary()
+
+
+def _read_ascii(filename):
+
+    with open(filename,'r') as restart:
+        names = [ name.strip().strip('"') for name in restart.readline().split('\t') ]
+        rows  = []
+        for line in restart:
+            # metadata lines at the end of the file
+            if not line.strip() or '=' in line: break
+            rows.append( [ float(value) for value in line.split() ] )
+
+    data = np.array(rows)
+
+    # the point index is implied by the row order
+    if names and names[0] == 'PointID':
+        data  = data[ np.argsort(data[:,0]), 1: ]
+        names = names[1:]
+
+    return names, data, 0, np.zeros(8)
+
+#: def _read_ascii()
+
+
+# ----------------------------------------------------------------------
+#  Reduced Order Model Class
+# ----------------------------------------------------------------------
+
+class ROM(object):
+    """ SU2.util.ROM(energy=0.9999)
+
+        Non-intrusive reduced order model of a steady solution over a
+        space of parameters (AOA, MACH_NUMBER, ...):
+            - the snapshots (restart fields of the training points) are
+              centered and scaled per field, and decomposed by a proper
+              orthogonal decomposition (POD), computed with a tall-skinny
+              QR over blocks of points (TSQR) and the SVD of the small R
+              factor;
+            - the modes that hold the fraction `energy` of the variance
+              are kept;
+            - the modal coefficients and any scalar functions (CL, CD,
+              ...) are interpolated over the parameters by cubic radial
+              basis functions with a linear polynomial.
+
+        Methods:
+            build(params,snapshots,names,functions=None) - offline stage
+            fields(params)                               - predicted fields [nPoint,nField]
+            functions(params)                            - predicted functions, dict
+            save(filename), ROM.load(filename)           - numpy archive (.npz)
+
+        Notes:
+            params is an array [nSample,nParam]. The coordinates are not
+            reduced, they are copied from the first snapshot.
+    """
+
+    def __init__(self, energy=0.9999, block=65536):
+
+        self.energy = energy
+        self.block  = block
+
+    def build(self, params, snapshots, names, functions=None):
+        """ offline stage, snapshots is a list of arrays [nPoint,nField] """
+
+        params = np.atleast_2d( np.asarray(params, dtype=np.float64) )
+        if params.shape[0] != len(snapshots):
+            params = params.T
+        n_sample = params.shape[0]
+
+        if n_sample < 2:
+            raise Exception('the reduced order model needs at least two snapshots')
+
+        coords = [ i for i,name in enumerate(names) if name in COORD_NAMES ]
+        reduce = [ i for i,name in enumerate(names) if name not in COORD_NAMES ]
+
+        self.names  = list(names)
+        self.coords = np.array(coords, dtype=int)
+        self.reduce = np.array(reduce, dtype=int)
+        self.xyz    = snapshots[0][:,coords].copy()
+
+        # snapshot matrix, one column per sample
+        X = np.column_stack([ snap[:,reduce].ravel() for snap in snapshots ])
+        n_field = len(reduce)
+
+        # center, and scale every field by its spread so that all of them count
+        self.mean  = X.mean(axis=1)
+        X -= self.mean[:,None]
+        spread = np.sqrt( (X.reshape(-1,n_field,n_sample)**2).mean(axis=(0,2)) )
+        spread[ spread == 0.0 ] = 1.0
+        self.scale = np.tile(spread, X.shape[0]//n_field)
+        X /= self.scale[:,None]
+
+        # POD: X = Q R (TSQR), R = U_r S V^T, modes = Q U_r
+        Q,R = self._tsqr(X)
+        U_r,S,VT = np.linalg.svd(R, full_matrices=False)
+
+        variance = np.cumsum(S**2)
+        if variance[-1] > 0.0:
+            n_mode = int( np.searchsorted(variance/variance[-1], self.energy) ) + 1
+        else:
+            n_mode = 1
+        n_mode = min(n_mode, n_sample)
+
+        self.singular = S
+        self.modes    = self._qmult(Q, U_r[:,:n_mode])
+
+        # modal coefficients of the snapshots
+        coefs = (S[:n_mode,None]*VT[:n_mode,:]).T
+
+        # parameters normalized to the training box
+        self.p_min = params.min(axis=0)
+        self.p_len = params.max(axis=0) - self.p_min
+        self.p_len[ self.p_len == 0.0 ] = 1.0
+        self.params = (params - self.p_min)/self.p_len
+
+        self.coef_weights = self._rbf_fit(coefs)
+
+        self.function_names = []
+        self.function_weights = None
+        if functions:
+            self.function_names = sorted( functions[0].keys() )
+            values = np.array([ [ float(func[name]) for name in self.function_names ] for func in functions ])
+            self.function_weights = self._rbf_fit(values)
+
+        return n_mode
+
+    def fields(self, params):
+        """ predicted restart fields at params, array [nPoint,nField] """
+
+        coefs = self._rbf_eval(self.coef_weights, params)
+        n_point = self.xyz.shape[0]
+
+        X = self.mean + self.scale*self.modes.dot(coefs)
+
+        data = np.zeros( (n_point,len(self.names)) )
+        data[:,self.coords] = self.xyz
+        data[:,self.reduce] = X.reshape(n_point,-1)
+        return data
+
+    def functions(self, params):
+        """ predicted functions at params, dict """
+
+        if self.function_weights is None: return {}
+        values = self._rbf_eval(self.function_weights, params)
+        return dict( zip(self.function_names, values) )
+
+    def save(self, filename):
+        """ writes the model to a numpy archive """
+
+        np.savez( filename,
+                  names = np.array(self.names), coords = self.coords, reduce = self.reduce,
+                  xyz = self.xyz, mean = self.mean, scale = self.scale,
+                  singular = self.singular, modes = self.modes,
+                  p_min = self.p_min, p_len = self.p_len, params = self.params,
+                  coef_weights = self.coef_weights,
+                  function_names = np.array(self.function_names),
+                  function_weights = self.function_weights if self.function_weights is not None else np.zeros(0),
+                  energy = self.energy )
+
+    @staticmethod
+    def load(filename):
+        """ reads a model written by save() """
+
+        archive = np.load(filename)
+        rom = ROM( float(archive['energy']) )
+        rom.names = [ str(name) for name in archive['names'] ]
+        for key in ['coords','reduce','xyz','mean','scale','singular','modes',
+                    'p_min','p_len','params','coef_weights']:
+            setattr( rom, key, archive[key] )
+        rom.function_names = [ str(name) for name in archive['function_names'] ]
+        rom.function_weights = archive['function_weights'] if rom.function_names else None
+        return rom
+
+    # ------------------------------------------------------------------
+    #  Tall-Skinny QR
+    # ------------------------------------------------------------------
+
+    def _tsqr(self, X):
+        """ Q,R = _tsqr(X), Q is kept as the block factors """
+
+        blocks = range(0, X.shape[0], self.block)
+        Q_loc  = []
+        R_loc  = []
+        for begin in blocks:
+            q,r = np.linalg.qr( X[begin:begin+self.block,:] )
+            Q_loc.append(q)
+            R_loc.append(r)
+
+        Q_red,R = np.linalg.qr( np.vstack(R_loc) )
+
+        return (Q_loc,Q_red), R
+
+    def _qmult(self, Q, B):
+        """ Q*B for the block factors of _tsqr() """
+
+        Q_loc,Q_red = Q
+        QB = Q_red.dot(B)
+        out = []
+        offset = 0
+        for q in Q_loc:
+            out.append( q.dot( QB[offset:offset+q.shape[1],:] ) )
+            offset += q.shape[1]
+        return np.vstack(out)
+
+    # ------------------------------------------------------------------
+    #  Radial Basis Function Interpolation
+    # ------------------------------------------------------------------
+
+    def _rbf_matrix(self, P, C):
+        r = np.sqrt( ((P[:,None,:]-C[None,:,:])**2).sum(axis=2) )
+        return r**3
+
+    def _rbf_poly(self, P):
+        # linear polynomial only if the samples can determine it
+        if self.params.shape[0] > self.params.shape[1]+1:
+            return np.hstack([ np.ones((P.shape[0],1)), P ])
+        return np.ones((P.shape[0],1))
+
+    def _rbf_fit(self, values):
+        P = self.params
+        A = self._rbf_matrix(P,P)
+        B = self._rbf_poly(P)
+        n,m = B.shape
+        K = np.zeros((n+m,n+m))
+        K[:n,:n] = A
+        K[:n,n:] = B
+        K[n:,:n] = B.T
+        rhs = np.zeros( (n+m,values.shape[1]) )
+        rhs[:n,:] = values
+        return np.linalg.lstsq(K, rhs, rcond=None)[0]
+
+    def _rbf_eval(self, weights, params):
+        P = np.atleast_2d( (np.asarray(params, dtype=np.float64) - self.p_min)/self.p_len )
+        n = self.params.shape[0]
+        values = self._rbf_matrix(P,self.params).dot(weights[:n,:]) + self._rbf_poly(P).dot(weights[n:,:])
+        return values[0]
+
+#: class ROM()
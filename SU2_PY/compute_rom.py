@@ -0,0 +1,231 @@
+#!/usr/bin/env python
+
+## \file compute_rom.py
+#  \brief Python script for building and querying a reduced order model.
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# imports
+import numpy as np
+from optparse import OptionParser
+import os, sys, copy
+sys.path.append(os.environ['SU2_RUN'])
+import SU2
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+    # Command Line Options
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename",
+                      help="read config from FILE", metavar="FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of PARTITIONS", metavar="PARTITIONS")
+    parser.add_option("-p", "--parameters", dest="parameters", default="AOA",
+                      help="comma separated config PARAMETERS of the model", metavar="PARAMETERS")
+    parser.add_option("-t", "--train", dest="train", default=None,
+                      help="FILE of training samples, one per line", metavar="FILE")
+    parser.add_option("-s", "--samples", dest="samples", default=0,
+                      help="number of latin hypercube SAMPLES in the BOUNDS", metavar="SAMPLES")
+    parser.add_option("-b", "--bounds", dest="bounds", default=None,
+                      help="BOUNDS of the parameters, lower,upper;lower,upper;...", metavar="BOUNDS")
+    parser.add_option("-q", "--query", dest="query", default=None,
+                      help="FILE of query points, one per line", metavar="FILE")
+    parser.add_option("-m", "--model", dest="model", default="rom.npz",
+                      help="MODEL file, built if training samples are given", metavar="MODEL")
+    parser.add_option("-e", "--energy", dest="energy", default=0.9999,
+                      help="fraction of the snapshot ENERGY kept by the modes", metavar="ENERGY")
+    parser.add_option("-w", "--write-fields", dest="fields", default="NO",
+                      help="write the predicted restart files (YES/NO)", metavar="FIELDS")
+
+    (options, args)=parser.parse_args()
+    options.partitions = int( options.partitions )
+    options.samples    = int( options.samples )
+    options.energy     = float( options.energy )
+    options.fields     = options.fields.upper() == 'YES'
+    options.parameters = [ name.strip().upper() for name in options.parameters.split(',') ]
+
+    # load config
+    config = SU2.io.Config(options.filename)
+    config.NUMBER_PART = options.partitions
+
+    # offline stage
+    samples = None
+    if options.train:
+        samples = read_samples(options.train, len(options.parameters))
+    elif options.samples > 0:
+        if not options.bounds:
+            raise Exception('latin hypercube sampling needs the BOUNDS of the parameters')
+        bounds = np.array([ [ float(v) for v in b.split(',') ] for b in options.bounds.split(';') ])
+        samples = SU2.util.lhc_unif(bounds, options.samples)
+
+    if samples is not None:
+        rom = build_rom(config, options.parameters, samples, options.energy)
+        rom.save(options.model)
+        print('Reduced order model written to %s' % options.model)
+
+    # online stage
+    if options.query:
+        rom = SU2.util.ROM.load(options.model)
+        query = read_samples(options.query, len(options.parameters))
+        query_rom(config, rom, options.parameters, query, options.fields)
+
+#: def main()
+
+
+# -------------------------------------------------------------------
+#  Offline Stage
+# -------------------------------------------------------------------
+
+def build_rom(config, parameters, samples, energy):
+    """ runs the training samples, concurrently with CONCURRENT_EVALUATIONS,
+        and builds the model from their restart files
+    """
+
+    print('\n-------------------- Training %i samples --------------------\n' % len(samples))
+
+    scheduler = SU2.eval.Scheduler(config)
+    link = [ os.path.abspath(config.MESH_FILENAME) ]
+
+    for i,values in enumerate(samples):
+        folder = os.path.join('ROM', 'SAMPLE_%03d' % (i+1))
+        scheduler.submit( run_sample, config, folder, link, parameters, list(values) )
+
+    results = scheduler.wait()
+
+    snapshots = []
+    functions = []
+    names = None
+    for restart,funcs in results:
+        names,data,ext_iter,metadata = SU2.util.read_restart(restart)
+        snapshots.append(data)
+        functions.append(funcs)
+
+    rom = SU2.util.ROM(energy)
+    n_mode = rom.build(samples, snapshots, names, functions)
+
+    print('POD modes kept: %i of %i' % (n_mode, len(snapshots)))
+
+    return rom
+
+#: def build_rom()
+
+
+def run_sample(config, folder, link, parameters, values):
+    """ direct solution of one training sample in its own folder,
+        returns the absolute path of its restart file and its functions
+    """
+
+    konfig = copy.deepcopy(config)
+    for name,value in zip(parameters,values):
+        konfig[name] = value
+
+    # full restart files, read back by SU2.util.read_restart()
+    konfig.WRT_BINARY_RESTART  = 'YES'
+    konfig.WRT_COMPACT_RESTART = 'NO'
+
+    with SU2.io.redirect_folder(folder, link=link):
+        info = SU2.run.direct(konfig)
+        restart = os.path.abspath(konfig.RESTART_FLOW_FILENAME)
+
+    funcs = {}
+    for key,value in info.FUNCTIONS.items():
+        funcs[key] = float(value)
+
+    return restart, funcs
+
+#: def run_sample()
+
+
+# -------------------------------------------------------------------
+#  Online Stage
+# -------------------------------------------------------------------
+
+def query_rom(config, rom, parameters, query, fields):
+    """ prints and writes the predicted functions at the query points,
+        optionally the predicted restart files
+    """
+
+    output = open('rom_functions.csv','w')
+    output.write( ','.join( [ '"%s"' % name for name in parameters + rom.function_names ] ) + '\n' )
+
+    for i,values in enumerate(query):
+
+        funcs = rom.functions(values)
+        line  = [ '%.10e' % value for value in values ]
+        line += [ '%.10e' % funcs[name] for name in rom.function_names ]
+        output.write( ','.join(line) + '\n' )
+
+        print( ' '.join( [ '%s= %g' % (name,value) for name,value in zip(parameters,values) ] ) )
+        for name in rom.function_names:
+            print('    %s = %.8g' % (name, funcs[name]))
+
+        # the predicted field can be the initial guess (RESTART_SOL= YES) of a full solution
+        if fields:
+            metadata = np.zeros(8)
+            metadata[0] = float( dict(zip(parameters,values)).get('AOA', config.get('AOA',0.0)) )
+            metadata[1] = float( dict(zip(parameters,values)).get('SIDESLIP_ANGLE', config.get('SIDESLIP_ANGLE',0.0)) )
+            filename = 'restart_flow_rom_%03d.dat' % (i+1)
+            SU2.util.write_restart(filename, rom.names, rom.fields(values), 0, metadata)
+
+    output.close()
+
+#: def query_rom()
+
+
+def read_samples(filename, n_param):
+    """ reads a file of samples, one per line, separated by spaces or commas """
+
+    samples = []
+    for line in open(filename):
+        line = line.split('#')[0].replace(',',' ').split()
+        if not line: continue
+        if len(line) != n_param:
+            raise Exception('%s: expected %i values per line' % (filename, n_param))
+        samples.append( [ float(value) for value in line ] )
+
+    return np.array(samples)
+
+#: def read_samples()
+
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,134 @@
+#!/usr/bin/env python
+
+## \file mesh_sequencing.py
+#  \brief Python script for solving on a sequence of coarser meshes before the fine mesh.
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# imports
+from optparse import OptionParser
+import os, sys, copy
+sys.path.append(os.environ['SU2_RUN'])
+import SU2
+
+# -------------------------------------------------------------------
+#  Main
+# -------------------------------------------------------------------
+
+def main():
+
+    # Command Line Options
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename",
+                      help="read config from FILE", metavar="FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default=1,
+                      help="number of PARTITIONS", metavar="PARTITIONS")
+
+    (options, args)=parser.parse_args()
+    options.partitions = int( options.partitions )
+
+    # load config
+    config = SU2.io.Config(options.filename)
+    config.NUMBER_PART = options.partitions
+
+    mesh_sequencing(config)
+
+#: def main()
+
+
+# -------------------------------------------------------------------
+#  Mesh Sequencing
+# -------------------------------------------------------------------
+
+def mesh_sequencing(config):
+    """ mesh_sequencing(config)
+
+        Solves the direct problem on the meshes of MESH_SEQUENCE, coarsest
+        first, to a residual reduction of MESH_SEQUENCE_RESIDUAL orders of
+        magnitude. Each solution is interpolated (RESTART_INTERPOLATE= YES)
+        to initialize the next mesh, linearly in the elements of the previous
+        mesh if it is a native mesh file. The last one initializes the
+        solution on MESH_FILENAME, which is run with the settings of the config.
+    """
+
+    sequence = str( config.get('MESH_SEQUENCE','NONE') ).strip('() ')
+    meshes   = [ mesh.strip() for mesh in sequence.split(',') if mesh.strip() ]
+    if meshes == ['NONE']: meshes = []
+
+    reduction = float( config.get('MESH_SEQUENCE_RESIDUAL',3) )
+
+    restart = None
+    native  = config.get('MESH_FORMAT','SU2') == 'SU2'
+
+    for i,mesh in enumerate( meshes + [config.MESH_FILENAME] ):
+
+        konfig = copy.deepcopy(config)
+        konfig.MATH_PROBLEM       = 'DIRECT'
+        konfig.MESH_FILENAME      = mesh
+        konfig.WRT_BINARY_RESTART = 'YES'
+
+        # coarser meshes, loose convergence
+        if i < len(meshes):
+            print('\n-------------------- Mesh sequence %i of %i: %s --------------------\n' % (i+1, len(meshes), mesh))
+            konfig.CONV_CRITERIA         = 'RESIDUAL'
+            konfig.RESIDUAL_REDUCTION    = reduction
+            konfig.RESTART_FLOW_FILENAME = 'restart_flow_sequence_%i.dat' % (i+1)
+            konfig.CONV_FILENAME         = config.CONV_FILENAME + '_sequence_%i' % (i+1)
+            konfig.WRT_COMPACT_RESTART   = 'NO'
+        else:
+            print('\n-------------------- Fine mesh: %s --------------------\n' % mesh)
+
+        # start from the solution of the previous mesh
+        if restart:
+            konfig.RESTART_SOL            = 'YES'
+            konfig.READ_BINARY_RESTART    = 'YES'
+            konfig.RESTART_INTERPOLATE    = 'YES'
+            konfig.SOLUTION_FLOW_FILENAME = restart
+            # linear interpolation in the elements of the previous mesh
+            if native: konfig.RESTART_INTERPOLATE_MESH = previous
+
+        SU2.run.CFD(konfig)
+
+        restart  = konfig.RESTART_FLOW_FILENAME
+        previous = mesh
+
+#: def mesh_sequencing()
+
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
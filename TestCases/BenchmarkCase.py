@@ -0,0 +1,208 @@
+#!/usr/bin/env python
+
+## \file BenchmarkCase.py
+#  \brief Python class for the performance benchmarks of the SU2 test cases
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+
+from __future__ import print_function, division, absolute_import
+import time, os, subprocess, datetime, sys, re, csv
+
+
+class BenchmarkCase:
+    """ Runs one test case at several rank and thread counts and collects
+        the time per iteration, the parallel efficiency and the memory.
+
+        The time per iteration is taken from profiling.csv (builds with
+        -DPROFILE), as the time of the most expensive function of the
+        iteration group per call, and from the wall time of the whole run
+        otherwise. The memory is the peak resident set size of the largest
+        process of the run, the memory per DOF assumes that all the ranks
+        reach it.
+    """
+
+    def __init__(self,tag_in):
+
+        self.tag  = tag_in  # Input, string tag that identifies this case
+
+        # Configuration file path/filename
+        self.cfg_dir  = "."
+        self.cfg_file = "default.cfg"
+
+        # Iterations of the benchmark, set with iter_option in the cfg file
+        # (None keeps the cfg file, n_iter is then only used for the averages)
+        self.n_iter      = 10
+        self.iter_option = "EXT_ITER"
+
+        # Option with the number of threads per rank (None if the solver is not threaded)
+        self.thread_option = None
+
+        # Unknowns per grid point, for the memory per DOF
+        self.dof_per_point = 5
+
+        # These can be optionally varied
+        self.su2_exec = "SU2_CFD"
+        self.timeout  = 3600
+
+    def write_cfg(self, n_threads):
+        """ writes the cfg file of the benchmark, returns its name """
+
+        file_in = open(self.cfg_file, 'r')
+        lines   = file_in.readlines()
+        file_in.close()
+
+        replace = {}
+        if self.iter_option is not None:
+            replace[self.iter_option] = self.n_iter
+        if self.thread_option is not None:
+            replace[self.thread_option] = n_threads
+
+        bench_file = "%s.benchmark" % self.cfg_file
+        file_out = open(bench_file, 'w')
+        file_out.write('%% This file automatically generated by the benchmark script\n')
+        for line in lines:
+            key = line.split('=')[0].strip()
+            if key not in replace:
+                file_out.write(line)
+        for key in sorted(replace):
+            file_out.write("%s= %d\n" % (key, replace[key]))
+        file_out.close()
+
+        return bench_file
+
+    def run(self, n_ranks, n_threads, mpi_command):
+        """ runs the case once, returns a dictionary with the measurements """
+
+        result = { 'case'    : self.tag,
+                   'ranks'   : n_ranks,
+                   'threads' : n_threads,
+                   'success' : False }
+
+        if n_threads > 1 and self.thread_option is None:
+            result['error'] = 'not threaded'
+            return result
+
+        workdir = os.getcwd()
+        os.chdir(self.cfg_dir)
+
+        bench_file  = self.write_cfg(n_threads)
+        logfilename = '%s_%dx%d.log' % (os.path.splitext(self.cfg_file)[0], n_ranks, n_threads)
+        if os.path.exists('profiling.csv'):
+            os.remove('profiling.csv')
+
+        command = "%s %s" % (self.su2_exec, bench_file)
+        if n_ranks > 1:
+            command = mpi_command % (n_ranks, command)
+        command = "%s > %s 2>&1" % (command, logfilename)
+
+        # Run SU2, wait4 returns the resource usage of this run only
+        print('%s: %s' % (self.tag, command))
+        sys.stdout.flush()
+        start     = datetime.datetime.now()
+        process   = subprocess.Popen(command, shell=True)
+        timed_out = False
+        while True:
+            pid, status, usage = os.wait4(process.pid, os.WNOHANG)
+            if pid != 0:
+                break
+            if (datetime.datetime.now() - start).seconds > self.timeout and not timed_out:
+                process.kill()
+                os.system('killall %s' % self.su2_exec)   # In case of parallel execution
+                timed_out = True
+            time.sleep(0.1)
+        wall_time = (datetime.datetime.now() - start).total_seconds()
+
+        # ru_maxrss is in kB on Linux
+        result['wall_time']   = wall_time
+        result['peak_rss_mb'] = usage.ru_maxrss/1024.0
+
+        if timed_out or not os.WIFEXITED(status) or os.WEXITSTATUS(status) != 0:
+            result['error'] = 'timed out' if timed_out else 'exit status %d' % status
+            os.chdir(workdir)
+            return result
+
+        # Time per iteration
+        profile = self.read_profiling()
+        if profile is not None:
+            result['time_per_iter'] = profile
+            result['timer']         = 'profiling.csv'
+        else:
+            result['time_per_iter'] = wall_time/max(self.n_iter,1)
+            result['timer']         = 'wall'
+
+        # Memory per DOF (bytes)
+        n_points = self.read_points(logfilename)
+        if n_points is not None:
+            n_dof = n_points*self.dof_per_point
+            result['dofs']          = n_dof
+            result['memory_per_dof'] = usage.ru_maxrss*1024.0*n_ranks/n_dof
+
+        result['success'] = True
+        os.chdir(workdir)
+        return result
+
+    def read_profiling(self):
+        """ time per call of the most expensive function of the iteration group """
+
+        if not os.path.exists('profiling.csv'):
+            return None
+
+        time_iter = None
+        with open('profiling.csv', 'r') as f:
+            reader = csv.reader(f, skipinitialspace=True)
+            header = next(reader)
+            for row in reader:
+                entry = dict(zip(header, row))
+                try:
+                    if int(entry['Function_ID']) != 0:
+                        continue
+                    n_calls = max(int(entry['N_Calls']), 1)
+                    t = float(entry['Avg_Total_Time'])/n_calls
+                except (KeyError, ValueError):
+                    continue
+                if time_iter is None or t > time_iter:
+                    time_iter = t
+
+        return time_iter
+
+    def read_points(self, logfilename):
+        """ number of grid points printed by the preprocessing """
+
+        pattern = re.compile(r'^(\d+) (?:points|vertices|grid points)\b')
+        with open(logfilename, 'r') as f:
+            for line in f:
+                match = pattern.match(line.strip())
+                if match:
+                    return int(match.group(1))
+
+        return None
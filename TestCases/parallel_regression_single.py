@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+
+## \file parallel_regression_single.py
+#  \brief Python script for automated regression testing of SU2 examples
+#  \author A. Aranake, A. Campos, T. Economon, T. Lukaczyk, S. Padron
+#  \version 6.2.0 "Falcon"
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# make print(*args) function available in PY2.6+, does'nt work on PY < 2.6
+from __future__ import print_function
+
+import sys
+from TestCase import TestCase    
+
+def main():
+    '''This program runs SU2 built with --enable-single-precision and ensures
+       that the output matches specified values. '''
+
+    test_list = []
+
+    #########################################
+    ### Single precision compressible Euler ###
+    #########################################
+
+    # Inviscid NACA0012, writes the restart of the next case
+    single_naca0012           = TestCase('single_naca0012')
+    single_naca0012.cfg_dir   = "single_precision/naca0012"
+    single_naca0012.cfg_file  = "inv_NACA0012.cfg"
+    single_naca0012.test_iter = 49
+    single_naca0012.test_vals = [-5.416586, -4.942655, 0.329865, 0.021523] #last 4 columns
+    single_naca0012.su2_exec  = "mpirun -n 2 SU2_CFD"
+    single_naca0012.timeout   = 1600
+    single_naca0012.tol       = 0.00001
+    test_list.append(single_naca0012)
+
+    # Interpolated restart, the bounding boxes of the ranks are passive doubles
+    single_naca0012_interp           = TestCase('single_naca0012_interp')
+    single_naca0012_interp.cfg_dir   = "single_precision/naca0012"
+    single_naca0012_interp.cfg_file  = "inv_NACA0012_interp.cfg"
+    single_naca0012_interp.test_iter = 59
+    single_naca0012_interp.test_vals = [-5.717635, -5.245781, 0.328887, 0.021459] #last 4 columns
+    single_naca0012_interp.su2_exec  = "mpirun -n 2 SU2_CFD"
+    single_naca0012_interp.timeout   = 1600
+    single_naca0012_interp.tol       = 0.00001
+    test_list.append(single_naca0012_interp)
+
+    ######################################
+    ### RUN TESTS                      ###
+    ######################################
+
+    pass_list = [ test.run_test() for test in test_list ]
+
+    # Tests summary
+    print('==================================================================')
+    print('Summary of the single precision parallel tests')
+    print('python version:', sys.version)
+    for i, test in enumerate(test_list):
+        if (pass_list[i]):
+            print('  passed - %s'%test.tag)
+        else:
+            print('* FAILED - %s'%test.tag)
+
+    if all(pass_list):
+        sys.exit(0)
+    else:
+        sys.exit(1)
+    # done
+
+if __name__ == '__main__':
+    main()
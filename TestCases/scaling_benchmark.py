@@ -0,0 +1,203 @@
+#!/usr/bin/env python
+
+## \file scaling_benchmark.py
+#  \brief Python script for the performance benchmarks of SU2 (time per
+#         iteration, parallel efficiency and memory) on a set of test cases
+#  \author SU2 contributors
+#  \version 6.2.0 "Falcon"
+#
+#
+# The current SU2 release has been coordinated by the
+# SU2 International Developers Society <www.su2devsociety.org>
+# with selected contributions from the open-source community.
+#
+# The main research teams contributing to the current release are:
+#  - Prof. Juan J. Alonso's group at Stanford University.
+#  - Prof. Piero Colonna's group at Delft University of Technology.
+#  - Prof. Nicolas R. Gauger's group at Kaiserslautern University of Technology.
+#  - Prof. Alberto Guardone's group at Polytechnic University of Milan.
+#  - Prof. Rafael Palacios' group at Imperial College London.
+#  - Prof. Vincent Terrapon's group at the University of Liege.
+#  - Prof. Edwin van der Weide's group at the University of Twente.
+#  - Lab. of New Concepts in Aeronautics at Tech. Institute of Aeronautics.
+#
+# Copyright 2012-2019, Francisco D. Palacios, Thomas D. Economon,
+#                      Tim Albring, and the SU2 contributors.
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+
+from __future__ import print_function
+
+import os, sys, json
+from optparse import OptionParser
+from BenchmarkCase import BenchmarkCase
+
+def main():
+    '''This program runs a set of test cases at several rank and thread counts
+       and writes the time per iteration, the parallel efficiency and the
+       memory per DOF to a JSON file, to compare the performance of builds.
+       The parallel efficiency of a run is relative to the run of the same
+       case with the fewest cores (ranks*threads). '''
+
+    parser = OptionParser()
+    parser.add_option("-r", "--ranks",   dest="ranks",   default="1,2,4",
+                      help="comma separated MPI rank counts", metavar="RANKS")
+    parser.add_option("-t", "--threads", dest="threads", default="1",
+                      help="comma separated thread counts per rank, for the threaded solvers", metavar="THREADS")
+    parser.add_option("-c", "--cases",   dest="cases",   default="",
+                      help="comma separated tags of the cases to run (default all)", metavar="CASES")
+    parser.add_option("-o", "--output",  dest="output",  default="benchmark.json",
+                      help="JSON file with the results", metavar="FILE")
+
+    (options, args) = parser.parse_args()
+
+    ranks   = [int(n) for n in options.ranks.split(',')]
+    threads = [int(n) for n in options.threads.split(',')]
+
+    # Same convention as the python scripts of SU2_PY
+    mpi_command = os.environ.get('SU2_MPI_COMMAND', 'mpirun -n %i %s')
+
+    bench_list = []
+
+    ##########################
+    ### Compressible Euler ###
+    ##########################
+
+    # ONERA M6 Wing
+    oneram6               = BenchmarkCase('euler_oneram6')
+    oneram6.cfg_dir       = "euler/oneram6"
+    oneram6.cfg_file      = "inv_ONERAM6.cfg"
+    oneram6.n_iter        = 20
+    oneram6.dof_per_point = 5
+    bench_list.append(oneram6)
+
+    ##########################
+    ### Compressible RANS  ###
+    ##########################
+
+    # ONERA M6 Wing, SA
+    turb_oneram6               = BenchmarkCase('rans_oneram6')
+    turb_oneram6.cfg_dir       = "rans/oneram6"
+    turb_oneram6.cfg_file      = "turb_ONERAM6.cfg"
+    turb_oneram6.n_iter        = 20
+    turb_oneram6.dof_per_point = 6
+    bench_list.append(turb_oneram6)
+
+    ######################################
+    ### DG-FEM Euler                   ###
+    ######################################
+
+    # NACA0012, 5th order
+    fem_euler_naca0012               = BenchmarkCase('dg_naca0012')
+    fem_euler_naca0012.cfg_dir       = "hom_euler/NACA0012_5thOrder"
+    fem_euler_naca0012.cfg_file      = "fem_NACA0012_reg.cfg"
+    fem_euler_naca0012.n_iter        = 20
+    fem_euler_naca0012.thread_option = "NUMBER_THREADS_DGFEM"
+    fem_euler_naca0012.dof_per_point = 4
+    bench_list.append(fem_euler_naca0012)
+
+    ######################################
+    ### Structural analysis            ###
+    ######################################
+
+    # Static beam, 3D
+    statbeam3d               = BenchmarkCase('fea_statbeam3d')
+    statbeam3d.cfg_dir       = "fea_fsi/StatBeam_3d"
+    statbeam3d.cfg_file      = "configBeam_3d.cfg"
+    statbeam3d.n_iter        = 1
+    statbeam3d.iter_option   = None
+    statbeam3d.thread_option = "NUMBER_THREADS_FEA"
+    statbeam3d.dof_per_point = 3
+    bench_list.append(statbeam3d)
+
+    ######################################
+    ### FSI                            ###
+    ######################################
+
+    # 2D channel with a flexible wall, time per time step
+    fsi2d               = BenchmarkCase('fsi_wallchannel2d')
+    fsi2d.cfg_dir       = "fea_fsi/WallChannel_2d"
+    fsi2d.cfg_file      = "configFSI.cfg"
+    fsi2d.n_iter        = 3
+    fsi2d.iter_option   = "TIME_ITER"
+    fsi2d.dof_per_point = 4
+    bench_list.append(fsi2d)
+
+    ######################################
+    ### Discrete adjoint               ###
+    ######################################
+
+    # NACA0012, SA
+    discadj_rans_naca0012               = BenchmarkCase('discadj_rans_naca0012')
+    discadj_rans_naca0012.cfg_dir       = "disc_adj_rans/naca0012"
+    discadj_rans_naca0012.cfg_file      = "turb_NACA0012_sa.cfg"
+    discadj_rans_naca0012.n_iter        = 20
+    discadj_rans_naca0012.su2_exec      = "SU2_CFD_AD"
+    discadj_rans_naca0012.dof_per_point = 5
+    bench_list.append(discadj_rans_naca0012)
+
+    ######################################
+    ### RUN BENCHMARKS                 ###
+    ######################################
+
+    if options.cases:
+        tags = options.cases.split(',')
+        bench_list = [case for case in bench_list if case.tag in tags]
+
+    results = []
+    for case in bench_list:
+
+        case_results = []
+        for n_ranks in ranks:
+            for n_threads in threads:
+                if n_threads > 1 and case.thread_option is None:
+                    continue
+                case_results.append(case.run(n_ranks, n_threads, mpi_command))
+
+        # Parallel efficiency, relative to the run with the fewest cores
+        done = [r for r in case_results if r['success']]
+        if done:
+            ref = min(done, key=lambda r: r['ranks']*r['threads'])
+            for r in done:
+                cores = r['ranks']*r['threads']
+                ref_cores = ref['ranks']*ref['threads']
+                r['efficiency'] = ref['time_per_iter']*ref_cores/(r['time_per_iter']*cores)
+
+        for r in case_results:
+            if r['success']:
+                print('%-24s %4d x %-3d  %12.5e s/iter  eff %6.3f  %10.1f MB' %
+                      (r['case'], r['ranks'], r['threads'], r['time_per_iter'],
+                       r['efficiency'], r['peak_rss_mb']))
+            else:
+                print('%-24s %4d x %-3d  FAILED (%s)' %
+                      (r['case'], r['ranks'], r['threads'], r.get('error', '')))
+
+        results.extend(case_results)
+
+    with open(options.output, 'w') as f:
+        json.dump({'ranks' : ranks, 'threads' : threads, 'results' : results}, f, indent=2)
+
+    print('Results written to %s' % options.output)
+
+    if not all(r['success'] for r in results):
+        sys.exit(1)
+    else:
+        sys.exit(0)
+
+# -------------------------------------------------------------------
+#  Run Main Program
+# -------------------------------------------------------------------
+
+# this is only accessed if running from command prompt
+if __name__ == '__main__':
+    main()
@@ -6,6 +6,12 @@ AC_DEFUN([CONFIGURE_CODI],
     AC_ARG_ENABLE(codi-forward,
         AS_HELP_STRING([--enable-codi-forward], [build executables with codi forward datatype (default = no)]),
         [build_CODI_FORWARD="yes"], [build_CODI_FORWARD="no"])
+    AC_ARG_WITH(codi-forward-directions,
+        AS_HELP_STRING([--with-codi-forward-directions=N], [number of tangent directions propagated by the codi forward datatype (default = 1)]),
+        [codi_forward_directions="$withval"], [codi_forward_directions="1"])
+    AC_ARG_WITH(codi-tape,
+        AS_HELP_STRING([--with-codi-tape=TYPE], [tape of the codi reverse datatype: jacobian, jacobian-index, primal or primal-index (default = jacobian)]),
+        [codi_tape="$withval"], [codi_tape="jacobian"])
 
         CODIheader=${srcdir}/externals/codi/include/codi.hpp
         AMPIheader=${srcdir}/externals/medi/include/medi/medi.hpp
@@ -22,6 +28,10 @@ AC_DEFUN([CONFIGURE_CODI],
         if test "$build_CODI_FORWARD" == "yes"
         then
            DIRECTDIFF_CXX="-std=c++0x -DCODI_FORWARD_TYPE -I\$(top_srcdir)/externals/codi/include"
+           if test "$codi_forward_directions" != "1"
+           then
+              DIRECTDIFF_CXX=$DIRECTDIFF_CXX" -DCODI_FORWARD_DIRECTIONS=$codi_forward_directions"
+           fi
            build_DIRECTDIFF=yes
            if test "$enablempi" == "yes"
            then
@@ -37,6 +47,13 @@ AC_DEFUN([CONFIGURE_CODI],
         elif test "$build_CODI_REVERSE" == "yes"
         then
            REVERSE_CXX="-std=c++0x -DCODI_REVERSE_TYPE -I\$(top_srcdir)/externals/codi/include"
+           case "$codi_tape" in
+              jacobian)       ;;
+              jacobian-index) REVERSE_CXX=$REVERSE_CXX" -DCODI_INDEX_TAPE=1" ;;
+              primal)         REVERSE_CXX=$REVERSE_CXX" -DCODI_PRIMAL_TAPE=1" ;;
+              primal-index)   REVERSE_CXX=$REVERSE_CXX" -DCODI_PRIMAL_INDEX_TAPE=1" ;;
+              *) AC_MSG_ERROR([Unknown codi tape '$codi_tape', use jacobian, jacobian-index, primal or primal-index.]) ;;
+           esac
            if test "$enablempi" == "yes"
            then
               AC_CHECK_FILE([$AMPIheader], [have_AMPIheader='yes'], [have_AMPIheader='no'])
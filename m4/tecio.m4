@@ -39,8 +39,14 @@ AC_DEFUN([CONFIGURE_TECIO],
     esac
 
 
-     TECIO_INCLUDE="-I\$(top_srcdir)/externals/tecio/teciosrc"
-     TECIO_LIB="\$(top_builddir)/externals/tecio/libtecio.a"
+     # with MPI the ranks write their partitions of a .szplt file through TecIO-MPI
+     if (test "x$have_MPI" = xyes); then
+       TECIO_INCLUDE="-DTECIOMPI -I\$(top_srcdir)/externals/tecio/teciompisrc"
+       TECIO_LIB="\$(top_builddir)/externals/tecio/libteciompi.a"
+     else
+       TECIO_INCLUDE="-I\$(top_srcdir)/externals/tecio/teciosrc"
+       TECIO_LIB="\$(top_builddir)/externals/tecio/libtecio.a"
+     fi
      AC_DEFINE(HAVE_TECPLOT_API, 1, [Flag indicating whether the library will be compiled with Tecplot TecIO API support])
      AC_DEFINE(HAVE_TECPLOT_API_112, 1, [Flag indicating tecplot API understands newer features])
      AC_MSG_RESULT(<<< Configuring library with Tecplot TecIO support >>>)